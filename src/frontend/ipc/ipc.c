@@ -97,6 +97,9 @@ static void IPCICReset(FcitxIPCFrontend* ipc, FcitxInputContext* ic);
 static void IPCICSetCursorRect(FcitxIPCFrontend* ipc, FcitxInputContext* ic, int x, int y, int w, int h);
 static int IPCProcessKey(FcitxIPCFrontend* ipc, FcitxInputContext* callic, const uint32_t originsym, const uint32_t keycode, const uint32_t originstate, uint32_t t, FcitxKeyEventType type);
 static boolean IPCCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, FcitxInputContext* ic);
+static uintptr_t IPCHashICFilter(void* arg, void* priv);
+static uintptr_t IPCHashIC(void* arg, FcitxInputContext* context);
+static uintptr_t IPCHashICApplication(void* arg, FcitxInputContext* context);
 static void IPCEmitPropertiesChanged(void* arg, const char* const* properties);
 static void IPCEmitPropertyChanged(void* arg, const char* property);
 static void IPCGetPropertyIMList(void* arg, DBusMessageIter* iter);
@@ -336,7 +339,10 @@ FCITX_DEFINE_PLUGIN(fcitx_ipc, frontend, FcitxFrontend) = {
     IPCCheckICFromSameApplication,
     IPCGetPid,
     IPCDeleteSurroundingText,
-    IPCGetSurroundingText
+    IPCGetSurroundingText,
+    IPCHashICFilter,
+    IPCHashIC,
+    IPCHashICApplication
 };
 
 void* IPCCreate(FcitxInstance* instance, int frontendid)
@@ -1237,6 +1243,30 @@ boolean IPCCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, F
     return strcmp(ic2ToCheck->prgname, ic2->prgname) == 0;
 }
 
+uintptr_t IPCHashICFilter(void* arg, void* priv)
+{
+    FCITX_UNUSED(arg);
+    return *(int*) priv;
+}
+
+uintptr_t IPCHashIC(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    return GetIPCIC(context)->id;
+}
+
+uintptr_t IPCHashICApplication(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    const char* prgname = ((FcitxInputContext2*)context)->prgname;
+    uintptr_t hash = 0;
+    if (prgname) {
+        while (*prgname)
+            hash = hash * 31 + (uint8_t) *prgname++;
+    }
+    return hash;
+}
+
 void IPCEmitPropertiesChanged(void* arg, const char* const* properties)
 {
     if (!properties || !*properties)
@@ -95,6 +95,9 @@ static void PortalICReset(FcitxPortalFrontend* ipc, FcitxInputContext* ic);
 static void PortalICSetCursorRect(FcitxPortalFrontend* ipc, FcitxInputContext* ic, int x, int y, int w, int h);
 static int PortalProcessKey(FcitxPortalFrontend* ipc, FcitxInputContext* callic, const uint32_t originsym, const uint32_t keycode, const uint32_t originstate, uint32_t t, FcitxKeyEventType type);
 static boolean PortalCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, FcitxInputContext* ic);
+static uintptr_t PortalHashICFilter(void* arg, void* priv);
+static uintptr_t PortalHashIC(void* arg, FcitxInputContext* context);
+static uintptr_t PortalHashICApplication(void* arg, FcitxInputContext* context);
 static void PortalUpdateIMInfoForIC(void* arg);
 static pid_t PortalGetPid(void* arg, FcitxInputContext* ic);
 
@@ -202,7 +205,10 @@ FCITX_DEFINE_PLUGIN(fcitx_ipcportal, frontend, FcitxFrontend) = {
     PortalCheckICFromSameApplication,
     PortalGetPid,
     PortalDeleteSurroundingText,
-    PortalGetSurroundingText
+    PortalGetSurroundingText,
+    PortalHashICFilter,
+    PortalHashIC,
+    PortalHashICApplication
 };
 
 void* PortalCreate(FcitxInstance* instance, int frontendid)
@@ -772,6 +778,30 @@ boolean PortalCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck
     return strcmp(ic2ToCheck->prgname, ic2->prgname) == 0;
 }
 
+uintptr_t PortalHashICFilter(void* arg, void* priv)
+{
+    FCITX_UNUSED(arg);
+    return *(int*) priv;
+}
+
+uintptr_t PortalHashIC(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    return GetPortalIC(context)->id;
+}
+
+uintptr_t PortalHashICApplication(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    const char* prgname = ((FcitxInputContext2*)context)->prgname;
+    uintptr_t hash = 0;
+    if (prgname) {
+        while (*prgname)
+            hash = hash * 31 + (uint8_t) *prgname++;
+    }
+    return hash;
+}
+
 void PortalUpdateIMInfoForIC(void* arg)
 {
     FcitxPortalFrontend* ipc = (FcitxPortalFrontend*) arg;
@@ -360,4 +360,22 @@ boolean XimCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, F
     return ximictoCheck->connect_id == ximic->connect_id;
 }
 
+uintptr_t XimHashICFilter(void* arg, void* priv)
+{
+    FCITX_UNUSED(arg);
+    return *(CARD16*) priv;
+}
+
+uintptr_t XimHashIC(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    return GetXimIC(context)->id;
+}
+
+uintptr_t XimHashICApplication(void* arg, FcitxInputContext* context)
+{
+    FCITX_UNUSED(arg);
+    return GetXimIC(context)->connect_id;
+}
+
 // kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -93,6 +93,9 @@ boolean  XimCheckIC(void* arg, FcitxInputContext* arg1, void* arg2);
 void     XimSetIC(struct _FcitxXimFrontend* xim, IMChangeICStruct * call_data);
 void     XimGetIC(struct _FcitxXimFrontend* xim, IMChangeICStruct * call_data);
 boolean  XimCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, FcitxInputContext* ic);
+uintptr_t XimHashICFilter(void* arg, void* priv);
+uintptr_t XimHashIC(void* arg, FcitxInputContext* context);
+uintptr_t XimHashICApplication(void* arg, FcitxInputContext* context);
 
 #endif
 
@@ -100,7 +100,10 @@ FCITX_DEFINE_PLUGIN(fcitx_xim, frontend, FcitxFrontend) = {
     XimCheckICFromSameApplication,
     NULL,
     NULL,
-    NULL
+    NULL,
+    XimHashICFilter,
+    XimHashIC,
+    XimHashICApplication
 };
 
 FcitxXimFrontend *ximfrontend;
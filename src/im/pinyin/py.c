@@ -64,8 +64,11 @@ static void LoadPYPhraseDict(FcitxPinyinState* pystate, FILE* fp,
 static void ReloadConfigPY(void* arg);
 static void PinyinMigration();
 static int PYCandWordCmp(const void* b, const void* a, void* arg);
-static boolean PYGetPYMapByHZ(FcitxPinyinState*pystate, char *strHZ,
-                              char* mapHint, char *strMap);
+static void PYStartLoadDict(FcitxPinyinState* pystate);
+static void PYFinishLoadDict(FcitxPinyinState* pystate);
+static void PYFreeDict(FcitxPinyinState* pystate);
+static boolean PYGetPYMapByHZ(FcitxPinyinState*pystate, const char *strHZ,
+                              const char* mapHint, char *strMap);
 
 FCITX_DEFINE_PLUGIN(fcitx_pinyin, ime2, FcitxIMClass2) = {
     PYCreate,
@@ -133,18 +136,37 @@ void *PYCreate(FcitxInstance* instance)
     pystate->owner = instance;
 
     FcitxPinyinAddFunctions(instance);
+    PYStartLoadDict(pystate);
     return pystate;
 }
 
 void PYDestroy(void* arg)
 {
     FcitxPinyinState *pystate = (FcitxPinyinState*)arg;
+    PYJournalClose(pystate);
+    if (pystate->loader.bStarted) {
+        pthread_join(pystate->loader.thread, NULL);
+        PYFreeDict(pystate->loader.staging);
+        free(pystate->loader.staging);
+    }
     free(pystate->pyconfig.MHPY_C);
     free(pystate->pyconfig.MHPY_S);
     free(pystate->pyconfig.PYTable);
     FreePYSplitData(&pystate->pyconfig);
     FcitxConfigFree(&pystate->pyconfig.gconfig);
-    fcitx_memory_pool_destroy(pystate->pool);
+    PYFreeDict(pystate);
+
+    free(pystate);
+}
+
+static void PYFreeDict(FcitxPinyinState* pystate)
+{
+    if (pystate->pool) {
+        fcitx_memory_pool_destroy(pystate->pool);
+        pystate->pool = NULL;
+    }
+    PYPhraseIndexFree(pystate);
+    PYHZIndexFree(pystate);
 
     int i, j, k;
     PYFA *PYFAList = pystate->PYFAList;
@@ -165,19 +187,20 @@ void PYDestroy(void* arg)
         free(PYFAList[i].pyBase);
     }
     free(PYFAList);
+    pystate->PYFAList = NULL;
+    pystate->iPYFACount = 0;
 
-    while(pystate->pyFreq) {
+    while (pystate->pyFreq) {
         PyFreq* pCurFreq = pystate->pyFreq;
-        pystate->pyFreq = pCurFreq->next;
         while (pCurFreq->HZList) {
             HZ* pHZ = pCurFreq->HZList;
-            pCurFreq->HZList = pHZ->next;
+            HASH_DEL(pCurFreq->HZList, pHZ);
             free(pHZ);
         }
+        HASH_DEL(pystate->pyFreq, pCurFreq);
         free(pCurFreq);
     }
-
-    free(pystate);
+    pystate->iPYFreqCount = 0;
 }
 
 boolean PYInit(void *arg)
@@ -187,6 +210,7 @@ boolean PYInit(void *arg)
     FcitxInstanceSetContext(pystate->owner, CONTEXT_IM_KEYBOARD_LAYOUT, "us");
     FcitxInstanceSetContext(pystate->owner, CONTEXT_SHOW_REMIND_STATUS, &flag);
     pystate->bSP = false;
+    PYLatticeReset(pystate);
     return true;
 }
 
@@ -197,6 +221,7 @@ boolean SPInit(void *arg)
     FcitxInstanceSetContext(pystate->owner, CONTEXT_IM_KEYBOARD_LAYOUT, "us");
     FcitxInstanceSetContext(pystate->owner, CONTEXT_SHOW_REMIND_STATUS, &flag);
     pystate->bSP = true;
+    PYLatticeReset(pystate);
     FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
     pyconfig->cNonS = 'o';
     memcpy(pyconfig->SPMap_S, SPMap_S_Ziranma, sizeof(SPMap_S_Ziranma));
@@ -222,6 +247,7 @@ boolean LoadPYBaseDict(FcitxPinyinState *pystate)
     for (i = 0; i < pystate->iPYFACount; i++) {
         fread(PYFAList[i].strMap, sizeof(char) * 2, 1, fp);
         PYFAList[i].strMap[2] = '\0';
+        PYFAList[i].iSyllable = PYMapToSyllable(PYFAList[i].strMap);
 
         fcitx_utils_read_int32(fp, &PYFAList[i].iBase);
         PYFAList[i].pyBase = (PyBase*)fcitx_utils_malloc0(sizeof(PyBase) * PYFAList[i].iBase);
@@ -243,16 +269,63 @@ boolean LoadPYBaseDict(FcitxPinyinState *pystate)
     }
 
     fclose(fp);
+    PYHZIndexBuild(pystate);
     pystate->bPYBaseDictLoaded = true;
 
     pystate->iOrigCounter = pystate->iCounter;
 
-    pystate->pyFreq = fcitx_utils_new(PyFreq);
-    // pystate->pyFreq->next = NULL;
-
     return true;
 }
 
+static uint32_t PYPhraseHash(const PyPhrase* phrase)
+{
+    uint32_t hash = 2166136261u;
+    const char* p;
+    for (p = phrase->strMap; *p; p++)
+        hash = (hash ^ (uint8_t) *p) * 16777619u;
+    /* 拼音映射中不会出现 0xff */
+    hash = (hash ^ 0xff) * 16777619u;
+    for (p = phrase->strPhrase; *p; p++)
+        hash = (hash ^ (uint8_t) *p) * 16777619u;
+    return hash;
+}
+
+/*
+ * 开放定址的散列表，存放的是 phrase 中的序号加一，0 为空
+ */
+static int32_t* PYPhraseTableNew(const PyPhrase* phrase, int32_t count,
+                                 uint32_t* pMask)
+{
+    uint32_t size = 16;
+    int32_t i;
+    while (size < (uint32_t) count * 2)
+        size <<= 1;
+    int32_t* table = fcitx_utils_malloc0(sizeof(int32_t) * size);
+    for (i = 0; i < count; i++) {
+        uint32_t slot = PYPhraseHash(&phrase[i]) & (size - 1);
+        while (table[slot])
+            slot = (slot + 1) & (size - 1);
+        table[slot] = i + 1;
+    }
+    *pMask = size - 1;
+    return table;
+}
+
+static boolean PYPhraseTableContains(const int32_t* table, uint32_t mask,
+                                     const PyPhrase* phrases,
+                                     const PyPhrase* phrase)
+{
+    uint32_t slot = PYPhraseHash(phrase) & mask;
+    while (table[slot]) {
+        const PyPhrase* other = &phrases[table[slot] - 1];
+        if (!strcmp(other->strMap, phrase->strMap)
+            && !strcmp(other->strPhrase, phrase->strPhrase))
+            return true;
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
 void LoadPYPhraseDict(FcitxPinyinState* pystate, FILE *fp, boolean isSystem, boolean stripDup)
 {
     int j, k;
@@ -329,48 +402,36 @@ void LoadPYPhraseDict(FcitxPinyinState* pystate, FILE *fp, boolean isSystem, boo
         }
 
         if (isSystem) {
-            if (PYFAList[i].pyBase[j].iPhrase == 0) {
-                PYFAList[i].pyBase[j].iPhrase = count;
-                PYFAList[i].pyBase[j].phrase = temp;
+            PyBase* base = &PYFAList[i].pyBase[j];
+            if (base->iPhrase == 0) {
+                free(base->phrase);
+                base->iPhrase = count;
+                base->iPhraseSize = count;
+                base->phrase = temp;
             } else {
-                int m, n;
-                boolean *flag = fcitx_utils_malloc0(sizeof(boolean) * count);
-                int left = count;
-                phrase = temp;
-                if (stripDup) {
-                    for (m = 0; m < count; m++) {
-                        for (n = 0; n < PYFAList[i].pyBase[j].iPhrase; n++) {
-                            int result = strcmp(PYFAList[i].pyBase[j].phrase[n].strMap, phrase[m].strMap);
-                            if (result == 0) {
-                                if (strcmp(PYFAList[i].pyBase[j].phrase[n].strPhrase, phrase[m].strPhrase) == 0)
-                                    break;
-                            }
-                        }
-                        if (n != PYFAList[i].pyBase[j].iPhrase) {
-                            flag[m] = 1;
-                            left -- ;
-                        }
-                    }
-                }
-                int orig = PYFAList[i].pyBase[j].iPhrase;
-                if (left >= 0) {
-                    PYFAList[i].pyBase[j].iPhrase += left;
-                    PYFAList[i].pyBase[j].phrase = realloc(PYFAList[i].pyBase[j].phrase, sizeof(PyPhrase) * PYFAList[i].pyBase[j].iPhrase);
-                    //memcpy(phrase, oldph, sizeof(PyPhrase) * old);
+                int m;
+                int32_t* table = NULL;
+                uint32_t mask = 0;
+                /* 只与已有的词组比较，新词组之间的重复不去除 */
+                if (stripDup)
+                    table = PYPhraseTableNew(base->phrase, base->iPhrase, &mask);
+
+                if (base->iPhrase + count > base->iPhraseSize) {
+                    int size = base->iPhraseSize * 2;
+                    if (size < base->iPhrase + count)
+                        size = base->iPhrase + count;
+                    base->phrase = realloc(base->phrase, sizeof(PyPhrase) * size);
+                    base->iPhraseSize = size;
                 }
+
                 for (m = 0; m < count; m ++) {
-                    if (!flag[m]) {
-                        memcpy(&PYFAList[i].pyBase[j].phrase[orig], &phrase[m], sizeof(PyPhrase));
-                        orig ++ ;
-                    }
-                    else {
-                        // free(phrase[m].strMap);
-                        // free(phrase[m].strPhrase);
-                    }
+                    if (table && PYPhraseTableContains(table, mask, base->phrase, &temp[m]))
+                        continue;
+                    memcpy(&base->phrase[base->iPhrase], &temp[m], sizeof(PyPhrase));
+                    base->iPhrase++;
                 }
-                assert(orig == PYFAList[i].pyBase[j].iPhrase);
-                free(flag);
-                free(phrase);
+                free(table);
+                free(temp);
             }
         }
     }
@@ -382,8 +443,8 @@ boolean LoadPYOtherDict(FcitxPinyinState* pystate)
     FILE *fp;
     int32_t i, j, k, iLen;
     uint32_t iIndex;
-    PyFreq *pyFreqTemp, *pPyFreq;
-    HZ *HZTemp, *pHZ;
+    PyFreq *pyFreqTemp;
+    HZ *HZTemp;
     PYFA* PYFAList = pystate->PYFAList;
 
     pystate->bPYOtherDictLoaded = true;
@@ -462,46 +523,125 @@ boolean LoadPYOtherDict(FcitxPinyinState* pystate)
     //下面读取常用词表
     fp = FcitxXDGGetFileUserWithPrefix("pinyin", PY_FREQ_FILE, "r", NULL);
     if (fp) {
-        pPyFreq = pystate->pyFreq;
+        uint32_t iPYFreqCount, iCount;
 
-        fcitx_utils_read_uint32(fp, &pystate->iPYFreqCount);
+        fcitx_utils_read_uint32(fp, &iPYFreqCount);
 
-        for (i = 0; i < pystate->iPYFreqCount; i++) {
-            pyFreqTemp = fcitx_utils_new(PyFreq);
-            // pyFreqTemp->next = NULL;
+        for (i = 0; i < iPYFreqCount; i++) {
+            char strPY[12];
+            fread(strPY, sizeof(char) * 11, 1, fp);
+            strPY[11] = '\0';
+            fcitx_utils_read_uint32(fp, &iCount);
 
-            fread(pyFreqTemp->strPY, sizeof(char) * 11, 1, fp);
-            fcitx_utils_read_uint32(fp, &pyFreqTemp->iCount);
+            /* 重复的拼音合并到一起 */
+            pyFreqTemp = PYFindFreq(pystate, strPY);
+            if (!pyFreqTemp)
+                pyFreqTemp = PYNewFreq(pystate, strPY);
 
-            pyFreqTemp->HZList = fcitx_utils_new(HZ);
-            // pyFreqTemp->HZList->next = NULL;
-            pHZ = pyFreqTemp->HZList;
-
-            for (k = 0; k < pyFreqTemp->iCount; k++) {
+            for (k = 0; k < iCount; k++) {
                 int8_t slen;
-                HZTemp = fcitx_utils_new(HZ);
+                char strHZ[MAX_PY_PHRASE_LENGTH * UTF8_MAX_LENGTH + 1];
+                int32_t iPYFA;
+                uint32_t iHit;
                 fread(&slen, sizeof(int8_t), 1, fp);
-                fread(HZTemp->strHZ, sizeof(char) * slen, 1, fp);
-                HZTemp->strHZ[slen] = '\0';
-                fcitx_utils_read_int32(fp, &HZTemp->iPYFA);
-                fcitx_utils_read_uint32(fp, &HZTemp->iHit);
-                fcitx_utils_read_uint32(fp, &HZTemp->iIndex);
-                pHZ->next = HZTemp;
-                pHZ = HZTemp;
+                fread(strHZ, sizeof(char) * slen, 1, fp);
+                strHZ[slen] = '\0';
+                fcitx_utils_read_int32(fp, &iPYFA);
+                fcitx_utils_read_uint32(fp, &iHit);
+                fcitx_utils_read_uint32(fp, &iIndex);
+                if (PYFindFreqHZ(pyFreqTemp, strHZ))
+                    continue;
+                HZTemp = PYNewFreqHZ(pyFreqTemp, strHZ);
+                HZTemp->iPYFA = iPYFA;
+                HZTemp->iHit = iHit;
+                HZTemp->iIndex = iIndex;
             }
-
-            pPyFreq->next = pyFreqTemp;
-            pPyFreq = pyFreqTemp;
         }
 
         fclose(fp);
     }
+
+    PYPhraseIndexBuild(pystate);
     return true;
 }
 
+static void* PYLoadDictThread(void* arg)
+{
+    FcitxPinyinState* pystate = (FcitxPinyinState*) arg;
+    FcitxPinyinState* staging = pystate->loader.staging;
+
+    if (LoadPYBaseDict(staging))
+        LoadPYOtherDict(staging);
+    fcitx_utils_atomic_add(&pystate->loader.iDone, 1);
+    return NULL;
+}
+
+/*
+ * 启动时就在后台读入词库，读完之前只用主线程读入的单字
+ */
+static void PYStartLoadDict(FcitxPinyinState* pystate)
+{
+    PYLoader* loader = &pystate->loader;
+    loader->staging = fcitx_utils_new(FcitxPinyinState);
+    loader->staging->pool = fcitx_memory_pool_create();
+    loader->iDone = 0;
+    if (pthread_create(&loader->thread, NULL, PYLoadDictThread, pystate) != 0) {
+        FcitxLog(WARNING, _("Cannot create thread to load Pinyin dictionary"));
+        fcitx_memory_pool_destroy(loader->staging->pool);
+        free(loader->staging);
+        loader->staging = NULL;
+        return;
+    }
+    loader->bStarted = true;
+}
+
+/*
+ * 如果后台已经读完，换上新的词库，再重放日志，把读完之前的改动也加上。
+ * 候选词中有指向旧词库的指针，所以只在候选词为空时调用
+ */
+static void PYFinishLoadDict(FcitxPinyinState* pystate)
+{
+    PYLoader* loader = &pystate->loader;
+    if (!loader->bStarted || !fcitx_utils_atomic_add(&loader->iDone, 0))
+        return;
+
+    pthread_join(loader->thread, NULL);
+    loader->bStarted = false;
+    FcitxPinyinState* staging = loader->staging;
+    loader->staging = NULL;
+
+    if (!staging->bPYOtherDictLoaded) {
+        PYFreeDict(staging);
+        free(staging);
+        return;
+    }
+
+    uint32_t iCounter = pystate->iCounter;
+    PYFreeDict(pystate);
+    pystate->pool = staging->pool;
+    pystate->iPYFACount = staging->iPYFACount;
+    pystate->PYFAList = staging->PYFAList;
+    pystate->phraseIndex = staging->phraseIndex;
+    pystate->hzIndex = staging->hzIndex;
+    pystate->iCounter = staging->iCounter > iCounter ? staging->iCounter : iCounter;
+    pystate->iOrigCounter = staging->iOrigCounter;
+    pystate->bPYBaseDictLoaded = true;
+    pystate->bPYOtherDictLoaded = true;
+    pystate->pyFreq = staging->pyFreq;
+    pystate->iPYFreqCount = staging->iPYFreqCount;
+    free(staging);
+
+    pystate->iNewPYPhraseCount = 0;
+    pystate->iOrderCount = 0;
+    pystate->iNewFreqCount = 0;
+    PYJournalReplay(pystate);
+    PYLatticeReset(pystate);
+}
+
 void ResetPYStatus(void* arg)
 {
     FcitxPinyinState *pystate = (FcitxPinyinState*)arg;
+    PYFinishLoadDict(pystate);
     pystate->iPYInsertPoint = 0;
     pystate->iPYSelected = 0;
     pystate->strFindString[0] = '\0';
@@ -540,10 +680,15 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
     if (sym == 0 && state == 0)
         sym = FcitxKey_VoidSymbol;
 
+    if (!FcitxCandidateWordGetListSize(candList))
+        PYFinishLoadDict(pystate);
     if (!pystate->bPYBaseDictLoaded)
         LoadPYBaseDict(pystate);
-    if (!pystate->bPYOtherDictLoaded)
+    if (!pystate->bPYOtherDictLoaded && !pystate->loader.bStarted) {
         LoadPYOtherDict(pystate);
+        PYJournalReplay(pystate);
+        PYLatticeReset(pystate);
+    }
 
     retVal = IRV_TO_PROCESS;
 
@@ -582,7 +727,7 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
 
             pystate->strFindString[pystate->iPYInsertPoint++] = sym;
             pystate->strFindString[val + 1] = '\0';
-            ParsePY(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+            ParsePYCached(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
 
             val = 0;
             for (i = 0; i < pystate->iPYSelected; i++)
@@ -591,7 +736,7 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
             retVal = IRV_DISPLAY_CANDWORDS;
             if (pystate->findMap.iHZCount > (MAX_WORDS_USER_INPUT - val)) {
                 UpdateFindString(pystate, val);
-                ParsePY(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+                ParsePYCached(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
                 retVal = IRV_DO_NOTHING;
             }
 
@@ -605,7 +750,7 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
                 strcpy(pystate->strFindString, strTemp);
                 pystate->iPYInsertPoint += strlen(pystate->strFindString) - val;
                 pystate->iPYSelected--;
-                ParsePY(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+                ParsePYCached(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
 
                 retVal = IRV_DISPLAY_CANDWORDS;
             } else if (pystate->iPYInsertPoint) {
@@ -615,8 +760,9 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
                 val = ((pystate->iPYInsertPoint > 1)
                        && (move_src[-2] == PY_SEPARATOR)) ? 2 : 1;
                 memmove(move_src - val, move_src, strlen(move_src) + 1);
-                ParsePY(&pystate->pyconfig, pystate->strFindString,
-                        &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+                ParsePYCached(&pystate->pyconfig, pystate->strFindString,
+                              &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP,
+                              &pystate->parseCache);
                 pystate->iPYInsertPoint -= val;
 
                 if (!strlen(pystate->strFindString)) {
@@ -639,8 +785,9 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
             val = (move_dst[1] == PY_SEPARATOR) ? 2 : 1;
             memmove(move_dst, move_dst + val, strlen(move_dst + val) + 1);
 
-            ParsePY(&pystate->pyconfig, pystate->strFindString,
-                    &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+            ParsePYCached(&pystate->pyconfig, pystate->strFindString,
+                          &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP,
+                          &pystate->parseCache);
             if (!strlen(pystate->strFindString)) {
                 retVal = IRV_CLEAN;
             } else {
@@ -670,7 +817,7 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
                     strcpy(pystate->strFindString, strTemp);
                     pystate->iPYInsertPoint = strlen(pystate->strFindString) - val;
                     pystate->iPYSelected--;
-                    ParsePY(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+                    ParsePYCached(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
 
                     retVal = IRV_DISPLAY_CANDWORDS;
                 } else {
@@ -815,7 +962,7 @@ INPUT_RETURN_VALUE DoPYInput(void* arg, FcitxKeySym sym, unsigned int state)
                 }
             }
         } else if (sym == FcitxKey_VoidSymbol) {
-            ParsePY(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+            ParsePYCached(&pystate->pyconfig, pystate->strFindString, &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
             pystate->iPYInsertPoint = 0;
             retVal = IRV_DISPLAY_CANDWORDS;
         } else if (FcitxHotkeyIsHotKey(sym, state, FCITX_ESCAPE)) {
@@ -911,7 +1058,6 @@ void UpdateFindString(FcitxPinyinState* pystate, int val)
 
 INPUT_RETURN_VALUE PYGetCandWords(void* arg)
 {
-    int iVal;
     FcitxPinyinState *pystate = (FcitxPinyinState*) arg;
     FcitxInputState *input = FcitxInstanceGetInputState(pystate->owner);
     FcitxGlobalConfig* config = FcitxInstanceGetGlobalConfig(pystate->owner);
@@ -954,10 +1100,10 @@ INPUT_RETURN_VALUE PYGetCandWords(void* arg)
         candWord.owner = pystate;
         candWord.callback = PYGetCandWord;
         candWord.priv = NULL;
-        candWord.strWord = strdup(errorAuto);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, errorAuto);
         candWord.strExtra = NULL;
         candWord.wordType = MSG_OTHER;
-        FcitxCandidateWordAppend(candList, &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
         return IRV_DISPLAY_CANDWORDS;
     }
 
@@ -965,27 +1111,22 @@ INPUT_RETURN_VALUE PYGetCandWords(void* arg)
         return PYGetRemindCandWords(pystate);
 
     //判断是不是要输入常用字或符号
-    PyFreq* pCurFreq = pystate->pyFreq->next;
-    for (iVal = 0; iVal < pystate->iPYFreqCount; iVal++) {
-        if (!strcmp(pystate->strFindString, pCurFreq->strPY))
-            break;
-        pCurFreq = pCurFreq->next;
-    }
+    PyFreq* pCurFreq = PYFindFreq(pystate, pystate->strFindString);
 
     if (pystate->pyconfig.bPYCreateAuto)
         PYCreateAuto(pystate);
 
     if (pystate->strPYAuto[0]) {
         FcitxCandidateWord candWord;
-        PYCandWord* pycandword = fcitx_utils_new(PYCandWord);
+        PYCandWord* pycandword = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
         pycandword->iWhich = PY_CAND_AUTO;
         candWord.owner = pystate;
         candWord.callback = PYGetCandWord;
         candWord.priv = pycandword;
-        candWord.strWord = strdup(pystate->strPYAuto);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, pystate->strPYAuto);
         candWord.strExtra = NULL;
         candWord.wordType = MSG_OTHER;
-        FcitxCandidateWordAppend(candList, &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
 
     PYGetPhraseCandWords(pystate);
@@ -1008,157 +1149,15 @@ INPUT_RETURN_VALUE PYGetCandWords(void* arg)
  */
 void PYCreateAuto(FcitxPinyinState* pystate)
 {
-    PYCandIndex candPos;
-    int val;
-    int iMatchedLength;
-    char str[3];
-    PyPhrase *phrase;
-    PyPhrase *phraseSelected = NULL;
-    PyBase *baseSelected = NULL;
-    PYFA *pPYFA = NULL;
-    char strMap[MAX_WORDS_USER_INPUT * 2 + 1];
-    int iCount;
-    PYFA* PYFAList = pystate->PYFAList;
-    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
-
     pystate->strPYAuto[0] = '\0';
     pystate->strPYAutoMap[0] = '\0';
-    str[2] = '\0';
 
     if (pystate->findMap.iHZCount == 1)
         return;
 
-    while (fcitx_utf8_strlen(pystate->strPYAuto) < pystate->findMap.iHZCount) {
-        phraseSelected = NULL;
-        baseSelected = NULL;
-
-        iCount = fcitx_utf8_strlen(pystate->strPYAuto);
-        str[0] = pystate->findMap.strMap[iCount][0];
-        str[1] = pystate->findMap.strMap[iCount][1];
-
-        strMap[0] = '\0';
-
-        for (val = iCount + 1; val < pystate->findMap.iHZCount; val++)
-            strcat(strMap, pystate->findMap.strMap[val]);
-
-        candPos.iPYFA = 0;
-        candPos.iBase = 0;
-        candPos.iPhrase = 0;
-        if ((pystate->findMap.iHZCount - iCount) > 1) {
-            for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-                if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
-                    for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
-                        phrase = USER_PHRASE_NEXT(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].userPhrase);
-                        for (candPos.iPhrase = 0;
-                                candPos.iPhrase < PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iUserPhrase; candPos.iPhrase++) {
-                            val = CmpMap(pyconfig, phrase->strMap, strMap, &iMatchedLength, pystate->bSP);
-                            if (!val && iMatchedLength == (pystate->findMap.iHZCount - 1) * 2)
-                                return;
-                            if (!val || (val && (strlen(phrase->strMap) == iMatchedLength))) {
-                                if (!phraseSelected) {
-                                    baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                    pPYFA = &PYFAList[candPos.iPYFA];
-                                    phraseSelected = phrase;
-                                } else if (strlen(phrase->strMap) <= (pystate->findMap.iHZCount - 1) * 2) {
-                                    if (strlen(phrase->strMap) == strlen(phraseSelected->strMap)) {
-                                        //先看词频，如果词频一样，再最近优先
-                                        if ((phrase->iHit > phraseSelected->iHit)
-                                                || ((phrase->iHit == phraseSelected->iHit)
-                                                    && (phrase->iIndex > phraseSelected->iIndex))) {
-                                            baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                            pPYFA = &PYFAList[candPos.iPYFA];
-                                            phraseSelected = phrase;
-                                        }
-                                    } else if (strlen(phrase->strMap) > strlen(phraseSelected->strMap)) {
-                                        baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                        pPYFA = &PYFAList[candPos.iPYFA];
-                                        phraseSelected = phrase;
-                                    }
-                                }
-                            }
-                            phrase = USER_PHRASE_NEXT(phrase);
-                        }
-                    }
-                }
-            }
-
-            for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-                if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
-                    for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
-                        for (candPos.iPhrase = 0;
-                                candPos.iPhrase < PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iPhrase; candPos.iPhrase++) {
-                            val =
-                                CmpMap(pyconfig, PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap,
-                                       strMap, &iMatchedLength, pystate->bSP);
-                            if (!val && iMatchedLength == (pystate->findMap.iHZCount - 1) * 2)
-                                return;
-                            if (!val || (val && (strlen(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap)
-                                                 == iMatchedLength))) {
-                                if (!phraseSelected) {
-                                    baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                    pPYFA = &PYFAList[candPos.iPYFA];
-                                    phraseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase]);
-                                } else if (strlen(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap)
-                                           <= (pystate->findMap.iHZCount - 1) * 2) {
-                                    if (strlen(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap)
-                                            == strlen(phraseSelected->strMap)) {
-                                        //先看词频，如果词频一样，再最近优先
-                                        if ((PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].iHit >
-                                                phraseSelected->iHit)
-                                                ||
-                                                ((PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].iHit ==
-                                                  phraseSelected->iHit)
-                                                 &&
-                                                 (PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].iIndex >
-                                                  phraseSelected->iIndex))) {
-                                            baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                            pPYFA = &PYFAList[candPos.iPYFA];
-                                            phraseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase]);
-                                        }
-                                    } else if (strlen(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap)
-                                               > strlen(phraseSelected->strMap)) {
-                                        baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                                        pPYFA = &PYFAList[candPos.iPYFA];
-                                        phraseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase]);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            if (baseSelected) {
-                strcat(pystate->strPYAuto, baseSelected->strHZ);
-                strcat(pystate->strPYAutoMap, pPYFA->strMap);
-                strcat(pystate->strPYAuto, phraseSelected->strPhrase);
-                strcat(pystate->strPYAutoMap, phraseSelected->strMap);
-            }
-        }
-
-        if (!baseSelected) {
-            val = -1;
-            baseSelected = NULL;
-            for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-                if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
-                    for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
-                        if ((int)
-                                (PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iHit) > val) {
-                            val = PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iHit;
-                            baseSelected = &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase]);
-                            pPYFA = &PYFAList[candPos.iPYFA];
-                        }
-                    }
-                }
-            }
-
-            if (baseSelected) {
-                strcat(pystate->strPYAuto, baseSelected->strHZ);
-                strcat(pystate->strPYAutoMap, pPYFA->strMap);
-            } else {            //出错了
-                pystate->strPYAuto[0] = '\0';
-                return;
-            }
-        }
+    if (!PYLatticeGetSentence(pystate, pystate->strPYAuto, pystate->strPYAutoMap)) {
+        pystate->strPYAuto[0] = '\0';
+        pystate->strPYAutoMap[0] = '\0';
     }
 }
 
@@ -1172,6 +1171,9 @@ INPUT_RETURN_VALUE PYGetCandWord(void* arg, FcitxCandidateWord* candWord)
         return IRV_COMMIT_STRING;
     }
 
+    /* 词频会改变 */
+    PYLatticeReset(pystate);
+
     char *pBase = NULL, *pPhrase = NULL;
     char *pBaseMap = NULL, *pPhraseMap = NULL;
     unsigned int *pIndex = NULL;
@@ -1231,11 +1233,27 @@ INPUT_RETURN_VALUE PYGetCandWord(void* arg, FcitxCandidateWord* candWord)
 
     if (pIndex && (*pIndex != pystate->iCounter))
         *pIndex = ++pystate->iCounter;
-    if (pystate->iOrderCount >= AUTOSAVE_ORDER_COUNT) {
-        SavePYIndex(pystate);
-    }
-    if (pystate->iNewFreqCount >= AUTOSAVE_FREQ_COUNT) {
-        SavePYFreq(pystate);
+    switch (pycandWord->iWhich) {
+    case PY_CAND_BASE:
+        PYJournalIndex(pystate, pycandWord->cand.base.iPYFA,
+                       pycandWord->cand.base.iBase, -1);
+        break;
+    case PY_CAND_SYSPHRASE:
+        PYJournalIndex(pystate, pycandWord->cand.phrase.iPYFA,
+                       pycandWord->cand.phrase.iBase,
+                       pycandWord->cand.phrase.phrase - PYFAList[pycandWord->cand.phrase.iPYFA].pyBase[pycandWord->cand.phrase.iBase].phrase);
+        break;
+    case PY_CAND_USERPHRASE:
+        PYJournalUserPhrase(pystate, pycandWord->cand.phrase.iPYFA,
+                            pycandWord->cand.phrase.iBase,
+                            pycandWord->cand.phrase.phrase, false);
+        break;
+    case PY_CAND_FREQ:
+        PYJournalFreq(pystate, pycandWord->cand.freq.pyFreq,
+                      pycandWord->cand.freq.hz, false);
+        break;
+    default:
+        break;
     }
 
     strcpy(strHZString, pBase);
@@ -1247,7 +1265,7 @@ INPUT_RETURN_VALUE PYGetCandWord(void* arg, FcitxCandidateWord* candWord)
         for (iLen = 0; iLen < pystate->iPYSelected; iLen++)
             strcat(pystate->strPYAuto, pystate->pySelected[iLen].strHZ);
         strcat(pystate->strPYAuto, strHZString);
-        ParsePY(&pystate->pyconfig, FcitxInputStateGetRawInputBuffer(input), &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP);
+        ParsePYCached(&pystate->pyconfig, FcitxInputStateGetRawInputBuffer(input), &pystate->findMap, PY_PARSE_INPUT_USER, pystate->bSP, &pystate->parseCache);
         strHZString[0] = '\0';
         for (i = 0; i < pystate->iPYSelected; i++)
             strcat(strHZString, pystate->pySelected[i].strMap);
@@ -1301,12 +1319,11 @@ void PYGetPhraseCandWords(FcitxPinyinState* pystate)
 {
     PYCandIndex candPos;
     char str[3];
-    int val, iMatchedLength;
+    int val;
     char strMap[MAX_WORDS_USER_INPUT * 2 + 1];
-    PyPhrase *phrase;
     PYFA* PYFAList = pystate->PYFAList;
-    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
     FcitxInputState* input = FcitxInstanceGetInputState(pystate->owner);
+    FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
 
     if (pystate->findMap.iHZCount == 1)
         return;
@@ -1320,45 +1337,35 @@ void PYGetPhraseCandWords(FcitxPinyinState* pystate)
     strMap[0] = '\0';
     for (val = 1; val < pystate->findMap.iHZCount; val++)
         strcat(strMap, pystate->findMap.strMap[val]);
-    for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-        if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
-            for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
-                phrase = USER_PHRASE_NEXT(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].userPhrase);
-                for (candPos.iPhrase = 0;
-                        candPos.iPhrase < PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iUserPhrase; candPos.iPhrase++) {
-                    val = CmpMap(pyconfig, phrase->strMap, strMap, &iMatchedLength, pystate->bSP);
-                    if (!val || (val && (strlen(phrase->strMap) == iMatchedLength))) {
-                        PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
-                        PYAddPhraseCandWord(pystate, candPos, phrase, false, pycandWord);
-                        utarray_push_back(&candtemp, &pycandWord);
-                    }
 
-                    phrase = USER_PHRASE_NEXT(phrase);
-                }
-            }
-        }
-    }
-
-    for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-        if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
-            for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
-                for (candPos.iPhrase = 0; candPos.iPhrase < PYFAList[candPos.iPYFA].pyBase[candPos.iBase].iPhrase; candPos.iPhrase++) {
-                    val = CmpMap(
-                              pyconfig,
-                              PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap,
-                              strMap,
-                              &iMatchedLength,
-                              pystate->bSP);
-                    if (!val ||
-                            (val && (strlen(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase].strMap) == iMatchedLength))) {
-                        PYCandWord* pycandWord = fcitx_utils_new(PYCandWord);
-                        PYAddPhraseCandWord(pystate, candPos, &(PYFAList[candPos.iPYFA].pyBase[candPos.iBase].phrase[candPos.iPhrase]), true, pycandWord);
-                        utarray_push_back(&candtemp, &pycandWord);
-                    }
-                }
-            }
-        }
-    }
+    UT_array matches;
+    utarray_init(&matches, &py_phrase_match_icd);
+    PYPhraseMatch* match;
+
+    PYPhraseIndexMatch(pystate, str, strMap, true, &matches);
+    for (match = (PYPhraseMatch*) utarray_front(&matches);
+            match != NULL;
+            match = (PYPhraseMatch*) utarray_next(&matches, match)) {
+        candPos.iPYFA = match->iPYFA;
+        candPos.iBase = match->iBase;
+        candPos.iPhrase = match->iPhrase;
+        PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
+        PYAddPhraseCandWord(pystate, candPos, match->phrase, false, pycandWord);
+        utarray_push_back(&candtemp, &pycandWord);
+    }
+
+    PYPhraseIndexMatch(pystate, str, strMap, false, &matches);
+    for (match = (PYPhraseMatch*) utarray_front(&matches);
+            match != NULL;
+            match = (PYPhraseMatch*) utarray_next(&matches, match)) {
+        candPos.iPYFA = match->iPYFA;
+        candPos.iBase = match->iBase;
+        candPos.iPhrase = match->iPhrase;
+        PYCandWord* pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
+        PYAddPhraseCandWord(pystate, candPos, match->phrase, true, pycandWord);
+        utarray_push_back(&candtemp, &pycandWord);
+    }
+    utarray_done(&matches);
 
     PYCandWordSortContext context;
     context.order = pystate->pyconfig.phraseOrder;
@@ -1383,9 +1390,11 @@ void PYGetPhraseCandWords(FcitxPinyinState* pystate)
             candWord.wordType = MSG_OTHER;
         const char* pBase = PYFAList[(*pcand)->cand.phrase.iPYFA].pyBase[(*pcand)->cand.phrase.iBase].strHZ;
         const char* pPhrase = (*pcand)->cand.phrase.phrase->strPhrase;
-        fcitx_utils_alloc_cat_str(candWord.strWord, pBase, pPhrase);
-        FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input),
-                                 &candWord);
+        size_t baseLen = strlen(pBase);
+        candWord.strWord = FcitxCandidateWordArenaAlloc(candList, baseLen + strlen(pPhrase) + 1);
+        memcpy(candWord.strWord, pBase, baseLen);
+        strcpy(candWord.strWord + baseLen, pPhrase);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
 
     utarray_done(&candtemp);
@@ -1426,17 +1435,20 @@ void PYGetBaseCandWords(FcitxPinyinState* pystate, PyFreq* pCurFreq)
     PYFA* PYFAList = pystate->PYFAList;
     FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
     FcitxInputState* input = FcitxInstanceGetInputState(pystate->owner);
+    FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
     UT_array candtemp;
     utarray_init(&candtemp, fcitx_ptr_icd);
 
     str[0] = pystate->findMap.strMap[0][0];
     str[1] = pystate->findMap.strMap[0][1];
     str[2] = '\0';
+    PYSyllableMask mask;
+    PYSyllableMaskFor2Map(pyconfig, str, pystate->bSP, &mask);
     for (candPos.iPYFA = 0; candPos.iPYFA < pystate->iPYFACount; candPos.iPYFA++) {
-        if (!Cmp2Map(pyconfig, PYFAList[candPos.iPYFA].strMap, str, pystate->bSP)) {
+        if (PYSyllableMatch(&mask, PYFAList[candPos.iPYFA].iSyllable)) {
             for (candPos.iBase = 0; candPos.iBase < PYFAList[candPos.iPYFA].iBase; candPos.iBase++) {
                 if (!PYIsInFreq(pCurFreq, PYFAList[candPos.iPYFA].pyBase[candPos.iBase].strHZ)) {
-                    PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+                    PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
                     PYAddBaseCandWord(candPos, pycandWord);
                     utarray_push_back(&candtemp, &pycandWord);
                 }
@@ -1460,10 +1472,10 @@ void PYGetBaseCandWords(FcitxPinyinState* pystate, PyFreq* pCurFreq)
         candWord.owner = pystate;
         candWord.priv = *pcand;
         candWord.strExtra = NULL;
-        candWord.strWord = strdup(PYFAList[(*pcand)->cand.base.iPYFA].pyBase[(*pcand)->cand.base.iBase].strHZ);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, PYFAList[(*pcand)->cand.base.iPYFA].pyBase[(*pcand)->cand.base.iBase].strHZ);
         candWord.wordType = MSG_OTHER;
 
-        FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input), &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
 
     utarray_done(&candtemp);
@@ -1481,19 +1493,17 @@ void PYAddBaseCandWord(PYCandIndex pos, PYCandWord* pycandWord)
 
 void PYGetFreqCandWords(FcitxPinyinState* pystate, PyFreq* pCurFreq)
 {
-    int i;
     HZ *hz;
     UT_array candtemp;
     FcitxInputState* input = FcitxInstanceGetInputState(pystate->owner);
+    FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
     utarray_init(&candtemp, fcitx_ptr_icd);
 
     if (pCurFreq) {
-        hz = pCurFreq->HZList->next;
-        for (i = 0; i < pCurFreq->iCount; i++) {
-            PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+        for (hz = pCurFreq->HZList; hz; hz = hz->hh.next) {
+            PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
             PYAddFreqCandWord(pCurFreq, hz, pCurFreq->strPY, pycandWord);
             utarray_push_back(&candtemp, &pycandWord);
-            hz = hz->next;
         }
     }
 
@@ -1513,10 +1523,10 @@ void PYGetFreqCandWords(FcitxPinyinState* pystate, PyFreq* pCurFreq)
         candWord.owner = pystate;
         candWord.priv = *pcand;
         candWord.strExtra = NULL;
-        candWord.strWord = strdup((*pcand)->cand.freq.hz->strHZ);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, (*pcand)->cand.freq.hz->strHZ);
         candWord.wordType = MSG_USERPHR;
 
-        FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input), &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
 
     utarray_done(&candtemp);
@@ -1549,6 +1559,7 @@ boolean PYAddUserPhrase(FcitxPinyinState* pystate, const char *phrase, const cha
     //如果短于两个汉字，则不能组成词组
     if (fcitx_utf8_strlen(phrase) < 2)
         return false;
+    PYLatticeReset(pystate);
     str[0] = map[0];
     str[1] = map[1];
     str[2] = '\0';
@@ -1567,6 +1578,8 @@ boolean PYAddUserPhrase(FcitxPinyinState* pystate, const char *phrase, const cha
             if (incHit) {
                 userPhrase->phrase.iHit ++;
                 userPhrase->phrase.iIndex = ++pystate->iCounter;
+                pystate->iNewPYPhraseCount++;
+                PYJournalUserPhrase(pystate, i, j, &userPhrase->phrase, false);
             }
             return false;
         }
@@ -1580,6 +1593,8 @@ boolean PYAddUserPhrase(FcitxPinyinState* pystate, const char *phrase, const cha
             if (incHit) {
                 PYFAList[i].pyBase[j].phrase[k].iHit ++;
                 PYFAList[i].pyBase[j].phrase[k].iIndex = ++pystate->iCounter;
+                pystate->iOrderCount++;
+                PYJournalIndex(pystate, i, j, k);
             }
             return false;
         }
@@ -1603,10 +1618,9 @@ boolean PYAddUserPhrase(FcitxPinyinState* pystate, const char *phrase, const cha
     newPhrase->next = temp->next;
     temp->next = newPhrase;
     PYFAList[i].pyBase[j].iUserPhrase++;
+    PYPhraseIndexInsertUser(pystate, i, j, newPhrase);
     pystate->iNewPYPhraseCount++;
-    if (pystate->iNewPYPhraseCount >= AUTOSAVE_PHRASE_COUNT) {
-        SavePYUserPhrase(pystate);
-    }
+    PYJournalUserPhrase(pystate, i, j, &newPhrase->phrase, false);
 
     return true;
 }
@@ -1625,15 +1639,245 @@ void PYDelUserPhrase(FcitxPinyinState* pystate, int32_t iPYFA, int iBase, PyUsrP
     }
     if (!temp)
         return;
+    PYLatticeReset(pystate);
+    PYJournalUserPhrase(pystate, iPYFA, iBase, &phrase->phrase, true);
     temp->next = phrase->next;
+    PYPhraseIndexRemoveUser(pystate, iPYFA, iBase, phrase);
     free(phrase->phrase.strPhrase);
     free(phrase->phrase.strMap);
     free(phrase);
     PYFAList[iPYFA].pyBase[iBase].iUserPhrase--;
     pystate->iNewPYPhraseCount++;
-    if (pystate->iNewPYPhraseCount >= AUTOSAVE_PHRASE_COUNT) {
-        SavePYUserPhrase(pystate);
+}
+
+typedef struct {
+    int32_t         iPYFA;
+    int32_t         iBase;
+    int             iOrder;
+    const char     *strMap;     /* 不含第一个字的拼音映射 */
+    const char     *strPhrase;  /* 不含第一个字的词组 */
+} PYUserPhraseImportItem;
+
+static const UT_icd py_user_phrase_import_icd = {
+    sizeof(PYUserPhraseImportItem), NULL, NULL, NULL
+};
+
+/*
+ * 同一个字的词组放在一起，每组内与用户词组链表一样按拼音映射从大到小排列
+ */
+static int PYUserPhraseImportCmp(const void* a, const void* b)
+{
+    const PYUserPhraseImportItem* itemA = a;
+    const PYUserPhraseImportItem* itemB = b;
+    int result;
+
+    if (itemA->iPYFA != itemB->iPYFA)
+        return itemA->iPYFA - itemB->iPYFA;
+    if (itemA->iBase != itemB->iBase)
+        return itemA->iBase - itemB->iBase;
+    result = strcmp(itemB->strMap, itemA->strMap);
+    if (result)
+        return result;
+    return itemA->iOrder - itemB->iOrder;
+}
+
+/*
+ * 把 [begin, end) 中同一个字的词组合并进它的用户词组链表，
+ * 已有的用户词组和系统词组用散列表去重，链表只走一遍
+ */
+static int PYMergeUserPhrase(FcitxPinyinState* pystate,
+                             PYUserPhraseImportItem* begin,
+                             PYUserPhraseImportItem* end)
+{
+    PyBase* base = &pystate->PYFAList[begin->iPYFA].pyBase[begin->iBase];
+    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
+    FcitxStringHashSet* seen = NULL;
+    PyUsrPhrase *userPhrase, *temp, *newPhrase;
+    PYUserPhraseImportItem* item;
+    char* key;
+    int k, iTemp, iAdded = 0;
+
+    userPhrase = base->userPhrase->next;
+    for (k = 0; k < base->iUserPhrase; k++) {
+        /* 拼音映射中没有空格 */
+        fcitx_utils_alloc_cat_str(key, userPhrase->phrase.strMap, " ",
+                                  userPhrase->phrase.strPhrase);
+        seen = fcitx_utils_string_hash_set_insert(seen, key);
+        free(key);
+        userPhrase = userPhrase->next;
+    }
+    for (k = 0; k < base->iPhrase; k++) {
+        fcitx_utils_alloc_cat_str(key, base->phrase[k].strMap, " ",
+                                  base->phrase[k].strPhrase);
+        seen = fcitx_utils_string_hash_set_insert(seen, key);
+        free(key);
     }
+
+    temp = base->userPhrase;
+    k = 0;
+    for (item = begin; item < end; item++) {
+        fcitx_utils_alloc_cat_str(key, item->strMap, " ", item->strPhrase);
+        if (fcitx_utils_string_hash_set_contains(seen, key)) {
+            free(key);
+            continue;
+        }
+        seen = fcitx_utils_string_hash_set_insert(seen, key);
+        free(key);
+
+        /* 与 PYAddUserPhrase 相同，插到第一个比它小的词组之前 */
+        while (k < base->iUserPhrase) {
+            if (CmpMap(pyconfig, item->strMap, temp->next->phrase.strMap,
+                       &iTemp, pystate->bSP) > 0)
+                break;
+            temp = temp->next;
+            k++;
+        }
+
+        newPhrase = fcitx_utils_new(PyUsrPhrase);
+        newPhrase->phrase.strMap = strdup(item->strMap);
+        newPhrase->phrase.strPhrase = strdup(item->strPhrase);
+        newPhrase->phrase.iIndex = ++pystate->iCounter;
+        newPhrase->phrase.iHit = 1;
+        newPhrase->next = temp->next;
+        temp->next = newPhrase;
+        temp = newPhrase;
+        k++;
+        base->iUserPhrase++;
+        PYPhraseIndexInsertUser(pystate, begin->iPYFA, begin->iBase, newPhrase);
+        iAdded++;
+    }
+
+    fcitx_utils_free_string_hash_set(seen);
+    return iAdded;
+}
+
+/*
+ * 一次加入很多用户词组，strPhrase 和 strMap 都是完整的词组和拼音映射。
+ * 与逐个调用 PYAddUserPhrase 不同，这里不写日志，也不增加已有词组的
+ * 词频，调用者应在最后调用 PYJournalCompact 保存一次。
+ * 返回新加入的词组数
+ */
+int PYAddUserPhraseBatch(FcitxPinyinState* pystate, const char* const* strPhrase,
+                         const char* const* strMap, int count)
+{
+    UT_array items;
+    PYUserPhraseImportItem item, *begin, *end, *cur;
+    char str[UTF8_MAX_LENGTH + 1];
+    int i, clen, iAdded = 0;
+
+    utarray_init(&items, &py_user_phrase_import_icd);
+    for (i = 0; i < count; i++) {
+        size_t len = fcitx_utf8_strlen(strPhrase[i]);
+        if (len < 2 || strlen(strMap[i]) != len * 2)
+            continue;
+
+        strncpy(str, strMap[i], 2);
+        str[2] = '\0';
+        item.iPYFA = GetBaseMapIndex(pystate, str);
+        if (item.iPYFA == -1)
+            continue;
+
+        clen = fcitx_utf8_char_len(strPhrase[i]);
+        strncpy(str, strPhrase[i], clen);
+        str[clen] = '\0';
+        item.iBase = GetBaseIndex(pystate, item.iPYFA, str);
+        if (item.iBase == -1)
+            continue;
+
+        item.iOrder = i;
+        item.strMap = strMap[i] + 2;
+        item.strPhrase = strPhrase[i] + clen;
+        utarray_push_back(&items, &item);
+    }
+
+    if (utarray_len(&items)) {
+        PYLatticeReset(pystate);
+        utarray_sort(&items, PYUserPhraseImportCmp);
+
+        begin = (PYUserPhraseImportItem*) utarray_front(&items);
+        end = begin + utarray_len(&items);
+        while (begin < end) {
+            for (cur = begin + 1; cur < end; cur++) {
+                if (cur->iPYFA != begin->iPYFA || cur->iBase != begin->iBase)
+                    break;
+            }
+            iAdded += PYMergeUserPhrase(pystate, begin, cur);
+            begin = cur;
+        }
+    }
+    utarray_done(&items);
+
+    pystate->iNewPYPhraseCount += iAdded;
+    return iAdded;
+}
+
+/*
+ * 导入 .org 格式的词库文件作为用户词组，全部加入后保存一次。
+ * 返回新加入的词组数，失败时返回 -1
+ */
+int PYImportUserPhraseFile(FcitxPinyinState* pystate, const char* path)
+{
+    FILE *fp;
+    char *buf = NULL, *phrase;
+    char strMap[MAX_PY_PHRASE_LENGTH * 2 + 1];
+    size_t bufLen = 0;
+    UT_array phrases, maps;
+    int iAdded;
+
+    /*
+     * 后台读入已经结束时先换上新词库，但拼音的候选词中有指向旧词库的指针，
+     * 此时只能等到候选词清空
+     */
+    FcitxInputState* input = FcitxInstanceGetInputState(pystate->owner);
+    FcitxCandidateWord* candWord = FcitxCandidateWordGetFirst(FcitxInputStateGetCandidateList(input));
+    if (!candWord || candWord->owner != pystate)
+        PYFinishLoadDict(pystate);
+
+    /* 后台读入的词库会替换当前的词库，导入的词组会丢失 */
+    if (pystate->loader.bStarted) {
+        if (fcitx_utils_atomic_add(&pystate->loader.iDone, 0))
+            FcitxLog(WARNING, _("Pinyin candidates are in use, try later"));
+        else
+            FcitxLog(WARNING, _("Pinyin dictionary is still loading, try later"));
+        return -1;
+    }
+
+    fp = fopen(path, "r");
+    if (!fp) {
+        FcitxLog(ERROR, _("Cannot open phrase file %s"), path);
+        return -1;
+    }
+
+    if (!pystate->bPYBaseDictLoaded)
+        LoadPYBaseDict(pystate);
+    if (!pystate->bPYOtherDictLoaded) {
+        LoadPYOtherDict(pystate);
+        PYJournalReplay(pystate);
+        PYLatticeReset(pystate);
+    }
+
+    utarray_init(&phrases, fcitx_str_icd);
+    utarray_init(&maps, fcitx_str_icd);
+    while (getline(&buf, &bufLen, fp) != -1) {
+        if (!ParsePYPhraseLine(&pystate->pyconfig, buf, &phrase, strMap))
+            continue;
+        char* str = phrase;
+        utarray_push_back(&phrases, &str);
+        str = strMap;
+        utarray_push_back(&maps, &str);
+    }
+    free(buf);
+    fclose(fp);
+
+    iAdded = PYAddUserPhraseBatch(pystate, (const char* const*) phrases.d,
+                                  (const char* const*) maps.d,
+                                  utarray_len(&phrases));
+    utarray_done(&phrases);
+    utarray_done(&maps);
+
+    if (iAdded)
+        PYJournalCompact(pystate);
+    return iAdded;
 }
 
 int GetBaseMapIndex(FcitxPinyinState* pystate, char *strMap)
@@ -1648,17 +1892,15 @@ int GetBaseMapIndex(FcitxPinyinState* pystate, char *strMap)
 }
 
 /*
- * 保存用户词库
+ * 把 data 写入 pinyin 目录下的 strFile，先写临时文件再改名，
+ * 不访问 FcitxPinyinState，可以在后台线程中调用
  */
-void SavePYUserPhrase(FcitxPinyinState* pystate)
+boolean PYSaveUserFile(const char* strFile, const char* data, size_t len)
 {
-    int j, k;
-    int32_t i, iTemp;
     char *tempfile, *pstr;
     FILE *fp;
-    PyPhrase *phrase;
-    PYFA* PYFAList = pystate->PYFAList;
     int fd;
+    boolean success;
 
     FcitxXDGGetFileUserWithPrefix("pinyin", "", "w", NULL);
     FcitxXDGGetFileUserWithPrefix("pinyin", PINYIN_TEMP_FILE, NULL, &tempfile);
@@ -1669,11 +1911,43 @@ void SavePYUserPhrase(FcitxPinyinState* pystate)
         fp = fdopen(fd, "w");
 
     if (!fp) {
-        FcitxLog(ERROR, _("Cannot Save User Pinyin Database: %s"), tempfile);
+        FcitxLog(ERROR, _("Cannot Save Pinyin Database: %s"), tempfile);
+        if (fd > 0) {
+            close(fd);
+            unlink(tempfile);
+        }
         free(tempfile);
-        return;
+        return false;
+    }
+
+    success = fwrite(data, sizeof(char), len, fp) == len;
+    success = (fclose(fp) == 0) && success;
+    if (!success) {
+        FcitxLog(ERROR, _("Cannot Save Pinyin Database: %s"), tempfile);
+        unlink(tempfile);
+        free(tempfile);
+        return false;
     }
 
+    FcitxXDGGetFileUserWithPrefix("pinyin", strFile, NULL, &pstr);
+    if (access(pstr, 0))
+        unlink(pstr);
+    rename(tempfile, pstr);
+    free(pstr);
+    free(tempfile);
+    return true;
+}
+
+/*
+ * 用户词库的内容
+ */
+void PYWriteUserPhrase(FcitxPinyinState* pystate, FILE* fp)
+{
+    int j, k;
+    int32_t i, iTemp;
+    PyPhrase *phrase;
+    PYFA* PYFAList = pystate->PYFAList;
+
     for (i = 0; i < pystate->iPYFACount; i++) {
         for (j = 0; j < PYFAList[i].iBase; j++) {
             iTemp = PYFAList[i].pyBase[j].iUserPhrase;
@@ -1701,104 +1975,38 @@ void SavePYUserPhrase(FcitxPinyinState* pystate)
             }
         }
     }
-
-    fclose(fp);
-    FcitxXDGGetFileUserWithPrefix("pinyin", PY_USERPHRASE_FILE, NULL, &pstr);
-    if (access(pstr, 0))
-        unlink(pstr);
-    rename(tempfile, pstr);
-    free(pstr);
-    free(tempfile);
-    pystate->iNewPYPhraseCount = 0;
 }
 
-void SavePYFreq(FcitxPinyinState *pystate)
+/*
+ * 常用字的内容
+ */
+void PYWriteFreq(FcitxPinyinState *pystate, FILE* fp)
 {
-    int32_t i;
-    int k;
-    char *pstr;
-    char *tempfile;
-    FILE *fp;
     PyFreq *pPyFreq;
     HZ *hz;
-    int fd;
-
-    FcitxXDGGetFileUserWithPrefix("pinyin", "", "w", NULL);
-    FcitxXDGGetFileUserWithPrefix("pinyin", PINYIN_TEMP_FILE, NULL, &tempfile);
-    fd = mkstemp(tempfile);
-    fp = NULL;
-
-    if (fd > 0)
-        fp = fdopen(fd, "w");
-
-    if (!fp) {
-        FcitxLog(ERROR, _("Cannot Save Frequent word: %s"), tempfile);
-        free(tempfile);
-        return;
-    }
 
-    i = 0;
-    pPyFreq = pystate->pyFreq->next;
-    while (pPyFreq) {
-        i++;
-        pPyFreq = pPyFreq->next;
-    }
-    fcitx_utils_write_int32(fp, i);
-    pPyFreq = pystate->pyFreq->next;
-    while (pPyFreq) {
+    fcitx_utils_write_int32(fp, HASH_COUNT(pystate->pyFreq));
+    for (pPyFreq = pystate->pyFreq; pPyFreq; pPyFreq = pPyFreq->hh.next) {
         fwrite(pPyFreq->strPY, sizeof(char) * 11, 1, fp);
         fcitx_utils_write_int32(fp, pPyFreq->iCount);
-        hz = pPyFreq->HZList->next;
-        for (k = 0; k < pPyFreq->iCount; k++) {
+        for (hz = pPyFreq->HZList; hz; hz = hz->hh.next) {
             char slen = strlen(hz->strHZ);
             fwrite(&slen, sizeof(char), 1, fp);
             fwrite(hz->strHZ, sizeof(char) * slen, 1, fp);
             fcitx_utils_write_int32(fp, hz->iPYFA);
             fcitx_utils_write_uint32(fp, hz->iHit);
             fcitx_utils_write_int32(fp, hz->iIndex);
-
-            hz = hz->next;
         }
-        pPyFreq = pPyFreq->next;
     }
-
-    fclose(fp);
-
-    FcitxXDGGetFileUserWithPrefix("pinyin", PY_FREQ_FILE, NULL, &pstr);
-    if (access(pstr, 0))
-        unlink(pstr);
-    rename(tempfile, pstr);
-
-    free(pstr);
-    free(tempfile);
-    pystate->iNewFreqCount = 0;
 }
 
 /*
- * 保存索引文件
+ * 索引文件的内容
  */
-void SavePYIndex(FcitxPinyinState *pystate)
+void PYWriteIndex(FcitxPinyinState *pystate, FILE* fp)
 {
     int32_t i, j, k;
-    char *pstr;
-    char *tempfile;
-    FILE *fp;
     PYFA* PYFAList = pystate->PYFAList;
-    int fd;
-
-    FcitxXDGGetFileUserWithPrefix("pinyin", "", "w", NULL);
-    FcitxXDGGetFileUserWithPrefix("pinyin", PINYIN_TEMP_FILE, NULL, &tempfile);
-    fd = mkstemp(tempfile);
-    fp = NULL;
-
-    if (fd > 0)
-        fp = fdopen(fd, "w");
-
-    if (!fp) {
-        FcitxLog(ERROR, _("Cannot Save Pinyin Index: %s"), tempfile);
-        free(tempfile);
-        return;
-    }
 
     fcitx_utils_write_uint32(fp, PY_INDEX_MAGIC_NUMBER);
 
@@ -1835,17 +2043,6 @@ void SavePYIndex(FcitxPinyinState *pystate)
             }
         }
     }
-
-    fclose(fp);
-
-    FcitxXDGGetFileUserWithPrefix("pinyin", PY_INDEX_FILE, NULL, &pstr);
-    if (access(pstr, 0))
-        unlink(pstr);
-    rename(tempfile, pstr);
-
-    free(pstr);
-    free(tempfile);
-    pystate->iOrderCount = 0;
 }
 
 /*
@@ -1856,70 +2053,30 @@ void SavePYIndex(FcitxPinyinState *pystate)
  */
 void PYAddFreq(FcitxPinyinState* pystate, PYCandWord* pycandWord)
 {
-    int i;
     HZ *HZTemp;
-    PyFreq *freq;
-    HZ *hz;
     PYFA* PYFAList = pystate->PYFAList;
-    PyFreq* pCurFreq = pystate->pyFreq->next;
-    for (i = 0; i < pystate->iPYFreqCount; i++) {
-        if (!strcmp(pystate->strFindString, pCurFreq->strPY))
-            break;
-        pCurFreq = pCurFreq->next;
-    }
+    PyFreq* pCurFreq = PYFindFreq(pystate, pystate->strFindString);
 
     //能到这儿来，就说明候选列表中都是单字
     //首先，看这个字是不是已经在常用字表中
-    i = 1;
     if (pCurFreq) {
-        i = -1;
-        if (pycandWord->iWhich != PY_CAND_FREQ) {
-            //说明该字是系统单字
-            HZTemp = pCurFreq->HZList->next;
-            for (i = 0; i < pCurFreq->iCount; i++) {
-                if (!strcmp(PYFAList[pycandWord->cand.base.iPYFA].pyBase[pycandWord->cand.base.iBase].strHZ, HZTemp->strHZ)) {
-                    i = -1;
-                    break;
-                }
-                HZTemp = HZTemp->next;
-            }
-        }
+        if (pycandWord->iWhich == PY_CAND_FREQ)
+            return;
+        //说明该字是系统单字
+        if (PYIsInFreq(pCurFreq, PYFAList[pycandWord->cand.base.iPYFA].pyBase[pycandWord->cand.base.iBase].strHZ))
+            return;
     }
-    //借用i来指示是否需要添加新的常用字
-    if (i < 0)
-        return;
     //需要添加该字，此时该字必然是系统单字
-    if (!pCurFreq) {
-        freq = fcitx_utils_new(PyFreq);
-        freq->HZList = fcitx_utils_new(HZ);
-        freq->HZList->next = NULL;
-        strcpy(freq->strPY, pystate->strFindString);
-        freq->next = NULL;
-        freq->iCount = 0;
-        pCurFreq = pystate->pyFreq;
-        for (i = 0; i < pystate->iPYFreqCount; i++)
-            pCurFreq = pCurFreq->next;
-        pCurFreq->next = freq;
-        pystate->iPYFreqCount++;
-        pCurFreq = freq;
-    }
-
-    HZTemp = fcitx_utils_new(HZ);
-    strcpy(HZTemp->strHZ, PYFAList[pycandWord->cand.base.iPYFA].pyBase[pycandWord->cand.base.iBase].strHZ);
+    if (!pCurFreq)
+        pCurFreq = PYNewFreq(pystate, pystate->strFindString);
+
+    //加到表的尾部
+    HZTemp = PYNewFreqHZ(pCurFreq, PYFAList[pycandWord->cand.base.iPYFA].pyBase[pycandWord->cand.base.iBase].strHZ);
     HZTemp->iPYFA = pycandWord->cand.base.iPYFA;
     HZTemp->iHit = 0;
     HZTemp->iIndex = 0;
-    HZTemp->next = NULL;
-    //将HZTemp加到链表尾部
-    hz = pCurFreq->HZList;
-    for (i = 0; i < pCurFreq->iCount; i++)
-        hz = hz->next;
-    hz->next = HZTemp;
-    pCurFreq->iCount++;
     pystate->iNewFreqCount++;
-    if (pystate->iNewFreqCount >= AUTOSAVE_FREQ_COUNT) {
-        SavePYFreq(pystate);
-    }
+    PYJournalFreq(pystate, pCurFreq, HZTemp, false);
 }
 
 /*
@@ -1927,43 +2084,61 @@ void PYAddFreq(FcitxPinyinState* pystate, PYCandWord* pycandWord)
  */
 void PYDelFreq(FcitxPinyinState *pystate, PYCandWord* pycandWord)
 {
-    HZ *hz;
+    PyFreq *pyFreq = pycandWord->cand.freq.pyFreq;
+    HZ *hz = pycandWord->cand.freq.hz;
 
     //能到这儿来，就说明候选列表中都是单字
     //首先，看这个字是不是已经在常用字表中
     if (pycandWord->iWhich != PY_CAND_FREQ)
         return;
-    //先找到需要删除单字的位置
-    hz = pycandWord->cand.freq.pyFreq->HZList;
-    while (hz->next != pycandWord->cand.freq.hz)
-        hz = hz->next;
-    hz->next = pycandWord->cand.freq.hz->next;
-    free(pycandWord->cand.freq.hz);
-    pycandWord->cand.freq.pyFreq->iCount--;
+    PYJournalFreq(pystate, pyFreq, hz, true);
+    HASH_DEL(pyFreq->HZList, hz);
+    free(hz);
+    pyFreq->iCount--;
     pystate->iNewFreqCount++;
-    if (pystate->iNewFreqCount >= AUTOSAVE_FREQ_COUNT) {
-        SavePYFreq(pystate);
-    }
 }
 
 /*
  * 判断一个字是否已经是常用字
  */
-boolean PYIsInFreq(PyFreq* pCurFreq, char *strHZ)
+boolean PYIsInFreq(PyFreq* pCurFreq, const char *strHZ)
 {
-    HZ *hz;
-    int i;
-
     if (!pCurFreq)
         return false;
-    hz = pCurFreq->HZList->next;
-    for (i = 0; i < pCurFreq->iCount; i++) {
-        if (!strcmp(strHZ, hz->strHZ))
-            return true;
-        hz = hz->next;
-    }
+    return PYFindFreqHZ(pCurFreq, strHZ) != NULL;
+}
 
-    return false;
+PyFreq* PYFindFreq(FcitxPinyinState* pystate, const char* strPY)
+{
+    PyFreq* pyFreq = NULL;
+    HASH_FIND_STR(pystate->pyFreq, strPY, pyFreq);
+    return pyFreq;
+}
+
+/* 加到常用字表的尾部，不检查是否已有 */
+PyFreq* PYNewFreq(FcitxPinyinState* pystate, const char* strPY)
+{
+    PyFreq* pyFreq = fcitx_utils_new(PyFreq);
+    strncpy(pyFreq->strPY, strPY, sizeof(pyFreq->strPY) - 1);
+    HASH_ADD_STR(pystate->pyFreq, strPY, pyFreq);
+    pystate->iPYFreqCount++;
+    return pyFreq;
+}
+
+HZ* PYFindFreqHZ(PyFreq* pyFreq, const char* strHZ)
+{
+    HZ* hz = NULL;
+    HASH_FIND_STR(pyFreq->HZList, strHZ, hz);
+    return hz;
+}
+
+HZ* PYNewFreqHZ(PyFreq* pyFreq, const char* strHZ)
+{
+    HZ* hz = fcitx_utils_new(HZ);
+    strncpy(hz->strHZ, strHZ, sizeof(hz->strHZ) - 1);
+    HASH_ADD_STR(pyFreq->HZList, strHZ, hz);
+    pyFreq->iCount++;
+    return hz;
 }
 
 /*
@@ -1978,6 +2153,7 @@ INPUT_RETURN_VALUE PYGetRemindCandWords(void *arg)
     FcitxGlobalConfig* config = FcitxInstanceGetGlobalConfig(pystate->owner);
     boolean bDisablePagingInRemind = config->bDisablePagingInRemind;
     FcitxInputState *input = FcitxInstanceGetInputState(pystate->owner);
+    FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
     PYFA* PYFAList = pystate->PYFAList;
 
     if (!pystate->strPYRemindSource[0])
@@ -2009,7 +2185,7 @@ _HIT:
 
         if (fcitx_utf8_strlen(pystate->strPYRemindSource) == 1) {
             if (fcitx_utf8_strlen(pyBaseForRemind->phrase[i].strPhrase) == 1) {
-                PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+                PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
                 PYAddRemindCandWord(pystate, &pyBaseForRemind->phrase[i], pycandWord);
                 utarray_push_back(&candtemp, &pycandWord);
             }
@@ -2018,7 +2194,7 @@ _HIT:
                     (pystate->strPYRemindSource + fcitx_utf8_char_len(pystate->strPYRemindSource),
                      pyBaseForRemind->phrase[i].strPhrase, strlen(pystate->strPYRemindSource + fcitx_utf8_char_len(pystate->strPYRemindSource)))
                ) {
-                PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+                PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
                 PYAddRemindCandWord(pystate, &pyBaseForRemind->phrase[i], pycandWord);
                 utarray_push_back(&candtemp, &pycandWord);
             }
@@ -2032,7 +2208,7 @@ _HIT:
 
         if (fcitx_utf8_strlen(pystate->strPYRemindSource) == 1) {
             if (fcitx_utf8_strlen(phrase->strPhrase) == 1) {
-                PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+                PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
                 PYAddRemindCandWord(pystate, phrase, pycandWord);
                 utarray_push_back(&candtemp, &pycandWord);
             }
@@ -2040,7 +2216,7 @@ _HIT:
             if (!strncmp
                     (pystate->strPYRemindSource + fcitx_utf8_char_len(pystate->strPYRemindSource),
                      phrase->strPhrase, strlen(pystate->strPYRemindSource + fcitx_utf8_char_len(pystate->strPYRemindSource)))) {
-                PYCandWord *pycandWord = fcitx_utils_new(PYCandWord);
+                PYCandWord *pycandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(PYCandWord));
                 PYAddRemindCandWord(pystate, phrase, pycandWord);
                 utarray_push_back(&candtemp, &pycandWord);
             }
@@ -2066,10 +2242,10 @@ _HIT:
         candWord.owner = pystate;
         candWord.priv = *pcand;
         candWord.strExtra = NULL;
-        candWord.strWord = strdup((*pcand)->cand.remind.phrase->strPhrase + (*pcand)->cand.remind.iLength);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, (*pcand)->cand.remind.phrase->strPhrase + (*pcand)->cand.remind.iLength);
         candWord.wordType = MSG_OTHER;
 
-        FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input), &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
 
     utarray_done(&candtemp);
@@ -2089,33 +2265,31 @@ void PYAddRemindCandWord(FcitxPinyinState* pystate, PyPhrase * phrase, PYCandWor
 
 void PYGetPYByHZ(FcitxPinyinState*pystate, const char *strHZ, char *strPY)
 {
-    int i, j;
     char str_PY[MAX_PY_LENGTH + 1];
     PYFA* PYFAList = pystate->PYFAList;
+    PYHZEntry* entry;
 
     strPY[0] = '\0';
-    for (i = pystate->iPYFACount - 1; i >= 0; i--) {
-        if (MapToPY(PYFAList[i].strMap, str_PY)) {
-            for (j = 0; j < PYFAList[i].iBase; j++) {
-                if (!strcmp(PYFAList[i].pyBase[j].strHZ, strHZ)) {
-                    if (strPY[0])
-                        strcat(strPY, " ");
-                    strcat(strPY, str_PY);
-                }
-            }
+    for (entry = PYHZIndexFind(pystate, strHZ); entry;
+         entry = PYHZIndexNext(pystate, entry)) {
+        if (MapToPY(PYFAList[entry->iPYFA].strMap, str_PY)) {
+            if (strPY[0])
+                strcat(strPY, " ");
+            strcat(strPY, str_PY);
         }
     }
 }
 
+/*
+ * 改动已经写入日志，只有日志过大时才在后台重写词库文件
+ */
 void SavePY(void *arg)
 {
     FcitxPinyinState *pystate = (FcitxPinyinState*)arg;
-    if (pystate->iNewPYPhraseCount)
-        SavePYUserPhrase(pystate);
-    if (pystate->iOrderCount)
-        SavePYIndex(pystate);
-    if (pystate->iNewFreqCount)
-        SavePYFreq(pystate);
+    if (pystate->journal.fp)
+        fflush(pystate->journal.fp);
+    if (pystate->journal.iSize >= PY_JOURNAL_COMPACT_SIZE)
+        PYJournalStartCompact(pystate);
 }
 
 void ReloadConfigPY(void* arg)
@@ -2123,6 +2297,7 @@ void ReloadConfigPY(void* arg)
     FcitxPinyinState *pystate = (FcitxPinyinState*)arg;
 
     LoadPYConfig(&pystate->pyconfig);
+    PYLatticeReset(pystate);
 }
 
 void PinyinMigration()
@@ -2250,22 +2425,23 @@ PYSP2QP(FcitxPinyinState *pystate, const char* strSP)
     return strdup(strQP);
 }
 
+/*
+ * 取单字 strHZ 与 mapHint 相符的拼音映射，mapHint 为 NULL 时取第一个
+ */
 static boolean
-PYGetPYMapByHZ(FcitxPinyinState* pystate, char* strHZ,
-               char* mapHint, char* strMap)
+PYGetPYMapByHZ(FcitxPinyinState* pystate, const char* strHZ,
+               const char* mapHint, char* strMap)
 {
-    int i, j;
     PYFA* PYFAList = pystate->PYFAList;
+    PYHZEntry* entry;
 
     strMap[0] = '\0';
-    for (i = pystate->iPYFACount - 1; i >= 0; i--) {
-        if (!Cmp2Map(&pystate->pyconfig, PYFAList[i].strMap, mapHint, false)) {
-            for (j = 0; j < PYFAList[i].iBase; j++) {
-                if (!strcmp(PYFAList[i].pyBase[j].strHZ, strHZ)) {
-                    strcpy(strMap, PYFAList[i].strMap);
-                    return true;
-                }
-            }
+    for (entry = PYHZIndexFind(pystate, strHZ); entry;
+         entry = PYHZIndexNext(pystate, entry)) {
+        if (!mapHint || !Cmp2Map(&pystate->pyconfig, PYFAList[entry->iPYFA].strMap,
+                                 (char*) mapHint, false)) {
+            strcpy(strMap, PYFAList[entry->iPYFA].strMap);
+            return true;
         }
     }
     return false;
@@ -20,9 +20,13 @@
 #ifndef _PY_H
 #define _PY_H
 
+#include <pthread.h>
+
 #include "fcitx/ime.h"
 #include "fcitx/fcitx.h"
 #include "fcitx-utils/memory.h"
+#include "fcitx-utils/utarray.h"
+#include "fcitx-utils/uthash.h"
 #include "fcitx/candidate.h"
 #include "fcitx/instance.h"
 #include "pyconfig.h"
@@ -34,10 +38,13 @@
 #define PY_INDEX_FILE   "pyindex.dat"
 #define PY_FREQ_FILE    "pyfreq.mb"
 #define PY_SYMBOL_FILE  "pySym.mb"
+#define PY_JOURNAL_FILE "pyjournal.dat"
 
-#define AUTOSAVE_PHRASE_COUNT   1024
-#define AUTOSAVE_ORDER_COUNT    1024
-#define AUTOSAVE_FREQ_COUNT     32
+/* 日志超过这个大小后合并到词库文件中 */
+#define PY_JOURNAL_COMPACT_SIZE  (128 * 1024)
+#define PY_JOURNAL_COMPACT_DELAY 3000
+/* 后台合并时检查是否写完的间隔 */
+#define PY_JOURNAL_COMPACT_POLL  100
 
 typedef enum {
     FIND_PHRASE,
@@ -54,19 +61,23 @@ typedef enum {
     PY_CAND_REMIND
 } PY_CAND_WORD_TYPE;
 
+/*
+ * 常用字表是以拼音为键的散列表，每个拼音的常用字又是以字为键的散列表，
+ * 用 hh.next 按加入的顺序遍历
+ */
 typedef struct _HZ {
     char            strHZ[MAX_PY_PHRASE_LENGTH * UTF8_MAX_LENGTH + 1];
     int32_t         iPYFA;
     uint32_t        iHit;
     uint32_t        iIndex;
-    struct _HZ     *next;
+    UT_hash_handle  hh;
 } HZ;
 
 typedef struct _PYFREQ {
     HZ             *HZList;
     char            strPY[MAX_PY_PHRASE_LENGTH * MAX_PY_LENGTH + 1];
     uint32_t        iCount;
-    struct _PYFREQ  *next;
+    UT_hash_handle  hh;
 } PyFreq;
 
 typedef struct {
@@ -87,6 +98,7 @@ typedef struct {
     char            strHZ[UTF8_MAX_LENGTH + 1];
     PyPhrase *phrase;
     int             iPhrase;
+    int             iPhraseSize; /* allocated size of phrase */
     PyUsrPhrase *userPhrase;
     int             iUserPhrase;
     uint32_t        iIndex;
@@ -95,10 +107,99 @@ typedef struct {
 
 typedef struct {
     char strMap[3];
+    PYSyllable iSyllable;       /* strMap packed by PYMapToSyllable */
     PyBase *pyBase;
     int32_t iBase;
 } PYFA;
 
+/*
+ * Trie over the map of phrases, one tree for each PYFA, every node is one
+ * syllable after the first one. Children and entries are linked lists of
+ * indexes, so user phrases can be added or removed at any time.
+ */
+typedef struct {
+    PYSyllable      iSyllable;
+    uint32_t        iChild;     /* 0 for none, nodes[0] is never a child */
+    uint32_t        iNext;      /* next sibling */
+    uint32_t        iEntry;     /* system phrases having exactly this map */
+    uint32_t        iUserEntry; /* user phrases having exactly this map */
+} PYPhraseNode;
+
+typedef struct {
+    int32_t         iBase;
+    int32_t         iPhrase;    /* index in PyBase::phrase */
+    uint32_t        iNext;
+} PYPhraseEntry;
+
+typedef struct {
+    int32_t         iBase;
+    PyUsrPhrase    *userPhrase;
+    uint32_t        iNext;
+} PYUserPhraseEntry;
+
+typedef struct {
+    UT_array        nodes;      /* PYPhraseNode, nodes[i] is the root of PYFAList[i] */
+    UT_array        entries;    /* PYPhraseEntry, entries[0] is not used */
+    UT_array        userEntries; /* PYUserPhraseEntry, userEntries[0] is not used */
+    uint32_t        iFreeUserEntry;
+    boolean         bBuilt;
+} PYPhraseIndex;
+
+typedef struct {
+    int32_t         iPYFA;
+    int32_t         iBase;
+    int32_t         iPhrase;    /* for user phrase, the position in the list */
+    PyPhrase       *phrase;
+} PYPhraseMatch;
+
+/*
+ * Hanzi to the PyBase entries having it, for finding the pinyin of a hanzi.
+ * Slots are an open addressing hash table on the code point, each one is the
+ * head of a list of entries.
+ */
+typedef struct {
+    int32_t         iPYFA;
+    int32_t         iBase;
+    uint32_t        iNext;
+} PYHZEntry;
+
+typedef struct {
+    uint32_t        chr;
+    uint32_t        iEntry;     /* 0 for an empty slot */
+} PYHZSlot;
+
+typedef struct {
+    PYHZSlot       *slots;
+    uint32_t        iMask;
+    UT_array        entries;    /* PYHZEntry, entries[0] is not used */
+} PYHZIndex;
+
+/*
+ * Word graph of the auto sentence, nodes[i] keeps the best path covering the
+ * first i syllables of findMap. Paths with fewer words win, then the one with
+ * more hits, then the more recent one.
+ */
+typedef struct {
+    int32_t         iPYFA;
+    int32_t         iBase;
+    PyPhrase       *phrase;     /* NULL for single HZ */
+} PYLatticeWord;
+
+typedef struct {
+    PYLatticeWord   word;       /* last word of the best path */
+    int8_t          iPrev;      /* where the last word starts, -1 if unreachable */
+    boolean         bPhrase;    /* a single phrase covers all syllables before */
+    int32_t         iWords;
+    uint64_t        iHit;
+    uint64_t        iIndex;
+} PYLatticeNode;
+
+typedef struct {
+    char            strMap[MAX_WORDS_USER_INPUT + 3][3]; /* syllables nodes are built for */
+    int             iCount;     /* nodes[0..iCount] are valid */
+    PYLatticeNode   nodes[MAX_WORDS_USER_INPUT + 4];
+} PYLattice;
+
 typedef struct {
     HZ             *hz;
     char           *strPY;
@@ -152,22 +253,67 @@ typedef struct {
     char            strMap[MAX_PY_PHRASE_LENGTH * 2 + 1];
 } PY_SELECTED;
 
+typedef enum {
+    PY_JOURNAL_SNAPSHOT_USERPHRASE,
+    PY_JOURNAL_SNAPSHOT_INDEX,
+    PY_JOURNAL_SNAPSHOT_FREQ,
+    PY_JOURNAL_SNAPSHOT_COUNT
+} PY_JOURNAL_SNAPSHOT;
+
+/*
+ * 合并日志时先在主线程中把词库写到内存里，后台线程再把它们写入文件，
+ * 写完后回到主线程，去掉日志中已经合并的部分
+ */
+typedef struct {
+    pthread_t       thread;
+    boolean         bStarted;   /* a snapshot is being written */
+    boolean         bThread;    /* written by thread, needs to be joined */
+    volatile int32_t iDone;
+    boolean         bSuccess;
+    long            iSize;      /* size of journal when the snapshot is made */
+    char           *data[PY_JOURNAL_SNAPSHOT_COUNT];
+    size_t          len[PY_JOURNAL_SNAPSHOT_COUNT];
+    int             iCount[PY_JOURNAL_SNAPSHOT_COUNT];
+} PYJournalCompactor;
+
+typedef struct {
+    FILE           *fp;         /* opened on the first record */
+    long            iSize;
+    boolean         bReplaying;
+    PYJournalCompactor compactor;
+} PYJournal;
+
+/*
+ * 词库在后台线程中读入另一个 FcitxPinyinState，读完后在主线程中替换
+ */
+typedef struct {
+    pthread_t       thread;
+    boolean         bStarted;
+    volatile int32_t iDone;
+    struct _FcitxPinyinState *staging;
+} PYLoader;
+
 typedef struct _FcitxPinyinState {
     FcitxPinyinConfig pyconfig;
 
     int32_t iPYFACount;
     PYFA *PYFAList;
+    PYPhraseIndex phraseIndex;
+    PYHZIndex hzIndex;
     uint32_t iCounter;
     uint32_t iOrigCounter;
     boolean bPYBaseDictLoaded;
     boolean bPYOtherDictLoaded;
+    PYLoader loader;
 
     PyFreq *pyFreq;
     uint32_t iPYFreqCount;
 
     char strFindString[MAX_USER_INPUT + 2];
     ParsePYStruct findMap;
+    ParsePYCache parseCache;
     int iPYInsertPoint;
+    PYLattice lattice;
 
     char strPYRemindSource[MAX_WORDS_USER_INPUT * UTF8_MAX_LENGTH + 1];
     char strPYRemindMap[MAX_WORDS_USER_INPUT * 2 + 1];
@@ -178,9 +324,11 @@ typedef struct _FcitxPinyinState {
     char strPYAuto[MAX_WORDS_USER_INPUT * UTF8_MAX_LENGTH + 1];
     char strPYAutoMap[MAX_WORDS_USER_INPUT * 2 + 1];
 
+    /* 已写入日志但未写入词库文件的改动 */
     int iNewPYPhraseCount;
     int iOrderCount;
     int iNewFreqCount;
+    PYJournal journal;
 
     boolean bIsPYAddFreq;
     boolean bIsPYDelFreq;
@@ -221,20 +369,60 @@ boolean         PYAddUserPhrase(FcitxPinyinState* pystate, const char* phrase,
                                 const char* map, boolean incHit);
 void            PYDelUserPhrase(FcitxPinyinState* pystate, int32_t iPYFA,
                                 int iBase, PyUsrPhrase* phrase);
+int             PYAddUserPhraseBatch(FcitxPinyinState* pystate,
+                                     const char* const* strPhrase,
+                                     const char* const* strMap, int count);
+int             PYImportUserPhraseFile(FcitxPinyinState* pystate, const char* path);
 int             GetBaseMapIndex(FcitxPinyinState* pystate, char *strMap);
-void            SavePYUserPhrase(FcitxPinyinState* pystate);
-void            SavePYFreq(FcitxPinyinState* pystate);
-void            SavePYIndex(FcitxPinyinState* pystate);
+void            PYWriteUserPhrase(FcitxPinyinState* pystate, FILE* fp);
+void            PYWriteFreq(FcitxPinyinState* pystate, FILE* fp);
+void            PYWriteIndex(FcitxPinyinState* pystate, FILE* fp);
+boolean         PYSaveUserFile(const char* strFile, const char* data, size_t len);
 void            SavePY(void *arg);
 
 void            PYAddFreq(FcitxPinyinState* pystate, PYCandWord* pycandWord);
 void            PYDelFreq(FcitxPinyinState* pystate, PYCandWord* pycandWord);
-boolean         PYIsInFreq(PyFreq* pCurFreq, char* strHZ);
+boolean         PYIsInFreq(PyFreq* pCurFreq, const char* strHZ);
+PyFreq*         PYFindFreq(FcitxPinyinState* pystate, const char* strPY);
+PyFreq*         PYNewFreq(FcitxPinyinState* pystate, const char* strPY);
+HZ*             PYFindFreqHZ(PyFreq* pyFreq, const char* strHZ);
+HZ*             PYNewFreqHZ(PyFreq* pyFreq, const char* strHZ);
 
 INPUT_RETURN_VALUE PYGetRemindCandWords(void* arg);
 void            PYAddRemindCandWord(FcitxPinyinState* pystate, PyPhrase * phrase, PYCandWord* pycandWord);
 void            PYGetPYByHZ(FcitxPinyinState* pystate, const char *strHZ, char *strPY);
 
+void            PYLatticeReset(FcitxPinyinState* pystate);
+boolean         PYLatticeGetSentence(FcitxPinyinState* pystate, char* strHZ, char* strMap);
+
+void            PYJournalIndex(FcitxPinyinState* pystate, int32_t iPYFA,
+                               int32_t iBase, int32_t iPhrase);
+void            PYJournalUserPhrase(FcitxPinyinState* pystate, int32_t iPYFA,
+                                    int32_t iBase, PyPhrase* phrase,
+                                    boolean bDelete);
+void            PYJournalFreq(FcitxPinyinState* pystate, PyFreq* pyFreq,
+                              HZ* hz, boolean bDelete);
+void            PYJournalReplay(FcitxPinyinState* pystate);
+boolean         PYJournalCompact(FcitxPinyinState* pystate);
+void            PYJournalStartCompact(FcitxPinyinState* pystate);
+void            PYJournalClose(FcitxPinyinState* pystate);
+
+void            PYPhraseIndexBuild(FcitxPinyinState* pystate);
+void            PYPhraseIndexFree(FcitxPinyinState* pystate);
+void            PYPhraseIndexInsertUser(FcitxPinyinState* pystate, int32_t iPYFA,
+                                        int32_t iBase, PyUsrPhrase* userPhrase);
+void            PYPhraseIndexRemoveUser(FcitxPinyinState* pystate, int32_t iPYFA,
+                                        int32_t iBase, PyUsrPhrase* userPhrase);
+extern const UT_icd py_phrase_match_icd;
+void            PYPhraseIndexMatch(FcitxPinyinState* pystate, const char* strFirst,
+                                   const char* strMap, boolean bUser,
+                                   UT_array* matches);
+
+void            PYHZIndexBuild(FcitxPinyinState* pystate);
+void            PYHZIndexFree(FcitxPinyinState* pystate);
+PYHZEntry*      PYHZIndexFind(FcitxPinyinState* pystate, const char* strHZ);
+PYHZEntry*      PYHZIndexNext(FcitxPinyinState* pystate, PYHZEntry* entry);
+
 #endif
 
 // kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -0,0 +1,635 @@
+#include "config.h"
+
+#include <libintl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx/instance.h"
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/log.h"
+#include "fcitx-utils/utf8.h"
+#include "fcitx-config/xdg.h"
+#include "py.h"
+
+/*
+ * 用户数据的日志文件，每次选词、造词、删词或调整常用字都只在文件末尾追加
+ * 一条记录，启动时读入词库后再重放一遍。日志过大时才在后台线程中重写
+ * pyusrphrase.mb, pyindex.dat, pyfreq.mb，写完后去掉日志中已合并的部分。
+ *
+ * 每条记录都是修改后的值而不是增量，重放多次结果相同，所以重写词库后、
+ * 删除日志前退出也不要紧。
+ */
+
+#define PY_JOURNAL_MAGIC_NUMBER 0x4a59500a
+#define PY_JOURNAL_MAX_STRING 256
+#define PY_JOURNAL_TEMP_FILE "pyjournal_XXXXXX"
+
+typedef enum {
+    PY_JOURNAL_INDEX = 1,       /* iPYFA, iBase, iPhrase, iIndex, iHit */
+    PY_JOURNAL_USER_PHRASE,     /* phrase, map, iIndex, iHit */
+    PY_JOURNAL_DEL_USER_PHRASE, /* phrase, map */
+    PY_JOURNAL_FREQ,            /* strPY, strHZ, iPYFA, iIndex, iHit */
+    PY_JOURNAL_DEL_FREQ,        /* strPY, strHZ */
+} PY_JOURNAL_RECORD_TYPE;
+
+static void PYJournalCompactTimeout(void* arg);
+
+static void PYJournalWriteString(FILE* fp, const char* str)
+{
+    int32_t len = strlen(str);
+    fcitx_utils_write_int32(fp, len);
+    fwrite(str, sizeof(char), len, fp);
+}
+
+static boolean PYJournalReadString(FILE* fp, char* str, int32_t size)
+{
+    int32_t len;
+    if (!fcitx_utils_read_int32(fp, &len) || len < 0 || len >= size)
+        return false;
+    if (len && fread(str, sizeof(char), len, fp) != (size_t) len)
+        return false;
+    str[len] = '\0';
+    return true;
+}
+
+static FILE* PYJournalBegin(FcitxPinyinState* pystate, PY_JOURNAL_RECORD_TYPE type)
+{
+    PYJournal* journal = &pystate->journal;
+    if (journal->bReplaying)
+        return NULL;
+
+    if (!journal->fp) {
+        journal->fp = FcitxXDGGetFileUserWithPrefix("pinyin", PY_JOURNAL_FILE, "a", NULL);
+        if (!journal->fp) {
+            FcitxLog(ERROR, _("Cannot open Pinyin journal"));
+            return NULL;
+        }
+        fseek(journal->fp, 0, SEEK_END);
+        if (ftell(journal->fp) == 0)
+            fcitx_utils_write_uint32(journal->fp, PY_JOURNAL_MAGIC_NUMBER);
+    }
+
+    fcitx_utils_write_uint32(journal->fp, type);
+    return journal->fp;
+}
+
+static void PYJournalEnd(FcitxPinyinState* pystate, PY_JOURNAL_RECORD_TYPE type)
+{
+    PYJournal* journal = &pystate->journal;
+
+    /* 用于判断最后一条记录是否完整 */
+    fcitx_utils_write_uint32(journal->fp, type ^ PY_JOURNAL_MAGIC_NUMBER);
+    fflush(journal->fp);
+    journal->iSize = ftell(journal->fp);
+
+    if (journal->iSize >= PY_JOURNAL_COMPACT_SIZE && pystate->owner
+        && !FcitxInstanceCheckTimeoutByFunc(pystate->owner, PYJournalCompactTimeout))
+        FcitxInstanceAddTimeout(pystate->owner, PY_JOURNAL_COMPACT_DELAY,
+                                PYJournalCompactTimeout, pystate);
+}
+
+/* iPhrase 为 -1 时是单字 */
+void PYJournalIndex(FcitxPinyinState* pystate, int32_t iPYFA, int32_t iBase,
+                    int32_t iPhrase)
+{
+    PyBase* base = &pystate->PYFAList[iPYFA].pyBase[iBase];
+    uint32_t iIndex = iPhrase < 0 ? base->iIndex : base->phrase[iPhrase].iIndex;
+    uint32_t iHit = iPhrase < 0 ? base->iHit : base->phrase[iPhrase].iHit;
+
+    FILE* fp = PYJournalBegin(pystate, PY_JOURNAL_INDEX);
+    if (!fp)
+        return;
+    fcitx_utils_write_int32(fp, iPYFA);
+    fcitx_utils_write_int32(fp, iBase);
+    fcitx_utils_write_int32(fp, iPhrase);
+    fcitx_utils_write_uint32(fp, iIndex);
+    fcitx_utils_write_uint32(fp, iHit);
+    PYJournalEnd(pystate, PY_JOURNAL_INDEX);
+}
+
+/*
+ * 用户词组以完整的词和拼音映射记录，新词组和词频改变都用这一条
+ */
+void PYJournalUserPhrase(FcitxPinyinState* pystate, int32_t iPYFA,
+                         int32_t iBase, PyPhrase* phrase, boolean bDelete)
+{
+    PY_JOURNAL_RECORD_TYPE type = bDelete ? PY_JOURNAL_DEL_USER_PHRASE : PY_JOURNAL_USER_PHRASE;
+    FILE* fp = PYJournalBegin(pystate, type);
+    if (!fp)
+        return;
+
+    PYFA* pyfa = &pystate->PYFAList[iPYFA];
+    char str[PY_JOURNAL_MAX_STRING];
+    snprintf(str, sizeof(str), "%s%s", pyfa->pyBase[iBase].strHZ, phrase->strPhrase);
+    PYJournalWriteString(fp, str);
+    snprintf(str, sizeof(str), "%s%s", pyfa->strMap, phrase->strMap);
+    PYJournalWriteString(fp, str);
+    if (!bDelete) {
+        fcitx_utils_write_uint32(fp, phrase->iIndex);
+        fcitx_utils_write_uint32(fp, phrase->iHit);
+    }
+    PYJournalEnd(pystate, type);
+}
+
+void PYJournalFreq(FcitxPinyinState* pystate, PyFreq* pyFreq, HZ* hz,
+                   boolean bDelete)
+{
+    PY_JOURNAL_RECORD_TYPE type = bDelete ? PY_JOURNAL_DEL_FREQ : PY_JOURNAL_FREQ;
+    FILE* fp = PYJournalBegin(pystate, type);
+    if (!fp)
+        return;
+
+    PYJournalWriteString(fp, pyFreq->strPY);
+    PYJournalWriteString(fp, hz->strHZ);
+    if (!bDelete) {
+        fcitx_utils_write_int32(fp, hz->iPYFA);
+        fcitx_utils_write_uint32(fp, hz->iIndex);
+        fcitx_utils_write_uint32(fp, hz->iHit);
+    }
+    PYJournalEnd(pystate, type);
+}
+
+static void PYJournalUpdateCounter(FcitxPinyinState* pystate, uint32_t iIndex)
+{
+    if (iIndex > pystate->iCounter)
+        pystate->iCounter = iIndex;
+}
+
+static boolean PYJournalReplayIndex(FcitxPinyinState* pystate, FILE* fp)
+{
+    PYFA* PYFAList = pystate->PYFAList;
+    int32_t i, j, k;
+    uint32_t iIndex, iHit;
+
+    if (!fcitx_utils_read_int32(fp, &i) || !fcitx_utils_read_int32(fp, &j)
+        || !fcitx_utils_read_int32(fp, &k) || !fcitx_utils_read_uint32(fp, &iIndex)
+        || !fcitx_utils_read_uint32(fp, &iHit))
+        return false;
+
+    /* 与读取索引文件时相同，系统词库变了则忽略 */
+    if (i < 0 || i >= pystate->iPYFACount || j < 0 || j >= PYFAList[i].iBase
+        || k >= PYFAList[i].pyBase[j].iPhrase)
+        return true;
+
+    if (k >= 0) {
+        PYFAList[i].pyBase[j].phrase[k].iIndex = iIndex;
+        PYFAList[i].pyBase[j].phrase[k].iHit = iHit;
+    } else {
+        PYFAList[i].pyBase[j].iIndex = iIndex;
+        PYFAList[i].pyBase[j].iHit = iHit;
+    }
+    PYJournalUpdateCounter(pystate, iIndex);
+    pystate->iOrderCount++;
+    return true;
+}
+
+static PyUsrPhrase* PYJournalFindUserPhrase(FcitxPinyinState* pystate,
+                                            const char* strPhrase,
+                                            const char* strMap,
+                                            int32_t* piPYFA, int32_t* piBase)
+{
+    char str[UTF8_MAX_LENGTH + 1];
+    int clen;
+    int32_t i, j, k;
+
+    if (strlen(strMap) < 4)
+        return NULL;
+    strncpy(str, strMap, 2);
+    str[2] = '\0';
+    i = GetBaseMapIndex(pystate, str);
+    if (i < 0)
+        return NULL;
+    clen = fcitx_utf8_char_len(strPhrase);
+    if (clen > UTF8_MAX_LENGTH)
+        return NULL;
+    strncpy(str, strPhrase, clen);
+    str[clen] = '\0';
+    j = GetBaseIndex(pystate, i, str);
+    if (j < 0)
+        return NULL;
+
+    *piPYFA = i;
+    *piBase = j;
+    PyBase* base = &pystate->PYFAList[i].pyBase[j];
+    PyUsrPhrase* userPhrase = base->userPhrase->next;
+    for (k = 0; k < base->iUserPhrase; k++) {
+        if (!strcmp(strMap + 2, userPhrase->phrase.strMap)
+            && !strcmp(strPhrase + clen, userPhrase->phrase.strPhrase))
+            return userPhrase;
+        userPhrase = userPhrase->next;
+    }
+    return NULL;
+}
+
+static boolean PYJournalReplayUserPhrase(FcitxPinyinState* pystate, FILE* fp,
+                                         boolean bDelete)
+{
+    char strPhrase[PY_JOURNAL_MAX_STRING];
+    char strMap[PY_JOURNAL_MAX_STRING];
+    uint32_t iIndex = 0, iHit = 0;
+    int32_t iPYFA = -1, iBase = -1;
+
+    if (!PYJournalReadString(fp, strPhrase, sizeof(strPhrase))
+        || !PYJournalReadString(fp, strMap, sizeof(strMap)))
+        return false;
+    if (!bDelete && (!fcitx_utils_read_uint32(fp, &iIndex)
+                     || !fcitx_utils_read_uint32(fp, &iHit)))
+        return false;
+
+    PyUsrPhrase* userPhrase = PYJournalFindUserPhrase(pystate, strPhrase, strMap,
+                                                      &iPYFA, &iBase);
+    if (bDelete) {
+        if (userPhrase)
+            PYDelUserPhrase(pystate, iPYFA, iBase, userPhrase);
+        return true;
+    }
+
+    if (!userPhrase && iPYFA >= 0
+        && fcitx_utf8_strlen(strPhrase) <= MAX_PY_PHRASE_LENGTH
+        && strlen(strMap) == fcitx_utf8_strlen(strPhrase) * 2) {
+        PYAddUserPhrase(pystate, strPhrase, strMap, false);
+        userPhrase = PYJournalFindUserPhrase(pystate, strPhrase, strMap,
+                                             &iPYFA, &iBase);
+    }
+    if (userPhrase) {
+        userPhrase->phrase.iIndex = iIndex;
+        userPhrase->phrase.iHit = iHit;
+        PYJournalUpdateCounter(pystate, iIndex);
+        pystate->iNewPYPhraseCount++;
+    }
+    return true;
+}
+
+static boolean PYJournalReplayFreq(FcitxPinyinState* pystate, FILE* fp,
+                                   boolean bDelete)
+{
+    char strPY[MAX_PY_PHRASE_LENGTH * MAX_PY_LENGTH + 1];
+    char strHZ[MAX_PY_PHRASE_LENGTH * UTF8_MAX_LENGTH + 1];
+    int32_t iPYFA = 0;
+    uint32_t iIndex = 0, iHit = 0;
+
+    if (!PYJournalReadString(fp, strPY, sizeof(strPY))
+        || !PYJournalReadString(fp, strHZ, sizeof(strHZ)))
+        return false;
+    if (!bDelete && (!fcitx_utils_read_int32(fp, &iPYFA)
+                     || !fcitx_utils_read_uint32(fp, &iIndex)
+                     || !fcitx_utils_read_uint32(fp, &iHit)))
+        return false;
+
+    PyFreq* pyFreq = PYFindFreq(pystate, strPY);
+    if (!pyFreq) {
+        if (bDelete || iPYFA < 0 || iPYFA >= pystate->iPYFACount)
+            return true;
+        pyFreq = PYNewFreq(pystate, strPY);
+    }
+
+    HZ* hz = PYFindFreqHZ(pyFreq, strHZ);
+    if (bDelete) {
+        if (hz) {
+            HASH_DEL(pyFreq->HZList, hz);
+            free(hz);
+            pyFreq->iCount--;
+            pystate->iNewFreqCount++;
+        }
+        return true;
+    }
+
+    if (!hz) {
+        if (iPYFA < 0 || iPYFA >= pystate->iPYFACount)
+            return true;
+        hz = PYNewFreqHZ(pyFreq, strHZ);
+    }
+    hz->iPYFA = iPYFA;
+    hz->iIndex = iIndex;
+    hz->iHit = iHit;
+    PYJournalUpdateCounter(pystate, iIndex);
+    pystate->iNewFreqCount++;
+    return true;
+}
+
+/*
+ * 在读入用户词库、索引和常用字之后调用，最后一条不完整的记录会被截掉
+ */
+void PYJournalReplay(FcitxPinyinState* pystate)
+{
+    PYJournal* journal = &pystate->journal;
+    char* path;
+    FILE* fp = FcitxXDGGetFileUserWithPrefix("pinyin", PY_JOURNAL_FILE, "r", &path);
+    long iGood = 0;
+    int iCount = 0;
+
+    if (!fp) {
+        free(path);
+        return;
+    }
+
+    journal->bReplaying = true;
+    uint32_t magic = 0;
+    if (fcitx_utils_read_uint32(fp, &magic) && magic == PY_JOURNAL_MAGIC_NUMBER) {
+        iGood = ftell(fp);
+        while (true) {
+            uint32_t type, end;
+            boolean ok;
+            if (!fcitx_utils_read_uint32(fp, &type))
+                break;
+
+            switch (type) {
+            case PY_JOURNAL_INDEX:
+                ok = PYJournalReplayIndex(pystate, fp);
+                break;
+            case PY_JOURNAL_USER_PHRASE:
+            case PY_JOURNAL_DEL_USER_PHRASE:
+                ok = PYJournalReplayUserPhrase(pystate, fp, type == PY_JOURNAL_DEL_USER_PHRASE);
+                break;
+            case PY_JOURNAL_FREQ:
+            case PY_JOURNAL_DEL_FREQ:
+                ok = PYJournalReplayFreq(pystate, fp, type == PY_JOURNAL_DEL_FREQ);
+                break;
+            default:
+                ok = false;
+                break;
+            }
+
+            if (!ok || !fcitx_utils_read_uint32(fp, &end)
+                || end != (type ^ PY_JOURNAL_MAGIC_NUMBER))
+                break;
+            iGood = ftell(fp);
+            iCount++;
+        }
+    }
+    journal->bReplaying = false;
+
+    fseek(fp, 0, SEEK_END);
+    journal->iSize = ftell(fp);
+    fclose(fp);
+
+    /* 不完整的记录之后再追加的内容也读不到，所以马上合并 */
+    if (journal->iSize != iGood) {
+        FcitxLog(WARNING, _("Pinyin journal is broken after %d records"), iCount);
+        if (!PYJournalCompact(pystate)) {
+            if (iGood == 0 || truncate(path, iGood) != 0)
+                unlink(path);
+            journal->iSize = iGood;
+        }
+    } else if (journal->iSize >= PY_JOURNAL_COMPACT_SIZE) {
+        PYJournalCompact(pystate);
+    }
+    free(path);
+}
+
+static int* PYJournalSnapshotCount(FcitxPinyinState* pystate,
+                                   PY_JOURNAL_SNAPSHOT snapshot)
+{
+    switch (snapshot) {
+    case PY_JOURNAL_SNAPSHOT_USERPHRASE:
+        return &pystate->iNewPYPhraseCount;
+    case PY_JOURNAL_SNAPSHOT_INDEX:
+        return &pystate->iOrderCount;
+    default:
+        return &pystate->iNewFreqCount;
+    }
+}
+
+/*
+ * 在主线程中把有改动的词库写到内存里，之后的改动继续写入日志
+ */
+static boolean PYJournalBeginCompact(FcitxPinyinState* pystate)
+{
+    PYJournal* journal = &pystate->journal;
+    PYJournalCompactor* compactor = &journal->compactor;
+    static void (*const writers[PY_JOURNAL_SNAPSHOT_COUNT])(FcitxPinyinState*, FILE*) = {
+        PYWriteUserPhrase, PYWriteIndex, PYWriteFreq
+    };
+    int i;
+
+    /* 只读入了单字时不能覆盖词库文件 */
+    if (compactor->bStarted || !pystate->bPYOtherDictLoaded)
+        return false;
+
+    for (i = 0; i < PY_JOURNAL_SNAPSHOT_COUNT; i++) {
+        compactor->data[i] = NULL;
+        compactor->len[i] = 0;
+        compactor->iCount[i] = *PYJournalSnapshotCount(pystate, i);
+    }
+    for (i = 0; i < PY_JOURNAL_SNAPSHOT_COUNT; i++) {
+        if (!compactor->iCount[i])
+            continue;
+        FILE* fp = open_memstream(&compactor->data[i], &compactor->len[i]);
+        if (!fp) {
+            for (i--; i >= 0; i--) {
+                free(compactor->data[i]);
+                compactor->data[i] = NULL;
+            }
+            return false;
+        }
+        writers[i](pystate, fp);
+        fclose(fp);
+    }
+    for (i = 0; i < PY_JOURNAL_SNAPSHOT_COUNT; i++)
+        *PYJournalSnapshotCount(pystate, i) = 0;
+
+    compactor->iSize = journal->iSize;
+    compactor->iDone = 0;
+    compactor->bSuccess = false;
+    compactor->bThread = false;
+    compactor->bStarted = true;
+    return true;
+}
+
+/* 不访问 FcitxPinyinState，可以在后台线程中调用 */
+static boolean PYJournalCompactWrite(PYJournalCompactor* compactor)
+{
+    static const char* const files[PY_JOURNAL_SNAPSHOT_COUNT] = {
+        PY_USERPHRASE_FILE, PY_INDEX_FILE, PY_FREQ_FILE
+    };
+    boolean success = true;
+    int i;
+
+    for (i = 0; i < PY_JOURNAL_SNAPSHOT_COUNT; i++) {
+        if (compactor->iCount[i])
+            success = PYSaveUserFile(files[i], compactor->data[i],
+                                     compactor->len[i]) && success;
+    }
+    return success;
+}
+
+static void* PYJournalCompactThread(void* arg)
+{
+    PYJournalCompactor* compactor = arg;
+    compactor->bSuccess = PYJournalCompactWrite(compactor);
+    fcitx_utils_atomic_add(&compactor->iDone, 1);
+    return NULL;
+}
+
+/*
+ * 日志的前 iSize 字节已经写入词库文件，只留下之后追加的记录
+ */
+static void PYJournalDropHead(FcitxPinyinState* pystate, long iSize)
+{
+    PYJournal* journal = &pystate->journal;
+    char *path, *tempfile = NULL;
+    FILE *fp, *tmp = NULL;
+    int fd = -1;
+    boolean success = false;
+
+    if (journal->fp) {
+        fclose(journal->fp);
+        journal->fp = NULL;
+    }
+
+    FcitxXDGGetFileUserWithPrefix("pinyin", PY_JOURNAL_FILE, NULL, &path);
+    if (journal->iSize <= iSize) {
+        unlink(path);
+        free(path);
+        journal->iSize = 0;
+        return;
+    }
+
+    fp = fopen(path, "r");
+    if (fp && fseek(fp, iSize, SEEK_SET) == 0) {
+        FcitxXDGGetFileUserWithPrefix("pinyin", PY_JOURNAL_TEMP_FILE, NULL,
+                                      &tempfile);
+        fd = mkstemp(tempfile);
+        if (fd >= 0)
+            tmp = fdopen(fd, "w");
+    }
+
+    if (tmp) {
+        char buf[4096];
+        size_t len;
+        long iNewSize;
+        fcitx_utils_write_uint32(tmp, PY_JOURNAL_MAGIC_NUMBER);
+        while ((len = fread(buf, sizeof(char), sizeof(buf), fp)) > 0)
+            fwrite(buf, sizeof(char), len, tmp);
+        success = !ferror(fp) && !ferror(tmp);
+        iNewSize = ftell(tmp);
+        success = (fclose(tmp) == 0) && success;
+        if (success && rename(tempfile, path) == 0)
+            journal->iSize = iNewSize;
+        else
+            success = false;
+    } else if (fd >= 0) {
+        close(fd);
+    }
+
+    /* 重放整个日志的结果也一样，只是下次还要再合并 */
+    if (!success) {
+        FcitxLog(WARNING, _("Cannot shrink Pinyin journal"));
+        if (tempfile)
+            unlink(tempfile);
+    }
+    if (fp)
+        fclose(fp);
+    free(tempfile);
+    free(path);
+}
+
+/*
+ * 后台写完之后在主线程中调用，bWait 为 false 时如果还没写完就返回 false
+ */
+static boolean PYJournalFinishCompact(FcitxPinyinState* pystate, boolean bWait)
+{
+    PYJournalCompactor* compactor = &pystate->journal.compactor;
+    int i;
+
+    if (!compactor->bStarted)
+        return true;
+    if (compactor->bThread) {
+        if (!bWait && !fcitx_utils_atomic_add(&compactor->iDone, 0))
+            return false;
+        pthread_join(compactor->thread, NULL);
+        compactor->bThread = false;
+    }
+    compactor->bStarted = false;
+
+    for (i = 0; i < PY_JOURNAL_SNAPSHOT_COUNT; i++) {
+        free(compactor->data[i]);
+        compactor->data[i] = NULL;
+        /* 改动还在日志里，下次合并时再写 */
+        if (!compactor->bSuccess)
+            *PYJournalSnapshotCount(pystate, i) += compactor->iCount[i];
+    }
+
+    if (compactor->bSuccess)
+        PYJournalDropHead(pystate, compactor->iSize);
+    return true;
+}
+
+/*
+ * 没有主循环或者不能创建线程时直接写
+ */
+static void PYJournalRunCompact(FcitxPinyinState* pystate)
+{
+    PYJournalCompactor* compactor = &pystate->journal.compactor;
+    if (pystate->owner &&
+        pthread_create(&compactor->thread, NULL, PYJournalCompactThread,
+                       compactor) == 0) {
+        compactor->bThread = true;
+        return;
+    }
+    compactor->bSuccess = PYJournalCompactWrite(compactor);
+    PYJournalFinishCompact(pystate, true);
+}
+
+/*
+ * 把日志合并到词库文件中，写完后才返回，全部写成功后才删除日志
+ */
+boolean PYJournalCompact(FcitxPinyinState* pystate)
+{
+    PYJournalCompactor* compactor = &pystate->journal.compactor;
+
+    PYJournalFinishCompact(pystate, true);
+    if (!PYJournalBeginCompact(pystate))
+        return false;
+    compactor->bSuccess = PYJournalCompactWrite(compactor);
+    PYJournalFinishCompact(pystate, true);
+    return compactor->bSuccess;
+}
+
+/*
+ * 在后台合并日志，由主循环检查是否写完
+ */
+void PYJournalStartCompact(FcitxPinyinState* pystate)
+{
+    if (!PYJournalBeginCompact(pystate))
+        return;
+    PYJournalRunCompact(pystate);
+    if (pystate->journal.compactor.bStarted &&
+        !FcitxInstanceCheckTimeoutByFunc(pystate->owner, PYJournalCompactTimeout))
+        FcitxInstanceAddTimeout(pystate->owner, PY_JOURNAL_COMPACT_POLL,
+                                PYJournalCompactTimeout, pystate);
+}
+
+static void PYJournalCompactTimeout(void* arg)
+{
+    FcitxPinyinState* pystate = arg;
+    PYJournal* journal = &pystate->journal;
+
+    if (!journal->compactor.bStarted) {
+        if (journal->iSize < PY_JOURNAL_COMPACT_SIZE ||
+            !PYJournalBeginCompact(pystate))
+            return;
+        PYJournalRunCompact(pystate);
+    }
+    /* 这个超时返回后才被删除，所以不能用 FcitxInstanceCheckTimeoutByFunc */
+    if (!PYJournalFinishCompact(pystate, false))
+        FcitxInstanceAddTimeout(pystate->owner, PY_JOURNAL_COMPACT_POLL,
+                                PYJournalCompactTimeout, pystate);
+}
+
+void PYJournalClose(FcitxPinyinState* pystate)
+{
+    PYJournal* journal = &pystate->journal;
+    if (pystate->owner)
+        FcitxInstanceRemoveTimeoutByFunc(pystate->owner, PYJournalCompactTimeout);
+    PYJournalFinishCompact(pystate, true);
+    if (journal->fp) {
+        fclose(journal->fp);
+        journal->fp = NULL;
+    }
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -0,0 +1,186 @@
+#include "config.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/utarray.h"
+#include "py.h"
+#include "pyParser.h"
+
+/* 词库、词频或模糊音设置改变后需要重新建立词图 */
+void PYLatticeReset(FcitxPinyinState* pystate)
+{
+    pystate->lattice.iCount = 0;
+}
+
+static void PYLatticeRelax(FcitxPinyinState* pystate, int s, int e,
+                           const PYLatticeWord* word, uint32_t iHit,
+                           uint32_t iIndex)
+{
+    PYLattice* lattice = &pystate->lattice;
+    PYLatticeNode* from = &lattice->nodes[s];
+    PYLatticeNode* to = &lattice->nodes[e];
+
+    if (from->iPrev < 0)
+        return;
+
+    int32_t iWords = from->iWords + 1;
+    uint64_t iTotalHit = from->iHit + iHit;
+    uint64_t iTotalIndex = from->iIndex + iIndex;
+
+    /* 相同时先到者优先 */
+    if (to->iPrev >= 0) {
+        if (iWords != to->iWords) {
+            if (iWords > to->iWords)
+                return;
+        } else if (iTotalHit != to->iHit) {
+            if (iTotalHit < to->iHit)
+                return;
+        } else if (iTotalIndex <= to->iIndex) {
+            return;
+        }
+    }
+
+    to->iPrev = s;
+    to->word = *word;
+    to->iWords = iWords;
+    to->iHit = iTotalHit;
+    to->iIndex = iTotalIndex;
+}
+
+/*
+ * 以 findMap 更新词图。结点 i 只与前 i 个音节有关，所以与上次相同的音节
+ * 之前的结点可以保留，只需找出结束于其后的词。
+ */
+static void PYLatticeUpdate(FcitxPinyinState* pystate)
+{
+    PYLattice* lattice = &pystate->lattice;
+    ParsePYStruct* findMap = &pystate->findMap;
+    PYFA* PYFAList = pystate->PYFAList;
+    int n = findMap->iHZCount;
+    int k, s, e;
+
+    for (k = 0; k < lattice->iCount && k < n; k++) {
+        if (strcmp(lattice->strMap[k], findMap->strMap[k]) != 0)
+            break;
+    }
+    if (k == n) {
+        lattice->iCount = n;
+        return;
+    }
+
+    if (k == 0) {
+        memset(&lattice->nodes[0], 0, sizeof(PYLatticeNode));
+    }
+    for (e = k + 1; e <= n; e++) {
+        lattice->nodes[e].iPrev = -1;
+        lattice->nodes[e].bPhrase = false;
+    }
+
+    UT_array matches;
+    utarray_init(&matches, &py_phrase_match_icd);
+    char strMap[MAX_WORDS_USER_INPUT * 2 + 1];
+
+    /* 词组不会长于 MAX_PY_PHRASE_LENGTH，更早开始的词不会结束于 k 之后 */
+    s = k + 1 - MAX_PY_PHRASE_LENGTH;
+    if (s < 0)
+        s = 0;
+    for (; s < n; s++) {
+        PYLatticeWord word;
+        int i;
+
+        /* 单字取词频最高的 */
+        if (s >= k) {
+            PyBase* best = NULL;
+            PYSyllableMask mask;
+            word.phrase = NULL;
+            PYSyllableMaskFor2Map(&pystate->pyconfig, findMap->strMap[s], pystate->bSP, &mask);
+            for (i = 0; i < pystate->iPYFACount; i++) {
+                int32_t j;
+                if (!PYSyllableMatch(&mask, PYFAList[i].iSyllable))
+                    continue;
+                for (j = 0; j < PYFAList[i].iBase; j++) {
+                    if (!best || PYFAList[i].pyBase[j].iHit > best->iHit) {
+                        best = &PYFAList[i].pyBase[j];
+                        word.iPYFA = i;
+                        word.iBase = j;
+                    }
+                }
+            }
+            if (best)
+                PYLatticeRelax(pystate, s, s + 1, &word, best->iHit, best->iIndex);
+        }
+
+        if (s + 1 >= n)
+            continue;
+
+        strMap[0] = '\0';
+        for (i = s + 1; i < n; i++)
+            strcat(strMap, findMap->strMap[i]);
+
+        /* 先用户词组，再系统词组 */
+        for (i = 0; i < 2; i++) {
+            PYPhraseMatch* match;
+            PYPhraseIndexMatch(pystate, findMap->strMap[s], strMap, i == 0, &matches);
+            for (match = (PYPhraseMatch*) utarray_front(&matches);
+                 match != NULL;
+                 match = (PYPhraseMatch*) utarray_next(&matches, match)) {
+                e = s + 1 + strlen(match->phrase->strMap) / 2;
+                if (e <= k)
+                    continue;
+                word.iPYFA = match->iPYFA;
+                word.iBase = match->iBase;
+                word.phrase = match->phrase;
+                PYLatticeRelax(pystate, s, e, &word, match->phrase->iHit,
+                               match->phrase->iIndex);
+                if (s == 0)
+                    lattice->nodes[e].bPhrase = true;
+            }
+        }
+    }
+
+    utarray_done(&matches);
+
+    for (s = k; s < n; s++)
+        strcpy(lattice->strMap[s], findMap->strMap[s]);
+    lattice->iCount = n;
+}
+
+/*
+ * 取整句及其拼音映射，如果输入本身就是一个词组，或者有音节找不到字，
+ * 则返回 false
+ */
+boolean PYLatticeGetSentence(FcitxPinyinState* pystate, char* strHZ, char* strMap)
+{
+    PYLattice* lattice = &pystate->lattice;
+    PYFA* PYFAList = pystate->PYFAList;
+    int n = pystate->findMap.iHZCount;
+    PYLatticeWord* words[MAX_WORDS_USER_INPUT + 3];
+    int iWords = 0;
+    int e;
+
+    strHZ[0] = '\0';
+    strMap[0] = '\0';
+
+    PYLatticeUpdate(pystate);
+    if (lattice->nodes[n].bPhrase || lattice->nodes[n].iPrev < 0)
+        return false;
+
+    for (e = n; e > 0; e = lattice->nodes[e].iPrev)
+        words[iWords++] = &lattice->nodes[e].word;
+
+    while (iWords--) {
+        PYLatticeWord* word = words[iWords];
+        strcat(strHZ, PYFAList[word->iPYFA].pyBase[word->iBase].strHZ);
+        strcat(strMap, PYFAList[word->iPYFA].strMap);
+        if (word->phrase) {
+            strcat(strHZ, word->phrase->strPhrase);
+            strcat(strMap, word->phrase->strMap);
+        }
+    }
+    return true;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -24,6 +24,7 @@
 #include "fcitx/fcitx.h"
 #include "fcitx/ime.h"
 #include "fcitx-utils/log.h"
+#include "fcitx-utils/utf8.h"
 
 #include "pyMapTable.h"
 #include "PYFA.h"
@@ -102,6 +103,54 @@ int FindPYFAIndex(FcitxPinyinConfig *pyconfig, const char *strPY, boolean bMode)
 }
 
 void ParsePY(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * parsePY, PYPARSEINPUTMODE mode, boolean bSP)
+{
+    ParsePYCached(pyconfig, strPY, parsePY, mode, bSP, NULL);
+}
+
+/*
+ * 从上次的结果中找出不受改动影响的最后一步，恢复到这一步开始时的状态，
+ * 返回这一步开始的位置
+ */
+static int ParsePYResume(FcitxPinyinConfig* pyconfig, const char* strPY,
+                         ParsePYStruct* parsePY, PYPARSEINPUTMODE mode,
+                         ParsePYCache* cache, boolean* bSeperator)
+{
+    int iSame = 0;
+    int i, j;
+
+    if (!cache->bValid || cache->mode != mode || cache->iSerial != pyconfig->iSerial) {
+        cache->iSteps = 0;
+        return 0;
+    }
+
+    while (cache->strPY[iSame] && cache->strPY[iSame] == strPY[iSame])
+        iSame++;
+    for (j = cache->iSteps - 1; j > 0; j--) {
+        if (cache->steps[j].iOffset + 2 * MAX_PY_LENGTH <= iSame)
+            break;
+    }
+    if (j <= 0) {
+        cache->iSteps = 0;
+        return 0;
+    }
+
+    ParsePYStep* step = &cache->steps[j];
+    parsePY->iHZCount = step->iHZCount;
+    parsePY->iMode = step->iMode;
+    *bSeperator = step->bSeperator;
+    for (i = 0; i < step->iHZCount; i++) {
+        strcpy(parsePY->strPYParsed[i], cache->parse.strPYParsed[i]);
+        strcpy(parsePY->strMap[i], cache->parse.strMap[i]);
+    }
+    cache->iSteps = j;
+    return step->iOffset;
+}
+
+/*
+ * cache 不为 NULL 时，全拼从上次输入中不变的部分继续分词
+ */
+void ParsePYCached(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * parsePY,
+                   PYPARSEINPUTMODE mode, boolean bSP, ParsePYCache* cache)
 {
     const char           *strP;
     int             iIndex;
@@ -113,41 +162,37 @@ void ParsePY(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * par
     strP = strPY;
     parsePY->iHZCount = 0;
 
+    if (cache && (bSP || !strPY[0] || strlen(strPY) > MAX_USER_INPUT)) {
+        cache->bValid = false;
+        cache = NULL;
+    }
+
     if (bSP) {
-        char            strQP[7];
         char            strJP[3];
-
-        strJP[2] = '\0';
+        const SP_KEY*   key;
+        SP_KEY          keybuf;
+        int             iMap = (mode == PY_PARSE_INPUT_USER) ? 0 : 1;
 
         while (*strP) {
-            strJP[0] = *strP++;
-            strJP[1] = *strP;
-            SP2QP(pyconfig, strJP, strQP);
-            MapPY(pyconfig, strQP, str_Map, mode);
-
-            if (!*strP) {
-                strcpy(parsePY->strMap[parsePY->iHZCount], str_Map);
-                strcpy(parsePY->strPYParsed[parsePY->iHZCount++], strJP);
-                break;
+            strJP[0] = strP[0];
+            strJP[1] = '\0';
+            key = NULL;
+
+            if (strP[1]) {
+                key = SPGetKey(pyconfig, strP[0], strP[1], &keybuf);
+                if (key->bValid)
+                    strJP[1] = strP[1];
+                else
+                    key = NULL;
             }
 
-            iIndex = FindPYFAIndex(pyconfig, strQP, 0);
-
-            if (iIndex != -1) {
-                strcpy(parsePY->strMap[parsePY->iHZCount], str_Map);
-                strcpy(parsePY->strPYParsed[parsePY->iHZCount++], strJP);
-                strP++;
-            } else {
-                strJP[1] = '\0';
-                SP2QP(pyconfig, strJP, strQP);
+            if (!key)
+                key = SPGetKey(pyconfig, strP[0], '\0', &keybuf);
 
-                if (!MapPY(pyconfig, strQP, str_Map, mode))
-                    strcpy(parsePY->strMap[parsePY->iHZCount], strJP);
-                else
-                    strcpy(parsePY->strMap[parsePY->iHZCount], str_Map);
-
-                strcpy(parsePY->strPYParsed[parsePY->iHZCount++], strJP);
-            }
+            strJP[2] = '\0';
+            strcpy(parsePY->strMap[parsePY->iHZCount], key->strMap[iMap]);
+            strcpy(parsePY->strPYParsed[parsePY->iHZCount++], strJP);
+            strP += strJP[1] ? 2 : 1;
 
             if (*strP == PY_SEPARATOR) {
                 strcat(parsePY->strPYParsed[parsePY->iHZCount - 1], PY_SEPARATOR_S);
@@ -159,7 +204,18 @@ void ParsePY(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * par
     } else {
         boolean            bSeperator = false;
 
+        if (cache)
+            strP += ParsePYResume(pyconfig, strPY, parsePY, mode, cache, &bSeperator);
+
         do {
+            if (cache) {
+                ParsePYStep* step = &cache->steps[cache->iSteps++];
+                step->iOffset = strP - strPY;
+                step->iHZCount = parsePY->iHZCount;
+                step->iMode = parsePY->iMode;
+                step->bSeperator = bSeperator;
+            }
+
             iIndex = FindPYFAIndex(pyconfig, strP, 1);
 
             if (iIndex != -1) {
@@ -307,6 +363,14 @@ void ParsePY(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * par
                 }
             }
         } while (*strP);
+
+        if (cache) {
+            strcpy(cache->strPY, strPY);
+            memcpy(&cache->parse, parsePY, sizeof(ParsePYStruct));
+            cache->mode = mode;
+            cache->iSerial = pyconfig->iSerial;
+            cache->bValid = true;
+        }
     }
 
     if (strPY[strlen(strPY) - 1] == PY_SEPARATOR && !bSP)
@@ -322,6 +386,25 @@ void ParsePY(FcitxPinyinConfig *pyconfig, const char *strPY, ParsePYStruct * par
     }
 }
 
+/*
+ * 声母的序号在下面被用来查 consonantMapTable，但声母表比它长，
+ * 越界时返回 -1
+ */
+static int CheckConsonantIndex(int iIndex)
+{
+    int             i;
+
+    if (iIndex < 0)
+        return -1;
+
+    for (i = 0; i < iIndex; i++) {
+        if (!consonantMapTable[i].cMap)
+            return -1;
+    }
+
+    return consonantMapTable[iIndex].cMap ? iIndex : -1;
+}
+
 /*
  * 将一个拼音(包括仅为声母或韵母)转换为拼音映射
  * 返回true为转换成功，否则为false(一般是因为strPY不是一个标准的拼音)
@@ -373,14 +456,23 @@ boolean MapPY(FcitxPinyinConfig* pyconfig, const char* strPYorigin, char strMap[
         str[0] = strPY[0];
         str[1] = strPY[1];
         str[2] = '\0';
-        iIndex = IsSyllabary(str, 0);
+        iIndex = CheckConsonantIndex(IsSyllabary(str, 0));
+
+        if (iIndex == -1)
+            return false;
+
         strMap[0] = consonantMapTable[iIndex].cMap;
+
         iIndex = IsConsonant(strPY + 2, 0);
+
+        if (iIndex == -1)
+            return false;
+
         strMap[1] = consonantMapTable[iIndex].cMap;
     } else {
         str[0] = strPY[0];
         str[1] = '\0';
-        iIndex = IsSyllabary(str, 0);
+        iIndex = CheckConsonantIndex(IsSyllabary(str, 0));
 
         if (iIndex == -1)
             return false;
@@ -441,16 +533,78 @@ boolean MapToPY(char strMap[3], char *strPY)
     return false;
 }
 
+static boolean IsPYString(const char* str)
+{
+    for (; *str; str++) {
+        if (!((*str >= 'a' && *str <= 'z') || *str == PY_SEPARATOR))
+            return false;
+    }
+    return true;
+}
+
 /*
- * 比较一位拼音映射
- * 0表示相等
- * b指示是声母还是韵母，true表示声母
+ * 解析 .org 词库中的一行，格式为 "拼音 词组"，scel2org -a 输出的
+ * "词组 拼音" 也可以。line 会被修改，strMap 的长度至少为
+ * MAX_PY_PHRASE_LENGTH * 2 + 1。返回 false 表示这一行不是可用的词组
  */
-int Cmp1Map(FcitxPinyinConfig* pyconfig,
-            char map1, char map2,
-            boolean is_S,
-            boolean bUseMH,
-            boolean bSP)
+boolean ParsePYPhraseLine(FcitxPinyinConfig* pyconfig, char* line,
+                          char** strPhrase, char* strMap)
+{
+    char           *strPY, *pstr;
+    ParsePYStruct   parse;
+    size_t          len;
+    int             i;
+
+    line += strspn(line, " \t");
+    len = strcspn(line, "\r\n");
+    while (len > 0 && (line[len - 1] == ' ' || line[len - 1] == '\t'))
+        len--;
+    line[len] = '\0';
+    if (!line[0] || line[0] == '#')
+        return false;
+
+    pstr = line + strcspn(line, " \t");
+    if (!*pstr)
+        return false;
+    *pstr++ = '\0';
+    pstr += strspn(pstr, " \t");
+    if (pstr[strcspn(pstr, " \t")])
+        return false;
+
+    if (IsPYString(line)) {
+        strPY = line;
+        *strPhrase = pstr;
+    } else if (IsPYString(pstr)) {
+        strPY = pstr;
+        *strPhrase = line;
+    } else
+        return false;
+
+    if (strlen(strPY) > MAX_USER_INPUT || !fcitx_utf8_check_string(*strPhrase))
+        return false;
+    len = fcitx_utf8_strlen(*strPhrase);
+    if (len < 2 || len > MAX_PY_PHRASE_LENGTH)
+        return false;
+
+    ParsePY(pyconfig, strPY, &parse, PY_PARSE_INPUT_SYSTEM, false);
+    if (parse.iHZCount != (int) len || parse.iMode == PARSE_ERROR
+        || (parse.iMode & PARSE_ABBR))
+        return false;
+
+    strMap[0] = '\0';
+    for (i = 0; i < parse.iHZCount; i++) {
+        if (strlen(parse.strMap[i]) != 2)
+            return false;
+        strcat(strMap, parse.strMap[i]);
+    }
+    return true;
+}
+
+static int Cmp1MapSlow(FcitxPinyinConfig* pyconfig,
+                       char map1, char map2,
+                       boolean is_S,
+                       boolean bUseMH,
+                       boolean bSP)
 {
     int             iVal;
 
@@ -478,6 +632,97 @@ int Cmp1Map(FcitxPinyinConfig* pyconfig,
     return (map1 - map2);
 }
 
+/* PYMapCode 的逆 */
+static const char pyMapCodeChar[] =
+    "\0 0ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+#define PY_MAP_CODE_VALID (sizeof(pyMapCodeChar) - 1)
+
+static uint64_t PYFuzzyMaskSlow(FcitxPinyinConfig* pyconfig, boolean bSP,
+                                boolean is_S, boolean bUseMH, char map2)
+{
+    uint64_t mask = 0;
+    unsigned int i;
+    if (PYMapCode(map2) == PY_MAP_CODE_INVALID)
+        return 0;
+    for (i = 0; i < PY_MAP_CODE_VALID; i++) {
+        if (!Cmp1MapSlow(pyconfig, pyMapCodeChar[i], map2, is_S, bUseMH, bSP))
+            mask |= ((uint64_t) 1) << i;
+    }
+    return mask;
+}
+
+/*
+ * 模糊音或全拼的设置改变后需要重新计算
+ */
+void PYBuildFuzzyMask(FcitxPinyinConfig* pyconfig)
+{
+    int bSP, is_S, bUseMH;
+    unsigned int i;
+    memset(pyconfig->fuzzyMask, 0, sizeof(pyconfig->fuzzyMask));
+    for (bSP = 0; bSP < 2; bSP++)
+        for (is_S = 0; is_S < 2; is_S++)
+            for (bUseMH = 0; bUseMH < 2; bUseMH++)
+                for (i = 0; i < PY_MAP_CODE_VALID; i++)
+                    pyconfig->fuzzyMask[bSP][is_S][bUseMH][i] =
+                        PYFuzzyMaskSlow(pyconfig, bSP, is_S, bUseMH, pyMapCodeChar[i]);
+    pyconfig->bFuzzyMaskBuilt = true;
+}
+
+static uint64_t PYFuzzyMask(FcitxPinyinConfig* pyconfig, boolean bSP,
+                            boolean is_S, boolean bUseMH, char map2)
+{
+    if (!pyconfig->bFuzzyMaskBuilt)
+        return PYFuzzyMaskSlow(pyconfig, bSP, is_S, bUseMH, map2);
+    return pyconfig->fuzzyMask[!!bSP][!!is_S][!!bUseMH][PYMapCode(map2)];
+}
+
+/*
+ * 比较一位拼音映射
+ * 0表示相等
+ * b指示是声母还是韵母，true表示声母
+ */
+int Cmp1Map(FcitxPinyinConfig* pyconfig,
+            char map1, char map2,
+            boolean is_S,
+            boolean bUseMH,
+            boolean bSP)
+{
+    int code1 = PYMapCode(map1);
+    if (!pyconfig->bFuzzyMaskBuilt || code1 == PY_MAP_CODE_INVALID
+        || PYMapCode(map2) == PY_MAP_CODE_INVALID)
+        return Cmp1MapSlow(pyconfig, map1, map2, is_S, bUseMH, bSP);
+
+    if ((PYFuzzyMask(pyconfig, bSP, is_S, bUseMH, map2) >> code1) & 1)
+        return 0;
+    return (map1 - map2);
+}
+
+/*
+ * 与 Cmp2Map(pyconfig, map1, strMap, bSP) 为 0 的 map1 相符
+ */
+void PYSyllableMaskFor2Map(FcitxPinyinConfig* pyconfig, const char* strMap,
+                           boolean bSP, PYSyllableMask* mask)
+{
+    boolean bUseMH = IsZ_C_S(strMap[0]) && strMap[1] == '0';
+    mask->s = PYFuzzyMask(pyconfig, bSP, true, bUseMH, strMap[0]);
+    mask->c = PYFuzzyMask(pyconfig, bSP, false, IsJ_Q_X_Y(strMap[0]), strMap[1]);
+}
+
+/*
+ * 与 CmpMap 比较一个音节时相符，strMap 为输入的，可以只有一位，
+ * 此时只与只有一位的相符
+ */
+void PYSyllableMaskForMap(FcitxPinyinConfig* pyconfig, const char* strMap,
+                          boolean bSP, PYSyllableMask* mask)
+{
+    boolean bUseMH = IsZ_C_S(strMap[0]) && (strMap[1] == '0' || !strMap[1]);
+    mask->s = PYFuzzyMask(pyconfig, bSP, true, bUseMH, strMap[0]);
+    if (!strMap[1])
+        mask->c = ((uint64_t) 1) << PYMapCode('\0');
+    else
+        mask->c = PYFuzzyMask(pyconfig, bSP, false, false, strMap[1]);
+}
+
 /*
  * 比较第二位拼音映射是否和第一个相等
  * 0表示相等
@@ -534,47 +779,94 @@ int CmpMap(FcitxPinyinConfig* pyconfig, const char *strMap1,
 
 #include "pysplitdata.h"
 
-struct _PYMappedSplitData {
-    char py[MAX_PY_LENGTH * 2 + 2];
-    float freq;
+typedef struct _PYSplitName {
+    const char* py;
+    int index;
     UT_hash_handle hh;
-};
+} PYSplitName;
 
+static int PYSplitNameIndex(PYSplitName** names, const char* py, int* count)
+{
+    PYSplitName* name = NULL;
+    HASH_FIND_STR(*names, py, name);
+    if (!name) {
+        name = fcitx_utils_new(PYSplitName);
+        name->py = py;
+        name->index = (*count)++;
+        HASH_ADD_KEYPTR(hh, *names, name->py, strlen(name->py), name);
+    }
+    return name->index;
+}
+
+static int PYSplitNameFind(PYSplitName* names, const char* py)
+{
+    PYSplitName* name = NULL;
+    HASH_FIND_STR(names, py, name);
+    return name ? name->index : -1;
+}
+
+static void PYSplitNameFree(PYSplitName** names)
+{
+    while (*names) {
+        PYSplitName* name = *names;
+        HASH_DEL(*names, name);
+        free(name);
+    }
+}
+
+/*
+ * 在 InitPYTable 之后调用，分词的前后两个音节各自编号，频率存为二维表
+ */
 void InitPYSplitData(FcitxPinyinConfig* pyconfig)
 {
     size_t size = sizeof(pySplitData) / sizeof(pySplitData[0]);
-    unsigned int i = 0;
-    for (i = 0;i < size;i++) {
-        PYMappedSplitData *data = fcitx_utils_new(PYMappedSplitData);
-        const char *strs[] = {pySplitData[i].py1, " ", pySplitData[i].py2};
-        fcitx_utils_cat_str_simple_with_len(data->py, MAX_PY_LENGTH * 2 + 2,
-                                            3, strs);
-        data->freq = pySplitData[i].freq;
-        HASH_ADD_STR(pyconfig->splitData, py, data);
+    PYSplitName* names1 = NULL;
+    PYSplitName* names2 = NULL;
+    int count1 = 0, count2 = 0;
+    unsigned int i;
+
+    for (i = 0; i < size; i++) {
+        PYSplitNameIndex(&names1, pySplitData[i].py1, &count1);
+        PYSplitNameIndex(&names2, pySplitData[i].py2, &count2);
+    }
+
+    pyconfig->iSplitCols = count2;
+    pyconfig->splitFreq = fcitx_utils_malloc0(sizeof(float) * count1 * count2);
+    for (i = 0; i < size; i++) {
+        int row = PYSplitNameFind(names1, pySplitData[i].py1);
+        int col = PYSplitNameFind(names2, pySplitData[i].py2);
+        pyconfig->splitFreq[row * count2 + col] = pySplitData[i].freq;
+    }
+
+    for (size = 0; pyconfig->PYTable[size].strPY[0]; size++);
+    pyconfig->splitIndex = fcitx_utils_malloc0(sizeof(pyconfig->splitIndex[0]) * (size + 1));
+    for (i = 0; i < size; i++) {
+        pyconfig->splitIndex[i][0] = PYSplitNameFind(names1, pyconfig->PYTable[i].strPY);
+        pyconfig->splitIndex[i][1] = PYSplitNameFind(names2, pyconfig->PYTable[i].strPY);
     }
+
+    PYSplitNameFree(&names1);
+    PYSplitNameFree(&names2);
 }
 
 double LookupPYFreq(FcitxPinyinConfig* pyconfig, int index1, int index2)
 {
-    if (index1 < 0 || index2 < 0)
+    /* createPYMB 等工具不读入分词数据 */
+    if (index1 < 0 || index2 < 0 || !pyconfig->splitIndex)
         return 0;
-    fcitx_utils_local_cat_str(py, 6 * 2 + 2, pyconfig->PYTable[index1].strPY,
-                              " ", pyconfig->PYTable[index2].strPY);
-    PYMappedSplitData *s = NULL;
-    HASH_FIND_STR(pyconfig->splitData, py, s);
-
-    if (s == NULL)
+    int row = pyconfig->splitIndex[index1][0];
+    int col = pyconfig->splitIndex[index2][1];
+    if (row < 0 || col < 0)
         return 0;
-    return s->freq;
+    return pyconfig->splitFreq[row * pyconfig->iSplitCols + col];
 }
 
 void FreePYSplitData(FcitxPinyinConfig* pyconfig)
 {
-    while (pyconfig->splitData) {
-        PYMappedSplitData* data = pyconfig->splitData;
-        HASH_DEL(pyconfig->splitData, data);
-        free(data);
-    }
+    free(pyconfig->splitIndex);
+    free(pyconfig->splitFreq);
+    pyconfig->splitIndex = NULL;
+    pyconfig->splitFreq = NULL;
 }
 
 // kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include "fcitx/fcitx.h"
+#include "fcitx/ime.h"
 #include "fcitx-config/fcitx-config.h"
 #include "pydef.h"
 
@@ -40,6 +41,48 @@ typedef enum _PYPARSEINPUTMODE {
     PY_PARSE_INPUT_SYSTEM = ' '
 } PYPARSEINPUTMODE;     //这个值不能随意修改
 
+/*
+ * 拼音映射的每一位编码为 0~63 的整数，一个音节的两位拼成 12 位的 PYSyllable。
+ * 模糊音预先算成位图，PYSyllableMask 中置位的编码与输入的音节相符。
+ */
+#define PY_MAP_CODE_COUNT 64
+#define PY_MAP_CODE_INVALID (PY_MAP_CODE_COUNT - 1)
+
+typedef uint16_t PYSyllable;
+
+typedef struct _PYSyllableMask {
+    uint64_t        s;          /* 声母 */
+    uint64_t        c;          /* 韵母 */
+} PYSyllableMask;
+
+static inline int PYMapCode(char map)
+{
+    if (map >= 'A' && map <= 'Z')
+        return map - 'A' + 3;
+    if (map >= 'a' && map <= 'z')
+        return map - 'a' + 29;
+    switch (map) {
+    case '\0':
+        return 0;
+    case ' ':
+        return 1;
+    case '0':
+        return 2;
+    }
+    return PY_MAP_CODE_INVALID;
+}
+
+/* strMap 可以只有一位 */
+static inline PYSyllable PYMapToSyllable(const char* strMap)
+{
+    return (PYMapCode(strMap[0]) << 6) | PYMapCode(strMap[0] ? strMap[1] : '\0');
+}
+
+static inline boolean PYSyllableMatch(const PYSyllableMask* mask, PYSyllable syllable)
+{
+    return (mask->s >> (syllable >> 6)) & (mask->c >> (syllable & 0x3f)) & 1;
+}
+
 typedef struct _ParsePYStruct {
     char            strPYParsed[MAX_WORDS_USER_INPUT + 3][MAX_PY_LENGTH + 2];
     char            strMap[MAX_WORDS_USER_INPUT + 3][3];
@@ -47,18 +90,49 @@ typedef struct _ParsePYStruct {
     char            iMode;
 } ParsePYStruct;
 
+/* ParsePY 中每一步开始时的状态 */
+typedef struct _ParsePYStep {
+    int16_t         iOffset;
+    int8_t          iHZCount;
+    char            iMode;
+    boolean         bSeperator;
+} ParsePYStep;
+
+/*
+ * 上一次全拼分词的结果。每一步最多向后看 2 * MAX_PY_LENGTH 个字符，
+ * 所以与上次输入相同的部分中足够靠前的步骤不用重做
+ */
+typedef struct _ParsePYCache {
+    char            strPY[MAX_USER_INPUT + 1];
+    ParsePYStruct   parse;
+    ParsePYStep     steps[MAX_USER_INPUT + 1];
+    int             iSteps;
+    PYPARSEINPUTMODE mode;
+    uint32_t        iSerial;
+    boolean         bValid;
+} ParsePYCache;
+
 struct _FcitxPinyinConfig;
 
 int             IsSyllabary(const char *strPY, boolean bMode);
 int             IsConsonant(const char *strPY, boolean bMode);
 int             FindPYFAIndex(struct _FcitxPinyinConfig* pyconfig, const char *strPY, boolean bMode);
 void            ParsePY(struct _FcitxPinyinConfig* pyconfig, const char* strPY, ParsePYStruct* parsePY, PYPARSEINPUTMODE mode, boolean bSP);
+void            ParsePYCached(struct _FcitxPinyinConfig* pyconfig, const char* strPY, ParsePYStruct* parsePY,
+                              PYPARSEINPUTMODE mode, boolean bSP, ParsePYCache* cache);
 boolean         MapPY(struct _FcitxPinyinConfig* pyconfig, const char* strPYorigin, char strMap[3], PYPARSEINPUTMODE mode);
 boolean         MapToPY(char strMap[3], char *strPY);
+boolean         ParsePYPhraseLine(struct _FcitxPinyinConfig* pyconfig, char* line,
+                                  char** strPhrase, char* strMap);
 int             CmpMap(struct _FcitxPinyinConfig* pyconfig, const char* strMap1,
                        const char* strMap2, int* iMatchedLength, boolean bSP);
 int             Cmp1Map(struct _FcitxPinyinConfig* pyconfig, char map1, char map2, boolean is_S, boolean bUseMH, boolean bSP);
 int             Cmp2Map(struct _FcitxPinyinConfig* pyconfig, char map1[3], char map2[3], boolean bSP);
+void            PYBuildFuzzyMask(struct _FcitxPinyinConfig* pyconfig);
+void            PYSyllableMaskFor2Map(struct _FcitxPinyinConfig* pyconfig, const char* strMap,
+                                      boolean bSP, PYSyllableMask* mask);
+void            PYSyllableMaskForMap(struct _FcitxPinyinConfig* pyconfig, const char* strMap,
+                                     boolean bSP, PYSyllableMask* mask);
 void            InitPYSplitData(struct _FcitxPinyinConfig* pyconfig);
 void            FreePYSplitData(struct _FcitxPinyinConfig* pyconfig);
 
@@ -0,0 +1,421 @@
+#include "config.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/utarray.h"
+#include "fcitx-utils/utf8.h"
+#include "py.h"
+#include "PYFA.h"
+#include "pyParser.h"
+
+static const UT_icd py_phrase_node_icd = {
+    sizeof(PYPhraseNode), NULL, NULL, NULL
+};
+
+static const UT_icd py_phrase_entry_icd = {
+    sizeof(PYPhraseEntry), NULL, NULL, NULL
+};
+
+static const UT_icd py_user_phrase_entry_icd = {
+    sizeof(PYUserPhraseEntry), NULL, NULL, NULL
+};
+
+const UT_icd py_phrase_match_icd = {
+    sizeof(PYPhraseMatch), NULL, NULL, NULL
+};
+
+static const UT_icd py_hz_entry_icd = {
+    sizeof(PYHZEntry), NULL, NULL, NULL
+};
+
+#define NODE(index, i) ((PYPhraseNode*) _utarray_eltptr(&(index)->nodes, i))
+
+/* 找到 strMap 对应的节点，create 为 false 时找不到返回 0 */
+static uint32_t PYPhraseIndexFindNode(PYPhraseIndex* index, int32_t iPYFA,
+                                      const char* strMap, boolean create)
+{
+    uint32_t iNode = iPYFA;
+
+    while (strMap[0]) {
+        char c1 = strMap[1];
+        PYSyllable iSyllable = PYMapToSyllable(strMap);
+        uint32_t iChild;
+        for (iChild = NODE(index, iNode)->iChild; iChild;
+             iChild = NODE(index, iChild)->iNext) {
+            if (NODE(index, iChild)->iSyllable == iSyllable)
+                break;
+        }
+
+        if (!iChild) {
+            if (!create)
+                return 0;
+            PYPhraseNode node;
+            memset(&node, 0, sizeof(PYPhraseNode));
+            node.iSyllable = iSyllable;
+            node.iNext = NODE(index, iNode)->iChild;
+            iChild = utarray_len(&index->nodes);
+            utarray_push_back(&index->nodes, &node);
+            NODE(index, iNode)->iChild = iChild;
+        }
+
+        iNode = iChild;
+        if (!c1)
+            break;
+        strMap += 2;
+    }
+    return iNode;
+}
+
+static void PYPhraseIndexInit(FcitxPinyinState* pystate)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    PYPhraseNode node;
+    int32_t i;
+
+    if (index->nodes.icd) {
+        utarray_clear(&index->nodes);
+        utarray_clear(&index->entries);
+        utarray_clear(&index->userEntries);
+    } else {
+        utarray_init(&index->nodes, &py_phrase_node_icd);
+        utarray_init(&index->entries, &py_phrase_entry_icd);
+        utarray_init(&index->userEntries, &py_user_phrase_entry_icd);
+    }
+    index->iFreeUserEntry = 0;
+
+    memset(&node, 0, sizeof(PYPhraseNode));
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        node.iSyllable = pystate->PYFAList[i].iSyllable;
+        utarray_push_back(&index->nodes, &node);
+    }
+    /* entries[0] means no entry */
+    utarray_extend_back(&index->entries);
+    utarray_extend_back(&index->userEntries);
+}
+
+void PYPhraseIndexBuild(FcitxPinyinState* pystate)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    PYFA* PYFAList = pystate->PYFAList;
+    int32_t i, j, k;
+
+    PYPhraseIndexInit(pystate);
+
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        for (j = 0; j < PYFAList[i].iBase; j++) {
+            PyBase* base = &PYFAList[i].pyBase[j];
+            /* 倒序插入，链表中的顺序与词库一致 */
+            for (k = base->iPhrase - 1; k >= 0; k--) {
+                uint32_t iNode = PYPhraseIndexFindNode(index, i, base->phrase[k].strMap, true);
+                PYPhraseEntry entry;
+                entry.iBase = j;
+                entry.iPhrase = k;
+                entry.iNext = NODE(index, iNode)->iEntry;
+                NODE(index, iNode)->iEntry = utarray_len(&index->entries);
+                utarray_push_back(&index->entries, &entry);
+            }
+
+            PyUsrPhrase* userPhrase = base->userPhrase->next;
+            for (k = 0; k < base->iUserPhrase; k++) {
+                PYPhraseIndexInsertUser(pystate, i, j, userPhrase);
+                userPhrase = userPhrase->next;
+            }
+        }
+    }
+
+    index->bBuilt = true;
+}
+
+void PYPhraseIndexFree(FcitxPinyinState* pystate)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    if (index->nodes.icd) {
+        utarray_done(&index->nodes);
+        utarray_done(&index->entries);
+        utarray_done(&index->userEntries);
+    }
+    memset(index, 0, sizeof(PYPhraseIndex));
+}
+
+void PYPhraseIndexInsertUser(FcitxPinyinState* pystate, int32_t iPYFA,
+                             int32_t iBase, PyUsrPhrase* userPhrase)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    if (!index->nodes.icd)
+        return;
+
+    uint32_t iNode = PYPhraseIndexFindNode(index, iPYFA, userPhrase->phrase.strMap, true);
+    uint32_t iEntry = index->iFreeUserEntry;
+    if (iEntry) {
+        index->iFreeUserEntry = ((PYUserPhraseEntry*) utarray_eltptr(&index->userEntries, iEntry))->iNext;
+    } else {
+        iEntry = utarray_len(&index->userEntries);
+        utarray_extend_back(&index->userEntries);
+    }
+
+    PYUserPhraseEntry* entry = (PYUserPhraseEntry*) utarray_eltptr(&index->userEntries, iEntry);
+    entry->iBase = iBase;
+    entry->userPhrase = userPhrase;
+    entry->iNext = NODE(index, iNode)->iUserEntry;
+    NODE(index, iNode)->iUserEntry = iEntry;
+}
+
+void PYPhraseIndexRemoveUser(FcitxPinyinState* pystate, int32_t iPYFA,
+                             int32_t iBase, PyUsrPhrase* userPhrase)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    if (!index->nodes.icd)
+        return;
+
+    uint32_t iNode = PYPhraseIndexFindNode(index, iPYFA, userPhrase->phrase.strMap, false);
+    /* child is never nodes[0], so 0 with a non-empty map means not found */
+    if (!iNode && userPhrase->phrase.strMap[0])
+        return;
+
+    uint32_t* piEntry = &NODE(index, iNode)->iUserEntry;
+    while (*piEntry) {
+        PYUserPhraseEntry* entry = (PYUserPhraseEntry*) utarray_eltptr(&index->userEntries, *piEntry);
+        if (entry->userPhrase == userPhrase && entry->iBase == iBase) {
+            uint32_t iEntry = *piEntry;
+            *piEntry = entry->iNext;
+            entry->userPhrase = NULL;
+            entry->iNext = index->iFreeUserEntry;
+            index->iFreeUserEntry = iEntry;
+            return;
+        }
+        piEntry = &entry->iNext;
+    }
+}
+
+static void PYPhraseIndexCollect(FcitxPinyinState* pystate, int32_t iPYFA,
+                                 uint32_t iNode, const char* strMap,
+                                 boolean bUser, UT_array* matches)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    PYFA* PYFAList = pystate->PYFAList;
+    PYPhraseNode* node = NODE(index, iNode);
+    PYPhraseMatch match;
+    match.iPYFA = iPYFA;
+
+    if (bUser) {
+        uint32_t iEntry;
+        for (iEntry = node->iUserEntry; iEntry;) {
+            PYUserPhraseEntry* entry = (PYUserPhraseEntry*) utarray_eltptr(&index->userEntries, iEntry);
+            match.iBase = entry->iBase;
+            match.iPhrase = 0;
+            match.phrase = &entry->userPhrase->phrase;
+            utarray_push_back(matches, &match);
+            iEntry = entry->iNext;
+        }
+    } else {
+        uint32_t iEntry;
+        for (iEntry = node->iEntry; iEntry;) {
+            PYPhraseEntry* entry = (PYPhraseEntry*) utarray_eltptr(&index->entries, iEntry);
+            match.iBase = entry->iBase;
+            match.iPhrase = entry->iPhrase;
+            match.phrase = &PYFAList[iPYFA].pyBase[entry->iBase].phrase[entry->iPhrase];
+            utarray_push_back(matches, &match);
+            iEntry = entry->iNext;
+        }
+    }
+
+    /* 词组比输入短也算匹配，输入结束则不再往下找 */
+    if (!strMap[0])
+        return;
+
+    /* 与 CmpMap 对一个音节的比较相同 */
+    PYSyllableMask mask;
+    PYSyllableMaskForMap(&pystate->pyconfig, strMap, pystate->bSP, &mask);
+    uint32_t iChild;
+    for (iChild = node->iChild; iChild; iChild = NODE(index, iChild)->iNext) {
+        if (!PYSyllableMatch(&mask, NODE(index, iChild)->iSyllable))
+            continue;
+        PYPhraseIndexCollect(pystate, iPYFA, iChild,
+                             strMap[1] ? strMap + 2 : strMap + 1, bUser, matches);
+    }
+}
+
+static int PYPhraseMatchCmp(const void* a, const void* b)
+{
+    const PYPhraseMatch* matchA = a;
+    const PYPhraseMatch* matchB = b;
+    if (matchA->iPYFA != matchB->iPYFA)
+        return matchA->iPYFA - matchB->iPYFA;
+    if (matchA->iBase != matchB->iBase)
+        return matchA->iBase - matchB->iBase;
+    return matchA->iPhrase - matchB->iPhrase;
+}
+
+static int PYPhraseMatchPhraseCmp(const void* a, const void* b)
+{
+    const PYPhraseMatch* matchA = a;
+    const PYPhraseMatch* matchB = b;
+    if (matchA->phrase == matchB->phrase)
+        return 0;
+    return (uintptr_t) matchA->phrase < (uintptr_t) matchB->phrase ? -1 : 1;
+}
+
+static int PYPhraseMatchBaseCmp(const void* a, const void* b)
+{
+    const PYPhraseMatch* matchA = a;
+    const PYPhraseMatch* matchB = b;
+    if (matchA->iPYFA != matchB->iPYFA)
+        return matchA->iPYFA - matchB->iPYFA;
+    if (matchA->iBase != matchB->iBase)
+        return matchA->iBase - matchB->iBase;
+    return PYPhraseMatchPhraseCmp(a, b);
+}
+
+/*
+ * 用户词组以在链表中的位置排序，同一 PyBase 的匹配按词组地址排好后
+ * 只走一遍链表，找齐即停
+ */
+static void PYPhraseIndexNumberUser(FcitxPinyinState* pystate, UT_array* matches)
+{
+    PYFA* PYFAList = pystate->PYFAList;
+    PYPhraseMatch* first = (PYPhraseMatch*) utarray_front(matches);
+    unsigned int len = utarray_len(matches);
+    unsigned int i, j;
+
+    qsort(first, len, sizeof(PYPhraseMatch), PYPhraseMatchBaseCmp);
+    for (i = 0; i < len; i = j) {
+        for (j = i + 1; j < len; j++) {
+            if (first[j].iPYFA != first[i].iPYFA || first[j].iBase != first[i].iBase)
+                break;
+        }
+
+        PyBase* base = &PYFAList[first[i].iPYFA].pyBase[first[i].iBase];
+        PyUsrPhrase* userPhrase = base->userPhrase->next;
+        unsigned int left = j - i;
+        int32_t k;
+        for (k = 0; left && k < base->iUserPhrase; k++) {
+            PYPhraseMatch key;
+            key.phrase = &userPhrase->phrase;
+            PYPhraseMatch* match = bsearch(&key, first + i, j - i,
+                                           sizeof(PYPhraseMatch),
+                                           PYPhraseMatchPhraseCmp);
+            if (match) {
+                match->iPhrase = k;
+                left--;
+            }
+            userPhrase = userPhrase->next;
+        }
+    }
+}
+
+/*
+ * 查找首音节与 strFirst 相符，其余部分为 strMap 的前缀 (含相等) 的词组，
+ * 与逐个 CmpMap 的结果相同，并按原先遍历 PYFA, PyBase, 词组的顺序排列
+ */
+void PYPhraseIndexMatch(FcitxPinyinState* pystate, const char* strFirst,
+                        const char* strMap, boolean bUser, UT_array* matches)
+{
+    PYPhraseIndex* index = &pystate->phraseIndex;
+    PYFA* PYFAList = pystate->PYFAList;
+    int32_t i;
+
+    utarray_clear(matches);
+    if (!index->bBuilt)
+        PYPhraseIndexBuild(pystate);
+
+    char str[3];
+    PYSyllableMask mask;
+    strncpy(str, strFirst, 2);
+    str[2] = '\0';
+    PYSyllableMaskFor2Map(&pystate->pyconfig, str, pystate->bSP, &mask);
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        if (PYSyllableMatch(&mask, PYFAList[i].iSyllable))
+            PYPhraseIndexCollect(pystate, i, i, strMap, bUser, matches);
+    }
+
+    if (bUser && utarray_len(matches))
+        PYPhraseIndexNumberUser(pystate, matches);
+
+    if (utarray_len(matches) > 1)
+        utarray_sort(matches, PYPhraseMatchCmp);
+}
+
+static PYHZSlot* PYHZIndexFindSlot(PYHZIndex* index, uint32_t chr)
+{
+    uint32_t i = (chr * 2654435761u) & index->iMask;
+    while (index->slots[i].iEntry && index->slots[i].chr != chr)
+        i = (i + 1) & index->iMask;
+    return &index->slots[i];
+}
+
+/* 读入单字后建立，单字在程序运行中不会改变 */
+void PYHZIndexBuild(FcitxPinyinState* pystate)
+{
+    PYHZIndex* index = &pystate->hzIndex;
+    PYFA* PYFAList = pystate->PYFAList;
+    uint32_t size = 16, count = 0;
+    int32_t i, j;
+
+    PYHZIndexFree(pystate);
+
+    for (i = 0; i < pystate->iPYFACount; i++)
+        count += PYFAList[i].iBase;
+    while (size < count * 2)
+        size <<= 1;
+    index->slots = fcitx_utils_malloc0(sizeof(PYHZSlot) * size);
+    index->iMask = size - 1;
+    utarray_init(&index->entries, &py_hz_entry_icd);
+    utarray_extend_back(&index->entries);
+
+    /* 插入到链表头，链表中 PYFA 从后往前，与原先查找的顺序一致 */
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        for (j = PYFAList[i].iBase - 1; j >= 0; j--) {
+            uint32_t chr;
+            fcitx_utf8_get_char(PYFAList[i].pyBase[j].strHZ, &chr);
+            PYHZSlot* slot = PYHZIndexFindSlot(index, chr);
+            PYHZEntry entry;
+            entry.iPYFA = i;
+            entry.iBase = j;
+            entry.iNext = slot->iEntry;
+            slot->chr = chr;
+            slot->iEntry = utarray_len(&index->entries);
+            utarray_push_back(&index->entries, &entry);
+        }
+    }
+}
+
+void PYHZIndexFree(FcitxPinyinState* pystate)
+{
+    PYHZIndex* index = &pystate->hzIndex;
+    if (index->slots) {
+        free(index->slots);
+        utarray_done(&index->entries);
+    }
+    memset(index, 0, sizeof(PYHZIndex));
+}
+
+/*
+ * 第一个单字为 strHZ 的 PyBase，strHZ 只能是一个字
+ */
+PYHZEntry* PYHZIndexFind(FcitxPinyinState* pystate, const char* strHZ)
+{
+    PYHZIndex* index = &pystate->hzIndex;
+    uint32_t chr;
+
+    if (!index->slots || !strHZ[0])
+        return NULL;
+    if (*fcitx_utf8_get_char(strHZ, &chr))
+        return NULL;
+
+    PYHZSlot* slot = PYHZIndexFindSlot(index, chr);
+    if (!slot->iEntry)
+        return NULL;
+    return (PYHZEntry*) utarray_eltptr(&index->entries, slot->iEntry);
+}
+
+PYHZEntry* PYHZIndexNext(FcitxPinyinState* pystate, PYHZEntry* entry)
+{
+    if (!entry->iNext)
+        return NULL;
+    return (PYHZEntry*) utarray_eltptr(&pystate->hzIndex.entries, entry->iNext);
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -27,6 +27,7 @@
 #include "fcitx-config/fcitx-config.h"
 #include "fcitx-config/xdg.h"
 #include "PYFA.h"
+#include "pyParser.h"
 #include <stdlib.h>
 #include <errno.h>
 
@@ -116,6 +117,8 @@ boolean LoadPYConfig(FcitxPinyinConfig *pyconfig)
     }
 
     FcitxConfigBindSync((FcitxGenericConfig*)pyconfig);
+    PYBuildFuzzyMask(pyconfig);
+    pyconfig->iSerial++;
 
     if (fp)
         fclose(fp);
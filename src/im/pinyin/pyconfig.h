@@ -43,8 +43,6 @@ typedef enum _SHUANGPINSCHEME {
     SP_USERDEFINE,
 } SHUANGPINSCHEME;
 
-typedef struct _PYMappedSplitData PYMappedSplitData;
-
 typedef struct _FcitxPinyinConfig {
     FcitxGenericConfig gconfig;
 
@@ -68,8 +66,21 @@ typedef struct _FcitxPinyinConfig {
     char cNonS;
     SP_C SPMap_C[31];
     SP_S SPMap_S[4];
+    /* 由 SPMap 建立的双拼键表，[c1][0] 为单键，[c1][c2 + 1] 为两键 */
+    SP_KEY SPKeyTable[SP_KEY_COUNT][SP_KEY_COUNT + 1];
+    boolean bSPKeyTableBuilt;
+    uint32_t iSPKeySerial;
+
+    /* [bSP][is_S][bUseMH][map2]，置位的 map1 与 map2 比较的结果为相等 */
+    uint64_t fuzzyMask[2][2][2][64];
+    boolean bFuzzyMaskBuilt;
 
-    PYMappedSplitData* splitData;
+    /* 分词的频率，splitIndex 把 PYTable 中的序号转为 splitFreq 的行和列 */
+    int16_t (*splitIndex)[2];
+    float* splitFreq;
+    int iSplitCols;
+    /* 改变设置后加一，ParsePYCache 以此判断是否失效 */
+    uint32_t iSerial;
 } FcitxPinyinConfig;
 
 CONFIG_BINDING_DECLARE(FcitxPinyinConfig);
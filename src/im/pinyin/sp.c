@@ -174,7 +174,10 @@ void LoadSPData(FcitxPinyinState *pystate)
     if (SPMap_C_source && SPMap_S_source) {
         pyconfig->cNonS = nonS;
         memcpy(pyconfig->SPMap_S, SPMap_S_source, 4 * sizeof(SP_S));
-        memcpy(pyconfig->SPMap_C, SPMap_C_source, 31 * sizeof(SP_C));
+        /* 小鹤的表比其他方案短一项，不能直接按 31 项复制 */
+        memset(pyconfig->SPMap_C, 0, sizeof(pyconfig->SPMap_C));
+        for (i = 0; SPMap_C_source[i].strQP[0]; i++)
+            pyconfig->SPMap_C[i] = SPMap_C_source[i];
     }
 
     //下面判断是否使用了';'
@@ -198,6 +201,90 @@ void LoadSPData(FcitxPinyinState *pystate)
         if (pyconfig->cNonS == ';')
             pystate->bSP_UseSemicolon = true;
     }
+
+    SPBuildKeyTable(pyconfig);
+}
+
+static int SPKeyIndex(char c)
+{
+    if (c >= 'a' && c <= 'z')
+        return c - 'a';
+    if (c == ';')
+        return SP_KEY_COUNT - 1;
+    return -1;
+}
+
+static char SPKeyChar(int i)
+{
+    return (i == SP_KEY_COUNT - 1) ? ';' : 'a' + i;
+}
+
+/*
+ * 按原来逐键转换的方式解析一个或两个键，c2 为 '\0' 时只解析一个键
+ */
+static void SPComputeKey(FcitxPinyinConfig* pyconfig, char c1, char c2, SP_KEY* key)
+{
+    char            strJP[3];
+    char            strQP[MAX_PY_LENGTH + 1];
+    int             i;
+    const PYPARSEINPUTMODE mode[2] = { PY_PARSE_INPUT_USER, PY_PARSE_INPUT_SYSTEM };
+
+    strJP[0] = c1;
+    strJP[1] = c2;
+    strJP[2] = '\0';
+    SP2QP(pyconfig, strJP, strQP);
+
+    if (c2)
+        key->bValid = (FindPYFAIndex(pyconfig, strQP, 0) != -1);
+    else
+        key->bValid = true;
+
+    for (i = 0; i < 2; i++) {
+        if (!MapPY(pyconfig, strQP, key->strMap[i], mode[i])) {
+            if (!c2)
+                key->bValid = false;
+            strcpy(key->strMap[i], strJP);
+        }
+    }
+}
+
+/*
+ * 双拼方案确定以后，每个键和每两个键的解析结果都是固定的，
+ * 在这里一次算好，ParsePY 时直接查表，不用再逐键做 SP2QP 和 MapPY。
+ * 模糊音在匹配时通过 fuzzyMask 处理，这里只存规范的映射
+ */
+void SPBuildKeyTable(FcitxPinyinConfig* pyconfig)
+{
+    int             i, j;
+
+    for (i = 0; i < SP_KEY_COUNT; i++) {
+        SPComputeKey(pyconfig, SPKeyChar(i), '\0', &pyconfig->SPKeyTable[i][0]);
+        for (j = 0; j < SP_KEY_COUNT; j++)
+            SPComputeKey(pyconfig, SPKeyChar(i), SPKeyChar(j), &pyconfig->SPKeyTable[i][j + 1]);
+    }
+
+    pyconfig->bSPKeyTableBuilt = true;
+    pyconfig->iSPKeySerial = pyconfig->iSerial;
+}
+
+/*
+ * 取得一个或两个键的解析结果，配置改变后会重建键表；
+ * 不在键表中的字符直接计算到 buf 中
+ */
+const SP_KEY* SPGetKey(FcitxPinyinConfig* pyconfig, char c1, char c2, SP_KEY* buf)
+{
+    int             i1 = SPKeyIndex(c1);
+    int             i2 = c2 ? SPKeyIndex(c2) : -1;
+
+    if (i1 < 0 || (c2 && i2 < 0)) {
+        SPComputeKey(pyconfig, c1, c2, buf);
+        return buf;
+    }
+
+    if (!pyconfig->bSPKeyTableBuilt || pyconfig->iSPKeySerial != pyconfig->iSerial)
+        SPBuildKeyTable(pyconfig);
+
+    return &pyconfig->SPKeyTable[i1][i2 + 1];
 }
 
 /*
@@ -38,6 +38,19 @@ typedef struct _SP_S {
     char            cJP;
 } SP_S;
 
+/* 双拼的键为 a-z 和 ; */
+#define SP_KEY_COUNT 27
+
+/*
+ * 一个或两个键解析的结果，strMap 分别为 PY_PARSE_INPUT_USER 和
+ * PY_PARSE_INPUT_SYSTEM 的映射。两个键时 bValid 表示是否为完整的音节，
+ * 一个键时表示 MapPY 是否成功
+ */
+typedef struct _SP_KEY {
+    char            strMap[2][3];
+    boolean         bValid;
+} SP_KEY;
+
 struct _FcitxPinyinConfig;
 struct _FcitxPinyinState;
 
@@ -49,6 +62,8 @@ int             GetSPIndexQP_C(struct _FcitxPinyinConfig* pyconfig, char *str);
 int             GetSPIndexQP_S(struct _FcitxPinyinConfig* pyconfig, char *str);
 int             GetSPIndexJP_C(struct _FcitxPinyinConfig* pyconfig, char c, int iStart);
 int             GetSPIndexJP_S(struct _FcitxPinyinConfig* pyconfig, char c);
+void            SPBuildKeyTable(struct _FcitxPinyinConfig* pyconfig);
+const SP_KEY*   SPGetKey(struct _FcitxPinyinConfig* pyconfig, char c1, char c2, SP_KEY* buf);
 
 #endif
 
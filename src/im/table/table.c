@@ -47,13 +47,8 @@
 #define MAX_TABLE_INPUT 50
 
 static void TableMetaDataFree(TableMetaData *table);
-typedef struct {
-    ADJUSTORDER order;
-    int simpleLevel;
-} TableCandWordSortContext;
 
 static void *TableCreate(FcitxInstance* instance);
-static int TableCandCmp(const void* a, const void* b, void* arg);
 static INPUT_RETURN_VALUE TableKeyBlocker(void* arg, FcitxKeySym sym, unsigned int state);
 static INPUT_RETURN_VALUE Table_PYGetCandWord(void *arg,
                                               FcitxCandidateWord *candidateWord);
@@ -339,10 +334,10 @@ boolean TableCheckNoMatch(TableMetaData* table, const char* code)
     FcitxInputState *input = FcitxInstanceGetInputState(instance);
     FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
     if (!table->bTableExactMatch) {
-        return FcitxCandidateWordGetListSize(candList) == 0;
+        return FcitxCandidateWordIsEmpty(candList);
     } else {
-        return (FcitxCandidateWordGetListSize(candList) == 0) &&
-            TableFindFirstMatchCode(table, code, false, false) == -1;
+        return FcitxCandidateWordIsEmpty(candList) &&
+            TableFindFirstMatchCode(table, code, false) == -1;
     }
 }
 
@@ -421,7 +416,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                 memcpy(buf, strCodeInput, len);
                 buf[len] = (char)sym;
                 buf[len + 1] = '\0';
-                if (TableFindFirstMatchCode(table, buf, false, false) == -1)
+                if (TableFindFirstMatchCode(table, buf, false) == -1)
                     return IRV_TO_PROCESS;
             }
 
@@ -460,7 +455,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
 
                         strLastFirstCand = (char *)NULL;
                         lastFirstCandType = CT_AUTOPHRASE;
-                        if (FcitxCandidateWordPageCount(candList) != 0) {
+                        if (!FcitxCandidateWordIsEmpty(candList)) {
                             // to realize auto-sending HZ to client
                             FcitxCandidateWord *candWord = NULL;
                             candWord = FcitxCandidateWordGetCurrentWindow(candList);
@@ -485,7 +480,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                             if (raw_size == 1)
                                 return IRV_TO_PROCESS;
 
-                            if (FcitxCandidateWordPageCount(candList) == 0) {
+                            if (FcitxCandidateWordIsEmpty(candList)) {
                                 FcitxInputStateSetRawInputBufferSize(input, 0);
                                 return IRV_CLEAN;
                             }
@@ -512,7 +507,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                             strCodeInput[0] = sym;
                             strCodeInput[1] = '\0';
                         } else if ((raw_size == 1) && strTemp &&
-                                   FcitxCandidateWordPageCount(candList) == 0) {
+                                   FcitxCandidateWordIsEmpty(candList)) {
                             /**
                              * 如果第一个字母是标点，并且没有候选字/词
                              * 则当做标点处理──适用于二笔这样的输入
@@ -527,7 +522,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                 } else {
                     if (table->bUseAutoSend && table->iTableAutoSendToClient) {
                         retVal = IRV_DISPLAY_CANDWORDS;
-                        if (FcitxCandidateWordPageCount(candList)) {
+                        if (!FcitxCandidateWordIsEmpty(candList)) {
                             FcitxCandidateWord* candWord = FcitxCandidateWordGetCurrentWindow(candList);
                             if (candWord->owner == table) {
                                 TABLECANDWORD* tableCandWord = candWord->priv;
@@ -669,7 +664,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
             int iKey;
             iKey = FcitxHotkeyCheckChooseKey(sym, state, table->strChoose);
 
-            if (FcitxCandidateWordPageCount(candList) == 0)
+            if (FcitxCandidateWordIsEmpty(candList))
                 return IRV_TO_PROCESS;
 
             if (FcitxCandidateWordGetByIndex(candList, iKey) == NULL)
@@ -697,7 +692,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
             }
         } else if (!tbl->bIsTableDelPhrase && !tbl->bIsTableAdjustOrder && !tbl->bIsTableClearFreq) {
             if (FcitxHotkeyIsHotKey(sym, state, tbl->config.hkTableAdjustOrder)) {
-                if (FcitxCandidateWordGetListSize(candList) < 2 || FcitxInputStateGetIsInRemind(input))
+                if (!FcitxCandidateWordGetByTotalIndex(candList, 1) || FcitxInputStateGetIsInRemind(input))
                     return IRV_DO_NOTHING;
 
                 tbl->bIsTableAdjustOrder = true;
@@ -705,7 +700,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                 FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxUp(input), MSG_TIPS, _("Choose the phrase to be put in the front, Press Escape to Cancel"));
                 retVal = IRV_DISPLAY_MESSAGE;
             } else if (FcitxHotkeyIsHotKey(sym, state, tbl->config.hkTableDelPhrase)) {
-                if (!FcitxCandidateWordPageCount(candList) || FcitxInputStateGetIsInRemind(input))
+                if (FcitxCandidateWordIsEmpty(candList) || FcitxInputStateGetIsInRemind(input))
                     return IRV_DO_NOTHING;
 
                 tbl->bIsTableDelPhrase = true;
@@ -713,7 +708,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                 FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxUp(input), MSG_TIPS, _("Choose the phrase to be deleted, Press Escape to Cancel"));
                 retVal = IRV_DISPLAY_MESSAGE;
             } else if (FcitxHotkeyIsHotKey(sym, state, tbl->config.hkTableClearFreq)) {
-                if (!FcitxCandidateWordPageCount(candList) || FcitxInputStateGetIsInRemind(input))
+                if (FcitxCandidateWordIsEmpty(candList) || FcitxInputStateGetIsInRemind(input))
                     return IRV_DO_NOTHING;
 
                 tbl->bIsTableClearFreq = true;
@@ -740,7 +735,7 @@ INPUT_RETURN_VALUE DoTableInput(void* arg, FcitxKeySym sym, unsigned int state)
                 if (FcitxInputStateGetRawInputBufferSize(input) == 1 && strCodeInput[0] == table->cPinyin && table->bUsePY)
                     retVal = IRV_COMMIT_STRING;
                 else {
-                    if (FcitxCandidateWordPageCount(candList) == 0 && table->bCommitKeyCommitWhenNoMatch) {
+                    if (FcitxCandidateWordIsEmpty(candList) && table->bCommitKeyCommitWhenNoMatch) {
                         FcitxInstanceCommitString(instance, FcitxInstanceGetCurrentIC(instance), FcitxInputStateGetRawInputBuffer(input));
                         FcitxInputStateSetRawInputBufferSize(input, 0);
                         FcitxInputStateGetRawInputBuffer(input)[0] = '\0';
@@ -862,7 +857,7 @@ INPUT_RETURN_VALUE _TableGetCandWord(TableMetaData* table, TABLECANDWORD* tableC
             FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxUp(input), MSG_INPUT, FcitxInputStateGetRawInputBuffer(input));
 
             FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxDown(input), MSG_TIPS, pCandWord);
-            temp = table->tableDict->tableSingleHZ[CalHZIndex(pCandWord)];
+            temp = TableFindSingleHZ(table->tableDict, pCandWord, RECORDTYPE_NORMAL);
             if (temp) {
                 FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxDown(input), MSG_CODE, temp->strCode);
             }
@@ -923,7 +918,7 @@ INPUT_RETURN_VALUE TableGetPinyinCandWords(TableMetaData* table)
          candWord = FcitxCandidateWordGetNext(FcitxInputStateGetCandidateList(input), candWord)) {
         char* pstr;
         if (fcitx_utf8_strlen(candWord->strWord) == 1) {
-            RECORD* recTemp = table->tableDict->tableSingleHZ[CalHZIndex(candWord->strWord)];
+            RECORD* recTemp = TableFindSingleHZ(table->tableDict, candWord->strWord, RECORDTYPE_NORMAL);
             if (!recTemp)
                 pstr = (char *) NULL;
             else
@@ -944,12 +939,145 @@ INPUT_RETURN_VALUE TableGetPinyinCandWords(TableMetaData* table)
     return IRV_DISPLAY_CANDWORDS;
 }
 
+static void TableAppendCandWord(TableMetaData* table,
+                                FcitxCandidateWordList* candList,
+                                RECORD* record, const char* strCodeInput,
+                                size_t rawSize)
+{
+    RECORD *recTemp;
+
+    TABLECANDWORD* tableCandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(TABLECANDWORD));
+    TableAddCandWord(record, tableCandWord);
+    FcitxCandidateWord candWord;
+    candWord.callback = TableGetCandWord;
+    candWord.owner = table;
+    candWord.priv = tableCandWord;
+    candWord.strWord = FcitxCandidateWordArenaStrdup(candList, tableCandWord->candWord.record->strHZ);
+    candWord.strExtra = NULL;
+    candWord.wordType = MSG_OTHER;
+
+    const char* pstr = NULL;
+    if ((tableCandWord->flag == CT_NORMAL) && (tableCandWord->candWord.record->type == RECORDTYPE_PINYIN)) {
+        if (fcitx_utf8_strlen(tableCandWord->candWord.record->strHZ) == 1) {
+            recTemp = TableFindSingleHZ(table->tableDict, tableCandWord->candWord.record->strHZ, RECORDTYPE_NORMAL);
+            if (!recTemp)
+                pstr = (char *) NULL;
+            else
+                pstr = recTemp->strCode;
+        } else
+            pstr = (char *) NULL;
+    } else if (HasMatchingKey(table, strCodeInput))
+        pstr = (tableCandWord->flag == CT_NORMAL) ? tableCandWord->candWord.record->strCode : tableCandWord->candWord.autoPhrase->strCode;
+    else
+        pstr = ((tableCandWord->flag == CT_NORMAL) ? tableCandWord->candWord.record->strCode : tableCandWord->candWord.autoPhrase->strCode) + rawSize;
+
+    if (pstr) {
+        if (table->customPrompt) {
+            size_t codelen = strlen(pstr);
+            int i = 0;
+            int totallen = 0;
+            for (i = 0; i < codelen; i ++) {
+                RECORD* rec = table->tableDict->promptCode[(uint8_t) pstr[i]];
+                if (rec) {
+                    totallen += strlen(rec->strHZ);
+                } else
+                    totallen += 1;
+            }
+
+            candWord.strExtra = FcitxCandidateWordArenaAlloc(candList, sizeof(char) * (totallen + 1 + 3));
+            if (codelen)
+                strcpy(candWord.strExtra, "\xef\xbd\x9e");
+            for (i = 0; i < codelen; i ++) {
+                RECORD* rec = table->tableDict->promptCode[(uint8_t) pstr[i]];
+                if (rec) {
+                    strcat(candWord.strExtra, rec->strHZ);
+                } else {
+                    char temp[2] = {pstr[i], '\0'};
+                    strcat(candWord.strExtra, temp);
+                }
+            }
+        }
+        else {
+            candWord.strExtra = FcitxCandidateWordArenaStrdup(candList, pstr);
+        }
+        candWord.extraType = MSG_CODE;
+    }
+
+    FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
+}
+
+static void TableAppendAutoPhraseCandWords(TableMetaData* table,
+                                           FcitxCandidateWordList* candList,
+                                           const char* strCodeInput,
+                                           size_t rawSize)
+{
+    int i;
+
+    if (table->tableDict->bRule && table->bAutoPhrase && rawSize == table->tableDict->iCodeLength) {
+        for (i = table->tableDict->iAutoPhrase - 1; i >= 0; i--) {
+            if (!TableCompareCode(table, strCodeInput, table->tableDict->autoPhrase[i].strCode, table->bTableExactMatch)) {
+                if (TableHasPhrase(table->tableDict, table->tableDict->autoPhrase[i].strCode, table->tableDict->autoPhrase[i].strHZ)) {
+                    TABLECANDWORD* tableCandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(TABLECANDWORD));
+                    TableAddAutoCandWord(table, i, tableCandWord);
+                    FcitxCandidateWord candWord;
+                    candWord.callback = TableGetCandWord;
+                    candWord.owner = table;
+                    candWord.priv = tableCandWord;
+                    candWord.strWord = FcitxCandidateWordArenaStrdup(candList, tableCandWord->candWord.autoPhrase->strHZ);
+                    candWord.strExtra = NULL;
+                    candWord.wordType = MSG_USERPHR;
+
+                    FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * 候选词按页生成，level 为候选码表缓存，在下一次查找之前不会改变，
+ * 翻到哪里才排序到哪里，自动组词排在最后。
+ * 输入码在生成器创建时保存，之后输入缓冲区改变也不影响已有的候选词
+ */
+typedef struct {
+    TableMetaData* table;
+    TableCandLevel* level;
+    unsigned int iNext;
+    char* strCodeInput;
+    size_t rawSize;
+} TableCandWordGenerator;
+
+static boolean TableGenerateCandWords(void* arg, FcitxCandidateWordList* candList, int count)
+{
+    TableCandWordGenerator* generator = arg;
+    UT_array* records = &generator->level->records;
+
+    while (count > 0 && generator->iNext < utarray_len(records)) {
+        if (generator->iNext >= generator->level->iSorted)
+            TableCandCacheSortTo(generator->table->tableDict, generator->level,
+                                 generator->iNext + count);
+        RECORD* record = *(RECORD**) utarray_eltptr(records, generator->iNext);
+        generator->iNext++;
+        if (record->type == RECORDTYPE_CONSTRUCT ||
+            record->type == RECORDTYPE_PROMPT)
+            continue;
+        TableAppendCandWord(generator->table, candList, record,
+                            generator->strCodeInput, generator->rawSize);
+        count--;
+    }
+
+    if (generator->iNext < utarray_len(records))
+        return true;
+
+    TableAppendAutoPhraseCandWords(generator->table, candList,
+                                   generator->strCodeInput, generator->rawSize);
+    return false;
+}
+
 INPUT_RETURN_VALUE TableGetCandWords(void* arg)
 {
     TableMetaData* table = (TableMetaData*) arg;
     FcitxTableState *tbl = table->owner;
-    int             i;
-    RECORD         *recTemp;
     FcitxInstance *instance = tbl->owner;
     FcitxInputState *input = FcitxInstanceGetInputState(instance);
     FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
@@ -967,7 +1095,13 @@ INPUT_RETURN_VALUE TableGetCandWords(void* arg)
     if (FcitxInputStateGetRawInputBuffer(input)[0] == table->cPinyin && table->bUsePY && tbl->pyaddon)
         return TableGetPinyinCandWords(table);
 
-    if (TableFindFirstMatchCode(table, FcitxInputStateGetRawInputBuffer(input), table->bTableExactMatch, true) == -1 && !table->tableDict->iAutoPhrase) {
+    /*
+     * a generator left in the list reads the candidate cache which is going
+     * to be changed, drop it, words it has already generated are kept
+     */
+    FcitxCandidateWordSetGenerator(candList, NULL, false, NULL, NULL);
+    TableCandLevel* level = TableCandCacheLookup(table, FcitxInputStateGetRawInputBuffer(input));
+    if (utarray_len(&level->records) == 0 && !table->tableDict->iAutoPhrase) {
         if (FcitxInputStateGetRawInputBufferSize(input)) {
             FcitxMessagesSetMessageCount(FcitxInputStateGetPreedit(input), 0);
             FcitxMessagesSetMessageCount(FcitxInputStateGetClientPreedit(input), 0);
@@ -983,119 +1117,13 @@ INPUT_RETURN_VALUE TableGetCandWords(void* arg)
         return IRV_DISPLAY_CANDWORDS;
     }
 
-    TableCandWordSortContext context;
-    context.order = table->tableOrder;
-    context.simpleLevel = table->iSimpleLevel;
-    UT_array candTemp;
-    utarray_init(&candTemp, fcitx_ptr_icd);
-
-    while (table->tableDict->currentRecord && table->tableDict->currentRecord != table->tableDict->recordHead) {
-        if (table->tableDict->currentRecord->type != RECORDTYPE_CONSTRUCT &&
-            table->tableDict->currentRecord->type != RECORDTYPE_PROMPT &&
-            !TableCompareCode(table, FcitxInputStateGetRawInputBuffer(input), table->tableDict->currentRecord->strCode, table->bTableExactMatch)) {
-            TABLECANDWORD* tableCandWord = fcitx_utils_malloc0(sizeof(TABLECANDWORD));
-            TableAddCandWord(table->tableDict->currentRecord, tableCandWord);
-            utarray_push_back(&candTemp, &tableCandWord);
-        }
-        table->tableDict->currentRecord = table->tableDict->currentRecord->next;
-    }
-
-    /* seems AD_NO will go back to n^2, really effect performance */
-    if (table->tableOrder != AD_NO)
-        utarray_msort_r(&candTemp, TableCandCmp, &context);
-
-    TABLECANDWORD** pcand = NULL;
-    for (pcand = (TABLECANDWORD**) utarray_front(&candTemp);
-            pcand != NULL;
-            pcand = (TABLECANDWORD**) utarray_next(&candTemp, pcand)) {
-        TABLECANDWORD* tableCandWord = *pcand;
-        FcitxCandidateWord candWord;
-        candWord.callback = TableGetCandWord;
-        candWord.owner = table;
-        candWord.priv = tableCandWord;
-        candWord.strWord = strdup(tableCandWord->candWord.record->strHZ);
-        candWord.strExtra = NULL;
-        candWord.wordType = MSG_OTHER;
-
-        const char* pstr = NULL;
-        if ((tableCandWord->flag == CT_NORMAL) && (tableCandWord->candWord.record->type == RECORDTYPE_PINYIN)) {
-            if (fcitx_utf8_strlen(tableCandWord->candWord.record->strHZ) == 1) {
-                recTemp = table->tableDict->tableSingleHZ[CalHZIndex(tableCandWord->candWord.record->strHZ)];
-                if (!recTemp)
-                    pstr = (char *) NULL;
-                else
-                    pstr = recTemp->strCode;
-            } else
-                pstr = (char *) NULL;
-        } else if (HasMatchingKey(table, FcitxInputStateGetRawInputBuffer(input)))
-            pstr = (tableCandWord->flag == CT_NORMAL) ? tableCandWord->candWord.record->strCode : tableCandWord->candWord.autoPhrase->strCode;
-        else
-            pstr = ((tableCandWord->flag == CT_NORMAL) ? tableCandWord->candWord.record->strCode : tableCandWord->candWord.autoPhrase->strCode) + FcitxInputStateGetRawInputBufferSize(input);
-
-        if (pstr) {
-            if (table->customPrompt) {
-                size_t codelen = strlen(pstr);
-                int i = 0;
-                int totallen = 0;
-                for (i = 0; i < codelen; i ++) {
-                    RECORD* rec = table->tableDict->promptCode[(uint8_t) pstr[i]];
-                    if (rec) {
-                        totallen += strlen(rec->strHZ);
-                    } else
-                        totallen += 1;
-                }
-
-                candWord.strExtra = fcitx_utils_malloc0(sizeof(char) * (totallen + 1 + 3));
-                if (codelen)
-                    strcpy(candWord.strExtra, "\xef\xbd\x9e");
-                for (i = 0; i < codelen; i ++) {
-                    RECORD* rec = table->tableDict->promptCode[(uint8_t) pstr[i]];
-                    if (rec) {
-                        strcat(candWord.strExtra, rec->strHZ);
-                    } else {
-                        char temp[2] = {pstr[i], '\0'};
-                        strcat(candWord.strExtra, temp);
-                    }
-                }
-            }
-            else {
-                candWord.strExtra = strdup(pstr);
-            }
-            candWord.extraType = MSG_CODE;
-        }
-
-        FcitxCandidateWordAppend(candList, &candWord);
-    }
-    utarray_clear(&candTemp);
-
-    if (table->tableDict->bRule && table->bAutoPhrase && FcitxInputStateGetRawInputBufferSize(input) == table->tableDict->iCodeLength) {
-        for (i = table->tableDict->iAutoPhrase - 1; i >= 0; i--) {
-            if (!TableCompareCode(table, FcitxInputStateGetRawInputBuffer(input), table->tableDict->autoPhrase[i].strCode, table->bTableExactMatch)) {
-                if (TableHasPhrase(table->tableDict, table->tableDict->autoPhrase[i].strCode, table->tableDict->autoPhrase[i].strHZ)) {
-                    TABLECANDWORD* tableCandWord = fcitx_utils_malloc0(sizeof(TABLECANDWORD));
-                    TableAddAutoCandWord(table, i, tableCandWord);
-                    utarray_push_back(&candTemp, &tableCandWord);
-                }
-            }
-        }
-    }
-
-    for (pcand = (TABLECANDWORD**) utarray_front(&candTemp);
-            pcand != NULL;
-            pcand = (TABLECANDWORD**) utarray_next(&candTemp, pcand)) {
-        TABLECANDWORD* tableCandWord = *pcand;
-        FcitxCandidateWord candWord;
-        candWord.callback = TableGetCandWord;
-        candWord.owner = table;
-        candWord.priv = tableCandWord;
-        candWord.strWord = strdup(tableCandWord->candWord.autoPhrase->strHZ);
-        candWord.strExtra = NULL;
-        candWord.wordType = MSG_USERPHR;
-
-        FcitxCandidateWordAppend(candList, &candWord);
-    }
-
-    utarray_done(&candTemp);
+    /* everything lives in the arena of candidate list, no malloc here */
+    TableCandWordGenerator* generator = FcitxCandidateWordArenaAlloc(candList, sizeof(TableCandWordGenerator));
+    generator->table = table;
+    generator->level = level;
+    generator->strCodeInput = FcitxCandidateWordArenaStrdup(candList, FcitxInputStateGetRawInputBuffer(input));
+    generator->rawSize = FcitxInputStateGetRawInputBufferSize(input);
+    FcitxCandidateWordSetGenerator(candList, TableGenerateCandWords, true, generator, NULL);
 
     INPUT_RETURN_VALUE retVal = IRV_DISPLAY_CANDWORDS;
 
@@ -1152,6 +1180,7 @@ void TableClearFreqByIndex(TableMetaData* table, TABLECANDWORD* tableCandWord)
 
     recTemp = tableCandWord->candWord.record;
     recTemp->iHit = 0;
+    TableCandCacheReset(table->tableDict);
 
     table->tableDict->iTableChanged++;
 }
@@ -1163,7 +1192,6 @@ void TableClearFreqByIndex(TableMetaData* table, TABLECANDWORD* tableCandWord)
 void TableAdjustOrderByIndex(TableMetaData* table, TABLECANDWORD* tableCandWord)
 {
     RECORD         *recTemp;
-    int             iTemp;
 
     recTemp = tableCandWord->candWord.record;
     while (!strcmp(recTemp->strCode, recTemp->prev->strCode))
@@ -1181,17 +1209,8 @@ void TableAdjustOrderByIndex(TableMetaData* table, TABLECANDWORD* tableCandWord)
 
     table->tableDict->iTableChanged++;
 
-    //需要的话，更新索引
-    if (tableCandWord->candWord.record->strCode[1] == '\0') {
-        size_t tmp_len = strlen(table->tableDict->strInputCode);
-        for (iTemp = 0; iTemp < tmp_len; iTemp++) {
-            if (table->tableDict->recordIndex[iTemp].cCode ==
-                tableCandWord->candWord.record->strCode[0]) {
-                table->tableDict->recordIndex[iTemp].record = tableCandWord->candWord.record;
-                break;
-            }
-        }
-    }
+    //更新索引
+    TableCodeIndexMoveFirst(table->tableDict, tableCandWord->candWord.record);
 }
 
 /*
@@ -1239,8 +1258,6 @@ void TableCreateNewPhrase(TableMetaData* table)
 INPUT_RETURN_VALUE TableGetRemindCandWords(TableMetaData* table)
 {
     FcitxTableState* tbl = table->owner;
-    int             iLength;
-    RECORD         *tableRemind = NULL;
     FcitxGlobalConfig *config = FcitxInstanceGetGlobalConfig(tbl->owner);
     FcitxInstance *instance = tbl->owner;
     FcitxInputState *input = FcitxInstanceGetInputState(instance);
@@ -1254,33 +1271,31 @@ INPUT_RETURN_VALUE TableGetRemindCandWords(TableMetaData* table)
     FcitxInputStateSetRawInputBufferSize(input, 0);
     FcitxCandidateWordReset(cand_list);
 
-    iLength = fcitx_utf8_strlen(tbl->strTableRemindSource);
-    tableRemind = table->tableDict->recordHead->next;
+    UT_array remind;
+    utarray_init(&remind, fcitx_ptr_icd);
+    TableFindRemindPhrase(table->tableDict, tbl->strTableRemindSource, &remind);
 
-    while (tableRemind != table->tableDict->recordHead) {
+    RECORD** pRemind;
+    for (pRemind = (RECORD**) utarray_front(&remind);
+         pRemind != NULL;
+         pRemind = (RECORD**) utarray_next(&remind, pRemind)) {
         if (bDisablePagingInRemind &&
             FcitxCandidateWordGetListSize(cand_list) >=
             FcitxCandidateWordGetPageSize(cand_list))
             break;
 
-        if (((iLength + 1) == fcitx_utf8_strlen(tableRemind->strHZ))) {
-            if (!fcitx_utf8_strncmp(tableRemind->strHZ,
-                                    tbl->strTableRemindSource, iLength) &&
-                fcitx_utf8_get_nth_char(tableRemind->strHZ, iLength)) {
-                TABLECANDWORD *tableCandWord = fcitx_utils_new(TABLECANDWORD);
-                TableAddRemindCandWord(tableRemind, tableCandWord);
-                FcitxCandidateWord candWord;
-                candWord.callback = TableGetCandWord;
-                candWord.owner = table;
-                candWord.priv = tableCandWord;
-                candWord.strExtra = NULL;
-                candWord.strWord = strdup(tableCandWord->candWord.record->strHZ + strlen(tbl->strTableRemindSource));
-                candWord.wordType = MSG_OTHER;
-                FcitxCandidateWordAppend(cand_list, &candWord);
-            }
-        }
-        tableRemind = tableRemind->next;
+        TABLECANDWORD *tableCandWord = FcitxCandidateWordArenaAlloc(cand_list, sizeof(TABLECANDWORD));
+        TableAddRemindCandWord(*pRemind, tableCandWord);
+        FcitxCandidateWord candWord;
+        candWord.callback = TableGetCandWord;
+        candWord.owner = table;
+        candWord.priv = tableCandWord;
+        candWord.strExtra = NULL;
+        candWord.strWord = FcitxCandidateWordArenaStrdup(cand_list, tableCandWord->candWord.record->strHZ + strlen(tbl->strTableRemindSource));
+        candWord.wordType = MSG_OTHER;
+        FcitxCandidateWordAppendWithFlags(cand_list, &candWord, CWF_Arena);
     }
+    utarray_done(&remind);
 
     FcitxInstanceCleanInputWindowUp(instance);
     FcitxMessagesAddMessageStringsAtLast(FcitxInputStateGetAuxUp(input),
@@ -1310,6 +1325,7 @@ INPUT_RETURN_VALUE TableGetRemindCandWord(void* arg, TABLECANDWORD* tableCandWor
     FcitxInputState *input = FcitxInstanceGetInputState(instance);
 
     tableCandWord->candWord.record->iHit++;
+    TableCandCacheReset(table->tableDict);
     strcpy(tbl->strTableRemindSource, tableCandWord->candWord.record->strHZ + strlen(tbl->strTableRemindSource));
     TableGetRemindCandWords(table);
 
@@ -1333,8 +1349,9 @@ INPUT_RETURN_VALUE TableGetFHCandWords(TableMetaData* table)
     if (!table->tableDict->iFH)
         return IRV_DISPLAY_MESSAGE;
 
+    FcitxCandidateWordList* candList = FcitxInputStateGetCandidateList(input);
     for (i = 0; i < table->tableDict->iFH; i++) {
-        TABLECANDWORD* tableCandWord = fcitx_utils_malloc0(sizeof(TABLECANDWORD));
+        TABLECANDWORD* tableCandWord = FcitxCandidateWordArenaAlloc(candList, sizeof(TABLECANDWORD));
         tableCandWord->flag = CT_FH;
         tableCandWord->candWord.iFHIndex = i;
         FcitxCandidateWord candWord;
@@ -1342,9 +1359,9 @@ INPUT_RETURN_VALUE TableGetFHCandWords(TableMetaData* table)
         candWord.owner = table;
         candWord.priv = tableCandWord;
         candWord.strExtra = NULL;
-        candWord.strWord = strdup(table->tableDict->fh[i].strFH);
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, table->tableDict->fh[i].strFH);
         candWord.wordType = MSG_OTHER;
-        FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input), &candWord);
+        FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
     }
     return IRV_DISPLAY_CANDWORDS;
 }
@@ -1449,50 +1466,6 @@ void TableMetaDataFree(TableMetaData *table)
     free(table);
 }
 
-int TableCandCmp(const void* a, const void* b, void *arg)
-{
-    TABLECANDWORD* canda = *(TABLECANDWORD**)a;
-    TABLECANDWORD* candb = *(TABLECANDWORD**)b;
-    TableCandWordSortContext* context = arg;
-
-    if (context->simpleLevel > 0) {
-        size_t lengthA = strlen(canda->candWord.record->strCode);
-        size_t lengthB = strlen(candb->candWord.record->strCode);
-
-        if (lengthA <= context->simpleLevel && lengthB <= context->simpleLevel) {
-            /* we use msort which is stable, so it doesn't matter */
-            return 0;
-        }
-        if (lengthA > context->simpleLevel && lengthB <= context->simpleLevel) {
-            return 1;
-        }
-        if (lengthA <= context->simpleLevel && lengthB > context->simpleLevel) {
-            return -1;
-        }
-    }
-
-    switch (context->order) {
-    case AD_NO:
-        /* actually this is dead code, since AD_NO doesn't sort at all */
-        return 0;
-    case AD_FAST: {
-        int result = strcmp(canda->candWord.record->strCode,
-                            candb->candWord.record->strCode);
-        if (result != 0)
-            return result;
-        return candb->candWord.record->iIndex - canda->candWord.record->iIndex;
-    }
-    case AD_FREQ: {
-        int result = strcmp(canda->candWord.record->strCode,
-                            candb->candWord.record->strCode);
-        if (result != 0)
-            return result;
-        return candb->candWord.record->iHit - canda->candWord.record->iHit;
-    }
-    }
-    return 0;
-}
-
 INPUT_RETURN_VALUE TableKeyBlocker(void* arg, FcitxKeySym sym, unsigned int state)
 {
     TableMetaData *table = arg;
@@ -1506,7 +1479,7 @@ INPUT_RETURN_VALUE TableKeyBlocker(void* arg, FcitxKeySym sym, unsigned int stat
             break;
         FcitxCandidateWordList *cand_list;
         cand_list = FcitxInputStateGetCandidateList(input);
-        if (FcitxCandidateWordPageCount(cand_list)) {
+        if (!FcitxCandidateWordIsEmpty(cand_list)) {
             FcitxCandidateWord *candWord;
             candWord = FcitxCandidateWordGetCurrentWindow(cand_list);
             if (candWord->owner != table)
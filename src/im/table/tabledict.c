@@ -24,17 +24,31 @@ void UpdateTableMetaData(TableMetaData* tableMetaData)
         tableMetaData->iTableAutoSendToClientWhenNone = tableDict->iCodeLength;
 }
 
+/*
+ * 记录读入的记录中拼音、提示等信息
+ */
+static void TableDictIndexRecord(TableDict* tableDict, RECORD* recTemp)
+{
+    if (recTemp->iIndex > tableDict->iTableIndex)
+        tableDict->iTableIndex = recTemp->iIndex;
+
+    if (recTemp->type == RECORDTYPE_PINYIN)
+        tableDict->bHasPinyin = true;
+
+    if (recTemp->type == RECORDTYPE_PROMPT && strlen(recTemp->strCode) == 1)
+        tableDict->promptCode[(uint8_t) recTemp->strCode[0]] = recTemp;
+}
+
 boolean LoadTableDict(TableMetaData* tableMetaData)
 {
     char            strCode[MAX_CODE_LENGTH + 1];
     char           *strHZ = 0;
     FILE           *fpDict;
-    RECORD         *recTemp;
+    RECORD         *recTemp, *recLast;
     unsigned int    i = 0;
     uint32_t        iTemp, iTempCount;
-    char            cChar = 0, cTemp;
+    char            cTemp;
     int8_t          iVersion = 1;
-    int             iRecordIndex;
     TableDict      *tableDict;
 
     //读入码表
@@ -66,6 +80,13 @@ boolean LoadTableDict(TableMetaData* tableMetaData)
         tableDict->pool = fcitx_memory_pool_create();
 #define CHECK_LOAD_TABLE_ERROR(SIZE) if (size < (SIZE)) { error = true; goto table_load_error; }
 
+        //预先生成的码表镜像，直接映射到内存
+        if (TableImageCheck(fpDict)) {
+            error = !TableImageLoad(tableDict, fpDict);
+            UpdateTableMetaData(tableMetaData);
+            goto table_load_error;
+        }
+
         //先读取码表的信息
         //判断版本信息
         size_t size;
@@ -83,16 +104,6 @@ boolean LoadTableDict(TableMetaData* tableMetaData)
         tableDict->strInputCode = (char*)realloc(tableDict->strInputCode, sizeof(char) * (iTemp + 1));
         size = fread(tableDict->strInputCode, sizeof(char), iTemp + 1, fpDict);
         CHECK_LOAD_TABLE_ERROR(iTemp + 1);
-        /*
-         * 建立索引，加26是为了为拼音编码预留空间
-         */
-        size_t tmp_len = strlen(tableDict->strInputCode) + 26;
-        tableDict->recordIndex = (RECORD_INDEX*)fcitx_memory_pool_alloc(tableDict->pool, tmp_len * sizeof(RECORD_INDEX));
-        for (iTemp = 0; iTemp < tmp_len; iTemp++) {
-            tableDict->recordIndex[iTemp].cCode = 0;
-            tableDict->recordIndex[iTemp].record = NULL;
-        }
-        /********************************************************************/
 
         size = fread(&(tableDict->iCodeLength), sizeof(uint8_t), 1, fpDict);
         CHECK_LOAD_TABLE_ERROR(1);
@@ -134,17 +145,11 @@ boolean LoadTableDict(TableMetaData* tableMetaData)
         }
 
         tableDict->recordHead = (RECORD*)fcitx_memory_pool_alloc(tableDict->pool, sizeof(RECORD));
-        tableDict->currentRecord = tableDict->recordHead;
+        recLast = tableDict->recordHead;
 
         size = fcitx_utils_read_uint32(fpDict, &tableDict->iRecordCount);
         CHECK_LOAD_TABLE_ERROR(1);
 
-        for (i = 0; i < SINGLE_HZ_COUNT; i++) {
-            tableDict->tableSingleHZ[i] = (RECORD*)NULL;
-            tableDict->tableSingleHZCons[i] = (RECORD*)NULL;
-        }
-
-        iRecordIndex = 0;
         size_t bufSize = 0;
         for (i = 0; i < tableDict->iRecordCount; i++) {
             size = fread(strCode, sizeof(int8_t), tableDict->iPYCodeLength + 1, fpDict);
@@ -181,61 +186,33 @@ boolean LoadTableDict(TableMetaData* tableMetaData)
             CHECK_LOAD_TABLE_ERROR(1);
             size = fcitx_utils_read_uint32(fpDict, &recTemp->iIndex);
             CHECK_LOAD_TABLE_ERROR(1);
-            if (recTemp->iIndex > tableDict->iTableIndex)
-                tableDict->iTableIndex = recTemp->iIndex;
-
-            /* 建立索引 */
-            if (cChar != recTemp->strCode[0]) {
-                cChar = recTemp->strCode[0];
-                tableDict->recordIndex[iRecordIndex].cCode = cChar;
-                tableDict->recordIndex[iRecordIndex].record = recTemp;
-                iRecordIndex++;
-            }
-            /******************************************************************/
-            /** 为单字生成一个表   */
-            if (fcitx_utf8_strlen(recTemp->strHZ) == 1 && !IsIgnoreChar(tableDict, strCode[0]))
-            {
-                RECORD** tableSingleHZ = NULL;
-                if (recTemp->type == RECORDTYPE_NORMAL)
-                    tableSingleHZ = tableDict->tableSingleHZ;
-                else if (recTemp->type == RECORDTYPE_CONSTRUCT)
-                    tableSingleHZ = tableDict->tableSingleHZCons;
-
-                if (tableSingleHZ) {
-                    iTemp = CalHZIndex(recTemp->strHZ);
-                    if (iTemp < SINGLE_HZ_COUNT) {
-                        if (tableSingleHZ[iTemp]) {
-                            if (strlen(strCode) > strlen(tableDict->tableSingleHZ[iTemp]->strCode))
-                                tableSingleHZ[iTemp] = recTemp;
-                        } else
-                            tableSingleHZ[iTemp] = recTemp;
-                    }
-                }
-            }
-
-            if (recTemp->type == RECORDTYPE_PINYIN)
-                tableDict->bHasPinyin = true;
 
-            if (recTemp->type == RECORDTYPE_PROMPT && strlen(recTemp->strCode) == 1)
-                tableDict->promptCode[(uint8_t) recTemp->strCode[0]] = recTemp;
+            TableDictIndexRecord(tableDict, recTemp);
 
-            tableDict->currentRecord->next = recTemp;
-            recTemp->prev = tableDict->currentRecord;
-            tableDict->currentRecord = recTemp;
+            recLast->next = recTemp;
+            recTemp->prev = recLast;
+            recLast = recTemp;
         }
         if (strHZ) {
             free(strHZ);
             strHZ = NULL;
         }
 
-        tableDict->currentRecord->next = tableDict->recordHead;
-        tableDict->recordHead->prev = tableDict->currentRecord;
+        recLast->next = tableDict->recordHead;
+        tableDict->recordHead->prev = recLast;
+
+        TableCodeIndexBuild(tableDict);
+        TablePhraseIndexBuild(tableDict);
 
 table_load_error:
         fclose(fpDict);
         if (error) {
             fcitx_memory_pool_destroy(tableDict->pool);
             tableDict->pool = NULL;
+            TableCodeIndexFree(tableDict);
+            TablePhraseIndexFree(tableDict);
+            TableCandCacheFree(tableDict);
+            TableImageFree(tableDict);
             reload++;
         } else {
             break;
@@ -378,6 +355,12 @@ void SaveTableDict(TableMetaData *tableMetaData)
     size_t size;
 #define CHECK_WRITE_TABLE_ERROR(SIZE) if (size < (SIZE)) { error = true; goto table_write_error; }
 
+    // keep the format of the loaded table
+    if (tableDict->image) {
+        error = !TableImageWrite(tableDict, fpDict);
+        goto table_write_error;
+    }
+
     // write version number
     size = fcitx_utils_write_uint32(fpDict, 0);
     CHECK_WRITE_TABLE_ERROR(1);
@@ -529,47 +512,14 @@ void FreeTableDict(TableMetaData* tableMetaData)
         SaveTableDict(tableMetaData);
 
     fcitx_memory_pool_destroy(tableDict->pool);
+    TableCodeIndexFree(tableDict);
+    TablePhraseIndexFree(tableDict);
+    TableCandCacheFree(tableDict);
+    TableImageFree(tableDict);
     free(tableDict);
     tableMetaData->tableDict = NULL;
 }
 
-/*
- *根据字串判断词库中是否有某个字/词，注意该函数会忽略拼音词组
- */
-RECORD         *TableFindPhrase(const TableDict* tableDict, const char *strHZ)
-{
-    RECORD         *recTemp;
-    char            strTemp[UTF8_MAX_LENGTH + 1];
-    int             i;
-
-    //首先，先查找第一个汉字的编码
-    strncpy(strTemp, strHZ, fcitx_utf8_char_len(strHZ));
-    strTemp[fcitx_utf8_char_len(strHZ)] = '\0';
-
-    recTemp = tableDict->tableSingleHZ[CalHZIndex(strTemp)];
-    if (!recTemp)
-        return (RECORD *) NULL;
-
-    //然后根据该编码找到检索的起始点
-    i = 0;
-    while (recTemp->strCode[0] != tableDict->recordIndex[i].cCode)
-        i++;
-
-    recTemp = tableDict->recordIndex[i].record;
-    while (recTemp != tableDict->recordHead) {
-        if (recTemp->strCode[0] != tableDict->recordIndex[i].cCode)
-            break;
-        if (!strcmp(recTemp->strHZ, strHZ)) {
-            if (recTemp->type != RECORDTYPE_PINYIN)
-                return recTemp;
-        }
-
-        recTemp = recTemp->next;
-    }
-
-    return (RECORD *) NULL;
-}
-
 void TableCreateAutoPhrase(TableMetaData* tableMetaData, char iCount)
 {
     char            *strHZ;
@@ -633,7 +583,6 @@ boolean TableCreatePhraseCode(TableDict* tableDict, char *strHZ)
     unsigned char   i;
     unsigned char   i1, i2;
     size_t          iLen;
-    char            strTemp[UTF8_MAX_LENGTH + 1] = {'\0', };
     RECORD         *recTemp;
     boolean bCanntFindCode = false;
 
@@ -656,25 +605,17 @@ boolean TableCreatePhraseCode(TableDict* tableDict, char *strHZ)
 
     int codeIdx = 0;
     for (i1 = 0; i1 < tableDict->iCodeLength; i1++) {
-        int clen;
         char* ps;
-        if (tableDict->rule[i].rule[i1].iFlag) {
+        if (tableDict->rule[i].rule[i1].iFlag)
             ps = fcitx_utf8_get_nth_char(strHZ, tableDict->rule[i].rule[i1].iWhich - 1);
-            clen = fcitx_utf8_char_len(ps);
-            strncpy(strTemp, ps, clen);
-        } else {
+        else
             ps = fcitx_utf8_get_nth_char(strHZ, iLen - tableDict->rule[i].rule[i1].iWhich);
-            clen = fcitx_utf8_char_len(ps);
-            strncpy(strTemp, ps, clen);
-        }
 
-        int hzIndex = CalHZIndex(strTemp);
-
-        if (tableDict->tableSingleHZ[hzIndex]) {
-            if (tableDict->tableSingleHZCons[hzIndex])
-                recTemp = tableDict->tableSingleHZCons[hzIndex];
-            else
-                recTemp = tableDict->tableSingleHZ[hzIndex];
+        recTemp = TableFindSingleHZ(tableDict, ps, RECORDTYPE_NORMAL);
+        if (recTemp) {
+            RECORD* recCons = TableFindSingleHZ(tableDict, ps, RECORDTYPE_CONSTRUCT);
+            if (recCons)
+                recTemp = recCons;
         }
         else {
             bCanntFindCode = true;
@@ -696,27 +637,30 @@ boolean TableCreatePhraseCode(TableDict* tableDict, char *strHZ)
  */
 RECORD         *TableHasPhrase(const TableDict* tableDict, const char *strCode, const char *strHZ)
 {
-    RECORD         *recTemp;
-    int             i;
-
-    i = 0;
-    while (strCode[0] != tableDict->recordIndex[i].cCode)
-        i++;
+    const TableCodeIndex* index = &tableDict->codeIndex;
+    uint32_t        low = 0, high = index->iRecordCount;
+
+    /* find the first record after all records of strCode */
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        if (strcmp(index->records[mid]->strCode, strCode) > 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
 
-    recTemp = tableDict->recordIndex[i].record;
-    while (recTemp != tableDict->recordHead) {
-        if (recTemp->type != RECORDTYPE_PINYIN) {
-            if (strcmp(recTemp->strCode, strCode) > 0)
-                break;
-            else if (!strcmp(recTemp->strCode, strCode)) {
-                if (!strcmp(recTemp->strHZ, strHZ))     //该词组已经在词库中
-                    return NULL;
-            }
-        }
-        recTemp = recTemp->next;
+    for (high = low; high > 0; high--) {
+        RECORD* recTemp = index->records[high - 1];
+        if (strcmp(recTemp->strCode, strCode) != 0)
+            break;
+        if (recTemp->type != RECORDTYPE_PINYIN &&
+            !strcmp(recTemp->strHZ, strHZ))     //该词组已经在词库中
+            return NULL;
     }
 
-    return recTemp;
+    if (low == index->iRecordCount)
+        return tableDict->recordHead;
+    return index->records[low];
 }
 
 void TableInsertPhrase(TableDict* tableDict, const char *strCode, const char *strHZ)
@@ -744,6 +688,8 @@ void TableInsertPhrase(TableDict* tableDict, const char *strCode, const char *st
 
     tableDict->iRecordCount++;
     tableDict->iTableChanged++;
+    TableCodeIndexInsert(tableDict, dictNew);
+    TablePhraseIndexInsert(tableDict, dictNew);
 }
 
 /*
@@ -771,6 +717,8 @@ void TableDelPhrase(TableDict* tableDict, RECORD * record)
 
     tableDict->iRecordCount--;
     tableDict->iTableChanged++;
+    TableCodeIndexRemove(tableDict, record);
+    TablePhraseIndexRemove(tableDict, record);
 }
 
 void TableUpdateHitFrequency(TableMetaData* tableMetaData, RECORD * record)
@@ -779,6 +727,7 @@ void TableUpdateHitFrequency(TableMetaData* tableMetaData, RECORD * record)
         tableMetaData->tableDict->iTableChanged++;
         record->iHit++;
         record->iIndex = ++tableMetaData->tableDict->iTableIndex;
+        TableCandCacheReset(tableMetaData->tableDict);
     }
 }
 
@@ -803,43 +752,6 @@ int TableCompareCode(const TableMetaData* tableMetaData, const char *strUser, co
     return 0;
 }
 
-int TableFindFirstMatchCode(TableMetaData* tableMetaData, const char* strCodeInput, boolean exactMatch, boolean cacheCurrentRecord)
-{
-    int             i = 0;
-    TableDict      *tableDict = tableMetaData->tableDict;
-
-    if (!tableDict->recordHead)
-        return -1;
-
-    if (tableMetaData->bUseMatchingKey && (strCodeInput[0] == tableMetaData->cMatchingKey))
-        i = 0;
-    else {
-        while (strCodeInput[0] != tableDict->recordIndex[i].cCode) {
-            if (!tableDict->recordIndex[i].cCode)
-                break;
-            i++;
-        }
-    }
-    RECORD* record = NULL;
-    RECORD** pRecord = &record;
-    if (cacheCurrentRecord)
-        pRecord = &tableDict->currentRecord;
-
-    *pRecord = tableDict->recordIndex[i].record;
-    if (!*pRecord)
-        return -1;
-
-    while (*pRecord != tableDict->recordHead) {
-        if (!TableCompareCode(tableMetaData, strCodeInput, (*pRecord)->strCode, exactMatch)) {
-            return i;
-        }
-        (*pRecord) = (*pRecord)->next;
-        i++;
-    }
-
-    return -1;          //Not found
-}
-
 boolean IsInputKey(const TableDict* tableDict, int iKey)
 {
     char           *p;
@@ -893,44 +805,6 @@ boolean IsIgnoreChar(const TableDict* tableDict, char cChar)
     return false;
 }
 
-#include "utf8_in_gb18030.h"
-
-static int cmpi(const void * a, const void *b)
-{
-    return (*((int*)a)) - (*((int*)b));
-}
-
-unsigned int CalHZIndex(char *strHZ)
-{
-    unsigned int iutf = 0;
-    int l = fcitx_utf8_char_len(strHZ);
-    unsigned char* utf = (unsigned char*) strHZ;
-    unsigned int *res;
-    int idx;
-
-    if (l == 2) {
-        iutf = *utf++ << 8;
-        iutf |= *utf++;
-    } else if (l == 3) {
-        iutf = *utf++ << 16;
-        iutf |= *utf++ << 8;
-        iutf |= *utf++;
-    } else if (l == 4) {
-        iutf = *utf++ << 24;
-
-        iutf |= *utf++ << 16;
-        iutf |= *utf++ << 8;
-        iutf |= *utf++;
-    }
-
-    res = bsearch(&iutf, fcitx_utf8_in_gb18030, 63360, sizeof(int), cmpi);
-    if (res)
-        idx = res - fcitx_utf8_in_gb18030;
-    else
-        idx = 63361;
-    return idx;
-}
-
 boolean HasMatchingKey(const TableMetaData* tableMetaData, const char* strCodeInput)
 {
     const char *str;
@@ -5,6 +5,7 @@
 #include "fcitx-config/fcitx-config.h"
 #include "fcitx-config/hotkey.h"
 #include "fcitx-utils/memory.h"
+#include "fcitx-utils/utarray.h"
 #include "fcitx/candidate.h"
 
 #define MAX_CODE_LENGTH  30
@@ -12,7 +13,6 @@
 #define FH_MAX_LENGTH  10
 #define TABLE_AUTO_SAVE_AFTER 1024
 #define AUTO_PHRASE_COUNT 10000
-#define SINGLE_HZ_COUNT 66000
 
 #define RECORDTYPE_NORMAL 0x0
 #define RECORDTYPE_PINYIN 0x1
@@ -66,11 +66,70 @@ typedef struct _AUTOPHRASE {
     struct _AUTOPHRASE *next;   //构造一个队列
 } AUTOPHRASE;
 
-/* 根据键码生成一个简单的索引，指向该键码起始的第一个记录 */
+/*
+ * Prefix tree over the code of all records, every node covers a continuous
+ * range of TableCodeIndex::records, which is sorted by code.
+ */
 typedef struct {
-    RECORD         *record;
+    uint32_t        iBegin;     /* first record having this prefix */
+    uint32_t        iExactEnd;  /* records in [iBegin, iExactEnd) have exactly this code */
+    uint32_t        iEnd;       /* one past the last record having this prefix */
+    uint32_t        iChild;     /* children are stored continuously, sorted by cCode */
+    uint8_t         iChildCount;
+    uint8_t         iDepth;
     char            cCode;
-} RECORD_INDEX;
+} TableCodeNode;
+
+typedef struct {
+    uint32_t        iBegin;
+    uint32_t        iEnd;
+} TableCodeRange;
+
+typedef struct {
+    RECORD        **records;
+    uint32_t        iRecordCount;
+    TableCodeNode  *nodes;      /* nodes[0] is the root, the empty prefix */
+    uint32_t        iNodeCount;
+    uint32_t        iNodeAlloc; /* 0 if nodes is borrowed from the table image */
+    uint32_t        iNodeUnused; /* left behind by TableCodeIndexInsert */
+    UT_array        matches;    /* TableCodeRange of the last TableFindMatchCode */
+} TableCodeIndex;
+
+/*
+ * Hash table from phrase to records, linear probing, so records of the same
+ * key are kept in insert order. The key is either the whole phrase (pinyin
+ * records are not included), or the phrase without its last character for
+ * remind.
+ */
+typedef struct {
+    RECORD        **slots;      /* NULL for empty slot */
+    uint32_t        iSize;      /* always power of 2 */
+    uint32_t        iCount;
+    boolean         bRemind;
+} TablePhraseIndex;
+
+/*
+ * Candidate records of the last input and all of its prefixes, so one more
+ * key only needs to filter the previous result, and backspace can pick up the
+ * shorter one directly. Only the leading records are put in candidate order,
+ * the rest is sorted when the candidate list pages to them.
+ */
+typedef struct {
+    UT_array        records;    /* RECORD* */
+    uint32_t        iSorted;    /* records before it are in candidate order */
+    boolean         bValid;
+} TableCandLevel;
+
+typedef struct {
+    char            strCode[MAX_CODE_LENGTH + 1]; /* levels[i] is for the first i keys */
+    TableCandLevel  levels[MAX_CODE_LENGTH + 1];
+    TableCandLevel  scratch;    /* input longer than MAX_CODE_LENGTH is not cached */
+    ADJUSTORDER     order;
+    int             iSimpleLevel;
+    boolean         bExactMatch;
+    boolean         bUseMatchingKey;
+    char            cMatchingKey;
+} TableCandCache;
 
 typedef struct {
     char strHZ[UTF8_MAX_LENGTH + 1];
@@ -86,18 +145,17 @@ typedef enum {
 
 typedef struct {
     char* strInputCode;
-    RECORD_INDEX* recordIndex;
+    TableCodeIndex codeIndex;
     unsigned char iCodeLength;
     unsigned char iPYCodeLength;
     char* strIgnoreChars;
     unsigned char   bRule;
     RULE* rule;
     uint32_t iRecordCount;
-    RECORD* tableSingleHZ[SINGLE_HZ_COUNT];
-    RECORD* tableSingleHZCons[SINGLE_HZ_COUNT];
+    TablePhraseIndex phraseIndex;
+    TablePhraseIndex remindIndex;
     unsigned int iTableIndex;
     boolean bHasPinyin;
-    RECORD* currentRecord;
     RECORD* recordHead;
     int iFH;
     FH* fh;
@@ -110,6 +168,9 @@ typedef struct {
     SINGLE_HZ hzLastInput[PHRASE_MAX_LENGTH]; //Records last HZ input
     RECORD* promptCode[256];
     FcitxMemoryPool* pool;
+    void* image;    /* mapped table image, if loaded from one */
+    size_t iImageSize;
+    TableCandCache candCache;
 } TableDict;
 
 typedef struct {
@@ -173,6 +234,8 @@ void UpdateTableMetaData(TableMetaData* tableMetaData);
 
 void TableInsertPhrase(TableDict* tableDict, const char *strCode, const char *strHZ);
 RECORD *TableFindPhrase(const TableDict* tableDict, const char *strHZ);
+RECORD *TableFindSingleHZ(const TableDict* tableDict, const char *strHZ, int8_t type);
+void TableFindRemindPhrase(const TableDict* tableDict, const char* strHZ, UT_array* records);
 boolean TableCreatePhraseCode(TableDict* tableDict, char* strHZ);
 void TableCreateAutoPhrase(TableMetaData* tableMetaData, char iCount);
 RECORD *TableHasPhrase(const TableDict* tableDict, const char *strCode, const char *strHZ);
@@ -180,13 +243,36 @@ void TableDelPhraseByHZ(TableDict* tableDict, const char *strHZ);
 void TableDelPhrase(TableDict* tableDict, RECORD * record);
 void TableUpdateHitFrequency(TableMetaData* tableMetaData, RECORD * record);
 int TableCompareCode(const TableMetaData* tableMetaData, const char* strUser, const char* strDict, boolean exactMatch);
-int TableFindFirstMatchCode(TableMetaData* tableMetaData, const char* strCodeInput, boolean exactMatch, boolean cacheCurrentRecord);
+int TableFindFirstMatchCode(TableMetaData* tableMetaData, const char* strCodeInput, boolean exactMatch);
+int TableFindMatchCode(TableMetaData* tableMetaData, const char* strCodeInput, boolean exactMatch);
+void TableCodeIndexBuild(TableDict* tableDict);
+void TableCodeIndexFree(TableDict* tableDict);
+void TableCodeIndexInsert(TableDict* tableDict, RECORD* record);
+void TableCodeIndexRemove(TableDict* tableDict, RECORD* record);
+void TableCodeIndexMoveFirst(TableDict* tableDict, RECORD* record);
+const TableCodeNode* TableCodeIndexFindNode(const TableDict* tableDict, const char* strCode);
+void TableCodeIndexAttach(TableDict* tableDict, RECORD** records, uint32_t iRecordCount, TableCodeNode* nodes, uint32_t iNodeCount);
+uint32_t TablePhraseHash(const char* strHZ, size_t len);
+uint32_t TablePhraseIndexSizeFor(uint32_t iCount);
+boolean TablePhraseIndexKey(const TablePhraseIndex* index, const RECORD* record, size_t* len);
+void TablePhraseIndexBuild(TableDict* tableDict);
+void TablePhraseIndexAttach(TablePhraseIndex* index, boolean bRemind, RECORD** slots, uint32_t iSize, uint32_t iCount);
+void TablePhraseIndexFree(TableDict* tableDict);
+void TablePhraseIndexInsert(TableDict* tableDict, RECORD* record);
+void TablePhraseIndexRemove(TableDict* tableDict, RECORD* record);
+TableCandLevel* TableCandCacheLookup(TableMetaData* tableMetaData, const char* strCodeInput);
+void TableCandCacheSortTo(TableDict* tableDict, TableCandLevel* level, uint32_t iCount);
+void TableCandCacheReset(TableDict* tableDict);
+void TableCandCacheFree(TableDict* tableDict);
+boolean TableImageCheck(FILE* fp);
+boolean TableImageLoad(TableDict* tableDict, FILE* fp);
+boolean TableImageWrite(TableDict* tableDict, FILE* fp);
+void TableImageFree(TableDict* tableDict);
 void TableResetFlags(TableDict* tableDict);
 
 boolean IsInputKey(const TableDict* tableDict, int iKey);
 boolean IsEndKey(const TableMetaData* tableMetaData, char cChar);
 boolean IsIgnoreChar(const TableDict* tableDict, char cChar);
-unsigned int CalHZIndex(char *strHZ);
 boolean HasMatchingKey(const TableMetaData* tableMetaData, const char* strCodeInput);
 CONFIG_BINDING_DECLARE(TableMetaData);
 
@@ -0,0 +1,483 @@
+#include "config.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx-utils/log.h"
+#include "fcitx-utils/utils.h"
+#include "tabledict.h"
+
+/*
+ * Table image is a prebuilt table that can be mapped into memory and used
+ * without parsing, so the same pages are shared by every process using the
+ * table. It contains the records, the code index, the phrase and remind
+ * index, all references are offsets relative to a section of the image.
+ *
+ * Every section is aligned to 8 bytes, integers are stored in host byte
+ * order, an image built on a host with different byte order is rejected.
+ */
+#define TABLE_IMAGE_MAGIC "FCITXTBI"
+#define TABLE_IMAGE_MAGIC_LEN 8
+#define TABLE_IMAGE_VERSION 3
+#define TABLE_IMAGE_BYTE_ORDER 0x01020304
+#define TABLE_IMAGE_ALIGN 8
+#define TABLE_IMAGE_NONE UINT32_MAX
+
+typedef struct {
+    char            magic[TABLE_IMAGE_MAGIC_LEN];
+    uint32_t        iVersion;
+    uint32_t        iByteOrder;
+    uint32_t        iSize;          /* size of the whole image */
+    uint32_t        iRecordSize;    /* sizeof(TableImageRecord) */
+    uint32_t        iNodeSize;      /* sizeof(TableCodeNode) */
+    uint32_t        iRecordCount;
+    uint32_t        iNodeCount;
+    uint32_t        iPhraseSize;    /* slots of phrase index */
+    uint32_t        iPhraseCount;   /* records in phrase index */
+    uint32_t        iRemindSize;
+    uint32_t        iRemindCount;
+    uint32_t        iRuleOffset;
+    uint32_t        iRuleSize;
+    uint32_t        iRecordOffset;
+    uint32_t        iNodeOffset;
+    uint32_t        iPhraseOffset;
+    uint32_t        iRemindOffset;
+    uint32_t        iStringOffset;
+    uint32_t        iStringSize;
+    uint32_t        iInputCode;     /* offset in string section */
+    uint32_t        iIgnoreChars;   /* offset in string section */
+    uint8_t         iCodeLength;
+    uint8_t         iPYCodeLength;
+    uint8_t         bRule;
+    uint8_t         reserved;
+} TableImageHeader;
+
+typedef struct {
+    uint32_t        iCode;          /* offset in string section */
+    uint32_t        iHZ;            /* offset in string section */
+    uint32_t        iHit;
+    uint32_t        iIndex;
+    int8_t          type;
+    uint8_t         reserved[3];
+} TableImageRecord;
+
+static inline uint32_t TableImageAlign(uint32_t offset)
+{
+    return (offset + TABLE_IMAGE_ALIGN - 1) & ~(TABLE_IMAGE_ALIGN - 1);
+}
+
+static inline uint32_t TableImageRuleSize(const TableImageHeader* header)
+{
+    if (!header->bRule || header->iCodeLength == 0)
+        return 0;
+    /* iFlag, iWords, then iFlag, iWhich, iIndex for each code */
+    return (header->iCodeLength - 1) * (2 + 3 * header->iCodeLength);
+}
+
+static boolean TableImageCheckSection(const TableImageHeader* header,
+                                      uint32_t offset, uint32_t count,
+                                      uint32_t size)
+{
+    if (offset % TABLE_IMAGE_ALIGN)
+        return false;
+    return (uint64_t) offset + (uint64_t) count * size <= header->iSize;
+}
+
+/* phrase index slots are record index, or NONE for empty slot */
+static boolean TableImageCheckPhraseIndex(const TableImageHeader* header,
+                                          const TableImageRecord* records,
+                                          const uint32_t* slots, uint32_t size,
+                                          uint32_t count, boolean bRemind)
+{
+    uint32_t i, n = 0;
+
+    /* lookup stops at empty slot, so there must be one */
+    if (size < 2 || (size & (size - 1)) || count >= size)
+        return false;
+    for (i = 0; i < size; i++) {
+        if (slots[i] == TABLE_IMAGE_NONE)
+            continue;
+        if (slots[i] >= header->iRecordCount
+            || (!bRemind && records[slots[i]].type == RECORDTYPE_PINYIN))
+            return false;
+        n++;
+    }
+    return n == count;
+}
+
+static RECORD** TableImageLoadPhraseIndex(RECORD* records, const uint32_t* slots,
+                                          uint32_t size)
+{
+    RECORD** result = fcitx_utils_malloc0(sizeof(RECORD*) * size);
+    uint32_t i;
+    for (i = 0; i < size; i++) {
+        if (slots[i] != TABLE_IMAGE_NONE)
+            result[i] = &records[slots[i]];
+    }
+    return result;
+}
+
+/*
+ * same as TablePhraseIndexBuild but with record index, records are added
+ * in list order, so it's identical to the index built from a text table
+ */
+static uint32_t* TableImageBuildPhraseIndex(const TableCodeIndex* codeIndex,
+                                            boolean bRemind, uint32_t* size,
+                                            uint32_t* count)
+{
+    TablePhraseIndex index;
+    uint32_t* slots;
+    uint32_t i, j;
+    size_t len;
+
+    memset(&index, 0, sizeof(index));
+    index.bRemind = bRemind;
+    *count = 0;
+    for (i = 0; i < codeIndex->iRecordCount; i++) {
+        if (TablePhraseIndexKey(&index, codeIndex->records[i], &len))
+            (*count)++;
+    }
+    *size = TablePhraseIndexSizeFor(*count);
+    slots = fcitx_utils_malloc0(sizeof(uint32_t) * *size);
+    memset(slots, 0xff, sizeof(uint32_t) * *size);
+    for (i = 0; i < codeIndex->iRecordCount; i++) {
+        RECORD* recTemp = codeIndex->records[i];
+        if (!TablePhraseIndexKey(&index, recTemp, &len))
+            continue;
+        j = TablePhraseHash(recTemp->strHZ, len) & (*size - 1);
+        while (slots[j] != TABLE_IMAGE_NONE)
+            j = (j + 1) & (*size - 1);
+        slots[j] = i;
+    }
+    return slots;
+}
+
+boolean TableImageCheck(FILE* fp)
+{
+    char magic[TABLE_IMAGE_MAGIC_LEN];
+    boolean result;
+
+    result = (fread(magic, 1, TABLE_IMAGE_MAGIC_LEN, fp) == TABLE_IMAGE_MAGIC_LEN
+              && memcmp(magic, TABLE_IMAGE_MAGIC, TABLE_IMAGE_MAGIC_LEN) == 0);
+    rewind(fp);
+    return result;
+}
+
+static boolean TableImageValidate(const char* image, size_t size)
+{
+    const TableImageHeader* header = (const TableImageHeader*) image;
+    uint32_t i;
+
+    if (size < sizeof(TableImageHeader)
+        || memcmp(header->magic, TABLE_IMAGE_MAGIC, TABLE_IMAGE_MAGIC_LEN) != 0
+        || header->iVersion != TABLE_IMAGE_VERSION
+        || header->iByteOrder != TABLE_IMAGE_BYTE_ORDER
+        || header->iSize != size
+        || header->iRecordSize != sizeof(TableImageRecord)
+        || header->iNodeSize != sizeof(TableCodeNode))
+        return false;
+
+    if (header->iCodeLength == 0
+        || header->iCodeLength > MAX_CODE_LENGTH
+        || header->iPYCodeLength < header->iCodeLength
+        || header->iPYCodeLength > MAX_CODE_LENGTH
+        || header->iRuleSize != TableImageRuleSize(header))
+        return false;
+
+    if (!TableImageCheckSection(header, header->iRuleOffset, header->iRuleSize, 1)
+        || !TableImageCheckSection(header, header->iRecordOffset, header->iRecordCount, sizeof(TableImageRecord))
+        || !TableImageCheckSection(header, header->iNodeOffset, header->iNodeCount, sizeof(TableCodeNode))
+        || !TableImageCheckSection(header, header->iPhraseOffset, header->iPhraseSize, sizeof(uint32_t))
+        || !TableImageCheckSection(header, header->iRemindOffset, header->iRemindSize, sizeof(uint32_t))
+        || !TableImageCheckSection(header, header->iStringOffset, header->iStringSize, 1))
+        return false;
+
+    /* every string is terminated inside the string section */
+    const char* strings = image + header->iStringOffset;
+    if (header->iStringSize == 0 || strings[header->iStringSize - 1] != '\0')
+        return false;
+    if (header->iInputCode >= header->iStringSize
+        || header->iIgnoreChars >= header->iStringSize)
+        return false;
+
+    const TableImageRecord* records = (const TableImageRecord*)(image + header->iRecordOffset);
+    for (i = 0; i < header->iRecordCount; i++) {
+        if (records[i].iCode >= header->iStringSize
+            || records[i].iHZ >= header->iStringSize)
+            return false;
+        if (strnlen(strings + records[i].iCode, header->iPYCodeLength + 1) > header->iPYCodeLength)
+            return false;
+    }
+
+    /* the index may give wrong result if it's broken, but never out of range */
+    const TableCodeNode* nodes = (const TableCodeNode*)(image + header->iNodeOffset);
+    if (header->iNodeCount == 0
+        || nodes[0].iBegin != 0
+        || nodes[0].iEnd != header->iRecordCount)
+        return false;
+    for (i = 0; i < header->iNodeCount; i++) {
+        if (nodes[i].iBegin > nodes[i].iExactEnd
+            || nodes[i].iExactEnd > nodes[i].iEnd
+            || nodes[i].iEnd > header->iRecordCount)
+            return false;
+        if (nodes[i].iChildCount
+            && (nodes[i].iChild <= i
+                || (uint64_t) nodes[i].iChild + nodes[i].iChildCount > header->iNodeCount))
+            return false;
+    }
+
+    if (!TableImageCheckPhraseIndex(header, records,
+                                    (const uint32_t*)(image + header->iPhraseOffset),
+                                    header->iPhraseSize, header->iPhraseCount, false)
+        || !TableImageCheckPhraseIndex(header, records,
+                                       (const uint32_t*)(image + header->iRemindOffset),
+                                       header->iRemindSize, header->iRemindCount, true))
+        return false;
+
+    return true;
+}
+
+boolean TableImageLoad(TableDict* tableDict, FILE* fp)
+{
+    struct stat st;
+    uint32_t i, j;
+    int fd = fileno(fp);
+
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(TableImageHeader)
+        || (uint64_t) st.st_size > UINT32_MAX)
+        return false;
+
+    char* image = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (image == MAP_FAILED)
+        return false;
+
+    tableDict->image = image;
+    tableDict->iImageSize = st.st_size;
+
+    if (!TableImageValidate(image, st.st_size)) {
+        FcitxLog(WARNING, "Invalid table image");
+        return false;
+    }
+
+    const TableImageHeader* header = (const TableImageHeader*) image;
+    const TableImageRecord* imageRecords = (const TableImageRecord*)(image + header->iRecordOffset);
+    char* strings = image + header->iStringOffset;
+    uint32_t n = header->iRecordCount;
+
+    /* strings are only read, so they simply point to the shared image */
+    RECORD* records = fcitx_memory_pool_alloc_align(tableDict->pool, sizeof(RECORD) * (n + 1), 1);
+    RECORD** recordIndex = fcitx_utils_malloc0(sizeof(RECORD*) * (n ? n : 1));
+
+    tableDict->strInputCode = strings + header->iInputCode;
+    tableDict->strIgnoreChars = strings + header->iIgnoreChars;
+    tableDict->iCodeLength = header->iCodeLength;
+    tableDict->iPYCodeLength = header->iPYCodeLength;
+    tableDict->bRule = header->bRule;
+
+    if (tableDict->bRule) {
+        const uint8_t* rule = (const uint8_t*)(image + header->iRuleOffset);
+        tableDict->rule = (RULE*)fcitx_memory_pool_alloc(tableDict->pool, sizeof(RULE) * (tableDict->iCodeLength - 1));
+        for (i = 0; i < tableDict->iCodeLength - 1; i++) {
+            tableDict->rule[i].iFlag = *rule++;
+            tableDict->rule[i].iWords = *rule++;
+            tableDict->rule[i].rule = (RULE_RULE*)fcitx_memory_pool_alloc(tableDict->pool, sizeof(RULE_RULE) * tableDict->iCodeLength);
+            for (j = 0; j < tableDict->iCodeLength; j++) {
+                tableDict->rule[i].rule[j].iFlag = *rule++;
+                tableDict->rule[i].rule[j].iWhich = *rule++;
+                tableDict->rule[i].rule[j].iIndex = *rule++;
+            }
+        }
+    }
+
+    tableDict->recordHead = &records[n];
+    tableDict->iRecordCount = n;
+    RECORD* recLast = tableDict->recordHead;
+    for (i = 0; i < n; i++) {
+        RECORD* recTemp = &records[i];
+        recTemp->strCode = strings + imageRecords[i].iCode;
+        recTemp->strHZ = strings + imageRecords[i].iHZ;
+        recTemp->iHit = imageRecords[i].iHit;
+        recTemp->iIndex = imageRecords[i].iIndex;
+        recTemp->type = imageRecords[i].type;
+
+        if (recTemp->iIndex > tableDict->iTableIndex)
+            tableDict->iTableIndex = recTemp->iIndex;
+        if (recTemp->type == RECORDTYPE_PINYIN)
+            tableDict->bHasPinyin = true;
+        if (recTemp->type == RECORDTYPE_PROMPT && recTemp->strCode[0]
+            && !recTemp->strCode[1])
+            tableDict->promptCode[(uint8_t) recTemp->strCode[0]] = recTemp;
+
+        recLast->next = recTemp;
+        recTemp->prev = recLast;
+        recLast = recTemp;
+        recordIndex[i] = recTemp;
+    }
+    recLast->next = tableDict->recordHead;
+    tableDict->recordHead->prev = recLast;
+
+    TablePhraseIndexAttach(&tableDict->phraseIndex, false,
+                           TableImageLoadPhraseIndex(records, (const uint32_t*)(image + header->iPhraseOffset), header->iPhraseSize),
+                           header->iPhraseSize, header->iPhraseCount);
+    TablePhraseIndexAttach(&tableDict->remindIndex, true,
+                           TableImageLoadPhraseIndex(records, (const uint32_t*)(image + header->iRemindOffset), header->iRemindSize),
+                           header->iRemindSize, header->iRemindCount);
+
+    TableCodeIndexAttach(tableDict, recordIndex, n,
+                         (TableCodeNode*)(image + header->iNodeOffset),
+                         header->iNodeCount);
+
+    return true;
+}
+
+void TableImageFree(TableDict* tableDict)
+{
+    if (!tableDict->image)
+        return;
+    munmap(tableDict->image, tableDict->iImageSize);
+    tableDict->image = NULL;
+    tableDict->iImageSize = 0;
+}
+
+static boolean TableImageWritePad(FILE* fp, uint32_t* pos, uint32_t offset)
+{
+    static const char zero[TABLE_IMAGE_ALIGN] = {0};
+    if (offset > *pos && fwrite(zero, 1, offset - *pos, fp) != offset - *pos)
+        return false;
+    *pos = offset;
+    return true;
+}
+
+#define CHECK_WRITE_IMAGE_ERROR(EXPR) if (!(EXPR)) { error = true; goto image_write_error; }
+
+boolean TableImageWrite(TableDict* tableDict, FILE* fp)
+{
+    const TableCodeIndex* index = &tableDict->codeIndex;
+    TableImageHeader header;
+    uint32_t* phrase = NULL;
+    uint32_t* remind = NULL;
+    uint32_t i, j, pos = 0;
+    uint64_t stringSize;
+    boolean error = false;
+
+    /* index is always kept up to date, it's the same order as the list */
+    if (index->iRecordCount != tableDict->iRecordCount || !index->iNodeCount)
+        return false;
+    /* don't save nodes left behind by inserting */
+    if (index->iNodeUnused)
+        TableCodeIndexBuild(tableDict);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TABLE_IMAGE_MAGIC, TABLE_IMAGE_MAGIC_LEN);
+    header.iVersion = TABLE_IMAGE_VERSION;
+    header.iByteOrder = TABLE_IMAGE_BYTE_ORDER;
+    header.iRecordSize = sizeof(TableImageRecord);
+    header.iNodeSize = sizeof(TableCodeNode);
+    header.iCodeLength = tableDict->iCodeLength;
+    header.iPYCodeLength = tableDict->iPYCodeLength;
+    header.bRule = tableDict->bRule;
+    header.iRecordCount = index->iRecordCount;
+    header.iNodeCount = index->iNodeCount;
+
+    phrase = TableImageBuildPhraseIndex(index, false, &header.iPhraseSize,
+                                        &header.iPhraseCount);
+    remind = TableImageBuildPhraseIndex(index, true, &header.iRemindSize,
+                                        &header.iRemindCount);
+
+    stringSize = strlen(tableDict->strInputCode) + 1
+                 + strlen(tableDict->strIgnoreChars) + 1;
+    for (i = 0; i < index->iRecordCount; i++) {
+        stringSize += strlen(index->records[i]->strCode) + 1;
+        stringSize += strlen(index->records[i]->strHZ) + 1;
+    }
+
+    header.iRuleSize = TableImageRuleSize(&header);
+    header.iRuleOffset = TableImageAlign(sizeof(TableImageHeader));
+    header.iRecordOffset = TableImageAlign(header.iRuleOffset + header.iRuleSize);
+    header.iNodeOffset = TableImageAlign(header.iRecordOffset
+                                         + header.iRecordCount * sizeof(TableImageRecord));
+    header.iPhraseOffset = TableImageAlign(header.iNodeOffset
+                                           + header.iNodeCount * sizeof(TableCodeNode));
+    header.iRemindOffset = TableImageAlign(header.iPhraseOffset
+                                           + header.iPhraseSize * sizeof(uint32_t));
+    header.iStringOffset = TableImageAlign(header.iRemindOffset
+                                           + header.iRemindSize * sizeof(uint32_t));
+    CHECK_WRITE_IMAGE_ERROR(header.iStringOffset + stringSize <= UINT32_MAX);
+    header.iStringSize = stringSize;
+    header.iSize = header.iStringOffset + header.iStringSize;
+
+    uint32_t stringPos = 0;
+    header.iInputCode = stringPos;
+    stringPos += strlen(tableDict->strInputCode) + 1;
+    header.iIgnoreChars = stringPos;
+    stringPos += strlen(tableDict->strIgnoreChars) + 1;
+
+    CHECK_WRITE_IMAGE_ERROR(fwrite(&header, sizeof(header), 1, fp) == 1);
+    pos = sizeof(header);
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iRuleOffset));
+    if (header.iRuleSize) {
+        for (i = 0; i < tableDict->iCodeLength - 1; i++) {
+            uint8_t rule[2 + 3 * MAX_CODE_LENGTH];
+            uint8_t* p = rule;
+            *p++ = tableDict->rule[i].iFlag;
+            *p++ = tableDict->rule[i].iWords;
+            for (j = 0; j < tableDict->iCodeLength; j++) {
+                *p++ = tableDict->rule[i].rule[j].iFlag;
+                *p++ = tableDict->rule[i].rule[j].iWhich;
+                *p++ = tableDict->rule[i].rule[j].iIndex;
+            }
+            CHECK_WRITE_IMAGE_ERROR(fwrite(rule, 1, p - rule, fp) == (size_t)(p - rule));
+            pos += p - rule;
+        }
+    }
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iRecordOffset));
+    for (i = 0; i < index->iRecordCount; i++) {
+        RECORD* recTemp = index->records[i];
+        TableImageRecord record;
+        memset(&record, 0, sizeof(record));
+        record.iCode = stringPos;
+        stringPos += strlen(recTemp->strCode) + 1;
+        record.iHZ = stringPos;
+        stringPos += strlen(recTemp->strHZ) + 1;
+        record.iHit = recTemp->iHit;
+        record.iIndex = recTemp->iIndex;
+        record.type = recTemp->type;
+        CHECK_WRITE_IMAGE_ERROR(fwrite(&record, sizeof(record), 1, fp) == 1);
+    }
+    pos += index->iRecordCount * sizeof(TableImageRecord);
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iNodeOffset));
+    CHECK_WRITE_IMAGE_ERROR(fwrite(index->nodes, sizeof(TableCodeNode), index->iNodeCount, fp) == index->iNodeCount);
+    pos += index->iNodeCount * sizeof(TableCodeNode);
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iPhraseOffset));
+    CHECK_WRITE_IMAGE_ERROR(fwrite(phrase, sizeof(uint32_t), header.iPhraseSize, fp) == header.iPhraseSize);
+    pos += header.iPhraseSize * sizeof(uint32_t);
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iRemindOffset));
+    CHECK_WRITE_IMAGE_ERROR(fwrite(remind, sizeof(uint32_t), header.iRemindSize, fp) == header.iRemindSize);
+    pos += header.iRemindSize * sizeof(uint32_t);
+
+    CHECK_WRITE_IMAGE_ERROR(TableImageWritePad(fp, &pos, header.iStringOffset));
+    CHECK_WRITE_IMAGE_ERROR(fputs(tableDict->strInputCode, fp) != EOF && fputc('\0', fp) != EOF);
+    CHECK_WRITE_IMAGE_ERROR(fputs(tableDict->strIgnoreChars, fp) != EOF && fputc('\0', fp) != EOF);
+    for (i = 0; i < index->iRecordCount; i++) {
+        RECORD* recTemp = index->records[i];
+        CHECK_WRITE_IMAGE_ERROR(fputs(recTemp->strCode, fp) != EOF && fputc('\0', fp) != EOF);
+        CHECK_WRITE_IMAGE_ERROR(fputs(recTemp->strHZ, fp) != EOF && fputc('\0', fp) != EOF);
+    }
+
+image_write_error:
+    free(phrase);
+    free(remind);
+    return !error;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
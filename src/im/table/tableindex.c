@@ -0,0 +1,912 @@
+#include "config.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/utarray.h"
+#include "tabledict.h"
+
+static const UT_icd table_code_range_icd = {
+    sizeof(TableCodeRange), NULL, NULL, NULL
+};
+
+static int TableRecordCodeCmp(const void* a, const void* b, void* arg)
+{
+    FCITX_UNUSED(arg);
+    return strcmp((*(RECORD**)a)->strCode, (*(RECORD**)b)->strCode);
+}
+
+static inline uint32_t TableCodeIndexNewNode(TableCodeIndex* index)
+{
+    if (index->iNodeCount == index->iNodeAlloc) {
+        index->iNodeAlloc = index->iNodeAlloc ? index->iNodeAlloc * 2 : 256;
+        index->nodes = realloc(index->nodes,
+                               sizeof(TableCodeNode) * index->iNodeAlloc);
+    }
+    memset(&index->nodes[index->iNodeCount], 0, sizeof(TableCodeNode));
+    return index->iNodeCount++;
+}
+
+/*
+ * Records are kept in the list sorted by code, so the index is simply the
+ * list flattened into an array, plus a prefix tree built level by level on
+ * top of it. Since every node is appended after all its ancestors, walking
+ * the node array in order is a breadth first traversal, and children of a
+ * node are always allocated in one go.
+ */
+void TableCodeIndexBuild(TableDict* tableDict)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    RECORD* recTemp;
+    uint32_t i, n;
+
+    TableCandCacheReset(tableDict);
+    if (!index->matches.icd)
+        utarray_init(&index->matches, &table_code_range_icd);
+    utarray_clear(&index->matches);
+
+    n = 0;
+    for (recTemp = tableDict->recordHead->next;
+         recTemp != tableDict->recordHead; recTemp = recTemp->next)
+        n++;
+
+    index->records = realloc(index->records, sizeof(RECORD*) * (n ? n : 1));
+    index->iRecordCount = n;
+    boolean sorted = true;
+    i = 0;
+    for (recTemp = tableDict->recordHead->next;
+         recTemp != tableDict->recordHead; recTemp = recTemp->next) {
+        if (i && strcmp(index->records[i - 1]->strCode, recTemp->strCode) > 0)
+            sorted = false;
+        index->records[i++] = recTemp;
+    }
+
+    /*
+     * a hand edited user table may not be sorted, keep order of same code,
+     * and relink the list so it will be saved in order.
+     */
+    if (!sorted) {
+        fcitx_msort_r(index->records, n, sizeof(RECORD*),
+                      TableRecordCodeCmp, NULL);
+        recTemp = tableDict->recordHead;
+        for (i = 0; i < n; i++) {
+            recTemp->next = index->records[i];
+            index->records[i]->prev = recTemp;
+            recTemp = index->records[i];
+        }
+        recTemp->next = tableDict->recordHead;
+        tableDict->recordHead->prev = recTemp;
+    }
+
+    /* nodes may be borrowed from a table image, never write to them */
+    if (!index->iNodeAlloc)
+        index->nodes = NULL;
+    index->iNodeCount = 0;
+    index->iNodeUnused = 0;
+    TableCodeIndexNewNode(index);
+    index->nodes[0].iBegin = 0;
+    index->nodes[0].iEnd = n;
+
+    uint32_t cur;
+    for (cur = 0; cur < index->iNodeCount; cur++) {
+        TableCodeNode node = index->nodes[cur];
+        uint32_t j = node.iBegin;
+        while (j < node.iEnd && index->records[j]->strCode[node.iDepth] == '\0')
+            j++;
+        index->nodes[cur].iExactEnd = j;
+        if (node.iDepth == UINT8_MAX)
+            continue;
+
+        uint32_t child = index->iNodeCount;
+        uint32_t count = 0;
+        while (j < node.iEnd) {
+            char c = index->records[j]->strCode[node.iDepth];
+            uint32_t begin = j;
+            while (j < node.iEnd && index->records[j]->strCode[node.iDepth] == c)
+                j++;
+            uint32_t id = TableCodeIndexNewNode(index);
+            index->nodes[id].iBegin = begin;
+            index->nodes[id].iEnd = j;
+            index->nodes[id].iDepth = node.iDepth + 1;
+            index->nodes[id].cCode = c;
+            count++;
+        }
+        index->nodes[cur].iChild = child;
+        index->nodes[cur].iChildCount = count;
+    }
+}
+
+void TableCodeIndexFree(TableDict* tableDict)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    free(index->records);
+    if (index->iNodeAlloc)
+        free(index->nodes);
+    if (index->matches.icd)
+        utarray_done(&index->matches);
+    memset(index, 0, sizeof(TableCodeIndex));
+}
+
+/*
+ * Use a prebuilt index, records is owned by the index afterwards, while nodes
+ * is only borrowed and will be copied on the first rebuild.
+ */
+void TableCodeIndexAttach(TableDict* tableDict, RECORD** records,
+                          uint32_t iRecordCount, TableCodeNode* nodes,
+                          uint32_t iNodeCount)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    if (!index->matches.icd)
+        utarray_init(&index->matches, &table_code_range_icd);
+    utarray_clear(&index->matches);
+    free(index->records);
+    if (index->iNodeAlloc)
+        free(index->nodes);
+    index->records = records;
+    index->iRecordCount = iRecordCount;
+    index->nodes = nodes;
+    index->iNodeCount = iNodeCount;
+    index->iNodeAlloc = 0;
+    index->iNodeUnused = 0;
+}
+
+static inline const TableCodeNode*
+TableCodeIndexChild(const TableCodeIndex* index, const TableCodeNode* node,
+                    char c)
+{
+    uint32_t low = node->iChild, high = node->iChild + node->iChildCount;
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        unsigned char midCode = index->nodes[mid].cCode;
+        if (midCode == (unsigned char) c)
+            return &index->nodes[mid];
+        if (midCode < (unsigned char) c)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return NULL;
+}
+
+const TableCodeNode* TableCodeIndexFindNode(const TableDict* tableDict,
+                                            const char* strCode)
+{
+    const TableCodeIndex* index = &tableDict->codeIndex;
+    if (!index->iNodeCount)
+        return NULL;
+    const TableCodeNode* node = &index->nodes[0];
+    while (node && *strCode)
+        node = TableCodeIndexChild(index, node, *strCode++);
+    return node;
+}
+
+/*
+ * A single insert, delete or reorder from the user only changes the record
+ * array around one code, so the index is patched in place instead of being
+ * built again. Whenever the index doesn't look like the list, fall back to a
+ * rebuild.
+ */
+static void TableCodeIndexOwnNodes(TableCodeIndex* index)
+{
+    if (index->iNodeAlloc)
+        return;
+    TableCodeNode* nodes = malloc(sizeof(TableCodeNode) * index->iNodeCount);
+    memcpy(nodes, index->nodes, sizeof(TableCodeNode) * index->iNodeCount);
+    index->nodes = nodes;
+    index->iNodeAlloc = index->iNodeCount;
+}
+
+static int64_t TableCodeIndexFindRecord(const TableDict* tableDict,
+                                        const RECORD* record)
+{
+    const TableCodeIndex* index = &tableDict->codeIndex;
+    const TableCodeNode* node = TableCodeIndexFindNode(tableDict,
+                                                       record->strCode);
+    uint32_t i;
+    if (!node)
+        return -1;
+    for (i = node->iBegin; i < node->iExactEnd; i++) {
+        if (index->records[i] == record)
+            return i;
+    }
+    return -1;
+}
+
+/*
+ * Children of a node have to be continuous, so they are copied to the end
+ * together with the new one, the old copy is left unused until next rebuild.
+ */
+static uint32_t TableCodeIndexAddChild(TableCodeIndex* index, uint32_t parent,
+                                       char c, uint32_t pos)
+{
+    uint32_t count = index->nodes[parent].iChildCount;
+    uint32_t first = index->iNodeCount;
+    uint32_t i, j, result = 0;
+
+    for (i = 0; i <= count; i++)
+        TableCodeIndexNewNode(index);
+
+    TableCodeNode* nodes = index->nodes;
+    uint32_t old = nodes[parent].iChild;
+    for (i = 0, j = first; i < count; i++) {
+        if (!result && (unsigned char) nodes[old + i].cCode > (unsigned char) c)
+            result = j++;
+        nodes[j++] = nodes[old + i];
+    }
+    if (!result)
+        result = j;
+
+    nodes[result].iBegin = pos;
+    nodes[result].iExactEnd = pos;
+    nodes[result].iEnd = pos;
+    nodes[result].iDepth = nodes[parent].iDepth + 1;
+    nodes[result].cCode = c;
+    nodes[parent].iChild = first;
+    nodes[parent].iChildCount = count + 1;
+    index->iNodeUnused += count;
+    return result;
+}
+
+void TableCodeIndexInsert(TableDict* tableDict, RECORD* record)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    size_t len = strlen(record->strCode);
+    uint32_t path[len + 1];
+    uint32_t low = 0, high = index->iRecordCount;
+    uint32_t i;
+
+    if (!index->iNodeCount || len >= UINT8_MAX) {
+        TableCodeIndexBuild(tableDict);
+        return;
+    }
+
+    TableCandCacheReset(tableDict);
+    TableCodeIndexOwnNodes(index);
+
+    /* same as the list, after all records having the same code */
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        if (strcmp(index->records[mid]->strCode, record->strCode) > 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    path[0] = 0;
+    for (i = 0; i < len; i++) {
+        const TableCodeNode* child = TableCodeIndexChild(index,
+                                                         &index->nodes[path[i]],
+                                                         record->strCode[i]);
+        if (child)
+            path[i + 1] = child - index->nodes;
+        else
+            path[i + 1] = TableCodeIndexAddChild(index, path[i],
+                                                 record->strCode[i], low);
+    }
+
+    /*
+     * nodes starting from low are after the new record, except those on the
+     * path, which contain it
+     */
+    for (i = 0; i < index->iNodeCount; i++) {
+        TableCodeNode* node = &index->nodes[i];
+        if (node->iBegin >= low) {
+            node->iBegin++;
+            node->iExactEnd++;
+            node->iEnd++;
+        }
+    }
+    for (i = 0; i <= len; i++) {
+        TableCodeNode* node = &index->nodes[path[i]];
+        if (node->iBegin > low) {
+            node->iBegin--;
+            node->iExactEnd--;
+            node->iEnd--;
+        }
+        node->iEnd++;
+    }
+    index->nodes[path[len]].iExactEnd++;
+
+    index->records = realloc(index->records,
+                             sizeof(RECORD*) * (index->iRecordCount + 1));
+    memmove(&index->records[low + 1], &index->records[low],
+            sizeof(RECORD*) * (index->iRecordCount - low));
+    index->records[low] = record;
+    index->iRecordCount++;
+}
+
+void TableCodeIndexRemove(TableDict* tableDict, RECORD* record)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    int64_t pos = TableCodeIndexFindRecord(tableDict, record);
+    uint32_t i;
+
+    if (pos < 0) {
+        TableCodeIndexBuild(tableDict);
+        return;
+    }
+
+    TableCandCacheReset(tableDict);
+    TableCodeIndexOwnNodes(index);
+    for (i = 0; i < index->iNodeCount; i++) {
+        TableCodeNode* node = &index->nodes[i];
+        if (node->iBegin > pos)
+            node->iBegin--;
+        if (node->iExactEnd > pos)
+            node->iExactEnd--;
+        if (node->iEnd > pos)
+            node->iEnd--;
+    }
+
+    memmove(&index->records[pos], &index->records[pos + 1],
+            sizeof(RECORD*) * (index->iRecordCount - pos - 1));
+    index->iRecordCount--;
+}
+
+/* record is moved before all others having the same code */
+void TableCodeIndexMoveFirst(TableDict* tableDict, RECORD* record)
+{
+    TableCodeIndex* index = &tableDict->codeIndex;
+    const TableCodeNode* node = TableCodeIndexFindNode(tableDict,
+                                                       record->strCode);
+    int64_t pos = TableCodeIndexFindRecord(tableDict, record);
+
+    if (pos < 0) {
+        TableCodeIndexBuild(tableDict);
+        return;
+    }
+
+    TableCandCacheReset(tableDict);
+    memmove(&index->records[node->iBegin + 1], &index->records[node->iBegin],
+            sizeof(RECORD*) * (pos - node->iBegin));
+    index->records[node->iBegin] = record;
+}
+
+/*
+ * Walk the tree with the user input, the matching key (if enabled) walks
+ * into every child. If ranges is NULL, stop at the first match and return
+ * its position, otherwise collect all matching ranges in code order and
+ * return the number of records they cover.
+ */
+static int TableCodeIndexMatch(const TableMetaData* tableMetaData,
+                               const TableCodeNode* node,
+                               const char* strCode, boolean exactMatch,
+                               UT_array* ranges)
+{
+    const TableCodeIndex* index = &tableMetaData->tableDict->codeIndex;
+    if (*strCode == '\0') {
+        TableCodeRange range;
+        range.iBegin = node->iBegin;
+        range.iEnd = exactMatch ? node->iExactEnd : node->iEnd;
+        if (range.iBegin == range.iEnd)
+            return ranges ? 0 : -1;
+        if (!ranges)
+            return range.iBegin;
+        utarray_push_back(ranges, &range);
+        return range.iEnd - range.iBegin;
+    }
+
+    if (tableMetaData->bUseMatchingKey &&
+        *strCode == tableMetaData->cMatchingKey) {
+        int total = 0;
+        uint32_t i;
+        for (i = node->iChild; i < node->iChild + node->iChildCount; i++) {
+            int result = TableCodeIndexMatch(tableMetaData, &index->nodes[i],
+                                             strCode + 1, exactMatch, ranges);
+            if (!ranges) {
+                if (result >= 0)
+                    return result;
+            } else {
+                total += result;
+            }
+        }
+        return ranges ? total : -1;
+    }
+
+    node = TableCodeIndexChild(index, node, *strCode);
+    if (!node)
+        return ranges ? 0 : -1;
+    return TableCodeIndexMatch(tableMetaData, node, strCode + 1,
+                               exactMatch, ranges);
+}
+
+int TableFindFirstMatchCode(TableMetaData* tableMetaData,
+                            const char* strCodeInput, boolean exactMatch)
+{
+    TableDict *tableDict = tableMetaData->tableDict;
+
+    if (!tableDict->recordHead || !tableDict->codeIndex.iNodeCount)
+        return -1;
+
+    return TableCodeIndexMatch(tableMetaData, &tableDict->codeIndex.nodes[0],
+                               strCodeInput, exactMatch, NULL);
+}
+
+int TableFindMatchCode(TableMetaData* tableMetaData, const char* strCodeInput,
+                       boolean exactMatch)
+{
+    TableDict *tableDict = tableMetaData->tableDict;
+
+    if (!tableDict->recordHead || !tableDict->codeIndex.iNodeCount)
+        return 0;
+
+    utarray_clear(&tableDict->codeIndex.matches);
+    return TableCodeIndexMatch(tableMetaData, &tableDict->codeIndex.nodes[0],
+                               strCodeInput, exactMatch,
+                               &tableDict->codeIndex.matches);
+}
+
+/* FNV-1a, it's also used by table image, so never change it */
+uint32_t TablePhraseHash(const char* strHZ, size_t len)
+{
+    uint32_t hash = 2166136261u;
+    size_t i;
+    for (i = 0; i < len; i++) {
+        hash ^= (uint8_t) strHZ[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* keep load factor under 1/2 */
+uint32_t TablePhraseIndexSizeFor(uint32_t iCount)
+{
+    uint32_t size = 16;
+    while (size < UINT32_MAX / 4 && size / 2 <= iCount)
+        size *= 2;
+    return size;
+}
+
+/*
+ * Phrase index uses the whole phrase as key, and ignores pinyin records.
+ * Remind index uses the phrase without its last character, so all records
+ * of phrases which is one character longer than the remind source can be
+ * found directly.
+ */
+boolean TablePhraseIndexKey(const TablePhraseIndex* index,
+                            const RECORD* record, size_t* len)
+{
+    if (!index->bRemind) {
+        if (record->type == RECORDTYPE_PINYIN)
+            return false;
+        *len = strlen(record->strHZ);
+        return true;
+    }
+
+    const char* p = record->strHZ;
+    const char* last = p;
+    while (*p) {
+        last = p;
+        p += fcitx_utf8_char_len(p);
+    }
+    *len = last - record->strHZ;
+    return *len != 0;
+}
+
+static inline boolean TablePhraseIndexMatch(const TablePhraseIndex* index,
+                                            const RECORD* record,
+                                            const char* strHZ, size_t len)
+{
+    size_t recordLen;
+    return TablePhraseIndexKey(index, record, &recordLen)
+           && recordLen == len && strncmp(record->strHZ, strHZ, len) == 0;
+}
+
+/*
+ * return next record of strHZ in probe sequence starting at *slot,
+ * NULL if there is no more.
+ */
+static RECORD* TablePhraseIndexNext(const TablePhraseIndex* index,
+                                    uint32_t* slot, const char* strHZ,
+                                    size_t len)
+{
+    uint32_t mask = index->iSize - 1;
+    RECORD* record;
+    while ((record = index->slots[*slot])) {
+        *slot = (*slot + 1) & mask;
+        if (TablePhraseIndexMatch(index, record, strHZ, len))
+            return record;
+    }
+    return NULL;
+}
+
+static void TablePhraseIndexAdd(TablePhraseIndex* index, RECORD* record,
+                                size_t len)
+{
+    uint32_t mask = index->iSize - 1;
+    uint32_t slot = TablePhraseHash(record->strHZ, len) & mask;
+    while (index->slots[slot])
+        slot = (slot + 1) & mask;
+    index->slots[slot] = record;
+    index->iCount++;
+}
+
+static void TablePhraseIndexResize(TablePhraseIndex* index, uint32_t iSize)
+{
+    RECORD** slots = index->slots;
+    uint32_t size = index->iSize;
+    uint32_t i;
+    size_t len;
+
+    index->slots = fcitx_utils_malloc0(sizeof(RECORD*) * iSize);
+    index->iSize = iSize;
+    index->iCount = 0;
+    for (i = 0; i < size; i++) {
+        if (slots[i] && TablePhraseIndexKey(index, slots[i], &len))
+            TablePhraseIndexAdd(index, slots[i], len);
+    }
+    free(slots);
+}
+
+static void TablePhraseIndexBuildOne(TableDict* tableDict,
+                                     TablePhraseIndex* index, boolean bRemind)
+{
+    RECORD* recTemp;
+    size_t len;
+
+    free(index->slots);
+    index->bRemind = bRemind;
+    index->iSize = TablePhraseIndexSizeFor(tableDict->iRecordCount);
+    index->slots = fcitx_utils_malloc0(sizeof(RECORD*) * index->iSize);
+    index->iCount = 0;
+    for (recTemp = tableDict->recordHead->next;
+         recTemp != tableDict->recordHead; recTemp = recTemp->next) {
+        if (TablePhraseIndexKey(index, recTemp, &len))
+            TablePhraseIndexAdd(index, recTemp, len);
+    }
+}
+
+void TablePhraseIndexBuild(TableDict* tableDict)
+{
+    TablePhraseIndexBuildOne(tableDict, &tableDict->phraseIndex, false);
+    TablePhraseIndexBuildOne(tableDict, &tableDict->remindIndex, true);
+}
+
+/* use a prebuilt index, slots is owned by the index afterwards */
+void TablePhraseIndexAttach(TablePhraseIndex* index, boolean bRemind,
+                            RECORD** slots, uint32_t iSize, uint32_t iCount)
+{
+    free(index->slots);
+    index->bRemind = bRemind;
+    index->slots = slots;
+    index->iSize = iSize;
+    index->iCount = iCount;
+}
+
+void TablePhraseIndexFree(TableDict* tableDict)
+{
+    free(tableDict->phraseIndex.slots);
+    free(tableDict->remindIndex.slots);
+    memset(&tableDict->phraseIndex, 0, sizeof(TablePhraseIndex));
+    memset(&tableDict->remindIndex, 0, sizeof(TablePhraseIndex));
+}
+
+static void TablePhraseIndexInsertOne(TablePhraseIndex* index, RECORD* record)
+{
+    size_t len;
+    if (!index->slots || !TablePhraseIndexKey(index, record, &len))
+        return;
+    if (TablePhraseIndexSizeFor(index->iCount + 1) > index->iSize)
+        TablePhraseIndexResize(index, TablePhraseIndexSizeFor(index->iCount + 1));
+    TablePhraseIndexAdd(index, record, len);
+}
+
+void TablePhraseIndexInsert(TableDict* tableDict, RECORD* record)
+{
+    TablePhraseIndexInsertOne(&tableDict->phraseIndex, record);
+    TablePhraseIndexInsertOne(&tableDict->remindIndex, record);
+}
+
+static void TablePhraseIndexRemoveOne(TablePhraseIndex* index, RECORD* record)
+{
+    size_t len;
+    if (!index->slots || !TablePhraseIndexKey(index, record, &len))
+        return;
+
+    uint32_t mask = index->iSize - 1;
+    uint32_t i = TablePhraseHash(record->strHZ, len) & mask;
+    while (index->slots[i] && index->slots[i] != record)
+        i = (i + 1) & mask;
+    if (!index->slots[i])
+        return;
+
+    /* shift following records back, so no tombstone is needed */
+    uint32_t j = i;
+    for (;;) {
+        j = (j + 1) & mask;
+        RECORD* recTemp = index->slots[j];
+        if (!recTemp)
+            break;
+        TablePhraseIndexKey(index, recTemp, &len);
+        uint32_t k = TablePhraseHash(recTemp->strHZ, len) & mask;
+        if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
+            index->slots[i] = recTemp;
+            i = j;
+        }
+    }
+    index->slots[i] = NULL;
+    index->iCount--;
+}
+
+void TablePhraseIndexRemove(TableDict* tableDict, RECORD* record)
+{
+    TablePhraseIndexRemoveOne(&tableDict->phraseIndex, record);
+    TablePhraseIndexRemoveOne(&tableDict->remindIndex, record);
+}
+
+/*
+ *根据字串判断词库中是否有某个字/词，注意该函数会忽略拼音词组
+ *有多个编码时返回编码最小的
+ */
+RECORD *TableFindPhrase(const TableDict* tableDict, const char *strHZ)
+{
+    const TablePhraseIndex* index = &tableDict->phraseIndex;
+    RECORD *recTemp, *result = NULL;
+    size_t len = strlen(strHZ);
+
+    if (!index->slots)
+        return NULL;
+
+    uint32_t slot = TablePhraseHash(strHZ, len) & (index->iSize - 1);
+    while ((recTemp = TablePhraseIndexNext(index, &slot, strHZ, len))) {
+        if (!result || strcmp(recTemp->strCode, result->strCode) < 0)
+            result = recTemp;
+    }
+    return result;
+}
+
+/*
+ * 查找字串中第一个字的单字记录，type 为 RECORDTYPE_NORMAL 或
+ * RECORDTYPE_CONSTRUCT，有多个编码时返回编码最长的，用于造词
+ */
+RECORD *TableFindSingleHZ(const TableDict* tableDict, const char *strHZ, int8_t type)
+{
+    const TablePhraseIndex* index = &tableDict->phraseIndex;
+    RECORD *recTemp, *result = NULL;
+    size_t len = fcitx_utf8_char_len(strHZ);
+
+    if (!index->slots || !*strHZ)
+        return NULL;
+
+    uint32_t slot = TablePhraseHash(strHZ, len) & (index->iSize - 1);
+    while ((recTemp = TablePhraseIndexNext(index, &slot, strHZ, len))) {
+        if (recTemp->type != type || IsIgnoreChar(tableDict, recTemp->strCode[0]))
+            continue;
+        if (!result || strlen(recTemp->strCode) > strlen(result->strCode))
+            result = recTemp;
+    }
+    return result;
+}
+
+/*
+ * 查找比 strHZ 多一个字的词组用于联想，结果按编码排序，与码表中的顺序一致
+ */
+void TableFindRemindPhrase(const TableDict* tableDict, const char* strHZ,
+                           UT_array* records)
+{
+    const TablePhraseIndex* index = &tableDict->remindIndex;
+    RECORD* recTemp;
+    size_t len = strlen(strHZ);
+
+    if (!index->slots || !len)
+        return;
+
+    unsigned int first = utarray_len(records);
+    uint32_t slot = TablePhraseHash(strHZ, len) & (index->iSize - 1);
+    while ((recTemp = TablePhraseIndexNext(index, &slot, strHZ, len)))
+        utarray_push_back(records, &recTemp);
+
+    if (utarray_len(records) > first)
+        fcitx_msort_r(utarray_eltptr(records, first), utarray_len(records) - first,
+                      sizeof(RECORD*), TableRecordCodeCmp, NULL);
+}
+
+
+/*
+ * 候选词缓存，以 levels[i] 保存 strCode 前 i 个码的候选记录 (前 iSorted 个已排序)。
+ * 排序方式与输入无关，所以在非精确匹配时，多输入一个码只需在上一级的结果中
+ * 过滤，顺序保持不变；退格时则直接使用更短一级的结果。
+ */
+static int TableCandCacheCmp(const void* a, const void* b, void* arg)
+{
+    const RECORD* recA = *(RECORD**)a;
+    const RECORD* recB = *(RECORD**)b;
+    const TableCandCache* cache = arg;
+
+    if (cache->iSimpleLevel > 0) {
+        size_t lengthA = strlen(recA->strCode);
+        size_t lengthB = strlen(recB->strCode);
+
+        if (lengthA <= cache->iSimpleLevel && lengthB <= cache->iSimpleLevel) {
+            /* we use msort which is stable, so it doesn't matter */
+            return 0;
+        }
+        if (lengthA > cache->iSimpleLevel && lengthB <= cache->iSimpleLevel) {
+            return 1;
+        }
+        if (lengthA <= cache->iSimpleLevel && lengthB > cache->iSimpleLevel) {
+            return -1;
+        }
+    }
+
+    switch (cache->order) {
+    case AD_NO:
+        /* actually this is dead code, since AD_NO doesn't sort at all */
+        return 0;
+    case AD_FAST: {
+        int result = strcmp(recA->strCode, recB->strCode);
+        if (result != 0)
+            return result;
+        return recB->iIndex - recA->iIndex;
+    }
+    case AD_FREQ: {
+        int result = strcmp(recA->strCode, recB->strCode);
+        if (result != 0)
+            return result;
+        return recB->iHit - recA->iHit;
+    }
+    }
+    return 0;
+}
+
+static void TableCandCacheFill(TableMetaData* tableMetaData,
+                               const char* strCodeInput, TableCandLevel* level)
+{
+    TableDict* tableDict = tableMetaData->tableDict;
+    TableCandCache* cache = &tableDict->candCache;
+    UT_array* records = &level->records;
+
+    utarray_clear(records);
+    level->iSorted = 0;
+    if (!TableFindMatchCode(tableMetaData, strCodeInput, cache->bExactMatch))
+        return;
+
+    TableCodeRange* range;
+    for (range = (TableCodeRange*) utarray_front(&tableDict->codeIndex.matches);
+         range != NULL;
+         range = (TableCodeRange*) utarray_next(&tableDict->codeIndex.matches, range)) {
+        uint32_t j;
+        for (j = range->iBegin; j < range->iEnd; j++)
+            utarray_push_back(records, &tableDict->codeIndex.records[j]);
+    }
+
+    /* AD_NO keeps the order of code index, nothing to sort */
+    if (cache->order == AD_NO)
+        level->iSorted = utarray_len(records);
+}
+
+/*
+ * 保证前 iCount 个记录已排序。剩余部分中相同的记录仍保持原有先后次序，
+ * 所以分多次排序与一次全部排序的结果相同；每次至少加倍，避免翻页过多时重复扫描
+ */
+#define TABLE_CAND_SORT_MIN 64
+
+void TableCandCacheSortTo(TableDict* tableDict, TableCandLevel* level,
+                          uint32_t iCount)
+{
+    uint32_t iLen = utarray_len(&level->records);
+    if (iCount <= level->iSorted || level->iSorted >= iLen)
+        return;
+
+    uint32_t iTarget = iCount;
+    if (iTarget < level->iSorted * 2)
+        iTarget = level->iSorted * 2;
+    if (iTarget < TABLE_CAND_SORT_MIN)
+        iTarget = TABLE_CAND_SORT_MIN;
+    if (iTarget > iLen)
+        iTarget = iLen;
+
+    RECORD** rest = (RECORD**) utarray_eltptr(&level->records, level->iSorted);
+    fcitx_msort_topk_r(rest, iLen - level->iSorted, sizeof(RECORD*),
+                       iTarget - level->iSorted, TableCandCacheCmp,
+                       &tableDict->candCache);
+    level->iSorted = iTarget;
+}
+
+/*
+ * 返回与 strCodeInput 匹配的所有记录，包括 CONSTRUCT 与 PROMPT 类型，
+ * 结果在下一次调用或码表改变前有效，读取前需以 TableCandCacheSortTo 排序
+ */
+TableCandLevel* TableCandCacheLookup(TableMetaData* tableMetaData,
+                                     const char* strCodeInput)
+{
+    TableCandCache* cache = &tableMetaData->tableDict->candCache;
+    size_t len = strlen(strCodeInput);
+    size_t i;
+
+    if (!cache->scratch.records.icd) {
+        utarray_init(&cache->scratch.records, fcitx_ptr_icd);
+        for (i = 0; i <= MAX_CODE_LENGTH; i++)
+            utarray_init(&cache->levels[i].records, fcitx_ptr_icd);
+    }
+
+    if (cache->order != tableMetaData->tableOrder ||
+        cache->iSimpleLevel != tableMetaData->iSimpleLevel ||
+        cache->bExactMatch != tableMetaData->bTableExactMatch ||
+        cache->bUseMatchingKey != tableMetaData->bUseMatchingKey ||
+        cache->cMatchingKey != tableMetaData->cMatchingKey) {
+        TableCandCacheReset(tableMetaData->tableDict);
+        cache->order = tableMetaData->tableOrder;
+        cache->iSimpleLevel = tableMetaData->iSimpleLevel;
+        cache->bExactMatch = tableMetaData->bTableExactMatch;
+        cache->bUseMatchingKey = tableMetaData->bUseMatchingKey;
+        cache->cMatchingKey = tableMetaData->cMatchingKey;
+    }
+
+    if (len > MAX_CODE_LENGTH) {
+        TableCandCacheFill(tableMetaData, strCodeInput, &cache->scratch);
+        return &cache->scratch;
+    }
+
+    /* levels after the common prefix belong to some other input */
+    for (i = 0; i < len && cache->strCode[i] == strCodeInput[i]; i++);
+    if (cache->strCode[i] != '\0' && i < len) {
+        size_t j;
+        for (j = i + 1; j <= MAX_CODE_LENGTH; j++)
+            cache->levels[j].bValid = false;
+    }
+    if (i < len)
+        strcpy(cache->strCode, strCodeInput);
+
+    TableCandLevel* level = &cache->levels[len];
+    if (level->bValid)
+        return level;
+
+    /* 精确匹配的结果不是上一级的子集，只能重新查找 */
+    size_t from = 0;
+    if (!cache->bExactMatch && len > 1) {
+        for (from = len - 1; from > 0 && !cache->levels[from].bValid; from--);
+    }
+
+    if (from == 0) {
+        TableCandCacheFill(tableMetaData, strCodeInput, level);
+    } else {
+        /*
+         * 上一级已排序的部分过滤后仍是这一级最靠前的记录，
+         * 未排序的部分也保持原有次序
+         */
+        TableCandLevel* parent = &cache->levels[from];
+        uint32_t j;
+        utarray_clear(&level->records);
+        level->iSorted = 0;
+        for (j = 0; j < utarray_len(&parent->records); j++) {
+            RECORD** precord = (RECORD**) utarray_eltptr(&parent->records, j);
+            if (!TableCompareCode(tableMetaData, strCodeInput,
+                                  (*precord)->strCode, false)) {
+                utarray_push_back(&level->records, precord);
+                if (j < parent->iSorted)
+                    level->iSorted++;
+            }
+        }
+        if (parent->iSorted >= utarray_len(&parent->records))
+            level->iSorted = utarray_len(&level->records);
+    }
+    level->bValid = true;
+    return level;
+}
+
+/* 码表内容或词频改变后，缓存的结果与顺序都不再可靠 */
+void TableCandCacheReset(TableDict* tableDict)
+{
+    TableCandCache* cache = &tableDict->candCache;
+    size_t i;
+    cache->strCode[0] = '\0';
+    for (i = 0; i <= MAX_CODE_LENGTH; i++)
+        cache->levels[i].bValid = false;
+}
+
+void TableCandCacheFree(TableDict* tableDict)
+{
+    TableCandCache* cache = &tableDict->candCache;
+    size_t i;
+    if (cache->scratch.records.icd) {
+        utarray_done(&cache->scratch.records);
+        for (i = 0; i <= MAX_CODE_LENGTH; i++)
+            utarray_done(&cache->levels[i].records);
+    }
+    memset(cache, 0, sizeof(TableCandCache));
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -1,63384 +0,0 @@
-/***************************************************************************
- *   Copyright (C) 2010~2010 by CSSlayer                                   *
- *   wengxt@gmail.com                                                      *
- *                                                                         *
- *   This program is free software; you can redistribute it and/or modify  *
- *   it under the terms of the GNU General Public License as published by  *
- *   the Free Software Foundation; either version 2 of the License, or     *
- *   (at your option) any later version.                                   *
- *                                                                         *
- *   This program is distributed in the hope that it will be useful,       *
- *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
- *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
- *   GNU General Public License for more details.                          *
- *                                                                         *
- *   You should have received a copy of the GNU General Public License     *
- *   along with this program; if not, write to the                         *
- *   Free Software Foundation, Inc.,                                       *
- *   51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA.              *
- ***************************************************************************/
-
-unsigned int fcitx_utf8_in_gb18030[ 63360 ] = {
-    0xc280,
-    0xc281,
-    0xc282,
-    0xc283,
-    0xc284,
-    0xc285,
-    0xc286,
-    0xc287,
-    0xc288,
-    0xc289,
-    0xc28a,
-    0xc28b,
-    0xc28c,
-    0xc28d,
-    0xc28e,
-    0xc28f,
-    0xc290,
-    0xc291,
-    0xc292,
-    0xc293,
-    0xc294,
-    0xc295,
-    0xc296,
-    0xc297,
-    0xc298,
-    0xc299,
-    0xc29a,
-    0xc29b,
-    0xc29c,
-    0xc29d,
-    0xc29e,
-    0xc29f,
-    0xc2a0,
-    0xc2a1,
-    0xc2a2,
-    0xc2a3,
-    0xc2a4,
-    0xc2a5,
-    0xc2a6,
-    0xc2a7,
-    0xc2a8,
-    0xc2a9,
-    0xc2aa,
-    0xc2ab,
-    0xc2ac,
-    0xc2ad,
-    0xc2ae,
-    0xc2af,
-    0xc2b0,
-    0xc2b1,
-    0xc2b2,
-    0xc2b3,
-    0xc2b4,
-    0xc2b5,
-    0xc2b6,
-    0xc2b7,
-    0xc2b8,
-    0xc2b9,
-    0xc2ba,
-    0xc2bb,
-    0xc2bc,
-    0xc2bd,
-    0xc2be,
-    0xc2bf,
-    0xc380,
-    0xc381,
-    0xc382,
-    0xc383,
-    0xc384,
-    0xc385,
-    0xc386,
-    0xc387,
-    0xc388,
-    0xc389,
-    0xc38a,
-    0xc38b,
-    0xc38c,
-    0xc38d,
-    0xc38e,
-    0xc38f,
-    0xc390,
-    0xc391,
-    0xc392,
-    0xc393,
-    0xc394,
-    0xc395,
-    0xc396,
-    0xc397,
-    0xc398,
-    0xc399,
-    0xc39a,
-    0xc39b,
-    0xc39c,
-    0xc39d,
-    0xc39e,
-    0xc39f,
-    0xc3a0,
-    0xc3a1,
-    0xc3a2,
-    0xc3a3,
-    0xc3a4,
-    0xc3a5,
-    0xc3a6,
-    0xc3a7,
-    0xc3a8,
-    0xc3a9,
-    0xc3aa,
-    0xc3ab,
-    0xc3ac,
-    0xc3ad,
-    0xc3ae,
-    0xc3af,
-    0xc3b0,
-    0xc3b1,
-    0xc3b2,
-    0xc3b3,
-    0xc3b4,
-    0xc3b5,
-    0xc3b6,
-    0xc3b7,
-    0xc3b8,
-    0xc3b9,
-    0xc3ba,
-    0xc3bb,
-    0xc3bc,
-    0xc3bd,
-    0xc3be,
-    0xc3bf,
-    0xc480,
-    0xc481,
-    0xc482,
-    0xc483,
-    0xc484,
-    0xc485,
-    0xc486,
-    0xc487,
-    0xc488,
-    0xc489,
-    0xc48a,
-    0xc48b,
-    0xc48c,
-    0xc48d,
-    0xc48e,
-    0xc48f,
-    0xc490,
-    0xc491,
-    0xc492,
-    0xc493,
-    0xc494,
-    0xc495,
-    0xc496,
-    0xc497,
-    0xc498,
-    0xc499,
-    0xc49a,
-    0xc49b,
-    0xc49c,
-    0xc49d,
-    0xc49e,
-    0xc49f,
-    0xc4a0,
-    0xc4a1,
-    0xc4a2,
-    0xc4a3,
-    0xc4a4,
-    0xc4a5,
-    0xc4a6,
-    0xc4a7,
-    0xc4a8,
-    0xc4a9,
-    0xc4aa,
-    0xc4ab,
-    0xc4ac,
-    0xc4ad,
-    0xc4ae,
-    0xc4af,
-    0xc4b0,
-    0xc4b1,
-    0xc4b2,
-    0xc4b3,
-    0xc4b4,
-    0xc4b5,
-    0xc4b6,
-    0xc4b7,
-    0xc4b8,
-    0xc4b9,
-    0xc4ba,
-    0xc4bb,
-    0xc4bc,
-    0xc4bd,
-    0xc4be,
-    0xc4bf,
-    0xc580,
-    0xc581,
-    0xc582,
-    0xc583,
-    0xc584,
-    0xc585,
-    0xc586,
-    0xc587,
-    0xc588,
-    0xc589,
-    0xc58a,
-    0xc58b,
-    0xc58c,
-    0xc58d,
-    0xc58e,
-    0xc58f,
-    0xc590,
-    0xc591,
-    0xc592,
-    0xc593,
-    0xc594,
-    0xc595,
-    0xc596,
-    0xc597,
-    0xc598,
-    0xc599,
-    0xc59a,
-    0xc59b,
-    0xc59c,
-    0xc59d,
-    0xc59e,
-    0xc59f,
-    0xc5a0,
-    0xc5a1,
-    0xc5a2,
-    0xc5a3,
-    0xc5a4,
-    0xc5a5,
-    0xc5a6,
-    0xc5a7,
-    0xc5a8,
-    0xc5a9,
-    0xc5aa,
-    0xc5ab,
-    0xc5ac,
-    0xc5ad,
-    0xc5ae,
-    0xc5af,
-    0xc5b0,
-    0xc5b1,
-    0xc5b2,
-    0xc5b3,
-    0xc5b4,
-    0xc5b5,
-    0xc5b6,
-    0xc5b7,
-    0xc5b8,
-    0xc5b9,
-    0xc5ba,
-    0xc5bb,
-    0xc5bc,
-    0xc5bd,
-    0xc5be,
-    0xc5bf,
-    0xc680,
-    0xc681,
-    0xc682,
-    0xc683,
-    0xc684,
-    0xc685,
-    0xc686,
-    0xc687,
-    0xc688,
-    0xc689,
-    0xc68a,
-    0xc68b,
-    0xc68c,
-    0xc68d,
-    0xc68e,
-    0xc68f,
-    0xc690,
-    0xc691,
-    0xc692,
-    0xc693,
-    0xc694,
-    0xc695,
-    0xc696,
-    0xc697,
-    0xc698,
-    0xc699,
-    0xc69a,
-    0xc69b,
-    0xc69c,
-    0xc69d,
-    0xc69e,
-    0xc69f,
-    0xc6a0,
-    0xc6a1,
-    0xc6a2,
-    0xc6a3,
-    0xc6a4,
-    0xc6a5,
-    0xc6a6,
-    0xc6a7,
-    0xc6a8,
-    0xc6a9,
-    0xc6aa,
-    0xc6ab,
-    0xc6ac,
-    0xc6ad,
-    0xc6ae,
-    0xc6af,
-    0xc6b0,
-    0xc6b1,
-    0xc6b2,
-    0xc6b3,
-    0xc6b4,
-    0xc6b5,
-    0xc6b6,
-    0xc6b7,
-    0xc6b8,
-    0xc6b9,
-    0xc6ba,
-    0xc6bb,
-    0xc6bc,
-    0xc6bd,
-    0xc6be,
-    0xc6bf,
-    0xc780,
-    0xc781,
-    0xc782,
-    0xc783,
-    0xc784,
-    0xc785,
-    0xc786,
-    0xc787,
-    0xc788,
-    0xc789,
-    0xc78a,
-    0xc78b,
-    0xc78c,
-    0xc78d,
-    0xc78e,
-    0xc78f,
-    0xc790,
-    0xc791,
-    0xc792,
-    0xc793,
-    0xc794,
-    0xc795,
-    0xc796,
-    0xc797,
-    0xc798,
-    0xc799,
-    0xc79a,
-    0xc79b,
-    0xc79c,
-    0xc79d,
-    0xc79e,
-    0xc79f,
-    0xc7a0,
-    0xc7a1,
-    0xc7a2,
-    0xc7a3,
-    0xc7a4,
-    0xc7a5,
-    0xc7a6,
-    0xc7a7,
-    0xc7a8,
-    0xc7a9,
-    0xc7aa,
-    0xc7ab,
-    0xc7ac,
-    0xc7ad,
-    0xc7ae,
-    0xc7af,
-    0xc7b0,
-    0xc7b1,
-    0xc7b2,
-    0xc7b3,
-    0xc7b4,
-    0xc7b5,
-    0xc7b6,
-    0xc7b7,
-    0xc7b8,
-    0xc7b9,
-    0xc7ba,
-    0xc7bb,
-    0xc7bc,
-    0xc7bd,
-    0xc7be,
-    0xc7bf,
-    0xc880,
-    0xc881,
-    0xc882,
-    0xc883,
-    0xc884,
-    0xc885,
-    0xc886,
-    0xc887,
-    0xc888,
-    0xc889,
-    0xc88a,
-    0xc88b,
-    0xc88c,
-    0xc88d,
-    0xc88e,
-    0xc88f,
-    0xc890,
-    0xc891,
-    0xc892,
-    0xc893,
-    0xc894,
-    0xc895,
-    0xc896,
-    0xc897,
-    0xc898,
-    0xc899,
-    0xc89a,
-    0xc89b,
-    0xc89c,
-    0xc89d,
-    0xc89e,
-    0xc89f,
-    0xc8a0,
-    0xc8a1,
-    0xc8a2,
-    0xc8a3,
-    0xc8a4,
-    0xc8a5,
-    0xc8a6,
-    0xc8a7,
-    0xc8a8,
-    0xc8a9,
-    0xc8aa,
-    0xc8ab,
-    0xc8ac,
-    0xc8ad,
-    0xc8ae,
-    0xc8af,
-    0xc8b0,
-    0xc8b1,
-    0xc8b2,
-    0xc8b3,
-    0xc8b4,
-    0xc8b5,
-    0xc8b6,
-    0xc8b7,
-    0xc8b8,
-    0xc8b9,
-    0xc8ba,
-    0xc8bb,
-    0xc8bc,
-    0xc8bd,
-    0xc8be,
-    0xc8bf,
-    0xc980,
-    0xc981,
-    0xc982,
-    0xc983,
-    0xc984,
-    0xc985,
-    0xc986,
-    0xc987,
-    0xc988,
-    0xc989,
-    0xc98a,
-    0xc98b,
-    0xc98c,
-    0xc98d,
-    0xc98e,
-    0xc98f,
-    0xc990,
-    0xc991,
-    0xc992,
-    0xc993,
-    0xc994,
-    0xc995,
-    0xc996,
-    0xc997,
-    0xc998,
-    0xc999,
-    0xc99a,
-    0xc99b,
-    0xc99c,
-    0xc99d,
-    0xc99e,
-    0xc99f,
-    0xc9a0,
-    0xc9a1,
-    0xc9a2,
-    0xc9a3,
-    0xc9a4,
-    0xc9a5,
-    0xc9a6,
-    0xc9a7,
-    0xc9a8,
-    0xc9a9,
-    0xc9aa,
-    0xc9ab,
-    0xc9ac,
-    0xc9ad,
-    0xc9ae,
-    0xc9af,
-    0xc9b0,
-    0xc9b1,
-    0xc9b2,
-    0xc9b3,
-    0xc9b4,
-    0xc9b5,
-    0xc9b6,
-    0xc9b7,
-    0xc9b8,
-    0xc9b9,
-    0xc9ba,
-    0xc9bb,
-    0xc9bc,
-    0xc9bd,
-    0xc9be,
-    0xc9bf,
-    0xca80,
-    0xca81,
-    0xca82,
-    0xca83,
-    0xca84,
-    0xca85,
-    0xca86,
-    0xca87,
-    0xca88,
-    0xca89,
-    0xca8a,
-    0xca8b,
-    0xca8c,
-    0xca8d,
-    0xca8e,
-    0xca8f,
-    0xca90,
-    0xca91,
-    0xca92,
-    0xca93,
-    0xca94,
-    0xca95,
-    0xca96,
-    0xca97,
-    0xca98,
-    0xca99,
-    0xca9a,
-    0xca9b,
-    0xca9c,
-    0xca9d,
-    0xca9e,
-    0xca9f,
-    0xcaa0,
-    0xcaa1,
-    0xcaa2,
-    0xcaa3,
-    0xcaa4,
-    0xcaa5,
-    0xcaa6,
-    0xcaa7,
-    0xcaa8,
-    0xcaa9,
-    0xcaaa,
-    0xcaab,
-    0xcaac,
-    0xcaad,
-    0xcaae,
-    0xcaaf,
-    0xcab0,
-    0xcab1,
-    0xcab2,
-    0xcab3,
-    0xcab4,
-    0xcab5,
-    0xcab6,
-    0xcab7,
-    0xcab8,
-    0xcab9,
-    0xcaba,
-    0xcabb,
-    0xcabc,
-    0xcabd,
-    0xcabe,
-    0xcabf,
-    0xcb80,
-    0xcb81,
-    0xcb82,
-    0xcb83,
-    0xcb84,
-    0xcb85,
-    0xcb86,
-    0xcb87,
-    0xcb88,
-    0xcb89,
-    0xcb8a,
-    0xcb8b,
-    0xcb8c,
-    0xcb8d,
-    0xcb8e,
-    0xcb8f,
-    0xcb90,
-    0xcb91,
-    0xcb92,
-    0xcb93,
-    0xcb94,
-    0xcb95,
-    0xcb96,
-    0xcb97,
-    0xcb98,
-    0xcb99,
-    0xcb9a,
-    0xcb9b,
-    0xcb9c,
-    0xcb9d,
-    0xcb9e,
-    0xcb9f,
-    0xcba0,
-    0xcba1,
-    0xcba2,
-    0xcba3,
-    0xcba4,
-    0xcba5,
-    0xcba6,
-    0xcba7,
-    0xcba8,
-    0xcba9,
-    0xcbaa,
-    0xcbab,
-    0xcbac,
-    0xcbad,
-    0xcbae,
-    0xcbaf,
-    0xcbb0,
-    0xcbb1,
-    0xcbb2,
-    0xcbb3,
-    0xcbb4,
-    0xcbb5,
-    0xcbb6,
-    0xcbb7,
-    0xcbb8,
-    0xcbb9,
-    0xcbba,
-    0xcbbb,
-    0xcbbc,
-    0xcbbd,
-    0xcbbe,
-    0xcbbf,
-    0xcc80,
-    0xcc81,
-    0xcc82,
-    0xcc83,
-    0xcc84,
-    0xcc85,
-    0xcc86,
-    0xcc87,
-    0xcc88,
-    0xcc89,
-    0xcc8a,
-    0xcc8b,
-    0xcc8c,
-    0xcc8d,
-    0xcc8e,
-    0xcc8f,
-    0xcc90,
-    0xcc91,
-    0xcc92,
-    0xcc93,
-    0xcc94,
-    0xcc95,
-    0xcc96,
-    0xcc97,
-    0xcc98,
-    0xcc99,
-    0xcc9a,
-    0xcc9b,
-    0xcc9c,
-    0xcc9d,
-    0xcc9e,
-    0xcc9f,
-    0xcca0,
-    0xcca1,
-    0xcca2,
-    0xcca3,
-    0xcca4,
-    0xcca5,
-    0xcca6,
-    0xcca7,
-    0xcca8,
-    0xcca9,
-    0xccaa,
-    0xccab,
-    0xccac,
-    0xccad,
-    0xccae,
-    0xccaf,
-    0xccb0,
-    0xccb1,
-    0xccb2,
-    0xccb3,
-    0xccb4,
-    0xccb5,
-    0xccb6,
-    0xccb7,
-    0xccb8,
-    0xccb9,
-    0xccba,
-    0xccbb,
-    0xccbc,
-    0xccbd,
-    0xccbe,
-    0xccbf,
-    0xcd80,
-    0xcd81,
-    0xcd82,
-    0xcd83,
-    0xcd84,
-    0xcd85,
-    0xcd86,
-    0xcd87,
-    0xcd88,
-    0xcd89,
-    0xcd8a,
-    0xcd8b,
-    0xcd8c,
-    0xcd8d,
-    0xcd8e,
-    0xcd8f,
-    0xcd90,
-    0xcd91,
-    0xcd92,
-    0xcd93,
-    0xcd94,
-    0xcd95,
-    0xcd96,
-    0xcd97,
-    0xcd98,
-    0xcd99,
-    0xcd9a,
-    0xcd9b,
-    0xcd9c,
-    0xcd9d,
-    0xcd9e,
-    0xcd9f,
-    0xcda0,
-    0xcda1,
-    0xcda2,
-    0xcda3,
-    0xcda4,
-    0xcda5,
-    0xcda6,
-    0xcda7,
-    0xcda8,
-    0xcda9,
-    0xcdaa,
-    0xcdab,
-    0xcdac,
-    0xcdad,
-    0xcdae,
-    0xcdaf,
-    0xcdb0,
-    0xcdb1,
-    0xcdb2,
-    0xcdb3,
-    0xcdb4,
-    0xcdb5,
-    0xcdb6,
-    0xcdb7,
-    0xcdb8,
-    0xcdb9,
-    0xcdba,
-    0xcdbb,
-    0xcdbc,
-    0xcdbd,
-    0xcdbe,
-    0xcdbf,
-    0xce80,
-    0xce81,
-    0xce82,
-    0xce83,
-    0xce84,
-    0xce85,
-    0xce86,
-    0xce87,
-    0xce88,
-    0xce89,
-    0xce8a,
-    0xce8b,
-    0xce8c,
-    0xce8d,
-    0xce8e,
-    0xce8f,
-    0xce90,
-    0xce91,
-    0xce92,
-    0xce93,
-    0xce94,
-    0xce95,
-    0xce96,
-    0xce97,
-    0xce98,
-    0xce99,
-    0xce9a,
-    0xce9b,
-    0xce9c,
-    0xce9d,
-    0xce9e,
-    0xce9f,
-    0xcea0,
-    0xcea1,
-    0xcea2,
-    0xcea3,
-    0xcea4,
-    0xcea5,
-    0xcea6,
-    0xcea7,
-    0xcea8,
-    0xcea9,
-    0xceaa,
-    0xceab,
-    0xceac,
-    0xcead,
-    0xceae,
-    0xceaf,
-    0xceb0,
-    0xceb1,
-    0xceb2,
-    0xceb3,
-    0xceb4,
-    0xceb5,
-    0xceb6,
-    0xceb7,
-    0xceb8,
-    0xceb9,
-    0xceba,
-    0xcebb,
-    0xcebc,
-    0xcebd,
-    0xcebe,
-    0xcebf,
-    0xcf80,
-    0xcf81,
-    0xcf82,
-    0xcf83,
-    0xcf84,
-    0xcf85,
-    0xcf86,
-    0xcf87,
-    0xcf88,
-    0xcf89,
-    0xcf8a,
-    0xcf8b,
-    0xcf8c,
-    0xcf8d,
-    0xcf8e,
-    0xcf8f,
-    0xcf90,
-    0xcf91,
-    0xcf92,
-    0xcf93,
-    0xcf94,
-    0xcf95,
-    0xcf96,
-    0xcf97,
-    0xcf98,
-    0xcf99,
-    0xcf9a,
-    0xcf9b,
-    0xcf9c,
-    0xcf9d,
-    0xcf9e,
-    0xcf9f,
-    0xcfa0,
-    0xcfa1,
-    0xcfa2,
-    0xcfa3,
-    0xcfa4,
-    0xcfa5,
-    0xcfa6,
-    0xcfa7,
-    0xcfa8,
-    0xcfa9,
-    0xcfaa,
-    0xcfab,
-    0xcfac,
-    0xcfad,
-    0xcfae,
-    0xcfaf,
-    0xcfb0,
-    0xcfb1,
-    0xcfb2,
-    0xcfb3,
-    0xcfb4,
-    0xcfb5,
-    0xcfb6,
-    0xcfb7,
-    0xcfb8,
-    0xcfb9,
-    0xcfba,
-    0xcfbb,
-    0xcfbc,
-    0xcfbd,
-    0xcfbe,
-    0xcfbf,
-    0xd080,
-    0xd081,
-    0xd082,
-    0xd083,
-    0xd084,
-    0xd085,
-    0xd086,
-    0xd087,
-    0xd088,
-    0xd089,
-    0xd08a,
-    0xd08b,
-    0xd08c,
-    0xd08d,
-    0xd08e,
-    0xd08f,
-    0xd090,
-    0xd091,
-    0xd092,
-    0xd093,
-    0xd094,
-    0xd095,
-    0xd096,
-    0xd097,
-    0xd098,
-    0xd099,
-    0xd09a,
-    0xd09b,
-    0xd09c,
-    0xd09d,
-    0xd09e,
-    0xd09f,
-    0xd0a0,
-    0xd0a1,
-    0xd0a2,
-    0xd0a3,
-    0xd0a4,
-    0xd0a5,
-    0xd0a6,
-    0xd0a7,
-    0xd0a8,
-    0xd0a9,
-    0xd0aa,
-    0xd0ab,
-    0xd0ac,
-    0xd0ad,
-    0xd0ae,
-    0xd0af,
-    0xd0b0,
-    0xd0b1,
-    0xd0b2,
-    0xd0b3,
-    0xd0b4,
-    0xd0b5,
-    0xd0b6,
-    0xd0b7,
-    0xd0b8,
-    0xd0b9,
-    0xd0ba,
-    0xd0bb,
-    0xd0bc,
-    0xd0bd,
-    0xd0be,
-    0xd0bf,
-    0xd180,
-    0xd181,
-    0xd182,
-    0xd183,
-    0xd184,
-    0xd185,
-    0xd186,
-    0xd187,
-    0xd188,
-    0xd189,
-    0xd18a,
-    0xd18b,
-    0xd18c,
-    0xd18d,
-    0xd18e,
-    0xd18f,
-    0xd190,
-    0xd191,
-    0xd192,
-    0xd193,
-    0xd194,
-    0xd195,
-    0xd196,
-    0xd197,
-    0xd198,
-    0xd199,
-    0xd19a,
-    0xd19b,
-    0xd19c,
-    0xd19d,
-    0xd19e,
-    0xd19f,
-    0xd1a0,
-    0xd1a1,
-    0xd1a2,
-    0xd1a3,
-    0xd1a4,
-    0xd1a5,
-    0xd1a6,
-    0xd1a7,
-    0xd1a8,
-    0xd1a9,
-    0xd1aa,
-    0xd1ab,
-    0xd1ac,
-    0xd1ad,
-    0xd1ae,
-    0xd1af,
-    0xd1b0,
-    0xd1b1,
-    0xd1b2,
-    0xd1b3,
-    0xd1b4,
-    0xd1b5,
-    0xd1b6,
-    0xd1b7,
-    0xd1b8,
-    0xd1b9,
-    0xd1ba,
-    0xd1bb,
-    0xd1bc,
-    0xd1bd,
-    0xd1be,
-    0xd1bf,
-    0xd280,
-    0xd281,
-    0xd282,
-    0xd283,
-    0xd284,
-    0xd285,
-    0xd286,
-    0xd287,
-    0xd288,
-    0xd289,
-    0xd28a,
-    0xd28b,
-    0xd28c,
-    0xd28d,
-    0xd28e,
-    0xd28f,
-    0xd290,
-    0xd291,
-    0xd292,
-    0xd293,
-    0xd294,
-    0xd295,
-    0xd296,
-    0xd297,
-    0xd298,
-    0xd299,
-    0xd29a,
-    0xd29b,
-    0xd29c,
-    0xd29d,
-    0xd29e,
-    0xd29f,
-    0xd2a0,
-    0xd2a1,
-    0xd2a2,
-    0xd2a3,
-    0xd2a4,
-    0xd2a5,
-    0xd2a6,
-    0xd2a7,
-    0xd2a8,
-    0xd2a9,
-    0xd2aa,
-    0xd2ab,
-    0xd2ac,
-    0xd2ad,
-    0xd2ae,
-    0xd2af,
-    0xd2b0,
-    0xd2b1,
-    0xd2b2,
-    0xd2b3,
-    0xd2b4,
-    0xd2b5,
-    0xd2b6,
-    0xd2b7,
-    0xd2b8,
-    0xd2b9,
-    0xd2ba,
-    0xd2bb,
-    0xd2bc,
-    0xd2bd,
-    0xd2be,
-    0xd2bf,
-    0xd380,
-    0xd381,
-    0xd382,
-    0xd383,
-    0xd384,
-    0xd385,
-    0xd386,
-    0xd387,
-    0xd388,
-    0xd389,
-    0xd38a,
-    0xd38b,
-    0xd38c,
-    0xd38d,
-    0xd38e,
-    0xd38f,
-    0xd390,
-    0xd391,
-    0xd392,
-    0xd393,
-    0xd394,
-    0xd395,
-    0xd396,
-    0xd397,
-    0xd398,
-    0xd399,
-    0xd39a,
-    0xd39b,
-    0xd39c,
-    0xd39d,
-    0xd39e,
-    0xd39f,
-    0xd3a0,
-    0xd3a1,
-    0xd3a2,
-    0xd3a3,
-    0xd3a4,
-    0xd3a5,
-    0xd3a6,
-    0xd3a7,
-    0xd3a8,
-    0xd3a9,
-    0xd3aa,
-    0xd3ab,
-    0xd3ac,
-    0xd3ad,
-    0xd3ae,
-    0xd3af,
-    0xd3b0,
-    0xd3b1,
-    0xd3b2,
-    0xd3b3,
-    0xd3b4,
-    0xd3b5,
-    0xd3b6,
-    0xd3b7,
-    0xd3b8,
-    0xd3b9,
-    0xd3ba,
-    0xd3bb,
-    0xd3bc,
-    0xd3bd,
-    0xd3be,
-    0xd3bf,
-    0xd480,
-    0xd481,
-    0xd482,
-    0xd483,
-    0xd484,
-    0xd485,
-    0xd486,
-    0xd487,
-    0xd488,
-    0xd489,
-    0xd48a,
-    0xd48b,
-    0xd48c,
-    0xd48d,
-    0xd48e,
-    0xd48f,
-    0xd490,
-    0xd491,
-    0xd492,
-    0xd493,
-    0xd494,
-    0xd495,
-    0xd496,
-    0xd497,
-    0xd498,
-    0xd499,
-    0xd49a,
-    0xd49b,
-    0xd49c,
-    0xd49d,
-    0xd49e,
-    0xd49f,
-    0xd4a0,
-    0xd4a1,
-    0xd4a2,
-    0xd4a3,
-    0xd4a4,
-    0xd4a5,
-    0xd4a6,
-    0xd4a7,
-    0xd4a8,
-    0xd4a9,
-    0xd4aa,
-    0xd4ab,
-    0xd4ac,
-    0xd4ad,
-    0xd4ae,
-    0xd4af,
-    0xd4b0,
-    0xd4b1,
-    0xd4b2,
-    0xd4b3,
-    0xd4b4,
-    0xd4b5,
-    0xd4b6,
-    0xd4b7,
-    0xd4b8,
-    0xd4b9,
-    0xd4ba,
-    0xd4bb,
-    0xd4bc,
-    0xd4bd,
-    0xd4be,
-    0xd4bf,
-    0xd580,
-    0xd581,
-    0xd582,
-    0xd583,
-    0xd584,
-    0xd585,
-    0xd586,
-    0xd587,
-    0xd588,
-    0xd589,
-    0xd58a,
-    0xd58b,
-    0xd58c,
-    0xd58d,
-    0xd58e,
-    0xd58f,
-    0xd590,
-    0xd591,
-    0xd592,
-    0xd593,
-    0xd594,
-    0xd595,
-    0xd596,
-    0xd597,
-    0xd598,
-    0xd599,
-    0xd59a,
-    0xd59b,
-    0xd59c,
-    0xd59d,
-    0xd59e,
-    0xd59f,
-    0xd5a0,
-    0xd5a1,
-    0xd5a2,
-    0xd5a3,
-    0xd5a4,
-    0xd5a5,
-    0xd5a6,
-    0xd5a7,
-    0xd5a8,
-    0xd5a9,
-    0xd5aa,
-    0xd5ab,
-    0xd5ac,
-    0xd5ad,
-    0xd5ae,
-    0xd5af,
-    0xd5b0,
-    0xd5b1,
-    0xd5b2,
-    0xd5b3,
-    0xd5b4,
-    0xd5b5,
-    0xd5b6,
-    0xd5b7,
-    0xd5b8,
-    0xd5b9,
-    0xd5ba,
-    0xd5bb,
-    0xd5bc,
-    0xd5bd,
-    0xd5be,
-    0xd5bf,
-    0xd680,
-    0xd681,
-    0xd682,
-    0xd683,
-    0xd684,
-    0xd685,
-    0xd686,
-    0xd687,
-    0xd688,
-    0xd689,
-    0xd68a,
-    0xd68b,
-    0xd68c,
-    0xd68d,
-    0xd68e,
-    0xd68f,
-    0xd690,
-    0xd691,
-    0xd692,
-    0xd693,
-    0xd694,
-    0xd695,
-    0xd696,
-    0xd697,
-    0xd698,
-    0xd699,
-    0xd69a,
-    0xd69b,
-    0xd69c,
-    0xd69d,
-    0xd69e,
-    0xd69f,
-    0xd6a0,
-    0xd6a1,
-    0xd6a2,
-    0xd6a3,
-    0xd6a4,
-    0xd6a5,
-    0xd6a6,
-    0xd6a7,
-    0xd6a8,
-    0xd6a9,
-    0xd6aa,
-    0xd6ab,
-    0xd6ac,
-    0xd6ad,
-    0xd6ae,
-    0xd6af,
-    0xd6b0,
-    0xd6b1,
-    0xd6b2,
-    0xd6b3,
-    0xd6b4,
-    0xd6b5,
-    0xd6b6,
-    0xd6b7,
-    0xd6b8,
-    0xd6b9,
-    0xd6ba,
-    0xd6bb,
-    0xd6bc,
-    0xd6bd,
-    0xd6be,
-    0xd6bf,
-    0xd780,
-    0xd781,
-    0xd782,
-    0xd783,
-    0xd784,
-    0xd785,
-    0xd786,
-    0xd787,
-    0xd788,
-    0xd789,
-    0xd78a,
-    0xd78b,
-    0xd78c,
-    0xd78d,
-    0xd78e,
-    0xd78f,
-    0xd790,
-    0xd791,
-    0xd792,
-    0xd793,
-    0xd794,
-    0xd795,
-    0xd796,
-    0xd797,
-    0xd798,
-    0xd799,
-    0xd79a,
-    0xd79b,
-    0xd79c,
-    0xd79d,
-    0xd79e,
-    0xd79f,
-    0xd7a0,
-    0xd7a1,
-    0xd7a2,
-    0xd7a3,
-    0xd7a4,
-    0xd7a5,
-    0xd7a6,
-    0xd7a7,
-    0xd7a8,
-    0xd7a9,
-    0xd7aa,
-    0xd7ab,
-    0xd7ac,
-    0xd7ad,
-    0xd7ae,
-    0xd7af,
-    0xd7b0,
-    0xd7b1,
-    0xd7b2,
-    0xd7b3,
-    0xd7b4,
-    0xd7b5,
-    0xd7b6,
-    0xd7b7,
-    0xd7b8,
-    0xd7b9,
-    0xd7ba,
-    0xd7bb,
-    0xd7bc,
-    0xd7bd,
-    0xd7be,
-    0xd7bf,
-    0xd880,
-    0xd881,
-    0xd882,
-    0xd883,
-    0xd884,
-    0xd885,
-    0xd886,
-    0xd887,
-    0xd888,
-    0xd889,
-    0xd88a,
-    0xd88b,
-    0xd88c,
-    0xd88d,
-    0xd88e,
-    0xd88f,
-    0xd890,
-    0xd891,
-    0xd892,
-    0xd893,
-    0xd894,
-    0xd895,
-    0xd896,
-    0xd897,
-    0xd898,
-    0xd899,
-    0xd89a,
-    0xd89b,
-    0xd89c,
-    0xd89d,
-    0xd89e,
-    0xd89f,
-    0xd8a0,
-    0xd8a1,
-    0xd8a2,
-    0xd8a3,
-    0xd8a4,
-    0xd8a5,
-    0xd8a6,
-    0xd8a7,
-    0xd8a8,
-    0xd8a9,
-    0xd8aa,
-    0xd8ab,
-    0xd8ac,
-    0xd8ad,
-    0xd8ae,
-    0xd8af,
-    0xd8b0,
-    0xd8b1,
-    0xd8b2,
-    0xd8b3,
-    0xd8b4,
-    0xd8b5,
-    0xd8b6,
-    0xd8b7,
-    0xd8b8,
-    0xd8b9,
-    0xd8ba,
-    0xd8bb,
-    0xd8bc,
-    0xd8bd,
-    0xd8be,
-    0xd8bf,
-    0xd980,
-    0xd981,
-    0xd982,
-    0xd983,
-    0xd984,
-    0xd985,
-    0xd986,
-    0xd987,
-    0xd988,
-    0xd989,
-    0xd98a,
-    0xd98b,
-    0xd98c,
-    0xd98d,
-    0xd98e,
-    0xd98f,
-    0xd990,
-    0xd991,
-    0xd992,
-    0xd993,
-    0xd994,
-    0xd995,
-    0xd996,
-    0xd997,
-    0xd998,
-    0xd999,
-    0xd99a,
-    0xd99b,
-    0xd99c,
-    0xd99d,
-    0xd99e,
-    0xd99f,
-    0xd9a0,
-    0xd9a1,
-    0xd9a2,
-    0xd9a3,
-    0xd9a4,
-    0xd9a5,
-    0xd9a6,
-    0xd9a7,
-    0xd9a8,
-    0xd9a9,
-    0xd9aa,
-    0xd9ab,
-    0xd9ac,
-    0xd9ad,
-    0xd9ae,
-    0xd9af,
-    0xd9b0,
-    0xd9b1,
-    0xd9b2,
-    0xd9b3,
-    0xd9b4,
-    0xd9b5,
-    0xd9b6,
-    0xd9b7,
-    0xd9b8,
-    0xd9b9,
-    0xd9ba,
-    0xd9bb,
-    0xd9bc,
-    0xd9bd,
-    0xd9be,
-    0xd9bf,
-    0xda80,
-    0xda81,
-    0xda82,
-    0xda83,
-    0xda84,
-    0xda85,
-    0xda86,
-    0xda87,
-    0xda88,
-    0xda89,
-    0xda8a,
-    0xda8b,
-    0xda8c,
-    0xda8d,
-    0xda8e,
-    0xda8f,
-    0xda90,
-    0xda91,
-    0xda92,
-    0xda93,
-    0xda94,
-    0xda95,
-    0xda96,
-    0xda97,
-    0xda98,
-    0xda99,
-    0xda9a,
-    0xda9b,
-    0xda9c,
-    0xda9d,
-    0xda9e,
-    0xda9f,
-    0xdaa0,
-    0xdaa1,
-    0xdaa2,
-    0xdaa3,
-    0xdaa4,
-    0xdaa5,
-    0xdaa6,
-    0xdaa7,
-    0xdaa8,
-    0xdaa9,
-    0xdaaa,
-    0xdaab,
-    0xdaac,
-    0xdaad,
-    0xdaae,
-    0xdaaf,
-    0xdab0,
-    0xdab1,
-    0xdab2,
-    0xdab3,
-    0xdab4,
-    0xdab5,
-    0xdab6,
-    0xdab7,
-    0xdab8,
-    0xdab9,
-    0xdaba,
-    0xdabb,
-    0xdabc,
-    0xdabd,
-    0xdabe,
-    0xdabf,
-    0xdb80,
-    0xdb81,
-    0xdb82,
-    0xdb83,
-    0xdb84,
-    0xdb85,
-    0xdb86,
-    0xdb87,
-    0xdb88,
-    0xdb89,
-    0xdb8a,
-    0xdb8b,
-    0xdb8c,
-    0xdb8d,
-    0xdb8e,
-    0xdb8f,
-    0xdb90,
-    0xdb91,
-    0xdb92,
-    0xdb93,
-    0xdb94,
-    0xdb95,
-    0xdb96,
-    0xdb97,
-    0xdb98,
-    0xdb99,
-    0xdb9a,
-    0xdb9b,
-    0xdb9c,
-    0xdb9d,
-    0xdb9e,
-    0xdb9f,
-    0xdba0,
-    0xdba1,
-    0xdba2,
-    0xdba3,
-    0xdba4,
-    0xdba5,
-    0xdba6,
-    0xdba7,
-    0xdba8,
-    0xdba9,
-    0xdbaa,
-    0xdbab,
-    0xdbac,
-    0xdbad,
-    0xdbae,
-    0xdbaf,
-    0xdbb0,
-    0xdbb1,
-    0xdbb2,
-    0xdbb3,
-    0xdbb4,
-    0xdbb5,
-    0xdbb6,
-    0xdbb7,
-    0xdbb8,
-    0xdbb9,
-    0xdbba,
-    0xdbbb,
-    0xdbbc,
-    0xdbbd,
-    0xdbbe,
-    0xdbbf,
-    0xdc80,
-    0xdc81,
-    0xdc82,
-    0xdc83,
-    0xdc84,
-    0xdc85,
-    0xdc86,
-    0xdc87,
-    0xdc88,
-    0xdc89,
-    0xdc8a,
-    0xdc8b,
-    0xdc8c,
-    0xdc8d,
-    0xdc8e,
-    0xdc8f,
-    0xdc90,
-    0xdc91,
-    0xdc92,
-    0xdc93,
-    0xdc94,
-    0xdc95,
-    0xdc96,
-    0xdc97,
-    0xdc98,
-    0xdc99,
-    0xdc9a,
-    0xdc9b,
-    0xdc9c,
-    0xdc9d,
-    0xdc9e,
-    0xdc9f,
-    0xdca0,
-    0xdca1,
-    0xdca2,
-    0xdca3,
-    0xdca4,
-    0xdca5,
-    0xdca6,
-    0xdca7,
-    0xdca8,
-    0xdca9,
-    0xdcaa,
-    0xdcab,
-    0xdcac,
-    0xdcad,
-    0xdcae,
-    0xdcaf,
-    0xdcb0,
-    0xdcb1,
-    0xdcb2,
-    0xdcb3,
-    0xdcb4,
-    0xdcb5,
-    0xdcb6,
-    0xdcb7,
-    0xdcb8,
-    0xdcb9,
-    0xdcba,
-    0xdcbb,
-    0xdcbc,
-    0xdcbd,
-    0xdcbe,
-    0xdcbf,
-    0xdd80,
-    0xdd81,
-    0xdd82,
-    0xdd83,
-    0xdd84,
-    0xdd85,
-    0xdd86,
-    0xdd87,
-    0xdd88,
-    0xdd89,
-    0xdd8a,
-    0xdd8b,
-    0xdd8c,
-    0xdd8d,
-    0xdd8e,
-    0xdd8f,
-    0xdd90,
-    0xdd91,
-    0xdd92,
-    0xdd93,
-    0xdd94,
-    0xdd95,
-    0xdd96,
-    0xdd97,
-    0xdd98,
-    0xdd99,
-    0xdd9a,
-    0xdd9b,
-    0xdd9c,
-    0xdd9d,
-    0xdd9e,
-    0xdd9f,
-    0xdda0,
-    0xdda1,
-    0xdda2,
-    0xdda3,
-    0xdda4,
-    0xdda5,
-    0xdda6,
-    0xdda7,
-    0xdda8,
-    0xdda9,
-    0xddaa,
-    0xddab,
-    0xddac,
-    0xddad,
-    0xddae,
-    0xddaf,
-    0xddb0,
-    0xddb1,
-    0xddb2,
-    0xddb3,
-    0xddb4,
-    0xddb5,
-    0xddb6,
-    0xddb7,
-    0xddb8,
-    0xddb9,
-    0xddba,
-    0xddbb,
-    0xddbc,
-    0xddbd,
-    0xddbe,
-    0xddbf,
-    0xde80,
-    0xde81,
-    0xde82,
-    0xde83,
-    0xde84,
-    0xde85,
-    0xde86,
-    0xde87,
-    0xde88,
-    0xde89,
-    0xde8a,
-    0xde8b,
-    0xde8c,
-    0xde8d,
-    0xde8e,
-    0xde8f,
-    0xde90,
-    0xde91,
-    0xde92,
-    0xde93,
-    0xde94,
-    0xde95,
-    0xde96,
-    0xde97,
-    0xde98,
-    0xde99,
-    0xde9a,
-    0xde9b,
-    0xde9c,
-    0xde9d,
-    0xde9e,
-    0xde9f,
-    0xdea0,
-    0xdea1,
-    0xdea2,
-    0xdea3,
-    0xdea4,
-    0xdea5,
-    0xdea6,
-    0xdea7,
-    0xdea8,
-    0xdea9,
-    0xdeaa,
-    0xdeab,
-    0xdeac,
-    0xdead,
-    0xdeae,
-    0xdeaf,
-    0xdeb0,
-    0xdeb1,
-    0xdeb2,
-    0xdeb3,
-    0xdeb4,
-    0xdeb5,
-    0xdeb6,
-    0xdeb7,
-    0xdeb8,
-    0xdeb9,
-    0xdeba,
-    0xdebb,
-    0xdebc,
-    0xdebd,
-    0xdebe,
-    0xdebf,
-    0xdf80,
-    0xdf81,
-    0xdf82,
-    0xdf83,
-    0xdf84,
-    0xdf85,
-    0xdf86,
-    0xdf87,
-    0xdf88,
-    0xdf89,
-    0xdf8a,
-    0xdf8b,
-    0xdf8c,
-    0xdf8d,
-    0xdf8e,
-    0xdf8f,
-    0xdf90,
-    0xdf91,
-    0xdf92,
-    0xdf93,
-    0xdf94,
-    0xdf95,
-    0xdf96,
-    0xdf97,
-    0xdf98,
-    0xdf99,
-    0xdf9a,
-    0xdf9b,
-    0xdf9c,
-    0xdf9d,
-    0xdf9e,
-    0xdf9f,
-    0xdfa0,
-    0xdfa1,
-    0xdfa2,
-    0xdfa3,
-    0xdfa4,
-    0xdfa5,
-    0xdfa6,
-    0xdfa7,
-    0xdfa8,
-    0xdfa9,
-    0xdfaa,
-    0xdfab,
-    0xdfac,
-    0xdfad,
-    0xdfae,
-    0xdfaf,
-    0xdfb0,
-    0xdfb1,
-    0xdfb2,
-    0xdfb3,
-    0xdfb4,
-    0xdfb5,
-    0xdfb6,
-    0xdfb7,
-    0xdfb8,
-    0xdfb9,
-    0xdfba,
-    0xdfbb,
-    0xdfbc,
-    0xdfbd,
-    0xdfbe,
-    0xdfbf,
-    0xe0a080,
-    0xe0a081,
-    0xe0a082,
-    0xe0a083,
-    0xe0a084,
-    0xe0a085,
-    0xe0a086,
-    0xe0a087,
-    0xe0a088,
-    0xe0a089,
-    0xe0a08a,
-    0xe0a08b,
-    0xe0a08c,
-    0xe0a08d,
-    0xe0a08e,
-    0xe0a08f,
-    0xe0a090,
-    0xe0a091,
-    0xe0a092,
-    0xe0a093,
-    0xe0a094,
-    0xe0a095,
-    0xe0a096,
-    0xe0a097,
-    0xe0a098,
-    0xe0a099,
-    0xe0a09a,
-    0xe0a09b,
-    0xe0a09c,
-    0xe0a09d,
-    0xe0a09e,
-    0xe0a09f,
-    0xe0a0a0,
-    0xe0a0a1,
-    0xe0a0a2,
-    0xe0a0a3,
-    0xe0a0a4,
-    0xe0a0a5,
-    0xe0a0a6,
-    0xe0a0a7,
-    0xe0a0a8,
-    0xe0a0a9,
-    0xe0a0aa,
-    0xe0a0ab,
-    0xe0a0ac,
-    0xe0a0ad,
-    0xe0a0ae,
-    0xe0a0af,
-    0xe0a0b0,
-    0xe0a0b1,
-    0xe0a0b2,
-    0xe0a0b3,
-    0xe0a0b4,
-    0xe0a0b5,
-    0xe0a0b6,
-    0xe0a0b7,
-    0xe0a0b8,
-    0xe0a0b9,
-    0xe0a0ba,
-    0xe0a0bb,
-    0xe0a0bc,
-    0xe0a0bd,
-    0xe0a0be,
-    0xe0a0bf,
-    0xe0a180,
-    0xe0a181,
-    0xe0a182,
-    0xe0a183,
-    0xe0a184,
-    0xe0a185,
-    0xe0a186,
-    0xe0a187,
-    0xe0a188,
-    0xe0a189,
-    0xe0a18a,
-    0xe0a18b,
-    0xe0a18c,
-    0xe0a18d,
-    0xe0a18e,
-    0xe0a18f,
-    0xe0a190,
-    0xe0a191,
-    0xe0a192,
-    0xe0a193,
-    0xe0a194,
-    0xe0a195,
-    0xe0a196,
-    0xe0a197,
-    0xe0a198,
-    0xe0a199,
-    0xe0a19a,
-    0xe0a19b,
-    0xe0a19c,
-    0xe0a19d,
-    0xe0a19e,
-    0xe0a19f,
-    0xe0a1a0,
-    0xe0a1a1,
-    0xe0a1a2,
-    0xe0a1a3,
-    0xe0a1a4,
-    0xe0a1a5,
-    0xe0a1a6,
-    0xe0a1a7,
-    0xe0a1a8,
-    0xe0a1a9,
-    0xe0a1aa,
-    0xe0a1ab,
-    0xe0a1ac,
-    0xe0a1ad,
-    0xe0a1ae,
-    0xe0a1af,
-    0xe0a1b0,
-    0xe0a1b1,
-    0xe0a1b2,
-    0xe0a1b3,
-    0xe0a1b4,
-    0xe0a1b5,
-    0xe0a1b6,
-    0xe0a1b7,
-    0xe0a1b8,
-    0xe0a1b9,
-    0xe0a1ba,
-    0xe0a1bb,
-    0xe0a1bc,
-    0xe0a1bd,
-    0xe0a1be,
-    0xe0a1bf,
-    0xe0a280,
-    0xe0a281,
-    0xe0a282,
-    0xe0a283,
-    0xe0a284,
-    0xe0a285,
-    0xe0a286,
-    0xe0a287,
-    0xe0a288,
-    0xe0a289,
-    0xe0a28a,
-    0xe0a28b,
-    0xe0a28c,
-    0xe0a28d,
-    0xe0a28e,
-    0xe0a28f,
-    0xe0a290,
-    0xe0a291,
-    0xe0a292,
-    0xe0a293,
-    0xe0a294,
-    0xe0a295,
-    0xe0a296,
-    0xe0a297,
-    0xe0a298,
-    0xe0a299,
-    0xe0a29a,
-    0xe0a29b,
-    0xe0a29c,
-    0xe0a29d,
-    0xe0a29e,
-    0xe0a29f,
-    0xe0a2a0,
-    0xe0a2a1,
-    0xe0a2a2,
-    0xe0a2a3,
-    0xe0a2a4,
-    0xe0a2a5,
-    0xe0a2a6,
-    0xe0a2a7,
-    0xe0a2a8,
-    0xe0a2a9,
-    0xe0a2aa,
-    0xe0a2ab,
-    0xe0a2ac,
-    0xe0a2ad,
-    0xe0a2ae,
-    0xe0a2af,
-    0xe0a2b0,
-    0xe0a2b1,
-    0xe0a2b2,
-    0xe0a2b3,
-    0xe0a2b4,
-    0xe0a2b5,
-    0xe0a2b6,
-    0xe0a2b7,
-    0xe0a2b8,
-    0xe0a2b9,
-    0xe0a2ba,
-    0xe0a2bb,
-    0xe0a2bc,
-    0xe0a2bd,
-    0xe0a2be,
-    0xe0a2bf,
-    0xe0a380,
-    0xe0a381,
-    0xe0a382,
-    0xe0a383,
-    0xe0a384,
-    0xe0a385,
-    0xe0a386,
-    0xe0a387,
-    0xe0a388,
-    0xe0a389,
-    0xe0a38a,
-    0xe0a38b,
-    0xe0a38c,
-    0xe0a38d,
-    0xe0a38e,
-    0xe0a38f,
-    0xe0a390,
-    0xe0a391,
-    0xe0a392,
-    0xe0a393,
-    0xe0a394,
-    0xe0a395,
-    0xe0a396,
-    0xe0a397,
-    0xe0a398,
-    0xe0a399,
-    0xe0a39a,
-    0xe0a39b,
-    0xe0a39c,
-    0xe0a39d,
-    0xe0a39e,
-    0xe0a39f,
-    0xe0a3a0,
-    0xe0a3a1,
-    0xe0a3a2,
-    0xe0a3a3,
-    0xe0a3a4,
-    0xe0a3a5,
-    0xe0a3a6,
-    0xe0a3a7,
-    0xe0a3a8,
-    0xe0a3a9,
-    0xe0a3aa,
-    0xe0a3ab,
-    0xe0a3ac,
-    0xe0a3ad,
-    0xe0a3ae,
-    0xe0a3af,
-    0xe0a3b0,
-    0xe0a3b1,
-    0xe0a3b2,
-    0xe0a3b3,
-    0xe0a3b4,
-    0xe0a3b5,
-    0xe0a3b6,
-    0xe0a3b7,
-    0xe0a3b8,
-    0xe0a3b9,
-    0xe0a3ba,
-    0xe0a3bb,
-    0xe0a3bc,
-    0xe0a3bd,
-    0xe0a3be,
-    0xe0a3bf,
-    0xe0a480,
-    0xe0a481,
-    0xe0a482,
-    0xe0a483,
-    0xe0a484,
-    0xe0a485,
-    0xe0a486,
-    0xe0a487,
-    0xe0a488,
-    0xe0a489,
-    0xe0a48a,
-    0xe0a48b,
-    0xe0a48c,
-    0xe0a48d,
-    0xe0a48e,
-    0xe0a48f,
-    0xe0a490,
-    0xe0a491,
-    0xe0a492,
-    0xe0a493,
-    0xe0a494,
-    0xe0a495,
-    0xe0a496,
-    0xe0a497,
-    0xe0a498,
-    0xe0a499,
-    0xe0a49a,
-    0xe0a49b,
-    0xe0a49c,
-    0xe0a49d,
-    0xe0a49e,
-    0xe0a49f,
-    0xe0a4a0,
-    0xe0a4a1,
-    0xe0a4a2,
-    0xe0a4a3,
-    0xe0a4a4,
-    0xe0a4a5,
-    0xe0a4a6,
-    0xe0a4a7,
-    0xe0a4a8,
-    0xe0a4a9,
-    0xe0a4aa,
-    0xe0a4ab,
-    0xe0a4ac,
-    0xe0a4ad,
-    0xe0a4ae,
-    0xe0a4af,
-    0xe0a4b0,
-    0xe0a4b1,
-    0xe0a4b2,
-    0xe0a4b3,
-    0xe0a4b4,
-    0xe0a4b5,
-    0xe0a4b6,
-    0xe0a4b7,
-    0xe0a4b8,
-    0xe0a4b9,
-    0xe0a4ba,
-    0xe0a4bb,
-    0xe0a4bc,
-    0xe0a4bd,
-    0xe0a4be,
-    0xe0a4bf,
-    0xe0a580,
-    0xe0a581,
-    0xe0a582,
-    0xe0a583,
-    0xe0a584,
-    0xe0a585,
-    0xe0a586,
-    0xe0a587,
-    0xe0a588,
-    0xe0a589,
-    0xe0a58a,
-    0xe0a58b,
-    0xe0a58c,
-    0xe0a58d,
-    0xe0a58e,
-    0xe0a58f,
-    0xe0a590,
-    0xe0a591,
-    0xe0a592,
-    0xe0a593,
-    0xe0a594,
-    0xe0a595,
-    0xe0a596,
-    0xe0a597,
-    0xe0a598,
-    0xe0a599,
-    0xe0a59a,
-    0xe0a59b,
-    0xe0a59c,
-    0xe0a59d,
-    0xe0a59e,
-    0xe0a59f,
-    0xe0a5a0,
-    0xe0a5a1,
-    0xe0a5a2,
-    0xe0a5a3,
-    0xe0a5a4,
-    0xe0a5a5,
-    0xe0a5a6,
-    0xe0a5a7,
-    0xe0a5a8,
-    0xe0a5a9,
-    0xe0a5aa,
-    0xe0a5ab,
-    0xe0a5ac,
-    0xe0a5ad,
-    0xe0a5ae,
-    0xe0a5af,
-    0xe0a5b0,
-    0xe0a5b1,
-    0xe0a5b2,
-    0xe0a5b3,
-    0xe0a5b4,
-    0xe0a5b5,
-    0xe0a5b6,
-    0xe0a5b7,
-    0xe0a5b8,
-    0xe0a5b9,
-    0xe0a5ba,
-    0xe0a5bb,
-    0xe0a5bc,
-    0xe0a5bd,
-    0xe0a5be,
-    0xe0a5bf,
-    0xe0a680,
-    0xe0a681,
-    0xe0a682,
-    0xe0a683,
-    0xe0a684,
-    0xe0a685,
-    0xe0a686,
-    0xe0a687,
-    0xe0a688,
-    0xe0a689,
-    0xe0a68a,
-    0xe0a68b,
-    0xe0a68c,
-    0xe0a68d,
-    0xe0a68e,
-    0xe0a68f,
-    0xe0a690,
-    0xe0a691,
-    0xe0a692,
-    0xe0a693,
-    0xe0a694,
-    0xe0a695,
-    0xe0a696,
-    0xe0a697,
-    0xe0a698,
-    0xe0a699,
-    0xe0a69a,
-    0xe0a69b,
-    0xe0a69c,
-    0xe0a69d,
-    0xe0a69e,
-    0xe0a69f,
-    0xe0a6a0,
-    0xe0a6a1,
-    0xe0a6a2,
-    0xe0a6a3,
-    0xe0a6a4,
-    0xe0a6a5,
-    0xe0a6a6,
-    0xe0a6a7,
-    0xe0a6a8,
-    0xe0a6a9,
-    0xe0a6aa,
-    0xe0a6ab,
-    0xe0a6ac,
-    0xe0a6ad,
-    0xe0a6ae,
-    0xe0a6af,
-    0xe0a6b0,
-    0xe0a6b1,
-    0xe0a6b2,
-    0xe0a6b3,
-    0xe0a6b4,
-    0xe0a6b5,
-    0xe0a6b6,
-    0xe0a6b7,
-    0xe0a6b8,
-    0xe0a6b9,
-    0xe0a6ba,
-    0xe0a6bb,
-    0xe0a6bc,
-    0xe0a6bd,
-    0xe0a6be,
-    0xe0a6bf,
-    0xe0a780,
-    0xe0a781,
-    0xe0a782,
-    0xe0a783,
-    0xe0a784,
-    0xe0a785,
-    0xe0a786,
-    0xe0a787,
-    0xe0a788,
-    0xe0a789,
-    0xe0a78a,
-    0xe0a78b,
-    0xe0a78c,
-    0xe0a78d,
-    0xe0a78e,
-    0xe0a78f,
-    0xe0a790,
-    0xe0a791,
-    0xe0a792,
-    0xe0a793,
-    0xe0a794,
-    0xe0a795,
-    0xe0a796,
-    0xe0a797,
-    0xe0a798,
-    0xe0a799,
-    0xe0a79a,
-    0xe0a79b,
-    0xe0a79c,
-    0xe0a79d,
-    0xe0a79e,
-    0xe0a79f,
-    0xe0a7a0,
-    0xe0a7a1,
-    0xe0a7a2,
-    0xe0a7a3,
-    0xe0a7a4,
-    0xe0a7a5,
-    0xe0a7a6,
-    0xe0a7a7,
-    0xe0a7a8,
-    0xe0a7a9,
-    0xe0a7aa,
-    0xe0a7ab,
-    0xe0a7ac,
-    0xe0a7ad,
-    0xe0a7ae,
-    0xe0a7af,
-    0xe0a7b0,
-    0xe0a7b1,
-    0xe0a7b2,
-    0xe0a7b3,
-    0xe0a7b4,
-    0xe0a7b5,
-    0xe0a7b6,
-    0xe0a7b7,
-    0xe0a7b8,
-    0xe0a7b9,
-    0xe0a7ba,
-    0xe0a7bb,
-    0xe0a7bc,
-    0xe0a7bd,
-    0xe0a7be,
-    0xe0a7bf,
-    0xe0a880,
-    0xe0a881,
-    0xe0a882,
-    0xe0a883,
-    0xe0a884,
-    0xe0a885,
-    0xe0a886,
-    0xe0a887,
-    0xe0a888,
-    0xe0a889,
-    0xe0a88a,
-    0xe0a88b,
-    0xe0a88c,
-    0xe0a88d,
-    0xe0a88e,
-    0xe0a88f,
-    0xe0a890,
-    0xe0a891,
-    0xe0a892,
-    0xe0a893,
-    0xe0a894,
-    0xe0a895,
-    0xe0a896,
-    0xe0a897,
-    0xe0a898,
-    0xe0a899,
-    0xe0a89a,
-    0xe0a89b,
-    0xe0a89c,
-    0xe0a89d,
-    0xe0a89e,
-    0xe0a89f,
-    0xe0a8a0,
-    0xe0a8a1,
-    0xe0a8a2,
-    0xe0a8a3,
-    0xe0a8a4,
-    0xe0a8a5,
-    0xe0a8a6,
-    0xe0a8a7,
-    0xe0a8a8,
-    0xe0a8a9,
-    0xe0a8aa,
-    0xe0a8ab,
-    0xe0a8ac,
-    0xe0a8ad,
-    0xe0a8ae,
-    0xe0a8af,
-    0xe0a8b0,
-    0xe0a8b1,
-    0xe0a8b2,
-    0xe0a8b3,
-    0xe0a8b4,
-    0xe0a8b5,
-    0xe0a8b6,
-    0xe0a8b7,
-    0xe0a8b8,
-    0xe0a8b9,
-    0xe0a8ba,
-    0xe0a8bb,
-    0xe0a8bc,
-    0xe0a8bd,
-    0xe0a8be,
-    0xe0a8bf,
-    0xe0a980,
-    0xe0a981,
-    0xe0a982,
-    0xe0a983,
-    0xe0a984,
-    0xe0a985,
-    0xe0a986,
-    0xe0a987,
-    0xe0a988,
-    0xe0a989,
-    0xe0a98a,
-    0xe0a98b,
-    0xe0a98c,
-    0xe0a98d,
-    0xe0a98e,
-    0xe0a98f,
-    0xe0a990,
-    0xe0a991,
-    0xe0a992,
-    0xe0a993,
-    0xe0a994,
-    0xe0a995,
-    0xe0a996,
-    0xe0a997,
-    0xe0a998,
-    0xe0a999,
-    0xe0a99a,
-    0xe0a99b,
-    0xe0a99c,
-    0xe0a99d,
-    0xe0a99e,
-    0xe0a99f,
-    0xe0a9a0,
-    0xe0a9a1,
-    0xe0a9a2,
-    0xe0a9a3,
-    0xe0a9a4,
-    0xe0a9a5,
-    0xe0a9a6,
-    0xe0a9a7,
-    0xe0a9a8,
-    0xe0a9a9,
-    0xe0a9aa,
-    0xe0a9ab,
-    0xe0a9ac,
-    0xe0a9ad,
-    0xe0a9ae,
-    0xe0a9af,
-    0xe0a9b0,
-    0xe0a9b1,
-    0xe0a9b2,
-    0xe0a9b3,
-    0xe0a9b4,
-    0xe0a9b5,
-    0xe0a9b6,
-    0xe0a9b7,
-    0xe0a9b8,
-    0xe0a9b9,
-    0xe0a9ba,
-    0xe0a9bb,
-    0xe0a9bc,
-    0xe0a9bd,
-    0xe0a9be,
-    0xe0a9bf,
-    0xe0aa80,
-    0xe0aa81,
-    0xe0aa82,
-    0xe0aa83,
-    0xe0aa84,
-    0xe0aa85,
-    0xe0aa86,
-    0xe0aa87,
-    0xe0aa88,
-    0xe0aa89,
-    0xe0aa8a,
-    0xe0aa8b,
-    0xe0aa8c,
-    0xe0aa8d,
-    0xe0aa8e,
-    0xe0aa8f,
-    0xe0aa90,
-    0xe0aa91,
-    0xe0aa92,
-    0xe0aa93,
-    0xe0aa94,
-    0xe0aa95,
-    0xe0aa96,
-    0xe0aa97,
-    0xe0aa98,
-    0xe0aa99,
-    0xe0aa9a,
-    0xe0aa9b,
-    0xe0aa9c,
-    0xe0aa9d,
-    0xe0aa9e,
-    0xe0aa9f,
-    0xe0aaa0,
-    0xe0aaa1,
-    0xe0aaa2,
-    0xe0aaa3,
-    0xe0aaa4,
-    0xe0aaa5,
-    0xe0aaa6,
-    0xe0aaa7,
-    0xe0aaa8,
-    0xe0aaa9,
-    0xe0aaaa,
-    0xe0aaab,
-    0xe0aaac,
-    0xe0aaad,
-    0xe0aaae,
-    0xe0aaaf,
-    0xe0aab0,
-    0xe0aab1,
-    0xe0aab2,
-    0xe0aab3,
-    0xe0aab4,
-    0xe0aab5,
-    0xe0aab6,
-    0xe0aab7,
-    0xe0aab8,
-    0xe0aab9,
-    0xe0aaba,
-    0xe0aabb,
-    0xe0aabc,
-    0xe0aabd,
-    0xe0aabe,
-    0xe0aabf,
-    0xe0ab80,
-    0xe0ab81,
-    0xe0ab82,
-    0xe0ab83,
-    0xe0ab84,
-    0xe0ab85,
-    0xe0ab86,
-    0xe0ab87,
-    0xe0ab88,
-    0xe0ab89,
-    0xe0ab8a,
-    0xe0ab8b,
-    0xe0ab8c,
-    0xe0ab8d,
-    0xe0ab8e,
-    0xe0ab8f,
-    0xe0ab90,
-    0xe0ab91,
-    0xe0ab92,
-    0xe0ab93,
-    0xe0ab94,
-    0xe0ab95,
-    0xe0ab96,
-    0xe0ab97,
-    0xe0ab98,
-    0xe0ab99,
-    0xe0ab9a,
-    0xe0ab9b,
-    0xe0ab9c,
-    0xe0ab9d,
-    0xe0ab9e,
-    0xe0ab9f,
-    0xe0aba0,
-    0xe0aba1,
-    0xe0aba2,
-    0xe0aba3,
-    0xe0aba4,
-    0xe0aba5,
-    0xe0aba6,
-    0xe0aba7,
-    0xe0aba8,
-    0xe0aba9,
-    0xe0abaa,
-    0xe0abab,
-    0xe0abac,
-    0xe0abad,
-    0xe0abae,
-    0xe0abaf,
-    0xe0abb0,
-    0xe0abb1,
-    0xe0abb2,
-    0xe0abb3,
-    0xe0abb4,
-    0xe0abb5,
-    0xe0abb6,
-    0xe0abb7,
-    0xe0abb8,
-    0xe0abb9,
-    0xe0abba,
-    0xe0abbb,
-    0xe0abbc,
-    0xe0abbd,
-    0xe0abbe,
-    0xe0abbf,
-    0xe0ac80,
-    0xe0ac81,
-    0xe0ac82,
-    0xe0ac83,
-    0xe0ac84,
-    0xe0ac85,
-    0xe0ac86,
-    0xe0ac87,
-    0xe0ac88,
-    0xe0ac89,
-    0xe0ac8a,
-    0xe0ac8b,
-    0xe0ac8c,
-    0xe0ac8d,
-    0xe0ac8e,
-    0xe0ac8f,
-    0xe0ac90,
-    0xe0ac91,
-    0xe0ac92,
-    0xe0ac93,
-    0xe0ac94,
-    0xe0ac95,
-    0xe0ac96,
-    0xe0ac97,
-    0xe0ac98,
-    0xe0ac99,
-    0xe0ac9a,
-    0xe0ac9b,
-    0xe0ac9c,
-    0xe0ac9d,
-    0xe0ac9e,
-    0xe0ac9f,
-    0xe0aca0,
-    0xe0aca1,
-    0xe0aca2,
-    0xe0aca3,
-    0xe0aca4,
-    0xe0aca5,
-    0xe0aca6,
-    0xe0aca7,
-    0xe0aca8,
-    0xe0aca9,
-    0xe0acaa,
-    0xe0acab,
-    0xe0acac,
-    0xe0acad,
-    0xe0acae,
-    0xe0acaf,
-    0xe0acb0,
-    0xe0acb1,
-    0xe0acb2,
-    0xe0acb3,
-    0xe0acb4,
-    0xe0acb5,
-    0xe0acb6,
-    0xe0acb7,
-    0xe0acb8,
-    0xe0acb9,
-    0xe0acba,
-    0xe0acbb,
-    0xe0acbc,
-    0xe0acbd,
-    0xe0acbe,
-    0xe0acbf,
-    0xe0ad80,
-    0xe0ad81,
-    0xe0ad82,
-    0xe0ad83,
-    0xe0ad84,
-    0xe0ad85,
-    0xe0ad86,
-    0xe0ad87,
-    0xe0ad88,
-    0xe0ad89,
-    0xe0ad8a,
-    0xe0ad8b,
-    0xe0ad8c,
-    0xe0ad8d,
-    0xe0ad8e,
-    0xe0ad8f,
-    0xe0ad90,
-    0xe0ad91,
-    0xe0ad92,
-    0xe0ad93,
-    0xe0ad94,
-    0xe0ad95,
-    0xe0ad96,
-    0xe0ad97,
-    0xe0ad98,
-    0xe0ad99,
-    0xe0ad9a,
-    0xe0ad9b,
-    0xe0ad9c,
-    0xe0ad9d,
-    0xe0ad9e,
-    0xe0ad9f,
-    0xe0ada0,
-    0xe0ada1,
-    0xe0ada2,
-    0xe0ada3,
-    0xe0ada4,
-    0xe0ada5,
-    0xe0ada6,
-    0xe0ada7,
-    0xe0ada8,
-    0xe0ada9,
-    0xe0adaa,
-    0xe0adab,
-    0xe0adac,
-    0xe0adad,
-    0xe0adae,
-    0xe0adaf,
-    0xe0adb0,
-    0xe0adb1,
-    0xe0adb2,
-    0xe0adb3,
-    0xe0adb4,
-    0xe0adb5,
-    0xe0adb6,
-    0xe0adb7,
-    0xe0adb8,
-    0xe0adb9,
-    0xe0adba,
-    0xe0adbb,
-    0xe0adbc,
-    0xe0adbd,
-    0xe0adbe,
-    0xe0adbf,
-    0xe0ae80,
-    0xe0ae81,
-    0xe0ae82,
-    0xe0ae83,
-    0xe0ae84,
-    0xe0ae85,
-    0xe0ae86,
-    0xe0ae87,
-    0xe0ae88,
-    0xe0ae89,
-    0xe0ae8a,
-    0xe0ae8b,
-    0xe0ae8c,
-    0xe0ae8d,
-    0xe0ae8e,
-    0xe0ae8f,
-    0xe0ae90,
-    0xe0ae91,
-    0xe0ae92,
-    0xe0ae93,
-    0xe0ae94,
-    0xe0ae95,
-    0xe0ae96,
-    0xe0ae97,
-    0xe0ae98,
-    0xe0ae99,
-    0xe0ae9a,
-    0xe0ae9b,
-    0xe0ae9c,
-    0xe0ae9d,
-    0xe0ae9e,
-    0xe0ae9f,
-    0xe0aea0,
-    0xe0aea1,
-    0xe0aea2,
-    0xe0aea3,
-    0xe0aea4,
-    0xe0aea5,
-    0xe0aea6,
-    0xe0aea7,
-    0xe0aea8,
-    0xe0aea9,
-    0xe0aeaa,
-    0xe0aeab,
-    0xe0aeac,
-    0xe0aead,
-    0xe0aeae,
-    0xe0aeaf,
-    0xe0aeb0,
-    0xe0aeb1,
-    0xe0aeb2,
-    0xe0aeb3,
-    0xe0aeb4,
-    0xe0aeb5,
-    0xe0aeb6,
-    0xe0aeb7,
-    0xe0aeb8,
-    0xe0aeb9,
-    0xe0aeba,
-    0xe0aebb,
-    0xe0aebc,
-    0xe0aebd,
-    0xe0aebe,
-    0xe0aebf,
-    0xe0af80,
-    0xe0af81,
-    0xe0af82,
-    0xe0af83,
-    0xe0af84,
-    0xe0af85,
-    0xe0af86,
-    0xe0af87,
-    0xe0af88,
-    0xe0af89,
-    0xe0af8a,
-    0xe0af8b,
-    0xe0af8c,
-    0xe0af8d,
-    0xe0af8e,
-    0xe0af8f,
-    0xe0af90,
-    0xe0af91,
-    0xe0af92,
-    0xe0af93,
-    0xe0af94,
-    0xe0af95,
-    0xe0af96,
-    0xe0af97,
-    0xe0af98,
-    0xe0af99,
-    0xe0af9a,
-    0xe0af9b,
-    0xe0af9c,
-    0xe0af9d,
-    0xe0af9e,
-    0xe0af9f,
-    0xe0afa0,
-    0xe0afa1,
-    0xe0afa2,
-    0xe0afa3,
-    0xe0afa4,
-    0xe0afa5,
-    0xe0afa6,
-    0xe0afa7,
-    0xe0afa8,
-    0xe0afa9,
-    0xe0afaa,
-    0xe0afab,
-    0xe0afac,
-    0xe0afad,
-    0xe0afae,
-    0xe0afaf,
-    0xe0afb0,
-    0xe0afb1,
-    0xe0afb2,
-    0xe0afb3,
-    0xe0afb4,
-    0xe0afb5,
-    0xe0afb6,
-    0xe0afb7,
-    0xe0afb8,
-    0xe0afb9,
-    0xe0afba,
-    0xe0afbb,
-    0xe0afbc,
-    0xe0afbd,
-    0xe0afbe,
-    0xe0afbf,
-    0xe0b080,
-    0xe0b081,
-    0xe0b082,
-    0xe0b083,
-    0xe0b084,
-    0xe0b085,
-    0xe0b086,
-    0xe0b087,
-    0xe0b088,
-    0xe0b089,
-    0xe0b08a,
-    0xe0b08b,
-    0xe0b08c,
-    0xe0b08d,
-    0xe0b08e,
-    0xe0b08f,
-    0xe0b090,
-    0xe0b091,
-    0xe0b092,
-    0xe0b093,
-    0xe0b094,
-    0xe0b095,
-    0xe0b096,
-    0xe0b097,
-    0xe0b098,
-    0xe0b099,
-    0xe0b09a,
-    0xe0b09b,
-    0xe0b09c,
-    0xe0b09d,
-    0xe0b09e,
-    0xe0b09f,
-    0xe0b0a0,
-    0xe0b0a1,
-    0xe0b0a2,
-    0xe0b0a3,
-    0xe0b0a4,
-    0xe0b0a5,
-    0xe0b0a6,
-    0xe0b0a7,
-    0xe0b0a8,
-    0xe0b0a9,
-    0xe0b0aa,
-    0xe0b0ab,
-    0xe0b0ac,
-    0xe0b0ad,
-    0xe0b0ae,
-    0xe0b0af,
-    0xe0b0b0,
-    0xe0b0b1,
-    0xe0b0b2,
-    0xe0b0b3,
-    0xe0b0b4,
-    0xe0b0b5,
-    0xe0b0b6,
-    0xe0b0b7,
-    0xe0b0b8,
-    0xe0b0b9,
-    0xe0b0ba,
-    0xe0b0bb,
-    0xe0b0bc,
-    0xe0b0bd,
-    0xe0b0be,
-    0xe0b0bf,
-    0xe0b180,
-    0xe0b181,
-    0xe0b182,
-    0xe0b183,
-    0xe0b184,
-    0xe0b185,
-    0xe0b186,
-    0xe0b187,
-    0xe0b188,
-    0xe0b189,
-    0xe0b18a,
-    0xe0b18b,
-    0xe0b18c,
-    0xe0b18d,
-    0xe0b18e,
-    0xe0b18f,
-    0xe0b190,
-    0xe0b191,
-    0xe0b192,
-    0xe0b193,
-    0xe0b194,
-    0xe0b195,
-    0xe0b196,
-    0xe0b197,
-    0xe0b198,
-    0xe0b199,
-    0xe0b19a,
-    0xe0b19b,
-    0xe0b19c,
-    0xe0b19d,
-    0xe0b19e,
-    0xe0b19f,
-    0xe0b1a0,
-    0xe0b1a1,
-    0xe0b1a2,
-    0xe0b1a3,
-    0xe0b1a4,
-    0xe0b1a5,
-    0xe0b1a6,
-    0xe0b1a7,
-    0xe0b1a8,
-    0xe0b1a9,
-    0xe0b1aa,
-    0xe0b1ab,
-    0xe0b1ac,
-    0xe0b1ad,
-    0xe0b1ae,
-    0xe0b1af,
-    0xe0b1b0,
-    0xe0b1b1,
-    0xe0b1b2,
-    0xe0b1b3,
-    0xe0b1b4,
-    0xe0b1b5,
-    0xe0b1b6,
-    0xe0b1b7,
-    0xe0b1b8,
-    0xe0b1b9,
-    0xe0b1ba,
-    0xe0b1bb,
-    0xe0b1bc,
-    0xe0b1bd,
-    0xe0b1be,
-    0xe0b1bf,
-    0xe0b280,
-    0xe0b281,
-    0xe0b282,
-    0xe0b283,
-    0xe0b284,
-    0xe0b285,
-    0xe0b286,
-    0xe0b287,
-    0xe0b288,
-    0xe0b289,
-    0xe0b28a,
-    0xe0b28b,
-    0xe0b28c,
-    0xe0b28d,
-    0xe0b28e,
-    0xe0b28f,
-    0xe0b290,
-    0xe0b291,
-    0xe0b292,
-    0xe0b293,
-    0xe0b294,
-    0xe0b295,
-    0xe0b296,
-    0xe0b297,
-    0xe0b298,
-    0xe0b299,
-    0xe0b29a,
-    0xe0b29b,
-    0xe0b29c,
-    0xe0b29d,
-    0xe0b29e,
-    0xe0b29f,
-    0xe0b2a0,
-    0xe0b2a1,
-    0xe0b2a2,
-    0xe0b2a3,
-    0xe0b2a4,
-    0xe0b2a5,
-    0xe0b2a6,
-    0xe0b2a7,
-    0xe0b2a8,
-    0xe0b2a9,
-    0xe0b2aa,
-    0xe0b2ab,
-    0xe0b2ac,
-    0xe0b2ad,
-    0xe0b2ae,
-    0xe0b2af,
-    0xe0b2b0,
-    0xe0b2b1,
-    0xe0b2b2,
-    0xe0b2b3,
-    0xe0b2b4,
-    0xe0b2b5,
-    0xe0b2b6,
-    0xe0b2b7,
-    0xe0b2b8,
-    0xe0b2b9,
-    0xe0b2ba,
-    0xe0b2bb,
-    0xe0b2bc,
-    0xe0b2bd,
-    0xe0b2be,
-    0xe0b2bf,
-    0xe0b380,
-    0xe0b381,
-    0xe0b382,
-    0xe0b383,
-    0xe0b384,
-    0xe0b385,
-    0xe0b386,
-    0xe0b387,
-    0xe0b388,
-    0xe0b389,
-    0xe0b38a,
-    0xe0b38b,
-    0xe0b38c,
-    0xe0b38d,
-    0xe0b38e,
-    0xe0b38f,
-    0xe0b390,
-    0xe0b391,
-    0xe0b392,
-    0xe0b393,
-    0xe0b394,
-    0xe0b395,
-    0xe0b396,
-    0xe0b397,
-    0xe0b398,
-    0xe0b399,
-    0xe0b39a,
-    0xe0b39b,
-    0xe0b39c,
-    0xe0b39d,
-    0xe0b39e,
-    0xe0b39f,
-    0xe0b3a0,
-    0xe0b3a1,
-    0xe0b3a2,
-    0xe0b3a3,
-    0xe0b3a4,
-    0xe0b3a5,
-    0xe0b3a6,
-    0xe0b3a7,
-    0xe0b3a8,
-    0xe0b3a9,
-    0xe0b3aa,
-    0xe0b3ab,
-    0xe0b3ac,
-    0xe0b3ad,
-    0xe0b3ae,
-    0xe0b3af,
-    0xe0b3b0,
-    0xe0b3b1,
-    0xe0b3b2,
-    0xe0b3b3,
-    0xe0b3b4,
-    0xe0b3b5,
-    0xe0b3b6,
-    0xe0b3b7,
-    0xe0b3b8,
-    0xe0b3b9,
-    0xe0b3ba,
-    0xe0b3bb,
-    0xe0b3bc,
-    0xe0b3bd,
-    0xe0b3be,
-    0xe0b3bf,
-    0xe0b480,
-    0xe0b481,
-    0xe0b482,
-    0xe0b483,
-    0xe0b484,
-    0xe0b485,
-    0xe0b486,
-    0xe0b487,
-    0xe0b488,
-    0xe0b489,
-    0xe0b48a,
-    0xe0b48b,
-    0xe0b48c,
-    0xe0b48d,
-    0xe0b48e,
-    0xe0b48f,
-    0xe0b490,
-    0xe0b491,
-    0xe0b492,
-    0xe0b493,
-    0xe0b494,
-    0xe0b495,
-    0xe0b496,
-    0xe0b497,
-    0xe0b498,
-    0xe0b499,
-    0xe0b49a,
-    0xe0b49b,
-    0xe0b49c,
-    0xe0b49d,
-    0xe0b49e,
-    0xe0b49f,
-    0xe0b4a0,
-    0xe0b4a1,
-    0xe0b4a2,
-    0xe0b4a3,
-    0xe0b4a4,
-    0xe0b4a5,
-    0xe0b4a6,
-    0xe0b4a7,
-    0xe0b4a8,
-    0xe0b4a9,
-    0xe0b4aa,
-    0xe0b4ab,
-    0xe0b4ac,
-    0xe0b4ad,
-    0xe0b4ae,
-    0xe0b4af,
-    0xe0b4b0,
-    0xe0b4b1,
-    0xe0b4b2,
-    0xe0b4b3,
-    0xe0b4b4,
-    0xe0b4b5,
-    0xe0b4b6,
-    0xe0b4b7,
-    0xe0b4b8,
-    0xe0b4b9,
-    0xe0b4ba,
-    0xe0b4bb,
-    0xe0b4bc,
-    0xe0b4bd,
-    0xe0b4be,
-    0xe0b4bf,
-    0xe0b580,
-    0xe0b581,
-    0xe0b582,
-    0xe0b583,
-    0xe0b584,
-    0xe0b585,
-    0xe0b586,
-    0xe0b587,
-    0xe0b588,
-    0xe0b589,
-    0xe0b58a,
-    0xe0b58b,
-    0xe0b58c,
-    0xe0b58d,
-    0xe0b58e,
-    0xe0b58f,
-    0xe0b590,
-    0xe0b591,
-    0xe0b592,
-    0xe0b593,
-    0xe0b594,
-    0xe0b595,
-    0xe0b596,
-    0xe0b597,
-    0xe0b598,
-    0xe0b599,
-    0xe0b59a,
-    0xe0b59b,
-    0xe0b59c,
-    0xe0b59d,
-    0xe0b59e,
-    0xe0b59f,
-    0xe0b5a0,
-    0xe0b5a1,
-    0xe0b5a2,
-    0xe0b5a3,
-    0xe0b5a4,
-    0xe0b5a5,
-    0xe0b5a6,
-    0xe0b5a7,
-    0xe0b5a8,
-    0xe0b5a9,
-    0xe0b5aa,
-    0xe0b5ab,
-    0xe0b5ac,
-    0xe0b5ad,
-    0xe0b5ae,
-    0xe0b5af,
-    0xe0b5b0,
-    0xe0b5b1,
-    0xe0b5b2,
-    0xe0b5b3,
-    0xe0b5b4,
-    0xe0b5b5,
-    0xe0b5b6,
-    0xe0b5b7,
-    0xe0b5b8,
-    0xe0b5b9,
-    0xe0b5ba,
-    0xe0b5bb,
-    0xe0b5bc,
-    0xe0b5bd,
-    0xe0b5be,
-    0xe0b5bf,
-    0xe0b680,
-    0xe0b681,
-    0xe0b682,
-    0xe0b683,
-    0xe0b684,
-    0xe0b685,
-    0xe0b686,
-    0xe0b687,
-    0xe0b688,
-    0xe0b689,
-    0xe0b68a,
-    0xe0b68b,
-    0xe0b68c,
-    0xe0b68d,
-    0xe0b68e,
-    0xe0b68f,
-    0xe0b690,
-    0xe0b691,
-    0xe0b692,
-    0xe0b693,
-    0xe0b694,
-    0xe0b695,
-    0xe0b696,
-    0xe0b697,
-    0xe0b698,
-    0xe0b699,
-    0xe0b69a,
-    0xe0b69b,
-    0xe0b69c,
-    0xe0b69d,
-    0xe0b69e,
-    0xe0b69f,
-    0xe0b6a0,
-    0xe0b6a1,
-    0xe0b6a2,
-    0xe0b6a3,
-    0xe0b6a4,
-    0xe0b6a5,
-    0xe0b6a6,
-    0xe0b6a7,
-    0xe0b6a8,
-    0xe0b6a9,
-    0xe0b6aa,
-    0xe0b6ab,
-    0xe0b6ac,
-    0xe0b6ad,
-    0xe0b6ae,
-    0xe0b6af,
-    0xe0b6b0,
-    0xe0b6b1,
-    0xe0b6b2,
-    0xe0b6b3,
-    0xe0b6b4,
-    0xe0b6b5,
-    0xe0b6b6,
-    0xe0b6b7,
-    0xe0b6b8,
-    0xe0b6b9,
-    0xe0b6ba,
-    0xe0b6bb,
-    0xe0b6bc,
-    0xe0b6bd,
-    0xe0b6be,
-    0xe0b6bf,
-    0xe0b780,
-    0xe0b781,
-    0xe0b782,
-    0xe0b783,
-    0xe0b784,
-    0xe0b785,
-    0xe0b786,
-    0xe0b787,
-    0xe0b788,
-    0xe0b789,
-    0xe0b78a,
-    0xe0b78b,
-    0xe0b78c,
-    0xe0b78d,
-    0xe0b78e,
-    0xe0b78f,
-    0xe0b790,
-    0xe0b791,
-    0xe0b792,
-    0xe0b793,
-    0xe0b794,
-    0xe0b795,
-    0xe0b796,
-    0xe0b797,
-    0xe0b798,
-    0xe0b799,
-    0xe0b79a,
-    0xe0b79b,
-    0xe0b79c,
-    0xe0b79d,
-    0xe0b79e,
-    0xe0b79f,
-    0xe0b7a0,
-    0xe0b7a1,
-    0xe0b7a2,
-    0xe0b7a3,
-    0xe0b7a4,
-    0xe0b7a5,
-    0xe0b7a6,
-    0xe0b7a7,
-    0xe0b7a8,
-    0xe0b7a9,
-    0xe0b7aa,
-    0xe0b7ab,
-    0xe0b7ac,
-    0xe0b7ad,
-    0xe0b7ae,
-    0xe0b7af,
-    0xe0b7b0,
-    0xe0b7b1,
-    0xe0b7b2,
-    0xe0b7b3,
-    0xe0b7b4,
-    0xe0b7b5,
-    0xe0b7b6,
-    0xe0b7b7,
-    0xe0b7b8,
-    0xe0b7b9,
-    0xe0b7ba,
-    0xe0b7bb,
-    0xe0b7bc,
-    0xe0b7bd,
-    0xe0b7be,
-    0xe0b7bf,
-    0xe0b880,
-    0xe0b881,
-    0xe0b882,
-    0xe0b883,
-    0xe0b884,
-    0xe0b885,
-    0xe0b886,
-    0xe0b887,
-    0xe0b888,
-    0xe0b889,
-    0xe0b88a,
-    0xe0b88b,
-    0xe0b88c,
-    0xe0b88d,
-    0xe0b88e,
-    0xe0b88f,
-    0xe0b890,
-    0xe0b891,
-    0xe0b892,
-    0xe0b893,
-    0xe0b894,
-    0xe0b895,
-    0xe0b896,
-    0xe0b897,
-    0xe0b898,
-    0xe0b899,
-    0xe0b89a,
-    0xe0b89b,
-    0xe0b89c,
-    0xe0b89d,
-    0xe0b89e,
-    0xe0b89f,
-    0xe0b8a0,
-    0xe0b8a1,
-    0xe0b8a2,
-    0xe0b8a3,
-    0xe0b8a4,
-    0xe0b8a5,
-    0xe0b8a6,
-    0xe0b8a7,
-    0xe0b8a8,
-    0xe0b8a9,
-    0xe0b8aa,
-    0xe0b8ab,
-    0xe0b8ac,
-    0xe0b8ad,
-    0xe0b8ae,
-    0xe0b8af,
-    0xe0b8b0,
-    0xe0b8b1,
-    0xe0b8b2,
-    0xe0b8b3,
-    0xe0b8b4,
-    0xe0b8b5,
-    0xe0b8b6,
-    0xe0b8b7,
-    0xe0b8b8,
-    0xe0b8b9,
-    0xe0b8ba,
-    0xe0b8bb,
-    0xe0b8bc,
-    0xe0b8bd,
-    0xe0b8be,
-    0xe0b8bf,
-    0xe0b980,
-    0xe0b981,
-    0xe0b982,
-    0xe0b983,
-    0xe0b984,
-    0xe0b985,
-    0xe0b986,
-    0xe0b987,
-    0xe0b988,
-    0xe0b989,
-    0xe0b98a,
-    0xe0b98b,
-    0xe0b98c,
-    0xe0b98d,
-    0xe0b98e,
-    0xe0b98f,
-    0xe0b990,
-    0xe0b991,
-    0xe0b992,
-    0xe0b993,
-    0xe0b994,
-    0xe0b995,
-    0xe0b996,
-    0xe0b997,
-    0xe0b998,
-    0xe0b999,
-    0xe0b99a,
-    0xe0b99b,
-    0xe0b99c,
-    0xe0b99d,
-    0xe0b99e,
-    0xe0b99f,
-    0xe0b9a0,
-    0xe0b9a1,
-    0xe0b9a2,
-    0xe0b9a3,
-    0xe0b9a4,
-    0xe0b9a5,
-    0xe0b9a6,
-    0xe0b9a7,
-    0xe0b9a8,
-    0xe0b9a9,
-    0xe0b9aa,
-    0xe0b9ab,
-    0xe0b9ac,
-    0xe0b9ad,
-    0xe0b9ae,
-    0xe0b9af,
-    0xe0b9b0,
-    0xe0b9b1,
-    0xe0b9b2,
-    0xe0b9b3,
-    0xe0b9b4,
-    0xe0b9b5,
-    0xe0b9b6,
-    0xe0b9b7,
-    0xe0b9b8,
-    0xe0b9b9,
-    0xe0b9ba,
-    0xe0b9bb,
-    0xe0b9bc,
-    0xe0b9bd,
-    0xe0b9be,
-    0xe0b9bf,
-    0xe0ba80,
-    0xe0ba81,
-    0xe0ba82,
-    0xe0ba83,
-    0xe0ba84,
-    0xe0ba85,
-    0xe0ba86,
-    0xe0ba87,
-    0xe0ba88,
-    0xe0ba89,
-    0xe0ba8a,
-    0xe0ba8b,
-    0xe0ba8c,
-    0xe0ba8d,
-    0xe0ba8e,
-    0xe0ba8f,
-    0xe0ba90,
-    0xe0ba91,
-    0xe0ba92,
-    0xe0ba93,
-    0xe0ba94,
-    0xe0ba95,
-    0xe0ba96,
-    0xe0ba97,
-    0xe0ba98,
-    0xe0ba99,
-    0xe0ba9a,
-    0xe0ba9b,
-    0xe0ba9c,
-    0xe0ba9d,
-    0xe0ba9e,
-    0xe0ba9f,
-    0xe0baa0,
-    0xe0baa1,
-    0xe0baa2,
-    0xe0baa3,
-    0xe0baa4,
-    0xe0baa5,
-    0xe0baa6,
-    0xe0baa7,
-    0xe0baa8,
-    0xe0baa9,
-    0xe0baaa,
-    0xe0baab,
-    0xe0baac,
-    0xe0baad,
-    0xe0baae,
-    0xe0baaf,
-    0xe0bab0,
-    0xe0bab1,
-    0xe0bab2,
-    0xe0bab3,
-    0xe0bab4,
-    0xe0bab5,
-    0xe0bab6,
-    0xe0bab7,
-    0xe0bab8,
-    0xe0bab9,
-    0xe0baba,
-    0xe0babb,
-    0xe0babc,
-    0xe0babd,
-    0xe0babe,
-    0xe0babf,
-    0xe0bb80,
-    0xe0bb81,
-    0xe0bb82,
-    0xe0bb83,
-    0xe0bb84,
-    0xe0bb85,
-    0xe0bb86,
-    0xe0bb87,
-    0xe0bb88,
-    0xe0bb89,
-    0xe0bb8a,
-    0xe0bb8b,
-    0xe0bb8c,
-    0xe0bb8d,
-    0xe0bb8e,
-    0xe0bb8f,
-    0xe0bb90,
-    0xe0bb91,
-    0xe0bb92,
-    0xe0bb93,
-    0xe0bb94,
-    0xe0bb95,
-    0xe0bb96,
-    0xe0bb97,
-    0xe0bb98,
-    0xe0bb99,
-    0xe0bb9a,
-    0xe0bb9b,
-    0xe0bb9c,
-    0xe0bb9d,
-    0xe0bb9e,
-    0xe0bb9f,
-    0xe0bba0,
-    0xe0bba1,
-    0xe0bba2,
-    0xe0bba3,
-    0xe0bba4,
-    0xe0bba5,
-    0xe0bba6,
-    0xe0bba7,
-    0xe0bba8,
-    0xe0bba9,
-    0xe0bbaa,
-    0xe0bbab,
-    0xe0bbac,
-    0xe0bbad,
-    0xe0bbae,
-    0xe0bbaf,
-    0xe0bbb0,
-    0xe0bbb1,
-    0xe0bbb2,
-    0xe0bbb3,
-    0xe0bbb4,
-    0xe0bbb5,
-    0xe0bbb6,
-    0xe0bbb7,
-    0xe0bbb8,
-    0xe0bbb9,
-    0xe0bbba,
-    0xe0bbbb,
-    0xe0bbbc,
-    0xe0bbbd,
-    0xe0bbbe,
-    0xe0bbbf,
-    0xe0bc80,
-    0xe0bc81,
-    0xe0bc82,
-    0xe0bc83,
-    0xe0bc84,
-    0xe0bc85,
-    0xe0bc86,
-    0xe0bc87,
-    0xe0bc88,
-    0xe0bc89,
-    0xe0bc8a,
-    0xe0bc8b,
-    0xe0bc8c,
-    0xe0bc8d,
-    0xe0bc8e,
-    0xe0bc8f,
-    0xe0bc90,
-    0xe0bc91,
-    0xe0bc92,
-    0xe0bc93,
-    0xe0bc94,
-    0xe0bc95,
-    0xe0bc96,
-    0xe0bc97,
-    0xe0bc98,
-    0xe0bc99,
-    0xe0bc9a,
-    0xe0bc9b,
-    0xe0bc9c,
-    0xe0bc9d,
-    0xe0bc9e,
-    0xe0bc9f,
-    0xe0bca0,
-    0xe0bca1,
-    0xe0bca2,
-    0xe0bca3,
-    0xe0bca4,
-    0xe0bca5,
-    0xe0bca6,
-    0xe0bca7,
-    0xe0bca8,
-    0xe0bca9,
-    0xe0bcaa,
-    0xe0bcab,
-    0xe0bcac,
-    0xe0bcad,
-    0xe0bcae,
-    0xe0bcaf,
-    0xe0bcb0,
-    0xe0bcb1,
-    0xe0bcb2,
-    0xe0bcb3,
-    0xe0bcb4,
-    0xe0bcb5,
-    0xe0bcb6,
-    0xe0bcb7,
-    0xe0bcb8,
-    0xe0bcb9,
-    0xe0bcba,
-    0xe0bcbb,
-    0xe0bcbc,
-    0xe0bcbd,
-    0xe0bcbe,
-    0xe0bcbf,
-    0xe0bd80,
-    0xe0bd81,
-    0xe0bd82,
-    0xe0bd83,
-    0xe0bd84,
-    0xe0bd85,
-    0xe0bd86,
-    0xe0bd87,
-    0xe0bd88,
-    0xe0bd89,
-    0xe0bd8a,
-    0xe0bd8b,
-    0xe0bd8c,
-    0xe0bd8d,
-    0xe0bd8e,
-    0xe0bd8f,
-    0xe0bd90,
-    0xe0bd91,
-    0xe0bd92,
-    0xe0bd93,
-    0xe0bd94,
-    0xe0bd95,
-    0xe0bd96,
-    0xe0bd97,
-    0xe0bd98,
-    0xe0bd99,
-    0xe0bd9a,
-    0xe0bd9b,
-    0xe0bd9c,
-    0xe0bd9d,
-    0xe0bd9e,
-    0xe0bd9f,
-    0xe0bda0,
-    0xe0bda1,
-    0xe0bda2,
-    0xe0bda3,
-    0xe0bda4,
-    0xe0bda5,
-    0xe0bda6,
-    0xe0bda7,
-    0xe0bda8,
-    0xe0bda9,
-    0xe0bdaa,
-    0xe0bdab,
-    0xe0bdac,
-    0xe0bdad,
-    0xe0bdae,
-    0xe0bdaf,
-    0xe0bdb0,
-    0xe0bdb1,
-    0xe0bdb2,
-    0xe0bdb3,
-    0xe0bdb4,
-    0xe0bdb5,
-    0xe0bdb6,
-    0xe0bdb7,
-    0xe0bdb8,
-    0xe0bdb9,
-    0xe0bdba,
-    0xe0bdbb,
-    0xe0bdbc,
-    0xe0bdbd,
-    0xe0bdbe,
-    0xe0bdbf,
-    0xe0be80,
-    0xe0be81,
-    0xe0be82,
-    0xe0be83,
-    0xe0be84,
-    0xe0be85,
-    0xe0be86,
-    0xe0be87,
-    0xe0be88,
-    0xe0be89,
-    0xe0be8a,
-    0xe0be8b,
-    0xe0be8c,
-    0xe0be8d,
-    0xe0be8e,
-    0xe0be8f,
-    0xe0be90,
-    0xe0be91,
-    0xe0be92,
-    0xe0be93,
-    0xe0be94,
-    0xe0be95,
-    0xe0be96,
-    0xe0be97,
-    0xe0be98,
-    0xe0be99,
-    0xe0be9a,
-    0xe0be9b,
-    0xe0be9c,
-    0xe0be9d,
-    0xe0be9e,
-    0xe0be9f,
-    0xe0bea0,
-    0xe0bea1,
-    0xe0bea2,
-    0xe0bea3,
-    0xe0bea4,
-    0xe0bea5,
-    0xe0bea6,
-    0xe0bea7,
-    0xe0bea8,
-    0xe0bea9,
-    0xe0beaa,
-    0xe0beab,
-    0xe0beac,
-    0xe0bead,
-    0xe0beae,
-    0xe0beaf,
-    0xe0beb0,
-    0xe0beb1,
-    0xe0beb2,
-    0xe0beb3,
-    0xe0beb4,
-    0xe0beb5,
-    0xe0beb6,
-    0xe0beb7,
-    0xe0beb8,
-    0xe0beb9,
-    0xe0beba,
-    0xe0bebb,
-    0xe0bebc,
-    0xe0bebd,
-    0xe0bebe,
-    0xe0bebf,
-    0xe0bf80,
-    0xe0bf81,
-    0xe0bf82,
-    0xe0bf83,
-    0xe0bf84,
-    0xe0bf85,
-    0xe0bf86,
-    0xe0bf87,
-    0xe0bf88,
-    0xe0bf89,
-    0xe0bf8a,
-    0xe0bf8b,
-    0xe0bf8c,
-    0xe0bf8d,
-    0xe0bf8e,
-    0xe0bf8f,
-    0xe0bf90,
-    0xe0bf91,
-    0xe0bf92,
-    0xe0bf93,
-    0xe0bf94,
-    0xe0bf95,
-    0xe0bf96,
-    0xe0bf97,
-    0xe0bf98,
-    0xe0bf99,
-    0xe0bf9a,
-    0xe0bf9b,
-    0xe0bf9c,
-    0xe0bf9d,
-    0xe0bf9e,
-    0xe0bf9f,
-    0xe0bfa0,
-    0xe0bfa1,
-    0xe0bfa2,
-    0xe0bfa3,
-    0xe0bfa4,
-    0xe0bfa5,
-    0xe0bfa6,
-    0xe0bfa7,
-    0xe0bfa8,
-    0xe0bfa9,
-    0xe0bfaa,
-    0xe0bfab,
-    0xe0bfac,
-    0xe0bfad,
-    0xe0bfae,
-    0xe0bfaf,
-    0xe0bfb0,
-    0xe0bfb1,
-    0xe0bfb2,
-    0xe0bfb3,
-    0xe0bfb4,
-    0xe0bfb5,
-    0xe0bfb6,
-    0xe0bfb7,
-    0xe0bfb8,
-    0xe0bfb9,
-    0xe0bfba,
-    0xe0bfbb,
-    0xe0bfbc,
-    0xe0bfbd,
-    0xe0bfbe,
-    0xe0bfbf,
-    0xe18080,
-    0xe18081,
-    0xe18082,
-    0xe18083,
-    0xe18084,
-    0xe18085,
-    0xe18086,
-    0xe18087,
-    0xe18088,
-    0xe18089,
-    0xe1808a,
-    0xe1808b,
-    0xe1808c,
-    0xe1808d,
-    0xe1808e,
-    0xe1808f,
-    0xe18090,
-    0xe18091,
-    0xe18092,
-    0xe18093,
-    0xe18094,
-    0xe18095,
-    0xe18096,
-    0xe18097,
-    0xe18098,
-    0xe18099,
-    0xe1809a,
-    0xe1809b,
-    0xe1809c,
-    0xe1809d,
-    0xe1809e,
-    0xe1809f,
-    0xe180a0,
-    0xe180a1,
-    0xe180a2,
-    0xe180a3,
-    0xe180a4,
-    0xe180a5,
-    0xe180a6,
-    0xe180a7,
-    0xe180a8,
-    0xe180a9,
-    0xe180aa,
-    0xe180ab,
-    0xe180ac,
-    0xe180ad,
-    0xe180ae,
-    0xe180af,
-    0xe180b0,
-    0xe180b1,
-    0xe180b2,
-    0xe180b3,
-    0xe180b4,
-    0xe180b5,
-    0xe180b6,
-    0xe180b7,
-    0xe180b8,
-    0xe180b9,
-    0xe180ba,
-    0xe180bb,
-    0xe180bc,
-    0xe180bd,
-    0xe180be,
-    0xe180bf,
-    0xe18180,
-    0xe18181,
-    0xe18182,
-    0xe18183,
-    0xe18184,
-    0xe18185,
-    0xe18186,
-    0xe18187,
-    0xe18188,
-    0xe18189,
-    0xe1818a,
-    0xe1818b,
-    0xe1818c,
-    0xe1818d,
-    0xe1818e,
-    0xe1818f,
-    0xe18190,
-    0xe18191,
-    0xe18192,
-    0xe18193,
-    0xe18194,
-    0xe18195,
-    0xe18196,
-    0xe18197,
-    0xe18198,
-    0xe18199,
-    0xe1819a,
-    0xe1819b,
-    0xe1819c,
-    0xe1819d,
-    0xe1819e,
-    0xe1819f,
-    0xe181a0,
-    0xe181a1,
-    0xe181a2,
-    0xe181a3,
-    0xe181a4,
-    0xe181a5,
-    0xe181a6,
-    0xe181a7,
-    0xe181a8,
-    0xe181a9,
-    0xe181aa,
-    0xe181ab,
-    0xe181ac,
-    0xe181ad,
-    0xe181ae,
-    0xe181af,
-    0xe181b0,
-    0xe181b1,
-    0xe181b2,
-    0xe181b3,
-    0xe181b4,
-    0xe181b5,
-    0xe181b6,
-    0xe181b7,
-    0xe181b8,
-    0xe181b9,
-    0xe181ba,
-    0xe181bb,
-    0xe181bc,
-    0xe181bd,
-    0xe181be,
-    0xe181bf,
-    0xe18280,
-    0xe18281,
-    0xe18282,
-    0xe18283,
-    0xe18284,
-    0xe18285,
-    0xe18286,
-    0xe18287,
-    0xe18288,
-    0xe18289,
-    0xe1828a,
-    0xe1828b,
-    0xe1828c,
-    0xe1828d,
-    0xe1828e,
-    0xe1828f,
-    0xe18290,
-    0xe18291,
-    0xe18292,
-    0xe18293,
-    0xe18294,
-    0xe18295,
-    0xe18296,
-    0xe18297,
-    0xe18298,
-    0xe18299,
-    0xe1829a,
-    0xe1829b,
-    0xe1829c,
-    0xe1829d,
-    0xe1829e,
-    0xe1829f,
-    0xe182a0,
-    0xe182a1,
-    0xe182a2,
-    0xe182a3,
-    0xe182a4,
-    0xe182a5,
-    0xe182a6,
-    0xe182a7,
-    0xe182a8,
-    0xe182a9,
-    0xe182aa,
-    0xe182ab,
-    0xe182ac,
-    0xe182ad,
-    0xe182ae,
-    0xe182af,
-    0xe182b0,
-    0xe182b1,
-    0xe182b2,
-    0xe182b3,
-    0xe182b4,
-    0xe182b5,
-    0xe182b6,
-    0xe182b7,
-    0xe182b8,
-    0xe182b9,
-    0xe182ba,
-    0xe182bb,
-    0xe182bc,
-    0xe182bd,
-    0xe182be,
-    0xe182bf,
-    0xe18380,
-    0xe18381,
-    0xe18382,
-    0xe18383,
-    0xe18384,
-    0xe18385,
-    0xe18386,
-    0xe18387,
-    0xe18388,
-    0xe18389,
-    0xe1838a,
-    0xe1838b,
-    0xe1838c,
-    0xe1838d,
-    0xe1838e,
-    0xe1838f,
-    0xe18390,
-    0xe18391,
-    0xe18392,
-    0xe18393,
-    0xe18394,
-    0xe18395,
-    0xe18396,
-    0xe18397,
-    0xe18398,
-    0xe18399,
-    0xe1839a,
-    0xe1839b,
-    0xe1839c,
-    0xe1839d,
-    0xe1839e,
-    0xe1839f,
-    0xe183a0,
-    0xe183a1,
-    0xe183a2,
-    0xe183a3,
-    0xe183a4,
-    0xe183a5,
-    0xe183a6,
-    0xe183a7,
-    0xe183a8,
-    0xe183a9,
-    0xe183aa,
-    0xe183ab,
-    0xe183ac,
-    0xe183ad,
-    0xe183ae,
-    0xe183af,
-    0xe183b0,
-    0xe183b1,
-    0xe183b2,
-    0xe183b3,
-    0xe183b4,
-    0xe183b5,
-    0xe183b6,
-    0xe183b7,
-    0xe183b8,
-    0xe183b9,
-    0xe183ba,
-    0xe183bb,
-    0xe183bc,
-    0xe183bd,
-    0xe183be,
-    0xe183bf,
-    0xe18480,
-    0xe18481,
-    0xe18482,
-    0xe18483,
-    0xe18484,
-    0xe18485,
-    0xe18486,
-    0xe18487,
-    0xe18488,
-    0xe18489,
-    0xe1848a,
-    0xe1848b,
-    0xe1848c,
-    0xe1848d,
-    0xe1848e,
-    0xe1848f,
-    0xe18490,
-    0xe18491,
-    0xe18492,
-    0xe18493,
-    0xe18494,
-    0xe18495,
-    0xe18496,
-    0xe18497,
-    0xe18498,
-    0xe18499,
-    0xe1849a,
-    0xe1849b,
-    0xe1849c,
-    0xe1849d,
-    0xe1849e,
-    0xe1849f,
-    0xe184a0,
-    0xe184a1,
-    0xe184a2,
-    0xe184a3,
-    0xe184a4,
-    0xe184a5,
-    0xe184a6,
-    0xe184a7,
-    0xe184a8,
-    0xe184a9,
-    0xe184aa,
-    0xe184ab,
-    0xe184ac,
-    0xe184ad,
-    0xe184ae,
-    0xe184af,
-    0xe184b0,
-    0xe184b1,
-    0xe184b2,
-    0xe184b3,
-    0xe184b4,
-    0xe184b5,
-    0xe184b6,
-    0xe184b7,
-    0xe184b8,
-    0xe184b9,
-    0xe184ba,
-    0xe184bb,
-    0xe184bc,
-    0xe184bd,
-    0xe184be,
-    0xe184bf,
-    0xe18580,
-    0xe18581,
-    0xe18582,
-    0xe18583,
-    0xe18584,
-    0xe18585,
-    0xe18586,
-    0xe18587,
-    0xe18588,
-    0xe18589,
-    0xe1858a,
-    0xe1858b,
-    0xe1858c,
-    0xe1858d,
-    0xe1858e,
-    0xe1858f,
-    0xe18590,
-    0xe18591,
-    0xe18592,
-    0xe18593,
-    0xe18594,
-    0xe18595,
-    0xe18596,
-    0xe18597,
-    0xe18598,
-    0xe18599,
-    0xe1859a,
-    0xe1859b,
-    0xe1859c,
-    0xe1859d,
-    0xe1859e,
-    0xe1859f,
-    0xe185a0,
-    0xe185a1,
-    0xe185a2,
-    0xe185a3,
-    0xe185a4,
-    0xe185a5,
-    0xe185a6,
-    0xe185a7,
-    0xe185a8,
-    0xe185a9,
-    0xe185aa,
-    0xe185ab,
-    0xe185ac,
-    0xe185ad,
-    0xe185ae,
-    0xe185af,
-    0xe185b0,
-    0xe185b1,
-    0xe185b2,
-    0xe185b3,
-    0xe185b4,
-    0xe185b5,
-    0xe185b6,
-    0xe185b7,
-    0xe185b8,
-    0xe185b9,
-    0xe185ba,
-    0xe185bb,
-    0xe185bc,
-    0xe185bd,
-    0xe185be,
-    0xe185bf,
-    0xe18680,
-    0xe18681,
-    0xe18682,
-    0xe18683,
-    0xe18684,
-    0xe18685,
-    0xe18686,
-    0xe18687,
-    0xe18688,
-    0xe18689,
-    0xe1868a,
-    0xe1868b,
-    0xe1868c,
-    0xe1868d,
-    0xe1868e,
-    0xe1868f,
-    0xe18690,
-    0xe18691,
-    0xe18692,
-    0xe18693,
-    0xe18694,
-    0xe18695,
-    0xe18696,
-    0xe18697,
-    0xe18698,
-    0xe18699,
-    0xe1869a,
-    0xe1869b,
-    0xe1869c,
-    0xe1869d,
-    0xe1869e,
-    0xe1869f,
-    0xe186a0,
-    0xe186a1,
-    0xe186a2,
-    0xe186a3,
-    0xe186a4,
-    0xe186a5,
-    0xe186a6,
-    0xe186a7,
-    0xe186a8,
-    0xe186a9,
-    0xe186aa,
-    0xe186ab,
-    0xe186ac,
-    0xe186ad,
-    0xe186ae,
-    0xe186af,
-    0xe186b0,
-    0xe186b1,
-    0xe186b2,
-    0xe186b3,
-    0xe186b4,
-    0xe186b5,
-    0xe186b6,
-    0xe186b7,
-    0xe186b8,
-    0xe186b9,
-    0xe186ba,
-    0xe186bb,
-    0xe186bc,
-    0xe186bd,
-    0xe186be,
-    0xe186bf,
-    0xe18780,
-    0xe18781,
-    0xe18782,
-    0xe18783,
-    0xe18784,
-    0xe18785,
-    0xe18786,
-    0xe18787,
-    0xe18788,
-    0xe18789,
-    0xe1878a,
-    0xe1878b,
-    0xe1878c,
-    0xe1878d,
-    0xe1878e,
-    0xe1878f,
-    0xe18790,
-    0xe18791,
-    0xe18792,
-    0xe18793,
-    0xe18794,
-    0xe18795,
-    0xe18796,
-    0xe18797,
-    0xe18798,
-    0xe18799,
-    0xe1879a,
-    0xe1879b,
-    0xe1879c,
-    0xe1879d,
-    0xe1879e,
-    0xe1879f,
-    0xe187a0,
-    0xe187a1,
-    0xe187a2,
-    0xe187a3,
-    0xe187a4,
-    0xe187a5,
-    0xe187a6,
-    0xe187a7,
-    0xe187a8,
-    0xe187a9,
-    0xe187aa,
-    0xe187ab,
-    0xe187ac,
-    0xe187ad,
-    0xe187ae,
-    0xe187af,
-    0xe187b0,
-    0xe187b1,
-    0xe187b2,
-    0xe187b3,
-    0xe187b4,
-    0xe187b5,
-    0xe187b6,
-    0xe187b7,
-    0xe187b8,
-    0xe187b9,
-    0xe187ba,
-    0xe187bb,
-    0xe187bc,
-    0xe187bd,
-    0xe187be,
-    0xe187bf,
-    0xe18880,
-    0xe18881,
-    0xe18882,
-    0xe18883,
-    0xe18884,
-    0xe18885,
-    0xe18886,
-    0xe18887,
-    0xe18888,
-    0xe18889,
-    0xe1888a,
-    0xe1888b,
-    0xe1888c,
-    0xe1888d,
-    0xe1888e,
-    0xe1888f,
-    0xe18890,
-    0xe18891,
-    0xe18892,
-    0xe18893,
-    0xe18894,
-    0xe18895,
-    0xe18896,
-    0xe18897,
-    0xe18898,
-    0xe18899,
-    0xe1889a,
-    0xe1889b,
-    0xe1889c,
-    0xe1889d,
-    0xe1889e,
-    0xe1889f,
-    0xe188a0,
-    0xe188a1,
-    0xe188a2,
-    0xe188a3,
-    0xe188a4,
-    0xe188a5,
-    0xe188a6,
-    0xe188a7,
-    0xe188a8,
-    0xe188a9,
-    0xe188aa,
-    0xe188ab,
-    0xe188ac,
-    0xe188ad,
-    0xe188ae,
-    0xe188af,
-    0xe188b0,
-    0xe188b1,
-    0xe188b2,
-    0xe188b3,
-    0xe188b4,
-    0xe188b5,
-    0xe188b6,
-    0xe188b7,
-    0xe188b8,
-    0xe188b9,
-    0xe188ba,
-    0xe188bb,
-    0xe188bc,
-    0xe188bd,
-    0xe188be,
-    0xe188bf,
-    0xe18980,
-    0xe18981,
-    0xe18982,
-    0xe18983,
-    0xe18984,
-    0xe18985,
-    0xe18986,
-    0xe18987,
-    0xe18988,
-    0xe18989,
-    0xe1898a,
-    0xe1898b,
-    0xe1898c,
-    0xe1898d,
-    0xe1898e,
-    0xe1898f,
-    0xe18990,
-    0xe18991,
-    0xe18992,
-    0xe18993,
-    0xe18994,
-    0xe18995,
-    0xe18996,
-    0xe18997,
-    0xe18998,
-    0xe18999,
-    0xe1899a,
-    0xe1899b,
-    0xe1899c,
-    0xe1899d,
-    0xe1899e,
-    0xe1899f,
-    0xe189a0,
-    0xe189a1,
-    0xe189a2,
-    0xe189a3,
-    0xe189a4,
-    0xe189a5,
-    0xe189a6,
-    0xe189a7,
-    0xe189a8,
-    0xe189a9,
-    0xe189aa,
-    0xe189ab,
-    0xe189ac,
-    0xe189ad,
-    0xe189ae,
-    0xe189af,
-    0xe189b0,
-    0xe189b1,
-    0xe189b2,
-    0xe189b3,
-    0xe189b4,
-    0xe189b5,
-    0xe189b6,
-    0xe189b7,
-    0xe189b8,
-    0xe189b9,
-    0xe189ba,
-    0xe189bb,
-    0xe189bc,
-    0xe189bd,
-    0xe189be,
-    0xe189bf,
-    0xe18a80,
-    0xe18a81,
-    0xe18a82,
-    0xe18a83,
-    0xe18a84,
-    0xe18a85,
-    0xe18a86,
-    0xe18a87,
-    0xe18a88,
-    0xe18a89,
-    0xe18a8a,
-    0xe18a8b,
-    0xe18a8c,
-    0xe18a8d,
-    0xe18a8e,
-    0xe18a8f,
-    0xe18a90,
-    0xe18a91,
-    0xe18a92,
-    0xe18a93,
-    0xe18a94,
-    0xe18a95,
-    0xe18a96,
-    0xe18a97,
-    0xe18a98,
-    0xe18a99,
-    0xe18a9a,
-    0xe18a9b,
-    0xe18a9c,
-    0xe18a9d,
-    0xe18a9e,
-    0xe18a9f,
-    0xe18aa0,
-    0xe18aa1,
-    0xe18aa2,
-    0xe18aa3,
-    0xe18aa4,
-    0xe18aa5,
-    0xe18aa6,
-    0xe18aa7,
-    0xe18aa8,
-    0xe18aa9,
-    0xe18aaa,
-    0xe18aab,
-    0xe18aac,
-    0xe18aad,
-    0xe18aae,
-    0xe18aaf,
-    0xe18ab0,
-    0xe18ab1,
-    0xe18ab2,
-    0xe18ab3,
-    0xe18ab4,
-    0xe18ab5,
-    0xe18ab6,
-    0xe18ab7,
-    0xe18ab8,
-    0xe18ab9,
-    0xe18aba,
-    0xe18abb,
-    0xe18abc,
-    0xe18abd,
-    0xe18abe,
-    0xe18abf,
-    0xe18b80,
-    0xe18b81,
-    0xe18b82,
-    0xe18b83,
-    0xe18b84,
-    0xe18b85,
-    0xe18b86,
-    0xe18b87,
-    0xe18b88,
-    0xe18b89,
-    0xe18b8a,
-    0xe18b8b,
-    0xe18b8c,
-    0xe18b8d,
-    0xe18b8e,
-    0xe18b8f,
-    0xe18b90,
-    0xe18b91,
-    0xe18b92,
-    0xe18b93,
-    0xe18b94,
-    0xe18b95,
-    0xe18b96,
-    0xe18b97,
-    0xe18b98,
-    0xe18b99,
-    0xe18b9a,
-    0xe18b9b,
-    0xe18b9c,
-    0xe18b9d,
-    0xe18b9e,
-    0xe18b9f,
-    0xe18ba0,
-    0xe18ba1,
-    0xe18ba2,
-    0xe18ba3,
-    0xe18ba4,
-    0xe18ba5,
-    0xe18ba6,
-    0xe18ba7,
-    0xe18ba8,
-    0xe18ba9,
-    0xe18baa,
-    0xe18bab,
-    0xe18bac,
-    0xe18bad,
-    0xe18bae,
-    0xe18baf,
-    0xe18bb0,
-    0xe18bb1,
-    0xe18bb2,
-    0xe18bb3,
-    0xe18bb4,
-    0xe18bb5,
-    0xe18bb6,
-    0xe18bb7,
-    0xe18bb8,
-    0xe18bb9,
-    0xe18bba,
-    0xe18bbb,
-    0xe18bbc,
-    0xe18bbd,
-    0xe18bbe,
-    0xe18bbf,
-    0xe18c80,
-    0xe18c81,
-    0xe18c82,
-    0xe18c83,
-    0xe18c84,
-    0xe18c85,
-    0xe18c86,
-    0xe18c87,
-    0xe18c88,
-    0xe18c89,
-    0xe18c8a,
-    0xe18c8b,
-    0xe18c8c,
-    0xe18c8d,
-    0xe18c8e,
-    0xe18c8f,
-    0xe18c90,
-    0xe18c91,
-    0xe18c92,
-    0xe18c93,
-    0xe18c94,
-    0xe18c95,
-    0xe18c96,
-    0xe18c97,
-    0xe18c98,
-    0xe18c99,
-    0xe18c9a,
-    0xe18c9b,
-    0xe18c9c,
-    0xe18c9d,
-    0xe18c9e,
-    0xe18c9f,
-    0xe18ca0,
-    0xe18ca1,
-    0xe18ca2,
-    0xe18ca3,
-    0xe18ca4,
-    0xe18ca5,
-    0xe18ca6,
-    0xe18ca7,
-    0xe18ca8,
-    0xe18ca9,
-    0xe18caa,
-    0xe18cab,
-    0xe18cac,
-    0xe18cad,
-    0xe18cae,
-    0xe18caf,
-    0xe18cb0,
-    0xe18cb1,
-    0xe18cb2,
-    0xe18cb3,
-    0xe18cb4,
-    0xe18cb5,
-    0xe18cb6,
-    0xe18cb7,
-    0xe18cb8,
-    0xe18cb9,
-    0xe18cba,
-    0xe18cbb,
-    0xe18cbc,
-    0xe18cbd,
-    0xe18cbe,
-    0xe18cbf,
-    0xe18d80,
-    0xe18d81,
-    0xe18d82,
-    0xe18d83,
-    0xe18d84,
-    0xe18d85,
-    0xe18d86,
-    0xe18d87,
-    0xe18d88,
-    0xe18d89,
-    0xe18d8a,
-    0xe18d8b,
-    0xe18d8c,
-    0xe18d8d,
-    0xe18d8e,
-    0xe18d8f,
-    0xe18d90,
-    0xe18d91,
-    0xe18d92,
-    0xe18d93,
-    0xe18d94,
-    0xe18d95,
-    0xe18d96,
-    0xe18d97,
-    0xe18d98,
-    0xe18d99,
-    0xe18d9a,
-    0xe18d9b,
-    0xe18d9c,
-    0xe18d9d,
-    0xe18d9e,
-    0xe18d9f,
-    0xe18da0,
-    0xe18da1,
-    0xe18da2,
-    0xe18da3,
-    0xe18da4,
-    0xe18da5,
-    0xe18da6,
-    0xe18da7,
-    0xe18da8,
-    0xe18da9,
-    0xe18daa,
-    0xe18dab,
-    0xe18dac,
-    0xe18dad,
-    0xe18dae,
-    0xe18daf,
-    0xe18db0,
-    0xe18db1,
-    0xe18db2,
-    0xe18db3,
-    0xe18db4,
-    0xe18db5,
-    0xe18db6,
-    0xe18db7,
-    0xe18db8,
-    0xe18db9,
-    0xe18dba,
-    0xe18dbb,
-    0xe18dbc,
-    0xe18dbd,
-    0xe18dbe,
-    0xe18dbf,
-    0xe18e80,
-    0xe18e81,
-    0xe18e82,
-    0xe18e83,
-    0xe18e84,
-    0xe18e85,
-    0xe18e86,
-    0xe18e87,
-    0xe18e88,
-    0xe18e89,
-    0xe18e8a,
-    0xe18e8b,
-    0xe18e8c,
-    0xe18e8d,
-    0xe18e8e,
-    0xe18e8f,
-    0xe18e90,
-    0xe18e91,
-    0xe18e92,
-    0xe18e93,
-    0xe18e94,
-    0xe18e95,
-    0xe18e96,
-    0xe18e97,
-    0xe18e98,
-    0xe18e99,
-    0xe18e9a,
-    0xe18e9b,
-    0xe18e9c,
-    0xe18e9d,
-    0xe18e9e,
-    0xe18e9f,
-    0xe18ea0,
-    0xe18ea1,
-    0xe18ea2,
-    0xe18ea3,
-    0xe18ea4,
-    0xe18ea5,
-    0xe18ea6,
-    0xe18ea7,
-    0xe18ea8,
-    0xe18ea9,
-    0xe18eaa,
-    0xe18eab,
-    0xe18eac,
-    0xe18ead,
-    0xe18eae,
-    0xe18eaf,
-    0xe18eb0,
-    0xe18eb1,
-    0xe18eb2,
-    0xe18eb3,
-    0xe18eb4,
-    0xe18eb5,
-    0xe18eb6,
-    0xe18eb7,
-    0xe18eb8,
-    0xe18eb9,
-    0xe18eba,
-    0xe18ebb,
-    0xe18ebc,
-    0xe18ebd,
-    0xe18ebe,
-    0xe18ebf,
-    0xe18f80,
-    0xe18f81,
-    0xe18f82,
-    0xe18f83,
-    0xe18f84,
-    0xe18f85,
-    0xe18f86,
-    0xe18f87,
-    0xe18f88,
-    0xe18f89,
-    0xe18f8a,
-    0xe18f8b,
-    0xe18f8c,
-    0xe18f8d,
-    0xe18f8e,
-    0xe18f8f,
-    0xe18f90,
-    0xe18f91,
-    0xe18f92,
-    0xe18f93,
-    0xe18f94,
-    0xe18f95,
-    0xe18f96,
-    0xe18f97,
-    0xe18f98,
-    0xe18f99,
-    0xe18f9a,
-    0xe18f9b,
-    0xe18f9c,
-    0xe18f9d,
-    0xe18f9e,
-    0xe18f9f,
-    0xe18fa0,
-    0xe18fa1,
-    0xe18fa2,
-    0xe18fa3,
-    0xe18fa4,
-    0xe18fa5,
-    0xe18fa6,
-    0xe18fa7,
-    0xe18fa8,
-    0xe18fa9,
-    0xe18faa,
-    0xe18fab,
-    0xe18fac,
-    0xe18fad,
-    0xe18fae,
-    0xe18faf,
-    0xe18fb0,
-    0xe18fb1,
-    0xe18fb2,
-    0xe18fb3,
-    0xe18fb4,
-    0xe18fb5,
-    0xe18fb6,
-    0xe18fb7,
-    0xe18fb8,
-    0xe18fb9,
-    0xe18fba,
-    0xe18fbb,
-    0xe18fbc,
-    0xe18fbd,
-    0xe18fbe,
-    0xe18fbf,
-    0xe19080,
-    0xe19081,
-    0xe19082,
-    0xe19083,
-    0xe19084,
-    0xe19085,
-    0xe19086,
-    0xe19087,
-    0xe19088,
-    0xe19089,
-    0xe1908a,
-    0xe1908b,
-    0xe1908c,
-    0xe1908d,
-    0xe1908e,
-    0xe1908f,
-    0xe19090,
-    0xe19091,
-    0xe19092,
-    0xe19093,
-    0xe19094,
-    0xe19095,
-    0xe19096,
-    0xe19097,
-    0xe19098,
-    0xe19099,
-    0xe1909a,
-    0xe1909b,
-    0xe1909c,
-    0xe1909d,
-    0xe1909e,
-    0xe1909f,
-    0xe190a0,
-    0xe190a1,
-    0xe190a2,
-    0xe190a3,
-    0xe190a4,
-    0xe190a5,
-    0xe190a6,
-    0xe190a7,
-    0xe190a8,
-    0xe190a9,
-    0xe190aa,
-    0xe190ab,
-    0xe190ac,
-    0xe190ad,
-    0xe190ae,
-    0xe190af,
-    0xe190b0,
-    0xe190b1,
-    0xe190b2,
-    0xe190b3,
-    0xe190b4,
-    0xe190b5,
-    0xe190b6,
-    0xe190b7,
-    0xe190b8,
-    0xe190b9,
-    0xe190ba,
-    0xe190bb,
-    0xe190bc,
-    0xe190bd,
-    0xe190be,
-    0xe190bf,
-    0xe19180,
-    0xe19181,
-    0xe19182,
-    0xe19183,
-    0xe19184,
-    0xe19185,
-    0xe19186,
-    0xe19187,
-    0xe19188,
-    0xe19189,
-    0xe1918a,
-    0xe1918b,
-    0xe1918c,
-    0xe1918d,
-    0xe1918e,
-    0xe1918f,
-    0xe19190,
-    0xe19191,
-    0xe19192,
-    0xe19193,
-    0xe19194,
-    0xe19195,
-    0xe19196,
-    0xe19197,
-    0xe19198,
-    0xe19199,
-    0xe1919a,
-    0xe1919b,
-    0xe1919c,
-    0xe1919d,
-    0xe1919e,
-    0xe1919f,
-    0xe191a0,
-    0xe191a1,
-    0xe191a2,
-    0xe191a3,
-    0xe191a4,
-    0xe191a5,
-    0xe191a6,
-    0xe191a7,
-    0xe191a8,
-    0xe191a9,
-    0xe191aa,
-    0xe191ab,
-    0xe191ac,
-    0xe191ad,
-    0xe191ae,
-    0xe191af,
-    0xe191b0,
-    0xe191b1,
-    0xe191b2,
-    0xe191b3,
-    0xe191b4,
-    0xe191b5,
-    0xe191b6,
-    0xe191b7,
-    0xe191b8,
-    0xe191b9,
-    0xe191ba,
-    0xe191bb,
-    0xe191bc,
-    0xe191bd,
-    0xe191be,
-    0xe191bf,
-    0xe19280,
-    0xe19281,
-    0xe19282,
-    0xe19283,
-    0xe19284,
-    0xe19285,
-    0xe19286,
-    0xe19287,
-    0xe19288,
-    0xe19289,
-    0xe1928a,
-    0xe1928b,
-    0xe1928c,
-    0xe1928d,
-    0xe1928e,
-    0xe1928f,
-    0xe19290,
-    0xe19291,
-    0xe19292,
-    0xe19293,
-    0xe19294,
-    0xe19295,
-    0xe19296,
-    0xe19297,
-    0xe19298,
-    0xe19299,
-    0xe1929a,
-    0xe1929b,
-    0xe1929c,
-    0xe1929d,
-    0xe1929e,
-    0xe1929f,
-    0xe192a0,
-    0xe192a1,
-    0xe192a2,
-    0xe192a3,
-    0xe192a4,
-    0xe192a5,
-    0xe192a6,
-    0xe192a7,
-    0xe192a8,
-    0xe192a9,
-    0xe192aa,
-    0xe192ab,
-    0xe192ac,
-    0xe192ad,
-    0xe192ae,
-    0xe192af,
-    0xe192b0,
-    0xe192b1,
-    0xe192b2,
-    0xe192b3,
-    0xe192b4,
-    0xe192b5,
-    0xe192b6,
-    0xe192b7,
-    0xe192b8,
-    0xe192b9,
-    0xe192ba,
-    0xe192bb,
-    0xe192bc,
-    0xe192bd,
-    0xe192be,
-    0xe192bf,
-    0xe19380,
-    0xe19381,
-    0xe19382,
-    0xe19383,
-    0xe19384,
-    0xe19385,
-    0xe19386,
-    0xe19387,
-    0xe19388,
-    0xe19389,
-    0xe1938a,
-    0xe1938b,
-    0xe1938c,
-    0xe1938d,
-    0xe1938e,
-    0xe1938f,
-    0xe19390,
-    0xe19391,
-    0xe19392,
-    0xe19393,
-    0xe19394,
-    0xe19395,
-    0xe19396,
-    0xe19397,
-    0xe19398,
-    0xe19399,
-    0xe1939a,
-    0xe1939b,
-    0xe1939c,
-    0xe1939d,
-    0xe1939e,
-    0xe1939f,
-    0xe193a0,
-    0xe193a1,
-    0xe193a2,
-    0xe193a3,
-    0xe193a4,
-    0xe193a5,
-    0xe193a6,
-    0xe193a7,
-    0xe193a8,
-    0xe193a9,
-    0xe193aa,
-    0xe193ab,
-    0xe193ac,
-    0xe193ad,
-    0xe193ae,
-    0xe193af,
-    0xe193b0,
-    0xe193b1,
-    0xe193b2,
-    0xe193b3,
-    0xe193b4,
-    0xe193b5,
-    0xe193b6,
-    0xe193b7,
-    0xe193b8,
-    0xe193b9,
-    0xe193ba,
-    0xe193bb,
-    0xe193bc,
-    0xe193bd,
-    0xe193be,
-    0xe193bf,
-    0xe19480,
-    0xe19481,
-    0xe19482,
-    0xe19483,
-    0xe19484,
-    0xe19485,
-    0xe19486,
-    0xe19487,
-    0xe19488,
-    0xe19489,
-    0xe1948a,
-    0xe1948b,
-    0xe1948c,
-    0xe1948d,
-    0xe1948e,
-    0xe1948f,
-    0xe19490,
-    0xe19491,
-    0xe19492,
-    0xe19493,
-    0xe19494,
-    0xe19495,
-    0xe19496,
-    0xe19497,
-    0xe19498,
-    0xe19499,
-    0xe1949a,
-    0xe1949b,
-    0xe1949c,
-    0xe1949d,
-    0xe1949e,
-    0xe1949f,
-    0xe194a0,
-    0xe194a1,
-    0xe194a2,
-    0xe194a3,
-    0xe194a4,
-    0xe194a5,
-    0xe194a6,
-    0xe194a7,
-    0xe194a8,
-    0xe194a9,
-    0xe194aa,
-    0xe194ab,
-    0xe194ac,
-    0xe194ad,
-    0xe194ae,
-    0xe194af,
-    0xe194b0,
-    0xe194b1,
-    0xe194b2,
-    0xe194b3,
-    0xe194b4,
-    0xe194b5,
-    0xe194b6,
-    0xe194b7,
-    0xe194b8,
-    0xe194b9,
-    0xe194ba,
-    0xe194bb,
-    0xe194bc,
-    0xe194bd,
-    0xe194be,
-    0xe194bf,
-    0xe19580,
-    0xe19581,
-    0xe19582,
-    0xe19583,
-    0xe19584,
-    0xe19585,
-    0xe19586,
-    0xe19587,
-    0xe19588,
-    0xe19589,
-    0xe1958a,
-    0xe1958b,
-    0xe1958c,
-    0xe1958d,
-    0xe1958e,
-    0xe1958f,
-    0xe19590,
-    0xe19591,
-    0xe19592,
-    0xe19593,
-    0xe19594,
-    0xe19595,
-    0xe19596,
-    0xe19597,
-    0xe19598,
-    0xe19599,
-    0xe1959a,
-    0xe1959b,
-    0xe1959c,
-    0xe1959d,
-    0xe1959e,
-    0xe1959f,
-    0xe195a0,
-    0xe195a1,
-    0xe195a2,
-    0xe195a3,
-    0xe195a4,
-    0xe195a5,
-    0xe195a6,
-    0xe195a7,
-    0xe195a8,
-    0xe195a9,
-    0xe195aa,
-    0xe195ab,
-    0xe195ac,
-    0xe195ad,
-    0xe195ae,
-    0xe195af,
-    0xe195b0,
-    0xe195b1,
-    0xe195b2,
-    0xe195b3,
-    0xe195b4,
-    0xe195b5,
-    0xe195b6,
-    0xe195b7,
-    0xe195b8,
-    0xe195b9,
-    0xe195ba,
-    0xe195bb,
-    0xe195bc,
-    0xe195bd,
-    0xe195be,
-    0xe195bf,
-    0xe19680,
-    0xe19681,
-    0xe19682,
-    0xe19683,
-    0xe19684,
-    0xe19685,
-    0xe19686,
-    0xe19687,
-    0xe19688,
-    0xe19689,
-    0xe1968a,
-    0xe1968b,
-    0xe1968c,
-    0xe1968d,
-    0xe1968e,
-    0xe1968f,
-    0xe19690,
-    0xe19691,
-    0xe19692,
-    0xe19693,
-    0xe19694,
-    0xe19695,
-    0xe19696,
-    0xe19697,
-    0xe19698,
-    0xe19699,
-    0xe1969a,
-    0xe1969b,
-    0xe1969c,
-    0xe1969d,
-    0xe1969e,
-    0xe1969f,
-    0xe196a0,
-    0xe196a1,
-    0xe196a2,
-    0xe196a3,
-    0xe196a4,
-    0xe196a5,
-    0xe196a6,
-    0xe196a7,
-    0xe196a8,
-    0xe196a9,
-    0xe196aa,
-    0xe196ab,
-    0xe196ac,
-    0xe196ad,
-    0xe196ae,
-    0xe196af,
-    0xe196b0,
-    0xe196b1,
-    0xe196b2,
-    0xe196b3,
-    0xe196b4,
-    0xe196b5,
-    0xe196b6,
-    0xe196b7,
-    0xe196b8,
-    0xe196b9,
-    0xe196ba,
-    0xe196bb,
-    0xe196bc,
-    0xe196bd,
-    0xe196be,
-    0xe196bf,
-    0xe19780,
-    0xe19781,
-    0xe19782,
-    0xe19783,
-    0xe19784,
-    0xe19785,
-    0xe19786,
-    0xe19787,
-    0xe19788,
-    0xe19789,
-    0xe1978a,
-    0xe1978b,
-    0xe1978c,
-    0xe1978d,
-    0xe1978e,
-    0xe1978f,
-    0xe19790,
-    0xe19791,
-    0xe19792,
-    0xe19793,
-    0xe19794,
-    0xe19795,
-    0xe19796,
-    0xe19797,
-    0xe19798,
-    0xe19799,
-    0xe1979a,
-    0xe1979b,
-    0xe1979c,
-    0xe1979d,
-    0xe1979e,
-    0xe1979f,
-    0xe197a0,
-    0xe197a1,
-    0xe197a2,
-    0xe197a3,
-    0xe197a4,
-    0xe197a5,
-    0xe197a6,
-    0xe197a7,
-    0xe197a8,
-    0xe197a9,
-    0xe197aa,
-    0xe197ab,
-    0xe197ac,
-    0xe197ad,
-    0xe197ae,
-    0xe197af,
-    0xe197b0,
-    0xe197b1,
-    0xe197b2,
-    0xe197b3,
-    0xe197b4,
-    0xe197b5,
-    0xe197b6,
-    0xe197b7,
-    0xe197b8,
-    0xe197b9,
-    0xe197ba,
-    0xe197bb,
-    0xe197bc,
-    0xe197bd,
-    0xe197be,
-    0xe197bf,
-    0xe19880,
-    0xe19881,
-    0xe19882,
-    0xe19883,
-    0xe19884,
-    0xe19885,
-    0xe19886,
-    0xe19887,
-    0xe19888,
-    0xe19889,
-    0xe1988a,
-    0xe1988b,
-    0xe1988c,
-    0xe1988d,
-    0xe1988e,
-    0xe1988f,
-    0xe19890,
-    0xe19891,
-    0xe19892,
-    0xe19893,
-    0xe19894,
-    0xe19895,
-    0xe19896,
-    0xe19897,
-    0xe19898,
-    0xe19899,
-    0xe1989a,
-    0xe1989b,
-    0xe1989c,
-    0xe1989d,
-    0xe1989e,
-    0xe1989f,
-    0xe198a0,
-    0xe198a1,
-    0xe198a2,
-    0xe198a3,
-    0xe198a4,
-    0xe198a5,
-    0xe198a6,
-    0xe198a7,
-    0xe198a8,
-    0xe198a9,
-    0xe198aa,
-    0xe198ab,
-    0xe198ac,
-    0xe198ad,
-    0xe198ae,
-    0xe198af,
-    0xe198b0,
-    0xe198b1,
-    0xe198b2,
-    0xe198b3,
-    0xe198b4,
-    0xe198b5,
-    0xe198b6,
-    0xe198b7,
-    0xe198b8,
-    0xe198b9,
-    0xe198ba,
-    0xe198bb,
-    0xe198bc,
-    0xe198bd,
-    0xe198be,
-    0xe198bf,
-    0xe19980,
-    0xe19981,
-    0xe19982,
-    0xe19983,
-    0xe19984,
-    0xe19985,
-    0xe19986,
-    0xe19987,
-    0xe19988,
-    0xe19989,
-    0xe1998a,
-    0xe1998b,
-    0xe1998c,
-    0xe1998d,
-    0xe1998e,
-    0xe1998f,
-    0xe19990,
-    0xe19991,
-    0xe19992,
-    0xe19993,
-    0xe19994,
-    0xe19995,
-    0xe19996,
-    0xe19997,
-    0xe19998,
-    0xe19999,
-    0xe1999a,
-    0xe1999b,
-    0xe1999c,
-    0xe1999d,
-    0xe1999e,
-    0xe1999f,
-    0xe199a0,
-    0xe199a1,
-    0xe199a2,
-    0xe199a3,
-    0xe199a4,
-    0xe199a5,
-    0xe199a6,
-    0xe199a7,
-    0xe199a8,
-    0xe199a9,
-    0xe199aa,
-    0xe199ab,
-    0xe199ac,
-    0xe199ad,
-    0xe199ae,
-    0xe199af,
-    0xe199b0,
-    0xe199b1,
-    0xe199b2,
-    0xe199b3,
-    0xe199b4,
-    0xe199b5,
-    0xe199b6,
-    0xe199b7,
-    0xe199b8,
-    0xe199b9,
-    0xe199ba,
-    0xe199bb,
-    0xe199bc,
-    0xe199bd,
-    0xe199be,
-    0xe199bf,
-    0xe19a80,
-    0xe19a81,
-    0xe19a82,
-    0xe19a83,
-    0xe19a84,
-    0xe19a85,
-    0xe19a86,
-    0xe19a87,
-    0xe19a88,
-    0xe19a89,
-    0xe19a8a,
-    0xe19a8b,
-    0xe19a8c,
-    0xe19a8d,
-    0xe19a8e,
-    0xe19a8f,
-    0xe19a90,
-    0xe19a91,
-    0xe19a92,
-    0xe19a93,
-    0xe19a94,
-    0xe19a95,
-    0xe19a96,
-    0xe19a97,
-    0xe19a98,
-    0xe19a99,
-    0xe19a9a,
-    0xe19a9b,
-    0xe19a9c,
-    0xe19a9d,
-    0xe19a9e,
-    0xe19a9f,
-    0xe19aa0,
-    0xe19aa1,
-    0xe19aa2,
-    0xe19aa3,
-    0xe19aa4,
-    0xe19aa5,
-    0xe19aa6,
-    0xe19aa7,
-    0xe19aa8,
-    0xe19aa9,
-    0xe19aaa,
-    0xe19aab,
-    0xe19aac,
-    0xe19aad,
-    0xe19aae,
-    0xe19aaf,
-    0xe19ab0,
-    0xe19ab1,
-    0xe19ab2,
-    0xe19ab3,
-    0xe19ab4,
-    0xe19ab5,
-    0xe19ab6,
-    0xe19ab7,
-    0xe19ab8,
-    0xe19ab9,
-    0xe19aba,
-    0xe19abb,
-    0xe19abc,
-    0xe19abd,
-    0xe19abe,
-    0xe19abf,
-    0xe19b80,
-    0xe19b81,
-    0xe19b82,
-    0xe19b83,
-    0xe19b84,
-    0xe19b85,
-    0xe19b86,
-    0xe19b87,
-    0xe19b88,
-    0xe19b89,
-    0xe19b8a,
-    0xe19b8b,
-    0xe19b8c,
-    0xe19b8d,
-    0xe19b8e,
-    0xe19b8f,
-    0xe19b90,
-    0xe19b91,
-    0xe19b92,
-    0xe19b93,
-    0xe19b94,
-    0xe19b95,
-    0xe19b96,
-    0xe19b97,
-    0xe19b98,
-    0xe19b99,
-    0xe19b9a,
-    0xe19b9b,
-    0xe19b9c,
-    0xe19b9d,
-    0xe19b9e,
-    0xe19b9f,
-    0xe19ba0,
-    0xe19ba1,
-    0xe19ba2,
-    0xe19ba3,
-    0xe19ba4,
-    0xe19ba5,
-    0xe19ba6,
-    0xe19ba7,
-    0xe19ba8,
-    0xe19ba9,
-    0xe19baa,
-    0xe19bab,
-    0xe19bac,
-    0xe19bad,
-    0xe19bae,
-    0xe19baf,
-    0xe19bb0,
-    0xe19bb1,
-    0xe19bb2,
-    0xe19bb3,
-    0xe19bb4,
-    0xe19bb5,
-    0xe19bb6,
-    0xe19bb7,
-    0xe19bb8,
-    0xe19bb9,
-    0xe19bba,
-    0xe19bbb,
-    0xe19bbc,
-    0xe19bbd,
-    0xe19bbe,
-    0xe19bbf,
-    0xe19c80,
-    0xe19c81,
-    0xe19c82,
-    0xe19c83,
-    0xe19c84,
-    0xe19c85,
-    0xe19c86,
-    0xe19c87,
-    0xe19c88,
-    0xe19c89,
-    0xe19c8a,
-    0xe19c8b,
-    0xe19c8c,
-    0xe19c8d,
-    0xe19c8e,
-    0xe19c8f,
-    0xe19c90,
-    0xe19c91,
-    0xe19c92,
-    0xe19c93,
-    0xe19c94,
-    0xe19c95,
-    0xe19c96,
-    0xe19c97,
-    0xe19c98,
-    0xe19c99,
-    0xe19c9a,
-    0xe19c9b,
-    0xe19c9c,
-    0xe19c9d,
-    0xe19c9e,
-    0xe19c9f,
-    0xe19ca0,
-    0xe19ca1,
-    0xe19ca2,
-    0xe19ca3,
-    0xe19ca4,
-    0xe19ca5,
-    0xe19ca6,
-    0xe19ca7,
-    0xe19ca8,
-    0xe19ca9,
-    0xe19caa,
-    0xe19cab,
-    0xe19cac,
-    0xe19cad,
-    0xe19cae,
-    0xe19caf,
-    0xe19cb0,
-    0xe19cb1,
-    0xe19cb2,
-    0xe19cb3,
-    0xe19cb4,
-    0xe19cb5,
-    0xe19cb6,
-    0xe19cb7,
-    0xe19cb8,
-    0xe19cb9,
-    0xe19cba,
-    0xe19cbb,
-    0xe19cbc,
-    0xe19cbd,
-    0xe19cbe,
-    0xe19cbf,
-    0xe19d80,
-    0xe19d81,
-    0xe19d82,
-    0xe19d83,
-    0xe19d84,
-    0xe19d85,
-    0xe19d86,
-    0xe19d87,
-    0xe19d88,
-    0xe19d89,
-    0xe19d8a,
-    0xe19d8b,
-    0xe19d8c,
-    0xe19d8d,
-    0xe19d8e,
-    0xe19d8f,
-    0xe19d90,
-    0xe19d91,
-    0xe19d92,
-    0xe19d93,
-    0xe19d94,
-    0xe19d95,
-    0xe19d96,
-    0xe19d97,
-    0xe19d98,
-    0xe19d99,
-    0xe19d9a,
-    0xe19d9b,
-    0xe19d9c,
-    0xe19d9d,
-    0xe19d9e,
-    0xe19d9f,
-    0xe19da0,
-    0xe19da1,
-    0xe19da2,
-    0xe19da3,
-    0xe19da4,
-    0xe19da5,
-    0xe19da6,
-    0xe19da7,
-    0xe19da8,
-    0xe19da9,
-    0xe19daa,
-    0xe19dab,
-    0xe19dac,
-    0xe19dad,
-    0xe19dae,
-    0xe19daf,
-    0xe19db0,
-    0xe19db1,
-    0xe19db2,
-    0xe19db3,
-    0xe19db4,
-    0xe19db5,
-    0xe19db6,
-    0xe19db7,
-    0xe19db8,
-    0xe19db9,
-    0xe19dba,
-    0xe19dbb,
-    0xe19dbc,
-    0xe19dbd,
-    0xe19dbe,
-    0xe19dbf,
-    0xe19e80,
-    0xe19e81,
-    0xe19e82,
-    0xe19e83,
-    0xe19e84,
-    0xe19e85,
-    0xe19e86,
-    0xe19e87,
-    0xe19e88,
-    0xe19e89,
-    0xe19e8a,
-    0xe19e8b,
-    0xe19e8c,
-    0xe19e8d,
-    0xe19e8e,
-    0xe19e8f,
-    0xe19e90,
-    0xe19e91,
-    0xe19e92,
-    0xe19e93,
-    0xe19e94,
-    0xe19e95,
-    0xe19e96,
-    0xe19e97,
-    0xe19e98,
-    0xe19e99,
-    0xe19e9a,
-    0xe19e9b,
-    0xe19e9c,
-    0xe19e9d,
-    0xe19e9e,
-    0xe19e9f,
-    0xe19ea0,
-    0xe19ea1,
-    0xe19ea2,
-    0xe19ea3,
-    0xe19ea4,
-    0xe19ea5,
-    0xe19ea6,
-    0xe19ea7,
-    0xe19ea8,
-    0xe19ea9,
-    0xe19eaa,
-    0xe19eab,
-    0xe19eac,
-    0xe19ead,
-    0xe19eae,
-    0xe19eaf,
-    0xe19eb0,
-    0xe19eb1,
-    0xe19eb2,
-    0xe19eb3,
-    0xe19eb4,
-    0xe19eb5,
-    0xe19eb6,
-    0xe19eb7,
-    0xe19eb8,
-    0xe19eb9,
-    0xe19eba,
-    0xe19ebb,
-    0xe19ebc,
-    0xe19ebd,
-    0xe19ebe,
-    0xe19ebf,
-    0xe19f80,
-    0xe19f81,
-    0xe19f82,
-    0xe19f83,
-    0xe19f84,
-    0xe19f85,
-    0xe19f86,
-    0xe19f87,
-    0xe19f88,
-    0xe19f89,
-    0xe19f8a,
-    0xe19f8b,
-    0xe19f8c,
-    0xe19f8d,
-    0xe19f8e,
-    0xe19f8f,
-    0xe19f90,
-    0xe19f91,
-    0xe19f92,
-    0xe19f93,
-    0xe19f94,
-    0xe19f95,
-    0xe19f96,
-    0xe19f97,
-    0xe19f98,
-    0xe19f99,
-    0xe19f9a,
-    0xe19f9b,
-    0xe19f9c,
-    0xe19f9d,
-    0xe19f9e,
-    0xe19f9f,
-    0xe19fa0,
-    0xe19fa1,
-    0xe19fa2,
-    0xe19fa3,
-    0xe19fa4,
-    0xe19fa5,
-    0xe19fa6,
-    0xe19fa7,
-    0xe19fa8,
-    0xe19fa9,
-    0xe19faa,
-    0xe19fab,
-    0xe19fac,
-    0xe19fad,
-    0xe19fae,
-    0xe19faf,
-    0xe19fb0,
-    0xe19fb1,
-    0xe19fb2,
-    0xe19fb3,
-    0xe19fb4,
-    0xe19fb5,
-    0xe19fb6,
-    0xe19fb7,
-    0xe19fb8,
-    0xe19fb9,
-    0xe19fba,
-    0xe19fbb,
-    0xe19fbc,
-    0xe19fbd,
-    0xe19fbe,
-    0xe19fbf,
-    0xe1a080,
-    0xe1a081,
-    0xe1a082,
-    0xe1a083,
-    0xe1a084,
-    0xe1a085,
-    0xe1a086,
-    0xe1a087,
-    0xe1a088,
-    0xe1a089,
-    0xe1a08a,
-    0xe1a08b,
-    0xe1a08c,
-    0xe1a08d,
-    0xe1a08e,
-    0xe1a08f,
-    0xe1a090,
-    0xe1a091,
-    0xe1a092,
-    0xe1a093,
-    0xe1a094,
-    0xe1a095,
-    0xe1a096,
-    0xe1a097,
-    0xe1a098,
-    0xe1a099,
-    0xe1a09a,
-    0xe1a09b,
-    0xe1a09c,
-    0xe1a09d,
-    0xe1a09e,
-    0xe1a09f,
-    0xe1a0a0,
-    0xe1a0a1,
-    0xe1a0a2,
-    0xe1a0a3,
-    0xe1a0a4,
-    0xe1a0a5,
-    0xe1a0a6,
-    0xe1a0a7,
-    0xe1a0a8,
-    0xe1a0a9,
-    0xe1a0aa,
-    0xe1a0ab,
-    0xe1a0ac,
-    0xe1a0ad,
-    0xe1a0ae,
-    0xe1a0af,
-    0xe1a0b0,
-    0xe1a0b1,
-    0xe1a0b2,
-    0xe1a0b3,
-    0xe1a0b4,
-    0xe1a0b5,
-    0xe1a0b6,
-    0xe1a0b7,
-    0xe1a0b8,
-    0xe1a0b9,
-    0xe1a0ba,
-    0xe1a0bb,
-    0xe1a0bc,
-    0xe1a0bd,
-    0xe1a0be,
-    0xe1a0bf,
-    0xe1a180,
-    0xe1a181,
-    0xe1a182,
-    0xe1a183,
-    0xe1a184,
-    0xe1a185,
-    0xe1a186,
-    0xe1a187,
-    0xe1a188,
-    0xe1a189,
-    0xe1a18a,
-    0xe1a18b,
-    0xe1a18c,
-    0xe1a18d,
-    0xe1a18e,
-    0xe1a18f,
-    0xe1a190,
-    0xe1a191,
-    0xe1a192,
-    0xe1a193,
-    0xe1a194,
-    0xe1a195,
-    0xe1a196,
-    0xe1a197,
-    0xe1a198,
-    0xe1a199,
-    0xe1a19a,
-    0xe1a19b,
-    0xe1a19c,
-    0xe1a19d,
-    0xe1a19e,
-    0xe1a19f,
-    0xe1a1a0,
-    0xe1a1a1,
-    0xe1a1a2,
-    0xe1a1a3,
-    0xe1a1a4,
-    0xe1a1a5,
-    0xe1a1a6,
-    0xe1a1a7,
-    0xe1a1a8,
-    0xe1a1a9,
-    0xe1a1aa,
-    0xe1a1ab,
-    0xe1a1ac,
-    0xe1a1ad,
-    0xe1a1ae,
-    0xe1a1af,
-    0xe1a1b0,
-    0xe1a1b1,
-    0xe1a1b2,
-    0xe1a1b3,
-    0xe1a1b4,
-    0xe1a1b5,
-    0xe1a1b6,
-    0xe1a1b7,
-    0xe1a1b8,
-    0xe1a1b9,
-    0xe1a1ba,
-    0xe1a1bb,
-    0xe1a1bc,
-    0xe1a1bd,
-    0xe1a1be,
-    0xe1a1bf,
-    0xe1a280,
-    0xe1a281,
-    0xe1a282,
-    0xe1a283,
-    0xe1a284,
-    0xe1a285,
-    0xe1a286,
-    0xe1a287,
-    0xe1a288,
-    0xe1a289,
-    0xe1a28a,
-    0xe1a28b,
-    0xe1a28c,
-    0xe1a28d,
-    0xe1a28e,
-    0xe1a28f,
-    0xe1a290,
-    0xe1a291,
-    0xe1a292,
-    0xe1a293,
-    0xe1a294,
-    0xe1a295,
-    0xe1a296,
-    0xe1a297,
-    0xe1a298,
-    0xe1a299,
-    0xe1a29a,
-    0xe1a29b,
-    0xe1a29c,
-    0xe1a29d,
-    0xe1a29e,
-    0xe1a29f,
-    0xe1a2a0,
-    0xe1a2a1,
-    0xe1a2a2,
-    0xe1a2a3,
-    0xe1a2a4,
-    0xe1a2a5,
-    0xe1a2a6,
-    0xe1a2a7,
-    0xe1a2a8,
-    0xe1a2a9,
-    0xe1a2aa,
-    0xe1a2ab,
-    0xe1a2ac,
-    0xe1a2ad,
-    0xe1a2ae,
-    0xe1a2af,
-    0xe1a2b0,
-    0xe1a2b1,
-    0xe1a2b2,
-    0xe1a2b3,
-    0xe1a2b4,
-    0xe1a2b5,
-    0xe1a2b6,
-    0xe1a2b7,
-    0xe1a2b8,
-    0xe1a2b9,
-    0xe1a2ba,
-    0xe1a2bb,
-    0xe1a2bc,
-    0xe1a2bd,
-    0xe1a2be,
-    0xe1a2bf,
-    0xe1a380,
-    0xe1a381,
-    0xe1a382,
-    0xe1a383,
-    0xe1a384,
-    0xe1a385,
-    0xe1a386,
-    0xe1a387,
-    0xe1a388,
-    0xe1a389,
-    0xe1a38a,
-    0xe1a38b,
-    0xe1a38c,
-    0xe1a38d,
-    0xe1a38e,
-    0xe1a38f,
-    0xe1a390,
-    0xe1a391,
-    0xe1a392,
-    0xe1a393,
-    0xe1a394,
-    0xe1a395,
-    0xe1a396,
-    0xe1a397,
-    0xe1a398,
-    0xe1a399,
-    0xe1a39a,
-    0xe1a39b,
-    0xe1a39c,
-    0xe1a39d,
-    0xe1a39e,
-    0xe1a39f,
-    0xe1a3a0,
-    0xe1a3a1,
-    0xe1a3a2,
-    0xe1a3a3,
-    0xe1a3a4,
-    0xe1a3a5,
-    0xe1a3a6,
-    0xe1a3a7,
-    0xe1a3a8,
-    0xe1a3a9,
-    0xe1a3aa,
-    0xe1a3ab,
-    0xe1a3ac,
-    0xe1a3ad,
-    0xe1a3ae,
-    0xe1a3af,
-    0xe1a3b0,
-    0xe1a3b1,
-    0xe1a3b2,
-    0xe1a3b3,
-    0xe1a3b4,
-    0xe1a3b5,
-    0xe1a3b6,
-    0xe1a3b7,
-    0xe1a3b8,
-    0xe1a3b9,
-    0xe1a3ba,
-    0xe1a3bb,
-    0xe1a3bc,
-    0xe1a3bd,
-    0xe1a3be,
-    0xe1a3bf,
-    0xe1a480,
-    0xe1a481,
-    0xe1a482,
-    0xe1a483,
-    0xe1a484,
-    0xe1a485,
-    0xe1a486,
-    0xe1a487,
-    0xe1a488,
-    0xe1a489,
-    0xe1a48a,
-    0xe1a48b,
-    0xe1a48c,
-    0xe1a48d,
-    0xe1a48e,
-    0xe1a48f,
-    0xe1a490,
-    0xe1a491,
-    0xe1a492,
-    0xe1a493,
-    0xe1a494,
-    0xe1a495,
-    0xe1a496,
-    0xe1a497,
-    0xe1a498,
-    0xe1a499,
-    0xe1a49a,
-    0xe1a49b,
-    0xe1a49c,
-    0xe1a49d,
-    0xe1a49e,
-    0xe1a49f,
-    0xe1a4a0,
-    0xe1a4a1,
-    0xe1a4a2,
-    0xe1a4a3,
-    0xe1a4a4,
-    0xe1a4a5,
-    0xe1a4a6,
-    0xe1a4a7,
-    0xe1a4a8,
-    0xe1a4a9,
-    0xe1a4aa,
-    0xe1a4ab,
-    0xe1a4ac,
-    0xe1a4ad,
-    0xe1a4ae,
-    0xe1a4af,
-    0xe1a4b0,
-    0xe1a4b1,
-    0xe1a4b2,
-    0xe1a4b3,
-    0xe1a4b4,
-    0xe1a4b5,
-    0xe1a4b6,
-    0xe1a4b7,
-    0xe1a4b8,
-    0xe1a4b9,
-    0xe1a4ba,
-    0xe1a4bb,
-    0xe1a4bc,
-    0xe1a4bd,
-    0xe1a4be,
-    0xe1a4bf,
-    0xe1a580,
-    0xe1a581,
-    0xe1a582,
-    0xe1a583,
-    0xe1a584,
-    0xe1a585,
-    0xe1a586,
-    0xe1a587,
-    0xe1a588,
-    0xe1a589,
-    0xe1a58a,
-    0xe1a58b,
-    0xe1a58c,
-    0xe1a58d,
-    0xe1a58e,
-    0xe1a58f,
-    0xe1a590,
-    0xe1a591,
-    0xe1a592,
-    0xe1a593,
-    0xe1a594,
-    0xe1a595,
-    0xe1a596,
-    0xe1a597,
-    0xe1a598,
-    0xe1a599,
-    0xe1a59a,
-    0xe1a59b,
-    0xe1a59c,
-    0xe1a59d,
-    0xe1a59e,
-    0xe1a59f,
-    0xe1a5a0,
-    0xe1a5a1,
-    0xe1a5a2,
-    0xe1a5a3,
-    0xe1a5a4,
-    0xe1a5a5,
-    0xe1a5a6,
-    0xe1a5a7,
-    0xe1a5a8,
-    0xe1a5a9,
-    0xe1a5aa,
-    0xe1a5ab,
-    0xe1a5ac,
-    0xe1a5ad,
-    0xe1a5ae,
-    0xe1a5af,
-    0xe1a5b0,
-    0xe1a5b1,
-    0xe1a5b2,
-    0xe1a5b3,
-    0xe1a5b4,
-    0xe1a5b5,
-    0xe1a5b6,
-    0xe1a5b7,
-    0xe1a5b8,
-    0xe1a5b9,
-    0xe1a5ba,
-    0xe1a5bb,
-    0xe1a5bc,
-    0xe1a5bd,
-    0xe1a5be,
-    0xe1a5bf,
-    0xe1a680,
-    0xe1a681,
-    0xe1a682,
-    0xe1a683,
-    0xe1a684,
-    0xe1a685,
-    0xe1a686,
-    0xe1a687,
-    0xe1a688,
-    0xe1a689,
-    0xe1a68a,
-    0xe1a68b,
-    0xe1a68c,
-    0xe1a68d,
-    0xe1a68e,
-    0xe1a68f,
-    0xe1a690,
-    0xe1a691,
-    0xe1a692,
-    0xe1a693,
-    0xe1a694,
-    0xe1a695,
-    0xe1a696,
-    0xe1a697,
-    0xe1a698,
-    0xe1a699,
-    0xe1a69a,
-    0xe1a69b,
-    0xe1a69c,
-    0xe1a69d,
-    0xe1a69e,
-    0xe1a69f,
-    0xe1a6a0,
-    0xe1a6a1,
-    0xe1a6a2,
-    0xe1a6a3,
-    0xe1a6a4,
-    0xe1a6a5,
-    0xe1a6a6,
-    0xe1a6a7,
-    0xe1a6a8,
-    0xe1a6a9,
-    0xe1a6aa,
-    0xe1a6ab,
-    0xe1a6ac,
-    0xe1a6ad,
-    0xe1a6ae,
-    0xe1a6af,
-    0xe1a6b0,
-    0xe1a6b1,
-    0xe1a6b2,
-    0xe1a6b3,
-    0xe1a6b4,
-    0xe1a6b5,
-    0xe1a6b6,
-    0xe1a6b7,
-    0xe1a6b8,
-    0xe1a6b9,
-    0xe1a6ba,
-    0xe1a6bb,
-    0xe1a6bc,
-    0xe1a6bd,
-    0xe1a6be,
-    0xe1a6bf,
-    0xe1a780,
-    0xe1a781,
-    0xe1a782,
-    0xe1a783,
-    0xe1a784,
-    0xe1a785,
-    0xe1a786,
-    0xe1a787,
-    0xe1a788,
-    0xe1a789,
-    0xe1a78a,
-    0xe1a78b,
-    0xe1a78c,
-    0xe1a78d,
-    0xe1a78e,
-    0xe1a78f,
-    0xe1a790,
-    0xe1a791,
-    0xe1a792,
-    0xe1a793,
-    0xe1a794,
-    0xe1a795,
-    0xe1a796,
-    0xe1a797,
-    0xe1a798,
-    0xe1a799,
-    0xe1a79a,
-    0xe1a79b,
-    0xe1a79c,
-    0xe1a79d,
-    0xe1a79e,
-    0xe1a79f,
-    0xe1a7a0,
-    0xe1a7a1,
-    0xe1a7a2,
-    0xe1a7a3,
-    0xe1a7a4,
-    0xe1a7a5,
-    0xe1a7a6,
-    0xe1a7a7,
-    0xe1a7a8,
-    0xe1a7a9,
-    0xe1a7aa,
-    0xe1a7ab,
-    0xe1a7ac,
-    0xe1a7ad,
-    0xe1a7ae,
-    0xe1a7af,
-    0xe1a7b0,
-    0xe1a7b1,
-    0xe1a7b2,
-    0xe1a7b3,
-    0xe1a7b4,
-    0xe1a7b5,
-    0xe1a7b6,
-    0xe1a7b7,
-    0xe1a7b8,
-    0xe1a7b9,
-    0xe1a7ba,
-    0xe1a7bb,
-    0xe1a7bc,
-    0xe1a7bd,
-    0xe1a7be,
-    0xe1a7bf,
-    0xe1a880,
-    0xe1a881,
-    0xe1a882,
-    0xe1a883,
-    0xe1a884,
-    0xe1a885,
-    0xe1a886,
-    0xe1a887,
-    0xe1a888,
-    0xe1a889,
-    0xe1a88a,
-    0xe1a88b,
-    0xe1a88c,
-    0xe1a88d,
-    0xe1a88e,
-    0xe1a88f,
-    0xe1a890,
-    0xe1a891,
-    0xe1a892,
-    0xe1a893,
-    0xe1a894,
-    0xe1a895,
-    0xe1a896,
-    0xe1a897,
-    0xe1a898,
-    0xe1a899,
-    0xe1a89a,
-    0xe1a89b,
-    0xe1a89c,
-    0xe1a89d,
-    0xe1a89e,
-    0xe1a89f,
-    0xe1a8a0,
-    0xe1a8a1,
-    0xe1a8a2,
-    0xe1a8a3,
-    0xe1a8a4,
-    0xe1a8a5,
-    0xe1a8a6,
-    0xe1a8a7,
-    0xe1a8a8,
-    0xe1a8a9,
-    0xe1a8aa,
-    0xe1a8ab,
-    0xe1a8ac,
-    0xe1a8ad,
-    0xe1a8ae,
-    0xe1a8af,
-    0xe1a8b0,
-    0xe1a8b1,
-    0xe1a8b2,
-    0xe1a8b3,
-    0xe1a8b4,
-    0xe1a8b5,
-    0xe1a8b6,
-    0xe1a8b7,
-    0xe1a8b8,
-    0xe1a8b9,
-    0xe1a8ba,
-    0xe1a8bb,
-    0xe1a8bc,
-    0xe1a8bd,
-    0xe1a8be,
-    0xe1a8bf,
-    0xe1a980,
-    0xe1a981,
-    0xe1a982,
-    0xe1a983,
-    0xe1a984,
-    0xe1a985,
-    0xe1a986,
-    0xe1a987,
-    0xe1a988,
-    0xe1a989,
-    0xe1a98a,
-    0xe1a98b,
-    0xe1a98c,
-    0xe1a98d,
-    0xe1a98e,
-    0xe1a98f,
-    0xe1a990,
-    0xe1a991,
-    0xe1a992,
-    0xe1a993,
-    0xe1a994,
-    0xe1a995,
-    0xe1a996,
-    0xe1a997,
-    0xe1a998,
-    0xe1a999,
-    0xe1a99a,
-    0xe1a99b,
-    0xe1a99c,
-    0xe1a99d,
-    0xe1a99e,
-    0xe1a99f,
-    0xe1a9a0,
-    0xe1a9a1,
-    0xe1a9a2,
-    0xe1a9a3,
-    0xe1a9a4,
-    0xe1a9a5,
-    0xe1a9a6,
-    0xe1a9a7,
-    0xe1a9a8,
-    0xe1a9a9,
-    0xe1a9aa,
-    0xe1a9ab,
-    0xe1a9ac,
-    0xe1a9ad,
-    0xe1a9ae,
-    0xe1a9af,
-    0xe1a9b0,
-    0xe1a9b1,
-    0xe1a9b2,
-    0xe1a9b3,
-    0xe1a9b4,
-    0xe1a9b5,
-    0xe1a9b6,
-    0xe1a9b7,
-    0xe1a9b8,
-    0xe1a9b9,
-    0xe1a9ba,
-    0xe1a9bb,
-    0xe1a9bc,
-    0xe1a9bd,
-    0xe1a9be,
-    0xe1a9bf,
-    0xe1aa80,
-    0xe1aa81,
-    0xe1aa82,
-    0xe1aa83,
-    0xe1aa84,
-    0xe1aa85,
-    0xe1aa86,
-    0xe1aa87,
-    0xe1aa88,
-    0xe1aa89,
-    0xe1aa8a,
-    0xe1aa8b,
-    0xe1aa8c,
-    0xe1aa8d,
-    0xe1aa8e,
-    0xe1aa8f,
-    0xe1aa90,
-    0xe1aa91,
-    0xe1aa92,
-    0xe1aa93,
-    0xe1aa94,
-    0xe1aa95,
-    0xe1aa96,
-    0xe1aa97,
-    0xe1aa98,
-    0xe1aa99,
-    0xe1aa9a,
-    0xe1aa9b,
-    0xe1aa9c,
-    0xe1aa9d,
-    0xe1aa9e,
-    0xe1aa9f,
-    0xe1aaa0,
-    0xe1aaa1,
-    0xe1aaa2,
-    0xe1aaa3,
-    0xe1aaa4,
-    0xe1aaa5,
-    0xe1aaa6,
-    0xe1aaa7,
-    0xe1aaa8,
-    0xe1aaa9,
-    0xe1aaaa,
-    0xe1aaab,
-    0xe1aaac,
-    0xe1aaad,
-    0xe1aaae,
-    0xe1aaaf,
-    0xe1aab0,
-    0xe1aab1,
-    0xe1aab2,
-    0xe1aab3,
-    0xe1aab4,
-    0xe1aab5,
-    0xe1aab6,
-    0xe1aab7,
-    0xe1aab8,
-    0xe1aab9,
-    0xe1aaba,
-    0xe1aabb,
-    0xe1aabc,
-    0xe1aabd,
-    0xe1aabe,
-    0xe1aabf,
-    0xe1ab80,
-    0xe1ab81,
-    0xe1ab82,
-    0xe1ab83,
-    0xe1ab84,
-    0xe1ab85,
-    0xe1ab86,
-    0xe1ab87,
-    0xe1ab88,
-    0xe1ab89,
-    0xe1ab8a,
-    0xe1ab8b,
-    0xe1ab8c,
-    0xe1ab8d,
-    0xe1ab8e,
-    0xe1ab8f,
-    0xe1ab90,
-    0xe1ab91,
-    0xe1ab92,
-    0xe1ab93,
-    0xe1ab94,
-    0xe1ab95,
-    0xe1ab96,
-    0xe1ab97,
-    0xe1ab98,
-    0xe1ab99,
-    0xe1ab9a,
-    0xe1ab9b,
-    0xe1ab9c,
-    0xe1ab9d,
-    0xe1ab9e,
-    0xe1ab9f,
-    0xe1aba0,
-    0xe1aba1,
-    0xe1aba2,
-    0xe1aba3,
-    0xe1aba4,
-    0xe1aba5,
-    0xe1aba6,
-    0xe1aba7,
-    0xe1aba8,
-    0xe1aba9,
-    0xe1abaa,
-    0xe1abab,
-    0xe1abac,
-    0xe1abad,
-    0xe1abae,
-    0xe1abaf,
-    0xe1abb0,
-    0xe1abb1,
-    0xe1abb2,
-    0xe1abb3,
-    0xe1abb4,
-    0xe1abb5,
-    0xe1abb6,
-    0xe1abb7,
-    0xe1abb8,
-    0xe1abb9,
-    0xe1abba,
-    0xe1abbb,
-    0xe1abbc,
-    0xe1abbd,
-    0xe1abbe,
-    0xe1abbf,
-    0xe1ac80,
-    0xe1ac81,
-    0xe1ac82,
-    0xe1ac83,
-    0xe1ac84,
-    0xe1ac85,
-    0xe1ac86,
-    0xe1ac87,
-    0xe1ac88,
-    0xe1ac89,
-    0xe1ac8a,
-    0xe1ac8b,
-    0xe1ac8c,
-    0xe1ac8d,
-    0xe1ac8e,
-    0xe1ac8f,
-    0xe1ac90,
-    0xe1ac91,
-    0xe1ac92,
-    0xe1ac93,
-    0xe1ac94,
-    0xe1ac95,
-    0xe1ac96,
-    0xe1ac97,
-    0xe1ac98,
-    0xe1ac99,
-    0xe1ac9a,
-    0xe1ac9b,
-    0xe1ac9c,
-    0xe1ac9d,
-    0xe1ac9e,
-    0xe1ac9f,
-    0xe1aca0,
-    0xe1aca1,
-    0xe1aca2,
-    0xe1aca3,
-    0xe1aca4,
-    0xe1aca5,
-    0xe1aca6,
-    0xe1aca7,
-    0xe1aca8,
-    0xe1aca9,
-    0xe1acaa,
-    0xe1acab,
-    0xe1acac,
-    0xe1acad,
-    0xe1acae,
-    0xe1acaf,
-    0xe1acb0,
-    0xe1acb1,
-    0xe1acb2,
-    0xe1acb3,
-    0xe1acb4,
-    0xe1acb5,
-    0xe1acb6,
-    0xe1acb7,
-    0xe1acb8,
-    0xe1acb9,
-    0xe1acba,
-    0xe1acbb,
-    0xe1acbc,
-    0xe1acbd,
-    0xe1acbe,
-    0xe1acbf,
-    0xe1ad80,
-    0xe1ad81,
-    0xe1ad82,
-    0xe1ad83,
-    0xe1ad84,
-    0xe1ad85,
-    0xe1ad86,
-    0xe1ad87,
-    0xe1ad88,
-    0xe1ad89,
-    0xe1ad8a,
-    0xe1ad8b,
-    0xe1ad8c,
-    0xe1ad8d,
-    0xe1ad8e,
-    0xe1ad8f,
-    0xe1ad90,
-    0xe1ad91,
-    0xe1ad92,
-    0xe1ad93,
-    0xe1ad94,
-    0xe1ad95,
-    0xe1ad96,
-    0xe1ad97,
-    0xe1ad98,
-    0xe1ad99,
-    0xe1ad9a,
-    0xe1ad9b,
-    0xe1ad9c,
-    0xe1ad9d,
-    0xe1ad9e,
-    0xe1ad9f,
-    0xe1ada0,
-    0xe1ada1,
-    0xe1ada2,
-    0xe1ada3,
-    0xe1ada4,
-    0xe1ada5,
-    0xe1ada6,
-    0xe1ada7,
-    0xe1ada8,
-    0xe1ada9,
-    0xe1adaa,
-    0xe1adab,
-    0xe1adac,
-    0xe1adad,
-    0xe1adae,
-    0xe1adaf,
-    0xe1adb0,
-    0xe1adb1,
-    0xe1adb2,
-    0xe1adb3,
-    0xe1adb4,
-    0xe1adb5,
-    0xe1adb6,
-    0xe1adb7,
-    0xe1adb8,
-    0xe1adb9,
-    0xe1adba,
-    0xe1adbb,
-    0xe1adbc,
-    0xe1adbd,
-    0xe1adbe,
-    0xe1adbf,
-    0xe1ae80,
-    0xe1ae81,
-    0xe1ae82,
-    0xe1ae83,
-    0xe1ae84,
-    0xe1ae85,
-    0xe1ae86,
-    0xe1ae87,
-    0xe1ae88,
-    0xe1ae89,
-    0xe1ae8a,
-    0xe1ae8b,
-    0xe1ae8c,
-    0xe1ae8d,
-    0xe1ae8e,
-    0xe1ae8f,
-    0xe1ae90,
-    0xe1ae91,
-    0xe1ae92,
-    0xe1ae93,
-    0xe1ae94,
-    0xe1ae95,
-    0xe1ae96,
-    0xe1ae97,
-    0xe1ae98,
-    0xe1ae99,
-    0xe1ae9a,
-    0xe1ae9b,
-    0xe1ae9c,
-    0xe1ae9d,
-    0xe1ae9e,
-    0xe1ae9f,
-    0xe1aea0,
-    0xe1aea1,
-    0xe1aea2,
-    0xe1aea3,
-    0xe1aea4,
-    0xe1aea5,
-    0xe1aea6,
-    0xe1aea7,
-    0xe1aea8,
-    0xe1aea9,
-    0xe1aeaa,
-    0xe1aeab,
-    0xe1aeac,
-    0xe1aead,
-    0xe1aeae,
-    0xe1aeaf,
-    0xe1aeb0,
-    0xe1aeb1,
-    0xe1aeb2,
-    0xe1aeb3,
-    0xe1aeb4,
-    0xe1aeb5,
-    0xe1aeb6,
-    0xe1aeb7,
-    0xe1aeb8,
-    0xe1aeb9,
-    0xe1aeba,
-    0xe1aebb,
-    0xe1aebc,
-    0xe1aebd,
-    0xe1aebe,
-    0xe1aebf,
-    0xe1af80,
-    0xe1af81,
-    0xe1af82,
-    0xe1af83,
-    0xe1af84,
-    0xe1af85,
-    0xe1af86,
-    0xe1af87,
-    0xe1af88,
-    0xe1af89,
-    0xe1af8a,
-    0xe1af8b,
-    0xe1af8c,
-    0xe1af8d,
-    0xe1af8e,
-    0xe1af8f,
-    0xe1af90,
-    0xe1af91,
-    0xe1af92,
-    0xe1af93,
-    0xe1af94,
-    0xe1af95,
-    0xe1af96,
-    0xe1af97,
-    0xe1af98,
-    0xe1af99,
-    0xe1af9a,
-    0xe1af9b,
-    0xe1af9c,
-    0xe1af9d,
-    0xe1af9e,
-    0xe1af9f,
-    0xe1afa0,
-    0xe1afa1,
-    0xe1afa2,
-    0xe1afa3,
-    0xe1afa4,
-    0xe1afa5,
-    0xe1afa6,
-    0xe1afa7,
-    0xe1afa8,
-    0xe1afa9,
-    0xe1afaa,
-    0xe1afab,
-    0xe1afac,
-    0xe1afad,
-    0xe1afae,
-    0xe1afaf,
-    0xe1afb0,
-    0xe1afb1,
-    0xe1afb2,
-    0xe1afb3,
-    0xe1afb4,
-    0xe1afb5,
-    0xe1afb6,
-    0xe1afb7,
-    0xe1afb8,
-    0xe1afb9,
-    0xe1afba,
-    0xe1afbb,
-    0xe1afbc,
-    0xe1afbd,
-    0xe1afbe,
-    0xe1afbf,
-    0xe1b080,
-    0xe1b081,
-    0xe1b082,
-    0xe1b083,
-    0xe1b084,
-    0xe1b085,
-    0xe1b086,
-    0xe1b087,
-    0xe1b088,
-    0xe1b089,
-    0xe1b08a,
-    0xe1b08b,
-    0xe1b08c,
-    0xe1b08d,
-    0xe1b08e,
-    0xe1b08f,
-    0xe1b090,
-    0xe1b091,
-    0xe1b092,
-    0xe1b093,
-    0xe1b094,
-    0xe1b095,
-    0xe1b096,
-    0xe1b097,
-    0xe1b098,
-    0xe1b099,
-    0xe1b09a,
-    0xe1b09b,
-    0xe1b09c,
-    0xe1b09d,
-    0xe1b09e,
-    0xe1b09f,
-    0xe1b0a0,
-    0xe1b0a1,
-    0xe1b0a2,
-    0xe1b0a3,
-    0xe1b0a4,
-    0xe1b0a5,
-    0xe1b0a6,
-    0xe1b0a7,
-    0xe1b0a8,
-    0xe1b0a9,
-    0xe1b0aa,
-    0xe1b0ab,
-    0xe1b0ac,
-    0xe1b0ad,
-    0xe1b0ae,
-    0xe1b0af,
-    0xe1b0b0,
-    0xe1b0b1,
-    0xe1b0b2,
-    0xe1b0b3,
-    0xe1b0b4,
-    0xe1b0b5,
-    0xe1b0b6,
-    0xe1b0b7,
-    0xe1b0b8,
-    0xe1b0b9,
-    0xe1b0ba,
-    0xe1b0bb,
-    0xe1b0bc,
-    0xe1b0bd,
-    0xe1b0be,
-    0xe1b0bf,
-    0xe1b180,
-    0xe1b181,
-    0xe1b182,
-    0xe1b183,
-    0xe1b184,
-    0xe1b185,
-    0xe1b186,
-    0xe1b187,
-    0xe1b188,
-    0xe1b189,
-    0xe1b18a,
-    0xe1b18b,
-    0xe1b18c,
-    0xe1b18d,
-    0xe1b18e,
-    0xe1b18f,
-    0xe1b190,
-    0xe1b191,
-    0xe1b192,
-    0xe1b193,
-    0xe1b194,
-    0xe1b195,
-    0xe1b196,
-    0xe1b197,
-    0xe1b198,
-    0xe1b199,
-    0xe1b19a,
-    0xe1b19b,
-    0xe1b19c,
-    0xe1b19d,
-    0xe1b19e,
-    0xe1b19f,
-    0xe1b1a0,
-    0xe1b1a1,
-    0xe1b1a2,
-    0xe1b1a3,
-    0xe1b1a4,
-    0xe1b1a5,
-    0xe1b1a6,
-    0xe1b1a7,
-    0xe1b1a8,
-    0xe1b1a9,
-    0xe1b1aa,
-    0xe1b1ab,
-    0xe1b1ac,
-    0xe1b1ad,
-    0xe1b1ae,
-    0xe1b1af,
-    0xe1b1b0,
-    0xe1b1b1,
-    0xe1b1b2,
-    0xe1b1b3,
-    0xe1b1b4,
-    0xe1b1b5,
-    0xe1b1b6,
-    0xe1b1b7,
-    0xe1b1b8,
-    0xe1b1b9,
-    0xe1b1ba,
-    0xe1b1bb,
-    0xe1b1bc,
-    0xe1b1bd,
-    0xe1b1be,
-    0xe1b1bf,
-    0xe1b280,
-    0xe1b281,
-    0xe1b282,
-    0xe1b283,
-    0xe1b284,
-    0xe1b285,
-    0xe1b286,
-    0xe1b287,
-    0xe1b288,
-    0xe1b289,
-    0xe1b28a,
-    0xe1b28b,
-    0xe1b28c,
-    0xe1b28d,
-    0xe1b28e,
-    0xe1b28f,
-    0xe1b290,
-    0xe1b291,
-    0xe1b292,
-    0xe1b293,
-    0xe1b294,
-    0xe1b295,
-    0xe1b296,
-    0xe1b297,
-    0xe1b298,
-    0xe1b299,
-    0xe1b29a,
-    0xe1b29b,
-    0xe1b29c,
-    0xe1b29d,
-    0xe1b29e,
-    0xe1b29f,
-    0xe1b2a0,
-    0xe1b2a1,
-    0xe1b2a2,
-    0xe1b2a3,
-    0xe1b2a4,
-    0xe1b2a5,
-    0xe1b2a6,
-    0xe1b2a7,
-    0xe1b2a8,
-    0xe1b2a9,
-    0xe1b2aa,
-    0xe1b2ab,
-    0xe1b2ac,
-    0xe1b2ad,
-    0xe1b2ae,
-    0xe1b2af,
-    0xe1b2b0,
-    0xe1b2b1,
-    0xe1b2b2,
-    0xe1b2b3,
-    0xe1b2b4,
-    0xe1b2b5,
-    0xe1b2b6,
-    0xe1b2b7,
-    0xe1b2b8,
-    0xe1b2b9,
-    0xe1b2ba,
-    0xe1b2bb,
-    0xe1b2bc,
-    0xe1b2bd,
-    0xe1b2be,
-    0xe1b2bf,
-    0xe1b380,
-    0xe1b381,
-    0xe1b382,
-    0xe1b383,
-    0xe1b384,
-    0xe1b385,
-    0xe1b386,
-    0xe1b387,
-    0xe1b388,
-    0xe1b389,
-    0xe1b38a,
-    0xe1b38b,
-    0xe1b38c,
-    0xe1b38d,
-    0xe1b38e,
-    0xe1b38f,
-    0xe1b390,
-    0xe1b391,
-    0xe1b392,
-    0xe1b393,
-    0xe1b394,
-    0xe1b395,
-    0xe1b396,
-    0xe1b397,
-    0xe1b398,
-    0xe1b399,
-    0xe1b39a,
-    0xe1b39b,
-    0xe1b39c,
-    0xe1b39d,
-    0xe1b39e,
-    0xe1b39f,
-    0xe1b3a0,
-    0xe1b3a1,
-    0xe1b3a2,
-    0xe1b3a3,
-    0xe1b3a4,
-    0xe1b3a5,
-    0xe1b3a6,
-    0xe1b3a7,
-    0xe1b3a8,
-    0xe1b3a9,
-    0xe1b3aa,
-    0xe1b3ab,
-    0xe1b3ac,
-    0xe1b3ad,
-    0xe1b3ae,
-    0xe1b3af,
-    0xe1b3b0,
-    0xe1b3b1,
-    0xe1b3b2,
-    0xe1b3b3,
-    0xe1b3b4,
-    0xe1b3b5,
-    0xe1b3b6,
-    0xe1b3b7,
-    0xe1b3b8,
-    0xe1b3b9,
-    0xe1b3ba,
-    0xe1b3bb,
-    0xe1b3bc,
-    0xe1b3bd,
-    0xe1b3be,
-    0xe1b3bf,
-    0xe1b480,
-    0xe1b481,
-    0xe1b482,
-    0xe1b483,
-    0xe1b484,
-    0xe1b485,
-    0xe1b486,
-    0xe1b487,
-    0xe1b488,
-    0xe1b489,
-    0xe1b48a,
-    0xe1b48b,
-    0xe1b48c,
-    0xe1b48d,
-    0xe1b48e,
-    0xe1b48f,
-    0xe1b490,
-    0xe1b491,
-    0xe1b492,
-    0xe1b493,
-    0xe1b494,
-    0xe1b495,
-    0xe1b496,
-    0xe1b497,
-    0xe1b498,
-    0xe1b499,
-    0xe1b49a,
-    0xe1b49b,
-    0xe1b49c,
-    0xe1b49d,
-    0xe1b49e,
-    0xe1b49f,
-    0xe1b4a0,
-    0xe1b4a1,
-    0xe1b4a2,
-    0xe1b4a3,
-    0xe1b4a4,
-    0xe1b4a5,
-    0xe1b4a6,
-    0xe1b4a7,
-    0xe1b4a8,
-    0xe1b4a9,
-    0xe1b4aa,
-    0xe1b4ab,
-    0xe1b4ac,
-    0xe1b4ad,
-    0xe1b4ae,
-    0xe1b4af,
-    0xe1b4b0,
-    0xe1b4b1,
-    0xe1b4b2,
-    0xe1b4b3,
-    0xe1b4b4,
-    0xe1b4b5,
-    0xe1b4b6,
-    0xe1b4b7,
-    0xe1b4b8,
-    0xe1b4b9,
-    0xe1b4ba,
-    0xe1b4bb,
-    0xe1b4bc,
-    0xe1b4bd,
-    0xe1b4be,
-    0xe1b4bf,
-    0xe1b580,
-    0xe1b581,
-    0xe1b582,
-    0xe1b583,
-    0xe1b584,
-    0xe1b585,
-    0xe1b586,
-    0xe1b587,
-    0xe1b588,
-    0xe1b589,
-    0xe1b58a,
-    0xe1b58b,
-    0xe1b58c,
-    0xe1b58d,
-    0xe1b58e,
-    0xe1b58f,
-    0xe1b590,
-    0xe1b591,
-    0xe1b592,
-    0xe1b593,
-    0xe1b594,
-    0xe1b595,
-    0xe1b596,
-    0xe1b597,
-    0xe1b598,
-    0xe1b599,
-    0xe1b59a,
-    0xe1b59b,
-    0xe1b59c,
-    0xe1b59d,
-    0xe1b59e,
-    0xe1b59f,
-    0xe1b5a0,
-    0xe1b5a1,
-    0xe1b5a2,
-    0xe1b5a3,
-    0xe1b5a4,
-    0xe1b5a5,
-    0xe1b5a6,
-    0xe1b5a7,
-    0xe1b5a8,
-    0xe1b5a9,
-    0xe1b5aa,
-    0xe1b5ab,
-    0xe1b5ac,
-    0xe1b5ad,
-    0xe1b5ae,
-    0xe1b5af,
-    0xe1b5b0,
-    0xe1b5b1,
-    0xe1b5b2,
-    0xe1b5b3,
-    0xe1b5b4,
-    0xe1b5b5,
-    0xe1b5b6,
-    0xe1b5b7,
-    0xe1b5b8,
-    0xe1b5b9,
-    0xe1b5ba,
-    0xe1b5bb,
-    0xe1b5bc,
-    0xe1b5bd,
-    0xe1b5be,
-    0xe1b5bf,
-    0xe1b680,
-    0xe1b681,
-    0xe1b682,
-    0xe1b683,
-    0xe1b684,
-    0xe1b685,
-    0xe1b686,
-    0xe1b687,
-    0xe1b688,
-    0xe1b689,
-    0xe1b68a,
-    0xe1b68b,
-    0xe1b68c,
-    0xe1b68d,
-    0xe1b68e,
-    0xe1b68f,
-    0xe1b690,
-    0xe1b691,
-    0xe1b692,
-    0xe1b693,
-    0xe1b694,
-    0xe1b695,
-    0xe1b696,
-    0xe1b697,
-    0xe1b698,
-    0xe1b699,
-    0xe1b69a,
-    0xe1b69b,
-    0xe1b69c,
-    0xe1b69d,
-    0xe1b69e,
-    0xe1b69f,
-    0xe1b6a0,
-    0xe1b6a1,
-    0xe1b6a2,
-    0xe1b6a3,
-    0xe1b6a4,
-    0xe1b6a5,
-    0xe1b6a6,
-    0xe1b6a7,
-    0xe1b6a8,
-    0xe1b6a9,
-    0xe1b6aa,
-    0xe1b6ab,
-    0xe1b6ac,
-    0xe1b6ad,
-    0xe1b6ae,
-    0xe1b6af,
-    0xe1b6b0,
-    0xe1b6b1,
-    0xe1b6b2,
-    0xe1b6b3,
-    0xe1b6b4,
-    0xe1b6b5,
-    0xe1b6b6,
-    0xe1b6b7,
-    0xe1b6b8,
-    0xe1b6b9,
-    0xe1b6ba,
-    0xe1b6bb,
-    0xe1b6bc,
-    0xe1b6bd,
-    0xe1b6be,
-    0xe1b6bf,
-    0xe1b780,
-    0xe1b781,
-    0xe1b782,
-    0xe1b783,
-    0xe1b784,
-    0xe1b785,
-    0xe1b786,
-    0xe1b787,
-    0xe1b788,
-    0xe1b789,
-    0xe1b78a,
-    0xe1b78b,
-    0xe1b78c,
-    0xe1b78d,
-    0xe1b78e,
-    0xe1b78f,
-    0xe1b790,
-    0xe1b791,
-    0xe1b792,
-    0xe1b793,
-    0xe1b794,
-    0xe1b795,
-    0xe1b796,
-    0xe1b797,
-    0xe1b798,
-    0xe1b799,
-    0xe1b79a,
-    0xe1b79b,
-    0xe1b79c,
-    0xe1b79d,
-    0xe1b79e,
-    0xe1b79f,
-    0xe1b7a0,
-    0xe1b7a1,
-    0xe1b7a2,
-    0xe1b7a3,
-    0xe1b7a4,
-    0xe1b7a5,
-    0xe1b7a6,
-    0xe1b7a7,
-    0xe1b7a8,
-    0xe1b7a9,
-    0xe1b7aa,
-    0xe1b7ab,
-    0xe1b7ac,
-    0xe1b7ad,
-    0xe1b7ae,
-    0xe1b7af,
-    0xe1b7b0,
-    0xe1b7b1,
-    0xe1b7b2,
-    0xe1b7b3,
-    0xe1b7b4,
-    0xe1b7b5,
-    0xe1b7b6,
-    0xe1b7b7,
-    0xe1b7b8,
-    0xe1b7b9,
-    0xe1b7ba,
-    0xe1b7bb,
-    0xe1b7bc,
-    0xe1b7bd,
-    0xe1b7be,
-    0xe1b7bf,
-    0xe1b880,
-    0xe1b881,
-    0xe1b882,
-    0xe1b883,
-    0xe1b884,
-    0xe1b885,
-    0xe1b886,
-    0xe1b887,
-    0xe1b888,
-    0xe1b889,
-    0xe1b88a,
-    0xe1b88b,
-    0xe1b88c,
-    0xe1b88d,
-    0xe1b88e,
-    0xe1b88f,
-    0xe1b890,
-    0xe1b891,
-    0xe1b892,
-    0xe1b893,
-    0xe1b894,
-    0xe1b895,
-    0xe1b896,
-    0xe1b897,
-    0xe1b898,
-    0xe1b899,
-    0xe1b89a,
-    0xe1b89b,
-    0xe1b89c,
-    0xe1b89d,
-    0xe1b89e,
-    0xe1b89f,
-    0xe1b8a0,
-    0xe1b8a1,
-    0xe1b8a2,
-    0xe1b8a3,
-    0xe1b8a4,
-    0xe1b8a5,
-    0xe1b8a6,
-    0xe1b8a7,
-    0xe1b8a8,
-    0xe1b8a9,
-    0xe1b8aa,
-    0xe1b8ab,
-    0xe1b8ac,
-    0xe1b8ad,
-    0xe1b8ae,
-    0xe1b8af,
-    0xe1b8b0,
-    0xe1b8b1,
-    0xe1b8b2,
-    0xe1b8b3,
-    0xe1b8b4,
-    0xe1b8b5,
-    0xe1b8b6,
-    0xe1b8b7,
-    0xe1b8b8,
-    0xe1b8b9,
-    0xe1b8ba,
-    0xe1b8bb,
-    0xe1b8bc,
-    0xe1b8bd,
-    0xe1b8be,
-    0xe1b8bf,
-    0xe1b980,
-    0xe1b981,
-    0xe1b982,
-    0xe1b983,
-    0xe1b984,
-    0xe1b985,
-    0xe1b986,
-    0xe1b987,
-    0xe1b988,
-    0xe1b989,
-    0xe1b98a,
-    0xe1b98b,
-    0xe1b98c,
-    0xe1b98d,
-    0xe1b98e,
-    0xe1b98f,
-    0xe1b990,
-    0xe1b991,
-    0xe1b992,
-    0xe1b993,
-    0xe1b994,
-    0xe1b995,
-    0xe1b996,
-    0xe1b997,
-    0xe1b998,
-    0xe1b999,
-    0xe1b99a,
-    0xe1b99b,
-    0xe1b99c,
-    0xe1b99d,
-    0xe1b99e,
-    0xe1b99f,
-    0xe1b9a0,
-    0xe1b9a1,
-    0xe1b9a2,
-    0xe1b9a3,
-    0xe1b9a4,
-    0xe1b9a5,
-    0xe1b9a6,
-    0xe1b9a7,
-    0xe1b9a8,
-    0xe1b9a9,
-    0xe1b9aa,
-    0xe1b9ab,
-    0xe1b9ac,
-    0xe1b9ad,
-    0xe1b9ae,
-    0xe1b9af,
-    0xe1b9b0,
-    0xe1b9b1,
-    0xe1b9b2,
-    0xe1b9b3,
-    0xe1b9b4,
-    0xe1b9b5,
-    0xe1b9b6,
-    0xe1b9b7,
-    0xe1b9b8,
-    0xe1b9b9,
-    0xe1b9ba,
-    0xe1b9bb,
-    0xe1b9bc,
-    0xe1b9bd,
-    0xe1b9be,
-    0xe1b9bf,
-    0xe1ba80,
-    0xe1ba81,
-    0xe1ba82,
-    0xe1ba83,
-    0xe1ba84,
-    0xe1ba85,
-    0xe1ba86,
-    0xe1ba87,
-    0xe1ba88,
-    0xe1ba89,
-    0xe1ba8a,
-    0xe1ba8b,
-    0xe1ba8c,
-    0xe1ba8d,
-    0xe1ba8e,
-    0xe1ba8f,
-    0xe1ba90,
-    0xe1ba91,
-    0xe1ba92,
-    0xe1ba93,
-    0xe1ba94,
-    0xe1ba95,
-    0xe1ba96,
-    0xe1ba97,
-    0xe1ba98,
-    0xe1ba99,
-    0xe1ba9a,
-    0xe1ba9b,
-    0xe1ba9c,
-    0xe1ba9d,
-    0xe1ba9e,
-    0xe1ba9f,
-    0xe1baa0,
-    0xe1baa1,
-    0xe1baa2,
-    0xe1baa3,
-    0xe1baa4,
-    0xe1baa5,
-    0xe1baa6,
-    0xe1baa7,
-    0xe1baa8,
-    0xe1baa9,
-    0xe1baaa,
-    0xe1baab,
-    0xe1baac,
-    0xe1baad,
-    0xe1baae,
-    0xe1baaf,
-    0xe1bab0,
-    0xe1bab1,
-    0xe1bab2,
-    0xe1bab3,
-    0xe1bab4,
-    0xe1bab5,
-    0xe1bab6,
-    0xe1bab7,
-    0xe1bab8,
-    0xe1bab9,
-    0xe1baba,
-    0xe1babb,
-    0xe1babc,
-    0xe1babd,
-    0xe1babe,
-    0xe1babf,
-    0xe1bb80,
-    0xe1bb81,
-    0xe1bb82,
-    0xe1bb83,
-    0xe1bb84,
-    0xe1bb85,
-    0xe1bb86,
-    0xe1bb87,
-    0xe1bb88,
-    0xe1bb89,
-    0xe1bb8a,
-    0xe1bb8b,
-    0xe1bb8c,
-    0xe1bb8d,
-    0xe1bb8e,
-    0xe1bb8f,
-    0xe1bb90,
-    0xe1bb91,
-    0xe1bb92,
-    0xe1bb93,
-    0xe1bb94,
-    0xe1bb95,
-    0xe1bb96,
-    0xe1bb97,
-    0xe1bb98,
-    0xe1bb99,
-    0xe1bb9a,
-    0xe1bb9b,
-    0xe1bb9c,
-    0xe1bb9d,
-    0xe1bb9e,
-    0xe1bb9f,
-    0xe1bba0,
-    0xe1bba1,
-    0xe1bba2,
-    0xe1bba3,
-    0xe1bba4,
-    0xe1bba5,
-    0xe1bba6,
-    0xe1bba7,
-    0xe1bba8,
-    0xe1bba9,
-    0xe1bbaa,
-    0xe1bbab,
-    0xe1bbac,
-    0xe1bbad,
-    0xe1bbae,
-    0xe1bbaf,
-    0xe1bbb0,
-    0xe1bbb1,
-    0xe1bbb2,
-    0xe1bbb3,
-    0xe1bbb4,
-    0xe1bbb5,
-    0xe1bbb6,
-    0xe1bbb7,
-    0xe1bbb8,
-    0xe1bbb9,
-    0xe1bbba,
-    0xe1bbbb,
-    0xe1bbbc,
-    0xe1bbbd,
-    0xe1bbbe,
-    0xe1bbbf,
-    0xe1bc80,
-    0xe1bc81,
-    0xe1bc82,
-    0xe1bc83,
-    0xe1bc84,
-    0xe1bc85,
-    0xe1bc86,
-    0xe1bc87,
-    0xe1bc88,
-    0xe1bc89,
-    0xe1bc8a,
-    0xe1bc8b,
-    0xe1bc8c,
-    0xe1bc8d,
-    0xe1bc8e,
-    0xe1bc8f,
-    0xe1bc90,
-    0xe1bc91,
-    0xe1bc92,
-    0xe1bc93,
-    0xe1bc94,
-    0xe1bc95,
-    0xe1bc96,
-    0xe1bc97,
-    0xe1bc98,
-    0xe1bc99,
-    0xe1bc9a,
-    0xe1bc9b,
-    0xe1bc9c,
-    0xe1bc9d,
-    0xe1bc9e,
-    0xe1bc9f,
-    0xe1bca0,
-    0xe1bca1,
-    0xe1bca2,
-    0xe1bca3,
-    0xe1bca4,
-    0xe1bca5,
-    0xe1bca6,
-    0xe1bca7,
-    0xe1bca8,
-    0xe1bca9,
-    0xe1bcaa,
-    0xe1bcab,
-    0xe1bcac,
-    0xe1bcad,
-    0xe1bcae,
-    0xe1bcaf,
-    0xe1bcb0,
-    0xe1bcb1,
-    0xe1bcb2,
-    0xe1bcb3,
-    0xe1bcb4,
-    0xe1bcb5,
-    0xe1bcb6,
-    0xe1bcb7,
-    0xe1bcb8,
-    0xe1bcb9,
-    0xe1bcba,
-    0xe1bcbb,
-    0xe1bcbc,
-    0xe1bcbd,
-    0xe1bcbe,
-    0xe1bcbf,
-    0xe1bd80,
-    0xe1bd81,
-    0xe1bd82,
-    0xe1bd83,
-    0xe1bd84,
-    0xe1bd85,
-    0xe1bd86,
-    0xe1bd87,
-    0xe1bd88,
-    0xe1bd89,
-    0xe1bd8a,
-    0xe1bd8b,
-    0xe1bd8c,
-    0xe1bd8d,
-    0xe1bd8e,
-    0xe1bd8f,
-    0xe1bd90,
-    0xe1bd91,
-    0xe1bd92,
-    0xe1bd93,
-    0xe1bd94,
-    0xe1bd95,
-    0xe1bd96,
-    0xe1bd97,
-    0xe1bd98,
-    0xe1bd99,
-    0xe1bd9a,
-    0xe1bd9b,
-    0xe1bd9c,
-    0xe1bd9d,
-    0xe1bd9e,
-    0xe1bd9f,
-    0xe1bda0,
-    0xe1bda1,
-    0xe1bda2,
-    0xe1bda3,
-    0xe1bda4,
-    0xe1bda5,
-    0xe1bda6,
-    0xe1bda7,
-    0xe1bda8,
-    0xe1bda9,
-    0xe1bdaa,
-    0xe1bdab,
-    0xe1bdac,
-    0xe1bdad,
-    0xe1bdae,
-    0xe1bdaf,
-    0xe1bdb0,
-    0xe1bdb1,
-    0xe1bdb2,
-    0xe1bdb3,
-    0xe1bdb4,
-    0xe1bdb5,
-    0xe1bdb6,
-    0xe1bdb7,
-    0xe1bdb8,
-    0xe1bdb9,
-    0xe1bdba,
-    0xe1bdbb,
-    0xe1bdbc,
-    0xe1bdbd,
-    0xe1bdbe,
-    0xe1bdbf,
-    0xe1be80,
-    0xe1be81,
-    0xe1be82,
-    0xe1be83,
-    0xe1be84,
-    0xe1be85,
-    0xe1be86,
-    0xe1be87,
-    0xe1be88,
-    0xe1be89,
-    0xe1be8a,
-    0xe1be8b,
-    0xe1be8c,
-    0xe1be8d,
-    0xe1be8e,
-    0xe1be8f,
-    0xe1be90,
-    0xe1be91,
-    0xe1be92,
-    0xe1be93,
-    0xe1be94,
-    0xe1be95,
-    0xe1be96,
-    0xe1be97,
-    0xe1be98,
-    0xe1be99,
-    0xe1be9a,
-    0xe1be9b,
-    0xe1be9c,
-    0xe1be9d,
-    0xe1be9e,
-    0xe1be9f,
-    0xe1bea0,
-    0xe1bea1,
-    0xe1bea2,
-    0xe1bea3,
-    0xe1bea4,
-    0xe1bea5,
-    0xe1bea6,
-    0xe1bea7,
-    0xe1bea8,
-    0xe1bea9,
-    0xe1beaa,
-    0xe1beab,
-    0xe1beac,
-    0xe1bead,
-    0xe1beae,
-    0xe1beaf,
-    0xe1beb0,
-    0xe1beb1,
-    0xe1beb2,
-    0xe1beb3,
-    0xe1beb4,
-    0xe1beb5,
-    0xe1beb6,
-    0xe1beb7,
-    0xe1beb8,
-    0xe1beb9,
-    0xe1beba,
-    0xe1bebb,
-    0xe1bebc,
-    0xe1bebd,
-    0xe1bebe,
-    0xe1bebf,
-    0xe1bf80,
-    0xe1bf81,
-    0xe1bf82,
-    0xe1bf83,
-    0xe1bf84,
-    0xe1bf85,
-    0xe1bf86,
-    0xe1bf87,
-    0xe1bf88,
-    0xe1bf89,
-    0xe1bf8a,
-    0xe1bf8b,
-    0xe1bf8c,
-    0xe1bf8d,
-    0xe1bf8e,
-    0xe1bf8f,
-    0xe1bf90,
-    0xe1bf91,
-    0xe1bf92,
-    0xe1bf93,
-    0xe1bf94,
-    0xe1bf95,
-    0xe1bf96,
-    0xe1bf97,
-    0xe1bf98,
-    0xe1bf99,
-    0xe1bf9a,
-    0xe1bf9b,
-    0xe1bf9c,
-    0xe1bf9d,
-    0xe1bf9e,
-    0xe1bf9f,
-    0xe1bfa0,
-    0xe1bfa1,
-    0xe1bfa2,
-    0xe1bfa3,
-    0xe1bfa4,
-    0xe1bfa5,
-    0xe1bfa6,
-    0xe1bfa7,
-    0xe1bfa8,
-    0xe1bfa9,
-    0xe1bfaa,
-    0xe1bfab,
-    0xe1bfac,
-    0xe1bfad,
-    0xe1bfae,
-    0xe1bfaf,
-    0xe1bfb0,
-    0xe1bfb1,
-    0xe1bfb2,
-    0xe1bfb3,
-    0xe1bfb4,
-    0xe1bfb5,
-    0xe1bfb6,
-    0xe1bfb7,
-    0xe1bfb8,
-    0xe1bfb9,
-    0xe1bfba,
-    0xe1bfbb,
-    0xe1bfbc,
-    0xe1bfbd,
-    0xe1bfbe,
-    0xe1bfbf,
-    0xe28080,
-    0xe28081,
-    0xe28082,
-    0xe28083,
-    0xe28084,
-    0xe28085,
-    0xe28086,
-    0xe28087,
-    0xe28088,
-    0xe28089,
-    0xe2808a,
-    0xe2808b,
-    0xe2808c,
-    0xe2808d,
-    0xe2808e,
-    0xe2808f,
-    0xe28090,
-    0xe28091,
-    0xe28092,
-    0xe28093,
-    0xe28094,
-    0xe28095,
-    0xe28096,
-    0xe28097,
-    0xe28098,
-    0xe28099,
-    0xe2809a,
-    0xe2809b,
-    0xe2809c,
-    0xe2809d,
-    0xe2809e,
-    0xe2809f,
-    0xe280a0,
-    0xe280a1,
-    0xe280a2,
-    0xe280a3,
-    0xe280a4,
-    0xe280a5,
-    0xe280a6,
-    0xe280a7,
-    0xe280a8,
-    0xe280a9,
-    0xe280aa,
-    0xe280ab,
-    0xe280ac,
-    0xe280ad,
-    0xe280ae,
-    0xe280af,
-    0xe280b0,
-    0xe280b1,
-    0xe280b2,
-    0xe280b3,
-    0xe280b4,
-    0xe280b5,
-    0xe280b6,
-    0xe280b7,
-    0xe280b8,
-    0xe280b9,
-    0xe280ba,
-    0xe280bb,
-    0xe280bc,
-    0xe280bd,
-    0xe280be,
-    0xe280bf,
-    0xe28180,
-    0xe28181,
-    0xe28182,
-    0xe28183,
-    0xe28184,
-    0xe28185,
-    0xe28186,
-    0xe28187,
-    0xe28188,
-    0xe28189,
-    0xe2818a,
-    0xe2818b,
-    0xe2818c,
-    0xe2818d,
-    0xe2818e,
-    0xe2818f,
-    0xe28190,
-    0xe28191,
-    0xe28192,
-    0xe28193,
-    0xe28194,
-    0xe28195,
-    0xe28196,
-    0xe28197,
-    0xe28198,
-    0xe28199,
-    0xe2819a,
-    0xe2819b,
-    0xe2819c,
-    0xe2819d,
-    0xe2819e,
-    0xe2819f,
-    0xe281a0,
-    0xe281a1,
-    0xe281a2,
-    0xe281a3,
-    0xe281a4,
-    0xe281a5,
-    0xe281a6,
-    0xe281a7,
-    0xe281a8,
-    0xe281a9,
-    0xe281aa,
-    0xe281ab,
-    0xe281ac,
-    0xe281ad,
-    0xe281ae,
-    0xe281af,
-    0xe281b0,
-    0xe281b1,
-    0xe281b2,
-    0xe281b3,
-    0xe281b4,
-    0xe281b5,
-    0xe281b6,
-    0xe281b7,
-    0xe281b8,
-    0xe281b9,
-    0xe281ba,
-    0xe281bb,
-    0xe281bc,
-    0xe281bd,
-    0xe281be,
-    0xe281bf,
-    0xe28280,
-    0xe28281,
-    0xe28282,
-    0xe28283,
-    0xe28284,
-    0xe28285,
-    0xe28286,
-    0xe28287,
-    0xe28288,
-    0xe28289,
-    0xe2828a,
-    0xe2828b,
-    0xe2828c,
-    0xe2828d,
-    0xe2828e,
-    0xe2828f,
-    0xe28290,
-    0xe28291,
-    0xe28292,
-    0xe28293,
-    0xe28294,
-    0xe28295,
-    0xe28296,
-    0xe28297,
-    0xe28298,
-    0xe28299,
-    0xe2829a,
-    0xe2829b,
-    0xe2829c,
-    0xe2829d,
-    0xe2829e,
-    0xe2829f,
-    0xe282a0,
-    0xe282a1,
-    0xe282a2,
-    0xe282a3,
-    0xe282a4,
-    0xe282a5,
-    0xe282a6,
-    0xe282a7,
-    0xe282a8,
-    0xe282a9,
-    0xe282aa,
-    0xe282ab,
-    0xe282ac,
-    0xe282ad,
-    0xe282ae,
-    0xe282af,
-    0xe282b0,
-    0xe282b1,
-    0xe282b2,
-    0xe282b3,
-    0xe282b4,
-    0xe282b5,
-    0xe282b6,
-    0xe282b7,
-    0xe282b8,
-    0xe282b9,
-    0xe282ba,
-    0xe282bb,
-    0xe282bc,
-    0xe282bd,
-    0xe282be,
-    0xe282bf,
-    0xe28380,
-    0xe28381,
-    0xe28382,
-    0xe28383,
-    0xe28384,
-    0xe28385,
-    0xe28386,
-    0xe28387,
-    0xe28388,
-    0xe28389,
-    0xe2838a,
-    0xe2838b,
-    0xe2838c,
-    0xe2838d,
-    0xe2838e,
-    0xe2838f,
-    0xe28390,
-    0xe28391,
-    0xe28392,
-    0xe28393,
-    0xe28394,
-    0xe28395,
-    0xe28396,
-    0xe28397,
-    0xe28398,
-    0xe28399,
-    0xe2839a,
-    0xe2839b,
-    0xe2839c,
-    0xe2839d,
-    0xe2839e,
-    0xe2839f,
-    0xe283a0,
-    0xe283a1,
-    0xe283a2,
-    0xe283a3,
-    0xe283a4,
-    0xe283a5,
-    0xe283a6,
-    0xe283a7,
-    0xe283a8,
-    0xe283a9,
-    0xe283aa,
-    0xe283ab,
-    0xe283ac,
-    0xe283ad,
-    0xe283ae,
-    0xe283af,
-    0xe283b0,
-    0xe283b1,
-    0xe283b2,
-    0xe283b3,
-    0xe283b4,
-    0xe283b5,
-    0xe283b6,
-    0xe283b7,
-    0xe283b8,
-    0xe283b9,
-    0xe283ba,
-    0xe283bb,
-    0xe283bc,
-    0xe283bd,
-    0xe283be,
-    0xe283bf,
-    0xe28480,
-    0xe28481,
-    0xe28482,
-    0xe28483,
-    0xe28484,
-    0xe28485,
-    0xe28486,
-    0xe28487,
-    0xe28488,
-    0xe28489,
-    0xe2848a,
-    0xe2848b,
-    0xe2848c,
-    0xe2848d,
-    0xe2848e,
-    0xe2848f,
-    0xe28490,
-    0xe28491,
-    0xe28492,
-    0xe28493,
-    0xe28494,
-    0xe28495,
-    0xe28496,
-    0xe28497,
-    0xe28498,
-    0xe28499,
-    0xe2849a,
-    0xe2849b,
-    0xe2849c,
-    0xe2849d,
-    0xe2849e,
-    0xe2849f,
-    0xe284a0,
-    0xe284a1,
-    0xe284a2,
-    0xe284a3,
-    0xe284a4,
-    0xe284a5,
-    0xe284a6,
-    0xe284a7,
-    0xe284a8,
-    0xe284a9,
-    0xe284aa,
-    0xe284ab,
-    0xe284ac,
-    0xe284ad,
-    0xe284ae,
-    0xe284af,
-    0xe284b0,
-    0xe284b1,
-    0xe284b2,
-    0xe284b3,
-    0xe284b4,
-    0xe284b5,
-    0xe284b6,
-    0xe284b7,
-    0xe284b8,
-    0xe284b9,
-    0xe284ba,
-    0xe284bb,
-    0xe284bc,
-    0xe284bd,
-    0xe284be,
-    0xe284bf,
-    0xe28580,
-    0xe28581,
-    0xe28582,
-    0xe28583,
-    0xe28584,
-    0xe28585,
-    0xe28586,
-    0xe28587,
-    0xe28588,
-    0xe28589,
-    0xe2858a,
-    0xe2858b,
-    0xe2858c,
-    0xe2858d,
-    0xe2858e,
-    0xe2858f,
-    0xe28590,
-    0xe28591,
-    0xe28592,
-    0xe28593,
-    0xe28594,
-    0xe28595,
-    0xe28596,
-    0xe28597,
-    0xe28598,
-    0xe28599,
-    0xe2859a,
-    0xe2859b,
-    0xe2859c,
-    0xe2859d,
-    0xe2859e,
-    0xe2859f,
-    0xe285a0,
-    0xe285a1,
-    0xe285a2,
-    0xe285a3,
-    0xe285a4,
-    0xe285a5,
-    0xe285a6,
-    0xe285a7,
-    0xe285a8,
-    0xe285a9,
-    0xe285aa,
-    0xe285ab,
-    0xe285ac,
-    0xe285ad,
-    0xe285ae,
-    0xe285af,
-    0xe285b0,
-    0xe285b1,
-    0xe285b2,
-    0xe285b3,
-    0xe285b4,
-    0xe285b5,
-    0xe285b6,
-    0xe285b7,
-    0xe285b8,
-    0xe285b9,
-    0xe285ba,
-    0xe285bb,
-    0xe285bc,
-    0xe285bd,
-    0xe285be,
-    0xe285bf,
-    0xe28680,
-    0xe28681,
-    0xe28682,
-    0xe28683,
-    0xe28684,
-    0xe28685,
-    0xe28686,
-    0xe28687,
-    0xe28688,
-    0xe28689,
-    0xe2868a,
-    0xe2868b,
-    0xe2868c,
-    0xe2868d,
-    0xe2868e,
-    0xe2868f,
-    0xe28690,
-    0xe28691,
-    0xe28692,
-    0xe28693,
-    0xe28694,
-    0xe28695,
-    0xe28696,
-    0xe28697,
-    0xe28698,
-    0xe28699,
-    0xe2869a,
-    0xe2869b,
-    0xe2869c,
-    0xe2869d,
-    0xe2869e,
-    0xe2869f,
-    0xe286a0,
-    0xe286a1,
-    0xe286a2,
-    0xe286a3,
-    0xe286a4,
-    0xe286a5,
-    0xe286a6,
-    0xe286a7,
-    0xe286a8,
-    0xe286a9,
-    0xe286aa,
-    0xe286ab,
-    0xe286ac,
-    0xe286ad,
-    0xe286ae,
-    0xe286af,
-    0xe286b0,
-    0xe286b1,
-    0xe286b2,
-    0xe286b3,
-    0xe286b4,
-    0xe286b5,
-    0xe286b6,
-    0xe286b7,
-    0xe286b8,
-    0xe286b9,
-    0xe286ba,
-    0xe286bb,
-    0xe286bc,
-    0xe286bd,
-    0xe286be,
-    0xe286bf,
-    0xe28780,
-    0xe28781,
-    0xe28782,
-    0xe28783,
-    0xe28784,
-    0xe28785,
-    0xe28786,
-    0xe28787,
-    0xe28788,
-    0xe28789,
-    0xe2878a,
-    0xe2878b,
-    0xe2878c,
-    0xe2878d,
-    0xe2878e,
-    0xe2878f,
-    0xe28790,
-    0xe28791,
-    0xe28792,
-    0xe28793,
-    0xe28794,
-    0xe28795,
-    0xe28796,
-    0xe28797,
-    0xe28798,
-    0xe28799,
-    0xe2879a,
-    0xe2879b,
-    0xe2879c,
-    0xe2879d,
-    0xe2879e,
-    0xe2879f,
-    0xe287a0,
-    0xe287a1,
-    0xe287a2,
-    0xe287a3,
-    0xe287a4,
-    0xe287a5,
-    0xe287a6,
-    0xe287a7,
-    0xe287a8,
-    0xe287a9,
-    0xe287aa,
-    0xe287ab,
-    0xe287ac,
-    0xe287ad,
-    0xe287ae,
-    0xe287af,
-    0xe287b0,
-    0xe287b1,
-    0xe287b2,
-    0xe287b3,
-    0xe287b4,
-    0xe287b5,
-    0xe287b6,
-    0xe287b7,
-    0xe287b8,
-    0xe287b9,
-    0xe287ba,
-    0xe287bb,
-    0xe287bc,
-    0xe287bd,
-    0xe287be,
-    0xe287bf,
-    0xe28880,
-    0xe28881,
-    0xe28882,
-    0xe28883,
-    0xe28884,
-    0xe28885,
-    0xe28886,
-    0xe28887,
-    0xe28888,
-    0xe28889,
-    0xe2888a,
-    0xe2888b,
-    0xe2888c,
-    0xe2888d,
-    0xe2888e,
-    0xe2888f,
-    0xe28890,
-    0xe28891,
-    0xe28892,
-    0xe28893,
-    0xe28894,
-    0xe28895,
-    0xe28896,
-    0xe28897,
-    0xe28898,
-    0xe28899,
-    0xe2889a,
-    0xe2889b,
-    0xe2889c,
-    0xe2889d,
-    0xe2889e,
-    0xe2889f,
-    0xe288a0,
-    0xe288a1,
-    0xe288a2,
-    0xe288a3,
-    0xe288a4,
-    0xe288a5,
-    0xe288a6,
-    0xe288a7,
-    0xe288a8,
-    0xe288a9,
-    0xe288aa,
-    0xe288ab,
-    0xe288ac,
-    0xe288ad,
-    0xe288ae,
-    0xe288af,
-    0xe288b0,
-    0xe288b1,
-    0xe288b2,
-    0xe288b3,
-    0xe288b4,
-    0xe288b5,
-    0xe288b6,
-    0xe288b7,
-    0xe288b8,
-    0xe288b9,
-    0xe288ba,
-    0xe288bb,
-    0xe288bc,
-    0xe288bd,
-    0xe288be,
-    0xe288bf,
-    0xe28980,
-    0xe28981,
-    0xe28982,
-    0xe28983,
-    0xe28984,
-    0xe28985,
-    0xe28986,
-    0xe28987,
-    0xe28988,
-    0xe28989,
-    0xe2898a,
-    0xe2898b,
-    0xe2898c,
-    0xe2898d,
-    0xe2898e,
-    0xe2898f,
-    0xe28990,
-    0xe28991,
-    0xe28992,
-    0xe28993,
-    0xe28994,
-    0xe28995,
-    0xe28996,
-    0xe28997,
-    0xe28998,
-    0xe28999,
-    0xe2899a,
-    0xe2899b,
-    0xe2899c,
-    0xe2899d,
-    0xe2899e,
-    0xe2899f,
-    0xe289a0,
-    0xe289a1,
-    0xe289a2,
-    0xe289a3,
-    0xe289a4,
-    0xe289a5,
-    0xe289a6,
-    0xe289a7,
-    0xe289a8,
-    0xe289a9,
-    0xe289aa,
-    0xe289ab,
-    0xe289ac,
-    0xe289ad,
-    0xe289ae,
-    0xe289af,
-    0xe289b0,
-    0xe289b1,
-    0xe289b2,
-    0xe289b3,
-    0xe289b4,
-    0xe289b5,
-    0xe289b6,
-    0xe289b7,
-    0xe289b8,
-    0xe289b9,
-    0xe289ba,
-    0xe289bb,
-    0xe289bc,
-    0xe289bd,
-    0xe289be,
-    0xe289bf,
-    0xe28a80,
-    0xe28a81,
-    0xe28a82,
-    0xe28a83,
-    0xe28a84,
-    0xe28a85,
-    0xe28a86,
-    0xe28a87,
-    0xe28a88,
-    0xe28a89,
-    0xe28a8a,
-    0xe28a8b,
-    0xe28a8c,
-    0xe28a8d,
-    0xe28a8e,
-    0xe28a8f,
-    0xe28a90,
-    0xe28a91,
-    0xe28a92,
-    0xe28a93,
-    0xe28a94,
-    0xe28a95,
-    0xe28a96,
-    0xe28a97,
-    0xe28a98,
-    0xe28a99,
-    0xe28a9a,
-    0xe28a9b,
-    0xe28a9c,
-    0xe28a9d,
-    0xe28a9e,
-    0xe28a9f,
-    0xe28aa0,
-    0xe28aa1,
-    0xe28aa2,
-    0xe28aa3,
-    0xe28aa4,
-    0xe28aa5,
-    0xe28aa6,
-    0xe28aa7,
-    0xe28aa8,
-    0xe28aa9,
-    0xe28aaa,
-    0xe28aab,
-    0xe28aac,
-    0xe28aad,
-    0xe28aae,
-    0xe28aaf,
-    0xe28ab0,
-    0xe28ab1,
-    0xe28ab2,
-    0xe28ab3,
-    0xe28ab4,
-    0xe28ab5,
-    0xe28ab6,
-    0xe28ab7,
-    0xe28ab8,
-    0xe28ab9,
-    0xe28aba,
-    0xe28abb,
-    0xe28abc,
-    0xe28abd,
-    0xe28abe,
-    0xe28abf,
-    0xe28b80,
-    0xe28b81,
-    0xe28b82,
-    0xe28b83,
-    0xe28b84,
-    0xe28b85,
-    0xe28b86,
-    0xe28b87,
-    0xe28b88,
-    0xe28b89,
-    0xe28b8a,
-    0xe28b8b,
-    0xe28b8c,
-    0xe28b8d,
-    0xe28b8e,
-    0xe28b8f,
-    0xe28b90,
-    0xe28b91,
-    0xe28b92,
-    0xe28b93,
-    0xe28b94,
-    0xe28b95,
-    0xe28b96,
-    0xe28b97,
-    0xe28b98,
-    0xe28b99,
-    0xe28b9a,
-    0xe28b9b,
-    0xe28b9c,
-    0xe28b9d,
-    0xe28b9e,
-    0xe28b9f,
-    0xe28ba0,
-    0xe28ba1,
-    0xe28ba2,
-    0xe28ba3,
-    0xe28ba4,
-    0xe28ba5,
-    0xe28ba6,
-    0xe28ba7,
-    0xe28ba8,
-    0xe28ba9,
-    0xe28baa,
-    0xe28bab,
-    0xe28bac,
-    0xe28bad,
-    0xe28bae,
-    0xe28baf,
-    0xe28bb0,
-    0xe28bb1,
-    0xe28bb2,
-    0xe28bb3,
-    0xe28bb4,
-    0xe28bb5,
-    0xe28bb6,
-    0xe28bb7,
-    0xe28bb8,
-    0xe28bb9,
-    0xe28bba,
-    0xe28bbb,
-    0xe28bbc,
-    0xe28bbd,
-    0xe28bbe,
-    0xe28bbf,
-    0xe28c80,
-    0xe28c81,
-    0xe28c82,
-    0xe28c83,
-    0xe28c84,
-    0xe28c85,
-    0xe28c86,
-    0xe28c87,
-    0xe28c88,
-    0xe28c89,
-    0xe28c8a,
-    0xe28c8b,
-    0xe28c8c,
-    0xe28c8d,
-    0xe28c8e,
-    0xe28c8f,
-    0xe28c90,
-    0xe28c91,
-    0xe28c92,
-    0xe28c93,
-    0xe28c94,
-    0xe28c95,
-    0xe28c96,
-    0xe28c97,
-    0xe28c98,
-    0xe28c99,
-    0xe28c9a,
-    0xe28c9b,
-    0xe28c9c,
-    0xe28c9d,
-    0xe28c9e,
-    0xe28c9f,
-    0xe28ca0,
-    0xe28ca1,
-    0xe28ca2,
-    0xe28ca3,
-    0xe28ca4,
-    0xe28ca5,
-    0xe28ca6,
-    0xe28ca7,
-    0xe28ca8,
-    0xe28ca9,
-    0xe28caa,
-    0xe28cab,
-    0xe28cac,
-    0xe28cad,
-    0xe28cae,
-    0xe28caf,
-    0xe28cb0,
-    0xe28cb1,
-    0xe28cb2,
-    0xe28cb3,
-    0xe28cb4,
-    0xe28cb5,
-    0xe28cb6,
-    0xe28cb7,
-    0xe28cb8,
-    0xe28cb9,
-    0xe28cba,
-    0xe28cbb,
-    0xe28cbc,
-    0xe28cbd,
-    0xe28cbe,
-    0xe28cbf,
-    0xe28d80,
-    0xe28d81,
-    0xe28d82,
-    0xe28d83,
-    0xe28d84,
-    0xe28d85,
-    0xe28d86,
-    0xe28d87,
-    0xe28d88,
-    0xe28d89,
-    0xe28d8a,
-    0xe28d8b,
-    0xe28d8c,
-    0xe28d8d,
-    0xe28d8e,
-    0xe28d8f,
-    0xe28d90,
-    0xe28d91,
-    0xe28d92,
-    0xe28d93,
-    0xe28d94,
-    0xe28d95,
-    0xe28d96,
-    0xe28d97,
-    0xe28d98,
-    0xe28d99,
-    0xe28d9a,
-    0xe28d9b,
-    0xe28d9c,
-    0xe28d9d,
-    0xe28d9e,
-    0xe28d9f,
-    0xe28da0,
-    0xe28da1,
-    0xe28da2,
-    0xe28da3,
-    0xe28da4,
-    0xe28da5,
-    0xe28da6,
-    0xe28da7,
-    0xe28da8,
-    0xe28da9,
-    0xe28daa,
-    0xe28dab,
-    0xe28dac,
-    0xe28dad,
-    0xe28dae,
-    0xe28daf,
-    0xe28db0,
-    0xe28db1,
-    0xe28db2,
-    0xe28db3,
-    0xe28db4,
-    0xe28db5,
-    0xe28db6,
-    0xe28db7,
-    0xe28db8,
-    0xe28db9,
-    0xe28dba,
-    0xe28dbb,
-    0xe28dbc,
-    0xe28dbd,
-    0xe28dbe,
-    0xe28dbf,
-    0xe28e80,
-    0xe28e81,
-    0xe28e82,
-    0xe28e83,
-    0xe28e84,
-    0xe28e85,
-    0xe28e86,
-    0xe28e87,
-    0xe28e88,
-    0xe28e89,
-    0xe28e8a,
-    0xe28e8b,
-    0xe28e8c,
-    0xe28e8d,
-    0xe28e8e,
-    0xe28e8f,
-    0xe28e90,
-    0xe28e91,
-    0xe28e92,
-    0xe28e93,
-    0xe28e94,
-    0xe28e95,
-    0xe28e96,
-    0xe28e97,
-    0xe28e98,
-    0xe28e99,
-    0xe28e9a,
-    0xe28e9b,
-    0xe28e9c,
-    0xe28e9d,
-    0xe28e9e,
-    0xe28e9f,
-    0xe28ea0,
-    0xe28ea1,
-    0xe28ea2,
-    0xe28ea3,
-    0xe28ea4,
-    0xe28ea5,
-    0xe28ea6,
-    0xe28ea7,
-    0xe28ea8,
-    0xe28ea9,
-    0xe28eaa,
-    0xe28eab,
-    0xe28eac,
-    0xe28ead,
-    0xe28eae,
-    0xe28eaf,
-    0xe28eb0,
-    0xe28eb1,
-    0xe28eb2,
-    0xe28eb3,
-    0xe28eb4,
-    0xe28eb5,
-    0xe28eb6,
-    0xe28eb7,
-    0xe28eb8,
-    0xe28eb9,
-    0xe28eba,
-    0xe28ebb,
-    0xe28ebc,
-    0xe28ebd,
-    0xe28ebe,
-    0xe28ebf,
-    0xe28f80,
-    0xe28f81,
-    0xe28f82,
-    0xe28f83,
-    0xe28f84,
-    0xe28f85,
-    0xe28f86,
-    0xe28f87,
-    0xe28f88,
-    0xe28f89,
-    0xe28f8a,
-    0xe28f8b,
-    0xe28f8c,
-    0xe28f8d,
-    0xe28f8e,
-    0xe28f8f,
-    0xe28f90,
-    0xe28f91,
-    0xe28f92,
-    0xe28f93,
-    0xe28f94,
-    0xe28f95,
-    0xe28f96,
-    0xe28f97,
-    0xe28f98,
-    0xe28f99,
-    0xe28f9a,
-    0xe28f9b,
-    0xe28f9c,
-    0xe28f9d,
-    0xe28f9e,
-    0xe28f9f,
-    0xe28fa0,
-    0xe28fa1,
-    0xe28fa2,
-    0xe28fa3,
-    0xe28fa4,
-    0xe28fa5,
-    0xe28fa6,
-    0xe28fa7,
-    0xe28fa8,
-    0xe28fa9,
-    0xe28faa,
-    0xe28fab,
-    0xe28fac,
-    0xe28fad,
-    0xe28fae,
-    0xe28faf,
-    0xe28fb0,
-    0xe28fb1,
-    0xe28fb2,
-    0xe28fb3,
-    0xe28fb4,
-    0xe28fb5,
-    0xe28fb6,
-    0xe28fb7,
-    0xe28fb8,
-    0xe28fb9,
-    0xe28fba,
-    0xe28fbb,
-    0xe28fbc,
-    0xe28fbd,
-    0xe28fbe,
-    0xe28fbf,
-    0xe29080,
-    0xe29081,
-    0xe29082,
-    0xe29083,
-    0xe29084,
-    0xe29085,
-    0xe29086,
-    0xe29087,
-    0xe29088,
-    0xe29089,
-    0xe2908a,
-    0xe2908b,
-    0xe2908c,
-    0xe2908d,
-    0xe2908e,
-    0xe2908f,
-    0xe29090,
-    0xe29091,
-    0xe29092,
-    0xe29093,
-    0xe29094,
-    0xe29095,
-    0xe29096,
-    0xe29097,
-    0xe29098,
-    0xe29099,
-    0xe2909a,
-    0xe2909b,
-    0xe2909c,
-    0xe2909d,
-    0xe2909e,
-    0xe2909f,
-    0xe290a0,
-    0xe290a1,
-    0xe290a2,
-    0xe290a3,
-    0xe290a4,
-    0xe290a5,
-    0xe290a6,
-    0xe290a7,
-    0xe290a8,
-    0xe290a9,
-    0xe290aa,
-    0xe290ab,
-    0xe290ac,
-    0xe290ad,
-    0xe290ae,
-    0xe290af,
-    0xe290b0,
-    0xe290b1,
-    0xe290b2,
-    0xe290b3,
-    0xe290b4,
-    0xe290b5,
-    0xe290b6,
-    0xe290b7,
-    0xe290b8,
-    0xe290b9,
-    0xe290ba,
-    0xe290bb,
-    0xe290bc,
-    0xe290bd,
-    0xe290be,
-    0xe290bf,
-    0xe29180,
-    0xe29181,
-    0xe29182,
-    0xe29183,
-    0xe29184,
-    0xe29185,
-    0xe29186,
-    0xe29187,
-    0xe29188,
-    0xe29189,
-    0xe2918a,
-    0xe2918b,
-    0xe2918c,
-    0xe2918d,
-    0xe2918e,
-    0xe2918f,
-    0xe29190,
-    0xe29191,
-    0xe29192,
-    0xe29193,
-    0xe29194,
-    0xe29195,
-    0xe29196,
-    0xe29197,
-    0xe29198,
-    0xe29199,
-    0xe2919a,
-    0xe2919b,
-    0xe2919c,
-    0xe2919d,
-    0xe2919e,
-    0xe2919f,
-    0xe291a0,
-    0xe291a1,
-    0xe291a2,
-    0xe291a3,
-    0xe291a4,
-    0xe291a5,
-    0xe291a6,
-    0xe291a7,
-    0xe291a8,
-    0xe291a9,
-    0xe291aa,
-    0xe291ab,
-    0xe291ac,
-    0xe291ad,
-    0xe291ae,
-    0xe291af,
-    0xe291b0,
-    0xe291b1,
-    0xe291b2,
-    0xe291b3,
-    0xe291b4,
-    0xe291b5,
-    0xe291b6,
-    0xe291b7,
-    0xe291b8,
-    0xe291b9,
-    0xe291ba,
-    0xe291bb,
-    0xe291bc,
-    0xe291bd,
-    0xe291be,
-    0xe291bf,
-    0xe29280,
-    0xe29281,
-    0xe29282,
-    0xe29283,
-    0xe29284,
-    0xe29285,
-    0xe29286,
-    0xe29287,
-    0xe29288,
-    0xe29289,
-    0xe2928a,
-    0xe2928b,
-    0xe2928c,
-    0xe2928d,
-    0xe2928e,
-    0xe2928f,
-    0xe29290,
-    0xe29291,
-    0xe29292,
-    0xe29293,
-    0xe29294,
-    0xe29295,
-    0xe29296,
-    0xe29297,
-    0xe29298,
-    0xe29299,
-    0xe2929a,
-    0xe2929b,
-    0xe2929c,
-    0xe2929d,
-    0xe2929e,
-    0xe2929f,
-    0xe292a0,
-    0xe292a1,
-    0xe292a2,
-    0xe292a3,
-    0xe292a4,
-    0xe292a5,
-    0xe292a6,
-    0xe292a7,
-    0xe292a8,
-    0xe292a9,
-    0xe292aa,
-    0xe292ab,
-    0xe292ac,
-    0xe292ad,
-    0xe292ae,
-    0xe292af,
-    0xe292b0,
-    0xe292b1,
-    0xe292b2,
-    0xe292b3,
-    0xe292b4,
-    0xe292b5,
-    0xe292b6,
-    0xe292b7,
-    0xe292b8,
-    0xe292b9,
-    0xe292ba,
-    0xe292bb,
-    0xe292bc,
-    0xe292bd,
-    0xe292be,
-    0xe292bf,
-    0xe29380,
-    0xe29381,
-    0xe29382,
-    0xe29383,
-    0xe29384,
-    0xe29385,
-    0xe29386,
-    0xe29387,
-    0xe29388,
-    0xe29389,
-    0xe2938a,
-    0xe2938b,
-    0xe2938c,
-    0xe2938d,
-    0xe2938e,
-    0xe2938f,
-    0xe29390,
-    0xe29391,
-    0xe29392,
-    0xe29393,
-    0xe29394,
-    0xe29395,
-    0xe29396,
-    0xe29397,
-    0xe29398,
-    0xe29399,
-    0xe2939a,
-    0xe2939b,
-    0xe2939c,
-    0xe2939d,
-    0xe2939e,
-    0xe2939f,
-    0xe293a0,
-    0xe293a1,
-    0xe293a2,
-    0xe293a3,
-    0xe293a4,
-    0xe293a5,
-    0xe293a6,
-    0xe293a7,
-    0xe293a8,
-    0xe293a9,
-    0xe293aa,
-    0xe293ab,
-    0xe293ac,
-    0xe293ad,
-    0xe293ae,
-    0xe293af,
-    0xe293b0,
-    0xe293b1,
-    0xe293b2,
-    0xe293b3,
-    0xe293b4,
-    0xe293b5,
-    0xe293b6,
-    0xe293b7,
-    0xe293b8,
-    0xe293b9,
-    0xe293ba,
-    0xe293bb,
-    0xe293bc,
-    0xe293bd,
-    0xe293be,
-    0xe293bf,
-    0xe29480,
-    0xe29481,
-    0xe29482,
-    0xe29483,
-    0xe29484,
-    0xe29485,
-    0xe29486,
-    0xe29487,
-    0xe29488,
-    0xe29489,
-    0xe2948a,
-    0xe2948b,
-    0xe2948c,
-    0xe2948d,
-    0xe2948e,
-    0xe2948f,
-    0xe29490,
-    0xe29491,
-    0xe29492,
-    0xe29493,
-    0xe29494,
-    0xe29495,
-    0xe29496,
-    0xe29497,
-    0xe29498,
-    0xe29499,
-    0xe2949a,
-    0xe2949b,
-    0xe2949c,
-    0xe2949d,
-    0xe2949e,
-    0xe2949f,
-    0xe294a0,
-    0xe294a1,
-    0xe294a2,
-    0xe294a3,
-    0xe294a4,
-    0xe294a5,
-    0xe294a6,
-    0xe294a7,
-    0xe294a8,
-    0xe294a9,
-    0xe294aa,
-    0xe294ab,
-    0xe294ac,
-    0xe294ad,
-    0xe294ae,
-    0xe294af,
-    0xe294b0,
-    0xe294b1,
-    0xe294b2,
-    0xe294b3,
-    0xe294b4,
-    0xe294b5,
-    0xe294b6,
-    0xe294b7,
-    0xe294b8,
-    0xe294b9,
-    0xe294ba,
-    0xe294bb,
-    0xe294bc,
-    0xe294bd,
-    0xe294be,
-    0xe294bf,
-    0xe29580,
-    0xe29581,
-    0xe29582,
-    0xe29583,
-    0xe29584,
-    0xe29585,
-    0xe29586,
-    0xe29587,
-    0xe29588,
-    0xe29589,
-    0xe2958a,
-    0xe2958b,
-    0xe2958c,
-    0xe2958d,
-    0xe2958e,
-    0xe2958f,
-    0xe29590,
-    0xe29591,
-    0xe29592,
-    0xe29593,
-    0xe29594,
-    0xe29595,
-    0xe29596,
-    0xe29597,
-    0xe29598,
-    0xe29599,
-    0xe2959a,
-    0xe2959b,
-    0xe2959c,
-    0xe2959d,
-    0xe2959e,
-    0xe2959f,
-    0xe295a0,
-    0xe295a1,
-    0xe295a2,
-    0xe295a3,
-    0xe295a4,
-    0xe295a5,
-    0xe295a6,
-    0xe295a7,
-    0xe295a8,
-    0xe295a9,
-    0xe295aa,
-    0xe295ab,
-    0xe295ac,
-    0xe295ad,
-    0xe295ae,
-    0xe295af,
-    0xe295b0,
-    0xe295b1,
-    0xe295b2,
-    0xe295b3,
-    0xe295b4,
-    0xe295b5,
-    0xe295b6,
-    0xe295b7,
-    0xe295b8,
-    0xe295b9,
-    0xe295ba,
-    0xe295bb,
-    0xe295bc,
-    0xe295bd,
-    0xe295be,
-    0xe295bf,
-    0xe29680,
-    0xe29681,
-    0xe29682,
-    0xe29683,
-    0xe29684,
-    0xe29685,
-    0xe29686,
-    0xe29687,
-    0xe29688,
-    0xe29689,
-    0xe2968a,
-    0xe2968b,
-    0xe2968c,
-    0xe2968d,
-    0xe2968e,
-    0xe2968f,
-    0xe29690,
-    0xe29691,
-    0xe29692,
-    0xe29693,
-    0xe29694,
-    0xe29695,
-    0xe29696,
-    0xe29697,
-    0xe29698,
-    0xe29699,
-    0xe2969a,
-    0xe2969b,
-    0xe2969c,
-    0xe2969d,
-    0xe2969e,
-    0xe2969f,
-    0xe296a0,
-    0xe296a1,
-    0xe296a2,
-    0xe296a3,
-    0xe296a4,
-    0xe296a5,
-    0xe296a6,
-    0xe296a7,
-    0xe296a8,
-    0xe296a9,
-    0xe296aa,
-    0xe296ab,
-    0xe296ac,
-    0xe296ad,
-    0xe296ae,
-    0xe296af,
-    0xe296b0,
-    0xe296b1,
-    0xe296b2,
-    0xe296b3,
-    0xe296b4,
-    0xe296b5,
-    0xe296b6,
-    0xe296b7,
-    0xe296b8,
-    0xe296b9,
-    0xe296ba,
-    0xe296bb,
-    0xe296bc,
-    0xe296bd,
-    0xe296be,
-    0xe296bf,
-    0xe29780,
-    0xe29781,
-    0xe29782,
-    0xe29783,
-    0xe29784,
-    0xe29785,
-    0xe29786,
-    0xe29787,
-    0xe29788,
-    0xe29789,
-    0xe2978a,
-    0xe2978b,
-    0xe2978c,
-    0xe2978d,
-    0xe2978e,
-    0xe2978f,
-    0xe29790,
-    0xe29791,
-    0xe29792,
-    0xe29793,
-    0xe29794,
-    0xe29795,
-    0xe29796,
-    0xe29797,
-    0xe29798,
-    0xe29799,
-    0xe2979a,
-    0xe2979b,
-    0xe2979c,
-    0xe2979d,
-    0xe2979e,
-    0xe2979f,
-    0xe297a0,
-    0xe297a1,
-    0xe297a2,
-    0xe297a3,
-    0xe297a4,
-    0xe297a5,
-    0xe297a6,
-    0xe297a7,
-    0xe297a8,
-    0xe297a9,
-    0xe297aa,
-    0xe297ab,
-    0xe297ac,
-    0xe297ad,
-    0xe297ae,
-    0xe297af,
-    0xe297b0,
-    0xe297b1,
-    0xe297b2,
-    0xe297b3,
-    0xe297b4,
-    0xe297b5,
-    0xe297b6,
-    0xe297b7,
-    0xe297b8,
-    0xe297b9,
-    0xe297ba,
-    0xe297bb,
-    0xe297bc,
-    0xe297bd,
-    0xe297be,
-    0xe297bf,
-    0xe29880,
-    0xe29881,
-    0xe29882,
-    0xe29883,
-    0xe29884,
-    0xe29885,
-    0xe29886,
-    0xe29887,
-    0xe29888,
-    0xe29889,
-    0xe2988a,
-    0xe2988b,
-    0xe2988c,
-    0xe2988d,
-    0xe2988e,
-    0xe2988f,
-    0xe29890,
-    0xe29891,
-    0xe29892,
-    0xe29893,
-    0xe29894,
-    0xe29895,
-    0xe29896,
-    0xe29897,
-    0xe29898,
-    0xe29899,
-    0xe2989a,
-    0xe2989b,
-    0xe2989c,
-    0xe2989d,
-    0xe2989e,
-    0xe2989f,
-    0xe298a0,
-    0xe298a1,
-    0xe298a2,
-    0xe298a3,
-    0xe298a4,
-    0xe298a5,
-    0xe298a6,
-    0xe298a7,
-    0xe298a8,
-    0xe298a9,
-    0xe298aa,
-    0xe298ab,
-    0xe298ac,
-    0xe298ad,
-    0xe298ae,
-    0xe298af,
-    0xe298b0,
-    0xe298b1,
-    0xe298b2,
-    0xe298b3,
-    0xe298b4,
-    0xe298b5,
-    0xe298b6,
-    0xe298b7,
-    0xe298b8,
-    0xe298b9,
-    0xe298ba,
-    0xe298bb,
-    0xe298bc,
-    0xe298bd,
-    0xe298be,
-    0xe298bf,
-    0xe29980,
-    0xe29981,
-    0xe29982,
-    0xe29983,
-    0xe29984,
-    0xe29985,
-    0xe29986,
-    0xe29987,
-    0xe29988,
-    0xe29989,
-    0xe2998a,
-    0xe2998b,
-    0xe2998c,
-    0xe2998d,
-    0xe2998e,
-    0xe2998f,
-    0xe29990,
-    0xe29991,
-    0xe29992,
-    0xe29993,
-    0xe29994,
-    0xe29995,
-    0xe29996,
-    0xe29997,
-    0xe29998,
-    0xe29999,
-    0xe2999a,
-    0xe2999b,
-    0xe2999c,
-    0xe2999d,
-    0xe2999e,
-    0xe2999f,
-    0xe299a0,
-    0xe299a1,
-    0xe299a2,
-    0xe299a3,
-    0xe299a4,
-    0xe299a5,
-    0xe299a6,
-    0xe299a7,
-    0xe299a8,
-    0xe299a9,
-    0xe299aa,
-    0xe299ab,
-    0xe299ac,
-    0xe299ad,
-    0xe299ae,
-    0xe299af,
-    0xe299b0,
-    0xe299b1,
-    0xe299b2,
-    0xe299b3,
-    0xe299b4,
-    0xe299b5,
-    0xe299b6,
-    0xe299b7,
-    0xe299b8,
-    0xe299b9,
-    0xe299ba,
-    0xe299bb,
-    0xe299bc,
-    0xe299bd,
-    0xe299be,
-    0xe299bf,
-    0xe29a80,
-    0xe29a81,
-    0xe29a82,
-    0xe29a83,
-    0xe29a84,
-    0xe29a85,
-    0xe29a86,
-    0xe29a87,
-    0xe29a88,
-    0xe29a89,
-    0xe29a8a,
-    0xe29a8b,
-    0xe29a8c,
-    0xe29a8d,
-    0xe29a8e,
-    0xe29a8f,
-    0xe29a90,
-    0xe29a91,
-    0xe29a92,
-    0xe29a93,
-    0xe29a94,
-    0xe29a95,
-    0xe29a96,
-    0xe29a97,
-    0xe29a98,
-    0xe29a99,
-    0xe29a9a,
-    0xe29a9b,
-    0xe29a9c,
-    0xe29a9d,
-    0xe29a9e,
-    0xe29a9f,
-    0xe29aa0,
-    0xe29aa1,
-    0xe29aa2,
-    0xe29aa3,
-    0xe29aa4,
-    0xe29aa5,
-    0xe29aa6,
-    0xe29aa7,
-    0xe29aa8,
-    0xe29aa9,
-    0xe29aaa,
-    0xe29aab,
-    0xe29aac,
-    0xe29aad,
-    0xe29aae,
-    0xe29aaf,
-    0xe29ab0,
-    0xe29ab1,
-    0xe29ab2,
-    0xe29ab3,
-    0xe29ab4,
-    0xe29ab5,
-    0xe29ab6,
-    0xe29ab7,
-    0xe29ab8,
-    0xe29ab9,
-    0xe29aba,
-    0xe29abb,
-    0xe29abc,
-    0xe29abd,
-    0xe29abe,
-    0xe29abf,
-    0xe29b80,
-    0xe29b81,
-    0xe29b82,
-    0xe29b83,
-    0xe29b84,
-    0xe29b85,
-    0xe29b86,
-    0xe29b87,
-    0xe29b88,
-    0xe29b89,
-    0xe29b8a,
-    0xe29b8b,
-    0xe29b8c,
-    0xe29b8d,
-    0xe29b8e,
-    0xe29b8f,
-    0xe29b90,
-    0xe29b91,
-    0xe29b92,
-    0xe29b93,
-    0xe29b94,
-    0xe29b95,
-    0xe29b96,
-    0xe29b97,
-    0xe29b98,
-    0xe29b99,
-    0xe29b9a,
-    0xe29b9b,
-    0xe29b9c,
-    0xe29b9d,
-    0xe29b9e,
-    0xe29b9f,
-    0xe29ba0,
-    0xe29ba1,
-    0xe29ba2,
-    0xe29ba3,
-    0xe29ba4,
-    0xe29ba5,
-    0xe29ba6,
-    0xe29ba7,
-    0xe29ba8,
-    0xe29ba9,
-    0xe29baa,
-    0xe29bab,
-    0xe29bac,
-    0xe29bad,
-    0xe29bae,
-    0xe29baf,
-    0xe29bb0,
-    0xe29bb1,
-    0xe29bb2,
-    0xe29bb3,
-    0xe29bb4,
-    0xe29bb5,
-    0xe29bb6,
-    0xe29bb7,
-    0xe29bb8,
-    0xe29bb9,
-    0xe29bba,
-    0xe29bbb,
-    0xe29bbc,
-    0xe29bbd,
-    0xe29bbe,
-    0xe29bbf,
-    0xe29c80,
-    0xe29c81,
-    0xe29c82,
-    0xe29c83,
-    0xe29c84,
-    0xe29c85,
-    0xe29c86,
-    0xe29c87,
-    0xe29c88,
-    0xe29c89,
-    0xe29c8a,
-    0xe29c8b,
-    0xe29c8c,
-    0xe29c8d,
-    0xe29c8e,
-    0xe29c8f,
-    0xe29c90,
-    0xe29c91,
-    0xe29c92,
-    0xe29c93,
-    0xe29c94,
-    0xe29c95,
-    0xe29c96,
-    0xe29c97,
-    0xe29c98,
-    0xe29c99,
-    0xe29c9a,
-    0xe29c9b,
-    0xe29c9c,
-    0xe29c9d,
-    0xe29c9e,
-    0xe29c9f,
-    0xe29ca0,
-    0xe29ca1,
-    0xe29ca2,
-    0xe29ca3,
-    0xe29ca4,
-    0xe29ca5,
-    0xe29ca6,
-    0xe29ca7,
-    0xe29ca8,
-    0xe29ca9,
-    0xe29caa,
-    0xe29cab,
-    0xe29cac,
-    0xe29cad,
-    0xe29cae,
-    0xe29caf,
-    0xe29cb0,
-    0xe29cb1,
-    0xe29cb2,
-    0xe29cb3,
-    0xe29cb4,
-    0xe29cb5,
-    0xe29cb6,
-    0xe29cb7,
-    0xe29cb8,
-    0xe29cb9,
-    0xe29cba,
-    0xe29cbb,
-    0xe29cbc,
-    0xe29cbd,
-    0xe29cbe,
-    0xe29cbf,
-    0xe29d80,
-    0xe29d81,
-    0xe29d82,
-    0xe29d83,
-    0xe29d84,
-    0xe29d85,
-    0xe29d86,
-    0xe29d87,
-    0xe29d88,
-    0xe29d89,
-    0xe29d8a,
-    0xe29d8b,
-    0xe29d8c,
-    0xe29d8d,
-    0xe29d8e,
-    0xe29d8f,
-    0xe29d90,
-    0xe29d91,
-    0xe29d92,
-    0xe29d93,
-    0xe29d94,
-    0xe29d95,
-    0xe29d96,
-    0xe29d97,
-    0xe29d98,
-    0xe29d99,
-    0xe29d9a,
-    0xe29d9b,
-    0xe29d9c,
-    0xe29d9d,
-    0xe29d9e,
-    0xe29d9f,
-    0xe29da0,
-    0xe29da1,
-    0xe29da2,
-    0xe29da3,
-    0xe29da4,
-    0xe29da5,
-    0xe29da6,
-    0xe29da7,
-    0xe29da8,
-    0xe29da9,
-    0xe29daa,
-    0xe29dab,
-    0xe29dac,
-    0xe29dad,
-    0xe29dae,
-    0xe29daf,
-    0xe29db0,
-    0xe29db1,
-    0xe29db2,
-    0xe29db3,
-    0xe29db4,
-    0xe29db5,
-    0xe29db6,
-    0xe29db7,
-    0xe29db8,
-    0xe29db9,
-    0xe29dba,
-    0xe29dbb,
-    0xe29dbc,
-    0xe29dbd,
-    0xe29dbe,
-    0xe29dbf,
-    0xe29e80,
-    0xe29e81,
-    0xe29e82,
-    0xe29e83,
-    0xe29e84,
-    0xe29e85,
-    0xe29e86,
-    0xe29e87,
-    0xe29e88,
-    0xe29e89,
-    0xe29e8a,
-    0xe29e8b,
-    0xe29e8c,
-    0xe29e8d,
-    0xe29e8e,
-    0xe29e8f,
-    0xe29e90,
-    0xe29e91,
-    0xe29e92,
-    0xe29e93,
-    0xe29e94,
-    0xe29e95,
-    0xe29e96,
-    0xe29e97,
-    0xe29e98,
-    0xe29e99,
-    0xe29e9a,
-    0xe29e9b,
-    0xe29e9c,
-    0xe29e9d,
-    0xe29e9e,
-    0xe29e9f,
-    0xe29ea0,
-    0xe29ea1,
-    0xe29ea2,
-    0xe29ea3,
-    0xe29ea4,
-    0xe29ea5,
-    0xe29ea6,
-    0xe29ea7,
-    0xe29ea8,
-    0xe29ea9,
-    0xe29eaa,
-    0xe29eab,
-    0xe29eac,
-    0xe29ead,
-    0xe29eae,
-    0xe29eaf,
-    0xe29eb0,
-    0xe29eb1,
-    0xe29eb2,
-    0xe29eb3,
-    0xe29eb4,
-    0xe29eb5,
-    0xe29eb6,
-    0xe29eb7,
-    0xe29eb8,
-    0xe29eb9,
-    0xe29eba,
-    0xe29ebb,
-    0xe29ebc,
-    0xe29ebd,
-    0xe29ebe,
-    0xe29ebf,
-    0xe29f80,
-    0xe29f81,
-    0xe29f82,
-    0xe29f83,
-    0xe29f84,
-    0xe29f85,
-    0xe29f86,
-    0xe29f87,
-    0xe29f88,
-    0xe29f89,
-    0xe29f8a,
-    0xe29f8b,
-    0xe29f8c,
-    0xe29f8d,
-    0xe29f8e,
-    0xe29f8f,
-    0xe29f90,
-    0xe29f91,
-    0xe29f92,
-    0xe29f93,
-    0xe29f94,
-    0xe29f95,
-    0xe29f96,
-    0xe29f97,
-    0xe29f98,
-    0xe29f99,
-    0xe29f9a,
-    0xe29f9b,
-    0xe29f9c,
-    0xe29f9d,
-    0xe29f9e,
-    0xe29f9f,
-    0xe29fa0,
-    0xe29fa1,
-    0xe29fa2,
-    0xe29fa3,
-    0xe29fa4,
-    0xe29fa5,
-    0xe29fa6,
-    0xe29fa7,
-    0xe29fa8,
-    0xe29fa9,
-    0xe29faa,
-    0xe29fab,
-    0xe29fac,
-    0xe29fad,
-    0xe29fae,
-    0xe29faf,
-    0xe29fb0,
-    0xe29fb1,
-    0xe29fb2,
-    0xe29fb3,
-    0xe29fb4,
-    0xe29fb5,
-    0xe29fb6,
-    0xe29fb7,
-    0xe29fb8,
-    0xe29fb9,
-    0xe29fba,
-    0xe29fbb,
-    0xe29fbc,
-    0xe29fbd,
-    0xe29fbe,
-    0xe29fbf,
-    0xe2a080,
-    0xe2a081,
-    0xe2a082,
-    0xe2a083,
-    0xe2a084,
-    0xe2a085,
-    0xe2a086,
-    0xe2a087,
-    0xe2a088,
-    0xe2a089,
-    0xe2a08a,
-    0xe2a08b,
-    0xe2a08c,
-    0xe2a08d,
-    0xe2a08e,
-    0xe2a08f,
-    0xe2a090,
-    0xe2a091,
-    0xe2a092,
-    0xe2a093,
-    0xe2a094,
-    0xe2a095,
-    0xe2a096,
-    0xe2a097,
-    0xe2a098,
-    0xe2a099,
-    0xe2a09a,
-    0xe2a09b,
-    0xe2a09c,
-    0xe2a09d,
-    0xe2a09e,
-    0xe2a09f,
-    0xe2a0a0,
-    0xe2a0a1,
-    0xe2a0a2,
-    0xe2a0a3,
-    0xe2a0a4,
-    0xe2a0a5,
-    0xe2a0a6,
-    0xe2a0a7,
-    0xe2a0a8,
-    0xe2a0a9,
-    0xe2a0aa,
-    0xe2a0ab,
-    0xe2a0ac,
-    0xe2a0ad,
-    0xe2a0ae,
-    0xe2a0af,
-    0xe2a0b0,
-    0xe2a0b1,
-    0xe2a0b2,
-    0xe2a0b3,
-    0xe2a0b4,
-    0xe2a0b5,
-    0xe2a0b6,
-    0xe2a0b7,
-    0xe2a0b8,
-    0xe2a0b9,
-    0xe2a0ba,
-    0xe2a0bb,
-    0xe2a0bc,
-    0xe2a0bd,
-    0xe2a0be,
-    0xe2a0bf,
-    0xe2a180,
-    0xe2a181,
-    0xe2a182,
-    0xe2a183,
-    0xe2a184,
-    0xe2a185,
-    0xe2a186,
-    0xe2a187,
-    0xe2a188,
-    0xe2a189,
-    0xe2a18a,
-    0xe2a18b,
-    0xe2a18c,
-    0xe2a18d,
-    0xe2a18e,
-    0xe2a18f,
-    0xe2a190,
-    0xe2a191,
-    0xe2a192,
-    0xe2a193,
-    0xe2a194,
-    0xe2a195,
-    0xe2a196,
-    0xe2a197,
-    0xe2a198,
-    0xe2a199,
-    0xe2a19a,
-    0xe2a19b,
-    0xe2a19c,
-    0xe2a19d,
-    0xe2a19e,
-    0xe2a19f,
-    0xe2a1a0,
-    0xe2a1a1,
-    0xe2a1a2,
-    0xe2a1a3,
-    0xe2a1a4,
-    0xe2a1a5,
-    0xe2a1a6,
-    0xe2a1a7,
-    0xe2a1a8,
-    0xe2a1a9,
-    0xe2a1aa,
-    0xe2a1ab,
-    0xe2a1ac,
-    0xe2a1ad,
-    0xe2a1ae,
-    0xe2a1af,
-    0xe2a1b0,
-    0xe2a1b1,
-    0xe2a1b2,
-    0xe2a1b3,
-    0xe2a1b4,
-    0xe2a1b5,
-    0xe2a1b6,
-    0xe2a1b7,
-    0xe2a1b8,
-    0xe2a1b9,
-    0xe2a1ba,
-    0xe2a1bb,
-    0xe2a1bc,
-    0xe2a1bd,
-    0xe2a1be,
-    0xe2a1bf,
-    0xe2a280,
-    0xe2a281,
-    0xe2a282,
-    0xe2a283,
-    0xe2a284,
-    0xe2a285,
-    0xe2a286,
-    0xe2a287,
-    0xe2a288,
-    0xe2a289,
-    0xe2a28a,
-    0xe2a28b,
-    0xe2a28c,
-    0xe2a28d,
-    0xe2a28e,
-    0xe2a28f,
-    0xe2a290,
-    0xe2a291,
-    0xe2a292,
-    0xe2a293,
-    0xe2a294,
-    0xe2a295,
-    0xe2a296,
-    0xe2a297,
-    0xe2a298,
-    0xe2a299,
-    0xe2a29a,
-    0xe2a29b,
-    0xe2a29c,
-    0xe2a29d,
-    0xe2a29e,
-    0xe2a29f,
-    0xe2a2a0,
-    0xe2a2a1,
-    0xe2a2a2,
-    0xe2a2a3,
-    0xe2a2a4,
-    0xe2a2a5,
-    0xe2a2a6,
-    0xe2a2a7,
-    0xe2a2a8,
-    0xe2a2a9,
-    0xe2a2aa,
-    0xe2a2ab,
-    0xe2a2ac,
-    0xe2a2ad,
-    0xe2a2ae,
-    0xe2a2af,
-    0xe2a2b0,
-    0xe2a2b1,
-    0xe2a2b2,
-    0xe2a2b3,
-    0xe2a2b4,
-    0xe2a2b5,
-    0xe2a2b6,
-    0xe2a2b7,
-    0xe2a2b8,
-    0xe2a2b9,
-    0xe2a2ba,
-    0xe2a2bb,
-    0xe2a2bc,
-    0xe2a2bd,
-    0xe2a2be,
-    0xe2a2bf,
-    0xe2a380,
-    0xe2a381,
-    0xe2a382,
-    0xe2a383,
-    0xe2a384,
-    0xe2a385,
-    0xe2a386,
-    0xe2a387,
-    0xe2a388,
-    0xe2a389,
-    0xe2a38a,
-    0xe2a38b,
-    0xe2a38c,
-    0xe2a38d,
-    0xe2a38e,
-    0xe2a38f,
-    0xe2a390,
-    0xe2a391,
-    0xe2a392,
-    0xe2a393,
-    0xe2a394,
-    0xe2a395,
-    0xe2a396,
-    0xe2a397,
-    0xe2a398,
-    0xe2a399,
-    0xe2a39a,
-    0xe2a39b,
-    0xe2a39c,
-    0xe2a39d,
-    0xe2a39e,
-    0xe2a39f,
-    0xe2a3a0,
-    0xe2a3a1,
-    0xe2a3a2,
-    0xe2a3a3,
-    0xe2a3a4,
-    0xe2a3a5,
-    0xe2a3a6,
-    0xe2a3a7,
-    0xe2a3a8,
-    0xe2a3a9,
-    0xe2a3aa,
-    0xe2a3ab,
-    0xe2a3ac,
-    0xe2a3ad,
-    0xe2a3ae,
-    0xe2a3af,
-    0xe2a3b0,
-    0xe2a3b1,
-    0xe2a3b2,
-    0xe2a3b3,
-    0xe2a3b4,
-    0xe2a3b5,
-    0xe2a3b6,
-    0xe2a3b7,
-    0xe2a3b8,
-    0xe2a3b9,
-    0xe2a3ba,
-    0xe2a3bb,
-    0xe2a3bc,
-    0xe2a3bd,
-    0xe2a3be,
-    0xe2a3bf,
-    0xe2a480,
-    0xe2a481,
-    0xe2a482,
-    0xe2a483,
-    0xe2a484,
-    0xe2a485,
-    0xe2a486,
-    0xe2a487,
-    0xe2a488,
-    0xe2a489,
-    0xe2a48a,
-    0xe2a48b,
-    0xe2a48c,
-    0xe2a48d,
-    0xe2a48e,
-    0xe2a48f,
-    0xe2a490,
-    0xe2a491,
-    0xe2a492,
-    0xe2a493,
-    0xe2a494,
-    0xe2a495,
-    0xe2a496,
-    0xe2a497,
-    0xe2a498,
-    0xe2a499,
-    0xe2a49a,
-    0xe2a49b,
-    0xe2a49c,
-    0xe2a49d,
-    0xe2a49e,
-    0xe2a49f,
-    0xe2a4a0,
-    0xe2a4a1,
-    0xe2a4a2,
-    0xe2a4a3,
-    0xe2a4a4,
-    0xe2a4a5,
-    0xe2a4a6,
-    0xe2a4a7,
-    0xe2a4a8,
-    0xe2a4a9,
-    0xe2a4aa,
-    0xe2a4ab,
-    0xe2a4ac,
-    0xe2a4ad,
-    0xe2a4ae,
-    0xe2a4af,
-    0xe2a4b0,
-    0xe2a4b1,
-    0xe2a4b2,
-    0xe2a4b3,
-    0xe2a4b4,
-    0xe2a4b5,
-    0xe2a4b6,
-    0xe2a4b7,
-    0xe2a4b8,
-    0xe2a4b9,
-    0xe2a4ba,
-    0xe2a4bb,
-    0xe2a4bc,
-    0xe2a4bd,
-    0xe2a4be,
-    0xe2a4bf,
-    0xe2a580,
-    0xe2a581,
-    0xe2a582,
-    0xe2a583,
-    0xe2a584,
-    0xe2a585,
-    0xe2a586,
-    0xe2a587,
-    0xe2a588,
-    0xe2a589,
-    0xe2a58a,
-    0xe2a58b,
-    0xe2a58c,
-    0xe2a58d,
-    0xe2a58e,
-    0xe2a58f,
-    0xe2a590,
-    0xe2a591,
-    0xe2a592,
-    0xe2a593,
-    0xe2a594,
-    0xe2a595,
-    0xe2a596,
-    0xe2a597,
-    0xe2a598,
-    0xe2a599,
-    0xe2a59a,
-    0xe2a59b,
-    0xe2a59c,
-    0xe2a59d,
-    0xe2a59e,
-    0xe2a59f,
-    0xe2a5a0,
-    0xe2a5a1,
-    0xe2a5a2,
-    0xe2a5a3,
-    0xe2a5a4,
-    0xe2a5a5,
-    0xe2a5a6,
-    0xe2a5a7,
-    0xe2a5a8,
-    0xe2a5a9,
-    0xe2a5aa,
-    0xe2a5ab,
-    0xe2a5ac,
-    0xe2a5ad,
-    0xe2a5ae,
-    0xe2a5af,
-    0xe2a5b0,
-    0xe2a5b1,
-    0xe2a5b2,
-    0xe2a5b3,
-    0xe2a5b4,
-    0xe2a5b5,
-    0xe2a5b6,
-    0xe2a5b7,
-    0xe2a5b8,
-    0xe2a5b9,
-    0xe2a5ba,
-    0xe2a5bb,
-    0xe2a5bc,
-    0xe2a5bd,
-    0xe2a5be,
-    0xe2a5bf,
-    0xe2a680,
-    0xe2a681,
-    0xe2a682,
-    0xe2a683,
-    0xe2a684,
-    0xe2a685,
-    0xe2a686,
-    0xe2a687,
-    0xe2a688,
-    0xe2a689,
-    0xe2a68a,
-    0xe2a68b,
-    0xe2a68c,
-    0xe2a68d,
-    0xe2a68e,
-    0xe2a68f,
-    0xe2a690,
-    0xe2a691,
-    0xe2a692,
-    0xe2a693,
-    0xe2a694,
-    0xe2a695,
-    0xe2a696,
-    0xe2a697,
-    0xe2a698,
-    0xe2a699,
-    0xe2a69a,
-    0xe2a69b,
-    0xe2a69c,
-    0xe2a69d,
-    0xe2a69e,
-    0xe2a69f,
-    0xe2a6a0,
-    0xe2a6a1,
-    0xe2a6a2,
-    0xe2a6a3,
-    0xe2a6a4,
-    0xe2a6a5,
-    0xe2a6a6,
-    0xe2a6a7,
-    0xe2a6a8,
-    0xe2a6a9,
-    0xe2a6aa,
-    0xe2a6ab,
-    0xe2a6ac,
-    0xe2a6ad,
-    0xe2a6ae,
-    0xe2a6af,
-    0xe2a6b0,
-    0xe2a6b1,
-    0xe2a6b2,
-    0xe2a6b3,
-    0xe2a6b4,
-    0xe2a6b5,
-    0xe2a6b6,
-    0xe2a6b7,
-    0xe2a6b8,
-    0xe2a6b9,
-    0xe2a6ba,
-    0xe2a6bb,
-    0xe2a6bc,
-    0xe2a6bd,
-    0xe2a6be,
-    0xe2a6bf,
-    0xe2a780,
-    0xe2a781,
-    0xe2a782,
-    0xe2a783,
-    0xe2a784,
-    0xe2a785,
-    0xe2a786,
-    0xe2a787,
-    0xe2a788,
-    0xe2a789,
-    0xe2a78a,
-    0xe2a78b,
-    0xe2a78c,
-    0xe2a78d,
-    0xe2a78e,
-    0xe2a78f,
-    0xe2a790,
-    0xe2a791,
-    0xe2a792,
-    0xe2a793,
-    0xe2a794,
-    0xe2a795,
-    0xe2a796,
-    0xe2a797,
-    0xe2a798,
-    0xe2a799,
-    0xe2a79a,
-    0xe2a79b,
-    0xe2a79c,
-    0xe2a79d,
-    0xe2a79e,
-    0xe2a79f,
-    0xe2a7a0,
-    0xe2a7a1,
-    0xe2a7a2,
-    0xe2a7a3,
-    0xe2a7a4,
-    0xe2a7a5,
-    0xe2a7a6,
-    0xe2a7a7,
-    0xe2a7a8,
-    0xe2a7a9,
-    0xe2a7aa,
-    0xe2a7ab,
-    0xe2a7ac,
-    0xe2a7ad,
-    0xe2a7ae,
-    0xe2a7af,
-    0xe2a7b0,
-    0xe2a7b1,
-    0xe2a7b2,
-    0xe2a7b3,
-    0xe2a7b4,
-    0xe2a7b5,
-    0xe2a7b6,
-    0xe2a7b7,
-    0xe2a7b8,
-    0xe2a7b9,
-    0xe2a7ba,
-    0xe2a7bb,
-    0xe2a7bc,
-    0xe2a7bd,
-    0xe2a7be,
-    0xe2a7bf,
-    0xe2a880,
-    0xe2a881,
-    0xe2a882,
-    0xe2a883,
-    0xe2a884,
-    0xe2a885,
-    0xe2a886,
-    0xe2a887,
-    0xe2a888,
-    0xe2a889,
-    0xe2a88a,
-    0xe2a88b,
-    0xe2a88c,
-    0xe2a88d,
-    0xe2a88e,
-    0xe2a88f,
-    0xe2a890,
-    0xe2a891,
-    0xe2a892,
-    0xe2a893,
-    0xe2a894,
-    0xe2a895,
-    0xe2a896,
-    0xe2a897,
-    0xe2a898,
-    0xe2a899,
-    0xe2a89a,
-    0xe2a89b,
-    0xe2a89c,
-    0xe2a89d,
-    0xe2a89e,
-    0xe2a89f,
-    0xe2a8a0,
-    0xe2a8a1,
-    0xe2a8a2,
-    0xe2a8a3,
-    0xe2a8a4,
-    0xe2a8a5,
-    0xe2a8a6,
-    0xe2a8a7,
-    0xe2a8a8,
-    0xe2a8a9,
-    0xe2a8aa,
-    0xe2a8ab,
-    0xe2a8ac,
-    0xe2a8ad,
-    0xe2a8ae,
-    0xe2a8af,
-    0xe2a8b0,
-    0xe2a8b1,
-    0xe2a8b2,
-    0xe2a8b3,
-    0xe2a8b4,
-    0xe2a8b5,
-    0xe2a8b6,
-    0xe2a8b7,
-    0xe2a8b8,
-    0xe2a8b9,
-    0xe2a8ba,
-    0xe2a8bb,
-    0xe2a8bc,
-    0xe2a8bd,
-    0xe2a8be,
-    0xe2a8bf,
-    0xe2a980,
-    0xe2a981,
-    0xe2a982,
-    0xe2a983,
-    0xe2a984,
-    0xe2a985,
-    0xe2a986,
-    0xe2a987,
-    0xe2a988,
-    0xe2a989,
-    0xe2a98a,
-    0xe2a98b,
-    0xe2a98c,
-    0xe2a98d,
-    0xe2a98e,
-    0xe2a98f,
-    0xe2a990,
-    0xe2a991,
-    0xe2a992,
-    0xe2a993,
-    0xe2a994,
-    0xe2a995,
-    0xe2a996,
-    0xe2a997,
-    0xe2a998,
-    0xe2a999,
-    0xe2a99a,
-    0xe2a99b,
-    0xe2a99c,
-    0xe2a99d,
-    0xe2a99e,
-    0xe2a99f,
-    0xe2a9a0,
-    0xe2a9a1,
-    0xe2a9a2,
-    0xe2a9a3,
-    0xe2a9a4,
-    0xe2a9a5,
-    0xe2a9a6,
-    0xe2a9a7,
-    0xe2a9a8,
-    0xe2a9a9,
-    0xe2a9aa,
-    0xe2a9ab,
-    0xe2a9ac,
-    0xe2a9ad,
-    0xe2a9ae,
-    0xe2a9af,
-    0xe2a9b0,
-    0xe2a9b1,
-    0xe2a9b2,
-    0xe2a9b3,
-    0xe2a9b4,
-    0xe2a9b5,
-    0xe2a9b6,
-    0xe2a9b7,
-    0xe2a9b8,
-    0xe2a9b9,
-    0xe2a9ba,
-    0xe2a9bb,
-    0xe2a9bc,
-    0xe2a9bd,
-    0xe2a9be,
-    0xe2a9bf,
-    0xe2aa80,
-    0xe2aa81,
-    0xe2aa82,
-    0xe2aa83,
-    0xe2aa84,
-    0xe2aa85,
-    0xe2aa86,
-    0xe2aa87,
-    0xe2aa88,
-    0xe2aa89,
-    0xe2aa8a,
-    0xe2aa8b,
-    0xe2aa8c,
-    0xe2aa8d,
-    0xe2aa8e,
-    0xe2aa8f,
-    0xe2aa90,
-    0xe2aa91,
-    0xe2aa92,
-    0xe2aa93,
-    0xe2aa94,
-    0xe2aa95,
-    0xe2aa96,
-    0xe2aa97,
-    0xe2aa98,
-    0xe2aa99,
-    0xe2aa9a,
-    0xe2aa9b,
-    0xe2aa9c,
-    0xe2aa9d,
-    0xe2aa9e,
-    0xe2aa9f,
-    0xe2aaa0,
-    0xe2aaa1,
-    0xe2aaa2,
-    0xe2aaa3,
-    0xe2aaa4,
-    0xe2aaa5,
-    0xe2aaa6,
-    0xe2aaa7,
-    0xe2aaa8,
-    0xe2aaa9,
-    0xe2aaaa,
-    0xe2aaab,
-    0xe2aaac,
-    0xe2aaad,
-    0xe2aaae,
-    0xe2aaaf,
-    0xe2aab0,
-    0xe2aab1,
-    0xe2aab2,
-    0xe2aab3,
-    0xe2aab4,
-    0xe2aab5,
-    0xe2aab6,
-    0xe2aab7,
-    0xe2aab8,
-    0xe2aab9,
-    0xe2aaba,
-    0xe2aabb,
-    0xe2aabc,
-    0xe2aabd,
-    0xe2aabe,
-    0xe2aabf,
-    0xe2ab80,
-    0xe2ab81,
-    0xe2ab82,
-    0xe2ab83,
-    0xe2ab84,
-    0xe2ab85,
-    0xe2ab86,
-    0xe2ab87,
-    0xe2ab88,
-    0xe2ab89,
-    0xe2ab8a,
-    0xe2ab8b,
-    0xe2ab8c,
-    0xe2ab8d,
-    0xe2ab8e,
-    0xe2ab8f,
-    0xe2ab90,
-    0xe2ab91,
-    0xe2ab92,
-    0xe2ab93,
-    0xe2ab94,
-    0xe2ab95,
-    0xe2ab96,
-    0xe2ab97,
-    0xe2ab98,
-    0xe2ab99,
-    0xe2ab9a,
-    0xe2ab9b,
-    0xe2ab9c,
-    0xe2ab9d,
-    0xe2ab9e,
-    0xe2ab9f,
-    0xe2aba0,
-    0xe2aba1,
-    0xe2aba2,
-    0xe2aba3,
-    0xe2aba4,
-    0xe2aba5,
-    0xe2aba6,
-    0xe2aba7,
-    0xe2aba8,
-    0xe2aba9,
-    0xe2abaa,
-    0xe2abab,
-    0xe2abac,
-    0xe2abad,
-    0xe2abae,
-    0xe2abaf,
-    0xe2abb0,
-    0xe2abb1,
-    0xe2abb2,
-    0xe2abb3,
-    0xe2abb4,
-    0xe2abb5,
-    0xe2abb6,
-    0xe2abb7,
-    0xe2abb8,
-    0xe2abb9,
-    0xe2abba,
-    0xe2abbb,
-    0xe2abbc,
-    0xe2abbd,
-    0xe2abbe,
-    0xe2abbf,
-    0xe2ac80,
-    0xe2ac81,
-    0xe2ac82,
-    0xe2ac83,
-    0xe2ac84,
-    0xe2ac85,
-    0xe2ac86,
-    0xe2ac87,
-    0xe2ac88,
-    0xe2ac89,
-    0xe2ac8a,
-    0xe2ac8b,
-    0xe2ac8c,
-    0xe2ac8d,
-    0xe2ac8e,
-    0xe2ac8f,
-    0xe2ac90,
-    0xe2ac91,
-    0xe2ac92,
-    0xe2ac93,
-    0xe2ac94,
-    0xe2ac95,
-    0xe2ac96,
-    0xe2ac97,
-    0xe2ac98,
-    0xe2ac99,
-    0xe2ac9a,
-    0xe2ac9b,
-    0xe2ac9c,
-    0xe2ac9d,
-    0xe2ac9e,
-    0xe2ac9f,
-    0xe2aca0,
-    0xe2aca1,
-    0xe2aca2,
-    0xe2aca3,
-    0xe2aca4,
-    0xe2aca5,
-    0xe2aca6,
-    0xe2aca7,
-    0xe2aca8,
-    0xe2aca9,
-    0xe2acaa,
-    0xe2acab,
-    0xe2acac,
-    0xe2acad,
-    0xe2acae,
-    0xe2acaf,
-    0xe2acb0,
-    0xe2acb1,
-    0xe2acb2,
-    0xe2acb3,
-    0xe2acb4,
-    0xe2acb5,
-    0xe2acb6,
-    0xe2acb7,
-    0xe2acb8,
-    0xe2acb9,
-    0xe2acba,
-    0xe2acbb,
-    0xe2acbc,
-    0xe2acbd,
-    0xe2acbe,
-    0xe2acbf,
-    0xe2ad80,
-    0xe2ad81,
-    0xe2ad82,
-    0xe2ad83,
-    0xe2ad84,
-    0xe2ad85,
-    0xe2ad86,
-    0xe2ad87,
-    0xe2ad88,
-    0xe2ad89,
-    0xe2ad8a,
-    0xe2ad8b,
-    0xe2ad8c,
-    0xe2ad8d,
-    0xe2ad8e,
-    0xe2ad8f,
-    0xe2ad90,
-    0xe2ad91,
-    0xe2ad92,
-    0xe2ad93,
-    0xe2ad94,
-    0xe2ad95,
-    0xe2ad96,
-    0xe2ad97,
-    0xe2ad98,
-    0xe2ad99,
-    0xe2ad9a,
-    0xe2ad9b,
-    0xe2ad9c,
-    0xe2ad9d,
-    0xe2ad9e,
-    0xe2ad9f,
-    0xe2ada0,
-    0xe2ada1,
-    0xe2ada2,
-    0xe2ada3,
-    0xe2ada4,
-    0xe2ada5,
-    0xe2ada6,
-    0xe2ada7,
-    0xe2ada8,
-    0xe2ada9,
-    0xe2adaa,
-    0xe2adab,
-    0xe2adac,
-    0xe2adad,
-    0xe2adae,
-    0xe2adaf,
-    0xe2adb0,
-    0xe2adb1,
-    0xe2adb2,
-    0xe2adb3,
-    0xe2adb4,
-    0xe2adb5,
-    0xe2adb6,
-    0xe2adb7,
-    0xe2adb8,
-    0xe2adb9,
-    0xe2adba,
-    0xe2adbb,
-    0xe2adbc,
-    0xe2adbd,
-    0xe2adbe,
-    0xe2adbf,
-    0xe2ae80,
-    0xe2ae81,
-    0xe2ae82,
-    0xe2ae83,
-    0xe2ae84,
-    0xe2ae85,
-    0xe2ae86,
-    0xe2ae87,
-    0xe2ae88,
-    0xe2ae89,
-    0xe2ae8a,
-    0xe2ae8b,
-    0xe2ae8c,
-    0xe2ae8d,
-    0xe2ae8e,
-    0xe2ae8f,
-    0xe2ae90,
-    0xe2ae91,
-    0xe2ae92,
-    0xe2ae93,
-    0xe2ae94,
-    0xe2ae95,
-    0xe2ae96,
-    0xe2ae97,
-    0xe2ae98,
-    0xe2ae99,
-    0xe2ae9a,
-    0xe2ae9b,
-    0xe2ae9c,
-    0xe2ae9d,
-    0xe2ae9e,
-    0xe2ae9f,
-    0xe2aea0,
-    0xe2aea1,
-    0xe2aea2,
-    0xe2aea3,
-    0xe2aea4,
-    0xe2aea5,
-    0xe2aea6,
-    0xe2aea7,
-    0xe2aea8,
-    0xe2aea9,
-    0xe2aeaa,
-    0xe2aeab,
-    0xe2aeac,
-    0xe2aead,
-    0xe2aeae,
-    0xe2aeaf,
-    0xe2aeb0,
-    0xe2aeb1,
-    0xe2aeb2,
-    0xe2aeb3,
-    0xe2aeb4,
-    0xe2aeb5,
-    0xe2aeb6,
-    0xe2aeb7,
-    0xe2aeb8,
-    0xe2aeb9,
-    0xe2aeba,
-    0xe2aebb,
-    0xe2aebc,
-    0xe2aebd,
-    0xe2aebe,
-    0xe2aebf,
-    0xe2af80,
-    0xe2af81,
-    0xe2af82,
-    0xe2af83,
-    0xe2af84,
-    0xe2af85,
-    0xe2af86,
-    0xe2af87,
-    0xe2af88,
-    0xe2af89,
-    0xe2af8a,
-    0xe2af8b,
-    0xe2af8c,
-    0xe2af8d,
-    0xe2af8e,
-    0xe2af8f,
-    0xe2af90,
-    0xe2af91,
-    0xe2af92,
-    0xe2af93,
-    0xe2af94,
-    0xe2af95,
-    0xe2af96,
-    0xe2af97,
-    0xe2af98,
-    0xe2af99,
-    0xe2af9a,
-    0xe2af9b,
-    0xe2af9c,
-    0xe2af9d,
-    0xe2af9e,
-    0xe2af9f,
-    0xe2afa0,
-    0xe2afa1,
-    0xe2afa2,
-    0xe2afa3,
-    0xe2afa4,
-    0xe2afa5,
-    0xe2afa6,
-    0xe2afa7,
-    0xe2afa8,
-    0xe2afa9,
-    0xe2afaa,
-    0xe2afab,
-    0xe2afac,
-    0xe2afad,
-    0xe2afae,
-    0xe2afaf,
-    0xe2afb0,
-    0xe2afb1,
-    0xe2afb2,
-    0xe2afb3,
-    0xe2afb4,
-    0xe2afb5,
-    0xe2afb6,
-    0xe2afb7,
-    0xe2afb8,
-    0xe2afb9,
-    0xe2afba,
-    0xe2afbb,
-    0xe2afbc,
-    0xe2afbd,
-    0xe2afbe,
-    0xe2afbf,
-    0xe2b080,
-    0xe2b081,
-    0xe2b082,
-    0xe2b083,
-    0xe2b084,
-    0xe2b085,
-    0xe2b086,
-    0xe2b087,
-    0xe2b088,
-    0xe2b089,
-    0xe2b08a,
-    0xe2b08b,
-    0xe2b08c,
-    0xe2b08d,
-    0xe2b08e,
-    0xe2b08f,
-    0xe2b090,
-    0xe2b091,
-    0xe2b092,
-    0xe2b093,
-    0xe2b094,
-    0xe2b095,
-    0xe2b096,
-    0xe2b097,
-    0xe2b098,
-    0xe2b099,
-    0xe2b09a,
-    0xe2b09b,
-    0xe2b09c,
-    0xe2b09d,
-    0xe2b09e,
-    0xe2b09f,
-    0xe2b0a0,
-    0xe2b0a1,
-    0xe2b0a2,
-    0xe2b0a3,
-    0xe2b0a4,
-    0xe2b0a5,
-    0xe2b0a6,
-    0xe2b0a7,
-    0xe2b0a8,
-    0xe2b0a9,
-    0xe2b0aa,
-    0xe2b0ab,
-    0xe2b0ac,
-    0xe2b0ad,
-    0xe2b0ae,
-    0xe2b0af,
-    0xe2b0b0,
-    0xe2b0b1,
-    0xe2b0b2,
-    0xe2b0b3,
-    0xe2b0b4,
-    0xe2b0b5,
-    0xe2b0b6,
-    0xe2b0b7,
-    0xe2b0b8,
-    0xe2b0b9,
-    0xe2b0ba,
-    0xe2b0bb,
-    0xe2b0bc,
-    0xe2b0bd,
-    0xe2b0be,
-    0xe2b0bf,
-    0xe2b180,
-    0xe2b181,
-    0xe2b182,
-    0xe2b183,
-    0xe2b184,
-    0xe2b185,
-    0xe2b186,
-    0xe2b187,
-    0xe2b188,
-    0xe2b189,
-    0xe2b18a,
-    0xe2b18b,
-    0xe2b18c,
-    0xe2b18d,
-    0xe2b18e,
-    0xe2b18f,
-    0xe2b190,
-    0xe2b191,
-    0xe2b192,
-    0xe2b193,
-    0xe2b194,
-    0xe2b195,
-    0xe2b196,
-    0xe2b197,
-    0xe2b198,
-    0xe2b199,
-    0xe2b19a,
-    0xe2b19b,
-    0xe2b19c,
-    0xe2b19d,
-    0xe2b19e,
-    0xe2b19f,
-    0xe2b1a0,
-    0xe2b1a1,
-    0xe2b1a2,
-    0xe2b1a3,
-    0xe2b1a4,
-    0xe2b1a5,
-    0xe2b1a6,
-    0xe2b1a7,
-    0xe2b1a8,
-    0xe2b1a9,
-    0xe2b1aa,
-    0xe2b1ab,
-    0xe2b1ac,
-    0xe2b1ad,
-    0xe2b1ae,
-    0xe2b1af,
-    0xe2b1b0,
-    0xe2b1b1,
-    0xe2b1b2,
-    0xe2b1b3,
-    0xe2b1b4,
-    0xe2b1b5,
-    0xe2b1b6,
-    0xe2b1b7,
-    0xe2b1b8,
-    0xe2b1b9,
-    0xe2b1ba,
-    0xe2b1bb,
-    0xe2b1bc,
-    0xe2b1bd,
-    0xe2b1be,
-    0xe2b1bf,
-    0xe2b280,
-    0xe2b281,
-    0xe2b282,
-    0xe2b283,
-    0xe2b284,
-    0xe2b285,
-    0xe2b286,
-    0xe2b287,
-    0xe2b288,
-    0xe2b289,
-    0xe2b28a,
-    0xe2b28b,
-    0xe2b28c,
-    0xe2b28d,
-    0xe2b28e,
-    0xe2b28f,
-    0xe2b290,
-    0xe2b291,
-    0xe2b292,
-    0xe2b293,
-    0xe2b294,
-    0xe2b295,
-    0xe2b296,
-    0xe2b297,
-    0xe2b298,
-    0xe2b299,
-    0xe2b29a,
-    0xe2b29b,
-    0xe2b29c,
-    0xe2b29d,
-    0xe2b29e,
-    0xe2b29f,
-    0xe2b2a0,
-    0xe2b2a1,
-    0xe2b2a2,
-    0xe2b2a3,
-    0xe2b2a4,
-    0xe2b2a5,
-    0xe2b2a6,
-    0xe2b2a7,
-    0xe2b2a8,
-    0xe2b2a9,
-    0xe2b2aa,
-    0xe2b2ab,
-    0xe2b2ac,
-    0xe2b2ad,
-    0xe2b2ae,
-    0xe2b2af,
-    0xe2b2b0,
-    0xe2b2b1,
-    0xe2b2b2,
-    0xe2b2b3,
-    0xe2b2b4,
-    0xe2b2b5,
-    0xe2b2b6,
-    0xe2b2b7,
-    0xe2b2b8,
-    0xe2b2b9,
-    0xe2b2ba,
-    0xe2b2bb,
-    0xe2b2bc,
-    0xe2b2bd,
-    0xe2b2be,
-    0xe2b2bf,
-    0xe2b380,
-    0xe2b381,
-    0xe2b382,
-    0xe2b383,
-    0xe2b384,
-    0xe2b385,
-    0xe2b386,
-    0xe2b387,
-    0xe2b388,
-    0xe2b389,
-    0xe2b38a,
-    0xe2b38b,
-    0xe2b38c,
-    0xe2b38d,
-    0xe2b38e,
-    0xe2b38f,
-    0xe2b390,
-    0xe2b391,
-    0xe2b392,
-    0xe2b393,
-    0xe2b394,
-    0xe2b395,
-    0xe2b396,
-    0xe2b397,
-    0xe2b398,
-    0xe2b399,
-    0xe2b39a,
-    0xe2b39b,
-    0xe2b39c,
-    0xe2b39d,
-    0xe2b39e,
-    0xe2b39f,
-    0xe2b3a0,
-    0xe2b3a1,
-    0xe2b3a2,
-    0xe2b3a3,
-    0xe2b3a4,
-    0xe2b3a5,
-    0xe2b3a6,
-    0xe2b3a7,
-    0xe2b3a8,
-    0xe2b3a9,
-    0xe2b3aa,
-    0xe2b3ab,
-    0xe2b3ac,
-    0xe2b3ad,
-    0xe2b3ae,
-    0xe2b3af,
-    0xe2b3b0,
-    0xe2b3b1,
-    0xe2b3b2,
-    0xe2b3b3,
-    0xe2b3b4,
-    0xe2b3b5,
-    0xe2b3b6,
-    0xe2b3b7,
-    0xe2b3b8,
-    0xe2b3b9,
-    0xe2b3ba,
-    0xe2b3bb,
-    0xe2b3bc,
-    0xe2b3bd,
-    0xe2b3be,
-    0xe2b3bf,
-    0xe2b480,
-    0xe2b481,
-    0xe2b482,
-    0xe2b483,
-    0xe2b484,
-    0xe2b485,
-    0xe2b486,
-    0xe2b487,
-    0xe2b488,
-    0xe2b489,
-    0xe2b48a,
-    0xe2b48b,
-    0xe2b48c,
-    0xe2b48d,
-    0xe2b48e,
-    0xe2b48f,
-    0xe2b490,
-    0xe2b491,
-    0xe2b492,
-    0xe2b493,
-    0xe2b494,
-    0xe2b495,
-    0xe2b496,
-    0xe2b497,
-    0xe2b498,
-    0xe2b499,
-    0xe2b49a,
-    0xe2b49b,
-    0xe2b49c,
-    0xe2b49d,
-    0xe2b49e,
-    0xe2b49f,
-    0xe2b4a0,
-    0xe2b4a1,
-    0xe2b4a2,
-    0xe2b4a3,
-    0xe2b4a4,
-    0xe2b4a5,
-    0xe2b4a6,
-    0xe2b4a7,
-    0xe2b4a8,
-    0xe2b4a9,
-    0xe2b4aa,
-    0xe2b4ab,
-    0xe2b4ac,
-    0xe2b4ad,
-    0xe2b4ae,
-    0xe2b4af,
-    0xe2b4b0,
-    0xe2b4b1,
-    0xe2b4b2,
-    0xe2b4b3,
-    0xe2b4b4,
-    0xe2b4b5,
-    0xe2b4b6,
-    0xe2b4b7,
-    0xe2b4b8,
-    0xe2b4b9,
-    0xe2b4ba,
-    0xe2b4bb,
-    0xe2b4bc,
-    0xe2b4bd,
-    0xe2b4be,
-    0xe2b4bf,
-    0xe2b580,
-    0xe2b581,
-    0xe2b582,
-    0xe2b583,
-    0xe2b584,
-    0xe2b585,
-    0xe2b586,
-    0xe2b587,
-    0xe2b588,
-    0xe2b589,
-    0xe2b58a,
-    0xe2b58b,
-    0xe2b58c,
-    0xe2b58d,
-    0xe2b58e,
-    0xe2b58f,
-    0xe2b590,
-    0xe2b591,
-    0xe2b592,
-    0xe2b593,
-    0xe2b594,
-    0xe2b595,
-    0xe2b596,
-    0xe2b597,
-    0xe2b598,
-    0xe2b599,
-    0xe2b59a,
-    0xe2b59b,
-    0xe2b59c,
-    0xe2b59d,
-    0xe2b59e,
-    0xe2b59f,
-    0xe2b5a0,
-    0xe2b5a1,
-    0xe2b5a2,
-    0xe2b5a3,
-    0xe2b5a4,
-    0xe2b5a5,
-    0xe2b5a6,
-    0xe2b5a7,
-    0xe2b5a8,
-    0xe2b5a9,
-    0xe2b5aa,
-    0xe2b5ab,
-    0xe2b5ac,
-    0xe2b5ad,
-    0xe2b5ae,
-    0xe2b5af,
-    0xe2b5b0,
-    0xe2b5b1,
-    0xe2b5b2,
-    0xe2b5b3,
-    0xe2b5b4,
-    0xe2b5b5,
-    0xe2b5b6,
-    0xe2b5b7,
-    0xe2b5b8,
-    0xe2b5b9,
-    0xe2b5ba,
-    0xe2b5bb,
-    0xe2b5bc,
-    0xe2b5bd,
-    0xe2b5be,
-    0xe2b5bf,
-    0xe2b680,
-    0xe2b681,
-    0xe2b682,
-    0xe2b683,
-    0xe2b684,
-    0xe2b685,
-    0xe2b686,
-    0xe2b687,
-    0xe2b688,
-    0xe2b689,
-    0xe2b68a,
-    0xe2b68b,
-    0xe2b68c,
-    0xe2b68d,
-    0xe2b68e,
-    0xe2b68f,
-    0xe2b690,
-    0xe2b691,
-    0xe2b692,
-    0xe2b693,
-    0xe2b694,
-    0xe2b695,
-    0xe2b696,
-    0xe2b697,
-    0xe2b698,
-    0xe2b699,
-    0xe2b69a,
-    0xe2b69b,
-    0xe2b69c,
-    0xe2b69d,
-    0xe2b69e,
-    0xe2b69f,
-    0xe2b6a0,
-    0xe2b6a1,
-    0xe2b6a2,
-    0xe2b6a3,
-    0xe2b6a4,
-    0xe2b6a5,
-    0xe2b6a6,
-    0xe2b6a7,
-    0xe2b6a8,
-    0xe2b6a9,
-    0xe2b6aa,
-    0xe2b6ab,
-    0xe2b6ac,
-    0xe2b6ad,
-    0xe2b6ae,
-    0xe2b6af,
-    0xe2b6b0,
-    0xe2b6b1,
-    0xe2b6b2,
-    0xe2b6b3,
-    0xe2b6b4,
-    0xe2b6b5,
-    0xe2b6b6,
-    0xe2b6b7,
-    0xe2b6b8,
-    0xe2b6b9,
-    0xe2b6ba,
-    0xe2b6bb,
-    0xe2b6bc,
-    0xe2b6bd,
-    0xe2b6be,
-    0xe2b6bf,
-    0xe2b780,
-    0xe2b781,
-    0xe2b782,
-    0xe2b783,
-    0xe2b784,
-    0xe2b785,
-    0xe2b786,
-    0xe2b787,
-    0xe2b788,
-    0xe2b789,
-    0xe2b78a,
-    0xe2b78b,
-    0xe2b78c,
-    0xe2b78d,
-    0xe2b78e,
-    0xe2b78f,
-    0xe2b790,
-    0xe2b791,
-    0xe2b792,
-    0xe2b793,
-    0xe2b794,
-    0xe2b795,
-    0xe2b796,
-    0xe2b797,
-    0xe2b798,
-    0xe2b799,
-    0xe2b79a,
-    0xe2b79b,
-    0xe2b79c,
-    0xe2b79d,
-    0xe2b79e,
-    0xe2b79f,
-    0xe2b7a0,
-    0xe2b7a1,
-    0xe2b7a2,
-    0xe2b7a3,
-    0xe2b7a4,
-    0xe2b7a5,
-    0xe2b7a6,
-    0xe2b7a7,
-    0xe2b7a8,
-    0xe2b7a9,
-    0xe2b7aa,
-    0xe2b7ab,
-    0xe2b7ac,
-    0xe2b7ad,
-    0xe2b7ae,
-    0xe2b7af,
-    0xe2b7b0,
-    0xe2b7b1,
-    0xe2b7b2,
-    0xe2b7b3,
-    0xe2b7b4,
-    0xe2b7b5,
-    0xe2b7b6,
-    0xe2b7b7,
-    0xe2b7b8,
-    0xe2b7b9,
-    0xe2b7ba,
-    0xe2b7bb,
-    0xe2b7bc,
-    0xe2b7bd,
-    0xe2b7be,
-    0xe2b7bf,
-    0xe2b880,
-    0xe2b881,
-    0xe2b882,
-    0xe2b883,
-    0xe2b884,
-    0xe2b885,
-    0xe2b886,
-    0xe2b887,
-    0xe2b888,
-    0xe2b889,
-    0xe2b88a,
-    0xe2b88b,
-    0xe2b88c,
-    0xe2b88d,
-    0xe2b88e,
-    0xe2b88f,
-    0xe2b890,
-    0xe2b891,
-    0xe2b892,
-    0xe2b893,
-    0xe2b894,
-    0xe2b895,
-    0xe2b896,
-    0xe2b897,
-    0xe2b898,
-    0xe2b899,
-    0xe2b89a,
-    0xe2b89b,
-    0xe2b89c,
-    0xe2b89d,
-    0xe2b89e,
-    0xe2b89f,
-    0xe2b8a0,
-    0xe2b8a1,
-    0xe2b8a2,
-    0xe2b8a3,
-    0xe2b8a4,
-    0xe2b8a5,
-    0xe2b8a6,
-    0xe2b8a7,
-    0xe2b8a8,
-    0xe2b8a9,
-    0xe2b8aa,
-    0xe2b8ab,
-    0xe2b8ac,
-    0xe2b8ad,
-    0xe2b8ae,
-    0xe2b8af,
-    0xe2b8b0,
-    0xe2b8b1,
-    0xe2b8b2,
-    0xe2b8b3,
-    0xe2b8b4,
-    0xe2b8b5,
-    0xe2b8b6,
-    0xe2b8b7,
-    0xe2b8b8,
-    0xe2b8b9,
-    0xe2b8ba,
-    0xe2b8bb,
-    0xe2b8bc,
-    0xe2b8bd,
-    0xe2b8be,
-    0xe2b8bf,
-    0xe2b980,
-    0xe2b981,
-    0xe2b982,
-    0xe2b983,
-    0xe2b984,
-    0xe2b985,
-    0xe2b986,
-    0xe2b987,
-    0xe2b988,
-    0xe2b989,
-    0xe2b98a,
-    0xe2b98b,
-    0xe2b98c,
-    0xe2b98d,
-    0xe2b98e,
-    0xe2b98f,
-    0xe2b990,
-    0xe2b991,
-    0xe2b992,
-    0xe2b993,
-    0xe2b994,
-    0xe2b995,
-    0xe2b996,
-    0xe2b997,
-    0xe2b998,
-    0xe2b999,
-    0xe2b99a,
-    0xe2b99b,
-    0xe2b99c,
-    0xe2b99d,
-    0xe2b99e,
-    0xe2b99f,
-    0xe2b9a0,
-    0xe2b9a1,
-    0xe2b9a2,
-    0xe2b9a3,
-    0xe2b9a4,
-    0xe2b9a5,
-    0xe2b9a6,
-    0xe2b9a7,
-    0xe2b9a8,
-    0xe2b9a9,
-    0xe2b9aa,
-    0xe2b9ab,
-    0xe2b9ac,
-    0xe2b9ad,
-    0xe2b9ae,
-    0xe2b9af,
-    0xe2b9b0,
-    0xe2b9b1,
-    0xe2b9b2,
-    0xe2b9b3,
-    0xe2b9b4,
-    0xe2b9b5,
-    0xe2b9b6,
-    0xe2b9b7,
-    0xe2b9b8,
-    0xe2b9b9,
-    0xe2b9ba,
-    0xe2b9bb,
-    0xe2b9bc,
-    0xe2b9bd,
-    0xe2b9be,
-    0xe2b9bf,
-    0xe2ba80,
-    0xe2ba81,
-    0xe2ba82,
-    0xe2ba83,
-    0xe2ba84,
-    0xe2ba85,
-    0xe2ba86,
-    0xe2ba87,
-    0xe2ba88,
-    0xe2ba89,
-    0xe2ba8a,
-    0xe2ba8b,
-    0xe2ba8c,
-    0xe2ba8d,
-    0xe2ba8e,
-    0xe2ba8f,
-    0xe2ba90,
-    0xe2ba91,
-    0xe2ba92,
-    0xe2ba93,
-    0xe2ba94,
-    0xe2ba95,
-    0xe2ba96,
-    0xe2ba97,
-    0xe2ba98,
-    0xe2ba99,
-    0xe2ba9a,
-    0xe2ba9b,
-    0xe2ba9c,
-    0xe2ba9d,
-    0xe2ba9e,
-    0xe2ba9f,
-    0xe2baa0,
-    0xe2baa1,
-    0xe2baa2,
-    0xe2baa3,
-    0xe2baa4,
-    0xe2baa5,
-    0xe2baa6,
-    0xe2baa7,
-    0xe2baa8,
-    0xe2baa9,
-    0xe2baaa,
-    0xe2baab,
-    0xe2baac,
-    0xe2baad,
-    0xe2baae,
-    0xe2baaf,
-    0xe2bab0,
-    0xe2bab1,
-    0xe2bab2,
-    0xe2bab3,
-    0xe2bab4,
-    0xe2bab5,
-    0xe2bab6,
-    0xe2bab7,
-    0xe2bab8,
-    0xe2bab9,
-    0xe2baba,
-    0xe2babb,
-    0xe2babc,
-    0xe2babd,
-    0xe2babe,
-    0xe2babf,
-    0xe2bb80,
-    0xe2bb81,
-    0xe2bb82,
-    0xe2bb83,
-    0xe2bb84,
-    0xe2bb85,
-    0xe2bb86,
-    0xe2bb87,
-    0xe2bb88,
-    0xe2bb89,
-    0xe2bb8a,
-    0xe2bb8b,
-    0xe2bb8c,
-    0xe2bb8d,
-    0xe2bb8e,
-    0xe2bb8f,
-    0xe2bb90,
-    0xe2bb91,
-    0xe2bb92,
-    0xe2bb93,
-    0xe2bb94,
-    0xe2bb95,
-    0xe2bb96,
-    0xe2bb97,
-    0xe2bb98,
-    0xe2bb99,
-    0xe2bb9a,
-    0xe2bb9b,
-    0xe2bb9c,
-    0xe2bb9d,
-    0xe2bb9e,
-    0xe2bb9f,
-    0xe2bba0,
-    0xe2bba1,
-    0xe2bba2,
-    0xe2bba3,
-    0xe2bba4,
-    0xe2bba5,
-    0xe2bba6,
-    0xe2bba7,
-    0xe2bba8,
-    0xe2bba9,
-    0xe2bbaa,
-    0xe2bbab,
-    0xe2bbac,
-    0xe2bbad,
-    0xe2bbae,
-    0xe2bbaf,
-    0xe2bbb0,
-    0xe2bbb1,
-    0xe2bbb2,
-    0xe2bbb3,
-    0xe2bbb4,
-    0xe2bbb5,
-    0xe2bbb6,
-    0xe2bbb7,
-    0xe2bbb8,
-    0xe2bbb9,
-    0xe2bbba,
-    0xe2bbbb,
-    0xe2bbbc,
-    0xe2bbbd,
-    0xe2bbbe,
-    0xe2bbbf,
-    0xe2bc80,
-    0xe2bc81,
-    0xe2bc82,
-    0xe2bc83,
-    0xe2bc84,
-    0xe2bc85,
-    0xe2bc86,
-    0xe2bc87,
-    0xe2bc88,
-    0xe2bc89,
-    0xe2bc8a,
-    0xe2bc8b,
-    0xe2bc8c,
-    0xe2bc8d,
-    0xe2bc8e,
-    0xe2bc8f,
-    0xe2bc90,
-    0xe2bc91,
-    0xe2bc92,
-    0xe2bc93,
-    0xe2bc94,
-    0xe2bc95,
-    0xe2bc96,
-    0xe2bc97,
-    0xe2bc98,
-    0xe2bc99,
-    0xe2bc9a,
-    0xe2bc9b,
-    0xe2bc9c,
-    0xe2bc9d,
-    0xe2bc9e,
-    0xe2bc9f,
-    0xe2bca0,
-    0xe2bca1,
-    0xe2bca2,
-    0xe2bca3,
-    0xe2bca4,
-    0xe2bca5,
-    0xe2bca6,
-    0xe2bca7,
-    0xe2bca8,
-    0xe2bca9,
-    0xe2bcaa,
-    0xe2bcab,
-    0xe2bcac,
-    0xe2bcad,
-    0xe2bcae,
-    0xe2bcaf,
-    0xe2bcb0,
-    0xe2bcb1,
-    0xe2bcb2,
-    0xe2bcb3,
-    0xe2bcb4,
-    0xe2bcb5,
-    0xe2bcb6,
-    0xe2bcb7,
-    0xe2bcb8,
-    0xe2bcb9,
-    0xe2bcba,
-    0xe2bcbb,
-    0xe2bcbc,
-    0xe2bcbd,
-    0xe2bcbe,
-    0xe2bcbf,
-    0xe2bd80,
-    0xe2bd81,
-    0xe2bd82,
-    0xe2bd83,
-    0xe2bd84,
-    0xe2bd85,
-    0xe2bd86,
-    0xe2bd87,
-    0xe2bd88,
-    0xe2bd89,
-    0xe2bd8a,
-    0xe2bd8b,
-    0xe2bd8c,
-    0xe2bd8d,
-    0xe2bd8e,
-    0xe2bd8f,
-    0xe2bd90,
-    0xe2bd91,
-    0xe2bd92,
-    0xe2bd93,
-    0xe2bd94,
-    0xe2bd95,
-    0xe2bd96,
-    0xe2bd97,
-    0xe2bd98,
-    0xe2bd99,
-    0xe2bd9a,
-    0xe2bd9b,
-    0xe2bd9c,
-    0xe2bd9d,
-    0xe2bd9e,
-    0xe2bd9f,
-    0xe2bda0,
-    0xe2bda1,
-    0xe2bda2,
-    0xe2bda3,
-    0xe2bda4,
-    0xe2bda5,
-    0xe2bda6,
-    0xe2bda7,
-    0xe2bda8,
-    0xe2bda9,
-    0xe2bdaa,
-    0xe2bdab,
-    0xe2bdac,
-    0xe2bdad,
-    0xe2bdae,
-    0xe2bdaf,
-    0xe2bdb0,
-    0xe2bdb1,
-    0xe2bdb2,
-    0xe2bdb3,
-    0xe2bdb4,
-    0xe2bdb5,
-    0xe2bdb6,
-    0xe2bdb7,
-    0xe2bdb8,
-    0xe2bdb9,
-    0xe2bdba,
-    0xe2bdbb,
-    0xe2bdbc,
-    0xe2bdbd,
-    0xe2bdbe,
-    0xe2bdbf,
-    0xe2be80,
-    0xe2be81,
-    0xe2be82,
-    0xe2be83,
-    0xe2be84,
-    0xe2be85,
-    0xe2be86,
-    0xe2be87,
-    0xe2be88,
-    0xe2be89,
-    0xe2be8a,
-    0xe2be8b,
-    0xe2be8c,
-    0xe2be8d,
-    0xe2be8e,
-    0xe2be8f,
-    0xe2be90,
-    0xe2be91,
-    0xe2be92,
-    0xe2be93,
-    0xe2be94,
-    0xe2be95,
-    0xe2be96,
-    0xe2be97,
-    0xe2be98,
-    0xe2be99,
-    0xe2be9a,
-    0xe2be9b,
-    0xe2be9c,
-    0xe2be9d,
-    0xe2be9e,
-    0xe2be9f,
-    0xe2bea0,
-    0xe2bea1,
-    0xe2bea2,
-    0xe2bea3,
-    0xe2bea4,
-    0xe2bea5,
-    0xe2bea6,
-    0xe2bea7,
-    0xe2bea8,
-    0xe2bea9,
-    0xe2beaa,
-    0xe2beab,
-    0xe2beac,
-    0xe2bead,
-    0xe2beae,
-    0xe2beaf,
-    0xe2beb0,
-    0xe2beb1,
-    0xe2beb2,
-    0xe2beb3,
-    0xe2beb4,
-    0xe2beb5,
-    0xe2beb6,
-    0xe2beb7,
-    0xe2beb8,
-    0xe2beb9,
-    0xe2beba,
-    0xe2bebb,
-    0xe2bebc,
-    0xe2bebd,
-    0xe2bebe,
-    0xe2bebf,
-    0xe2bf80,
-    0xe2bf81,
-    0xe2bf82,
-    0xe2bf83,
-    0xe2bf84,
-    0xe2bf85,
-    0xe2bf86,
-    0xe2bf87,
-    0xe2bf88,
-    0xe2bf89,
-    0xe2bf8a,
-    0xe2bf8b,
-    0xe2bf8c,
-    0xe2bf8d,
-    0xe2bf8e,
-    0xe2bf8f,
-    0xe2bf90,
-    0xe2bf91,
-    0xe2bf92,
-    0xe2bf93,
-    0xe2bf94,
-    0xe2bf95,
-    0xe2bf96,
-    0xe2bf97,
-    0xe2bf98,
-    0xe2bf99,
-    0xe2bf9a,
-    0xe2bf9b,
-    0xe2bf9c,
-    0xe2bf9d,
-    0xe2bf9e,
-    0xe2bf9f,
-    0xe2bfa0,
-    0xe2bfa1,
-    0xe2bfa2,
-    0xe2bfa3,
-    0xe2bfa4,
-    0xe2bfa5,
-    0xe2bfa6,
-    0xe2bfa7,
-    0xe2bfa8,
-    0xe2bfa9,
-    0xe2bfaa,
-    0xe2bfab,
-    0xe2bfac,
-    0xe2bfad,
-    0xe2bfae,
-    0xe2bfaf,
-    0xe2bfb0,
-    0xe2bfb1,
-    0xe2bfb2,
-    0xe2bfb3,
-    0xe2bfb4,
-    0xe2bfb5,
-    0xe2bfb6,
-    0xe2bfb7,
-    0xe2bfb8,
-    0xe2bfb9,
-    0xe2bfba,
-    0xe2bfbb,
-    0xe2bfbc,
-    0xe2bfbd,
-    0xe2bfbe,
-    0xe2bfbf,
-    0xe38080,
-    0xe38081,
-    0xe38082,
-    0xe38083,
-    0xe38084,
-    0xe38085,
-    0xe38086,
-    0xe38087,
-    0xe38088,
-    0xe38089,
-    0xe3808a,
-    0xe3808b,
-    0xe3808c,
-    0xe3808d,
-    0xe3808e,
-    0xe3808f,
-    0xe38090,
-    0xe38091,
-    0xe38092,
-    0xe38093,
-    0xe38094,
-    0xe38095,
-    0xe38096,
-    0xe38097,
-    0xe38098,
-    0xe38099,
-    0xe3809a,
-    0xe3809b,
-    0xe3809c,
-    0xe3809d,
-    0xe3809e,
-    0xe3809f,
-    0xe380a0,
-    0xe380a1,
-    0xe380a2,
-    0xe380a3,
-    0xe380a4,
-    0xe380a5,
-    0xe380a6,
-    0xe380a7,
-    0xe380a8,
-    0xe380a9,
-    0xe380aa,
-    0xe380ab,
-    0xe380ac,
-    0xe380ad,
-    0xe380ae,
-    0xe380af,
-    0xe380b0,
-    0xe380b1,
-    0xe380b2,
-    0xe380b3,
-    0xe380b4,
-    0xe380b5,
-    0xe380b6,
-    0xe380b7,
-    0xe380b8,
-    0xe380b9,
-    0xe380ba,
-    0xe380bb,
-    0xe380bc,
-    0xe380bd,
-    0xe380be,
-    0xe380bf,
-    0xe38180,
-    0xe38181,
-    0xe38182,
-    0xe38183,
-    0xe38184,
-    0xe38185,
-    0xe38186,
-    0xe38187,
-    0xe38188,
-    0xe38189,
-    0xe3818a,
-    0xe3818b,
-    0xe3818c,
-    0xe3818d,
-    0xe3818e,
-    0xe3818f,
-    0xe38190,
-    0xe38191,
-    0xe38192,
-    0xe38193,
-    0xe38194,
-    0xe38195,
-    0xe38196,
-    0xe38197,
-    0xe38198,
-    0xe38199,
-    0xe3819a,
-    0xe3819b,
-    0xe3819c,
-    0xe3819d,
-    0xe3819e,
-    0xe3819f,
-    0xe381a0,
-    0xe381a1,
-    0xe381a2,
-    0xe381a3,
-    0xe381a4,
-    0xe381a5,
-    0xe381a6,
-    0xe381a7,
-    0xe381a8,
-    0xe381a9,
-    0xe381aa,
-    0xe381ab,
-    0xe381ac,
-    0xe381ad,
-    0xe381ae,
-    0xe381af,
-    0xe381b0,
-    0xe381b1,
-    0xe381b2,
-    0xe381b3,
-    0xe381b4,
-    0xe381b5,
-    0xe381b6,
-    0xe381b7,
-    0xe381b8,
-    0xe381b9,
-    0xe381ba,
-    0xe381bb,
-    0xe381bc,
-    0xe381bd,
-    0xe381be,
-    0xe381bf,
-    0xe38280,
-    0xe38281,
-    0xe38282,
-    0xe38283,
-    0xe38284,
-    0xe38285,
-    0xe38286,
-    0xe38287,
-    0xe38288,
-    0xe38289,
-    0xe3828a,
-    0xe3828b,
-    0xe3828c,
-    0xe3828d,
-    0xe3828e,
-    0xe3828f,
-    0xe38290,
-    0xe38291,
-    0xe38292,
-    0xe38293,
-    0xe38294,
-    0xe38295,
-    0xe38296,
-    0xe38297,
-    0xe38298,
-    0xe38299,
-    0xe3829a,
-    0xe3829b,
-    0xe3829c,
-    0xe3829d,
-    0xe3829e,
-    0xe3829f,
-    0xe382a0,
-    0xe382a1,
-    0xe382a2,
-    0xe382a3,
-    0xe382a4,
-    0xe382a5,
-    0xe382a6,
-    0xe382a7,
-    0xe382a8,
-    0xe382a9,
-    0xe382aa,
-    0xe382ab,
-    0xe382ac,
-    0xe382ad,
-    0xe382ae,
-    0xe382af,
-    0xe382b0,
-    0xe382b1,
-    0xe382b2,
-    0xe382b3,
-    0xe382b4,
-    0xe382b5,
-    0xe382b6,
-    0xe382b7,
-    0xe382b8,
-    0xe382b9,
-    0xe382ba,
-    0xe382bb,
-    0xe382bc,
-    0xe382bd,
-    0xe382be,
-    0xe382bf,
-    0xe38380,
-    0xe38381,
-    0xe38382,
-    0xe38383,
-    0xe38384,
-    0xe38385,
-    0xe38386,
-    0xe38387,
-    0xe38388,
-    0xe38389,
-    0xe3838a,
-    0xe3838b,
-    0xe3838c,
-    0xe3838d,
-    0xe3838e,
-    0xe3838f,
-    0xe38390,
-    0xe38391,
-    0xe38392,
-    0xe38393,
-    0xe38394,
-    0xe38395,
-    0xe38396,
-    0xe38397,
-    0xe38398,
-    0xe38399,
-    0xe3839a,
-    0xe3839b,
-    0xe3839c,
-    0xe3839d,
-    0xe3839e,
-    0xe3839f,
-    0xe383a0,
-    0xe383a1,
-    0xe383a2,
-    0xe383a3,
-    0xe383a4,
-    0xe383a5,
-    0xe383a6,
-    0xe383a7,
-    0xe383a8,
-    0xe383a9,
-    0xe383aa,
-    0xe383ab,
-    0xe383ac,
-    0xe383ad,
-    0xe383ae,
-    0xe383af,
-    0xe383b0,
-    0xe383b1,
-    0xe383b2,
-    0xe383b3,
-    0xe383b4,
-    0xe383b5,
-    0xe383b6,
-    0xe383b7,
-    0xe383b8,
-    0xe383b9,
-    0xe383ba,
-    0xe383bb,
-    0xe383bc,
-    0xe383bd,
-    0xe383be,
-    0xe383bf,
-    0xe38480,
-    0xe38481,
-    0xe38482,
-    0xe38483,
-    0xe38484,
-    0xe38485,
-    0xe38486,
-    0xe38487,
-    0xe38488,
-    0xe38489,
-    0xe3848a,
-    0xe3848b,
-    0xe3848c,
-    0xe3848d,
-    0xe3848e,
-    0xe3848f,
-    0xe38490,
-    0xe38491,
-    0xe38492,
-    0xe38493,
-    0xe38494,
-    0xe38495,
-    0xe38496,
-    0xe38497,
-    0xe38498,
-    0xe38499,
-    0xe3849a,
-    0xe3849b,
-    0xe3849c,
-    0xe3849d,
-    0xe3849e,
-    0xe3849f,
-    0xe384a0,
-    0xe384a1,
-    0xe384a2,
-    0xe384a3,
-    0xe384a4,
-    0xe384a5,
-    0xe384a6,
-    0xe384a7,
-    0xe384a8,
-    0xe384a9,
-    0xe384aa,
-    0xe384ab,
-    0xe384ac,
-    0xe384ad,
-    0xe384ae,
-    0xe384af,
-    0xe384b0,
-    0xe384b1,
-    0xe384b2,
-    0xe384b3,
-    0xe384b4,
-    0xe384b5,
-    0xe384b6,
-    0xe384b7,
-    0xe384b8,
-    0xe384b9,
-    0xe384ba,
-    0xe384bb,
-    0xe384bc,
-    0xe384bd,
-    0xe384be,
-    0xe384bf,
-    0xe38580,
-    0xe38581,
-    0xe38582,
-    0xe38583,
-    0xe38584,
-    0xe38585,
-    0xe38586,
-    0xe38587,
-    0xe38588,
-    0xe38589,
-    0xe3858a,
-    0xe3858b,
-    0xe3858c,
-    0xe3858d,
-    0xe3858e,
-    0xe3858f,
-    0xe38590,
-    0xe38591,
-    0xe38592,
-    0xe38593,
-    0xe38594,
-    0xe38595,
-    0xe38596,
-    0xe38597,
-    0xe38598,
-    0xe38599,
-    0xe3859a,
-    0xe3859b,
-    0xe3859c,
-    0xe3859d,
-    0xe3859e,
-    0xe3859f,
-    0xe385a0,
-    0xe385a1,
-    0xe385a2,
-    0xe385a3,
-    0xe385a4,
-    0xe385a5,
-    0xe385a6,
-    0xe385a7,
-    0xe385a8,
-    0xe385a9,
-    0xe385aa,
-    0xe385ab,
-    0xe385ac,
-    0xe385ad,
-    0xe385ae,
-    0xe385af,
-    0xe385b0,
-    0xe385b1,
-    0xe385b2,
-    0xe385b3,
-    0xe385b4,
-    0xe385b5,
-    0xe385b6,
-    0xe385b7,
-    0xe385b8,
-    0xe385b9,
-    0xe385ba,
-    0xe385bb,
-    0xe385bc,
-    0xe385bd,
-    0xe385be,
-    0xe385bf,
-    0xe38680,
-    0xe38681,
-    0xe38682,
-    0xe38683,
-    0xe38684,
-    0xe38685,
-    0xe38686,
-    0xe38687,
-    0xe38688,
-    0xe38689,
-    0xe3868a,
-    0xe3868b,
-    0xe3868c,
-    0xe3868d,
-    0xe3868e,
-    0xe3868f,
-    0xe38690,
-    0xe38691,
-    0xe38692,
-    0xe38693,
-    0xe38694,
-    0xe38695,
-    0xe38696,
-    0xe38697,
-    0xe38698,
-    0xe38699,
-    0xe3869a,
-    0xe3869b,
-    0xe3869c,
-    0xe3869d,
-    0xe3869e,
-    0xe3869f,
-    0xe386a0,
-    0xe386a1,
-    0xe386a2,
-    0xe386a3,
-    0xe386a4,
-    0xe386a5,
-    0xe386a6,
-    0xe386a7,
-    0xe386a8,
-    0xe386a9,
-    0xe386aa,
-    0xe386ab,
-    0xe386ac,
-    0xe386ad,
-    0xe386ae,
-    0xe386af,
-    0xe386b0,
-    0xe386b1,
-    0xe386b2,
-    0xe386b3,
-    0xe386b4,
-    0xe386b5,
-    0xe386b6,
-    0xe386b7,
-    0xe386b8,
-    0xe386b9,
-    0xe386ba,
-    0xe386bb,
-    0xe386bc,
-    0xe386bd,
-    0xe386be,
-    0xe386bf,
-    0xe38780,
-    0xe38781,
-    0xe38782,
-    0xe38783,
-    0xe38784,
-    0xe38785,
-    0xe38786,
-    0xe38787,
-    0xe38788,
-    0xe38789,
-    0xe3878a,
-    0xe3878b,
-    0xe3878c,
-    0xe3878d,
-    0xe3878e,
-    0xe3878f,
-    0xe38790,
-    0xe38791,
-    0xe38792,
-    0xe38793,
-    0xe38794,
-    0xe38795,
-    0xe38796,
-    0xe38797,
-    0xe38798,
-    0xe38799,
-    0xe3879a,
-    0xe3879b,
-    0xe3879c,
-    0xe3879d,
-    0xe3879e,
-    0xe3879f,
-    0xe387a0,
-    0xe387a1,
-    0xe387a2,
-    0xe387a3,
-    0xe387a4,
-    0xe387a5,
-    0xe387a6,
-    0xe387a7,
-    0xe387a8,
-    0xe387a9,
-    0xe387aa,
-    0xe387ab,
-    0xe387ac,
-    0xe387ad,
-    0xe387ae,
-    0xe387af,
-    0xe387b0,
-    0xe387b1,
-    0xe387b2,
-    0xe387b3,
-    0xe387b4,
-    0xe387b5,
-    0xe387b6,
-    0xe387b7,
-    0xe387b8,
-    0xe387b9,
-    0xe387ba,
-    0xe387bb,
-    0xe387bc,
-    0xe387bd,
-    0xe387be,
-    0xe387bf,
-    0xe38880,
-    0xe38881,
-    0xe38882,
-    0xe38883,
-    0xe38884,
-    0xe38885,
-    0xe38886,
-    0xe38887,
-    0xe38888,
-    0xe38889,
-    0xe3888a,
-    0xe3888b,
-    0xe3888c,
-    0xe3888d,
-    0xe3888e,
-    0xe3888f,
-    0xe38890,
-    0xe38891,
-    0xe38892,
-    0xe38893,
-    0xe38894,
-    0xe38895,
-    0xe38896,
-    0xe38897,
-    0xe38898,
-    0xe38899,
-    0xe3889a,
-    0xe3889b,
-    0xe3889c,
-    0xe3889d,
-    0xe3889e,
-    0xe3889f,
-    0xe388a0,
-    0xe388a1,
-    0xe388a2,
-    0xe388a3,
-    0xe388a4,
-    0xe388a5,
-    0xe388a6,
-    0xe388a7,
-    0xe388a8,
-    0xe388a9,
-    0xe388aa,
-    0xe388ab,
-    0xe388ac,
-    0xe388ad,
-    0xe388ae,
-    0xe388af,
-    0xe388b0,
-    0xe388b1,
-    0xe388b2,
-    0xe388b3,
-    0xe388b4,
-    0xe388b5,
-    0xe388b6,
-    0xe388b7,
-    0xe388b8,
-    0xe388b9,
-    0xe388ba,
-    0xe388bb,
-    0xe388bc,
-    0xe388bd,
-    0xe388be,
-    0xe388bf,
-    0xe38980,
-    0xe38981,
-    0xe38982,
-    0xe38983,
-    0xe38984,
-    0xe38985,
-    0xe38986,
-    0xe38987,
-    0xe38988,
-    0xe38989,
-    0xe3898a,
-    0xe3898b,
-    0xe3898c,
-    0xe3898d,
-    0xe3898e,
-    0xe3898f,
-    0xe38990,
-    0xe38991,
-    0xe38992,
-    0xe38993,
-    0xe38994,
-    0xe38995,
-    0xe38996,
-    0xe38997,
-    0xe38998,
-    0xe38999,
-    0xe3899a,
-    0xe3899b,
-    0xe3899c,
-    0xe3899d,
-    0xe3899e,
-    0xe3899f,
-    0xe389a0,
-    0xe389a1,
-    0xe389a2,
-    0xe389a3,
-    0xe389a4,
-    0xe389a5,
-    0xe389a6,
-    0xe389a7,
-    0xe389a8,
-    0xe389a9,
-    0xe389aa,
-    0xe389ab,
-    0xe389ac,
-    0xe389ad,
-    0xe389ae,
-    0xe389af,
-    0xe389b0,
-    0xe389b1,
-    0xe389b2,
-    0xe389b3,
-    0xe389b4,
-    0xe389b5,
-    0xe389b6,
-    0xe389b7,
-    0xe389b8,
-    0xe389b9,
-    0xe389ba,
-    0xe389bb,
-    0xe389bc,
-    0xe389bd,
-    0xe389be,
-    0xe389bf,
-    0xe38a80,
-    0xe38a81,
-    0xe38a82,
-    0xe38a83,
-    0xe38a84,
-    0xe38a85,
-    0xe38a86,
-    0xe38a87,
-    0xe38a88,
-    0xe38a89,
-    0xe38a8a,
-    0xe38a8b,
-    0xe38a8c,
-    0xe38a8d,
-    0xe38a8e,
-    0xe38a8f,
-    0xe38a90,
-    0xe38a91,
-    0xe38a92,
-    0xe38a93,
-    0xe38a94,
-    0xe38a95,
-    0xe38a96,
-    0xe38a97,
-    0xe38a98,
-    0xe38a99,
-    0xe38a9a,
-    0xe38a9b,
-    0xe38a9c,
-    0xe38a9d,
-    0xe38a9e,
-    0xe38a9f,
-    0xe38aa0,
-    0xe38aa1,
-    0xe38aa2,
-    0xe38aa3,
-    0xe38aa4,
-    0xe38aa5,
-    0xe38aa6,
-    0xe38aa7,
-    0xe38aa8,
-    0xe38aa9,
-    0xe38aaa,
-    0xe38aab,
-    0xe38aac,
-    0xe38aad,
-    0xe38aae,
-    0xe38aaf,
-    0xe38ab0,
-    0xe38ab1,
-    0xe38ab2,
-    0xe38ab3,
-    0xe38ab4,
-    0xe38ab5,
-    0xe38ab6,
-    0xe38ab7,
-    0xe38ab8,
-    0xe38ab9,
-    0xe38aba,
-    0xe38abb,
-    0xe38abc,
-    0xe38abd,
-    0xe38abe,
-    0xe38abf,
-    0xe38b80,
-    0xe38b81,
-    0xe38b82,
-    0xe38b83,
-    0xe38b84,
-    0xe38b85,
-    0xe38b86,
-    0xe38b87,
-    0xe38b88,
-    0xe38b89,
-    0xe38b8a,
-    0xe38b8b,
-    0xe38b8c,
-    0xe38b8d,
-    0xe38b8e,
-    0xe38b8f,
-    0xe38b90,
-    0xe38b91,
-    0xe38b92,
-    0xe38b93,
-    0xe38b94,
-    0xe38b95,
-    0xe38b96,
-    0xe38b97,
-    0xe38b98,
-    0xe38b99,
-    0xe38b9a,
-    0xe38b9b,
-    0xe38b9c,
-    0xe38b9d,
-    0xe38b9e,
-    0xe38b9f,
-    0xe38ba0,
-    0xe38ba1,
-    0xe38ba2,
-    0xe38ba3,
-    0xe38ba4,
-    0xe38ba5,
-    0xe38ba6,
-    0xe38ba7,
-    0xe38ba8,
-    0xe38ba9,
-    0xe38baa,
-    0xe38bab,
-    0xe38bac,
-    0xe38bad,
-    0xe38bae,
-    0xe38baf,
-    0xe38bb0,
-    0xe38bb1,
-    0xe38bb2,
-    0xe38bb3,
-    0xe38bb4,
-    0xe38bb5,
-    0xe38bb6,
-    0xe38bb7,
-    0xe38bb8,
-    0xe38bb9,
-    0xe38bba,
-    0xe38bbb,
-    0xe38bbc,
-    0xe38bbd,
-    0xe38bbe,
-    0xe38bbf,
-    0xe38c80,
-    0xe38c81,
-    0xe38c82,
-    0xe38c83,
-    0xe38c84,
-    0xe38c85,
-    0xe38c86,
-    0xe38c87,
-    0xe38c88,
-    0xe38c89,
-    0xe38c8a,
-    0xe38c8b,
-    0xe38c8c,
-    0xe38c8d,
-    0xe38c8e,
-    0xe38c8f,
-    0xe38c90,
-    0xe38c91,
-    0xe38c92,
-    0xe38c93,
-    0xe38c94,
-    0xe38c95,
-    0xe38c96,
-    0xe38c97,
-    0xe38c98,
-    0xe38c99,
-    0xe38c9a,
-    0xe38c9b,
-    0xe38c9c,
-    0xe38c9d,
-    0xe38c9e,
-    0xe38c9f,
-    0xe38ca0,
-    0xe38ca1,
-    0xe38ca2,
-    0xe38ca3,
-    0xe38ca4,
-    0xe38ca5,
-    0xe38ca6,
-    0xe38ca7,
-    0xe38ca8,
-    0xe38ca9,
-    0xe38caa,
-    0xe38cab,
-    0xe38cac,
-    0xe38cad,
-    0xe38cae,
-    0xe38caf,
-    0xe38cb0,
-    0xe38cb1,
-    0xe38cb2,
-    0xe38cb3,
-    0xe38cb4,
-    0xe38cb5,
-    0xe38cb6,
-    0xe38cb7,
-    0xe38cb8,
-    0xe38cb9,
-    0xe38cba,
-    0xe38cbb,
-    0xe38cbc,
-    0xe38cbd,
-    0xe38cbe,
-    0xe38cbf,
-    0xe38d80,
-    0xe38d81,
-    0xe38d82,
-    0xe38d83,
-    0xe38d84,
-    0xe38d85,
-    0xe38d86,
-    0xe38d87,
-    0xe38d88,
-    0xe38d89,
-    0xe38d8a,
-    0xe38d8b,
-    0xe38d8c,
-    0xe38d8d,
-    0xe38d8e,
-    0xe38d8f,
-    0xe38d90,
-    0xe38d91,
-    0xe38d92,
-    0xe38d93,
-    0xe38d94,
-    0xe38d95,
-    0xe38d96,
-    0xe38d97,
-    0xe38d98,
-    0xe38d99,
-    0xe38d9a,
-    0xe38d9b,
-    0xe38d9c,
-    0xe38d9d,
-    0xe38d9e,
-    0xe38d9f,
-    0xe38da0,
-    0xe38da1,
-    0xe38da2,
-    0xe38da3,
-    0xe38da4,
-    0xe38da5,
-    0xe38da6,
-    0xe38da7,
-    0xe38da8,
-    0xe38da9,
-    0xe38daa,
-    0xe38dab,
-    0xe38dac,
-    0xe38dad,
-    0xe38dae,
-    0xe38daf,
-    0xe38db0,
-    0xe38db1,
-    0xe38db2,
-    0xe38db3,
-    0xe38db4,
-    0xe38db5,
-    0xe38db6,
-    0xe38db7,
-    0xe38db8,
-    0xe38db9,
-    0xe38dba,
-    0xe38dbb,
-    0xe38dbc,
-    0xe38dbd,
-    0xe38dbe,
-    0xe38dbf,
-    0xe38e80,
-    0xe38e81,
-    0xe38e82,
-    0xe38e83,
-    0xe38e84,
-    0xe38e85,
-    0xe38e86,
-    0xe38e87,
-    0xe38e88,
-    0xe38e89,
-    0xe38e8a,
-    0xe38e8b,
-    0xe38e8c,
-    0xe38e8d,
-    0xe38e8e,
-    0xe38e8f,
-    0xe38e90,
-    0xe38e91,
-    0xe38e92,
-    0xe38e93,
-    0xe38e94,
-    0xe38e95,
-    0xe38e96,
-    0xe38e97,
-    0xe38e98,
-    0xe38e99,
-    0xe38e9a,
-    0xe38e9b,
-    0xe38e9c,
-    0xe38e9d,
-    0xe38e9e,
-    0xe38e9f,
-    0xe38ea0,
-    0xe38ea1,
-    0xe38ea2,
-    0xe38ea3,
-    0xe38ea4,
-    0xe38ea5,
-    0xe38ea6,
-    0xe38ea7,
-    0xe38ea8,
-    0xe38ea9,
-    0xe38eaa,
-    0xe38eab,
-    0xe38eac,
-    0xe38ead,
-    0xe38eae,
-    0xe38eaf,
-    0xe38eb0,
-    0xe38eb1,
-    0xe38eb2,
-    0xe38eb3,
-    0xe38eb4,
-    0xe38eb5,
-    0xe38eb6,
-    0xe38eb7,
-    0xe38eb8,
-    0xe38eb9,
-    0xe38eba,
-    0xe38ebb,
-    0xe38ebc,
-    0xe38ebd,
-    0xe38ebe,
-    0xe38ebf,
-    0xe38f80,
-    0xe38f81,
-    0xe38f82,
-    0xe38f83,
-    0xe38f84,
-    0xe38f85,
-    0xe38f86,
-    0xe38f87,
-    0xe38f88,
-    0xe38f89,
-    0xe38f8a,
-    0xe38f8b,
-    0xe38f8c,
-    0xe38f8d,
-    0xe38f8e,
-    0xe38f8f,
-    0xe38f90,
-    0xe38f91,
-    0xe38f92,
-    0xe38f93,
-    0xe38f94,
-    0xe38f95,
-    0xe38f96,
-    0xe38f97,
-    0xe38f98,
-    0xe38f99,
-    0xe38f9a,
-    0xe38f9b,
-    0xe38f9c,
-    0xe38f9d,
-    0xe38f9e,
-    0xe38f9f,
-    0xe38fa0,
-    0xe38fa1,
-    0xe38fa2,
-    0xe38fa3,
-    0xe38fa4,
-    0xe38fa5,
-    0xe38fa6,
-    0xe38fa7,
-    0xe38fa8,
-    0xe38fa9,
-    0xe38faa,
-    0xe38fab,
-    0xe38fac,
-    0xe38fad,
-    0xe38fae,
-    0xe38faf,
-    0xe38fb0,
-    0xe38fb1,
-    0xe38fb2,
-    0xe38fb3,
-    0xe38fb4,
-    0xe38fb5,
-    0xe38fb6,
-    0xe38fb7,
-    0xe38fb8,
-    0xe38fb9,
-    0xe38fba,
-    0xe38fbb,
-    0xe38fbc,
-    0xe38fbd,
-    0xe38fbe,
-    0xe38fbf,
-    0xe39080,
-    0xe39081,
-    0xe39082,
-    0xe39083,
-    0xe39084,
-    0xe39085,
-    0xe39086,
-    0xe39087,
-    0xe39088,
-    0xe39089,
-    0xe3908a,
-    0xe3908b,
-    0xe3908c,
-    0xe3908d,
-    0xe3908e,
-    0xe3908f,
-    0xe39090,
-    0xe39091,
-    0xe39092,
-    0xe39093,
-    0xe39094,
-    0xe39095,
-    0xe39096,
-    0xe39097,
-    0xe39098,
-    0xe39099,
-    0xe3909a,
-    0xe3909b,
-    0xe3909c,
-    0xe3909d,
-    0xe3909e,
-    0xe3909f,
-    0xe390a0,
-    0xe390a1,
-    0xe390a2,
-    0xe390a3,
-    0xe390a4,
-    0xe390a5,
-    0xe390a6,
-    0xe390a7,
-    0xe390a8,
-    0xe390a9,
-    0xe390aa,
-    0xe390ab,
-    0xe390ac,
-    0xe390ad,
-    0xe390ae,
-    0xe390af,
-    0xe390b0,
-    0xe390b1,
-    0xe390b2,
-    0xe390b3,
-    0xe390b4,
-    0xe390b5,
-    0xe390b6,
-    0xe390b7,
-    0xe390b8,
-    0xe390b9,
-    0xe390ba,
-    0xe390bb,
-    0xe390bc,
-    0xe390bd,
-    0xe390be,
-    0xe390bf,
-    0xe39180,
-    0xe39181,
-    0xe39182,
-    0xe39183,
-    0xe39184,
-    0xe39185,
-    0xe39186,
-    0xe39187,
-    0xe39188,
-    0xe39189,
-    0xe3918a,
-    0xe3918b,
-    0xe3918c,
-    0xe3918d,
-    0xe3918e,
-    0xe3918f,
-    0xe39190,
-    0xe39191,
-    0xe39192,
-    0xe39193,
-    0xe39194,
-    0xe39195,
-    0xe39196,
-    0xe39197,
-    0xe39198,
-    0xe39199,
-    0xe3919a,
-    0xe3919b,
-    0xe3919c,
-    0xe3919d,
-    0xe3919e,
-    0xe3919f,
-    0xe391a0,
-    0xe391a1,
-    0xe391a2,
-    0xe391a3,
-    0xe391a4,
-    0xe391a5,
-    0xe391a6,
-    0xe391a7,
-    0xe391a8,
-    0xe391a9,
-    0xe391aa,
-    0xe391ab,
-    0xe391ac,
-    0xe391ad,
-    0xe391ae,
-    0xe391af,
-    0xe391b0,
-    0xe391b1,
-    0xe391b2,
-    0xe391b3,
-    0xe391b4,
-    0xe391b5,
-    0xe391b6,
-    0xe391b7,
-    0xe391b8,
-    0xe391b9,
-    0xe391ba,
-    0xe391bb,
-    0xe391bc,
-    0xe391bd,
-    0xe391be,
-    0xe391bf,
-    0xe39280,
-    0xe39281,
-    0xe39282,
-    0xe39283,
-    0xe39284,
-    0xe39285,
-    0xe39286,
-    0xe39287,
-    0xe39288,
-    0xe39289,
-    0xe3928a,
-    0xe3928b,
-    0xe3928c,
-    0xe3928d,
-    0xe3928e,
-    0xe3928f,
-    0xe39290,
-    0xe39291,
-    0xe39292,
-    0xe39293,
-    0xe39294,
-    0xe39295,
-    0xe39296,
-    0xe39297,
-    0xe39298,
-    0xe39299,
-    0xe3929a,
-    0xe3929b,
-    0xe3929c,
-    0xe3929d,
-    0xe3929e,
-    0xe3929f,
-    0xe392a0,
-    0xe392a1,
-    0xe392a2,
-    0xe392a3,
-    0xe392a4,
-    0xe392a5,
-    0xe392a6,
-    0xe392a7,
-    0xe392a8,
-    0xe392a9,
-    0xe392aa,
-    0xe392ab,
-    0xe392ac,
-    0xe392ad,
-    0xe392ae,
-    0xe392af,
-    0xe392b0,
-    0xe392b1,
-    0xe392b2,
-    0xe392b3,
-    0xe392b4,
-    0xe392b5,
-    0xe392b6,
-    0xe392b7,
-    0xe392b8,
-    0xe392b9,
-    0xe392ba,
-    0xe392bb,
-    0xe392bc,
-    0xe392bd,
-    0xe392be,
-    0xe392bf,
-    0xe39380,
-    0xe39381,
-    0xe39382,
-    0xe39383,
-    0xe39384,
-    0xe39385,
-    0xe39386,
-    0xe39387,
-    0xe39388,
-    0xe39389,
-    0xe3938a,
-    0xe3938b,
-    0xe3938c,
-    0xe3938d,
-    0xe3938e,
-    0xe3938f,
-    0xe39390,
-    0xe39391,
-    0xe39392,
-    0xe39393,
-    0xe39394,
-    0xe39395,
-    0xe39396,
-    0xe39397,
-    0xe39398,
-    0xe39399,
-    0xe3939a,
-    0xe3939b,
-    0xe3939c,
-    0xe3939d,
-    0xe3939e,
-    0xe3939f,
-    0xe393a0,
-    0xe393a1,
-    0xe393a2,
-    0xe393a3,
-    0xe393a4,
-    0xe393a5,
-    0xe393a6,
-    0xe393a7,
-    0xe393a8,
-    0xe393a9,
-    0xe393aa,
-    0xe393ab,
-    0xe393ac,
-    0xe393ad,
-    0xe393ae,
-    0xe393af,
-    0xe393b0,
-    0xe393b1,
-    0xe393b2,
-    0xe393b3,
-    0xe393b4,
-    0xe393b5,
-    0xe393b6,
-    0xe393b7,
-    0xe393b8,
-    0xe393b9,
-    0xe393ba,
-    0xe393bb,
-    0xe393bc,
-    0xe393bd,
-    0xe393be,
-    0xe393bf,
-    0xe39480,
-    0xe39481,
-    0xe39482,
-    0xe39483,
-    0xe39484,
-    0xe39485,
-    0xe39486,
-    0xe39487,
-    0xe39488,
-    0xe39489,
-    0xe3948a,
-    0xe3948b,
-    0xe3948c,
-    0xe3948d,
-    0xe3948e,
-    0xe3948f,
-    0xe39490,
-    0xe39491,
-    0xe39492,
-    0xe39493,
-    0xe39494,
-    0xe39495,
-    0xe39496,
-    0xe39497,
-    0xe39498,
-    0xe39499,
-    0xe3949a,
-    0xe3949b,
-    0xe3949c,
-    0xe3949d,
-    0xe3949e,
-    0xe3949f,
-    0xe394a0,
-    0xe394a1,
-    0xe394a2,
-    0xe394a3,
-    0xe394a4,
-    0xe394a5,
-    0xe394a6,
-    0xe394a7,
-    0xe394a8,
-    0xe394a9,
-    0xe394aa,
-    0xe394ab,
-    0xe394ac,
-    0xe394ad,
-    0xe394ae,
-    0xe394af,
-    0xe394b0,
-    0xe394b1,
-    0xe394b2,
-    0xe394b3,
-    0xe394b4,
-    0xe394b5,
-    0xe394b6,
-    0xe394b7,
-    0xe394b8,
-    0xe394b9,
-    0xe394ba,
-    0xe394bb,
-    0xe394bc,
-    0xe394bd,
-    0xe394be,
-    0xe394bf,
-    0xe39580,
-    0xe39581,
-    0xe39582,
-    0xe39583,
-    0xe39584,
-    0xe39585,
-    0xe39586,
-    0xe39587,
-    0xe39588,
-    0xe39589,
-    0xe3958a,
-    0xe3958b,
-    0xe3958c,
-    0xe3958d,
-    0xe3958e,
-    0xe3958f,
-    0xe39590,
-    0xe39591,
-    0xe39592,
-    0xe39593,
-    0xe39594,
-    0xe39595,
-    0xe39596,
-    0xe39597,
-    0xe39598,
-    0xe39599,
-    0xe3959a,
-    0xe3959b,
-    0xe3959c,
-    0xe3959d,
-    0xe3959e,
-    0xe3959f,
-    0xe395a0,
-    0xe395a1,
-    0xe395a2,
-    0xe395a3,
-    0xe395a4,
-    0xe395a5,
-    0xe395a6,
-    0xe395a7,
-    0xe395a8,
-    0xe395a9,
-    0xe395aa,
-    0xe395ab,
-    0xe395ac,
-    0xe395ad,
-    0xe395ae,
-    0xe395af,
-    0xe395b0,
-    0xe395b1,
-    0xe395b2,
-    0xe395b3,
-    0xe395b4,
-    0xe395b5,
-    0xe395b6,
-    0xe395b7,
-    0xe395b8,
-    0xe395b9,
-    0xe395ba,
-    0xe395bb,
-    0xe395bc,
-    0xe395bd,
-    0xe395be,
-    0xe395bf,
-    0xe39680,
-    0xe39681,
-    0xe39682,
-    0xe39683,
-    0xe39684,
-    0xe39685,
-    0xe39686,
-    0xe39687,
-    0xe39688,
-    0xe39689,
-    0xe3968a,
-    0xe3968b,
-    0xe3968c,
-    0xe3968d,
-    0xe3968e,
-    0xe3968f,
-    0xe39690,
-    0xe39691,
-    0xe39692,
-    0xe39693,
-    0xe39694,
-    0xe39695,
-    0xe39696,
-    0xe39697,
-    0xe39698,
-    0xe39699,
-    0xe3969a,
-    0xe3969b,
-    0xe3969c,
-    0xe3969d,
-    0xe3969e,
-    0xe3969f,
-    0xe396a0,
-    0xe396a1,
-    0xe396a2,
-    0xe396a3,
-    0xe396a4,
-    0xe396a5,
-    0xe396a6,
-    0xe396a7,
-    0xe396a8,
-    0xe396a9,
-    0xe396aa,
-    0xe396ab,
-    0xe396ac,
-    0xe396ad,
-    0xe396ae,
-    0xe396af,
-    0xe396b0,
-    0xe396b1,
-    0xe396b2,
-    0xe396b3,
-    0xe396b4,
-    0xe396b5,
-    0xe396b6,
-    0xe396b7,
-    0xe396b8,
-    0xe396b9,
-    0xe396ba,
-    0xe396bb,
-    0xe396bc,
-    0xe396bd,
-    0xe396be,
-    0xe396bf,
-    0xe39780,
-    0xe39781,
-    0xe39782,
-    0xe39783,
-    0xe39784,
-    0xe39785,
-    0xe39786,
-    0xe39787,
-    0xe39788,
-    0xe39789,
-    0xe3978a,
-    0xe3978b,
-    0xe3978c,
-    0xe3978d,
-    0xe3978e,
-    0xe3978f,
-    0xe39790,
-    0xe39791,
-    0xe39792,
-    0xe39793,
-    0xe39794,
-    0xe39795,
-    0xe39796,
-    0xe39797,
-    0xe39798,
-    0xe39799,
-    0xe3979a,
-    0xe3979b,
-    0xe3979c,
-    0xe3979d,
-    0xe3979e,
-    0xe3979f,
-    0xe397a0,
-    0xe397a1,
-    0xe397a2,
-    0xe397a3,
-    0xe397a4,
-    0xe397a5,
-    0xe397a6,
-    0xe397a7,
-    0xe397a8,
-    0xe397a9,
-    0xe397aa,
-    0xe397ab,
-    0xe397ac,
-    0xe397ad,
-    0xe397ae,
-    0xe397af,
-    0xe397b0,
-    0xe397b1,
-    0xe397b2,
-    0xe397b3,
-    0xe397b4,
-    0xe397b5,
-    0xe397b6,
-    0xe397b7,
-    0xe397b8,
-    0xe397b9,
-    0xe397ba,
-    0xe397bb,
-    0xe397bc,
-    0xe397bd,
-    0xe397be,
-    0xe397bf,
-    0xe39880,
-    0xe39881,
-    0xe39882,
-    0xe39883,
-    0xe39884,
-    0xe39885,
-    0xe39886,
-    0xe39887,
-    0xe39888,
-    0xe39889,
-    0xe3988a,
-    0xe3988b,
-    0xe3988c,
-    0xe3988d,
-    0xe3988e,
-    0xe3988f,
-    0xe39890,
-    0xe39891,
-    0xe39892,
-    0xe39893,
-    0xe39894,
-    0xe39895,
-    0xe39896,
-    0xe39897,
-    0xe39898,
-    0xe39899,
-    0xe3989a,
-    0xe3989b,
-    0xe3989c,
-    0xe3989d,
-    0xe3989e,
-    0xe3989f,
-    0xe398a0,
-    0xe398a1,
-    0xe398a2,
-    0xe398a3,
-    0xe398a4,
-    0xe398a5,
-    0xe398a6,
-    0xe398a7,
-    0xe398a8,
-    0xe398a9,
-    0xe398aa,
-    0xe398ab,
-    0xe398ac,
-    0xe398ad,
-    0xe398ae,
-    0xe398af,
-    0xe398b0,
-    0xe398b1,
-    0xe398b2,
-    0xe398b3,
-    0xe398b4,
-    0xe398b5,
-    0xe398b6,
-    0xe398b7,
-    0xe398b8,
-    0xe398b9,
-    0xe398ba,
-    0xe398bb,
-    0xe398bc,
-    0xe398bd,
-    0xe398be,
-    0xe398bf,
-    0xe39980,
-    0xe39981,
-    0xe39982,
-    0xe39983,
-    0xe39984,
-    0xe39985,
-    0xe39986,
-    0xe39987,
-    0xe39988,
-    0xe39989,
-    0xe3998a,
-    0xe3998b,
-    0xe3998c,
-    0xe3998d,
-    0xe3998e,
-    0xe3998f,
-    0xe39990,
-    0xe39991,
-    0xe39992,
-    0xe39993,
-    0xe39994,
-    0xe39995,
-    0xe39996,
-    0xe39997,
-    0xe39998,
-    0xe39999,
-    0xe3999a,
-    0xe3999b,
-    0xe3999c,
-    0xe3999d,
-    0xe3999e,
-    0xe3999f,
-    0xe399a0,
-    0xe399a1,
-    0xe399a2,
-    0xe399a3,
-    0xe399a4,
-    0xe399a5,
-    0xe399a6,
-    0xe399a7,
-    0xe399a8,
-    0xe399a9,
-    0xe399aa,
-    0xe399ab,
-    0xe399ac,
-    0xe399ad,
-    0xe399ae,
-    0xe399af,
-    0xe399b0,
-    0xe399b1,
-    0xe399b2,
-    0xe399b3,
-    0xe399b4,
-    0xe399b5,
-    0xe399b6,
-    0xe399b7,
-    0xe399b8,
-    0xe399b9,
-    0xe399ba,
-    0xe399bb,
-    0xe399bc,
-    0xe399bd,
-    0xe399be,
-    0xe399bf,
-    0xe39a80,
-    0xe39a81,
-    0xe39a82,
-    0xe39a83,
-    0xe39a84,
-    0xe39a85,
-    0xe39a86,
-    0xe39a87,
-    0xe39a88,
-    0xe39a89,
-    0xe39a8a,
-    0xe39a8b,
-    0xe39a8c,
-    0xe39a8d,
-    0xe39a8e,
-    0xe39a8f,
-    0xe39a90,
-    0xe39a91,
-    0xe39a92,
-    0xe39a93,
-    0xe39a94,
-    0xe39a95,
-    0xe39a96,
-    0xe39a97,
-    0xe39a98,
-    0xe39a99,
-    0xe39a9a,
-    0xe39a9b,
-    0xe39a9c,
-    0xe39a9d,
-    0xe39a9e,
-    0xe39a9f,
-    0xe39aa0,
-    0xe39aa1,
-    0xe39aa2,
-    0xe39aa3,
-    0xe39aa4,
-    0xe39aa5,
-    0xe39aa6,
-    0xe39aa7,
-    0xe39aa8,
-    0xe39aa9,
-    0xe39aaa,
-    0xe39aab,
-    0xe39aac,
-    0xe39aad,
-    0xe39aae,
-    0xe39aaf,
-    0xe39ab0,
-    0xe39ab1,
-    0xe39ab2,
-    0xe39ab3,
-    0xe39ab4,
-    0xe39ab5,
-    0xe39ab6,
-    0xe39ab7,
-    0xe39ab8,
-    0xe39ab9,
-    0xe39aba,
-    0xe39abb,
-    0xe39abc,
-    0xe39abd,
-    0xe39abe,
-    0xe39abf,
-    0xe39b80,
-    0xe39b81,
-    0xe39b82,
-    0xe39b83,
-    0xe39b84,
-    0xe39b85,
-    0xe39b86,
-    0xe39b87,
-    0xe39b88,
-    0xe39b89,
-    0xe39b8a,
-    0xe39b8b,
-    0xe39b8c,
-    0xe39b8d,
-    0xe39b8e,
-    0xe39b8f,
-    0xe39b90,
-    0xe39b91,
-    0xe39b92,
-    0xe39b93,
-    0xe39b94,
-    0xe39b95,
-    0xe39b96,
-    0xe39b97,
-    0xe39b98,
-    0xe39b99,
-    0xe39b9a,
-    0xe39b9b,
-    0xe39b9c,
-    0xe39b9d,
-    0xe39b9e,
-    0xe39b9f,
-    0xe39ba0,
-    0xe39ba1,
-    0xe39ba2,
-    0xe39ba3,
-    0xe39ba4,
-    0xe39ba5,
-    0xe39ba6,
-    0xe39ba7,
-    0xe39ba8,
-    0xe39ba9,
-    0xe39baa,
-    0xe39bab,
-    0xe39bac,
-    0xe39bad,
-    0xe39bae,
-    0xe39baf,
-    0xe39bb0,
-    0xe39bb1,
-    0xe39bb2,
-    0xe39bb3,
-    0xe39bb4,
-    0xe39bb5,
-    0xe39bb6,
-    0xe39bb7,
-    0xe39bb8,
-    0xe39bb9,
-    0xe39bba,
-    0xe39bbb,
-    0xe39bbc,
-    0xe39bbd,
-    0xe39bbe,
-    0xe39bbf,
-    0xe39c80,
-    0xe39c81,
-    0xe39c82,
-    0xe39c83,
-    0xe39c84,
-    0xe39c85,
-    0xe39c86,
-    0xe39c87,
-    0xe39c88,
-    0xe39c89,
-    0xe39c8a,
-    0xe39c8b,
-    0xe39c8c,
-    0xe39c8d,
-    0xe39c8e,
-    0xe39c8f,
-    0xe39c90,
-    0xe39c91,
-    0xe39c92,
-    0xe39c93,
-    0xe39c94,
-    0xe39c95,
-    0xe39c96,
-    0xe39c97,
-    0xe39c98,
-    0xe39c99,
-    0xe39c9a,
-    0xe39c9b,
-    0xe39c9c,
-    0xe39c9d,
-    0xe39c9e,
-    0xe39c9f,
-    0xe39ca0,
-    0xe39ca1,
-    0xe39ca2,
-    0xe39ca3,
-    0xe39ca4,
-    0xe39ca5,
-    0xe39ca6,
-    0xe39ca7,
-    0xe39ca8,
-    0xe39ca9,
-    0xe39caa,
-    0xe39cab,
-    0xe39cac,
-    0xe39cad,
-    0xe39cae,
-    0xe39caf,
-    0xe39cb0,
-    0xe39cb1,
-    0xe39cb2,
-    0xe39cb3,
-    0xe39cb4,
-    0xe39cb5,
-    0xe39cb6,
-    0xe39cb7,
-    0xe39cb8,
-    0xe39cb9,
-    0xe39cba,
-    0xe39cbb,
-    0xe39cbc,
-    0xe39cbd,
-    0xe39cbe,
-    0xe39cbf,
-    0xe39d80,
-    0xe39d81,
-    0xe39d82,
-    0xe39d83,
-    0xe39d84,
-    0xe39d85,
-    0xe39d86,
-    0xe39d87,
-    0xe39d88,
-    0xe39d89,
-    0xe39d8a,
-    0xe39d8b,
-    0xe39d8c,
-    0xe39d8d,
-    0xe39d8e,
-    0xe39d8f,
-    0xe39d90,
-    0xe39d91,
-    0xe39d92,
-    0xe39d93,
-    0xe39d94,
-    0xe39d95,
-    0xe39d96,
-    0xe39d97,
-    0xe39d98,
-    0xe39d99,
-    0xe39d9a,
-    0xe39d9b,
-    0xe39d9c,
-    0xe39d9d,
-    0xe39d9e,
-    0xe39d9f,
-    0xe39da0,
-    0xe39da1,
-    0xe39da2,
-    0xe39da3,
-    0xe39da4,
-    0xe39da5,
-    0xe39da6,
-    0xe39da7,
-    0xe39da8,
-    0xe39da9,
-    0xe39daa,
-    0xe39dab,
-    0xe39dac,
-    0xe39dad,
-    0xe39dae,
-    0xe39daf,
-    0xe39db0,
-    0xe39db1,
-    0xe39db2,
-    0xe39db3,
-    0xe39db4,
-    0xe39db5,
-    0xe39db6,
-    0xe39db7,
-    0xe39db8,
-    0xe39db9,
-    0xe39dba,
-    0xe39dbb,
-    0xe39dbc,
-    0xe39dbd,
-    0xe39dbe,
-    0xe39dbf,
-    0xe39e80,
-    0xe39e81,
-    0xe39e82,
-    0xe39e83,
-    0xe39e84,
-    0xe39e85,
-    0xe39e86,
-    0xe39e87,
-    0xe39e88,
-    0xe39e89,
-    0xe39e8a,
-    0xe39e8b,
-    0xe39e8c,
-    0xe39e8d,
-    0xe39e8e,
-    0xe39e8f,
-    0xe39e90,
-    0xe39e91,
-    0xe39e92,
-    0xe39e93,
-    0xe39e94,
-    0xe39e95,
-    0xe39e96,
-    0xe39e97,
-    0xe39e98,
-    0xe39e99,
-    0xe39e9a,
-    0xe39e9b,
-    0xe39e9c,
-    0xe39e9d,
-    0xe39e9e,
-    0xe39e9f,
-    0xe39ea0,
-    0xe39ea1,
-    0xe39ea2,
-    0xe39ea3,
-    0xe39ea4,
-    0xe39ea5,
-    0xe39ea6,
-    0xe39ea7,
-    0xe39ea8,
-    0xe39ea9,
-    0xe39eaa,
-    0xe39eab,
-    0xe39eac,
-    0xe39ead,
-    0xe39eae,
-    0xe39eaf,
-    0xe39eb0,
-    0xe39eb1,
-    0xe39eb2,
-    0xe39eb3,
-    0xe39eb4,
-    0xe39eb5,
-    0xe39eb6,
-    0xe39eb7,
-    0xe39eb8,
-    0xe39eb9,
-    0xe39eba,
-    0xe39ebb,
-    0xe39ebc,
-    0xe39ebd,
-    0xe39ebe,
-    0xe39ebf,
-    0xe39f80,
-    0xe39f81,
-    0xe39f82,
-    0xe39f83,
-    0xe39f84,
-    0xe39f85,
-    0xe39f86,
-    0xe39f87,
-    0xe39f88,
-    0xe39f89,
-    0xe39f8a,
-    0xe39f8b,
-    0xe39f8c,
-    0xe39f8d,
-    0xe39f8e,
-    0xe39f8f,
-    0xe39f90,
-    0xe39f91,
-    0xe39f92,
-    0xe39f93,
-    0xe39f94,
-    0xe39f95,
-    0xe39f96,
-    0xe39f97,
-    0xe39f98,
-    0xe39f99,
-    0xe39f9a,
-    0xe39f9b,
-    0xe39f9c,
-    0xe39f9d,
-    0xe39f9e,
-    0xe39f9f,
-    0xe39fa0,
-    0xe39fa1,
-    0xe39fa2,
-    0xe39fa3,
-    0xe39fa4,
-    0xe39fa5,
-    0xe39fa6,
-    0xe39fa7,
-    0xe39fa8,
-    0xe39fa9,
-    0xe39faa,
-    0xe39fab,
-    0xe39fac,
-    0xe39fad,
-    0xe39fae,
-    0xe39faf,
-    0xe39fb0,
-    0xe39fb1,
-    0xe39fb2,
-    0xe39fb3,
-    0xe39fb4,
-    0xe39fb5,
-    0xe39fb6,
-    0xe39fb7,
-    0xe39fb8,
-    0xe39fb9,
-    0xe39fba,
-    0xe39fbb,
-    0xe39fbc,
-    0xe39fbd,
-    0xe39fbe,
-    0xe39fbf,
-    0xe3a080,
-    0xe3a081,
-    0xe3a082,
-    0xe3a083,
-    0xe3a084,
-    0xe3a085,
-    0xe3a086,
-    0xe3a087,
-    0xe3a088,
-    0xe3a089,
-    0xe3a08a,
-    0xe3a08b,
-    0xe3a08c,
-    0xe3a08d,
-    0xe3a08e,
-    0xe3a08f,
-    0xe3a090,
-    0xe3a091,
-    0xe3a092,
-    0xe3a093,
-    0xe3a094,
-    0xe3a095,
-    0xe3a096,
-    0xe3a097,
-    0xe3a098,
-    0xe3a099,
-    0xe3a09a,
-    0xe3a09b,
-    0xe3a09c,
-    0xe3a09d,
-    0xe3a09e,
-    0xe3a09f,
-    0xe3a0a0,
-    0xe3a0a1,
-    0xe3a0a2,
-    0xe3a0a3,
-    0xe3a0a4,
-    0xe3a0a5,
-    0xe3a0a6,
-    0xe3a0a7,
-    0xe3a0a8,
-    0xe3a0a9,
-    0xe3a0aa,
-    0xe3a0ab,
-    0xe3a0ac,
-    0xe3a0ad,
-    0xe3a0ae,
-    0xe3a0af,
-    0xe3a0b0,
-    0xe3a0b1,
-    0xe3a0b2,
-    0xe3a0b3,
-    0xe3a0b4,
-    0xe3a0b5,
-    0xe3a0b6,
-    0xe3a0b7,
-    0xe3a0b8,
-    0xe3a0b9,
-    0xe3a0ba,
-    0xe3a0bb,
-    0xe3a0bc,
-    0xe3a0bd,
-    0xe3a0be,
-    0xe3a0bf,
-    0xe3a180,
-    0xe3a181,
-    0xe3a182,
-    0xe3a183,
-    0xe3a184,
-    0xe3a185,
-    0xe3a186,
-    0xe3a187,
-    0xe3a188,
-    0xe3a189,
-    0xe3a18a,
-    0xe3a18b,
-    0xe3a18c,
-    0xe3a18d,
-    0xe3a18e,
-    0xe3a18f,
-    0xe3a190,
-    0xe3a191,
-    0xe3a192,
-    0xe3a193,
-    0xe3a194,
-    0xe3a195,
-    0xe3a196,
-    0xe3a197,
-    0xe3a198,
-    0xe3a199,
-    0xe3a19a,
-    0xe3a19b,
-    0xe3a19c,
-    0xe3a19d,
-    0xe3a19e,
-    0xe3a19f,
-    0xe3a1a0,
-    0xe3a1a1,
-    0xe3a1a2,
-    0xe3a1a3,
-    0xe3a1a4,
-    0xe3a1a5,
-    0xe3a1a6,
-    0xe3a1a7,
-    0xe3a1a8,
-    0xe3a1a9,
-    0xe3a1aa,
-    0xe3a1ab,
-    0xe3a1ac,
-    0xe3a1ad,
-    0xe3a1ae,
-    0xe3a1af,
-    0xe3a1b0,
-    0xe3a1b1,
-    0xe3a1b2,
-    0xe3a1b3,
-    0xe3a1b4,
-    0xe3a1b5,
-    0xe3a1b6,
-    0xe3a1b7,
-    0xe3a1b8,
-    0xe3a1b9,
-    0xe3a1ba,
-    0xe3a1bb,
-    0xe3a1bc,
-    0xe3a1bd,
-    0xe3a1be,
-    0xe3a1bf,
-    0xe3a280,
-    0xe3a281,
-    0xe3a282,
-    0xe3a283,
-    0xe3a284,
-    0xe3a285,
-    0xe3a286,
-    0xe3a287,
-    0xe3a288,
-    0xe3a289,
-    0xe3a28a,
-    0xe3a28b,
-    0xe3a28c,
-    0xe3a28d,
-    0xe3a28e,
-    0xe3a28f,
-    0xe3a290,
-    0xe3a291,
-    0xe3a292,
-    0xe3a293,
-    0xe3a294,
-    0xe3a295,
-    0xe3a296,
-    0xe3a297,
-    0xe3a298,
-    0xe3a299,
-    0xe3a29a,
-    0xe3a29b,
-    0xe3a29c,
-    0xe3a29d,
-    0xe3a29e,
-    0xe3a29f,
-    0xe3a2a0,
-    0xe3a2a1,
-    0xe3a2a2,
-    0xe3a2a3,
-    0xe3a2a4,
-    0xe3a2a5,
-    0xe3a2a6,
-    0xe3a2a7,
-    0xe3a2a8,
-    0xe3a2a9,
-    0xe3a2aa,
-    0xe3a2ab,
-    0xe3a2ac,
-    0xe3a2ad,
-    0xe3a2ae,
-    0xe3a2af,
-    0xe3a2b0,
-    0xe3a2b1,
-    0xe3a2b2,
-    0xe3a2b3,
-    0xe3a2b4,
-    0xe3a2b5,
-    0xe3a2b6,
-    0xe3a2b7,
-    0xe3a2b8,
-    0xe3a2b9,
-    0xe3a2ba,
-    0xe3a2bb,
-    0xe3a2bc,
-    0xe3a2bd,
-    0xe3a2be,
-    0xe3a2bf,
-    0xe3a380,
-    0xe3a381,
-    0xe3a382,
-    0xe3a383,
-    0xe3a384,
-    0xe3a385,
-    0xe3a386,
-    0xe3a387,
-    0xe3a388,
-    0xe3a389,
-    0xe3a38a,
-    0xe3a38b,
-    0xe3a38c,
-    0xe3a38d,
-    0xe3a38e,
-    0xe3a38f,
-    0xe3a390,
-    0xe3a391,
-    0xe3a392,
-    0xe3a393,
-    0xe3a394,
-    0xe3a395,
-    0xe3a396,
-    0xe3a397,
-    0xe3a398,
-    0xe3a399,
-    0xe3a39a,
-    0xe3a39b,
-    0xe3a39c,
-    0xe3a39d,
-    0xe3a39e,
-    0xe3a39f,
-    0xe3a3a0,
-    0xe3a3a1,
-    0xe3a3a2,
-    0xe3a3a3,
-    0xe3a3a4,
-    0xe3a3a5,
-    0xe3a3a6,
-    0xe3a3a7,
-    0xe3a3a8,
-    0xe3a3a9,
-    0xe3a3aa,
-    0xe3a3ab,
-    0xe3a3ac,
-    0xe3a3ad,
-    0xe3a3ae,
-    0xe3a3af,
-    0xe3a3b0,
-    0xe3a3b1,
-    0xe3a3b2,
-    0xe3a3b3,
-    0xe3a3b4,
-    0xe3a3b5,
-    0xe3a3b6,
-    0xe3a3b7,
-    0xe3a3b8,
-    0xe3a3b9,
-    0xe3a3ba,
-    0xe3a3bb,
-    0xe3a3bc,
-    0xe3a3bd,
-    0xe3a3be,
-    0xe3a3bf,
-    0xe3a480,
-    0xe3a481,
-    0xe3a482,
-    0xe3a483,
-    0xe3a484,
-    0xe3a485,
-    0xe3a486,
-    0xe3a487,
-    0xe3a488,
-    0xe3a489,
-    0xe3a48a,
-    0xe3a48b,
-    0xe3a48c,
-    0xe3a48d,
-    0xe3a48e,
-    0xe3a48f,
-    0xe3a490,
-    0xe3a491,
-    0xe3a492,
-    0xe3a493,
-    0xe3a494,
-    0xe3a495,
-    0xe3a496,
-    0xe3a497,
-    0xe3a498,
-    0xe3a499,
-    0xe3a49a,
-    0xe3a49b,
-    0xe3a49c,
-    0xe3a49d,
-    0xe3a49e,
-    0xe3a49f,
-    0xe3a4a0,
-    0xe3a4a1,
-    0xe3a4a2,
-    0xe3a4a3,
-    0xe3a4a4,
-    0xe3a4a5,
-    0xe3a4a6,
-    0xe3a4a7,
-    0xe3a4a8,
-    0xe3a4a9,
-    0xe3a4aa,
-    0xe3a4ab,
-    0xe3a4ac,
-    0xe3a4ad,
-    0xe3a4ae,
-    0xe3a4af,
-    0xe3a4b0,
-    0xe3a4b1,
-    0xe3a4b2,
-    0xe3a4b3,
-    0xe3a4b4,
-    0xe3a4b5,
-    0xe3a4b6,
-    0xe3a4b7,
-    0xe3a4b8,
-    0xe3a4b9,
-    0xe3a4ba,
-    0xe3a4bb,
-    0xe3a4bc,
-    0xe3a4bd,
-    0xe3a4be,
-    0xe3a4bf,
-    0xe3a580,
-    0xe3a581,
-    0xe3a582,
-    0xe3a583,
-    0xe3a584,
-    0xe3a585,
-    0xe3a586,
-    0xe3a587,
-    0xe3a588,
-    0xe3a589,
-    0xe3a58a,
-    0xe3a58b,
-    0xe3a58c,
-    0xe3a58d,
-    0xe3a58e,
-    0xe3a58f,
-    0xe3a590,
-    0xe3a591,
-    0xe3a592,
-    0xe3a593,
-    0xe3a594,
-    0xe3a595,
-    0xe3a596,
-    0xe3a597,
-    0xe3a598,
-    0xe3a599,
-    0xe3a59a,
-    0xe3a59b,
-    0xe3a59c,
-    0xe3a59d,
-    0xe3a59e,
-    0xe3a59f,
-    0xe3a5a0,
-    0xe3a5a1,
-    0xe3a5a2,
-    0xe3a5a3,
-    0xe3a5a4,
-    0xe3a5a5,
-    0xe3a5a6,
-    0xe3a5a7,
-    0xe3a5a8,
-    0xe3a5a9,
-    0xe3a5aa,
-    0xe3a5ab,
-    0xe3a5ac,
-    0xe3a5ad,
-    0xe3a5ae,
-    0xe3a5af,
-    0xe3a5b0,
-    0xe3a5b1,
-    0xe3a5b2,
-    0xe3a5b3,
-    0xe3a5b4,
-    0xe3a5b5,
-    0xe3a5b6,
-    0xe3a5b7,
-    0xe3a5b8,
-    0xe3a5b9,
-    0xe3a5ba,
-    0xe3a5bb,
-    0xe3a5bc,
-    0xe3a5bd,
-    0xe3a5be,
-    0xe3a5bf,
-    0xe3a680,
-    0xe3a681,
-    0xe3a682,
-    0xe3a683,
-    0xe3a684,
-    0xe3a685,
-    0xe3a686,
-    0xe3a687,
-    0xe3a688,
-    0xe3a689,
-    0xe3a68a,
-    0xe3a68b,
-    0xe3a68c,
-    0xe3a68d,
-    0xe3a68e,
-    0xe3a68f,
-    0xe3a690,
-    0xe3a691,
-    0xe3a692,
-    0xe3a693,
-    0xe3a694,
-    0xe3a695,
-    0xe3a696,
-    0xe3a697,
-    0xe3a698,
-    0xe3a699,
-    0xe3a69a,
-    0xe3a69b,
-    0xe3a69c,
-    0xe3a69d,
-    0xe3a69e,
-    0xe3a69f,
-    0xe3a6a0,
-    0xe3a6a1,
-    0xe3a6a2,
-    0xe3a6a3,
-    0xe3a6a4,
-    0xe3a6a5,
-    0xe3a6a6,
-    0xe3a6a7,
-    0xe3a6a8,
-    0xe3a6a9,
-    0xe3a6aa,
-    0xe3a6ab,
-    0xe3a6ac,
-    0xe3a6ad,
-    0xe3a6ae,
-    0xe3a6af,
-    0xe3a6b0,
-    0xe3a6b1,
-    0xe3a6b2,
-    0xe3a6b3,
-    0xe3a6b4,
-    0xe3a6b5,
-    0xe3a6b6,
-    0xe3a6b7,
-    0xe3a6b8,
-    0xe3a6b9,
-    0xe3a6ba,
-    0xe3a6bb,
-    0xe3a6bc,
-    0xe3a6bd,
-    0xe3a6be,
-    0xe3a6bf,
-    0xe3a780,
-    0xe3a781,
-    0xe3a782,
-    0xe3a783,
-    0xe3a784,
-    0xe3a785,
-    0xe3a786,
-    0xe3a787,
-    0xe3a788,
-    0xe3a789,
-    0xe3a78a,
-    0xe3a78b,
-    0xe3a78c,
-    0xe3a78d,
-    0xe3a78e,
-    0xe3a78f,
-    0xe3a790,
-    0xe3a791,
-    0xe3a792,
-    0xe3a793,
-    0xe3a794,
-    0xe3a795,
-    0xe3a796,
-    0xe3a797,
-    0xe3a798,
-    0xe3a799,
-    0xe3a79a,
-    0xe3a79b,
-    0xe3a79c,
-    0xe3a79d,
-    0xe3a79e,
-    0xe3a79f,
-    0xe3a7a0,
-    0xe3a7a1,
-    0xe3a7a2,
-    0xe3a7a3,
-    0xe3a7a4,
-    0xe3a7a5,
-    0xe3a7a6,
-    0xe3a7a7,
-    0xe3a7a8,
-    0xe3a7a9,
-    0xe3a7aa,
-    0xe3a7ab,
-    0xe3a7ac,
-    0xe3a7ad,
-    0xe3a7ae,
-    0xe3a7af,
-    0xe3a7b0,
-    0xe3a7b1,
-    0xe3a7b2,
-    0xe3a7b3,
-    0xe3a7b4,
-    0xe3a7b5,
-    0xe3a7b6,
-    0xe3a7b7,
-    0xe3a7b8,
-    0xe3a7b9,
-    0xe3a7ba,
-    0xe3a7bb,
-    0xe3a7bc,
-    0xe3a7bd,
-    0xe3a7be,
-    0xe3a7bf,
-    0xe3a880,
-    0xe3a881,
-    0xe3a882,
-    0xe3a883,
-    0xe3a884,
-    0xe3a885,
-    0xe3a886,
-    0xe3a887,
-    0xe3a888,
-    0xe3a889,
-    0xe3a88a,
-    0xe3a88b,
-    0xe3a88c,
-    0xe3a88d,
-    0xe3a88e,
-    0xe3a88f,
-    0xe3a890,
-    0xe3a891,
-    0xe3a892,
-    0xe3a893,
-    0xe3a894,
-    0xe3a895,
-    0xe3a896,
-    0xe3a897,
-    0xe3a898,
-    0xe3a899,
-    0xe3a89a,
-    0xe3a89b,
-    0xe3a89c,
-    0xe3a89d,
-    0xe3a89e,
-    0xe3a89f,
-    0xe3a8a0,
-    0xe3a8a1,
-    0xe3a8a2,
-    0xe3a8a3,
-    0xe3a8a4,
-    0xe3a8a5,
-    0xe3a8a6,
-    0xe3a8a7,
-    0xe3a8a8,
-    0xe3a8a9,
-    0xe3a8aa,
-    0xe3a8ab,
-    0xe3a8ac,
-    0xe3a8ad,
-    0xe3a8ae,
-    0xe3a8af,
-    0xe3a8b0,
-    0xe3a8b1,
-    0xe3a8b2,
-    0xe3a8b3,
-    0xe3a8b4,
-    0xe3a8b5,
-    0xe3a8b6,
-    0xe3a8b7,
-    0xe3a8b8,
-    0xe3a8b9,
-    0xe3a8ba,
-    0xe3a8bb,
-    0xe3a8bc,
-    0xe3a8bd,
-    0xe3a8be,
-    0xe3a8bf,
-    0xe3a980,
-    0xe3a981,
-    0xe3a982,
-    0xe3a983,
-    0xe3a984,
-    0xe3a985,
-    0xe3a986,
-    0xe3a987,
-    0xe3a988,
-    0xe3a989,
-    0xe3a98a,
-    0xe3a98b,
-    0xe3a98c,
-    0xe3a98d,
-    0xe3a98e,
-    0xe3a98f,
-    0xe3a990,
-    0xe3a991,
-    0xe3a992,
-    0xe3a993,
-    0xe3a994,
-    0xe3a995,
-    0xe3a996,
-    0xe3a997,
-    0xe3a998,
-    0xe3a999,
-    0xe3a99a,
-    0xe3a99b,
-    0xe3a99c,
-    0xe3a99d,
-    0xe3a99e,
-    0xe3a99f,
-    0xe3a9a0,
-    0xe3a9a1,
-    0xe3a9a2,
-    0xe3a9a3,
-    0xe3a9a4,
-    0xe3a9a5,
-    0xe3a9a6,
-    0xe3a9a7,
-    0xe3a9a8,
-    0xe3a9a9,
-    0xe3a9aa,
-    0xe3a9ab,
-    0xe3a9ac,
-    0xe3a9ad,
-    0xe3a9ae,
-    0xe3a9af,
-    0xe3a9b0,
-    0xe3a9b1,
-    0xe3a9b2,
-    0xe3a9b3,
-    0xe3a9b4,
-    0xe3a9b5,
-    0xe3a9b6,
-    0xe3a9b7,
-    0xe3a9b8,
-    0xe3a9b9,
-    0xe3a9ba,
-    0xe3a9bb,
-    0xe3a9bc,
-    0xe3a9bd,
-    0xe3a9be,
-    0xe3a9bf,
-    0xe3aa80,
-    0xe3aa81,
-    0xe3aa82,
-    0xe3aa83,
-    0xe3aa84,
-    0xe3aa85,
-    0xe3aa86,
-    0xe3aa87,
-    0xe3aa88,
-    0xe3aa89,
-    0xe3aa8a,
-    0xe3aa8b,
-    0xe3aa8c,
-    0xe3aa8d,
-    0xe3aa8e,
-    0xe3aa8f,
-    0xe3aa90,
-    0xe3aa91,
-    0xe3aa92,
-    0xe3aa93,
-    0xe3aa94,
-    0xe3aa95,
-    0xe3aa96,
-    0xe3aa97,
-    0xe3aa98,
-    0xe3aa99,
-    0xe3aa9a,
-    0xe3aa9b,
-    0xe3aa9c,
-    0xe3aa9d,
-    0xe3aa9e,
-    0xe3aa9f,
-    0xe3aaa0,
-    0xe3aaa1,
-    0xe3aaa2,
-    0xe3aaa3,
-    0xe3aaa4,
-    0xe3aaa5,
-    0xe3aaa6,
-    0xe3aaa7,
-    0xe3aaa8,
-    0xe3aaa9,
-    0xe3aaaa,
-    0xe3aaab,
-    0xe3aaac,
-    0xe3aaad,
-    0xe3aaae,
-    0xe3aaaf,
-    0xe3aab0,
-    0xe3aab1,
-    0xe3aab2,
-    0xe3aab3,
-    0xe3aab4,
-    0xe3aab5,
-    0xe3aab6,
-    0xe3aab7,
-    0xe3aab8,
-    0xe3aab9,
-    0xe3aaba,
-    0xe3aabb,
-    0xe3aabc,
-    0xe3aabd,
-    0xe3aabe,
-    0xe3aabf,
-    0xe3ab80,
-    0xe3ab81,
-    0xe3ab82,
-    0xe3ab83,
-    0xe3ab84,
-    0xe3ab85,
-    0xe3ab86,
-    0xe3ab87,
-    0xe3ab88,
-    0xe3ab89,
-    0xe3ab8a,
-    0xe3ab8b,
-    0xe3ab8c,
-    0xe3ab8d,
-    0xe3ab8e,
-    0xe3ab8f,
-    0xe3ab90,
-    0xe3ab91,
-    0xe3ab92,
-    0xe3ab93,
-    0xe3ab94,
-    0xe3ab95,
-    0xe3ab96,
-    0xe3ab97,
-    0xe3ab98,
-    0xe3ab99,
-    0xe3ab9a,
-    0xe3ab9b,
-    0xe3ab9c,
-    0xe3ab9d,
-    0xe3ab9e,
-    0xe3ab9f,
-    0xe3aba0,
-    0xe3aba1,
-    0xe3aba2,
-    0xe3aba3,
-    0xe3aba4,
-    0xe3aba5,
-    0xe3aba6,
-    0xe3aba7,
-    0xe3aba8,
-    0xe3aba9,
-    0xe3abaa,
-    0xe3abab,
-    0xe3abac,
-    0xe3abad,
-    0xe3abae,
-    0xe3abaf,
-    0xe3abb0,
-    0xe3abb1,
-    0xe3abb2,
-    0xe3abb3,
-    0xe3abb4,
-    0xe3abb5,
-    0xe3abb6,
-    0xe3abb7,
-    0xe3abb8,
-    0xe3abb9,
-    0xe3abba,
-    0xe3abbb,
-    0xe3abbc,
-    0xe3abbd,
-    0xe3abbe,
-    0xe3abbf,
-    0xe3ac80,
-    0xe3ac81,
-    0xe3ac82,
-    0xe3ac83,
-    0xe3ac84,
-    0xe3ac85,
-    0xe3ac86,
-    0xe3ac87,
-    0xe3ac88,
-    0xe3ac89,
-    0xe3ac8a,
-    0xe3ac8b,
-    0xe3ac8c,
-    0xe3ac8d,
-    0xe3ac8e,
-    0xe3ac8f,
-    0xe3ac90,
-    0xe3ac91,
-    0xe3ac92,
-    0xe3ac93,
-    0xe3ac94,
-    0xe3ac95,
-    0xe3ac96,
-    0xe3ac97,
-    0xe3ac98,
-    0xe3ac99,
-    0xe3ac9a,
-    0xe3ac9b,
-    0xe3ac9c,
-    0xe3ac9d,
-    0xe3ac9e,
-    0xe3ac9f,
-    0xe3aca0,
-    0xe3aca1,
-    0xe3aca2,
-    0xe3aca3,
-    0xe3aca4,
-    0xe3aca5,
-    0xe3aca6,
-    0xe3aca7,
-    0xe3aca8,
-    0xe3aca9,
-    0xe3acaa,
-    0xe3acab,
-    0xe3acac,
-    0xe3acad,
-    0xe3acae,
-    0xe3acaf,
-    0xe3acb0,
-    0xe3acb1,
-    0xe3acb2,
-    0xe3acb3,
-    0xe3acb4,
-    0xe3acb5,
-    0xe3acb6,
-    0xe3acb7,
-    0xe3acb8,
-    0xe3acb9,
-    0xe3acba,
-    0xe3acbb,
-    0xe3acbc,
-    0xe3acbd,
-    0xe3acbe,
-    0xe3acbf,
-    0xe3ad80,
-    0xe3ad81,
-    0xe3ad82,
-    0xe3ad83,
-    0xe3ad84,
-    0xe3ad85,
-    0xe3ad86,
-    0xe3ad87,
-    0xe3ad88,
-    0xe3ad89,
-    0xe3ad8a,
-    0xe3ad8b,
-    0xe3ad8c,
-    0xe3ad8d,
-    0xe3ad8e,
-    0xe3ad8f,
-    0xe3ad90,
-    0xe3ad91,
-    0xe3ad92,
-    0xe3ad93,
-    0xe3ad94,
-    0xe3ad95,
-    0xe3ad96,
-    0xe3ad97,
-    0xe3ad98,
-    0xe3ad99,
-    0xe3ad9a,
-    0xe3ad9b,
-    0xe3ad9c,
-    0xe3ad9d,
-    0xe3ad9e,
-    0xe3ad9f,
-    0xe3ada0,
-    0xe3ada1,
-    0xe3ada2,
-    0xe3ada3,
-    0xe3ada4,
-    0xe3ada5,
-    0xe3ada6,
-    0xe3ada7,
-    0xe3ada8,
-    0xe3ada9,
-    0xe3adaa,
-    0xe3adab,
-    0xe3adac,
-    0xe3adad,
-    0xe3adae,
-    0xe3adaf,
-    0xe3adb0,
-    0xe3adb1,
-    0xe3adb2,
-    0xe3adb3,
-    0xe3adb4,
-    0xe3adb5,
-    0xe3adb6,
-    0xe3adb7,
-    0xe3adb8,
-    0xe3adb9,
-    0xe3adba,
-    0xe3adbb,
-    0xe3adbc,
-    0xe3adbd,
-    0xe3adbe,
-    0xe3adbf,
-    0xe3ae80,
-    0xe3ae81,
-    0xe3ae82,
-    0xe3ae83,
-    0xe3ae84,
-    0xe3ae85,
-    0xe3ae86,
-    0xe3ae87,
-    0xe3ae88,
-    0xe3ae89,
-    0xe3ae8a,
-    0xe3ae8b,
-    0xe3ae8c,
-    0xe3ae8d,
-    0xe3ae8e,
-    0xe3ae8f,
-    0xe3ae90,
-    0xe3ae91,
-    0xe3ae92,
-    0xe3ae93,
-    0xe3ae94,
-    0xe3ae95,
-    0xe3ae96,
-    0xe3ae97,
-    0xe3ae98,
-    0xe3ae99,
-    0xe3ae9a,
-    0xe3ae9b,
-    0xe3ae9c,
-    0xe3ae9d,
-    0xe3ae9e,
-    0xe3ae9f,
-    0xe3aea0,
-    0xe3aea1,
-    0xe3aea2,
-    0xe3aea3,
-    0xe3aea4,
-    0xe3aea5,
-    0xe3aea6,
-    0xe3aea7,
-    0xe3aea8,
-    0xe3aea9,
-    0xe3aeaa,
-    0xe3aeab,
-    0xe3aeac,
-    0xe3aead,
-    0xe3aeae,
-    0xe3aeaf,
-    0xe3aeb0,
-    0xe3aeb1,
-    0xe3aeb2,
-    0xe3aeb3,
-    0xe3aeb4,
-    0xe3aeb5,
-    0xe3aeb6,
-    0xe3aeb7,
-    0xe3aeb8,
-    0xe3aeb9,
-    0xe3aeba,
-    0xe3aebb,
-    0xe3aebc,
-    0xe3aebd,
-    0xe3aebe,
-    0xe3aebf,
-    0xe3af80,
-    0xe3af81,
-    0xe3af82,
-    0xe3af83,
-    0xe3af84,
-    0xe3af85,
-    0xe3af86,
-    0xe3af87,
-    0xe3af88,
-    0xe3af89,
-    0xe3af8a,
-    0xe3af8b,
-    0xe3af8c,
-    0xe3af8d,
-    0xe3af8e,
-    0xe3af8f,
-    0xe3af90,
-    0xe3af91,
-    0xe3af92,
-    0xe3af93,
-    0xe3af94,
-    0xe3af95,
-    0xe3af96,
-    0xe3af97,
-    0xe3af98,
-    0xe3af99,
-    0xe3af9a,
-    0xe3af9b,
-    0xe3af9c,
-    0xe3af9d,
-    0xe3af9e,
-    0xe3af9f,
-    0xe3afa0,
-    0xe3afa1,
-    0xe3afa2,
-    0xe3afa3,
-    0xe3afa4,
-    0xe3afa5,
-    0xe3afa6,
-    0xe3afa7,
-    0xe3afa8,
-    0xe3afa9,
-    0xe3afaa,
-    0xe3afab,
-    0xe3afac,
-    0xe3afad,
-    0xe3afae,
-    0xe3afaf,
-    0xe3afb0,
-    0xe3afb1,
-    0xe3afb2,
-    0xe3afb3,
-    0xe3afb4,
-    0xe3afb5,
-    0xe3afb6,
-    0xe3afb7,
-    0xe3afb8,
-    0xe3afb9,
-    0xe3afba,
-    0xe3afbb,
-    0xe3afbc,
-    0xe3afbd,
-    0xe3afbe,
-    0xe3afbf,
-    0xe3b080,
-    0xe3b081,
-    0xe3b082,
-    0xe3b083,
-    0xe3b084,
-    0xe3b085,
-    0xe3b086,
-    0xe3b087,
-    0xe3b088,
-    0xe3b089,
-    0xe3b08a,
-    0xe3b08b,
-    0xe3b08c,
-    0xe3b08d,
-    0xe3b08e,
-    0xe3b08f,
-    0xe3b090,
-    0xe3b091,
-    0xe3b092,
-    0xe3b093,
-    0xe3b094,
-    0xe3b095,
-    0xe3b096,
-    0xe3b097,
-    0xe3b098,
-    0xe3b099,
-    0xe3b09a,
-    0xe3b09b,
-    0xe3b09c,
-    0xe3b09d,
-    0xe3b09e,
-    0xe3b09f,
-    0xe3b0a0,
-    0xe3b0a1,
-    0xe3b0a2,
-    0xe3b0a3,
-    0xe3b0a4,
-    0xe3b0a5,
-    0xe3b0a6,
-    0xe3b0a7,
-    0xe3b0a8,
-    0xe3b0a9,
-    0xe3b0aa,
-    0xe3b0ab,
-    0xe3b0ac,
-    0xe3b0ad,
-    0xe3b0ae,
-    0xe3b0af,
-    0xe3b0b0,
-    0xe3b0b1,
-    0xe3b0b2,
-    0xe3b0b3,
-    0xe3b0b4,
-    0xe3b0b5,
-    0xe3b0b6,
-    0xe3b0b7,
-    0xe3b0b8,
-    0xe3b0b9,
-    0xe3b0ba,
-    0xe3b0bb,
-    0xe3b0bc,
-    0xe3b0bd,
-    0xe3b0be,
-    0xe3b0bf,
-    0xe3b180,
-    0xe3b181,
-    0xe3b182,
-    0xe3b183,
-    0xe3b184,
-    0xe3b185,
-    0xe3b186,
-    0xe3b187,
-    0xe3b188,
-    0xe3b189,
-    0xe3b18a,
-    0xe3b18b,
-    0xe3b18c,
-    0xe3b18d,
-    0xe3b18e,
-    0xe3b18f,
-    0xe3b190,
-    0xe3b191,
-    0xe3b192,
-    0xe3b193,
-    0xe3b194,
-    0xe3b195,
-    0xe3b196,
-    0xe3b197,
-    0xe3b198,
-    0xe3b199,
-    0xe3b19a,
-    0xe3b19b,
-    0xe3b19c,
-    0xe3b19d,
-    0xe3b19e,
-    0xe3b19f,
-    0xe3b1a0,
-    0xe3b1a1,
-    0xe3b1a2,
-    0xe3b1a3,
-    0xe3b1a4,
-    0xe3b1a5,
-    0xe3b1a6,
-    0xe3b1a7,
-    0xe3b1a8,
-    0xe3b1a9,
-    0xe3b1aa,
-    0xe3b1ab,
-    0xe3b1ac,
-    0xe3b1ad,
-    0xe3b1ae,
-    0xe3b1af,
-    0xe3b1b0,
-    0xe3b1b1,
-    0xe3b1b2,
-    0xe3b1b3,
-    0xe3b1b4,
-    0xe3b1b5,
-    0xe3b1b6,
-    0xe3b1b7,
-    0xe3b1b8,
-    0xe3b1b9,
-    0xe3b1ba,
-    0xe3b1bb,
-    0xe3b1bc,
-    0xe3b1bd,
-    0xe3b1be,
-    0xe3b1bf,
-    0xe3b280,
-    0xe3b281,
-    0xe3b282,
-    0xe3b283,
-    0xe3b284,
-    0xe3b285,
-    0xe3b286,
-    0xe3b287,
-    0xe3b288,
-    0xe3b289,
-    0xe3b28a,
-    0xe3b28b,
-    0xe3b28c,
-    0xe3b28d,
-    0xe3b28e,
-    0xe3b28f,
-    0xe3b290,
-    0xe3b291,
-    0xe3b292,
-    0xe3b293,
-    0xe3b294,
-    0xe3b295,
-    0xe3b296,
-    0xe3b297,
-    0xe3b298,
-    0xe3b299,
-    0xe3b29a,
-    0xe3b29b,
-    0xe3b29c,
-    0xe3b29d,
-    0xe3b29e,
-    0xe3b29f,
-    0xe3b2a0,
-    0xe3b2a1,
-    0xe3b2a2,
-    0xe3b2a3,
-    0xe3b2a4,
-    0xe3b2a5,
-    0xe3b2a6,
-    0xe3b2a7,
-    0xe3b2a8,
-    0xe3b2a9,
-    0xe3b2aa,
-    0xe3b2ab,
-    0xe3b2ac,
-    0xe3b2ad,
-    0xe3b2ae,
-    0xe3b2af,
-    0xe3b2b0,
-    0xe3b2b1,
-    0xe3b2b2,
-    0xe3b2b3,
-    0xe3b2b4,
-    0xe3b2b5,
-    0xe3b2b6,
-    0xe3b2b7,
-    0xe3b2b8,
-    0xe3b2b9,
-    0xe3b2ba,
-    0xe3b2bb,
-    0xe3b2bc,
-    0xe3b2bd,
-    0xe3b2be,
-    0xe3b2bf,
-    0xe3b380,
-    0xe3b381,
-    0xe3b382,
-    0xe3b383,
-    0xe3b384,
-    0xe3b385,
-    0xe3b386,
-    0xe3b387,
-    0xe3b388,
-    0xe3b389,
-    0xe3b38a,
-    0xe3b38b,
-    0xe3b38c,
-    0xe3b38d,
-    0xe3b38e,
-    0xe3b38f,
-    0xe3b390,
-    0xe3b391,
-    0xe3b392,
-    0xe3b393,
-    0xe3b394,
-    0xe3b395,
-    0xe3b396,
-    0xe3b397,
-    0xe3b398,
-    0xe3b399,
-    0xe3b39a,
-    0xe3b39b,
-    0xe3b39c,
-    0xe3b39d,
-    0xe3b39e,
-    0xe3b39f,
-    0xe3b3a0,
-    0xe3b3a1,
-    0xe3b3a2,
-    0xe3b3a3,
-    0xe3b3a4,
-    0xe3b3a5,
-    0xe3b3a6,
-    0xe3b3a7,
-    0xe3b3a8,
-    0xe3b3a9,
-    0xe3b3aa,
-    0xe3b3ab,
-    0xe3b3ac,
-    0xe3b3ad,
-    0xe3b3ae,
-    0xe3b3af,
-    0xe3b3b0,
-    0xe3b3b1,
-    0xe3b3b2,
-    0xe3b3b3,
-    0xe3b3b4,
-    0xe3b3b5,
-    0xe3b3b6,
-    0xe3b3b7,
-    0xe3b3b8,
-    0xe3b3b9,
-    0xe3b3ba,
-    0xe3b3bb,
-    0xe3b3bc,
-    0xe3b3bd,
-    0xe3b3be,
-    0xe3b3bf,
-    0xe3b480,
-    0xe3b481,
-    0xe3b482,
-    0xe3b483,
-    0xe3b484,
-    0xe3b485,
-    0xe3b486,
-    0xe3b487,
-    0xe3b488,
-    0xe3b489,
-    0xe3b48a,
-    0xe3b48b,
-    0xe3b48c,
-    0xe3b48d,
-    0xe3b48e,
-    0xe3b48f,
-    0xe3b490,
-    0xe3b491,
-    0xe3b492,
-    0xe3b493,
-    0xe3b494,
-    0xe3b495,
-    0xe3b496,
-    0xe3b497,
-    0xe3b498,
-    0xe3b499,
-    0xe3b49a,
-    0xe3b49b,
-    0xe3b49c,
-    0xe3b49d,
-    0xe3b49e,
-    0xe3b49f,
-    0xe3b4a0,
-    0xe3b4a1,
-    0xe3b4a2,
-    0xe3b4a3,
-    0xe3b4a4,
-    0xe3b4a5,
-    0xe3b4a6,
-    0xe3b4a7,
-    0xe3b4a8,
-    0xe3b4a9,
-    0xe3b4aa,
-    0xe3b4ab,
-    0xe3b4ac,
-    0xe3b4ad,
-    0xe3b4ae,
-    0xe3b4af,
-    0xe3b4b0,
-    0xe3b4b1,
-    0xe3b4b2,
-    0xe3b4b3,
-    0xe3b4b4,
-    0xe3b4b5,
-    0xe3b4b6,
-    0xe3b4b7,
-    0xe3b4b8,
-    0xe3b4b9,
-    0xe3b4ba,
-    0xe3b4bb,
-    0xe3b4bc,
-    0xe3b4bd,
-    0xe3b4be,
-    0xe3b4bf,
-    0xe3b580,
-    0xe3b581,
-    0xe3b582,
-    0xe3b583,
-    0xe3b584,
-    0xe3b585,
-    0xe3b586,
-    0xe3b587,
-    0xe3b588,
-    0xe3b589,
-    0xe3b58a,
-    0xe3b58b,
-    0xe3b58c,
-    0xe3b58d,
-    0xe3b58e,
-    0xe3b58f,
-    0xe3b590,
-    0xe3b591,
-    0xe3b592,
-    0xe3b593,
-    0xe3b594,
-    0xe3b595,
-    0xe3b596,
-    0xe3b597,
-    0xe3b598,
-    0xe3b599,
-    0xe3b59a,
-    0xe3b59b,
-    0xe3b59c,
-    0xe3b59d,
-    0xe3b59e,
-    0xe3b59f,
-    0xe3b5a0,
-    0xe3b5a1,
-    0xe3b5a2,
-    0xe3b5a3,
-    0xe3b5a4,
-    0xe3b5a5,
-    0xe3b5a6,
-    0xe3b5a7,
-    0xe3b5a8,
-    0xe3b5a9,
-    0xe3b5aa,
-    0xe3b5ab,
-    0xe3b5ac,
-    0xe3b5ad,
-    0xe3b5ae,
-    0xe3b5af,
-    0xe3b5b0,
-    0xe3b5b1,
-    0xe3b5b2,
-    0xe3b5b3,
-    0xe3b5b4,
-    0xe3b5b5,
-    0xe3b5b6,
-    0xe3b5b7,
-    0xe3b5b8,
-    0xe3b5b9,
-    0xe3b5ba,
-    0xe3b5bb,
-    0xe3b5bc,
-    0xe3b5bd,
-    0xe3b5be,
-    0xe3b5bf,
-    0xe3b680,
-    0xe3b681,
-    0xe3b682,
-    0xe3b683,
-    0xe3b684,
-    0xe3b685,
-    0xe3b686,
-    0xe3b687,
-    0xe3b688,
-    0xe3b689,
-    0xe3b68a,
-    0xe3b68b,
-    0xe3b68c,
-    0xe3b68d,
-    0xe3b68e,
-    0xe3b68f,
-    0xe3b690,
-    0xe3b691,
-    0xe3b692,
-    0xe3b693,
-    0xe3b694,
-    0xe3b695,
-    0xe3b696,
-    0xe3b697,
-    0xe3b698,
-    0xe3b699,
-    0xe3b69a,
-    0xe3b69b,
-    0xe3b69c,
-    0xe3b69d,
-    0xe3b69e,
-    0xe3b69f,
-    0xe3b6a0,
-    0xe3b6a1,
-    0xe3b6a2,
-    0xe3b6a3,
-    0xe3b6a4,
-    0xe3b6a5,
-    0xe3b6a6,
-    0xe3b6a7,
-    0xe3b6a8,
-    0xe3b6a9,
-    0xe3b6aa,
-    0xe3b6ab,
-    0xe3b6ac,
-    0xe3b6ad,
-    0xe3b6ae,
-    0xe3b6af,
-    0xe3b6b0,
-    0xe3b6b1,
-    0xe3b6b2,
-    0xe3b6b3,
-    0xe3b6b4,
-    0xe3b6b5,
-    0xe3b6b6,
-    0xe3b6b7,
-    0xe3b6b8,
-    0xe3b6b9,
-    0xe3b6ba,
-    0xe3b6bb,
-    0xe3b6bc,
-    0xe3b6bd,
-    0xe3b6be,
-    0xe3b6bf,
-    0xe3b780,
-    0xe3b781,
-    0xe3b782,
-    0xe3b783,
-    0xe3b784,
-    0xe3b785,
-    0xe3b786,
-    0xe3b787,
-    0xe3b788,
-    0xe3b789,
-    0xe3b78a,
-    0xe3b78b,
-    0xe3b78c,
-    0xe3b78d,
-    0xe3b78e,
-    0xe3b78f,
-    0xe3b790,
-    0xe3b791,
-    0xe3b792,
-    0xe3b793,
-    0xe3b794,
-    0xe3b795,
-    0xe3b796,
-    0xe3b797,
-    0xe3b798,
-    0xe3b799,
-    0xe3b79a,
-    0xe3b79b,
-    0xe3b79c,
-    0xe3b79d,
-    0xe3b79e,
-    0xe3b79f,
-    0xe3b7a0,
-    0xe3b7a1,
-    0xe3b7a2,
-    0xe3b7a3,
-    0xe3b7a4,
-    0xe3b7a5,
-    0xe3b7a6,
-    0xe3b7a7,
-    0xe3b7a8,
-    0xe3b7a9,
-    0xe3b7aa,
-    0xe3b7ab,
-    0xe3b7ac,
-    0xe3b7ad,
-    0xe3b7ae,
-    0xe3b7af,
-    0xe3b7b0,
-    0xe3b7b1,
-    0xe3b7b2,
-    0xe3b7b3,
-    0xe3b7b4,
-    0xe3b7b5,
-    0xe3b7b6,
-    0xe3b7b7,
-    0xe3b7b8,
-    0xe3b7b9,
-    0xe3b7ba,
-    0xe3b7bb,
-    0xe3b7bc,
-    0xe3b7bd,
-    0xe3b7be,
-    0xe3b7bf,
-    0xe3b880,
-    0xe3b881,
-    0xe3b882,
-    0xe3b883,
-    0xe3b884,
-    0xe3b885,
-    0xe3b886,
-    0xe3b887,
-    0xe3b888,
-    0xe3b889,
-    0xe3b88a,
-    0xe3b88b,
-    0xe3b88c,
-    0xe3b88d,
-    0xe3b88e,
-    0xe3b88f,
-    0xe3b890,
-    0xe3b891,
-    0xe3b892,
-    0xe3b893,
-    0xe3b894,
-    0xe3b895,
-    0xe3b896,
-    0xe3b897,
-    0xe3b898,
-    0xe3b899,
-    0xe3b89a,
-    0xe3b89b,
-    0xe3b89c,
-    0xe3b89d,
-    0xe3b89e,
-    0xe3b89f,
-    0xe3b8a0,
-    0xe3b8a1,
-    0xe3b8a2,
-    0xe3b8a3,
-    0xe3b8a4,
-    0xe3b8a5,
-    0xe3b8a6,
-    0xe3b8a7,
-    0xe3b8a8,
-    0xe3b8a9,
-    0xe3b8aa,
-    0xe3b8ab,
-    0xe3b8ac,
-    0xe3b8ad,
-    0xe3b8ae,
-    0xe3b8af,
-    0xe3b8b0,
-    0xe3b8b1,
-    0xe3b8b2,
-    0xe3b8b3,
-    0xe3b8b4,
-    0xe3b8b5,
-    0xe3b8b6,
-    0xe3b8b7,
-    0xe3b8b8,
-    0xe3b8b9,
-    0xe3b8ba,
-    0xe3b8bb,
-    0xe3b8bc,
-    0xe3b8bd,
-    0xe3b8be,
-    0xe3b8bf,
-    0xe3b980,
-    0xe3b981,
-    0xe3b982,
-    0xe3b983,
-    0xe3b984,
-    0xe3b985,
-    0xe3b986,
-    0xe3b987,
-    0xe3b988,
-    0xe3b989,
-    0xe3b98a,
-    0xe3b98b,
-    0xe3b98c,
-    0xe3b98d,
-    0xe3b98e,
-    0xe3b98f,
-    0xe3b990,
-    0xe3b991,
-    0xe3b992,
-    0xe3b993,
-    0xe3b994,
-    0xe3b995,
-    0xe3b996,
-    0xe3b997,
-    0xe3b998,
-    0xe3b999,
-    0xe3b99a,
-    0xe3b99b,
-    0xe3b99c,
-    0xe3b99d,
-    0xe3b99e,
-    0xe3b99f,
-    0xe3b9a0,
-    0xe3b9a1,
-    0xe3b9a2,
-    0xe3b9a3,
-    0xe3b9a4,
-    0xe3b9a5,
-    0xe3b9a6,
-    0xe3b9a7,
-    0xe3b9a8,
-    0xe3b9a9,
-    0xe3b9aa,
-    0xe3b9ab,
-    0xe3b9ac,
-    0xe3b9ad,
-    0xe3b9ae,
-    0xe3b9af,
-    0xe3b9b0,
-    0xe3b9b1,
-    0xe3b9b2,
-    0xe3b9b3,
-    0xe3b9b4,
-    0xe3b9b5,
-    0xe3b9b6,
-    0xe3b9b7,
-    0xe3b9b8,
-    0xe3b9b9,
-    0xe3b9ba,
-    0xe3b9bb,
-    0xe3b9bc,
-    0xe3b9bd,
-    0xe3b9be,
-    0xe3b9bf,
-    0xe3ba80,
-    0xe3ba81,
-    0xe3ba82,
-    0xe3ba83,
-    0xe3ba84,
-    0xe3ba85,
-    0xe3ba86,
-    0xe3ba87,
-    0xe3ba88,
-    0xe3ba89,
-    0xe3ba8a,
-    0xe3ba8b,
-    0xe3ba8c,
-    0xe3ba8d,
-    0xe3ba8e,
-    0xe3ba8f,
-    0xe3ba90,
-    0xe3ba91,
-    0xe3ba92,
-    0xe3ba93,
-    0xe3ba94,
-    0xe3ba95,
-    0xe3ba96,
-    0xe3ba97,
-    0xe3ba98,
-    0xe3ba99,
-    0xe3ba9a,
-    0xe3ba9b,
-    0xe3ba9c,
-    0xe3ba9d,
-    0xe3ba9e,
-    0xe3ba9f,
-    0xe3baa0,
-    0xe3baa1,
-    0xe3baa2,
-    0xe3baa3,
-    0xe3baa4,
-    0xe3baa5,
-    0xe3baa6,
-    0xe3baa7,
-    0xe3baa8,
-    0xe3baa9,
-    0xe3baaa,
-    0xe3baab,
-    0xe3baac,
-    0xe3baad,
-    0xe3baae,
-    0xe3baaf,
-    0xe3bab0,
-    0xe3bab1,
-    0xe3bab2,
-    0xe3bab3,
-    0xe3bab4,
-    0xe3bab5,
-    0xe3bab6,
-    0xe3bab7,
-    0xe3bab8,
-    0xe3bab9,
-    0xe3baba,
-    0xe3babb,
-    0xe3babc,
-    0xe3babd,
-    0xe3babe,
-    0xe3babf,
-    0xe3bb80,
-    0xe3bb81,
-    0xe3bb82,
-    0xe3bb83,
-    0xe3bb84,
-    0xe3bb85,
-    0xe3bb86,
-    0xe3bb87,
-    0xe3bb88,
-    0xe3bb89,
-    0xe3bb8a,
-    0xe3bb8b,
-    0xe3bb8c,
-    0xe3bb8d,
-    0xe3bb8e,
-    0xe3bb8f,
-    0xe3bb90,
-    0xe3bb91,
-    0xe3bb92,
-    0xe3bb93,
-    0xe3bb94,
-    0xe3bb95,
-    0xe3bb96,
-    0xe3bb97,
-    0xe3bb98,
-    0xe3bb99,
-    0xe3bb9a,
-    0xe3bb9b,
-    0xe3bb9c,
-    0xe3bb9d,
-    0xe3bb9e,
-    0xe3bb9f,
-    0xe3bba0,
-    0xe3bba1,
-    0xe3bba2,
-    0xe3bba3,
-    0xe3bba4,
-    0xe3bba5,
-    0xe3bba6,
-    0xe3bba7,
-    0xe3bba8,
-    0xe3bba9,
-    0xe3bbaa,
-    0xe3bbab,
-    0xe3bbac,
-    0xe3bbad,
-    0xe3bbae,
-    0xe3bbaf,
-    0xe3bbb0,
-    0xe3bbb1,
-    0xe3bbb2,
-    0xe3bbb3,
-    0xe3bbb4,
-    0xe3bbb5,
-    0xe3bbb6,
-    0xe3bbb7,
-    0xe3bbb8,
-    0xe3bbb9,
-    0xe3bbba,
-    0xe3bbbb,
-    0xe3bbbc,
-    0xe3bbbd,
-    0xe3bbbe,
-    0xe3bbbf,
-    0xe3bc80,
-    0xe3bc81,
-    0xe3bc82,
-    0xe3bc83,
-    0xe3bc84,
-    0xe3bc85,
-    0xe3bc86,
-    0xe3bc87,
-    0xe3bc88,
-    0xe3bc89,
-    0xe3bc8a,
-    0xe3bc8b,
-    0xe3bc8c,
-    0xe3bc8d,
-    0xe3bc8e,
-    0xe3bc8f,
-    0xe3bc90,
-    0xe3bc91,
-    0xe3bc92,
-    0xe3bc93,
-    0xe3bc94,
-    0xe3bc95,
-    0xe3bc96,
-    0xe3bc97,
-    0xe3bc98,
-    0xe3bc99,
-    0xe3bc9a,
-    0xe3bc9b,
-    0xe3bc9c,
-    0xe3bc9d,
-    0xe3bc9e,
-    0xe3bc9f,
-    0xe3bca0,
-    0xe3bca1,
-    0xe3bca2,
-    0xe3bca3,
-    0xe3bca4,
-    0xe3bca5,
-    0xe3bca6,
-    0xe3bca7,
-    0xe3bca8,
-    0xe3bca9,
-    0xe3bcaa,
-    0xe3bcab,
-    0xe3bcac,
-    0xe3bcad,
-    0xe3bcae,
-    0xe3bcaf,
-    0xe3bcb0,
-    0xe3bcb1,
-    0xe3bcb2,
-    0xe3bcb3,
-    0xe3bcb4,
-    0xe3bcb5,
-    0xe3bcb6,
-    0xe3bcb7,
-    0xe3bcb8,
-    0xe3bcb9,
-    0xe3bcba,
-    0xe3bcbb,
-    0xe3bcbc,
-    0xe3bcbd,
-    0xe3bcbe,
-    0xe3bcbf,
-    0xe3bd80,
-    0xe3bd81,
-    0xe3bd82,
-    0xe3bd83,
-    0xe3bd84,
-    0xe3bd85,
-    0xe3bd86,
-    0xe3bd87,
-    0xe3bd88,
-    0xe3bd89,
-    0xe3bd8a,
-    0xe3bd8b,
-    0xe3bd8c,
-    0xe3bd8d,
-    0xe3bd8e,
-    0xe3bd8f,
-    0xe3bd90,
-    0xe3bd91,
-    0xe3bd92,
-    0xe3bd93,
-    0xe3bd94,
-    0xe3bd95,
-    0xe3bd96,
-    0xe3bd97,
-    0xe3bd98,
-    0xe3bd99,
-    0xe3bd9a,
-    0xe3bd9b,
-    0xe3bd9c,
-    0xe3bd9d,
-    0xe3bd9e,
-    0xe3bd9f,
-    0xe3bda0,
-    0xe3bda1,
-    0xe3bda2,
-    0xe3bda3,
-    0xe3bda4,
-    0xe3bda5,
-    0xe3bda6,
-    0xe3bda7,
-    0xe3bda8,
-    0xe3bda9,
-    0xe3bdaa,
-    0xe3bdab,
-    0xe3bdac,
-    0xe3bdad,
-    0xe3bdae,
-    0xe3bdaf,
-    0xe3bdb0,
-    0xe3bdb1,
-    0xe3bdb2,
-    0xe3bdb3,
-    0xe3bdb4,
-    0xe3bdb5,
-    0xe3bdb6,
-    0xe3bdb7,
-    0xe3bdb8,
-    0xe3bdb9,
-    0xe3bdba,
-    0xe3bdbb,
-    0xe3bdbc,
-    0xe3bdbd,
-    0xe3bdbe,
-    0xe3bdbf,
-    0xe3be80,
-    0xe3be81,
-    0xe3be82,
-    0xe3be83,
-    0xe3be84,
-    0xe3be85,
-    0xe3be86,
-    0xe3be87,
-    0xe3be88,
-    0xe3be89,
-    0xe3be8a,
-    0xe3be8b,
-    0xe3be8c,
-    0xe3be8d,
-    0xe3be8e,
-    0xe3be8f,
-    0xe3be90,
-    0xe3be91,
-    0xe3be92,
-    0xe3be93,
-    0xe3be94,
-    0xe3be95,
-    0xe3be96,
-    0xe3be97,
-    0xe3be98,
-    0xe3be99,
-    0xe3be9a,
-    0xe3be9b,
-    0xe3be9c,
-    0xe3be9d,
-    0xe3be9e,
-    0xe3be9f,
-    0xe3bea0,
-    0xe3bea1,
-    0xe3bea2,
-    0xe3bea3,
-    0xe3bea4,
-    0xe3bea5,
-    0xe3bea6,
-    0xe3bea7,
-    0xe3bea8,
-    0xe3bea9,
-    0xe3beaa,
-    0xe3beab,
-    0xe3beac,
-    0xe3bead,
-    0xe3beae,
-    0xe3beaf,
-    0xe3beb0,
-    0xe3beb1,
-    0xe3beb2,
-    0xe3beb3,
-    0xe3beb4,
-    0xe3beb5,
-    0xe3beb6,
-    0xe3beb7,
-    0xe3beb8,
-    0xe3beb9,
-    0xe3beba,
-    0xe3bebb,
-    0xe3bebc,
-    0xe3bebd,
-    0xe3bebe,
-    0xe3bebf,
-    0xe3bf80,
-    0xe3bf81,
-    0xe3bf82,
-    0xe3bf83,
-    0xe3bf84,
-    0xe3bf85,
-    0xe3bf86,
-    0xe3bf87,
-    0xe3bf88,
-    0xe3bf89,
-    0xe3bf8a,
-    0xe3bf8b,
-    0xe3bf8c,
-    0xe3bf8d,
-    0xe3bf8e,
-    0xe3bf8f,
-    0xe3bf90,
-    0xe3bf91,
-    0xe3bf92,
-    0xe3bf93,
-    0xe3bf94,
-    0xe3bf95,
-    0xe3bf96,
-    0xe3bf97,
-    0xe3bf98,
-    0xe3bf99,
-    0xe3bf9a,
-    0xe3bf9b,
-    0xe3bf9c,
-    0xe3bf9d,
-    0xe3bf9e,
-    0xe3bf9f,
-    0xe3bfa0,
-    0xe3bfa1,
-    0xe3bfa2,
-    0xe3bfa3,
-    0xe3bfa4,
-    0xe3bfa5,
-    0xe3bfa6,
-    0xe3bfa7,
-    0xe3bfa8,
-    0xe3bfa9,
-    0xe3bfaa,
-    0xe3bfab,
-    0xe3bfac,
-    0xe3bfad,
-    0xe3bfae,
-    0xe3bfaf,
-    0xe3bfb0,
-    0xe3bfb1,
-    0xe3bfb2,
-    0xe3bfb3,
-    0xe3bfb4,
-    0xe3bfb5,
-    0xe3bfb6,
-    0xe3bfb7,
-    0xe3bfb8,
-    0xe3bfb9,
-    0xe3bfba,
-    0xe3bfbb,
-    0xe3bfbc,
-    0xe3bfbd,
-    0xe3bfbe,
-    0xe3bfbf,
-    0xe48080,
-    0xe48081,
-    0xe48082,
-    0xe48083,
-    0xe48084,
-    0xe48085,
-    0xe48086,
-    0xe48087,
-    0xe48088,
-    0xe48089,
-    0xe4808a,
-    0xe4808b,
-    0xe4808c,
-    0xe4808d,
-    0xe4808e,
-    0xe4808f,
-    0xe48090,
-    0xe48091,
-    0xe48092,
-    0xe48093,
-    0xe48094,
-    0xe48095,
-    0xe48096,
-    0xe48097,
-    0xe48098,
-    0xe48099,
-    0xe4809a,
-    0xe4809b,
-    0xe4809c,
-    0xe4809d,
-    0xe4809e,
-    0xe4809f,
-    0xe480a0,
-    0xe480a1,
-    0xe480a2,
-    0xe480a3,
-    0xe480a4,
-    0xe480a5,
-    0xe480a6,
-    0xe480a7,
-    0xe480a8,
-    0xe480a9,
-    0xe480aa,
-    0xe480ab,
-    0xe480ac,
-    0xe480ad,
-    0xe480ae,
-    0xe480af,
-    0xe480b0,
-    0xe480b1,
-    0xe480b2,
-    0xe480b3,
-    0xe480b4,
-    0xe480b5,
-    0xe480b6,
-    0xe480b7,
-    0xe480b8,
-    0xe480b9,
-    0xe480ba,
-    0xe480bb,
-    0xe480bc,
-    0xe480bd,
-    0xe480be,
-    0xe480bf,
-    0xe48180,
-    0xe48181,
-    0xe48182,
-    0xe48183,
-    0xe48184,
-    0xe48185,
-    0xe48186,
-    0xe48187,
-    0xe48188,
-    0xe48189,
-    0xe4818a,
-    0xe4818b,
-    0xe4818c,
-    0xe4818d,
-    0xe4818e,
-    0xe4818f,
-    0xe48190,
-    0xe48191,
-    0xe48192,
-    0xe48193,
-    0xe48194,
-    0xe48195,
-    0xe48196,
-    0xe48197,
-    0xe48198,
-    0xe48199,
-    0xe4819a,
-    0xe4819b,
-    0xe4819c,
-    0xe4819d,
-    0xe4819e,
-    0xe4819f,
-    0xe481a0,
-    0xe481a1,
-    0xe481a2,
-    0xe481a3,
-    0xe481a4,
-    0xe481a5,
-    0xe481a6,
-    0xe481a7,
-    0xe481a8,
-    0xe481a9,
-    0xe481aa,
-    0xe481ab,
-    0xe481ac,
-    0xe481ad,
-    0xe481ae,
-    0xe481af,
-    0xe481b0,
-    0xe481b1,
-    0xe481b2,
-    0xe481b3,
-    0xe481b4,
-    0xe481b5,
-    0xe481b6,
-    0xe481b7,
-    0xe481b8,
-    0xe481b9,
-    0xe481ba,
-    0xe481bb,
-    0xe481bc,
-    0xe481bd,
-    0xe481be,
-    0xe481bf,
-    0xe48280,
-    0xe48281,
-    0xe48282,
-    0xe48283,
-    0xe48284,
-    0xe48285,
-    0xe48286,
-    0xe48287,
-    0xe48288,
-    0xe48289,
-    0xe4828a,
-    0xe4828b,
-    0xe4828c,
-    0xe4828d,
-    0xe4828e,
-    0xe4828f,
-    0xe48290,
-    0xe48291,
-    0xe48292,
-    0xe48293,
-    0xe48294,
-    0xe48295,
-    0xe48296,
-    0xe48297,
-    0xe48298,
-    0xe48299,
-    0xe4829a,
-    0xe4829b,
-    0xe4829c,
-    0xe4829d,
-    0xe4829e,
-    0xe4829f,
-    0xe482a0,
-    0xe482a1,
-    0xe482a2,
-    0xe482a3,
-    0xe482a4,
-    0xe482a5,
-    0xe482a6,
-    0xe482a7,
-    0xe482a8,
-    0xe482a9,
-    0xe482aa,
-    0xe482ab,
-    0xe482ac,
-    0xe482ad,
-    0xe482ae,
-    0xe482af,
-    0xe482b0,
-    0xe482b1,
-    0xe482b2,
-    0xe482b3,
-    0xe482b4,
-    0xe482b5,
-    0xe482b6,
-    0xe482b7,
-    0xe482b8,
-    0xe482b9,
-    0xe482ba,
-    0xe482bb,
-    0xe482bc,
-    0xe482bd,
-    0xe482be,
-    0xe482bf,
-    0xe48380,
-    0xe48381,
-    0xe48382,
-    0xe48383,
-    0xe48384,
-    0xe48385,
-    0xe48386,
-    0xe48387,
-    0xe48388,
-    0xe48389,
-    0xe4838a,
-    0xe4838b,
-    0xe4838c,
-    0xe4838d,
-    0xe4838e,
-    0xe4838f,
-    0xe48390,
-    0xe48391,
-    0xe48392,
-    0xe48393,
-    0xe48394,
-    0xe48395,
-    0xe48396,
-    0xe48397,
-    0xe48398,
-    0xe48399,
-    0xe4839a,
-    0xe4839b,
-    0xe4839c,
-    0xe4839d,
-    0xe4839e,
-    0xe4839f,
-    0xe483a0,
-    0xe483a1,
-    0xe483a2,
-    0xe483a3,
-    0xe483a4,
-    0xe483a5,
-    0xe483a6,
-    0xe483a7,
-    0xe483a8,
-    0xe483a9,
-    0xe483aa,
-    0xe483ab,
-    0xe483ac,
-    0xe483ad,
-    0xe483ae,
-    0xe483af,
-    0xe483b0,
-    0xe483b1,
-    0xe483b2,
-    0xe483b3,
-    0xe483b4,
-    0xe483b5,
-    0xe483b6,
-    0xe483b7,
-    0xe483b8,
-    0xe483b9,
-    0xe483ba,
-    0xe483bb,
-    0xe483bc,
-    0xe483bd,
-    0xe483be,
-    0xe483bf,
-    0xe48480,
-    0xe48481,
-    0xe48482,
-    0xe48483,
-    0xe48484,
-    0xe48485,
-    0xe48486,
-    0xe48487,
-    0xe48488,
-    0xe48489,
-    0xe4848a,
-    0xe4848b,
-    0xe4848c,
-    0xe4848d,
-    0xe4848e,
-    0xe4848f,
-    0xe48490,
-    0xe48491,
-    0xe48492,
-    0xe48493,
-    0xe48494,
-    0xe48495,
-    0xe48496,
-    0xe48497,
-    0xe48498,
-    0xe48499,
-    0xe4849a,
-    0xe4849b,
-    0xe4849c,
-    0xe4849d,
-    0xe4849e,
-    0xe4849f,
-    0xe484a0,
-    0xe484a1,
-    0xe484a2,
-    0xe484a3,
-    0xe484a4,
-    0xe484a5,
-    0xe484a6,
-    0xe484a7,
-    0xe484a8,
-    0xe484a9,
-    0xe484aa,
-    0xe484ab,
-    0xe484ac,
-    0xe484ad,
-    0xe484ae,
-    0xe484af,
-    0xe484b0,
-    0xe484b1,
-    0xe484b2,
-    0xe484b3,
-    0xe484b4,
-    0xe484b5,
-    0xe484b6,
-    0xe484b7,
-    0xe484b8,
-    0xe484b9,
-    0xe484ba,
-    0xe484bb,
-    0xe484bc,
-    0xe484bd,
-    0xe484be,
-    0xe484bf,
-    0xe48580,
-    0xe48581,
-    0xe48582,
-    0xe48583,
-    0xe48584,
-    0xe48585,
-    0xe48586,
-    0xe48587,
-    0xe48588,
-    0xe48589,
-    0xe4858a,
-    0xe4858b,
-    0xe4858c,
-    0xe4858d,
-    0xe4858e,
-    0xe4858f,
-    0xe48590,
-    0xe48591,
-    0xe48592,
-    0xe48593,
-    0xe48594,
-    0xe48595,
-    0xe48596,
-    0xe48597,
-    0xe48598,
-    0xe48599,
-    0xe4859a,
-    0xe4859b,
-    0xe4859c,
-    0xe4859d,
-    0xe4859e,
-    0xe4859f,
-    0xe485a0,
-    0xe485a1,
-    0xe485a2,
-    0xe485a3,
-    0xe485a4,
-    0xe485a5,
-    0xe485a6,
-    0xe485a7,
-    0xe485a8,
-    0xe485a9,
-    0xe485aa,
-    0xe485ab,
-    0xe485ac,
-    0xe485ad,
-    0xe485ae,
-    0xe485af,
-    0xe485b0,
-    0xe485b1,
-    0xe485b2,
-    0xe485b3,
-    0xe485b4,
-    0xe485b5,
-    0xe485b6,
-    0xe485b7,
-    0xe485b8,
-    0xe485b9,
-    0xe485ba,
-    0xe485bb,
-    0xe485bc,
-    0xe485bd,
-    0xe485be,
-    0xe485bf,
-    0xe48680,
-    0xe48681,
-    0xe48682,
-    0xe48683,
-    0xe48684,
-    0xe48685,
-    0xe48686,
-    0xe48687,
-    0xe48688,
-    0xe48689,
-    0xe4868a,
-    0xe4868b,
-    0xe4868c,
-    0xe4868d,
-    0xe4868e,
-    0xe4868f,
-    0xe48690,
-    0xe48691,
-    0xe48692,
-    0xe48693,
-    0xe48694,
-    0xe48695,
-    0xe48696,
-    0xe48697,
-    0xe48698,
-    0xe48699,
-    0xe4869a,
-    0xe4869b,
-    0xe4869c,
-    0xe4869d,
-    0xe4869e,
-    0xe4869f,
-    0xe486a0,
-    0xe486a1,
-    0xe486a2,
-    0xe486a3,
-    0xe486a4,
-    0xe486a5,
-    0xe486a6,
-    0xe486a7,
-    0xe486a8,
-    0xe486a9,
-    0xe486aa,
-    0xe486ab,
-    0xe486ac,
-    0xe486ad,
-    0xe486ae,
-    0xe486af,
-    0xe486b0,
-    0xe486b1,
-    0xe486b2,
-    0xe486b3,
-    0xe486b4,
-    0xe486b5,
-    0xe486b6,
-    0xe486b7,
-    0xe486b8,
-    0xe486b9,
-    0xe486ba,
-    0xe486bb,
-    0xe486bc,
-    0xe486bd,
-    0xe486be,
-    0xe486bf,
-    0xe48780,
-    0xe48781,
-    0xe48782,
-    0xe48783,
-    0xe48784,
-    0xe48785,
-    0xe48786,
-    0xe48787,
-    0xe48788,
-    0xe48789,
-    0xe4878a,
-    0xe4878b,
-    0xe4878c,
-    0xe4878d,
-    0xe4878e,
-    0xe4878f,
-    0xe48790,
-    0xe48791,
-    0xe48792,
-    0xe48793,
-    0xe48794,
-    0xe48795,
-    0xe48796,
-    0xe48797,
-    0xe48798,
-    0xe48799,
-    0xe4879a,
-    0xe4879b,
-    0xe4879c,
-    0xe4879d,
-    0xe4879e,
-    0xe4879f,
-    0xe487a0,
-    0xe487a1,
-    0xe487a2,
-    0xe487a3,
-    0xe487a4,
-    0xe487a5,
-    0xe487a6,
-    0xe487a7,
-    0xe487a8,
-    0xe487a9,
-    0xe487aa,
-    0xe487ab,
-    0xe487ac,
-    0xe487ad,
-    0xe487ae,
-    0xe487af,
-    0xe487b0,
-    0xe487b1,
-    0xe487b2,
-    0xe487b3,
-    0xe487b4,
-    0xe487b5,
-    0xe487b6,
-    0xe487b7,
-    0xe487b8,
-    0xe487b9,
-    0xe487ba,
-    0xe487bb,
-    0xe487bc,
-    0xe487bd,
-    0xe487be,
-    0xe487bf,
-    0xe48880,
-    0xe48881,
-    0xe48882,
-    0xe48883,
-    0xe48884,
-    0xe48885,
-    0xe48886,
-    0xe48887,
-    0xe48888,
-    0xe48889,
-    0xe4888a,
-    0xe4888b,
-    0xe4888c,
-    0xe4888d,
-    0xe4888e,
-    0xe4888f,
-    0xe48890,
-    0xe48891,
-    0xe48892,
-    0xe48893,
-    0xe48894,
-    0xe48895,
-    0xe48896,
-    0xe48897,
-    0xe48898,
-    0xe48899,
-    0xe4889a,
-    0xe4889b,
-    0xe4889c,
-    0xe4889d,
-    0xe4889e,
-    0xe4889f,
-    0xe488a0,
-    0xe488a1,
-    0xe488a2,
-    0xe488a3,
-    0xe488a4,
-    0xe488a5,
-    0xe488a6,
-    0xe488a7,
-    0xe488a8,
-    0xe488a9,
-    0xe488aa,
-    0xe488ab,
-    0xe488ac,
-    0xe488ad,
-    0xe488ae,
-    0xe488af,
-    0xe488b0,
-    0xe488b1,
-    0xe488b2,
-    0xe488b3,
-    0xe488b4,
-    0xe488b5,
-    0xe488b6,
-    0xe488b7,
-    0xe488b8,
-    0xe488b9,
-    0xe488ba,
-    0xe488bb,
-    0xe488bc,
-    0xe488bd,
-    0xe488be,
-    0xe488bf,
-    0xe48980,
-    0xe48981,
-    0xe48982,
-    0xe48983,
-    0xe48984,
-    0xe48985,
-    0xe48986,
-    0xe48987,
-    0xe48988,
-    0xe48989,
-    0xe4898a,
-    0xe4898b,
-    0xe4898c,
-    0xe4898d,
-    0xe4898e,
-    0xe4898f,
-    0xe48990,
-    0xe48991,
-    0xe48992,
-    0xe48993,
-    0xe48994,
-    0xe48995,
-    0xe48996,
-    0xe48997,
-    0xe48998,
-    0xe48999,
-    0xe4899a,
-    0xe4899b,
-    0xe4899c,
-    0xe4899d,
-    0xe4899e,
-    0xe4899f,
-    0xe489a0,
-    0xe489a1,
-    0xe489a2,
-    0xe489a3,
-    0xe489a4,
-    0xe489a5,
-    0xe489a6,
-    0xe489a7,
-    0xe489a8,
-    0xe489a9,
-    0xe489aa,
-    0xe489ab,
-    0xe489ac,
-    0xe489ad,
-    0xe489ae,
-    0xe489af,
-    0xe489b0,
-    0xe489b1,
-    0xe489b2,
-    0xe489b3,
-    0xe489b4,
-    0xe489b5,
-    0xe489b6,
-    0xe489b7,
-    0xe489b8,
-    0xe489b9,
-    0xe489ba,
-    0xe489bb,
-    0xe489bc,
-    0xe489bd,
-    0xe489be,
-    0xe489bf,
-    0xe48a80,
-    0xe48a81,
-    0xe48a82,
-    0xe48a83,
-    0xe48a84,
-    0xe48a85,
-    0xe48a86,
-    0xe48a87,
-    0xe48a88,
-    0xe48a89,
-    0xe48a8a,
-    0xe48a8b,
-    0xe48a8c,
-    0xe48a8d,
-    0xe48a8e,
-    0xe48a8f,
-    0xe48a90,
-    0xe48a91,
-    0xe48a92,
-    0xe48a93,
-    0xe48a94,
-    0xe48a95,
-    0xe48a96,
-    0xe48a97,
-    0xe48a98,
-    0xe48a99,
-    0xe48a9a,
-    0xe48a9b,
-    0xe48a9c,
-    0xe48a9d,
-    0xe48a9e,
-    0xe48a9f,
-    0xe48aa0,
-    0xe48aa1,
-    0xe48aa2,
-    0xe48aa3,
-    0xe48aa4,
-    0xe48aa5,
-    0xe48aa6,
-    0xe48aa7,
-    0xe48aa8,
-    0xe48aa9,
-    0xe48aaa,
-    0xe48aab,
-    0xe48aac,
-    0xe48aad,
-    0xe48aae,
-    0xe48aaf,
-    0xe48ab0,
-    0xe48ab1,
-    0xe48ab2,
-    0xe48ab3,
-    0xe48ab4,
-    0xe48ab5,
-    0xe48ab6,
-    0xe48ab7,
-    0xe48ab8,
-    0xe48ab9,
-    0xe48aba,
-    0xe48abb,
-    0xe48abc,
-    0xe48abd,
-    0xe48abe,
-    0xe48abf,
-    0xe48b80,
-    0xe48b81,
-    0xe48b82,
-    0xe48b83,
-    0xe48b84,
-    0xe48b85,
-    0xe48b86,
-    0xe48b87,
-    0xe48b88,
-    0xe48b89,
-    0xe48b8a,
-    0xe48b8b,
-    0xe48b8c,
-    0xe48b8d,
-    0xe48b8e,
-    0xe48b8f,
-    0xe48b90,
-    0xe48b91,
-    0xe48b92,
-    0xe48b93,
-    0xe48b94,
-    0xe48b95,
-    0xe48b96,
-    0xe48b97,
-    0xe48b98,
-    0xe48b99,
-    0xe48b9a,
-    0xe48b9b,
-    0xe48b9c,
-    0xe48b9d,
-    0xe48b9e,
-    0xe48b9f,
-    0xe48ba0,
-    0xe48ba1,
-    0xe48ba2,
-    0xe48ba3,
-    0xe48ba4,
-    0xe48ba5,
-    0xe48ba6,
-    0xe48ba7,
-    0xe48ba8,
-    0xe48ba9,
-    0xe48baa,
-    0xe48bab,
-    0xe48bac,
-    0xe48bad,
-    0xe48bae,
-    0xe48baf,
-    0xe48bb0,
-    0xe48bb1,
-    0xe48bb2,
-    0xe48bb3,
-    0xe48bb4,
-    0xe48bb5,
-    0xe48bb6,
-    0xe48bb7,
-    0xe48bb8,
-    0xe48bb9,
-    0xe48bba,
-    0xe48bbb,
-    0xe48bbc,
-    0xe48bbd,
-    0xe48bbe,
-    0xe48bbf,
-    0xe48c80,
-    0xe48c81,
-    0xe48c82,
-    0xe48c83,
-    0xe48c84,
-    0xe48c85,
-    0xe48c86,
-    0xe48c87,
-    0xe48c88,
-    0xe48c89,
-    0xe48c8a,
-    0xe48c8b,
-    0xe48c8c,
-    0xe48c8d,
-    0xe48c8e,
-    0xe48c8f,
-    0xe48c90,
-    0xe48c91,
-    0xe48c92,
-    0xe48c93,
-    0xe48c94,
-    0xe48c95,
-    0xe48c96,
-    0xe48c97,
-    0xe48c98,
-    0xe48c99,
-    0xe48c9a,
-    0xe48c9b,
-    0xe48c9c,
-    0xe48c9d,
-    0xe48c9e,
-    0xe48c9f,
-    0xe48ca0,
-    0xe48ca1,
-    0xe48ca2,
-    0xe48ca3,
-    0xe48ca4,
-    0xe48ca5,
-    0xe48ca6,
-    0xe48ca7,
-    0xe48ca8,
-    0xe48ca9,
-    0xe48caa,
-    0xe48cab,
-    0xe48cac,
-    0xe48cad,
-    0xe48cae,
-    0xe48caf,
-    0xe48cb0,
-    0xe48cb1,
-    0xe48cb2,
-    0xe48cb3,
-    0xe48cb4,
-    0xe48cb5,
-    0xe48cb6,
-    0xe48cb7,
-    0xe48cb8,
-    0xe48cb9,
-    0xe48cba,
-    0xe48cbb,
-    0xe48cbc,
-    0xe48cbd,
-    0xe48cbe,
-    0xe48cbf,
-    0xe48d80,
-    0xe48d81,
-    0xe48d82,
-    0xe48d83,
-    0xe48d84,
-    0xe48d85,
-    0xe48d86,
-    0xe48d87,
-    0xe48d88,
-    0xe48d89,
-    0xe48d8a,
-    0xe48d8b,
-    0xe48d8c,
-    0xe48d8d,
-    0xe48d8e,
-    0xe48d8f,
-    0xe48d90,
-    0xe48d91,
-    0xe48d92,
-    0xe48d93,
-    0xe48d94,
-    0xe48d95,
-    0xe48d96,
-    0xe48d97,
-    0xe48d98,
-    0xe48d99,
-    0xe48d9a,
-    0xe48d9b,
-    0xe48d9c,
-    0xe48d9d,
-    0xe48d9e,
-    0xe48d9f,
-    0xe48da0,
-    0xe48da1,
-    0xe48da2,
-    0xe48da3,
-    0xe48da4,
-    0xe48da5,
-    0xe48da6,
-    0xe48da7,
-    0xe48da8,
-    0xe48da9,
-    0xe48daa,
-    0xe48dab,
-    0xe48dac,
-    0xe48dad,
-    0xe48dae,
-    0xe48daf,
-    0xe48db0,
-    0xe48db1,
-    0xe48db2,
-    0xe48db3,
-    0xe48db4,
-    0xe48db5,
-    0xe48db6,
-    0xe48db7,
-    0xe48db8,
-    0xe48db9,
-    0xe48dba,
-    0xe48dbb,
-    0xe48dbc,
-    0xe48dbd,
-    0xe48dbe,
-    0xe48dbf,
-    0xe48e80,
-    0xe48e81,
-    0xe48e82,
-    0xe48e83,
-    0xe48e84,
-    0xe48e85,
-    0xe48e86,
-    0xe48e87,
-    0xe48e88,
-    0xe48e89,
-    0xe48e8a,
-    0xe48e8b,
-    0xe48e8c,
-    0xe48e8d,
-    0xe48e8e,
-    0xe48e8f,
-    0xe48e90,
-    0xe48e91,
-    0xe48e92,
-    0xe48e93,
-    0xe48e94,
-    0xe48e95,
-    0xe48e96,
-    0xe48e97,
-    0xe48e98,
-    0xe48e99,
-    0xe48e9a,
-    0xe48e9b,
-    0xe48e9c,
-    0xe48e9d,
-    0xe48e9e,
-    0xe48e9f,
-    0xe48ea0,
-    0xe48ea1,
-    0xe48ea2,
-    0xe48ea3,
-    0xe48ea4,
-    0xe48ea5,
-    0xe48ea6,
-    0xe48ea7,
-    0xe48ea8,
-    0xe48ea9,
-    0xe48eaa,
-    0xe48eab,
-    0xe48eac,
-    0xe48ead,
-    0xe48eae,
-    0xe48eaf,
-    0xe48eb0,
-    0xe48eb1,
-    0xe48eb2,
-    0xe48eb3,
-    0xe48eb4,
-    0xe48eb5,
-    0xe48eb6,
-    0xe48eb7,
-    0xe48eb8,
-    0xe48eb9,
-    0xe48eba,
-    0xe48ebb,
-    0xe48ebc,
-    0xe48ebd,
-    0xe48ebe,
-    0xe48ebf,
-    0xe48f80,
-    0xe48f81,
-    0xe48f82,
-    0xe48f83,
-    0xe48f84,
-    0xe48f85,
-    0xe48f86,
-    0xe48f87,
-    0xe48f88,
-    0xe48f89,
-    0xe48f8a,
-    0xe48f8b,
-    0xe48f8c,
-    0xe48f8d,
-    0xe48f8e,
-    0xe48f8f,
-    0xe48f90,
-    0xe48f91,
-    0xe48f92,
-    0xe48f93,
-    0xe48f94,
-    0xe48f95,
-    0xe48f96,
-    0xe48f97,
-    0xe48f98,
-    0xe48f99,
-    0xe48f9a,
-    0xe48f9b,
-    0xe48f9c,
-    0xe48f9d,
-    0xe48f9e,
-    0xe48f9f,
-    0xe48fa0,
-    0xe48fa1,
-    0xe48fa2,
-    0xe48fa3,
-    0xe48fa4,
-    0xe48fa5,
-    0xe48fa6,
-    0xe48fa7,
-    0xe48fa8,
-    0xe48fa9,
-    0xe48faa,
-    0xe48fab,
-    0xe48fac,
-    0xe48fad,
-    0xe48fae,
-    0xe48faf,
-    0xe48fb0,
-    0xe48fb1,
-    0xe48fb2,
-    0xe48fb3,
-    0xe48fb4,
-    0xe48fb5,
-    0xe48fb6,
-    0xe48fb7,
-    0xe48fb8,
-    0xe48fb9,
-    0xe48fba,
-    0xe48fbb,
-    0xe48fbc,
-    0xe48fbd,
-    0xe48fbe,
-    0xe48fbf,
-    0xe49080,
-    0xe49081,
-    0xe49082,
-    0xe49083,
-    0xe49084,
-    0xe49085,
-    0xe49086,
-    0xe49087,
-    0xe49088,
-    0xe49089,
-    0xe4908a,
-    0xe4908b,
-    0xe4908c,
-    0xe4908d,
-    0xe4908e,
-    0xe4908f,
-    0xe49090,
-    0xe49091,
-    0xe49092,
-    0xe49093,
-    0xe49094,
-    0xe49095,
-    0xe49096,
-    0xe49097,
-    0xe49098,
-    0xe49099,
-    0xe4909a,
-    0xe4909b,
-    0xe4909c,
-    0xe4909d,
-    0xe4909e,
-    0xe4909f,
-    0xe490a0,
-    0xe490a1,
-    0xe490a2,
-    0xe490a3,
-    0xe490a4,
-    0xe490a5,
-    0xe490a6,
-    0xe490a7,
-    0xe490a8,
-    0xe490a9,
-    0xe490aa,
-    0xe490ab,
-    0xe490ac,
-    0xe490ad,
-    0xe490ae,
-    0xe490af,
-    0xe490b0,
-    0xe490b1,
-    0xe490b2,
-    0xe490b3,
-    0xe490b4,
-    0xe490b5,
-    0xe490b6,
-    0xe490b7,
-    0xe490b8,
-    0xe490b9,
-    0xe490ba,
-    0xe490bb,
-    0xe490bc,
-    0xe490bd,
-    0xe490be,
-    0xe490bf,
-    0xe49180,
-    0xe49181,
-    0xe49182,
-    0xe49183,
-    0xe49184,
-    0xe49185,
-    0xe49186,
-    0xe49187,
-    0xe49188,
-    0xe49189,
-    0xe4918a,
-    0xe4918b,
-    0xe4918c,
-    0xe4918d,
-    0xe4918e,
-    0xe4918f,
-    0xe49190,
-    0xe49191,
-    0xe49192,
-    0xe49193,
-    0xe49194,
-    0xe49195,
-    0xe49196,
-    0xe49197,
-    0xe49198,
-    0xe49199,
-    0xe4919a,
-    0xe4919b,
-    0xe4919c,
-    0xe4919d,
-    0xe4919e,
-    0xe4919f,
-    0xe491a0,
-    0xe491a1,
-    0xe491a2,
-    0xe491a3,
-    0xe491a4,
-    0xe491a5,
-    0xe491a6,
-    0xe491a7,
-    0xe491a8,
-    0xe491a9,
-    0xe491aa,
-    0xe491ab,
-    0xe491ac,
-    0xe491ad,
-    0xe491ae,
-    0xe491af,
-    0xe491b0,
-    0xe491b1,
-    0xe491b2,
-    0xe491b3,
-    0xe491b4,
-    0xe491b5,
-    0xe491b6,
-    0xe491b7,
-    0xe491b8,
-    0xe491b9,
-    0xe491ba,
-    0xe491bb,
-    0xe491bc,
-    0xe491bd,
-    0xe491be,
-    0xe491bf,
-    0xe49280,
-    0xe49281,
-    0xe49282,
-    0xe49283,
-    0xe49284,
-    0xe49285,
-    0xe49286,
-    0xe49287,
-    0xe49288,
-    0xe49289,
-    0xe4928a,
-    0xe4928b,
-    0xe4928c,
-    0xe4928d,
-    0xe4928e,
-    0xe4928f,
-    0xe49290,
-    0xe49291,
-    0xe49292,
-    0xe49293,
-    0xe49294,
-    0xe49295,
-    0xe49296,
-    0xe49297,
-    0xe49298,
-    0xe49299,
-    0xe4929a,
-    0xe4929b,
-    0xe4929c,
-    0xe4929d,
-    0xe4929e,
-    0xe4929f,
-    0xe492a0,
-    0xe492a1,
-    0xe492a2,
-    0xe492a3,
-    0xe492a4,
-    0xe492a5,
-    0xe492a6,
-    0xe492a7,
-    0xe492a8,
-    0xe492a9,
-    0xe492aa,
-    0xe492ab,
-    0xe492ac,
-    0xe492ad,
-    0xe492ae,
-    0xe492af,
-    0xe492b0,
-    0xe492b1,
-    0xe492b2,
-    0xe492b3,
-    0xe492b4,
-    0xe492b5,
-    0xe492b6,
-    0xe492b7,
-    0xe492b8,
-    0xe492b9,
-    0xe492ba,
-    0xe492bb,
-    0xe492bc,
-    0xe492bd,
-    0xe492be,
-    0xe492bf,
-    0xe49380,
-    0xe49381,
-    0xe49382,
-    0xe49383,
-    0xe49384,
-    0xe49385,
-    0xe49386,
-    0xe49387,
-    0xe49388,
-    0xe49389,
-    0xe4938a,
-    0xe4938b,
-    0xe4938c,
-    0xe4938d,
-    0xe4938e,
-    0xe4938f,
-    0xe49390,
-    0xe49391,
-    0xe49392,
-    0xe49393,
-    0xe49394,
-    0xe49395,
-    0xe49396,
-    0xe49397,
-    0xe49398,
-    0xe49399,
-    0xe4939a,
-    0xe4939b,
-    0xe4939c,
-    0xe4939d,
-    0xe4939e,
-    0xe4939f,
-    0xe493a0,
-    0xe493a1,
-    0xe493a2,
-    0xe493a3,
-    0xe493a4,
-    0xe493a5,
-    0xe493a6,
-    0xe493a7,
-    0xe493a8,
-    0xe493a9,
-    0xe493aa,
-    0xe493ab,
-    0xe493ac,
-    0xe493ad,
-    0xe493ae,
-    0xe493af,
-    0xe493b0,
-    0xe493b1,
-    0xe493b2,
-    0xe493b3,
-    0xe493b4,
-    0xe493b5,
-    0xe493b6,
-    0xe493b7,
-    0xe493b8,
-    0xe493b9,
-    0xe493ba,
-    0xe493bb,
-    0xe493bc,
-    0xe493bd,
-    0xe493be,
-    0xe493bf,
-    0xe49480,
-    0xe49481,
-    0xe49482,
-    0xe49483,
-    0xe49484,
-    0xe49485,
-    0xe49486,
-    0xe49487,
-    0xe49488,
-    0xe49489,
-    0xe4948a,
-    0xe4948b,
-    0xe4948c,
-    0xe4948d,
-    0xe4948e,
-    0xe4948f,
-    0xe49490,
-    0xe49491,
-    0xe49492,
-    0xe49493,
-    0xe49494,
-    0xe49495,
-    0xe49496,
-    0xe49497,
-    0xe49498,
-    0xe49499,
-    0xe4949a,
-    0xe4949b,
-    0xe4949c,
-    0xe4949d,
-    0xe4949e,
-    0xe4949f,
-    0xe494a0,
-    0xe494a1,
-    0xe494a2,
-    0xe494a3,
-    0xe494a4,
-    0xe494a5,
-    0xe494a6,
-    0xe494a7,
-    0xe494a8,
-    0xe494a9,
-    0xe494aa,
-    0xe494ab,
-    0xe494ac,
-    0xe494ad,
-    0xe494ae,
-    0xe494af,
-    0xe494b0,
-    0xe494b1,
-    0xe494b2,
-    0xe494b3,
-    0xe494b4,
-    0xe494b5,
-    0xe494b6,
-    0xe494b7,
-    0xe494b8,
-    0xe494b9,
-    0xe494ba,
-    0xe494bb,
-    0xe494bc,
-    0xe494bd,
-    0xe494be,
-    0xe494bf,
-    0xe49580,
-    0xe49581,
-    0xe49582,
-    0xe49583,
-    0xe49584,
-    0xe49585,
-    0xe49586,
-    0xe49587,
-    0xe49588,
-    0xe49589,
-    0xe4958a,
-    0xe4958b,
-    0xe4958c,
-    0xe4958d,
-    0xe4958e,
-    0xe4958f,
-    0xe49590,
-    0xe49591,
-    0xe49592,
-    0xe49593,
-    0xe49594,
-    0xe49595,
-    0xe49596,
-    0xe49597,
-    0xe49598,
-    0xe49599,
-    0xe4959a,
-    0xe4959b,
-    0xe4959c,
-    0xe4959d,
-    0xe4959e,
-    0xe4959f,
-    0xe495a0,
-    0xe495a1,
-    0xe495a2,
-    0xe495a3,
-    0xe495a4,
-    0xe495a5,
-    0xe495a6,
-    0xe495a7,
-    0xe495a8,
-    0xe495a9,
-    0xe495aa,
-    0xe495ab,
-    0xe495ac,
-    0xe495ad,
-    0xe495ae,
-    0xe495af,
-    0xe495b0,
-    0xe495b1,
-    0xe495b2,
-    0xe495b3,
-    0xe495b4,
-    0xe495b5,
-    0xe495b6,
-    0xe495b7,
-    0xe495b8,
-    0xe495b9,
-    0xe495ba,
-    0xe495bb,
-    0xe495bc,
-    0xe495bd,
-    0xe495be,
-    0xe495bf,
-    0xe49680,
-    0xe49681,
-    0xe49682,
-    0xe49683,
-    0xe49684,
-    0xe49685,
-    0xe49686,
-    0xe49687,
-    0xe49688,
-    0xe49689,
-    0xe4968a,
-    0xe4968b,
-    0xe4968c,
-    0xe4968d,
-    0xe4968e,
-    0xe4968f,
-    0xe49690,
-    0xe49691,
-    0xe49692,
-    0xe49693,
-    0xe49694,
-    0xe49695,
-    0xe49696,
-    0xe49697,
-    0xe49698,
-    0xe49699,
-    0xe4969a,
-    0xe4969b,
-    0xe4969c,
-    0xe4969d,
-    0xe4969e,
-    0xe4969f,
-    0xe496a0,
-    0xe496a1,
-    0xe496a2,
-    0xe496a3,
-    0xe496a4,
-    0xe496a5,
-    0xe496a6,
-    0xe496a7,
-    0xe496a8,
-    0xe496a9,
-    0xe496aa,
-    0xe496ab,
-    0xe496ac,
-    0xe496ad,
-    0xe496ae,
-    0xe496af,
-    0xe496b0,
-    0xe496b1,
-    0xe496b2,
-    0xe496b3,
-    0xe496b4,
-    0xe496b5,
-    0xe496b6,
-    0xe496b7,
-    0xe496b8,
-    0xe496b9,
-    0xe496ba,
-    0xe496bb,
-    0xe496bc,
-    0xe496bd,
-    0xe496be,
-    0xe496bf,
-    0xe49780,
-    0xe49781,
-    0xe49782,
-    0xe49783,
-    0xe49784,
-    0xe49785,
-    0xe49786,
-    0xe49787,
-    0xe49788,
-    0xe49789,
-    0xe4978a,
-    0xe4978b,
-    0xe4978c,
-    0xe4978d,
-    0xe4978e,
-    0xe4978f,
-    0xe49790,
-    0xe49791,
-    0xe49792,
-    0xe49793,
-    0xe49794,
-    0xe49795,
-    0xe49796,
-    0xe49797,
-    0xe49798,
-    0xe49799,
-    0xe4979a,
-    0xe4979b,
-    0xe4979c,
-    0xe4979d,
-    0xe4979e,
-    0xe4979f,
-    0xe497a0,
-    0xe497a1,
-    0xe497a2,
-    0xe497a3,
-    0xe497a4,
-    0xe497a5,
-    0xe497a6,
-    0xe497a7,
-    0xe497a8,
-    0xe497a9,
-    0xe497aa,
-    0xe497ab,
-    0xe497ac,
-    0xe497ad,
-    0xe497ae,
-    0xe497af,
-    0xe497b0,
-    0xe497b1,
-    0xe497b2,
-    0xe497b3,
-    0xe497b4,
-    0xe497b5,
-    0xe497b6,
-    0xe497b7,
-    0xe497b8,
-    0xe497b9,
-    0xe497ba,
-    0xe497bb,
-    0xe497bc,
-    0xe497bd,
-    0xe497be,
-    0xe497bf,
-    0xe49880,
-    0xe49881,
-    0xe49882,
-    0xe49883,
-    0xe49884,
-    0xe49885,
-    0xe49886,
-    0xe49887,
-    0xe49888,
-    0xe49889,
-    0xe4988a,
-    0xe4988b,
-    0xe4988c,
-    0xe4988d,
-    0xe4988e,
-    0xe4988f,
-    0xe49890,
-    0xe49891,
-    0xe49892,
-    0xe49893,
-    0xe49894,
-    0xe49895,
-    0xe49896,
-    0xe49897,
-    0xe49898,
-    0xe49899,
-    0xe4989a,
-    0xe4989b,
-    0xe4989c,
-    0xe4989d,
-    0xe4989e,
-    0xe4989f,
-    0xe498a0,
-    0xe498a1,
-    0xe498a2,
-    0xe498a3,
-    0xe498a4,
-    0xe498a5,
-    0xe498a6,
-    0xe498a7,
-    0xe498a8,
-    0xe498a9,
-    0xe498aa,
-    0xe498ab,
-    0xe498ac,
-    0xe498ad,
-    0xe498ae,
-    0xe498af,
-    0xe498b0,
-    0xe498b1,
-    0xe498b2,
-    0xe498b3,
-    0xe498b4,
-    0xe498b5,
-    0xe498b6,
-    0xe498b7,
-    0xe498b8,
-    0xe498b9,
-    0xe498ba,
-    0xe498bb,
-    0xe498bc,
-    0xe498bd,
-    0xe498be,
-    0xe498bf,
-    0xe49980,
-    0xe49981,
-    0xe49982,
-    0xe49983,
-    0xe49984,
-    0xe49985,
-    0xe49986,
-    0xe49987,
-    0xe49988,
-    0xe49989,
-    0xe4998a,
-    0xe4998b,
-    0xe4998c,
-    0xe4998d,
-    0xe4998e,
-    0xe4998f,
-    0xe49990,
-    0xe49991,
-    0xe49992,
-    0xe49993,
-    0xe49994,
-    0xe49995,
-    0xe49996,
-    0xe49997,
-    0xe49998,
-    0xe49999,
-    0xe4999a,
-    0xe4999b,
-    0xe4999c,
-    0xe4999d,
-    0xe4999e,
-    0xe4999f,
-    0xe499a0,
-    0xe499a1,
-    0xe499a2,
-    0xe499a3,
-    0xe499a4,
-    0xe499a5,
-    0xe499a6,
-    0xe499a7,
-    0xe499a8,
-    0xe499a9,
-    0xe499aa,
-    0xe499ab,
-    0xe499ac,
-    0xe499ad,
-    0xe499ae,
-    0xe499af,
-    0xe499b0,
-    0xe499b1,
-    0xe499b2,
-    0xe499b3,
-    0xe499b4,
-    0xe499b5,
-    0xe499b6,
-    0xe499b7,
-    0xe499b8,
-    0xe499b9,
-    0xe499ba,
-    0xe499bb,
-    0xe499bc,
-    0xe499bd,
-    0xe499be,
-    0xe499bf,
-    0xe49a80,
-    0xe49a81,
-    0xe49a82,
-    0xe49a83,
-    0xe49a84,
-    0xe49a85,
-    0xe49a86,
-    0xe49a87,
-    0xe49a88,
-    0xe49a89,
-    0xe49a8a,
-    0xe49a8b,
-    0xe49a8c,
-    0xe49a8d,
-    0xe49a8e,
-    0xe49a8f,
-    0xe49a90,
-    0xe49a91,
-    0xe49a92,
-    0xe49a93,
-    0xe49a94,
-    0xe49a95,
-    0xe49a96,
-    0xe49a97,
-    0xe49a98,
-    0xe49a99,
-    0xe49a9a,
-    0xe49a9b,
-    0xe49a9c,
-    0xe49a9d,
-    0xe49a9e,
-    0xe49a9f,
-    0xe49aa0,
-    0xe49aa1,
-    0xe49aa2,
-    0xe49aa3,
-    0xe49aa4,
-    0xe49aa5,
-    0xe49aa6,
-    0xe49aa7,
-    0xe49aa8,
-    0xe49aa9,
-    0xe49aaa,
-    0xe49aab,
-    0xe49aac,
-    0xe49aad,
-    0xe49aae,
-    0xe49aaf,
-    0xe49ab0,
-    0xe49ab1,
-    0xe49ab2,
-    0xe49ab3,
-    0xe49ab4,
-    0xe49ab5,
-    0xe49ab6,
-    0xe49ab7,
-    0xe49ab8,
-    0xe49ab9,
-    0xe49aba,
-    0xe49abb,
-    0xe49abc,
-    0xe49abd,
-    0xe49abe,
-    0xe49abf,
-    0xe49b80,
-    0xe49b81,
-    0xe49b82,
-    0xe49b83,
-    0xe49b84,
-    0xe49b85,
-    0xe49b86,
-    0xe49b87,
-    0xe49b88,
-    0xe49b89,
-    0xe49b8a,
-    0xe49b8b,
-    0xe49b8c,
-    0xe49b8d,
-    0xe49b8e,
-    0xe49b8f,
-    0xe49b90,
-    0xe49b91,
-    0xe49b92,
-    0xe49b93,
-    0xe49b94,
-    0xe49b95,
-    0xe49b96,
-    0xe49b97,
-    0xe49b98,
-    0xe49b99,
-    0xe49b9a,
-    0xe49b9b,
-    0xe49b9c,
-    0xe49b9d,
-    0xe49b9e,
-    0xe49b9f,
-    0xe49ba0,
-    0xe49ba1,
-    0xe49ba2,
-    0xe49ba3,
-    0xe49ba4,
-    0xe49ba5,
-    0xe49ba6,
-    0xe49ba7,
-    0xe49ba8,
-    0xe49ba9,
-    0xe49baa,
-    0xe49bab,
-    0xe49bac,
-    0xe49bad,
-    0xe49bae,
-    0xe49baf,
-    0xe49bb0,
-    0xe49bb1,
-    0xe49bb2,
-    0xe49bb3,
-    0xe49bb4,
-    0xe49bb5,
-    0xe49bb6,
-    0xe49bb7,
-    0xe49bb8,
-    0xe49bb9,
-    0xe49bba,
-    0xe49bbb,
-    0xe49bbc,
-    0xe49bbd,
-    0xe49bbe,
-    0xe49bbf,
-    0xe49c80,
-    0xe49c81,
-    0xe49c82,
-    0xe49c83,
-    0xe49c84,
-    0xe49c85,
-    0xe49c86,
-    0xe49c87,
-    0xe49c88,
-    0xe49c89,
-    0xe49c8a,
-    0xe49c8b,
-    0xe49c8c,
-    0xe49c8d,
-    0xe49c8e,
-    0xe49c8f,
-    0xe49c90,
-    0xe49c91,
-    0xe49c92,
-    0xe49c93,
-    0xe49c94,
-    0xe49c95,
-    0xe49c96,
-    0xe49c97,
-    0xe49c98,
-    0xe49c99,
-    0xe49c9a,
-    0xe49c9b,
-    0xe49c9c,
-    0xe49c9d,
-    0xe49c9e,
-    0xe49c9f,
-    0xe49ca0,
-    0xe49ca1,
-    0xe49ca2,
-    0xe49ca3,
-    0xe49ca4,
-    0xe49ca5,
-    0xe49ca6,
-    0xe49ca7,
-    0xe49ca8,
-    0xe49ca9,
-    0xe49caa,
-    0xe49cab,
-    0xe49cac,
-    0xe49cad,
-    0xe49cae,
-    0xe49caf,
-    0xe49cb0,
-    0xe49cb1,
-    0xe49cb2,
-    0xe49cb3,
-    0xe49cb4,
-    0xe49cb5,
-    0xe49cb6,
-    0xe49cb7,
-    0xe49cb8,
-    0xe49cb9,
-    0xe49cba,
-    0xe49cbb,
-    0xe49cbc,
-    0xe49cbd,
-    0xe49cbe,
-    0xe49cbf,
-    0xe49d80,
-    0xe49d81,
-    0xe49d82,
-    0xe49d83,
-    0xe49d84,
-    0xe49d85,
-    0xe49d86,
-    0xe49d87,
-    0xe49d88,
-    0xe49d89,
-    0xe49d8a,
-    0xe49d8b,
-    0xe49d8c,
-    0xe49d8d,
-    0xe49d8e,
-    0xe49d8f,
-    0xe49d90,
-    0xe49d91,
-    0xe49d92,
-    0xe49d93,
-    0xe49d94,
-    0xe49d95,
-    0xe49d96,
-    0xe49d97,
-    0xe49d98,
-    0xe49d99,
-    0xe49d9a,
-    0xe49d9b,
-    0xe49d9c,
-    0xe49d9d,
-    0xe49d9e,
-    0xe49d9f,
-    0xe49da0,
-    0xe49da1,
-    0xe49da2,
-    0xe49da3,
-    0xe49da4,
-    0xe49da5,
-    0xe49da6,
-    0xe49da7,
-    0xe49da8,
-    0xe49da9,
-    0xe49daa,
-    0xe49dab,
-    0xe49dac,
-    0xe49dad,
-    0xe49dae,
-    0xe49daf,
-    0xe49db0,
-    0xe49db1,
-    0xe49db2,
-    0xe49db3,
-    0xe49db4,
-    0xe49db5,
-    0xe49db6,
-    0xe49db7,
-    0xe49db8,
-    0xe49db9,
-    0xe49dba,
-    0xe49dbb,
-    0xe49dbc,
-    0xe49dbd,
-    0xe49dbe,
-    0xe49dbf,
-    0xe49e80,
-    0xe49e81,
-    0xe49e82,
-    0xe49e83,
-    0xe49e84,
-    0xe49e85,
-    0xe49e86,
-    0xe49e87,
-    0xe49e88,
-    0xe49e89,
-    0xe49e8a,
-    0xe49e8b,
-    0xe49e8c,
-    0xe49e8d,
-    0xe49e8e,
-    0xe49e8f,
-    0xe49e90,
-    0xe49e91,
-    0xe49e92,
-    0xe49e93,
-    0xe49e94,
-    0xe49e95,
-    0xe49e96,
-    0xe49e97,
-    0xe49e98,
-    0xe49e99,
-    0xe49e9a,
-    0xe49e9b,
-    0xe49e9c,
-    0xe49e9d,
-    0xe49e9e,
-    0xe49e9f,
-    0xe49ea0,
-    0xe49ea1,
-    0xe49ea2,
-    0xe49ea3,
-    0xe49ea4,
-    0xe49ea5,
-    0xe49ea6,
-    0xe49ea7,
-    0xe49ea8,
-    0xe49ea9,
-    0xe49eaa,
-    0xe49eab,
-    0xe49eac,
-    0xe49ead,
-    0xe49eae,
-    0xe49eaf,
-    0xe49eb0,
-    0xe49eb1,
-    0xe49eb2,
-    0xe49eb3,
-    0xe49eb4,
-    0xe49eb5,
-    0xe49eb6,
-    0xe49eb7,
-    0xe49eb8,
-    0xe49eb9,
-    0xe49eba,
-    0xe49ebb,
-    0xe49ebc,
-    0xe49ebd,
-    0xe49ebe,
-    0xe49ebf,
-    0xe49f80,
-    0xe49f81,
-    0xe49f82,
-    0xe49f83,
-    0xe49f84,
-    0xe49f85,
-    0xe49f86,
-    0xe49f87,
-    0xe49f88,
-    0xe49f89,
-    0xe49f8a,
-    0xe49f8b,
-    0xe49f8c,
-    0xe49f8d,
-    0xe49f8e,
-    0xe49f8f,
-    0xe49f90,
-    0xe49f91,
-    0xe49f92,
-    0xe49f93,
-    0xe49f94,
-    0xe49f95,
-    0xe49f96,
-    0xe49f97,
-    0xe49f98,
-    0xe49f99,
-    0xe49f9a,
-    0xe49f9b,
-    0xe49f9c,
-    0xe49f9d,
-    0xe49f9e,
-    0xe49f9f,
-    0xe49fa0,
-    0xe49fa1,
-    0xe49fa2,
-    0xe49fa3,
-    0xe49fa4,
-    0xe49fa5,
-    0xe49fa6,
-    0xe49fa7,
-    0xe49fa8,
-    0xe49fa9,
-    0xe49faa,
-    0xe49fab,
-    0xe49fac,
-    0xe49fad,
-    0xe49fae,
-    0xe49faf,
-    0xe49fb0,
-    0xe49fb1,
-    0xe49fb2,
-    0xe49fb3,
-    0xe49fb4,
-    0xe49fb5,
-    0xe49fb6,
-    0xe49fb7,
-    0xe49fb8,
-    0xe49fb9,
-    0xe49fba,
-    0xe49fbb,
-    0xe49fbc,
-    0xe49fbd,
-    0xe49fbe,
-    0xe49fbf,
-    0xe4a080,
-    0xe4a081,
-    0xe4a082,
-    0xe4a083,
-    0xe4a084,
-    0xe4a085,
-    0xe4a086,
-    0xe4a087,
-    0xe4a088,
-    0xe4a089,
-    0xe4a08a,
-    0xe4a08b,
-    0xe4a08c,
-    0xe4a08d,
-    0xe4a08e,
-    0xe4a08f,
-    0xe4a090,
-    0xe4a091,
-    0xe4a092,
-    0xe4a093,
-    0xe4a094,
-    0xe4a095,
-    0xe4a096,
-    0xe4a097,
-    0xe4a098,
-    0xe4a099,
-    0xe4a09a,
-    0xe4a09b,
-    0xe4a09c,
-    0xe4a09d,
-    0xe4a09e,
-    0xe4a09f,
-    0xe4a0a0,
-    0xe4a0a1,
-    0xe4a0a2,
-    0xe4a0a3,
-    0xe4a0a4,
-    0xe4a0a5,
-    0xe4a0a6,
-    0xe4a0a7,
-    0xe4a0a8,
-    0xe4a0a9,
-    0xe4a0aa,
-    0xe4a0ab,
-    0xe4a0ac,
-    0xe4a0ad,
-    0xe4a0ae,
-    0xe4a0af,
-    0xe4a0b0,
-    0xe4a0b1,
-    0xe4a0b2,
-    0xe4a0b3,
-    0xe4a0b4,
-    0xe4a0b5,
-    0xe4a0b6,
-    0xe4a0b7,
-    0xe4a0b8,
-    0xe4a0b9,
-    0xe4a0ba,
-    0xe4a0bb,
-    0xe4a0bc,
-    0xe4a0bd,
-    0xe4a0be,
-    0xe4a0bf,
-    0xe4a180,
-    0xe4a181,
-    0xe4a182,
-    0xe4a183,
-    0xe4a184,
-    0xe4a185,
-    0xe4a186,
-    0xe4a187,
-    0xe4a188,
-    0xe4a189,
-    0xe4a18a,
-    0xe4a18b,
-    0xe4a18c,
-    0xe4a18d,
-    0xe4a18e,
-    0xe4a18f,
-    0xe4a190,
-    0xe4a191,
-    0xe4a192,
-    0xe4a193,
-    0xe4a194,
-    0xe4a195,
-    0xe4a196,
-    0xe4a197,
-    0xe4a198,
-    0xe4a199,
-    0xe4a19a,
-    0xe4a19b,
-    0xe4a19c,
-    0xe4a19d,
-    0xe4a19e,
-    0xe4a19f,
-    0xe4a1a0,
-    0xe4a1a1,
-    0xe4a1a2,
-    0xe4a1a3,
-    0xe4a1a4,
-    0xe4a1a5,
-    0xe4a1a6,
-    0xe4a1a7,
-    0xe4a1a8,
-    0xe4a1a9,
-    0xe4a1aa,
-    0xe4a1ab,
-    0xe4a1ac,
-    0xe4a1ad,
-    0xe4a1ae,
-    0xe4a1af,
-    0xe4a1b0,
-    0xe4a1b1,
-    0xe4a1b2,
-    0xe4a1b3,
-    0xe4a1b4,
-    0xe4a1b5,
-    0xe4a1b6,
-    0xe4a1b7,
-    0xe4a1b8,
-    0xe4a1b9,
-    0xe4a1ba,
-    0xe4a1bb,
-    0xe4a1bc,
-    0xe4a1bd,
-    0xe4a1be,
-    0xe4a1bf,
-    0xe4a280,
-    0xe4a281,
-    0xe4a282,
-    0xe4a283,
-    0xe4a284,
-    0xe4a285,
-    0xe4a286,
-    0xe4a287,
-    0xe4a288,
-    0xe4a289,
-    0xe4a28a,
-    0xe4a28b,
-    0xe4a28c,
-    0xe4a28d,
-    0xe4a28e,
-    0xe4a28f,
-    0xe4a290,
-    0xe4a291,
-    0xe4a292,
-    0xe4a293,
-    0xe4a294,
-    0xe4a295,
-    0xe4a296,
-    0xe4a297,
-    0xe4a298,
-    0xe4a299,
-    0xe4a29a,
-    0xe4a29b,
-    0xe4a29c,
-    0xe4a29d,
-    0xe4a29e,
-    0xe4a29f,
-    0xe4a2a0,
-    0xe4a2a1,
-    0xe4a2a2,
-    0xe4a2a3,
-    0xe4a2a4,
-    0xe4a2a5,
-    0xe4a2a6,
-    0xe4a2a7,
-    0xe4a2a8,
-    0xe4a2a9,
-    0xe4a2aa,
-    0xe4a2ab,
-    0xe4a2ac,
-    0xe4a2ad,
-    0xe4a2ae,
-    0xe4a2af,
-    0xe4a2b0,
-    0xe4a2b1,
-    0xe4a2b2,
-    0xe4a2b3,
-    0xe4a2b4,
-    0xe4a2b5,
-    0xe4a2b6,
-    0xe4a2b7,
-    0xe4a2b8,
-    0xe4a2b9,
-    0xe4a2ba,
-    0xe4a2bb,
-    0xe4a2bc,
-    0xe4a2bd,
-    0xe4a2be,
-    0xe4a2bf,
-    0xe4a380,
-    0xe4a381,
-    0xe4a382,
-    0xe4a383,
-    0xe4a384,
-    0xe4a385,
-    0xe4a386,
-    0xe4a387,
-    0xe4a388,
-    0xe4a389,
-    0xe4a38a,
-    0xe4a38b,
-    0xe4a38c,
-    0xe4a38d,
-    0xe4a38e,
-    0xe4a38f,
-    0xe4a390,
-    0xe4a391,
-    0xe4a392,
-    0xe4a393,
-    0xe4a394,
-    0xe4a395,
-    0xe4a396,
-    0xe4a397,
-    0xe4a398,
-    0xe4a399,
-    0xe4a39a,
-    0xe4a39b,
-    0xe4a39c,
-    0xe4a39d,
-    0xe4a39e,
-    0xe4a39f,
-    0xe4a3a0,
-    0xe4a3a1,
-    0xe4a3a2,
-    0xe4a3a3,
-    0xe4a3a4,
-    0xe4a3a5,
-    0xe4a3a6,
-    0xe4a3a7,
-    0xe4a3a8,
-    0xe4a3a9,
-    0xe4a3aa,
-    0xe4a3ab,
-    0xe4a3ac,
-    0xe4a3ad,
-    0xe4a3ae,
-    0xe4a3af,
-    0xe4a3b0,
-    0xe4a3b1,
-    0xe4a3b2,
-    0xe4a3b3,
-    0xe4a3b4,
-    0xe4a3b5,
-    0xe4a3b6,
-    0xe4a3b7,
-    0xe4a3b8,
-    0xe4a3b9,
-    0xe4a3ba,
-    0xe4a3bb,
-    0xe4a3bc,
-    0xe4a3bd,
-    0xe4a3be,
-    0xe4a3bf,
-    0xe4a480,
-    0xe4a481,
-    0xe4a482,
-    0xe4a483,
-    0xe4a484,
-    0xe4a485,
-    0xe4a486,
-    0xe4a487,
-    0xe4a488,
-    0xe4a489,
-    0xe4a48a,
-    0xe4a48b,
-    0xe4a48c,
-    0xe4a48d,
-    0xe4a48e,
-    0xe4a48f,
-    0xe4a490,
-    0xe4a491,
-    0xe4a492,
-    0xe4a493,
-    0xe4a494,
-    0xe4a495,
-    0xe4a496,
-    0xe4a497,
-    0xe4a498,
-    0xe4a499,
-    0xe4a49a,
-    0xe4a49b,
-    0xe4a49c,
-    0xe4a49d,
-    0xe4a49e,
-    0xe4a49f,
-    0xe4a4a0,
-    0xe4a4a1,
-    0xe4a4a2,
-    0xe4a4a3,
-    0xe4a4a4,
-    0xe4a4a5,
-    0xe4a4a6,
-    0xe4a4a7,
-    0xe4a4a8,
-    0xe4a4a9,
-    0xe4a4aa,
-    0xe4a4ab,
-    0xe4a4ac,
-    0xe4a4ad,
-    0xe4a4ae,
-    0xe4a4af,
-    0xe4a4b0,
-    0xe4a4b1,
-    0xe4a4b2,
-    0xe4a4b3,
-    0xe4a4b4,
-    0xe4a4b5,
-    0xe4a4b6,
-    0xe4a4b7,
-    0xe4a4b8,
-    0xe4a4b9,
-    0xe4a4ba,
-    0xe4a4bb,
-    0xe4a4bc,
-    0xe4a4bd,
-    0xe4a4be,
-    0xe4a4bf,
-    0xe4a580,
-    0xe4a581,
-    0xe4a582,
-    0xe4a583,
-    0xe4a584,
-    0xe4a585,
-    0xe4a586,
-    0xe4a587,
-    0xe4a588,
-    0xe4a589,
-    0xe4a58a,
-    0xe4a58b,
-    0xe4a58c,
-    0xe4a58d,
-    0xe4a58e,
-    0xe4a58f,
-    0xe4a590,
-    0xe4a591,
-    0xe4a592,
-    0xe4a593,
-    0xe4a594,
-    0xe4a595,
-    0xe4a596,
-    0xe4a597,
-    0xe4a598,
-    0xe4a599,
-    0xe4a59a,
-    0xe4a59b,
-    0xe4a59c,
-    0xe4a59d,
-    0xe4a59e,
-    0xe4a59f,
-    0xe4a5a0,
-    0xe4a5a1,
-    0xe4a5a2,
-    0xe4a5a3,
-    0xe4a5a4,
-    0xe4a5a5,
-    0xe4a5a6,
-    0xe4a5a7,
-    0xe4a5a8,
-    0xe4a5a9,
-    0xe4a5aa,
-    0xe4a5ab,
-    0xe4a5ac,
-    0xe4a5ad,
-    0xe4a5ae,
-    0xe4a5af,
-    0xe4a5b0,
-    0xe4a5b1,
-    0xe4a5b2,
-    0xe4a5b3,
-    0xe4a5b4,
-    0xe4a5b5,
-    0xe4a5b6,
-    0xe4a5b7,
-    0xe4a5b8,
-    0xe4a5b9,
-    0xe4a5ba,
-    0xe4a5bb,
-    0xe4a5bc,
-    0xe4a5bd,
-    0xe4a5be,
-    0xe4a5bf,
-    0xe4a680,
-    0xe4a681,
-    0xe4a682,
-    0xe4a683,
-    0xe4a684,
-    0xe4a685,
-    0xe4a686,
-    0xe4a687,
-    0xe4a688,
-    0xe4a689,
-    0xe4a68a,
-    0xe4a68b,
-    0xe4a68c,
-    0xe4a68d,
-    0xe4a68e,
-    0xe4a68f,
-    0xe4a690,
-    0xe4a691,
-    0xe4a692,
-    0xe4a693,
-    0xe4a694,
-    0xe4a695,
-    0xe4a696,
-    0xe4a697,
-    0xe4a698,
-    0xe4a699,
-    0xe4a69a,
-    0xe4a69b,
-    0xe4a69c,
-    0xe4a69d,
-    0xe4a69e,
-    0xe4a69f,
-    0xe4a6a0,
-    0xe4a6a1,
-    0xe4a6a2,
-    0xe4a6a3,
-    0xe4a6a4,
-    0xe4a6a5,
-    0xe4a6a6,
-    0xe4a6a7,
-    0xe4a6a8,
-    0xe4a6a9,
-    0xe4a6aa,
-    0xe4a6ab,
-    0xe4a6ac,
-    0xe4a6ad,
-    0xe4a6ae,
-    0xe4a6af,
-    0xe4a6b0,
-    0xe4a6b1,
-    0xe4a6b2,
-    0xe4a6b3,
-    0xe4a6b4,
-    0xe4a6b5,
-    0xe4a6b6,
-    0xe4a6b7,
-    0xe4a6b8,
-    0xe4a6b9,
-    0xe4a6ba,
-    0xe4a6bb,
-    0xe4a6bc,
-    0xe4a6bd,
-    0xe4a6be,
-    0xe4a6bf,
-    0xe4a780,
-    0xe4a781,
-    0xe4a782,
-    0xe4a783,
-    0xe4a784,
-    0xe4a785,
-    0xe4a786,
-    0xe4a787,
-    0xe4a788,
-    0xe4a789,
-    0xe4a78a,
-    0xe4a78b,
-    0xe4a78c,
-    0xe4a78d,
-    0xe4a78e,
-    0xe4a78f,
-    0xe4a790,
-    0xe4a791,
-    0xe4a792,
-    0xe4a793,
-    0xe4a794,
-    0xe4a795,
-    0xe4a796,
-    0xe4a797,
-    0xe4a798,
-    0xe4a799,
-    0xe4a79a,
-    0xe4a79b,
-    0xe4a79c,
-    0xe4a79d,
-    0xe4a79e,
-    0xe4a79f,
-    0xe4a7a0,
-    0xe4a7a1,
-    0xe4a7a2,
-    0xe4a7a3,
-    0xe4a7a4,
-    0xe4a7a5,
-    0xe4a7a6,
-    0xe4a7a7,
-    0xe4a7a8,
-    0xe4a7a9,
-    0xe4a7aa,
-    0xe4a7ab,
-    0xe4a7ac,
-    0xe4a7ad,
-    0xe4a7ae,
-    0xe4a7af,
-    0xe4a7b0,
-    0xe4a7b1,
-    0xe4a7b2,
-    0xe4a7b3,
-    0xe4a7b4,
-    0xe4a7b5,
-    0xe4a7b6,
-    0xe4a7b7,
-    0xe4a7b8,
-    0xe4a7b9,
-    0xe4a7ba,
-    0xe4a7bb,
-    0xe4a7bc,
-    0xe4a7bd,
-    0xe4a7be,
-    0xe4a7bf,
-    0xe4a880,
-    0xe4a881,
-    0xe4a882,
-    0xe4a883,
-    0xe4a884,
-    0xe4a885,
-    0xe4a886,
-    0xe4a887,
-    0xe4a888,
-    0xe4a889,
-    0xe4a88a,
-    0xe4a88b,
-    0xe4a88c,
-    0xe4a88d,
-    0xe4a88e,
-    0xe4a88f,
-    0xe4a890,
-    0xe4a891,
-    0xe4a892,
-    0xe4a893,
-    0xe4a894,
-    0xe4a895,
-    0xe4a896,
-    0xe4a897,
-    0xe4a898,
-    0xe4a899,
-    0xe4a89a,
-    0xe4a89b,
-    0xe4a89c,
-    0xe4a89d,
-    0xe4a89e,
-    0xe4a89f,
-    0xe4a8a0,
-    0xe4a8a1,
-    0xe4a8a2,
-    0xe4a8a3,
-    0xe4a8a4,
-    0xe4a8a5,
-    0xe4a8a6,
-    0xe4a8a7,
-    0xe4a8a8,
-    0xe4a8a9,
-    0xe4a8aa,
-    0xe4a8ab,
-    0xe4a8ac,
-    0xe4a8ad,
-    0xe4a8ae,
-    0xe4a8af,
-    0xe4a8b0,
-    0xe4a8b1,
-    0xe4a8b2,
-    0xe4a8b3,
-    0xe4a8b4,
-    0xe4a8b5,
-    0xe4a8b6,
-    0xe4a8b7,
-    0xe4a8b8,
-    0xe4a8b9,
-    0xe4a8ba,
-    0xe4a8bb,
-    0xe4a8bc,
-    0xe4a8bd,
-    0xe4a8be,
-    0xe4a8bf,
-    0xe4a980,
-    0xe4a981,
-    0xe4a982,
-    0xe4a983,
-    0xe4a984,
-    0xe4a985,
-    0xe4a986,
-    0xe4a987,
-    0xe4a988,
-    0xe4a989,
-    0xe4a98a,
-    0xe4a98b,
-    0xe4a98c,
-    0xe4a98d,
-    0xe4a98e,
-    0xe4a98f,
-    0xe4a990,
-    0xe4a991,
-    0xe4a992,
-    0xe4a993,
-    0xe4a994,
-    0xe4a995,
-    0xe4a996,
-    0xe4a997,
-    0xe4a998,
-    0xe4a999,
-    0xe4a99a,
-    0xe4a99b,
-    0xe4a99c,
-    0xe4a99d,
-    0xe4a99e,
-    0xe4a99f,
-    0xe4a9a0,
-    0xe4a9a1,
-    0xe4a9a2,
-    0xe4a9a3,
-    0xe4a9a4,
-    0xe4a9a5,
-    0xe4a9a6,
-    0xe4a9a7,
-    0xe4a9a8,
-    0xe4a9a9,
-    0xe4a9aa,
-    0xe4a9ab,
-    0xe4a9ac,
-    0xe4a9ad,
-    0xe4a9ae,
-    0xe4a9af,
-    0xe4a9b0,
-    0xe4a9b1,
-    0xe4a9b2,
-    0xe4a9b3,
-    0xe4a9b4,
-    0xe4a9b5,
-    0xe4a9b6,
-    0xe4a9b7,
-    0xe4a9b8,
-    0xe4a9b9,
-    0xe4a9ba,
-    0xe4a9bb,
-    0xe4a9bc,
-    0xe4a9bd,
-    0xe4a9be,
-    0xe4a9bf,
-    0xe4aa80,
-    0xe4aa81,
-    0xe4aa82,
-    0xe4aa83,
-    0xe4aa84,
-    0xe4aa85,
-    0xe4aa86,
-    0xe4aa87,
-    0xe4aa88,
-    0xe4aa89,
-    0xe4aa8a,
-    0xe4aa8b,
-    0xe4aa8c,
-    0xe4aa8d,
-    0xe4aa8e,
-    0xe4aa8f,
-    0xe4aa90,
-    0xe4aa91,
-    0xe4aa92,
-    0xe4aa93,
-    0xe4aa94,
-    0xe4aa95,
-    0xe4aa96,
-    0xe4aa97,
-    0xe4aa98,
-    0xe4aa99,
-    0xe4aa9a,
-    0xe4aa9b,
-    0xe4aa9c,
-    0xe4aa9d,
-    0xe4aa9e,
-    0xe4aa9f,
-    0xe4aaa0,
-    0xe4aaa1,
-    0xe4aaa2,
-    0xe4aaa3,
-    0xe4aaa4,
-    0xe4aaa5,
-    0xe4aaa6,
-    0xe4aaa7,
-    0xe4aaa8,
-    0xe4aaa9,
-    0xe4aaaa,
-    0xe4aaab,
-    0xe4aaac,
-    0xe4aaad,
-    0xe4aaae,
-    0xe4aaaf,
-    0xe4aab0,
-    0xe4aab1,
-    0xe4aab2,
-    0xe4aab3,
-    0xe4aab4,
-    0xe4aab5,
-    0xe4aab6,
-    0xe4aab7,
-    0xe4aab8,
-    0xe4aab9,
-    0xe4aaba,
-    0xe4aabb,
-    0xe4aabc,
-    0xe4aabd,
-    0xe4aabe,
-    0xe4aabf,
-    0xe4ab80,
-    0xe4ab81,
-    0xe4ab82,
-    0xe4ab83,
-    0xe4ab84,
-    0xe4ab85,
-    0xe4ab86,
-    0xe4ab87,
-    0xe4ab88,
-    0xe4ab89,
-    0xe4ab8a,
-    0xe4ab8b,
-    0xe4ab8c,
-    0xe4ab8d,
-    0xe4ab8e,
-    0xe4ab8f,
-    0xe4ab90,
-    0xe4ab91,
-    0xe4ab92,
-    0xe4ab93,
-    0xe4ab94,
-    0xe4ab95,
-    0xe4ab96,
-    0xe4ab97,
-    0xe4ab98,
-    0xe4ab99,
-    0xe4ab9a,
-    0xe4ab9b,
-    0xe4ab9c,
-    0xe4ab9d,
-    0xe4ab9e,
-    0xe4ab9f,
-    0xe4aba0,
-    0xe4aba1,
-    0xe4aba2,
-    0xe4aba3,
-    0xe4aba4,
-    0xe4aba5,
-    0xe4aba6,
-    0xe4aba7,
-    0xe4aba8,
-    0xe4aba9,
-    0xe4abaa,
-    0xe4abab,
-    0xe4abac,
-    0xe4abad,
-    0xe4abae,
-    0xe4abaf,
-    0xe4abb0,
-    0xe4abb1,
-    0xe4abb2,
-    0xe4abb3,
-    0xe4abb4,
-    0xe4abb5,
-    0xe4abb6,
-    0xe4abb7,
-    0xe4abb8,
-    0xe4abb9,
-    0xe4abba,
-    0xe4abbb,
-    0xe4abbc,
-    0xe4abbd,
-    0xe4abbe,
-    0xe4abbf,
-    0xe4ac80,
-    0xe4ac81,
-    0xe4ac82,
-    0xe4ac83,
-    0xe4ac84,
-    0xe4ac85,
-    0xe4ac86,
-    0xe4ac87,
-    0xe4ac88,
-    0xe4ac89,
-    0xe4ac8a,
-    0xe4ac8b,
-    0xe4ac8c,
-    0xe4ac8d,
-    0xe4ac8e,
-    0xe4ac8f,
-    0xe4ac90,
-    0xe4ac91,
-    0xe4ac92,
-    0xe4ac93,
-    0xe4ac94,
-    0xe4ac95,
-    0xe4ac96,
-    0xe4ac97,
-    0xe4ac98,
-    0xe4ac99,
-    0xe4ac9a,
-    0xe4ac9b,
-    0xe4ac9c,
-    0xe4ac9d,
-    0xe4ac9e,
-    0xe4ac9f,
-    0xe4aca0,
-    0xe4aca1,
-    0xe4aca2,
-    0xe4aca3,
-    0xe4aca4,
-    0xe4aca5,
-    0xe4aca6,
-    0xe4aca7,
-    0xe4aca8,
-    0xe4aca9,
-    0xe4acaa,
-    0xe4acab,
-    0xe4acac,
-    0xe4acad,
-    0xe4acae,
-    0xe4acaf,
-    0xe4acb0,
-    0xe4acb1,
-    0xe4acb2,
-    0xe4acb3,
-    0xe4acb4,
-    0xe4acb5,
-    0xe4acb6,
-    0xe4acb7,
-    0xe4acb8,
-    0xe4acb9,
-    0xe4acba,
-    0xe4acbb,
-    0xe4acbc,
-    0xe4acbd,
-    0xe4acbe,
-    0xe4acbf,
-    0xe4ad80,
-    0xe4ad81,
-    0xe4ad82,
-    0xe4ad83,
-    0xe4ad84,
-    0xe4ad85,
-    0xe4ad86,
-    0xe4ad87,
-    0xe4ad88,
-    0xe4ad89,
-    0xe4ad8a,
-    0xe4ad8b,
-    0xe4ad8c,
-    0xe4ad8d,
-    0xe4ad8e,
-    0xe4ad8f,
-    0xe4ad90,
-    0xe4ad91,
-    0xe4ad92,
-    0xe4ad93,
-    0xe4ad94,
-    0xe4ad95,
-    0xe4ad96,
-    0xe4ad97,
-    0xe4ad98,
-    0xe4ad99,
-    0xe4ad9a,
-    0xe4ad9b,
-    0xe4ad9c,
-    0xe4ad9d,
-    0xe4ad9e,
-    0xe4ad9f,
-    0xe4ada0,
-    0xe4ada1,
-    0xe4ada2,
-    0xe4ada3,
-    0xe4ada4,
-    0xe4ada5,
-    0xe4ada6,
-    0xe4ada7,
-    0xe4ada8,
-    0xe4ada9,
-    0xe4adaa,
-    0xe4adab,
-    0xe4adac,
-    0xe4adad,
-    0xe4adae,
-    0xe4adaf,
-    0xe4adb0,
-    0xe4adb1,
-    0xe4adb2,
-    0xe4adb3,
-    0xe4adb4,
-    0xe4adb5,
-    0xe4adb6,
-    0xe4adb7,
-    0xe4adb8,
-    0xe4adb9,
-    0xe4adba,
-    0xe4adbb,
-    0xe4adbc,
-    0xe4adbd,
-    0xe4adbe,
-    0xe4adbf,
-    0xe4ae80,
-    0xe4ae81,
-    0xe4ae82,
-    0xe4ae83,
-    0xe4ae84,
-    0xe4ae85,
-    0xe4ae86,
-    0xe4ae87,
-    0xe4ae88,
-    0xe4ae89,
-    0xe4ae8a,
-    0xe4ae8b,
-    0xe4ae8c,
-    0xe4ae8d,
-    0xe4ae8e,
-    0xe4ae8f,
-    0xe4ae90,
-    0xe4ae91,
-    0xe4ae92,
-    0xe4ae93,
-    0xe4ae94,
-    0xe4ae95,
-    0xe4ae96,
-    0xe4ae97,
-    0xe4ae98,
-    0xe4ae99,
-    0xe4ae9a,
-    0xe4ae9b,
-    0xe4ae9c,
-    0xe4ae9d,
-    0xe4ae9e,
-    0xe4ae9f,
-    0xe4aea0,
-    0xe4aea1,
-    0xe4aea2,
-    0xe4aea3,
-    0xe4aea4,
-    0xe4aea5,
-    0xe4aea6,
-    0xe4aea7,
-    0xe4aea8,
-    0xe4aea9,
-    0xe4aeaa,
-    0xe4aeab,
-    0xe4aeac,
-    0xe4aead,
-    0xe4aeae,
-    0xe4aeaf,
-    0xe4aeb0,
-    0xe4aeb1,
-    0xe4aeb2,
-    0xe4aeb3,
-    0xe4aeb4,
-    0xe4aeb5,
-    0xe4aeb6,
-    0xe4aeb7,
-    0xe4aeb8,
-    0xe4aeb9,
-    0xe4aeba,
-    0xe4aebb,
-    0xe4aebc,
-    0xe4aebd,
-    0xe4aebe,
-    0xe4aebf,
-    0xe4af80,
-    0xe4af81,
-    0xe4af82,
-    0xe4af83,
-    0xe4af84,
-    0xe4af85,
-    0xe4af86,
-    0xe4af87,
-    0xe4af88,
-    0xe4af89,
-    0xe4af8a,
-    0xe4af8b,
-    0xe4af8c,
-    0xe4af8d,
-    0xe4af8e,
-    0xe4af8f,
-    0xe4af90,
-    0xe4af91,
-    0xe4af92,
-    0xe4af93,
-    0xe4af94,
-    0xe4af95,
-    0xe4af96,
-    0xe4af97,
-    0xe4af98,
-    0xe4af99,
-    0xe4af9a,
-    0xe4af9b,
-    0xe4af9c,
-    0xe4af9d,
-    0xe4af9e,
-    0xe4af9f,
-    0xe4afa0,
-    0xe4afa1,
-    0xe4afa2,
-    0xe4afa3,
-    0xe4afa4,
-    0xe4afa5,
-    0xe4afa6,
-    0xe4afa7,
-    0xe4afa8,
-    0xe4afa9,
-    0xe4afaa,
-    0xe4afab,
-    0xe4afac,
-    0xe4afad,
-    0xe4afae,
-    0xe4afaf,
-    0xe4afb0,
-    0xe4afb1,
-    0xe4afb2,
-    0xe4afb3,
-    0xe4afb4,
-    0xe4afb5,
-    0xe4afb6,
-    0xe4afb7,
-    0xe4afb8,
-    0xe4afb9,
-    0xe4afba,
-    0xe4afbb,
-    0xe4afbc,
-    0xe4afbd,
-    0xe4afbe,
-    0xe4afbf,
-    0xe4b080,
-    0xe4b081,
-    0xe4b082,
-    0xe4b083,
-    0xe4b084,
-    0xe4b085,
-    0xe4b086,
-    0xe4b087,
-    0xe4b088,
-    0xe4b089,
-    0xe4b08a,
-    0xe4b08b,
-    0xe4b08c,
-    0xe4b08d,
-    0xe4b08e,
-    0xe4b08f,
-    0xe4b090,
-    0xe4b091,
-    0xe4b092,
-    0xe4b093,
-    0xe4b094,
-    0xe4b095,
-    0xe4b096,
-    0xe4b097,
-    0xe4b098,
-    0xe4b099,
-    0xe4b09a,
-    0xe4b09b,
-    0xe4b09c,
-    0xe4b09d,
-    0xe4b09e,
-    0xe4b09f,
-    0xe4b0a0,
-    0xe4b0a1,
-    0xe4b0a2,
-    0xe4b0a3,
-    0xe4b0a4,
-    0xe4b0a5,
-    0xe4b0a6,
-    0xe4b0a7,
-    0xe4b0a8,
-    0xe4b0a9,
-    0xe4b0aa,
-    0xe4b0ab,
-    0xe4b0ac,
-    0xe4b0ad,
-    0xe4b0ae,
-    0xe4b0af,
-    0xe4b0b0,
-    0xe4b0b1,
-    0xe4b0b2,
-    0xe4b0b3,
-    0xe4b0b4,
-    0xe4b0b5,
-    0xe4b0b6,
-    0xe4b0b7,
-    0xe4b0b8,
-    0xe4b0b9,
-    0xe4b0ba,
-    0xe4b0bb,
-    0xe4b0bc,
-    0xe4b0bd,
-    0xe4b0be,
-    0xe4b0bf,
-    0xe4b180,
-    0xe4b181,
-    0xe4b182,
-    0xe4b183,
-    0xe4b184,
-    0xe4b185,
-    0xe4b186,
-    0xe4b187,
-    0xe4b188,
-    0xe4b189,
-    0xe4b18a,
-    0xe4b18b,
-    0xe4b18c,
-    0xe4b18d,
-    0xe4b18e,
-    0xe4b18f,
-    0xe4b190,
-    0xe4b191,
-    0xe4b192,
-    0xe4b193,
-    0xe4b194,
-    0xe4b195,
-    0xe4b196,
-    0xe4b197,
-    0xe4b198,
-    0xe4b199,
-    0xe4b19a,
-    0xe4b19b,
-    0xe4b19c,
-    0xe4b19d,
-    0xe4b19e,
-    0xe4b19f,
-    0xe4b1a0,
-    0xe4b1a1,
-    0xe4b1a2,
-    0xe4b1a3,
-    0xe4b1a4,
-    0xe4b1a5,
-    0xe4b1a6,
-    0xe4b1a7,
-    0xe4b1a8,
-    0xe4b1a9,
-    0xe4b1aa,
-    0xe4b1ab,
-    0xe4b1ac,
-    0xe4b1ad,
-    0xe4b1ae,
-    0xe4b1af,
-    0xe4b1b0,
-    0xe4b1b1,
-    0xe4b1b2,
-    0xe4b1b3,
-    0xe4b1b4,
-    0xe4b1b5,
-    0xe4b1b6,
-    0xe4b1b7,
-    0xe4b1b8,
-    0xe4b1b9,
-    0xe4b1ba,
-    0xe4b1bb,
-    0xe4b1bc,
-    0xe4b1bd,
-    0xe4b1be,
-    0xe4b1bf,
-    0xe4b280,
-    0xe4b281,
-    0xe4b282,
-    0xe4b283,
-    0xe4b284,
-    0xe4b285,
-    0xe4b286,
-    0xe4b287,
-    0xe4b288,
-    0xe4b289,
-    0xe4b28a,
-    0xe4b28b,
-    0xe4b28c,
-    0xe4b28d,
-    0xe4b28e,
-    0xe4b28f,
-    0xe4b290,
-    0xe4b291,
-    0xe4b292,
-    0xe4b293,
-    0xe4b294,
-    0xe4b295,
-    0xe4b296,
-    0xe4b297,
-    0xe4b298,
-    0xe4b299,
-    0xe4b29a,
-    0xe4b29b,
-    0xe4b29c,
-    0xe4b29d,
-    0xe4b29e,
-    0xe4b29f,
-    0xe4b2a0,
-    0xe4b2a1,
-    0xe4b2a2,
-    0xe4b2a3,
-    0xe4b2a4,
-    0xe4b2a5,
-    0xe4b2a6,
-    0xe4b2a7,
-    0xe4b2a8,
-    0xe4b2a9,
-    0xe4b2aa,
-    0xe4b2ab,
-    0xe4b2ac,
-    0xe4b2ad,
-    0xe4b2ae,
-    0xe4b2af,
-    0xe4b2b0,
-    0xe4b2b1,
-    0xe4b2b2,
-    0xe4b2b3,
-    0xe4b2b4,
-    0xe4b2b5,
-    0xe4b2b6,
-    0xe4b2b7,
-    0xe4b2b8,
-    0xe4b2b9,
-    0xe4b2ba,
-    0xe4b2bb,
-    0xe4b2bc,
-    0xe4b2bd,
-    0xe4b2be,
-    0xe4b2bf,
-    0xe4b380,
-    0xe4b381,
-    0xe4b382,
-    0xe4b383,
-    0xe4b384,
-    0xe4b385,
-    0xe4b386,
-    0xe4b387,
-    0xe4b388,
-    0xe4b389,
-    0xe4b38a,
-    0xe4b38b,
-    0xe4b38c,
-    0xe4b38d,
-    0xe4b38e,
-    0xe4b38f,
-    0xe4b390,
-    0xe4b391,
-    0xe4b392,
-    0xe4b393,
-    0xe4b394,
-    0xe4b395,
-    0xe4b396,
-    0xe4b397,
-    0xe4b398,
-    0xe4b399,
-    0xe4b39a,
-    0xe4b39b,
-    0xe4b39c,
-    0xe4b39d,
-    0xe4b39e,
-    0xe4b39f,
-    0xe4b3a0,
-    0xe4b3a1,
-    0xe4b3a2,
-    0xe4b3a3,
-    0xe4b3a4,
-    0xe4b3a5,
-    0xe4b3a6,
-    0xe4b3a7,
-    0xe4b3a8,
-    0xe4b3a9,
-    0xe4b3aa,
-    0xe4b3ab,
-    0xe4b3ac,
-    0xe4b3ad,
-    0xe4b3ae,
-    0xe4b3af,
-    0xe4b3b0,
-    0xe4b3b1,
-    0xe4b3b2,
-    0xe4b3b3,
-    0xe4b3b4,
-    0xe4b3b5,
-    0xe4b3b6,
-    0xe4b3b7,
-    0xe4b3b8,
-    0xe4b3b9,
-    0xe4b3ba,
-    0xe4b3bb,
-    0xe4b3bc,
-    0xe4b3bd,
-    0xe4b3be,
-    0xe4b3bf,
-    0xe4b480,
-    0xe4b481,
-    0xe4b482,
-    0xe4b483,
-    0xe4b484,
-    0xe4b485,
-    0xe4b486,
-    0xe4b487,
-    0xe4b488,
-    0xe4b489,
-    0xe4b48a,
-    0xe4b48b,
-    0xe4b48c,
-    0xe4b48d,
-    0xe4b48e,
-    0xe4b48f,
-    0xe4b490,
-    0xe4b491,
-    0xe4b492,
-    0xe4b493,
-    0xe4b494,
-    0xe4b495,
-    0xe4b496,
-    0xe4b497,
-    0xe4b498,
-    0xe4b499,
-    0xe4b49a,
-    0xe4b49b,
-    0xe4b49c,
-    0xe4b49d,
-    0xe4b49e,
-    0xe4b49f,
-    0xe4b4a0,
-    0xe4b4a1,
-    0xe4b4a2,
-    0xe4b4a3,
-    0xe4b4a4,
-    0xe4b4a5,
-    0xe4b4a6,
-    0xe4b4a7,
-    0xe4b4a8,
-    0xe4b4a9,
-    0xe4b4aa,
-    0xe4b4ab,
-    0xe4b4ac,
-    0xe4b4ad,
-    0xe4b4ae,
-    0xe4b4af,
-    0xe4b4b0,
-    0xe4b4b1,
-    0xe4b4b2,
-    0xe4b4b3,
-    0xe4b4b4,
-    0xe4b4b5,
-    0xe4b4b6,
-    0xe4b4b7,
-    0xe4b4b8,
-    0xe4b4b9,
-    0xe4b4ba,
-    0xe4b4bb,
-    0xe4b4bc,
-    0xe4b4bd,
-    0xe4b4be,
-    0xe4b4bf,
-    0xe4b580,
-    0xe4b581,
-    0xe4b582,
-    0xe4b583,
-    0xe4b584,
-    0xe4b585,
-    0xe4b586,
-    0xe4b587,
-    0xe4b588,
-    0xe4b589,
-    0xe4b58a,
-    0xe4b58b,
-    0xe4b58c,
-    0xe4b58d,
-    0xe4b58e,
-    0xe4b58f,
-    0xe4b590,
-    0xe4b591,
-    0xe4b592,
-    0xe4b593,
-    0xe4b594,
-    0xe4b595,
-    0xe4b596,
-    0xe4b597,
-    0xe4b598,
-    0xe4b599,
-    0xe4b59a,
-    0xe4b59b,
-    0xe4b59c,
-    0xe4b59d,
-    0xe4b59e,
-    0xe4b59f,
-    0xe4b5a0,
-    0xe4b5a1,
-    0xe4b5a2,
-    0xe4b5a3,
-    0xe4b5a4,
-    0xe4b5a5,
-    0xe4b5a6,
-    0xe4b5a7,
-    0xe4b5a8,
-    0xe4b5a9,
-    0xe4b5aa,
-    0xe4b5ab,
-    0xe4b5ac,
-    0xe4b5ad,
-    0xe4b5ae,
-    0xe4b5af,
-    0xe4b5b0,
-    0xe4b5b1,
-    0xe4b5b2,
-    0xe4b5b3,
-    0xe4b5b4,
-    0xe4b5b5,
-    0xe4b5b6,
-    0xe4b5b7,
-    0xe4b5b8,
-    0xe4b5b9,
-    0xe4b5ba,
-    0xe4b5bb,
-    0xe4b5bc,
-    0xe4b5bd,
-    0xe4b5be,
-    0xe4b5bf,
-    0xe4b680,
-    0xe4b681,
-    0xe4b682,
-    0xe4b683,
-    0xe4b684,
-    0xe4b685,
-    0xe4b686,
-    0xe4b687,
-    0xe4b688,
-    0xe4b689,
-    0xe4b68a,
-    0xe4b68b,
-    0xe4b68c,
-    0xe4b68d,
-    0xe4b68e,
-    0xe4b68f,
-    0xe4b690,
-    0xe4b691,
-    0xe4b692,
-    0xe4b693,
-    0xe4b694,
-    0xe4b695,
-    0xe4b696,
-    0xe4b697,
-    0xe4b698,
-    0xe4b699,
-    0xe4b69a,
-    0xe4b69b,
-    0xe4b69c,
-    0xe4b69d,
-    0xe4b69e,
-    0xe4b69f,
-    0xe4b6a0,
-    0xe4b6a1,
-    0xe4b6a2,
-    0xe4b6a3,
-    0xe4b6a4,
-    0xe4b6a5,
-    0xe4b6a6,
-    0xe4b6a7,
-    0xe4b6a8,
-    0xe4b6a9,
-    0xe4b6aa,
-    0xe4b6ab,
-    0xe4b6ac,
-    0xe4b6ad,
-    0xe4b6ae,
-    0xe4b6af,
-    0xe4b6b0,
-    0xe4b6b1,
-    0xe4b6b2,
-    0xe4b6b3,
-    0xe4b6b4,
-    0xe4b6b5,
-    0xe4b6b6,
-    0xe4b6b7,
-    0xe4b6b8,
-    0xe4b6b9,
-    0xe4b6ba,
-    0xe4b6bb,
-    0xe4b6bc,
-    0xe4b6bd,
-    0xe4b6be,
-    0xe4b6bf,
-    0xe4b780,
-    0xe4b781,
-    0xe4b782,
-    0xe4b783,
-    0xe4b784,
-    0xe4b785,
-    0xe4b786,
-    0xe4b787,
-    0xe4b788,
-    0xe4b789,
-    0xe4b78a,
-    0xe4b78b,
-    0xe4b78c,
-    0xe4b78d,
-    0xe4b78e,
-    0xe4b78f,
-    0xe4b790,
-    0xe4b791,
-    0xe4b792,
-    0xe4b793,
-    0xe4b794,
-    0xe4b795,
-    0xe4b796,
-    0xe4b797,
-    0xe4b798,
-    0xe4b799,
-    0xe4b79a,
-    0xe4b79b,
-    0xe4b79c,
-    0xe4b79d,
-    0xe4b79e,
-    0xe4b79f,
-    0xe4b7a0,
-    0xe4b7a1,
-    0xe4b7a2,
-    0xe4b7a3,
-    0xe4b7a4,
-    0xe4b7a5,
-    0xe4b7a6,
-    0xe4b7a7,
-    0xe4b7a8,
-    0xe4b7a9,
-    0xe4b7aa,
-    0xe4b7ab,
-    0xe4b7ac,
-    0xe4b7ad,
-    0xe4b7ae,
-    0xe4b7af,
-    0xe4b7b0,
-    0xe4b7b1,
-    0xe4b7b2,
-    0xe4b7b3,
-    0xe4b7b4,
-    0xe4b7b5,
-    0xe4b7b6,
-    0xe4b7b7,
-    0xe4b7b8,
-    0xe4b7b9,
-    0xe4b7ba,
-    0xe4b7bb,
-    0xe4b7bc,
-    0xe4b7bd,
-    0xe4b7be,
-    0xe4b7bf,
-    0xe4b880,
-    0xe4b881,
-    0xe4b882,
-    0xe4b883,
-    0xe4b884,
-    0xe4b885,
-    0xe4b886,
-    0xe4b887,
-    0xe4b888,
-    0xe4b889,
-    0xe4b88a,
-    0xe4b88b,
-    0xe4b88c,
-    0xe4b88d,
-    0xe4b88e,
-    0xe4b88f,
-    0xe4b890,
-    0xe4b891,
-    0xe4b892,
-    0xe4b893,
-    0xe4b894,
-    0xe4b895,
-    0xe4b896,
-    0xe4b897,
-    0xe4b898,
-    0xe4b899,
-    0xe4b89a,
-    0xe4b89b,
-    0xe4b89c,
-    0xe4b89d,
-    0xe4b89e,
-    0xe4b89f,
-    0xe4b8a0,
-    0xe4b8a1,
-    0xe4b8a2,
-    0xe4b8a3,
-    0xe4b8a4,
-    0xe4b8a5,
-    0xe4b8a6,
-    0xe4b8a7,
-    0xe4b8a8,
-    0xe4b8a9,
-    0xe4b8aa,
-    0xe4b8ab,
-    0xe4b8ac,
-    0xe4b8ad,
-    0xe4b8ae,
-    0xe4b8af,
-    0xe4b8b0,
-    0xe4b8b1,
-    0xe4b8b2,
-    0xe4b8b3,
-    0xe4b8b4,
-    0xe4b8b5,
-    0xe4b8b6,
-    0xe4b8b7,
-    0xe4b8b8,
-    0xe4b8b9,
-    0xe4b8ba,
-    0xe4b8bb,
-    0xe4b8bc,
-    0xe4b8bd,
-    0xe4b8be,
-    0xe4b8bf,
-    0xe4b980,
-    0xe4b981,
-    0xe4b982,
-    0xe4b983,
-    0xe4b984,
-    0xe4b985,
-    0xe4b986,
-    0xe4b987,
-    0xe4b988,
-    0xe4b989,
-    0xe4b98a,
-    0xe4b98b,
-    0xe4b98c,
-    0xe4b98d,
-    0xe4b98e,
-    0xe4b98f,
-    0xe4b990,
-    0xe4b991,
-    0xe4b992,
-    0xe4b993,
-    0xe4b994,
-    0xe4b995,
-    0xe4b996,
-    0xe4b997,
-    0xe4b998,
-    0xe4b999,
-    0xe4b99a,
-    0xe4b99b,
-    0xe4b99c,
-    0xe4b99d,
-    0xe4b99e,
-    0xe4b99f,
-    0xe4b9a0,
-    0xe4b9a1,
-    0xe4b9a2,
-    0xe4b9a3,
-    0xe4b9a4,
-    0xe4b9a5,
-    0xe4b9a6,
-    0xe4b9a7,
-    0xe4b9a8,
-    0xe4b9a9,
-    0xe4b9aa,
-    0xe4b9ab,
-    0xe4b9ac,
-    0xe4b9ad,
-    0xe4b9ae,
-    0xe4b9af,
-    0xe4b9b0,
-    0xe4b9b1,
-    0xe4b9b2,
-    0xe4b9b3,
-    0xe4b9b4,
-    0xe4b9b5,
-    0xe4b9b6,
-    0xe4b9b7,
-    0xe4b9b8,
-    0xe4b9b9,
-    0xe4b9ba,
-    0xe4b9bb,
-    0xe4b9bc,
-    0xe4b9bd,
-    0xe4b9be,
-    0xe4b9bf,
-    0xe4ba80,
-    0xe4ba81,
-    0xe4ba82,
-    0xe4ba83,
-    0xe4ba84,
-    0xe4ba85,
-    0xe4ba86,
-    0xe4ba87,
-    0xe4ba88,
-    0xe4ba89,
-    0xe4ba8a,
-    0xe4ba8b,
-    0xe4ba8c,
-    0xe4ba8d,
-    0xe4ba8e,
-    0xe4ba8f,
-    0xe4ba90,
-    0xe4ba91,
-    0xe4ba92,
-    0xe4ba93,
-    0xe4ba94,
-    0xe4ba95,
-    0xe4ba96,
-    0xe4ba97,
-    0xe4ba98,
-    0xe4ba99,
-    0xe4ba9a,
-    0xe4ba9b,
-    0xe4ba9c,
-    0xe4ba9d,
-    0xe4ba9e,
-    0xe4ba9f,
-    0xe4baa0,
-    0xe4baa1,
-    0xe4baa2,
-    0xe4baa3,
-    0xe4baa4,
-    0xe4baa5,
-    0xe4baa6,
-    0xe4baa7,
-    0xe4baa8,
-    0xe4baa9,
-    0xe4baaa,
-    0xe4baab,
-    0xe4baac,
-    0xe4baad,
-    0xe4baae,
-    0xe4baaf,
-    0xe4bab0,
-    0xe4bab1,
-    0xe4bab2,
-    0xe4bab3,
-    0xe4bab4,
-    0xe4bab5,
-    0xe4bab6,
-    0xe4bab7,
-    0xe4bab8,
-    0xe4bab9,
-    0xe4baba,
-    0xe4babb,
-    0xe4babc,
-    0xe4babd,
-    0xe4babe,
-    0xe4babf,
-    0xe4bb80,
-    0xe4bb81,
-    0xe4bb82,
-    0xe4bb83,
-    0xe4bb84,
-    0xe4bb85,
-    0xe4bb86,
-    0xe4bb87,
-    0xe4bb88,
-    0xe4bb89,
-    0xe4bb8a,
-    0xe4bb8b,
-    0xe4bb8c,
-    0xe4bb8d,
-    0xe4bb8e,
-    0xe4bb8f,
-    0xe4bb90,
-    0xe4bb91,
-    0xe4bb92,
-    0xe4bb93,
-    0xe4bb94,
-    0xe4bb95,
-    0xe4bb96,
-    0xe4bb97,
-    0xe4bb98,
-    0xe4bb99,
-    0xe4bb9a,
-    0xe4bb9b,
-    0xe4bb9c,
-    0xe4bb9d,
-    0xe4bb9e,
-    0xe4bb9f,
-    0xe4bba0,
-    0xe4bba1,
-    0xe4bba2,
-    0xe4bba3,
-    0xe4bba4,
-    0xe4bba5,
-    0xe4bba6,
-    0xe4bba7,
-    0xe4bba8,
-    0xe4bba9,
-    0xe4bbaa,
-    0xe4bbab,
-    0xe4bbac,
-    0xe4bbad,
-    0xe4bbae,
-    0xe4bbaf,
-    0xe4bbb0,
-    0xe4bbb1,
-    0xe4bbb2,
-    0xe4bbb3,
-    0xe4bbb4,
-    0xe4bbb5,
-    0xe4bbb6,
-    0xe4bbb7,
-    0xe4bbb8,
-    0xe4bbb9,
-    0xe4bbba,
-    0xe4bbbb,
-    0xe4bbbc,
-    0xe4bbbd,
-    0xe4bbbe,
-    0xe4bbbf,
-    0xe4bc80,
-    0xe4bc81,
-    0xe4bc82,
-    0xe4bc83,
-    0xe4bc84,
-    0xe4bc85,
-    0xe4bc86,
-    0xe4bc87,
-    0xe4bc88,
-    0xe4bc89,
-    0xe4bc8a,
-    0xe4bc8b,
-    0xe4bc8c,
-    0xe4bc8d,
-    0xe4bc8e,
-    0xe4bc8f,
-    0xe4bc90,
-    0xe4bc91,
-    0xe4bc92,
-    0xe4bc93,
-    0xe4bc94,
-    0xe4bc95,
-    0xe4bc96,
-    0xe4bc97,
-    0xe4bc98,
-    0xe4bc99,
-    0xe4bc9a,
-    0xe4bc9b,
-    0xe4bc9c,
-    0xe4bc9d,
-    0xe4bc9e,
-    0xe4bc9f,
-    0xe4bca0,
-    0xe4bca1,
-    0xe4bca2,
-    0xe4bca3,
-    0xe4bca4,
-    0xe4bca5,
-    0xe4bca6,
-    0xe4bca7,
-    0xe4bca8,
-    0xe4bca9,
-    0xe4bcaa,
-    0xe4bcab,
-    0xe4bcac,
-    0xe4bcad,
-    0xe4bcae,
-    0xe4bcaf,
-    0xe4bcb0,
-    0xe4bcb1,
-    0xe4bcb2,
-    0xe4bcb3,
-    0xe4bcb4,
-    0xe4bcb5,
-    0xe4bcb6,
-    0xe4bcb7,
-    0xe4bcb8,
-    0xe4bcb9,
-    0xe4bcba,
-    0xe4bcbb,
-    0xe4bcbc,
-    0xe4bcbd,
-    0xe4bcbe,
-    0xe4bcbf,
-    0xe4bd80,
-    0xe4bd81,
-    0xe4bd82,
-    0xe4bd83,
-    0xe4bd84,
-    0xe4bd85,
-    0xe4bd86,
-    0xe4bd87,
-    0xe4bd88,
-    0xe4bd89,
-    0xe4bd8a,
-    0xe4bd8b,
-    0xe4bd8c,
-    0xe4bd8d,
-    0xe4bd8e,
-    0xe4bd8f,
-    0xe4bd90,
-    0xe4bd91,
-    0xe4bd92,
-    0xe4bd93,
-    0xe4bd94,
-    0xe4bd95,
-    0xe4bd96,
-    0xe4bd97,
-    0xe4bd98,
-    0xe4bd99,
-    0xe4bd9a,
-    0xe4bd9b,
-    0xe4bd9c,
-    0xe4bd9d,
-    0xe4bd9e,
-    0xe4bd9f,
-    0xe4bda0,
-    0xe4bda1,
-    0xe4bda2,
-    0xe4bda3,
-    0xe4bda4,
-    0xe4bda5,
-    0xe4bda6,
-    0xe4bda7,
-    0xe4bda8,
-    0xe4bda9,
-    0xe4bdaa,
-    0xe4bdab,
-    0xe4bdac,
-    0xe4bdad,
-    0xe4bdae,
-    0xe4bdaf,
-    0xe4bdb0,
-    0xe4bdb1,
-    0xe4bdb2,
-    0xe4bdb3,
-    0xe4bdb4,
-    0xe4bdb5,
-    0xe4bdb6,
-    0xe4bdb7,
-    0xe4bdb8,
-    0xe4bdb9,
-    0xe4bdba,
-    0xe4bdbb,
-    0xe4bdbc,
-    0xe4bdbd,
-    0xe4bdbe,
-    0xe4bdbf,
-    0xe4be80,
-    0xe4be81,
-    0xe4be82,
-    0xe4be83,
-    0xe4be84,
-    0xe4be85,
-    0xe4be86,
-    0xe4be87,
-    0xe4be88,
-    0xe4be89,
-    0xe4be8a,
-    0xe4be8b,
-    0xe4be8c,
-    0xe4be8d,
-    0xe4be8e,
-    0xe4be8f,
-    0xe4be90,
-    0xe4be91,
-    0xe4be92,
-    0xe4be93,
-    0xe4be94,
-    0xe4be95,
-    0xe4be96,
-    0xe4be97,
-    0xe4be98,
-    0xe4be99,
-    0xe4be9a,
-    0xe4be9b,
-    0xe4be9c,
-    0xe4be9d,
-    0xe4be9e,
-    0xe4be9f,
-    0xe4bea0,
-    0xe4bea1,
-    0xe4bea2,
-    0xe4bea3,
-    0xe4bea4,
-    0xe4bea5,
-    0xe4bea6,
-    0xe4bea7,
-    0xe4bea8,
-    0xe4bea9,
-    0xe4beaa,
-    0xe4beab,
-    0xe4beac,
-    0xe4bead,
-    0xe4beae,
-    0xe4beaf,
-    0xe4beb0,
-    0xe4beb1,
-    0xe4beb2,
-    0xe4beb3,
-    0xe4beb4,
-    0xe4beb5,
-    0xe4beb6,
-    0xe4beb7,
-    0xe4beb8,
-    0xe4beb9,
-    0xe4beba,
-    0xe4bebb,
-    0xe4bebc,
-    0xe4bebd,
-    0xe4bebe,
-    0xe4bebf,
-    0xe4bf80,
-    0xe4bf81,
-    0xe4bf82,
-    0xe4bf83,
-    0xe4bf84,
-    0xe4bf85,
-    0xe4bf86,
-    0xe4bf87,
-    0xe4bf88,
-    0xe4bf89,
-    0xe4bf8a,
-    0xe4bf8b,
-    0xe4bf8c,
-    0xe4bf8d,
-    0xe4bf8e,
-    0xe4bf8f,
-    0xe4bf90,
-    0xe4bf91,
-    0xe4bf92,
-    0xe4bf93,
-    0xe4bf94,
-    0xe4bf95,
-    0xe4bf96,
-    0xe4bf97,
-    0xe4bf98,
-    0xe4bf99,
-    0xe4bf9a,
-    0xe4bf9b,
-    0xe4bf9c,
-    0xe4bf9d,
-    0xe4bf9e,
-    0xe4bf9f,
-    0xe4bfa0,
-    0xe4bfa1,
-    0xe4bfa2,
-    0xe4bfa3,
-    0xe4bfa4,
-    0xe4bfa5,
-    0xe4bfa6,
-    0xe4bfa7,
-    0xe4bfa8,
-    0xe4bfa9,
-    0xe4bfaa,
-    0xe4bfab,
-    0xe4bfac,
-    0xe4bfad,
-    0xe4bfae,
-    0xe4bfaf,
-    0xe4bfb0,
-    0xe4bfb1,
-    0xe4bfb2,
-    0xe4bfb3,
-    0xe4bfb4,
-    0xe4bfb5,
-    0xe4bfb6,
-    0xe4bfb7,
-    0xe4bfb8,
-    0xe4bfb9,
-    0xe4bfba,
-    0xe4bfbb,
-    0xe4bfbc,
-    0xe4bfbd,
-    0xe4bfbe,
-    0xe4bfbf,
-    0xe58080,
-    0xe58081,
-    0xe58082,
-    0xe58083,
-    0xe58084,
-    0xe58085,
-    0xe58086,
-    0xe58087,
-    0xe58088,
-    0xe58089,
-    0xe5808a,
-    0xe5808b,
-    0xe5808c,
-    0xe5808d,
-    0xe5808e,
-    0xe5808f,
-    0xe58090,
-    0xe58091,
-    0xe58092,
-    0xe58093,
-    0xe58094,
-    0xe58095,
-    0xe58096,
-    0xe58097,
-    0xe58098,
-    0xe58099,
-    0xe5809a,
-    0xe5809b,
-    0xe5809c,
-    0xe5809d,
-    0xe5809e,
-    0xe5809f,
-    0xe580a0,
-    0xe580a1,
-    0xe580a2,
-    0xe580a3,
-    0xe580a4,
-    0xe580a5,
-    0xe580a6,
-    0xe580a7,
-    0xe580a8,
-    0xe580a9,
-    0xe580aa,
-    0xe580ab,
-    0xe580ac,
-    0xe580ad,
-    0xe580ae,
-    0xe580af,
-    0xe580b0,
-    0xe580b1,
-    0xe580b2,
-    0xe580b3,
-    0xe580b4,
-    0xe580b5,
-    0xe580b6,
-    0xe580b7,
-    0xe580b8,
-    0xe580b9,
-    0xe580ba,
-    0xe580bb,
-    0xe580bc,
-    0xe580bd,
-    0xe580be,
-    0xe580bf,
-    0xe58180,
-    0xe58181,
-    0xe58182,
-    0xe58183,
-    0xe58184,
-    0xe58185,
-    0xe58186,
-    0xe58187,
-    0xe58188,
-    0xe58189,
-    0xe5818a,
-    0xe5818b,
-    0xe5818c,
-    0xe5818d,
-    0xe5818e,
-    0xe5818f,
-    0xe58190,
-    0xe58191,
-    0xe58192,
-    0xe58193,
-    0xe58194,
-    0xe58195,
-    0xe58196,
-    0xe58197,
-    0xe58198,
-    0xe58199,
-    0xe5819a,
-    0xe5819b,
-    0xe5819c,
-    0xe5819d,
-    0xe5819e,
-    0xe5819f,
-    0xe581a0,
-    0xe581a1,
-    0xe581a2,
-    0xe581a3,
-    0xe581a4,
-    0xe581a5,
-    0xe581a6,
-    0xe581a7,
-    0xe581a8,
-    0xe581a9,
-    0xe581aa,
-    0xe581ab,
-    0xe581ac,
-    0xe581ad,
-    0xe581ae,
-    0xe581af,
-    0xe581b0,
-    0xe581b1,
-    0xe581b2,
-    0xe581b3,
-    0xe581b4,
-    0xe581b5,
-    0xe581b6,
-    0xe581b7,
-    0xe581b8,
-    0xe581b9,
-    0xe581ba,
-    0xe581bb,
-    0xe581bc,
-    0xe581bd,
-    0xe581be,
-    0xe581bf,
-    0xe58280,
-    0xe58281,
-    0xe58282,
-    0xe58283,
-    0xe58284,
-    0xe58285,
-    0xe58286,
-    0xe58287,
-    0xe58288,
-    0xe58289,
-    0xe5828a,
-    0xe5828b,
-    0xe5828c,
-    0xe5828d,
-    0xe5828e,
-    0xe5828f,
-    0xe58290,
-    0xe58291,
-    0xe58292,
-    0xe58293,
-    0xe58294,
-    0xe58295,
-    0xe58296,
-    0xe58297,
-    0xe58298,
-    0xe58299,
-    0xe5829a,
-    0xe5829b,
-    0xe5829c,
-    0xe5829d,
-    0xe5829e,
-    0xe5829f,
-    0xe582a0,
-    0xe582a1,
-    0xe582a2,
-    0xe582a3,
-    0xe582a4,
-    0xe582a5,
-    0xe582a6,
-    0xe582a7,
-    0xe582a8,
-    0xe582a9,
-    0xe582aa,
-    0xe582ab,
-    0xe582ac,
-    0xe582ad,
-    0xe582ae,
-    0xe582af,
-    0xe582b0,
-    0xe582b1,
-    0xe582b2,
-    0xe582b3,
-    0xe582b4,
-    0xe582b5,
-    0xe582b6,
-    0xe582b7,
-    0xe582b8,
-    0xe582b9,
-    0xe582ba,
-    0xe582bb,
-    0xe582bc,
-    0xe582bd,
-    0xe582be,
-    0xe582bf,
-    0xe58380,
-    0xe58381,
-    0xe58382,
-    0xe58383,
-    0xe58384,
-    0xe58385,
-    0xe58386,
-    0xe58387,
-    0xe58388,
-    0xe58389,
-    0xe5838a,
-    0xe5838b,
-    0xe5838c,
-    0xe5838d,
-    0xe5838e,
-    0xe5838f,
-    0xe58390,
-    0xe58391,
-    0xe58392,
-    0xe58393,
-    0xe58394,
-    0xe58395,
-    0xe58396,
-    0xe58397,
-    0xe58398,
-    0xe58399,
-    0xe5839a,
-    0xe5839b,
-    0xe5839c,
-    0xe5839d,
-    0xe5839e,
-    0xe5839f,
-    0xe583a0,
-    0xe583a1,
-    0xe583a2,
-    0xe583a3,
-    0xe583a4,
-    0xe583a5,
-    0xe583a6,
-    0xe583a7,
-    0xe583a8,
-    0xe583a9,
-    0xe583aa,
-    0xe583ab,
-    0xe583ac,
-    0xe583ad,
-    0xe583ae,
-    0xe583af,
-    0xe583b0,
-    0xe583b1,
-    0xe583b2,
-    0xe583b3,
-    0xe583b4,
-    0xe583b5,
-    0xe583b6,
-    0xe583b7,
-    0xe583b8,
-    0xe583b9,
-    0xe583ba,
-    0xe583bb,
-    0xe583bc,
-    0xe583bd,
-    0xe583be,
-    0xe583bf,
-    0xe58480,
-    0xe58481,
-    0xe58482,
-    0xe58483,
-    0xe58484,
-    0xe58485,
-    0xe58486,
-    0xe58487,
-    0xe58488,
-    0xe58489,
-    0xe5848a,
-    0xe5848b,
-    0xe5848c,
-    0xe5848d,
-    0xe5848e,
-    0xe5848f,
-    0xe58490,
-    0xe58491,
-    0xe58492,
-    0xe58493,
-    0xe58494,
-    0xe58495,
-    0xe58496,
-    0xe58497,
-    0xe58498,
-    0xe58499,
-    0xe5849a,
-    0xe5849b,
-    0xe5849c,
-    0xe5849d,
-    0xe5849e,
-    0xe5849f,
-    0xe584a0,
-    0xe584a1,
-    0xe584a2,
-    0xe584a3,
-    0xe584a4,
-    0xe584a5,
-    0xe584a6,
-    0xe584a7,
-    0xe584a8,
-    0xe584a9,
-    0xe584aa,
-    0xe584ab,
-    0xe584ac,
-    0xe584ad,
-    0xe584ae,
-    0xe584af,
-    0xe584b0,
-    0xe584b1,
-    0xe584b2,
-    0xe584b3,
-    0xe584b4,
-    0xe584b5,
-    0xe584b6,
-    0xe584b7,
-    0xe584b8,
-    0xe584b9,
-    0xe584ba,
-    0xe584bb,
-    0xe584bc,
-    0xe584bd,
-    0xe584be,
-    0xe584bf,
-    0xe58580,
-    0xe58581,
-    0xe58582,
-    0xe58583,
-    0xe58584,
-    0xe58585,
-    0xe58586,
-    0xe58587,
-    0xe58588,
-    0xe58589,
-    0xe5858a,
-    0xe5858b,
-    0xe5858c,
-    0xe5858d,
-    0xe5858e,
-    0xe5858f,
-    0xe58590,
-    0xe58591,
-    0xe58592,
-    0xe58593,
-    0xe58594,
-    0xe58595,
-    0xe58596,
-    0xe58597,
-    0xe58598,
-    0xe58599,
-    0xe5859a,
-    0xe5859b,
-    0xe5859c,
-    0xe5859d,
-    0xe5859e,
-    0xe5859f,
-    0xe585a0,
-    0xe585a1,
-    0xe585a2,
-    0xe585a3,
-    0xe585a4,
-    0xe585a5,
-    0xe585a6,
-    0xe585a7,
-    0xe585a8,
-    0xe585a9,
-    0xe585aa,
-    0xe585ab,
-    0xe585ac,
-    0xe585ad,
-    0xe585ae,
-    0xe585af,
-    0xe585b0,
-    0xe585b1,
-    0xe585b2,
-    0xe585b3,
-    0xe585b4,
-    0xe585b5,
-    0xe585b6,
-    0xe585b7,
-    0xe585b8,
-    0xe585b9,
-    0xe585ba,
-    0xe585bb,
-    0xe585bc,
-    0xe585bd,
-    0xe585be,
-    0xe585bf,
-    0xe58680,
-    0xe58681,
-    0xe58682,
-    0xe58683,
-    0xe58684,
-    0xe58685,
-    0xe58686,
-    0xe58687,
-    0xe58688,
-    0xe58689,
-    0xe5868a,
-    0xe5868b,
-    0xe5868c,
-    0xe5868d,
-    0xe5868e,
-    0xe5868f,
-    0xe58690,
-    0xe58691,
-    0xe58692,
-    0xe58693,
-    0xe58694,
-    0xe58695,
-    0xe58696,
-    0xe58697,
-    0xe58698,
-    0xe58699,
-    0xe5869a,
-    0xe5869b,
-    0xe5869c,
-    0xe5869d,
-    0xe5869e,
-    0xe5869f,
-    0xe586a0,
-    0xe586a1,
-    0xe586a2,
-    0xe586a3,
-    0xe586a4,
-    0xe586a5,
-    0xe586a6,
-    0xe586a7,
-    0xe586a8,
-    0xe586a9,
-    0xe586aa,
-    0xe586ab,
-    0xe586ac,
-    0xe586ad,
-    0xe586ae,
-    0xe586af,
-    0xe586b0,
-    0xe586b1,
-    0xe586b2,
-    0xe586b3,
-    0xe586b4,
-    0xe586b5,
-    0xe586b6,
-    0xe586b7,
-    0xe586b8,
-    0xe586b9,
-    0xe586ba,
-    0xe586bb,
-    0xe586bc,
-    0xe586bd,
-    0xe586be,
-    0xe586bf,
-    0xe58780,
-    0xe58781,
-    0xe58782,
-    0xe58783,
-    0xe58784,
-    0xe58785,
-    0xe58786,
-    0xe58787,
-    0xe58788,
-    0xe58789,
-    0xe5878a,
-    0xe5878b,
-    0xe5878c,
-    0xe5878d,
-    0xe5878e,
-    0xe5878f,
-    0xe58790,
-    0xe58791,
-    0xe58792,
-    0xe58793,
-    0xe58794,
-    0xe58795,
-    0xe58796,
-    0xe58797,
-    0xe58798,
-    0xe58799,
-    0xe5879a,
-    0xe5879b,
-    0xe5879c,
-    0xe5879d,
-    0xe5879e,
-    0xe5879f,
-    0xe587a0,
-    0xe587a1,
-    0xe587a2,
-    0xe587a3,
-    0xe587a4,
-    0xe587a5,
-    0xe587a6,
-    0xe587a7,
-    0xe587a8,
-    0xe587a9,
-    0xe587aa,
-    0xe587ab,
-    0xe587ac,
-    0xe587ad,
-    0xe587ae,
-    0xe587af,
-    0xe587b0,
-    0xe587b1,
-    0xe587b2,
-    0xe587b3,
-    0xe587b4,
-    0xe587b5,
-    0xe587b6,
-    0xe587b7,
-    0xe587b8,
-    0xe587b9,
-    0xe587ba,
-    0xe587bb,
-    0xe587bc,
-    0xe587bd,
-    0xe587be,
-    0xe587bf,
-    0xe58880,
-    0xe58881,
-    0xe58882,
-    0xe58883,
-    0xe58884,
-    0xe58885,
-    0xe58886,
-    0xe58887,
-    0xe58888,
-    0xe58889,
-    0xe5888a,
-    0xe5888b,
-    0xe5888c,
-    0xe5888d,
-    0xe5888e,
-    0xe5888f,
-    0xe58890,
-    0xe58891,
-    0xe58892,
-    0xe58893,
-    0xe58894,
-    0xe58895,
-    0xe58896,
-    0xe58897,
-    0xe58898,
-    0xe58899,
-    0xe5889a,
-    0xe5889b,
-    0xe5889c,
-    0xe5889d,
-    0xe5889e,
-    0xe5889f,
-    0xe588a0,
-    0xe588a1,
-    0xe588a2,
-    0xe588a3,
-    0xe588a4,
-    0xe588a5,
-    0xe588a6,
-    0xe588a7,
-    0xe588a8,
-    0xe588a9,
-    0xe588aa,
-    0xe588ab,
-    0xe588ac,
-    0xe588ad,
-    0xe588ae,
-    0xe588af,
-    0xe588b0,
-    0xe588b1,
-    0xe588b2,
-    0xe588b3,
-    0xe588b4,
-    0xe588b5,
-    0xe588b6,
-    0xe588b7,
-    0xe588b8,
-    0xe588b9,
-    0xe588ba,
-    0xe588bb,
-    0xe588bc,
-    0xe588bd,
-    0xe588be,
-    0xe588bf,
-    0xe58980,
-    0xe58981,
-    0xe58982,
-    0xe58983,
-    0xe58984,
-    0xe58985,
-    0xe58986,
-    0xe58987,
-    0xe58988,
-    0xe58989,
-    0xe5898a,
-    0xe5898b,
-    0xe5898c,
-    0xe5898d,
-    0xe5898e,
-    0xe5898f,
-    0xe58990,
-    0xe58991,
-    0xe58992,
-    0xe58993,
-    0xe58994,
-    0xe58995,
-    0xe58996,
-    0xe58997,
-    0xe58998,
-    0xe58999,
-    0xe5899a,
-    0xe5899b,
-    0xe5899c,
-    0xe5899d,
-    0xe5899e,
-    0xe5899f,
-    0xe589a0,
-    0xe589a1,
-    0xe589a2,
-    0xe589a3,
-    0xe589a4,
-    0xe589a5,
-    0xe589a6,
-    0xe589a7,
-    0xe589a8,
-    0xe589a9,
-    0xe589aa,
-    0xe589ab,
-    0xe589ac,
-    0xe589ad,
-    0xe589ae,
-    0xe589af,
-    0xe589b0,
-    0xe589b1,
-    0xe589b2,
-    0xe589b3,
-    0xe589b4,
-    0xe589b5,
-    0xe589b6,
-    0xe589b7,
-    0xe589b8,
-    0xe589b9,
-    0xe589ba,
-    0xe589bb,
-    0xe589bc,
-    0xe589bd,
-    0xe589be,
-    0xe589bf,
-    0xe58a80,
-    0xe58a81,
-    0xe58a82,
-    0xe58a83,
-    0xe58a84,
-    0xe58a85,
-    0xe58a86,
-    0xe58a87,
-    0xe58a88,
-    0xe58a89,
-    0xe58a8a,
-    0xe58a8b,
-    0xe58a8c,
-    0xe58a8d,
-    0xe58a8e,
-    0xe58a8f,
-    0xe58a90,
-    0xe58a91,
-    0xe58a92,
-    0xe58a93,
-    0xe58a94,
-    0xe58a95,
-    0xe58a96,
-    0xe58a97,
-    0xe58a98,
-    0xe58a99,
-    0xe58a9a,
-    0xe58a9b,
-    0xe58a9c,
-    0xe58a9d,
-    0xe58a9e,
-    0xe58a9f,
-    0xe58aa0,
-    0xe58aa1,
-    0xe58aa2,
-    0xe58aa3,
-    0xe58aa4,
-    0xe58aa5,
-    0xe58aa6,
-    0xe58aa7,
-    0xe58aa8,
-    0xe58aa9,
-    0xe58aaa,
-    0xe58aab,
-    0xe58aac,
-    0xe58aad,
-    0xe58aae,
-    0xe58aaf,
-    0xe58ab0,
-    0xe58ab1,
-    0xe58ab2,
-    0xe58ab3,
-    0xe58ab4,
-    0xe58ab5,
-    0xe58ab6,
-    0xe58ab7,
-    0xe58ab8,
-    0xe58ab9,
-    0xe58aba,
-    0xe58abb,
-    0xe58abc,
-    0xe58abd,
-    0xe58abe,
-    0xe58abf,
-    0xe58b80,
-    0xe58b81,
-    0xe58b82,
-    0xe58b83,
-    0xe58b84,
-    0xe58b85,
-    0xe58b86,
-    0xe58b87,
-    0xe58b88,
-    0xe58b89,
-    0xe58b8a,
-    0xe58b8b,
-    0xe58b8c,
-    0xe58b8d,
-    0xe58b8e,
-    0xe58b8f,
-    0xe58b90,
-    0xe58b91,
-    0xe58b92,
-    0xe58b93,
-    0xe58b94,
-    0xe58b95,
-    0xe58b96,
-    0xe58b97,
-    0xe58b98,
-    0xe58b99,
-    0xe58b9a,
-    0xe58b9b,
-    0xe58b9c,
-    0xe58b9d,
-    0xe58b9e,
-    0xe58b9f,
-    0xe58ba0,
-    0xe58ba1,
-    0xe58ba2,
-    0xe58ba3,
-    0xe58ba4,
-    0xe58ba5,
-    0xe58ba6,
-    0xe58ba7,
-    0xe58ba8,
-    0xe58ba9,
-    0xe58baa,
-    0xe58bab,
-    0xe58bac,
-    0xe58bad,
-    0xe58bae,
-    0xe58baf,
-    0xe58bb0,
-    0xe58bb1,
-    0xe58bb2,
-    0xe58bb3,
-    0xe58bb4,
-    0xe58bb5,
-    0xe58bb6,
-    0xe58bb7,
-    0xe58bb8,
-    0xe58bb9,
-    0xe58bba,
-    0xe58bbb,
-    0xe58bbc,
-    0xe58bbd,
-    0xe58bbe,
-    0xe58bbf,
-    0xe58c80,
-    0xe58c81,
-    0xe58c82,
-    0xe58c83,
-    0xe58c84,
-    0xe58c85,
-    0xe58c86,
-    0xe58c87,
-    0xe58c88,
-    0xe58c89,
-    0xe58c8a,
-    0xe58c8b,
-    0xe58c8c,
-    0xe58c8d,
-    0xe58c8e,
-    0xe58c8f,
-    0xe58c90,
-    0xe58c91,
-    0xe58c92,
-    0xe58c93,
-    0xe58c94,
-    0xe58c95,
-    0xe58c96,
-    0xe58c97,
-    0xe58c98,
-    0xe58c99,
-    0xe58c9a,
-    0xe58c9b,
-    0xe58c9c,
-    0xe58c9d,
-    0xe58c9e,
-    0xe58c9f,
-    0xe58ca0,
-    0xe58ca1,
-    0xe58ca2,
-    0xe58ca3,
-    0xe58ca4,
-    0xe58ca5,
-    0xe58ca6,
-    0xe58ca7,
-    0xe58ca8,
-    0xe58ca9,
-    0xe58caa,
-    0xe58cab,
-    0xe58cac,
-    0xe58cad,
-    0xe58cae,
-    0xe58caf,
-    0xe58cb0,
-    0xe58cb1,
-    0xe58cb2,
-    0xe58cb3,
-    0xe58cb4,
-    0xe58cb5,
-    0xe58cb6,
-    0xe58cb7,
-    0xe58cb8,
-    0xe58cb9,
-    0xe58cba,
-    0xe58cbb,
-    0xe58cbc,
-    0xe58cbd,
-    0xe58cbe,
-    0xe58cbf,
-    0xe58d80,
-    0xe58d81,
-    0xe58d82,
-    0xe58d83,
-    0xe58d84,
-    0xe58d85,
-    0xe58d86,
-    0xe58d87,
-    0xe58d88,
-    0xe58d89,
-    0xe58d8a,
-    0xe58d8b,
-    0xe58d8c,
-    0xe58d8d,
-    0xe58d8e,
-    0xe58d8f,
-    0xe58d90,
-    0xe58d91,
-    0xe58d92,
-    0xe58d93,
-    0xe58d94,
-    0xe58d95,
-    0xe58d96,
-    0xe58d97,
-    0xe58d98,
-    0xe58d99,
-    0xe58d9a,
-    0xe58d9b,
-    0xe58d9c,
-    0xe58d9d,
-    0xe58d9e,
-    0xe58d9f,
-    0xe58da0,
-    0xe58da1,
-    0xe58da2,
-    0xe58da3,
-    0xe58da4,
-    0xe58da5,
-    0xe58da6,
-    0xe58da7,
-    0xe58da8,
-    0xe58da9,
-    0xe58daa,
-    0xe58dab,
-    0xe58dac,
-    0xe58dad,
-    0xe58dae,
-    0xe58daf,
-    0xe58db0,
-    0xe58db1,
-    0xe58db2,
-    0xe58db3,
-    0xe58db4,
-    0xe58db5,
-    0xe58db6,
-    0xe58db7,
-    0xe58db8,
-    0xe58db9,
-    0xe58dba,
-    0xe58dbb,
-    0xe58dbc,
-    0xe58dbd,
-    0xe58dbe,
-    0xe58dbf,
-    0xe58e80,
-    0xe58e81,
-    0xe58e82,
-    0xe58e83,
-    0xe58e84,
-    0xe58e85,
-    0xe58e86,
-    0xe58e87,
-    0xe58e88,
-    0xe58e89,
-    0xe58e8a,
-    0xe58e8b,
-    0xe58e8c,
-    0xe58e8d,
-    0xe58e8e,
-    0xe58e8f,
-    0xe58e90,
-    0xe58e91,
-    0xe58e92,
-    0xe58e93,
-    0xe58e94,
-    0xe58e95,
-    0xe58e96,
-    0xe58e97,
-    0xe58e98,
-    0xe58e99,
-    0xe58e9a,
-    0xe58e9b,
-    0xe58e9c,
-    0xe58e9d,
-    0xe58e9e,
-    0xe58e9f,
-    0xe58ea0,
-    0xe58ea1,
-    0xe58ea2,
-    0xe58ea3,
-    0xe58ea4,
-    0xe58ea5,
-    0xe58ea6,
-    0xe58ea7,
-    0xe58ea8,
-    0xe58ea9,
-    0xe58eaa,
-    0xe58eab,
-    0xe58eac,
-    0xe58ead,
-    0xe58eae,
-    0xe58eaf,
-    0xe58eb0,
-    0xe58eb1,
-    0xe58eb2,
-    0xe58eb3,
-    0xe58eb4,
-    0xe58eb5,
-    0xe58eb6,
-    0xe58eb7,
-    0xe58eb8,
-    0xe58eb9,
-    0xe58eba,
-    0xe58ebb,
-    0xe58ebc,
-    0xe58ebd,
-    0xe58ebe,
-    0xe58ebf,
-    0xe58f80,
-    0xe58f81,
-    0xe58f82,
-    0xe58f83,
-    0xe58f84,
-    0xe58f85,
-    0xe58f86,
-    0xe58f87,
-    0xe58f88,
-    0xe58f89,
-    0xe58f8a,
-    0xe58f8b,
-    0xe58f8c,
-    0xe58f8d,
-    0xe58f8e,
-    0xe58f8f,
-    0xe58f90,
-    0xe58f91,
-    0xe58f92,
-    0xe58f93,
-    0xe58f94,
-    0xe58f95,
-    0xe58f96,
-    0xe58f97,
-    0xe58f98,
-    0xe58f99,
-    0xe58f9a,
-    0xe58f9b,
-    0xe58f9c,
-    0xe58f9d,
-    0xe58f9e,
-    0xe58f9f,
-    0xe58fa0,
-    0xe58fa1,
-    0xe58fa2,
-    0xe58fa3,
-    0xe58fa4,
-    0xe58fa5,
-    0xe58fa6,
-    0xe58fa7,
-    0xe58fa8,
-    0xe58fa9,
-    0xe58faa,
-    0xe58fab,
-    0xe58fac,
-    0xe58fad,
-    0xe58fae,
-    0xe58faf,
-    0xe58fb0,
-    0xe58fb1,
-    0xe58fb2,
-    0xe58fb3,
-    0xe58fb4,
-    0xe58fb5,
-    0xe58fb6,
-    0xe58fb7,
-    0xe58fb8,
-    0xe58fb9,
-    0xe58fba,
-    0xe58fbb,
-    0xe58fbc,
-    0xe58fbd,
-    0xe58fbe,
-    0xe58fbf,
-    0xe59080,
-    0xe59081,
-    0xe59082,
-    0xe59083,
-    0xe59084,
-    0xe59085,
-    0xe59086,
-    0xe59087,
-    0xe59088,
-    0xe59089,
-    0xe5908a,
-    0xe5908b,
-    0xe5908c,
-    0xe5908d,
-    0xe5908e,
-    0xe5908f,
-    0xe59090,
-    0xe59091,
-    0xe59092,
-    0xe59093,
-    0xe59094,
-    0xe59095,
-    0xe59096,
-    0xe59097,
-    0xe59098,
-    0xe59099,
-    0xe5909a,
-    0xe5909b,
-    0xe5909c,
-    0xe5909d,
-    0xe5909e,
-    0xe5909f,
-    0xe590a0,
-    0xe590a1,
-    0xe590a2,
-    0xe590a3,
-    0xe590a4,
-    0xe590a5,
-    0xe590a6,
-    0xe590a7,
-    0xe590a8,
-    0xe590a9,
-    0xe590aa,
-    0xe590ab,
-    0xe590ac,
-    0xe590ad,
-    0xe590ae,
-    0xe590af,
-    0xe590b0,
-    0xe590b1,
-    0xe590b2,
-    0xe590b3,
-    0xe590b4,
-    0xe590b5,
-    0xe590b6,
-    0xe590b7,
-    0xe590b8,
-    0xe590b9,
-    0xe590ba,
-    0xe590bb,
-    0xe590bc,
-    0xe590bd,
-    0xe590be,
-    0xe590bf,
-    0xe59180,
-    0xe59181,
-    0xe59182,
-    0xe59183,
-    0xe59184,
-    0xe59185,
-    0xe59186,
-    0xe59187,
-    0xe59188,
-    0xe59189,
-    0xe5918a,
-    0xe5918b,
-    0xe5918c,
-    0xe5918d,
-    0xe5918e,
-    0xe5918f,
-    0xe59190,
-    0xe59191,
-    0xe59192,
-    0xe59193,
-    0xe59194,
-    0xe59195,
-    0xe59196,
-    0xe59197,
-    0xe59198,
-    0xe59199,
-    0xe5919a,
-    0xe5919b,
-    0xe5919c,
-    0xe5919d,
-    0xe5919e,
-    0xe5919f,
-    0xe591a0,
-    0xe591a1,
-    0xe591a2,
-    0xe591a3,
-    0xe591a4,
-    0xe591a5,
-    0xe591a6,
-    0xe591a7,
-    0xe591a8,
-    0xe591a9,
-    0xe591aa,
-    0xe591ab,
-    0xe591ac,
-    0xe591ad,
-    0xe591ae,
-    0xe591af,
-    0xe591b0,
-    0xe591b1,
-    0xe591b2,
-    0xe591b3,
-    0xe591b4,
-    0xe591b5,
-    0xe591b6,
-    0xe591b7,
-    0xe591b8,
-    0xe591b9,
-    0xe591ba,
-    0xe591bb,
-    0xe591bc,
-    0xe591bd,
-    0xe591be,
-    0xe591bf,
-    0xe59280,
-    0xe59281,
-    0xe59282,
-    0xe59283,
-    0xe59284,
-    0xe59285,
-    0xe59286,
-    0xe59287,
-    0xe59288,
-    0xe59289,
-    0xe5928a,
-    0xe5928b,
-    0xe5928c,
-    0xe5928d,
-    0xe5928e,
-    0xe5928f,
-    0xe59290,
-    0xe59291,
-    0xe59292,
-    0xe59293,
-    0xe59294,
-    0xe59295,
-    0xe59296,
-    0xe59297,
-    0xe59298,
-    0xe59299,
-    0xe5929a,
-    0xe5929b,
-    0xe5929c,
-    0xe5929d,
-    0xe5929e,
-    0xe5929f,
-    0xe592a0,
-    0xe592a1,
-    0xe592a2,
-    0xe592a3,
-    0xe592a4,
-    0xe592a5,
-    0xe592a6,
-    0xe592a7,
-    0xe592a8,
-    0xe592a9,
-    0xe592aa,
-    0xe592ab,
-    0xe592ac,
-    0xe592ad,
-    0xe592ae,
-    0xe592af,
-    0xe592b0,
-    0xe592b1,
-    0xe592b2,
-    0xe592b3,
-    0xe592b4,
-    0xe592b5,
-    0xe592b6,
-    0xe592b7,
-    0xe592b8,
-    0xe592b9,
-    0xe592ba,
-    0xe592bb,
-    0xe592bc,
-    0xe592bd,
-    0xe592be,
-    0xe592bf,
-    0xe59380,
-    0xe59381,
-    0xe59382,
-    0xe59383,
-    0xe59384,
-    0xe59385,
-    0xe59386,
-    0xe59387,
-    0xe59388,
-    0xe59389,
-    0xe5938a,
-    0xe5938b,
-    0xe5938c,
-    0xe5938d,
-    0xe5938e,
-    0xe5938f,
-    0xe59390,
-    0xe59391,
-    0xe59392,
-    0xe59393,
-    0xe59394,
-    0xe59395,
-    0xe59396,
-    0xe59397,
-    0xe59398,
-    0xe59399,
-    0xe5939a,
-    0xe5939b,
-    0xe5939c,
-    0xe5939d,
-    0xe5939e,
-    0xe5939f,
-    0xe593a0,
-    0xe593a1,
-    0xe593a2,
-    0xe593a3,
-    0xe593a4,
-    0xe593a5,
-    0xe593a6,
-    0xe593a7,
-    0xe593a8,
-    0xe593a9,
-    0xe593aa,
-    0xe593ab,
-    0xe593ac,
-    0xe593ad,
-    0xe593ae,
-    0xe593af,
-    0xe593b0,
-    0xe593b1,
-    0xe593b2,
-    0xe593b3,
-    0xe593b4,
-    0xe593b5,
-    0xe593b6,
-    0xe593b7,
-    0xe593b8,
-    0xe593b9,
-    0xe593ba,
-    0xe593bb,
-    0xe593bc,
-    0xe593bd,
-    0xe593be,
-    0xe593bf,
-    0xe59480,
-    0xe59481,
-    0xe59482,
-    0xe59483,
-    0xe59484,
-    0xe59485,
-    0xe59486,
-    0xe59487,
-    0xe59488,
-    0xe59489,
-    0xe5948a,
-    0xe5948b,
-    0xe5948c,
-    0xe5948d,
-    0xe5948e,
-    0xe5948f,
-    0xe59490,
-    0xe59491,
-    0xe59492,
-    0xe59493,
-    0xe59494,
-    0xe59495,
-    0xe59496,
-    0xe59497,
-    0xe59498,
-    0xe59499,
-    0xe5949a,
-    0xe5949b,
-    0xe5949c,
-    0xe5949d,
-    0xe5949e,
-    0xe5949f,
-    0xe594a0,
-    0xe594a1,
-    0xe594a2,
-    0xe594a3,
-    0xe594a4,
-    0xe594a5,
-    0xe594a6,
-    0xe594a7,
-    0xe594a8,
-    0xe594a9,
-    0xe594aa,
-    0xe594ab,
-    0xe594ac,
-    0xe594ad,
-    0xe594ae,
-    0xe594af,
-    0xe594b0,
-    0xe594b1,
-    0xe594b2,
-    0xe594b3,
-    0xe594b4,
-    0xe594b5,
-    0xe594b6,
-    0xe594b7,
-    0xe594b8,
-    0xe594b9,
-    0xe594ba,
-    0xe594bb,
-    0xe594bc,
-    0xe594bd,
-    0xe594be,
-    0xe594bf,
-    0xe59580,
-    0xe59581,
-    0xe59582,
-    0xe59583,
-    0xe59584,
-    0xe59585,
-    0xe59586,
-    0xe59587,
-    0xe59588,
-    0xe59589,
-    0xe5958a,
-    0xe5958b,
-    0xe5958c,
-    0xe5958d,
-    0xe5958e,
-    0xe5958f,
-    0xe59590,
-    0xe59591,
-    0xe59592,
-    0xe59593,
-    0xe59594,
-    0xe59595,
-    0xe59596,
-    0xe59597,
-    0xe59598,
-    0xe59599,
-    0xe5959a,
-    0xe5959b,
-    0xe5959c,
-    0xe5959d,
-    0xe5959e,
-    0xe5959f,
-    0xe595a0,
-    0xe595a1,
-    0xe595a2,
-    0xe595a3,
-    0xe595a4,
-    0xe595a5,
-    0xe595a6,
-    0xe595a7,
-    0xe595a8,
-    0xe595a9,
-    0xe595aa,
-    0xe595ab,
-    0xe595ac,
-    0xe595ad,
-    0xe595ae,
-    0xe595af,
-    0xe595b0,
-    0xe595b1,
-    0xe595b2,
-    0xe595b3,
-    0xe595b4,
-    0xe595b5,
-    0xe595b6,
-    0xe595b7,
-    0xe595b8,
-    0xe595b9,
-    0xe595ba,
-    0xe595bb,
-    0xe595bc,
-    0xe595bd,
-    0xe595be,
-    0xe595bf,
-    0xe59680,
-    0xe59681,
-    0xe59682,
-    0xe59683,
-    0xe59684,
-    0xe59685,
-    0xe59686,
-    0xe59687,
-    0xe59688,
-    0xe59689,
-    0xe5968a,
-    0xe5968b,
-    0xe5968c,
-    0xe5968d,
-    0xe5968e,
-    0xe5968f,
-    0xe59690,
-    0xe59691,
-    0xe59692,
-    0xe59693,
-    0xe59694,
-    0xe59695,
-    0xe59696,
-    0xe59697,
-    0xe59698,
-    0xe59699,
-    0xe5969a,
-    0xe5969b,
-    0xe5969c,
-    0xe5969d,
-    0xe5969e,
-    0xe5969f,
-    0xe596a0,
-    0xe596a1,
-    0xe596a2,
-    0xe596a3,
-    0xe596a4,
-    0xe596a5,
-    0xe596a6,
-    0xe596a7,
-    0xe596a8,
-    0xe596a9,
-    0xe596aa,
-    0xe596ab,
-    0xe596ac,
-    0xe596ad,
-    0xe596ae,
-    0xe596af,
-    0xe596b0,
-    0xe596b1,
-    0xe596b2,
-    0xe596b3,
-    0xe596b4,
-    0xe596b5,
-    0xe596b6,
-    0xe596b7,
-    0xe596b8,
-    0xe596b9,
-    0xe596ba,
-    0xe596bb,
-    0xe596bc,
-    0xe596bd,
-    0xe596be,
-    0xe596bf,
-    0xe59780,
-    0xe59781,
-    0xe59782,
-    0xe59783,
-    0xe59784,
-    0xe59785,
-    0xe59786,
-    0xe59787,
-    0xe59788,
-    0xe59789,
-    0xe5978a,
-    0xe5978b,
-    0xe5978c,
-    0xe5978d,
-    0xe5978e,
-    0xe5978f,
-    0xe59790,
-    0xe59791,
-    0xe59792,
-    0xe59793,
-    0xe59794,
-    0xe59795,
-    0xe59796,
-    0xe59797,
-    0xe59798,
-    0xe59799,
-    0xe5979a,
-    0xe5979b,
-    0xe5979c,
-    0xe5979d,
-    0xe5979e,
-    0xe5979f,
-    0xe597a0,
-    0xe597a1,
-    0xe597a2,
-    0xe597a3,
-    0xe597a4,
-    0xe597a5,
-    0xe597a6,
-    0xe597a7,
-    0xe597a8,
-    0xe597a9,
-    0xe597aa,
-    0xe597ab,
-    0xe597ac,
-    0xe597ad,
-    0xe597ae,
-    0xe597af,
-    0xe597b0,
-    0xe597b1,
-    0xe597b2,
-    0xe597b3,
-    0xe597b4,
-    0xe597b5,
-    0xe597b6,
-    0xe597b7,
-    0xe597b8,
-    0xe597b9,
-    0xe597ba,
-    0xe597bb,
-    0xe597bc,
-    0xe597bd,
-    0xe597be,
-    0xe597bf,
-    0xe59880,
-    0xe59881,
-    0xe59882,
-    0xe59883,
-    0xe59884,
-    0xe59885,
-    0xe59886,
-    0xe59887,
-    0xe59888,
-    0xe59889,
-    0xe5988a,
-    0xe5988b,
-    0xe5988c,
-    0xe5988d,
-    0xe5988e,
-    0xe5988f,
-    0xe59890,
-    0xe59891,
-    0xe59892,
-    0xe59893,
-    0xe59894,
-    0xe59895,
-    0xe59896,
-    0xe59897,
-    0xe59898,
-    0xe59899,
-    0xe5989a,
-    0xe5989b,
-    0xe5989c,
-    0xe5989d,
-    0xe5989e,
-    0xe5989f,
-    0xe598a0,
-    0xe598a1,
-    0xe598a2,
-    0xe598a3,
-    0xe598a4,
-    0xe598a5,
-    0xe598a6,
-    0xe598a7,
-    0xe598a8,
-    0xe598a9,
-    0xe598aa,
-    0xe598ab,
-    0xe598ac,
-    0xe598ad,
-    0xe598ae,
-    0xe598af,
-    0xe598b0,
-    0xe598b1,
-    0xe598b2,
-    0xe598b3,
-    0xe598b4,
-    0xe598b5,
-    0xe598b6,
-    0xe598b7,
-    0xe598b8,
-    0xe598b9,
-    0xe598ba,
-    0xe598bb,
-    0xe598bc,
-    0xe598bd,
-    0xe598be,
-    0xe598bf,
-    0xe59980,
-    0xe59981,
-    0xe59982,
-    0xe59983,
-    0xe59984,
-    0xe59985,
-    0xe59986,
-    0xe59987,
-    0xe59988,
-    0xe59989,
-    0xe5998a,
-    0xe5998b,
-    0xe5998c,
-    0xe5998d,
-    0xe5998e,
-    0xe5998f,
-    0xe59990,
-    0xe59991,
-    0xe59992,
-    0xe59993,
-    0xe59994,
-    0xe59995,
-    0xe59996,
-    0xe59997,
-    0xe59998,
-    0xe59999,
-    0xe5999a,
-    0xe5999b,
-    0xe5999c,
-    0xe5999d,
-    0xe5999e,
-    0xe5999f,
-    0xe599a0,
-    0xe599a1,
-    0xe599a2,
-    0xe599a3,
-    0xe599a4,
-    0xe599a5,
-    0xe599a6,
-    0xe599a7,
-    0xe599a8,
-    0xe599a9,
-    0xe599aa,
-    0xe599ab,
-    0xe599ac,
-    0xe599ad,
-    0xe599ae,
-    0xe599af,
-    0xe599b0,
-    0xe599b1,
-    0xe599b2,
-    0xe599b3,
-    0xe599b4,
-    0xe599b5,
-    0xe599b6,
-    0xe599b7,
-    0xe599b8,
-    0xe599b9,
-    0xe599ba,
-    0xe599bb,
-    0xe599bc,
-    0xe599bd,
-    0xe599be,
-    0xe599bf,
-    0xe59a80,
-    0xe59a81,
-    0xe59a82,
-    0xe59a83,
-    0xe59a84,
-    0xe59a85,
-    0xe59a86,
-    0xe59a87,
-    0xe59a88,
-    0xe59a89,
-    0xe59a8a,
-    0xe59a8b,
-    0xe59a8c,
-    0xe59a8d,
-    0xe59a8e,
-    0xe59a8f,
-    0xe59a90,
-    0xe59a91,
-    0xe59a92,
-    0xe59a93,
-    0xe59a94,
-    0xe59a95,
-    0xe59a96,
-    0xe59a97,
-    0xe59a98,
-    0xe59a99,
-    0xe59a9a,
-    0xe59a9b,
-    0xe59a9c,
-    0xe59a9d,
-    0xe59a9e,
-    0xe59a9f,
-    0xe59aa0,
-    0xe59aa1,
-    0xe59aa2,
-    0xe59aa3,
-    0xe59aa4,
-    0xe59aa5,
-    0xe59aa6,
-    0xe59aa7,
-    0xe59aa8,
-    0xe59aa9,
-    0xe59aaa,
-    0xe59aab,
-    0xe59aac,
-    0xe59aad,
-    0xe59aae,
-    0xe59aaf,
-    0xe59ab0,
-    0xe59ab1,
-    0xe59ab2,
-    0xe59ab3,
-    0xe59ab4,
-    0xe59ab5,
-    0xe59ab6,
-    0xe59ab7,
-    0xe59ab8,
-    0xe59ab9,
-    0xe59aba,
-    0xe59abb,
-    0xe59abc,
-    0xe59abd,
-    0xe59abe,
-    0xe59abf,
-    0xe59b80,
-    0xe59b81,
-    0xe59b82,
-    0xe59b83,
-    0xe59b84,
-    0xe59b85,
-    0xe59b86,
-    0xe59b87,
-    0xe59b88,
-    0xe59b89,
-    0xe59b8a,
-    0xe59b8b,
-    0xe59b8c,
-    0xe59b8d,
-    0xe59b8e,
-    0xe59b8f,
-    0xe59b90,
-    0xe59b91,
-    0xe59b92,
-    0xe59b93,
-    0xe59b94,
-    0xe59b95,
-    0xe59b96,
-    0xe59b97,
-    0xe59b98,
-    0xe59b99,
-    0xe59b9a,
-    0xe59b9b,
-    0xe59b9c,
-    0xe59b9d,
-    0xe59b9e,
-    0xe59b9f,
-    0xe59ba0,
-    0xe59ba1,
-    0xe59ba2,
-    0xe59ba3,
-    0xe59ba4,
-    0xe59ba5,
-    0xe59ba6,
-    0xe59ba7,
-    0xe59ba8,
-    0xe59ba9,
-    0xe59baa,
-    0xe59bab,
-    0xe59bac,
-    0xe59bad,
-    0xe59bae,
-    0xe59baf,
-    0xe59bb0,
-    0xe59bb1,
-    0xe59bb2,
-    0xe59bb3,
-    0xe59bb4,
-    0xe59bb5,
-    0xe59bb6,
-    0xe59bb7,
-    0xe59bb8,
-    0xe59bb9,
-    0xe59bba,
-    0xe59bbb,
-    0xe59bbc,
-    0xe59bbd,
-    0xe59bbe,
-    0xe59bbf,
-    0xe59c80,
-    0xe59c81,
-    0xe59c82,
-    0xe59c83,
-    0xe59c84,
-    0xe59c85,
-    0xe59c86,
-    0xe59c87,
-    0xe59c88,
-    0xe59c89,
-    0xe59c8a,
-    0xe59c8b,
-    0xe59c8c,
-    0xe59c8d,
-    0xe59c8e,
-    0xe59c8f,
-    0xe59c90,
-    0xe59c91,
-    0xe59c92,
-    0xe59c93,
-    0xe59c94,
-    0xe59c95,
-    0xe59c96,
-    0xe59c97,
-    0xe59c98,
-    0xe59c99,
-    0xe59c9a,
-    0xe59c9b,
-    0xe59c9c,
-    0xe59c9d,
-    0xe59c9e,
-    0xe59c9f,
-    0xe59ca0,
-    0xe59ca1,
-    0xe59ca2,
-    0xe59ca3,
-    0xe59ca4,
-    0xe59ca5,
-    0xe59ca6,
-    0xe59ca7,
-    0xe59ca8,
-    0xe59ca9,
-    0xe59caa,
-    0xe59cab,
-    0xe59cac,
-    0xe59cad,
-    0xe59cae,
-    0xe59caf,
-    0xe59cb0,
-    0xe59cb1,
-    0xe59cb2,
-    0xe59cb3,
-    0xe59cb4,
-    0xe59cb5,
-    0xe59cb6,
-    0xe59cb7,
-    0xe59cb8,
-    0xe59cb9,
-    0xe59cba,
-    0xe59cbb,
-    0xe59cbc,
-    0xe59cbd,
-    0xe59cbe,
-    0xe59cbf,
-    0xe59d80,
-    0xe59d81,
-    0xe59d82,
-    0xe59d83,
-    0xe59d84,
-    0xe59d85,
-    0xe59d86,
-    0xe59d87,
-    0xe59d88,
-    0xe59d89,
-    0xe59d8a,
-    0xe59d8b,
-    0xe59d8c,
-    0xe59d8d,
-    0xe59d8e,
-    0xe59d8f,
-    0xe59d90,
-    0xe59d91,
-    0xe59d92,
-    0xe59d93,
-    0xe59d94,
-    0xe59d95,
-    0xe59d96,
-    0xe59d97,
-    0xe59d98,
-    0xe59d99,
-    0xe59d9a,
-    0xe59d9b,
-    0xe59d9c,
-    0xe59d9d,
-    0xe59d9e,
-    0xe59d9f,
-    0xe59da0,
-    0xe59da1,
-    0xe59da2,
-    0xe59da3,
-    0xe59da4,
-    0xe59da5,
-    0xe59da6,
-    0xe59da7,
-    0xe59da8,
-    0xe59da9,
-    0xe59daa,
-    0xe59dab,
-    0xe59dac,
-    0xe59dad,
-    0xe59dae,
-    0xe59daf,
-    0xe59db0,
-    0xe59db1,
-    0xe59db2,
-    0xe59db3,
-    0xe59db4,
-    0xe59db5,
-    0xe59db6,
-    0xe59db7,
-    0xe59db8,
-    0xe59db9,
-    0xe59dba,
-    0xe59dbb,
-    0xe59dbc,
-    0xe59dbd,
-    0xe59dbe,
-    0xe59dbf,
-    0xe59e80,
-    0xe59e81,
-    0xe59e82,
-    0xe59e83,
-    0xe59e84,
-    0xe59e85,
-    0xe59e86,
-    0xe59e87,
-    0xe59e88,
-    0xe59e89,
-    0xe59e8a,
-    0xe59e8b,
-    0xe59e8c,
-    0xe59e8d,
-    0xe59e8e,
-    0xe59e8f,
-    0xe59e90,
-    0xe59e91,
-    0xe59e92,
-    0xe59e93,
-    0xe59e94,
-    0xe59e95,
-    0xe59e96,
-    0xe59e97,
-    0xe59e98,
-    0xe59e99,
-    0xe59e9a,
-    0xe59e9b,
-    0xe59e9c,
-    0xe59e9d,
-    0xe59e9e,
-    0xe59e9f,
-    0xe59ea0,
-    0xe59ea1,
-    0xe59ea2,
-    0xe59ea3,
-    0xe59ea4,
-    0xe59ea5,
-    0xe59ea6,
-    0xe59ea7,
-    0xe59ea8,
-    0xe59ea9,
-    0xe59eaa,
-    0xe59eab,
-    0xe59eac,
-    0xe59ead,
-    0xe59eae,
-    0xe59eaf,
-    0xe59eb0,
-    0xe59eb1,
-    0xe59eb2,
-    0xe59eb3,
-    0xe59eb4,
-    0xe59eb5,
-    0xe59eb6,
-    0xe59eb7,
-    0xe59eb8,
-    0xe59eb9,
-    0xe59eba,
-    0xe59ebb,
-    0xe59ebc,
-    0xe59ebd,
-    0xe59ebe,
-    0xe59ebf,
-    0xe59f80,
-    0xe59f81,
-    0xe59f82,
-    0xe59f83,
-    0xe59f84,
-    0xe59f85,
-    0xe59f86,
-    0xe59f87,
-    0xe59f88,
-    0xe59f89,
-    0xe59f8a,
-    0xe59f8b,
-    0xe59f8c,
-    0xe59f8d,
-    0xe59f8e,
-    0xe59f8f,
-    0xe59f90,
-    0xe59f91,
-    0xe59f92,
-    0xe59f93,
-    0xe59f94,
-    0xe59f95,
-    0xe59f96,
-    0xe59f97,
-    0xe59f98,
-    0xe59f99,
-    0xe59f9a,
-    0xe59f9b,
-    0xe59f9c,
-    0xe59f9d,
-    0xe59f9e,
-    0xe59f9f,
-    0xe59fa0,
-    0xe59fa1,
-    0xe59fa2,
-    0xe59fa3,
-    0xe59fa4,
-    0xe59fa5,
-    0xe59fa6,
-    0xe59fa7,
-    0xe59fa8,
-    0xe59fa9,
-    0xe59faa,
-    0xe59fab,
-    0xe59fac,
-    0xe59fad,
-    0xe59fae,
-    0xe59faf,
-    0xe59fb0,
-    0xe59fb1,
-    0xe59fb2,
-    0xe59fb3,
-    0xe59fb4,
-    0xe59fb5,
-    0xe59fb6,
-    0xe59fb7,
-    0xe59fb8,
-    0xe59fb9,
-    0xe59fba,
-    0xe59fbb,
-    0xe59fbc,
-    0xe59fbd,
-    0xe59fbe,
-    0xe59fbf,
-    0xe5a080,
-    0xe5a081,
-    0xe5a082,
-    0xe5a083,
-    0xe5a084,
-    0xe5a085,
-    0xe5a086,
-    0xe5a087,
-    0xe5a088,
-    0xe5a089,
-    0xe5a08a,
-    0xe5a08b,
-    0xe5a08c,
-    0xe5a08d,
-    0xe5a08e,
-    0xe5a08f,
-    0xe5a090,
-    0xe5a091,
-    0xe5a092,
-    0xe5a093,
-    0xe5a094,
-    0xe5a095,
-    0xe5a096,
-    0xe5a097,
-    0xe5a098,
-    0xe5a099,
-    0xe5a09a,
-    0xe5a09b,
-    0xe5a09c,
-    0xe5a09d,
-    0xe5a09e,
-    0xe5a09f,
-    0xe5a0a0,
-    0xe5a0a1,
-    0xe5a0a2,
-    0xe5a0a3,
-    0xe5a0a4,
-    0xe5a0a5,
-    0xe5a0a6,
-    0xe5a0a7,
-    0xe5a0a8,
-    0xe5a0a9,
-    0xe5a0aa,
-    0xe5a0ab,
-    0xe5a0ac,
-    0xe5a0ad,
-    0xe5a0ae,
-    0xe5a0af,
-    0xe5a0b0,
-    0xe5a0b1,
-    0xe5a0b2,
-    0xe5a0b3,
-    0xe5a0b4,
-    0xe5a0b5,
-    0xe5a0b6,
-    0xe5a0b7,
-    0xe5a0b8,
-    0xe5a0b9,
-    0xe5a0ba,
-    0xe5a0bb,
-    0xe5a0bc,
-    0xe5a0bd,
-    0xe5a0be,
-    0xe5a0bf,
-    0xe5a180,
-    0xe5a181,
-    0xe5a182,
-    0xe5a183,
-    0xe5a184,
-    0xe5a185,
-    0xe5a186,
-    0xe5a187,
-    0xe5a188,
-    0xe5a189,
-    0xe5a18a,
-    0xe5a18b,
-    0xe5a18c,
-    0xe5a18d,
-    0xe5a18e,
-    0xe5a18f,
-    0xe5a190,
-    0xe5a191,
-    0xe5a192,
-    0xe5a193,
-    0xe5a194,
-    0xe5a195,
-    0xe5a196,
-    0xe5a197,
-    0xe5a198,
-    0xe5a199,
-    0xe5a19a,
-    0xe5a19b,
-    0xe5a19c,
-    0xe5a19d,
-    0xe5a19e,
-    0xe5a19f,
-    0xe5a1a0,
-    0xe5a1a1,
-    0xe5a1a2,
-    0xe5a1a3,
-    0xe5a1a4,
-    0xe5a1a5,
-    0xe5a1a6,
-    0xe5a1a7,
-    0xe5a1a8,
-    0xe5a1a9,
-    0xe5a1aa,
-    0xe5a1ab,
-    0xe5a1ac,
-    0xe5a1ad,
-    0xe5a1ae,
-    0xe5a1af,
-    0xe5a1b0,
-    0xe5a1b1,
-    0xe5a1b2,
-    0xe5a1b3,
-    0xe5a1b4,
-    0xe5a1b5,
-    0xe5a1b6,
-    0xe5a1b7,
-    0xe5a1b8,
-    0xe5a1b9,
-    0xe5a1ba,
-    0xe5a1bb,
-    0xe5a1bc,
-    0xe5a1bd,
-    0xe5a1be,
-    0xe5a1bf,
-    0xe5a280,
-    0xe5a281,
-    0xe5a282,
-    0xe5a283,
-    0xe5a284,
-    0xe5a285,
-    0xe5a286,
-    0xe5a287,
-    0xe5a288,
-    0xe5a289,
-    0xe5a28a,
-    0xe5a28b,
-    0xe5a28c,
-    0xe5a28d,
-    0xe5a28e,
-    0xe5a28f,
-    0xe5a290,
-    0xe5a291,
-    0xe5a292,
-    0xe5a293,
-    0xe5a294,
-    0xe5a295,
-    0xe5a296,
-    0xe5a297,
-    0xe5a298,
-    0xe5a299,
-    0xe5a29a,
-    0xe5a29b,
-    0xe5a29c,
-    0xe5a29d,
-    0xe5a29e,
-    0xe5a29f,
-    0xe5a2a0,
-    0xe5a2a1,
-    0xe5a2a2,
-    0xe5a2a3,
-    0xe5a2a4,
-    0xe5a2a5,
-    0xe5a2a6,
-    0xe5a2a7,
-    0xe5a2a8,
-    0xe5a2a9,
-    0xe5a2aa,
-    0xe5a2ab,
-    0xe5a2ac,
-    0xe5a2ad,
-    0xe5a2ae,
-    0xe5a2af,
-    0xe5a2b0,
-    0xe5a2b1,
-    0xe5a2b2,
-    0xe5a2b3,
-    0xe5a2b4,
-    0xe5a2b5,
-    0xe5a2b6,
-    0xe5a2b7,
-    0xe5a2b8,
-    0xe5a2b9,
-    0xe5a2ba,
-    0xe5a2bb,
-    0xe5a2bc,
-    0xe5a2bd,
-    0xe5a2be,
-    0xe5a2bf,
-    0xe5a380,
-    0xe5a381,
-    0xe5a382,
-    0xe5a383,
-    0xe5a384,
-    0xe5a385,
-    0xe5a386,
-    0xe5a387,
-    0xe5a388,
-    0xe5a389,
-    0xe5a38a,
-    0xe5a38b,
-    0xe5a38c,
-    0xe5a38d,
-    0xe5a38e,
-    0xe5a38f,
-    0xe5a390,
-    0xe5a391,
-    0xe5a392,
-    0xe5a393,
-    0xe5a394,
-    0xe5a395,
-    0xe5a396,
-    0xe5a397,
-    0xe5a398,
-    0xe5a399,
-    0xe5a39a,
-    0xe5a39b,
-    0xe5a39c,
-    0xe5a39d,
-    0xe5a39e,
-    0xe5a39f,
-    0xe5a3a0,
-    0xe5a3a1,
-    0xe5a3a2,
-    0xe5a3a3,
-    0xe5a3a4,
-    0xe5a3a5,
-    0xe5a3a6,
-    0xe5a3a7,
-    0xe5a3a8,
-    0xe5a3a9,
-    0xe5a3aa,
-    0xe5a3ab,
-    0xe5a3ac,
-    0xe5a3ad,
-    0xe5a3ae,
-    0xe5a3af,
-    0xe5a3b0,
-    0xe5a3b1,
-    0xe5a3b2,
-    0xe5a3b3,
-    0xe5a3b4,
-    0xe5a3b5,
-    0xe5a3b6,
-    0xe5a3b7,
-    0xe5a3b8,
-    0xe5a3b9,
-    0xe5a3ba,
-    0xe5a3bb,
-    0xe5a3bc,
-    0xe5a3bd,
-    0xe5a3be,
-    0xe5a3bf,
-    0xe5a480,
-    0xe5a481,
-    0xe5a482,
-    0xe5a483,
-    0xe5a484,
-    0xe5a485,
-    0xe5a486,
-    0xe5a487,
-    0xe5a488,
-    0xe5a489,
-    0xe5a48a,
-    0xe5a48b,
-    0xe5a48c,
-    0xe5a48d,
-    0xe5a48e,
-    0xe5a48f,
-    0xe5a490,
-    0xe5a491,
-    0xe5a492,
-    0xe5a493,
-    0xe5a494,
-    0xe5a495,
-    0xe5a496,
-    0xe5a497,
-    0xe5a498,
-    0xe5a499,
-    0xe5a49a,
-    0xe5a49b,
-    0xe5a49c,
-    0xe5a49d,
-    0xe5a49e,
-    0xe5a49f,
-    0xe5a4a0,
-    0xe5a4a1,
-    0xe5a4a2,
-    0xe5a4a3,
-    0xe5a4a4,
-    0xe5a4a5,
-    0xe5a4a6,
-    0xe5a4a7,
-    0xe5a4a8,
-    0xe5a4a9,
-    0xe5a4aa,
-    0xe5a4ab,
-    0xe5a4ac,
-    0xe5a4ad,
-    0xe5a4ae,
-    0xe5a4af,
-    0xe5a4b0,
-    0xe5a4b1,
-    0xe5a4b2,
-    0xe5a4b3,
-    0xe5a4b4,
-    0xe5a4b5,
-    0xe5a4b6,
-    0xe5a4b7,
-    0xe5a4b8,
-    0xe5a4b9,
-    0xe5a4ba,
-    0xe5a4bb,
-    0xe5a4bc,
-    0xe5a4bd,
-    0xe5a4be,
-    0xe5a4bf,
-    0xe5a580,
-    0xe5a581,
-    0xe5a582,
-    0xe5a583,
-    0xe5a584,
-    0xe5a585,
-    0xe5a586,
-    0xe5a587,
-    0xe5a588,
-    0xe5a589,
-    0xe5a58a,
-    0xe5a58b,
-    0xe5a58c,
-    0xe5a58d,
-    0xe5a58e,
-    0xe5a58f,
-    0xe5a590,
-    0xe5a591,
-    0xe5a592,
-    0xe5a593,
-    0xe5a594,
-    0xe5a595,
-    0xe5a596,
-    0xe5a597,
-    0xe5a598,
-    0xe5a599,
-    0xe5a59a,
-    0xe5a59b,
-    0xe5a59c,
-    0xe5a59d,
-    0xe5a59e,
-    0xe5a59f,
-    0xe5a5a0,
-    0xe5a5a1,
-    0xe5a5a2,
-    0xe5a5a3,
-    0xe5a5a4,
-    0xe5a5a5,
-    0xe5a5a6,
-    0xe5a5a7,
-    0xe5a5a8,
-    0xe5a5a9,
-    0xe5a5aa,
-    0xe5a5ab,
-    0xe5a5ac,
-    0xe5a5ad,
-    0xe5a5ae,
-    0xe5a5af,
-    0xe5a5b0,
-    0xe5a5b1,
-    0xe5a5b2,
-    0xe5a5b3,
-    0xe5a5b4,
-    0xe5a5b5,
-    0xe5a5b6,
-    0xe5a5b7,
-    0xe5a5b8,
-    0xe5a5b9,
-    0xe5a5ba,
-    0xe5a5bb,
-    0xe5a5bc,
-    0xe5a5bd,
-    0xe5a5be,
-    0xe5a5bf,
-    0xe5a680,
-    0xe5a681,
-    0xe5a682,
-    0xe5a683,
-    0xe5a684,
-    0xe5a685,
-    0xe5a686,
-    0xe5a687,
-    0xe5a688,
-    0xe5a689,
-    0xe5a68a,
-    0xe5a68b,
-    0xe5a68c,
-    0xe5a68d,
-    0xe5a68e,
-    0xe5a68f,
-    0xe5a690,
-    0xe5a691,
-    0xe5a692,
-    0xe5a693,
-    0xe5a694,
-    0xe5a695,
-    0xe5a696,
-    0xe5a697,
-    0xe5a698,
-    0xe5a699,
-    0xe5a69a,
-    0xe5a69b,
-    0xe5a69c,
-    0xe5a69d,
-    0xe5a69e,
-    0xe5a69f,
-    0xe5a6a0,
-    0xe5a6a1,
-    0xe5a6a2,
-    0xe5a6a3,
-    0xe5a6a4,
-    0xe5a6a5,
-    0xe5a6a6,
-    0xe5a6a7,
-    0xe5a6a8,
-    0xe5a6a9,
-    0xe5a6aa,
-    0xe5a6ab,
-    0xe5a6ac,
-    0xe5a6ad,
-    0xe5a6ae,
-    0xe5a6af,
-    0xe5a6b0,
-    0xe5a6b1,
-    0xe5a6b2,
-    0xe5a6b3,
-    0xe5a6b4,
-    0xe5a6b5,
-    0xe5a6b6,
-    0xe5a6b7,
-    0xe5a6b8,
-    0xe5a6b9,
-    0xe5a6ba,
-    0xe5a6bb,
-    0xe5a6bc,
-    0xe5a6bd,
-    0xe5a6be,
-    0xe5a6bf,
-    0xe5a780,
-    0xe5a781,
-    0xe5a782,
-    0xe5a783,
-    0xe5a784,
-    0xe5a785,
-    0xe5a786,
-    0xe5a787,
-    0xe5a788,
-    0xe5a789,
-    0xe5a78a,
-    0xe5a78b,
-    0xe5a78c,
-    0xe5a78d,
-    0xe5a78e,
-    0xe5a78f,
-    0xe5a790,
-    0xe5a791,
-    0xe5a792,
-    0xe5a793,
-    0xe5a794,
-    0xe5a795,
-    0xe5a796,
-    0xe5a797,
-    0xe5a798,
-    0xe5a799,
-    0xe5a79a,
-    0xe5a79b,
-    0xe5a79c,
-    0xe5a79d,
-    0xe5a79e,
-    0xe5a79f,
-    0xe5a7a0,
-    0xe5a7a1,
-    0xe5a7a2,
-    0xe5a7a3,
-    0xe5a7a4,
-    0xe5a7a5,
-    0xe5a7a6,
-    0xe5a7a7,
-    0xe5a7a8,
-    0xe5a7a9,
-    0xe5a7aa,
-    0xe5a7ab,
-    0xe5a7ac,
-    0xe5a7ad,
-    0xe5a7ae,
-    0xe5a7af,
-    0xe5a7b0,
-    0xe5a7b1,
-    0xe5a7b2,
-    0xe5a7b3,
-    0xe5a7b4,
-    0xe5a7b5,
-    0xe5a7b6,
-    0xe5a7b7,
-    0xe5a7b8,
-    0xe5a7b9,
-    0xe5a7ba,
-    0xe5a7bb,
-    0xe5a7bc,
-    0xe5a7bd,
-    0xe5a7be,
-    0xe5a7bf,
-    0xe5a880,
-    0xe5a881,
-    0xe5a882,
-    0xe5a883,
-    0xe5a884,
-    0xe5a885,
-    0xe5a886,
-    0xe5a887,
-    0xe5a888,
-    0xe5a889,
-    0xe5a88a,
-    0xe5a88b,
-    0xe5a88c,
-    0xe5a88d,
-    0xe5a88e,
-    0xe5a88f,
-    0xe5a890,
-    0xe5a891,
-    0xe5a892,
-    0xe5a893,
-    0xe5a894,
-    0xe5a895,
-    0xe5a896,
-    0xe5a897,
-    0xe5a898,
-    0xe5a899,
-    0xe5a89a,
-    0xe5a89b,
-    0xe5a89c,
-    0xe5a89d,
-    0xe5a89e,
-    0xe5a89f,
-    0xe5a8a0,
-    0xe5a8a1,
-    0xe5a8a2,
-    0xe5a8a3,
-    0xe5a8a4,
-    0xe5a8a5,
-    0xe5a8a6,
-    0xe5a8a7,
-    0xe5a8a8,
-    0xe5a8a9,
-    0xe5a8aa,
-    0xe5a8ab,
-    0xe5a8ac,
-    0xe5a8ad,
-    0xe5a8ae,
-    0xe5a8af,
-    0xe5a8b0,
-    0xe5a8b1,
-    0xe5a8b2,
-    0xe5a8b3,
-    0xe5a8b4,
-    0xe5a8b5,
-    0xe5a8b6,
-    0xe5a8b7,
-    0xe5a8b8,
-    0xe5a8b9,
-    0xe5a8ba,
-    0xe5a8bb,
-    0xe5a8bc,
-    0xe5a8bd,
-    0xe5a8be,
-    0xe5a8bf,
-    0xe5a980,
-    0xe5a981,
-    0xe5a982,
-    0xe5a983,
-    0xe5a984,
-    0xe5a985,
-    0xe5a986,
-    0xe5a987,
-    0xe5a988,
-    0xe5a989,
-    0xe5a98a,
-    0xe5a98b,
-    0xe5a98c,
-    0xe5a98d,
-    0xe5a98e,
-    0xe5a98f,
-    0xe5a990,
-    0xe5a991,
-    0xe5a992,
-    0xe5a993,
-    0xe5a994,
-    0xe5a995,
-    0xe5a996,
-    0xe5a997,
-    0xe5a998,
-    0xe5a999,
-    0xe5a99a,
-    0xe5a99b,
-    0xe5a99c,
-    0xe5a99d,
-    0xe5a99e,
-    0xe5a99f,
-    0xe5a9a0,
-    0xe5a9a1,
-    0xe5a9a2,
-    0xe5a9a3,
-    0xe5a9a4,
-    0xe5a9a5,
-    0xe5a9a6,
-    0xe5a9a7,
-    0xe5a9a8,
-    0xe5a9a9,
-    0xe5a9aa,
-    0xe5a9ab,
-    0xe5a9ac,
-    0xe5a9ad,
-    0xe5a9ae,
-    0xe5a9af,
-    0xe5a9b0,
-    0xe5a9b1,
-    0xe5a9b2,
-    0xe5a9b3,
-    0xe5a9b4,
-    0xe5a9b5,
-    0xe5a9b6,
-    0xe5a9b7,
-    0xe5a9b8,
-    0xe5a9b9,
-    0xe5a9ba,
-    0xe5a9bb,
-    0xe5a9bc,
-    0xe5a9bd,
-    0xe5a9be,
-    0xe5a9bf,
-    0xe5aa80,
-    0xe5aa81,
-    0xe5aa82,
-    0xe5aa83,
-    0xe5aa84,
-    0xe5aa85,
-    0xe5aa86,
-    0xe5aa87,
-    0xe5aa88,
-    0xe5aa89,
-    0xe5aa8a,
-    0xe5aa8b,
-    0xe5aa8c,
-    0xe5aa8d,
-    0xe5aa8e,
-    0xe5aa8f,
-    0xe5aa90,
-    0xe5aa91,
-    0xe5aa92,
-    0xe5aa93,
-    0xe5aa94,
-    0xe5aa95,
-    0xe5aa96,
-    0xe5aa97,
-    0xe5aa98,
-    0xe5aa99,
-    0xe5aa9a,
-    0xe5aa9b,
-    0xe5aa9c,
-    0xe5aa9d,
-    0xe5aa9e,
-    0xe5aa9f,
-    0xe5aaa0,
-    0xe5aaa1,
-    0xe5aaa2,
-    0xe5aaa3,
-    0xe5aaa4,
-    0xe5aaa5,
-    0xe5aaa6,
-    0xe5aaa7,
-    0xe5aaa8,
-    0xe5aaa9,
-    0xe5aaaa,
-    0xe5aaab,
-    0xe5aaac,
-    0xe5aaad,
-    0xe5aaae,
-    0xe5aaaf,
-    0xe5aab0,
-    0xe5aab1,
-    0xe5aab2,
-    0xe5aab3,
-    0xe5aab4,
-    0xe5aab5,
-    0xe5aab6,
-    0xe5aab7,
-    0xe5aab8,
-    0xe5aab9,
-    0xe5aaba,
-    0xe5aabb,
-    0xe5aabc,
-    0xe5aabd,
-    0xe5aabe,
-    0xe5aabf,
-    0xe5ab80,
-    0xe5ab81,
-    0xe5ab82,
-    0xe5ab83,
-    0xe5ab84,
-    0xe5ab85,
-    0xe5ab86,
-    0xe5ab87,
-    0xe5ab88,
-    0xe5ab89,
-    0xe5ab8a,
-    0xe5ab8b,
-    0xe5ab8c,
-    0xe5ab8d,
-    0xe5ab8e,
-    0xe5ab8f,
-    0xe5ab90,
-    0xe5ab91,
-    0xe5ab92,
-    0xe5ab93,
-    0xe5ab94,
-    0xe5ab95,
-    0xe5ab96,
-    0xe5ab97,
-    0xe5ab98,
-    0xe5ab99,
-    0xe5ab9a,
-    0xe5ab9b,
-    0xe5ab9c,
-    0xe5ab9d,
-    0xe5ab9e,
-    0xe5ab9f,
-    0xe5aba0,
-    0xe5aba1,
-    0xe5aba2,
-    0xe5aba3,
-    0xe5aba4,
-    0xe5aba5,
-    0xe5aba6,
-    0xe5aba7,
-    0xe5aba8,
-    0xe5aba9,
-    0xe5abaa,
-    0xe5abab,
-    0xe5abac,
-    0xe5abad,
-    0xe5abae,
-    0xe5abaf,
-    0xe5abb0,
-    0xe5abb1,
-    0xe5abb2,
-    0xe5abb3,
-    0xe5abb4,
-    0xe5abb5,
-    0xe5abb6,
-    0xe5abb7,
-    0xe5abb8,
-    0xe5abb9,
-    0xe5abba,
-    0xe5abbb,
-    0xe5abbc,
-    0xe5abbd,
-    0xe5abbe,
-    0xe5abbf,
-    0xe5ac80,
-    0xe5ac81,
-    0xe5ac82,
-    0xe5ac83,
-    0xe5ac84,
-    0xe5ac85,
-    0xe5ac86,
-    0xe5ac87,
-    0xe5ac88,
-    0xe5ac89,
-    0xe5ac8a,
-    0xe5ac8b,
-    0xe5ac8c,
-    0xe5ac8d,
-    0xe5ac8e,
-    0xe5ac8f,
-    0xe5ac90,
-    0xe5ac91,
-    0xe5ac92,
-    0xe5ac93,
-    0xe5ac94,
-    0xe5ac95,
-    0xe5ac96,
-    0xe5ac97,
-    0xe5ac98,
-    0xe5ac99,
-    0xe5ac9a,
-    0xe5ac9b,
-    0xe5ac9c,
-    0xe5ac9d,
-    0xe5ac9e,
-    0xe5ac9f,
-    0xe5aca0,
-    0xe5aca1,
-    0xe5aca2,
-    0xe5aca3,
-    0xe5aca4,
-    0xe5aca5,
-    0xe5aca6,
-    0xe5aca7,
-    0xe5aca8,
-    0xe5aca9,
-    0xe5acaa,
-    0xe5acab,
-    0xe5acac,
-    0xe5acad,
-    0xe5acae,
-    0xe5acaf,
-    0xe5acb0,
-    0xe5acb1,
-    0xe5acb2,
-    0xe5acb3,
-    0xe5acb4,
-    0xe5acb5,
-    0xe5acb6,
-    0xe5acb7,
-    0xe5acb8,
-    0xe5acb9,
-    0xe5acba,
-    0xe5acbb,
-    0xe5acbc,
-    0xe5acbd,
-    0xe5acbe,
-    0xe5acbf,
-    0xe5ad80,
-    0xe5ad81,
-    0xe5ad82,
-    0xe5ad83,
-    0xe5ad84,
-    0xe5ad85,
-    0xe5ad86,
-    0xe5ad87,
-    0xe5ad88,
-    0xe5ad89,
-    0xe5ad8a,
-    0xe5ad8b,
-    0xe5ad8c,
-    0xe5ad8d,
-    0xe5ad8e,
-    0xe5ad8f,
-    0xe5ad90,
-    0xe5ad91,
-    0xe5ad92,
-    0xe5ad93,
-    0xe5ad94,
-    0xe5ad95,
-    0xe5ad96,
-    0xe5ad97,
-    0xe5ad98,
-    0xe5ad99,
-    0xe5ad9a,
-    0xe5ad9b,
-    0xe5ad9c,
-    0xe5ad9d,
-    0xe5ad9e,
-    0xe5ad9f,
-    0xe5ada0,
-    0xe5ada1,
-    0xe5ada2,
-    0xe5ada3,
-    0xe5ada4,
-    0xe5ada5,
-    0xe5ada6,
-    0xe5ada7,
-    0xe5ada8,
-    0xe5ada9,
-    0xe5adaa,
-    0xe5adab,
-    0xe5adac,
-    0xe5adad,
-    0xe5adae,
-    0xe5adaf,
-    0xe5adb0,
-    0xe5adb1,
-    0xe5adb2,
-    0xe5adb3,
-    0xe5adb4,
-    0xe5adb5,
-    0xe5adb6,
-    0xe5adb7,
-    0xe5adb8,
-    0xe5adb9,
-    0xe5adba,
-    0xe5adbb,
-    0xe5adbc,
-    0xe5adbd,
-    0xe5adbe,
-    0xe5adbf,
-    0xe5ae80,
-    0xe5ae81,
-    0xe5ae82,
-    0xe5ae83,
-    0xe5ae84,
-    0xe5ae85,
-    0xe5ae86,
-    0xe5ae87,
-    0xe5ae88,
-    0xe5ae89,
-    0xe5ae8a,
-    0xe5ae8b,
-    0xe5ae8c,
-    0xe5ae8d,
-    0xe5ae8e,
-    0xe5ae8f,
-    0xe5ae90,
-    0xe5ae91,
-    0xe5ae92,
-    0xe5ae93,
-    0xe5ae94,
-    0xe5ae95,
-    0xe5ae96,
-    0xe5ae97,
-    0xe5ae98,
-    0xe5ae99,
-    0xe5ae9a,
-    0xe5ae9b,
-    0xe5ae9c,
-    0xe5ae9d,
-    0xe5ae9e,
-    0xe5ae9f,
-    0xe5aea0,
-    0xe5aea1,
-    0xe5aea2,
-    0xe5aea3,
-    0xe5aea4,
-    0xe5aea5,
-    0xe5aea6,
-    0xe5aea7,
-    0xe5aea8,
-    0xe5aea9,
-    0xe5aeaa,
-    0xe5aeab,
-    0xe5aeac,
-    0xe5aead,
-    0xe5aeae,
-    0xe5aeaf,
-    0xe5aeb0,
-    0xe5aeb1,
-    0xe5aeb2,
-    0xe5aeb3,
-    0xe5aeb4,
-    0xe5aeb5,
-    0xe5aeb6,
-    0xe5aeb7,
-    0xe5aeb8,
-    0xe5aeb9,
-    0xe5aeba,
-    0xe5aebb,
-    0xe5aebc,
-    0xe5aebd,
-    0xe5aebe,
-    0xe5aebf,
-    0xe5af80,
-    0xe5af81,
-    0xe5af82,
-    0xe5af83,
-    0xe5af84,
-    0xe5af85,
-    0xe5af86,
-    0xe5af87,
-    0xe5af88,
-    0xe5af89,
-    0xe5af8a,
-    0xe5af8b,
-    0xe5af8c,
-    0xe5af8d,
-    0xe5af8e,
-    0xe5af8f,
-    0xe5af90,
-    0xe5af91,
-    0xe5af92,
-    0xe5af93,
-    0xe5af94,
-    0xe5af95,
-    0xe5af96,
-    0xe5af97,
-    0xe5af98,
-    0xe5af99,
-    0xe5af9a,
-    0xe5af9b,
-    0xe5af9c,
-    0xe5af9d,
-    0xe5af9e,
-    0xe5af9f,
-    0xe5afa0,
-    0xe5afa1,
-    0xe5afa2,
-    0xe5afa3,
-    0xe5afa4,
-    0xe5afa5,
-    0xe5afa6,
-    0xe5afa7,
-    0xe5afa8,
-    0xe5afa9,
-    0xe5afaa,
-    0xe5afab,
-    0xe5afac,
-    0xe5afad,
-    0xe5afae,
-    0xe5afaf,
-    0xe5afb0,
-    0xe5afb1,
-    0xe5afb2,
-    0xe5afb3,
-    0xe5afb4,
-    0xe5afb5,
-    0xe5afb6,
-    0xe5afb7,
-    0xe5afb8,
-    0xe5afb9,
-    0xe5afba,
-    0xe5afbb,
-    0xe5afbc,
-    0xe5afbd,
-    0xe5afbe,
-    0xe5afbf,
-    0xe5b080,
-    0xe5b081,
-    0xe5b082,
-    0xe5b083,
-    0xe5b084,
-    0xe5b085,
-    0xe5b086,
-    0xe5b087,
-    0xe5b088,
-    0xe5b089,
-    0xe5b08a,
-    0xe5b08b,
-    0xe5b08c,
-    0xe5b08d,
-    0xe5b08e,
-    0xe5b08f,
-    0xe5b090,
-    0xe5b091,
-    0xe5b092,
-    0xe5b093,
-    0xe5b094,
-    0xe5b095,
-    0xe5b096,
-    0xe5b097,
-    0xe5b098,
-    0xe5b099,
-    0xe5b09a,
-    0xe5b09b,
-    0xe5b09c,
-    0xe5b09d,
-    0xe5b09e,
-    0xe5b09f,
-    0xe5b0a0,
-    0xe5b0a1,
-    0xe5b0a2,
-    0xe5b0a3,
-    0xe5b0a4,
-    0xe5b0a5,
-    0xe5b0a6,
-    0xe5b0a7,
-    0xe5b0a8,
-    0xe5b0a9,
-    0xe5b0aa,
-    0xe5b0ab,
-    0xe5b0ac,
-    0xe5b0ad,
-    0xe5b0ae,
-    0xe5b0af,
-    0xe5b0b0,
-    0xe5b0b1,
-    0xe5b0b2,
-    0xe5b0b3,
-    0xe5b0b4,
-    0xe5b0b5,
-    0xe5b0b6,
-    0xe5b0b7,
-    0xe5b0b8,
-    0xe5b0b9,
-    0xe5b0ba,
-    0xe5b0bb,
-    0xe5b0bc,
-    0xe5b0bd,
-    0xe5b0be,
-    0xe5b0bf,
-    0xe5b180,
-    0xe5b181,
-    0xe5b182,
-    0xe5b183,
-    0xe5b184,
-    0xe5b185,
-    0xe5b186,
-    0xe5b187,
-    0xe5b188,
-    0xe5b189,
-    0xe5b18a,
-    0xe5b18b,
-    0xe5b18c,
-    0xe5b18d,
-    0xe5b18e,
-    0xe5b18f,
-    0xe5b190,
-    0xe5b191,
-    0xe5b192,
-    0xe5b193,
-    0xe5b194,
-    0xe5b195,
-    0xe5b196,
-    0xe5b197,
-    0xe5b198,
-    0xe5b199,
-    0xe5b19a,
-    0xe5b19b,
-    0xe5b19c,
-    0xe5b19d,
-    0xe5b19e,
-    0xe5b19f,
-    0xe5b1a0,
-    0xe5b1a1,
-    0xe5b1a2,
-    0xe5b1a3,
-    0xe5b1a4,
-    0xe5b1a5,
-    0xe5b1a6,
-    0xe5b1a7,
-    0xe5b1a8,
-    0xe5b1a9,
-    0xe5b1aa,
-    0xe5b1ab,
-    0xe5b1ac,
-    0xe5b1ad,
-    0xe5b1ae,
-    0xe5b1af,
-    0xe5b1b0,
-    0xe5b1b1,
-    0xe5b1b2,
-    0xe5b1b3,
-    0xe5b1b4,
-    0xe5b1b5,
-    0xe5b1b6,
-    0xe5b1b7,
-    0xe5b1b8,
-    0xe5b1b9,
-    0xe5b1ba,
-    0xe5b1bb,
-    0xe5b1bc,
-    0xe5b1bd,
-    0xe5b1be,
-    0xe5b1bf,
-    0xe5b280,
-    0xe5b281,
-    0xe5b282,
-    0xe5b283,
-    0xe5b284,
-    0xe5b285,
-    0xe5b286,
-    0xe5b287,
-    0xe5b288,
-    0xe5b289,
-    0xe5b28a,
-    0xe5b28b,
-    0xe5b28c,
-    0xe5b28d,
-    0xe5b28e,
-    0xe5b28f,
-    0xe5b290,
-    0xe5b291,
-    0xe5b292,
-    0xe5b293,
-    0xe5b294,
-    0xe5b295,
-    0xe5b296,
-    0xe5b297,
-    0xe5b298,
-    0xe5b299,
-    0xe5b29a,
-    0xe5b29b,
-    0xe5b29c,
-    0xe5b29d,
-    0xe5b29e,
-    0xe5b29f,
-    0xe5b2a0,
-    0xe5b2a1,
-    0xe5b2a2,
-    0xe5b2a3,
-    0xe5b2a4,
-    0xe5b2a5,
-    0xe5b2a6,
-    0xe5b2a7,
-    0xe5b2a8,
-    0xe5b2a9,
-    0xe5b2aa,
-    0xe5b2ab,
-    0xe5b2ac,
-    0xe5b2ad,
-    0xe5b2ae,
-    0xe5b2af,
-    0xe5b2b0,
-    0xe5b2b1,
-    0xe5b2b2,
-    0xe5b2b3,
-    0xe5b2b4,
-    0xe5b2b5,
-    0xe5b2b6,
-    0xe5b2b7,
-    0xe5b2b8,
-    0xe5b2b9,
-    0xe5b2ba,
-    0xe5b2bb,
-    0xe5b2bc,
-    0xe5b2bd,
-    0xe5b2be,
-    0xe5b2bf,
-    0xe5b380,
-    0xe5b381,
-    0xe5b382,
-    0xe5b383,
-    0xe5b384,
-    0xe5b385,
-    0xe5b386,
-    0xe5b387,
-    0xe5b388,
-    0xe5b389,
-    0xe5b38a,
-    0xe5b38b,
-    0xe5b38c,
-    0xe5b38d,
-    0xe5b38e,
-    0xe5b38f,
-    0xe5b390,
-    0xe5b391,
-    0xe5b392,
-    0xe5b393,
-    0xe5b394,
-    0xe5b395,
-    0xe5b396,
-    0xe5b397,
-    0xe5b398,
-    0xe5b399,
-    0xe5b39a,
-    0xe5b39b,
-    0xe5b39c,
-    0xe5b39d,
-    0xe5b39e,
-    0xe5b39f,
-    0xe5b3a0,
-    0xe5b3a1,
-    0xe5b3a2,
-    0xe5b3a3,
-    0xe5b3a4,
-    0xe5b3a5,
-    0xe5b3a6,
-    0xe5b3a7,
-    0xe5b3a8,
-    0xe5b3a9,
-    0xe5b3aa,
-    0xe5b3ab,
-    0xe5b3ac,
-    0xe5b3ad,
-    0xe5b3ae,
-    0xe5b3af,
-    0xe5b3b0,
-    0xe5b3b1,
-    0xe5b3b2,
-    0xe5b3b3,
-    0xe5b3b4,
-    0xe5b3b5,
-    0xe5b3b6,
-    0xe5b3b7,
-    0xe5b3b8,
-    0xe5b3b9,
-    0xe5b3ba,
-    0xe5b3bb,
-    0xe5b3bc,
-    0xe5b3bd,
-    0xe5b3be,
-    0xe5b3bf,
-    0xe5b480,
-    0xe5b481,
-    0xe5b482,
-    0xe5b483,
-    0xe5b484,
-    0xe5b485,
-    0xe5b486,
-    0xe5b487,
-    0xe5b488,
-    0xe5b489,
-    0xe5b48a,
-    0xe5b48b,
-    0xe5b48c,
-    0xe5b48d,
-    0xe5b48e,
-    0xe5b48f,
-    0xe5b490,
-    0xe5b491,
-    0xe5b492,
-    0xe5b493,
-    0xe5b494,
-    0xe5b495,
-    0xe5b496,
-    0xe5b497,
-    0xe5b498,
-    0xe5b499,
-    0xe5b49a,
-    0xe5b49b,
-    0xe5b49c,
-    0xe5b49d,
-    0xe5b49e,
-    0xe5b49f,
-    0xe5b4a0,
-    0xe5b4a1,
-    0xe5b4a2,
-    0xe5b4a3,
-    0xe5b4a4,
-    0xe5b4a5,
-    0xe5b4a6,
-    0xe5b4a7,
-    0xe5b4a8,
-    0xe5b4a9,
-    0xe5b4aa,
-    0xe5b4ab,
-    0xe5b4ac,
-    0xe5b4ad,
-    0xe5b4ae,
-    0xe5b4af,
-    0xe5b4b0,
-    0xe5b4b1,
-    0xe5b4b2,
-    0xe5b4b3,
-    0xe5b4b4,
-    0xe5b4b5,
-    0xe5b4b6,
-    0xe5b4b7,
-    0xe5b4b8,
-    0xe5b4b9,
-    0xe5b4ba,
-    0xe5b4bb,
-    0xe5b4bc,
-    0xe5b4bd,
-    0xe5b4be,
-    0xe5b4bf,
-    0xe5b580,
-    0xe5b581,
-    0xe5b582,
-    0xe5b583,
-    0xe5b584,
-    0xe5b585,
-    0xe5b586,
-    0xe5b587,
-    0xe5b588,
-    0xe5b589,
-    0xe5b58a,
-    0xe5b58b,
-    0xe5b58c,
-    0xe5b58d,
-    0xe5b58e,
-    0xe5b58f,
-    0xe5b590,
-    0xe5b591,
-    0xe5b592,
-    0xe5b593,
-    0xe5b594,
-    0xe5b595,
-    0xe5b596,
-    0xe5b597,
-    0xe5b598,
-    0xe5b599,
-    0xe5b59a,
-    0xe5b59b,
-    0xe5b59c,
-    0xe5b59d,
-    0xe5b59e,
-    0xe5b59f,
-    0xe5b5a0,
-    0xe5b5a1,
-    0xe5b5a2,
-    0xe5b5a3,
-    0xe5b5a4,
-    0xe5b5a5,
-    0xe5b5a6,
-    0xe5b5a7,
-    0xe5b5a8,
-    0xe5b5a9,
-    0xe5b5aa,
-    0xe5b5ab,
-    0xe5b5ac,
-    0xe5b5ad,
-    0xe5b5ae,
-    0xe5b5af,
-    0xe5b5b0,
-    0xe5b5b1,
-    0xe5b5b2,
-    0xe5b5b3,
-    0xe5b5b4,
-    0xe5b5b5,
-    0xe5b5b6,
-    0xe5b5b7,
-    0xe5b5b8,
-    0xe5b5b9,
-    0xe5b5ba,
-    0xe5b5bb,
-    0xe5b5bc,
-    0xe5b5bd,
-    0xe5b5be,
-    0xe5b5bf,
-    0xe5b680,
-    0xe5b681,
-    0xe5b682,
-    0xe5b683,
-    0xe5b684,
-    0xe5b685,
-    0xe5b686,
-    0xe5b687,
-    0xe5b688,
-    0xe5b689,
-    0xe5b68a,
-    0xe5b68b,
-    0xe5b68c,
-    0xe5b68d,
-    0xe5b68e,
-    0xe5b68f,
-    0xe5b690,
-    0xe5b691,
-    0xe5b692,
-    0xe5b693,
-    0xe5b694,
-    0xe5b695,
-    0xe5b696,
-    0xe5b697,
-    0xe5b698,
-    0xe5b699,
-    0xe5b69a,
-    0xe5b69b,
-    0xe5b69c,
-    0xe5b69d,
-    0xe5b69e,
-    0xe5b69f,
-    0xe5b6a0,
-    0xe5b6a1,
-    0xe5b6a2,
-    0xe5b6a3,
-    0xe5b6a4,
-    0xe5b6a5,
-    0xe5b6a6,
-    0xe5b6a7,
-    0xe5b6a8,
-    0xe5b6a9,
-    0xe5b6aa,
-    0xe5b6ab,
-    0xe5b6ac,
-    0xe5b6ad,
-    0xe5b6ae,
-    0xe5b6af,
-    0xe5b6b0,
-    0xe5b6b1,
-    0xe5b6b2,
-    0xe5b6b3,
-    0xe5b6b4,
-    0xe5b6b5,
-    0xe5b6b6,
-    0xe5b6b7,
-    0xe5b6b8,
-    0xe5b6b9,
-    0xe5b6ba,
-    0xe5b6bb,
-    0xe5b6bc,
-    0xe5b6bd,
-    0xe5b6be,
-    0xe5b6bf,
-    0xe5b780,
-    0xe5b781,
-    0xe5b782,
-    0xe5b783,
-    0xe5b784,
-    0xe5b785,
-    0xe5b786,
-    0xe5b787,
-    0xe5b788,
-    0xe5b789,
-    0xe5b78a,
-    0xe5b78b,
-    0xe5b78c,
-    0xe5b78d,
-    0xe5b78e,
-    0xe5b78f,
-    0xe5b790,
-    0xe5b791,
-    0xe5b792,
-    0xe5b793,
-    0xe5b794,
-    0xe5b795,
-    0xe5b796,
-    0xe5b797,
-    0xe5b798,
-    0xe5b799,
-    0xe5b79a,
-    0xe5b79b,
-    0xe5b79c,
-    0xe5b79d,
-    0xe5b79e,
-    0xe5b79f,
-    0xe5b7a0,
-    0xe5b7a1,
-    0xe5b7a2,
-    0xe5b7a3,
-    0xe5b7a4,
-    0xe5b7a5,
-    0xe5b7a6,
-    0xe5b7a7,
-    0xe5b7a8,
-    0xe5b7a9,
-    0xe5b7aa,
-    0xe5b7ab,
-    0xe5b7ac,
-    0xe5b7ad,
-    0xe5b7ae,
-    0xe5b7af,
-    0xe5b7b0,
-    0xe5b7b1,
-    0xe5b7b2,
-    0xe5b7b3,
-    0xe5b7b4,
-    0xe5b7b5,
-    0xe5b7b6,
-    0xe5b7b7,
-    0xe5b7b8,
-    0xe5b7b9,
-    0xe5b7ba,
-    0xe5b7bb,
-    0xe5b7bc,
-    0xe5b7bd,
-    0xe5b7be,
-    0xe5b7bf,
-    0xe5b880,
-    0xe5b881,
-    0xe5b882,
-    0xe5b883,
-    0xe5b884,
-    0xe5b885,
-    0xe5b886,
-    0xe5b887,
-    0xe5b888,
-    0xe5b889,
-    0xe5b88a,
-    0xe5b88b,
-    0xe5b88c,
-    0xe5b88d,
-    0xe5b88e,
-    0xe5b88f,
-    0xe5b890,
-    0xe5b891,
-    0xe5b892,
-    0xe5b893,
-    0xe5b894,
-    0xe5b895,
-    0xe5b896,
-    0xe5b897,
-    0xe5b898,
-    0xe5b899,
-    0xe5b89a,
-    0xe5b89b,
-    0xe5b89c,
-    0xe5b89d,
-    0xe5b89e,
-    0xe5b89f,
-    0xe5b8a0,
-    0xe5b8a1,
-    0xe5b8a2,
-    0xe5b8a3,
-    0xe5b8a4,
-    0xe5b8a5,
-    0xe5b8a6,
-    0xe5b8a7,
-    0xe5b8a8,
-    0xe5b8a9,
-    0xe5b8aa,
-    0xe5b8ab,
-    0xe5b8ac,
-    0xe5b8ad,
-    0xe5b8ae,
-    0xe5b8af,
-    0xe5b8b0,
-    0xe5b8b1,
-    0xe5b8b2,
-    0xe5b8b3,
-    0xe5b8b4,
-    0xe5b8b5,
-    0xe5b8b6,
-    0xe5b8b7,
-    0xe5b8b8,
-    0xe5b8b9,
-    0xe5b8ba,
-    0xe5b8bb,
-    0xe5b8bc,
-    0xe5b8bd,
-    0xe5b8be,
-    0xe5b8bf,
-    0xe5b980,
-    0xe5b981,
-    0xe5b982,
-    0xe5b983,
-    0xe5b984,
-    0xe5b985,
-    0xe5b986,
-    0xe5b987,
-    0xe5b988,
-    0xe5b989,
-    0xe5b98a,
-    0xe5b98b,
-    0xe5b98c,
-    0xe5b98d,
-    0xe5b98e,
-    0xe5b98f,
-    0xe5b990,
-    0xe5b991,
-    0xe5b992,
-    0xe5b993,
-    0xe5b994,
-    0xe5b995,
-    0xe5b996,
-    0xe5b997,
-    0xe5b998,
-    0xe5b999,
-    0xe5b99a,
-    0xe5b99b,
-    0xe5b99c,
-    0xe5b99d,
-    0xe5b99e,
-    0xe5b99f,
-    0xe5b9a0,
-    0xe5b9a1,
-    0xe5b9a2,
-    0xe5b9a3,
-    0xe5b9a4,
-    0xe5b9a5,
-    0xe5b9a6,
-    0xe5b9a7,
-    0xe5b9a8,
-    0xe5b9a9,
-    0xe5b9aa,
-    0xe5b9ab,
-    0xe5b9ac,
-    0xe5b9ad,
-    0xe5b9ae,
-    0xe5b9af,
-    0xe5b9b0,
-    0xe5b9b1,
-    0xe5b9b2,
-    0xe5b9b3,
-    0xe5b9b4,
-    0xe5b9b5,
-    0xe5b9b6,
-    0xe5b9b7,
-    0xe5b9b8,
-    0xe5b9b9,
-    0xe5b9ba,
-    0xe5b9bb,
-    0xe5b9bc,
-    0xe5b9bd,
-    0xe5b9be,
-    0xe5b9bf,
-    0xe5ba80,
-    0xe5ba81,
-    0xe5ba82,
-    0xe5ba83,
-    0xe5ba84,
-    0xe5ba85,
-    0xe5ba86,
-    0xe5ba87,
-    0xe5ba88,
-    0xe5ba89,
-    0xe5ba8a,
-    0xe5ba8b,
-    0xe5ba8c,
-    0xe5ba8d,
-    0xe5ba8e,
-    0xe5ba8f,
-    0xe5ba90,
-    0xe5ba91,
-    0xe5ba92,
-    0xe5ba93,
-    0xe5ba94,
-    0xe5ba95,
-    0xe5ba96,
-    0xe5ba97,
-    0xe5ba98,
-    0xe5ba99,
-    0xe5ba9a,
-    0xe5ba9b,
-    0xe5ba9c,
-    0xe5ba9d,
-    0xe5ba9e,
-    0xe5ba9f,
-    0xe5baa0,
-    0xe5baa1,
-    0xe5baa2,
-    0xe5baa3,
-    0xe5baa4,
-    0xe5baa5,
-    0xe5baa6,
-    0xe5baa7,
-    0xe5baa8,
-    0xe5baa9,
-    0xe5baaa,
-    0xe5baab,
-    0xe5baac,
-    0xe5baad,
-    0xe5baae,
-    0xe5baaf,
-    0xe5bab0,
-    0xe5bab1,
-    0xe5bab2,
-    0xe5bab3,
-    0xe5bab4,
-    0xe5bab5,
-    0xe5bab6,
-    0xe5bab7,
-    0xe5bab8,
-    0xe5bab9,
-    0xe5baba,
-    0xe5babb,
-    0xe5babc,
-    0xe5babd,
-    0xe5babe,
-    0xe5babf,
-    0xe5bb80,
-    0xe5bb81,
-    0xe5bb82,
-    0xe5bb83,
-    0xe5bb84,
-    0xe5bb85,
-    0xe5bb86,
-    0xe5bb87,
-    0xe5bb88,
-    0xe5bb89,
-    0xe5bb8a,
-    0xe5bb8b,
-    0xe5bb8c,
-    0xe5bb8d,
-    0xe5bb8e,
-    0xe5bb8f,
-    0xe5bb90,
-    0xe5bb91,
-    0xe5bb92,
-    0xe5bb93,
-    0xe5bb94,
-    0xe5bb95,
-    0xe5bb96,
-    0xe5bb97,
-    0xe5bb98,
-    0xe5bb99,
-    0xe5bb9a,
-    0xe5bb9b,
-    0xe5bb9c,
-    0xe5bb9d,
-    0xe5bb9e,
-    0xe5bb9f,
-    0xe5bba0,
-    0xe5bba1,
-    0xe5bba2,
-    0xe5bba3,
-    0xe5bba4,
-    0xe5bba5,
-    0xe5bba6,
-    0xe5bba7,
-    0xe5bba8,
-    0xe5bba9,
-    0xe5bbaa,
-    0xe5bbab,
-    0xe5bbac,
-    0xe5bbad,
-    0xe5bbae,
-    0xe5bbaf,
-    0xe5bbb0,
-    0xe5bbb1,
-    0xe5bbb2,
-    0xe5bbb3,
-    0xe5bbb4,
-    0xe5bbb5,
-    0xe5bbb6,
-    0xe5bbb7,
-    0xe5bbb8,
-    0xe5bbb9,
-    0xe5bbba,
-    0xe5bbbb,
-    0xe5bbbc,
-    0xe5bbbd,
-    0xe5bbbe,
-    0xe5bbbf,
-    0xe5bc80,
-    0xe5bc81,
-    0xe5bc82,
-    0xe5bc83,
-    0xe5bc84,
-    0xe5bc85,
-    0xe5bc86,
-    0xe5bc87,
-    0xe5bc88,
-    0xe5bc89,
-    0xe5bc8a,
-    0xe5bc8b,
-    0xe5bc8c,
-    0xe5bc8d,
-    0xe5bc8e,
-    0xe5bc8f,
-    0xe5bc90,
-    0xe5bc91,
-    0xe5bc92,
-    0xe5bc93,
-    0xe5bc94,
-    0xe5bc95,
-    0xe5bc96,
-    0xe5bc97,
-    0xe5bc98,
-    0xe5bc99,
-    0xe5bc9a,
-    0xe5bc9b,
-    0xe5bc9c,
-    0xe5bc9d,
-    0xe5bc9e,
-    0xe5bc9f,
-    0xe5bca0,
-    0xe5bca1,
-    0xe5bca2,
-    0xe5bca3,
-    0xe5bca4,
-    0xe5bca5,
-    0xe5bca6,
-    0xe5bca7,
-    0xe5bca8,
-    0xe5bca9,
-    0xe5bcaa,
-    0xe5bcab,
-    0xe5bcac,
-    0xe5bcad,
-    0xe5bcae,
-    0xe5bcaf,
-    0xe5bcb0,
-    0xe5bcb1,
-    0xe5bcb2,
-    0xe5bcb3,
-    0xe5bcb4,
-    0xe5bcb5,
-    0xe5bcb6,
-    0xe5bcb7,
-    0xe5bcb8,
-    0xe5bcb9,
-    0xe5bcba,
-    0xe5bcbb,
-    0xe5bcbc,
-    0xe5bcbd,
-    0xe5bcbe,
-    0xe5bcbf,
-    0xe5bd80,
-    0xe5bd81,
-    0xe5bd82,
-    0xe5bd83,
-    0xe5bd84,
-    0xe5bd85,
-    0xe5bd86,
-    0xe5bd87,
-    0xe5bd88,
-    0xe5bd89,
-    0xe5bd8a,
-    0xe5bd8b,
-    0xe5bd8c,
-    0xe5bd8d,
-    0xe5bd8e,
-    0xe5bd8f,
-    0xe5bd90,
-    0xe5bd91,
-    0xe5bd92,
-    0xe5bd93,
-    0xe5bd94,
-    0xe5bd95,
-    0xe5bd96,
-    0xe5bd97,
-    0xe5bd98,
-    0xe5bd99,
-    0xe5bd9a,
-    0xe5bd9b,
-    0xe5bd9c,
-    0xe5bd9d,
-    0xe5bd9e,
-    0xe5bd9f,
-    0xe5bda0,
-    0xe5bda1,
-    0xe5bda2,
-    0xe5bda3,
-    0xe5bda4,
-    0xe5bda5,
-    0xe5bda6,
-    0xe5bda7,
-    0xe5bda8,
-    0xe5bda9,
-    0xe5bdaa,
-    0xe5bdab,
-    0xe5bdac,
-    0xe5bdad,
-    0xe5bdae,
-    0xe5bdaf,
-    0xe5bdb0,
-    0xe5bdb1,
-    0xe5bdb2,
-    0xe5bdb3,
-    0xe5bdb4,
-    0xe5bdb5,
-    0xe5bdb6,
-    0xe5bdb7,
-    0xe5bdb8,
-    0xe5bdb9,
-    0xe5bdba,
-    0xe5bdbb,
-    0xe5bdbc,
-    0xe5bdbd,
-    0xe5bdbe,
-    0xe5bdbf,
-    0xe5be80,
-    0xe5be81,
-    0xe5be82,
-    0xe5be83,
-    0xe5be84,
-    0xe5be85,
-    0xe5be86,
-    0xe5be87,
-    0xe5be88,
-    0xe5be89,
-    0xe5be8a,
-    0xe5be8b,
-    0xe5be8c,
-    0xe5be8d,
-    0xe5be8e,
-    0xe5be8f,
-    0xe5be90,
-    0xe5be91,
-    0xe5be92,
-    0xe5be93,
-    0xe5be94,
-    0xe5be95,
-    0xe5be96,
-    0xe5be97,
-    0xe5be98,
-    0xe5be99,
-    0xe5be9a,
-    0xe5be9b,
-    0xe5be9c,
-    0xe5be9d,
-    0xe5be9e,
-    0xe5be9f,
-    0xe5bea0,
-    0xe5bea1,
-    0xe5bea2,
-    0xe5bea3,
-    0xe5bea4,
-    0xe5bea5,
-    0xe5bea6,
-    0xe5bea7,
-    0xe5bea8,
-    0xe5bea9,
-    0xe5beaa,
-    0xe5beab,
-    0xe5beac,
-    0xe5bead,
-    0xe5beae,
-    0xe5beaf,
-    0xe5beb0,
-    0xe5beb1,
-    0xe5beb2,
-    0xe5beb3,
-    0xe5beb4,
-    0xe5beb5,
-    0xe5beb6,
-    0xe5beb7,
-    0xe5beb8,
-    0xe5beb9,
-    0xe5beba,
-    0xe5bebb,
-    0xe5bebc,
-    0xe5bebd,
-    0xe5bebe,
-    0xe5bebf,
-    0xe5bf80,
-    0xe5bf81,
-    0xe5bf82,
-    0xe5bf83,
-    0xe5bf84,
-    0xe5bf85,
-    0xe5bf86,
-    0xe5bf87,
-    0xe5bf88,
-    0xe5bf89,
-    0xe5bf8a,
-    0xe5bf8b,
-    0xe5bf8c,
-    0xe5bf8d,
-    0xe5bf8e,
-    0xe5bf8f,
-    0xe5bf90,
-    0xe5bf91,
-    0xe5bf92,
-    0xe5bf93,
-    0xe5bf94,
-    0xe5bf95,
-    0xe5bf96,
-    0xe5bf97,
-    0xe5bf98,
-    0xe5bf99,
-    0xe5bf9a,
-    0xe5bf9b,
-    0xe5bf9c,
-    0xe5bf9d,
-    0xe5bf9e,
-    0xe5bf9f,
-    0xe5bfa0,
-    0xe5bfa1,
-    0xe5bfa2,
-    0xe5bfa3,
-    0xe5bfa4,
-    0xe5bfa5,
-    0xe5bfa6,
-    0xe5bfa7,
-    0xe5bfa8,
-    0xe5bfa9,
-    0xe5bfaa,
-    0xe5bfab,
-    0xe5bfac,
-    0xe5bfad,
-    0xe5bfae,
-    0xe5bfaf,
-    0xe5bfb0,
-    0xe5bfb1,
-    0xe5bfb2,
-    0xe5bfb3,
-    0xe5bfb4,
-    0xe5bfb5,
-    0xe5bfb6,
-    0xe5bfb7,
-    0xe5bfb8,
-    0xe5bfb9,
-    0xe5bfba,
-    0xe5bfbb,
-    0xe5bfbc,
-    0xe5bfbd,
-    0xe5bfbe,
-    0xe5bfbf,
-    0xe68080,
-    0xe68081,
-    0xe68082,
-    0xe68083,
-    0xe68084,
-    0xe68085,
-    0xe68086,
-    0xe68087,
-    0xe68088,
-    0xe68089,
-    0xe6808a,
-    0xe6808b,
-    0xe6808c,
-    0xe6808d,
-    0xe6808e,
-    0xe6808f,
-    0xe68090,
-    0xe68091,
-    0xe68092,
-    0xe68093,
-    0xe68094,
-    0xe68095,
-    0xe68096,
-    0xe68097,
-    0xe68098,
-    0xe68099,
-    0xe6809a,
-    0xe6809b,
-    0xe6809c,
-    0xe6809d,
-    0xe6809e,
-    0xe6809f,
-    0xe680a0,
-    0xe680a1,
-    0xe680a2,
-    0xe680a3,
-    0xe680a4,
-    0xe680a5,
-    0xe680a6,
-    0xe680a7,
-    0xe680a8,
-    0xe680a9,
-    0xe680aa,
-    0xe680ab,
-    0xe680ac,
-    0xe680ad,
-    0xe680ae,
-    0xe680af,
-    0xe680b0,
-    0xe680b1,
-    0xe680b2,
-    0xe680b3,
-    0xe680b4,
-    0xe680b5,
-    0xe680b6,
-    0xe680b7,
-    0xe680b8,
-    0xe680b9,
-    0xe680ba,
-    0xe680bb,
-    0xe680bc,
-    0xe680bd,
-    0xe680be,
-    0xe680bf,
-    0xe68180,
-    0xe68181,
-    0xe68182,
-    0xe68183,
-    0xe68184,
-    0xe68185,
-    0xe68186,
-    0xe68187,
-    0xe68188,
-    0xe68189,
-    0xe6818a,
-    0xe6818b,
-    0xe6818c,
-    0xe6818d,
-    0xe6818e,
-    0xe6818f,
-    0xe68190,
-    0xe68191,
-    0xe68192,
-    0xe68193,
-    0xe68194,
-    0xe68195,
-    0xe68196,
-    0xe68197,
-    0xe68198,
-    0xe68199,
-    0xe6819a,
-    0xe6819b,
-    0xe6819c,
-    0xe6819d,
-    0xe6819e,
-    0xe6819f,
-    0xe681a0,
-    0xe681a1,
-    0xe681a2,
-    0xe681a3,
-    0xe681a4,
-    0xe681a5,
-    0xe681a6,
-    0xe681a7,
-    0xe681a8,
-    0xe681a9,
-    0xe681aa,
-    0xe681ab,
-    0xe681ac,
-    0xe681ad,
-    0xe681ae,
-    0xe681af,
-    0xe681b0,
-    0xe681b1,
-    0xe681b2,
-    0xe681b3,
-    0xe681b4,
-    0xe681b5,
-    0xe681b6,
-    0xe681b7,
-    0xe681b8,
-    0xe681b9,
-    0xe681ba,
-    0xe681bb,
-    0xe681bc,
-    0xe681bd,
-    0xe681be,
-    0xe681bf,
-    0xe68280,
-    0xe68281,
-    0xe68282,
-    0xe68283,
-    0xe68284,
-    0xe68285,
-    0xe68286,
-    0xe68287,
-    0xe68288,
-    0xe68289,
-    0xe6828a,
-    0xe6828b,
-    0xe6828c,
-    0xe6828d,
-    0xe6828e,
-    0xe6828f,
-    0xe68290,
-    0xe68291,
-    0xe68292,
-    0xe68293,
-    0xe68294,
-    0xe68295,
-    0xe68296,
-    0xe68297,
-    0xe68298,
-    0xe68299,
-    0xe6829a,
-    0xe6829b,
-    0xe6829c,
-    0xe6829d,
-    0xe6829e,
-    0xe6829f,
-    0xe682a0,
-    0xe682a1,
-    0xe682a2,
-    0xe682a3,
-    0xe682a4,
-    0xe682a5,
-    0xe682a6,
-    0xe682a7,
-    0xe682a8,
-    0xe682a9,
-    0xe682aa,
-    0xe682ab,
-    0xe682ac,
-    0xe682ad,
-    0xe682ae,
-    0xe682af,
-    0xe682b0,
-    0xe682b1,
-    0xe682b2,
-    0xe682b3,
-    0xe682b4,
-    0xe682b5,
-    0xe682b6,
-    0xe682b7,
-    0xe682b8,
-    0xe682b9,
-    0xe682ba,
-    0xe682bb,
-    0xe682bc,
-    0xe682bd,
-    0xe682be,
-    0xe682bf,
-    0xe68380,
-    0xe68381,
-    0xe68382,
-    0xe68383,
-    0xe68384,
-    0xe68385,
-    0xe68386,
-    0xe68387,
-    0xe68388,
-    0xe68389,
-    0xe6838a,
-    0xe6838b,
-    0xe6838c,
-    0xe6838d,
-    0xe6838e,
-    0xe6838f,
-    0xe68390,
-    0xe68391,
-    0xe68392,
-    0xe68393,
-    0xe68394,
-    0xe68395,
-    0xe68396,
-    0xe68397,
-    0xe68398,
-    0xe68399,
-    0xe6839a,
-    0xe6839b,
-    0xe6839c,
-    0xe6839d,
-    0xe6839e,
-    0xe6839f,
-    0xe683a0,
-    0xe683a1,
-    0xe683a2,
-    0xe683a3,
-    0xe683a4,
-    0xe683a5,
-    0xe683a6,
-    0xe683a7,
-    0xe683a8,
-    0xe683a9,
-    0xe683aa,
-    0xe683ab,
-    0xe683ac,
-    0xe683ad,
-    0xe683ae,
-    0xe683af,
-    0xe683b0,
-    0xe683b1,
-    0xe683b2,
-    0xe683b3,
-    0xe683b4,
-    0xe683b5,
-    0xe683b6,
-    0xe683b7,
-    0xe683b8,
-    0xe683b9,
-    0xe683ba,
-    0xe683bb,
-    0xe683bc,
-    0xe683bd,
-    0xe683be,
-    0xe683bf,
-    0xe68480,
-    0xe68481,
-    0xe68482,
-    0xe68483,
-    0xe68484,
-    0xe68485,
-    0xe68486,
-    0xe68487,
-    0xe68488,
-    0xe68489,
-    0xe6848a,
-    0xe6848b,
-    0xe6848c,
-    0xe6848d,
-    0xe6848e,
-    0xe6848f,
-    0xe68490,
-    0xe68491,
-    0xe68492,
-    0xe68493,
-    0xe68494,
-    0xe68495,
-    0xe68496,
-    0xe68497,
-    0xe68498,
-    0xe68499,
-    0xe6849a,
-    0xe6849b,
-    0xe6849c,
-    0xe6849d,
-    0xe6849e,
-    0xe6849f,
-    0xe684a0,
-    0xe684a1,
-    0xe684a2,
-    0xe684a3,
-    0xe684a4,
-    0xe684a5,
-    0xe684a6,
-    0xe684a7,
-    0xe684a8,
-    0xe684a9,
-    0xe684aa,
-    0xe684ab,
-    0xe684ac,
-    0xe684ad,
-    0xe684ae,
-    0xe684af,
-    0xe684b0,
-    0xe684b1,
-    0xe684b2,
-    0xe684b3,
-    0xe684b4,
-    0xe684b5,
-    0xe684b6,
-    0xe684b7,
-    0xe684b8,
-    0xe684b9,
-    0xe684ba,
-    0xe684bb,
-    0xe684bc,
-    0xe684bd,
-    0xe684be,
-    0xe684bf,
-    0xe68580,
-    0xe68581,
-    0xe68582,
-    0xe68583,
-    0xe68584,
-    0xe68585,
-    0xe68586,
-    0xe68587,
-    0xe68588,
-    0xe68589,
-    0xe6858a,
-    0xe6858b,
-    0xe6858c,
-    0xe6858d,
-    0xe6858e,
-    0xe6858f,
-    0xe68590,
-    0xe68591,
-    0xe68592,
-    0xe68593,
-    0xe68594,
-    0xe68595,
-    0xe68596,
-    0xe68597,
-    0xe68598,
-    0xe68599,
-    0xe6859a,
-    0xe6859b,
-    0xe6859c,
-    0xe6859d,
-    0xe6859e,
-    0xe6859f,
-    0xe685a0,
-    0xe685a1,
-    0xe685a2,
-    0xe685a3,
-    0xe685a4,
-    0xe685a5,
-    0xe685a6,
-    0xe685a7,
-    0xe685a8,
-    0xe685a9,
-    0xe685aa,
-    0xe685ab,
-    0xe685ac,
-    0xe685ad,
-    0xe685ae,
-    0xe685af,
-    0xe685b0,
-    0xe685b1,
-    0xe685b2,
-    0xe685b3,
-    0xe685b4,
-    0xe685b5,
-    0xe685b6,
-    0xe685b7,
-    0xe685b8,
-    0xe685b9,
-    0xe685ba,
-    0xe685bb,
-    0xe685bc,
-    0xe685bd,
-    0xe685be,
-    0xe685bf,
-    0xe68680,
-    0xe68681,
-    0xe68682,
-    0xe68683,
-    0xe68684,
-    0xe68685,
-    0xe68686,
-    0xe68687,
-    0xe68688,
-    0xe68689,
-    0xe6868a,
-    0xe6868b,
-    0xe6868c,
-    0xe6868d,
-    0xe6868e,
-    0xe6868f,
-    0xe68690,
-    0xe68691,
-    0xe68692,
-    0xe68693,
-    0xe68694,
-    0xe68695,
-    0xe68696,
-    0xe68697,
-    0xe68698,
-    0xe68699,
-    0xe6869a,
-    0xe6869b,
-    0xe6869c,
-    0xe6869d,
-    0xe6869e,
-    0xe6869f,
-    0xe686a0,
-    0xe686a1,
-    0xe686a2,
-    0xe686a3,
-    0xe686a4,
-    0xe686a5,
-    0xe686a6,
-    0xe686a7,
-    0xe686a8,
-    0xe686a9,
-    0xe686aa,
-    0xe686ab,
-    0xe686ac,
-    0xe686ad,
-    0xe686ae,
-    0xe686af,
-    0xe686b0,
-    0xe686b1,
-    0xe686b2,
-    0xe686b3,
-    0xe686b4,
-    0xe686b5,
-    0xe686b6,
-    0xe686b7,
-    0xe686b8,
-    0xe686b9,
-    0xe686ba,
-    0xe686bb,
-    0xe686bc,
-    0xe686bd,
-    0xe686be,
-    0xe686bf,
-    0xe68780,
-    0xe68781,
-    0xe68782,
-    0xe68783,
-    0xe68784,
-    0xe68785,
-    0xe68786,
-    0xe68787,
-    0xe68788,
-    0xe68789,
-    0xe6878a,
-    0xe6878b,
-    0xe6878c,
-    0xe6878d,
-    0xe6878e,
-    0xe6878f,
-    0xe68790,
-    0xe68791,
-    0xe68792,
-    0xe68793,
-    0xe68794,
-    0xe68795,
-    0xe68796,
-    0xe68797,
-    0xe68798,
-    0xe68799,
-    0xe6879a,
-    0xe6879b,
-    0xe6879c,
-    0xe6879d,
-    0xe6879e,
-    0xe6879f,
-    0xe687a0,
-    0xe687a1,
-    0xe687a2,
-    0xe687a3,
-    0xe687a4,
-    0xe687a5,
-    0xe687a6,
-    0xe687a7,
-    0xe687a8,
-    0xe687a9,
-    0xe687aa,
-    0xe687ab,
-    0xe687ac,
-    0xe687ad,
-    0xe687ae,
-    0xe687af,
-    0xe687b0,
-    0xe687b1,
-    0xe687b2,
-    0xe687b3,
-    0xe687b4,
-    0xe687b5,
-    0xe687b6,
-    0xe687b7,
-    0xe687b8,
-    0xe687b9,
-    0xe687ba,
-    0xe687bb,
-    0xe687bc,
-    0xe687bd,
-    0xe687be,
-    0xe687bf,
-    0xe68880,
-    0xe68881,
-    0xe68882,
-    0xe68883,
-    0xe68884,
-    0xe68885,
-    0xe68886,
-    0xe68887,
-    0xe68888,
-    0xe68889,
-    0xe6888a,
-    0xe6888b,
-    0xe6888c,
-    0xe6888d,
-    0xe6888e,
-    0xe6888f,
-    0xe68890,
-    0xe68891,
-    0xe68892,
-    0xe68893,
-    0xe68894,
-    0xe68895,
-    0xe68896,
-    0xe68897,
-    0xe68898,
-    0xe68899,
-    0xe6889a,
-    0xe6889b,
-    0xe6889c,
-    0xe6889d,
-    0xe6889e,
-    0xe6889f,
-    0xe688a0,
-    0xe688a1,
-    0xe688a2,
-    0xe688a3,
-    0xe688a4,
-    0xe688a5,
-    0xe688a6,
-    0xe688a7,
-    0xe688a8,
-    0xe688a9,
-    0xe688aa,
-    0xe688ab,
-    0xe688ac,
-    0xe688ad,
-    0xe688ae,
-    0xe688af,
-    0xe688b0,
-    0xe688b1,
-    0xe688b2,
-    0xe688b3,
-    0xe688b4,
-    0xe688b5,
-    0xe688b6,
-    0xe688b7,
-    0xe688b8,
-    0xe688b9,
-    0xe688ba,
-    0xe688bb,
-    0xe688bc,
-    0xe688bd,
-    0xe688be,
-    0xe688bf,
-    0xe68980,
-    0xe68981,
-    0xe68982,
-    0xe68983,
-    0xe68984,
-    0xe68985,
-    0xe68986,
-    0xe68987,
-    0xe68988,
-    0xe68989,
-    0xe6898a,
-    0xe6898b,
-    0xe6898c,
-    0xe6898d,
-    0xe6898e,
-    0xe6898f,
-    0xe68990,
-    0xe68991,
-    0xe68992,
-    0xe68993,
-    0xe68994,
-    0xe68995,
-    0xe68996,
-    0xe68997,
-    0xe68998,
-    0xe68999,
-    0xe6899a,
-    0xe6899b,
-    0xe6899c,
-    0xe6899d,
-    0xe6899e,
-    0xe6899f,
-    0xe689a0,
-    0xe689a1,
-    0xe689a2,
-    0xe689a3,
-    0xe689a4,
-    0xe689a5,
-    0xe689a6,
-    0xe689a7,
-    0xe689a8,
-    0xe689a9,
-    0xe689aa,
-    0xe689ab,
-    0xe689ac,
-    0xe689ad,
-    0xe689ae,
-    0xe689af,
-    0xe689b0,
-    0xe689b1,
-    0xe689b2,
-    0xe689b3,
-    0xe689b4,
-    0xe689b5,
-    0xe689b6,
-    0xe689b7,
-    0xe689b8,
-    0xe689b9,
-    0xe689ba,
-    0xe689bb,
-    0xe689bc,
-    0xe689bd,
-    0xe689be,
-    0xe689bf,
-    0xe68a80,
-    0xe68a81,
-    0xe68a82,
-    0xe68a83,
-    0xe68a84,
-    0xe68a85,
-    0xe68a86,
-    0xe68a87,
-    0xe68a88,
-    0xe68a89,
-    0xe68a8a,
-    0xe68a8b,
-    0xe68a8c,
-    0xe68a8d,
-    0xe68a8e,
-    0xe68a8f,
-    0xe68a90,
-    0xe68a91,
-    0xe68a92,
-    0xe68a93,
-    0xe68a94,
-    0xe68a95,
-    0xe68a96,
-    0xe68a97,
-    0xe68a98,
-    0xe68a99,
-    0xe68a9a,
-    0xe68a9b,
-    0xe68a9c,
-    0xe68a9d,
-    0xe68a9e,
-    0xe68a9f,
-    0xe68aa0,
-    0xe68aa1,
-    0xe68aa2,
-    0xe68aa3,
-    0xe68aa4,
-    0xe68aa5,
-    0xe68aa6,
-    0xe68aa7,
-    0xe68aa8,
-    0xe68aa9,
-    0xe68aaa,
-    0xe68aab,
-    0xe68aac,
-    0xe68aad,
-    0xe68aae,
-    0xe68aaf,
-    0xe68ab0,
-    0xe68ab1,
-    0xe68ab2,
-    0xe68ab3,
-    0xe68ab4,
-    0xe68ab5,
-    0xe68ab6,
-    0xe68ab7,
-    0xe68ab8,
-    0xe68ab9,
-    0xe68aba,
-    0xe68abb,
-    0xe68abc,
-    0xe68abd,
-    0xe68abe,
-    0xe68abf,
-    0xe68b80,
-    0xe68b81,
-    0xe68b82,
-    0xe68b83,
-    0xe68b84,
-    0xe68b85,
-    0xe68b86,
-    0xe68b87,
-    0xe68b88,
-    0xe68b89,
-    0xe68b8a,
-    0xe68b8b,
-    0xe68b8c,
-    0xe68b8d,
-    0xe68b8e,
-    0xe68b8f,
-    0xe68b90,
-    0xe68b91,
-    0xe68b92,
-    0xe68b93,
-    0xe68b94,
-    0xe68b95,
-    0xe68b96,
-    0xe68b97,
-    0xe68b98,
-    0xe68b99,
-    0xe68b9a,
-    0xe68b9b,
-    0xe68b9c,
-    0xe68b9d,
-    0xe68b9e,
-    0xe68b9f,
-    0xe68ba0,
-    0xe68ba1,
-    0xe68ba2,
-    0xe68ba3,
-    0xe68ba4,
-    0xe68ba5,
-    0xe68ba6,
-    0xe68ba7,
-    0xe68ba8,
-    0xe68ba9,
-    0xe68baa,
-    0xe68bab,
-    0xe68bac,
-    0xe68bad,
-    0xe68bae,
-    0xe68baf,
-    0xe68bb0,
-    0xe68bb1,
-    0xe68bb2,
-    0xe68bb3,
-    0xe68bb4,
-    0xe68bb5,
-    0xe68bb6,
-    0xe68bb7,
-    0xe68bb8,
-    0xe68bb9,
-    0xe68bba,
-    0xe68bbb,
-    0xe68bbc,
-    0xe68bbd,
-    0xe68bbe,
-    0xe68bbf,
-    0xe68c80,
-    0xe68c81,
-    0xe68c82,
-    0xe68c83,
-    0xe68c84,
-    0xe68c85,
-    0xe68c86,
-    0xe68c87,
-    0xe68c88,
-    0xe68c89,
-    0xe68c8a,
-    0xe68c8b,
-    0xe68c8c,
-    0xe68c8d,
-    0xe68c8e,
-    0xe68c8f,
-    0xe68c90,
-    0xe68c91,
-    0xe68c92,
-    0xe68c93,
-    0xe68c94,
-    0xe68c95,
-    0xe68c96,
-    0xe68c97,
-    0xe68c98,
-    0xe68c99,
-    0xe68c9a,
-    0xe68c9b,
-    0xe68c9c,
-    0xe68c9d,
-    0xe68c9e,
-    0xe68c9f,
-    0xe68ca0,
-    0xe68ca1,
-    0xe68ca2,
-    0xe68ca3,
-    0xe68ca4,
-    0xe68ca5,
-    0xe68ca6,
-    0xe68ca7,
-    0xe68ca8,
-    0xe68ca9,
-    0xe68caa,
-    0xe68cab,
-    0xe68cac,
-    0xe68cad,
-    0xe68cae,
-    0xe68caf,
-    0xe68cb0,
-    0xe68cb1,
-    0xe68cb2,
-    0xe68cb3,
-    0xe68cb4,
-    0xe68cb5,
-    0xe68cb6,
-    0xe68cb7,
-    0xe68cb8,
-    0xe68cb9,
-    0xe68cba,
-    0xe68cbb,
-    0xe68cbc,
-    0xe68cbd,
-    0xe68cbe,
-    0xe68cbf,
-    0xe68d80,
-    0xe68d81,
-    0xe68d82,
-    0xe68d83,
-    0xe68d84,
-    0xe68d85,
-    0xe68d86,
-    0xe68d87,
-    0xe68d88,
-    0xe68d89,
-    0xe68d8a,
-    0xe68d8b,
-    0xe68d8c,
-    0xe68d8d,
-    0xe68d8e,
-    0xe68d8f,
-    0xe68d90,
-    0xe68d91,
-    0xe68d92,
-    0xe68d93,
-    0xe68d94,
-    0xe68d95,
-    0xe68d96,
-    0xe68d97,
-    0xe68d98,
-    0xe68d99,
-    0xe68d9a,
-    0xe68d9b,
-    0xe68d9c,
-    0xe68d9d,
-    0xe68d9e,
-    0xe68d9f,
-    0xe68da0,
-    0xe68da1,
-    0xe68da2,
-    0xe68da3,
-    0xe68da4,
-    0xe68da5,
-    0xe68da6,
-    0xe68da7,
-    0xe68da8,
-    0xe68da9,
-    0xe68daa,
-    0xe68dab,
-    0xe68dac,
-    0xe68dad,
-    0xe68dae,
-    0xe68daf,
-    0xe68db0,
-    0xe68db1,
-    0xe68db2,
-    0xe68db3,
-    0xe68db4,
-    0xe68db5,
-    0xe68db6,
-    0xe68db7,
-    0xe68db8,
-    0xe68db9,
-    0xe68dba,
-    0xe68dbb,
-    0xe68dbc,
-    0xe68dbd,
-    0xe68dbe,
-    0xe68dbf,
-    0xe68e80,
-    0xe68e81,
-    0xe68e82,
-    0xe68e83,
-    0xe68e84,
-    0xe68e85,
-    0xe68e86,
-    0xe68e87,
-    0xe68e88,
-    0xe68e89,
-    0xe68e8a,
-    0xe68e8b,
-    0xe68e8c,
-    0xe68e8d,
-    0xe68e8e,
-    0xe68e8f,
-    0xe68e90,
-    0xe68e91,
-    0xe68e92,
-    0xe68e93,
-    0xe68e94,
-    0xe68e95,
-    0xe68e96,
-    0xe68e97,
-    0xe68e98,
-    0xe68e99,
-    0xe68e9a,
-    0xe68e9b,
-    0xe68e9c,
-    0xe68e9d,
-    0xe68e9e,
-    0xe68e9f,
-    0xe68ea0,
-    0xe68ea1,
-    0xe68ea2,
-    0xe68ea3,
-    0xe68ea4,
-    0xe68ea5,
-    0xe68ea6,
-    0xe68ea7,
-    0xe68ea8,
-    0xe68ea9,
-    0xe68eaa,
-    0xe68eab,
-    0xe68eac,
-    0xe68ead,
-    0xe68eae,
-    0xe68eaf,
-    0xe68eb0,
-    0xe68eb1,
-    0xe68eb2,
-    0xe68eb3,
-    0xe68eb4,
-    0xe68eb5,
-    0xe68eb6,
-    0xe68eb7,
-    0xe68eb8,
-    0xe68eb9,
-    0xe68eba,
-    0xe68ebb,
-    0xe68ebc,
-    0xe68ebd,
-    0xe68ebe,
-    0xe68ebf,
-    0xe68f80,
-    0xe68f81,
-    0xe68f82,
-    0xe68f83,
-    0xe68f84,
-    0xe68f85,
-    0xe68f86,
-    0xe68f87,
-    0xe68f88,
-    0xe68f89,
-    0xe68f8a,
-    0xe68f8b,
-    0xe68f8c,
-    0xe68f8d,
-    0xe68f8e,
-    0xe68f8f,
-    0xe68f90,
-    0xe68f91,
-    0xe68f92,
-    0xe68f93,
-    0xe68f94,
-    0xe68f95,
-    0xe68f96,
-    0xe68f97,
-    0xe68f98,
-    0xe68f99,
-    0xe68f9a,
-    0xe68f9b,
-    0xe68f9c,
-    0xe68f9d,
-    0xe68f9e,
-    0xe68f9f,
-    0xe68fa0,
-    0xe68fa1,
-    0xe68fa2,
-    0xe68fa3,
-    0xe68fa4,
-    0xe68fa5,
-    0xe68fa6,
-    0xe68fa7,
-    0xe68fa8,
-    0xe68fa9,
-    0xe68faa,
-    0xe68fab,
-    0xe68fac,
-    0xe68fad,
-    0xe68fae,
-    0xe68faf,
-    0xe68fb0,
-    0xe68fb1,
-    0xe68fb2,
-    0xe68fb3,
-    0xe68fb4,
-    0xe68fb5,
-    0xe68fb6,
-    0xe68fb7,
-    0xe68fb8,
-    0xe68fb9,
-    0xe68fba,
-    0xe68fbb,
-    0xe68fbc,
-    0xe68fbd,
-    0xe68fbe,
-    0xe68fbf,
-    0xe69080,
-    0xe69081,
-    0xe69082,
-    0xe69083,
-    0xe69084,
-    0xe69085,
-    0xe69086,
-    0xe69087,
-    0xe69088,
-    0xe69089,
-    0xe6908a,
-    0xe6908b,
-    0xe6908c,
-    0xe6908d,
-    0xe6908e,
-    0xe6908f,
-    0xe69090,
-    0xe69091,
-    0xe69092,
-    0xe69093,
-    0xe69094,
-    0xe69095,
-    0xe69096,
-    0xe69097,
-    0xe69098,
-    0xe69099,
-    0xe6909a,
-    0xe6909b,
-    0xe6909c,
-    0xe6909d,
-    0xe6909e,
-    0xe6909f,
-    0xe690a0,
-    0xe690a1,
-    0xe690a2,
-    0xe690a3,
-    0xe690a4,
-    0xe690a5,
-    0xe690a6,
-    0xe690a7,
-    0xe690a8,
-    0xe690a9,
-    0xe690aa,
-    0xe690ab,
-    0xe690ac,
-    0xe690ad,
-    0xe690ae,
-    0xe690af,
-    0xe690b0,
-    0xe690b1,
-    0xe690b2,
-    0xe690b3,
-    0xe690b4,
-    0xe690b5,
-    0xe690b6,
-    0xe690b7,
-    0xe690b8,
-    0xe690b9,
-    0xe690ba,
-    0xe690bb,
-    0xe690bc,
-    0xe690bd,
-    0xe690be,
-    0xe690bf,
-    0xe69180,
-    0xe69181,
-    0xe69182,
-    0xe69183,
-    0xe69184,
-    0xe69185,
-    0xe69186,
-    0xe69187,
-    0xe69188,
-    0xe69189,
-    0xe6918a,
-    0xe6918b,
-    0xe6918c,
-    0xe6918d,
-    0xe6918e,
-    0xe6918f,
-    0xe69190,
-    0xe69191,
-    0xe69192,
-    0xe69193,
-    0xe69194,
-    0xe69195,
-    0xe69196,
-    0xe69197,
-    0xe69198,
-    0xe69199,
-    0xe6919a,
-    0xe6919b,
-    0xe6919c,
-    0xe6919d,
-    0xe6919e,
-    0xe6919f,
-    0xe691a0,
-    0xe691a1,
-    0xe691a2,
-    0xe691a3,
-    0xe691a4,
-    0xe691a5,
-    0xe691a6,
-    0xe691a7,
-    0xe691a8,
-    0xe691a9,
-    0xe691aa,
-    0xe691ab,
-    0xe691ac,
-    0xe691ad,
-    0xe691ae,
-    0xe691af,
-    0xe691b0,
-    0xe691b1,
-    0xe691b2,
-    0xe691b3,
-    0xe691b4,
-    0xe691b5,
-    0xe691b6,
-    0xe691b7,
-    0xe691b8,
-    0xe691b9,
-    0xe691ba,
-    0xe691bb,
-    0xe691bc,
-    0xe691bd,
-    0xe691be,
-    0xe691bf,
-    0xe69280,
-    0xe69281,
-    0xe69282,
-    0xe69283,
-    0xe69284,
-    0xe69285,
-    0xe69286,
-    0xe69287,
-    0xe69288,
-    0xe69289,
-    0xe6928a,
-    0xe6928b,
-    0xe6928c,
-    0xe6928d,
-    0xe6928e,
-    0xe6928f,
-    0xe69290,
-    0xe69291,
-    0xe69292,
-    0xe69293,
-    0xe69294,
-    0xe69295,
-    0xe69296,
-    0xe69297,
-    0xe69298,
-    0xe69299,
-    0xe6929a,
-    0xe6929b,
-    0xe6929c,
-    0xe6929d,
-    0xe6929e,
-    0xe6929f,
-    0xe692a0,
-    0xe692a1,
-    0xe692a2,
-    0xe692a3,
-    0xe692a4,
-    0xe692a5,
-    0xe692a6,
-    0xe692a7,
-    0xe692a8,
-    0xe692a9,
-    0xe692aa,
-    0xe692ab,
-    0xe692ac,
-    0xe692ad,
-    0xe692ae,
-    0xe692af,
-    0xe692b0,
-    0xe692b1,
-    0xe692b2,
-    0xe692b3,
-    0xe692b4,
-    0xe692b5,
-    0xe692b6,
-    0xe692b7,
-    0xe692b8,
-    0xe692b9,
-    0xe692ba,
-    0xe692bb,
-    0xe692bc,
-    0xe692bd,
-    0xe692be,
-    0xe692bf,
-    0xe69380,
-    0xe69381,
-    0xe69382,
-    0xe69383,
-    0xe69384,
-    0xe69385,
-    0xe69386,
-    0xe69387,
-    0xe69388,
-    0xe69389,
-    0xe6938a,
-    0xe6938b,
-    0xe6938c,
-    0xe6938d,
-    0xe6938e,
-    0xe6938f,
-    0xe69390,
-    0xe69391,
-    0xe69392,
-    0xe69393,
-    0xe69394,
-    0xe69395,
-    0xe69396,
-    0xe69397,
-    0xe69398,
-    0xe69399,
-    0xe6939a,
-    0xe6939b,
-    0xe6939c,
-    0xe6939d,
-    0xe6939e,
-    0xe6939f,
-    0xe693a0,
-    0xe693a1,
-    0xe693a2,
-    0xe693a3,
-    0xe693a4,
-    0xe693a5,
-    0xe693a6,
-    0xe693a7,
-    0xe693a8,
-    0xe693a9,
-    0xe693aa,
-    0xe693ab,
-    0xe693ac,
-    0xe693ad,
-    0xe693ae,
-    0xe693af,
-    0xe693b0,
-    0xe693b1,
-    0xe693b2,
-    0xe693b3,
-    0xe693b4,
-    0xe693b5,
-    0xe693b6,
-    0xe693b7,
-    0xe693b8,
-    0xe693b9,
-    0xe693ba,
-    0xe693bb,
-    0xe693bc,
-    0xe693bd,
-    0xe693be,
-    0xe693bf,
-    0xe69480,
-    0xe69481,
-    0xe69482,
-    0xe69483,
-    0xe69484,
-    0xe69485,
-    0xe69486,
-    0xe69487,
-    0xe69488,
-    0xe69489,
-    0xe6948a,
-    0xe6948b,
-    0xe6948c,
-    0xe6948d,
-    0xe6948e,
-    0xe6948f,
-    0xe69490,
-    0xe69491,
-    0xe69492,
-    0xe69493,
-    0xe69494,
-    0xe69495,
-    0xe69496,
-    0xe69497,
-    0xe69498,
-    0xe69499,
-    0xe6949a,
-    0xe6949b,
-    0xe6949c,
-    0xe6949d,
-    0xe6949e,
-    0xe6949f,
-    0xe694a0,
-    0xe694a1,
-    0xe694a2,
-    0xe694a3,
-    0xe694a4,
-    0xe694a5,
-    0xe694a6,
-    0xe694a7,
-    0xe694a8,
-    0xe694a9,
-    0xe694aa,
-    0xe694ab,
-    0xe694ac,
-    0xe694ad,
-    0xe694ae,
-    0xe694af,
-    0xe694b0,
-    0xe694b1,
-    0xe694b2,
-    0xe694b3,
-    0xe694b4,
-    0xe694b5,
-    0xe694b6,
-    0xe694b7,
-    0xe694b8,
-    0xe694b9,
-    0xe694ba,
-    0xe694bb,
-    0xe694bc,
-    0xe694bd,
-    0xe694be,
-    0xe694bf,
-    0xe69580,
-    0xe69581,
-    0xe69582,
-    0xe69583,
-    0xe69584,
-    0xe69585,
-    0xe69586,
-    0xe69587,
-    0xe69588,
-    0xe69589,
-    0xe6958a,
-    0xe6958b,
-    0xe6958c,
-    0xe6958d,
-    0xe6958e,
-    0xe6958f,
-    0xe69590,
-    0xe69591,
-    0xe69592,
-    0xe69593,
-    0xe69594,
-    0xe69595,
-    0xe69596,
-    0xe69597,
-    0xe69598,
-    0xe69599,
-    0xe6959a,
-    0xe6959b,
-    0xe6959c,
-    0xe6959d,
-    0xe6959e,
-    0xe6959f,
-    0xe695a0,
-    0xe695a1,
-    0xe695a2,
-    0xe695a3,
-    0xe695a4,
-    0xe695a5,
-    0xe695a6,
-    0xe695a7,
-    0xe695a8,
-    0xe695a9,
-    0xe695aa,
-    0xe695ab,
-    0xe695ac,
-    0xe695ad,
-    0xe695ae,
-    0xe695af,
-    0xe695b0,
-    0xe695b1,
-    0xe695b2,
-    0xe695b3,
-    0xe695b4,
-    0xe695b5,
-    0xe695b6,
-    0xe695b7,
-    0xe695b8,
-    0xe695b9,
-    0xe695ba,
-    0xe695bb,
-    0xe695bc,
-    0xe695bd,
-    0xe695be,
-    0xe695bf,
-    0xe69680,
-    0xe69681,
-    0xe69682,
-    0xe69683,
-    0xe69684,
-    0xe69685,
-    0xe69686,
-    0xe69687,
-    0xe69688,
-    0xe69689,
-    0xe6968a,
-    0xe6968b,
-    0xe6968c,
-    0xe6968d,
-    0xe6968e,
-    0xe6968f,
-    0xe69690,
-    0xe69691,
-    0xe69692,
-    0xe69693,
-    0xe69694,
-    0xe69695,
-    0xe69696,
-    0xe69697,
-    0xe69698,
-    0xe69699,
-    0xe6969a,
-    0xe6969b,
-    0xe6969c,
-    0xe6969d,
-    0xe6969e,
-    0xe6969f,
-    0xe696a0,
-    0xe696a1,
-    0xe696a2,
-    0xe696a3,
-    0xe696a4,
-    0xe696a5,
-    0xe696a6,
-    0xe696a7,
-    0xe696a8,
-    0xe696a9,
-    0xe696aa,
-    0xe696ab,
-    0xe696ac,
-    0xe696ad,
-    0xe696ae,
-    0xe696af,
-    0xe696b0,
-    0xe696b1,
-    0xe696b2,
-    0xe696b3,
-    0xe696b4,
-    0xe696b5,
-    0xe696b6,
-    0xe696b7,
-    0xe696b8,
-    0xe696b9,
-    0xe696ba,
-    0xe696bb,
-    0xe696bc,
-    0xe696bd,
-    0xe696be,
-    0xe696bf,
-    0xe69780,
-    0xe69781,
-    0xe69782,
-    0xe69783,
-    0xe69784,
-    0xe69785,
-    0xe69786,
-    0xe69787,
-    0xe69788,
-    0xe69789,
-    0xe6978a,
-    0xe6978b,
-    0xe6978c,
-    0xe6978d,
-    0xe6978e,
-    0xe6978f,
-    0xe69790,
-    0xe69791,
-    0xe69792,
-    0xe69793,
-    0xe69794,
-    0xe69795,
-    0xe69796,
-    0xe69797,
-    0xe69798,
-    0xe69799,
-    0xe6979a,
-    0xe6979b,
-    0xe6979c,
-    0xe6979d,
-    0xe6979e,
-    0xe6979f,
-    0xe697a0,
-    0xe697a1,
-    0xe697a2,
-    0xe697a3,
-    0xe697a4,
-    0xe697a5,
-    0xe697a6,
-    0xe697a7,
-    0xe697a8,
-    0xe697a9,
-    0xe697aa,
-    0xe697ab,
-    0xe697ac,
-    0xe697ad,
-    0xe697ae,
-    0xe697af,
-    0xe697b0,
-    0xe697b1,
-    0xe697b2,
-    0xe697b3,
-    0xe697b4,
-    0xe697b5,
-    0xe697b6,
-    0xe697b7,
-    0xe697b8,
-    0xe697b9,
-    0xe697ba,
-    0xe697bb,
-    0xe697bc,
-    0xe697bd,
-    0xe697be,
-    0xe697bf,
-    0xe69880,
-    0xe69881,
-    0xe69882,
-    0xe69883,
-    0xe69884,
-    0xe69885,
-    0xe69886,
-    0xe69887,
-    0xe69888,
-    0xe69889,
-    0xe6988a,
-    0xe6988b,
-    0xe6988c,
-    0xe6988d,
-    0xe6988e,
-    0xe6988f,
-    0xe69890,
-    0xe69891,
-    0xe69892,
-    0xe69893,
-    0xe69894,
-    0xe69895,
-    0xe69896,
-    0xe69897,
-    0xe69898,
-    0xe69899,
-    0xe6989a,
-    0xe6989b,
-    0xe6989c,
-    0xe6989d,
-    0xe6989e,
-    0xe6989f,
-    0xe698a0,
-    0xe698a1,
-    0xe698a2,
-    0xe698a3,
-    0xe698a4,
-    0xe698a5,
-    0xe698a6,
-    0xe698a7,
-    0xe698a8,
-    0xe698a9,
-    0xe698aa,
-    0xe698ab,
-    0xe698ac,
-    0xe698ad,
-    0xe698ae,
-    0xe698af,
-    0xe698b0,
-    0xe698b1,
-    0xe698b2,
-    0xe698b3,
-    0xe698b4,
-    0xe698b5,
-    0xe698b6,
-    0xe698b7,
-    0xe698b8,
-    0xe698b9,
-    0xe698ba,
-    0xe698bb,
-    0xe698bc,
-    0xe698bd,
-    0xe698be,
-    0xe698bf,
-    0xe69980,
-    0xe69981,
-    0xe69982,
-    0xe69983,
-    0xe69984,
-    0xe69985,
-    0xe69986,
-    0xe69987,
-    0xe69988,
-    0xe69989,
-    0xe6998a,
-    0xe6998b,
-    0xe6998c,
-    0xe6998d,
-    0xe6998e,
-    0xe6998f,
-    0xe69990,
-    0xe69991,
-    0xe69992,
-    0xe69993,
-    0xe69994,
-    0xe69995,
-    0xe69996,
-    0xe69997,
-    0xe69998,
-    0xe69999,
-    0xe6999a,
-    0xe6999b,
-    0xe6999c,
-    0xe6999d,
-    0xe6999e,
-    0xe6999f,
-    0xe699a0,
-    0xe699a1,
-    0xe699a2,
-    0xe699a3,
-    0xe699a4,
-    0xe699a5,
-    0xe699a6,
-    0xe699a7,
-    0xe699a8,
-    0xe699a9,
-    0xe699aa,
-    0xe699ab,
-    0xe699ac,
-    0xe699ad,
-    0xe699ae,
-    0xe699af,
-    0xe699b0,
-    0xe699b1,
-    0xe699b2,
-    0xe699b3,
-    0xe699b4,
-    0xe699b5,
-    0xe699b6,
-    0xe699b7,
-    0xe699b8,
-    0xe699b9,
-    0xe699ba,
-    0xe699bb,
-    0xe699bc,
-    0xe699bd,
-    0xe699be,
-    0xe699bf,
-    0xe69a80,
-    0xe69a81,
-    0xe69a82,
-    0xe69a83,
-    0xe69a84,
-    0xe69a85,
-    0xe69a86,
-    0xe69a87,
-    0xe69a88,
-    0xe69a89,
-    0xe69a8a,
-    0xe69a8b,
-    0xe69a8c,
-    0xe69a8d,
-    0xe69a8e,
-    0xe69a8f,
-    0xe69a90,
-    0xe69a91,
-    0xe69a92,
-    0xe69a93,
-    0xe69a94,
-    0xe69a95,
-    0xe69a96,
-    0xe69a97,
-    0xe69a98,
-    0xe69a99,
-    0xe69a9a,
-    0xe69a9b,
-    0xe69a9c,
-    0xe69a9d,
-    0xe69a9e,
-    0xe69a9f,
-    0xe69aa0,
-    0xe69aa1,
-    0xe69aa2,
-    0xe69aa3,
-    0xe69aa4,
-    0xe69aa5,
-    0xe69aa6,
-    0xe69aa7,
-    0xe69aa8,
-    0xe69aa9,
-    0xe69aaa,
-    0xe69aab,
-    0xe69aac,
-    0xe69aad,
-    0xe69aae,
-    0xe69aaf,
-    0xe69ab0,
-    0xe69ab1,
-    0xe69ab2,
-    0xe69ab3,
-    0xe69ab4,
-    0xe69ab5,
-    0xe69ab6,
-    0xe69ab7,
-    0xe69ab8,
-    0xe69ab9,
-    0xe69aba,
-    0xe69abb,
-    0xe69abc,
-    0xe69abd,
-    0xe69abe,
-    0xe69abf,
-    0xe69b80,
-    0xe69b81,
-    0xe69b82,
-    0xe69b83,
-    0xe69b84,
-    0xe69b85,
-    0xe69b86,
-    0xe69b87,
-    0xe69b88,
-    0xe69b89,
-    0xe69b8a,
-    0xe69b8b,
-    0xe69b8c,
-    0xe69b8d,
-    0xe69b8e,
-    0xe69b8f,
-    0xe69b90,
-    0xe69b91,
-    0xe69b92,
-    0xe69b93,
-    0xe69b94,
-    0xe69b95,
-    0xe69b96,
-    0xe69b97,
-    0xe69b98,
-    0xe69b99,
-    0xe69b9a,
-    0xe69b9b,
-    0xe69b9c,
-    0xe69b9d,
-    0xe69b9e,
-    0xe69b9f,
-    0xe69ba0,
-    0xe69ba1,
-    0xe69ba2,
-    0xe69ba3,
-    0xe69ba4,
-    0xe69ba5,
-    0xe69ba6,
-    0xe69ba7,
-    0xe69ba8,
-    0xe69ba9,
-    0xe69baa,
-    0xe69bab,
-    0xe69bac,
-    0xe69bad,
-    0xe69bae,
-    0xe69baf,
-    0xe69bb0,
-    0xe69bb1,
-    0xe69bb2,
-    0xe69bb3,
-    0xe69bb4,
-    0xe69bb5,
-    0xe69bb6,
-    0xe69bb7,
-    0xe69bb8,
-    0xe69bb9,
-    0xe69bba,
-    0xe69bbb,
-    0xe69bbc,
-    0xe69bbd,
-    0xe69bbe,
-    0xe69bbf,
-    0xe69c80,
-    0xe69c81,
-    0xe69c82,
-    0xe69c83,
-    0xe69c84,
-    0xe69c85,
-    0xe69c86,
-    0xe69c87,
-    0xe69c88,
-    0xe69c89,
-    0xe69c8a,
-    0xe69c8b,
-    0xe69c8c,
-    0xe69c8d,
-    0xe69c8e,
-    0xe69c8f,
-    0xe69c90,
-    0xe69c91,
-    0xe69c92,
-    0xe69c93,
-    0xe69c94,
-    0xe69c95,
-    0xe69c96,
-    0xe69c97,
-    0xe69c98,
-    0xe69c99,
-    0xe69c9a,
-    0xe69c9b,
-    0xe69c9c,
-    0xe69c9d,
-    0xe69c9e,
-    0xe69c9f,
-    0xe69ca0,
-    0xe69ca1,
-    0xe69ca2,
-    0xe69ca3,
-    0xe69ca4,
-    0xe69ca5,
-    0xe69ca6,
-    0xe69ca7,
-    0xe69ca8,
-    0xe69ca9,
-    0xe69caa,
-    0xe69cab,
-    0xe69cac,
-    0xe69cad,
-    0xe69cae,
-    0xe69caf,
-    0xe69cb0,
-    0xe69cb1,
-    0xe69cb2,
-    0xe69cb3,
-    0xe69cb4,
-    0xe69cb5,
-    0xe69cb6,
-    0xe69cb7,
-    0xe69cb8,
-    0xe69cb9,
-    0xe69cba,
-    0xe69cbb,
-    0xe69cbc,
-    0xe69cbd,
-    0xe69cbe,
-    0xe69cbf,
-    0xe69d80,
-    0xe69d81,
-    0xe69d82,
-    0xe69d83,
-    0xe69d84,
-    0xe69d85,
-    0xe69d86,
-    0xe69d87,
-    0xe69d88,
-    0xe69d89,
-    0xe69d8a,
-    0xe69d8b,
-    0xe69d8c,
-    0xe69d8d,
-    0xe69d8e,
-    0xe69d8f,
-    0xe69d90,
-    0xe69d91,
-    0xe69d92,
-    0xe69d93,
-    0xe69d94,
-    0xe69d95,
-    0xe69d96,
-    0xe69d97,
-    0xe69d98,
-    0xe69d99,
-    0xe69d9a,
-    0xe69d9b,
-    0xe69d9c,
-    0xe69d9d,
-    0xe69d9e,
-    0xe69d9f,
-    0xe69da0,
-    0xe69da1,
-    0xe69da2,
-    0xe69da3,
-    0xe69da4,
-    0xe69da5,
-    0xe69da6,
-    0xe69da7,
-    0xe69da8,
-    0xe69da9,
-    0xe69daa,
-    0xe69dab,
-    0xe69dac,
-    0xe69dad,
-    0xe69dae,
-    0xe69daf,
-    0xe69db0,
-    0xe69db1,
-    0xe69db2,
-    0xe69db3,
-    0xe69db4,
-    0xe69db5,
-    0xe69db6,
-    0xe69db7,
-    0xe69db8,
-    0xe69db9,
-    0xe69dba,
-    0xe69dbb,
-    0xe69dbc,
-    0xe69dbd,
-    0xe69dbe,
-    0xe69dbf,
-    0xe69e80,
-    0xe69e81,
-    0xe69e82,
-    0xe69e83,
-    0xe69e84,
-    0xe69e85,
-    0xe69e86,
-    0xe69e87,
-    0xe69e88,
-    0xe69e89,
-    0xe69e8a,
-    0xe69e8b,
-    0xe69e8c,
-    0xe69e8d,
-    0xe69e8e,
-    0xe69e8f,
-    0xe69e90,
-    0xe69e91,
-    0xe69e92,
-    0xe69e93,
-    0xe69e94,
-    0xe69e95,
-    0xe69e96,
-    0xe69e97,
-    0xe69e98,
-    0xe69e99,
-    0xe69e9a,
-    0xe69e9b,
-    0xe69e9c,
-    0xe69e9d,
-    0xe69e9e,
-    0xe69e9f,
-    0xe69ea0,
-    0xe69ea1,
-    0xe69ea2,
-    0xe69ea3,
-    0xe69ea4,
-    0xe69ea5,
-    0xe69ea6,
-    0xe69ea7,
-    0xe69ea8,
-    0xe69ea9,
-    0xe69eaa,
-    0xe69eab,
-    0xe69eac,
-    0xe69ead,
-    0xe69eae,
-    0xe69eaf,
-    0xe69eb0,
-    0xe69eb1,
-    0xe69eb2,
-    0xe69eb3,
-    0xe69eb4,
-    0xe69eb5,
-    0xe69eb6,
-    0xe69eb7,
-    0xe69eb8,
-    0xe69eb9,
-    0xe69eba,
-    0xe69ebb,
-    0xe69ebc,
-    0xe69ebd,
-    0xe69ebe,
-    0xe69ebf,
-    0xe69f80,
-    0xe69f81,
-    0xe69f82,
-    0xe69f83,
-    0xe69f84,
-    0xe69f85,
-    0xe69f86,
-    0xe69f87,
-    0xe69f88,
-    0xe69f89,
-    0xe69f8a,
-    0xe69f8b,
-    0xe69f8c,
-    0xe69f8d,
-    0xe69f8e,
-    0xe69f8f,
-    0xe69f90,
-    0xe69f91,
-    0xe69f92,
-    0xe69f93,
-    0xe69f94,
-    0xe69f95,
-    0xe69f96,
-    0xe69f97,
-    0xe69f98,
-    0xe69f99,
-    0xe69f9a,
-    0xe69f9b,
-    0xe69f9c,
-    0xe69f9d,
-    0xe69f9e,
-    0xe69f9f,
-    0xe69fa0,
-    0xe69fa1,
-    0xe69fa2,
-    0xe69fa3,
-    0xe69fa4,
-    0xe69fa5,
-    0xe69fa6,
-    0xe69fa7,
-    0xe69fa8,
-    0xe69fa9,
-    0xe69faa,
-    0xe69fab,
-    0xe69fac,
-    0xe69fad,
-    0xe69fae,
-    0xe69faf,
-    0xe69fb0,
-    0xe69fb1,
-    0xe69fb2,
-    0xe69fb3,
-    0xe69fb4,
-    0xe69fb5,
-    0xe69fb6,
-    0xe69fb7,
-    0xe69fb8,
-    0xe69fb9,
-    0xe69fba,
-    0xe69fbb,
-    0xe69fbc,
-    0xe69fbd,
-    0xe69fbe,
-    0xe69fbf,
-    0xe6a080,
-    0xe6a081,
-    0xe6a082,
-    0xe6a083,
-    0xe6a084,
-    0xe6a085,
-    0xe6a086,
-    0xe6a087,
-    0xe6a088,
-    0xe6a089,
-    0xe6a08a,
-    0xe6a08b,
-    0xe6a08c,
-    0xe6a08d,
-    0xe6a08e,
-    0xe6a08f,
-    0xe6a090,
-    0xe6a091,
-    0xe6a092,
-    0xe6a093,
-    0xe6a094,
-    0xe6a095,
-    0xe6a096,
-    0xe6a097,
-    0xe6a098,
-    0xe6a099,
-    0xe6a09a,
-    0xe6a09b,
-    0xe6a09c,
-    0xe6a09d,
-    0xe6a09e,
-    0xe6a09f,
-    0xe6a0a0,
-    0xe6a0a1,
-    0xe6a0a2,
-    0xe6a0a3,
-    0xe6a0a4,
-    0xe6a0a5,
-    0xe6a0a6,
-    0xe6a0a7,
-    0xe6a0a8,
-    0xe6a0a9,
-    0xe6a0aa,
-    0xe6a0ab,
-    0xe6a0ac,
-    0xe6a0ad,
-    0xe6a0ae,
-    0xe6a0af,
-    0xe6a0b0,
-    0xe6a0b1,
-    0xe6a0b2,
-    0xe6a0b3,
-    0xe6a0b4,
-    0xe6a0b5,
-    0xe6a0b6,
-    0xe6a0b7,
-    0xe6a0b8,
-    0xe6a0b9,
-    0xe6a0ba,
-    0xe6a0bb,
-    0xe6a0bc,
-    0xe6a0bd,
-    0xe6a0be,
-    0xe6a0bf,
-    0xe6a180,
-    0xe6a181,
-    0xe6a182,
-    0xe6a183,
-    0xe6a184,
-    0xe6a185,
-    0xe6a186,
-    0xe6a187,
-    0xe6a188,
-    0xe6a189,
-    0xe6a18a,
-    0xe6a18b,
-    0xe6a18c,
-    0xe6a18d,
-    0xe6a18e,
-    0xe6a18f,
-    0xe6a190,
-    0xe6a191,
-    0xe6a192,
-    0xe6a193,
-    0xe6a194,
-    0xe6a195,
-    0xe6a196,
-    0xe6a197,
-    0xe6a198,
-    0xe6a199,
-    0xe6a19a,
-    0xe6a19b,
-    0xe6a19c,
-    0xe6a19d,
-    0xe6a19e,
-    0xe6a19f,
-    0xe6a1a0,
-    0xe6a1a1,
-    0xe6a1a2,
-    0xe6a1a3,
-    0xe6a1a4,
-    0xe6a1a5,
-    0xe6a1a6,
-    0xe6a1a7,
-    0xe6a1a8,
-    0xe6a1a9,
-    0xe6a1aa,
-    0xe6a1ab,
-    0xe6a1ac,
-    0xe6a1ad,
-    0xe6a1ae,
-    0xe6a1af,
-    0xe6a1b0,
-    0xe6a1b1,
-    0xe6a1b2,
-    0xe6a1b3,
-    0xe6a1b4,
-    0xe6a1b5,
-    0xe6a1b6,
-    0xe6a1b7,
-    0xe6a1b8,
-    0xe6a1b9,
-    0xe6a1ba,
-    0xe6a1bb,
-    0xe6a1bc,
-    0xe6a1bd,
-    0xe6a1be,
-    0xe6a1bf,
-    0xe6a280,
-    0xe6a281,
-    0xe6a282,
-    0xe6a283,
-    0xe6a284,
-    0xe6a285,
-    0xe6a286,
-    0xe6a287,
-    0xe6a288,
-    0xe6a289,
-    0xe6a28a,
-    0xe6a28b,
-    0xe6a28c,
-    0xe6a28d,
-    0xe6a28e,
-    0xe6a28f,
-    0xe6a290,
-    0xe6a291,
-    0xe6a292,
-    0xe6a293,
-    0xe6a294,
-    0xe6a295,
-    0xe6a296,
-    0xe6a297,
-    0xe6a298,
-    0xe6a299,
-    0xe6a29a,
-    0xe6a29b,
-    0xe6a29c,
-    0xe6a29d,
-    0xe6a29e,
-    0xe6a29f,
-    0xe6a2a0,
-    0xe6a2a1,
-    0xe6a2a2,
-    0xe6a2a3,
-    0xe6a2a4,
-    0xe6a2a5,
-    0xe6a2a6,
-    0xe6a2a7,
-    0xe6a2a8,
-    0xe6a2a9,
-    0xe6a2aa,
-    0xe6a2ab,
-    0xe6a2ac,
-    0xe6a2ad,
-    0xe6a2ae,
-    0xe6a2af,
-    0xe6a2b0,
-    0xe6a2b1,
-    0xe6a2b2,
-    0xe6a2b3,
-    0xe6a2b4,
-    0xe6a2b5,
-    0xe6a2b6,
-    0xe6a2b7,
-    0xe6a2b8,
-    0xe6a2b9,
-    0xe6a2ba,
-    0xe6a2bb,
-    0xe6a2bc,
-    0xe6a2bd,
-    0xe6a2be,
-    0xe6a2bf,
-    0xe6a380,
-    0xe6a381,
-    0xe6a382,
-    0xe6a383,
-    0xe6a384,
-    0xe6a385,
-    0xe6a386,
-    0xe6a387,
-    0xe6a388,
-    0xe6a389,
-    0xe6a38a,
-    0xe6a38b,
-    0xe6a38c,
-    0xe6a38d,
-    0xe6a38e,
-    0xe6a38f,
-    0xe6a390,
-    0xe6a391,
-    0xe6a392,
-    0xe6a393,
-    0xe6a394,
-    0xe6a395,
-    0xe6a396,
-    0xe6a397,
-    0xe6a398,
-    0xe6a399,
-    0xe6a39a,
-    0xe6a39b,
-    0xe6a39c,
-    0xe6a39d,
-    0xe6a39e,
-    0xe6a39f,
-    0xe6a3a0,
-    0xe6a3a1,
-    0xe6a3a2,
-    0xe6a3a3,
-    0xe6a3a4,
-    0xe6a3a5,
-    0xe6a3a6,
-    0xe6a3a7,
-    0xe6a3a8,
-    0xe6a3a9,
-    0xe6a3aa,
-    0xe6a3ab,
-    0xe6a3ac,
-    0xe6a3ad,
-    0xe6a3ae,
-    0xe6a3af,
-    0xe6a3b0,
-    0xe6a3b1,
-    0xe6a3b2,
-    0xe6a3b3,
-    0xe6a3b4,
-    0xe6a3b5,
-    0xe6a3b6,
-    0xe6a3b7,
-    0xe6a3b8,
-    0xe6a3b9,
-    0xe6a3ba,
-    0xe6a3bb,
-    0xe6a3bc,
-    0xe6a3bd,
-    0xe6a3be,
-    0xe6a3bf,
-    0xe6a480,
-    0xe6a481,
-    0xe6a482,
-    0xe6a483,
-    0xe6a484,
-    0xe6a485,
-    0xe6a486,
-    0xe6a487,
-    0xe6a488,
-    0xe6a489,
-    0xe6a48a,
-    0xe6a48b,
-    0xe6a48c,
-    0xe6a48d,
-    0xe6a48e,
-    0xe6a48f,
-    0xe6a490,
-    0xe6a491,
-    0xe6a492,
-    0xe6a493,
-    0xe6a494,
-    0xe6a495,
-    0xe6a496,
-    0xe6a497,
-    0xe6a498,
-    0xe6a499,
-    0xe6a49a,
-    0xe6a49b,
-    0xe6a49c,
-    0xe6a49d,
-    0xe6a49e,
-    0xe6a49f,
-    0xe6a4a0,
-    0xe6a4a1,
-    0xe6a4a2,
-    0xe6a4a3,
-    0xe6a4a4,
-    0xe6a4a5,
-    0xe6a4a6,
-    0xe6a4a7,
-    0xe6a4a8,
-    0xe6a4a9,
-    0xe6a4aa,
-    0xe6a4ab,
-    0xe6a4ac,
-    0xe6a4ad,
-    0xe6a4ae,
-    0xe6a4af,
-    0xe6a4b0,
-    0xe6a4b1,
-    0xe6a4b2,
-    0xe6a4b3,
-    0xe6a4b4,
-    0xe6a4b5,
-    0xe6a4b6,
-    0xe6a4b7,
-    0xe6a4b8,
-    0xe6a4b9,
-    0xe6a4ba,
-    0xe6a4bb,
-    0xe6a4bc,
-    0xe6a4bd,
-    0xe6a4be,
-    0xe6a4bf,
-    0xe6a580,
-    0xe6a581,
-    0xe6a582,
-    0xe6a583,
-    0xe6a584,
-    0xe6a585,
-    0xe6a586,
-    0xe6a587,
-    0xe6a588,
-    0xe6a589,
-    0xe6a58a,
-    0xe6a58b,
-    0xe6a58c,
-    0xe6a58d,
-    0xe6a58e,
-    0xe6a58f,
-    0xe6a590,
-    0xe6a591,
-    0xe6a592,
-    0xe6a593,
-    0xe6a594,
-    0xe6a595,
-    0xe6a596,
-    0xe6a597,
-    0xe6a598,
-    0xe6a599,
-    0xe6a59a,
-    0xe6a59b,
-    0xe6a59c,
-    0xe6a59d,
-    0xe6a59e,
-    0xe6a59f,
-    0xe6a5a0,
-    0xe6a5a1,
-    0xe6a5a2,
-    0xe6a5a3,
-    0xe6a5a4,
-    0xe6a5a5,
-    0xe6a5a6,
-    0xe6a5a7,
-    0xe6a5a8,
-    0xe6a5a9,
-    0xe6a5aa,
-    0xe6a5ab,
-    0xe6a5ac,
-    0xe6a5ad,
-    0xe6a5ae,
-    0xe6a5af,
-    0xe6a5b0,
-    0xe6a5b1,
-    0xe6a5b2,
-    0xe6a5b3,
-    0xe6a5b4,
-    0xe6a5b5,
-    0xe6a5b6,
-    0xe6a5b7,
-    0xe6a5b8,
-    0xe6a5b9,
-    0xe6a5ba,
-    0xe6a5bb,
-    0xe6a5bc,
-    0xe6a5bd,
-    0xe6a5be,
-    0xe6a5bf,
-    0xe6a680,
-    0xe6a681,
-    0xe6a682,
-    0xe6a683,
-    0xe6a684,
-    0xe6a685,
-    0xe6a686,
-    0xe6a687,
-    0xe6a688,
-    0xe6a689,
-    0xe6a68a,
-    0xe6a68b,
-    0xe6a68c,
-    0xe6a68d,
-    0xe6a68e,
-    0xe6a68f,
-    0xe6a690,
-    0xe6a691,
-    0xe6a692,
-    0xe6a693,
-    0xe6a694,
-    0xe6a695,
-    0xe6a696,
-    0xe6a697,
-    0xe6a698,
-    0xe6a699,
-    0xe6a69a,
-    0xe6a69b,
-    0xe6a69c,
-    0xe6a69d,
-    0xe6a69e,
-    0xe6a69f,
-    0xe6a6a0,
-    0xe6a6a1,
-    0xe6a6a2,
-    0xe6a6a3,
-    0xe6a6a4,
-    0xe6a6a5,
-    0xe6a6a6,
-    0xe6a6a7,
-    0xe6a6a8,
-    0xe6a6a9,
-    0xe6a6aa,
-    0xe6a6ab,
-    0xe6a6ac,
-    0xe6a6ad,
-    0xe6a6ae,
-    0xe6a6af,
-    0xe6a6b0,
-    0xe6a6b1,
-    0xe6a6b2,
-    0xe6a6b3,
-    0xe6a6b4,
-    0xe6a6b5,
-    0xe6a6b6,
-    0xe6a6b7,
-    0xe6a6b8,
-    0xe6a6b9,
-    0xe6a6ba,
-    0xe6a6bb,
-    0xe6a6bc,
-    0xe6a6bd,
-    0xe6a6be,
-    0xe6a6bf,
-    0xe6a780,
-    0xe6a781,
-    0xe6a782,
-    0xe6a783,
-    0xe6a784,
-    0xe6a785,
-    0xe6a786,
-    0xe6a787,
-    0xe6a788,
-    0xe6a789,
-    0xe6a78a,
-    0xe6a78b,
-    0xe6a78c,
-    0xe6a78d,
-    0xe6a78e,
-    0xe6a78f,
-    0xe6a790,
-    0xe6a791,
-    0xe6a792,
-    0xe6a793,
-    0xe6a794,
-    0xe6a795,
-    0xe6a796,
-    0xe6a797,
-    0xe6a798,
-    0xe6a799,
-    0xe6a79a,
-    0xe6a79b,
-    0xe6a79c,
-    0xe6a79d,
-    0xe6a79e,
-    0xe6a79f,
-    0xe6a7a0,
-    0xe6a7a1,
-    0xe6a7a2,
-    0xe6a7a3,
-    0xe6a7a4,
-    0xe6a7a5,
-    0xe6a7a6,
-    0xe6a7a7,
-    0xe6a7a8,
-    0xe6a7a9,
-    0xe6a7aa,
-    0xe6a7ab,
-    0xe6a7ac,
-    0xe6a7ad,
-    0xe6a7ae,
-    0xe6a7af,
-    0xe6a7b0,
-    0xe6a7b1,
-    0xe6a7b2,
-    0xe6a7b3,
-    0xe6a7b4,
-    0xe6a7b5,
-    0xe6a7b6,
-    0xe6a7b7,
-    0xe6a7b8,
-    0xe6a7b9,
-    0xe6a7ba,
-    0xe6a7bb,
-    0xe6a7bc,
-    0xe6a7bd,
-    0xe6a7be,
-    0xe6a7bf,
-    0xe6a880,
-    0xe6a881,
-    0xe6a882,
-    0xe6a883,
-    0xe6a884,
-    0xe6a885,
-    0xe6a886,
-    0xe6a887,
-    0xe6a888,
-    0xe6a889,
-    0xe6a88a,
-    0xe6a88b,
-    0xe6a88c,
-    0xe6a88d,
-    0xe6a88e,
-    0xe6a88f,
-    0xe6a890,
-    0xe6a891,
-    0xe6a892,
-    0xe6a893,
-    0xe6a894,
-    0xe6a895,
-    0xe6a896,
-    0xe6a897,
-    0xe6a898,
-    0xe6a899,
-    0xe6a89a,
-    0xe6a89b,
-    0xe6a89c,
-    0xe6a89d,
-    0xe6a89e,
-    0xe6a89f,
-    0xe6a8a0,
-    0xe6a8a1,
-    0xe6a8a2,
-    0xe6a8a3,
-    0xe6a8a4,
-    0xe6a8a5,
-    0xe6a8a6,
-    0xe6a8a7,
-    0xe6a8a8,
-    0xe6a8a9,
-    0xe6a8aa,
-    0xe6a8ab,
-    0xe6a8ac,
-    0xe6a8ad,
-    0xe6a8ae,
-    0xe6a8af,
-    0xe6a8b0,
-    0xe6a8b1,
-    0xe6a8b2,
-    0xe6a8b3,
-    0xe6a8b4,
-    0xe6a8b5,
-    0xe6a8b6,
-    0xe6a8b7,
-    0xe6a8b8,
-    0xe6a8b9,
-    0xe6a8ba,
-    0xe6a8bb,
-    0xe6a8bc,
-    0xe6a8bd,
-    0xe6a8be,
-    0xe6a8bf,
-    0xe6a980,
-    0xe6a981,
-    0xe6a982,
-    0xe6a983,
-    0xe6a984,
-    0xe6a985,
-    0xe6a986,
-    0xe6a987,
-    0xe6a988,
-    0xe6a989,
-    0xe6a98a,
-    0xe6a98b,
-    0xe6a98c,
-    0xe6a98d,
-    0xe6a98e,
-    0xe6a98f,
-    0xe6a990,
-    0xe6a991,
-    0xe6a992,
-    0xe6a993,
-    0xe6a994,
-    0xe6a995,
-    0xe6a996,
-    0xe6a997,
-    0xe6a998,
-    0xe6a999,
-    0xe6a99a,
-    0xe6a99b,
-    0xe6a99c,
-    0xe6a99d,
-    0xe6a99e,
-    0xe6a99f,
-    0xe6a9a0,
-    0xe6a9a1,
-    0xe6a9a2,
-    0xe6a9a3,
-    0xe6a9a4,
-    0xe6a9a5,
-    0xe6a9a6,
-    0xe6a9a7,
-    0xe6a9a8,
-    0xe6a9a9,
-    0xe6a9aa,
-    0xe6a9ab,
-    0xe6a9ac,
-    0xe6a9ad,
-    0xe6a9ae,
-    0xe6a9af,
-    0xe6a9b0,
-    0xe6a9b1,
-    0xe6a9b2,
-    0xe6a9b3,
-    0xe6a9b4,
-    0xe6a9b5,
-    0xe6a9b6,
-    0xe6a9b7,
-    0xe6a9b8,
-    0xe6a9b9,
-    0xe6a9ba,
-    0xe6a9bb,
-    0xe6a9bc,
-    0xe6a9bd,
-    0xe6a9be,
-    0xe6a9bf,
-    0xe6aa80,
-    0xe6aa81,
-    0xe6aa82,
-    0xe6aa83,
-    0xe6aa84,
-    0xe6aa85,
-    0xe6aa86,
-    0xe6aa87,
-    0xe6aa88,
-    0xe6aa89,
-    0xe6aa8a,
-    0xe6aa8b,
-    0xe6aa8c,
-    0xe6aa8d,
-    0xe6aa8e,
-    0xe6aa8f,
-    0xe6aa90,
-    0xe6aa91,
-    0xe6aa92,
-    0xe6aa93,
-    0xe6aa94,
-    0xe6aa95,
-    0xe6aa96,
-    0xe6aa97,
-    0xe6aa98,
-    0xe6aa99,
-    0xe6aa9a,
-    0xe6aa9b,
-    0xe6aa9c,
-    0xe6aa9d,
-    0xe6aa9e,
-    0xe6aa9f,
-    0xe6aaa0,
-    0xe6aaa1,
-    0xe6aaa2,
-    0xe6aaa3,
-    0xe6aaa4,
-    0xe6aaa5,
-    0xe6aaa6,
-    0xe6aaa7,
-    0xe6aaa8,
-    0xe6aaa9,
-    0xe6aaaa,
-    0xe6aaab,
-    0xe6aaac,
-    0xe6aaad,
-    0xe6aaae,
-    0xe6aaaf,
-    0xe6aab0,
-    0xe6aab1,
-    0xe6aab2,
-    0xe6aab3,
-    0xe6aab4,
-    0xe6aab5,
-    0xe6aab6,
-    0xe6aab7,
-    0xe6aab8,
-    0xe6aab9,
-    0xe6aaba,
-    0xe6aabb,
-    0xe6aabc,
-    0xe6aabd,
-    0xe6aabe,
-    0xe6aabf,
-    0xe6ab80,
-    0xe6ab81,
-    0xe6ab82,
-    0xe6ab83,
-    0xe6ab84,
-    0xe6ab85,
-    0xe6ab86,
-    0xe6ab87,
-    0xe6ab88,
-    0xe6ab89,
-    0xe6ab8a,
-    0xe6ab8b,
-    0xe6ab8c,
-    0xe6ab8d,
-    0xe6ab8e,
-    0xe6ab8f,
-    0xe6ab90,
-    0xe6ab91,
-    0xe6ab92,
-    0xe6ab93,
-    0xe6ab94,
-    0xe6ab95,
-    0xe6ab96,
-    0xe6ab97,
-    0xe6ab98,
-    0xe6ab99,
-    0xe6ab9a,
-    0xe6ab9b,
-    0xe6ab9c,
-    0xe6ab9d,
-    0xe6ab9e,
-    0xe6ab9f,
-    0xe6aba0,
-    0xe6aba1,
-    0xe6aba2,
-    0xe6aba3,
-    0xe6aba4,
-    0xe6aba5,
-    0xe6aba6,
-    0xe6aba7,
-    0xe6aba8,
-    0xe6aba9,
-    0xe6abaa,
-    0xe6abab,
-    0xe6abac,
-    0xe6abad,
-    0xe6abae,
-    0xe6abaf,
-    0xe6abb0,
-    0xe6abb1,
-    0xe6abb2,
-    0xe6abb3,
-    0xe6abb4,
-    0xe6abb5,
-    0xe6abb6,
-    0xe6abb7,
-    0xe6abb8,
-    0xe6abb9,
-    0xe6abba,
-    0xe6abbb,
-    0xe6abbc,
-    0xe6abbd,
-    0xe6abbe,
-    0xe6abbf,
-    0xe6ac80,
-    0xe6ac81,
-    0xe6ac82,
-    0xe6ac83,
-    0xe6ac84,
-    0xe6ac85,
-    0xe6ac86,
-    0xe6ac87,
-    0xe6ac88,
-    0xe6ac89,
-    0xe6ac8a,
-    0xe6ac8b,
-    0xe6ac8c,
-    0xe6ac8d,
-    0xe6ac8e,
-    0xe6ac8f,
-    0xe6ac90,
-    0xe6ac91,
-    0xe6ac92,
-    0xe6ac93,
-    0xe6ac94,
-    0xe6ac95,
-    0xe6ac96,
-    0xe6ac97,
-    0xe6ac98,
-    0xe6ac99,
-    0xe6ac9a,
-    0xe6ac9b,
-    0xe6ac9c,
-    0xe6ac9d,
-    0xe6ac9e,
-    0xe6ac9f,
-    0xe6aca0,
-    0xe6aca1,
-    0xe6aca2,
-    0xe6aca3,
-    0xe6aca4,
-    0xe6aca5,
-    0xe6aca6,
-    0xe6aca7,
-    0xe6aca8,
-    0xe6aca9,
-    0xe6acaa,
-    0xe6acab,
-    0xe6acac,
-    0xe6acad,
-    0xe6acae,
-    0xe6acaf,
-    0xe6acb0,
-    0xe6acb1,
-    0xe6acb2,
-    0xe6acb3,
-    0xe6acb4,
-    0xe6acb5,
-    0xe6acb6,
-    0xe6acb7,
-    0xe6acb8,
-    0xe6acb9,
-    0xe6acba,
-    0xe6acbb,
-    0xe6acbc,
-    0xe6acbd,
-    0xe6acbe,
-    0xe6acbf,
-    0xe6ad80,
-    0xe6ad81,
-    0xe6ad82,
-    0xe6ad83,
-    0xe6ad84,
-    0xe6ad85,
-    0xe6ad86,
-    0xe6ad87,
-    0xe6ad88,
-    0xe6ad89,
-    0xe6ad8a,
-    0xe6ad8b,
-    0xe6ad8c,
-    0xe6ad8d,
-    0xe6ad8e,
-    0xe6ad8f,
-    0xe6ad90,
-    0xe6ad91,
-    0xe6ad92,
-    0xe6ad93,
-    0xe6ad94,
-    0xe6ad95,
-    0xe6ad96,
-    0xe6ad97,
-    0xe6ad98,
-    0xe6ad99,
-    0xe6ad9a,
-    0xe6ad9b,
-    0xe6ad9c,
-    0xe6ad9d,
-    0xe6ad9e,
-    0xe6ad9f,
-    0xe6ada0,
-    0xe6ada1,
-    0xe6ada2,
-    0xe6ada3,
-    0xe6ada4,
-    0xe6ada5,
-    0xe6ada6,
-    0xe6ada7,
-    0xe6ada8,
-    0xe6ada9,
-    0xe6adaa,
-    0xe6adab,
-    0xe6adac,
-    0xe6adad,
-    0xe6adae,
-    0xe6adaf,
-    0xe6adb0,
-    0xe6adb1,
-    0xe6adb2,
-    0xe6adb3,
-    0xe6adb4,
-    0xe6adb5,
-    0xe6adb6,
-    0xe6adb7,
-    0xe6adb8,
-    0xe6adb9,
-    0xe6adba,
-    0xe6adbb,
-    0xe6adbc,
-    0xe6adbd,
-    0xe6adbe,
-    0xe6adbf,
-    0xe6ae80,
-    0xe6ae81,
-    0xe6ae82,
-    0xe6ae83,
-    0xe6ae84,
-    0xe6ae85,
-    0xe6ae86,
-    0xe6ae87,
-    0xe6ae88,
-    0xe6ae89,
-    0xe6ae8a,
-    0xe6ae8b,
-    0xe6ae8c,
-    0xe6ae8d,
-    0xe6ae8e,
-    0xe6ae8f,
-    0xe6ae90,
-    0xe6ae91,
-    0xe6ae92,
-    0xe6ae93,
-    0xe6ae94,
-    0xe6ae95,
-    0xe6ae96,
-    0xe6ae97,
-    0xe6ae98,
-    0xe6ae99,
-    0xe6ae9a,
-    0xe6ae9b,
-    0xe6ae9c,
-    0xe6ae9d,
-    0xe6ae9e,
-    0xe6ae9f,
-    0xe6aea0,
-    0xe6aea1,
-    0xe6aea2,
-    0xe6aea3,
-    0xe6aea4,
-    0xe6aea5,
-    0xe6aea6,
-    0xe6aea7,
-    0xe6aea8,
-    0xe6aea9,
-    0xe6aeaa,
-    0xe6aeab,
-    0xe6aeac,
-    0xe6aead,
-    0xe6aeae,
-    0xe6aeaf,
-    0xe6aeb0,
-    0xe6aeb1,
-    0xe6aeb2,
-    0xe6aeb3,
-    0xe6aeb4,
-    0xe6aeb5,
-    0xe6aeb6,
-    0xe6aeb7,
-    0xe6aeb8,
-    0xe6aeb9,
-    0xe6aeba,
-    0xe6aebb,
-    0xe6aebc,
-    0xe6aebd,
-    0xe6aebe,
-    0xe6aebf,
-    0xe6af80,
-    0xe6af81,
-    0xe6af82,
-    0xe6af83,
-    0xe6af84,
-    0xe6af85,
-    0xe6af86,
-    0xe6af87,
-    0xe6af88,
-    0xe6af89,
-    0xe6af8a,
-    0xe6af8b,
-    0xe6af8c,
-    0xe6af8d,
-    0xe6af8e,
-    0xe6af8f,
-    0xe6af90,
-    0xe6af91,
-    0xe6af92,
-    0xe6af93,
-    0xe6af94,
-    0xe6af95,
-    0xe6af96,
-    0xe6af97,
-    0xe6af98,
-    0xe6af99,
-    0xe6af9a,
-    0xe6af9b,
-    0xe6af9c,
-    0xe6af9d,
-    0xe6af9e,
-    0xe6af9f,
-    0xe6afa0,
-    0xe6afa1,
-    0xe6afa2,
-    0xe6afa3,
-    0xe6afa4,
-    0xe6afa5,
-    0xe6afa6,
-    0xe6afa7,
-    0xe6afa8,
-    0xe6afa9,
-    0xe6afaa,
-    0xe6afab,
-    0xe6afac,
-    0xe6afad,
-    0xe6afae,
-    0xe6afaf,
-    0xe6afb0,
-    0xe6afb1,
-    0xe6afb2,
-    0xe6afb3,
-    0xe6afb4,
-    0xe6afb5,
-    0xe6afb6,
-    0xe6afb7,
-    0xe6afb8,
-    0xe6afb9,
-    0xe6afba,
-    0xe6afbb,
-    0xe6afbc,
-    0xe6afbd,
-    0xe6afbe,
-    0xe6afbf,
-    0xe6b080,
-    0xe6b081,
-    0xe6b082,
-    0xe6b083,
-    0xe6b084,
-    0xe6b085,
-    0xe6b086,
-    0xe6b087,
-    0xe6b088,
-    0xe6b089,
-    0xe6b08a,
-    0xe6b08b,
-    0xe6b08c,
-    0xe6b08d,
-    0xe6b08e,
-    0xe6b08f,
-    0xe6b090,
-    0xe6b091,
-    0xe6b092,
-    0xe6b093,
-    0xe6b094,
-    0xe6b095,
-    0xe6b096,
-    0xe6b097,
-    0xe6b098,
-    0xe6b099,
-    0xe6b09a,
-    0xe6b09b,
-    0xe6b09c,
-    0xe6b09d,
-    0xe6b09e,
-    0xe6b09f,
-    0xe6b0a0,
-    0xe6b0a1,
-    0xe6b0a2,
-    0xe6b0a3,
-    0xe6b0a4,
-    0xe6b0a5,
-    0xe6b0a6,
-    0xe6b0a7,
-    0xe6b0a8,
-    0xe6b0a9,
-    0xe6b0aa,
-    0xe6b0ab,
-    0xe6b0ac,
-    0xe6b0ad,
-    0xe6b0ae,
-    0xe6b0af,
-    0xe6b0b0,
-    0xe6b0b1,
-    0xe6b0b2,
-    0xe6b0b3,
-    0xe6b0b4,
-    0xe6b0b5,
-    0xe6b0b6,
-    0xe6b0b7,
-    0xe6b0b8,
-    0xe6b0b9,
-    0xe6b0ba,
-    0xe6b0bb,
-    0xe6b0bc,
-    0xe6b0bd,
-    0xe6b0be,
-    0xe6b0bf,
-    0xe6b180,
-    0xe6b181,
-    0xe6b182,
-    0xe6b183,
-    0xe6b184,
-    0xe6b185,
-    0xe6b186,
-    0xe6b187,
-    0xe6b188,
-    0xe6b189,
-    0xe6b18a,
-    0xe6b18b,
-    0xe6b18c,
-    0xe6b18d,
-    0xe6b18e,
-    0xe6b18f,
-    0xe6b190,
-    0xe6b191,
-    0xe6b192,
-    0xe6b193,
-    0xe6b194,
-    0xe6b195,
-    0xe6b196,
-    0xe6b197,
-    0xe6b198,
-    0xe6b199,
-    0xe6b19a,
-    0xe6b19b,
-    0xe6b19c,
-    0xe6b19d,
-    0xe6b19e,
-    0xe6b19f,
-    0xe6b1a0,
-    0xe6b1a1,
-    0xe6b1a2,
-    0xe6b1a3,
-    0xe6b1a4,
-    0xe6b1a5,
-    0xe6b1a6,
-    0xe6b1a7,
-    0xe6b1a8,
-    0xe6b1a9,
-    0xe6b1aa,
-    0xe6b1ab,
-    0xe6b1ac,
-    0xe6b1ad,
-    0xe6b1ae,
-    0xe6b1af,
-    0xe6b1b0,
-    0xe6b1b1,
-    0xe6b1b2,
-    0xe6b1b3,
-    0xe6b1b4,
-    0xe6b1b5,
-    0xe6b1b6,
-    0xe6b1b7,
-    0xe6b1b8,
-    0xe6b1b9,
-    0xe6b1ba,
-    0xe6b1bb,
-    0xe6b1bc,
-    0xe6b1bd,
-    0xe6b1be,
-    0xe6b1bf,
-    0xe6b280,
-    0xe6b281,
-    0xe6b282,
-    0xe6b283,
-    0xe6b284,
-    0xe6b285,
-    0xe6b286,
-    0xe6b287,
-    0xe6b288,
-    0xe6b289,
-    0xe6b28a,
-    0xe6b28b,
-    0xe6b28c,
-    0xe6b28d,
-    0xe6b28e,
-    0xe6b28f,
-    0xe6b290,
-    0xe6b291,
-    0xe6b292,
-    0xe6b293,
-    0xe6b294,
-    0xe6b295,
-    0xe6b296,
-    0xe6b297,
-    0xe6b298,
-    0xe6b299,
-    0xe6b29a,
-    0xe6b29b,
-    0xe6b29c,
-    0xe6b29d,
-    0xe6b29e,
-    0xe6b29f,
-    0xe6b2a0,
-    0xe6b2a1,
-    0xe6b2a2,
-    0xe6b2a3,
-    0xe6b2a4,
-    0xe6b2a5,
-    0xe6b2a6,
-    0xe6b2a7,
-    0xe6b2a8,
-    0xe6b2a9,
-    0xe6b2aa,
-    0xe6b2ab,
-    0xe6b2ac,
-    0xe6b2ad,
-    0xe6b2ae,
-    0xe6b2af,
-    0xe6b2b0,
-    0xe6b2b1,
-    0xe6b2b2,
-    0xe6b2b3,
-    0xe6b2b4,
-    0xe6b2b5,
-    0xe6b2b6,
-    0xe6b2b7,
-    0xe6b2b8,
-    0xe6b2b9,
-    0xe6b2ba,
-    0xe6b2bb,
-    0xe6b2bc,
-    0xe6b2bd,
-    0xe6b2be,
-    0xe6b2bf,
-    0xe6b380,
-    0xe6b381,
-    0xe6b382,
-    0xe6b383,
-    0xe6b384,
-    0xe6b385,
-    0xe6b386,
-    0xe6b387,
-    0xe6b388,
-    0xe6b389,
-    0xe6b38a,
-    0xe6b38b,
-    0xe6b38c,
-    0xe6b38d,
-    0xe6b38e,
-    0xe6b38f,
-    0xe6b390,
-    0xe6b391,
-    0xe6b392,
-    0xe6b393,
-    0xe6b394,
-    0xe6b395,
-    0xe6b396,
-    0xe6b397,
-    0xe6b398,
-    0xe6b399,
-    0xe6b39a,
-    0xe6b39b,
-    0xe6b39c,
-    0xe6b39d,
-    0xe6b39e,
-    0xe6b39f,
-    0xe6b3a0,
-    0xe6b3a1,
-    0xe6b3a2,
-    0xe6b3a3,
-    0xe6b3a4,
-    0xe6b3a5,
-    0xe6b3a6,
-    0xe6b3a7,
-    0xe6b3a8,
-    0xe6b3a9,
-    0xe6b3aa,
-    0xe6b3ab,
-    0xe6b3ac,
-    0xe6b3ad,
-    0xe6b3ae,
-    0xe6b3af,
-    0xe6b3b0,
-    0xe6b3b1,
-    0xe6b3b2,
-    0xe6b3b3,
-    0xe6b3b4,
-    0xe6b3b5,
-    0xe6b3b6,
-    0xe6b3b7,
-    0xe6b3b8,
-    0xe6b3b9,
-    0xe6b3ba,
-    0xe6b3bb,
-    0xe6b3bc,
-    0xe6b3bd,
-    0xe6b3be,
-    0xe6b3bf,
-    0xe6b480,
-    0xe6b481,
-    0xe6b482,
-    0xe6b483,
-    0xe6b484,
-    0xe6b485,
-    0xe6b486,
-    0xe6b487,
-    0xe6b488,
-    0xe6b489,
-    0xe6b48a,
-    0xe6b48b,
-    0xe6b48c,
-    0xe6b48d,
-    0xe6b48e,
-    0xe6b48f,
-    0xe6b490,
-    0xe6b491,
-    0xe6b492,
-    0xe6b493,
-    0xe6b494,
-    0xe6b495,
-    0xe6b496,
-    0xe6b497,
-    0xe6b498,
-    0xe6b499,
-    0xe6b49a,
-    0xe6b49b,
-    0xe6b49c,
-    0xe6b49d,
-    0xe6b49e,
-    0xe6b49f,
-    0xe6b4a0,
-    0xe6b4a1,
-    0xe6b4a2,
-    0xe6b4a3,
-    0xe6b4a4,
-    0xe6b4a5,
-    0xe6b4a6,
-    0xe6b4a7,
-    0xe6b4a8,
-    0xe6b4a9,
-    0xe6b4aa,
-    0xe6b4ab,
-    0xe6b4ac,
-    0xe6b4ad,
-    0xe6b4ae,
-    0xe6b4af,
-    0xe6b4b0,
-    0xe6b4b1,
-    0xe6b4b2,
-    0xe6b4b3,
-    0xe6b4b4,
-    0xe6b4b5,
-    0xe6b4b6,
-    0xe6b4b7,
-    0xe6b4b8,
-    0xe6b4b9,
-    0xe6b4ba,
-    0xe6b4bb,
-    0xe6b4bc,
-    0xe6b4bd,
-    0xe6b4be,
-    0xe6b4bf,
-    0xe6b580,
-    0xe6b581,
-    0xe6b582,
-    0xe6b583,
-    0xe6b584,
-    0xe6b585,
-    0xe6b586,
-    0xe6b587,
-    0xe6b588,
-    0xe6b589,
-    0xe6b58a,
-    0xe6b58b,
-    0xe6b58c,
-    0xe6b58d,
-    0xe6b58e,
-    0xe6b58f,
-    0xe6b590,
-    0xe6b591,
-    0xe6b592,
-    0xe6b593,
-    0xe6b594,
-    0xe6b595,
-    0xe6b596,
-    0xe6b597,
-    0xe6b598,
-    0xe6b599,
-    0xe6b59a,
-    0xe6b59b,
-    0xe6b59c,
-    0xe6b59d,
-    0xe6b59e,
-    0xe6b59f,
-    0xe6b5a0,
-    0xe6b5a1,
-    0xe6b5a2,
-    0xe6b5a3,
-    0xe6b5a4,
-    0xe6b5a5,
-    0xe6b5a6,
-    0xe6b5a7,
-    0xe6b5a8,
-    0xe6b5a9,
-    0xe6b5aa,
-    0xe6b5ab,
-    0xe6b5ac,
-    0xe6b5ad,
-    0xe6b5ae,
-    0xe6b5af,
-    0xe6b5b0,
-    0xe6b5b1,
-    0xe6b5b2,
-    0xe6b5b3,
-    0xe6b5b4,
-    0xe6b5b5,
-    0xe6b5b6,
-    0xe6b5b7,
-    0xe6b5b8,
-    0xe6b5b9,
-    0xe6b5ba,
-    0xe6b5bb,
-    0xe6b5bc,
-    0xe6b5bd,
-    0xe6b5be,
-    0xe6b5bf,
-    0xe6b680,
-    0xe6b681,
-    0xe6b682,
-    0xe6b683,
-    0xe6b684,
-    0xe6b685,
-    0xe6b686,
-    0xe6b687,
-    0xe6b688,
-    0xe6b689,
-    0xe6b68a,
-    0xe6b68b,
-    0xe6b68c,
-    0xe6b68d,
-    0xe6b68e,
-    0xe6b68f,
-    0xe6b690,
-    0xe6b691,
-    0xe6b692,
-    0xe6b693,
-    0xe6b694,
-    0xe6b695,
-    0xe6b696,
-    0xe6b697,
-    0xe6b698,
-    0xe6b699,
-    0xe6b69a,
-    0xe6b69b,
-    0xe6b69c,
-    0xe6b69d,
-    0xe6b69e,
-    0xe6b69f,
-    0xe6b6a0,
-    0xe6b6a1,
-    0xe6b6a2,
-    0xe6b6a3,
-    0xe6b6a4,
-    0xe6b6a5,
-    0xe6b6a6,
-    0xe6b6a7,
-    0xe6b6a8,
-    0xe6b6a9,
-    0xe6b6aa,
-    0xe6b6ab,
-    0xe6b6ac,
-    0xe6b6ad,
-    0xe6b6ae,
-    0xe6b6af,
-    0xe6b6b0,
-    0xe6b6b1,
-    0xe6b6b2,
-    0xe6b6b3,
-    0xe6b6b4,
-    0xe6b6b5,
-    0xe6b6b6,
-    0xe6b6b7,
-    0xe6b6b8,
-    0xe6b6b9,
-    0xe6b6ba,
-    0xe6b6bb,
-    0xe6b6bc,
-    0xe6b6bd,
-    0xe6b6be,
-    0xe6b6bf,
-    0xe6b780,
-    0xe6b781,
-    0xe6b782,
-    0xe6b783,
-    0xe6b784,
-    0xe6b785,
-    0xe6b786,
-    0xe6b787,
-    0xe6b788,
-    0xe6b789,
-    0xe6b78a,
-    0xe6b78b,
-    0xe6b78c,
-    0xe6b78d,
-    0xe6b78e,
-    0xe6b78f,
-    0xe6b790,
-    0xe6b791,
-    0xe6b792,
-    0xe6b793,
-    0xe6b794,
-    0xe6b795,
-    0xe6b796,
-    0xe6b797,
-    0xe6b798,
-    0xe6b799,
-    0xe6b79a,
-    0xe6b79b,
-    0xe6b79c,
-    0xe6b79d,
-    0xe6b79e,
-    0xe6b79f,
-    0xe6b7a0,
-    0xe6b7a1,
-    0xe6b7a2,
-    0xe6b7a3,
-    0xe6b7a4,
-    0xe6b7a5,
-    0xe6b7a6,
-    0xe6b7a7,
-    0xe6b7a8,
-    0xe6b7a9,
-    0xe6b7aa,
-    0xe6b7ab,
-    0xe6b7ac,
-    0xe6b7ad,
-    0xe6b7ae,
-    0xe6b7af,
-    0xe6b7b0,
-    0xe6b7b1,
-    0xe6b7b2,
-    0xe6b7b3,
-    0xe6b7b4,
-    0xe6b7b5,
-    0xe6b7b6,
-    0xe6b7b7,
-    0xe6b7b8,
-    0xe6b7b9,
-    0xe6b7ba,
-    0xe6b7bb,
-    0xe6b7bc,
-    0xe6b7bd,
-    0xe6b7be,
-    0xe6b7bf,
-    0xe6b880,
-    0xe6b881,
-    0xe6b882,
-    0xe6b883,
-    0xe6b884,
-    0xe6b885,
-    0xe6b886,
-    0xe6b887,
-    0xe6b888,
-    0xe6b889,
-    0xe6b88a,
-    0xe6b88b,
-    0xe6b88c,
-    0xe6b88d,
-    0xe6b88e,
-    0xe6b88f,
-    0xe6b890,
-    0xe6b891,
-    0xe6b892,
-    0xe6b893,
-    0xe6b894,
-    0xe6b895,
-    0xe6b896,
-    0xe6b897,
-    0xe6b898,
-    0xe6b899,
-    0xe6b89a,
-    0xe6b89b,
-    0xe6b89c,
-    0xe6b89d,
-    0xe6b89e,
-    0xe6b89f,
-    0xe6b8a0,
-    0xe6b8a1,
-    0xe6b8a2,
-    0xe6b8a3,
-    0xe6b8a4,
-    0xe6b8a5,
-    0xe6b8a6,
-    0xe6b8a7,
-    0xe6b8a8,
-    0xe6b8a9,
-    0xe6b8aa,
-    0xe6b8ab,
-    0xe6b8ac,
-    0xe6b8ad,
-    0xe6b8ae,
-    0xe6b8af,
-    0xe6b8b0,
-    0xe6b8b1,
-    0xe6b8b2,
-    0xe6b8b3,
-    0xe6b8b4,
-    0xe6b8b5,
-    0xe6b8b6,
-    0xe6b8b7,
-    0xe6b8b8,
-    0xe6b8b9,
-    0xe6b8ba,
-    0xe6b8bb,
-    0xe6b8bc,
-    0xe6b8bd,
-    0xe6b8be,
-    0xe6b8bf,
-    0xe6b980,
-    0xe6b981,
-    0xe6b982,
-    0xe6b983,
-    0xe6b984,
-    0xe6b985,
-    0xe6b986,
-    0xe6b987,
-    0xe6b988,
-    0xe6b989,
-    0xe6b98a,
-    0xe6b98b,
-    0xe6b98c,
-    0xe6b98d,
-    0xe6b98e,
-    0xe6b98f,
-    0xe6b990,
-    0xe6b991,
-    0xe6b992,
-    0xe6b993,
-    0xe6b994,
-    0xe6b995,
-    0xe6b996,
-    0xe6b997,
-    0xe6b998,
-    0xe6b999,
-    0xe6b99a,
-    0xe6b99b,
-    0xe6b99c,
-    0xe6b99d,
-    0xe6b99e,
-    0xe6b99f,
-    0xe6b9a0,
-    0xe6b9a1,
-    0xe6b9a2,
-    0xe6b9a3,
-    0xe6b9a4,
-    0xe6b9a5,
-    0xe6b9a6,
-    0xe6b9a7,
-    0xe6b9a8,
-    0xe6b9a9,
-    0xe6b9aa,
-    0xe6b9ab,
-    0xe6b9ac,
-    0xe6b9ad,
-    0xe6b9ae,
-    0xe6b9af,
-    0xe6b9b0,
-    0xe6b9b1,
-    0xe6b9b2,
-    0xe6b9b3,
-    0xe6b9b4,
-    0xe6b9b5,
-    0xe6b9b6,
-    0xe6b9b7,
-    0xe6b9b8,
-    0xe6b9b9,
-    0xe6b9ba,
-    0xe6b9bb,
-    0xe6b9bc,
-    0xe6b9bd,
-    0xe6b9be,
-    0xe6b9bf,
-    0xe6ba80,
-    0xe6ba81,
-    0xe6ba82,
-    0xe6ba83,
-    0xe6ba84,
-    0xe6ba85,
-    0xe6ba86,
-    0xe6ba87,
-    0xe6ba88,
-    0xe6ba89,
-    0xe6ba8a,
-    0xe6ba8b,
-    0xe6ba8c,
-    0xe6ba8d,
-    0xe6ba8e,
-    0xe6ba8f,
-    0xe6ba90,
-    0xe6ba91,
-    0xe6ba92,
-    0xe6ba93,
-    0xe6ba94,
-    0xe6ba95,
-    0xe6ba96,
-    0xe6ba97,
-    0xe6ba98,
-    0xe6ba99,
-    0xe6ba9a,
-    0xe6ba9b,
-    0xe6ba9c,
-    0xe6ba9d,
-    0xe6ba9e,
-    0xe6ba9f,
-    0xe6baa0,
-    0xe6baa1,
-    0xe6baa2,
-    0xe6baa3,
-    0xe6baa4,
-    0xe6baa5,
-    0xe6baa6,
-    0xe6baa7,
-    0xe6baa8,
-    0xe6baa9,
-    0xe6baaa,
-    0xe6baab,
-    0xe6baac,
-    0xe6baad,
-    0xe6baae,
-    0xe6baaf,
-    0xe6bab0,
-    0xe6bab1,
-    0xe6bab2,
-    0xe6bab3,
-    0xe6bab4,
-    0xe6bab5,
-    0xe6bab6,
-    0xe6bab7,
-    0xe6bab8,
-    0xe6bab9,
-    0xe6baba,
-    0xe6babb,
-    0xe6babc,
-    0xe6babd,
-    0xe6babe,
-    0xe6babf,
-    0xe6bb80,
-    0xe6bb81,
-    0xe6bb82,
-    0xe6bb83,
-    0xe6bb84,
-    0xe6bb85,
-    0xe6bb86,
-    0xe6bb87,
-    0xe6bb88,
-    0xe6bb89,
-    0xe6bb8a,
-    0xe6bb8b,
-    0xe6bb8c,
-    0xe6bb8d,
-    0xe6bb8e,
-    0xe6bb8f,
-    0xe6bb90,
-    0xe6bb91,
-    0xe6bb92,
-    0xe6bb93,
-    0xe6bb94,
-    0xe6bb95,
-    0xe6bb96,
-    0xe6bb97,
-    0xe6bb98,
-    0xe6bb99,
-    0xe6bb9a,
-    0xe6bb9b,
-    0xe6bb9c,
-    0xe6bb9d,
-    0xe6bb9e,
-    0xe6bb9f,
-    0xe6bba0,
-    0xe6bba1,
-    0xe6bba2,
-    0xe6bba3,
-    0xe6bba4,
-    0xe6bba5,
-    0xe6bba6,
-    0xe6bba7,
-    0xe6bba8,
-    0xe6bba9,
-    0xe6bbaa,
-    0xe6bbab,
-    0xe6bbac,
-    0xe6bbad,
-    0xe6bbae,
-    0xe6bbaf,
-    0xe6bbb0,
-    0xe6bbb1,
-    0xe6bbb2,
-    0xe6bbb3,
-    0xe6bbb4,
-    0xe6bbb5,
-    0xe6bbb6,
-    0xe6bbb7,
-    0xe6bbb8,
-    0xe6bbb9,
-    0xe6bbba,
-    0xe6bbbb,
-    0xe6bbbc,
-    0xe6bbbd,
-    0xe6bbbe,
-    0xe6bbbf,
-    0xe6bc80,
-    0xe6bc81,
-    0xe6bc82,
-    0xe6bc83,
-    0xe6bc84,
-    0xe6bc85,
-    0xe6bc86,
-    0xe6bc87,
-    0xe6bc88,
-    0xe6bc89,
-    0xe6bc8a,
-    0xe6bc8b,
-    0xe6bc8c,
-    0xe6bc8d,
-    0xe6bc8e,
-    0xe6bc8f,
-    0xe6bc90,
-    0xe6bc91,
-    0xe6bc92,
-    0xe6bc93,
-    0xe6bc94,
-    0xe6bc95,
-    0xe6bc96,
-    0xe6bc97,
-    0xe6bc98,
-    0xe6bc99,
-    0xe6bc9a,
-    0xe6bc9b,
-    0xe6bc9c,
-    0xe6bc9d,
-    0xe6bc9e,
-    0xe6bc9f,
-    0xe6bca0,
-    0xe6bca1,
-    0xe6bca2,
-    0xe6bca3,
-    0xe6bca4,
-    0xe6bca5,
-    0xe6bca6,
-    0xe6bca7,
-    0xe6bca8,
-    0xe6bca9,
-    0xe6bcaa,
-    0xe6bcab,
-    0xe6bcac,
-    0xe6bcad,
-    0xe6bcae,
-    0xe6bcaf,
-    0xe6bcb0,
-    0xe6bcb1,
-    0xe6bcb2,
-    0xe6bcb3,
-    0xe6bcb4,
-    0xe6bcb5,
-    0xe6bcb6,
-    0xe6bcb7,
-    0xe6bcb8,
-    0xe6bcb9,
-    0xe6bcba,
-    0xe6bcbb,
-    0xe6bcbc,
-    0xe6bcbd,
-    0xe6bcbe,
-    0xe6bcbf,
-    0xe6bd80,
-    0xe6bd81,
-    0xe6bd82,
-    0xe6bd83,
-    0xe6bd84,
-    0xe6bd85,
-    0xe6bd86,
-    0xe6bd87,
-    0xe6bd88,
-    0xe6bd89,
-    0xe6bd8a,
-    0xe6bd8b,
-    0xe6bd8c,
-    0xe6bd8d,
-    0xe6bd8e,
-    0xe6bd8f,
-    0xe6bd90,
-    0xe6bd91,
-    0xe6bd92,
-    0xe6bd93,
-    0xe6bd94,
-    0xe6bd95,
-    0xe6bd96,
-    0xe6bd97,
-    0xe6bd98,
-    0xe6bd99,
-    0xe6bd9a,
-    0xe6bd9b,
-    0xe6bd9c,
-    0xe6bd9d,
-    0xe6bd9e,
-    0xe6bd9f,
-    0xe6bda0,
-    0xe6bda1,
-    0xe6bda2,
-    0xe6bda3,
-    0xe6bda4,
-    0xe6bda5,
-    0xe6bda6,
-    0xe6bda7,
-    0xe6bda8,
-    0xe6bda9,
-    0xe6bdaa,
-    0xe6bdab,
-    0xe6bdac,
-    0xe6bdad,
-    0xe6bdae,
-    0xe6bdaf,
-    0xe6bdb0,
-    0xe6bdb1,
-    0xe6bdb2,
-    0xe6bdb3,
-    0xe6bdb4,
-    0xe6bdb5,
-    0xe6bdb6,
-    0xe6bdb7,
-    0xe6bdb8,
-    0xe6bdb9,
-    0xe6bdba,
-    0xe6bdbb,
-    0xe6bdbc,
-    0xe6bdbd,
-    0xe6bdbe,
-    0xe6bdbf,
-    0xe6be80,
-    0xe6be81,
-    0xe6be82,
-    0xe6be83,
-    0xe6be84,
-    0xe6be85,
-    0xe6be86,
-    0xe6be87,
-    0xe6be88,
-    0xe6be89,
-    0xe6be8a,
-    0xe6be8b,
-    0xe6be8c,
-    0xe6be8d,
-    0xe6be8e,
-    0xe6be8f,
-    0xe6be90,
-    0xe6be91,
-    0xe6be92,
-    0xe6be93,
-    0xe6be94,
-    0xe6be95,
-    0xe6be96,
-    0xe6be97,
-    0xe6be98,
-    0xe6be99,
-    0xe6be9a,
-    0xe6be9b,
-    0xe6be9c,
-    0xe6be9d,
-    0xe6be9e,
-    0xe6be9f,
-    0xe6bea0,
-    0xe6bea1,
-    0xe6bea2,
-    0xe6bea3,
-    0xe6bea4,
-    0xe6bea5,
-    0xe6bea6,
-    0xe6bea7,
-    0xe6bea8,
-    0xe6bea9,
-    0xe6beaa,
-    0xe6beab,
-    0xe6beac,
-    0xe6bead,
-    0xe6beae,
-    0xe6beaf,
-    0xe6beb0,
-    0xe6beb1,
-    0xe6beb2,
-    0xe6beb3,
-    0xe6beb4,
-    0xe6beb5,
-    0xe6beb6,
-    0xe6beb7,
-    0xe6beb8,
-    0xe6beb9,
-    0xe6beba,
-    0xe6bebb,
-    0xe6bebc,
-    0xe6bebd,
-    0xe6bebe,
-    0xe6bebf,
-    0xe6bf80,
-    0xe6bf81,
-    0xe6bf82,
-    0xe6bf83,
-    0xe6bf84,
-    0xe6bf85,
-    0xe6bf86,
-    0xe6bf87,
-    0xe6bf88,
-    0xe6bf89,
-    0xe6bf8a,
-    0xe6bf8b,
-    0xe6bf8c,
-    0xe6bf8d,
-    0xe6bf8e,
-    0xe6bf8f,
-    0xe6bf90,
-    0xe6bf91,
-    0xe6bf92,
-    0xe6bf93,
-    0xe6bf94,
-    0xe6bf95,
-    0xe6bf96,
-    0xe6bf97,
-    0xe6bf98,
-    0xe6bf99,
-    0xe6bf9a,
-    0xe6bf9b,
-    0xe6bf9c,
-    0xe6bf9d,
-    0xe6bf9e,
-    0xe6bf9f,
-    0xe6bfa0,
-    0xe6bfa1,
-    0xe6bfa2,
-    0xe6bfa3,
-    0xe6bfa4,
-    0xe6bfa5,
-    0xe6bfa6,
-    0xe6bfa7,
-    0xe6bfa8,
-    0xe6bfa9,
-    0xe6bfaa,
-    0xe6bfab,
-    0xe6bfac,
-    0xe6bfad,
-    0xe6bfae,
-    0xe6bfaf,
-    0xe6bfb0,
-    0xe6bfb1,
-    0xe6bfb2,
-    0xe6bfb3,
-    0xe6bfb4,
-    0xe6bfb5,
-    0xe6bfb6,
-    0xe6bfb7,
-    0xe6bfb8,
-    0xe6bfb9,
-    0xe6bfba,
-    0xe6bfbb,
-    0xe6bfbc,
-    0xe6bfbd,
-    0xe6bfbe,
-    0xe6bfbf,
-    0xe78080,
-    0xe78081,
-    0xe78082,
-    0xe78083,
-    0xe78084,
-    0xe78085,
-    0xe78086,
-    0xe78087,
-    0xe78088,
-    0xe78089,
-    0xe7808a,
-    0xe7808b,
-    0xe7808c,
-    0xe7808d,
-    0xe7808e,
-    0xe7808f,
-    0xe78090,
-    0xe78091,
-    0xe78092,
-    0xe78093,
-    0xe78094,
-    0xe78095,
-    0xe78096,
-    0xe78097,
-    0xe78098,
-    0xe78099,
-    0xe7809a,
-    0xe7809b,
-    0xe7809c,
-    0xe7809d,
-    0xe7809e,
-    0xe7809f,
-    0xe780a0,
-    0xe780a1,
-    0xe780a2,
-    0xe780a3,
-    0xe780a4,
-    0xe780a5,
-    0xe780a6,
-    0xe780a7,
-    0xe780a8,
-    0xe780a9,
-    0xe780aa,
-    0xe780ab,
-    0xe780ac,
-    0xe780ad,
-    0xe780ae,
-    0xe780af,
-    0xe780b0,
-    0xe780b1,
-    0xe780b2,
-    0xe780b3,
-    0xe780b4,
-    0xe780b5,
-    0xe780b6,
-    0xe780b7,
-    0xe780b8,
-    0xe780b9,
-    0xe780ba,
-    0xe780bb,
-    0xe780bc,
-    0xe780bd,
-    0xe780be,
-    0xe780bf,
-    0xe78180,
-    0xe78181,
-    0xe78182,
-    0xe78183,
-    0xe78184,
-    0xe78185,
-    0xe78186,
-    0xe78187,
-    0xe78188,
-    0xe78189,
-    0xe7818a,
-    0xe7818b,
-    0xe7818c,
-    0xe7818d,
-    0xe7818e,
-    0xe7818f,
-    0xe78190,
-    0xe78191,
-    0xe78192,
-    0xe78193,
-    0xe78194,
-    0xe78195,
-    0xe78196,
-    0xe78197,
-    0xe78198,
-    0xe78199,
-    0xe7819a,
-    0xe7819b,
-    0xe7819c,
-    0xe7819d,
-    0xe7819e,
-    0xe7819f,
-    0xe781a0,
-    0xe781a1,
-    0xe781a2,
-    0xe781a3,
-    0xe781a4,
-    0xe781a5,
-    0xe781a6,
-    0xe781a7,
-    0xe781a8,
-    0xe781a9,
-    0xe781aa,
-    0xe781ab,
-    0xe781ac,
-    0xe781ad,
-    0xe781ae,
-    0xe781af,
-    0xe781b0,
-    0xe781b1,
-    0xe781b2,
-    0xe781b3,
-    0xe781b4,
-    0xe781b5,
-    0xe781b6,
-    0xe781b7,
-    0xe781b8,
-    0xe781b9,
-    0xe781ba,
-    0xe781bb,
-    0xe781bc,
-    0xe781bd,
-    0xe781be,
-    0xe781bf,
-    0xe78280,
-    0xe78281,
-    0xe78282,
-    0xe78283,
-    0xe78284,
-    0xe78285,
-    0xe78286,
-    0xe78287,
-    0xe78288,
-    0xe78289,
-    0xe7828a,
-    0xe7828b,
-    0xe7828c,
-    0xe7828d,
-    0xe7828e,
-    0xe7828f,
-    0xe78290,
-    0xe78291,
-    0xe78292,
-    0xe78293,
-    0xe78294,
-    0xe78295,
-    0xe78296,
-    0xe78297,
-    0xe78298,
-    0xe78299,
-    0xe7829a,
-    0xe7829b,
-    0xe7829c,
-    0xe7829d,
-    0xe7829e,
-    0xe7829f,
-    0xe782a0,
-    0xe782a1,
-    0xe782a2,
-    0xe782a3,
-    0xe782a4,
-    0xe782a5,
-    0xe782a6,
-    0xe782a7,
-    0xe782a8,
-    0xe782a9,
-    0xe782aa,
-    0xe782ab,
-    0xe782ac,
-    0xe782ad,
-    0xe782ae,
-    0xe782af,
-    0xe782b0,
-    0xe782b1,
-    0xe782b2,
-    0xe782b3,
-    0xe782b4,
-    0xe782b5,
-    0xe782b6,
-    0xe782b7,
-    0xe782b8,
-    0xe782b9,
-    0xe782ba,
-    0xe782bb,
-    0xe782bc,
-    0xe782bd,
-    0xe782be,
-    0xe782bf,
-    0xe78380,
-    0xe78381,
-    0xe78382,
-    0xe78383,
-    0xe78384,
-    0xe78385,
-    0xe78386,
-    0xe78387,
-    0xe78388,
-    0xe78389,
-    0xe7838a,
-    0xe7838b,
-    0xe7838c,
-    0xe7838d,
-    0xe7838e,
-    0xe7838f,
-    0xe78390,
-    0xe78391,
-    0xe78392,
-    0xe78393,
-    0xe78394,
-    0xe78395,
-    0xe78396,
-    0xe78397,
-    0xe78398,
-    0xe78399,
-    0xe7839a,
-    0xe7839b,
-    0xe7839c,
-    0xe7839d,
-    0xe7839e,
-    0xe7839f,
-    0xe783a0,
-    0xe783a1,
-    0xe783a2,
-    0xe783a3,
-    0xe783a4,
-    0xe783a5,
-    0xe783a6,
-    0xe783a7,
-    0xe783a8,
-    0xe783a9,
-    0xe783aa,
-    0xe783ab,
-    0xe783ac,
-    0xe783ad,
-    0xe783ae,
-    0xe783af,
-    0xe783b0,
-    0xe783b1,
-    0xe783b2,
-    0xe783b3,
-    0xe783b4,
-    0xe783b5,
-    0xe783b6,
-    0xe783b7,
-    0xe783b8,
-    0xe783b9,
-    0xe783ba,
-    0xe783bb,
-    0xe783bc,
-    0xe783bd,
-    0xe783be,
-    0xe783bf,
-    0xe78480,
-    0xe78481,
-    0xe78482,
-    0xe78483,
-    0xe78484,
-    0xe78485,
-    0xe78486,
-    0xe78487,
-    0xe78488,
-    0xe78489,
-    0xe7848a,
-    0xe7848b,
-    0xe7848c,
-    0xe7848d,
-    0xe7848e,
-    0xe7848f,
-    0xe78490,
-    0xe78491,
-    0xe78492,
-    0xe78493,
-    0xe78494,
-    0xe78495,
-    0xe78496,
-    0xe78497,
-    0xe78498,
-    0xe78499,
-    0xe7849a,
-    0xe7849b,
-    0xe7849c,
-    0xe7849d,
-    0xe7849e,
-    0xe7849f,
-    0xe784a0,
-    0xe784a1,
-    0xe784a2,
-    0xe784a3,
-    0xe784a4,
-    0xe784a5,
-    0xe784a6,
-    0xe784a7,
-    0xe784a8,
-    0xe784a9,
-    0xe784aa,
-    0xe784ab,
-    0xe784ac,
-    0xe784ad,
-    0xe784ae,
-    0xe784af,
-    0xe784b0,
-    0xe784b1,
-    0xe784b2,
-    0xe784b3,
-    0xe784b4,
-    0xe784b5,
-    0xe784b6,
-    0xe784b7,
-    0xe784b8,
-    0xe784b9,
-    0xe784ba,
-    0xe784bb,
-    0xe784bc,
-    0xe784bd,
-    0xe784be,
-    0xe784bf,
-    0xe78580,
-    0xe78581,
-    0xe78582,
-    0xe78583,
-    0xe78584,
-    0xe78585,
-    0xe78586,
-    0xe78587,
-    0xe78588,
-    0xe78589,
-    0xe7858a,
-    0xe7858b,
-    0xe7858c,
-    0xe7858d,
-    0xe7858e,
-    0xe7858f,
-    0xe78590,
-    0xe78591,
-    0xe78592,
-    0xe78593,
-    0xe78594,
-    0xe78595,
-    0xe78596,
-    0xe78597,
-    0xe78598,
-    0xe78599,
-    0xe7859a,
-    0xe7859b,
-    0xe7859c,
-    0xe7859d,
-    0xe7859e,
-    0xe7859f,
-    0xe785a0,
-    0xe785a1,
-    0xe785a2,
-    0xe785a3,
-    0xe785a4,
-    0xe785a5,
-    0xe785a6,
-    0xe785a7,
-    0xe785a8,
-    0xe785a9,
-    0xe785aa,
-    0xe785ab,
-    0xe785ac,
-    0xe785ad,
-    0xe785ae,
-    0xe785af,
-    0xe785b0,
-    0xe785b1,
-    0xe785b2,
-    0xe785b3,
-    0xe785b4,
-    0xe785b5,
-    0xe785b6,
-    0xe785b7,
-    0xe785b8,
-    0xe785b9,
-    0xe785ba,
-    0xe785bb,
-    0xe785bc,
-    0xe785bd,
-    0xe785be,
-    0xe785bf,
-    0xe78680,
-    0xe78681,
-    0xe78682,
-    0xe78683,
-    0xe78684,
-    0xe78685,
-    0xe78686,
-    0xe78687,
-    0xe78688,
-    0xe78689,
-    0xe7868a,
-    0xe7868b,
-    0xe7868c,
-    0xe7868d,
-    0xe7868e,
-    0xe7868f,
-    0xe78690,
-    0xe78691,
-    0xe78692,
-    0xe78693,
-    0xe78694,
-    0xe78695,
-    0xe78696,
-    0xe78697,
-    0xe78698,
-    0xe78699,
-    0xe7869a,
-    0xe7869b,
-    0xe7869c,
-    0xe7869d,
-    0xe7869e,
-    0xe7869f,
-    0xe786a0,
-    0xe786a1,
-    0xe786a2,
-    0xe786a3,
-    0xe786a4,
-    0xe786a5,
-    0xe786a6,
-    0xe786a7,
-    0xe786a8,
-    0xe786a9,
-    0xe786aa,
-    0xe786ab,
-    0xe786ac,
-    0xe786ad,
-    0xe786ae,
-    0xe786af,
-    0xe786b0,
-    0xe786b1,
-    0xe786b2,
-    0xe786b3,
-    0xe786b4,
-    0xe786b5,
-    0xe786b6,
-    0xe786b7,
-    0xe786b8,
-    0xe786b9,
-    0xe786ba,
-    0xe786bb,
-    0xe786bc,
-    0xe786bd,
-    0xe786be,
-    0xe786bf,
-    0xe78780,
-    0xe78781,
-    0xe78782,
-    0xe78783,
-    0xe78784,
-    0xe78785,
-    0xe78786,
-    0xe78787,
-    0xe78788,
-    0xe78789,
-    0xe7878a,
-    0xe7878b,
-    0xe7878c,
-    0xe7878d,
-    0xe7878e,
-    0xe7878f,
-    0xe78790,
-    0xe78791,
-    0xe78792,
-    0xe78793,
-    0xe78794,
-    0xe78795,
-    0xe78796,
-    0xe78797,
-    0xe78798,
-    0xe78799,
-    0xe7879a,
-    0xe7879b,
-    0xe7879c,
-    0xe7879d,
-    0xe7879e,
-    0xe7879f,
-    0xe787a0,
-    0xe787a1,
-    0xe787a2,
-    0xe787a3,
-    0xe787a4,
-    0xe787a5,
-    0xe787a6,
-    0xe787a7,
-    0xe787a8,
-    0xe787a9,
-    0xe787aa,
-    0xe787ab,
-    0xe787ac,
-    0xe787ad,
-    0xe787ae,
-    0xe787af,
-    0xe787b0,
-    0xe787b1,
-    0xe787b2,
-    0xe787b3,
-    0xe787b4,
-    0xe787b5,
-    0xe787b6,
-    0xe787b7,
-    0xe787b8,
-    0xe787b9,
-    0xe787ba,
-    0xe787bb,
-    0xe787bc,
-    0xe787bd,
-    0xe787be,
-    0xe787bf,
-    0xe78880,
-    0xe78881,
-    0xe78882,
-    0xe78883,
-    0xe78884,
-    0xe78885,
-    0xe78886,
-    0xe78887,
-    0xe78888,
-    0xe78889,
-    0xe7888a,
-    0xe7888b,
-    0xe7888c,
-    0xe7888d,
-    0xe7888e,
-    0xe7888f,
-    0xe78890,
-    0xe78891,
-    0xe78892,
-    0xe78893,
-    0xe78894,
-    0xe78895,
-    0xe78896,
-    0xe78897,
-    0xe78898,
-    0xe78899,
-    0xe7889a,
-    0xe7889b,
-    0xe7889c,
-    0xe7889d,
-    0xe7889e,
-    0xe7889f,
-    0xe788a0,
-    0xe788a1,
-    0xe788a2,
-    0xe788a3,
-    0xe788a4,
-    0xe788a5,
-    0xe788a6,
-    0xe788a7,
-    0xe788a8,
-    0xe788a9,
-    0xe788aa,
-    0xe788ab,
-    0xe788ac,
-    0xe788ad,
-    0xe788ae,
-    0xe788af,
-    0xe788b0,
-    0xe788b1,
-    0xe788b2,
-    0xe788b3,
-    0xe788b4,
-    0xe788b5,
-    0xe788b6,
-    0xe788b7,
-    0xe788b8,
-    0xe788b9,
-    0xe788ba,
-    0xe788bb,
-    0xe788bc,
-    0xe788bd,
-    0xe788be,
-    0xe788bf,
-    0xe78980,
-    0xe78981,
-    0xe78982,
-    0xe78983,
-    0xe78984,
-    0xe78985,
-    0xe78986,
-    0xe78987,
-    0xe78988,
-    0xe78989,
-    0xe7898a,
-    0xe7898b,
-    0xe7898c,
-    0xe7898d,
-    0xe7898e,
-    0xe7898f,
-    0xe78990,
-    0xe78991,
-    0xe78992,
-    0xe78993,
-    0xe78994,
-    0xe78995,
-    0xe78996,
-    0xe78997,
-    0xe78998,
-    0xe78999,
-    0xe7899a,
-    0xe7899b,
-    0xe7899c,
-    0xe7899d,
-    0xe7899e,
-    0xe7899f,
-    0xe789a0,
-    0xe789a1,
-    0xe789a2,
-    0xe789a3,
-    0xe789a4,
-    0xe789a5,
-    0xe789a6,
-    0xe789a7,
-    0xe789a8,
-    0xe789a9,
-    0xe789aa,
-    0xe789ab,
-    0xe789ac,
-    0xe789ad,
-    0xe789ae,
-    0xe789af,
-    0xe789b0,
-    0xe789b1,
-    0xe789b2,
-    0xe789b3,
-    0xe789b4,
-    0xe789b5,
-    0xe789b6,
-    0xe789b7,
-    0xe789b8,
-    0xe789b9,
-    0xe789ba,
-    0xe789bb,
-    0xe789bc,
-    0xe789bd,
-    0xe789be,
-    0xe789bf,
-    0xe78a80,
-    0xe78a81,
-    0xe78a82,
-    0xe78a83,
-    0xe78a84,
-    0xe78a85,
-    0xe78a86,
-    0xe78a87,
-    0xe78a88,
-    0xe78a89,
-    0xe78a8a,
-    0xe78a8b,
-    0xe78a8c,
-    0xe78a8d,
-    0xe78a8e,
-    0xe78a8f,
-    0xe78a90,
-    0xe78a91,
-    0xe78a92,
-    0xe78a93,
-    0xe78a94,
-    0xe78a95,
-    0xe78a96,
-    0xe78a97,
-    0xe78a98,
-    0xe78a99,
-    0xe78a9a,
-    0xe78a9b,
-    0xe78a9c,
-    0xe78a9d,
-    0xe78a9e,
-    0xe78a9f,
-    0xe78aa0,
-    0xe78aa1,
-    0xe78aa2,
-    0xe78aa3,
-    0xe78aa4,
-    0xe78aa5,
-    0xe78aa6,
-    0xe78aa7,
-    0xe78aa8,
-    0xe78aa9,
-    0xe78aaa,
-    0xe78aab,
-    0xe78aac,
-    0xe78aad,
-    0xe78aae,
-    0xe78aaf,
-    0xe78ab0,
-    0xe78ab1,
-    0xe78ab2,
-    0xe78ab3,
-    0xe78ab4,
-    0xe78ab5,
-    0xe78ab6,
-    0xe78ab7,
-    0xe78ab8,
-    0xe78ab9,
-    0xe78aba,
-    0xe78abb,
-    0xe78abc,
-    0xe78abd,
-    0xe78abe,
-    0xe78abf,
-    0xe78b80,
-    0xe78b81,
-    0xe78b82,
-    0xe78b83,
-    0xe78b84,
-    0xe78b85,
-    0xe78b86,
-    0xe78b87,
-    0xe78b88,
-    0xe78b89,
-    0xe78b8a,
-    0xe78b8b,
-    0xe78b8c,
-    0xe78b8d,
-    0xe78b8e,
-    0xe78b8f,
-    0xe78b90,
-    0xe78b91,
-    0xe78b92,
-    0xe78b93,
-    0xe78b94,
-    0xe78b95,
-    0xe78b96,
-    0xe78b97,
-    0xe78b98,
-    0xe78b99,
-    0xe78b9a,
-    0xe78b9b,
-    0xe78b9c,
-    0xe78b9d,
-    0xe78b9e,
-    0xe78b9f,
-    0xe78ba0,
-    0xe78ba1,
-    0xe78ba2,
-    0xe78ba3,
-    0xe78ba4,
-    0xe78ba5,
-    0xe78ba6,
-    0xe78ba7,
-    0xe78ba8,
-    0xe78ba9,
-    0xe78baa,
-    0xe78bab,
-    0xe78bac,
-    0xe78bad,
-    0xe78bae,
-    0xe78baf,
-    0xe78bb0,
-    0xe78bb1,
-    0xe78bb2,
-    0xe78bb3,
-    0xe78bb4,
-    0xe78bb5,
-    0xe78bb6,
-    0xe78bb7,
-    0xe78bb8,
-    0xe78bb9,
-    0xe78bba,
-    0xe78bbb,
-    0xe78bbc,
-    0xe78bbd,
-    0xe78bbe,
-    0xe78bbf,
-    0xe78c80,
-    0xe78c81,
-    0xe78c82,
-    0xe78c83,
-    0xe78c84,
-    0xe78c85,
-    0xe78c86,
-    0xe78c87,
-    0xe78c88,
-    0xe78c89,
-    0xe78c8a,
-    0xe78c8b,
-    0xe78c8c,
-    0xe78c8d,
-    0xe78c8e,
-    0xe78c8f,
-    0xe78c90,
-    0xe78c91,
-    0xe78c92,
-    0xe78c93,
-    0xe78c94,
-    0xe78c95,
-    0xe78c96,
-    0xe78c97,
-    0xe78c98,
-    0xe78c99,
-    0xe78c9a,
-    0xe78c9b,
-    0xe78c9c,
-    0xe78c9d,
-    0xe78c9e,
-    0xe78c9f,
-    0xe78ca0,
-    0xe78ca1,
-    0xe78ca2,
-    0xe78ca3,
-    0xe78ca4,
-    0xe78ca5,
-    0xe78ca6,
-    0xe78ca7,
-    0xe78ca8,
-    0xe78ca9,
-    0xe78caa,
-    0xe78cab,
-    0xe78cac,
-    0xe78cad,
-    0xe78cae,
-    0xe78caf,
-    0xe78cb0,
-    0xe78cb1,
-    0xe78cb2,
-    0xe78cb3,
-    0xe78cb4,
-    0xe78cb5,
-    0xe78cb6,
-    0xe78cb7,
-    0xe78cb8,
-    0xe78cb9,
-    0xe78cba,
-    0xe78cbb,
-    0xe78cbc,
-    0xe78cbd,
-    0xe78cbe,
-    0xe78cbf,
-    0xe78d80,
-    0xe78d81,
-    0xe78d82,
-    0xe78d83,
-    0xe78d84,
-    0xe78d85,
-    0xe78d86,
-    0xe78d87,
-    0xe78d88,
-    0xe78d89,
-    0xe78d8a,
-    0xe78d8b,
-    0xe78d8c,
-    0xe78d8d,
-    0xe78d8e,
-    0xe78d8f,
-    0xe78d90,
-    0xe78d91,
-    0xe78d92,
-    0xe78d93,
-    0xe78d94,
-    0xe78d95,
-    0xe78d96,
-    0xe78d97,
-    0xe78d98,
-    0xe78d99,
-    0xe78d9a,
-    0xe78d9b,
-    0xe78d9c,
-    0xe78d9d,
-    0xe78d9e,
-    0xe78d9f,
-    0xe78da0,
-    0xe78da1,
-    0xe78da2,
-    0xe78da3,
-    0xe78da4,
-    0xe78da5,
-    0xe78da6,
-    0xe78da7,
-    0xe78da8,
-    0xe78da9,
-    0xe78daa,
-    0xe78dab,
-    0xe78dac,
-    0xe78dad,
-    0xe78dae,
-    0xe78daf,
-    0xe78db0,
-    0xe78db1,
-    0xe78db2,
-    0xe78db3,
-    0xe78db4,
-    0xe78db5,
-    0xe78db6,
-    0xe78db7,
-    0xe78db8,
-    0xe78db9,
-    0xe78dba,
-    0xe78dbb,
-    0xe78dbc,
-    0xe78dbd,
-    0xe78dbe,
-    0xe78dbf,
-    0xe78e80,
-    0xe78e81,
-    0xe78e82,
-    0xe78e83,
-    0xe78e84,
-    0xe78e85,
-    0xe78e86,
-    0xe78e87,
-    0xe78e88,
-    0xe78e89,
-    0xe78e8a,
-    0xe78e8b,
-    0xe78e8c,
-    0xe78e8d,
-    0xe78e8e,
-    0xe78e8f,
-    0xe78e90,
-    0xe78e91,
-    0xe78e92,
-    0xe78e93,
-    0xe78e94,
-    0xe78e95,
-    0xe78e96,
-    0xe78e97,
-    0xe78e98,
-    0xe78e99,
-    0xe78e9a,
-    0xe78e9b,
-    0xe78e9c,
-    0xe78e9d,
-    0xe78e9e,
-    0xe78e9f,
-    0xe78ea0,
-    0xe78ea1,
-    0xe78ea2,
-    0xe78ea3,
-    0xe78ea4,
-    0xe78ea5,
-    0xe78ea6,
-    0xe78ea7,
-    0xe78ea8,
-    0xe78ea9,
-    0xe78eaa,
-    0xe78eab,
-    0xe78eac,
-    0xe78ead,
-    0xe78eae,
-    0xe78eaf,
-    0xe78eb0,
-    0xe78eb1,
-    0xe78eb2,
-    0xe78eb3,
-    0xe78eb4,
-    0xe78eb5,
-    0xe78eb6,
-    0xe78eb7,
-    0xe78eb8,
-    0xe78eb9,
-    0xe78eba,
-    0xe78ebb,
-    0xe78ebc,
-    0xe78ebd,
-    0xe78ebe,
-    0xe78ebf,
-    0xe78f80,
-    0xe78f81,
-    0xe78f82,
-    0xe78f83,
-    0xe78f84,
-    0xe78f85,
-    0xe78f86,
-    0xe78f87,
-    0xe78f88,
-    0xe78f89,
-    0xe78f8a,
-    0xe78f8b,
-    0xe78f8c,
-    0xe78f8d,
-    0xe78f8e,
-    0xe78f8f,
-    0xe78f90,
-    0xe78f91,
-    0xe78f92,
-    0xe78f93,
-    0xe78f94,
-    0xe78f95,
-    0xe78f96,
-    0xe78f97,
-    0xe78f98,
-    0xe78f99,
-    0xe78f9a,
-    0xe78f9b,
-    0xe78f9c,
-    0xe78f9d,
-    0xe78f9e,
-    0xe78f9f,
-    0xe78fa0,
-    0xe78fa1,
-    0xe78fa2,
-    0xe78fa3,
-    0xe78fa4,
-    0xe78fa5,
-    0xe78fa6,
-    0xe78fa7,
-    0xe78fa8,
-    0xe78fa9,
-    0xe78faa,
-    0xe78fab,
-    0xe78fac,
-    0xe78fad,
-    0xe78fae,
-    0xe78faf,
-    0xe78fb0,
-    0xe78fb1,
-    0xe78fb2,
-    0xe78fb3,
-    0xe78fb4,
-    0xe78fb5,
-    0xe78fb6,
-    0xe78fb7,
-    0xe78fb8,
-    0xe78fb9,
-    0xe78fba,
-    0xe78fbb,
-    0xe78fbc,
-    0xe78fbd,
-    0xe78fbe,
-    0xe78fbf,
-    0xe79080,
-    0xe79081,
-    0xe79082,
-    0xe79083,
-    0xe79084,
-    0xe79085,
-    0xe79086,
-    0xe79087,
-    0xe79088,
-    0xe79089,
-    0xe7908a,
-    0xe7908b,
-    0xe7908c,
-    0xe7908d,
-    0xe7908e,
-    0xe7908f,
-    0xe79090,
-    0xe79091,
-    0xe79092,
-    0xe79093,
-    0xe79094,
-    0xe79095,
-    0xe79096,
-    0xe79097,
-    0xe79098,
-    0xe79099,
-    0xe7909a,
-    0xe7909b,
-    0xe7909c,
-    0xe7909d,
-    0xe7909e,
-    0xe7909f,
-    0xe790a0,
-    0xe790a1,
-    0xe790a2,
-    0xe790a3,
-    0xe790a4,
-    0xe790a5,
-    0xe790a6,
-    0xe790a7,
-    0xe790a8,
-    0xe790a9,
-    0xe790aa,
-    0xe790ab,
-    0xe790ac,
-    0xe790ad,
-    0xe790ae,
-    0xe790af,
-    0xe790b0,
-    0xe790b1,
-    0xe790b2,
-    0xe790b3,
-    0xe790b4,
-    0xe790b5,
-    0xe790b6,
-    0xe790b7,
-    0xe790b8,
-    0xe790b9,
-    0xe790ba,
-    0xe790bb,
-    0xe790bc,
-    0xe790bd,
-    0xe790be,
-    0xe790bf,
-    0xe79180,
-    0xe79181,
-    0xe79182,
-    0xe79183,
-    0xe79184,
-    0xe79185,
-    0xe79186,
-    0xe79187,
-    0xe79188,
-    0xe79189,
-    0xe7918a,
-    0xe7918b,
-    0xe7918c,
-    0xe7918d,
-    0xe7918e,
-    0xe7918f,
-    0xe79190,
-    0xe79191,
-    0xe79192,
-    0xe79193,
-    0xe79194,
-    0xe79195,
-    0xe79196,
-    0xe79197,
-    0xe79198,
-    0xe79199,
-    0xe7919a,
-    0xe7919b,
-    0xe7919c,
-    0xe7919d,
-    0xe7919e,
-    0xe7919f,
-    0xe791a0,
-    0xe791a1,
-    0xe791a2,
-    0xe791a3,
-    0xe791a4,
-    0xe791a5,
-    0xe791a6,
-    0xe791a7,
-    0xe791a8,
-    0xe791a9,
-    0xe791aa,
-    0xe791ab,
-    0xe791ac,
-    0xe791ad,
-    0xe791ae,
-    0xe791af,
-    0xe791b0,
-    0xe791b1,
-    0xe791b2,
-    0xe791b3,
-    0xe791b4,
-    0xe791b5,
-    0xe791b6,
-    0xe791b7,
-    0xe791b8,
-    0xe791b9,
-    0xe791ba,
-    0xe791bb,
-    0xe791bc,
-    0xe791bd,
-    0xe791be,
-    0xe791bf,
-    0xe79280,
-    0xe79281,
-    0xe79282,
-    0xe79283,
-    0xe79284,
-    0xe79285,
-    0xe79286,
-    0xe79287,
-    0xe79288,
-    0xe79289,
-    0xe7928a,
-    0xe7928b,
-    0xe7928c,
-    0xe7928d,
-    0xe7928e,
-    0xe7928f,
-    0xe79290,
-    0xe79291,
-    0xe79292,
-    0xe79293,
-    0xe79294,
-    0xe79295,
-    0xe79296,
-    0xe79297,
-    0xe79298,
-    0xe79299,
-    0xe7929a,
-    0xe7929b,
-    0xe7929c,
-    0xe7929d,
-    0xe7929e,
-    0xe7929f,
-    0xe792a0,
-    0xe792a1,
-    0xe792a2,
-    0xe792a3,
-    0xe792a4,
-    0xe792a5,
-    0xe792a6,
-    0xe792a7,
-    0xe792a8,
-    0xe792a9,
-    0xe792aa,
-    0xe792ab,
-    0xe792ac,
-    0xe792ad,
-    0xe792ae,
-    0xe792af,
-    0xe792b0,
-    0xe792b1,
-    0xe792b2,
-    0xe792b3,
-    0xe792b4,
-    0xe792b5,
-    0xe792b6,
-    0xe792b7,
-    0xe792b8,
-    0xe792b9,
-    0xe792ba,
-    0xe792bb,
-    0xe792bc,
-    0xe792bd,
-    0xe792be,
-    0xe792bf,
-    0xe79380,
-    0xe79381,
-    0xe79382,
-    0xe79383,
-    0xe79384,
-    0xe79385,
-    0xe79386,
-    0xe79387,
-    0xe79388,
-    0xe79389,
-    0xe7938a,
-    0xe7938b,
-    0xe7938c,
-    0xe7938d,
-    0xe7938e,
-    0xe7938f,
-    0xe79390,
-    0xe79391,
-    0xe79392,
-    0xe79393,
-    0xe79394,
-    0xe79395,
-    0xe79396,
-    0xe79397,
-    0xe79398,
-    0xe79399,
-    0xe7939a,
-    0xe7939b,
-    0xe7939c,
-    0xe7939d,
-    0xe7939e,
-    0xe7939f,
-    0xe793a0,
-    0xe793a1,
-    0xe793a2,
-    0xe793a3,
-    0xe793a4,
-    0xe793a5,
-    0xe793a6,
-    0xe793a7,
-    0xe793a8,
-    0xe793a9,
-    0xe793aa,
-    0xe793ab,
-    0xe793ac,
-    0xe793ad,
-    0xe793ae,
-    0xe793af,
-    0xe793b0,
-    0xe793b1,
-    0xe793b2,
-    0xe793b3,
-    0xe793b4,
-    0xe793b5,
-    0xe793b6,
-    0xe793b7,
-    0xe793b8,
-    0xe793b9,
-    0xe793ba,
-    0xe793bb,
-    0xe793bc,
-    0xe793bd,
-    0xe793be,
-    0xe793bf,
-    0xe79480,
-    0xe79481,
-    0xe79482,
-    0xe79483,
-    0xe79484,
-    0xe79485,
-    0xe79486,
-    0xe79487,
-    0xe79488,
-    0xe79489,
-    0xe7948a,
-    0xe7948b,
-    0xe7948c,
-    0xe7948d,
-    0xe7948e,
-    0xe7948f,
-    0xe79490,
-    0xe79491,
-    0xe79492,
-    0xe79493,
-    0xe79494,
-    0xe79495,
-    0xe79496,
-    0xe79497,
-    0xe79498,
-    0xe79499,
-    0xe7949a,
-    0xe7949b,
-    0xe7949c,
-    0xe7949d,
-    0xe7949e,
-    0xe7949f,
-    0xe794a0,
-    0xe794a1,
-    0xe794a2,
-    0xe794a3,
-    0xe794a4,
-    0xe794a5,
-    0xe794a6,
-    0xe794a7,
-    0xe794a8,
-    0xe794a9,
-    0xe794aa,
-    0xe794ab,
-    0xe794ac,
-    0xe794ad,
-    0xe794ae,
-    0xe794af,
-    0xe794b0,
-    0xe794b1,
-    0xe794b2,
-    0xe794b3,
-    0xe794b4,
-    0xe794b5,
-    0xe794b6,
-    0xe794b7,
-    0xe794b8,
-    0xe794b9,
-    0xe794ba,
-    0xe794bb,
-    0xe794bc,
-    0xe794bd,
-    0xe794be,
-    0xe794bf,
-    0xe79580,
-    0xe79581,
-    0xe79582,
-    0xe79583,
-    0xe79584,
-    0xe79585,
-    0xe79586,
-    0xe79587,
-    0xe79588,
-    0xe79589,
-    0xe7958a,
-    0xe7958b,
-    0xe7958c,
-    0xe7958d,
-    0xe7958e,
-    0xe7958f,
-    0xe79590,
-    0xe79591,
-    0xe79592,
-    0xe79593,
-    0xe79594,
-    0xe79595,
-    0xe79596,
-    0xe79597,
-    0xe79598,
-    0xe79599,
-    0xe7959a,
-    0xe7959b,
-    0xe7959c,
-    0xe7959d,
-    0xe7959e,
-    0xe7959f,
-    0xe795a0,
-    0xe795a1,
-    0xe795a2,
-    0xe795a3,
-    0xe795a4,
-    0xe795a5,
-    0xe795a6,
-    0xe795a7,
-    0xe795a8,
-    0xe795a9,
-    0xe795aa,
-    0xe795ab,
-    0xe795ac,
-    0xe795ad,
-    0xe795ae,
-    0xe795af,
-    0xe795b0,
-    0xe795b1,
-    0xe795b2,
-    0xe795b3,
-    0xe795b4,
-    0xe795b5,
-    0xe795b6,
-    0xe795b7,
-    0xe795b8,
-    0xe795b9,
-    0xe795ba,
-    0xe795bb,
-    0xe795bc,
-    0xe795bd,
-    0xe795be,
-    0xe795bf,
-    0xe79680,
-    0xe79681,
-    0xe79682,
-    0xe79683,
-    0xe79684,
-    0xe79685,
-    0xe79686,
-    0xe79687,
-    0xe79688,
-    0xe79689,
-    0xe7968a,
-    0xe7968b,
-    0xe7968c,
-    0xe7968d,
-    0xe7968e,
-    0xe7968f,
-    0xe79690,
-    0xe79691,
-    0xe79692,
-    0xe79693,
-    0xe79694,
-    0xe79695,
-    0xe79696,
-    0xe79697,
-    0xe79698,
-    0xe79699,
-    0xe7969a,
-    0xe7969b,
-    0xe7969c,
-    0xe7969d,
-    0xe7969e,
-    0xe7969f,
-    0xe796a0,
-    0xe796a1,
-    0xe796a2,
-    0xe796a3,
-    0xe796a4,
-    0xe796a5,
-    0xe796a6,
-    0xe796a7,
-    0xe796a8,
-    0xe796a9,
-    0xe796aa,
-    0xe796ab,
-    0xe796ac,
-    0xe796ad,
-    0xe796ae,
-    0xe796af,
-    0xe796b0,
-    0xe796b1,
-    0xe796b2,
-    0xe796b3,
-    0xe796b4,
-    0xe796b5,
-    0xe796b6,
-    0xe796b7,
-    0xe796b8,
-    0xe796b9,
-    0xe796ba,
-    0xe796bb,
-    0xe796bc,
-    0xe796bd,
-    0xe796be,
-    0xe796bf,
-    0xe79780,
-    0xe79781,
-    0xe79782,
-    0xe79783,
-    0xe79784,
-    0xe79785,
-    0xe79786,
-    0xe79787,
-    0xe79788,
-    0xe79789,
-    0xe7978a,
-    0xe7978b,
-    0xe7978c,
-    0xe7978d,
-    0xe7978e,
-    0xe7978f,
-    0xe79790,
-    0xe79791,
-    0xe79792,
-    0xe79793,
-    0xe79794,
-    0xe79795,
-    0xe79796,
-    0xe79797,
-    0xe79798,
-    0xe79799,
-    0xe7979a,
-    0xe7979b,
-    0xe7979c,
-    0xe7979d,
-    0xe7979e,
-    0xe7979f,
-    0xe797a0,
-    0xe797a1,
-    0xe797a2,
-    0xe797a3,
-    0xe797a4,
-    0xe797a5,
-    0xe797a6,
-    0xe797a7,
-    0xe797a8,
-    0xe797a9,
-    0xe797aa,
-    0xe797ab,
-    0xe797ac,
-    0xe797ad,
-    0xe797ae,
-    0xe797af,
-    0xe797b0,
-    0xe797b1,
-    0xe797b2,
-    0xe797b3,
-    0xe797b4,
-    0xe797b5,
-    0xe797b6,
-    0xe797b7,
-    0xe797b8,
-    0xe797b9,
-    0xe797ba,
-    0xe797bb,
-    0xe797bc,
-    0xe797bd,
-    0xe797be,
-    0xe797bf,
-    0xe79880,
-    0xe79881,
-    0xe79882,
-    0xe79883,
-    0xe79884,
-    0xe79885,
-    0xe79886,
-    0xe79887,
-    0xe79888,
-    0xe79889,
-    0xe7988a,
-    0xe7988b,
-    0xe7988c,
-    0xe7988d,
-    0xe7988e,
-    0xe7988f,
-    0xe79890,
-    0xe79891,
-    0xe79892,
-    0xe79893,
-    0xe79894,
-    0xe79895,
-    0xe79896,
-    0xe79897,
-    0xe79898,
-    0xe79899,
-    0xe7989a,
-    0xe7989b,
-    0xe7989c,
-    0xe7989d,
-    0xe7989e,
-    0xe7989f,
-    0xe798a0,
-    0xe798a1,
-    0xe798a2,
-    0xe798a3,
-    0xe798a4,
-    0xe798a5,
-    0xe798a6,
-    0xe798a7,
-    0xe798a8,
-    0xe798a9,
-    0xe798aa,
-    0xe798ab,
-    0xe798ac,
-    0xe798ad,
-    0xe798ae,
-    0xe798af,
-    0xe798b0,
-    0xe798b1,
-    0xe798b2,
-    0xe798b3,
-    0xe798b4,
-    0xe798b5,
-    0xe798b6,
-    0xe798b7,
-    0xe798b8,
-    0xe798b9,
-    0xe798ba,
-    0xe798bb,
-    0xe798bc,
-    0xe798bd,
-    0xe798be,
-    0xe798bf,
-    0xe79980,
-    0xe79981,
-    0xe79982,
-    0xe79983,
-    0xe79984,
-    0xe79985,
-    0xe79986,
-    0xe79987,
-    0xe79988,
-    0xe79989,
-    0xe7998a,
-    0xe7998b,
-    0xe7998c,
-    0xe7998d,
-    0xe7998e,
-    0xe7998f,
-    0xe79990,
-    0xe79991,
-    0xe79992,
-    0xe79993,
-    0xe79994,
-    0xe79995,
-    0xe79996,
-    0xe79997,
-    0xe79998,
-    0xe79999,
-    0xe7999a,
-    0xe7999b,
-    0xe7999c,
-    0xe7999d,
-    0xe7999e,
-    0xe7999f,
-    0xe799a0,
-    0xe799a1,
-    0xe799a2,
-    0xe799a3,
-    0xe799a4,
-    0xe799a5,
-    0xe799a6,
-    0xe799a7,
-    0xe799a8,
-    0xe799a9,
-    0xe799aa,
-    0xe799ab,
-    0xe799ac,
-    0xe799ad,
-    0xe799ae,
-    0xe799af,
-    0xe799b0,
-    0xe799b1,
-    0xe799b2,
-    0xe799b3,
-    0xe799b4,
-    0xe799b5,
-    0xe799b6,
-    0xe799b7,
-    0xe799b8,
-    0xe799b9,
-    0xe799ba,
-    0xe799bb,
-    0xe799bc,
-    0xe799bd,
-    0xe799be,
-    0xe799bf,
-    0xe79a80,
-    0xe79a81,
-    0xe79a82,
-    0xe79a83,
-    0xe79a84,
-    0xe79a85,
-    0xe79a86,
-    0xe79a87,
-    0xe79a88,
-    0xe79a89,
-    0xe79a8a,
-    0xe79a8b,
-    0xe79a8c,
-    0xe79a8d,
-    0xe79a8e,
-    0xe79a8f,
-    0xe79a90,
-    0xe79a91,
-    0xe79a92,
-    0xe79a93,
-    0xe79a94,
-    0xe79a95,
-    0xe79a96,
-    0xe79a97,
-    0xe79a98,
-    0xe79a99,
-    0xe79a9a,
-    0xe79a9b,
-    0xe79a9c,
-    0xe79a9d,
-    0xe79a9e,
-    0xe79a9f,
-    0xe79aa0,
-    0xe79aa1,
-    0xe79aa2,
-    0xe79aa3,
-    0xe79aa4,
-    0xe79aa5,
-    0xe79aa6,
-    0xe79aa7,
-    0xe79aa8,
-    0xe79aa9,
-    0xe79aaa,
-    0xe79aab,
-    0xe79aac,
-    0xe79aad,
-    0xe79aae,
-    0xe79aaf,
-    0xe79ab0,
-    0xe79ab1,
-    0xe79ab2,
-    0xe79ab3,
-    0xe79ab4,
-    0xe79ab5,
-    0xe79ab6,
-    0xe79ab7,
-    0xe79ab8,
-    0xe79ab9,
-    0xe79aba,
-    0xe79abb,
-    0xe79abc,
-    0xe79abd,
-    0xe79abe,
-    0xe79abf,
-    0xe79b80,
-    0xe79b81,
-    0xe79b82,
-    0xe79b83,
-    0xe79b84,
-    0xe79b85,
-    0xe79b86,
-    0xe79b87,
-    0xe79b88,
-    0xe79b89,
-    0xe79b8a,
-    0xe79b8b,
-    0xe79b8c,
-    0xe79b8d,
-    0xe79b8e,
-    0xe79b8f,
-    0xe79b90,
-    0xe79b91,
-    0xe79b92,
-    0xe79b93,
-    0xe79b94,
-    0xe79b95,
-    0xe79b96,
-    0xe79b97,
-    0xe79b98,
-    0xe79b99,
-    0xe79b9a,
-    0xe79b9b,
-    0xe79b9c,
-    0xe79b9d,
-    0xe79b9e,
-    0xe79b9f,
-    0xe79ba0,
-    0xe79ba1,
-    0xe79ba2,
-    0xe79ba3,
-    0xe79ba4,
-    0xe79ba5,
-    0xe79ba6,
-    0xe79ba7,
-    0xe79ba8,
-    0xe79ba9,
-    0xe79baa,
-    0xe79bab,
-    0xe79bac,
-    0xe79bad,
-    0xe79bae,
-    0xe79baf,
-    0xe79bb0,
-    0xe79bb1,
-    0xe79bb2,
-    0xe79bb3,
-    0xe79bb4,
-    0xe79bb5,
-    0xe79bb6,
-    0xe79bb7,
-    0xe79bb8,
-    0xe79bb9,
-    0xe79bba,
-    0xe79bbb,
-    0xe79bbc,
-    0xe79bbd,
-    0xe79bbe,
-    0xe79bbf,
-    0xe79c80,
-    0xe79c81,
-    0xe79c82,
-    0xe79c83,
-    0xe79c84,
-    0xe79c85,
-    0xe79c86,
-    0xe79c87,
-    0xe79c88,
-    0xe79c89,
-    0xe79c8a,
-    0xe79c8b,
-    0xe79c8c,
-    0xe79c8d,
-    0xe79c8e,
-    0xe79c8f,
-    0xe79c90,
-    0xe79c91,
-    0xe79c92,
-    0xe79c93,
-    0xe79c94,
-    0xe79c95,
-    0xe79c96,
-    0xe79c97,
-    0xe79c98,
-    0xe79c99,
-    0xe79c9a,
-    0xe79c9b,
-    0xe79c9c,
-    0xe79c9d,
-    0xe79c9e,
-    0xe79c9f,
-    0xe79ca0,
-    0xe79ca1,
-    0xe79ca2,
-    0xe79ca3,
-    0xe79ca4,
-    0xe79ca5,
-    0xe79ca6,
-    0xe79ca7,
-    0xe79ca8,
-    0xe79ca9,
-    0xe79caa,
-    0xe79cab,
-    0xe79cac,
-    0xe79cad,
-    0xe79cae,
-    0xe79caf,
-    0xe79cb0,
-    0xe79cb1,
-    0xe79cb2,
-    0xe79cb3,
-    0xe79cb4,
-    0xe79cb5,
-    0xe79cb6,
-    0xe79cb7,
-    0xe79cb8,
-    0xe79cb9,
-    0xe79cba,
-    0xe79cbb,
-    0xe79cbc,
-    0xe79cbd,
-    0xe79cbe,
-    0xe79cbf,
-    0xe79d80,
-    0xe79d81,
-    0xe79d82,
-    0xe79d83,
-    0xe79d84,
-    0xe79d85,
-    0xe79d86,
-    0xe79d87,
-    0xe79d88,
-    0xe79d89,
-    0xe79d8a,
-    0xe79d8b,
-    0xe79d8c,
-    0xe79d8d,
-    0xe79d8e,
-    0xe79d8f,
-    0xe79d90,
-    0xe79d91,
-    0xe79d92,
-    0xe79d93,
-    0xe79d94,
-    0xe79d95,
-    0xe79d96,
-    0xe79d97,
-    0xe79d98,
-    0xe79d99,
-    0xe79d9a,
-    0xe79d9b,
-    0xe79d9c,
-    0xe79d9d,
-    0xe79d9e,
-    0xe79d9f,
-    0xe79da0,
-    0xe79da1,
-    0xe79da2,
-    0xe79da3,
-    0xe79da4,
-    0xe79da5,
-    0xe79da6,
-    0xe79da7,
-    0xe79da8,
-    0xe79da9,
-    0xe79daa,
-    0xe79dab,
-    0xe79dac,
-    0xe79dad,
-    0xe79dae,
-    0xe79daf,
-    0xe79db0,
-    0xe79db1,
-    0xe79db2,
-    0xe79db3,
-    0xe79db4,
-    0xe79db5,
-    0xe79db6,
-    0xe79db7,
-    0xe79db8,
-    0xe79db9,
-    0xe79dba,
-    0xe79dbb,
-    0xe79dbc,
-    0xe79dbd,
-    0xe79dbe,
-    0xe79dbf,
-    0xe79e80,
-    0xe79e81,
-    0xe79e82,
-    0xe79e83,
-    0xe79e84,
-    0xe79e85,
-    0xe79e86,
-    0xe79e87,
-    0xe79e88,
-    0xe79e89,
-    0xe79e8a,
-    0xe79e8b,
-    0xe79e8c,
-    0xe79e8d,
-    0xe79e8e,
-    0xe79e8f,
-    0xe79e90,
-    0xe79e91,
-    0xe79e92,
-    0xe79e93,
-    0xe79e94,
-    0xe79e95,
-    0xe79e96,
-    0xe79e97,
-    0xe79e98,
-    0xe79e99,
-    0xe79e9a,
-    0xe79e9b,
-    0xe79e9c,
-    0xe79e9d,
-    0xe79e9e,
-    0xe79e9f,
-    0xe79ea0,
-    0xe79ea1,
-    0xe79ea2,
-    0xe79ea3,
-    0xe79ea4,
-    0xe79ea5,
-    0xe79ea6,
-    0xe79ea7,
-    0xe79ea8,
-    0xe79ea9,
-    0xe79eaa,
-    0xe79eab,
-    0xe79eac,
-    0xe79ead,
-    0xe79eae,
-    0xe79eaf,
-    0xe79eb0,
-    0xe79eb1,
-    0xe79eb2,
-    0xe79eb3,
-    0xe79eb4,
-    0xe79eb5,
-    0xe79eb6,
-    0xe79eb7,
-    0xe79eb8,
-    0xe79eb9,
-    0xe79eba,
-    0xe79ebb,
-    0xe79ebc,
-    0xe79ebd,
-    0xe79ebe,
-    0xe79ebf,
-    0xe79f80,
-    0xe79f81,
-    0xe79f82,
-    0xe79f83,
-    0xe79f84,
-    0xe79f85,
-    0xe79f86,
-    0xe79f87,
-    0xe79f88,
-    0xe79f89,
-    0xe79f8a,
-    0xe79f8b,
-    0xe79f8c,
-    0xe79f8d,
-    0xe79f8e,
-    0xe79f8f,
-    0xe79f90,
-    0xe79f91,
-    0xe79f92,
-    0xe79f93,
-    0xe79f94,
-    0xe79f95,
-    0xe79f96,
-    0xe79f97,
-    0xe79f98,
-    0xe79f99,
-    0xe79f9a,
-    0xe79f9b,
-    0xe79f9c,
-    0xe79f9d,
-    0xe79f9e,
-    0xe79f9f,
-    0xe79fa0,
-    0xe79fa1,
-    0xe79fa2,
-    0xe79fa3,
-    0xe79fa4,
-    0xe79fa5,
-    0xe79fa6,
-    0xe79fa7,
-    0xe79fa8,
-    0xe79fa9,
-    0xe79faa,
-    0xe79fab,
-    0xe79fac,
-    0xe79fad,
-    0xe79fae,
-    0xe79faf,
-    0xe79fb0,
-    0xe79fb1,
-    0xe79fb2,
-    0xe79fb3,
-    0xe79fb4,
-    0xe79fb5,
-    0xe79fb6,
-    0xe79fb7,
-    0xe79fb8,
-    0xe79fb9,
-    0xe79fba,
-    0xe79fbb,
-    0xe79fbc,
-    0xe79fbd,
-    0xe79fbe,
-    0xe79fbf,
-    0xe7a080,
-    0xe7a081,
-    0xe7a082,
-    0xe7a083,
-    0xe7a084,
-    0xe7a085,
-    0xe7a086,
-    0xe7a087,
-    0xe7a088,
-    0xe7a089,
-    0xe7a08a,
-    0xe7a08b,
-    0xe7a08c,
-    0xe7a08d,
-    0xe7a08e,
-    0xe7a08f,
-    0xe7a090,
-    0xe7a091,
-    0xe7a092,
-    0xe7a093,
-    0xe7a094,
-    0xe7a095,
-    0xe7a096,
-    0xe7a097,
-    0xe7a098,
-    0xe7a099,
-    0xe7a09a,
-    0xe7a09b,
-    0xe7a09c,
-    0xe7a09d,
-    0xe7a09e,
-    0xe7a09f,
-    0xe7a0a0,
-    0xe7a0a1,
-    0xe7a0a2,
-    0xe7a0a3,
-    0xe7a0a4,
-    0xe7a0a5,
-    0xe7a0a6,
-    0xe7a0a7,
-    0xe7a0a8,
-    0xe7a0a9,
-    0xe7a0aa,
-    0xe7a0ab,
-    0xe7a0ac,
-    0xe7a0ad,
-    0xe7a0ae,
-    0xe7a0af,
-    0xe7a0b0,
-    0xe7a0b1,
-    0xe7a0b2,
-    0xe7a0b3,
-    0xe7a0b4,
-    0xe7a0b5,
-    0xe7a0b6,
-    0xe7a0b7,
-    0xe7a0b8,
-    0xe7a0b9,
-    0xe7a0ba,
-    0xe7a0bb,
-    0xe7a0bc,
-    0xe7a0bd,
-    0xe7a0be,
-    0xe7a0bf,
-    0xe7a180,
-    0xe7a181,
-    0xe7a182,
-    0xe7a183,
-    0xe7a184,
-    0xe7a185,
-    0xe7a186,
-    0xe7a187,
-    0xe7a188,
-    0xe7a189,
-    0xe7a18a,
-    0xe7a18b,
-    0xe7a18c,
-    0xe7a18d,
-    0xe7a18e,
-    0xe7a18f,
-    0xe7a190,
-    0xe7a191,
-    0xe7a192,
-    0xe7a193,
-    0xe7a194,
-    0xe7a195,
-    0xe7a196,
-    0xe7a197,
-    0xe7a198,
-    0xe7a199,
-    0xe7a19a,
-    0xe7a19b,
-    0xe7a19c,
-    0xe7a19d,
-    0xe7a19e,
-    0xe7a19f,
-    0xe7a1a0,
-    0xe7a1a1,
-    0xe7a1a2,
-    0xe7a1a3,
-    0xe7a1a4,
-    0xe7a1a5,
-    0xe7a1a6,
-    0xe7a1a7,
-    0xe7a1a8,
-    0xe7a1a9,
-    0xe7a1aa,
-    0xe7a1ab,
-    0xe7a1ac,
-    0xe7a1ad,
-    0xe7a1ae,
-    0xe7a1af,
-    0xe7a1b0,
-    0xe7a1b1,
-    0xe7a1b2,
-    0xe7a1b3,
-    0xe7a1b4,
-    0xe7a1b5,
-    0xe7a1b6,
-    0xe7a1b7,
-    0xe7a1b8,
-    0xe7a1b9,
-    0xe7a1ba,
-    0xe7a1bb,
-    0xe7a1bc,
-    0xe7a1bd,
-    0xe7a1be,
-    0xe7a1bf,
-    0xe7a280,
-    0xe7a281,
-    0xe7a282,
-    0xe7a283,
-    0xe7a284,
-    0xe7a285,
-    0xe7a286,
-    0xe7a287,
-    0xe7a288,
-    0xe7a289,
-    0xe7a28a,
-    0xe7a28b,
-    0xe7a28c,
-    0xe7a28d,
-    0xe7a28e,
-    0xe7a28f,
-    0xe7a290,
-    0xe7a291,
-    0xe7a292,
-    0xe7a293,
-    0xe7a294,
-    0xe7a295,
-    0xe7a296,
-    0xe7a297,
-    0xe7a298,
-    0xe7a299,
-    0xe7a29a,
-    0xe7a29b,
-    0xe7a29c,
-    0xe7a29d,
-    0xe7a29e,
-    0xe7a29f,
-    0xe7a2a0,
-    0xe7a2a1,
-    0xe7a2a2,
-    0xe7a2a3,
-    0xe7a2a4,
-    0xe7a2a5,
-    0xe7a2a6,
-    0xe7a2a7,
-    0xe7a2a8,
-    0xe7a2a9,
-    0xe7a2aa,
-    0xe7a2ab,
-    0xe7a2ac,
-    0xe7a2ad,
-    0xe7a2ae,
-    0xe7a2af,
-    0xe7a2b0,
-    0xe7a2b1,
-    0xe7a2b2,
-    0xe7a2b3,
-    0xe7a2b4,
-    0xe7a2b5,
-    0xe7a2b6,
-    0xe7a2b7,
-    0xe7a2b8,
-    0xe7a2b9,
-    0xe7a2ba,
-    0xe7a2bb,
-    0xe7a2bc,
-    0xe7a2bd,
-    0xe7a2be,
-    0xe7a2bf,
-    0xe7a380,
-    0xe7a381,
-    0xe7a382,
-    0xe7a383,
-    0xe7a384,
-    0xe7a385,
-    0xe7a386,
-    0xe7a387,
-    0xe7a388,
-    0xe7a389,
-    0xe7a38a,
-    0xe7a38b,
-    0xe7a38c,
-    0xe7a38d,
-    0xe7a38e,
-    0xe7a38f,
-    0xe7a390,
-    0xe7a391,
-    0xe7a392,
-    0xe7a393,
-    0xe7a394,
-    0xe7a395,
-    0xe7a396,
-    0xe7a397,
-    0xe7a398,
-    0xe7a399,
-    0xe7a39a,
-    0xe7a39b,
-    0xe7a39c,
-    0xe7a39d,
-    0xe7a39e,
-    0xe7a39f,
-    0xe7a3a0,
-    0xe7a3a1,
-    0xe7a3a2,
-    0xe7a3a3,
-    0xe7a3a4,
-    0xe7a3a5,
-    0xe7a3a6,
-    0xe7a3a7,
-    0xe7a3a8,
-    0xe7a3a9,
-    0xe7a3aa,
-    0xe7a3ab,
-    0xe7a3ac,
-    0xe7a3ad,
-    0xe7a3ae,
-    0xe7a3af,
-    0xe7a3b0,
-    0xe7a3b1,
-    0xe7a3b2,
-    0xe7a3b3,
-    0xe7a3b4,
-    0xe7a3b5,
-    0xe7a3b6,
-    0xe7a3b7,
-    0xe7a3b8,
-    0xe7a3b9,
-    0xe7a3ba,
-    0xe7a3bb,
-    0xe7a3bc,
-    0xe7a3bd,
-    0xe7a3be,
-    0xe7a3bf,
-    0xe7a480,
-    0xe7a481,
-    0xe7a482,
-    0xe7a483,
-    0xe7a484,
-    0xe7a485,
-    0xe7a486,
-    0xe7a487,
-    0xe7a488,
-    0xe7a489,
-    0xe7a48a,
-    0xe7a48b,
-    0xe7a48c,
-    0xe7a48d,
-    0xe7a48e,
-    0xe7a48f,
-    0xe7a490,
-    0xe7a491,
-    0xe7a492,
-    0xe7a493,
-    0xe7a494,
-    0xe7a495,
-    0xe7a496,
-    0xe7a497,
-    0xe7a498,
-    0xe7a499,
-    0xe7a49a,
-    0xe7a49b,
-    0xe7a49c,
-    0xe7a49d,
-    0xe7a49e,
-    0xe7a49f,
-    0xe7a4a0,
-    0xe7a4a1,
-    0xe7a4a2,
-    0xe7a4a3,
-    0xe7a4a4,
-    0xe7a4a5,
-    0xe7a4a6,
-    0xe7a4a7,
-    0xe7a4a8,
-    0xe7a4a9,
-    0xe7a4aa,
-    0xe7a4ab,
-    0xe7a4ac,
-    0xe7a4ad,
-    0xe7a4ae,
-    0xe7a4af,
-    0xe7a4b0,
-    0xe7a4b1,
-    0xe7a4b2,
-    0xe7a4b3,
-    0xe7a4b4,
-    0xe7a4b5,
-    0xe7a4b6,
-    0xe7a4b7,
-    0xe7a4b8,
-    0xe7a4b9,
-    0xe7a4ba,
-    0xe7a4bb,
-    0xe7a4bc,
-    0xe7a4bd,
-    0xe7a4be,
-    0xe7a4bf,
-    0xe7a580,
-    0xe7a581,
-    0xe7a582,
-    0xe7a583,
-    0xe7a584,
-    0xe7a585,
-    0xe7a586,
-    0xe7a587,
-    0xe7a588,
-    0xe7a589,
-    0xe7a58a,
-    0xe7a58b,
-    0xe7a58c,
-    0xe7a58d,
-    0xe7a58e,
-    0xe7a58f,
-    0xe7a590,
-    0xe7a591,
-    0xe7a592,
-    0xe7a593,
-    0xe7a594,
-    0xe7a595,
-    0xe7a596,
-    0xe7a597,
-    0xe7a598,
-    0xe7a599,
-    0xe7a59a,
-    0xe7a59b,
-    0xe7a59c,
-    0xe7a59d,
-    0xe7a59e,
-    0xe7a59f,
-    0xe7a5a0,
-    0xe7a5a1,
-    0xe7a5a2,
-    0xe7a5a3,
-    0xe7a5a4,
-    0xe7a5a5,
-    0xe7a5a6,
-    0xe7a5a7,
-    0xe7a5a8,
-    0xe7a5a9,
-    0xe7a5aa,
-    0xe7a5ab,
-    0xe7a5ac,
-    0xe7a5ad,
-    0xe7a5ae,
-    0xe7a5af,
-    0xe7a5b0,
-    0xe7a5b1,
-    0xe7a5b2,
-    0xe7a5b3,
-    0xe7a5b4,
-    0xe7a5b5,
-    0xe7a5b6,
-    0xe7a5b7,
-    0xe7a5b8,
-    0xe7a5b9,
-    0xe7a5ba,
-    0xe7a5bb,
-    0xe7a5bc,
-    0xe7a5bd,
-    0xe7a5be,
-    0xe7a5bf,
-    0xe7a680,
-    0xe7a681,
-    0xe7a682,
-    0xe7a683,
-    0xe7a684,
-    0xe7a685,
-    0xe7a686,
-    0xe7a687,
-    0xe7a688,
-    0xe7a689,
-    0xe7a68a,
-    0xe7a68b,
-    0xe7a68c,
-    0xe7a68d,
-    0xe7a68e,
-    0xe7a68f,
-    0xe7a690,
-    0xe7a691,
-    0xe7a692,
-    0xe7a693,
-    0xe7a694,
-    0xe7a695,
-    0xe7a696,
-    0xe7a697,
-    0xe7a698,
-    0xe7a699,
-    0xe7a69a,
-    0xe7a69b,
-    0xe7a69c,
-    0xe7a69d,
-    0xe7a69e,
-    0xe7a69f,
-    0xe7a6a0,
-    0xe7a6a1,
-    0xe7a6a2,
-    0xe7a6a3,
-    0xe7a6a4,
-    0xe7a6a5,
-    0xe7a6a6,
-    0xe7a6a7,
-    0xe7a6a8,
-    0xe7a6a9,
-    0xe7a6aa,
-    0xe7a6ab,
-    0xe7a6ac,
-    0xe7a6ad,
-    0xe7a6ae,
-    0xe7a6af,
-    0xe7a6b0,
-    0xe7a6b1,
-    0xe7a6b2,
-    0xe7a6b3,
-    0xe7a6b4,
-    0xe7a6b5,
-    0xe7a6b6,
-    0xe7a6b7,
-    0xe7a6b8,
-    0xe7a6b9,
-    0xe7a6ba,
-    0xe7a6bb,
-    0xe7a6bc,
-    0xe7a6bd,
-    0xe7a6be,
-    0xe7a6bf,
-    0xe7a780,
-    0xe7a781,
-    0xe7a782,
-    0xe7a783,
-    0xe7a784,
-    0xe7a785,
-    0xe7a786,
-    0xe7a787,
-    0xe7a788,
-    0xe7a789,
-    0xe7a78a,
-    0xe7a78b,
-    0xe7a78c,
-    0xe7a78d,
-    0xe7a78e,
-    0xe7a78f,
-    0xe7a790,
-    0xe7a791,
-    0xe7a792,
-    0xe7a793,
-    0xe7a794,
-    0xe7a795,
-    0xe7a796,
-    0xe7a797,
-    0xe7a798,
-    0xe7a799,
-    0xe7a79a,
-    0xe7a79b,
-    0xe7a79c,
-    0xe7a79d,
-    0xe7a79e,
-    0xe7a79f,
-    0xe7a7a0,
-    0xe7a7a1,
-    0xe7a7a2,
-    0xe7a7a3,
-    0xe7a7a4,
-    0xe7a7a5,
-    0xe7a7a6,
-    0xe7a7a7,
-    0xe7a7a8,
-    0xe7a7a9,
-    0xe7a7aa,
-    0xe7a7ab,
-    0xe7a7ac,
-    0xe7a7ad,
-    0xe7a7ae,
-    0xe7a7af,
-    0xe7a7b0,
-    0xe7a7b1,
-    0xe7a7b2,
-    0xe7a7b3,
-    0xe7a7b4,
-    0xe7a7b5,
-    0xe7a7b6,
-    0xe7a7b7,
-    0xe7a7b8,
-    0xe7a7b9,
-    0xe7a7ba,
-    0xe7a7bb,
-    0xe7a7bc,
-    0xe7a7bd,
-    0xe7a7be,
-    0xe7a7bf,
-    0xe7a880,
-    0xe7a881,
-    0xe7a882,
-    0xe7a883,
-    0xe7a884,
-    0xe7a885,
-    0xe7a886,
-    0xe7a887,
-    0xe7a888,
-    0xe7a889,
-    0xe7a88a,
-    0xe7a88b,
-    0xe7a88c,
-    0xe7a88d,
-    0xe7a88e,
-    0xe7a88f,
-    0xe7a890,
-    0xe7a891,
-    0xe7a892,
-    0xe7a893,
-    0xe7a894,
-    0xe7a895,
-    0xe7a896,
-    0xe7a897,
-    0xe7a898,
-    0xe7a899,
-    0xe7a89a,
-    0xe7a89b,
-    0xe7a89c,
-    0xe7a89d,
-    0xe7a89e,
-    0xe7a89f,
-    0xe7a8a0,
-    0xe7a8a1,
-    0xe7a8a2,
-    0xe7a8a3,
-    0xe7a8a4,
-    0xe7a8a5,
-    0xe7a8a6,
-    0xe7a8a7,
-    0xe7a8a8,
-    0xe7a8a9,
-    0xe7a8aa,
-    0xe7a8ab,
-    0xe7a8ac,
-    0xe7a8ad,
-    0xe7a8ae,
-    0xe7a8af,
-    0xe7a8b0,
-    0xe7a8b1,
-    0xe7a8b2,
-    0xe7a8b3,
-    0xe7a8b4,
-    0xe7a8b5,
-    0xe7a8b6,
-    0xe7a8b7,
-    0xe7a8b8,
-    0xe7a8b9,
-    0xe7a8ba,
-    0xe7a8bb,
-    0xe7a8bc,
-    0xe7a8bd,
-    0xe7a8be,
-    0xe7a8bf,
-    0xe7a980,
-    0xe7a981,
-    0xe7a982,
-    0xe7a983,
-    0xe7a984,
-    0xe7a985,
-    0xe7a986,
-    0xe7a987,
-    0xe7a988,
-    0xe7a989,
-    0xe7a98a,
-    0xe7a98b,
-    0xe7a98c,
-    0xe7a98d,
-    0xe7a98e,
-    0xe7a98f,
-    0xe7a990,
-    0xe7a991,
-    0xe7a992,
-    0xe7a993,
-    0xe7a994,
-    0xe7a995,
-    0xe7a996,
-    0xe7a997,
-    0xe7a998,
-    0xe7a999,
-    0xe7a99a,
-    0xe7a99b,
-    0xe7a99c,
-    0xe7a99d,
-    0xe7a99e,
-    0xe7a99f,
-    0xe7a9a0,
-    0xe7a9a1,
-    0xe7a9a2,
-    0xe7a9a3,
-    0xe7a9a4,
-    0xe7a9a5,
-    0xe7a9a6,
-    0xe7a9a7,
-    0xe7a9a8,
-    0xe7a9a9,
-    0xe7a9aa,
-    0xe7a9ab,
-    0xe7a9ac,
-    0xe7a9ad,
-    0xe7a9ae,
-    0xe7a9af,
-    0xe7a9b0,
-    0xe7a9b1,
-    0xe7a9b2,
-    0xe7a9b3,
-    0xe7a9b4,
-    0xe7a9b5,
-    0xe7a9b6,
-    0xe7a9b7,
-    0xe7a9b8,
-    0xe7a9b9,
-    0xe7a9ba,
-    0xe7a9bb,
-    0xe7a9bc,
-    0xe7a9bd,
-    0xe7a9be,
-    0xe7a9bf,
-    0xe7aa80,
-    0xe7aa81,
-    0xe7aa82,
-    0xe7aa83,
-    0xe7aa84,
-    0xe7aa85,
-    0xe7aa86,
-    0xe7aa87,
-    0xe7aa88,
-    0xe7aa89,
-    0xe7aa8a,
-    0xe7aa8b,
-    0xe7aa8c,
-    0xe7aa8d,
-    0xe7aa8e,
-    0xe7aa8f,
-    0xe7aa90,
-    0xe7aa91,
-    0xe7aa92,
-    0xe7aa93,
-    0xe7aa94,
-    0xe7aa95,
-    0xe7aa96,
-    0xe7aa97,
-    0xe7aa98,
-    0xe7aa99,
-    0xe7aa9a,
-    0xe7aa9b,
-    0xe7aa9c,
-    0xe7aa9d,
-    0xe7aa9e,
-    0xe7aa9f,
-    0xe7aaa0,
-    0xe7aaa1,
-    0xe7aaa2,
-    0xe7aaa3,
-    0xe7aaa4,
-    0xe7aaa5,
-    0xe7aaa6,
-    0xe7aaa7,
-    0xe7aaa8,
-    0xe7aaa9,
-    0xe7aaaa,
-    0xe7aaab,
-    0xe7aaac,
-    0xe7aaad,
-    0xe7aaae,
-    0xe7aaaf,
-    0xe7aab0,
-    0xe7aab1,
-    0xe7aab2,
-    0xe7aab3,
-    0xe7aab4,
-    0xe7aab5,
-    0xe7aab6,
-    0xe7aab7,
-    0xe7aab8,
-    0xe7aab9,
-    0xe7aaba,
-    0xe7aabb,
-    0xe7aabc,
-    0xe7aabd,
-    0xe7aabe,
-    0xe7aabf,
-    0xe7ab80,
-    0xe7ab81,
-    0xe7ab82,
-    0xe7ab83,
-    0xe7ab84,
-    0xe7ab85,
-    0xe7ab86,
-    0xe7ab87,
-    0xe7ab88,
-    0xe7ab89,
-    0xe7ab8a,
-    0xe7ab8b,
-    0xe7ab8c,
-    0xe7ab8d,
-    0xe7ab8e,
-    0xe7ab8f,
-    0xe7ab90,
-    0xe7ab91,
-    0xe7ab92,
-    0xe7ab93,
-    0xe7ab94,
-    0xe7ab95,
-    0xe7ab96,
-    0xe7ab97,
-    0xe7ab98,
-    0xe7ab99,
-    0xe7ab9a,
-    0xe7ab9b,
-    0xe7ab9c,
-    0xe7ab9d,
-    0xe7ab9e,
-    0xe7ab9f,
-    0xe7aba0,
-    0xe7aba1,
-    0xe7aba2,
-    0xe7aba3,
-    0xe7aba4,
-    0xe7aba5,
-    0xe7aba6,
-    0xe7aba7,
-    0xe7aba8,
-    0xe7aba9,
-    0xe7abaa,
-    0xe7abab,
-    0xe7abac,
-    0xe7abad,
-    0xe7abae,
-    0xe7abaf,
-    0xe7abb0,
-    0xe7abb1,
-    0xe7abb2,
-    0xe7abb3,
-    0xe7abb4,
-    0xe7abb5,
-    0xe7abb6,
-    0xe7abb7,
-    0xe7abb8,
-    0xe7abb9,
-    0xe7abba,
-    0xe7abbb,
-    0xe7abbc,
-    0xe7abbd,
-    0xe7abbe,
-    0xe7abbf,
-    0xe7ac80,
-    0xe7ac81,
-    0xe7ac82,
-    0xe7ac83,
-    0xe7ac84,
-    0xe7ac85,
-    0xe7ac86,
-    0xe7ac87,
-    0xe7ac88,
-    0xe7ac89,
-    0xe7ac8a,
-    0xe7ac8b,
-    0xe7ac8c,
-    0xe7ac8d,
-    0xe7ac8e,
-    0xe7ac8f,
-    0xe7ac90,
-    0xe7ac91,
-    0xe7ac92,
-    0xe7ac93,
-    0xe7ac94,
-    0xe7ac95,
-    0xe7ac96,
-    0xe7ac97,
-    0xe7ac98,
-    0xe7ac99,
-    0xe7ac9a,
-    0xe7ac9b,
-    0xe7ac9c,
-    0xe7ac9d,
-    0xe7ac9e,
-    0xe7ac9f,
-    0xe7aca0,
-    0xe7aca1,
-    0xe7aca2,
-    0xe7aca3,
-    0xe7aca4,
-    0xe7aca5,
-    0xe7aca6,
-    0xe7aca7,
-    0xe7aca8,
-    0xe7aca9,
-    0xe7acaa,
-    0xe7acab,
-    0xe7acac,
-    0xe7acad,
-    0xe7acae,
-    0xe7acaf,
-    0xe7acb0,
-    0xe7acb1,
-    0xe7acb2,
-    0xe7acb3,
-    0xe7acb4,
-    0xe7acb5,
-    0xe7acb6,
-    0xe7acb7,
-    0xe7acb8,
-    0xe7acb9,
-    0xe7acba,
-    0xe7acbb,
-    0xe7acbc,
-    0xe7acbd,
-    0xe7acbe,
-    0xe7acbf,
-    0xe7ad80,
-    0xe7ad81,
-    0xe7ad82,
-    0xe7ad83,
-    0xe7ad84,
-    0xe7ad85,
-    0xe7ad86,
-    0xe7ad87,
-    0xe7ad88,
-    0xe7ad89,
-    0xe7ad8a,
-    0xe7ad8b,
-    0xe7ad8c,
-    0xe7ad8d,
-    0xe7ad8e,
-    0xe7ad8f,
-    0xe7ad90,
-    0xe7ad91,
-    0xe7ad92,
-    0xe7ad93,
-    0xe7ad94,
-    0xe7ad95,
-    0xe7ad96,
-    0xe7ad97,
-    0xe7ad98,
-    0xe7ad99,
-    0xe7ad9a,
-    0xe7ad9b,
-    0xe7ad9c,
-    0xe7ad9d,
-    0xe7ad9e,
-    0xe7ad9f,
-    0xe7ada0,
-    0xe7ada1,
-    0xe7ada2,
-    0xe7ada3,
-    0xe7ada4,
-    0xe7ada5,
-    0xe7ada6,
-    0xe7ada7,
-    0xe7ada8,
-    0xe7ada9,
-    0xe7adaa,
-    0xe7adab,
-    0xe7adac,
-    0xe7adad,
-    0xe7adae,
-    0xe7adaf,
-    0xe7adb0,
-    0xe7adb1,
-    0xe7adb2,
-    0xe7adb3,
-    0xe7adb4,
-    0xe7adb5,
-    0xe7adb6,
-    0xe7adb7,
-    0xe7adb8,
-    0xe7adb9,
-    0xe7adba,
-    0xe7adbb,
-    0xe7adbc,
-    0xe7adbd,
-    0xe7adbe,
-    0xe7adbf,
-    0xe7ae80,
-    0xe7ae81,
-    0xe7ae82,
-    0xe7ae83,
-    0xe7ae84,
-    0xe7ae85,
-    0xe7ae86,
-    0xe7ae87,
-    0xe7ae88,
-    0xe7ae89,
-    0xe7ae8a,
-    0xe7ae8b,
-    0xe7ae8c,
-    0xe7ae8d,
-    0xe7ae8e,
-    0xe7ae8f,
-    0xe7ae90,
-    0xe7ae91,
-    0xe7ae92,
-    0xe7ae93,
-    0xe7ae94,
-    0xe7ae95,
-    0xe7ae96,
-    0xe7ae97,
-    0xe7ae98,
-    0xe7ae99,
-    0xe7ae9a,
-    0xe7ae9b,
-    0xe7ae9c,
-    0xe7ae9d,
-    0xe7ae9e,
-    0xe7ae9f,
-    0xe7aea0,
-    0xe7aea1,
-    0xe7aea2,
-    0xe7aea3,
-    0xe7aea4,
-    0xe7aea5,
-    0xe7aea6,
-    0xe7aea7,
-    0xe7aea8,
-    0xe7aea9,
-    0xe7aeaa,
-    0xe7aeab,
-    0xe7aeac,
-    0xe7aead,
-    0xe7aeae,
-    0xe7aeaf,
-    0xe7aeb0,
-    0xe7aeb1,
-    0xe7aeb2,
-    0xe7aeb3,
-    0xe7aeb4,
-    0xe7aeb5,
-    0xe7aeb6,
-    0xe7aeb7,
-    0xe7aeb8,
-    0xe7aeb9,
-    0xe7aeba,
-    0xe7aebb,
-    0xe7aebc,
-    0xe7aebd,
-    0xe7aebe,
-    0xe7aebf,
-    0xe7af80,
-    0xe7af81,
-    0xe7af82,
-    0xe7af83,
-    0xe7af84,
-    0xe7af85,
-    0xe7af86,
-    0xe7af87,
-    0xe7af88,
-    0xe7af89,
-    0xe7af8a,
-    0xe7af8b,
-    0xe7af8c,
-    0xe7af8d,
-    0xe7af8e,
-    0xe7af8f,
-    0xe7af90,
-    0xe7af91,
-    0xe7af92,
-    0xe7af93,
-    0xe7af94,
-    0xe7af95,
-    0xe7af96,
-    0xe7af97,
-    0xe7af98,
-    0xe7af99,
-    0xe7af9a,
-    0xe7af9b,
-    0xe7af9c,
-    0xe7af9d,
-    0xe7af9e,
-    0xe7af9f,
-    0xe7afa0,
-    0xe7afa1,
-    0xe7afa2,
-    0xe7afa3,
-    0xe7afa4,
-    0xe7afa5,
-    0xe7afa6,
-    0xe7afa7,
-    0xe7afa8,
-    0xe7afa9,
-    0xe7afaa,
-    0xe7afab,
-    0xe7afac,
-    0xe7afad,
-    0xe7afae,
-    0xe7afaf,
-    0xe7afb0,
-    0xe7afb1,
-    0xe7afb2,
-    0xe7afb3,
-    0xe7afb4,
-    0xe7afb5,
-    0xe7afb6,
-    0xe7afb7,
-    0xe7afb8,
-    0xe7afb9,
-    0xe7afba,
-    0xe7afbb,
-    0xe7afbc,
-    0xe7afbd,
-    0xe7afbe,
-    0xe7afbf,
-    0xe7b080,
-    0xe7b081,
-    0xe7b082,
-    0xe7b083,
-    0xe7b084,
-    0xe7b085,
-    0xe7b086,
-    0xe7b087,
-    0xe7b088,
-    0xe7b089,
-    0xe7b08a,
-    0xe7b08b,
-    0xe7b08c,
-    0xe7b08d,
-    0xe7b08e,
-    0xe7b08f,
-    0xe7b090,
-    0xe7b091,
-    0xe7b092,
-    0xe7b093,
-    0xe7b094,
-    0xe7b095,
-    0xe7b096,
-    0xe7b097,
-    0xe7b098,
-    0xe7b099,
-    0xe7b09a,
-    0xe7b09b,
-    0xe7b09c,
-    0xe7b09d,
-    0xe7b09e,
-    0xe7b09f,
-    0xe7b0a0,
-    0xe7b0a1,
-    0xe7b0a2,
-    0xe7b0a3,
-    0xe7b0a4,
-    0xe7b0a5,
-    0xe7b0a6,
-    0xe7b0a7,
-    0xe7b0a8,
-    0xe7b0a9,
-    0xe7b0aa,
-    0xe7b0ab,
-    0xe7b0ac,
-    0xe7b0ad,
-    0xe7b0ae,
-    0xe7b0af,
-    0xe7b0b0,
-    0xe7b0b1,
-    0xe7b0b2,
-    0xe7b0b3,
-    0xe7b0b4,
-    0xe7b0b5,
-    0xe7b0b6,
-    0xe7b0b7,
-    0xe7b0b8,
-    0xe7b0b9,
-    0xe7b0ba,
-    0xe7b0bb,
-    0xe7b0bc,
-    0xe7b0bd,
-    0xe7b0be,
-    0xe7b0bf,
-    0xe7b180,
-    0xe7b181,
-    0xe7b182,
-    0xe7b183,
-    0xe7b184,
-    0xe7b185,
-    0xe7b186,
-    0xe7b187,
-    0xe7b188,
-    0xe7b189,
-    0xe7b18a,
-    0xe7b18b,
-    0xe7b18c,
-    0xe7b18d,
-    0xe7b18e,
-    0xe7b18f,
-    0xe7b190,
-    0xe7b191,
-    0xe7b192,
-    0xe7b193,
-    0xe7b194,
-    0xe7b195,
-    0xe7b196,
-    0xe7b197,
-    0xe7b198,
-    0xe7b199,
-    0xe7b19a,
-    0xe7b19b,
-    0xe7b19c,
-    0xe7b19d,
-    0xe7b19e,
-    0xe7b19f,
-    0xe7b1a0,
-    0xe7b1a1,
-    0xe7b1a2,
-    0xe7b1a3,
-    0xe7b1a4,
-    0xe7b1a5,
-    0xe7b1a6,
-    0xe7b1a7,
-    0xe7b1a8,
-    0xe7b1a9,
-    0xe7b1aa,
-    0xe7b1ab,
-    0xe7b1ac,
-    0xe7b1ad,
-    0xe7b1ae,
-    0xe7b1af,
-    0xe7b1b0,
-    0xe7b1b1,
-    0xe7b1b2,
-    0xe7b1b3,
-    0xe7b1b4,
-    0xe7b1b5,
-    0xe7b1b6,
-    0xe7b1b7,
-    0xe7b1b8,
-    0xe7b1b9,
-    0xe7b1ba,
-    0xe7b1bb,
-    0xe7b1bc,
-    0xe7b1bd,
-    0xe7b1be,
-    0xe7b1bf,
-    0xe7b280,
-    0xe7b281,
-    0xe7b282,
-    0xe7b283,
-    0xe7b284,
-    0xe7b285,
-    0xe7b286,
-    0xe7b287,
-    0xe7b288,
-    0xe7b289,
-    0xe7b28a,
-    0xe7b28b,
-    0xe7b28c,
-    0xe7b28d,
-    0xe7b28e,
-    0xe7b28f,
-    0xe7b290,
-    0xe7b291,
-    0xe7b292,
-    0xe7b293,
-    0xe7b294,
-    0xe7b295,
-    0xe7b296,
-    0xe7b297,
-    0xe7b298,
-    0xe7b299,
-    0xe7b29a,
-    0xe7b29b,
-    0xe7b29c,
-    0xe7b29d,
-    0xe7b29e,
-    0xe7b29f,
-    0xe7b2a0,
-    0xe7b2a1,
-    0xe7b2a2,
-    0xe7b2a3,
-    0xe7b2a4,
-    0xe7b2a5,
-    0xe7b2a6,
-    0xe7b2a7,
-    0xe7b2a8,
-    0xe7b2a9,
-    0xe7b2aa,
-    0xe7b2ab,
-    0xe7b2ac,
-    0xe7b2ad,
-    0xe7b2ae,
-    0xe7b2af,
-    0xe7b2b0,
-    0xe7b2b1,
-    0xe7b2b2,
-    0xe7b2b3,
-    0xe7b2b4,
-    0xe7b2b5,
-    0xe7b2b6,
-    0xe7b2b7,
-    0xe7b2b8,
-    0xe7b2b9,
-    0xe7b2ba,
-    0xe7b2bb,
-    0xe7b2bc,
-    0xe7b2bd,
-    0xe7b2be,
-    0xe7b2bf,
-    0xe7b380,
-    0xe7b381,
-    0xe7b382,
-    0xe7b383,
-    0xe7b384,
-    0xe7b385,
-    0xe7b386,
-    0xe7b387,
-    0xe7b388,
-    0xe7b389,
-    0xe7b38a,
-    0xe7b38b,
-    0xe7b38c,
-    0xe7b38d,
-    0xe7b38e,
-    0xe7b38f,
-    0xe7b390,
-    0xe7b391,
-    0xe7b392,
-    0xe7b393,
-    0xe7b394,
-    0xe7b395,
-    0xe7b396,
-    0xe7b397,
-    0xe7b398,
-    0xe7b399,
-    0xe7b39a,
-    0xe7b39b,
-    0xe7b39c,
-    0xe7b39d,
-    0xe7b39e,
-    0xe7b39f,
-    0xe7b3a0,
-    0xe7b3a1,
-    0xe7b3a2,
-    0xe7b3a3,
-    0xe7b3a4,
-    0xe7b3a5,
-    0xe7b3a6,
-    0xe7b3a7,
-    0xe7b3a8,
-    0xe7b3a9,
-    0xe7b3aa,
-    0xe7b3ab,
-    0xe7b3ac,
-    0xe7b3ad,
-    0xe7b3ae,
-    0xe7b3af,
-    0xe7b3b0,
-    0xe7b3b1,
-    0xe7b3b2,
-    0xe7b3b3,
-    0xe7b3b4,
-    0xe7b3b5,
-    0xe7b3b6,
-    0xe7b3b7,
-    0xe7b3b8,
-    0xe7b3b9,
-    0xe7b3ba,
-    0xe7b3bb,
-    0xe7b3bc,
-    0xe7b3bd,
-    0xe7b3be,
-    0xe7b3bf,
-    0xe7b480,
-    0xe7b481,
-    0xe7b482,
-    0xe7b483,
-    0xe7b484,
-    0xe7b485,
-    0xe7b486,
-    0xe7b487,
-    0xe7b488,
-    0xe7b489,
-    0xe7b48a,
-    0xe7b48b,
-    0xe7b48c,
-    0xe7b48d,
-    0xe7b48e,
-    0xe7b48f,
-    0xe7b490,
-    0xe7b491,
-    0xe7b492,
-    0xe7b493,
-    0xe7b494,
-    0xe7b495,
-    0xe7b496,
-    0xe7b497,
-    0xe7b498,
-    0xe7b499,
-    0xe7b49a,
-    0xe7b49b,
-    0xe7b49c,
-    0xe7b49d,
-    0xe7b49e,
-    0xe7b49f,
-    0xe7b4a0,
-    0xe7b4a1,
-    0xe7b4a2,
-    0xe7b4a3,
-    0xe7b4a4,
-    0xe7b4a5,
-    0xe7b4a6,
-    0xe7b4a7,
-    0xe7b4a8,
-    0xe7b4a9,
-    0xe7b4aa,
-    0xe7b4ab,
-    0xe7b4ac,
-    0xe7b4ad,
-    0xe7b4ae,
-    0xe7b4af,
-    0xe7b4b0,
-    0xe7b4b1,
-    0xe7b4b2,
-    0xe7b4b3,
-    0xe7b4b4,
-    0xe7b4b5,
-    0xe7b4b6,
-    0xe7b4b7,
-    0xe7b4b8,
-    0xe7b4b9,
-    0xe7b4ba,
-    0xe7b4bb,
-    0xe7b4bc,
-    0xe7b4bd,
-    0xe7b4be,
-    0xe7b4bf,
-    0xe7b580,
-    0xe7b581,
-    0xe7b582,
-    0xe7b583,
-    0xe7b584,
-    0xe7b585,
-    0xe7b586,
-    0xe7b587,
-    0xe7b588,
-    0xe7b589,
-    0xe7b58a,
-    0xe7b58b,
-    0xe7b58c,
-    0xe7b58d,
-    0xe7b58e,
-    0xe7b58f,
-    0xe7b590,
-    0xe7b591,
-    0xe7b592,
-    0xe7b593,
-    0xe7b594,
-    0xe7b595,
-    0xe7b596,
-    0xe7b597,
-    0xe7b598,
-    0xe7b599,
-    0xe7b59a,
-    0xe7b59b,
-    0xe7b59c,
-    0xe7b59d,
-    0xe7b59e,
-    0xe7b59f,
-    0xe7b5a0,
-    0xe7b5a1,
-    0xe7b5a2,
-    0xe7b5a3,
-    0xe7b5a4,
-    0xe7b5a5,
-    0xe7b5a6,
-    0xe7b5a7,
-    0xe7b5a8,
-    0xe7b5a9,
-    0xe7b5aa,
-    0xe7b5ab,
-    0xe7b5ac,
-    0xe7b5ad,
-    0xe7b5ae,
-    0xe7b5af,
-    0xe7b5b0,
-    0xe7b5b1,
-    0xe7b5b2,
-    0xe7b5b3,
-    0xe7b5b4,
-    0xe7b5b5,
-    0xe7b5b6,
-    0xe7b5b7,
-    0xe7b5b8,
-    0xe7b5b9,
-    0xe7b5ba,
-    0xe7b5bb,
-    0xe7b5bc,
-    0xe7b5bd,
-    0xe7b5be,
-    0xe7b5bf,
-    0xe7b680,
-    0xe7b681,
-    0xe7b682,
-    0xe7b683,
-    0xe7b684,
-    0xe7b685,
-    0xe7b686,
-    0xe7b687,
-    0xe7b688,
-    0xe7b689,
-    0xe7b68a,
-    0xe7b68b,
-    0xe7b68c,
-    0xe7b68d,
-    0xe7b68e,
-    0xe7b68f,
-    0xe7b690,
-    0xe7b691,
-    0xe7b692,
-    0xe7b693,
-    0xe7b694,
-    0xe7b695,
-    0xe7b696,
-    0xe7b697,
-    0xe7b698,
-    0xe7b699,
-    0xe7b69a,
-    0xe7b69b,
-    0xe7b69c,
-    0xe7b69d,
-    0xe7b69e,
-    0xe7b69f,
-    0xe7b6a0,
-    0xe7b6a1,
-    0xe7b6a2,
-    0xe7b6a3,
-    0xe7b6a4,
-    0xe7b6a5,
-    0xe7b6a6,
-    0xe7b6a7,
-    0xe7b6a8,
-    0xe7b6a9,
-    0xe7b6aa,
-    0xe7b6ab,
-    0xe7b6ac,
-    0xe7b6ad,
-    0xe7b6ae,
-    0xe7b6af,
-    0xe7b6b0,
-    0xe7b6b1,
-    0xe7b6b2,
-    0xe7b6b3,
-    0xe7b6b4,
-    0xe7b6b5,
-    0xe7b6b6,
-    0xe7b6b7,
-    0xe7b6b8,
-    0xe7b6b9,
-    0xe7b6ba,
-    0xe7b6bb,
-    0xe7b6bc,
-    0xe7b6bd,
-    0xe7b6be,
-    0xe7b6bf,
-    0xe7b780,
-    0xe7b781,
-    0xe7b782,
-    0xe7b783,
-    0xe7b784,
-    0xe7b785,
-    0xe7b786,
-    0xe7b787,
-    0xe7b788,
-    0xe7b789,
-    0xe7b78a,
-    0xe7b78b,
-    0xe7b78c,
-    0xe7b78d,
-    0xe7b78e,
-    0xe7b78f,
-    0xe7b790,
-    0xe7b791,
-    0xe7b792,
-    0xe7b793,
-    0xe7b794,
-    0xe7b795,
-    0xe7b796,
-    0xe7b797,
-    0xe7b798,
-    0xe7b799,
-    0xe7b79a,
-    0xe7b79b,
-    0xe7b79c,
-    0xe7b79d,
-    0xe7b79e,
-    0xe7b79f,
-    0xe7b7a0,
-    0xe7b7a1,
-    0xe7b7a2,
-    0xe7b7a3,
-    0xe7b7a4,
-    0xe7b7a5,
-    0xe7b7a6,
-    0xe7b7a7,
-    0xe7b7a8,
-    0xe7b7a9,
-    0xe7b7aa,
-    0xe7b7ab,
-    0xe7b7ac,
-    0xe7b7ad,
-    0xe7b7ae,
-    0xe7b7af,
-    0xe7b7b0,
-    0xe7b7b1,
-    0xe7b7b2,
-    0xe7b7b3,
-    0xe7b7b4,
-    0xe7b7b5,
-    0xe7b7b6,
-    0xe7b7b7,
-    0xe7b7b8,
-    0xe7b7b9,
-    0xe7b7ba,
-    0xe7b7bb,
-    0xe7b7bc,
-    0xe7b7bd,
-    0xe7b7be,
-    0xe7b7bf,
-    0xe7b880,
-    0xe7b881,
-    0xe7b882,
-    0xe7b883,
-    0xe7b884,
-    0xe7b885,
-    0xe7b886,
-    0xe7b887,
-    0xe7b888,
-    0xe7b889,
-    0xe7b88a,
-    0xe7b88b,
-    0xe7b88c,
-    0xe7b88d,
-    0xe7b88e,
-    0xe7b88f,
-    0xe7b890,
-    0xe7b891,
-    0xe7b892,
-    0xe7b893,
-    0xe7b894,
-    0xe7b895,
-    0xe7b896,
-    0xe7b897,
-    0xe7b898,
-    0xe7b899,
-    0xe7b89a,
-    0xe7b89b,
-    0xe7b89c,
-    0xe7b89d,
-    0xe7b89e,
-    0xe7b89f,
-    0xe7b8a0,
-    0xe7b8a1,
-    0xe7b8a2,
-    0xe7b8a3,
-    0xe7b8a4,
-    0xe7b8a5,
-    0xe7b8a6,
-    0xe7b8a7,
-    0xe7b8a8,
-    0xe7b8a9,
-    0xe7b8aa,
-    0xe7b8ab,
-    0xe7b8ac,
-    0xe7b8ad,
-    0xe7b8ae,
-    0xe7b8af,
-    0xe7b8b0,
-    0xe7b8b1,
-    0xe7b8b2,
-    0xe7b8b3,
-    0xe7b8b4,
-    0xe7b8b5,
-    0xe7b8b6,
-    0xe7b8b7,
-    0xe7b8b8,
-    0xe7b8b9,
-    0xe7b8ba,
-    0xe7b8bb,
-    0xe7b8bc,
-    0xe7b8bd,
-    0xe7b8be,
-    0xe7b8bf,
-    0xe7b980,
-    0xe7b981,
-    0xe7b982,
-    0xe7b983,
-    0xe7b984,
-    0xe7b985,
-    0xe7b986,
-    0xe7b987,
-    0xe7b988,
-    0xe7b989,
-    0xe7b98a,
-    0xe7b98b,
-    0xe7b98c,
-    0xe7b98d,
-    0xe7b98e,
-    0xe7b98f,
-    0xe7b990,
-    0xe7b991,
-    0xe7b992,
-    0xe7b993,
-    0xe7b994,
-    0xe7b995,
-    0xe7b996,
-    0xe7b997,
-    0xe7b998,
-    0xe7b999,
-    0xe7b99a,
-    0xe7b99b,
-    0xe7b99c,
-    0xe7b99d,
-    0xe7b99e,
-    0xe7b99f,
-    0xe7b9a0,
-    0xe7b9a1,
-    0xe7b9a2,
-    0xe7b9a3,
-    0xe7b9a4,
-    0xe7b9a5,
-    0xe7b9a6,
-    0xe7b9a7,
-    0xe7b9a8,
-    0xe7b9a9,
-    0xe7b9aa,
-    0xe7b9ab,
-    0xe7b9ac,
-    0xe7b9ad,
-    0xe7b9ae,
-    0xe7b9af,
-    0xe7b9b0,
-    0xe7b9b1,
-    0xe7b9b2,
-    0xe7b9b3,
-    0xe7b9b4,
-    0xe7b9b5,
-    0xe7b9b6,
-    0xe7b9b7,
-    0xe7b9b8,
-    0xe7b9b9,
-    0xe7b9ba,
-    0xe7b9bb,
-    0xe7b9bc,
-    0xe7b9bd,
-    0xe7b9be,
-    0xe7b9bf,
-    0xe7ba80,
-    0xe7ba81,
-    0xe7ba82,
-    0xe7ba83,
-    0xe7ba84,
-    0xe7ba85,
-    0xe7ba86,
-    0xe7ba87,
-    0xe7ba88,
-    0xe7ba89,
-    0xe7ba8a,
-    0xe7ba8b,
-    0xe7ba8c,
-    0xe7ba8d,
-    0xe7ba8e,
-    0xe7ba8f,
-    0xe7ba90,
-    0xe7ba91,
-    0xe7ba92,
-    0xe7ba93,
-    0xe7ba94,
-    0xe7ba95,
-    0xe7ba96,
-    0xe7ba97,
-    0xe7ba98,
-    0xe7ba99,
-    0xe7ba9a,
-    0xe7ba9b,
-    0xe7ba9c,
-    0xe7ba9d,
-    0xe7ba9e,
-    0xe7ba9f,
-    0xe7baa0,
-    0xe7baa1,
-    0xe7baa2,
-    0xe7baa3,
-    0xe7baa4,
-    0xe7baa5,
-    0xe7baa6,
-    0xe7baa7,
-    0xe7baa8,
-    0xe7baa9,
-    0xe7baaa,
-    0xe7baab,
-    0xe7baac,
-    0xe7baad,
-    0xe7baae,
-    0xe7baaf,
-    0xe7bab0,
-    0xe7bab1,
-    0xe7bab2,
-    0xe7bab3,
-    0xe7bab4,
-    0xe7bab5,
-    0xe7bab6,
-    0xe7bab7,
-    0xe7bab8,
-    0xe7bab9,
-    0xe7baba,
-    0xe7babb,
-    0xe7babc,
-    0xe7babd,
-    0xe7babe,
-    0xe7babf,
-    0xe7bb80,
-    0xe7bb81,
-    0xe7bb82,
-    0xe7bb83,
-    0xe7bb84,
-    0xe7bb85,
-    0xe7bb86,
-    0xe7bb87,
-    0xe7bb88,
-    0xe7bb89,
-    0xe7bb8a,
-    0xe7bb8b,
-    0xe7bb8c,
-    0xe7bb8d,
-    0xe7bb8e,
-    0xe7bb8f,
-    0xe7bb90,
-    0xe7bb91,
-    0xe7bb92,
-    0xe7bb93,
-    0xe7bb94,
-    0xe7bb95,
-    0xe7bb96,
-    0xe7bb97,
-    0xe7bb98,
-    0xe7bb99,
-    0xe7bb9a,
-    0xe7bb9b,
-    0xe7bb9c,
-    0xe7bb9d,
-    0xe7bb9e,
-    0xe7bb9f,
-    0xe7bba0,
-    0xe7bba1,
-    0xe7bba2,
-    0xe7bba3,
-    0xe7bba4,
-    0xe7bba5,
-    0xe7bba6,
-    0xe7bba7,
-    0xe7bba8,
-    0xe7bba9,
-    0xe7bbaa,
-    0xe7bbab,
-    0xe7bbac,
-    0xe7bbad,
-    0xe7bbae,
-    0xe7bbaf,
-    0xe7bbb0,
-    0xe7bbb1,
-    0xe7bbb2,
-    0xe7bbb3,
-    0xe7bbb4,
-    0xe7bbb5,
-    0xe7bbb6,
-    0xe7bbb7,
-    0xe7bbb8,
-    0xe7bbb9,
-    0xe7bbba,
-    0xe7bbbb,
-    0xe7bbbc,
-    0xe7bbbd,
-    0xe7bbbe,
-    0xe7bbbf,
-    0xe7bc80,
-    0xe7bc81,
-    0xe7bc82,
-    0xe7bc83,
-    0xe7bc84,
-    0xe7bc85,
-    0xe7bc86,
-    0xe7bc87,
-    0xe7bc88,
-    0xe7bc89,
-    0xe7bc8a,
-    0xe7bc8b,
-    0xe7bc8c,
-    0xe7bc8d,
-    0xe7bc8e,
-    0xe7bc8f,
-    0xe7bc90,
-    0xe7bc91,
-    0xe7bc92,
-    0xe7bc93,
-    0xe7bc94,
-    0xe7bc95,
-    0xe7bc96,
-    0xe7bc97,
-    0xe7bc98,
-    0xe7bc99,
-    0xe7bc9a,
-    0xe7bc9b,
-    0xe7bc9c,
-    0xe7bc9d,
-    0xe7bc9e,
-    0xe7bc9f,
-    0xe7bca0,
-    0xe7bca1,
-    0xe7bca2,
-    0xe7bca3,
-    0xe7bca4,
-    0xe7bca5,
-    0xe7bca6,
-    0xe7bca7,
-    0xe7bca8,
-    0xe7bca9,
-    0xe7bcaa,
-    0xe7bcab,
-    0xe7bcac,
-    0xe7bcad,
-    0xe7bcae,
-    0xe7bcaf,
-    0xe7bcb0,
-    0xe7bcb1,
-    0xe7bcb2,
-    0xe7bcb3,
-    0xe7bcb4,
-    0xe7bcb5,
-    0xe7bcb6,
-    0xe7bcb7,
-    0xe7bcb8,
-    0xe7bcb9,
-    0xe7bcba,
-    0xe7bcbb,
-    0xe7bcbc,
-    0xe7bcbd,
-    0xe7bcbe,
-    0xe7bcbf,
-    0xe7bd80,
-    0xe7bd81,
-    0xe7bd82,
-    0xe7bd83,
-    0xe7bd84,
-    0xe7bd85,
-    0xe7bd86,
-    0xe7bd87,
-    0xe7bd88,
-    0xe7bd89,
-    0xe7bd8a,
-    0xe7bd8b,
-    0xe7bd8c,
-    0xe7bd8d,
-    0xe7bd8e,
-    0xe7bd8f,
-    0xe7bd90,
-    0xe7bd91,
-    0xe7bd92,
-    0xe7bd93,
-    0xe7bd94,
-    0xe7bd95,
-    0xe7bd96,
-    0xe7bd97,
-    0xe7bd98,
-    0xe7bd99,
-    0xe7bd9a,
-    0xe7bd9b,
-    0xe7bd9c,
-    0xe7bd9d,
-    0xe7bd9e,
-    0xe7bd9f,
-    0xe7bda0,
-    0xe7bda1,
-    0xe7bda2,
-    0xe7bda3,
-    0xe7bda4,
-    0xe7bda5,
-    0xe7bda6,
-    0xe7bda7,
-    0xe7bda8,
-    0xe7bda9,
-    0xe7bdaa,
-    0xe7bdab,
-    0xe7bdac,
-    0xe7bdad,
-    0xe7bdae,
-    0xe7bdaf,
-    0xe7bdb0,
-    0xe7bdb1,
-    0xe7bdb2,
-    0xe7bdb3,
-    0xe7bdb4,
-    0xe7bdb5,
-    0xe7bdb6,
-    0xe7bdb7,
-    0xe7bdb8,
-    0xe7bdb9,
-    0xe7bdba,
-    0xe7bdbb,
-    0xe7bdbc,
-    0xe7bdbd,
-    0xe7bdbe,
-    0xe7bdbf,
-    0xe7be80,
-    0xe7be81,
-    0xe7be82,
-    0xe7be83,
-    0xe7be84,
-    0xe7be85,
-    0xe7be86,
-    0xe7be87,
-    0xe7be88,
-    0xe7be89,
-    0xe7be8a,
-    0xe7be8b,
-    0xe7be8c,
-    0xe7be8d,
-    0xe7be8e,
-    0xe7be8f,
-    0xe7be90,
-    0xe7be91,
-    0xe7be92,
-    0xe7be93,
-    0xe7be94,
-    0xe7be95,
-    0xe7be96,
-    0xe7be97,
-    0xe7be98,
-    0xe7be99,
-    0xe7be9a,
-    0xe7be9b,
-    0xe7be9c,
-    0xe7be9d,
-    0xe7be9e,
-    0xe7be9f,
-    0xe7bea0,
-    0xe7bea1,
-    0xe7bea2,
-    0xe7bea3,
-    0xe7bea4,
-    0xe7bea5,
-    0xe7bea6,
-    0xe7bea7,
-    0xe7bea8,
-    0xe7bea9,
-    0xe7beaa,
-    0xe7beab,
-    0xe7beac,
-    0xe7bead,
-    0xe7beae,
-    0xe7beaf,
-    0xe7beb0,
-    0xe7beb1,
-    0xe7beb2,
-    0xe7beb3,
-    0xe7beb4,
-    0xe7beb5,
-    0xe7beb6,
-    0xe7beb7,
-    0xe7beb8,
-    0xe7beb9,
-    0xe7beba,
-    0xe7bebb,
-    0xe7bebc,
-    0xe7bebd,
-    0xe7bebe,
-    0xe7bebf,
-    0xe7bf80,
-    0xe7bf81,
-    0xe7bf82,
-    0xe7bf83,
-    0xe7bf84,
-    0xe7bf85,
-    0xe7bf86,
-    0xe7bf87,
-    0xe7bf88,
-    0xe7bf89,
-    0xe7bf8a,
-    0xe7bf8b,
-    0xe7bf8c,
-    0xe7bf8d,
-    0xe7bf8e,
-    0xe7bf8f,
-    0xe7bf90,
-    0xe7bf91,
-    0xe7bf92,
-    0xe7bf93,
-    0xe7bf94,
-    0xe7bf95,
-    0xe7bf96,
-    0xe7bf97,
-    0xe7bf98,
-    0xe7bf99,
-    0xe7bf9a,
-    0xe7bf9b,
-    0xe7bf9c,
-    0xe7bf9d,
-    0xe7bf9e,
-    0xe7bf9f,
-    0xe7bfa0,
-    0xe7bfa1,
-    0xe7bfa2,
-    0xe7bfa3,
-    0xe7bfa4,
-    0xe7bfa5,
-    0xe7bfa6,
-    0xe7bfa7,
-    0xe7bfa8,
-    0xe7bfa9,
-    0xe7bfaa,
-    0xe7bfab,
-    0xe7bfac,
-    0xe7bfad,
-    0xe7bfae,
-    0xe7bfaf,
-    0xe7bfb0,
-    0xe7bfb1,
-    0xe7bfb2,
-    0xe7bfb3,
-    0xe7bfb4,
-    0xe7bfb5,
-    0xe7bfb6,
-    0xe7bfb7,
-    0xe7bfb8,
-    0xe7bfb9,
-    0xe7bfba,
-    0xe7bfbb,
-    0xe7bfbc,
-    0xe7bfbd,
-    0xe7bfbe,
-    0xe7bfbf,
-    0xe88080,
-    0xe88081,
-    0xe88082,
-    0xe88083,
-    0xe88084,
-    0xe88085,
-    0xe88086,
-    0xe88087,
-    0xe88088,
-    0xe88089,
-    0xe8808a,
-    0xe8808b,
-    0xe8808c,
-    0xe8808d,
-    0xe8808e,
-    0xe8808f,
-    0xe88090,
-    0xe88091,
-    0xe88092,
-    0xe88093,
-    0xe88094,
-    0xe88095,
-    0xe88096,
-    0xe88097,
-    0xe88098,
-    0xe88099,
-    0xe8809a,
-    0xe8809b,
-    0xe8809c,
-    0xe8809d,
-    0xe8809e,
-    0xe8809f,
-    0xe880a0,
-    0xe880a1,
-    0xe880a2,
-    0xe880a3,
-    0xe880a4,
-    0xe880a5,
-    0xe880a6,
-    0xe880a7,
-    0xe880a8,
-    0xe880a9,
-    0xe880aa,
-    0xe880ab,
-    0xe880ac,
-    0xe880ad,
-    0xe880ae,
-    0xe880af,
-    0xe880b0,
-    0xe880b1,
-    0xe880b2,
-    0xe880b3,
-    0xe880b4,
-    0xe880b5,
-    0xe880b6,
-    0xe880b7,
-    0xe880b8,
-    0xe880b9,
-    0xe880ba,
-    0xe880bb,
-    0xe880bc,
-    0xe880bd,
-    0xe880be,
-    0xe880bf,
-    0xe88180,
-    0xe88181,
-    0xe88182,
-    0xe88183,
-    0xe88184,
-    0xe88185,
-    0xe88186,
-    0xe88187,
-    0xe88188,
-    0xe88189,
-    0xe8818a,
-    0xe8818b,
-    0xe8818c,
-    0xe8818d,
-    0xe8818e,
-    0xe8818f,
-    0xe88190,
-    0xe88191,
-    0xe88192,
-    0xe88193,
-    0xe88194,
-    0xe88195,
-    0xe88196,
-    0xe88197,
-    0xe88198,
-    0xe88199,
-    0xe8819a,
-    0xe8819b,
-    0xe8819c,
-    0xe8819d,
-    0xe8819e,
-    0xe8819f,
-    0xe881a0,
-    0xe881a1,
-    0xe881a2,
-    0xe881a3,
-    0xe881a4,
-    0xe881a5,
-    0xe881a6,
-    0xe881a7,
-    0xe881a8,
-    0xe881a9,
-    0xe881aa,
-    0xe881ab,
-    0xe881ac,
-    0xe881ad,
-    0xe881ae,
-    0xe881af,
-    0xe881b0,
-    0xe881b1,
-    0xe881b2,
-    0xe881b3,
-    0xe881b4,
-    0xe881b5,
-    0xe881b6,
-    0xe881b7,
-    0xe881b8,
-    0xe881b9,
-    0xe881ba,
-    0xe881bb,
-    0xe881bc,
-    0xe881bd,
-    0xe881be,
-    0xe881bf,
-    0xe88280,
-    0xe88281,
-    0xe88282,
-    0xe88283,
-    0xe88284,
-    0xe88285,
-    0xe88286,
-    0xe88287,
-    0xe88288,
-    0xe88289,
-    0xe8828a,
-    0xe8828b,
-    0xe8828c,
-    0xe8828d,
-    0xe8828e,
-    0xe8828f,
-    0xe88290,
-    0xe88291,
-    0xe88292,
-    0xe88293,
-    0xe88294,
-    0xe88295,
-    0xe88296,
-    0xe88297,
-    0xe88298,
-    0xe88299,
-    0xe8829a,
-    0xe8829b,
-    0xe8829c,
-    0xe8829d,
-    0xe8829e,
-    0xe8829f,
-    0xe882a0,
-    0xe882a1,
-    0xe882a2,
-    0xe882a3,
-    0xe882a4,
-    0xe882a5,
-    0xe882a6,
-    0xe882a7,
-    0xe882a8,
-    0xe882a9,
-    0xe882aa,
-    0xe882ab,
-    0xe882ac,
-    0xe882ad,
-    0xe882ae,
-    0xe882af,
-    0xe882b0,
-    0xe882b1,
-    0xe882b2,
-    0xe882b3,
-    0xe882b4,
-    0xe882b5,
-    0xe882b6,
-    0xe882b7,
-    0xe882b8,
-    0xe882b9,
-    0xe882ba,
-    0xe882bb,
-    0xe882bc,
-    0xe882bd,
-    0xe882be,
-    0xe882bf,
-    0xe88380,
-    0xe88381,
-    0xe88382,
-    0xe88383,
-    0xe88384,
-    0xe88385,
-    0xe88386,
-    0xe88387,
-    0xe88388,
-    0xe88389,
-    0xe8838a,
-    0xe8838b,
-    0xe8838c,
-    0xe8838d,
-    0xe8838e,
-    0xe8838f,
-    0xe88390,
-    0xe88391,
-    0xe88392,
-    0xe88393,
-    0xe88394,
-    0xe88395,
-    0xe88396,
-    0xe88397,
-    0xe88398,
-    0xe88399,
-    0xe8839a,
-    0xe8839b,
-    0xe8839c,
-    0xe8839d,
-    0xe8839e,
-    0xe8839f,
-    0xe883a0,
-    0xe883a1,
-    0xe883a2,
-    0xe883a3,
-    0xe883a4,
-    0xe883a5,
-    0xe883a6,
-    0xe883a7,
-    0xe883a8,
-    0xe883a9,
-    0xe883aa,
-    0xe883ab,
-    0xe883ac,
-    0xe883ad,
-    0xe883ae,
-    0xe883af,
-    0xe883b0,
-    0xe883b1,
-    0xe883b2,
-    0xe883b3,
-    0xe883b4,
-    0xe883b5,
-    0xe883b6,
-    0xe883b7,
-    0xe883b8,
-    0xe883b9,
-    0xe883ba,
-    0xe883bb,
-    0xe883bc,
-    0xe883bd,
-    0xe883be,
-    0xe883bf,
-    0xe88480,
-    0xe88481,
-    0xe88482,
-    0xe88483,
-    0xe88484,
-    0xe88485,
-    0xe88486,
-    0xe88487,
-    0xe88488,
-    0xe88489,
-    0xe8848a,
-    0xe8848b,
-    0xe8848c,
-    0xe8848d,
-    0xe8848e,
-    0xe8848f,
-    0xe88490,
-    0xe88491,
-    0xe88492,
-    0xe88493,
-    0xe88494,
-    0xe88495,
-    0xe88496,
-    0xe88497,
-    0xe88498,
-    0xe88499,
-    0xe8849a,
-    0xe8849b,
-    0xe8849c,
-    0xe8849d,
-    0xe8849e,
-    0xe8849f,
-    0xe884a0,
-    0xe884a1,
-    0xe884a2,
-    0xe884a3,
-    0xe884a4,
-    0xe884a5,
-    0xe884a6,
-    0xe884a7,
-    0xe884a8,
-    0xe884a9,
-    0xe884aa,
-    0xe884ab,
-    0xe884ac,
-    0xe884ad,
-    0xe884ae,
-    0xe884af,
-    0xe884b0,
-    0xe884b1,
-    0xe884b2,
-    0xe884b3,
-    0xe884b4,
-    0xe884b5,
-    0xe884b6,
-    0xe884b7,
-    0xe884b8,
-    0xe884b9,
-    0xe884ba,
-    0xe884bb,
-    0xe884bc,
-    0xe884bd,
-    0xe884be,
-    0xe884bf,
-    0xe88580,
-    0xe88581,
-    0xe88582,
-    0xe88583,
-    0xe88584,
-    0xe88585,
-    0xe88586,
-    0xe88587,
-    0xe88588,
-    0xe88589,
-    0xe8858a,
-    0xe8858b,
-    0xe8858c,
-    0xe8858d,
-    0xe8858e,
-    0xe8858f,
-    0xe88590,
-    0xe88591,
-    0xe88592,
-    0xe88593,
-    0xe88594,
-    0xe88595,
-    0xe88596,
-    0xe88597,
-    0xe88598,
-    0xe88599,
-    0xe8859a,
-    0xe8859b,
-    0xe8859c,
-    0xe8859d,
-    0xe8859e,
-    0xe8859f,
-    0xe885a0,
-    0xe885a1,
-    0xe885a2,
-    0xe885a3,
-    0xe885a4,
-    0xe885a5,
-    0xe885a6,
-    0xe885a7,
-    0xe885a8,
-    0xe885a9,
-    0xe885aa,
-    0xe885ab,
-    0xe885ac,
-    0xe885ad,
-    0xe885ae,
-    0xe885af,
-    0xe885b0,
-    0xe885b1,
-    0xe885b2,
-    0xe885b3,
-    0xe885b4,
-    0xe885b5,
-    0xe885b6,
-    0xe885b7,
-    0xe885b8,
-    0xe885b9,
-    0xe885ba,
-    0xe885bb,
-    0xe885bc,
-    0xe885bd,
-    0xe885be,
-    0xe885bf,
-    0xe88680,
-    0xe88681,
-    0xe88682,
-    0xe88683,
-    0xe88684,
-    0xe88685,
-    0xe88686,
-    0xe88687,
-    0xe88688,
-    0xe88689,
-    0xe8868a,
-    0xe8868b,
-    0xe8868c,
-    0xe8868d,
-    0xe8868e,
-    0xe8868f,
-    0xe88690,
-    0xe88691,
-    0xe88692,
-    0xe88693,
-    0xe88694,
-    0xe88695,
-    0xe88696,
-    0xe88697,
-    0xe88698,
-    0xe88699,
-    0xe8869a,
-    0xe8869b,
-    0xe8869c,
-    0xe8869d,
-    0xe8869e,
-    0xe8869f,
-    0xe886a0,
-    0xe886a1,
-    0xe886a2,
-    0xe886a3,
-    0xe886a4,
-    0xe886a5,
-    0xe886a6,
-    0xe886a7,
-    0xe886a8,
-    0xe886a9,
-    0xe886aa,
-    0xe886ab,
-    0xe886ac,
-    0xe886ad,
-    0xe886ae,
-    0xe886af,
-    0xe886b0,
-    0xe886b1,
-    0xe886b2,
-    0xe886b3,
-    0xe886b4,
-    0xe886b5,
-    0xe886b6,
-    0xe886b7,
-    0xe886b8,
-    0xe886b9,
-    0xe886ba,
-    0xe886bb,
-    0xe886bc,
-    0xe886bd,
-    0xe886be,
-    0xe886bf,
-    0xe88780,
-    0xe88781,
-    0xe88782,
-    0xe88783,
-    0xe88784,
-    0xe88785,
-    0xe88786,
-    0xe88787,
-    0xe88788,
-    0xe88789,
-    0xe8878a,
-    0xe8878b,
-    0xe8878c,
-    0xe8878d,
-    0xe8878e,
-    0xe8878f,
-    0xe88790,
-    0xe88791,
-    0xe88792,
-    0xe88793,
-    0xe88794,
-    0xe88795,
-    0xe88796,
-    0xe88797,
-    0xe88798,
-    0xe88799,
-    0xe8879a,
-    0xe8879b,
-    0xe8879c,
-    0xe8879d,
-    0xe8879e,
-    0xe8879f,
-    0xe887a0,
-    0xe887a1,
-    0xe887a2,
-    0xe887a3,
-    0xe887a4,
-    0xe887a5,
-    0xe887a6,
-    0xe887a7,
-    0xe887a8,
-    0xe887a9,
-    0xe887aa,
-    0xe887ab,
-    0xe887ac,
-    0xe887ad,
-    0xe887ae,
-    0xe887af,
-    0xe887b0,
-    0xe887b1,
-    0xe887b2,
-    0xe887b3,
-    0xe887b4,
-    0xe887b5,
-    0xe887b6,
-    0xe887b7,
-    0xe887b8,
-    0xe887b9,
-    0xe887ba,
-    0xe887bb,
-    0xe887bc,
-    0xe887bd,
-    0xe887be,
-    0xe887bf,
-    0xe88880,
-    0xe88881,
-    0xe88882,
-    0xe88883,
-    0xe88884,
-    0xe88885,
-    0xe88886,
-    0xe88887,
-    0xe88888,
-    0xe88889,
-    0xe8888a,
-    0xe8888b,
-    0xe8888c,
-    0xe8888d,
-    0xe8888e,
-    0xe8888f,
-    0xe88890,
-    0xe88891,
-    0xe88892,
-    0xe88893,
-    0xe88894,
-    0xe88895,
-    0xe88896,
-    0xe88897,
-    0xe88898,
-    0xe88899,
-    0xe8889a,
-    0xe8889b,
-    0xe8889c,
-    0xe8889d,
-    0xe8889e,
-    0xe8889f,
-    0xe888a0,
-    0xe888a1,
-    0xe888a2,
-    0xe888a3,
-    0xe888a4,
-    0xe888a5,
-    0xe888a6,
-    0xe888a7,
-    0xe888a8,
-    0xe888a9,
-    0xe888aa,
-    0xe888ab,
-    0xe888ac,
-    0xe888ad,
-    0xe888ae,
-    0xe888af,
-    0xe888b0,
-    0xe888b1,
-    0xe888b2,
-    0xe888b3,
-    0xe888b4,
-    0xe888b5,
-    0xe888b6,
-    0xe888b7,
-    0xe888b8,
-    0xe888b9,
-    0xe888ba,
-    0xe888bb,
-    0xe888bc,
-    0xe888bd,
-    0xe888be,
-    0xe888bf,
-    0xe88980,
-    0xe88981,
-    0xe88982,
-    0xe88983,
-    0xe88984,
-    0xe88985,
-    0xe88986,
-    0xe88987,
-    0xe88988,
-    0xe88989,
-    0xe8898a,
-    0xe8898b,
-    0xe8898c,
-    0xe8898d,
-    0xe8898e,
-    0xe8898f,
-    0xe88990,
-    0xe88991,
-    0xe88992,
-    0xe88993,
-    0xe88994,
-    0xe88995,
-    0xe88996,
-    0xe88997,
-    0xe88998,
-    0xe88999,
-    0xe8899a,
-    0xe8899b,
-    0xe8899c,
-    0xe8899d,
-    0xe8899e,
-    0xe8899f,
-    0xe889a0,
-    0xe889a1,
-    0xe889a2,
-    0xe889a3,
-    0xe889a4,
-    0xe889a5,
-    0xe889a6,
-    0xe889a7,
-    0xe889a8,
-    0xe889a9,
-    0xe889aa,
-    0xe889ab,
-    0xe889ac,
-    0xe889ad,
-    0xe889ae,
-    0xe889af,
-    0xe889b0,
-    0xe889b1,
-    0xe889b2,
-    0xe889b3,
-    0xe889b4,
-    0xe889b5,
-    0xe889b6,
-    0xe889b7,
-    0xe889b8,
-    0xe889b9,
-    0xe889ba,
-    0xe889bb,
-    0xe889bc,
-    0xe889bd,
-    0xe889be,
-    0xe889bf,
-    0xe88a80,
-    0xe88a81,
-    0xe88a82,
-    0xe88a83,
-    0xe88a84,
-    0xe88a85,
-    0xe88a86,
-    0xe88a87,
-    0xe88a88,
-    0xe88a89,
-    0xe88a8a,
-    0xe88a8b,
-    0xe88a8c,
-    0xe88a8d,
-    0xe88a8e,
-    0xe88a8f,
-    0xe88a90,
-    0xe88a91,
-    0xe88a92,
-    0xe88a93,
-    0xe88a94,
-    0xe88a95,
-    0xe88a96,
-    0xe88a97,
-    0xe88a98,
-    0xe88a99,
-    0xe88a9a,
-    0xe88a9b,
-    0xe88a9c,
-    0xe88a9d,
-    0xe88a9e,
-    0xe88a9f,
-    0xe88aa0,
-    0xe88aa1,
-    0xe88aa2,
-    0xe88aa3,
-    0xe88aa4,
-    0xe88aa5,
-    0xe88aa6,
-    0xe88aa7,
-    0xe88aa8,
-    0xe88aa9,
-    0xe88aaa,
-    0xe88aab,
-    0xe88aac,
-    0xe88aad,
-    0xe88aae,
-    0xe88aaf,
-    0xe88ab0,
-    0xe88ab1,
-    0xe88ab2,
-    0xe88ab3,
-    0xe88ab4,
-    0xe88ab5,
-    0xe88ab6,
-    0xe88ab7,
-    0xe88ab8,
-    0xe88ab9,
-    0xe88aba,
-    0xe88abb,
-    0xe88abc,
-    0xe88abd,
-    0xe88abe,
-    0xe88abf,
-    0xe88b80,
-    0xe88b81,
-    0xe88b82,
-    0xe88b83,
-    0xe88b84,
-    0xe88b85,
-    0xe88b86,
-    0xe88b87,
-    0xe88b88,
-    0xe88b89,
-    0xe88b8a,
-    0xe88b8b,
-    0xe88b8c,
-    0xe88b8d,
-    0xe88b8e,
-    0xe88b8f,
-    0xe88b90,
-    0xe88b91,
-    0xe88b92,
-    0xe88b93,
-    0xe88b94,
-    0xe88b95,
-    0xe88b96,
-    0xe88b97,
-    0xe88b98,
-    0xe88b99,
-    0xe88b9a,
-    0xe88b9b,
-    0xe88b9c,
-    0xe88b9d,
-    0xe88b9e,
-    0xe88b9f,
-    0xe88ba0,
-    0xe88ba1,
-    0xe88ba2,
-    0xe88ba3,
-    0xe88ba4,
-    0xe88ba5,
-    0xe88ba6,
-    0xe88ba7,
-    0xe88ba8,
-    0xe88ba9,
-    0xe88baa,
-    0xe88bab,
-    0xe88bac,
-    0xe88bad,
-    0xe88bae,
-    0xe88baf,
-    0xe88bb0,
-    0xe88bb1,
-    0xe88bb2,
-    0xe88bb3,
-    0xe88bb4,
-    0xe88bb5,
-    0xe88bb6,
-    0xe88bb7,
-    0xe88bb8,
-    0xe88bb9,
-    0xe88bba,
-    0xe88bbb,
-    0xe88bbc,
-    0xe88bbd,
-    0xe88bbe,
-    0xe88bbf,
-    0xe88c80,
-    0xe88c81,
-    0xe88c82,
-    0xe88c83,
-    0xe88c84,
-    0xe88c85,
-    0xe88c86,
-    0xe88c87,
-    0xe88c88,
-    0xe88c89,
-    0xe88c8a,
-    0xe88c8b,
-    0xe88c8c,
-    0xe88c8d,
-    0xe88c8e,
-    0xe88c8f,
-    0xe88c90,
-    0xe88c91,
-    0xe88c92,
-    0xe88c93,
-    0xe88c94,
-    0xe88c95,
-    0xe88c96,
-    0xe88c97,
-    0xe88c98,
-    0xe88c99,
-    0xe88c9a,
-    0xe88c9b,
-    0xe88c9c,
-    0xe88c9d,
-    0xe88c9e,
-    0xe88c9f,
-    0xe88ca0,
-    0xe88ca1,
-    0xe88ca2,
-    0xe88ca3,
-    0xe88ca4,
-    0xe88ca5,
-    0xe88ca6,
-    0xe88ca7,
-    0xe88ca8,
-    0xe88ca9,
-    0xe88caa,
-    0xe88cab,
-    0xe88cac,
-    0xe88cad,
-    0xe88cae,
-    0xe88caf,
-    0xe88cb0,
-    0xe88cb1,
-    0xe88cb2,
-    0xe88cb3,
-    0xe88cb4,
-    0xe88cb5,
-    0xe88cb6,
-    0xe88cb7,
-    0xe88cb8,
-    0xe88cb9,
-    0xe88cba,
-    0xe88cbb,
-    0xe88cbc,
-    0xe88cbd,
-    0xe88cbe,
-    0xe88cbf,
-    0xe88d80,
-    0xe88d81,
-    0xe88d82,
-    0xe88d83,
-    0xe88d84,
-    0xe88d85,
-    0xe88d86,
-    0xe88d87,
-    0xe88d88,
-    0xe88d89,
-    0xe88d8a,
-    0xe88d8b,
-    0xe88d8c,
-    0xe88d8d,
-    0xe88d8e,
-    0xe88d8f,
-    0xe88d90,
-    0xe88d91,
-    0xe88d92,
-    0xe88d93,
-    0xe88d94,
-    0xe88d95,
-    0xe88d96,
-    0xe88d97,
-    0xe88d98,
-    0xe88d99,
-    0xe88d9a,
-    0xe88d9b,
-    0xe88d9c,
-    0xe88d9d,
-    0xe88d9e,
-    0xe88d9f,
-    0xe88da0,
-    0xe88da1,
-    0xe88da2,
-    0xe88da3,
-    0xe88da4,
-    0xe88da5,
-    0xe88da6,
-    0xe88da7,
-    0xe88da8,
-    0xe88da9,
-    0xe88daa,
-    0xe88dab,
-    0xe88dac,
-    0xe88dad,
-    0xe88dae,
-    0xe88daf,
-    0xe88db0,
-    0xe88db1,
-    0xe88db2,
-    0xe88db3,
-    0xe88db4,
-    0xe88db5,
-    0xe88db6,
-    0xe88db7,
-    0xe88db8,
-    0xe88db9,
-    0xe88dba,
-    0xe88dbb,
-    0xe88dbc,
-    0xe88dbd,
-    0xe88dbe,
-    0xe88dbf,
-    0xe88e80,
-    0xe88e81,
-    0xe88e82,
-    0xe88e83,
-    0xe88e84,
-    0xe88e85,
-    0xe88e86,
-    0xe88e87,
-    0xe88e88,
-    0xe88e89,
-    0xe88e8a,
-    0xe88e8b,
-    0xe88e8c,
-    0xe88e8d,
-    0xe88e8e,
-    0xe88e8f,
-    0xe88e90,
-    0xe88e91,
-    0xe88e92,
-    0xe88e93,
-    0xe88e94,
-    0xe88e95,
-    0xe88e96,
-    0xe88e97,
-    0xe88e98,
-    0xe88e99,
-    0xe88e9a,
-    0xe88e9b,
-    0xe88e9c,
-    0xe88e9d,
-    0xe88e9e,
-    0xe88e9f,
-    0xe88ea0,
-    0xe88ea1,
-    0xe88ea2,
-    0xe88ea3,
-    0xe88ea4,
-    0xe88ea5,
-    0xe88ea6,
-    0xe88ea7,
-    0xe88ea8,
-    0xe88ea9,
-    0xe88eaa,
-    0xe88eab,
-    0xe88eac,
-    0xe88ead,
-    0xe88eae,
-    0xe88eaf,
-    0xe88eb0,
-    0xe88eb1,
-    0xe88eb2,
-    0xe88eb3,
-    0xe88eb4,
-    0xe88eb5,
-    0xe88eb6,
-    0xe88eb7,
-    0xe88eb8,
-    0xe88eb9,
-    0xe88eba,
-    0xe88ebb,
-    0xe88ebc,
-    0xe88ebd,
-    0xe88ebe,
-    0xe88ebf,
-    0xe88f80,
-    0xe88f81,
-    0xe88f82,
-    0xe88f83,
-    0xe88f84,
-    0xe88f85,
-    0xe88f86,
-    0xe88f87,
-    0xe88f88,
-    0xe88f89,
-    0xe88f8a,
-    0xe88f8b,
-    0xe88f8c,
-    0xe88f8d,
-    0xe88f8e,
-    0xe88f8f,
-    0xe88f90,
-    0xe88f91,
-    0xe88f92,
-    0xe88f93,
-    0xe88f94,
-    0xe88f95,
-    0xe88f96,
-    0xe88f97,
-    0xe88f98,
-    0xe88f99,
-    0xe88f9a,
-    0xe88f9b,
-    0xe88f9c,
-    0xe88f9d,
-    0xe88f9e,
-    0xe88f9f,
-    0xe88fa0,
-    0xe88fa1,
-    0xe88fa2,
-    0xe88fa3,
-    0xe88fa4,
-    0xe88fa5,
-    0xe88fa6,
-    0xe88fa7,
-    0xe88fa8,
-    0xe88fa9,
-    0xe88faa,
-    0xe88fab,
-    0xe88fac,
-    0xe88fad,
-    0xe88fae,
-    0xe88faf,
-    0xe88fb0,
-    0xe88fb1,
-    0xe88fb2,
-    0xe88fb3,
-    0xe88fb4,
-    0xe88fb5,
-    0xe88fb6,
-    0xe88fb7,
-    0xe88fb8,
-    0xe88fb9,
-    0xe88fba,
-    0xe88fbb,
-    0xe88fbc,
-    0xe88fbd,
-    0xe88fbe,
-    0xe88fbf,
-    0xe89080,
-    0xe89081,
-    0xe89082,
-    0xe89083,
-    0xe89084,
-    0xe89085,
-    0xe89086,
-    0xe89087,
-    0xe89088,
-    0xe89089,
-    0xe8908a,
-    0xe8908b,
-    0xe8908c,
-    0xe8908d,
-    0xe8908e,
-    0xe8908f,
-    0xe89090,
-    0xe89091,
-    0xe89092,
-    0xe89093,
-    0xe89094,
-    0xe89095,
-    0xe89096,
-    0xe89097,
-    0xe89098,
-    0xe89099,
-    0xe8909a,
-    0xe8909b,
-    0xe8909c,
-    0xe8909d,
-    0xe8909e,
-    0xe8909f,
-    0xe890a0,
-    0xe890a1,
-    0xe890a2,
-    0xe890a3,
-    0xe890a4,
-    0xe890a5,
-    0xe890a6,
-    0xe890a7,
-    0xe890a8,
-    0xe890a9,
-    0xe890aa,
-    0xe890ab,
-    0xe890ac,
-    0xe890ad,
-    0xe890ae,
-    0xe890af,
-    0xe890b0,
-    0xe890b1,
-    0xe890b2,
-    0xe890b3,
-    0xe890b4,
-    0xe890b5,
-    0xe890b6,
-    0xe890b7,
-    0xe890b8,
-    0xe890b9,
-    0xe890ba,
-    0xe890bb,
-    0xe890bc,
-    0xe890bd,
-    0xe890be,
-    0xe890bf,
-    0xe89180,
-    0xe89181,
-    0xe89182,
-    0xe89183,
-    0xe89184,
-    0xe89185,
-    0xe89186,
-    0xe89187,
-    0xe89188,
-    0xe89189,
-    0xe8918a,
-    0xe8918b,
-    0xe8918c,
-    0xe8918d,
-    0xe8918e,
-    0xe8918f,
-    0xe89190,
-    0xe89191,
-    0xe89192,
-    0xe89193,
-    0xe89194,
-    0xe89195,
-    0xe89196,
-    0xe89197,
-    0xe89198,
-    0xe89199,
-    0xe8919a,
-    0xe8919b,
-    0xe8919c,
-    0xe8919d,
-    0xe8919e,
-    0xe8919f,
-    0xe891a0,
-    0xe891a1,
-    0xe891a2,
-    0xe891a3,
-    0xe891a4,
-    0xe891a5,
-    0xe891a6,
-    0xe891a7,
-    0xe891a8,
-    0xe891a9,
-    0xe891aa,
-    0xe891ab,
-    0xe891ac,
-    0xe891ad,
-    0xe891ae,
-    0xe891af,
-    0xe891b0,
-    0xe891b1,
-    0xe891b2,
-    0xe891b3,
-    0xe891b4,
-    0xe891b5,
-    0xe891b6,
-    0xe891b7,
-    0xe891b8,
-    0xe891b9,
-    0xe891ba,
-    0xe891bb,
-    0xe891bc,
-    0xe891bd,
-    0xe891be,
-    0xe891bf,
-    0xe89280,
-    0xe89281,
-    0xe89282,
-    0xe89283,
-    0xe89284,
-    0xe89285,
-    0xe89286,
-    0xe89287,
-    0xe89288,
-    0xe89289,
-    0xe8928a,
-    0xe8928b,
-    0xe8928c,
-    0xe8928d,
-    0xe8928e,
-    0xe8928f,
-    0xe89290,
-    0xe89291,
-    0xe89292,
-    0xe89293,
-    0xe89294,
-    0xe89295,
-    0xe89296,
-    0xe89297,
-    0xe89298,
-    0xe89299,
-    0xe8929a,
-    0xe8929b,
-    0xe8929c,
-    0xe8929d,
-    0xe8929e,
-    0xe8929f,
-    0xe892a0,
-    0xe892a1,
-    0xe892a2,
-    0xe892a3,
-    0xe892a4,
-    0xe892a5,
-    0xe892a6,
-    0xe892a7,
-    0xe892a8,
-    0xe892a9,
-    0xe892aa,
-    0xe892ab,
-    0xe892ac,
-    0xe892ad,
-    0xe892ae,
-    0xe892af,
-    0xe892b0,
-    0xe892b1,
-    0xe892b2,
-    0xe892b3,
-    0xe892b4,
-    0xe892b5,
-    0xe892b6,
-    0xe892b7,
-    0xe892b8,
-    0xe892b9,
-    0xe892ba,
-    0xe892bb,
-    0xe892bc,
-    0xe892bd,
-    0xe892be,
-    0xe892bf,
-    0xe89380,
-    0xe89381,
-    0xe89382,
-    0xe89383,
-    0xe89384,
-    0xe89385,
-    0xe89386,
-    0xe89387,
-    0xe89388,
-    0xe89389,
-    0xe8938a,
-    0xe8938b,
-    0xe8938c,
-    0xe8938d,
-    0xe8938e,
-    0xe8938f,
-    0xe89390,
-    0xe89391,
-    0xe89392,
-    0xe89393,
-    0xe89394,
-    0xe89395,
-    0xe89396,
-    0xe89397,
-    0xe89398,
-    0xe89399,
-    0xe8939a,
-    0xe8939b,
-    0xe8939c,
-    0xe8939d,
-    0xe8939e,
-    0xe8939f,
-    0xe893a0,
-    0xe893a1,
-    0xe893a2,
-    0xe893a3,
-    0xe893a4,
-    0xe893a5,
-    0xe893a6,
-    0xe893a7,
-    0xe893a8,
-    0xe893a9,
-    0xe893aa,
-    0xe893ab,
-    0xe893ac,
-    0xe893ad,
-    0xe893ae,
-    0xe893af,
-    0xe893b0,
-    0xe893b1,
-    0xe893b2,
-    0xe893b3,
-    0xe893b4,
-    0xe893b5,
-    0xe893b6,
-    0xe893b7,
-    0xe893b8,
-    0xe893b9,
-    0xe893ba,
-    0xe893bb,
-    0xe893bc,
-    0xe893bd,
-    0xe893be,
-    0xe893bf,
-    0xe89480,
-    0xe89481,
-    0xe89482,
-    0xe89483,
-    0xe89484,
-    0xe89485,
-    0xe89486,
-    0xe89487,
-    0xe89488,
-    0xe89489,
-    0xe8948a,
-    0xe8948b,
-    0xe8948c,
-    0xe8948d,
-    0xe8948e,
-    0xe8948f,
-    0xe89490,
-    0xe89491,
-    0xe89492,
-    0xe89493,
-    0xe89494,
-    0xe89495,
-    0xe89496,
-    0xe89497,
-    0xe89498,
-    0xe89499,
-    0xe8949a,
-    0xe8949b,
-    0xe8949c,
-    0xe8949d,
-    0xe8949e,
-    0xe8949f,
-    0xe894a0,
-    0xe894a1,
-    0xe894a2,
-    0xe894a3,
-    0xe894a4,
-    0xe894a5,
-    0xe894a6,
-    0xe894a7,
-    0xe894a8,
-    0xe894a9,
-    0xe894aa,
-    0xe894ab,
-    0xe894ac,
-    0xe894ad,
-    0xe894ae,
-    0xe894af,
-    0xe894b0,
-    0xe894b1,
-    0xe894b2,
-    0xe894b3,
-    0xe894b4,
-    0xe894b5,
-    0xe894b6,
-    0xe894b7,
-    0xe894b8,
-    0xe894b9,
-    0xe894ba,
-    0xe894bb,
-    0xe894bc,
-    0xe894bd,
-    0xe894be,
-    0xe894bf,
-    0xe89580,
-    0xe89581,
-    0xe89582,
-    0xe89583,
-    0xe89584,
-    0xe89585,
-    0xe89586,
-    0xe89587,
-    0xe89588,
-    0xe89589,
-    0xe8958a,
-    0xe8958b,
-    0xe8958c,
-    0xe8958d,
-    0xe8958e,
-    0xe8958f,
-    0xe89590,
-    0xe89591,
-    0xe89592,
-    0xe89593,
-    0xe89594,
-    0xe89595,
-    0xe89596,
-    0xe89597,
-    0xe89598,
-    0xe89599,
-    0xe8959a,
-    0xe8959b,
-    0xe8959c,
-    0xe8959d,
-    0xe8959e,
-    0xe8959f,
-    0xe895a0,
-    0xe895a1,
-    0xe895a2,
-    0xe895a3,
-    0xe895a4,
-    0xe895a5,
-    0xe895a6,
-    0xe895a7,
-    0xe895a8,
-    0xe895a9,
-    0xe895aa,
-    0xe895ab,
-    0xe895ac,
-    0xe895ad,
-    0xe895ae,
-    0xe895af,
-    0xe895b0,
-    0xe895b1,
-    0xe895b2,
-    0xe895b3,
-    0xe895b4,
-    0xe895b5,
-    0xe895b6,
-    0xe895b7,
-    0xe895b8,
-    0xe895b9,
-    0xe895ba,
-    0xe895bb,
-    0xe895bc,
-    0xe895bd,
-    0xe895be,
-    0xe895bf,
-    0xe89680,
-    0xe89681,
-    0xe89682,
-    0xe89683,
-    0xe89684,
-    0xe89685,
-    0xe89686,
-    0xe89687,
-    0xe89688,
-    0xe89689,
-    0xe8968a,
-    0xe8968b,
-    0xe8968c,
-    0xe8968d,
-    0xe8968e,
-    0xe8968f,
-    0xe89690,
-    0xe89691,
-    0xe89692,
-    0xe89693,
-    0xe89694,
-    0xe89695,
-    0xe89696,
-    0xe89697,
-    0xe89698,
-    0xe89699,
-    0xe8969a,
-    0xe8969b,
-    0xe8969c,
-    0xe8969d,
-    0xe8969e,
-    0xe8969f,
-    0xe896a0,
-    0xe896a1,
-    0xe896a2,
-    0xe896a3,
-    0xe896a4,
-    0xe896a5,
-    0xe896a6,
-    0xe896a7,
-    0xe896a8,
-    0xe896a9,
-    0xe896aa,
-    0xe896ab,
-    0xe896ac,
-    0xe896ad,
-    0xe896ae,
-    0xe896af,
-    0xe896b0,
-    0xe896b1,
-    0xe896b2,
-    0xe896b3,
-    0xe896b4,
-    0xe896b5,
-    0xe896b6,
-    0xe896b7,
-    0xe896b8,
-    0xe896b9,
-    0xe896ba,
-    0xe896bb,
-    0xe896bc,
-    0xe896bd,
-    0xe896be,
-    0xe896bf,
-    0xe89780,
-    0xe89781,
-    0xe89782,
-    0xe89783,
-    0xe89784,
-    0xe89785,
-    0xe89786,
-    0xe89787,
-    0xe89788,
-    0xe89789,
-    0xe8978a,
-    0xe8978b,
-    0xe8978c,
-    0xe8978d,
-    0xe8978e,
-    0xe8978f,
-    0xe89790,
-    0xe89791,
-    0xe89792,
-    0xe89793,
-    0xe89794,
-    0xe89795,
-    0xe89796,
-    0xe89797,
-    0xe89798,
-    0xe89799,
-    0xe8979a,
-    0xe8979b,
-    0xe8979c,
-    0xe8979d,
-    0xe8979e,
-    0xe8979f,
-    0xe897a0,
-    0xe897a1,
-    0xe897a2,
-    0xe897a3,
-    0xe897a4,
-    0xe897a5,
-    0xe897a6,
-    0xe897a7,
-    0xe897a8,
-    0xe897a9,
-    0xe897aa,
-    0xe897ab,
-    0xe897ac,
-    0xe897ad,
-    0xe897ae,
-    0xe897af,
-    0xe897b0,
-    0xe897b1,
-    0xe897b2,
-    0xe897b3,
-    0xe897b4,
-    0xe897b5,
-    0xe897b6,
-    0xe897b7,
-    0xe897b8,
-    0xe897b9,
-    0xe897ba,
-    0xe897bb,
-    0xe897bc,
-    0xe897bd,
-    0xe897be,
-    0xe897bf,
-    0xe89880,
-    0xe89881,
-    0xe89882,
-    0xe89883,
-    0xe89884,
-    0xe89885,
-    0xe89886,
-    0xe89887,
-    0xe89888,
-    0xe89889,
-    0xe8988a,
-    0xe8988b,
-    0xe8988c,
-    0xe8988d,
-    0xe8988e,
-    0xe8988f,
-    0xe89890,
-    0xe89891,
-    0xe89892,
-    0xe89893,
-    0xe89894,
-    0xe89895,
-    0xe89896,
-    0xe89897,
-    0xe89898,
-    0xe89899,
-    0xe8989a,
-    0xe8989b,
-    0xe8989c,
-    0xe8989d,
-    0xe8989e,
-    0xe8989f,
-    0xe898a0,
-    0xe898a1,
-    0xe898a2,
-    0xe898a3,
-    0xe898a4,
-    0xe898a5,
-    0xe898a6,
-    0xe898a7,
-    0xe898a8,
-    0xe898a9,
-    0xe898aa,
-    0xe898ab,
-    0xe898ac,
-    0xe898ad,
-    0xe898ae,
-    0xe898af,
-    0xe898b0,
-    0xe898b1,
-    0xe898b2,
-    0xe898b3,
-    0xe898b4,
-    0xe898b5,
-    0xe898b6,
-    0xe898b7,
-    0xe898b8,
-    0xe898b9,
-    0xe898ba,
-    0xe898bb,
-    0xe898bc,
-    0xe898bd,
-    0xe898be,
-    0xe898bf,
-    0xe89980,
-    0xe89981,
-    0xe89982,
-    0xe89983,
-    0xe89984,
-    0xe89985,
-    0xe89986,
-    0xe89987,
-    0xe89988,
-    0xe89989,
-    0xe8998a,
-    0xe8998b,
-    0xe8998c,
-    0xe8998d,
-    0xe8998e,
-    0xe8998f,
-    0xe89990,
-    0xe89991,
-    0xe89992,
-    0xe89993,
-    0xe89994,
-    0xe89995,
-    0xe89996,
-    0xe89997,
-    0xe89998,
-    0xe89999,
-    0xe8999a,
-    0xe8999b,
-    0xe8999c,
-    0xe8999d,
-    0xe8999e,
-    0xe8999f,
-    0xe899a0,
-    0xe899a1,
-    0xe899a2,
-    0xe899a3,
-    0xe899a4,
-    0xe899a5,
-    0xe899a6,
-    0xe899a7,
-    0xe899a8,
-    0xe899a9,
-    0xe899aa,
-    0xe899ab,
-    0xe899ac,
-    0xe899ad,
-    0xe899ae,
-    0xe899af,
-    0xe899b0,
-    0xe899b1,
-    0xe899b2,
-    0xe899b3,
-    0xe899b4,
-    0xe899b5,
-    0xe899b6,
-    0xe899b7,
-    0xe899b8,
-    0xe899b9,
-    0xe899ba,
-    0xe899bb,
-    0xe899bc,
-    0xe899bd,
-    0xe899be,
-    0xe899bf,
-    0xe89a80,
-    0xe89a81,
-    0xe89a82,
-    0xe89a83,
-    0xe89a84,
-    0xe89a85,
-    0xe89a86,
-    0xe89a87,
-    0xe89a88,
-    0xe89a89,
-    0xe89a8a,
-    0xe89a8b,
-    0xe89a8c,
-    0xe89a8d,
-    0xe89a8e,
-    0xe89a8f,
-    0xe89a90,
-    0xe89a91,
-    0xe89a92,
-    0xe89a93,
-    0xe89a94,
-    0xe89a95,
-    0xe89a96,
-    0xe89a97,
-    0xe89a98,
-    0xe89a99,
-    0xe89a9a,
-    0xe89a9b,
-    0xe89a9c,
-    0xe89a9d,
-    0xe89a9e,
-    0xe89a9f,
-    0xe89aa0,
-    0xe89aa1,
-    0xe89aa2,
-    0xe89aa3,
-    0xe89aa4,
-    0xe89aa5,
-    0xe89aa6,
-    0xe89aa7,
-    0xe89aa8,
-    0xe89aa9,
-    0xe89aaa,
-    0xe89aab,
-    0xe89aac,
-    0xe89aad,
-    0xe89aae,
-    0xe89aaf,
-    0xe89ab0,
-    0xe89ab1,
-    0xe89ab2,
-    0xe89ab3,
-    0xe89ab4,
-    0xe89ab5,
-    0xe89ab6,
-    0xe89ab7,
-    0xe89ab8,
-    0xe89ab9,
-    0xe89aba,
-    0xe89abb,
-    0xe89abc,
-    0xe89abd,
-    0xe89abe,
-    0xe89abf,
-    0xe89b80,
-    0xe89b81,
-    0xe89b82,
-    0xe89b83,
-    0xe89b84,
-    0xe89b85,
-    0xe89b86,
-    0xe89b87,
-    0xe89b88,
-    0xe89b89,
-    0xe89b8a,
-    0xe89b8b,
-    0xe89b8c,
-    0xe89b8d,
-    0xe89b8e,
-    0xe89b8f,
-    0xe89b90,
-    0xe89b91,
-    0xe89b92,
-    0xe89b93,
-    0xe89b94,
-    0xe89b95,
-    0xe89b96,
-    0xe89b97,
-    0xe89b98,
-    0xe89b99,
-    0xe89b9a,
-    0xe89b9b,
-    0xe89b9c,
-    0xe89b9d,
-    0xe89b9e,
-    0xe89b9f,
-    0xe89ba0,
-    0xe89ba1,
-    0xe89ba2,
-    0xe89ba3,
-    0xe89ba4,
-    0xe89ba5,
-    0xe89ba6,
-    0xe89ba7,
-    0xe89ba8,
-    0xe89ba9,
-    0xe89baa,
-    0xe89bab,
-    0xe89bac,
-    0xe89bad,
-    0xe89bae,
-    0xe89baf,
-    0xe89bb0,
-    0xe89bb1,
-    0xe89bb2,
-    0xe89bb3,
-    0xe89bb4,
-    0xe89bb5,
-    0xe89bb6,
-    0xe89bb7,
-    0xe89bb8,
-    0xe89bb9,
-    0xe89bba,
-    0xe89bbb,
-    0xe89bbc,
-    0xe89bbd,
-    0xe89bbe,
-    0xe89bbf,
-    0xe89c80,
-    0xe89c81,
-    0xe89c82,
-    0xe89c83,
-    0xe89c84,
-    0xe89c85,
-    0xe89c86,
-    0xe89c87,
-    0xe89c88,
-    0xe89c89,
-    0xe89c8a,
-    0xe89c8b,
-    0xe89c8c,
-    0xe89c8d,
-    0xe89c8e,
-    0xe89c8f,
-    0xe89c90,
-    0xe89c91,
-    0xe89c92,
-    0xe89c93,
-    0xe89c94,
-    0xe89c95,
-    0xe89c96,
-    0xe89c97,
-    0xe89c98,
-    0xe89c99,
-    0xe89c9a,
-    0xe89c9b,
-    0xe89c9c,
-    0xe89c9d,
-    0xe89c9e,
-    0xe89c9f,
-    0xe89ca0,
-    0xe89ca1,
-    0xe89ca2,
-    0xe89ca3,
-    0xe89ca4,
-    0xe89ca5,
-    0xe89ca6,
-    0xe89ca7,
-    0xe89ca8,
-    0xe89ca9,
-    0xe89caa,
-    0xe89cab,
-    0xe89cac,
-    0xe89cad,
-    0xe89cae,
-    0xe89caf,
-    0xe89cb0,
-    0xe89cb1,
-    0xe89cb2,
-    0xe89cb3,
-    0xe89cb4,
-    0xe89cb5,
-    0xe89cb6,
-    0xe89cb7,
-    0xe89cb8,
-    0xe89cb9,
-    0xe89cba,
-    0xe89cbb,
-    0xe89cbc,
-    0xe89cbd,
-    0xe89cbe,
-    0xe89cbf,
-    0xe89d80,
-    0xe89d81,
-    0xe89d82,
-    0xe89d83,
-    0xe89d84,
-    0xe89d85,
-    0xe89d86,
-    0xe89d87,
-    0xe89d88,
-    0xe89d89,
-    0xe89d8a,
-    0xe89d8b,
-    0xe89d8c,
-    0xe89d8d,
-    0xe89d8e,
-    0xe89d8f,
-    0xe89d90,
-    0xe89d91,
-    0xe89d92,
-    0xe89d93,
-    0xe89d94,
-    0xe89d95,
-    0xe89d96,
-    0xe89d97,
-    0xe89d98,
-    0xe89d99,
-    0xe89d9a,
-    0xe89d9b,
-    0xe89d9c,
-    0xe89d9d,
-    0xe89d9e,
-    0xe89d9f,
-    0xe89da0,
-    0xe89da1,
-    0xe89da2,
-    0xe89da3,
-    0xe89da4,
-    0xe89da5,
-    0xe89da6,
-    0xe89da7,
-    0xe89da8,
-    0xe89da9,
-    0xe89daa,
-    0xe89dab,
-    0xe89dac,
-    0xe89dad,
-    0xe89dae,
-    0xe89daf,
-    0xe89db0,
-    0xe89db1,
-    0xe89db2,
-    0xe89db3,
-    0xe89db4,
-    0xe89db5,
-    0xe89db6,
-    0xe89db7,
-    0xe89db8,
-    0xe89db9,
-    0xe89dba,
-    0xe89dbb,
-    0xe89dbc,
-    0xe89dbd,
-    0xe89dbe,
-    0xe89dbf,
-    0xe89e80,
-    0xe89e81,
-    0xe89e82,
-    0xe89e83,
-    0xe89e84,
-    0xe89e85,
-    0xe89e86,
-    0xe89e87,
-    0xe89e88,
-    0xe89e89,
-    0xe89e8a,
-    0xe89e8b,
-    0xe89e8c,
-    0xe89e8d,
-    0xe89e8e,
-    0xe89e8f,
-    0xe89e90,
-    0xe89e91,
-    0xe89e92,
-    0xe89e93,
-    0xe89e94,
-    0xe89e95,
-    0xe89e96,
-    0xe89e97,
-    0xe89e98,
-    0xe89e99,
-    0xe89e9a,
-    0xe89e9b,
-    0xe89e9c,
-    0xe89e9d,
-    0xe89e9e,
-    0xe89e9f,
-    0xe89ea0,
-    0xe89ea1,
-    0xe89ea2,
-    0xe89ea3,
-    0xe89ea4,
-    0xe89ea5,
-    0xe89ea6,
-    0xe89ea7,
-    0xe89ea8,
-    0xe89ea9,
-    0xe89eaa,
-    0xe89eab,
-    0xe89eac,
-    0xe89ead,
-    0xe89eae,
-    0xe89eaf,
-    0xe89eb0,
-    0xe89eb1,
-    0xe89eb2,
-    0xe89eb3,
-    0xe89eb4,
-    0xe89eb5,
-    0xe89eb6,
-    0xe89eb7,
-    0xe89eb8,
-    0xe89eb9,
-    0xe89eba,
-    0xe89ebb,
-    0xe89ebc,
-    0xe89ebd,
-    0xe89ebe,
-    0xe89ebf,
-    0xe89f80,
-    0xe89f81,
-    0xe89f82,
-    0xe89f83,
-    0xe89f84,
-    0xe89f85,
-    0xe89f86,
-    0xe89f87,
-    0xe89f88,
-    0xe89f89,
-    0xe89f8a,
-    0xe89f8b,
-    0xe89f8c,
-    0xe89f8d,
-    0xe89f8e,
-    0xe89f8f,
-    0xe89f90,
-    0xe89f91,
-    0xe89f92,
-    0xe89f93,
-    0xe89f94,
-    0xe89f95,
-    0xe89f96,
-    0xe89f97,
-    0xe89f98,
-    0xe89f99,
-    0xe89f9a,
-    0xe89f9b,
-    0xe89f9c,
-    0xe89f9d,
-    0xe89f9e,
-    0xe89f9f,
-    0xe89fa0,
-    0xe89fa1,
-    0xe89fa2,
-    0xe89fa3,
-    0xe89fa4,
-    0xe89fa5,
-    0xe89fa6,
-    0xe89fa7,
-    0xe89fa8,
-    0xe89fa9,
-    0xe89faa,
-    0xe89fab,
-    0xe89fac,
-    0xe89fad,
-    0xe89fae,
-    0xe89faf,
-    0xe89fb0,
-    0xe89fb1,
-    0xe89fb2,
-    0xe89fb3,
-    0xe89fb4,
-    0xe89fb5,
-    0xe89fb6,
-    0xe89fb7,
-    0xe89fb8,
-    0xe89fb9,
-    0xe89fba,
-    0xe89fbb,
-    0xe89fbc,
-    0xe89fbd,
-    0xe89fbe,
-    0xe89fbf,
-    0xe8a080,
-    0xe8a081,
-    0xe8a082,
-    0xe8a083,
-    0xe8a084,
-    0xe8a085,
-    0xe8a086,
-    0xe8a087,
-    0xe8a088,
-    0xe8a089,
-    0xe8a08a,
-    0xe8a08b,
-    0xe8a08c,
-    0xe8a08d,
-    0xe8a08e,
-    0xe8a08f,
-    0xe8a090,
-    0xe8a091,
-    0xe8a092,
-    0xe8a093,
-    0xe8a094,
-    0xe8a095,
-    0xe8a096,
-    0xe8a097,
-    0xe8a098,
-    0xe8a099,
-    0xe8a09a,
-    0xe8a09b,
-    0xe8a09c,
-    0xe8a09d,
-    0xe8a09e,
-    0xe8a09f,
-    0xe8a0a0,
-    0xe8a0a1,
-    0xe8a0a2,
-    0xe8a0a3,
-    0xe8a0a4,
-    0xe8a0a5,
-    0xe8a0a6,
-    0xe8a0a7,
-    0xe8a0a8,
-    0xe8a0a9,
-    0xe8a0aa,
-    0xe8a0ab,
-    0xe8a0ac,
-    0xe8a0ad,
-    0xe8a0ae,
-    0xe8a0af,
-    0xe8a0b0,
-    0xe8a0b1,
-    0xe8a0b2,
-    0xe8a0b3,
-    0xe8a0b4,
-    0xe8a0b5,
-    0xe8a0b6,
-    0xe8a0b7,
-    0xe8a0b8,
-    0xe8a0b9,
-    0xe8a0ba,
-    0xe8a0bb,
-    0xe8a0bc,
-    0xe8a0bd,
-    0xe8a0be,
-    0xe8a0bf,
-    0xe8a180,
-    0xe8a181,
-    0xe8a182,
-    0xe8a183,
-    0xe8a184,
-    0xe8a185,
-    0xe8a186,
-    0xe8a187,
-    0xe8a188,
-    0xe8a189,
-    0xe8a18a,
-    0xe8a18b,
-    0xe8a18c,
-    0xe8a18d,
-    0xe8a18e,
-    0xe8a18f,
-    0xe8a190,
-    0xe8a191,
-    0xe8a192,
-    0xe8a193,
-    0xe8a194,
-    0xe8a195,
-    0xe8a196,
-    0xe8a197,
-    0xe8a198,
-    0xe8a199,
-    0xe8a19a,
-    0xe8a19b,
-    0xe8a19c,
-    0xe8a19d,
-    0xe8a19e,
-    0xe8a19f,
-    0xe8a1a0,
-    0xe8a1a1,
-    0xe8a1a2,
-    0xe8a1a3,
-    0xe8a1a4,
-    0xe8a1a5,
-    0xe8a1a6,
-    0xe8a1a7,
-    0xe8a1a8,
-    0xe8a1a9,
-    0xe8a1aa,
-    0xe8a1ab,
-    0xe8a1ac,
-    0xe8a1ad,
-    0xe8a1ae,
-    0xe8a1af,
-    0xe8a1b0,
-    0xe8a1b1,
-    0xe8a1b2,
-    0xe8a1b3,
-    0xe8a1b4,
-    0xe8a1b5,
-    0xe8a1b6,
-    0xe8a1b7,
-    0xe8a1b8,
-    0xe8a1b9,
-    0xe8a1ba,
-    0xe8a1bb,
-    0xe8a1bc,
-    0xe8a1bd,
-    0xe8a1be,
-    0xe8a1bf,
-    0xe8a280,
-    0xe8a281,
-    0xe8a282,
-    0xe8a283,
-    0xe8a284,
-    0xe8a285,
-    0xe8a286,
-    0xe8a287,
-    0xe8a288,
-    0xe8a289,
-    0xe8a28a,
-    0xe8a28b,
-    0xe8a28c,
-    0xe8a28d,
-    0xe8a28e,
-    0xe8a28f,
-    0xe8a290,
-    0xe8a291,
-    0xe8a292,
-    0xe8a293,
-    0xe8a294,
-    0xe8a295,
-    0xe8a296,
-    0xe8a297,
-    0xe8a298,
-    0xe8a299,
-    0xe8a29a,
-    0xe8a29b,
-    0xe8a29c,
-    0xe8a29d,
-    0xe8a29e,
-    0xe8a29f,
-    0xe8a2a0,
-    0xe8a2a1,
-    0xe8a2a2,
-    0xe8a2a3,
-    0xe8a2a4,
-    0xe8a2a5,
-    0xe8a2a6,
-    0xe8a2a7,
-    0xe8a2a8,
-    0xe8a2a9,
-    0xe8a2aa,
-    0xe8a2ab,
-    0xe8a2ac,
-    0xe8a2ad,
-    0xe8a2ae,
-    0xe8a2af,
-    0xe8a2b0,
-    0xe8a2b1,
-    0xe8a2b2,
-    0xe8a2b3,
-    0xe8a2b4,
-    0xe8a2b5,
-    0xe8a2b6,
-    0xe8a2b7,
-    0xe8a2b8,
-    0xe8a2b9,
-    0xe8a2ba,
-    0xe8a2bb,
-    0xe8a2bc,
-    0xe8a2bd,
-    0xe8a2be,
-    0xe8a2bf,
-    0xe8a380,
-    0xe8a381,
-    0xe8a382,
-    0xe8a383,
-    0xe8a384,
-    0xe8a385,
-    0xe8a386,
-    0xe8a387,
-    0xe8a388,
-    0xe8a389,
-    0xe8a38a,
-    0xe8a38b,
-    0xe8a38c,
-    0xe8a38d,
-    0xe8a38e,
-    0xe8a38f,
-    0xe8a390,
-    0xe8a391,
-    0xe8a392,
-    0xe8a393,
-    0xe8a394,
-    0xe8a395,
-    0xe8a396,
-    0xe8a397,
-    0xe8a398,
-    0xe8a399,
-    0xe8a39a,
-    0xe8a39b,
-    0xe8a39c,
-    0xe8a39d,
-    0xe8a39e,
-    0xe8a39f,
-    0xe8a3a0,
-    0xe8a3a1,
-    0xe8a3a2,
-    0xe8a3a3,
-    0xe8a3a4,
-    0xe8a3a5,
-    0xe8a3a6,
-    0xe8a3a7,
-    0xe8a3a8,
-    0xe8a3a9,
-    0xe8a3aa,
-    0xe8a3ab,
-    0xe8a3ac,
-    0xe8a3ad,
-    0xe8a3ae,
-    0xe8a3af,
-    0xe8a3b0,
-    0xe8a3b1,
-    0xe8a3b2,
-    0xe8a3b3,
-    0xe8a3b4,
-    0xe8a3b5,
-    0xe8a3b6,
-    0xe8a3b7,
-    0xe8a3b8,
-    0xe8a3b9,
-    0xe8a3ba,
-    0xe8a3bb,
-    0xe8a3bc,
-    0xe8a3bd,
-    0xe8a3be,
-    0xe8a3bf,
-    0xe8a480,
-    0xe8a481,
-    0xe8a482,
-    0xe8a483,
-    0xe8a484,
-    0xe8a485,
-    0xe8a486,
-    0xe8a487,
-    0xe8a488,
-    0xe8a489,
-    0xe8a48a,
-    0xe8a48b,
-    0xe8a48c,
-    0xe8a48d,
-    0xe8a48e,
-    0xe8a48f,
-    0xe8a490,
-    0xe8a491,
-    0xe8a492,
-    0xe8a493,
-    0xe8a494,
-    0xe8a495,
-    0xe8a496,
-    0xe8a497,
-    0xe8a498,
-    0xe8a499,
-    0xe8a49a,
-    0xe8a49b,
-    0xe8a49c,
-    0xe8a49d,
-    0xe8a49e,
-    0xe8a49f,
-    0xe8a4a0,
-    0xe8a4a1,
-    0xe8a4a2,
-    0xe8a4a3,
-    0xe8a4a4,
-    0xe8a4a5,
-    0xe8a4a6,
-    0xe8a4a7,
-    0xe8a4a8,
-    0xe8a4a9,
-    0xe8a4aa,
-    0xe8a4ab,
-    0xe8a4ac,
-    0xe8a4ad,
-    0xe8a4ae,
-    0xe8a4af,
-    0xe8a4b0,
-    0xe8a4b1,
-    0xe8a4b2,
-    0xe8a4b3,
-    0xe8a4b4,
-    0xe8a4b5,
-    0xe8a4b6,
-    0xe8a4b7,
-    0xe8a4b8,
-    0xe8a4b9,
-    0xe8a4ba,
-    0xe8a4bb,
-    0xe8a4bc,
-    0xe8a4bd,
-    0xe8a4be,
-    0xe8a4bf,
-    0xe8a580,
-    0xe8a581,
-    0xe8a582,
-    0xe8a583,
-    0xe8a584,
-    0xe8a585,
-    0xe8a586,
-    0xe8a587,
-    0xe8a588,
-    0xe8a589,
-    0xe8a58a,
-    0xe8a58b,
-    0xe8a58c,
-    0xe8a58d,
-    0xe8a58e,
-    0xe8a58f,
-    0xe8a590,
-    0xe8a591,
-    0xe8a592,
-    0xe8a593,
-    0xe8a594,
-    0xe8a595,
-    0xe8a596,
-    0xe8a597,
-    0xe8a598,
-    0xe8a599,
-    0xe8a59a,
-    0xe8a59b,
-    0xe8a59c,
-    0xe8a59d,
-    0xe8a59e,
-    0xe8a59f,
-    0xe8a5a0,
-    0xe8a5a1,
-    0xe8a5a2,
-    0xe8a5a3,
-    0xe8a5a4,
-    0xe8a5a5,
-    0xe8a5a6,
-    0xe8a5a7,
-    0xe8a5a8,
-    0xe8a5a9,
-    0xe8a5aa,
-    0xe8a5ab,
-    0xe8a5ac,
-    0xe8a5ad,
-    0xe8a5ae,
-    0xe8a5af,
-    0xe8a5b0,
-    0xe8a5b1,
-    0xe8a5b2,
-    0xe8a5b3,
-    0xe8a5b4,
-    0xe8a5b5,
-    0xe8a5b6,
-    0xe8a5b7,
-    0xe8a5b8,
-    0xe8a5b9,
-    0xe8a5ba,
-    0xe8a5bb,
-    0xe8a5bc,
-    0xe8a5bd,
-    0xe8a5be,
-    0xe8a5bf,
-    0xe8a680,
-    0xe8a681,
-    0xe8a682,
-    0xe8a683,
-    0xe8a684,
-    0xe8a685,
-    0xe8a686,
-    0xe8a687,
-    0xe8a688,
-    0xe8a689,
-    0xe8a68a,
-    0xe8a68b,
-    0xe8a68c,
-    0xe8a68d,
-    0xe8a68e,
-    0xe8a68f,
-    0xe8a690,
-    0xe8a691,
-    0xe8a692,
-    0xe8a693,
-    0xe8a694,
-    0xe8a695,
-    0xe8a696,
-    0xe8a697,
-    0xe8a698,
-    0xe8a699,
-    0xe8a69a,
-    0xe8a69b,
-    0xe8a69c,
-    0xe8a69d,
-    0xe8a69e,
-    0xe8a69f,
-    0xe8a6a0,
-    0xe8a6a1,
-    0xe8a6a2,
-    0xe8a6a3,
-    0xe8a6a4,
-    0xe8a6a5,
-    0xe8a6a6,
-    0xe8a6a7,
-    0xe8a6a8,
-    0xe8a6a9,
-    0xe8a6aa,
-    0xe8a6ab,
-    0xe8a6ac,
-    0xe8a6ad,
-    0xe8a6ae,
-    0xe8a6af,
-    0xe8a6b0,
-    0xe8a6b1,
-    0xe8a6b2,
-    0xe8a6b3,
-    0xe8a6b4,
-    0xe8a6b5,
-    0xe8a6b6,
-    0xe8a6b7,
-    0xe8a6b8,
-    0xe8a6b9,
-    0xe8a6ba,
-    0xe8a6bb,
-    0xe8a6bc,
-    0xe8a6bd,
-    0xe8a6be,
-    0xe8a6bf,
-    0xe8a780,
-    0xe8a781,
-    0xe8a782,
-    0xe8a783,
-    0xe8a784,
-    0xe8a785,
-    0xe8a786,
-    0xe8a787,
-    0xe8a788,
-    0xe8a789,
-    0xe8a78a,
-    0xe8a78b,
-    0xe8a78c,
-    0xe8a78d,
-    0xe8a78e,
-    0xe8a78f,
-    0xe8a790,
-    0xe8a791,
-    0xe8a792,
-    0xe8a793,
-    0xe8a794,
-    0xe8a795,
-    0xe8a796,
-    0xe8a797,
-    0xe8a798,
-    0xe8a799,
-    0xe8a79a,
-    0xe8a79b,
-    0xe8a79c,
-    0xe8a79d,
-    0xe8a79e,
-    0xe8a79f,
-    0xe8a7a0,
-    0xe8a7a1,
-    0xe8a7a2,
-    0xe8a7a3,
-    0xe8a7a4,
-    0xe8a7a5,
-    0xe8a7a6,
-    0xe8a7a7,
-    0xe8a7a8,
-    0xe8a7a9,
-    0xe8a7aa,
-    0xe8a7ab,
-    0xe8a7ac,
-    0xe8a7ad,
-    0xe8a7ae,
-    0xe8a7af,
-    0xe8a7b0,
-    0xe8a7b1,
-    0xe8a7b2,
-    0xe8a7b3,
-    0xe8a7b4,
-    0xe8a7b5,
-    0xe8a7b6,
-    0xe8a7b7,
-    0xe8a7b8,
-    0xe8a7b9,
-    0xe8a7ba,
-    0xe8a7bb,
-    0xe8a7bc,
-    0xe8a7bd,
-    0xe8a7be,
-    0xe8a7bf,
-    0xe8a880,
-    0xe8a881,
-    0xe8a882,
-    0xe8a883,
-    0xe8a884,
-    0xe8a885,
-    0xe8a886,
-    0xe8a887,
-    0xe8a888,
-    0xe8a889,
-    0xe8a88a,
-    0xe8a88b,
-    0xe8a88c,
-    0xe8a88d,
-    0xe8a88e,
-    0xe8a88f,
-    0xe8a890,
-    0xe8a891,
-    0xe8a892,
-    0xe8a893,
-    0xe8a894,
-    0xe8a895,
-    0xe8a896,
-    0xe8a897,
-    0xe8a898,
-    0xe8a899,
-    0xe8a89a,
-    0xe8a89b,
-    0xe8a89c,
-    0xe8a89d,
-    0xe8a89e,
-    0xe8a89f,
-    0xe8a8a0,
-    0xe8a8a1,
-    0xe8a8a2,
-    0xe8a8a3,
-    0xe8a8a4,
-    0xe8a8a5,
-    0xe8a8a6,
-    0xe8a8a7,
-    0xe8a8a8,
-    0xe8a8a9,
-    0xe8a8aa,
-    0xe8a8ab,
-    0xe8a8ac,
-    0xe8a8ad,
-    0xe8a8ae,
-    0xe8a8af,
-    0xe8a8b0,
-    0xe8a8b1,
-    0xe8a8b2,
-    0xe8a8b3,
-    0xe8a8b4,
-    0xe8a8b5,
-    0xe8a8b6,
-    0xe8a8b7,
-    0xe8a8b8,
-    0xe8a8b9,
-    0xe8a8ba,
-    0xe8a8bb,
-    0xe8a8bc,
-    0xe8a8bd,
-    0xe8a8be,
-    0xe8a8bf,
-    0xe8a980,
-    0xe8a981,
-    0xe8a982,
-    0xe8a983,
-    0xe8a984,
-    0xe8a985,
-    0xe8a986,
-    0xe8a987,
-    0xe8a988,
-    0xe8a989,
-    0xe8a98a,
-    0xe8a98b,
-    0xe8a98c,
-    0xe8a98d,
-    0xe8a98e,
-    0xe8a98f,
-    0xe8a990,
-    0xe8a991,
-    0xe8a992,
-    0xe8a993,
-    0xe8a994,
-    0xe8a995,
-    0xe8a996,
-    0xe8a997,
-    0xe8a998,
-    0xe8a999,
-    0xe8a99a,
-    0xe8a99b,
-    0xe8a99c,
-    0xe8a99d,
-    0xe8a99e,
-    0xe8a99f,
-    0xe8a9a0,
-    0xe8a9a1,
-    0xe8a9a2,
-    0xe8a9a3,
-    0xe8a9a4,
-    0xe8a9a5,
-    0xe8a9a6,
-    0xe8a9a7,
-    0xe8a9a8,
-    0xe8a9a9,
-    0xe8a9aa,
-    0xe8a9ab,
-    0xe8a9ac,
-    0xe8a9ad,
-    0xe8a9ae,
-    0xe8a9af,
-    0xe8a9b0,
-    0xe8a9b1,
-    0xe8a9b2,
-    0xe8a9b3,
-    0xe8a9b4,
-    0xe8a9b5,
-    0xe8a9b6,
-    0xe8a9b7,
-    0xe8a9b8,
-    0xe8a9b9,
-    0xe8a9ba,
-    0xe8a9bb,
-    0xe8a9bc,
-    0xe8a9bd,
-    0xe8a9be,
-    0xe8a9bf,
-    0xe8aa80,
-    0xe8aa81,
-    0xe8aa82,
-    0xe8aa83,
-    0xe8aa84,
-    0xe8aa85,
-    0xe8aa86,
-    0xe8aa87,
-    0xe8aa88,
-    0xe8aa89,
-    0xe8aa8a,
-    0xe8aa8b,
-    0xe8aa8c,
-    0xe8aa8d,
-    0xe8aa8e,
-    0xe8aa8f,
-    0xe8aa90,
-    0xe8aa91,
-    0xe8aa92,
-    0xe8aa93,
-    0xe8aa94,
-    0xe8aa95,
-    0xe8aa96,
-    0xe8aa97,
-    0xe8aa98,
-    0xe8aa99,
-    0xe8aa9a,
-    0xe8aa9b,
-    0xe8aa9c,
-    0xe8aa9d,
-    0xe8aa9e,
-    0xe8aa9f,
-    0xe8aaa0,
-    0xe8aaa1,
-    0xe8aaa2,
-    0xe8aaa3,
-    0xe8aaa4,
-    0xe8aaa5,
-    0xe8aaa6,
-    0xe8aaa7,
-    0xe8aaa8,
-    0xe8aaa9,
-    0xe8aaaa,
-    0xe8aaab,
-    0xe8aaac,
-    0xe8aaad,
-    0xe8aaae,
-    0xe8aaaf,
-    0xe8aab0,
-    0xe8aab1,
-    0xe8aab2,
-    0xe8aab3,
-    0xe8aab4,
-    0xe8aab5,
-    0xe8aab6,
-    0xe8aab7,
-    0xe8aab8,
-    0xe8aab9,
-    0xe8aaba,
-    0xe8aabb,
-    0xe8aabc,
-    0xe8aabd,
-    0xe8aabe,
-    0xe8aabf,
-    0xe8ab80,
-    0xe8ab81,
-    0xe8ab82,
-    0xe8ab83,
-    0xe8ab84,
-    0xe8ab85,
-    0xe8ab86,
-    0xe8ab87,
-    0xe8ab88,
-    0xe8ab89,
-    0xe8ab8a,
-    0xe8ab8b,
-    0xe8ab8c,
-    0xe8ab8d,
-    0xe8ab8e,
-    0xe8ab8f,
-    0xe8ab90,
-    0xe8ab91,
-    0xe8ab92,
-    0xe8ab93,
-    0xe8ab94,
-    0xe8ab95,
-    0xe8ab96,
-    0xe8ab97,
-    0xe8ab98,
-    0xe8ab99,
-    0xe8ab9a,
-    0xe8ab9b,
-    0xe8ab9c,
-    0xe8ab9d,
-    0xe8ab9e,
-    0xe8ab9f,
-    0xe8aba0,
-    0xe8aba1,
-    0xe8aba2,
-    0xe8aba3,
-    0xe8aba4,
-    0xe8aba5,
-    0xe8aba6,
-    0xe8aba7,
-    0xe8aba8,
-    0xe8aba9,
-    0xe8abaa,
-    0xe8abab,
-    0xe8abac,
-    0xe8abad,
-    0xe8abae,
-    0xe8abaf,
-    0xe8abb0,
-    0xe8abb1,
-    0xe8abb2,
-    0xe8abb3,
-    0xe8abb4,
-    0xe8abb5,
-    0xe8abb6,
-    0xe8abb7,
-    0xe8abb8,
-    0xe8abb9,
-    0xe8abba,
-    0xe8abbb,
-    0xe8abbc,
-    0xe8abbd,
-    0xe8abbe,
-    0xe8abbf,
-    0xe8ac80,
-    0xe8ac81,
-    0xe8ac82,
-    0xe8ac83,
-    0xe8ac84,
-    0xe8ac85,
-    0xe8ac86,
-    0xe8ac87,
-    0xe8ac88,
-    0xe8ac89,
-    0xe8ac8a,
-    0xe8ac8b,
-    0xe8ac8c,
-    0xe8ac8d,
-    0xe8ac8e,
-    0xe8ac8f,
-    0xe8ac90,
-    0xe8ac91,
-    0xe8ac92,
-    0xe8ac93,
-    0xe8ac94,
-    0xe8ac95,
-    0xe8ac96,
-    0xe8ac97,
-    0xe8ac98,
-    0xe8ac99,
-    0xe8ac9a,
-    0xe8ac9b,
-    0xe8ac9c,
-    0xe8ac9d,
-    0xe8ac9e,
-    0xe8ac9f,
-    0xe8aca0,
-    0xe8aca1,
-    0xe8aca2,
-    0xe8aca3,
-    0xe8aca4,
-    0xe8aca5,
-    0xe8aca6,
-    0xe8aca7,
-    0xe8aca8,
-    0xe8aca9,
-    0xe8acaa,
-    0xe8acab,
-    0xe8acac,
-    0xe8acad,
-    0xe8acae,
-    0xe8acaf,
-    0xe8acb0,
-    0xe8acb1,
-    0xe8acb2,
-    0xe8acb3,
-    0xe8acb4,
-    0xe8acb5,
-    0xe8acb6,
-    0xe8acb7,
-    0xe8acb8,
-    0xe8acb9,
-    0xe8acba,
-    0xe8acbb,
-    0xe8acbc,
-    0xe8acbd,
-    0xe8acbe,
-    0xe8acbf,
-    0xe8ad80,
-    0xe8ad81,
-    0xe8ad82,
-    0xe8ad83,
-    0xe8ad84,
-    0xe8ad85,
-    0xe8ad86,
-    0xe8ad87,
-    0xe8ad88,
-    0xe8ad89,
-    0xe8ad8a,
-    0xe8ad8b,
-    0xe8ad8c,
-    0xe8ad8d,
-    0xe8ad8e,
-    0xe8ad8f,
-    0xe8ad90,
-    0xe8ad91,
-    0xe8ad92,
-    0xe8ad93,
-    0xe8ad94,
-    0xe8ad95,
-    0xe8ad96,
-    0xe8ad97,
-    0xe8ad98,
-    0xe8ad99,
-    0xe8ad9a,
-    0xe8ad9b,
-    0xe8ad9c,
-    0xe8ad9d,
-    0xe8ad9e,
-    0xe8ad9f,
-    0xe8ada0,
-    0xe8ada1,
-    0xe8ada2,
-    0xe8ada3,
-    0xe8ada4,
-    0xe8ada5,
-    0xe8ada6,
-    0xe8ada7,
-    0xe8ada8,
-    0xe8ada9,
-    0xe8adaa,
-    0xe8adab,
-    0xe8adac,
-    0xe8adad,
-    0xe8adae,
-    0xe8adaf,
-    0xe8adb0,
-    0xe8adb1,
-    0xe8adb2,
-    0xe8adb3,
-    0xe8adb4,
-    0xe8adb5,
-    0xe8adb6,
-    0xe8adb7,
-    0xe8adb8,
-    0xe8adb9,
-    0xe8adba,
-    0xe8adbb,
-    0xe8adbc,
-    0xe8adbd,
-    0xe8adbe,
-    0xe8adbf,
-    0xe8ae80,
-    0xe8ae81,
-    0xe8ae82,
-    0xe8ae83,
-    0xe8ae84,
-    0xe8ae85,
-    0xe8ae86,
-    0xe8ae87,
-    0xe8ae88,
-    0xe8ae89,
-    0xe8ae8a,
-    0xe8ae8b,
-    0xe8ae8c,
-    0xe8ae8d,
-    0xe8ae8e,
-    0xe8ae8f,
-    0xe8ae90,
-    0xe8ae91,
-    0xe8ae92,
-    0xe8ae93,
-    0xe8ae94,
-    0xe8ae95,
-    0xe8ae96,
-    0xe8ae97,
-    0xe8ae98,
-    0xe8ae99,
-    0xe8ae9a,
-    0xe8ae9b,
-    0xe8ae9c,
-    0xe8ae9d,
-    0xe8ae9e,
-    0xe8ae9f,
-    0xe8aea0,
-    0xe8aea1,
-    0xe8aea2,
-    0xe8aea3,
-    0xe8aea4,
-    0xe8aea5,
-    0xe8aea6,
-    0xe8aea7,
-    0xe8aea8,
-    0xe8aea9,
-    0xe8aeaa,
-    0xe8aeab,
-    0xe8aeac,
-    0xe8aead,
-    0xe8aeae,
-    0xe8aeaf,
-    0xe8aeb0,
-    0xe8aeb1,
-    0xe8aeb2,
-    0xe8aeb3,
-    0xe8aeb4,
-    0xe8aeb5,
-    0xe8aeb6,
-    0xe8aeb7,
-    0xe8aeb8,
-    0xe8aeb9,
-    0xe8aeba,
-    0xe8aebb,
-    0xe8aebc,
-    0xe8aebd,
-    0xe8aebe,
-    0xe8aebf,
-    0xe8af80,
-    0xe8af81,
-    0xe8af82,
-    0xe8af83,
-    0xe8af84,
-    0xe8af85,
-    0xe8af86,
-    0xe8af87,
-    0xe8af88,
-    0xe8af89,
-    0xe8af8a,
-    0xe8af8b,
-    0xe8af8c,
-    0xe8af8d,
-    0xe8af8e,
-    0xe8af8f,
-    0xe8af90,
-    0xe8af91,
-    0xe8af92,
-    0xe8af93,
-    0xe8af94,
-    0xe8af95,
-    0xe8af96,
-    0xe8af97,
-    0xe8af98,
-    0xe8af99,
-    0xe8af9a,
-    0xe8af9b,
-    0xe8af9c,
-    0xe8af9d,
-    0xe8af9e,
-    0xe8af9f,
-    0xe8afa0,
-    0xe8afa1,
-    0xe8afa2,
-    0xe8afa3,
-    0xe8afa4,
-    0xe8afa5,
-    0xe8afa6,
-    0xe8afa7,
-    0xe8afa8,
-    0xe8afa9,
-    0xe8afaa,
-    0xe8afab,
-    0xe8afac,
-    0xe8afad,
-    0xe8afae,
-    0xe8afaf,
-    0xe8afb0,
-    0xe8afb1,
-    0xe8afb2,
-    0xe8afb3,
-    0xe8afb4,
-    0xe8afb5,
-    0xe8afb6,
-    0xe8afb7,
-    0xe8afb8,
-    0xe8afb9,
-    0xe8afba,
-    0xe8afbb,
-    0xe8afbc,
-    0xe8afbd,
-    0xe8afbe,
-    0xe8afbf,
-    0xe8b080,
-    0xe8b081,
-    0xe8b082,
-    0xe8b083,
-    0xe8b084,
-    0xe8b085,
-    0xe8b086,
-    0xe8b087,
-    0xe8b088,
-    0xe8b089,
-    0xe8b08a,
-    0xe8b08b,
-    0xe8b08c,
-    0xe8b08d,
-    0xe8b08e,
-    0xe8b08f,
-    0xe8b090,
-    0xe8b091,
-    0xe8b092,
-    0xe8b093,
-    0xe8b094,
-    0xe8b095,
-    0xe8b096,
-    0xe8b097,
-    0xe8b098,
-    0xe8b099,
-    0xe8b09a,
-    0xe8b09b,
-    0xe8b09c,
-    0xe8b09d,
-    0xe8b09e,
-    0xe8b09f,
-    0xe8b0a0,
-    0xe8b0a1,
-    0xe8b0a2,
-    0xe8b0a3,
-    0xe8b0a4,
-    0xe8b0a5,
-    0xe8b0a6,
-    0xe8b0a7,
-    0xe8b0a8,
-    0xe8b0a9,
-    0xe8b0aa,
-    0xe8b0ab,
-    0xe8b0ac,
-    0xe8b0ad,
-    0xe8b0ae,
-    0xe8b0af,
-    0xe8b0b0,
-    0xe8b0b1,
-    0xe8b0b2,
-    0xe8b0b3,
-    0xe8b0b4,
-    0xe8b0b5,
-    0xe8b0b6,
-    0xe8b0b7,
-    0xe8b0b8,
-    0xe8b0b9,
-    0xe8b0ba,
-    0xe8b0bb,
-    0xe8b0bc,
-    0xe8b0bd,
-    0xe8b0be,
-    0xe8b0bf,
-    0xe8b180,
-    0xe8b181,
-    0xe8b182,
-    0xe8b183,
-    0xe8b184,
-    0xe8b185,
-    0xe8b186,
-    0xe8b187,
-    0xe8b188,
-    0xe8b189,
-    0xe8b18a,
-    0xe8b18b,
-    0xe8b18c,
-    0xe8b18d,
-    0xe8b18e,
-    0xe8b18f,
-    0xe8b190,
-    0xe8b191,
-    0xe8b192,
-    0xe8b193,
-    0xe8b194,
-    0xe8b195,
-    0xe8b196,
-    0xe8b197,
-    0xe8b198,
-    0xe8b199,
-    0xe8b19a,
-    0xe8b19b,
-    0xe8b19c,
-    0xe8b19d,
-    0xe8b19e,
-    0xe8b19f,
-    0xe8b1a0,
-    0xe8b1a1,
-    0xe8b1a2,
-    0xe8b1a3,
-    0xe8b1a4,
-    0xe8b1a5,
-    0xe8b1a6,
-    0xe8b1a7,
-    0xe8b1a8,
-    0xe8b1a9,
-    0xe8b1aa,
-    0xe8b1ab,
-    0xe8b1ac,
-    0xe8b1ad,
-    0xe8b1ae,
-    0xe8b1af,
-    0xe8b1b0,
-    0xe8b1b1,
-    0xe8b1b2,
-    0xe8b1b3,
-    0xe8b1b4,
-    0xe8b1b5,
-    0xe8b1b6,
-    0xe8b1b7,
-    0xe8b1b8,
-    0xe8b1b9,
-    0xe8b1ba,
-    0xe8b1bb,
-    0xe8b1bc,
-    0xe8b1bd,
-    0xe8b1be,
-    0xe8b1bf,
-    0xe8b280,
-    0xe8b281,
-    0xe8b282,
-    0xe8b283,
-    0xe8b284,
-    0xe8b285,
-    0xe8b286,
-    0xe8b287,
-    0xe8b288,
-    0xe8b289,
-    0xe8b28a,
-    0xe8b28b,
-    0xe8b28c,
-    0xe8b28d,
-    0xe8b28e,
-    0xe8b28f,
-    0xe8b290,
-    0xe8b291,
-    0xe8b292,
-    0xe8b293,
-    0xe8b294,
-    0xe8b295,
-    0xe8b296,
-    0xe8b297,
-    0xe8b298,
-    0xe8b299,
-    0xe8b29a,
-    0xe8b29b,
-    0xe8b29c,
-    0xe8b29d,
-    0xe8b29e,
-    0xe8b29f,
-    0xe8b2a0,
-    0xe8b2a1,
-    0xe8b2a2,
-    0xe8b2a3,
-    0xe8b2a4,
-    0xe8b2a5,
-    0xe8b2a6,
-    0xe8b2a7,
-    0xe8b2a8,
-    0xe8b2a9,
-    0xe8b2aa,
-    0xe8b2ab,
-    0xe8b2ac,
-    0xe8b2ad,
-    0xe8b2ae,
-    0xe8b2af,
-    0xe8b2b0,
-    0xe8b2b1,
-    0xe8b2b2,
-    0xe8b2b3,
-    0xe8b2b4,
-    0xe8b2b5,
-    0xe8b2b6,
-    0xe8b2b7,
-    0xe8b2b8,
-    0xe8b2b9,
-    0xe8b2ba,
-    0xe8b2bb,
-    0xe8b2bc,
-    0xe8b2bd,
-    0xe8b2be,
-    0xe8b2bf,
-    0xe8b380,
-    0xe8b381,
-    0xe8b382,
-    0xe8b383,
-    0xe8b384,
-    0xe8b385,
-    0xe8b386,
-    0xe8b387,
-    0xe8b388,
-    0xe8b389,
-    0xe8b38a,
-    0xe8b38b,
-    0xe8b38c,
-    0xe8b38d,
-    0xe8b38e,
-    0xe8b38f,
-    0xe8b390,
-    0xe8b391,
-    0xe8b392,
-    0xe8b393,
-    0xe8b394,
-    0xe8b395,
-    0xe8b396,
-    0xe8b397,
-    0xe8b398,
-    0xe8b399,
-    0xe8b39a,
-    0xe8b39b,
-    0xe8b39c,
-    0xe8b39d,
-    0xe8b39e,
-    0xe8b39f,
-    0xe8b3a0,
-    0xe8b3a1,
-    0xe8b3a2,
-    0xe8b3a3,
-    0xe8b3a4,
-    0xe8b3a5,
-    0xe8b3a6,
-    0xe8b3a7,
-    0xe8b3a8,
-    0xe8b3a9,
-    0xe8b3aa,
-    0xe8b3ab,
-    0xe8b3ac,
-    0xe8b3ad,
-    0xe8b3ae,
-    0xe8b3af,
-    0xe8b3b0,
-    0xe8b3b1,
-    0xe8b3b2,
-    0xe8b3b3,
-    0xe8b3b4,
-    0xe8b3b5,
-    0xe8b3b6,
-    0xe8b3b7,
-    0xe8b3b8,
-    0xe8b3b9,
-    0xe8b3ba,
-    0xe8b3bb,
-    0xe8b3bc,
-    0xe8b3bd,
-    0xe8b3be,
-    0xe8b3bf,
-    0xe8b480,
-    0xe8b481,
-    0xe8b482,
-    0xe8b483,
-    0xe8b484,
-    0xe8b485,
-    0xe8b486,
-    0xe8b487,
-    0xe8b488,
-    0xe8b489,
-    0xe8b48a,
-    0xe8b48b,
-    0xe8b48c,
-    0xe8b48d,
-    0xe8b48e,
-    0xe8b48f,
-    0xe8b490,
-    0xe8b491,
-    0xe8b492,
-    0xe8b493,
-    0xe8b494,
-    0xe8b495,
-    0xe8b496,
-    0xe8b497,
-    0xe8b498,
-    0xe8b499,
-    0xe8b49a,
-    0xe8b49b,
-    0xe8b49c,
-    0xe8b49d,
-    0xe8b49e,
-    0xe8b49f,
-    0xe8b4a0,
-    0xe8b4a1,
-    0xe8b4a2,
-    0xe8b4a3,
-    0xe8b4a4,
-    0xe8b4a5,
-    0xe8b4a6,
-    0xe8b4a7,
-    0xe8b4a8,
-    0xe8b4a9,
-    0xe8b4aa,
-    0xe8b4ab,
-    0xe8b4ac,
-    0xe8b4ad,
-    0xe8b4ae,
-    0xe8b4af,
-    0xe8b4b0,
-    0xe8b4b1,
-    0xe8b4b2,
-    0xe8b4b3,
-    0xe8b4b4,
-    0xe8b4b5,
-    0xe8b4b6,
-    0xe8b4b7,
-    0xe8b4b8,
-    0xe8b4b9,
-    0xe8b4ba,
-    0xe8b4bb,
-    0xe8b4bc,
-    0xe8b4bd,
-    0xe8b4be,
-    0xe8b4bf,
-    0xe8b580,
-    0xe8b581,
-    0xe8b582,
-    0xe8b583,
-    0xe8b584,
-    0xe8b585,
-    0xe8b586,
-    0xe8b587,
-    0xe8b588,
-    0xe8b589,
-    0xe8b58a,
-    0xe8b58b,
-    0xe8b58c,
-    0xe8b58d,
-    0xe8b58e,
-    0xe8b58f,
-    0xe8b590,
-    0xe8b591,
-    0xe8b592,
-    0xe8b593,
-    0xe8b594,
-    0xe8b595,
-    0xe8b596,
-    0xe8b597,
-    0xe8b598,
-    0xe8b599,
-    0xe8b59a,
-    0xe8b59b,
-    0xe8b59c,
-    0xe8b59d,
-    0xe8b59e,
-    0xe8b59f,
-    0xe8b5a0,
-    0xe8b5a1,
-    0xe8b5a2,
-    0xe8b5a3,
-    0xe8b5a4,
-    0xe8b5a5,
-    0xe8b5a6,
-    0xe8b5a7,
-    0xe8b5a8,
-    0xe8b5a9,
-    0xe8b5aa,
-    0xe8b5ab,
-    0xe8b5ac,
-    0xe8b5ad,
-    0xe8b5ae,
-    0xe8b5af,
-    0xe8b5b0,
-    0xe8b5b1,
-    0xe8b5b2,
-    0xe8b5b3,
-    0xe8b5b4,
-    0xe8b5b5,
-    0xe8b5b6,
-    0xe8b5b7,
-    0xe8b5b8,
-    0xe8b5b9,
-    0xe8b5ba,
-    0xe8b5bb,
-    0xe8b5bc,
-    0xe8b5bd,
-    0xe8b5be,
-    0xe8b5bf,
-    0xe8b680,
-    0xe8b681,
-    0xe8b682,
-    0xe8b683,
-    0xe8b684,
-    0xe8b685,
-    0xe8b686,
-    0xe8b687,
-    0xe8b688,
-    0xe8b689,
-    0xe8b68a,
-    0xe8b68b,
-    0xe8b68c,
-    0xe8b68d,
-    0xe8b68e,
-    0xe8b68f,
-    0xe8b690,
-    0xe8b691,
-    0xe8b692,
-    0xe8b693,
-    0xe8b694,
-    0xe8b695,
-    0xe8b696,
-    0xe8b697,
-    0xe8b698,
-    0xe8b699,
-    0xe8b69a,
-    0xe8b69b,
-    0xe8b69c,
-    0xe8b69d,
-    0xe8b69e,
-    0xe8b69f,
-    0xe8b6a0,
-    0xe8b6a1,
-    0xe8b6a2,
-    0xe8b6a3,
-    0xe8b6a4,
-    0xe8b6a5,
-    0xe8b6a6,
-    0xe8b6a7,
-    0xe8b6a8,
-    0xe8b6a9,
-    0xe8b6aa,
-    0xe8b6ab,
-    0xe8b6ac,
-    0xe8b6ad,
-    0xe8b6ae,
-    0xe8b6af,
-    0xe8b6b0,
-    0xe8b6b1,
-    0xe8b6b2,
-    0xe8b6b3,
-    0xe8b6b4,
-    0xe8b6b5,
-    0xe8b6b6,
-    0xe8b6b7,
-    0xe8b6b8,
-    0xe8b6b9,
-    0xe8b6ba,
-    0xe8b6bb,
-    0xe8b6bc,
-    0xe8b6bd,
-    0xe8b6be,
-    0xe8b6bf,
-    0xe8b780,
-    0xe8b781,
-    0xe8b782,
-    0xe8b783,
-    0xe8b784,
-    0xe8b785,
-    0xe8b786,
-    0xe8b787,
-    0xe8b788,
-    0xe8b789,
-    0xe8b78a,
-    0xe8b78b,
-    0xe8b78c,
-    0xe8b78d,
-    0xe8b78e,
-    0xe8b78f,
-    0xe8b790,
-    0xe8b791,
-    0xe8b792,
-    0xe8b793,
-    0xe8b794,
-    0xe8b795,
-    0xe8b796,
-    0xe8b797,
-    0xe8b798,
-    0xe8b799,
-    0xe8b79a,
-    0xe8b79b,
-    0xe8b79c,
-    0xe8b79d,
-    0xe8b79e,
-    0xe8b79f,
-    0xe8b7a0,
-    0xe8b7a1,
-    0xe8b7a2,
-    0xe8b7a3,
-    0xe8b7a4,
-    0xe8b7a5,
-    0xe8b7a6,
-    0xe8b7a7,
-    0xe8b7a8,
-    0xe8b7a9,
-    0xe8b7aa,
-    0xe8b7ab,
-    0xe8b7ac,
-    0xe8b7ad,
-    0xe8b7ae,
-    0xe8b7af,
-    0xe8b7b0,
-    0xe8b7b1,
-    0xe8b7b2,
-    0xe8b7b3,
-    0xe8b7b4,
-    0xe8b7b5,
-    0xe8b7b6,
-    0xe8b7b7,
-    0xe8b7b8,
-    0xe8b7b9,
-    0xe8b7ba,
-    0xe8b7bb,
-    0xe8b7bc,
-    0xe8b7bd,
-    0xe8b7be,
-    0xe8b7bf,
-    0xe8b880,
-    0xe8b881,
-    0xe8b882,
-    0xe8b883,
-    0xe8b884,
-    0xe8b885,
-    0xe8b886,
-    0xe8b887,
-    0xe8b888,
-    0xe8b889,
-    0xe8b88a,
-    0xe8b88b,
-    0xe8b88c,
-    0xe8b88d,
-    0xe8b88e,
-    0xe8b88f,
-    0xe8b890,
-    0xe8b891,
-    0xe8b892,
-    0xe8b893,
-    0xe8b894,
-    0xe8b895,
-    0xe8b896,
-    0xe8b897,
-    0xe8b898,
-    0xe8b899,
-    0xe8b89a,
-    0xe8b89b,
-    0xe8b89c,
-    0xe8b89d,
-    0xe8b89e,
-    0xe8b89f,
-    0xe8b8a0,
-    0xe8b8a1,
-    0xe8b8a2,
-    0xe8b8a3,
-    0xe8b8a4,
-    0xe8b8a5,
-    0xe8b8a6,
-    0xe8b8a7,
-    0xe8b8a8,
-    0xe8b8a9,
-    0xe8b8aa,
-    0xe8b8ab,
-    0xe8b8ac,
-    0xe8b8ad,
-    0xe8b8ae,
-    0xe8b8af,
-    0xe8b8b0,
-    0xe8b8b1,
-    0xe8b8b2,
-    0xe8b8b3,
-    0xe8b8b4,
-    0xe8b8b5,
-    0xe8b8b6,
-    0xe8b8b7,
-    0xe8b8b8,
-    0xe8b8b9,
-    0xe8b8ba,
-    0xe8b8bb,
-    0xe8b8bc,
-    0xe8b8bd,
-    0xe8b8be,
-    0xe8b8bf,
-    0xe8b980,
-    0xe8b981,
-    0xe8b982,
-    0xe8b983,
-    0xe8b984,
-    0xe8b985,
-    0xe8b986,
-    0xe8b987,
-    0xe8b988,
-    0xe8b989,
-    0xe8b98a,
-    0xe8b98b,
-    0xe8b98c,
-    0xe8b98d,
-    0xe8b98e,
-    0xe8b98f,
-    0xe8b990,
-    0xe8b991,
-    0xe8b992,
-    0xe8b993,
-    0xe8b994,
-    0xe8b995,
-    0xe8b996,
-    0xe8b997,
-    0xe8b998,
-    0xe8b999,
-    0xe8b99a,
-    0xe8b99b,
-    0xe8b99c,
-    0xe8b99d,
-    0xe8b99e,
-    0xe8b99f,
-    0xe8b9a0,
-    0xe8b9a1,
-    0xe8b9a2,
-    0xe8b9a3,
-    0xe8b9a4,
-    0xe8b9a5,
-    0xe8b9a6,
-    0xe8b9a7,
-    0xe8b9a8,
-    0xe8b9a9,
-    0xe8b9aa,
-    0xe8b9ab,
-    0xe8b9ac,
-    0xe8b9ad,
-    0xe8b9ae,
-    0xe8b9af,
-    0xe8b9b0,
-    0xe8b9b1,
-    0xe8b9b2,
-    0xe8b9b3,
-    0xe8b9b4,
-    0xe8b9b5,
-    0xe8b9b6,
-    0xe8b9b7,
-    0xe8b9b8,
-    0xe8b9b9,
-    0xe8b9ba,
-    0xe8b9bb,
-    0xe8b9bc,
-    0xe8b9bd,
-    0xe8b9be,
-    0xe8b9bf,
-    0xe8ba80,
-    0xe8ba81,
-    0xe8ba82,
-    0xe8ba83,
-    0xe8ba84,
-    0xe8ba85,
-    0xe8ba86,
-    0xe8ba87,
-    0xe8ba88,
-    0xe8ba89,
-    0xe8ba8a,
-    0xe8ba8b,
-    0xe8ba8c,
-    0xe8ba8d,
-    0xe8ba8e,
-    0xe8ba8f,
-    0xe8ba90,
-    0xe8ba91,
-    0xe8ba92,
-    0xe8ba93,
-    0xe8ba94,
-    0xe8ba95,
-    0xe8ba96,
-    0xe8ba97,
-    0xe8ba98,
-    0xe8ba99,
-    0xe8ba9a,
-    0xe8ba9b,
-    0xe8ba9c,
-    0xe8ba9d,
-    0xe8ba9e,
-    0xe8ba9f,
-    0xe8baa0,
-    0xe8baa1,
-    0xe8baa2,
-    0xe8baa3,
-    0xe8baa4,
-    0xe8baa5,
-    0xe8baa6,
-    0xe8baa7,
-    0xe8baa8,
-    0xe8baa9,
-    0xe8baaa,
-    0xe8baab,
-    0xe8baac,
-    0xe8baad,
-    0xe8baae,
-    0xe8baaf,
-    0xe8bab0,
-    0xe8bab1,
-    0xe8bab2,
-    0xe8bab3,
-    0xe8bab4,
-    0xe8bab5,
-    0xe8bab6,
-    0xe8bab7,
-    0xe8bab8,
-    0xe8bab9,
-    0xe8baba,
-    0xe8babb,
-    0xe8babc,
-    0xe8babd,
-    0xe8babe,
-    0xe8babf,
-    0xe8bb80,
-    0xe8bb81,
-    0xe8bb82,
-    0xe8bb83,
-    0xe8bb84,
-    0xe8bb85,
-    0xe8bb86,
-    0xe8bb87,
-    0xe8bb88,
-    0xe8bb89,
-    0xe8bb8a,
-    0xe8bb8b,
-    0xe8bb8c,
-    0xe8bb8d,
-    0xe8bb8e,
-    0xe8bb8f,
-    0xe8bb90,
-    0xe8bb91,
-    0xe8bb92,
-    0xe8bb93,
-    0xe8bb94,
-    0xe8bb95,
-    0xe8bb96,
-    0xe8bb97,
-    0xe8bb98,
-    0xe8bb99,
-    0xe8bb9a,
-    0xe8bb9b,
-    0xe8bb9c,
-    0xe8bb9d,
-    0xe8bb9e,
-    0xe8bb9f,
-    0xe8bba0,
-    0xe8bba1,
-    0xe8bba2,
-    0xe8bba3,
-    0xe8bba4,
-    0xe8bba5,
-    0xe8bba6,
-    0xe8bba7,
-    0xe8bba8,
-    0xe8bba9,
-    0xe8bbaa,
-    0xe8bbab,
-    0xe8bbac,
-    0xe8bbad,
-    0xe8bbae,
-    0xe8bbaf,
-    0xe8bbb0,
-    0xe8bbb1,
-    0xe8bbb2,
-    0xe8bbb3,
-    0xe8bbb4,
-    0xe8bbb5,
-    0xe8bbb6,
-    0xe8bbb7,
-    0xe8bbb8,
-    0xe8bbb9,
-    0xe8bbba,
-    0xe8bbbb,
-    0xe8bbbc,
-    0xe8bbbd,
-    0xe8bbbe,
-    0xe8bbbf,
-    0xe8bc80,
-    0xe8bc81,
-    0xe8bc82,
-    0xe8bc83,
-    0xe8bc84,
-    0xe8bc85,
-    0xe8bc86,
-    0xe8bc87,
-    0xe8bc88,
-    0xe8bc89,
-    0xe8bc8a,
-    0xe8bc8b,
-    0xe8bc8c,
-    0xe8bc8d,
-    0xe8bc8e,
-    0xe8bc8f,
-    0xe8bc90,
-    0xe8bc91,
-    0xe8bc92,
-    0xe8bc93,
-    0xe8bc94,
-    0xe8bc95,
-    0xe8bc96,
-    0xe8bc97,
-    0xe8bc98,
-    0xe8bc99,
-    0xe8bc9a,
-    0xe8bc9b,
-    0xe8bc9c,
-    0xe8bc9d,
-    0xe8bc9e,
-    0xe8bc9f,
-    0xe8bca0,
-    0xe8bca1,
-    0xe8bca2,
-    0xe8bca3,
-    0xe8bca4,
-    0xe8bca5,
-    0xe8bca6,
-    0xe8bca7,
-    0xe8bca8,
-    0xe8bca9,
-    0xe8bcaa,
-    0xe8bcab,
-    0xe8bcac,
-    0xe8bcad,
-    0xe8bcae,
-    0xe8bcaf,
-    0xe8bcb0,
-    0xe8bcb1,
-    0xe8bcb2,
-    0xe8bcb3,
-    0xe8bcb4,
-    0xe8bcb5,
-    0xe8bcb6,
-    0xe8bcb7,
-    0xe8bcb8,
-    0xe8bcb9,
-    0xe8bcba,
-    0xe8bcbb,
-    0xe8bcbc,
-    0xe8bcbd,
-    0xe8bcbe,
-    0xe8bcbf,
-    0xe8bd80,
-    0xe8bd81,
-    0xe8bd82,
-    0xe8bd83,
-    0xe8bd84,
-    0xe8bd85,
-    0xe8bd86,
-    0xe8bd87,
-    0xe8bd88,
-    0xe8bd89,
-    0xe8bd8a,
-    0xe8bd8b,
-    0xe8bd8c,
-    0xe8bd8d,
-    0xe8bd8e,
-    0xe8bd8f,
-    0xe8bd90,
-    0xe8bd91,
-    0xe8bd92,
-    0xe8bd93,
-    0xe8bd94,
-    0xe8bd95,
-    0xe8bd96,
-    0xe8bd97,
-    0xe8bd98,
-    0xe8bd99,
-    0xe8bd9a,
-    0xe8bd9b,
-    0xe8bd9c,
-    0xe8bd9d,
-    0xe8bd9e,
-    0xe8bd9f,
-    0xe8bda0,
-    0xe8bda1,
-    0xe8bda2,
-    0xe8bda3,
-    0xe8bda4,
-    0xe8bda5,
-    0xe8bda6,
-    0xe8bda7,
-    0xe8bda8,
-    0xe8bda9,
-    0xe8bdaa,
-    0xe8bdab,
-    0xe8bdac,
-    0xe8bdad,
-    0xe8bdae,
-    0xe8bdaf,
-    0xe8bdb0,
-    0xe8bdb1,
-    0xe8bdb2,
-    0xe8bdb3,
-    0xe8bdb4,
-    0xe8bdb5,
-    0xe8bdb6,
-    0xe8bdb7,
-    0xe8bdb8,
-    0xe8bdb9,
-    0xe8bdba,
-    0xe8bdbb,
-    0xe8bdbc,
-    0xe8bdbd,
-    0xe8bdbe,
-    0xe8bdbf,
-    0xe8be80,
-    0xe8be81,
-    0xe8be82,
-    0xe8be83,
-    0xe8be84,
-    0xe8be85,
-    0xe8be86,
-    0xe8be87,
-    0xe8be88,
-    0xe8be89,
-    0xe8be8a,
-    0xe8be8b,
-    0xe8be8c,
-    0xe8be8d,
-    0xe8be8e,
-    0xe8be8f,
-    0xe8be90,
-    0xe8be91,
-    0xe8be92,
-    0xe8be93,
-    0xe8be94,
-    0xe8be95,
-    0xe8be96,
-    0xe8be97,
-    0xe8be98,
-    0xe8be99,
-    0xe8be9a,
-    0xe8be9b,
-    0xe8be9c,
-    0xe8be9d,
-    0xe8be9e,
-    0xe8be9f,
-    0xe8bea0,
-    0xe8bea1,
-    0xe8bea2,
-    0xe8bea3,
-    0xe8bea4,
-    0xe8bea5,
-    0xe8bea6,
-    0xe8bea7,
-    0xe8bea8,
-    0xe8bea9,
-    0xe8beaa,
-    0xe8beab,
-    0xe8beac,
-    0xe8bead,
-    0xe8beae,
-    0xe8beaf,
-    0xe8beb0,
-    0xe8beb1,
-    0xe8beb2,
-    0xe8beb3,
-    0xe8beb4,
-    0xe8beb5,
-    0xe8beb6,
-    0xe8beb7,
-    0xe8beb8,
-    0xe8beb9,
-    0xe8beba,
-    0xe8bebb,
-    0xe8bebc,
-    0xe8bebd,
-    0xe8bebe,
-    0xe8bebf,
-    0xe8bf80,
-    0xe8bf81,
-    0xe8bf82,
-    0xe8bf83,
-    0xe8bf84,
-    0xe8bf85,
-    0xe8bf86,
-    0xe8bf87,
-    0xe8bf88,
-    0xe8bf89,
-    0xe8bf8a,
-    0xe8bf8b,
-    0xe8bf8c,
-    0xe8bf8d,
-    0xe8bf8e,
-    0xe8bf8f,
-    0xe8bf90,
-    0xe8bf91,
-    0xe8bf92,
-    0xe8bf93,
-    0xe8bf94,
-    0xe8bf95,
-    0xe8bf96,
-    0xe8bf97,
-    0xe8bf98,
-    0xe8bf99,
-    0xe8bf9a,
-    0xe8bf9b,
-    0xe8bf9c,
-    0xe8bf9d,
-    0xe8bf9e,
-    0xe8bf9f,
-    0xe8bfa0,
-    0xe8bfa1,
-    0xe8bfa2,
-    0xe8bfa3,
-    0xe8bfa4,
-    0xe8bfa5,
-    0xe8bfa6,
-    0xe8bfa7,
-    0xe8bfa8,
-    0xe8bfa9,
-    0xe8bfaa,
-    0xe8bfab,
-    0xe8bfac,
-    0xe8bfad,
-    0xe8bfae,
-    0xe8bfaf,
-    0xe8bfb0,
-    0xe8bfb1,
-    0xe8bfb2,
-    0xe8bfb3,
-    0xe8bfb4,
-    0xe8bfb5,
-    0xe8bfb6,
-    0xe8bfb7,
-    0xe8bfb8,
-    0xe8bfb9,
-    0xe8bfba,
-    0xe8bfbb,
-    0xe8bfbc,
-    0xe8bfbd,
-    0xe8bfbe,
-    0xe8bfbf,
-    0xe98080,
-    0xe98081,
-    0xe98082,
-    0xe98083,
-    0xe98084,
-    0xe98085,
-    0xe98086,
-    0xe98087,
-    0xe98088,
-    0xe98089,
-    0xe9808a,
-    0xe9808b,
-    0xe9808c,
-    0xe9808d,
-    0xe9808e,
-    0xe9808f,
-    0xe98090,
-    0xe98091,
-    0xe98092,
-    0xe98093,
-    0xe98094,
-    0xe98095,
-    0xe98096,
-    0xe98097,
-    0xe98098,
-    0xe98099,
-    0xe9809a,
-    0xe9809b,
-    0xe9809c,
-    0xe9809d,
-    0xe9809e,
-    0xe9809f,
-    0xe980a0,
-    0xe980a1,
-    0xe980a2,
-    0xe980a3,
-    0xe980a4,
-    0xe980a5,
-    0xe980a6,
-    0xe980a7,
-    0xe980a8,
-    0xe980a9,
-    0xe980aa,
-    0xe980ab,
-    0xe980ac,
-    0xe980ad,
-    0xe980ae,
-    0xe980af,
-    0xe980b0,
-    0xe980b1,
-    0xe980b2,
-    0xe980b3,
-    0xe980b4,
-    0xe980b5,
-    0xe980b6,
-    0xe980b7,
-    0xe980b8,
-    0xe980b9,
-    0xe980ba,
-    0xe980bb,
-    0xe980bc,
-    0xe980bd,
-    0xe980be,
-    0xe980bf,
-    0xe98180,
-    0xe98181,
-    0xe98182,
-    0xe98183,
-    0xe98184,
-    0xe98185,
-    0xe98186,
-    0xe98187,
-    0xe98188,
-    0xe98189,
-    0xe9818a,
-    0xe9818b,
-    0xe9818c,
-    0xe9818d,
-    0xe9818e,
-    0xe9818f,
-    0xe98190,
-    0xe98191,
-    0xe98192,
-    0xe98193,
-    0xe98194,
-    0xe98195,
-    0xe98196,
-    0xe98197,
-    0xe98198,
-    0xe98199,
-    0xe9819a,
-    0xe9819b,
-    0xe9819c,
-    0xe9819d,
-    0xe9819e,
-    0xe9819f,
-    0xe981a0,
-    0xe981a1,
-    0xe981a2,
-    0xe981a3,
-    0xe981a4,
-    0xe981a5,
-    0xe981a6,
-    0xe981a7,
-    0xe981a8,
-    0xe981a9,
-    0xe981aa,
-    0xe981ab,
-    0xe981ac,
-    0xe981ad,
-    0xe981ae,
-    0xe981af,
-    0xe981b0,
-    0xe981b1,
-    0xe981b2,
-    0xe981b3,
-    0xe981b4,
-    0xe981b5,
-    0xe981b6,
-    0xe981b7,
-    0xe981b8,
-    0xe981b9,
-    0xe981ba,
-    0xe981bb,
-    0xe981bc,
-    0xe981bd,
-    0xe981be,
-    0xe981bf,
-    0xe98280,
-    0xe98281,
-    0xe98282,
-    0xe98283,
-    0xe98284,
-    0xe98285,
-    0xe98286,
-    0xe98287,
-    0xe98288,
-    0xe98289,
-    0xe9828a,
-    0xe9828b,
-    0xe9828c,
-    0xe9828d,
-    0xe9828e,
-    0xe9828f,
-    0xe98290,
-    0xe98291,
-    0xe98292,
-    0xe98293,
-    0xe98294,
-    0xe98295,
-    0xe98296,
-    0xe98297,
-    0xe98298,
-    0xe98299,
-    0xe9829a,
-    0xe9829b,
-    0xe9829c,
-    0xe9829d,
-    0xe9829e,
-    0xe9829f,
-    0xe982a0,
-    0xe982a1,
-    0xe982a2,
-    0xe982a3,
-    0xe982a4,
-    0xe982a5,
-    0xe982a6,
-    0xe982a7,
-    0xe982a8,
-    0xe982a9,
-    0xe982aa,
-    0xe982ab,
-    0xe982ac,
-    0xe982ad,
-    0xe982ae,
-    0xe982af,
-    0xe982b0,
-    0xe982b1,
-    0xe982b2,
-    0xe982b3,
-    0xe982b4,
-    0xe982b5,
-    0xe982b6,
-    0xe982b7,
-    0xe982b8,
-    0xe982b9,
-    0xe982ba,
-    0xe982bb,
-    0xe982bc,
-    0xe982bd,
-    0xe982be,
-    0xe982bf,
-    0xe98380,
-    0xe98381,
-    0xe98382,
-    0xe98383,
-    0xe98384,
-    0xe98385,
-    0xe98386,
-    0xe98387,
-    0xe98388,
-    0xe98389,
-    0xe9838a,
-    0xe9838b,
-    0xe9838c,
-    0xe9838d,
-    0xe9838e,
-    0xe9838f,
-    0xe98390,
-    0xe98391,
-    0xe98392,
-    0xe98393,
-    0xe98394,
-    0xe98395,
-    0xe98396,
-    0xe98397,
-    0xe98398,
-    0xe98399,
-    0xe9839a,
-    0xe9839b,
-    0xe9839c,
-    0xe9839d,
-    0xe9839e,
-    0xe9839f,
-    0xe983a0,
-    0xe983a1,
-    0xe983a2,
-    0xe983a3,
-    0xe983a4,
-    0xe983a5,
-    0xe983a6,
-    0xe983a7,
-    0xe983a8,
-    0xe983a9,
-    0xe983aa,
-    0xe983ab,
-    0xe983ac,
-    0xe983ad,
-    0xe983ae,
-    0xe983af,
-    0xe983b0,
-    0xe983b1,
-    0xe983b2,
-    0xe983b3,
-    0xe983b4,
-    0xe983b5,
-    0xe983b6,
-    0xe983b7,
-    0xe983b8,
-    0xe983b9,
-    0xe983ba,
-    0xe983bb,
-    0xe983bc,
-    0xe983bd,
-    0xe983be,
-    0xe983bf,
-    0xe98480,
-    0xe98481,
-    0xe98482,
-    0xe98483,
-    0xe98484,
-    0xe98485,
-    0xe98486,
-    0xe98487,
-    0xe98488,
-    0xe98489,
-    0xe9848a,
-    0xe9848b,
-    0xe9848c,
-    0xe9848d,
-    0xe9848e,
-    0xe9848f,
-    0xe98490,
-    0xe98491,
-    0xe98492,
-    0xe98493,
-    0xe98494,
-    0xe98495,
-    0xe98496,
-    0xe98497,
-    0xe98498,
-    0xe98499,
-    0xe9849a,
-    0xe9849b,
-    0xe9849c,
-    0xe9849d,
-    0xe9849e,
-    0xe9849f,
-    0xe984a0,
-    0xe984a1,
-    0xe984a2,
-    0xe984a3,
-    0xe984a4,
-    0xe984a5,
-    0xe984a6,
-    0xe984a7,
-    0xe984a8,
-    0xe984a9,
-    0xe984aa,
-    0xe984ab,
-    0xe984ac,
-    0xe984ad,
-    0xe984ae,
-    0xe984af,
-    0xe984b0,
-    0xe984b1,
-    0xe984b2,
-    0xe984b3,
-    0xe984b4,
-    0xe984b5,
-    0xe984b6,
-    0xe984b7,
-    0xe984b8,
-    0xe984b9,
-    0xe984ba,
-    0xe984bb,
-    0xe984bc,
-    0xe984bd,
-    0xe984be,
-    0xe984bf,
-    0xe98580,
-    0xe98581,
-    0xe98582,
-    0xe98583,
-    0xe98584,
-    0xe98585,
-    0xe98586,
-    0xe98587,
-    0xe98588,
-    0xe98589,
-    0xe9858a,
-    0xe9858b,
-    0xe9858c,
-    0xe9858d,
-    0xe9858e,
-    0xe9858f,
-    0xe98590,
-    0xe98591,
-    0xe98592,
-    0xe98593,
-    0xe98594,
-    0xe98595,
-    0xe98596,
-    0xe98597,
-    0xe98598,
-    0xe98599,
-    0xe9859a,
-    0xe9859b,
-    0xe9859c,
-    0xe9859d,
-    0xe9859e,
-    0xe9859f,
-    0xe985a0,
-    0xe985a1,
-    0xe985a2,
-    0xe985a3,
-    0xe985a4,
-    0xe985a5,
-    0xe985a6,
-    0xe985a7,
-    0xe985a8,
-    0xe985a9,
-    0xe985aa,
-    0xe985ab,
-    0xe985ac,
-    0xe985ad,
-    0xe985ae,
-    0xe985af,
-    0xe985b0,
-    0xe985b1,
-    0xe985b2,
-    0xe985b3,
-    0xe985b4,
-    0xe985b5,
-    0xe985b6,
-    0xe985b7,
-    0xe985b8,
-    0xe985b9,
-    0xe985ba,
-    0xe985bb,
-    0xe985bc,
-    0xe985bd,
-    0xe985be,
-    0xe985bf,
-    0xe98680,
-    0xe98681,
-    0xe98682,
-    0xe98683,
-    0xe98684,
-    0xe98685,
-    0xe98686,
-    0xe98687,
-    0xe98688,
-    0xe98689,
-    0xe9868a,
-    0xe9868b,
-    0xe9868c,
-    0xe9868d,
-    0xe9868e,
-    0xe9868f,
-    0xe98690,
-    0xe98691,
-    0xe98692,
-    0xe98693,
-    0xe98694,
-    0xe98695,
-    0xe98696,
-    0xe98697,
-    0xe98698,
-    0xe98699,
-    0xe9869a,
-    0xe9869b,
-    0xe9869c,
-    0xe9869d,
-    0xe9869e,
-    0xe9869f,
-    0xe986a0,
-    0xe986a1,
-    0xe986a2,
-    0xe986a3,
-    0xe986a4,
-    0xe986a5,
-    0xe986a6,
-    0xe986a7,
-    0xe986a8,
-    0xe986a9,
-    0xe986aa,
-    0xe986ab,
-    0xe986ac,
-    0xe986ad,
-    0xe986ae,
-    0xe986af,
-    0xe986b0,
-    0xe986b1,
-    0xe986b2,
-    0xe986b3,
-    0xe986b4,
-    0xe986b5,
-    0xe986b6,
-    0xe986b7,
-    0xe986b8,
-    0xe986b9,
-    0xe986ba,
-    0xe986bb,
-    0xe986bc,
-    0xe986bd,
-    0xe986be,
-    0xe986bf,
-    0xe98780,
-    0xe98781,
-    0xe98782,
-    0xe98783,
-    0xe98784,
-    0xe98785,
-    0xe98786,
-    0xe98787,
-    0xe98788,
-    0xe98789,
-    0xe9878a,
-    0xe9878b,
-    0xe9878c,
-    0xe9878d,
-    0xe9878e,
-    0xe9878f,
-    0xe98790,
-    0xe98791,
-    0xe98792,
-    0xe98793,
-    0xe98794,
-    0xe98795,
-    0xe98796,
-    0xe98797,
-    0xe98798,
-    0xe98799,
-    0xe9879a,
-    0xe9879b,
-    0xe9879c,
-    0xe9879d,
-    0xe9879e,
-    0xe9879f,
-    0xe987a0,
-    0xe987a1,
-    0xe987a2,
-    0xe987a3,
-    0xe987a4,
-    0xe987a5,
-    0xe987a6,
-    0xe987a7,
-    0xe987a8,
-    0xe987a9,
-    0xe987aa,
-    0xe987ab,
-    0xe987ac,
-    0xe987ad,
-    0xe987ae,
-    0xe987af,
-    0xe987b0,
-    0xe987b1,
-    0xe987b2,
-    0xe987b3,
-    0xe987b4,
-    0xe987b5,
-    0xe987b6,
-    0xe987b7,
-    0xe987b8,
-    0xe987b9,
-    0xe987ba,
-    0xe987bb,
-    0xe987bc,
-    0xe987bd,
-    0xe987be,
-    0xe987bf,
-    0xe98880,
-    0xe98881,
-    0xe98882,
-    0xe98883,
-    0xe98884,
-    0xe98885,
-    0xe98886,
-    0xe98887,
-    0xe98888,
-    0xe98889,
-    0xe9888a,
-    0xe9888b,
-    0xe9888c,
-    0xe9888d,
-    0xe9888e,
-    0xe9888f,
-    0xe98890,
-    0xe98891,
-    0xe98892,
-    0xe98893,
-    0xe98894,
-    0xe98895,
-    0xe98896,
-    0xe98897,
-    0xe98898,
-    0xe98899,
-    0xe9889a,
-    0xe9889b,
-    0xe9889c,
-    0xe9889d,
-    0xe9889e,
-    0xe9889f,
-    0xe988a0,
-    0xe988a1,
-    0xe988a2,
-    0xe988a3,
-    0xe988a4,
-    0xe988a5,
-    0xe988a6,
-    0xe988a7,
-    0xe988a8,
-    0xe988a9,
-    0xe988aa,
-    0xe988ab,
-    0xe988ac,
-    0xe988ad,
-    0xe988ae,
-    0xe988af,
-    0xe988b0,
-    0xe988b1,
-    0xe988b2,
-    0xe988b3,
-    0xe988b4,
-    0xe988b5,
-    0xe988b6,
-    0xe988b7,
-    0xe988b8,
-    0xe988b9,
-    0xe988ba,
-    0xe988bb,
-    0xe988bc,
-    0xe988bd,
-    0xe988be,
-    0xe988bf,
-    0xe98980,
-    0xe98981,
-    0xe98982,
-    0xe98983,
-    0xe98984,
-    0xe98985,
-    0xe98986,
-    0xe98987,
-    0xe98988,
-    0xe98989,
-    0xe9898a,
-    0xe9898b,
-    0xe9898c,
-    0xe9898d,
-    0xe9898e,
-    0xe9898f,
-    0xe98990,
-    0xe98991,
-    0xe98992,
-    0xe98993,
-    0xe98994,
-    0xe98995,
-    0xe98996,
-    0xe98997,
-    0xe98998,
-    0xe98999,
-    0xe9899a,
-    0xe9899b,
-    0xe9899c,
-    0xe9899d,
-    0xe9899e,
-    0xe9899f,
-    0xe989a0,
-    0xe989a1,
-    0xe989a2,
-    0xe989a3,
-    0xe989a4,
-    0xe989a5,
-    0xe989a6,
-    0xe989a7,
-    0xe989a8,
-    0xe989a9,
-    0xe989aa,
-    0xe989ab,
-    0xe989ac,
-    0xe989ad,
-    0xe989ae,
-    0xe989af,
-    0xe989b0,
-    0xe989b1,
-    0xe989b2,
-    0xe989b3,
-    0xe989b4,
-    0xe989b5,
-    0xe989b6,
-    0xe989b7,
-    0xe989b8,
-    0xe989b9,
-    0xe989ba,
-    0xe989bb,
-    0xe989bc,
-    0xe989bd,
-    0xe989be,
-    0xe989bf,
-    0xe98a80,
-    0xe98a81,
-    0xe98a82,
-    0xe98a83,
-    0xe98a84,
-    0xe98a85,
-    0xe98a86,
-    0xe98a87,
-    0xe98a88,
-    0xe98a89,
-    0xe98a8a,
-    0xe98a8b,
-    0xe98a8c,
-    0xe98a8d,
-    0xe98a8e,
-    0xe98a8f,
-    0xe98a90,
-    0xe98a91,
-    0xe98a92,
-    0xe98a93,
-    0xe98a94,
-    0xe98a95,
-    0xe98a96,
-    0xe98a97,
-    0xe98a98,
-    0xe98a99,
-    0xe98a9a,
-    0xe98a9b,
-    0xe98a9c,
-    0xe98a9d,
-    0xe98a9e,
-    0xe98a9f,
-    0xe98aa0,
-    0xe98aa1,
-    0xe98aa2,
-    0xe98aa3,
-    0xe98aa4,
-    0xe98aa5,
-    0xe98aa6,
-    0xe98aa7,
-    0xe98aa8,
-    0xe98aa9,
-    0xe98aaa,
-    0xe98aab,
-    0xe98aac,
-    0xe98aad,
-    0xe98aae,
-    0xe98aaf,
-    0xe98ab0,
-    0xe98ab1,
-    0xe98ab2,
-    0xe98ab3,
-    0xe98ab4,
-    0xe98ab5,
-    0xe98ab6,
-    0xe98ab7,
-    0xe98ab8,
-    0xe98ab9,
-    0xe98aba,
-    0xe98abb,
-    0xe98abc,
-    0xe98abd,
-    0xe98abe,
-    0xe98abf,
-    0xe98b80,
-    0xe98b81,
-    0xe98b82,
-    0xe98b83,
-    0xe98b84,
-    0xe98b85,
-    0xe98b86,
-    0xe98b87,
-    0xe98b88,
-    0xe98b89,
-    0xe98b8a,
-    0xe98b8b,
-    0xe98b8c,
-    0xe98b8d,
-    0xe98b8e,
-    0xe98b8f,
-    0xe98b90,
-    0xe98b91,
-    0xe98b92,
-    0xe98b93,
-    0xe98b94,
-    0xe98b95,
-    0xe98b96,
-    0xe98b97,
-    0xe98b98,
-    0xe98b99,
-    0xe98b9a,
-    0xe98b9b,
-    0xe98b9c,
-    0xe98b9d,
-    0xe98b9e,
-    0xe98b9f,
-    0xe98ba0,
-    0xe98ba1,
-    0xe98ba2,
-    0xe98ba3,
-    0xe98ba4,
-    0xe98ba5,
-    0xe98ba6,
-    0xe98ba7,
-    0xe98ba8,
-    0xe98ba9,
-    0xe98baa,
-    0xe98bab,
-    0xe98bac,
-    0xe98bad,
-    0xe98bae,
-    0xe98baf,
-    0xe98bb0,
-    0xe98bb1,
-    0xe98bb2,
-    0xe98bb3,
-    0xe98bb4,
-    0xe98bb5,
-    0xe98bb6,
-    0xe98bb7,
-    0xe98bb8,
-    0xe98bb9,
-    0xe98bba,
-    0xe98bbb,
-    0xe98bbc,
-    0xe98bbd,
-    0xe98bbe,
-    0xe98bbf,
-    0xe98c80,
-    0xe98c81,
-    0xe98c82,
-    0xe98c83,
-    0xe98c84,
-    0xe98c85,
-    0xe98c86,
-    0xe98c87,
-    0xe98c88,
-    0xe98c89,
-    0xe98c8a,
-    0xe98c8b,
-    0xe98c8c,
-    0xe98c8d,
-    0xe98c8e,
-    0xe98c8f,
-    0xe98c90,
-    0xe98c91,
-    0xe98c92,
-    0xe98c93,
-    0xe98c94,
-    0xe98c95,
-    0xe98c96,
-    0xe98c97,
-    0xe98c98,
-    0xe98c99,
-    0xe98c9a,
-    0xe98c9b,
-    0xe98c9c,
-    0xe98c9d,
-    0xe98c9e,
-    0xe98c9f,
-    0xe98ca0,
-    0xe98ca1,
-    0xe98ca2,
-    0xe98ca3,
-    0xe98ca4,
-    0xe98ca5,
-    0xe98ca6,
-    0xe98ca7,
-    0xe98ca8,
-    0xe98ca9,
-    0xe98caa,
-    0xe98cab,
-    0xe98cac,
-    0xe98cad,
-    0xe98cae,
-    0xe98caf,
-    0xe98cb0,
-    0xe98cb1,
-    0xe98cb2,
-    0xe98cb3,
-    0xe98cb4,
-    0xe98cb5,
-    0xe98cb6,
-    0xe98cb7,
-    0xe98cb8,
-    0xe98cb9,
-    0xe98cba,
-    0xe98cbb,
-    0xe98cbc,
-    0xe98cbd,
-    0xe98cbe,
-    0xe98cbf,
-    0xe98d80,
-    0xe98d81,
-    0xe98d82,
-    0xe98d83,
-    0xe98d84,
-    0xe98d85,
-    0xe98d86,
-    0xe98d87,
-    0xe98d88,
-    0xe98d89,
-    0xe98d8a,
-    0xe98d8b,
-    0xe98d8c,
-    0xe98d8d,
-    0xe98d8e,
-    0xe98d8f,
-    0xe98d90,
-    0xe98d91,
-    0xe98d92,
-    0xe98d93,
-    0xe98d94,
-    0xe98d95,
-    0xe98d96,
-    0xe98d97,
-    0xe98d98,
-    0xe98d99,
-    0xe98d9a,
-    0xe98d9b,
-    0xe98d9c,
-    0xe98d9d,
-    0xe98d9e,
-    0xe98d9f,
-    0xe98da0,
-    0xe98da1,
-    0xe98da2,
-    0xe98da3,
-    0xe98da4,
-    0xe98da5,
-    0xe98da6,
-    0xe98da7,
-    0xe98da8,
-    0xe98da9,
-    0xe98daa,
-    0xe98dab,
-    0xe98dac,
-    0xe98dad,
-    0xe98dae,
-    0xe98daf,
-    0xe98db0,
-    0xe98db1,
-    0xe98db2,
-    0xe98db3,
-    0xe98db4,
-    0xe98db5,
-    0xe98db6,
-    0xe98db7,
-    0xe98db8,
-    0xe98db9,
-    0xe98dba,
-    0xe98dbb,
-    0xe98dbc,
-    0xe98dbd,
-    0xe98dbe,
-    0xe98dbf,
-    0xe98e80,
-    0xe98e81,
-    0xe98e82,
-    0xe98e83,
-    0xe98e84,
-    0xe98e85,
-    0xe98e86,
-    0xe98e87,
-    0xe98e88,
-    0xe98e89,
-    0xe98e8a,
-    0xe98e8b,
-    0xe98e8c,
-    0xe98e8d,
-    0xe98e8e,
-    0xe98e8f,
-    0xe98e90,
-    0xe98e91,
-    0xe98e92,
-    0xe98e93,
-    0xe98e94,
-    0xe98e95,
-    0xe98e96,
-    0xe98e97,
-    0xe98e98,
-    0xe98e99,
-    0xe98e9a,
-    0xe98e9b,
-    0xe98e9c,
-    0xe98e9d,
-    0xe98e9e,
-    0xe98e9f,
-    0xe98ea0,
-    0xe98ea1,
-    0xe98ea2,
-    0xe98ea3,
-    0xe98ea4,
-    0xe98ea5,
-    0xe98ea6,
-    0xe98ea7,
-    0xe98ea8,
-    0xe98ea9,
-    0xe98eaa,
-    0xe98eab,
-    0xe98eac,
-    0xe98ead,
-    0xe98eae,
-    0xe98eaf,
-    0xe98eb0,
-    0xe98eb1,
-    0xe98eb2,
-    0xe98eb3,
-    0xe98eb4,
-    0xe98eb5,
-    0xe98eb6,
-    0xe98eb7,
-    0xe98eb8,
-    0xe98eb9,
-    0xe98eba,
-    0xe98ebb,
-    0xe98ebc,
-    0xe98ebd,
-    0xe98ebe,
-    0xe98ebf,
-    0xe98f80,
-    0xe98f81,
-    0xe98f82,
-    0xe98f83,
-    0xe98f84,
-    0xe98f85,
-    0xe98f86,
-    0xe98f87,
-    0xe98f88,
-    0xe98f89,
-    0xe98f8a,
-    0xe98f8b,
-    0xe98f8c,
-    0xe98f8d,
-    0xe98f8e,
-    0xe98f8f,
-    0xe98f90,
-    0xe98f91,
-    0xe98f92,
-    0xe98f93,
-    0xe98f94,
-    0xe98f95,
-    0xe98f96,
-    0xe98f97,
-    0xe98f98,
-    0xe98f99,
-    0xe98f9a,
-    0xe98f9b,
-    0xe98f9c,
-    0xe98f9d,
-    0xe98f9e,
-    0xe98f9f,
-    0xe98fa0,
-    0xe98fa1,
-    0xe98fa2,
-    0xe98fa3,
-    0xe98fa4,
-    0xe98fa5,
-    0xe98fa6,
-    0xe98fa7,
-    0xe98fa8,
-    0xe98fa9,
-    0xe98faa,
-    0xe98fab,
-    0xe98fac,
-    0xe98fad,
-    0xe98fae,
-    0xe98faf,
-    0xe98fb0,
-    0xe98fb1,
-    0xe98fb2,
-    0xe98fb3,
-    0xe98fb4,
-    0xe98fb5,
-    0xe98fb6,
-    0xe98fb7,
-    0xe98fb8,
-    0xe98fb9,
-    0xe98fba,
-    0xe98fbb,
-    0xe98fbc,
-    0xe98fbd,
-    0xe98fbe,
-    0xe98fbf,
-    0xe99080,
-    0xe99081,
-    0xe99082,
-    0xe99083,
-    0xe99084,
-    0xe99085,
-    0xe99086,
-    0xe99087,
-    0xe99088,
-    0xe99089,
-    0xe9908a,
-    0xe9908b,
-    0xe9908c,
-    0xe9908d,
-    0xe9908e,
-    0xe9908f,
-    0xe99090,
-    0xe99091,
-    0xe99092,
-    0xe99093,
-    0xe99094,
-    0xe99095,
-    0xe99096,
-    0xe99097,
-    0xe99098,
-    0xe99099,
-    0xe9909a,
-    0xe9909b,
-    0xe9909c,
-    0xe9909d,
-    0xe9909e,
-    0xe9909f,
-    0xe990a0,
-    0xe990a1,
-    0xe990a2,
-    0xe990a3,
-    0xe990a4,
-    0xe990a5,
-    0xe990a6,
-    0xe990a7,
-    0xe990a8,
-    0xe990a9,
-    0xe990aa,
-    0xe990ab,
-    0xe990ac,
-    0xe990ad,
-    0xe990ae,
-    0xe990af,
-    0xe990b0,
-    0xe990b1,
-    0xe990b2,
-    0xe990b3,
-    0xe990b4,
-    0xe990b5,
-    0xe990b6,
-    0xe990b7,
-    0xe990b8,
-    0xe990b9,
-    0xe990ba,
-    0xe990bb,
-    0xe990bc,
-    0xe990bd,
-    0xe990be,
-    0xe990bf,
-    0xe99180,
-    0xe99181,
-    0xe99182,
-    0xe99183,
-    0xe99184,
-    0xe99185,
-    0xe99186,
-    0xe99187,
-    0xe99188,
-    0xe99189,
-    0xe9918a,
-    0xe9918b,
-    0xe9918c,
-    0xe9918d,
-    0xe9918e,
-    0xe9918f,
-    0xe99190,
-    0xe99191,
-    0xe99192,
-    0xe99193,
-    0xe99194,
-    0xe99195,
-    0xe99196,
-    0xe99197,
-    0xe99198,
-    0xe99199,
-    0xe9919a,
-    0xe9919b,
-    0xe9919c,
-    0xe9919d,
-    0xe9919e,
-    0xe9919f,
-    0xe991a0,
-    0xe991a1,
-    0xe991a2,
-    0xe991a3,
-    0xe991a4,
-    0xe991a5,
-    0xe991a6,
-    0xe991a7,
-    0xe991a8,
-    0xe991a9,
-    0xe991aa,
-    0xe991ab,
-    0xe991ac,
-    0xe991ad,
-    0xe991ae,
-    0xe991af,
-    0xe991b0,
-    0xe991b1,
-    0xe991b2,
-    0xe991b3,
-    0xe991b4,
-    0xe991b5,
-    0xe991b6,
-    0xe991b7,
-    0xe991b8,
-    0xe991b9,
-    0xe991ba,
-    0xe991bb,
-    0xe991bc,
-    0xe991bd,
-    0xe991be,
-    0xe991bf,
-    0xe99280,
-    0xe99281,
-    0xe99282,
-    0xe99283,
-    0xe99284,
-    0xe99285,
-    0xe99286,
-    0xe99287,
-    0xe99288,
-    0xe99289,
-    0xe9928a,
-    0xe9928b,
-    0xe9928c,
-    0xe9928d,
-    0xe9928e,
-    0xe9928f,
-    0xe99290,
-    0xe99291,
-    0xe99292,
-    0xe99293,
-    0xe99294,
-    0xe99295,
-    0xe99296,
-    0xe99297,
-    0xe99298,
-    0xe99299,
-    0xe9929a,
-    0xe9929b,
-    0xe9929c,
-    0xe9929d,
-    0xe9929e,
-    0xe9929f,
-    0xe992a0,
-    0xe992a1,
-    0xe992a2,
-    0xe992a3,
-    0xe992a4,
-    0xe992a5,
-    0xe992a6,
-    0xe992a7,
-    0xe992a8,
-    0xe992a9,
-    0xe992aa,
-    0xe992ab,
-    0xe992ac,
-    0xe992ad,
-    0xe992ae,
-    0xe992af,
-    0xe992b0,
-    0xe992b1,
-    0xe992b2,
-    0xe992b3,
-    0xe992b4,
-    0xe992b5,
-    0xe992b6,
-    0xe992b7,
-    0xe992b8,
-    0xe992b9,
-    0xe992ba,
-    0xe992bb,
-    0xe992bc,
-    0xe992bd,
-    0xe992be,
-    0xe992bf,
-    0xe99380,
-    0xe99381,
-    0xe99382,
-    0xe99383,
-    0xe99384,
-    0xe99385,
-    0xe99386,
-    0xe99387,
-    0xe99388,
-    0xe99389,
-    0xe9938a,
-    0xe9938b,
-    0xe9938c,
-    0xe9938d,
-    0xe9938e,
-    0xe9938f,
-    0xe99390,
-    0xe99391,
-    0xe99392,
-    0xe99393,
-    0xe99394,
-    0xe99395,
-    0xe99396,
-    0xe99397,
-    0xe99398,
-    0xe99399,
-    0xe9939a,
-    0xe9939b,
-    0xe9939c,
-    0xe9939d,
-    0xe9939e,
-    0xe9939f,
-    0xe993a0,
-    0xe993a1,
-    0xe993a2,
-    0xe993a3,
-    0xe993a4,
-    0xe993a5,
-    0xe993a6,
-    0xe993a7,
-    0xe993a8,
-    0xe993a9,
-    0xe993aa,
-    0xe993ab,
-    0xe993ac,
-    0xe993ad,
-    0xe993ae,
-    0xe993af,
-    0xe993b0,
-    0xe993b1,
-    0xe993b2,
-    0xe993b3,
-    0xe993b4,
-    0xe993b5,
-    0xe993b6,
-    0xe993b7,
-    0xe993b8,
-    0xe993b9,
-    0xe993ba,
-    0xe993bb,
-    0xe993bc,
-    0xe993bd,
-    0xe993be,
-    0xe993bf,
-    0xe99480,
-    0xe99481,
-    0xe99482,
-    0xe99483,
-    0xe99484,
-    0xe99485,
-    0xe99486,
-    0xe99487,
-    0xe99488,
-    0xe99489,
-    0xe9948a,
-    0xe9948b,
-    0xe9948c,
-    0xe9948d,
-    0xe9948e,
-    0xe9948f,
-    0xe99490,
-    0xe99491,
-    0xe99492,
-    0xe99493,
-    0xe99494,
-    0xe99495,
-    0xe99496,
-    0xe99497,
-    0xe99498,
-    0xe99499,
-    0xe9949a,
-    0xe9949b,
-    0xe9949c,
-    0xe9949d,
-    0xe9949e,
-    0xe9949f,
-    0xe994a0,
-    0xe994a1,
-    0xe994a2,
-    0xe994a3,
-    0xe994a4,
-    0xe994a5,
-    0xe994a6,
-    0xe994a7,
-    0xe994a8,
-    0xe994a9,
-    0xe994aa,
-    0xe994ab,
-    0xe994ac,
-    0xe994ad,
-    0xe994ae,
-    0xe994af,
-    0xe994b0,
-    0xe994b1,
-    0xe994b2,
-    0xe994b3,
-    0xe994b4,
-    0xe994b5,
-    0xe994b6,
-    0xe994b7,
-    0xe994b8,
-    0xe994b9,
-    0xe994ba,
-    0xe994bb,
-    0xe994bc,
-    0xe994bd,
-    0xe994be,
-    0xe994bf,
-    0xe99580,
-    0xe99581,
-    0xe99582,
-    0xe99583,
-    0xe99584,
-    0xe99585,
-    0xe99586,
-    0xe99587,
-    0xe99588,
-    0xe99589,
-    0xe9958a,
-    0xe9958b,
-    0xe9958c,
-    0xe9958d,
-    0xe9958e,
-    0xe9958f,
-    0xe99590,
-    0xe99591,
-    0xe99592,
-    0xe99593,
-    0xe99594,
-    0xe99595,
-    0xe99596,
-    0xe99597,
-    0xe99598,
-    0xe99599,
-    0xe9959a,
-    0xe9959b,
-    0xe9959c,
-    0xe9959d,
-    0xe9959e,
-    0xe9959f,
-    0xe995a0,
-    0xe995a1,
-    0xe995a2,
-    0xe995a3,
-    0xe995a4,
-    0xe995a5,
-    0xe995a6,
-    0xe995a7,
-    0xe995a8,
-    0xe995a9,
-    0xe995aa,
-    0xe995ab,
-    0xe995ac,
-    0xe995ad,
-    0xe995ae,
-    0xe995af,
-    0xe995b0,
-    0xe995b1,
-    0xe995b2,
-    0xe995b3,
-    0xe995b4,
-    0xe995b5,
-    0xe995b6,
-    0xe995b7,
-    0xe995b8,
-    0xe995b9,
-    0xe995ba,
-    0xe995bb,
-    0xe995bc,
-    0xe995bd,
-    0xe995be,
-    0xe995bf,
-    0xe99680,
-    0xe99681,
-    0xe99682,
-    0xe99683,
-    0xe99684,
-    0xe99685,
-    0xe99686,
-    0xe99687,
-    0xe99688,
-    0xe99689,
-    0xe9968a,
-    0xe9968b,
-    0xe9968c,
-    0xe9968d,
-    0xe9968e,
-    0xe9968f,
-    0xe99690,
-    0xe99691,
-    0xe99692,
-    0xe99693,
-    0xe99694,
-    0xe99695,
-    0xe99696,
-    0xe99697,
-    0xe99698,
-    0xe99699,
-    0xe9969a,
-    0xe9969b,
-    0xe9969c,
-    0xe9969d,
-    0xe9969e,
-    0xe9969f,
-    0xe996a0,
-    0xe996a1,
-    0xe996a2,
-    0xe996a3,
-    0xe996a4,
-    0xe996a5,
-    0xe996a6,
-    0xe996a7,
-    0xe996a8,
-    0xe996a9,
-    0xe996aa,
-    0xe996ab,
-    0xe996ac,
-    0xe996ad,
-    0xe996ae,
-    0xe996af,
-    0xe996b0,
-    0xe996b1,
-    0xe996b2,
-    0xe996b3,
-    0xe996b4,
-    0xe996b5,
-    0xe996b6,
-    0xe996b7,
-    0xe996b8,
-    0xe996b9,
-    0xe996ba,
-    0xe996bb,
-    0xe996bc,
-    0xe996bd,
-    0xe996be,
-    0xe996bf,
-    0xe99780,
-    0xe99781,
-    0xe99782,
-    0xe99783,
-    0xe99784,
-    0xe99785,
-    0xe99786,
-    0xe99787,
-    0xe99788,
-    0xe99789,
-    0xe9978a,
-    0xe9978b,
-    0xe9978c,
-    0xe9978d,
-    0xe9978e,
-    0xe9978f,
-    0xe99790,
-    0xe99791,
-    0xe99792,
-    0xe99793,
-    0xe99794,
-    0xe99795,
-    0xe99796,
-    0xe99797,
-    0xe99798,
-    0xe99799,
-    0xe9979a,
-    0xe9979b,
-    0xe9979c,
-    0xe9979d,
-    0xe9979e,
-    0xe9979f,
-    0xe997a0,
-    0xe997a1,
-    0xe997a2,
-    0xe997a3,
-    0xe997a4,
-    0xe997a5,
-    0xe997a6,
-    0xe997a7,
-    0xe997a8,
-    0xe997a9,
-    0xe997aa,
-    0xe997ab,
-    0xe997ac,
-    0xe997ad,
-    0xe997ae,
-    0xe997af,
-    0xe997b0,
-    0xe997b1,
-    0xe997b2,
-    0xe997b3,
-    0xe997b4,
-    0xe997b5,
-    0xe997b6,
-    0xe997b7,
-    0xe997b8,
-    0xe997b9,
-    0xe997ba,
-    0xe997bb,
-    0xe997bc,
-    0xe997bd,
-    0xe997be,
-    0xe997bf,
-    0xe99880,
-    0xe99881,
-    0xe99882,
-    0xe99883,
-    0xe99884,
-    0xe99885,
-    0xe99886,
-    0xe99887,
-    0xe99888,
-    0xe99889,
-    0xe9988a,
-    0xe9988b,
-    0xe9988c,
-    0xe9988d,
-    0xe9988e,
-    0xe9988f,
-    0xe99890,
-    0xe99891,
-    0xe99892,
-    0xe99893,
-    0xe99894,
-    0xe99895,
-    0xe99896,
-    0xe99897,
-    0xe99898,
-    0xe99899,
-    0xe9989a,
-    0xe9989b,
-    0xe9989c,
-    0xe9989d,
-    0xe9989e,
-    0xe9989f,
-    0xe998a0,
-    0xe998a1,
-    0xe998a2,
-    0xe998a3,
-    0xe998a4,
-    0xe998a5,
-    0xe998a6,
-    0xe998a7,
-    0xe998a8,
-    0xe998a9,
-    0xe998aa,
-    0xe998ab,
-    0xe998ac,
-    0xe998ad,
-    0xe998ae,
-    0xe998af,
-    0xe998b0,
-    0xe998b1,
-    0xe998b2,
-    0xe998b3,
-    0xe998b4,
-    0xe998b5,
-    0xe998b6,
-    0xe998b7,
-    0xe998b8,
-    0xe998b9,
-    0xe998ba,
-    0xe998bb,
-    0xe998bc,
-    0xe998bd,
-    0xe998be,
-    0xe998bf,
-    0xe99980,
-    0xe99981,
-    0xe99982,
-    0xe99983,
-    0xe99984,
-    0xe99985,
-    0xe99986,
-    0xe99987,
-    0xe99988,
-    0xe99989,
-    0xe9998a,
-    0xe9998b,
-    0xe9998c,
-    0xe9998d,
-    0xe9998e,
-    0xe9998f,
-    0xe99990,
-    0xe99991,
-    0xe99992,
-    0xe99993,
-    0xe99994,
-    0xe99995,
-    0xe99996,
-    0xe99997,
-    0xe99998,
-    0xe99999,
-    0xe9999a,
-    0xe9999b,
-    0xe9999c,
-    0xe9999d,
-    0xe9999e,
-    0xe9999f,
-    0xe999a0,
-    0xe999a1,
-    0xe999a2,
-    0xe999a3,
-    0xe999a4,
-    0xe999a5,
-    0xe999a6,
-    0xe999a7,
-    0xe999a8,
-    0xe999a9,
-    0xe999aa,
-    0xe999ab,
-    0xe999ac,
-    0xe999ad,
-    0xe999ae,
-    0xe999af,
-    0xe999b0,
-    0xe999b1,
-    0xe999b2,
-    0xe999b3,
-    0xe999b4,
-    0xe999b5,
-    0xe999b6,
-    0xe999b7,
-    0xe999b8,
-    0xe999b9,
-    0xe999ba,
-    0xe999bb,
-    0xe999bc,
-    0xe999bd,
-    0xe999be,
-    0xe999bf,
-    0xe99a80,
-    0xe99a81,
-    0xe99a82,
-    0xe99a83,
-    0xe99a84,
-    0xe99a85,
-    0xe99a86,
-    0xe99a87,
-    0xe99a88,
-    0xe99a89,
-    0xe99a8a,
-    0xe99a8b,
-    0xe99a8c,
-    0xe99a8d,
-    0xe99a8e,
-    0xe99a8f,
-    0xe99a90,
-    0xe99a91,
-    0xe99a92,
-    0xe99a93,
-    0xe99a94,
-    0xe99a95,
-    0xe99a96,
-    0xe99a97,
-    0xe99a98,
-    0xe99a99,
-    0xe99a9a,
-    0xe99a9b,
-    0xe99a9c,
-    0xe99a9d,
-    0xe99a9e,
-    0xe99a9f,
-    0xe99aa0,
-    0xe99aa1,
-    0xe99aa2,
-    0xe99aa3,
-    0xe99aa4,
-    0xe99aa5,
-    0xe99aa6,
-    0xe99aa7,
-    0xe99aa8,
-    0xe99aa9,
-    0xe99aaa,
-    0xe99aab,
-    0xe99aac,
-    0xe99aad,
-    0xe99aae,
-    0xe99aaf,
-    0xe99ab0,
-    0xe99ab1,
-    0xe99ab2,
-    0xe99ab3,
-    0xe99ab4,
-    0xe99ab5,
-    0xe99ab6,
-    0xe99ab7,
-    0xe99ab8,
-    0xe99ab9,
-    0xe99aba,
-    0xe99abb,
-    0xe99abc,
-    0xe99abd,
-    0xe99abe,
-    0xe99abf,
-    0xe99b80,
-    0xe99b81,
-    0xe99b82,
-    0xe99b83,
-    0xe99b84,
-    0xe99b85,
-    0xe99b86,
-    0xe99b87,
-    0xe99b88,
-    0xe99b89,
-    0xe99b8a,
-    0xe99b8b,
-    0xe99b8c,
-    0xe99b8d,
-    0xe99b8e,
-    0xe99b8f,
-    0xe99b90,
-    0xe99b91,
-    0xe99b92,
-    0xe99b93,
-    0xe99b94,
-    0xe99b95,
-    0xe99b96,
-    0xe99b97,
-    0xe99b98,
-    0xe99b99,
-    0xe99b9a,
-    0xe99b9b,
-    0xe99b9c,
-    0xe99b9d,
-    0xe99b9e,
-    0xe99b9f,
-    0xe99ba0,
-    0xe99ba1,
-    0xe99ba2,
-    0xe99ba3,
-    0xe99ba4,
-    0xe99ba5,
-    0xe99ba6,
-    0xe99ba7,
-    0xe99ba8,
-    0xe99ba9,
-    0xe99baa,
-    0xe99bab,
-    0xe99bac,
-    0xe99bad,
-    0xe99bae,
-    0xe99baf,
-    0xe99bb0,
-    0xe99bb1,
-    0xe99bb2,
-    0xe99bb3,
-    0xe99bb4,
-    0xe99bb5,
-    0xe99bb6,
-    0xe99bb7,
-    0xe99bb8,
-    0xe99bb9,
-    0xe99bba,
-    0xe99bbb,
-    0xe99bbc,
-    0xe99bbd,
-    0xe99bbe,
-    0xe99bbf,
-    0xe99c80,
-    0xe99c81,
-    0xe99c82,
-    0xe99c83,
-    0xe99c84,
-    0xe99c85,
-    0xe99c86,
-    0xe99c87,
-    0xe99c88,
-    0xe99c89,
-    0xe99c8a,
-    0xe99c8b,
-    0xe99c8c,
-    0xe99c8d,
-    0xe99c8e,
-    0xe99c8f,
-    0xe99c90,
-    0xe99c91,
-    0xe99c92,
-    0xe99c93,
-    0xe99c94,
-    0xe99c95,
-    0xe99c96,
-    0xe99c97,
-    0xe99c98,
-    0xe99c99,
-    0xe99c9a,
-    0xe99c9b,
-    0xe99c9c,
-    0xe99c9d,
-    0xe99c9e,
-    0xe99c9f,
-    0xe99ca0,
-    0xe99ca1,
-    0xe99ca2,
-    0xe99ca3,
-    0xe99ca4,
-    0xe99ca5,
-    0xe99ca6,
-    0xe99ca7,
-    0xe99ca8,
-    0xe99ca9,
-    0xe99caa,
-    0xe99cab,
-    0xe99cac,
-    0xe99cad,
-    0xe99cae,
-    0xe99caf,
-    0xe99cb0,
-    0xe99cb1,
-    0xe99cb2,
-    0xe99cb3,
-    0xe99cb4,
-    0xe99cb5,
-    0xe99cb6,
-    0xe99cb7,
-    0xe99cb8,
-    0xe99cb9,
-    0xe99cba,
-    0xe99cbb,
-    0xe99cbc,
-    0xe99cbd,
-    0xe99cbe,
-    0xe99cbf,
-    0xe99d80,
-    0xe99d81,
-    0xe99d82,
-    0xe99d83,
-    0xe99d84,
-    0xe99d85,
-    0xe99d86,
-    0xe99d87,
-    0xe99d88,
-    0xe99d89,
-    0xe99d8a,
-    0xe99d8b,
-    0xe99d8c,
-    0xe99d8d,
-    0xe99d8e,
-    0xe99d8f,
-    0xe99d90,
-    0xe99d91,
-    0xe99d92,
-    0xe99d93,
-    0xe99d94,
-    0xe99d95,
-    0xe99d96,
-    0xe99d97,
-    0xe99d98,
-    0xe99d99,
-    0xe99d9a,
-    0xe99d9b,
-    0xe99d9c,
-    0xe99d9d,
-    0xe99d9e,
-    0xe99d9f,
-    0xe99da0,
-    0xe99da1,
-    0xe99da2,
-    0xe99da3,
-    0xe99da4,
-    0xe99da5,
-    0xe99da6,
-    0xe99da7,
-    0xe99da8,
-    0xe99da9,
-    0xe99daa,
-    0xe99dab,
-    0xe99dac,
-    0xe99dad,
-    0xe99dae,
-    0xe99daf,
-    0xe99db0,
-    0xe99db1,
-    0xe99db2,
-    0xe99db3,
-    0xe99db4,
-    0xe99db5,
-    0xe99db6,
-    0xe99db7,
-    0xe99db8,
-    0xe99db9,
-    0xe99dba,
-    0xe99dbb,
-    0xe99dbc,
-    0xe99dbd,
-    0xe99dbe,
-    0xe99dbf,
-    0xe99e80,
-    0xe99e81,
-    0xe99e82,
-    0xe99e83,
-    0xe99e84,
-    0xe99e85,
-    0xe99e86,
-    0xe99e87,
-    0xe99e88,
-    0xe99e89,
-    0xe99e8a,
-    0xe99e8b,
-    0xe99e8c,
-    0xe99e8d,
-    0xe99e8e,
-    0xe99e8f,
-    0xe99e90,
-    0xe99e91,
-    0xe99e92,
-    0xe99e93,
-    0xe99e94,
-    0xe99e95,
-    0xe99e96,
-    0xe99e97,
-    0xe99e98,
-    0xe99e99,
-    0xe99e9a,
-    0xe99e9b,
-    0xe99e9c,
-    0xe99e9d,
-    0xe99e9e,
-    0xe99e9f,
-    0xe99ea0,
-    0xe99ea1,
-    0xe99ea2,
-    0xe99ea3,
-    0xe99ea4,
-    0xe99ea5,
-    0xe99ea6,
-    0xe99ea7,
-    0xe99ea8,
-    0xe99ea9,
-    0xe99eaa,
-    0xe99eab,
-    0xe99eac,
-    0xe99ead,
-    0xe99eae,
-    0xe99eaf,
-    0xe99eb0,
-    0xe99eb1,
-    0xe99eb2,
-    0xe99eb3,
-    0xe99eb4,
-    0xe99eb5,
-    0xe99eb6,
-    0xe99eb7,
-    0xe99eb8,
-    0xe99eb9,
-    0xe99eba,
-    0xe99ebb,
-    0xe99ebc,
-    0xe99ebd,
-    0xe99ebe,
-    0xe99ebf,
-    0xe99f80,
-    0xe99f81,
-    0xe99f82,
-    0xe99f83,
-    0xe99f84,
-    0xe99f85,
-    0xe99f86,
-    0xe99f87,
-    0xe99f88,
-    0xe99f89,
-    0xe99f8a,
-    0xe99f8b,
-    0xe99f8c,
-    0xe99f8d,
-    0xe99f8e,
-    0xe99f8f,
-    0xe99f90,
-    0xe99f91,
-    0xe99f92,
-    0xe99f93,
-    0xe99f94,
-    0xe99f95,
-    0xe99f96,
-    0xe99f97,
-    0xe99f98,
-    0xe99f99,
-    0xe99f9a,
-    0xe99f9b,
-    0xe99f9c,
-    0xe99f9d,
-    0xe99f9e,
-    0xe99f9f,
-    0xe99fa0,
-    0xe99fa1,
-    0xe99fa2,
-    0xe99fa3,
-    0xe99fa4,
-    0xe99fa5,
-    0xe99fa6,
-    0xe99fa7,
-    0xe99fa8,
-    0xe99fa9,
-    0xe99faa,
-    0xe99fab,
-    0xe99fac,
-    0xe99fad,
-    0xe99fae,
-    0xe99faf,
-    0xe99fb0,
-    0xe99fb1,
-    0xe99fb2,
-    0xe99fb3,
-    0xe99fb4,
-    0xe99fb5,
-    0xe99fb6,
-    0xe99fb7,
-    0xe99fb8,
-    0xe99fb9,
-    0xe99fba,
-    0xe99fbb,
-    0xe99fbc,
-    0xe99fbd,
-    0xe99fbe,
-    0xe99fbf,
-    0xe9a080,
-    0xe9a081,
-    0xe9a082,
-    0xe9a083,
-    0xe9a084,
-    0xe9a085,
-    0xe9a086,
-    0xe9a087,
-    0xe9a088,
-    0xe9a089,
-    0xe9a08a,
-    0xe9a08b,
-    0xe9a08c,
-    0xe9a08d,
-    0xe9a08e,
-    0xe9a08f,
-    0xe9a090,
-    0xe9a091,
-    0xe9a092,
-    0xe9a093,
-    0xe9a094,
-    0xe9a095,
-    0xe9a096,
-    0xe9a097,
-    0xe9a098,
-    0xe9a099,
-    0xe9a09a,
-    0xe9a09b,
-    0xe9a09c,
-    0xe9a09d,
-    0xe9a09e,
-    0xe9a09f,
-    0xe9a0a0,
-    0xe9a0a1,
-    0xe9a0a2,
-    0xe9a0a3,
-    0xe9a0a4,
-    0xe9a0a5,
-    0xe9a0a6,
-    0xe9a0a7,
-    0xe9a0a8,
-    0xe9a0a9,
-    0xe9a0aa,
-    0xe9a0ab,
-    0xe9a0ac,
-    0xe9a0ad,
-    0xe9a0ae,
-    0xe9a0af,
-    0xe9a0b0,
-    0xe9a0b1,
-    0xe9a0b2,
-    0xe9a0b3,
-    0xe9a0b4,
-    0xe9a0b5,
-    0xe9a0b6,
-    0xe9a0b7,
-    0xe9a0b8,
-    0xe9a0b9,
-    0xe9a0ba,
-    0xe9a0bb,
-    0xe9a0bc,
-    0xe9a0bd,
-    0xe9a0be,
-    0xe9a0bf,
-    0xe9a180,
-    0xe9a181,
-    0xe9a182,
-    0xe9a183,
-    0xe9a184,
-    0xe9a185,
-    0xe9a186,
-    0xe9a187,
-    0xe9a188,
-    0xe9a189,
-    0xe9a18a,
-    0xe9a18b,
-    0xe9a18c,
-    0xe9a18d,
-    0xe9a18e,
-    0xe9a18f,
-    0xe9a190,
-    0xe9a191,
-    0xe9a192,
-    0xe9a193,
-    0xe9a194,
-    0xe9a195,
-    0xe9a196,
-    0xe9a197,
-    0xe9a198,
-    0xe9a199,
-    0xe9a19a,
-    0xe9a19b,
-    0xe9a19c,
-    0xe9a19d,
-    0xe9a19e,
-    0xe9a19f,
-    0xe9a1a0,
-    0xe9a1a1,
-    0xe9a1a2,
-    0xe9a1a3,
-    0xe9a1a4,
-    0xe9a1a5,
-    0xe9a1a6,
-    0xe9a1a7,
-    0xe9a1a8,
-    0xe9a1a9,
-    0xe9a1aa,
-    0xe9a1ab,
-    0xe9a1ac,
-    0xe9a1ad,
-    0xe9a1ae,
-    0xe9a1af,
-    0xe9a1b0,
-    0xe9a1b1,
-    0xe9a1b2,
-    0xe9a1b3,
-    0xe9a1b4,
-    0xe9a1b5,
-    0xe9a1b6,
-    0xe9a1b7,
-    0xe9a1b8,
-    0xe9a1b9,
-    0xe9a1ba,
-    0xe9a1bb,
-    0xe9a1bc,
-    0xe9a1bd,
-    0xe9a1be,
-    0xe9a1bf,
-    0xe9a280,
-    0xe9a281,
-    0xe9a282,
-    0xe9a283,
-    0xe9a284,
-    0xe9a285,
-    0xe9a286,
-    0xe9a287,
-    0xe9a288,
-    0xe9a289,
-    0xe9a28a,
-    0xe9a28b,
-    0xe9a28c,
-    0xe9a28d,
-    0xe9a28e,
-    0xe9a28f,
-    0xe9a290,
-    0xe9a291,
-    0xe9a292,
-    0xe9a293,
-    0xe9a294,
-    0xe9a295,
-    0xe9a296,
-    0xe9a297,
-    0xe9a298,
-    0xe9a299,
-    0xe9a29a,
-    0xe9a29b,
-    0xe9a29c,
-    0xe9a29d,
-    0xe9a29e,
-    0xe9a29f,
-    0xe9a2a0,
-    0xe9a2a1,
-    0xe9a2a2,
-    0xe9a2a3,
-    0xe9a2a4,
-    0xe9a2a5,
-    0xe9a2a6,
-    0xe9a2a7,
-    0xe9a2a8,
-    0xe9a2a9,
-    0xe9a2aa,
-    0xe9a2ab,
-    0xe9a2ac,
-    0xe9a2ad,
-    0xe9a2ae,
-    0xe9a2af,
-    0xe9a2b0,
-    0xe9a2b1,
-    0xe9a2b2,
-    0xe9a2b3,
-    0xe9a2b4,
-    0xe9a2b5,
-    0xe9a2b6,
-    0xe9a2b7,
-    0xe9a2b8,
-    0xe9a2b9,
-    0xe9a2ba,
-    0xe9a2bb,
-    0xe9a2bc,
-    0xe9a2bd,
-    0xe9a2be,
-    0xe9a2bf,
-    0xe9a380,
-    0xe9a381,
-    0xe9a382,
-    0xe9a383,
-    0xe9a384,
-    0xe9a385,
-    0xe9a386,
-    0xe9a387,
-    0xe9a388,
-    0xe9a389,
-    0xe9a38a,
-    0xe9a38b,
-    0xe9a38c,
-    0xe9a38d,
-    0xe9a38e,
-    0xe9a38f,
-    0xe9a390,
-    0xe9a391,
-    0xe9a392,
-    0xe9a393,
-    0xe9a394,
-    0xe9a395,
-    0xe9a396,
-    0xe9a397,
-    0xe9a398,
-    0xe9a399,
-    0xe9a39a,
-    0xe9a39b,
-    0xe9a39c,
-    0xe9a39d,
-    0xe9a39e,
-    0xe9a39f,
-    0xe9a3a0,
-    0xe9a3a1,
-    0xe9a3a2,
-    0xe9a3a3,
-    0xe9a3a4,
-    0xe9a3a5,
-    0xe9a3a6,
-    0xe9a3a7,
-    0xe9a3a8,
-    0xe9a3a9,
-    0xe9a3aa,
-    0xe9a3ab,
-    0xe9a3ac,
-    0xe9a3ad,
-    0xe9a3ae,
-    0xe9a3af,
-    0xe9a3b0,
-    0xe9a3b1,
-    0xe9a3b2,
-    0xe9a3b3,
-    0xe9a3b4,
-    0xe9a3b5,
-    0xe9a3b6,
-    0xe9a3b7,
-    0xe9a3b8,
-    0xe9a3b9,
-    0xe9a3ba,
-    0xe9a3bb,
-    0xe9a3bc,
-    0xe9a3bd,
-    0xe9a3be,
-    0xe9a3bf,
-    0xe9a480,
-    0xe9a481,
-    0xe9a482,
-    0xe9a483,
-    0xe9a484,
-    0xe9a485,
-    0xe9a486,
-    0xe9a487,
-    0xe9a488,
-    0xe9a489,
-    0xe9a48a,
-    0xe9a48b,
-    0xe9a48c,
-    0xe9a48d,
-    0xe9a48e,
-    0xe9a48f,
-    0xe9a490,
-    0xe9a491,
-    0xe9a492,
-    0xe9a493,
-    0xe9a494,
-    0xe9a495,
-    0xe9a496,
-    0xe9a497,
-    0xe9a498,
-    0xe9a499,
-    0xe9a49a,
-    0xe9a49b,
-    0xe9a49c,
-    0xe9a49d,
-    0xe9a49e,
-    0xe9a49f,
-    0xe9a4a0,
-    0xe9a4a1,
-    0xe9a4a2,
-    0xe9a4a3,
-    0xe9a4a4,
-    0xe9a4a5,
-    0xe9a4a6,
-    0xe9a4a7,
-    0xe9a4a8,
-    0xe9a4a9,
-    0xe9a4aa,
-    0xe9a4ab,
-    0xe9a4ac,
-    0xe9a4ad,
-    0xe9a4ae,
-    0xe9a4af,
-    0xe9a4b0,
-    0xe9a4b1,
-    0xe9a4b2,
-    0xe9a4b3,
-    0xe9a4b4,
-    0xe9a4b5,
-    0xe9a4b6,
-    0xe9a4b7,
-    0xe9a4b8,
-    0xe9a4b9,
-    0xe9a4ba,
-    0xe9a4bb,
-    0xe9a4bc,
-    0xe9a4bd,
-    0xe9a4be,
-    0xe9a4bf,
-    0xe9a580,
-    0xe9a581,
-    0xe9a582,
-    0xe9a583,
-    0xe9a584,
-    0xe9a585,
-    0xe9a586,
-    0xe9a587,
-    0xe9a588,
-    0xe9a589,
-    0xe9a58a,
-    0xe9a58b,
-    0xe9a58c,
-    0xe9a58d,
-    0xe9a58e,
-    0xe9a58f,
-    0xe9a590,
-    0xe9a591,
-    0xe9a592,
-    0xe9a593,
-    0xe9a594,
-    0xe9a595,
-    0xe9a596,
-    0xe9a597,
-    0xe9a598,
-    0xe9a599,
-    0xe9a59a,
-    0xe9a59b,
-    0xe9a59c,
-    0xe9a59d,
-    0xe9a59e,
-    0xe9a59f,
-    0xe9a5a0,
-    0xe9a5a1,
-    0xe9a5a2,
-    0xe9a5a3,
-    0xe9a5a4,
-    0xe9a5a5,
-    0xe9a5a6,
-    0xe9a5a7,
-    0xe9a5a8,
-    0xe9a5a9,
-    0xe9a5aa,
-    0xe9a5ab,
-    0xe9a5ac,
-    0xe9a5ad,
-    0xe9a5ae,
-    0xe9a5af,
-    0xe9a5b0,
-    0xe9a5b1,
-    0xe9a5b2,
-    0xe9a5b3,
-    0xe9a5b4,
-    0xe9a5b5,
-    0xe9a5b6,
-    0xe9a5b7,
-    0xe9a5b8,
-    0xe9a5b9,
-    0xe9a5ba,
-    0xe9a5bb,
-    0xe9a5bc,
-    0xe9a5bd,
-    0xe9a5be,
-    0xe9a5bf,
-    0xe9a680,
-    0xe9a681,
-    0xe9a682,
-    0xe9a683,
-    0xe9a684,
-    0xe9a685,
-    0xe9a686,
-    0xe9a687,
-    0xe9a688,
-    0xe9a689,
-    0xe9a68a,
-    0xe9a68b,
-    0xe9a68c,
-    0xe9a68d,
-    0xe9a68e,
-    0xe9a68f,
-    0xe9a690,
-    0xe9a691,
-    0xe9a692,
-    0xe9a693,
-    0xe9a694,
-    0xe9a695,
-    0xe9a696,
-    0xe9a697,
-    0xe9a698,
-    0xe9a699,
-    0xe9a69a,
-    0xe9a69b,
-    0xe9a69c,
-    0xe9a69d,
-    0xe9a69e,
-    0xe9a69f,
-    0xe9a6a0,
-    0xe9a6a1,
-    0xe9a6a2,
-    0xe9a6a3,
-    0xe9a6a4,
-    0xe9a6a5,
-    0xe9a6a6,
-    0xe9a6a7,
-    0xe9a6a8,
-    0xe9a6a9,
-    0xe9a6aa,
-    0xe9a6ab,
-    0xe9a6ac,
-    0xe9a6ad,
-    0xe9a6ae,
-    0xe9a6af,
-    0xe9a6b0,
-    0xe9a6b1,
-    0xe9a6b2,
-    0xe9a6b3,
-    0xe9a6b4,
-    0xe9a6b5,
-    0xe9a6b6,
-    0xe9a6b7,
-    0xe9a6b8,
-    0xe9a6b9,
-    0xe9a6ba,
-    0xe9a6bb,
-    0xe9a6bc,
-    0xe9a6bd,
-    0xe9a6be,
-    0xe9a6bf,
-    0xe9a780,
-    0xe9a781,
-    0xe9a782,
-    0xe9a783,
-    0xe9a784,
-    0xe9a785,
-    0xe9a786,
-    0xe9a787,
-    0xe9a788,
-    0xe9a789,
-    0xe9a78a,
-    0xe9a78b,
-    0xe9a78c,
-    0xe9a78d,
-    0xe9a78e,
-    0xe9a78f,
-    0xe9a790,
-    0xe9a791,
-    0xe9a792,
-    0xe9a793,
-    0xe9a794,
-    0xe9a795,
-    0xe9a796,
-    0xe9a797,
-    0xe9a798,
-    0xe9a799,
-    0xe9a79a,
-    0xe9a79b,
-    0xe9a79c,
-    0xe9a79d,
-    0xe9a79e,
-    0xe9a79f,
-    0xe9a7a0,
-    0xe9a7a1,
-    0xe9a7a2,
-    0xe9a7a3,
-    0xe9a7a4,
-    0xe9a7a5,
-    0xe9a7a6,
-    0xe9a7a7,
-    0xe9a7a8,
-    0xe9a7a9,
-    0xe9a7aa,
-    0xe9a7ab,
-    0xe9a7ac,
-    0xe9a7ad,
-    0xe9a7ae,
-    0xe9a7af,
-    0xe9a7b0,
-    0xe9a7b1,
-    0xe9a7b2,
-    0xe9a7b3,
-    0xe9a7b4,
-    0xe9a7b5,
-    0xe9a7b6,
-    0xe9a7b7,
-    0xe9a7b8,
-    0xe9a7b9,
-    0xe9a7ba,
-    0xe9a7bb,
-    0xe9a7bc,
-    0xe9a7bd,
-    0xe9a7be,
-    0xe9a7bf,
-    0xe9a880,
-    0xe9a881,
-    0xe9a882,
-    0xe9a883,
-    0xe9a884,
-    0xe9a885,
-    0xe9a886,
-    0xe9a887,
-    0xe9a888,
-    0xe9a889,
-    0xe9a88a,
-    0xe9a88b,
-    0xe9a88c,
-    0xe9a88d,
-    0xe9a88e,
-    0xe9a88f,
-    0xe9a890,
-    0xe9a891,
-    0xe9a892,
-    0xe9a893,
-    0xe9a894,
-    0xe9a895,
-    0xe9a896,
-    0xe9a897,
-    0xe9a898,
-    0xe9a899,
-    0xe9a89a,
-    0xe9a89b,
-    0xe9a89c,
-    0xe9a89d,
-    0xe9a89e,
-    0xe9a89f,
-    0xe9a8a0,
-    0xe9a8a1,
-    0xe9a8a2,
-    0xe9a8a3,
-    0xe9a8a4,
-    0xe9a8a5,
-    0xe9a8a6,
-    0xe9a8a7,
-    0xe9a8a8,
-    0xe9a8a9,
-    0xe9a8aa,
-    0xe9a8ab,
-    0xe9a8ac,
-    0xe9a8ad,
-    0xe9a8ae,
-    0xe9a8af,
-    0xe9a8b0,
-    0xe9a8b1,
-    0xe9a8b2,
-    0xe9a8b3,
-    0xe9a8b4,
-    0xe9a8b5,
-    0xe9a8b6,
-    0xe9a8b7,
-    0xe9a8b8,
-    0xe9a8b9,
-    0xe9a8ba,
-    0xe9a8bb,
-    0xe9a8bc,
-    0xe9a8bd,
-    0xe9a8be,
-    0xe9a8bf,
-    0xe9a980,
-    0xe9a981,
-    0xe9a982,
-    0xe9a983,
-    0xe9a984,
-    0xe9a985,
-    0xe9a986,
-    0xe9a987,
-    0xe9a988,
-    0xe9a989,
-    0xe9a98a,
-    0xe9a98b,
-    0xe9a98c,
-    0xe9a98d,
-    0xe9a98e,
-    0xe9a98f,
-    0xe9a990,
-    0xe9a991,
-    0xe9a992,
-    0xe9a993,
-    0xe9a994,
-    0xe9a995,
-    0xe9a996,
-    0xe9a997,
-    0xe9a998,
-    0xe9a999,
-    0xe9a99a,
-    0xe9a99b,
-    0xe9a99c,
-    0xe9a99d,
-    0xe9a99e,
-    0xe9a99f,
-    0xe9a9a0,
-    0xe9a9a1,
-    0xe9a9a2,
-    0xe9a9a3,
-    0xe9a9a4,
-    0xe9a9a5,
-    0xe9a9a6,
-    0xe9a9a7,
-    0xe9a9a8,
-    0xe9a9a9,
-    0xe9a9aa,
-    0xe9a9ab,
-    0xe9a9ac,
-    0xe9a9ad,
-    0xe9a9ae,
-    0xe9a9af,
-    0xe9a9b0,
-    0xe9a9b1,
-    0xe9a9b2,
-    0xe9a9b3,
-    0xe9a9b4,
-    0xe9a9b5,
-    0xe9a9b6,
-    0xe9a9b7,
-    0xe9a9b8,
-    0xe9a9b9,
-    0xe9a9ba,
-    0xe9a9bb,
-    0xe9a9bc,
-    0xe9a9bd,
-    0xe9a9be,
-    0xe9a9bf,
-    0xe9aa80,
-    0xe9aa81,
-    0xe9aa82,
-    0xe9aa83,
-    0xe9aa84,
-    0xe9aa85,
-    0xe9aa86,
-    0xe9aa87,
-    0xe9aa88,
-    0xe9aa89,
-    0xe9aa8a,
-    0xe9aa8b,
-    0xe9aa8c,
-    0xe9aa8d,
-    0xe9aa8e,
-    0xe9aa8f,
-    0xe9aa90,
-    0xe9aa91,
-    0xe9aa92,
-    0xe9aa93,
-    0xe9aa94,
-    0xe9aa95,
-    0xe9aa96,
-    0xe9aa97,
-    0xe9aa98,
-    0xe9aa99,
-    0xe9aa9a,
-    0xe9aa9b,
-    0xe9aa9c,
-    0xe9aa9d,
-    0xe9aa9e,
-    0xe9aa9f,
-    0xe9aaa0,
-    0xe9aaa1,
-    0xe9aaa2,
-    0xe9aaa3,
-    0xe9aaa4,
-    0xe9aaa5,
-    0xe9aaa6,
-    0xe9aaa7,
-    0xe9aaa8,
-    0xe9aaa9,
-    0xe9aaaa,
-    0xe9aaab,
-    0xe9aaac,
-    0xe9aaad,
-    0xe9aaae,
-    0xe9aaaf,
-    0xe9aab0,
-    0xe9aab1,
-    0xe9aab2,
-    0xe9aab3,
-    0xe9aab4,
-    0xe9aab5,
-    0xe9aab6,
-    0xe9aab7,
-    0xe9aab8,
-    0xe9aab9,
-    0xe9aaba,
-    0xe9aabb,
-    0xe9aabc,
-    0xe9aabd,
-    0xe9aabe,
-    0xe9aabf,
-    0xe9ab80,
-    0xe9ab81,
-    0xe9ab82,
-    0xe9ab83,
-    0xe9ab84,
-    0xe9ab85,
-    0xe9ab86,
-    0xe9ab87,
-    0xe9ab88,
-    0xe9ab89,
-    0xe9ab8a,
-    0xe9ab8b,
-    0xe9ab8c,
-    0xe9ab8d,
-    0xe9ab8e,
-    0xe9ab8f,
-    0xe9ab90,
-    0xe9ab91,
-    0xe9ab92,
-    0xe9ab93,
-    0xe9ab94,
-    0xe9ab95,
-    0xe9ab96,
-    0xe9ab97,
-    0xe9ab98,
-    0xe9ab99,
-    0xe9ab9a,
-    0xe9ab9b,
-    0xe9ab9c,
-    0xe9ab9d,
-    0xe9ab9e,
-    0xe9ab9f,
-    0xe9aba0,
-    0xe9aba1,
-    0xe9aba2,
-    0xe9aba3,
-    0xe9aba4,
-    0xe9aba5,
-    0xe9aba6,
-    0xe9aba7,
-    0xe9aba8,
-    0xe9aba9,
-    0xe9abaa,
-    0xe9abab,
-    0xe9abac,
-    0xe9abad,
-    0xe9abae,
-    0xe9abaf,
-    0xe9abb0,
-    0xe9abb1,
-    0xe9abb2,
-    0xe9abb3,
-    0xe9abb4,
-    0xe9abb5,
-    0xe9abb6,
-    0xe9abb7,
-    0xe9abb8,
-    0xe9abb9,
-    0xe9abba,
-    0xe9abbb,
-    0xe9abbc,
-    0xe9abbd,
-    0xe9abbe,
-    0xe9abbf,
-    0xe9ac80,
-    0xe9ac81,
-    0xe9ac82,
-    0xe9ac83,
-    0xe9ac84,
-    0xe9ac85,
-    0xe9ac86,
-    0xe9ac87,
-    0xe9ac88,
-    0xe9ac89,
-    0xe9ac8a,
-    0xe9ac8b,
-    0xe9ac8c,
-    0xe9ac8d,
-    0xe9ac8e,
-    0xe9ac8f,
-    0xe9ac90,
-    0xe9ac91,
-    0xe9ac92,
-    0xe9ac93,
-    0xe9ac94,
-    0xe9ac95,
-    0xe9ac96,
-    0xe9ac97,
-    0xe9ac98,
-    0xe9ac99,
-    0xe9ac9a,
-    0xe9ac9b,
-    0xe9ac9c,
-    0xe9ac9d,
-    0xe9ac9e,
-    0xe9ac9f,
-    0xe9aca0,
-    0xe9aca1,
-    0xe9aca2,
-    0xe9aca3,
-    0xe9aca4,
-    0xe9aca5,
-    0xe9aca6,
-    0xe9aca7,
-    0xe9aca8,
-    0xe9aca9,
-    0xe9acaa,
-    0xe9acab,
-    0xe9acac,
-    0xe9acad,
-    0xe9acae,
-    0xe9acaf,
-    0xe9acb0,
-    0xe9acb1,
-    0xe9acb2,
-    0xe9acb3,
-    0xe9acb4,
-    0xe9acb5,
-    0xe9acb6,
-    0xe9acb7,
-    0xe9acb8,
-    0xe9acb9,
-    0xe9acba,
-    0xe9acbb,
-    0xe9acbc,
-    0xe9acbd,
-    0xe9acbe,
-    0xe9acbf,
-    0xe9ad80,
-    0xe9ad81,
-    0xe9ad82,
-    0xe9ad83,
-    0xe9ad84,
-    0xe9ad85,
-    0xe9ad86,
-    0xe9ad87,
-    0xe9ad88,
-    0xe9ad89,
-    0xe9ad8a,
-    0xe9ad8b,
-    0xe9ad8c,
-    0xe9ad8d,
-    0xe9ad8e,
-    0xe9ad8f,
-    0xe9ad90,
-    0xe9ad91,
-    0xe9ad92,
-    0xe9ad93,
-    0xe9ad94,
-    0xe9ad95,
-    0xe9ad96,
-    0xe9ad97,
-    0xe9ad98,
-    0xe9ad99,
-    0xe9ad9a,
-    0xe9ad9b,
-    0xe9ad9c,
-    0xe9ad9d,
-    0xe9ad9e,
-    0xe9ad9f,
-    0xe9ada0,
-    0xe9ada1,
-    0xe9ada2,
-    0xe9ada3,
-    0xe9ada4,
-    0xe9ada5,
-    0xe9ada6,
-    0xe9ada7,
-    0xe9ada8,
-    0xe9ada9,
-    0xe9adaa,
-    0xe9adab,
-    0xe9adac,
-    0xe9adad,
-    0xe9adae,
-    0xe9adaf,
-    0xe9adb0,
-    0xe9adb1,
-    0xe9adb2,
-    0xe9adb3,
-    0xe9adb4,
-    0xe9adb5,
-    0xe9adb6,
-    0xe9adb7,
-    0xe9adb8,
-    0xe9adb9,
-    0xe9adba,
-    0xe9adbb,
-    0xe9adbc,
-    0xe9adbd,
-    0xe9adbe,
-    0xe9adbf,
-    0xe9ae80,
-    0xe9ae81,
-    0xe9ae82,
-    0xe9ae83,
-    0xe9ae84,
-    0xe9ae85,
-    0xe9ae86,
-    0xe9ae87,
-    0xe9ae88,
-    0xe9ae89,
-    0xe9ae8a,
-    0xe9ae8b,
-    0xe9ae8c,
-    0xe9ae8d,
-    0xe9ae8e,
-    0xe9ae8f,
-    0xe9ae90,
-    0xe9ae91,
-    0xe9ae92,
-    0xe9ae93,
-    0xe9ae94,
-    0xe9ae95,
-    0xe9ae96,
-    0xe9ae97,
-    0xe9ae98,
-    0xe9ae99,
-    0xe9ae9a,
-    0xe9ae9b,
-    0xe9ae9c,
-    0xe9ae9d,
-    0xe9ae9e,
-    0xe9ae9f,
-    0xe9aea0,
-    0xe9aea1,
-    0xe9aea2,
-    0xe9aea3,
-    0xe9aea4,
-    0xe9aea5,
-    0xe9aea6,
-    0xe9aea7,
-    0xe9aea8,
-    0xe9aea9,
-    0xe9aeaa,
-    0xe9aeab,
-    0xe9aeac,
-    0xe9aead,
-    0xe9aeae,
-    0xe9aeaf,
-    0xe9aeb0,
-    0xe9aeb1,
-    0xe9aeb2,
-    0xe9aeb3,
-    0xe9aeb4,
-    0xe9aeb5,
-    0xe9aeb6,
-    0xe9aeb7,
-    0xe9aeb8,
-    0xe9aeb9,
-    0xe9aeba,
-    0xe9aebb,
-    0xe9aebc,
-    0xe9aebd,
-    0xe9aebe,
-    0xe9aebf,
-    0xe9af80,
-    0xe9af81,
-    0xe9af82,
-    0xe9af83,
-    0xe9af84,
-    0xe9af85,
-    0xe9af86,
-    0xe9af87,
-    0xe9af88,
-    0xe9af89,
-    0xe9af8a,
-    0xe9af8b,
-    0xe9af8c,
-    0xe9af8d,
-    0xe9af8e,
-    0xe9af8f,
-    0xe9af90,
-    0xe9af91,
-    0xe9af92,
-    0xe9af93,
-    0xe9af94,
-    0xe9af95,
-    0xe9af96,
-    0xe9af97,
-    0xe9af98,
-    0xe9af99,
-    0xe9af9a,
-    0xe9af9b,
-    0xe9af9c,
-    0xe9af9d,
-    0xe9af9e,
-    0xe9af9f,
-    0xe9afa0,
-    0xe9afa1,
-    0xe9afa2,
-    0xe9afa3,
-    0xe9afa4,
-    0xe9afa5,
-    0xe9afa6,
-    0xe9afa7,
-    0xe9afa8,
-    0xe9afa9,
-    0xe9afaa,
-    0xe9afab,
-    0xe9afac,
-    0xe9afad,
-    0xe9afae,
-    0xe9afaf,
-    0xe9afb0,
-    0xe9afb1,
-    0xe9afb2,
-    0xe9afb3,
-    0xe9afb4,
-    0xe9afb5,
-    0xe9afb6,
-    0xe9afb7,
-    0xe9afb8,
-    0xe9afb9,
-    0xe9afba,
-    0xe9afbb,
-    0xe9afbc,
-    0xe9afbd,
-    0xe9afbe,
-    0xe9afbf,
-    0xe9b080,
-    0xe9b081,
-    0xe9b082,
-    0xe9b083,
-    0xe9b084,
-    0xe9b085,
-    0xe9b086,
-    0xe9b087,
-    0xe9b088,
-    0xe9b089,
-    0xe9b08a,
-    0xe9b08b,
-    0xe9b08c,
-    0xe9b08d,
-    0xe9b08e,
-    0xe9b08f,
-    0xe9b090,
-    0xe9b091,
-    0xe9b092,
-    0xe9b093,
-    0xe9b094,
-    0xe9b095,
-    0xe9b096,
-    0xe9b097,
-    0xe9b098,
-    0xe9b099,
-    0xe9b09a,
-    0xe9b09b,
-    0xe9b09c,
-    0xe9b09d,
-    0xe9b09e,
-    0xe9b09f,
-    0xe9b0a0,
-    0xe9b0a1,
-    0xe9b0a2,
-    0xe9b0a3,
-    0xe9b0a4,
-    0xe9b0a5,
-    0xe9b0a6,
-    0xe9b0a7,
-    0xe9b0a8,
-    0xe9b0a9,
-    0xe9b0aa,
-    0xe9b0ab,
-    0xe9b0ac,
-    0xe9b0ad,
-    0xe9b0ae,
-    0xe9b0af,
-    0xe9b0b0,
-    0xe9b0b1,
-    0xe9b0b2,
-    0xe9b0b3,
-    0xe9b0b4,
-    0xe9b0b5,
-    0xe9b0b6,
-    0xe9b0b7,
-    0xe9b0b8,
-    0xe9b0b9,
-    0xe9b0ba,
-    0xe9b0bb,
-    0xe9b0bc,
-    0xe9b0bd,
-    0xe9b0be,
-    0xe9b0bf,
-    0xe9b180,
-    0xe9b181,
-    0xe9b182,
-    0xe9b183,
-    0xe9b184,
-    0xe9b185,
-    0xe9b186,
-    0xe9b187,
-    0xe9b188,
-    0xe9b189,
-    0xe9b18a,
-    0xe9b18b,
-    0xe9b18c,
-    0xe9b18d,
-    0xe9b18e,
-    0xe9b18f,
-    0xe9b190,
-    0xe9b191,
-    0xe9b192,
-    0xe9b193,
-    0xe9b194,
-    0xe9b195,
-    0xe9b196,
-    0xe9b197,
-    0xe9b198,
-    0xe9b199,
-    0xe9b19a,
-    0xe9b19b,
-    0xe9b19c,
-    0xe9b19d,
-    0xe9b19e,
-    0xe9b19f,
-    0xe9b1a0,
-    0xe9b1a1,
-    0xe9b1a2,
-    0xe9b1a3,
-    0xe9b1a4,
-    0xe9b1a5,
-    0xe9b1a6,
-    0xe9b1a7,
-    0xe9b1a8,
-    0xe9b1a9,
-    0xe9b1aa,
-    0xe9b1ab,
-    0xe9b1ac,
-    0xe9b1ad,
-    0xe9b1ae,
-    0xe9b1af,
-    0xe9b1b0,
-    0xe9b1b1,
-    0xe9b1b2,
-    0xe9b1b3,
-    0xe9b1b4,
-    0xe9b1b5,
-    0xe9b1b6,
-    0xe9b1b7,
-    0xe9b1b8,
-    0xe9b1b9,
-    0xe9b1ba,
-    0xe9b1bb,
-    0xe9b1bc,
-    0xe9b1bd,
-    0xe9b1be,
-    0xe9b1bf,
-    0xe9b280,
-    0xe9b281,
-    0xe9b282,
-    0xe9b283,
-    0xe9b284,
-    0xe9b285,
-    0xe9b286,
-    0xe9b287,
-    0xe9b288,
-    0xe9b289,
-    0xe9b28a,
-    0xe9b28b,
-    0xe9b28c,
-    0xe9b28d,
-    0xe9b28e,
-    0xe9b28f,
-    0xe9b290,
-    0xe9b291,
-    0xe9b292,
-    0xe9b293,
-    0xe9b294,
-    0xe9b295,
-    0xe9b296,
-    0xe9b297,
-    0xe9b298,
-    0xe9b299,
-    0xe9b29a,
-    0xe9b29b,
-    0xe9b29c,
-    0xe9b29d,
-    0xe9b29e,
-    0xe9b29f,
-    0xe9b2a0,
-    0xe9b2a1,
-    0xe9b2a2,
-    0xe9b2a3,
-    0xe9b2a4,
-    0xe9b2a5,
-    0xe9b2a6,
-    0xe9b2a7,
-    0xe9b2a8,
-    0xe9b2a9,
-    0xe9b2aa,
-    0xe9b2ab,
-    0xe9b2ac,
-    0xe9b2ad,
-    0xe9b2ae,
-    0xe9b2af,
-    0xe9b2b0,
-    0xe9b2b1,
-    0xe9b2b2,
-    0xe9b2b3,
-    0xe9b2b4,
-    0xe9b2b5,
-    0xe9b2b6,
-    0xe9b2b7,
-    0xe9b2b8,
-    0xe9b2b9,
-    0xe9b2ba,
-    0xe9b2bb,
-    0xe9b2bc,
-    0xe9b2bd,
-    0xe9b2be,
-    0xe9b2bf,
-    0xe9b380,
-    0xe9b381,
-    0xe9b382,
-    0xe9b383,
-    0xe9b384,
-    0xe9b385,
-    0xe9b386,
-    0xe9b387,
-    0xe9b388,
-    0xe9b389,
-    0xe9b38a,
-    0xe9b38b,
-    0xe9b38c,
-    0xe9b38d,
-    0xe9b38e,
-    0xe9b38f,
-    0xe9b390,
-    0xe9b391,
-    0xe9b392,
-    0xe9b393,
-    0xe9b394,
-    0xe9b395,
-    0xe9b396,
-    0xe9b397,
-    0xe9b398,
-    0xe9b399,
-    0xe9b39a,
-    0xe9b39b,
-    0xe9b39c,
-    0xe9b39d,
-    0xe9b39e,
-    0xe9b39f,
-    0xe9b3a0,
-    0xe9b3a1,
-    0xe9b3a2,
-    0xe9b3a3,
-    0xe9b3a4,
-    0xe9b3a5,
-    0xe9b3a6,
-    0xe9b3a7,
-    0xe9b3a8,
-    0xe9b3a9,
-    0xe9b3aa,
-    0xe9b3ab,
-    0xe9b3ac,
-    0xe9b3ad,
-    0xe9b3ae,
-    0xe9b3af,
-    0xe9b3b0,
-    0xe9b3b1,
-    0xe9b3b2,
-    0xe9b3b3,
-    0xe9b3b4,
-    0xe9b3b5,
-    0xe9b3b6,
-    0xe9b3b7,
-    0xe9b3b8,
-    0xe9b3b9,
-    0xe9b3ba,
-    0xe9b3bb,
-    0xe9b3bc,
-    0xe9b3bd,
-    0xe9b3be,
-    0xe9b3bf,
-    0xe9b480,
-    0xe9b481,
-    0xe9b482,
-    0xe9b483,
-    0xe9b484,
-    0xe9b485,
-    0xe9b486,
-    0xe9b487,
-    0xe9b488,
-    0xe9b489,
-    0xe9b48a,
-    0xe9b48b,
-    0xe9b48c,
-    0xe9b48d,
-    0xe9b48e,
-    0xe9b48f,
-    0xe9b490,
-    0xe9b491,
-    0xe9b492,
-    0xe9b493,
-    0xe9b494,
-    0xe9b495,
-    0xe9b496,
-    0xe9b497,
-    0xe9b498,
-    0xe9b499,
-    0xe9b49a,
-    0xe9b49b,
-    0xe9b49c,
-    0xe9b49d,
-    0xe9b49e,
-    0xe9b49f,
-    0xe9b4a0,
-    0xe9b4a1,
-    0xe9b4a2,
-    0xe9b4a3,
-    0xe9b4a4,
-    0xe9b4a5,
-    0xe9b4a6,
-    0xe9b4a7,
-    0xe9b4a8,
-    0xe9b4a9,
-    0xe9b4aa,
-    0xe9b4ab,
-    0xe9b4ac,
-    0xe9b4ad,
-    0xe9b4ae,
-    0xe9b4af,
-    0xe9b4b0,
-    0xe9b4b1,
-    0xe9b4b2,
-    0xe9b4b3,
-    0xe9b4b4,
-    0xe9b4b5,
-    0xe9b4b6,
-    0xe9b4b7,
-    0xe9b4b8,
-    0xe9b4b9,
-    0xe9b4ba,
-    0xe9b4bb,
-    0xe9b4bc,
-    0xe9b4bd,
-    0xe9b4be,
-    0xe9b4bf,
-    0xe9b580,
-    0xe9b581,
-    0xe9b582,
-    0xe9b583,
-    0xe9b584,
-    0xe9b585,
-    0xe9b586,
-    0xe9b587,
-    0xe9b588,
-    0xe9b589,
-    0xe9b58a,
-    0xe9b58b,
-    0xe9b58c,
-    0xe9b58d,
-    0xe9b58e,
-    0xe9b58f,
-    0xe9b590,
-    0xe9b591,
-    0xe9b592,
-    0xe9b593,
-    0xe9b594,
-    0xe9b595,
-    0xe9b596,
-    0xe9b597,
-    0xe9b598,
-    0xe9b599,
-    0xe9b59a,
-    0xe9b59b,
-    0xe9b59c,
-    0xe9b59d,
-    0xe9b59e,
-    0xe9b59f,
-    0xe9b5a0,
-    0xe9b5a1,
-    0xe9b5a2,
-    0xe9b5a3,
-    0xe9b5a4,
-    0xe9b5a5,
-    0xe9b5a6,
-    0xe9b5a7,
-    0xe9b5a8,
-    0xe9b5a9,
-    0xe9b5aa,
-    0xe9b5ab,
-    0xe9b5ac,
-    0xe9b5ad,
-    0xe9b5ae,
-    0xe9b5af,
-    0xe9b5b0,
-    0xe9b5b1,
-    0xe9b5b2,
-    0xe9b5b3,
-    0xe9b5b4,
-    0xe9b5b5,
-    0xe9b5b6,
-    0xe9b5b7,
-    0xe9b5b8,
-    0xe9b5b9,
-    0xe9b5ba,
-    0xe9b5bb,
-    0xe9b5bc,
-    0xe9b5bd,
-    0xe9b5be,
-    0xe9b5bf,
-    0xe9b680,
-    0xe9b681,
-    0xe9b682,
-    0xe9b683,
-    0xe9b684,
-    0xe9b685,
-    0xe9b686,
-    0xe9b687,
-    0xe9b688,
-    0xe9b689,
-    0xe9b68a,
-    0xe9b68b,
-    0xe9b68c,
-    0xe9b68d,
-    0xe9b68e,
-    0xe9b68f,
-    0xe9b690,
-    0xe9b691,
-    0xe9b692,
-    0xe9b693,
-    0xe9b694,
-    0xe9b695,
-    0xe9b696,
-    0xe9b697,
-    0xe9b698,
-    0xe9b699,
-    0xe9b69a,
-    0xe9b69b,
-    0xe9b69c,
-    0xe9b69d,
-    0xe9b69e,
-    0xe9b69f,
-    0xe9b6a0,
-    0xe9b6a1,
-    0xe9b6a2,
-    0xe9b6a3,
-    0xe9b6a4,
-    0xe9b6a5,
-    0xe9b6a6,
-    0xe9b6a7,
-    0xe9b6a8,
-    0xe9b6a9,
-    0xe9b6aa,
-    0xe9b6ab,
-    0xe9b6ac,
-    0xe9b6ad,
-    0xe9b6ae,
-    0xe9b6af,
-    0xe9b6b0,
-    0xe9b6b1,
-    0xe9b6b2,
-    0xe9b6b3,
-    0xe9b6b4,
-    0xe9b6b5,
-    0xe9b6b6,
-    0xe9b6b7,
-    0xe9b6b8,
-    0xe9b6b9,
-    0xe9b6ba,
-    0xe9b6bb,
-    0xe9b6bc,
-    0xe9b6bd,
-    0xe9b6be,
-    0xe9b6bf,
-    0xe9b780,
-    0xe9b781,
-    0xe9b782,
-    0xe9b783,
-    0xe9b784,
-    0xe9b785,
-    0xe9b786,
-    0xe9b787,
-    0xe9b788,
-    0xe9b789,
-    0xe9b78a,
-    0xe9b78b,
-    0xe9b78c,
-    0xe9b78d,
-    0xe9b78e,
-    0xe9b78f,
-    0xe9b790,
-    0xe9b791,
-    0xe9b792,
-    0xe9b793,
-    0xe9b794,
-    0xe9b795,
-    0xe9b796,
-    0xe9b797,
-    0xe9b798,
-    0xe9b799,
-    0xe9b79a,
-    0xe9b79b,
-    0xe9b79c,
-    0xe9b79d,
-    0xe9b79e,
-    0xe9b79f,
-    0xe9b7a0,
-    0xe9b7a1,
-    0xe9b7a2,
-    0xe9b7a3,
-    0xe9b7a4,
-    0xe9b7a5,
-    0xe9b7a6,
-    0xe9b7a7,
-    0xe9b7a8,
-    0xe9b7a9,
-    0xe9b7aa,
-    0xe9b7ab,
-    0xe9b7ac,
-    0xe9b7ad,
-    0xe9b7ae,
-    0xe9b7af,
-    0xe9b7b0,
-    0xe9b7b1,
-    0xe9b7b2,
-    0xe9b7b3,
-    0xe9b7b4,
-    0xe9b7b5,
-    0xe9b7b6,
-    0xe9b7b7,
-    0xe9b7b8,
-    0xe9b7b9,
-    0xe9b7ba,
-    0xe9b7bb,
-    0xe9b7bc,
-    0xe9b7bd,
-    0xe9b7be,
-    0xe9b7bf,
-    0xe9b880,
-    0xe9b881,
-    0xe9b882,
-    0xe9b883,
-    0xe9b884,
-    0xe9b885,
-    0xe9b886,
-    0xe9b887,
-    0xe9b888,
-    0xe9b889,
-    0xe9b88a,
-    0xe9b88b,
-    0xe9b88c,
-    0xe9b88d,
-    0xe9b88e,
-    0xe9b88f,
-    0xe9b890,
-    0xe9b891,
-    0xe9b892,
-    0xe9b893,
-    0xe9b894,
-    0xe9b895,
-    0xe9b896,
-    0xe9b897,
-    0xe9b898,
-    0xe9b899,
-    0xe9b89a,
-    0xe9b89b,
-    0xe9b89c,
-    0xe9b89d,
-    0xe9b89e,
-    0xe9b89f,
-    0xe9b8a0,
-    0xe9b8a1,
-    0xe9b8a2,
-    0xe9b8a3,
-    0xe9b8a4,
-    0xe9b8a5,
-    0xe9b8a6,
-    0xe9b8a7,
-    0xe9b8a8,
-    0xe9b8a9,
-    0xe9b8aa,
-    0xe9b8ab,
-    0xe9b8ac,
-    0xe9b8ad,
-    0xe9b8ae,
-    0xe9b8af,
-    0xe9b8b0,
-    0xe9b8b1,
-    0xe9b8b2,
-    0xe9b8b3,
-    0xe9b8b4,
-    0xe9b8b5,
-    0xe9b8b6,
-    0xe9b8b7,
-    0xe9b8b8,
-    0xe9b8b9,
-    0xe9b8ba,
-    0xe9b8bb,
-    0xe9b8bc,
-    0xe9b8bd,
-    0xe9b8be,
-    0xe9b8bf,
-    0xe9b980,
-    0xe9b981,
-    0xe9b982,
-    0xe9b983,
-    0xe9b984,
-    0xe9b985,
-    0xe9b986,
-    0xe9b987,
-    0xe9b988,
-    0xe9b989,
-    0xe9b98a,
-    0xe9b98b,
-    0xe9b98c,
-    0xe9b98d,
-    0xe9b98e,
-    0xe9b98f,
-    0xe9b990,
-    0xe9b991,
-    0xe9b992,
-    0xe9b993,
-    0xe9b994,
-    0xe9b995,
-    0xe9b996,
-    0xe9b997,
-    0xe9b998,
-    0xe9b999,
-    0xe9b99a,
-    0xe9b99b,
-    0xe9b99c,
-    0xe9b99d,
-    0xe9b99e,
-    0xe9b99f,
-    0xe9b9a0,
-    0xe9b9a1,
-    0xe9b9a2,
-    0xe9b9a3,
-    0xe9b9a4,
-    0xe9b9a5,
-    0xe9b9a6,
-    0xe9b9a7,
-    0xe9b9a8,
-    0xe9b9a9,
-    0xe9b9aa,
-    0xe9b9ab,
-    0xe9b9ac,
-    0xe9b9ad,
-    0xe9b9ae,
-    0xe9b9af,
-    0xe9b9b0,
-    0xe9b9b1,
-    0xe9b9b2,
-    0xe9b9b3,
-    0xe9b9b4,
-    0xe9b9b5,
-    0xe9b9b6,
-    0xe9b9b7,
-    0xe9b9b8,
-    0xe9b9b9,
-    0xe9b9ba,
-    0xe9b9bb,
-    0xe9b9bc,
-    0xe9b9bd,
-    0xe9b9be,
-    0xe9b9bf,
-    0xe9ba80,
-    0xe9ba81,
-    0xe9ba82,
-    0xe9ba83,
-    0xe9ba84,
-    0xe9ba85,
-    0xe9ba86,
-    0xe9ba87,
-    0xe9ba88,
-    0xe9ba89,
-    0xe9ba8a,
-    0xe9ba8b,
-    0xe9ba8c,
-    0xe9ba8d,
-    0xe9ba8e,
-    0xe9ba8f,
-    0xe9ba90,
-    0xe9ba91,
-    0xe9ba92,
-    0xe9ba93,
-    0xe9ba94,
-    0xe9ba95,
-    0xe9ba96,
-    0xe9ba97,
-    0xe9ba98,
-    0xe9ba99,
-    0xe9ba9a,
-    0xe9ba9b,
-    0xe9ba9c,
-    0xe9ba9d,
-    0xe9ba9e,
-    0xe9ba9f,
-    0xe9baa0,
-    0xe9baa1,
-    0xe9baa2,
-    0xe9baa3,
-    0xe9baa4,
-    0xe9baa5,
-    0xe9baa6,
-    0xe9baa7,
-    0xe9baa8,
-    0xe9baa9,
-    0xe9baaa,
-    0xe9baab,
-    0xe9baac,
-    0xe9baad,
-    0xe9baae,
-    0xe9baaf,
-    0xe9bab0,
-    0xe9bab1,
-    0xe9bab2,
-    0xe9bab3,
-    0xe9bab4,
-    0xe9bab5,
-    0xe9bab6,
-    0xe9bab7,
-    0xe9bab8,
-    0xe9bab9,
-    0xe9baba,
-    0xe9babb,
-    0xe9babc,
-    0xe9babd,
-    0xe9babe,
-    0xe9babf,
-    0xe9bb80,
-    0xe9bb81,
-    0xe9bb82,
-    0xe9bb83,
-    0xe9bb84,
-    0xe9bb85,
-    0xe9bb86,
-    0xe9bb87,
-    0xe9bb88,
-    0xe9bb89,
-    0xe9bb8a,
-    0xe9bb8b,
-    0xe9bb8c,
-    0xe9bb8d,
-    0xe9bb8e,
-    0xe9bb8f,
-    0xe9bb90,
-    0xe9bb91,
-    0xe9bb92,
-    0xe9bb93,
-    0xe9bb94,
-    0xe9bb95,
-    0xe9bb96,
-    0xe9bb97,
-    0xe9bb98,
-    0xe9bb99,
-    0xe9bb9a,
-    0xe9bb9b,
-    0xe9bb9c,
-    0xe9bb9d,
-    0xe9bb9e,
-    0xe9bb9f,
-    0xe9bba0,
-    0xe9bba1,
-    0xe9bba2,
-    0xe9bba3,
-    0xe9bba4,
-    0xe9bba5,
-    0xe9bba6,
-    0xe9bba7,
-    0xe9bba8,
-    0xe9bba9,
-    0xe9bbaa,
-    0xe9bbab,
-    0xe9bbac,
-    0xe9bbad,
-    0xe9bbae,
-    0xe9bbaf,
-    0xe9bbb0,
-    0xe9bbb1,
-    0xe9bbb2,
-    0xe9bbb3,
-    0xe9bbb4,
-    0xe9bbb5,
-    0xe9bbb6,
-    0xe9bbb7,
-    0xe9bbb8,
-    0xe9bbb9,
-    0xe9bbba,
-    0xe9bbbb,
-    0xe9bbbc,
-    0xe9bbbd,
-    0xe9bbbe,
-    0xe9bbbf,
-    0xe9bc80,
-    0xe9bc81,
-    0xe9bc82,
-    0xe9bc83,
-    0xe9bc84,
-    0xe9bc85,
-    0xe9bc86,
-    0xe9bc87,
-    0xe9bc88,
-    0xe9bc89,
-    0xe9bc8a,
-    0xe9bc8b,
-    0xe9bc8c,
-    0xe9bc8d,
-    0xe9bc8e,
-    0xe9bc8f,
-    0xe9bc90,
-    0xe9bc91,
-    0xe9bc92,
-    0xe9bc93,
-    0xe9bc94,
-    0xe9bc95,
-    0xe9bc96,
-    0xe9bc97,
-    0xe9bc98,
-    0xe9bc99,
-    0xe9bc9a,
-    0xe9bc9b,
-    0xe9bc9c,
-    0xe9bc9d,
-    0xe9bc9e,
-    0xe9bc9f,
-    0xe9bca0,
-    0xe9bca1,
-    0xe9bca2,
-    0xe9bca3,
-    0xe9bca4,
-    0xe9bca5,
-    0xe9bca6,
-    0xe9bca7,
-    0xe9bca8,
-    0xe9bca9,
-    0xe9bcaa,
-    0xe9bcab,
-    0xe9bcac,
-    0xe9bcad,
-    0xe9bcae,
-    0xe9bcaf,
-    0xe9bcb0,
-    0xe9bcb1,
-    0xe9bcb2,
-    0xe9bcb3,
-    0xe9bcb4,
-    0xe9bcb5,
-    0xe9bcb6,
-    0xe9bcb7,
-    0xe9bcb8,
-    0xe9bcb9,
-    0xe9bcba,
-    0xe9bcbb,
-    0xe9bcbc,
-    0xe9bcbd,
-    0xe9bcbe,
-    0xe9bcbf,
-    0xe9bd80,
-    0xe9bd81,
-    0xe9bd82,
-    0xe9bd83,
-    0xe9bd84,
-    0xe9bd85,
-    0xe9bd86,
-    0xe9bd87,
-    0xe9bd88,
-    0xe9bd89,
-    0xe9bd8a,
-    0xe9bd8b,
-    0xe9bd8c,
-    0xe9bd8d,
-    0xe9bd8e,
-    0xe9bd8f,
-    0xe9bd90,
-    0xe9bd91,
-    0xe9bd92,
-    0xe9bd93,
-    0xe9bd94,
-    0xe9bd95,
-    0xe9bd96,
-    0xe9bd97,
-    0xe9bd98,
-    0xe9bd99,
-    0xe9bd9a,
-    0xe9bd9b,
-    0xe9bd9c,
-    0xe9bd9d,
-    0xe9bd9e,
-    0xe9bd9f,
-    0xe9bda0,
-    0xe9bda1,
-    0xe9bda2,
-    0xe9bda3,
-    0xe9bda4,
-    0xe9bda5,
-    0xe9bda6,
-    0xe9bda7,
-    0xe9bda8,
-    0xe9bda9,
-    0xe9bdaa,
-    0xe9bdab,
-    0xe9bdac,
-    0xe9bdad,
-    0xe9bdae,
-    0xe9bdaf,
-    0xe9bdb0,
-    0xe9bdb1,
-    0xe9bdb2,
-    0xe9bdb3,
-    0xe9bdb4,
-    0xe9bdb5,
-    0xe9bdb6,
-    0xe9bdb7,
-    0xe9bdb8,
-    0xe9bdb9,
-    0xe9bdba,
-    0xe9bdbb,
-    0xe9bdbc,
-    0xe9bdbd,
-    0xe9bdbe,
-    0xe9bdbf,
-    0xe9be80,
-    0xe9be81,
-    0xe9be82,
-    0xe9be83,
-    0xe9be84,
-    0xe9be85,
-    0xe9be86,
-    0xe9be87,
-    0xe9be88,
-    0xe9be89,
-    0xe9be8a,
-    0xe9be8b,
-    0xe9be8c,
-    0xe9be8d,
-    0xe9be8e,
-    0xe9be8f,
-    0xe9be90,
-    0xe9be91,
-    0xe9be92,
-    0xe9be93,
-    0xe9be94,
-    0xe9be95,
-    0xe9be96,
-    0xe9be97,
-    0xe9be98,
-    0xe9be99,
-    0xe9be9a,
-    0xe9be9b,
-    0xe9be9c,
-    0xe9be9d,
-    0xe9be9e,
-    0xe9be9f,
-    0xe9bea0,
-    0xe9bea1,
-    0xe9bea2,
-    0xe9bea3,
-    0xe9bea4,
-    0xe9bea5,
-    0xe9bea6,
-    0xe9bea7,
-    0xe9bea8,
-    0xe9bea9,
-    0xe9beaa,
-    0xe9beab,
-    0xe9beac,
-    0xe9bead,
-    0xe9beae,
-    0xe9beaf,
-    0xe9beb0,
-    0xe9beb1,
-    0xe9beb2,
-    0xe9beb3,
-    0xe9beb4,
-    0xe9beb5,
-    0xe9beb6,
-    0xe9beb7,
-    0xe9beb8,
-    0xe9beb9,
-    0xe9beba,
-    0xe9bebb,
-    0xe9bebc,
-    0xe9bebd,
-    0xe9bebe,
-    0xe9bebf,
-    0xe9bf80,
-    0xe9bf81,
-    0xe9bf82,
-    0xe9bf83,
-    0xe9bf84,
-    0xe9bf85,
-    0xe9bf86,
-    0xe9bf87,
-    0xe9bf88,
-    0xe9bf89,
-    0xe9bf8a,
-    0xe9bf8b,
-    0xe9bf8c,
-    0xe9bf8d,
-    0xe9bf8e,
-    0xe9bf8f,
-    0xe9bf90,
-    0xe9bf91,
-    0xe9bf92,
-    0xe9bf93,
-    0xe9bf94,
-    0xe9bf95,
-    0xe9bf96,
-    0xe9bf97,
-    0xe9bf98,
-    0xe9bf99,
-    0xe9bf9a,
-    0xe9bf9b,
-    0xe9bf9c,
-    0xe9bf9d,
-    0xe9bf9e,
-    0xe9bf9f,
-    0xe9bfa0,
-    0xe9bfa1,
-    0xe9bfa2,
-    0xe9bfa3,
-    0xe9bfa4,
-    0xe9bfa5,
-    0xe9bfa6,
-    0xe9bfa7,
-    0xe9bfa8,
-    0xe9bfa9,
-    0xe9bfaa,
-    0xe9bfab,
-    0xe9bfac,
-    0xe9bfad,
-    0xe9bfae,
-    0xe9bfaf,
-    0xe9bfb0,
-    0xe9bfb1,
-    0xe9bfb2,
-    0xe9bfb3,
-    0xe9bfb4,
-    0xe9bfb5,
-    0xe9bfb6,
-    0xe9bfb7,
-    0xe9bfb8,
-    0xe9bfb9,
-    0xe9bfba,
-    0xe9bfbb,
-    0xe9bfbc,
-    0xe9bfbd,
-    0xe9bfbe,
-    0xe9bfbf,
-    0xea8080,
-    0xea8081,
-    0xea8082,
-    0xea8083,
-    0xea8084,
-    0xea8085,
-    0xea8086,
-    0xea8087,
-    0xea8088,
-    0xea8089,
-    0xea808a,
-    0xea808b,
-    0xea808c,
-    0xea808d,
-    0xea808e,
-    0xea808f,
-    0xea8090,
-    0xea8091,
-    0xea8092,
-    0xea8093,
-    0xea8094,
-    0xea8095,
-    0xea8096,
-    0xea8097,
-    0xea8098,
-    0xea8099,
-    0xea809a,
-    0xea809b,
-    0xea809c,
-    0xea809d,
-    0xea809e,
-    0xea809f,
-    0xea80a0,
-    0xea80a1,
-    0xea80a2,
-    0xea80a3,
-    0xea80a4,
-    0xea80a5,
-    0xea80a6,
-    0xea80a7,
-    0xea80a8,
-    0xea80a9,
-    0xea80aa,
-    0xea80ab,
-    0xea80ac,
-    0xea80ad,
-    0xea80ae,
-    0xea80af,
-    0xea80b0,
-    0xea80b1,
-    0xea80b2,
-    0xea80b3,
-    0xea80b4,
-    0xea80b5,
-    0xea80b6,
-    0xea80b7,
-    0xea80b8,
-    0xea80b9,
-    0xea80ba,
-    0xea80bb,
-    0xea80bc,
-    0xea80bd,
-    0xea80be,
-    0xea80bf,
-    0xea8180,
-    0xea8181,
-    0xea8182,
-    0xea8183,
-    0xea8184,
-    0xea8185,
-    0xea8186,
-    0xea8187,
-    0xea8188,
-    0xea8189,
-    0xea818a,
-    0xea818b,
-    0xea818c,
-    0xea818d,
-    0xea818e,
-    0xea818f,
-    0xea8190,
-    0xea8191,
-    0xea8192,
-    0xea8193,
-    0xea8194,
-    0xea8195,
-    0xea8196,
-    0xea8197,
-    0xea8198,
-    0xea8199,
-    0xea819a,
-    0xea819b,
-    0xea819c,
-    0xea819d,
-    0xea819e,
-    0xea819f,
-    0xea81a0,
-    0xea81a1,
-    0xea81a2,
-    0xea81a3,
-    0xea81a4,
-    0xea81a5,
-    0xea81a6,
-    0xea81a7,
-    0xea81a8,
-    0xea81a9,
-    0xea81aa,
-    0xea81ab,
-    0xea81ac,
-    0xea81ad,
-    0xea81ae,
-    0xea81af,
-    0xea81b0,
-    0xea81b1,
-    0xea81b2,
-    0xea81b3,
-    0xea81b4,
-    0xea81b5,
-    0xea81b6,
-    0xea81b7,
-    0xea81b8,
-    0xea81b9,
-    0xea81ba,
-    0xea81bb,
-    0xea81bc,
-    0xea81bd,
-    0xea81be,
-    0xea81bf,
-    0xea8280,
-    0xea8281,
-    0xea8282,
-    0xea8283,
-    0xea8284,
-    0xea8285,
-    0xea8286,
-    0xea8287,
-    0xea8288,
-    0xea8289,
-    0xea828a,
-    0xea828b,
-    0xea828c,
-    0xea828d,
-    0xea828e,
-    0xea828f,
-    0xea8290,
-    0xea8291,
-    0xea8292,
-    0xea8293,
-    0xea8294,
-    0xea8295,
-    0xea8296,
-    0xea8297,
-    0xea8298,
-    0xea8299,
-    0xea829a,
-    0xea829b,
-    0xea829c,
-    0xea829d,
-    0xea829e,
-    0xea829f,
-    0xea82a0,
-    0xea82a1,
-    0xea82a2,
-    0xea82a3,
-    0xea82a4,
-    0xea82a5,
-    0xea82a6,
-    0xea82a7,
-    0xea82a8,
-    0xea82a9,
-    0xea82aa,
-    0xea82ab,
-    0xea82ac,
-    0xea82ad,
-    0xea82ae,
-    0xea82af,
-    0xea82b0,
-    0xea82b1,
-    0xea82b2,
-    0xea82b3,
-    0xea82b4,
-    0xea82b5,
-    0xea82b6,
-    0xea82b7,
-    0xea82b8,
-    0xea82b9,
-    0xea82ba,
-    0xea82bb,
-    0xea82bc,
-    0xea82bd,
-    0xea82be,
-    0xea82bf,
-    0xea8380,
-    0xea8381,
-    0xea8382,
-    0xea8383,
-    0xea8384,
-    0xea8385,
-    0xea8386,
-    0xea8387,
-    0xea8388,
-    0xea8389,
-    0xea838a,
-    0xea838b,
-    0xea838c,
-    0xea838d,
-    0xea838e,
-    0xea838f,
-    0xea8390,
-    0xea8391,
-    0xea8392,
-    0xea8393,
-    0xea8394,
-    0xea8395,
-    0xea8396,
-    0xea8397,
-    0xea8398,
-    0xea8399,
-    0xea839a,
-    0xea839b,
-    0xea839c,
-    0xea839d,
-    0xea839e,
-    0xea839f,
-    0xea83a0,
-    0xea83a1,
-    0xea83a2,
-    0xea83a3,
-    0xea83a4,
-    0xea83a5,
-    0xea83a6,
-    0xea83a7,
-    0xea83a8,
-    0xea83a9,
-    0xea83aa,
-    0xea83ab,
-    0xea83ac,
-    0xea83ad,
-    0xea83ae,
-    0xea83af,
-    0xea83b0,
-    0xea83b1,
-    0xea83b2,
-    0xea83b3,
-    0xea83b4,
-    0xea83b5,
-    0xea83b6,
-    0xea83b7,
-    0xea83b8,
-    0xea83b9,
-    0xea83ba,
-    0xea83bb,
-    0xea83bc,
-    0xea83bd,
-    0xea83be,
-    0xea83bf,
-    0xea8480,
-    0xea8481,
-    0xea8482,
-    0xea8483,
-    0xea8484,
-    0xea8485,
-    0xea8486,
-    0xea8487,
-    0xea8488,
-    0xea8489,
-    0xea848a,
-    0xea848b,
-    0xea848c,
-    0xea848d,
-    0xea848e,
-    0xea848f,
-    0xea8490,
-    0xea8491,
-    0xea8492,
-    0xea8493,
-    0xea8494,
-    0xea8495,
-    0xea8496,
-    0xea8497,
-    0xea8498,
-    0xea8499,
-    0xea849a,
-    0xea849b,
-    0xea849c,
-    0xea849d,
-    0xea849e,
-    0xea849f,
-    0xea84a0,
-    0xea84a1,
-    0xea84a2,
-    0xea84a3,
-    0xea84a4,
-    0xea84a5,
-    0xea84a6,
-    0xea84a7,
-    0xea84a8,
-    0xea84a9,
-    0xea84aa,
-    0xea84ab,
-    0xea84ac,
-    0xea84ad,
-    0xea84ae,
-    0xea84af,
-    0xea84b0,
-    0xea84b1,
-    0xea84b2,
-    0xea84b3,
-    0xea84b4,
-    0xea84b5,
-    0xea84b6,
-    0xea84b7,
-    0xea84b8,
-    0xea84b9,
-    0xea84ba,
-    0xea84bb,
-    0xea84bc,
-    0xea84bd,
-    0xea84be,
-    0xea84bf,
-    0xea8580,
-    0xea8581,
-    0xea8582,
-    0xea8583,
-    0xea8584,
-    0xea8585,
-    0xea8586,
-    0xea8587,
-    0xea8588,
-    0xea8589,
-    0xea858a,
-    0xea858b,
-    0xea858c,
-    0xea858d,
-    0xea858e,
-    0xea858f,
-    0xea8590,
-    0xea8591,
-    0xea8592,
-    0xea8593,
-    0xea8594,
-    0xea8595,
-    0xea8596,
-    0xea8597,
-    0xea8598,
-    0xea8599,
-    0xea859a,
-    0xea859b,
-    0xea859c,
-    0xea859d,
-    0xea859e,
-    0xea859f,
-    0xea85a0,
-    0xea85a1,
-    0xea85a2,
-    0xea85a3,
-    0xea85a4,
-    0xea85a5,
-    0xea85a6,
-    0xea85a7,
-    0xea85a8,
-    0xea85a9,
-    0xea85aa,
-    0xea85ab,
-    0xea85ac,
-    0xea85ad,
-    0xea85ae,
-    0xea85af,
-    0xea85b0,
-    0xea85b1,
-    0xea85b2,
-    0xea85b3,
-    0xea85b4,
-    0xea85b5,
-    0xea85b6,
-    0xea85b7,
-    0xea85b8,
-    0xea85b9,
-    0xea85ba,
-    0xea85bb,
-    0xea85bc,
-    0xea85bd,
-    0xea85be,
-    0xea85bf,
-    0xea8680,
-    0xea8681,
-    0xea8682,
-    0xea8683,
-    0xea8684,
-    0xea8685,
-    0xea8686,
-    0xea8687,
-    0xea8688,
-    0xea8689,
-    0xea868a,
-    0xea868b,
-    0xea868c,
-    0xea868d,
-    0xea868e,
-    0xea868f,
-    0xea8690,
-    0xea8691,
-    0xea8692,
-    0xea8693,
-    0xea8694,
-    0xea8695,
-    0xea8696,
-    0xea8697,
-    0xea8698,
-    0xea8699,
-    0xea869a,
-    0xea869b,
-    0xea869c,
-    0xea869d,
-    0xea869e,
-    0xea869f,
-    0xea86a0,
-    0xea86a1,
-    0xea86a2,
-    0xea86a3,
-    0xea86a4,
-    0xea86a5,
-    0xea86a6,
-    0xea86a7,
-    0xea86a8,
-    0xea86a9,
-    0xea86aa,
-    0xea86ab,
-    0xea86ac,
-    0xea86ad,
-    0xea86ae,
-    0xea86af,
-    0xea86b0,
-    0xea86b1,
-    0xea86b2,
-    0xea86b3,
-    0xea86b4,
-    0xea86b5,
-    0xea86b6,
-    0xea86b7,
-    0xea86b8,
-    0xea86b9,
-    0xea86ba,
-    0xea86bb,
-    0xea86bc,
-    0xea86bd,
-    0xea86be,
-    0xea86bf,
-    0xea8780,
-    0xea8781,
-    0xea8782,
-    0xea8783,
-    0xea8784,
-    0xea8785,
-    0xea8786,
-    0xea8787,
-    0xea8788,
-    0xea8789,
-    0xea878a,
-    0xea878b,
-    0xea878c,
-    0xea878d,
-    0xea878e,
-    0xea878f,
-    0xea8790,
-    0xea8791,
-    0xea8792,
-    0xea8793,
-    0xea8794,
-    0xea8795,
-    0xea8796,
-    0xea8797,
-    0xea8798,
-    0xea8799,
-    0xea879a,
-    0xea879b,
-    0xea879c,
-    0xea879d,
-    0xea879e,
-    0xea879f,
-    0xea87a0,
-    0xea87a1,
-    0xea87a2,
-    0xea87a3,
-    0xea87a4,
-    0xea87a5,
-    0xea87a6,
-    0xea87a7,
-    0xea87a8,
-    0xea87a9,
-    0xea87aa,
-    0xea87ab,
-    0xea87ac,
-    0xea87ad,
-    0xea87ae,
-    0xea87af,
-    0xea87b0,
-    0xea87b1,
-    0xea87b2,
-    0xea87b3,
-    0xea87b4,
-    0xea87b5,
-    0xea87b6,
-    0xea87b7,
-    0xea87b8,
-    0xea87b9,
-    0xea87ba,
-    0xea87bb,
-    0xea87bc,
-    0xea87bd,
-    0xea87be,
-    0xea87bf,
-    0xea8880,
-    0xea8881,
-    0xea8882,
-    0xea8883,
-    0xea8884,
-    0xea8885,
-    0xea8886,
-    0xea8887,
-    0xea8888,
-    0xea8889,
-    0xea888a,
-    0xea888b,
-    0xea888c,
-    0xea888d,
-    0xea888e,
-    0xea888f,
-    0xea8890,
-    0xea8891,
-    0xea8892,
-    0xea8893,
-    0xea8894,
-    0xea8895,
-    0xea8896,
-    0xea8897,
-    0xea8898,
-    0xea8899,
-    0xea889a,
-    0xea889b,
-    0xea889c,
-    0xea889d,
-    0xea889e,
-    0xea889f,
-    0xea88a0,
-    0xea88a1,
-    0xea88a2,
-    0xea88a3,
-    0xea88a4,
-    0xea88a5,
-    0xea88a6,
-    0xea88a7,
-    0xea88a8,
-    0xea88a9,
-    0xea88aa,
-    0xea88ab,
-    0xea88ac,
-    0xea88ad,
-    0xea88ae,
-    0xea88af,
-    0xea88b0,
-    0xea88b1,
-    0xea88b2,
-    0xea88b3,
-    0xea88b4,
-    0xea88b5,
-    0xea88b6,
-    0xea88b7,
-    0xea88b8,
-    0xea88b9,
-    0xea88ba,
-    0xea88bb,
-    0xea88bc,
-    0xea88bd,
-    0xea88be,
-    0xea88bf,
-    0xea8980,
-    0xea8981,
-    0xea8982,
-    0xea8983,
-    0xea8984,
-    0xea8985,
-    0xea8986,
-    0xea8987,
-    0xea8988,
-    0xea8989,
-    0xea898a,
-    0xea898b,
-    0xea898c,
-    0xea898d,
-    0xea898e,
-    0xea898f,
-    0xea8990,
-    0xea8991,
-    0xea8992,
-    0xea8993,
-    0xea8994,
-    0xea8995,
-    0xea8996,
-    0xea8997,
-    0xea8998,
-    0xea8999,
-    0xea899a,
-    0xea899b,
-    0xea899c,
-    0xea899d,
-    0xea899e,
-    0xea899f,
-    0xea89a0,
-    0xea89a1,
-    0xea89a2,
-    0xea89a3,
-    0xea89a4,
-    0xea89a5,
-    0xea89a6,
-    0xea89a7,
-    0xea89a8,
-    0xea89a9,
-    0xea89aa,
-    0xea89ab,
-    0xea89ac,
-    0xea89ad,
-    0xea89ae,
-    0xea89af,
-    0xea89b0,
-    0xea89b1,
-    0xea89b2,
-    0xea89b3,
-    0xea89b4,
-    0xea89b5,
-    0xea89b6,
-    0xea89b7,
-    0xea89b8,
-    0xea89b9,
-    0xea89ba,
-    0xea89bb,
-    0xea89bc,
-    0xea89bd,
-    0xea89be,
-    0xea89bf,
-    0xea8a80,
-    0xea8a81,
-    0xea8a82,
-    0xea8a83,
-    0xea8a84,
-    0xea8a85,
-    0xea8a86,
-    0xea8a87,
-    0xea8a88,
-    0xea8a89,
-    0xea8a8a,
-    0xea8a8b,
-    0xea8a8c,
-    0xea8a8d,
-    0xea8a8e,
-    0xea8a8f,
-    0xea8a90,
-    0xea8a91,
-    0xea8a92,
-    0xea8a93,
-    0xea8a94,
-    0xea8a95,
-    0xea8a96,
-    0xea8a97,
-    0xea8a98,
-    0xea8a99,
-    0xea8a9a,
-    0xea8a9b,
-    0xea8a9c,
-    0xea8a9d,
-    0xea8a9e,
-    0xea8a9f,
-    0xea8aa0,
-    0xea8aa1,
-    0xea8aa2,
-    0xea8aa3,
-    0xea8aa4,
-    0xea8aa5,
-    0xea8aa6,
-    0xea8aa7,
-    0xea8aa8,
-    0xea8aa9,
-    0xea8aaa,
-    0xea8aab,
-    0xea8aac,
-    0xea8aad,
-    0xea8aae,
-    0xea8aaf,
-    0xea8ab0,
-    0xea8ab1,
-    0xea8ab2,
-    0xea8ab3,
-    0xea8ab4,
-    0xea8ab5,
-    0xea8ab6,
-    0xea8ab7,
-    0xea8ab8,
-    0xea8ab9,
-    0xea8aba,
-    0xea8abb,
-    0xea8abc,
-    0xea8abd,
-    0xea8abe,
-    0xea8abf,
-    0xea8b80,
-    0xea8b81,
-    0xea8b82,
-    0xea8b83,
-    0xea8b84,
-    0xea8b85,
-    0xea8b86,
-    0xea8b87,
-    0xea8b88,
-    0xea8b89,
-    0xea8b8a,
-    0xea8b8b,
-    0xea8b8c,
-    0xea8b8d,
-    0xea8b8e,
-    0xea8b8f,
-    0xea8b90,
-    0xea8b91,
-    0xea8b92,
-    0xea8b93,
-    0xea8b94,
-    0xea8b95,
-    0xea8b96,
-    0xea8b97,
-    0xea8b98,
-    0xea8b99,
-    0xea8b9a,
-    0xea8b9b,
-    0xea8b9c,
-    0xea8b9d,
-    0xea8b9e,
-    0xea8b9f,
-    0xea8ba0,
-    0xea8ba1,
-    0xea8ba2,
-    0xea8ba3,
-    0xea8ba4,
-    0xea8ba5,
-    0xea8ba6,
-    0xea8ba7,
-    0xea8ba8,
-    0xea8ba9,
-    0xea8baa,
-    0xea8bab,
-    0xea8bac,
-    0xea8bad,
-    0xea8bae,
-    0xea8baf,
-    0xea8bb0,
-    0xea8bb1,
-    0xea8bb2,
-    0xea8bb3,
-    0xea8bb4,
-    0xea8bb5,
-    0xea8bb6,
-    0xea8bb7,
-    0xea8bb8,
-    0xea8bb9,
-    0xea8bba,
-    0xea8bbb,
-    0xea8bbc,
-    0xea8bbd,
-    0xea8bbe,
-    0xea8bbf,
-    0xea8c80,
-    0xea8c81,
-    0xea8c82,
-    0xea8c83,
-    0xea8c84,
-    0xea8c85,
-    0xea8c86,
-    0xea8c87,
-    0xea8c88,
-    0xea8c89,
-    0xea8c8a,
-    0xea8c8b,
-    0xea8c8c,
-    0xea8c8d,
-    0xea8c8e,
-    0xea8c8f,
-    0xea8c90,
-    0xea8c91,
-    0xea8c92,
-    0xea8c93,
-    0xea8c94,
-    0xea8c95,
-    0xea8c96,
-    0xea8c97,
-    0xea8c98,
-    0xea8c99,
-    0xea8c9a,
-    0xea8c9b,
-    0xea8c9c,
-    0xea8c9d,
-    0xea8c9e,
-    0xea8c9f,
-    0xea8ca0,
-    0xea8ca1,
-    0xea8ca2,
-    0xea8ca3,
-    0xea8ca4,
-    0xea8ca5,
-    0xea8ca6,
-    0xea8ca7,
-    0xea8ca8,
-    0xea8ca9,
-    0xea8caa,
-    0xea8cab,
-    0xea8cac,
-    0xea8cad,
-    0xea8cae,
-    0xea8caf,
-    0xea8cb0,
-    0xea8cb1,
-    0xea8cb2,
-    0xea8cb3,
-    0xea8cb4,
-    0xea8cb5,
-    0xea8cb6,
-    0xea8cb7,
-    0xea8cb8,
-    0xea8cb9,
-    0xea8cba,
-    0xea8cbb,
-    0xea8cbc,
-    0xea8cbd,
-    0xea8cbe,
-    0xea8cbf,
-    0xea8d80,
-    0xea8d81,
-    0xea8d82,
-    0xea8d83,
-    0xea8d84,
-    0xea8d85,
-    0xea8d86,
-    0xea8d87,
-    0xea8d88,
-    0xea8d89,
-    0xea8d8a,
-    0xea8d8b,
-    0xea8d8c,
-    0xea8d8d,
-    0xea8d8e,
-    0xea8d8f,
-    0xea8d90,
-    0xea8d91,
-    0xea8d92,
-    0xea8d93,
-    0xea8d94,
-    0xea8d95,
-    0xea8d96,
-    0xea8d97,
-    0xea8d98,
-    0xea8d99,
-    0xea8d9a,
-    0xea8d9b,
-    0xea8d9c,
-    0xea8d9d,
-    0xea8d9e,
-    0xea8d9f,
-    0xea8da0,
-    0xea8da1,
-    0xea8da2,
-    0xea8da3,
-    0xea8da4,
-    0xea8da5,
-    0xea8da6,
-    0xea8da7,
-    0xea8da8,
-    0xea8da9,
-    0xea8daa,
-    0xea8dab,
-    0xea8dac,
-    0xea8dad,
-    0xea8dae,
-    0xea8daf,
-    0xea8db0,
-    0xea8db1,
-    0xea8db2,
-    0xea8db3,
-    0xea8db4,
-    0xea8db5,
-    0xea8db6,
-    0xea8db7,
-    0xea8db8,
-    0xea8db9,
-    0xea8dba,
-    0xea8dbb,
-    0xea8dbc,
-    0xea8dbd,
-    0xea8dbe,
-    0xea8dbf,
-    0xea8e80,
-    0xea8e81,
-    0xea8e82,
-    0xea8e83,
-    0xea8e84,
-    0xea8e85,
-    0xea8e86,
-    0xea8e87,
-    0xea8e88,
-    0xea8e89,
-    0xea8e8a,
-    0xea8e8b,
-    0xea8e8c,
-    0xea8e8d,
-    0xea8e8e,
-    0xea8e8f,
-    0xea8e90,
-    0xea8e91,
-    0xea8e92,
-    0xea8e93,
-    0xea8e94,
-    0xea8e95,
-    0xea8e96,
-    0xea8e97,
-    0xea8e98,
-    0xea8e99,
-    0xea8e9a,
-    0xea8e9b,
-    0xea8e9c,
-    0xea8e9d,
-    0xea8e9e,
-    0xea8e9f,
-    0xea8ea0,
-    0xea8ea1,
-    0xea8ea2,
-    0xea8ea3,
-    0xea8ea4,
-    0xea8ea5,
-    0xea8ea6,
-    0xea8ea7,
-    0xea8ea8,
-    0xea8ea9,
-    0xea8eaa,
-    0xea8eab,
-    0xea8eac,
-    0xea8ead,
-    0xea8eae,
-    0xea8eaf,
-    0xea8eb0,
-    0xea8eb1,
-    0xea8eb2,
-    0xea8eb3,
-    0xea8eb4,
-    0xea8eb5,
-    0xea8eb6,
-    0xea8eb7,
-    0xea8eb8,
-    0xea8eb9,
-    0xea8eba,
-    0xea8ebb,
-    0xea8ebc,
-    0xea8ebd,
-    0xea8ebe,
-    0xea8ebf,
-    0xea8f80,
-    0xea8f81,
-    0xea8f82,
-    0xea8f83,
-    0xea8f84,
-    0xea8f85,
-    0xea8f86,
-    0xea8f87,
-    0xea8f88,
-    0xea8f89,
-    0xea8f8a,
-    0xea8f8b,
-    0xea8f8c,
-    0xea8f8d,
-    0xea8f8e,
-    0xea8f8f,
-    0xea8f90,
-    0xea8f91,
-    0xea8f92,
-    0xea8f93,
-    0xea8f94,
-    0xea8f95,
-    0xea8f96,
-    0xea8f97,
-    0xea8f98,
-    0xea8f99,
-    0xea8f9a,
-    0xea8f9b,
-    0xea8f9c,
-    0xea8f9d,
-    0xea8f9e,
-    0xea8f9f,
-    0xea8fa0,
-    0xea8fa1,
-    0xea8fa2,
-    0xea8fa3,
-    0xea8fa4,
-    0xea8fa5,
-    0xea8fa6,
-    0xea8fa7,
-    0xea8fa8,
-    0xea8fa9,
-    0xea8faa,
-    0xea8fab,
-    0xea8fac,
-    0xea8fad,
-    0xea8fae,
-    0xea8faf,
-    0xea8fb0,
-    0xea8fb1,
-    0xea8fb2,
-    0xea8fb3,
-    0xea8fb4,
-    0xea8fb5,
-    0xea8fb6,
-    0xea8fb7,
-    0xea8fb8,
-    0xea8fb9,
-    0xea8fba,
-    0xea8fbb,
-    0xea8fbc,
-    0xea8fbd,
-    0xea8fbe,
-    0xea8fbf,
-    0xea9080,
-    0xea9081,
-    0xea9082,
-    0xea9083,
-    0xea9084,
-    0xea9085,
-    0xea9086,
-    0xea9087,
-    0xea9088,
-    0xea9089,
-    0xea908a,
-    0xea908b,
-    0xea908c,
-    0xea908d,
-    0xea908e,
-    0xea908f,
-    0xea9090,
-    0xea9091,
-    0xea9092,
-    0xea9093,
-    0xea9094,
-    0xea9095,
-    0xea9096,
-    0xea9097,
-    0xea9098,
-    0xea9099,
-    0xea909a,
-    0xea909b,
-    0xea909c,
-    0xea909d,
-    0xea909e,
-    0xea909f,
-    0xea90a0,
-    0xea90a1,
-    0xea90a2,
-    0xea90a3,
-    0xea90a4,
-    0xea90a5,
-    0xea90a6,
-    0xea90a7,
-    0xea90a8,
-    0xea90a9,
-    0xea90aa,
-    0xea90ab,
-    0xea90ac,
-    0xea90ad,
-    0xea90ae,
-    0xea90af,
-    0xea90b0,
-    0xea90b1,
-    0xea90b2,
-    0xea90b3,
-    0xea90b4,
-    0xea90b5,
-    0xea90b6,
-    0xea90b7,
-    0xea90b8,
-    0xea90b9,
-    0xea90ba,
-    0xea90bb,
-    0xea90bc,
-    0xea90bd,
-    0xea90be,
-    0xea90bf,
-    0xea9180,
-    0xea9181,
-    0xea9182,
-    0xea9183,
-    0xea9184,
-    0xea9185,
-    0xea9186,
-    0xea9187,
-    0xea9188,
-    0xea9189,
-    0xea918a,
-    0xea918b,
-    0xea918c,
-    0xea918d,
-    0xea918e,
-    0xea918f,
-    0xea9190,
-    0xea9191,
-    0xea9192,
-    0xea9193,
-    0xea9194,
-    0xea9195,
-    0xea9196,
-    0xea9197,
-    0xea9198,
-    0xea9199,
-    0xea919a,
-    0xea919b,
-    0xea919c,
-    0xea919d,
-    0xea919e,
-    0xea919f,
-    0xea91a0,
-    0xea91a1,
-    0xea91a2,
-    0xea91a3,
-    0xea91a4,
-    0xea91a5,
-    0xea91a6,
-    0xea91a7,
-    0xea91a8,
-    0xea91a9,
-    0xea91aa,
-    0xea91ab,
-    0xea91ac,
-    0xea91ad,
-    0xea91ae,
-    0xea91af,
-    0xea91b0,
-    0xea91b1,
-    0xea91b2,
-    0xea91b3,
-    0xea91b4,
-    0xea91b5,
-    0xea91b6,
-    0xea91b7,
-    0xea91b8,
-    0xea91b9,
-    0xea91ba,
-    0xea91bb,
-    0xea91bc,
-    0xea91bd,
-    0xea91be,
-    0xea91bf,
-    0xea9280,
-    0xea9281,
-    0xea9282,
-    0xea9283,
-    0xea9284,
-    0xea9285,
-    0xea9286,
-    0xea9287,
-    0xea9288,
-    0xea9289,
-    0xea928a,
-    0xea928b,
-    0xea928c,
-    0xea928d,
-    0xea928e,
-    0xea928f,
-    0xea9290,
-    0xea9291,
-    0xea9292,
-    0xea9293,
-    0xea9294,
-    0xea9295,
-    0xea9296,
-    0xea9297,
-    0xea9298,
-    0xea9299,
-    0xea929a,
-    0xea929b,
-    0xea929c,
-    0xea929d,
-    0xea929e,
-    0xea929f,
-    0xea92a0,
-    0xea92a1,
-    0xea92a2,
-    0xea92a3,
-    0xea92a4,
-    0xea92a5,
-    0xea92a6,
-    0xea92a7,
-    0xea92a8,
-    0xea92a9,
-    0xea92aa,
-    0xea92ab,
-    0xea92ac,
-    0xea92ad,
-    0xea92ae,
-    0xea92af,
-    0xea92b0,
-    0xea92b1,
-    0xea92b2,
-    0xea92b3,
-    0xea92b4,
-    0xea92b5,
-    0xea92b6,
-    0xea92b7,
-    0xea92b8,
-    0xea92b9,
-    0xea92ba,
-    0xea92bb,
-    0xea92bc,
-    0xea92bd,
-    0xea92be,
-    0xea92bf,
-    0xea9380,
-    0xea9381,
-    0xea9382,
-    0xea9383,
-    0xea9384,
-    0xea9385,
-    0xea9386,
-    0xea9387,
-    0xea9388,
-    0xea9389,
-    0xea938a,
-    0xea938b,
-    0xea938c,
-    0xea938d,
-    0xea938e,
-    0xea938f,
-    0xea9390,
-    0xea9391,
-    0xea9392,
-    0xea9393,
-    0xea9394,
-    0xea9395,
-    0xea9396,
-    0xea9397,
-    0xea9398,
-    0xea9399,
-    0xea939a,
-    0xea939b,
-    0xea939c,
-    0xea939d,
-    0xea939e,
-    0xea939f,
-    0xea93a0,
-    0xea93a1,
-    0xea93a2,
-    0xea93a3,
-    0xea93a4,
-    0xea93a5,
-    0xea93a6,
-    0xea93a7,
-    0xea93a8,
-    0xea93a9,
-    0xea93aa,
-    0xea93ab,
-    0xea93ac,
-    0xea93ad,
-    0xea93ae,
-    0xea93af,
-    0xea93b0,
-    0xea93b1,
-    0xea93b2,
-    0xea93b3,
-    0xea93b4,
-    0xea93b5,
-    0xea93b6,
-    0xea93b7,
-    0xea93b8,
-    0xea93b9,
-    0xea93ba,
-    0xea93bb,
-    0xea93bc,
-    0xea93bd,
-    0xea93be,
-    0xea93bf,
-    0xea9480,
-    0xea9481,
-    0xea9482,
-    0xea9483,
-    0xea9484,
-    0xea9485,
-    0xea9486,
-    0xea9487,
-    0xea9488,
-    0xea9489,
-    0xea948a,
-    0xea948b,
-    0xea948c,
-    0xea948d,
-    0xea948e,
-    0xea948f,
-    0xea9490,
-    0xea9491,
-    0xea9492,
-    0xea9493,
-    0xea9494,
-    0xea9495,
-    0xea9496,
-    0xea9497,
-    0xea9498,
-    0xea9499,
-    0xea949a,
-    0xea949b,
-    0xea949c,
-    0xea949d,
-    0xea949e,
-    0xea949f,
-    0xea94a0,
-    0xea94a1,
-    0xea94a2,
-    0xea94a3,
-    0xea94a4,
-    0xea94a5,
-    0xea94a6,
-    0xea94a7,
-    0xea94a8,
-    0xea94a9,
-    0xea94aa,
-    0xea94ab,
-    0xea94ac,
-    0xea94ad,
-    0xea94ae,
-    0xea94af,
-    0xea94b0,
-    0xea94b1,
-    0xea94b2,
-    0xea94b3,
-    0xea94b4,
-    0xea94b5,
-    0xea94b6,
-    0xea94b7,
-    0xea94b8,
-    0xea94b9,
-    0xea94ba,
-    0xea94bb,
-    0xea94bc,
-    0xea94bd,
-    0xea94be,
-    0xea94bf,
-    0xea9580,
-    0xea9581,
-    0xea9582,
-    0xea9583,
-    0xea9584,
-    0xea9585,
-    0xea9586,
-    0xea9587,
-    0xea9588,
-    0xea9589,
-    0xea958a,
-    0xea958b,
-    0xea958c,
-    0xea958d,
-    0xea958e,
-    0xea958f,
-    0xea9590,
-    0xea9591,
-    0xea9592,
-    0xea9593,
-    0xea9594,
-    0xea9595,
-    0xea9596,
-    0xea9597,
-    0xea9598,
-    0xea9599,
-    0xea959a,
-    0xea959b,
-    0xea959c,
-    0xea959d,
-    0xea959e,
-    0xea959f,
-    0xea95a0,
-    0xea95a1,
-    0xea95a2,
-    0xea95a3,
-    0xea95a4,
-    0xea95a5,
-    0xea95a6,
-    0xea95a7,
-    0xea95a8,
-    0xea95a9,
-    0xea95aa,
-    0xea95ab,
-    0xea95ac,
-    0xea95ad,
-    0xea95ae,
-    0xea95af,
-    0xea95b0,
-    0xea95b1,
-    0xea95b2,
-    0xea95b3,
-    0xea95b4,
-    0xea95b5,
-    0xea95b6,
-    0xea95b7,
-    0xea95b8,
-    0xea95b9,
-    0xea95ba,
-    0xea95bb,
-    0xea95bc,
-    0xea95bd,
-    0xea95be,
-    0xea95bf,
-    0xea9680,
-    0xea9681,
-    0xea9682,
-    0xea9683,
-    0xea9684,
-    0xea9685,
-    0xea9686,
-    0xea9687,
-    0xea9688,
-    0xea9689,
-    0xea968a,
-    0xea968b,
-    0xea968c,
-    0xea968d,
-    0xea968e,
-    0xea968f,
-    0xea9690,
-    0xea9691,
-    0xea9692,
-    0xea9693,
-    0xea9694,
-    0xea9695,
-    0xea9696,
-    0xea9697,
-    0xea9698,
-    0xea9699,
-    0xea969a,
-    0xea969b,
-    0xea969c,
-    0xea969d,
-    0xea969e,
-    0xea969f,
-    0xea96a0,
-    0xea96a1,
-    0xea96a2,
-    0xea96a3,
-    0xea96a4,
-    0xea96a5,
-    0xea96a6,
-    0xea96a7,
-    0xea96a8,
-    0xea96a9,
-    0xea96aa,
-    0xea96ab,
-    0xea96ac,
-    0xea96ad,
-    0xea96ae,
-    0xea96af,
-    0xea96b0,
-    0xea96b1,
-    0xea96b2,
-    0xea96b3,
-    0xea96b4,
-    0xea96b5,
-    0xea96b6,
-    0xea96b7,
-    0xea96b8,
-    0xea96b9,
-    0xea96ba,
-    0xea96bb,
-    0xea96bc,
-    0xea96bd,
-    0xea96be,
-    0xea96bf,
-    0xea9780,
-    0xea9781,
-    0xea9782,
-    0xea9783,
-    0xea9784,
-    0xea9785,
-    0xea9786,
-    0xea9787,
-    0xea9788,
-    0xea9789,
-    0xea978a,
-    0xea978b,
-    0xea978c,
-    0xea978d,
-    0xea978e,
-    0xea978f,
-    0xea9790,
-    0xea9791,
-    0xea9792,
-    0xea9793,
-    0xea9794,
-    0xea9795,
-    0xea9796,
-    0xea9797,
-    0xea9798,
-    0xea9799,
-    0xea979a,
-    0xea979b,
-    0xea979c,
-    0xea979d,
-    0xea979e,
-    0xea979f,
-    0xea97a0,
-    0xea97a1,
-    0xea97a2,
-    0xea97a3,
-    0xea97a4,
-    0xea97a5,
-    0xea97a6,
-    0xea97a7,
-    0xea97a8,
-    0xea97a9,
-    0xea97aa,
-    0xea97ab,
-    0xea97ac,
-    0xea97ad,
-    0xea97ae,
-    0xea97af,
-    0xea97b0,
-    0xea97b1,
-    0xea97b2,
-    0xea97b3,
-    0xea97b4,
-    0xea97b5,
-    0xea97b6,
-    0xea97b7,
-    0xea97b8,
-    0xea97b9,
-    0xea97ba,
-    0xea97bb,
-    0xea97bc,
-    0xea97bd,
-    0xea97be,
-    0xea97bf,
-    0xea9880,
-    0xea9881,
-    0xea9882,
-    0xea9883,
-    0xea9884,
-    0xea9885,
-    0xea9886,
-    0xea9887,
-    0xea9888,
-    0xea9889,
-    0xea988a,
-    0xea988b,
-    0xea988c,
-    0xea988d,
-    0xea988e,
-    0xea988f,
-    0xea9890,
-    0xea9891,
-    0xea9892,
-    0xea9893,
-    0xea9894,
-    0xea9895,
-    0xea9896,
-    0xea9897,
-    0xea9898,
-    0xea9899,
-    0xea989a,
-    0xea989b,
-    0xea989c,
-    0xea989d,
-    0xea989e,
-    0xea989f,
-    0xea98a0,
-    0xea98a1,
-    0xea98a2,
-    0xea98a3,
-    0xea98a4,
-    0xea98a5,
-    0xea98a6,
-    0xea98a7,
-    0xea98a8,
-    0xea98a9,
-    0xea98aa,
-    0xea98ab,
-    0xea98ac,
-    0xea98ad,
-    0xea98ae,
-    0xea98af,
-    0xea98b0,
-    0xea98b1,
-    0xea98b2,
-    0xea98b3,
-    0xea98b4,
-    0xea98b5,
-    0xea98b6,
-    0xea98b7,
-    0xea98b8,
-    0xea98b9,
-    0xea98ba,
-    0xea98bb,
-    0xea98bc,
-    0xea98bd,
-    0xea98be,
-    0xea98bf,
-    0xea9980,
-    0xea9981,
-    0xea9982,
-    0xea9983,
-    0xea9984,
-    0xea9985,
-    0xea9986,
-    0xea9987,
-    0xea9988,
-    0xea9989,
-    0xea998a,
-    0xea998b,
-    0xea998c,
-    0xea998d,
-    0xea998e,
-    0xea998f,
-    0xea9990,
-    0xea9991,
-    0xea9992,
-    0xea9993,
-    0xea9994,
-    0xea9995,
-    0xea9996,
-    0xea9997,
-    0xea9998,
-    0xea9999,
-    0xea999a,
-    0xea999b,
-    0xea999c,
-    0xea999d,
-    0xea999e,
-    0xea999f,
-    0xea99a0,
-    0xea99a1,
-    0xea99a2,
-    0xea99a3,
-    0xea99a4,
-    0xea99a5,
-    0xea99a6,
-    0xea99a7,
-    0xea99a8,
-    0xea99a9,
-    0xea99aa,
-    0xea99ab,
-    0xea99ac,
-    0xea99ad,
-    0xea99ae,
-    0xea99af,
-    0xea99b0,
-    0xea99b1,
-    0xea99b2,
-    0xea99b3,
-    0xea99b4,
-    0xea99b5,
-    0xea99b6,
-    0xea99b7,
-    0xea99b8,
-    0xea99b9,
-    0xea99ba,
-    0xea99bb,
-    0xea99bc,
-    0xea99bd,
-    0xea99be,
-    0xea99bf,
-    0xea9a80,
-    0xea9a81,
-    0xea9a82,
-    0xea9a83,
-    0xea9a84,
-    0xea9a85,
-    0xea9a86,
-    0xea9a87,
-    0xea9a88,
-    0xea9a89,
-    0xea9a8a,
-    0xea9a8b,
-    0xea9a8c,
-    0xea9a8d,
-    0xea9a8e,
-    0xea9a8f,
-    0xea9a90,
-    0xea9a91,
-    0xea9a92,
-    0xea9a93,
-    0xea9a94,
-    0xea9a95,
-    0xea9a96,
-    0xea9a97,
-    0xea9a98,
-    0xea9a99,
-    0xea9a9a,
-    0xea9a9b,
-    0xea9a9c,
-    0xea9a9d,
-    0xea9a9e,
-    0xea9a9f,
-    0xea9aa0,
-    0xea9aa1,
-    0xea9aa2,
-    0xea9aa3,
-    0xea9aa4,
-    0xea9aa5,
-    0xea9aa6,
-    0xea9aa7,
-    0xea9aa8,
-    0xea9aa9,
-    0xea9aaa,
-    0xea9aab,
-    0xea9aac,
-    0xea9aad,
-    0xea9aae,
-    0xea9aaf,
-    0xea9ab0,
-    0xea9ab1,
-    0xea9ab2,
-    0xea9ab3,
-    0xea9ab4,
-    0xea9ab5,
-    0xea9ab6,
-    0xea9ab7,
-    0xea9ab8,
-    0xea9ab9,
-    0xea9aba,
-    0xea9abb,
-    0xea9abc,
-    0xea9abd,
-    0xea9abe,
-    0xea9abf,
-    0xea9b80,
-    0xea9b81,
-    0xea9b82,
-    0xea9b83,
-    0xea9b84,
-    0xea9b85,
-    0xea9b86,
-    0xea9b87,
-    0xea9b88,
-    0xea9b89,
-    0xea9b8a,
-    0xea9b8b,
-    0xea9b8c,
-    0xea9b8d,
-    0xea9b8e,
-    0xea9b8f,
-    0xea9b90,
-    0xea9b91,
-    0xea9b92,
-    0xea9b93,
-    0xea9b94,
-    0xea9b95,
-    0xea9b96,
-    0xea9b97,
-    0xea9b98,
-    0xea9b99,
-    0xea9b9a,
-    0xea9b9b,
-    0xea9b9c,
-    0xea9b9d,
-    0xea9b9e,
-    0xea9b9f,
-    0xea9ba0,
-    0xea9ba1,
-    0xea9ba2,
-    0xea9ba3,
-    0xea9ba4,
-    0xea9ba5,
-    0xea9ba6,
-    0xea9ba7,
-    0xea9ba8,
-    0xea9ba9,
-    0xea9baa,
-    0xea9bab,
-    0xea9bac,
-    0xea9bad,
-    0xea9bae,
-    0xea9baf,
-    0xea9bb0,
-    0xea9bb1,
-    0xea9bb2,
-    0xea9bb3,
-    0xea9bb4,
-    0xea9bb5,
-    0xea9bb6,
-    0xea9bb7,
-    0xea9bb8,
-    0xea9bb9,
-    0xea9bba,
-    0xea9bbb,
-    0xea9bbc,
-    0xea9bbd,
-    0xea9bbe,
-    0xea9bbf,
-    0xea9c80,
-    0xea9c81,
-    0xea9c82,
-    0xea9c83,
-    0xea9c84,
-    0xea9c85,
-    0xea9c86,
-    0xea9c87,
-    0xea9c88,
-    0xea9c89,
-    0xea9c8a,
-    0xea9c8b,
-    0xea9c8c,
-    0xea9c8d,
-    0xea9c8e,
-    0xea9c8f,
-    0xea9c90,
-    0xea9c91,
-    0xea9c92,
-    0xea9c93,
-    0xea9c94,
-    0xea9c95,
-    0xea9c96,
-    0xea9c97,
-    0xea9c98,
-    0xea9c99,
-    0xea9c9a,
-    0xea9c9b,
-    0xea9c9c,
-    0xea9c9d,
-    0xea9c9e,
-    0xea9c9f,
-    0xea9ca0,
-    0xea9ca1,
-    0xea9ca2,
-    0xea9ca3,
-    0xea9ca4,
-    0xea9ca5,
-    0xea9ca6,
-    0xea9ca7,
-    0xea9ca8,
-    0xea9ca9,
-    0xea9caa,
-    0xea9cab,
-    0xea9cac,
-    0xea9cad,
-    0xea9cae,
-    0xea9caf,
-    0xea9cb0,
-    0xea9cb1,
-    0xea9cb2,
-    0xea9cb3,
-    0xea9cb4,
-    0xea9cb5,
-    0xea9cb6,
-    0xea9cb7,
-    0xea9cb8,
-    0xea9cb9,
-    0xea9cba,
-    0xea9cbb,
-    0xea9cbc,
-    0xea9cbd,
-    0xea9cbe,
-    0xea9cbf,
-    0xea9d80,
-    0xea9d81,
-    0xea9d82,
-    0xea9d83,
-    0xea9d84,
-    0xea9d85,
-    0xea9d86,
-    0xea9d87,
-    0xea9d88,
-    0xea9d89,
-    0xea9d8a,
-    0xea9d8b,
-    0xea9d8c,
-    0xea9d8d,
-    0xea9d8e,
-    0xea9d8f,
-    0xea9d90,
-    0xea9d91,
-    0xea9d92,
-    0xea9d93,
-    0xea9d94,
-    0xea9d95,
-    0xea9d96,
-    0xea9d97,
-    0xea9d98,
-    0xea9d99,
-    0xea9d9a,
-    0xea9d9b,
-    0xea9d9c,
-    0xea9d9d,
-    0xea9d9e,
-    0xea9d9f,
-    0xea9da0,
-    0xea9da1,
-    0xea9da2,
-    0xea9da3,
-    0xea9da4,
-    0xea9da5,
-    0xea9da6,
-    0xea9da7,
-    0xea9da8,
-    0xea9da9,
-    0xea9daa,
-    0xea9dab,
-    0xea9dac,
-    0xea9dad,
-    0xea9dae,
-    0xea9daf,
-    0xea9db0,
-    0xea9db1,
-    0xea9db2,
-    0xea9db3,
-    0xea9db4,
-    0xea9db5,
-    0xea9db6,
-    0xea9db7,
-    0xea9db8,
-    0xea9db9,
-    0xea9dba,
-    0xea9dbb,
-    0xea9dbc,
-    0xea9dbd,
-    0xea9dbe,
-    0xea9dbf,
-    0xea9e80,
-    0xea9e81,
-    0xea9e82,
-    0xea9e83,
-    0xea9e84,
-    0xea9e85,
-    0xea9e86,
-    0xea9e87,
-    0xea9e88,
-    0xea9e89,
-    0xea9e8a,
-    0xea9e8b,
-    0xea9e8c,
-    0xea9e8d,
-    0xea9e8e,
-    0xea9e8f,
-    0xea9e90,
-    0xea9e91,
-    0xea9e92,
-    0xea9e93,
-    0xea9e94,
-    0xea9e95,
-    0xea9e96,
-    0xea9e97,
-    0xea9e98,
-    0xea9e99,
-    0xea9e9a,
-    0xea9e9b,
-    0xea9e9c,
-    0xea9e9d,
-    0xea9e9e,
-    0xea9e9f,
-    0xea9ea0,
-    0xea9ea1,
-    0xea9ea2,
-    0xea9ea3,
-    0xea9ea4,
-    0xea9ea5,
-    0xea9ea6,
-    0xea9ea7,
-    0xea9ea8,
-    0xea9ea9,
-    0xea9eaa,
-    0xea9eab,
-    0xea9eac,
-    0xea9ead,
-    0xea9eae,
-    0xea9eaf,
-    0xea9eb0,
-    0xea9eb1,
-    0xea9eb2,
-    0xea9eb3,
-    0xea9eb4,
-    0xea9eb5,
-    0xea9eb6,
-    0xea9eb7,
-    0xea9eb8,
-    0xea9eb9,
-    0xea9eba,
-    0xea9ebb,
-    0xea9ebc,
-    0xea9ebd,
-    0xea9ebe,
-    0xea9ebf,
-    0xea9f80,
-    0xea9f81,
-    0xea9f82,
-    0xea9f83,
-    0xea9f84,
-    0xea9f85,
-    0xea9f86,
-    0xea9f87,
-    0xea9f88,
-    0xea9f89,
-    0xea9f8a,
-    0xea9f8b,
-    0xea9f8c,
-    0xea9f8d,
-    0xea9f8e,
-    0xea9f8f,
-    0xea9f90,
-    0xea9f91,
-    0xea9f92,
-    0xea9f93,
-    0xea9f94,
-    0xea9f95,
-    0xea9f96,
-    0xea9f97,
-    0xea9f98,
-    0xea9f99,
-    0xea9f9a,
-    0xea9f9b,
-    0xea9f9c,
-    0xea9f9d,
-    0xea9f9e,
-    0xea9f9f,
-    0xea9fa0,
-    0xea9fa1,
-    0xea9fa2,
-    0xea9fa3,
-    0xea9fa4,
-    0xea9fa5,
-    0xea9fa6,
-    0xea9fa7,
-    0xea9fa8,
-    0xea9fa9,
-    0xea9faa,
-    0xea9fab,
-    0xea9fac,
-    0xea9fad,
-    0xea9fae,
-    0xea9faf,
-    0xea9fb0,
-    0xea9fb1,
-    0xea9fb2,
-    0xea9fb3,
-    0xea9fb4,
-    0xea9fb5,
-    0xea9fb6,
-    0xea9fb7,
-    0xea9fb8,
-    0xea9fb9,
-    0xea9fba,
-    0xea9fbb,
-    0xea9fbc,
-    0xea9fbd,
-    0xea9fbe,
-    0xea9fbf,
-    0xeaa080,
-    0xeaa081,
-    0xeaa082,
-    0xeaa083,
-    0xeaa084,
-    0xeaa085,
-    0xeaa086,
-    0xeaa087,
-    0xeaa088,
-    0xeaa089,
-    0xeaa08a,
-    0xeaa08b,
-    0xeaa08c,
-    0xeaa08d,
-    0xeaa08e,
-    0xeaa08f,
-    0xeaa090,
-    0xeaa091,
-    0xeaa092,
-    0xeaa093,
-    0xeaa094,
-    0xeaa095,
-    0xeaa096,
-    0xeaa097,
-    0xeaa098,
-    0xeaa099,
-    0xeaa09a,
-    0xeaa09b,
-    0xeaa09c,
-    0xeaa09d,
-    0xeaa09e,
-    0xeaa09f,
-    0xeaa0a0,
-    0xeaa0a1,
-    0xeaa0a2,
-    0xeaa0a3,
-    0xeaa0a4,
-    0xeaa0a5,
-    0xeaa0a6,
-    0xeaa0a7,
-    0xeaa0a8,
-    0xeaa0a9,
-    0xeaa0aa,
-    0xeaa0ab,
-    0xeaa0ac,
-    0xeaa0ad,
-    0xeaa0ae,
-    0xeaa0af,
-    0xeaa0b0,
-    0xeaa0b1,
-    0xeaa0b2,
-    0xeaa0b3,
-    0xeaa0b4,
-    0xeaa0b5,
-    0xeaa0b6,
-    0xeaa0b7,
-    0xeaa0b8,
-    0xeaa0b9,
-    0xeaa0ba,
-    0xeaa0bb,
-    0xeaa0bc,
-    0xeaa0bd,
-    0xeaa0be,
-    0xeaa0bf,
-    0xeaa180,
-    0xeaa181,
-    0xeaa182,
-    0xeaa183,
-    0xeaa184,
-    0xeaa185,
-    0xeaa186,
-    0xeaa187,
-    0xeaa188,
-    0xeaa189,
-    0xeaa18a,
-    0xeaa18b,
-    0xeaa18c,
-    0xeaa18d,
-    0xeaa18e,
-    0xeaa18f,
-    0xeaa190,
-    0xeaa191,
-    0xeaa192,
-    0xeaa193,
-    0xeaa194,
-    0xeaa195,
-    0xeaa196,
-    0xeaa197,
-    0xeaa198,
-    0xeaa199,
-    0xeaa19a,
-    0xeaa19b,
-    0xeaa19c,
-    0xeaa19d,
-    0xeaa19e,
-    0xeaa19f,
-    0xeaa1a0,
-    0xeaa1a1,
-    0xeaa1a2,
-    0xeaa1a3,
-    0xeaa1a4,
-    0xeaa1a5,
-    0xeaa1a6,
-    0xeaa1a7,
-    0xeaa1a8,
-    0xeaa1a9,
-    0xeaa1aa,
-    0xeaa1ab,
-    0xeaa1ac,
-    0xeaa1ad,
-    0xeaa1ae,
-    0xeaa1af,
-    0xeaa1b0,
-    0xeaa1b1,
-    0xeaa1b2,
-    0xeaa1b3,
-    0xeaa1b4,
-    0xeaa1b5,
-    0xeaa1b6,
-    0xeaa1b7,
-    0xeaa1b8,
-    0xeaa1b9,
-    0xeaa1ba,
-    0xeaa1bb,
-    0xeaa1bc,
-    0xeaa1bd,
-    0xeaa1be,
-    0xeaa1bf,
-    0xeaa280,
-    0xeaa281,
-    0xeaa282,
-    0xeaa283,
-    0xeaa284,
-    0xeaa285,
-    0xeaa286,
-    0xeaa287,
-    0xeaa288,
-    0xeaa289,
-    0xeaa28a,
-    0xeaa28b,
-    0xeaa28c,
-    0xeaa28d,
-    0xeaa28e,
-    0xeaa28f,
-    0xeaa290,
-    0xeaa291,
-    0xeaa292,
-    0xeaa293,
-    0xeaa294,
-    0xeaa295,
-    0xeaa296,
-    0xeaa297,
-    0xeaa298,
-    0xeaa299,
-    0xeaa29a,
-    0xeaa29b,
-    0xeaa29c,
-    0xeaa29d,
-    0xeaa29e,
-    0xeaa29f,
-    0xeaa2a0,
-    0xeaa2a1,
-    0xeaa2a2,
-    0xeaa2a3,
-    0xeaa2a4,
-    0xeaa2a5,
-    0xeaa2a6,
-    0xeaa2a7,
-    0xeaa2a8,
-    0xeaa2a9,
-    0xeaa2aa,
-    0xeaa2ab,
-    0xeaa2ac,
-    0xeaa2ad,
-    0xeaa2ae,
-    0xeaa2af,
-    0xeaa2b0,
-    0xeaa2b1,
-    0xeaa2b2,
-    0xeaa2b3,
-    0xeaa2b4,
-    0xeaa2b5,
-    0xeaa2b6,
-    0xeaa2b7,
-    0xeaa2b8,
-    0xeaa2b9,
-    0xeaa2ba,
-    0xeaa2bb,
-    0xeaa2bc,
-    0xeaa2bd,
-    0xeaa2be,
-    0xeaa2bf,
-    0xeaa380,
-    0xeaa381,
-    0xeaa382,
-    0xeaa383,
-    0xeaa384,
-    0xeaa385,
-    0xeaa386,
-    0xeaa387,
-    0xeaa388,
-    0xeaa389,
-    0xeaa38a,
-    0xeaa38b,
-    0xeaa38c,
-    0xeaa38d,
-    0xeaa38e,
-    0xeaa38f,
-    0xeaa390,
-    0xeaa391,
-    0xeaa392,
-    0xeaa393,
-    0xeaa394,
-    0xeaa395,
-    0xeaa396,
-    0xeaa397,
-    0xeaa398,
-    0xeaa399,
-    0xeaa39a,
-    0xeaa39b,
-    0xeaa39c,
-    0xeaa39d,
-    0xeaa39e,
-    0xeaa39f,
-    0xeaa3a0,
-    0xeaa3a1,
-    0xeaa3a2,
-    0xeaa3a3,
-    0xeaa3a4,
-    0xeaa3a5,
-    0xeaa3a6,
-    0xeaa3a7,
-    0xeaa3a8,
-    0xeaa3a9,
-    0xeaa3aa,
-    0xeaa3ab,
-    0xeaa3ac,
-    0xeaa3ad,
-    0xeaa3ae,
-    0xeaa3af,
-    0xeaa3b0,
-    0xeaa3b1,
-    0xeaa3b2,
-    0xeaa3b3,
-    0xeaa3b4,
-    0xeaa3b5,
-    0xeaa3b6,
-    0xeaa3b7,
-    0xeaa3b8,
-    0xeaa3b9,
-    0xeaa3ba,
-    0xeaa3bb,
-    0xeaa3bc,
-    0xeaa3bd,
-    0xeaa3be,
-    0xeaa3bf,
-    0xeaa480,
-    0xeaa481,
-    0xeaa482,
-    0xeaa483,
-    0xeaa484,
-    0xeaa485,
-    0xeaa486,
-    0xeaa487,
-    0xeaa488,
-    0xeaa489,
-    0xeaa48a,
-    0xeaa48b,
-    0xeaa48c,
-    0xeaa48d,
-    0xeaa48e,
-    0xeaa48f,
-    0xeaa490,
-    0xeaa491,
-    0xeaa492,
-    0xeaa493,
-    0xeaa494,
-    0xeaa495,
-    0xeaa496,
-    0xeaa497,
-    0xeaa498,
-    0xeaa499,
-    0xeaa49a,
-    0xeaa49b,
-    0xeaa49c,
-    0xeaa49d,
-    0xeaa49e,
-    0xeaa49f,
-    0xeaa4a0,
-    0xeaa4a1,
-    0xeaa4a2,
-    0xeaa4a3,
-    0xeaa4a4,
-    0xeaa4a5,
-    0xeaa4a6,
-    0xeaa4a7,
-    0xeaa4a8,
-    0xeaa4a9,
-    0xeaa4aa,
-    0xeaa4ab,
-    0xeaa4ac,
-    0xeaa4ad,
-    0xeaa4ae,
-    0xeaa4af,
-    0xeaa4b0,
-    0xeaa4b1,
-    0xeaa4b2,
-    0xeaa4b3,
-    0xeaa4b4,
-    0xeaa4b5,
-    0xeaa4b6,
-    0xeaa4b7,
-    0xeaa4b8,
-    0xeaa4b9,
-    0xeaa4ba,
-    0xeaa4bb,
-    0xeaa4bc,
-    0xeaa4bd,
-    0xeaa4be,
-    0xeaa4bf,
-    0xeaa580,
-    0xeaa581,
-    0xeaa582,
-    0xeaa583,
-    0xeaa584,
-    0xeaa585,
-    0xeaa586,
-    0xeaa587,
-    0xeaa588,
-    0xeaa589,
-    0xeaa58a,
-    0xeaa58b,
-    0xeaa58c,
-    0xeaa58d,
-    0xeaa58e,
-    0xeaa58f,
-    0xeaa590,
-    0xeaa591,
-    0xeaa592,
-    0xeaa593,
-    0xeaa594,
-    0xeaa595,
-    0xeaa596,
-    0xeaa597,
-    0xeaa598,
-    0xeaa599,
-    0xeaa59a,
-    0xeaa59b,
-    0xeaa59c,
-    0xeaa59d,
-    0xeaa59e,
-    0xeaa59f,
-    0xeaa5a0,
-    0xeaa5a1,
-    0xeaa5a2,
-    0xeaa5a3,
-    0xeaa5a4,
-    0xeaa5a5,
-    0xeaa5a6,
-    0xeaa5a7,
-    0xeaa5a8,
-    0xeaa5a9,
-    0xeaa5aa,
-    0xeaa5ab,
-    0xeaa5ac,
-    0xeaa5ad,
-    0xeaa5ae,
-    0xeaa5af,
-    0xeaa5b0,
-    0xeaa5b1,
-    0xeaa5b2,
-    0xeaa5b3,
-    0xeaa5b4,
-    0xeaa5b5,
-    0xeaa5b6,
-    0xeaa5b7,
-    0xeaa5b8,
-    0xeaa5b9,
-    0xeaa5ba,
-    0xeaa5bb,
-    0xeaa5bc,
-    0xeaa5bd,
-    0xeaa5be,
-    0xeaa5bf,
-    0xeaa680,
-    0xeaa681,
-    0xeaa682,
-    0xeaa683,
-    0xeaa684,
-    0xeaa685,
-    0xeaa686,
-    0xeaa687,
-    0xeaa688,
-    0xeaa689,
-    0xeaa68a,
-    0xeaa68b,
-    0xeaa68c,
-    0xeaa68d,
-    0xeaa68e,
-    0xeaa68f,
-    0xeaa690,
-    0xeaa691,
-    0xeaa692,
-    0xeaa693,
-    0xeaa694,
-    0xeaa695,
-    0xeaa696,
-    0xeaa697,
-    0xeaa698,
-    0xeaa699,
-    0xeaa69a,
-    0xeaa69b,
-    0xeaa69c,
-    0xeaa69d,
-    0xeaa69e,
-    0xeaa69f,
-    0xeaa6a0,
-    0xeaa6a1,
-    0xeaa6a2,
-    0xeaa6a3,
-    0xeaa6a4,
-    0xeaa6a5,
-    0xeaa6a6,
-    0xeaa6a7,
-    0xeaa6a8,
-    0xeaa6a9,
-    0xeaa6aa,
-    0xeaa6ab,
-    0xeaa6ac,
-    0xeaa6ad,
-    0xeaa6ae,
-    0xeaa6af,
-    0xeaa6b0,
-    0xeaa6b1,
-    0xeaa6b2,
-    0xeaa6b3,
-    0xeaa6b4,
-    0xeaa6b5,
-    0xeaa6b6,
-    0xeaa6b7,
-    0xeaa6b8,
-    0xeaa6b9,
-    0xeaa6ba,
-    0xeaa6bb,
-    0xeaa6bc,
-    0xeaa6bd,
-    0xeaa6be,
-    0xeaa6bf,
-    0xeaa780,
-    0xeaa781,
-    0xeaa782,
-    0xeaa783,
-    0xeaa784,
-    0xeaa785,
-    0xeaa786,
-    0xeaa787,
-    0xeaa788,
-    0xeaa789,
-    0xeaa78a,
-    0xeaa78b,
-    0xeaa78c,
-    0xeaa78d,
-    0xeaa78e,
-    0xeaa78f,
-    0xeaa790,
-    0xeaa791,
-    0xeaa792,
-    0xeaa793,
-    0xeaa794,
-    0xeaa795,
-    0xeaa796,
-    0xeaa797,
-    0xeaa798,
-    0xeaa799,
-    0xeaa79a,
-    0xeaa79b,
-    0xeaa79c,
-    0xeaa79d,
-    0xeaa79e,
-    0xeaa79f,
-    0xeaa7a0,
-    0xeaa7a1,
-    0xeaa7a2,
-    0xeaa7a3,
-    0xeaa7a4,
-    0xeaa7a5,
-    0xeaa7a6,
-    0xeaa7a7,
-    0xeaa7a8,
-    0xeaa7a9,
-    0xeaa7aa,
-    0xeaa7ab,
-    0xeaa7ac,
-    0xeaa7ad,
-    0xeaa7ae,
-    0xeaa7af,
-    0xeaa7b0,
-    0xeaa7b1,
-    0xeaa7b2,
-    0xeaa7b3,
-    0xeaa7b4,
-    0xeaa7b5,
-    0xeaa7b6,
-    0xeaa7b7,
-    0xeaa7b8,
-    0xeaa7b9,
-    0xeaa7ba,
-    0xeaa7bb,
-    0xeaa7bc,
-    0xeaa7bd,
-    0xeaa7be,
-    0xeaa7bf,
-    0xeaa880,
-    0xeaa881,
-    0xeaa882,
-    0xeaa883,
-    0xeaa884,
-    0xeaa885,
-    0xeaa886,
-    0xeaa887,
-    0xeaa888,
-    0xeaa889,
-    0xeaa88a,
-    0xeaa88b,
-    0xeaa88c,
-    0xeaa88d,
-    0xeaa88e,
-    0xeaa88f,
-    0xeaa890,
-    0xeaa891,
-    0xeaa892,
-    0xeaa893,
-    0xeaa894,
-    0xeaa895,
-    0xeaa896,
-    0xeaa897,
-    0xeaa898,
-    0xeaa899,
-    0xeaa89a,
-    0xeaa89b,
-    0xeaa89c,
-    0xeaa89d,
-    0xeaa89e,
-    0xeaa89f,
-    0xeaa8a0,
-    0xeaa8a1,
-    0xeaa8a2,
-    0xeaa8a3,
-    0xeaa8a4,
-    0xeaa8a5,
-    0xeaa8a6,
-    0xeaa8a7,
-    0xeaa8a8,
-    0xeaa8a9,
-    0xeaa8aa,
-    0xeaa8ab,
-    0xeaa8ac,
-    0xeaa8ad,
-    0xeaa8ae,
-    0xeaa8af,
-    0xeaa8b0,
-    0xeaa8b1,
-    0xeaa8b2,
-    0xeaa8b3,
-    0xeaa8b4,
-    0xeaa8b5,
-    0xeaa8b6,
-    0xeaa8b7,
-    0xeaa8b8,
-    0xeaa8b9,
-    0xeaa8ba,
-    0xeaa8bb,
-    0xeaa8bc,
-    0xeaa8bd,
-    0xeaa8be,
-    0xeaa8bf,
-    0xeaa980,
-    0xeaa981,
-    0xeaa982,
-    0xeaa983,
-    0xeaa984,
-    0xeaa985,
-    0xeaa986,
-    0xeaa987,
-    0xeaa988,
-    0xeaa989,
-    0xeaa98a,
-    0xeaa98b,
-    0xeaa98c,
-    0xeaa98d,
-    0xeaa98e,
-    0xeaa98f,
-    0xeaa990,
-    0xeaa991,
-    0xeaa992,
-    0xeaa993,
-    0xeaa994,
-    0xeaa995,
-    0xeaa996,
-    0xeaa997,
-    0xeaa998,
-    0xeaa999,
-    0xeaa99a,
-    0xeaa99b,
-    0xeaa99c,
-    0xeaa99d,
-    0xeaa99e,
-    0xeaa99f,
-    0xeaa9a0,
-    0xeaa9a1,
-    0xeaa9a2,
-    0xeaa9a3,
-    0xeaa9a4,
-    0xeaa9a5,
-    0xeaa9a6,
-    0xeaa9a7,
-    0xeaa9a8,
-    0xeaa9a9,
-    0xeaa9aa,
-    0xeaa9ab,
-    0xeaa9ac,
-    0xeaa9ad,
-    0xeaa9ae,
-    0xeaa9af,
-    0xeaa9b0,
-    0xeaa9b1,
-    0xeaa9b2,
-    0xeaa9b3,
-    0xeaa9b4,
-    0xeaa9b5,
-    0xeaa9b6,
-    0xeaa9b7,
-    0xeaa9b8,
-    0xeaa9b9,
-    0xeaa9ba,
-    0xeaa9bb,
-    0xeaa9bc,
-    0xeaa9bd,
-    0xeaa9be,
-    0xeaa9bf,
-    0xeaaa80,
-    0xeaaa81,
-    0xeaaa82,
-    0xeaaa83,
-    0xeaaa84,
-    0xeaaa85,
-    0xeaaa86,
-    0xeaaa87,
-    0xeaaa88,
-    0xeaaa89,
-    0xeaaa8a,
-    0xeaaa8b,
-    0xeaaa8c,
-    0xeaaa8d,
-    0xeaaa8e,
-    0xeaaa8f,
-    0xeaaa90,
-    0xeaaa91,
-    0xeaaa92,
-    0xeaaa93,
-    0xeaaa94,
-    0xeaaa95,
-    0xeaaa96,
-    0xeaaa97,
-    0xeaaa98,
-    0xeaaa99,
-    0xeaaa9a,
-    0xeaaa9b,
-    0xeaaa9c,
-    0xeaaa9d,
-    0xeaaa9e,
-    0xeaaa9f,
-    0xeaaaa0,
-    0xeaaaa1,
-    0xeaaaa2,
-    0xeaaaa3,
-    0xeaaaa4,
-    0xeaaaa5,
-    0xeaaaa6,
-    0xeaaaa7,
-    0xeaaaa8,
-    0xeaaaa9,
-    0xeaaaaa,
-    0xeaaaab,
-    0xeaaaac,
-    0xeaaaad,
-    0xeaaaae,
-    0xeaaaaf,
-    0xeaaab0,
-    0xeaaab1,
-    0xeaaab2,
-    0xeaaab3,
-    0xeaaab4,
-    0xeaaab5,
-    0xeaaab6,
-    0xeaaab7,
-    0xeaaab8,
-    0xeaaab9,
-    0xeaaaba,
-    0xeaaabb,
-    0xeaaabc,
-    0xeaaabd,
-    0xeaaabe,
-    0xeaaabf,
-    0xeaab80,
-    0xeaab81,
-    0xeaab82,
-    0xeaab83,
-    0xeaab84,
-    0xeaab85,
-    0xeaab86,
-    0xeaab87,
-    0xeaab88,
-    0xeaab89,
-    0xeaab8a,
-    0xeaab8b,
-    0xeaab8c,
-    0xeaab8d,
-    0xeaab8e,
-    0xeaab8f,
-    0xeaab90,
-    0xeaab91,
-    0xeaab92,
-    0xeaab93,
-    0xeaab94,
-    0xeaab95,
-    0xeaab96,
-    0xeaab97,
-    0xeaab98,
-    0xeaab99,
-    0xeaab9a,
-    0xeaab9b,
-    0xeaab9c,
-    0xeaab9d,
-    0xeaab9e,
-    0xeaab9f,
-    0xeaaba0,
-    0xeaaba1,
-    0xeaaba2,
-    0xeaaba3,
-    0xeaaba4,
-    0xeaaba5,
-    0xeaaba6,
-    0xeaaba7,
-    0xeaaba8,
-    0xeaaba9,
-    0xeaabaa,
-    0xeaabab,
-    0xeaabac,
-    0xeaabad,
-    0xeaabae,
-    0xeaabaf,
-    0xeaabb0,
-    0xeaabb1,
-    0xeaabb2,
-    0xeaabb3,
-    0xeaabb4,
-    0xeaabb5,
-    0xeaabb6,
-    0xeaabb7,
-    0xeaabb8,
-    0xeaabb9,
-    0xeaabba,
-    0xeaabbb,
-    0xeaabbc,
-    0xeaabbd,
-    0xeaabbe,
-    0xeaabbf,
-    0xeaac80,
-    0xeaac81,
-    0xeaac82,
-    0xeaac83,
-    0xeaac84,
-    0xeaac85,
-    0xeaac86,
-    0xeaac87,
-    0xeaac88,
-    0xeaac89,
-    0xeaac8a,
-    0xeaac8b,
-    0xeaac8c,
-    0xeaac8d,
-    0xeaac8e,
-    0xeaac8f,
-    0xeaac90,
-    0xeaac91,
-    0xeaac92,
-    0xeaac93,
-    0xeaac94,
-    0xeaac95,
-    0xeaac96,
-    0xeaac97,
-    0xeaac98,
-    0xeaac99,
-    0xeaac9a,
-    0xeaac9b,
-    0xeaac9c,
-    0xeaac9d,
-    0xeaac9e,
-    0xeaac9f,
-    0xeaaca0,
-    0xeaaca1,
-    0xeaaca2,
-    0xeaaca3,
-    0xeaaca4,
-    0xeaaca5,
-    0xeaaca6,
-    0xeaaca7,
-    0xeaaca8,
-    0xeaaca9,
-    0xeaacaa,
-    0xeaacab,
-    0xeaacac,
-    0xeaacad,
-    0xeaacae,
-    0xeaacaf,
-    0xeaacb0,
-    0xeaacb1,
-    0xeaacb2,
-    0xeaacb3,
-    0xeaacb4,
-    0xeaacb5,
-    0xeaacb6,
-    0xeaacb7,
-    0xeaacb8,
-    0xeaacb9,
-    0xeaacba,
-    0xeaacbb,
-    0xeaacbc,
-    0xeaacbd,
-    0xeaacbe,
-    0xeaacbf,
-    0xeaad80,
-    0xeaad81,
-    0xeaad82,
-    0xeaad83,
-    0xeaad84,
-    0xeaad85,
-    0xeaad86,
-    0xeaad87,
-    0xeaad88,
-    0xeaad89,
-    0xeaad8a,
-    0xeaad8b,
-    0xeaad8c,
-    0xeaad8d,
-    0xeaad8e,
-    0xeaad8f,
-    0xeaad90,
-    0xeaad91,
-    0xeaad92,
-    0xeaad93,
-    0xeaad94,
-    0xeaad95,
-    0xeaad96,
-    0xeaad97,
-    0xeaad98,
-    0xeaad99,
-    0xeaad9a,
-    0xeaad9b,
-    0xeaad9c,
-    0xeaad9d,
-    0xeaad9e,
-    0xeaad9f,
-    0xeaada0,
-    0xeaada1,
-    0xeaada2,
-    0xeaada3,
-    0xeaada4,
-    0xeaada5,
-    0xeaada6,
-    0xeaada7,
-    0xeaada8,
-    0xeaada9,
-    0xeaadaa,
-    0xeaadab,
-    0xeaadac,
-    0xeaadad,
-    0xeaadae,
-    0xeaadaf,
-    0xeaadb0,
-    0xeaadb1,
-    0xeaadb2,
-    0xeaadb3,
-    0xeaadb4,
-    0xeaadb5,
-    0xeaadb6,
-    0xeaadb7,
-    0xeaadb8,
-    0xeaadb9,
-    0xeaadba,
-    0xeaadbb,
-    0xeaadbc,
-    0xeaadbd,
-    0xeaadbe,
-    0xeaadbf,
-    0xeaae80,
-    0xeaae81,
-    0xeaae82,
-    0xeaae83,
-    0xeaae84,
-    0xeaae85,
-    0xeaae86,
-    0xeaae87,
-    0xeaae88,
-    0xeaae89,
-    0xeaae8a,
-    0xeaae8b,
-    0xeaae8c,
-    0xeaae8d,
-    0xeaae8e,
-    0xeaae8f,
-    0xeaae90,
-    0xeaae91,
-    0xeaae92,
-    0xeaae93,
-    0xeaae94,
-    0xeaae95,
-    0xeaae96,
-    0xeaae97,
-    0xeaae98,
-    0xeaae99,
-    0xeaae9a,
-    0xeaae9b,
-    0xeaae9c,
-    0xeaae9d,
-    0xeaae9e,
-    0xeaae9f,
-    0xeaaea0,
-    0xeaaea1,
-    0xeaaea2,
-    0xeaaea3,
-    0xeaaea4,
-    0xeaaea5,
-    0xeaaea6,
-    0xeaaea7,
-    0xeaaea8,
-    0xeaaea9,
-    0xeaaeaa,
-    0xeaaeab,
-    0xeaaeac,
-    0xeaaead,
-    0xeaaeae,
-    0xeaaeaf,
-    0xeaaeb0,
-    0xeaaeb1,
-    0xeaaeb2,
-    0xeaaeb3,
-    0xeaaeb4,
-    0xeaaeb5,
-    0xeaaeb6,
-    0xeaaeb7,
-    0xeaaeb8,
-    0xeaaeb9,
-    0xeaaeba,
-    0xeaaebb,
-    0xeaaebc,
-    0xeaaebd,
-    0xeaaebe,
-    0xeaaebf,
-    0xeaaf80,
-    0xeaaf81,
-    0xeaaf82,
-    0xeaaf83,
-    0xeaaf84,
-    0xeaaf85,
-    0xeaaf86,
-    0xeaaf87,
-    0xeaaf88,
-    0xeaaf89,
-    0xeaaf8a,
-    0xeaaf8b,
-    0xeaaf8c,
-    0xeaaf8d,
-    0xeaaf8e,
-    0xeaaf8f,
-    0xeaaf90,
-    0xeaaf91,
-    0xeaaf92,
-    0xeaaf93,
-    0xeaaf94,
-    0xeaaf95,
-    0xeaaf96,
-    0xeaaf97,
-    0xeaaf98,
-    0xeaaf99,
-    0xeaaf9a,
-    0xeaaf9b,
-    0xeaaf9c,
-    0xeaaf9d,
-    0xeaaf9e,
-    0xeaaf9f,
-    0xeaafa0,
-    0xeaafa1,
-    0xeaafa2,
-    0xeaafa3,
-    0xeaafa4,
-    0xeaafa5,
-    0xeaafa6,
-    0xeaafa7,
-    0xeaafa8,
-    0xeaafa9,
-    0xeaafaa,
-    0xeaafab,
-    0xeaafac,
-    0xeaafad,
-    0xeaafae,
-    0xeaafaf,
-    0xeaafb0,
-    0xeaafb1,
-    0xeaafb2,
-    0xeaafb3,
-    0xeaafb4,
-    0xeaafb5,
-    0xeaafb6,
-    0xeaafb7,
-    0xeaafb8,
-    0xeaafb9,
-    0xeaafba,
-    0xeaafbb,
-    0xeaafbc,
-    0xeaafbd,
-    0xeaafbe,
-    0xeaafbf,
-    0xeab080,
-    0xeab081,
-    0xeab082,
-    0xeab083,
-    0xeab084,
-    0xeab085,
-    0xeab086,
-    0xeab087,
-    0xeab088,
-    0xeab089,
-    0xeab08a,
-    0xeab08b,
-    0xeab08c,
-    0xeab08d,
-    0xeab08e,
-    0xeab08f,
-    0xeab090,
-    0xeab091,
-    0xeab092,
-    0xeab093,
-    0xeab094,
-    0xeab095,
-    0xeab096,
-    0xeab097,
-    0xeab098,
-    0xeab099,
-    0xeab09a,
-    0xeab09b,
-    0xeab09c,
-    0xeab09d,
-    0xeab09e,
-    0xeab09f,
-    0xeab0a0,
-    0xeab0a1,
-    0xeab0a2,
-    0xeab0a3,
-    0xeab0a4,
-    0xeab0a5,
-    0xeab0a6,
-    0xeab0a7,
-    0xeab0a8,
-    0xeab0a9,
-    0xeab0aa,
-    0xeab0ab,
-    0xeab0ac,
-    0xeab0ad,
-    0xeab0ae,
-    0xeab0af,
-    0xeab0b0,
-    0xeab0b1,
-    0xeab0b2,
-    0xeab0b3,
-    0xeab0b4,
-    0xeab0b5,
-    0xeab0b6,
-    0xeab0b7,
-    0xeab0b8,
-    0xeab0b9,
-    0xeab0ba,
-    0xeab0bb,
-    0xeab0bc,
-    0xeab0bd,
-    0xeab0be,
-    0xeab0bf,
-    0xeab180,
-    0xeab181,
-    0xeab182,
-    0xeab183,
-    0xeab184,
-    0xeab185,
-    0xeab186,
-    0xeab187,
-    0xeab188,
-    0xeab189,
-    0xeab18a,
-    0xeab18b,
-    0xeab18c,
-    0xeab18d,
-    0xeab18e,
-    0xeab18f,
-    0xeab190,
-    0xeab191,
-    0xeab192,
-    0xeab193,
-    0xeab194,
-    0xeab195,
-    0xeab196,
-    0xeab197,
-    0xeab198,
-    0xeab199,
-    0xeab19a,
-    0xeab19b,
-    0xeab19c,
-    0xeab19d,
-    0xeab19e,
-    0xeab19f,
-    0xeab1a0,
-    0xeab1a1,
-    0xeab1a2,
-    0xeab1a3,
-    0xeab1a4,
-    0xeab1a5,
-    0xeab1a6,
-    0xeab1a7,
-    0xeab1a8,
-    0xeab1a9,
-    0xeab1aa,
-    0xeab1ab,
-    0xeab1ac,
-    0xeab1ad,
-    0xeab1ae,
-    0xeab1af,
-    0xeab1b0,
-    0xeab1b1,
-    0xeab1b2,
-    0xeab1b3,
-    0xeab1b4,
-    0xeab1b5,
-    0xeab1b6,
-    0xeab1b7,
-    0xeab1b8,
-    0xeab1b9,
-    0xeab1ba,
-    0xeab1bb,
-    0xeab1bc,
-    0xeab1bd,
-    0xeab1be,
-    0xeab1bf,
-    0xeab280,
-    0xeab281,
-    0xeab282,
-    0xeab283,
-    0xeab284,
-    0xeab285,
-    0xeab286,
-    0xeab287,
-    0xeab288,
-    0xeab289,
-    0xeab28a,
-    0xeab28b,
-    0xeab28c,
-    0xeab28d,
-    0xeab28e,
-    0xeab28f,
-    0xeab290,
-    0xeab291,
-    0xeab292,
-    0xeab293,
-    0xeab294,
-    0xeab295,
-    0xeab296,
-    0xeab297,
-    0xeab298,
-    0xeab299,
-    0xeab29a,
-    0xeab29b,
-    0xeab29c,
-    0xeab29d,
-    0xeab29e,
-    0xeab29f,
-    0xeab2a0,
-    0xeab2a1,
-    0xeab2a2,
-    0xeab2a3,
-    0xeab2a4,
-    0xeab2a5,
-    0xeab2a6,
-    0xeab2a7,
-    0xeab2a8,
-    0xeab2a9,
-    0xeab2aa,
-    0xeab2ab,
-    0xeab2ac,
-    0xeab2ad,
-    0xeab2ae,
-    0xeab2af,
-    0xeab2b0,
-    0xeab2b1,
-    0xeab2b2,
-    0xeab2b3,
-    0xeab2b4,
-    0xeab2b5,
-    0xeab2b6,
-    0xeab2b7,
-    0xeab2b8,
-    0xeab2b9,
-    0xeab2ba,
-    0xeab2bb,
-    0xeab2bc,
-    0xeab2bd,
-    0xeab2be,
-    0xeab2bf,
-    0xeab380,
-    0xeab381,
-    0xeab382,
-    0xeab383,
-    0xeab384,
-    0xeab385,
-    0xeab386,
-    0xeab387,
-    0xeab388,
-    0xeab389,
-    0xeab38a,
-    0xeab38b,
-    0xeab38c,
-    0xeab38d,
-    0xeab38e,
-    0xeab38f,
-    0xeab390,
-    0xeab391,
-    0xeab392,
-    0xeab393,
-    0xeab394,
-    0xeab395,
-    0xeab396,
-    0xeab397,
-    0xeab398,
-    0xeab399,
-    0xeab39a,
-    0xeab39b,
-    0xeab39c,
-    0xeab39d,
-    0xeab39e,
-    0xeab39f,
-    0xeab3a0,
-    0xeab3a1,
-    0xeab3a2,
-    0xeab3a3,
-    0xeab3a4,
-    0xeab3a5,
-    0xeab3a6,
-    0xeab3a7,
-    0xeab3a8,
-    0xeab3a9,
-    0xeab3aa,
-    0xeab3ab,
-    0xeab3ac,
-    0xeab3ad,
-    0xeab3ae,
-    0xeab3af,
-    0xeab3b0,
-    0xeab3b1,
-    0xeab3b2,
-    0xeab3b3,
-    0xeab3b4,
-    0xeab3b5,
-    0xeab3b6,
-    0xeab3b7,
-    0xeab3b8,
-    0xeab3b9,
-    0xeab3ba,
-    0xeab3bb,
-    0xeab3bc,
-    0xeab3bd,
-    0xeab3be,
-    0xeab3bf,
-    0xeab480,
-    0xeab481,
-    0xeab482,
-    0xeab483,
-    0xeab484,
-    0xeab485,
-    0xeab486,
-    0xeab487,
-    0xeab488,
-    0xeab489,
-    0xeab48a,
-    0xeab48b,
-    0xeab48c,
-    0xeab48d,
-    0xeab48e,
-    0xeab48f,
-    0xeab490,
-    0xeab491,
-    0xeab492,
-    0xeab493,
-    0xeab494,
-    0xeab495,
-    0xeab496,
-    0xeab497,
-    0xeab498,
-    0xeab499,
-    0xeab49a,
-    0xeab49b,
-    0xeab49c,
-    0xeab49d,
-    0xeab49e,
-    0xeab49f,
-    0xeab4a0,
-    0xeab4a1,
-    0xeab4a2,
-    0xeab4a3,
-    0xeab4a4,
-    0xeab4a5,
-    0xeab4a6,
-    0xeab4a7,
-    0xeab4a8,
-    0xeab4a9,
-    0xeab4aa,
-    0xeab4ab,
-    0xeab4ac,
-    0xeab4ad,
-    0xeab4ae,
-    0xeab4af,
-    0xeab4b0,
-    0xeab4b1,
-    0xeab4b2,
-    0xeab4b3,
-    0xeab4b4,
-    0xeab4b5,
-    0xeab4b6,
-    0xeab4b7,
-    0xeab4b8,
-    0xeab4b9,
-    0xeab4ba,
-    0xeab4bb,
-    0xeab4bc,
-    0xeab4bd,
-    0xeab4be,
-    0xeab4bf,
-    0xeab580,
-    0xeab581,
-    0xeab582,
-    0xeab583,
-    0xeab584,
-    0xeab585,
-    0xeab586,
-    0xeab587,
-    0xeab588,
-    0xeab589,
-    0xeab58a,
-    0xeab58b,
-    0xeab58c,
-    0xeab58d,
-    0xeab58e,
-    0xeab58f,
-    0xeab590,
-    0xeab591,
-    0xeab592,
-    0xeab593,
-    0xeab594,
-    0xeab595,
-    0xeab596,
-    0xeab597,
-    0xeab598,
-    0xeab599,
-    0xeab59a,
-    0xeab59b,
-    0xeab59c,
-    0xeab59d,
-    0xeab59e,
-    0xeab59f,
-    0xeab5a0,
-    0xeab5a1,
-    0xeab5a2,
-    0xeab5a3,
-    0xeab5a4,
-    0xeab5a5,
-    0xeab5a6,
-    0xeab5a7,
-    0xeab5a8,
-    0xeab5a9,
-    0xeab5aa,
-    0xeab5ab,
-    0xeab5ac,
-    0xeab5ad,
-    0xeab5ae,
-    0xeab5af,
-    0xeab5b0,
-    0xeab5b1,
-    0xeab5b2,
-    0xeab5b3,
-    0xeab5b4,
-    0xeab5b5,
-    0xeab5b6,
-    0xeab5b7,
-    0xeab5b8,
-    0xeab5b9,
-    0xeab5ba,
-    0xeab5bb,
-    0xeab5bc,
-    0xeab5bd,
-    0xeab5be,
-    0xeab5bf,
-    0xeab680,
-    0xeab681,
-    0xeab682,
-    0xeab683,
-    0xeab684,
-    0xeab685,
-    0xeab686,
-    0xeab687,
-    0xeab688,
-    0xeab689,
-    0xeab68a,
-    0xeab68b,
-    0xeab68c,
-    0xeab68d,
-    0xeab68e,
-    0xeab68f,
-    0xeab690,
-    0xeab691,
-    0xeab692,
-    0xeab693,
-    0xeab694,
-    0xeab695,
-    0xeab696,
-    0xeab697,
-    0xeab698,
-    0xeab699,
-    0xeab69a,
-    0xeab69b,
-    0xeab69c,
-    0xeab69d,
-    0xeab69e,
-    0xeab69f,
-    0xeab6a0,
-    0xeab6a1,
-    0xeab6a2,
-    0xeab6a3,
-    0xeab6a4,
-    0xeab6a5,
-    0xeab6a6,
-    0xeab6a7,
-    0xeab6a8,
-    0xeab6a9,
-    0xeab6aa,
-    0xeab6ab,
-    0xeab6ac,
-    0xeab6ad,
-    0xeab6ae,
-    0xeab6af,
-    0xeab6b0,
-    0xeab6b1,
-    0xeab6b2,
-    0xeab6b3,
-    0xeab6b4,
-    0xeab6b5,
-    0xeab6b6,
-    0xeab6b7,
-    0xeab6b8,
-    0xeab6b9,
-    0xeab6ba,
-    0xeab6bb,
-    0xeab6bc,
-    0xeab6bd,
-    0xeab6be,
-    0xeab6bf,
-    0xeab780,
-    0xeab781,
-    0xeab782,
-    0xeab783,
-    0xeab784,
-    0xeab785,
-    0xeab786,
-    0xeab787,
-    0xeab788,
-    0xeab789,
-    0xeab78a,
-    0xeab78b,
-    0xeab78c,
-    0xeab78d,
-    0xeab78e,
-    0xeab78f,
-    0xeab790,
-    0xeab791,
-    0xeab792,
-    0xeab793,
-    0xeab794,
-    0xeab795,
-    0xeab796,
-    0xeab797,
-    0xeab798,
-    0xeab799,
-    0xeab79a,
-    0xeab79b,
-    0xeab79c,
-    0xeab79d,
-    0xeab79e,
-    0xeab79f,
-    0xeab7a0,
-    0xeab7a1,
-    0xeab7a2,
-    0xeab7a3,
-    0xeab7a4,
-    0xeab7a5,
-    0xeab7a6,
-    0xeab7a7,
-    0xeab7a8,
-    0xeab7a9,
-    0xeab7aa,
-    0xeab7ab,
-    0xeab7ac,
-    0xeab7ad,
-    0xeab7ae,
-    0xeab7af,
-    0xeab7b0,
-    0xeab7b1,
-    0xeab7b2,
-    0xeab7b3,
-    0xeab7b4,
-    0xeab7b5,
-    0xeab7b6,
-    0xeab7b7,
-    0xeab7b8,
-    0xeab7b9,
-    0xeab7ba,
-    0xeab7bb,
-    0xeab7bc,
-    0xeab7bd,
-    0xeab7be,
-    0xeab7bf,
-    0xeab880,
-    0xeab881,
-    0xeab882,
-    0xeab883,
-    0xeab884,
-    0xeab885,
-    0xeab886,
-    0xeab887,
-    0xeab888,
-    0xeab889,
-    0xeab88a,
-    0xeab88b,
-    0xeab88c,
-    0xeab88d,
-    0xeab88e,
-    0xeab88f,
-    0xeab890,
-    0xeab891,
-    0xeab892,
-    0xeab893,
-    0xeab894,
-    0xeab895,
-    0xeab896,
-    0xeab897,
-    0xeab898,
-    0xeab899,
-    0xeab89a,
-    0xeab89b,
-    0xeab89c,
-    0xeab89d,
-    0xeab89e,
-    0xeab89f,
-    0xeab8a0,
-    0xeab8a1,
-    0xeab8a2,
-    0xeab8a3,
-    0xeab8a4,
-    0xeab8a5,
-    0xeab8a6,
-    0xeab8a7,
-    0xeab8a8,
-    0xeab8a9,
-    0xeab8aa,
-    0xeab8ab,
-    0xeab8ac,
-    0xeab8ad,
-    0xeab8ae,
-    0xeab8af,
-    0xeab8b0,
-    0xeab8b1,
-    0xeab8b2,
-    0xeab8b3,
-    0xeab8b4,
-    0xeab8b5,
-    0xeab8b6,
-    0xeab8b7,
-    0xeab8b8,
-    0xeab8b9,
-    0xeab8ba,
-    0xeab8bb,
-    0xeab8bc,
-    0xeab8bd,
-    0xeab8be,
-    0xeab8bf,
-    0xeab980,
-    0xeab981,
-    0xeab982,
-    0xeab983,
-    0xeab984,
-    0xeab985,
-    0xeab986,
-    0xeab987,
-    0xeab988,
-    0xeab989,
-    0xeab98a,
-    0xeab98b,
-    0xeab98c,
-    0xeab98d,
-    0xeab98e,
-    0xeab98f,
-    0xeab990,
-    0xeab991,
-    0xeab992,
-    0xeab993,
-    0xeab994,
-    0xeab995,
-    0xeab996,
-    0xeab997,
-    0xeab998,
-    0xeab999,
-    0xeab99a,
-    0xeab99b,
-    0xeab99c,
-    0xeab99d,
-    0xeab99e,
-    0xeab99f,
-    0xeab9a0,
-    0xeab9a1,
-    0xeab9a2,
-    0xeab9a3,
-    0xeab9a4,
-    0xeab9a5,
-    0xeab9a6,
-    0xeab9a7,
-    0xeab9a8,
-    0xeab9a9,
-    0xeab9aa,
-    0xeab9ab,
-    0xeab9ac,
-    0xeab9ad,
-    0xeab9ae,
-    0xeab9af,
-    0xeab9b0,
-    0xeab9b1,
-    0xeab9b2,
-    0xeab9b3,
-    0xeab9b4,
-    0xeab9b5,
-    0xeab9b6,
-    0xeab9b7,
-    0xeab9b8,
-    0xeab9b9,
-    0xeab9ba,
-    0xeab9bb,
-    0xeab9bc,
-    0xeab9bd,
-    0xeab9be,
-    0xeab9bf,
-    0xeaba80,
-    0xeaba81,
-    0xeaba82,
-    0xeaba83,
-    0xeaba84,
-    0xeaba85,
-    0xeaba86,
-    0xeaba87,
-    0xeaba88,
-    0xeaba89,
-    0xeaba8a,
-    0xeaba8b,
-    0xeaba8c,
-    0xeaba8d,
-    0xeaba8e,
-    0xeaba8f,
-    0xeaba90,
-    0xeaba91,
-    0xeaba92,
-    0xeaba93,
-    0xeaba94,
-    0xeaba95,
-    0xeaba96,
-    0xeaba97,
-    0xeaba98,
-    0xeaba99,
-    0xeaba9a,
-    0xeaba9b,
-    0xeaba9c,
-    0xeaba9d,
-    0xeaba9e,
-    0xeaba9f,
-    0xeabaa0,
-    0xeabaa1,
-    0xeabaa2,
-    0xeabaa3,
-    0xeabaa4,
-    0xeabaa5,
-    0xeabaa6,
-    0xeabaa7,
-    0xeabaa8,
-    0xeabaa9,
-    0xeabaaa,
-    0xeabaab,
-    0xeabaac,
-    0xeabaad,
-    0xeabaae,
-    0xeabaaf,
-    0xeabab0,
-    0xeabab1,
-    0xeabab2,
-    0xeabab3,
-    0xeabab4,
-    0xeabab5,
-    0xeabab6,
-    0xeabab7,
-    0xeabab8,
-    0xeabab9,
-    0xeababa,
-    0xeababb,
-    0xeababc,
-    0xeababd,
-    0xeababe,
-    0xeababf,
-    0xeabb80,
-    0xeabb81,
-    0xeabb82,
-    0xeabb83,
-    0xeabb84,
-    0xeabb85,
-    0xeabb86,
-    0xeabb87,
-    0xeabb88,
-    0xeabb89,
-    0xeabb8a,
-    0xeabb8b,
-    0xeabb8c,
-    0xeabb8d,
-    0xeabb8e,
-    0xeabb8f,
-    0xeabb90,
-    0xeabb91,
-    0xeabb92,
-    0xeabb93,
-    0xeabb94,
-    0xeabb95,
-    0xeabb96,
-    0xeabb97,
-    0xeabb98,
-    0xeabb99,
-    0xeabb9a,
-    0xeabb9b,
-    0xeabb9c,
-    0xeabb9d,
-    0xeabb9e,
-    0xeabb9f,
-    0xeabba0,
-    0xeabba1,
-    0xeabba2,
-    0xeabba3,
-    0xeabba4,
-    0xeabba5,
-    0xeabba6,
-    0xeabba7,
-    0xeabba8,
-    0xeabba9,
-    0xeabbaa,
-    0xeabbab,
-    0xeabbac,
-    0xeabbad,
-    0xeabbae,
-    0xeabbaf,
-    0xeabbb0,
-    0xeabbb1,
-    0xeabbb2,
-    0xeabbb3,
-    0xeabbb4,
-    0xeabbb5,
-    0xeabbb6,
-    0xeabbb7,
-    0xeabbb8,
-    0xeabbb9,
-    0xeabbba,
-    0xeabbbb,
-    0xeabbbc,
-    0xeabbbd,
-    0xeabbbe,
-    0xeabbbf,
-    0xeabc80,
-    0xeabc81,
-    0xeabc82,
-    0xeabc83,
-    0xeabc84,
-    0xeabc85,
-    0xeabc86,
-    0xeabc87,
-    0xeabc88,
-    0xeabc89,
-    0xeabc8a,
-    0xeabc8b,
-    0xeabc8c,
-    0xeabc8d,
-    0xeabc8e,
-    0xeabc8f,
-    0xeabc90,
-    0xeabc91,
-    0xeabc92,
-    0xeabc93,
-    0xeabc94,
-    0xeabc95,
-    0xeabc96,
-    0xeabc97,
-    0xeabc98,
-    0xeabc99,
-    0xeabc9a,
-    0xeabc9b,
-    0xeabc9c,
-    0xeabc9d,
-    0xeabc9e,
-    0xeabc9f,
-    0xeabca0,
-    0xeabca1,
-    0xeabca2,
-    0xeabca3,
-    0xeabca4,
-    0xeabca5,
-    0xeabca6,
-    0xeabca7,
-    0xeabca8,
-    0xeabca9,
-    0xeabcaa,
-    0xeabcab,
-    0xeabcac,
-    0xeabcad,
-    0xeabcae,
-    0xeabcaf,
-    0xeabcb0,
-    0xeabcb1,
-    0xeabcb2,
-    0xeabcb3,
-    0xeabcb4,
-    0xeabcb5,
-    0xeabcb6,
-    0xeabcb7,
-    0xeabcb8,
-    0xeabcb9,
-    0xeabcba,
-    0xeabcbb,
-    0xeabcbc,
-    0xeabcbd,
-    0xeabcbe,
-    0xeabcbf,
-    0xeabd80,
-    0xeabd81,
-    0xeabd82,
-    0xeabd83,
-    0xeabd84,
-    0xeabd85,
-    0xeabd86,
-    0xeabd87,
-    0xeabd88,
-    0xeabd89,
-    0xeabd8a,
-    0xeabd8b,
-    0xeabd8c,
-    0xeabd8d,
-    0xeabd8e,
-    0xeabd8f,
-    0xeabd90,
-    0xeabd91,
-    0xeabd92,
-    0xeabd93,
-    0xeabd94,
-    0xeabd95,
-    0xeabd96,
-    0xeabd97,
-    0xeabd98,
-    0xeabd99,
-    0xeabd9a,
-    0xeabd9b,
-    0xeabd9c,
-    0xeabd9d,
-    0xeabd9e,
-    0xeabd9f,
-    0xeabda0,
-    0xeabda1,
-    0xeabda2,
-    0xeabda3,
-    0xeabda4,
-    0xeabda5,
-    0xeabda6,
-    0xeabda7,
-    0xeabda8,
-    0xeabda9,
-    0xeabdaa,
-    0xeabdab,
-    0xeabdac,
-    0xeabdad,
-    0xeabdae,
-    0xeabdaf,
-    0xeabdb0,
-    0xeabdb1,
-    0xeabdb2,
-    0xeabdb3,
-    0xeabdb4,
-    0xeabdb5,
-    0xeabdb6,
-    0xeabdb7,
-    0xeabdb8,
-    0xeabdb9,
-    0xeabdba,
-    0xeabdbb,
-    0xeabdbc,
-    0xeabdbd,
-    0xeabdbe,
-    0xeabdbf,
-    0xeabe80,
-    0xeabe81,
-    0xeabe82,
-    0xeabe83,
-    0xeabe84,
-    0xeabe85,
-    0xeabe86,
-    0xeabe87,
-    0xeabe88,
-    0xeabe89,
-    0xeabe8a,
-    0xeabe8b,
-    0xeabe8c,
-    0xeabe8d,
-    0xeabe8e,
-    0xeabe8f,
-    0xeabe90,
-    0xeabe91,
-    0xeabe92,
-    0xeabe93,
-    0xeabe94,
-    0xeabe95,
-    0xeabe96,
-    0xeabe97,
-    0xeabe98,
-    0xeabe99,
-    0xeabe9a,
-    0xeabe9b,
-    0xeabe9c,
-    0xeabe9d,
-    0xeabe9e,
-    0xeabe9f,
-    0xeabea0,
-    0xeabea1,
-    0xeabea2,
-    0xeabea3,
-    0xeabea4,
-    0xeabea5,
-    0xeabea6,
-    0xeabea7,
-    0xeabea8,
-    0xeabea9,
-    0xeabeaa,
-    0xeabeab,
-    0xeabeac,
-    0xeabead,
-    0xeabeae,
-    0xeabeaf,
-    0xeabeb0,
-    0xeabeb1,
-    0xeabeb2,
-    0xeabeb3,
-    0xeabeb4,
-    0xeabeb5,
-    0xeabeb6,
-    0xeabeb7,
-    0xeabeb8,
-    0xeabeb9,
-    0xeabeba,
-    0xeabebb,
-    0xeabebc,
-    0xeabebd,
-    0xeabebe,
-    0xeabebf,
-    0xeabf80,
-    0xeabf81,
-    0xeabf82,
-    0xeabf83,
-    0xeabf84,
-    0xeabf85,
-    0xeabf86,
-    0xeabf87,
-    0xeabf88,
-    0xeabf89,
-    0xeabf8a,
-    0xeabf8b,
-    0xeabf8c,
-    0xeabf8d,
-    0xeabf8e,
-    0xeabf8f,
-    0xeabf90,
-    0xeabf91,
-    0xeabf92,
-    0xeabf93,
-    0xeabf94,
-    0xeabf95,
-    0xeabf96,
-    0xeabf97,
-    0xeabf98,
-    0xeabf99,
-    0xeabf9a,
-    0xeabf9b,
-    0xeabf9c,
-    0xeabf9d,
-    0xeabf9e,
-    0xeabf9f,
-    0xeabfa0,
-    0xeabfa1,
-    0xeabfa2,
-    0xeabfa3,
-    0xeabfa4,
-    0xeabfa5,
-    0xeabfa6,
-    0xeabfa7,
-    0xeabfa8,
-    0xeabfa9,
-    0xeabfaa,
-    0xeabfab,
-    0xeabfac,
-    0xeabfad,
-    0xeabfae,
-    0xeabfaf,
-    0xeabfb0,
-    0xeabfb1,
-    0xeabfb2,
-    0xeabfb3,
-    0xeabfb4,
-    0xeabfb5,
-    0xeabfb6,
-    0xeabfb7,
-    0xeabfb8,
-    0xeabfb9,
-    0xeabfba,
-    0xeabfbb,
-    0xeabfbc,
-    0xeabfbd,
-    0xeabfbe,
-    0xeabfbf,
-    0xeb8080,
-    0xeb8081,
-    0xeb8082,
-    0xeb8083,
-    0xeb8084,
-    0xeb8085,
-    0xeb8086,
-    0xeb8087,
-    0xeb8088,
-    0xeb8089,
-    0xeb808a,
-    0xeb808b,
-    0xeb808c,
-    0xeb808d,
-    0xeb808e,
-    0xeb808f,
-    0xeb8090,
-    0xeb8091,
-    0xeb8092,
-    0xeb8093,
-    0xeb8094,
-    0xeb8095,
-    0xeb8096,
-    0xeb8097,
-    0xeb8098,
-    0xeb8099,
-    0xeb809a,
-    0xeb809b,
-    0xeb809c,
-    0xeb809d,
-    0xeb809e,
-    0xeb809f,
-    0xeb80a0,
-    0xeb80a1,
-    0xeb80a2,
-    0xeb80a3,
-    0xeb80a4,
-    0xeb80a5,
-    0xeb80a6,
-    0xeb80a7,
-    0xeb80a8,
-    0xeb80a9,
-    0xeb80aa,
-    0xeb80ab,
-    0xeb80ac,
-    0xeb80ad,
-    0xeb80ae,
-    0xeb80af,
-    0xeb80b0,
-    0xeb80b1,
-    0xeb80b2,
-    0xeb80b3,
-    0xeb80b4,
-    0xeb80b5,
-    0xeb80b6,
-    0xeb80b7,
-    0xeb80b8,
-    0xeb80b9,
-    0xeb80ba,
-    0xeb80bb,
-    0xeb80bc,
-    0xeb80bd,
-    0xeb80be,
-    0xeb80bf,
-    0xeb8180,
-    0xeb8181,
-    0xeb8182,
-    0xeb8183,
-    0xeb8184,
-    0xeb8185,
-    0xeb8186,
-    0xeb8187,
-    0xeb8188,
-    0xeb8189,
-    0xeb818a,
-    0xeb818b,
-    0xeb818c,
-    0xeb818d,
-    0xeb818e,
-    0xeb818f,
-    0xeb8190,
-    0xeb8191,
-    0xeb8192,
-    0xeb8193,
-    0xeb8194,
-    0xeb8195,
-    0xeb8196,
-    0xeb8197,
-    0xeb8198,
-    0xeb8199,
-    0xeb819a,
-    0xeb819b,
-    0xeb819c,
-    0xeb819d,
-    0xeb819e,
-    0xeb819f,
-    0xeb81a0,
-    0xeb81a1,
-    0xeb81a2,
-    0xeb81a3,
-    0xeb81a4,
-    0xeb81a5,
-    0xeb81a6,
-    0xeb81a7,
-    0xeb81a8,
-    0xeb81a9,
-    0xeb81aa,
-    0xeb81ab,
-    0xeb81ac,
-    0xeb81ad,
-    0xeb81ae,
-    0xeb81af,
-    0xeb81b0,
-    0xeb81b1,
-    0xeb81b2,
-    0xeb81b3,
-    0xeb81b4,
-    0xeb81b5,
-    0xeb81b6,
-    0xeb81b7,
-    0xeb81b8,
-    0xeb81b9,
-    0xeb81ba,
-    0xeb81bb,
-    0xeb81bc,
-    0xeb81bd,
-    0xeb81be,
-    0xeb81bf,
-    0xeb8280,
-    0xeb8281,
-    0xeb8282,
-    0xeb8283,
-    0xeb8284,
-    0xeb8285,
-    0xeb8286,
-    0xeb8287,
-    0xeb8288,
-    0xeb8289,
-    0xeb828a,
-    0xeb828b,
-    0xeb828c,
-    0xeb828d,
-    0xeb828e,
-    0xeb828f,
-    0xeb8290,
-    0xeb8291,
-    0xeb8292,
-    0xeb8293,
-    0xeb8294,
-    0xeb8295,
-    0xeb8296,
-    0xeb8297,
-    0xeb8298,
-    0xeb8299,
-    0xeb829a,
-    0xeb829b,
-    0xeb829c,
-    0xeb829d,
-    0xeb829e,
-    0xeb829f,
-    0xeb82a0,
-    0xeb82a1,
-    0xeb82a2,
-    0xeb82a3,
-    0xeb82a4,
-    0xeb82a5,
-    0xeb82a6,
-    0xeb82a7,
-    0xeb82a8,
-    0xeb82a9,
-    0xeb82aa,
-    0xeb82ab,
-    0xeb82ac,
-    0xeb82ad,
-    0xeb82ae,
-    0xeb82af,
-    0xeb82b0,
-    0xeb82b1,
-    0xeb82b2,
-    0xeb82b3,
-    0xeb82b4,
-    0xeb82b5,
-    0xeb82b6,
-    0xeb82b7,
-    0xeb82b8,
-    0xeb82b9,
-    0xeb82ba,
-    0xeb82bb,
-    0xeb82bc,
-    0xeb82bd,
-    0xeb82be,
-    0xeb82bf,
-    0xeb8380,
-    0xeb8381,
-    0xeb8382,
-    0xeb8383,
-    0xeb8384,
-    0xeb8385,
-    0xeb8386,
-    0xeb8387,
-    0xeb8388,
-    0xeb8389,
-    0xeb838a,
-    0xeb838b,
-    0xeb838c,
-    0xeb838d,
-    0xeb838e,
-    0xeb838f,
-    0xeb8390,
-    0xeb8391,
-    0xeb8392,
-    0xeb8393,
-    0xeb8394,
-    0xeb8395,
-    0xeb8396,
-    0xeb8397,
-    0xeb8398,
-    0xeb8399,
-    0xeb839a,
-    0xeb839b,
-    0xeb839c,
-    0xeb839d,
-    0xeb839e,
-    0xeb839f,
-    0xeb83a0,
-    0xeb83a1,
-    0xeb83a2,
-    0xeb83a3,
-    0xeb83a4,
-    0xeb83a5,
-    0xeb83a6,
-    0xeb83a7,
-    0xeb83a8,
-    0xeb83a9,
-    0xeb83aa,
-    0xeb83ab,
-    0xeb83ac,
-    0xeb83ad,
-    0xeb83ae,
-    0xeb83af,
-    0xeb83b0,
-    0xeb83b1,
-    0xeb83b2,
-    0xeb83b3,
-    0xeb83b4,
-    0xeb83b5,
-    0xeb83b6,
-    0xeb83b7,
-    0xeb83b8,
-    0xeb83b9,
-    0xeb83ba,
-    0xeb83bb,
-    0xeb83bc,
-    0xeb83bd,
-    0xeb83be,
-    0xeb83bf,
-    0xeb8480,
-    0xeb8481,
-    0xeb8482,
-    0xeb8483,
-    0xeb8484,
-    0xeb8485,
-    0xeb8486,
-    0xeb8487,
-    0xeb8488,
-    0xeb8489,
-    0xeb848a,
-    0xeb848b,
-    0xeb848c,
-    0xeb848d,
-    0xeb848e,
-    0xeb848f,
-    0xeb8490,
-    0xeb8491,
-    0xeb8492,
-    0xeb8493,
-    0xeb8494,
-    0xeb8495,
-    0xeb8496,
-    0xeb8497,
-    0xeb8498,
-    0xeb8499,
-    0xeb849a,
-    0xeb849b,
-    0xeb849c,
-    0xeb849d,
-    0xeb849e,
-    0xeb849f,
-    0xeb84a0,
-    0xeb84a1,
-    0xeb84a2,
-    0xeb84a3,
-    0xeb84a4,
-    0xeb84a5,
-    0xeb84a6,
-    0xeb84a7,
-    0xeb84a8,
-    0xeb84a9,
-    0xeb84aa,
-    0xeb84ab,
-    0xeb84ac,
-    0xeb84ad,
-    0xeb84ae,
-    0xeb84af,
-    0xeb84b0,
-    0xeb84b1,
-    0xeb84b2,
-    0xeb84b3,
-    0xeb84b4,
-    0xeb84b5,
-    0xeb84b6,
-    0xeb84b7,
-    0xeb84b8,
-    0xeb84b9,
-    0xeb84ba,
-    0xeb84bb,
-    0xeb84bc,
-    0xeb84bd,
-    0xeb84be,
-    0xeb84bf,
-    0xeb8580,
-    0xeb8581,
-    0xeb8582,
-    0xeb8583,
-    0xeb8584,
-    0xeb8585,
-    0xeb8586,
-    0xeb8587,
-    0xeb8588,
-    0xeb8589,
-    0xeb858a,
-    0xeb858b,
-    0xeb858c,
-    0xeb858d,
-    0xeb858e,
-    0xeb858f,
-    0xeb8590,
-    0xeb8591,
-    0xeb8592,
-    0xeb8593,
-    0xeb8594,
-    0xeb8595,
-    0xeb8596,
-    0xeb8597,
-    0xeb8598,
-    0xeb8599,
-    0xeb859a,
-    0xeb859b,
-    0xeb859c,
-    0xeb859d,
-    0xeb859e,
-    0xeb859f,
-    0xeb85a0,
-    0xeb85a1,
-    0xeb85a2,
-    0xeb85a3,
-    0xeb85a4,
-    0xeb85a5,
-    0xeb85a6,
-    0xeb85a7,
-    0xeb85a8,
-    0xeb85a9,
-    0xeb85aa,
-    0xeb85ab,
-    0xeb85ac,
-    0xeb85ad,
-    0xeb85ae,
-    0xeb85af,
-    0xeb85b0,
-    0xeb85b1,
-    0xeb85b2,
-    0xeb85b3,
-    0xeb85b4,
-    0xeb85b5,
-    0xeb85b6,
-    0xeb85b7,
-    0xeb85b8,
-    0xeb85b9,
-    0xeb85ba,
-    0xeb85bb,
-    0xeb85bc,
-    0xeb85bd,
-    0xeb85be,
-    0xeb85bf,
-    0xeb8680,
-    0xeb8681,
-    0xeb8682,
-    0xeb8683,
-    0xeb8684,
-    0xeb8685,
-    0xeb8686,
-    0xeb8687,
-    0xeb8688,
-    0xeb8689,
-    0xeb868a,
-    0xeb868b,
-    0xeb868c,
-    0xeb868d,
-    0xeb868e,
-    0xeb868f,
-    0xeb8690,
-    0xeb8691,
-    0xeb8692,
-    0xeb8693,
-    0xeb8694,
-    0xeb8695,
-    0xeb8696,
-    0xeb8697,
-    0xeb8698,
-    0xeb8699,
-    0xeb869a,
-    0xeb869b,
-    0xeb869c,
-    0xeb869d,
-    0xeb869e,
-    0xeb869f,
-    0xeb86a0,
-    0xeb86a1,
-    0xeb86a2,
-    0xeb86a3,
-    0xeb86a4,
-    0xeb86a5,
-    0xeb86a6,
-    0xeb86a7,
-    0xeb86a8,
-    0xeb86a9,
-    0xeb86aa,
-    0xeb86ab,
-    0xeb86ac,
-    0xeb86ad,
-    0xeb86ae,
-    0xeb86af,
-    0xeb86b0,
-    0xeb86b1,
-    0xeb86b2,
-    0xeb86b3,
-    0xeb86b4,
-    0xeb86b5,
-    0xeb86b6,
-    0xeb86b7,
-    0xeb86b8,
-    0xeb86b9,
-    0xeb86ba,
-    0xeb86bb,
-    0xeb86bc,
-    0xeb86bd,
-    0xeb86be,
-    0xeb86bf,
-    0xeb8780,
-    0xeb8781,
-    0xeb8782,
-    0xeb8783,
-    0xeb8784,
-    0xeb8785,
-    0xeb8786,
-    0xeb8787,
-    0xeb8788,
-    0xeb8789,
-    0xeb878a,
-    0xeb878b,
-    0xeb878c,
-    0xeb878d,
-    0xeb878e,
-    0xeb878f,
-    0xeb8790,
-    0xeb8791,
-    0xeb8792,
-    0xeb8793,
-    0xeb8794,
-    0xeb8795,
-    0xeb8796,
-    0xeb8797,
-    0xeb8798,
-    0xeb8799,
-    0xeb879a,
-    0xeb879b,
-    0xeb879c,
-    0xeb879d,
-    0xeb879e,
-    0xeb879f,
-    0xeb87a0,
-    0xeb87a1,
-    0xeb87a2,
-    0xeb87a3,
-    0xeb87a4,
-    0xeb87a5,
-    0xeb87a6,
-    0xeb87a7,
-    0xeb87a8,
-    0xeb87a9,
-    0xeb87aa,
-    0xeb87ab,
-    0xeb87ac,
-    0xeb87ad,
-    0xeb87ae,
-    0xeb87af,
-    0xeb87b0,
-    0xeb87b1,
-    0xeb87b2,
-    0xeb87b3,
-    0xeb87b4,
-    0xeb87b5,
-    0xeb87b6,
-    0xeb87b7,
-    0xeb87b8,
-    0xeb87b9,
-    0xeb87ba,
-    0xeb87bb,
-    0xeb87bc,
-    0xeb87bd,
-    0xeb87be,
-    0xeb87bf,
-    0xeb8880,
-    0xeb8881,
-    0xeb8882,
-    0xeb8883,
-    0xeb8884,
-    0xeb8885,
-    0xeb8886,
-    0xeb8887,
-    0xeb8888,
-    0xeb8889,
-    0xeb888a,
-    0xeb888b,
-    0xeb888c,
-    0xeb888d,
-    0xeb888e,
-    0xeb888f,
-    0xeb8890,
-    0xeb8891,
-    0xeb8892,
-    0xeb8893,
-    0xeb8894,
-    0xeb8895,
-    0xeb8896,
-    0xeb8897,
-    0xeb8898,
-    0xeb8899,
-    0xeb889a,
-    0xeb889b,
-    0xeb889c,
-    0xeb889d,
-    0xeb889e,
-    0xeb889f,
-    0xeb88a0,
-    0xeb88a1,
-    0xeb88a2,
-    0xeb88a3,
-    0xeb88a4,
-    0xeb88a5,
-    0xeb88a6,
-    0xeb88a7,
-    0xeb88a8,
-    0xeb88a9,
-    0xeb88aa,
-    0xeb88ab,
-    0xeb88ac,
-    0xeb88ad,
-    0xeb88ae,
-    0xeb88af,
-    0xeb88b0,
-    0xeb88b1,
-    0xeb88b2,
-    0xeb88b3,
-    0xeb88b4,
-    0xeb88b5,
-    0xeb88b6,
-    0xeb88b7,
-    0xeb88b8,
-    0xeb88b9,
-    0xeb88ba,
-    0xeb88bb,
-    0xeb88bc,
-    0xeb88bd,
-    0xeb88be,
-    0xeb88bf,
-    0xeb8980,
-    0xeb8981,
-    0xeb8982,
-    0xeb8983,
-    0xeb8984,
-    0xeb8985,
-    0xeb8986,
-    0xeb8987,
-    0xeb8988,
-    0xeb8989,
-    0xeb898a,
-    0xeb898b,
-    0xeb898c,
-    0xeb898d,
-    0xeb898e,
-    0xeb898f,
-    0xeb8990,
-    0xeb8991,
-    0xeb8992,
-    0xeb8993,
-    0xeb8994,
-    0xeb8995,
-    0xeb8996,
-    0xeb8997,
-    0xeb8998,
-    0xeb8999,
-    0xeb899a,
-    0xeb899b,
-    0xeb899c,
-    0xeb899d,
-    0xeb899e,
-    0xeb899f,
-    0xeb89a0,
-    0xeb89a1,
-    0xeb89a2,
-    0xeb89a3,
-    0xeb89a4,
-    0xeb89a5,
-    0xeb89a6,
-    0xeb89a7,
-    0xeb89a8,
-    0xeb89a9,
-    0xeb89aa,
-    0xeb89ab,
-    0xeb89ac,
-    0xeb89ad,
-    0xeb89ae,
-    0xeb89af,
-    0xeb89b0,
-    0xeb89b1,
-    0xeb89b2,
-    0xeb89b3,
-    0xeb89b4,
-    0xeb89b5,
-    0xeb89b6,
-    0xeb89b7,
-    0xeb89b8,
-    0xeb89b9,
-    0xeb89ba,
-    0xeb89bb,
-    0xeb89bc,
-    0xeb89bd,
-    0xeb89be,
-    0xeb89bf,
-    0xeb8a80,
-    0xeb8a81,
-    0xeb8a82,
-    0xeb8a83,
-    0xeb8a84,
-    0xeb8a85,
-    0xeb8a86,
-    0xeb8a87,
-    0xeb8a88,
-    0xeb8a89,
-    0xeb8a8a,
-    0xeb8a8b,
-    0xeb8a8c,
-    0xeb8a8d,
-    0xeb8a8e,
-    0xeb8a8f,
-    0xeb8a90,
-    0xeb8a91,
-    0xeb8a92,
-    0xeb8a93,
-    0xeb8a94,
-    0xeb8a95,
-    0xeb8a96,
-    0xeb8a97,
-    0xeb8a98,
-    0xeb8a99,
-    0xeb8a9a,
-    0xeb8a9b,
-    0xeb8a9c,
-    0xeb8a9d,
-    0xeb8a9e,
-    0xeb8a9f,
-    0xeb8aa0,
-    0xeb8aa1,
-    0xeb8aa2,
-    0xeb8aa3,
-    0xeb8aa4,
-    0xeb8aa5,
-    0xeb8aa6,
-    0xeb8aa7,
-    0xeb8aa8,
-    0xeb8aa9,
-    0xeb8aaa,
-    0xeb8aab,
-    0xeb8aac,
-    0xeb8aad,
-    0xeb8aae,
-    0xeb8aaf,
-    0xeb8ab0,
-    0xeb8ab1,
-    0xeb8ab2,
-    0xeb8ab3,
-    0xeb8ab4,
-    0xeb8ab5,
-    0xeb8ab6,
-    0xeb8ab7,
-    0xeb8ab8,
-    0xeb8ab9,
-    0xeb8aba,
-    0xeb8abb,
-    0xeb8abc,
-    0xeb8abd,
-    0xeb8abe,
-    0xeb8abf,
-    0xeb8b80,
-    0xeb8b81,
-    0xeb8b82,
-    0xeb8b83,
-    0xeb8b84,
-    0xeb8b85,
-    0xeb8b86,
-    0xeb8b87,
-    0xeb8b88,
-    0xeb8b89,
-    0xeb8b8a,
-    0xeb8b8b,
-    0xeb8b8c,
-    0xeb8b8d,
-    0xeb8b8e,
-    0xeb8b8f,
-    0xeb8b90,
-    0xeb8b91,
-    0xeb8b92,
-    0xeb8b93,
-    0xeb8b94,
-    0xeb8b95,
-    0xeb8b96,
-    0xeb8b97,
-    0xeb8b98,
-    0xeb8b99,
-    0xeb8b9a,
-    0xeb8b9b,
-    0xeb8b9c,
-    0xeb8b9d,
-    0xeb8b9e,
-    0xeb8b9f,
-    0xeb8ba0,
-    0xeb8ba1,
-    0xeb8ba2,
-    0xeb8ba3,
-    0xeb8ba4,
-    0xeb8ba5,
-    0xeb8ba6,
-    0xeb8ba7,
-    0xeb8ba8,
-    0xeb8ba9,
-    0xeb8baa,
-    0xeb8bab,
-    0xeb8bac,
-    0xeb8bad,
-    0xeb8bae,
-    0xeb8baf,
-    0xeb8bb0,
-    0xeb8bb1,
-    0xeb8bb2,
-    0xeb8bb3,
-    0xeb8bb4,
-    0xeb8bb5,
-    0xeb8bb6,
-    0xeb8bb7,
-    0xeb8bb8,
-    0xeb8bb9,
-    0xeb8bba,
-    0xeb8bbb,
-    0xeb8bbc,
-    0xeb8bbd,
-    0xeb8bbe,
-    0xeb8bbf,
-    0xeb8c80,
-    0xeb8c81,
-    0xeb8c82,
-    0xeb8c83,
-    0xeb8c84,
-    0xeb8c85,
-    0xeb8c86,
-    0xeb8c87,
-    0xeb8c88,
-    0xeb8c89,
-    0xeb8c8a,
-    0xeb8c8b,
-    0xeb8c8c,
-    0xeb8c8d,
-    0xeb8c8e,
-    0xeb8c8f,
-    0xeb8c90,
-    0xeb8c91,
-    0xeb8c92,
-    0xeb8c93,
-    0xeb8c94,
-    0xeb8c95,
-    0xeb8c96,
-    0xeb8c97,
-    0xeb8c98,
-    0xeb8c99,
-    0xeb8c9a,
-    0xeb8c9b,
-    0xeb8c9c,
-    0xeb8c9d,
-    0xeb8c9e,
-    0xeb8c9f,
-    0xeb8ca0,
-    0xeb8ca1,
-    0xeb8ca2,
-    0xeb8ca3,
-    0xeb8ca4,
-    0xeb8ca5,
-    0xeb8ca6,
-    0xeb8ca7,
-    0xeb8ca8,
-    0xeb8ca9,
-    0xeb8caa,
-    0xeb8cab,
-    0xeb8cac,
-    0xeb8cad,
-    0xeb8cae,
-    0xeb8caf,
-    0xeb8cb0,
-    0xeb8cb1,
-    0xeb8cb2,
-    0xeb8cb3,
-    0xeb8cb4,
-    0xeb8cb5,
-    0xeb8cb6,
-    0xeb8cb7,
-    0xeb8cb8,
-    0xeb8cb9,
-    0xeb8cba,
-    0xeb8cbb,
-    0xeb8cbc,
-    0xeb8cbd,
-    0xeb8cbe,
-    0xeb8cbf,
-    0xeb8d80,
-    0xeb8d81,
-    0xeb8d82,
-    0xeb8d83,
-    0xeb8d84,
-    0xeb8d85,
-    0xeb8d86,
-    0xeb8d87,
-    0xeb8d88,
-    0xeb8d89,
-    0xeb8d8a,
-    0xeb8d8b,
-    0xeb8d8c,
-    0xeb8d8d,
-    0xeb8d8e,
-    0xeb8d8f,
-    0xeb8d90,
-    0xeb8d91,
-    0xeb8d92,
-    0xeb8d93,
-    0xeb8d94,
-    0xeb8d95,
-    0xeb8d96,
-    0xeb8d97,
-    0xeb8d98,
-    0xeb8d99,
-    0xeb8d9a,
-    0xeb8d9b,
-    0xeb8d9c,
-    0xeb8d9d,
-    0xeb8d9e,
-    0xeb8d9f,
-    0xeb8da0,
-    0xeb8da1,
-    0xeb8da2,
-    0xeb8da3,
-    0xeb8da4,
-    0xeb8da5,
-    0xeb8da6,
-    0xeb8da7,
-    0xeb8da8,
-    0xeb8da9,
-    0xeb8daa,
-    0xeb8dab,
-    0xeb8dac,
-    0xeb8dad,
-    0xeb8dae,
-    0xeb8daf,
-    0xeb8db0,
-    0xeb8db1,
-    0xeb8db2,
-    0xeb8db3,
-    0xeb8db4,
-    0xeb8db5,
-    0xeb8db6,
-    0xeb8db7,
-    0xeb8db8,
-    0xeb8db9,
-    0xeb8dba,
-    0xeb8dbb,
-    0xeb8dbc,
-    0xeb8dbd,
-    0xeb8dbe,
-    0xeb8dbf,
-    0xeb8e80,
-    0xeb8e81,
-    0xeb8e82,
-    0xeb8e83,
-    0xeb8e84,
-    0xeb8e85,
-    0xeb8e86,
-    0xeb8e87,
-    0xeb8e88,
-    0xeb8e89,
-    0xeb8e8a,
-    0xeb8e8b,
-    0xeb8e8c,
-    0xeb8e8d,
-    0xeb8e8e,
-    0xeb8e8f,
-    0xeb8e90,
-    0xeb8e91,
-    0xeb8e92,
-    0xeb8e93,
-    0xeb8e94,
-    0xeb8e95,
-    0xeb8e96,
-    0xeb8e97,
-    0xeb8e98,
-    0xeb8e99,
-    0xeb8e9a,
-    0xeb8e9b,
-    0xeb8e9c,
-    0xeb8e9d,
-    0xeb8e9e,
-    0xeb8e9f,
-    0xeb8ea0,
-    0xeb8ea1,
-    0xeb8ea2,
-    0xeb8ea3,
-    0xeb8ea4,
-    0xeb8ea5,
-    0xeb8ea6,
-    0xeb8ea7,
-    0xeb8ea8,
-    0xeb8ea9,
-    0xeb8eaa,
-    0xeb8eab,
-    0xeb8eac,
-    0xeb8ead,
-    0xeb8eae,
-    0xeb8eaf,
-    0xeb8eb0,
-    0xeb8eb1,
-    0xeb8eb2,
-    0xeb8eb3,
-    0xeb8eb4,
-    0xeb8eb5,
-    0xeb8eb6,
-    0xeb8eb7,
-    0xeb8eb8,
-    0xeb8eb9,
-    0xeb8eba,
-    0xeb8ebb,
-    0xeb8ebc,
-    0xeb8ebd,
-    0xeb8ebe,
-    0xeb8ebf,
-    0xeb8f80,
-    0xeb8f81,
-    0xeb8f82,
-    0xeb8f83,
-    0xeb8f84,
-    0xeb8f85,
-    0xeb8f86,
-    0xeb8f87,
-    0xeb8f88,
-    0xeb8f89,
-    0xeb8f8a,
-    0xeb8f8b,
-    0xeb8f8c,
-    0xeb8f8d,
-    0xeb8f8e,
-    0xeb8f8f,
-    0xeb8f90,
-    0xeb8f91,
-    0xeb8f92,
-    0xeb8f93,
-    0xeb8f94,
-    0xeb8f95,
-    0xeb8f96,
-    0xeb8f97,
-    0xeb8f98,
-    0xeb8f99,
-    0xeb8f9a,
-    0xeb8f9b,
-    0xeb8f9c,
-    0xeb8f9d,
-    0xeb8f9e,
-    0xeb8f9f,
-    0xeb8fa0,
-    0xeb8fa1,
-    0xeb8fa2,
-    0xeb8fa3,
-    0xeb8fa4,
-    0xeb8fa5,
-    0xeb8fa6,
-    0xeb8fa7,
-    0xeb8fa8,
-    0xeb8fa9,
-    0xeb8faa,
-    0xeb8fab,
-    0xeb8fac,
-    0xeb8fad,
-    0xeb8fae,
-    0xeb8faf,
-    0xeb8fb0,
-    0xeb8fb1,
-    0xeb8fb2,
-    0xeb8fb3,
-    0xeb8fb4,
-    0xeb8fb5,
-    0xeb8fb6,
-    0xeb8fb7,
-    0xeb8fb8,
-    0xeb8fb9,
-    0xeb8fba,
-    0xeb8fbb,
-    0xeb8fbc,
-    0xeb8fbd,
-    0xeb8fbe,
-    0xeb8fbf,
-    0xeb9080,
-    0xeb9081,
-    0xeb9082,
-    0xeb9083,
-    0xeb9084,
-    0xeb9085,
-    0xeb9086,
-    0xeb9087,
-    0xeb9088,
-    0xeb9089,
-    0xeb908a,
-    0xeb908b,
-    0xeb908c,
-    0xeb908d,
-    0xeb908e,
-    0xeb908f,
-    0xeb9090,
-    0xeb9091,
-    0xeb9092,
-    0xeb9093,
-    0xeb9094,
-    0xeb9095,
-    0xeb9096,
-    0xeb9097,
-    0xeb9098,
-    0xeb9099,
-    0xeb909a,
-    0xeb909b,
-    0xeb909c,
-    0xeb909d,
-    0xeb909e,
-    0xeb909f,
-    0xeb90a0,
-    0xeb90a1,
-    0xeb90a2,
-    0xeb90a3,
-    0xeb90a4,
-    0xeb90a5,
-    0xeb90a6,
-    0xeb90a7,
-    0xeb90a8,
-    0xeb90a9,
-    0xeb90aa,
-    0xeb90ab,
-    0xeb90ac,
-    0xeb90ad,
-    0xeb90ae,
-    0xeb90af,
-    0xeb90b0,
-    0xeb90b1,
-    0xeb90b2,
-    0xeb90b3,
-    0xeb90b4,
-    0xeb90b5,
-    0xeb90b6,
-    0xeb90b7,
-    0xeb90b8,
-    0xeb90b9,
-    0xeb90ba,
-    0xeb90bb,
-    0xeb90bc,
-    0xeb90bd,
-    0xeb90be,
-    0xeb90bf,
-    0xeb9180,
-    0xeb9181,
-    0xeb9182,
-    0xeb9183,
-    0xeb9184,
-    0xeb9185,
-    0xeb9186,
-    0xeb9187,
-    0xeb9188,
-    0xeb9189,
-    0xeb918a,
-    0xeb918b,
-    0xeb918c,
-    0xeb918d,
-    0xeb918e,
-    0xeb918f,
-    0xeb9190,
-    0xeb9191,
-    0xeb9192,
-    0xeb9193,
-    0xeb9194,
-    0xeb9195,
-    0xeb9196,
-    0xeb9197,
-    0xeb9198,
-    0xeb9199,
-    0xeb919a,
-    0xeb919b,
-    0xeb919c,
-    0xeb919d,
-    0xeb919e,
-    0xeb919f,
-    0xeb91a0,
-    0xeb91a1,
-    0xeb91a2,
-    0xeb91a3,
-    0xeb91a4,
-    0xeb91a5,
-    0xeb91a6,
-    0xeb91a7,
-    0xeb91a8,
-    0xeb91a9,
-    0xeb91aa,
-    0xeb91ab,
-    0xeb91ac,
-    0xeb91ad,
-    0xeb91ae,
-    0xeb91af,
-    0xeb91b0,
-    0xeb91b1,
-    0xeb91b2,
-    0xeb91b3,
-    0xeb91b4,
-    0xeb91b5,
-    0xeb91b6,
-    0xeb91b7,
-    0xeb91b8,
-    0xeb91b9,
-    0xeb91ba,
-    0xeb91bb,
-    0xeb91bc,
-    0xeb91bd,
-    0xeb91be,
-    0xeb91bf,
-    0xeb9280,
-    0xeb9281,
-    0xeb9282,
-    0xeb9283,
-    0xeb9284,
-    0xeb9285,
-    0xeb9286,
-    0xeb9287,
-    0xeb9288,
-    0xeb9289,
-    0xeb928a,
-    0xeb928b,
-    0xeb928c,
-    0xeb928d,
-    0xeb928e,
-    0xeb928f,
-    0xeb9290,
-    0xeb9291,
-    0xeb9292,
-    0xeb9293,
-    0xeb9294,
-    0xeb9295,
-    0xeb9296,
-    0xeb9297,
-    0xeb9298,
-    0xeb9299,
-    0xeb929a,
-    0xeb929b,
-    0xeb929c,
-    0xeb929d,
-    0xeb929e,
-    0xeb929f,
-    0xeb92a0,
-    0xeb92a1,
-    0xeb92a2,
-    0xeb92a3,
-    0xeb92a4,
-    0xeb92a5,
-    0xeb92a6,
-    0xeb92a7,
-    0xeb92a8,
-    0xeb92a9,
-    0xeb92aa,
-    0xeb92ab,
-    0xeb92ac,
-    0xeb92ad,
-    0xeb92ae,
-    0xeb92af,
-    0xeb92b0,
-    0xeb92b1,
-    0xeb92b2,
-    0xeb92b3,
-    0xeb92b4,
-    0xeb92b5,
-    0xeb92b6,
-    0xeb92b7,
-    0xeb92b8,
-    0xeb92b9,
-    0xeb92ba,
-    0xeb92bb,
-    0xeb92bc,
-    0xeb92bd,
-    0xeb92be,
-    0xeb92bf,
-    0xeb9380,
-    0xeb9381,
-    0xeb9382,
-    0xeb9383,
-    0xeb9384,
-    0xeb9385,
-    0xeb9386,
-    0xeb9387,
-    0xeb9388,
-    0xeb9389,
-    0xeb938a,
-    0xeb938b,
-    0xeb938c,
-    0xeb938d,
-    0xeb938e,
-    0xeb938f,
-    0xeb9390,
-    0xeb9391,
-    0xeb9392,
-    0xeb9393,
-    0xeb9394,
-    0xeb9395,
-    0xeb9396,
-    0xeb9397,
-    0xeb9398,
-    0xeb9399,
-    0xeb939a,
-    0xeb939b,
-    0xeb939c,
-    0xeb939d,
-    0xeb939e,
-    0xeb939f,
-    0xeb93a0,
-    0xeb93a1,
-    0xeb93a2,
-    0xeb93a3,
-    0xeb93a4,
-    0xeb93a5,
-    0xeb93a6,
-    0xeb93a7,
-    0xeb93a8,
-    0xeb93a9,
-    0xeb93aa,
-    0xeb93ab,
-    0xeb93ac,
-    0xeb93ad,
-    0xeb93ae,
-    0xeb93af,
-    0xeb93b0,
-    0xeb93b1,
-    0xeb93b2,
-    0xeb93b3,
-    0xeb93b4,
-    0xeb93b5,
-    0xeb93b6,
-    0xeb93b7,
-    0xeb93b8,
-    0xeb93b9,
-    0xeb93ba,
-    0xeb93bb,
-    0xeb93bc,
-    0xeb93bd,
-    0xeb93be,
-    0xeb93bf,
-    0xeb9480,
-    0xeb9481,
-    0xeb9482,
-    0xeb9483,
-    0xeb9484,
-    0xeb9485,
-    0xeb9486,
-    0xeb9487,
-    0xeb9488,
-    0xeb9489,
-    0xeb948a,
-    0xeb948b,
-    0xeb948c,
-    0xeb948d,
-    0xeb948e,
-    0xeb948f,
-    0xeb9490,
-    0xeb9491,
-    0xeb9492,
-    0xeb9493,
-    0xeb9494,
-    0xeb9495,
-    0xeb9496,
-    0xeb9497,
-    0xeb9498,
-    0xeb9499,
-    0xeb949a,
-    0xeb949b,
-    0xeb949c,
-    0xeb949d,
-    0xeb949e,
-    0xeb949f,
-    0xeb94a0,
-    0xeb94a1,
-    0xeb94a2,
-    0xeb94a3,
-    0xeb94a4,
-    0xeb94a5,
-    0xeb94a6,
-    0xeb94a7,
-    0xeb94a8,
-    0xeb94a9,
-    0xeb94aa,
-    0xeb94ab,
-    0xeb94ac,
-    0xeb94ad,
-    0xeb94ae,
-    0xeb94af,
-    0xeb94b0,
-    0xeb94b1,
-    0xeb94b2,
-    0xeb94b3,
-    0xeb94b4,
-    0xeb94b5,
-    0xeb94b6,
-    0xeb94b7,
-    0xeb94b8,
-    0xeb94b9,
-    0xeb94ba,
-    0xeb94bb,
-    0xeb94bc,
-    0xeb94bd,
-    0xeb94be,
-    0xeb94bf,
-    0xeb9580,
-    0xeb9581,
-    0xeb9582,
-    0xeb9583,
-    0xeb9584,
-    0xeb9585,
-    0xeb9586,
-    0xeb9587,
-    0xeb9588,
-    0xeb9589,
-    0xeb958a,
-    0xeb958b,
-    0xeb958c,
-    0xeb958d,
-    0xeb958e,
-    0xeb958f,
-    0xeb9590,
-    0xeb9591,
-    0xeb9592,
-    0xeb9593,
-    0xeb9594,
-    0xeb9595,
-    0xeb9596,
-    0xeb9597,
-    0xeb9598,
-    0xeb9599,
-    0xeb959a,
-    0xeb959b,
-    0xeb959c,
-    0xeb959d,
-    0xeb959e,
-    0xeb959f,
-    0xeb95a0,
-    0xeb95a1,
-    0xeb95a2,
-    0xeb95a3,
-    0xeb95a4,
-    0xeb95a5,
-    0xeb95a6,
-    0xeb95a7,
-    0xeb95a8,
-    0xeb95a9,
-    0xeb95aa,
-    0xeb95ab,
-    0xeb95ac,
-    0xeb95ad,
-    0xeb95ae,
-    0xeb95af,
-    0xeb95b0,
-    0xeb95b1,
-    0xeb95b2,
-    0xeb95b3,
-    0xeb95b4,
-    0xeb95b5,
-    0xeb95b6,
-    0xeb95b7,
-    0xeb95b8,
-    0xeb95b9,
-    0xeb95ba,
-    0xeb95bb,
-    0xeb95bc,
-    0xeb95bd,
-    0xeb95be,
-    0xeb95bf,
-    0xeb9680,
-    0xeb9681,
-    0xeb9682,
-    0xeb9683,
-    0xeb9684,
-    0xeb9685,
-    0xeb9686,
-    0xeb9687,
-    0xeb9688,
-    0xeb9689,
-    0xeb968a,
-    0xeb968b,
-    0xeb968c,
-    0xeb968d,
-    0xeb968e,
-    0xeb968f,
-    0xeb9690,
-    0xeb9691,
-    0xeb9692,
-    0xeb9693,
-    0xeb9694,
-    0xeb9695,
-    0xeb9696,
-    0xeb9697,
-    0xeb9698,
-    0xeb9699,
-    0xeb969a,
-    0xeb969b,
-    0xeb969c,
-    0xeb969d,
-    0xeb969e,
-    0xeb969f,
-    0xeb96a0,
-    0xeb96a1,
-    0xeb96a2,
-    0xeb96a3,
-    0xeb96a4,
-    0xeb96a5,
-    0xeb96a6,
-    0xeb96a7,
-    0xeb96a8,
-    0xeb96a9,
-    0xeb96aa,
-    0xeb96ab,
-    0xeb96ac,
-    0xeb96ad,
-    0xeb96ae,
-    0xeb96af,
-    0xeb96b0,
-    0xeb96b1,
-    0xeb96b2,
-    0xeb96b3,
-    0xeb96b4,
-    0xeb96b5,
-    0xeb96b6,
-    0xeb96b7,
-    0xeb96b8,
-    0xeb96b9,
-    0xeb96ba,
-    0xeb96bb,
-    0xeb96bc,
-    0xeb96bd,
-    0xeb96be,
-    0xeb96bf,
-    0xeb9780,
-    0xeb9781,
-    0xeb9782,
-    0xeb9783,
-    0xeb9784,
-    0xeb9785,
-    0xeb9786,
-    0xeb9787,
-    0xeb9788,
-    0xeb9789,
-    0xeb978a,
-    0xeb978b,
-    0xeb978c,
-    0xeb978d,
-    0xeb978e,
-    0xeb978f,
-    0xeb9790,
-    0xeb9791,
-    0xeb9792,
-    0xeb9793,
-    0xeb9794,
-    0xeb9795,
-    0xeb9796,
-    0xeb9797,
-    0xeb9798,
-    0xeb9799,
-    0xeb979a,
-    0xeb979b,
-    0xeb979c,
-    0xeb979d,
-    0xeb979e,
-    0xeb979f,
-    0xeb97a0,
-    0xeb97a1,
-    0xeb97a2,
-    0xeb97a3,
-    0xeb97a4,
-    0xeb97a5,
-    0xeb97a6,
-    0xeb97a7,
-    0xeb97a8,
-    0xeb97a9,
-    0xeb97aa,
-    0xeb97ab,
-    0xeb97ac,
-    0xeb97ad,
-    0xeb97ae,
-    0xeb97af,
-    0xeb97b0,
-    0xeb97b1,
-    0xeb97b2,
-    0xeb97b3,
-    0xeb97b4,
-    0xeb97b5,
-    0xeb97b6,
-    0xeb97b7,
-    0xeb97b8,
-    0xeb97b9,
-    0xeb97ba,
-    0xeb97bb,
-    0xeb97bc,
-    0xeb97bd,
-    0xeb97be,
-    0xeb97bf,
-    0xeb9880,
-    0xeb9881,
-    0xeb9882,
-    0xeb9883,
-    0xeb9884,
-    0xeb9885,
-    0xeb9886,
-    0xeb9887,
-    0xeb9888,
-    0xeb9889,
-    0xeb988a,
-    0xeb988b,
-    0xeb988c,
-    0xeb988d,
-    0xeb988e,
-    0xeb988f,
-    0xeb9890,
-    0xeb9891,
-    0xeb9892,
-    0xeb9893,
-    0xeb9894,
-    0xeb9895,
-    0xeb9896,
-    0xeb9897,
-    0xeb9898,
-    0xeb9899,
-    0xeb989a,
-    0xeb989b,
-    0xeb989c,
-    0xeb989d,
-    0xeb989e,
-    0xeb989f,
-    0xeb98a0,
-    0xeb98a1,
-    0xeb98a2,
-    0xeb98a3,
-    0xeb98a4,
-    0xeb98a5,
-    0xeb98a6,
-    0xeb98a7,
-    0xeb98a8,
-    0xeb98a9,
-    0xeb98aa,
-    0xeb98ab,
-    0xeb98ac,
-    0xeb98ad,
-    0xeb98ae,
-    0xeb98af,
-    0xeb98b0,
-    0xeb98b1,
-    0xeb98b2,
-    0xeb98b3,
-    0xeb98b4,
-    0xeb98b5,
-    0xeb98b6,
-    0xeb98b7,
-    0xeb98b8,
-    0xeb98b9,
-    0xeb98ba,
-    0xeb98bb,
-    0xeb98bc,
-    0xeb98bd,
-    0xeb98be,
-    0xeb98bf,
-    0xeb9980,
-    0xeb9981,
-    0xeb9982,
-    0xeb9983,
-    0xeb9984,
-    0xeb9985,
-    0xeb9986,
-    0xeb9987,
-    0xeb9988,
-    0xeb9989,
-    0xeb998a,
-    0xeb998b,
-    0xeb998c,
-    0xeb998d,
-    0xeb998e,
-    0xeb998f,
-    0xeb9990,
-    0xeb9991,
-    0xeb9992,
-    0xeb9993,
-    0xeb9994,
-    0xeb9995,
-    0xeb9996,
-    0xeb9997,
-    0xeb9998,
-    0xeb9999,
-    0xeb999a,
-    0xeb999b,
-    0xeb999c,
-    0xeb999d,
-    0xeb999e,
-    0xeb999f,
-    0xeb99a0,
-    0xeb99a1,
-    0xeb99a2,
-    0xeb99a3,
-    0xeb99a4,
-    0xeb99a5,
-    0xeb99a6,
-    0xeb99a7,
-    0xeb99a8,
-    0xeb99a9,
-    0xeb99aa,
-    0xeb99ab,
-    0xeb99ac,
-    0xeb99ad,
-    0xeb99ae,
-    0xeb99af,
-    0xeb99b0,
-    0xeb99b1,
-    0xeb99b2,
-    0xeb99b3,
-    0xeb99b4,
-    0xeb99b5,
-    0xeb99b6,
-    0xeb99b7,
-    0xeb99b8,
-    0xeb99b9,
-    0xeb99ba,
-    0xeb99bb,
-    0xeb99bc,
-    0xeb99bd,
-    0xeb99be,
-    0xeb99bf,
-    0xeb9a80,
-    0xeb9a81,
-    0xeb9a82,
-    0xeb9a83,
-    0xeb9a84,
-    0xeb9a85,
-    0xeb9a86,
-    0xeb9a87,
-    0xeb9a88,
-    0xeb9a89,
-    0xeb9a8a,
-    0xeb9a8b,
-    0xeb9a8c,
-    0xeb9a8d,
-    0xeb9a8e,
-    0xeb9a8f,
-    0xeb9a90,
-    0xeb9a91,
-    0xeb9a92,
-    0xeb9a93,
-    0xeb9a94,
-    0xeb9a95,
-    0xeb9a96,
-    0xeb9a97,
-    0xeb9a98,
-    0xeb9a99,
-    0xeb9a9a,
-    0xeb9a9b,
-    0xeb9a9c,
-    0xeb9a9d,
-    0xeb9a9e,
-    0xeb9a9f,
-    0xeb9aa0,
-    0xeb9aa1,
-    0xeb9aa2,
-    0xeb9aa3,
-    0xeb9aa4,
-    0xeb9aa5,
-    0xeb9aa6,
-    0xeb9aa7,
-    0xeb9aa8,
-    0xeb9aa9,
-    0xeb9aaa,
-    0xeb9aab,
-    0xeb9aac,
-    0xeb9aad,
-    0xeb9aae,
-    0xeb9aaf,
-    0xeb9ab0,
-    0xeb9ab1,
-    0xeb9ab2,
-    0xeb9ab3,
-    0xeb9ab4,
-    0xeb9ab5,
-    0xeb9ab6,
-    0xeb9ab7,
-    0xeb9ab8,
-    0xeb9ab9,
-    0xeb9aba,
-    0xeb9abb,
-    0xeb9abc,
-    0xeb9abd,
-    0xeb9abe,
-    0xeb9abf,
-    0xeb9b80,
-    0xeb9b81,
-    0xeb9b82,
-    0xeb9b83,
-    0xeb9b84,
-    0xeb9b85,
-    0xeb9b86,
-    0xeb9b87,
-    0xeb9b88,
-    0xeb9b89,
-    0xeb9b8a,
-    0xeb9b8b,
-    0xeb9b8c,
-    0xeb9b8d,
-    0xeb9b8e,
-    0xeb9b8f,
-    0xeb9b90,
-    0xeb9b91,
-    0xeb9b92,
-    0xeb9b93,
-    0xeb9b94,
-    0xeb9b95,
-    0xeb9b96,
-    0xeb9b97,
-    0xeb9b98,
-    0xeb9b99,
-    0xeb9b9a,
-    0xeb9b9b,
-    0xeb9b9c,
-    0xeb9b9d,
-    0xeb9b9e,
-    0xeb9b9f,
-    0xeb9ba0,
-    0xeb9ba1,
-    0xeb9ba2,
-    0xeb9ba3,
-    0xeb9ba4,
-    0xeb9ba5,
-    0xeb9ba6,
-    0xeb9ba7,
-    0xeb9ba8,
-    0xeb9ba9,
-    0xeb9baa,
-    0xeb9bab,
-    0xeb9bac,
-    0xeb9bad,
-    0xeb9bae,
-    0xeb9baf,
-    0xeb9bb0,
-    0xeb9bb1,
-    0xeb9bb2,
-    0xeb9bb3,
-    0xeb9bb4,
-    0xeb9bb5,
-    0xeb9bb6,
-    0xeb9bb7,
-    0xeb9bb8,
-    0xeb9bb9,
-    0xeb9bba,
-    0xeb9bbb,
-    0xeb9bbc,
-    0xeb9bbd,
-    0xeb9bbe,
-    0xeb9bbf,
-    0xeb9c80,
-    0xeb9c81,
-    0xeb9c82,
-    0xeb9c83,
-    0xeb9c84,
-    0xeb9c85,
-    0xeb9c86,
-    0xeb9c87,
-    0xeb9c88,
-    0xeb9c89,
-    0xeb9c8a,
-    0xeb9c8b,
-    0xeb9c8c,
-    0xeb9c8d,
-    0xeb9c8e,
-    0xeb9c8f,
-    0xeb9c90,
-    0xeb9c91,
-    0xeb9c92,
-    0xeb9c93,
-    0xeb9c94,
-    0xeb9c95,
-    0xeb9c96,
-    0xeb9c97,
-    0xeb9c98,
-    0xeb9c99,
-    0xeb9c9a,
-    0xeb9c9b,
-    0xeb9c9c,
-    0xeb9c9d,
-    0xeb9c9e,
-    0xeb9c9f,
-    0xeb9ca0,
-    0xeb9ca1,
-    0xeb9ca2,
-    0xeb9ca3,
-    0xeb9ca4,
-    0xeb9ca5,
-    0xeb9ca6,
-    0xeb9ca7,
-    0xeb9ca8,
-    0xeb9ca9,
-    0xeb9caa,
-    0xeb9cab,
-    0xeb9cac,
-    0xeb9cad,
-    0xeb9cae,
-    0xeb9caf,
-    0xeb9cb0,
-    0xeb9cb1,
-    0xeb9cb2,
-    0xeb9cb3,
-    0xeb9cb4,
-    0xeb9cb5,
-    0xeb9cb6,
-    0xeb9cb7,
-    0xeb9cb8,
-    0xeb9cb9,
-    0xeb9cba,
-    0xeb9cbb,
-    0xeb9cbc,
-    0xeb9cbd,
-    0xeb9cbe,
-    0xeb9cbf,
-    0xeb9d80,
-    0xeb9d81,
-    0xeb9d82,
-    0xeb9d83,
-    0xeb9d84,
-    0xeb9d85,
-    0xeb9d86,
-    0xeb9d87,
-    0xeb9d88,
-    0xeb9d89,
-    0xeb9d8a,
-    0xeb9d8b,
-    0xeb9d8c,
-    0xeb9d8d,
-    0xeb9d8e,
-    0xeb9d8f,
-    0xeb9d90,
-    0xeb9d91,
-    0xeb9d92,
-    0xeb9d93,
-    0xeb9d94,
-    0xeb9d95,
-    0xeb9d96,
-    0xeb9d97,
-    0xeb9d98,
-    0xeb9d99,
-    0xeb9d9a,
-    0xeb9d9b,
-    0xeb9d9c,
-    0xeb9d9d,
-    0xeb9d9e,
-    0xeb9d9f,
-    0xeb9da0,
-    0xeb9da1,
-    0xeb9da2,
-    0xeb9da3,
-    0xeb9da4,
-    0xeb9da5,
-    0xeb9da6,
-    0xeb9da7,
-    0xeb9da8,
-    0xeb9da9,
-    0xeb9daa,
-    0xeb9dab,
-    0xeb9dac,
-    0xeb9dad,
-    0xeb9dae,
-    0xeb9daf,
-    0xeb9db0,
-    0xeb9db1,
-    0xeb9db2,
-    0xeb9db3,
-    0xeb9db4,
-    0xeb9db5,
-    0xeb9db6,
-    0xeb9db7,
-    0xeb9db8,
-    0xeb9db9,
-    0xeb9dba,
-    0xeb9dbb,
-    0xeb9dbc,
-    0xeb9dbd,
-    0xeb9dbe,
-    0xeb9dbf,
-    0xeb9e80,
-    0xeb9e81,
-    0xeb9e82,
-    0xeb9e83,
-    0xeb9e84,
-    0xeb9e85,
-    0xeb9e86,
-    0xeb9e87,
-    0xeb9e88,
-    0xeb9e89,
-    0xeb9e8a,
-    0xeb9e8b,
-    0xeb9e8c,
-    0xeb9e8d,
-    0xeb9e8e,
-    0xeb9e8f,
-    0xeb9e90,
-    0xeb9e91,
-    0xeb9e92,
-    0xeb9e93,
-    0xeb9e94,
-    0xeb9e95,
-    0xeb9e96,
-    0xeb9e97,
-    0xeb9e98,
-    0xeb9e99,
-    0xeb9e9a,
-    0xeb9e9b,
-    0xeb9e9c,
-    0xeb9e9d,
-    0xeb9e9e,
-    0xeb9e9f,
-    0xeb9ea0,
-    0xeb9ea1,
-    0xeb9ea2,
-    0xeb9ea3,
-    0xeb9ea4,
-    0xeb9ea5,
-    0xeb9ea6,
-    0xeb9ea7,
-    0xeb9ea8,
-    0xeb9ea9,
-    0xeb9eaa,
-    0xeb9eab,
-    0xeb9eac,
-    0xeb9ead,
-    0xeb9eae,
-    0xeb9eaf,
-    0xeb9eb0,
-    0xeb9eb1,
-    0xeb9eb2,
-    0xeb9eb3,
-    0xeb9eb4,
-    0xeb9eb5,
-    0xeb9eb6,
-    0xeb9eb7,
-    0xeb9eb8,
-    0xeb9eb9,
-    0xeb9eba,
-    0xeb9ebb,
-    0xeb9ebc,
-    0xeb9ebd,
-    0xeb9ebe,
-    0xeb9ebf,
-    0xeb9f80,
-    0xeb9f81,
-    0xeb9f82,
-    0xeb9f83,
-    0xeb9f84,
-    0xeb9f85,
-    0xeb9f86,
-    0xeb9f87,
-    0xeb9f88,
-    0xeb9f89,
-    0xeb9f8a,
-    0xeb9f8b,
-    0xeb9f8c,
-    0xeb9f8d,
-    0xeb9f8e,
-    0xeb9f8f,
-    0xeb9f90,
-    0xeb9f91,
-    0xeb9f92,
-    0xeb9f93,
-    0xeb9f94,
-    0xeb9f95,
-    0xeb9f96,
-    0xeb9f97,
-    0xeb9f98,
-    0xeb9f99,
-    0xeb9f9a,
-    0xeb9f9b,
-    0xeb9f9c,
-    0xeb9f9d,
-    0xeb9f9e,
-    0xeb9f9f,
-    0xeb9fa0,
-    0xeb9fa1,
-    0xeb9fa2,
-    0xeb9fa3,
-    0xeb9fa4,
-    0xeb9fa5,
-    0xeb9fa6,
-    0xeb9fa7,
-    0xeb9fa8,
-    0xeb9fa9,
-    0xeb9faa,
-    0xeb9fab,
-    0xeb9fac,
-    0xeb9fad,
-    0xeb9fae,
-    0xeb9faf,
-    0xeb9fb0,
-    0xeb9fb1,
-    0xeb9fb2,
-    0xeb9fb3,
-    0xeb9fb4,
-    0xeb9fb5,
-    0xeb9fb6,
-    0xeb9fb7,
-    0xeb9fb8,
-    0xeb9fb9,
-    0xeb9fba,
-    0xeb9fbb,
-    0xeb9fbc,
-    0xeb9fbd,
-    0xeb9fbe,
-    0xeb9fbf,
-    0xeba080,
-    0xeba081,
-    0xeba082,
-    0xeba083,
-    0xeba084,
-    0xeba085,
-    0xeba086,
-    0xeba087,
-    0xeba088,
-    0xeba089,
-    0xeba08a,
-    0xeba08b,
-    0xeba08c,
-    0xeba08d,
-    0xeba08e,
-    0xeba08f,
-    0xeba090,
-    0xeba091,
-    0xeba092,
-    0xeba093,
-    0xeba094,
-    0xeba095,
-    0xeba096,
-    0xeba097,
-    0xeba098,
-    0xeba099,
-    0xeba09a,
-    0xeba09b,
-    0xeba09c,
-    0xeba09d,
-    0xeba09e,
-    0xeba09f,
-    0xeba0a0,
-    0xeba0a1,
-    0xeba0a2,
-    0xeba0a3,
-    0xeba0a4,
-    0xeba0a5,
-    0xeba0a6,
-    0xeba0a7,
-    0xeba0a8,
-    0xeba0a9,
-    0xeba0aa,
-    0xeba0ab,
-    0xeba0ac,
-    0xeba0ad,
-    0xeba0ae,
-    0xeba0af,
-    0xeba0b0,
-    0xeba0b1,
-    0xeba0b2,
-    0xeba0b3,
-    0xeba0b4,
-    0xeba0b5,
-    0xeba0b6,
-    0xeba0b7,
-    0xeba0b8,
-    0xeba0b9,
-    0xeba0ba,
-    0xeba0bb,
-    0xeba0bc,
-    0xeba0bd,
-    0xeba0be,
-    0xeba0bf,
-    0xeba180,
-    0xeba181,
-    0xeba182,
-    0xeba183,
-    0xeba184,
-    0xeba185,
-    0xeba186,
-    0xeba187,
-    0xeba188,
-    0xeba189,
-    0xeba18a,
-    0xeba18b,
-    0xeba18c,
-    0xeba18d,
-    0xeba18e,
-    0xeba18f,
-    0xeba190,
-    0xeba191,
-    0xeba192,
-    0xeba193,
-    0xeba194,
-    0xeba195,
-    0xeba196,
-    0xeba197,
-    0xeba198,
-    0xeba199,
-    0xeba19a,
-    0xeba19b,
-    0xeba19c,
-    0xeba19d,
-    0xeba19e,
-    0xeba19f,
-    0xeba1a0,
-    0xeba1a1,
-    0xeba1a2,
-    0xeba1a3,
-    0xeba1a4,
-    0xeba1a5,
-    0xeba1a6,
-    0xeba1a7,
-    0xeba1a8,
-    0xeba1a9,
-    0xeba1aa,
-    0xeba1ab,
-    0xeba1ac,
-    0xeba1ad,
-    0xeba1ae,
-    0xeba1af,
-    0xeba1b0,
-    0xeba1b1,
-    0xeba1b2,
-    0xeba1b3,
-    0xeba1b4,
-    0xeba1b5,
-    0xeba1b6,
-    0xeba1b7,
-    0xeba1b8,
-    0xeba1b9,
-    0xeba1ba,
-    0xeba1bb,
-    0xeba1bc,
-    0xeba1bd,
-    0xeba1be,
-    0xeba1bf,
-    0xeba280,
-    0xeba281,
-    0xeba282,
-    0xeba283,
-    0xeba284,
-    0xeba285,
-    0xeba286,
-    0xeba287,
-    0xeba288,
-    0xeba289,
-    0xeba28a,
-    0xeba28b,
-    0xeba28c,
-    0xeba28d,
-    0xeba28e,
-    0xeba28f,
-    0xeba290,
-    0xeba291,
-    0xeba292,
-    0xeba293,
-    0xeba294,
-    0xeba295,
-    0xeba296,
-    0xeba297,
-    0xeba298,
-    0xeba299,
-    0xeba29a,
-    0xeba29b,
-    0xeba29c,
-    0xeba29d,
-    0xeba29e,
-    0xeba29f,
-    0xeba2a0,
-    0xeba2a1,
-    0xeba2a2,
-    0xeba2a3,
-    0xeba2a4,
-    0xeba2a5,
-    0xeba2a6,
-    0xeba2a7,
-    0xeba2a8,
-    0xeba2a9,
-    0xeba2aa,
-    0xeba2ab,
-    0xeba2ac,
-    0xeba2ad,
-    0xeba2ae,
-    0xeba2af,
-    0xeba2b0,
-    0xeba2b1,
-    0xeba2b2,
-    0xeba2b3,
-    0xeba2b4,
-    0xeba2b5,
-    0xeba2b6,
-    0xeba2b7,
-    0xeba2b8,
-    0xeba2b9,
-    0xeba2ba,
-    0xeba2bb,
-    0xeba2bc,
-    0xeba2bd,
-    0xeba2be,
-    0xeba2bf,
-    0xeba380,
-    0xeba381,
-    0xeba382,
-    0xeba383,
-    0xeba384,
-    0xeba385,
-    0xeba386,
-    0xeba387,
-    0xeba388,
-    0xeba389,
-    0xeba38a,
-    0xeba38b,
-    0xeba38c,
-    0xeba38d,
-    0xeba38e,
-    0xeba38f,
-    0xeba390,
-    0xeba391,
-    0xeba392,
-    0xeba393,
-    0xeba394,
-    0xeba395,
-    0xeba396,
-    0xeba397,
-    0xeba398,
-    0xeba399,
-    0xeba39a,
-    0xeba39b,
-    0xeba39c,
-    0xeba39d,
-    0xeba39e,
-    0xeba39f,
-    0xeba3a0,
-    0xeba3a1,
-    0xeba3a2,
-    0xeba3a3,
-    0xeba3a4,
-    0xeba3a5,
-    0xeba3a6,
-    0xeba3a7,
-    0xeba3a8,
-    0xeba3a9,
-    0xeba3aa,
-    0xeba3ab,
-    0xeba3ac,
-    0xeba3ad,
-    0xeba3ae,
-    0xeba3af,
-    0xeba3b0,
-    0xeba3b1,
-    0xeba3b2,
-    0xeba3b3,
-    0xeba3b4,
-    0xeba3b5,
-    0xeba3b6,
-    0xeba3b7,
-    0xeba3b8,
-    0xeba3b9,
-    0xeba3ba,
-    0xeba3bb,
-    0xeba3bc,
-    0xeba3bd,
-    0xeba3be,
-    0xeba3bf,
-    0xeba480,
-    0xeba481,
-    0xeba482,
-    0xeba483,
-    0xeba484,
-    0xeba485,
-    0xeba486,
-    0xeba487,
-    0xeba488,
-    0xeba489,
-    0xeba48a,
-    0xeba48b,
-    0xeba48c,
-    0xeba48d,
-    0xeba48e,
-    0xeba48f,
-    0xeba490,
-    0xeba491,
-    0xeba492,
-    0xeba493,
-    0xeba494,
-    0xeba495,
-    0xeba496,
-    0xeba497,
-    0xeba498,
-    0xeba499,
-    0xeba49a,
-    0xeba49b,
-    0xeba49c,
-    0xeba49d,
-    0xeba49e,
-    0xeba49f,
-    0xeba4a0,
-    0xeba4a1,
-    0xeba4a2,
-    0xeba4a3,
-    0xeba4a4,
-    0xeba4a5,
-    0xeba4a6,
-    0xeba4a7,
-    0xeba4a8,
-    0xeba4a9,
-    0xeba4aa,
-    0xeba4ab,
-    0xeba4ac,
-    0xeba4ad,
-    0xeba4ae,
-    0xeba4af,
-    0xeba4b0,
-    0xeba4b1,
-    0xeba4b2,
-    0xeba4b3,
-    0xeba4b4,
-    0xeba4b5,
-    0xeba4b6,
-    0xeba4b7,
-    0xeba4b8,
-    0xeba4b9,
-    0xeba4ba,
-    0xeba4bb,
-    0xeba4bc,
-    0xeba4bd,
-    0xeba4be,
-    0xeba4bf,
-    0xeba580,
-    0xeba581,
-    0xeba582,
-    0xeba583,
-    0xeba584,
-    0xeba585,
-    0xeba586,
-    0xeba587,
-    0xeba588,
-    0xeba589,
-    0xeba58a,
-    0xeba58b,
-    0xeba58c,
-    0xeba58d,
-    0xeba58e,
-    0xeba58f,
-    0xeba590,
-    0xeba591,
-    0xeba592,
-    0xeba593,
-    0xeba594,
-    0xeba595,
-    0xeba596,
-    0xeba597,
-    0xeba598,
-    0xeba599,
-    0xeba59a,
-    0xeba59b,
-    0xeba59c,
-    0xeba59d,
-    0xeba59e,
-    0xeba59f,
-    0xeba5a0,
-    0xeba5a1,
-    0xeba5a2,
-    0xeba5a3,
-    0xeba5a4,
-    0xeba5a5,
-    0xeba5a6,
-    0xeba5a7,
-    0xeba5a8,
-    0xeba5a9,
-    0xeba5aa,
-    0xeba5ab,
-    0xeba5ac,
-    0xeba5ad,
-    0xeba5ae,
-    0xeba5af,
-    0xeba5b0,
-    0xeba5b1,
-    0xeba5b2,
-    0xeba5b3,
-    0xeba5b4,
-    0xeba5b5,
-    0xeba5b6,
-    0xeba5b7,
-    0xeba5b8,
-    0xeba5b9,
-    0xeba5ba,
-    0xeba5bb,
-    0xeba5bc,
-    0xeba5bd,
-    0xeba5be,
-    0xeba5bf,
-    0xeba680,
-    0xeba681,
-    0xeba682,
-    0xeba683,
-    0xeba684,
-    0xeba685,
-    0xeba686,
-    0xeba687,
-    0xeba688,
-    0xeba689,
-    0xeba68a,
-    0xeba68b,
-    0xeba68c,
-    0xeba68d,
-    0xeba68e,
-    0xeba68f,
-    0xeba690,
-    0xeba691,
-    0xeba692,
-    0xeba693,
-    0xeba694,
-    0xeba695,
-    0xeba696,
-    0xeba697,
-    0xeba698,
-    0xeba699,
-    0xeba69a,
-    0xeba69b,
-    0xeba69c,
-    0xeba69d,
-    0xeba69e,
-    0xeba69f,
-    0xeba6a0,
-    0xeba6a1,
-    0xeba6a2,
-    0xeba6a3,
-    0xeba6a4,
-    0xeba6a5,
-    0xeba6a6,
-    0xeba6a7,
-    0xeba6a8,
-    0xeba6a9,
-    0xeba6aa,
-    0xeba6ab,
-    0xeba6ac,
-    0xeba6ad,
-    0xeba6ae,
-    0xeba6af,
-    0xeba6b0,
-    0xeba6b1,
-    0xeba6b2,
-    0xeba6b3,
-    0xeba6b4,
-    0xeba6b5,
-    0xeba6b6,
-    0xeba6b7,
-    0xeba6b8,
-    0xeba6b9,
-    0xeba6ba,
-    0xeba6bb,
-    0xeba6bc,
-    0xeba6bd,
-    0xeba6be,
-    0xeba6bf,
-    0xeba780,
-    0xeba781,
-    0xeba782,
-    0xeba783,
-    0xeba784,
-    0xeba785,
-    0xeba786,
-    0xeba787,
-    0xeba788,
-    0xeba789,
-    0xeba78a,
-    0xeba78b,
-    0xeba78c,
-    0xeba78d,
-    0xeba78e,
-    0xeba78f,
-    0xeba790,
-    0xeba791,
-    0xeba792,
-    0xeba793,
-    0xeba794,
-    0xeba795,
-    0xeba796,
-    0xeba797,
-    0xeba798,
-    0xeba799,
-    0xeba79a,
-    0xeba79b,
-    0xeba79c,
-    0xeba79d,
-    0xeba79e,
-    0xeba79f,
-    0xeba7a0,
-    0xeba7a1,
-    0xeba7a2,
-    0xeba7a3,
-    0xeba7a4,
-    0xeba7a5,
-    0xeba7a6,
-    0xeba7a7,
-    0xeba7a8,
-    0xeba7a9,
-    0xeba7aa,
-    0xeba7ab,
-    0xeba7ac,
-    0xeba7ad,
-    0xeba7ae,
-    0xeba7af,
-    0xeba7b0,
-    0xeba7b1,
-    0xeba7b2,
-    0xeba7b3,
-    0xeba7b4,
-    0xeba7b5,
-    0xeba7b6,
-    0xeba7b7,
-    0xeba7b8,
-    0xeba7b9,
-    0xeba7ba,
-    0xeba7bb,
-    0xeba7bc,
-    0xeba7bd,
-    0xeba7be,
-    0xeba7bf,
-    0xeba880,
-    0xeba881,
-    0xeba882,
-    0xeba883,
-    0xeba884,
-    0xeba885,
-    0xeba886,
-    0xeba887,
-    0xeba888,
-    0xeba889,
-    0xeba88a,
-    0xeba88b,
-    0xeba88c,
-    0xeba88d,
-    0xeba88e,
-    0xeba88f,
-    0xeba890,
-    0xeba891,
-    0xeba892,
-    0xeba893,
-    0xeba894,
-    0xeba895,
-    0xeba896,
-    0xeba897,
-    0xeba898,
-    0xeba899,
-    0xeba89a,
-    0xeba89b,
-    0xeba89c,
-    0xeba89d,
-    0xeba89e,
-    0xeba89f,
-    0xeba8a0,
-    0xeba8a1,
-    0xeba8a2,
-    0xeba8a3,
-    0xeba8a4,
-    0xeba8a5,
-    0xeba8a6,
-    0xeba8a7,
-    0xeba8a8,
-    0xeba8a9,
-    0xeba8aa,
-    0xeba8ab,
-    0xeba8ac,
-    0xeba8ad,
-    0xeba8ae,
-    0xeba8af,
-    0xeba8b0,
-    0xeba8b1,
-    0xeba8b2,
-    0xeba8b3,
-    0xeba8b4,
-    0xeba8b5,
-    0xeba8b6,
-    0xeba8b7,
-    0xeba8b8,
-    0xeba8b9,
-    0xeba8ba,
-    0xeba8bb,
-    0xeba8bc,
-    0xeba8bd,
-    0xeba8be,
-    0xeba8bf,
-    0xeba980,
-    0xeba981,
-    0xeba982,
-    0xeba983,
-    0xeba984,
-    0xeba985,
-    0xeba986,
-    0xeba987,
-    0xeba988,
-    0xeba989,
-    0xeba98a,
-    0xeba98b,
-    0xeba98c,
-    0xeba98d,
-    0xeba98e,
-    0xeba98f,
-    0xeba990,
-    0xeba991,
-    0xeba992,
-    0xeba993,
-    0xeba994,
-    0xeba995,
-    0xeba996,
-    0xeba997,
-    0xeba998,
-    0xeba999,
-    0xeba99a,
-    0xeba99b,
-    0xeba99c,
-    0xeba99d,
-    0xeba99e,
-    0xeba99f,
-    0xeba9a0,
-    0xeba9a1,
-    0xeba9a2,
-    0xeba9a3,
-    0xeba9a4,
-    0xeba9a5,
-    0xeba9a6,
-    0xeba9a7,
-    0xeba9a8,
-    0xeba9a9,
-    0xeba9aa,
-    0xeba9ab,
-    0xeba9ac,
-    0xeba9ad,
-    0xeba9ae,
-    0xeba9af,
-    0xeba9b0,
-    0xeba9b1,
-    0xeba9b2,
-    0xeba9b3,
-    0xeba9b4,
-    0xeba9b5,
-    0xeba9b6,
-    0xeba9b7,
-    0xeba9b8,
-    0xeba9b9,
-    0xeba9ba,
-    0xeba9bb,
-    0xeba9bc,
-    0xeba9bd,
-    0xeba9be,
-    0xeba9bf,
-    0xebaa80,
-    0xebaa81,
-    0xebaa82,
-    0xebaa83,
-    0xebaa84,
-    0xebaa85,
-    0xebaa86,
-    0xebaa87,
-    0xebaa88,
-    0xebaa89,
-    0xebaa8a,
-    0xebaa8b,
-    0xebaa8c,
-    0xebaa8d,
-    0xebaa8e,
-    0xebaa8f,
-    0xebaa90,
-    0xebaa91,
-    0xebaa92,
-    0xebaa93,
-    0xebaa94,
-    0xebaa95,
-    0xebaa96,
-    0xebaa97,
-    0xebaa98,
-    0xebaa99,
-    0xebaa9a,
-    0xebaa9b,
-    0xebaa9c,
-    0xebaa9d,
-    0xebaa9e,
-    0xebaa9f,
-    0xebaaa0,
-    0xebaaa1,
-    0xebaaa2,
-    0xebaaa3,
-    0xebaaa4,
-    0xebaaa5,
-    0xebaaa6,
-    0xebaaa7,
-    0xebaaa8,
-    0xebaaa9,
-    0xebaaaa,
-    0xebaaab,
-    0xebaaac,
-    0xebaaad,
-    0xebaaae,
-    0xebaaaf,
-    0xebaab0,
-    0xebaab1,
-    0xebaab2,
-    0xebaab3,
-    0xebaab4,
-    0xebaab5,
-    0xebaab6,
-    0xebaab7,
-    0xebaab8,
-    0xebaab9,
-    0xebaaba,
-    0xebaabb,
-    0xebaabc,
-    0xebaabd,
-    0xebaabe,
-    0xebaabf,
-    0xebab80,
-    0xebab81,
-    0xebab82,
-    0xebab83,
-    0xebab84,
-    0xebab85,
-    0xebab86,
-    0xebab87,
-    0xebab88,
-    0xebab89,
-    0xebab8a,
-    0xebab8b,
-    0xebab8c,
-    0xebab8d,
-    0xebab8e,
-    0xebab8f,
-    0xebab90,
-    0xebab91,
-    0xebab92,
-    0xebab93,
-    0xebab94,
-    0xebab95,
-    0xebab96,
-    0xebab97,
-    0xebab98,
-    0xebab99,
-    0xebab9a,
-    0xebab9b,
-    0xebab9c,
-    0xebab9d,
-    0xebab9e,
-    0xebab9f,
-    0xebaba0,
-    0xebaba1,
-    0xebaba2,
-    0xebaba3,
-    0xebaba4,
-    0xebaba5,
-    0xebaba6,
-    0xebaba7,
-    0xebaba8,
-    0xebaba9,
-    0xebabaa,
-    0xebabab,
-    0xebabac,
-    0xebabad,
-    0xebabae,
-    0xebabaf,
-    0xebabb0,
-    0xebabb1,
-    0xebabb2,
-    0xebabb3,
-    0xebabb4,
-    0xebabb5,
-    0xebabb6,
-    0xebabb7,
-    0xebabb8,
-    0xebabb9,
-    0xebabba,
-    0xebabbb,
-    0xebabbc,
-    0xebabbd,
-    0xebabbe,
-    0xebabbf,
-    0xebac80,
-    0xebac81,
-    0xebac82,
-    0xebac83,
-    0xebac84,
-    0xebac85,
-    0xebac86,
-    0xebac87,
-    0xebac88,
-    0xebac89,
-    0xebac8a,
-    0xebac8b,
-    0xebac8c,
-    0xebac8d,
-    0xebac8e,
-    0xebac8f,
-    0xebac90,
-    0xebac91,
-    0xebac92,
-    0xebac93,
-    0xebac94,
-    0xebac95,
-    0xebac96,
-    0xebac97,
-    0xebac98,
-    0xebac99,
-    0xebac9a,
-    0xebac9b,
-    0xebac9c,
-    0xebac9d,
-    0xebac9e,
-    0xebac9f,
-    0xebaca0,
-    0xebaca1,
-    0xebaca2,
-    0xebaca3,
-    0xebaca4,
-    0xebaca5,
-    0xebaca6,
-    0xebaca7,
-    0xebaca8,
-    0xebaca9,
-    0xebacaa,
-    0xebacab,
-    0xebacac,
-    0xebacad,
-    0xebacae,
-    0xebacaf,
-    0xebacb0,
-    0xebacb1,
-    0xebacb2,
-    0xebacb3,
-    0xebacb4,
-    0xebacb5,
-    0xebacb6,
-    0xebacb7,
-    0xebacb8,
-    0xebacb9,
-    0xebacba,
-    0xebacbb,
-    0xebacbc,
-    0xebacbd,
-    0xebacbe,
-    0xebacbf,
-    0xebad80,
-    0xebad81,
-    0xebad82,
-    0xebad83,
-    0xebad84,
-    0xebad85,
-    0xebad86,
-    0xebad87,
-    0xebad88,
-    0xebad89,
-    0xebad8a,
-    0xebad8b,
-    0xebad8c,
-    0xebad8d,
-    0xebad8e,
-    0xebad8f,
-    0xebad90,
-    0xebad91,
-    0xebad92,
-    0xebad93,
-    0xebad94,
-    0xebad95,
-    0xebad96,
-    0xebad97,
-    0xebad98,
-    0xebad99,
-    0xebad9a,
-    0xebad9b,
-    0xebad9c,
-    0xebad9d,
-    0xebad9e,
-    0xebad9f,
-    0xebada0,
-    0xebada1,
-    0xebada2,
-    0xebada3,
-    0xebada4,
-    0xebada5,
-    0xebada6,
-    0xebada7,
-    0xebada8,
-    0xebada9,
-    0xebadaa,
-    0xebadab,
-    0xebadac,
-    0xebadad,
-    0xebadae,
-    0xebadaf,
-    0xebadb0,
-    0xebadb1,
-    0xebadb2,
-    0xebadb3,
-    0xebadb4,
-    0xebadb5,
-    0xebadb6,
-    0xebadb7,
-    0xebadb8,
-    0xebadb9,
-    0xebadba,
-    0xebadbb,
-    0xebadbc,
-    0xebadbd,
-    0xebadbe,
-    0xebadbf,
-    0xebae80,
-    0xebae81,
-    0xebae82,
-    0xebae83,
-    0xebae84,
-    0xebae85,
-    0xebae86,
-    0xebae87,
-    0xebae88,
-    0xebae89,
-    0xebae8a,
-    0xebae8b,
-    0xebae8c,
-    0xebae8d,
-    0xebae8e,
-    0xebae8f,
-    0xebae90,
-    0xebae91,
-    0xebae92,
-    0xebae93,
-    0xebae94,
-    0xebae95,
-    0xebae96,
-    0xebae97,
-    0xebae98,
-    0xebae99,
-    0xebae9a,
-    0xebae9b,
-    0xebae9c,
-    0xebae9d,
-    0xebae9e,
-    0xebae9f,
-    0xebaea0,
-    0xebaea1,
-    0xebaea2,
-    0xebaea3,
-    0xebaea4,
-    0xebaea5,
-    0xebaea6,
-    0xebaea7,
-    0xebaea8,
-    0xebaea9,
-    0xebaeaa,
-    0xebaeab,
-    0xebaeac,
-    0xebaead,
-    0xebaeae,
-    0xebaeaf,
-    0xebaeb0,
-    0xebaeb1,
-    0xebaeb2,
-    0xebaeb3,
-    0xebaeb4,
-    0xebaeb5,
-    0xebaeb6,
-    0xebaeb7,
-    0xebaeb8,
-    0xebaeb9,
-    0xebaeba,
-    0xebaebb,
-    0xebaebc,
-    0xebaebd,
-    0xebaebe,
-    0xebaebf,
-    0xebaf80,
-    0xebaf81,
-    0xebaf82,
-    0xebaf83,
-    0xebaf84,
-    0xebaf85,
-    0xebaf86,
-    0xebaf87,
-    0xebaf88,
-    0xebaf89,
-    0xebaf8a,
-    0xebaf8b,
-    0xebaf8c,
-    0xebaf8d,
-    0xebaf8e,
-    0xebaf8f,
-    0xebaf90,
-    0xebaf91,
-    0xebaf92,
-    0xebaf93,
-    0xebaf94,
-    0xebaf95,
-    0xebaf96,
-    0xebaf97,
-    0xebaf98,
-    0xebaf99,
-    0xebaf9a,
-    0xebaf9b,
-    0xebaf9c,
-    0xebaf9d,
-    0xebaf9e,
-    0xebaf9f,
-    0xebafa0,
-    0xebafa1,
-    0xebafa2,
-    0xebafa3,
-    0xebafa4,
-    0xebafa5,
-    0xebafa6,
-    0xebafa7,
-    0xebafa8,
-    0xebafa9,
-    0xebafaa,
-    0xebafab,
-    0xebafac,
-    0xebafad,
-    0xebafae,
-    0xebafaf,
-    0xebafb0,
-    0xebafb1,
-    0xebafb2,
-    0xebafb3,
-    0xebafb4,
-    0xebafb5,
-    0xebafb6,
-    0xebafb7,
-    0xebafb8,
-    0xebafb9,
-    0xebafba,
-    0xebafbb,
-    0xebafbc,
-    0xebafbd,
-    0xebafbe,
-    0xebafbf,
-    0xebb080,
-    0xebb081,
-    0xebb082,
-    0xebb083,
-    0xebb084,
-    0xebb085,
-    0xebb086,
-    0xebb087,
-    0xebb088,
-    0xebb089,
-    0xebb08a,
-    0xebb08b,
-    0xebb08c,
-    0xebb08d,
-    0xebb08e,
-    0xebb08f,
-    0xebb090,
-    0xebb091,
-    0xebb092,
-    0xebb093,
-    0xebb094,
-    0xebb095,
-    0xebb096,
-    0xebb097,
-    0xebb098,
-    0xebb099,
-    0xebb09a,
-    0xebb09b,
-    0xebb09c,
-    0xebb09d,
-    0xebb09e,
-    0xebb09f,
-    0xebb0a0,
-    0xebb0a1,
-    0xebb0a2,
-    0xebb0a3,
-    0xebb0a4,
-    0xebb0a5,
-    0xebb0a6,
-    0xebb0a7,
-    0xebb0a8,
-    0xebb0a9,
-    0xebb0aa,
-    0xebb0ab,
-    0xebb0ac,
-    0xebb0ad,
-    0xebb0ae,
-    0xebb0af,
-    0xebb0b0,
-    0xebb0b1,
-    0xebb0b2,
-    0xebb0b3,
-    0xebb0b4,
-    0xebb0b5,
-    0xebb0b6,
-    0xebb0b7,
-    0xebb0b8,
-    0xebb0b9,
-    0xebb0ba,
-    0xebb0bb,
-    0xebb0bc,
-    0xebb0bd,
-    0xebb0be,
-    0xebb0bf,
-    0xebb180,
-    0xebb181,
-    0xebb182,
-    0xebb183,
-    0xebb184,
-    0xebb185,
-    0xebb186,
-    0xebb187,
-    0xebb188,
-    0xebb189,
-    0xebb18a,
-    0xebb18b,
-    0xebb18c,
-    0xebb18d,
-    0xebb18e,
-    0xebb18f,
-    0xebb190,
-    0xebb191,
-    0xebb192,
-    0xebb193,
-    0xebb194,
-    0xebb195,
-    0xebb196,
-    0xebb197,
-    0xebb198,
-    0xebb199,
-    0xebb19a,
-    0xebb19b,
-    0xebb19c,
-    0xebb19d,
-    0xebb19e,
-    0xebb19f,
-    0xebb1a0,
-    0xebb1a1,
-    0xebb1a2,
-    0xebb1a3,
-    0xebb1a4,
-    0xebb1a5,
-    0xebb1a6,
-    0xebb1a7,
-    0xebb1a8,
-    0xebb1a9,
-    0xebb1aa,
-    0xebb1ab,
-    0xebb1ac,
-    0xebb1ad,
-    0xebb1ae,
-    0xebb1af,
-    0xebb1b0,
-    0xebb1b1,
-    0xebb1b2,
-    0xebb1b3,
-    0xebb1b4,
-    0xebb1b5,
-    0xebb1b6,
-    0xebb1b7,
-    0xebb1b8,
-    0xebb1b9,
-    0xebb1ba,
-    0xebb1bb,
-    0xebb1bc,
-    0xebb1bd,
-    0xebb1be,
-    0xebb1bf,
-    0xebb280,
-    0xebb281,
-    0xebb282,
-    0xebb283,
-    0xebb284,
-    0xebb285,
-    0xebb286,
-    0xebb287,
-    0xebb288,
-    0xebb289,
-    0xebb28a,
-    0xebb28b,
-    0xebb28c,
-    0xebb28d,
-    0xebb28e,
-    0xebb28f,
-    0xebb290,
-    0xebb291,
-    0xebb292,
-    0xebb293,
-    0xebb294,
-    0xebb295,
-    0xebb296,
-    0xebb297,
-    0xebb298,
-    0xebb299,
-    0xebb29a,
-    0xebb29b,
-    0xebb29c,
-    0xebb29d,
-    0xebb29e,
-    0xebb29f,
-    0xebb2a0,
-    0xebb2a1,
-    0xebb2a2,
-    0xebb2a3,
-    0xebb2a4,
-    0xebb2a5,
-    0xebb2a6,
-    0xebb2a7,
-    0xebb2a8,
-    0xebb2a9,
-    0xebb2aa,
-    0xebb2ab,
-    0xebb2ac,
-    0xebb2ad,
-    0xebb2ae,
-    0xebb2af,
-    0xebb2b0,
-    0xebb2b1,
-    0xebb2b2,
-    0xebb2b3,
-    0xebb2b4,
-    0xebb2b5,
-    0xebb2b6,
-    0xebb2b7,
-    0xebb2b8,
-    0xebb2b9,
-    0xebb2ba,
-    0xebb2bb,
-    0xebb2bc,
-    0xebb2bd,
-    0xebb2be,
-    0xebb2bf,
-    0xebb380,
-    0xebb381,
-    0xebb382,
-    0xebb383,
-    0xebb384,
-    0xebb385,
-    0xebb386,
-    0xebb387,
-    0xebb388,
-    0xebb389,
-    0xebb38a,
-    0xebb38b,
-    0xebb38c,
-    0xebb38d,
-    0xebb38e,
-    0xebb38f,
-    0xebb390,
-    0xebb391,
-    0xebb392,
-    0xebb393,
-    0xebb394,
-    0xebb395,
-    0xebb396,
-    0xebb397,
-    0xebb398,
-    0xebb399,
-    0xebb39a,
-    0xebb39b,
-    0xebb39c,
-    0xebb39d,
-    0xebb39e,
-    0xebb39f,
-    0xebb3a0,
-    0xebb3a1,
-    0xebb3a2,
-    0xebb3a3,
-    0xebb3a4,
-    0xebb3a5,
-    0xebb3a6,
-    0xebb3a7,
-    0xebb3a8,
-    0xebb3a9,
-    0xebb3aa,
-    0xebb3ab,
-    0xebb3ac,
-    0xebb3ad,
-    0xebb3ae,
-    0xebb3af,
-    0xebb3b0,
-    0xebb3b1,
-    0xebb3b2,
-    0xebb3b3,
-    0xebb3b4,
-    0xebb3b5,
-    0xebb3b6,
-    0xebb3b7,
-    0xebb3b8,
-    0xebb3b9,
-    0xebb3ba,
-    0xebb3bb,
-    0xebb3bc,
-    0xebb3bd,
-    0xebb3be,
-    0xebb3bf,
-    0xebb480,
-    0xebb481,
-    0xebb482,
-    0xebb483,
-    0xebb484,
-    0xebb485,
-    0xebb486,
-    0xebb487,
-    0xebb488,
-    0xebb489,
-    0xebb48a,
-    0xebb48b,
-    0xebb48c,
-    0xebb48d,
-    0xebb48e,
-    0xebb48f,
-    0xebb490,
-    0xebb491,
-    0xebb492,
-    0xebb493,
-    0xebb494,
-    0xebb495,
-    0xebb496,
-    0xebb497,
-    0xebb498,
-    0xebb499,
-    0xebb49a,
-    0xebb49b,
-    0xebb49c,
-    0xebb49d,
-    0xebb49e,
-    0xebb49f,
-    0xebb4a0,
-    0xebb4a1,
-    0xebb4a2,
-    0xebb4a3,
-    0xebb4a4,
-    0xebb4a5,
-    0xebb4a6,
-    0xebb4a7,
-    0xebb4a8,
-    0xebb4a9,
-    0xebb4aa,
-    0xebb4ab,
-    0xebb4ac,
-    0xebb4ad,
-    0xebb4ae,
-    0xebb4af,
-    0xebb4b0,
-    0xebb4b1,
-    0xebb4b2,
-    0xebb4b3,
-    0xebb4b4,
-    0xebb4b5,
-    0xebb4b6,
-    0xebb4b7,
-    0xebb4b8,
-    0xebb4b9,
-    0xebb4ba,
-    0xebb4bb,
-    0xebb4bc,
-    0xebb4bd,
-    0xebb4be,
-    0xebb4bf,
-    0xebb580,
-    0xebb581,
-    0xebb582,
-    0xebb583,
-    0xebb584,
-    0xebb585,
-    0xebb586,
-    0xebb587,
-    0xebb588,
-    0xebb589,
-    0xebb58a,
-    0xebb58b,
-    0xebb58c,
-    0xebb58d,
-    0xebb58e,
-    0xebb58f,
-    0xebb590,
-    0xebb591,
-    0xebb592,
-    0xebb593,
-    0xebb594,
-    0xebb595,
-    0xebb596,
-    0xebb597,
-    0xebb598,
-    0xebb599,
-    0xebb59a,
-    0xebb59b,
-    0xebb59c,
-    0xebb59d,
-    0xebb59e,
-    0xebb59f,
-    0xebb5a0,
-    0xebb5a1,
-    0xebb5a2,
-    0xebb5a3,
-    0xebb5a4,
-    0xebb5a5,
-    0xebb5a6,
-    0xebb5a7,
-    0xebb5a8,
-    0xebb5a9,
-    0xebb5aa,
-    0xebb5ab,
-    0xebb5ac,
-    0xebb5ad,
-    0xebb5ae,
-    0xebb5af,
-    0xebb5b0,
-    0xebb5b1,
-    0xebb5b2,
-    0xebb5b3,
-    0xebb5b4,
-    0xebb5b5,
-    0xebb5b6,
-    0xebb5b7,
-    0xebb5b8,
-    0xebb5b9,
-    0xebb5ba,
-    0xebb5bb,
-    0xebb5bc,
-    0xebb5bd,
-    0xebb5be,
-    0xebb5bf,
-    0xebb680,
-    0xebb681,
-    0xebb682,
-    0xebb683,
-    0xebb684,
-    0xebb685,
-    0xebb686,
-    0xebb687,
-    0xebb688,
-    0xebb689,
-    0xebb68a,
-    0xebb68b,
-    0xebb68c,
-    0xebb68d,
-    0xebb68e,
-    0xebb68f,
-    0xebb690,
-    0xebb691,
-    0xebb692,
-    0xebb693,
-    0xebb694,
-    0xebb695,
-    0xebb696,
-    0xebb697,
-    0xebb698,
-    0xebb699,
-    0xebb69a,
-    0xebb69b,
-    0xebb69c,
-    0xebb69d,
-    0xebb69e,
-    0xebb69f,
-    0xebb6a0,
-    0xebb6a1,
-    0xebb6a2,
-    0xebb6a3,
-    0xebb6a4,
-    0xebb6a5,
-    0xebb6a6,
-    0xebb6a7,
-    0xebb6a8,
-    0xebb6a9,
-    0xebb6aa,
-    0xebb6ab,
-    0xebb6ac,
-    0xebb6ad,
-    0xebb6ae,
-    0xebb6af,
-    0xebb6b0,
-    0xebb6b1,
-    0xebb6b2,
-    0xebb6b3,
-    0xebb6b4,
-    0xebb6b5,
-    0xebb6b6,
-    0xebb6b7,
-    0xebb6b8,
-    0xebb6b9,
-    0xebb6ba,
-    0xebb6bb,
-    0xebb6bc,
-    0xebb6bd,
-    0xebb6be,
-    0xebb6bf,
-    0xebb780,
-    0xebb781,
-    0xebb782,
-    0xebb783,
-    0xebb784,
-    0xebb785,
-    0xebb786,
-    0xebb787,
-    0xebb788,
-    0xebb789,
-    0xebb78a,
-    0xebb78b,
-    0xebb78c,
-    0xebb78d,
-    0xebb78e,
-    0xebb78f,
-    0xebb790,
-    0xebb791,
-    0xebb792,
-    0xebb793,
-    0xebb794,
-    0xebb795,
-    0xebb796,
-    0xebb797,
-    0xebb798,
-    0xebb799,
-    0xebb79a,
-    0xebb79b,
-    0xebb79c,
-    0xebb79d,
-    0xebb79e,
-    0xebb79f,
-    0xebb7a0,
-    0xebb7a1,
-    0xebb7a2,
-    0xebb7a3,
-    0xebb7a4,
-    0xebb7a5,
-    0xebb7a6,
-    0xebb7a7,
-    0xebb7a8,
-    0xebb7a9,
-    0xebb7aa,
-    0xebb7ab,
-    0xebb7ac,
-    0xebb7ad,
-    0xebb7ae,
-    0xebb7af,
-    0xebb7b0,
-    0xebb7b1,
-    0xebb7b2,
-    0xebb7b3,
-    0xebb7b4,
-    0xebb7b5,
-    0xebb7b6,
-    0xebb7b7,
-    0xebb7b8,
-    0xebb7b9,
-    0xebb7ba,
-    0xebb7bb,
-    0xebb7bc,
-    0xebb7bd,
-    0xebb7be,
-    0xebb7bf,
-    0xebb880,
-    0xebb881,
-    0xebb882,
-    0xebb883,
-    0xebb884,
-    0xebb885,
-    0xebb886,
-    0xebb887,
-    0xebb888,
-    0xebb889,
-    0xebb88a,
-    0xebb88b,
-    0xebb88c,
-    0xebb88d,
-    0xebb88e,
-    0xebb88f,
-    0xebb890,
-    0xebb891,
-    0xebb892,
-    0xebb893,
-    0xebb894,
-    0xebb895,
-    0xebb896,
-    0xebb897,
-    0xebb898,
-    0xebb899,
-    0xebb89a,
-    0xebb89b,
-    0xebb89c,
-    0xebb89d,
-    0xebb89e,
-    0xebb89f,
-    0xebb8a0,
-    0xebb8a1,
-    0xebb8a2,
-    0xebb8a3,
-    0xebb8a4,
-    0xebb8a5,
-    0xebb8a6,
-    0xebb8a7,
-    0xebb8a8,
-    0xebb8a9,
-    0xebb8aa,
-    0xebb8ab,
-    0xebb8ac,
-    0xebb8ad,
-    0xebb8ae,
-    0xebb8af,
-    0xebb8b0,
-    0xebb8b1,
-    0xebb8b2,
-    0xebb8b3,
-    0xebb8b4,
-    0xebb8b5,
-    0xebb8b6,
-    0xebb8b7,
-    0xebb8b8,
-    0xebb8b9,
-    0xebb8ba,
-    0xebb8bb,
-    0xebb8bc,
-    0xebb8bd,
-    0xebb8be,
-    0xebb8bf,
-    0xebb980,
-    0xebb981,
-    0xebb982,
-    0xebb983,
-    0xebb984,
-    0xebb985,
-    0xebb986,
-    0xebb987,
-    0xebb988,
-    0xebb989,
-    0xebb98a,
-    0xebb98b,
-    0xebb98c,
-    0xebb98d,
-    0xebb98e,
-    0xebb98f,
-    0xebb990,
-    0xebb991,
-    0xebb992,
-    0xebb993,
-    0xebb994,
-    0xebb995,
-    0xebb996,
-    0xebb997,
-    0xebb998,
-    0xebb999,
-    0xebb99a,
-    0xebb99b,
-    0xebb99c,
-    0xebb99d,
-    0xebb99e,
-    0xebb99f,
-    0xebb9a0,
-    0xebb9a1,
-    0xebb9a2,
-    0xebb9a3,
-    0xebb9a4,
-    0xebb9a5,
-    0xebb9a6,
-    0xebb9a7,
-    0xebb9a8,
-    0xebb9a9,
-    0xebb9aa,
-    0xebb9ab,
-    0xebb9ac,
-    0xebb9ad,
-    0xebb9ae,
-    0xebb9af,
-    0xebb9b0,
-    0xebb9b1,
-    0xebb9b2,
-    0xebb9b3,
-    0xebb9b4,
-    0xebb9b5,
-    0xebb9b6,
-    0xebb9b7,
-    0xebb9b8,
-    0xebb9b9,
-    0xebb9ba,
-    0xebb9bb,
-    0xebb9bc,
-    0xebb9bd,
-    0xebb9be,
-    0xebb9bf,
-    0xebba80,
-    0xebba81,
-    0xebba82,
-    0xebba83,
-    0xebba84,
-    0xebba85,
-    0xebba86,
-    0xebba87,
-    0xebba88,
-    0xebba89,
-    0xebba8a,
-    0xebba8b,
-    0xebba8c,
-    0xebba8d,
-    0xebba8e,
-    0xebba8f,
-    0xebba90,
-    0xebba91,
-    0xebba92,
-    0xebba93,
-    0xebba94,
-    0xebba95,
-    0xebba96,
-    0xebba97,
-    0xebba98,
-    0xebba99,
-    0xebba9a,
-    0xebba9b,
-    0xebba9c,
-    0xebba9d,
-    0xebba9e,
-    0xebba9f,
-    0xebbaa0,
-    0xebbaa1,
-    0xebbaa2,
-    0xebbaa3,
-    0xebbaa4,
-    0xebbaa5,
-    0xebbaa6,
-    0xebbaa7,
-    0xebbaa8,
-    0xebbaa9,
-    0xebbaaa,
-    0xebbaab,
-    0xebbaac,
-    0xebbaad,
-    0xebbaae,
-    0xebbaaf,
-    0xebbab0,
-    0xebbab1,
-    0xebbab2,
-    0xebbab3,
-    0xebbab4,
-    0xebbab5,
-    0xebbab6,
-    0xebbab7,
-    0xebbab8,
-    0xebbab9,
-    0xebbaba,
-    0xebbabb,
-    0xebbabc,
-    0xebbabd,
-    0xebbabe,
-    0xebbabf,
-    0xebbb80,
-    0xebbb81,
-    0xebbb82,
-    0xebbb83,
-    0xebbb84,
-    0xebbb85,
-    0xebbb86,
-    0xebbb87,
-    0xebbb88,
-    0xebbb89,
-    0xebbb8a,
-    0xebbb8b,
-    0xebbb8c,
-    0xebbb8d,
-    0xebbb8e,
-    0xebbb8f,
-    0xebbb90,
-    0xebbb91,
-    0xebbb92,
-    0xebbb93,
-    0xebbb94,
-    0xebbb95,
-    0xebbb96,
-    0xebbb97,
-    0xebbb98,
-    0xebbb99,
-    0xebbb9a,
-    0xebbb9b,
-    0xebbb9c,
-    0xebbb9d,
-    0xebbb9e,
-    0xebbb9f,
-    0xebbba0,
-    0xebbba1,
-    0xebbba2,
-    0xebbba3,
-    0xebbba4,
-    0xebbba5,
-    0xebbba6,
-    0xebbba7,
-    0xebbba8,
-    0xebbba9,
-    0xebbbaa,
-    0xebbbab,
-    0xebbbac,
-    0xebbbad,
-    0xebbbae,
-    0xebbbaf,
-    0xebbbb0,
-    0xebbbb1,
-    0xebbbb2,
-    0xebbbb3,
-    0xebbbb4,
-    0xebbbb5,
-    0xebbbb6,
-    0xebbbb7,
-    0xebbbb8,
-    0xebbbb9,
-    0xebbbba,
-    0xebbbbb,
-    0xebbbbc,
-    0xebbbbd,
-    0xebbbbe,
-    0xebbbbf,
-    0xebbc80,
-    0xebbc81,
-    0xebbc82,
-    0xebbc83,
-    0xebbc84,
-    0xebbc85,
-    0xebbc86,
-    0xebbc87,
-    0xebbc88,
-    0xebbc89,
-    0xebbc8a,
-    0xebbc8b,
-    0xebbc8c,
-    0xebbc8d,
-    0xebbc8e,
-    0xebbc8f,
-    0xebbc90,
-    0xebbc91,
-    0xebbc92,
-    0xebbc93,
-    0xebbc94,
-    0xebbc95,
-    0xebbc96,
-    0xebbc97,
-    0xebbc98,
-    0xebbc99,
-    0xebbc9a,
-    0xebbc9b,
-    0xebbc9c,
-    0xebbc9d,
-    0xebbc9e,
-    0xebbc9f,
-    0xebbca0,
-    0xebbca1,
-    0xebbca2,
-    0xebbca3,
-    0xebbca4,
-    0xebbca5,
-    0xebbca6,
-    0xebbca7,
-    0xebbca8,
-    0xebbca9,
-    0xebbcaa,
-    0xebbcab,
-    0xebbcac,
-    0xebbcad,
-    0xebbcae,
-    0xebbcaf,
-    0xebbcb0,
-    0xebbcb1,
-    0xebbcb2,
-    0xebbcb3,
-    0xebbcb4,
-    0xebbcb5,
-    0xebbcb6,
-    0xebbcb7,
-    0xebbcb8,
-    0xebbcb9,
-    0xebbcba,
-    0xebbcbb,
-    0xebbcbc,
-    0xebbcbd,
-    0xebbcbe,
-    0xebbcbf,
-    0xebbd80,
-    0xebbd81,
-    0xebbd82,
-    0xebbd83,
-    0xebbd84,
-    0xebbd85,
-    0xebbd86,
-    0xebbd87,
-    0xebbd88,
-    0xebbd89,
-    0xebbd8a,
-    0xebbd8b,
-    0xebbd8c,
-    0xebbd8d,
-    0xebbd8e,
-    0xebbd8f,
-    0xebbd90,
-    0xebbd91,
-    0xebbd92,
-    0xebbd93,
-    0xebbd94,
-    0xebbd95,
-    0xebbd96,
-    0xebbd97,
-    0xebbd98,
-    0xebbd99,
-    0xebbd9a,
-    0xebbd9b,
-    0xebbd9c,
-    0xebbd9d,
-    0xebbd9e,
-    0xebbd9f,
-    0xebbda0,
-    0xebbda1,
-    0xebbda2,
-    0xebbda3,
-    0xebbda4,
-    0xebbda5,
-    0xebbda6,
-    0xebbda7,
-    0xebbda8,
-    0xebbda9,
-    0xebbdaa,
-    0xebbdab,
-    0xebbdac,
-    0xebbdad,
-    0xebbdae,
-    0xebbdaf,
-    0xebbdb0,
-    0xebbdb1,
-    0xebbdb2,
-    0xebbdb3,
-    0xebbdb4,
-    0xebbdb5,
-    0xebbdb6,
-    0xebbdb7,
-    0xebbdb8,
-    0xebbdb9,
-    0xebbdba,
-    0xebbdbb,
-    0xebbdbc,
-    0xebbdbd,
-    0xebbdbe,
-    0xebbdbf,
-    0xebbe80,
-    0xebbe81,
-    0xebbe82,
-    0xebbe83,
-    0xebbe84,
-    0xebbe85,
-    0xebbe86,
-    0xebbe87,
-    0xebbe88,
-    0xebbe89,
-    0xebbe8a,
-    0xebbe8b,
-    0xebbe8c,
-    0xebbe8d,
-    0xebbe8e,
-    0xebbe8f,
-    0xebbe90,
-    0xebbe91,
-    0xebbe92,
-    0xebbe93,
-    0xebbe94,
-    0xebbe95,
-    0xebbe96,
-    0xebbe97,
-    0xebbe98,
-    0xebbe99,
-    0xebbe9a,
-    0xebbe9b,
-    0xebbe9c,
-    0xebbe9d,
-    0xebbe9e,
-    0xebbe9f,
-    0xebbea0,
-    0xebbea1,
-    0xebbea2,
-    0xebbea3,
-    0xebbea4,
-    0xebbea5,
-    0xebbea6,
-    0xebbea7,
-    0xebbea8,
-    0xebbea9,
-    0xebbeaa,
-    0xebbeab,
-    0xebbeac,
-    0xebbead,
-    0xebbeae,
-    0xebbeaf,
-    0xebbeb0,
-    0xebbeb1,
-    0xebbeb2,
-    0xebbeb3,
-    0xebbeb4,
-    0xebbeb5,
-    0xebbeb6,
-    0xebbeb7,
-    0xebbeb8,
-    0xebbeb9,
-    0xebbeba,
-    0xebbebb,
-    0xebbebc,
-    0xebbebd,
-    0xebbebe,
-    0xebbebf,
-    0xebbf80,
-    0xebbf81,
-    0xebbf82,
-    0xebbf83,
-    0xebbf84,
-    0xebbf85,
-    0xebbf86,
-    0xebbf87,
-    0xebbf88,
-    0xebbf89,
-    0xebbf8a,
-    0xebbf8b,
-    0xebbf8c,
-    0xebbf8d,
-    0xebbf8e,
-    0xebbf8f,
-    0xebbf90,
-    0xebbf91,
-    0xebbf92,
-    0xebbf93,
-    0xebbf94,
-    0xebbf95,
-    0xebbf96,
-    0xebbf97,
-    0xebbf98,
-    0xebbf99,
-    0xebbf9a,
-    0xebbf9b,
-    0xebbf9c,
-    0xebbf9d,
-    0xebbf9e,
-    0xebbf9f,
-    0xebbfa0,
-    0xebbfa1,
-    0xebbfa2,
-    0xebbfa3,
-    0xebbfa4,
-    0xebbfa5,
-    0xebbfa6,
-    0xebbfa7,
-    0xebbfa8,
-    0xebbfa9,
-    0xebbfaa,
-    0xebbfab,
-    0xebbfac,
-    0xebbfad,
-    0xebbfae,
-    0xebbfaf,
-    0xebbfb0,
-    0xebbfb1,
-    0xebbfb2,
-    0xebbfb3,
-    0xebbfb4,
-    0xebbfb5,
-    0xebbfb6,
-    0xebbfb7,
-    0xebbfb8,
-    0xebbfb9,
-    0xebbfba,
-    0xebbfbb,
-    0xebbfbc,
-    0xebbfbd,
-    0xebbfbe,
-    0xebbfbf,
-    0xec8080,
-    0xec8081,
-    0xec8082,
-    0xec8083,
-    0xec8084,
-    0xec8085,
-    0xec8086,
-    0xec8087,
-    0xec8088,
-    0xec8089,
-    0xec808a,
-    0xec808b,
-    0xec808c,
-    0xec808d,
-    0xec808e,
-    0xec808f,
-    0xec8090,
-    0xec8091,
-    0xec8092,
-    0xec8093,
-    0xec8094,
-    0xec8095,
-    0xec8096,
-    0xec8097,
-    0xec8098,
-    0xec8099,
-    0xec809a,
-    0xec809b,
-    0xec809c,
-    0xec809d,
-    0xec809e,
-    0xec809f,
-    0xec80a0,
-    0xec80a1,
-    0xec80a2,
-    0xec80a3,
-    0xec80a4,
-    0xec80a5,
-    0xec80a6,
-    0xec80a7,
-    0xec80a8,
-    0xec80a9,
-    0xec80aa,
-    0xec80ab,
-    0xec80ac,
-    0xec80ad,
-    0xec80ae,
-    0xec80af,
-    0xec80b0,
-    0xec80b1,
-    0xec80b2,
-    0xec80b3,
-    0xec80b4,
-    0xec80b5,
-    0xec80b6,
-    0xec80b7,
-    0xec80b8,
-    0xec80b9,
-    0xec80ba,
-    0xec80bb,
-    0xec80bc,
-    0xec80bd,
-    0xec80be,
-    0xec80bf,
-    0xec8180,
-    0xec8181,
-    0xec8182,
-    0xec8183,
-    0xec8184,
-    0xec8185,
-    0xec8186,
-    0xec8187,
-    0xec8188,
-    0xec8189,
-    0xec818a,
-    0xec818b,
-    0xec818c,
-    0xec818d,
-    0xec818e,
-    0xec818f,
-    0xec8190,
-    0xec8191,
-    0xec8192,
-    0xec8193,
-    0xec8194,
-    0xec8195,
-    0xec8196,
-    0xec8197,
-    0xec8198,
-    0xec8199,
-    0xec819a,
-    0xec819b,
-    0xec819c,
-    0xec819d,
-    0xec819e,
-    0xec819f,
-    0xec81a0,
-    0xec81a1,
-    0xec81a2,
-    0xec81a3,
-    0xec81a4,
-    0xec81a5,
-    0xec81a6,
-    0xec81a7,
-    0xec81a8,
-    0xec81a9,
-    0xec81aa,
-    0xec81ab,
-    0xec81ac,
-    0xec81ad,
-    0xec81ae,
-    0xec81af,
-    0xec81b0,
-    0xec81b1,
-    0xec81b2,
-    0xec81b3,
-    0xec81b4,
-    0xec81b5,
-    0xec81b6,
-    0xec81b7,
-    0xec81b8,
-    0xec81b9,
-    0xec81ba,
-    0xec81bb,
-    0xec81bc,
-    0xec81bd,
-    0xec81be,
-    0xec81bf,
-    0xec8280,
-    0xec8281,
-    0xec8282,
-    0xec8283,
-    0xec8284,
-    0xec8285,
-    0xec8286,
-    0xec8287,
-    0xec8288,
-    0xec8289,
-    0xec828a,
-    0xec828b,
-    0xec828c,
-    0xec828d,
-    0xec828e,
-    0xec828f,
-    0xec8290,
-    0xec8291,
-    0xec8292,
-    0xec8293,
-    0xec8294,
-    0xec8295,
-    0xec8296,
-    0xec8297,
-    0xec8298,
-    0xec8299,
-    0xec829a,
-    0xec829b,
-    0xec829c,
-    0xec829d,
-    0xec829e,
-    0xec829f,
-    0xec82a0,
-    0xec82a1,
-    0xec82a2,
-    0xec82a3,
-    0xec82a4,
-    0xec82a5,
-    0xec82a6,
-    0xec82a7,
-    0xec82a8,
-    0xec82a9,
-    0xec82aa,
-    0xec82ab,
-    0xec82ac,
-    0xec82ad,
-    0xec82ae,
-    0xec82af,
-    0xec82b0,
-    0xec82b1,
-    0xec82b2,
-    0xec82b3,
-    0xec82b4,
-    0xec82b5,
-    0xec82b6,
-    0xec82b7,
-    0xec82b8,
-    0xec82b9,
-    0xec82ba,
-    0xec82bb,
-    0xec82bc,
-    0xec82bd,
-    0xec82be,
-    0xec82bf,
-    0xec8380,
-    0xec8381,
-    0xec8382,
-    0xec8383,
-    0xec8384,
-    0xec8385,
-    0xec8386,
-    0xec8387,
-    0xec8388,
-    0xec8389,
-    0xec838a,
-    0xec838b,
-    0xec838c,
-    0xec838d,
-    0xec838e,
-    0xec838f,
-    0xec8390,
-    0xec8391,
-    0xec8392,
-    0xec8393,
-    0xec8394,
-    0xec8395,
-    0xec8396,
-    0xec8397,
-    0xec8398,
-    0xec8399,
-    0xec839a,
-    0xec839b,
-    0xec839c,
-    0xec839d,
-    0xec839e,
-    0xec839f,
-    0xec83a0,
-    0xec83a1,
-    0xec83a2,
-    0xec83a3,
-    0xec83a4,
-    0xec83a5,
-    0xec83a6,
-    0xec83a7,
-    0xec83a8,
-    0xec83a9,
-    0xec83aa,
-    0xec83ab,
-    0xec83ac,
-    0xec83ad,
-    0xec83ae,
-    0xec83af,
-    0xec83b0,
-    0xec83b1,
-    0xec83b2,
-    0xec83b3,
-    0xec83b4,
-    0xec83b5,
-    0xec83b6,
-    0xec83b7,
-    0xec83b8,
-    0xec83b9,
-    0xec83ba,
-    0xec83bb,
-    0xec83bc,
-    0xec83bd,
-    0xec83be,
-    0xec83bf,
-    0xec8480,
-    0xec8481,
-    0xec8482,
-    0xec8483,
-    0xec8484,
-    0xec8485,
-    0xec8486,
-    0xec8487,
-    0xec8488,
-    0xec8489,
-    0xec848a,
-    0xec848b,
-    0xec848c,
-    0xec848d,
-    0xec848e,
-    0xec848f,
-    0xec8490,
-    0xec8491,
-    0xec8492,
-    0xec8493,
-    0xec8494,
-    0xec8495,
-    0xec8496,
-    0xec8497,
-    0xec8498,
-    0xec8499,
-    0xec849a,
-    0xec849b,
-    0xec849c,
-    0xec849d,
-    0xec849e,
-    0xec849f,
-    0xec84a0,
-    0xec84a1,
-    0xec84a2,
-    0xec84a3,
-    0xec84a4,
-    0xec84a5,
-    0xec84a6,
-    0xec84a7,
-    0xec84a8,
-    0xec84a9,
-    0xec84aa,
-    0xec84ab,
-    0xec84ac,
-    0xec84ad,
-    0xec84ae,
-    0xec84af,
-    0xec84b0,
-    0xec84b1,
-    0xec84b2,
-    0xec84b3,
-    0xec84b4,
-    0xec84b5,
-    0xec84b6,
-    0xec84b7,
-    0xec84b8,
-    0xec84b9,
-    0xec84ba,
-    0xec84bb,
-    0xec84bc,
-    0xec84bd,
-    0xec84be,
-    0xec84bf,
-    0xec8580,
-    0xec8581,
-    0xec8582,
-    0xec8583,
-    0xec8584,
-    0xec8585,
-    0xec8586,
-    0xec8587,
-    0xec8588,
-    0xec8589,
-    0xec858a,
-    0xec858b,
-    0xec858c,
-    0xec858d,
-    0xec858e,
-    0xec858f,
-    0xec8590,
-    0xec8591,
-    0xec8592,
-    0xec8593,
-    0xec8594,
-    0xec8595,
-    0xec8596,
-    0xec8597,
-    0xec8598,
-    0xec8599,
-    0xec859a,
-    0xec859b,
-    0xec859c,
-    0xec859d,
-    0xec859e,
-    0xec859f,
-    0xec85a0,
-    0xec85a1,
-    0xec85a2,
-    0xec85a3,
-    0xec85a4,
-    0xec85a5,
-    0xec85a6,
-    0xec85a7,
-    0xec85a8,
-    0xec85a9,
-    0xec85aa,
-    0xec85ab,
-    0xec85ac,
-    0xec85ad,
-    0xec85ae,
-    0xec85af,
-    0xec85b0,
-    0xec85b1,
-    0xec85b2,
-    0xec85b3,
-    0xec85b4,
-    0xec85b5,
-    0xec85b6,
-    0xec85b7,
-    0xec85b8,
-    0xec85b9,
-    0xec85ba,
-    0xec85bb,
-    0xec85bc,
-    0xec85bd,
-    0xec85be,
-    0xec85bf,
-    0xec8680,
-    0xec8681,
-    0xec8682,
-    0xec8683,
-    0xec8684,
-    0xec8685,
-    0xec8686,
-    0xec8687,
-    0xec8688,
-    0xec8689,
-    0xec868a,
-    0xec868b,
-    0xec868c,
-    0xec868d,
-    0xec868e,
-    0xec868f,
-    0xec8690,
-    0xec8691,
-    0xec8692,
-    0xec8693,
-    0xec8694,
-    0xec8695,
-    0xec8696,
-    0xec8697,
-    0xec8698,
-    0xec8699,
-    0xec869a,
-    0xec869b,
-    0xec869c,
-    0xec869d,
-    0xec869e,
-    0xec869f,
-    0xec86a0,
-    0xec86a1,
-    0xec86a2,
-    0xec86a3,
-    0xec86a4,
-    0xec86a5,
-    0xec86a6,
-    0xec86a7,
-    0xec86a8,
-    0xec86a9,
-    0xec86aa,
-    0xec86ab,
-    0xec86ac,
-    0xec86ad,
-    0xec86ae,
-    0xec86af,
-    0xec86b0,
-    0xec86b1,
-    0xec86b2,
-    0xec86b3,
-    0xec86b4,
-    0xec86b5,
-    0xec86b6,
-    0xec86b7,
-    0xec86b8,
-    0xec86b9,
-    0xec86ba,
-    0xec86bb,
-    0xec86bc,
-    0xec86bd,
-    0xec86be,
-    0xec86bf,
-    0xec8780,
-    0xec8781,
-    0xec8782,
-    0xec8783,
-    0xec8784,
-    0xec8785,
-    0xec8786,
-    0xec8787,
-    0xec8788,
-    0xec8789,
-    0xec878a,
-    0xec878b,
-    0xec878c,
-    0xec878d,
-    0xec878e,
-    0xec878f,
-    0xec8790,
-    0xec8791,
-    0xec8792,
-    0xec8793,
-    0xec8794,
-    0xec8795,
-    0xec8796,
-    0xec8797,
-    0xec8798,
-    0xec8799,
-    0xec879a,
-    0xec879b,
-    0xec879c,
-    0xec879d,
-    0xec879e,
-    0xec879f,
-    0xec87a0,
-    0xec87a1,
-    0xec87a2,
-    0xec87a3,
-    0xec87a4,
-    0xec87a5,
-    0xec87a6,
-    0xec87a7,
-    0xec87a8,
-    0xec87a9,
-    0xec87aa,
-    0xec87ab,
-    0xec87ac,
-    0xec87ad,
-    0xec87ae,
-    0xec87af,
-    0xec87b0,
-    0xec87b1,
-    0xec87b2,
-    0xec87b3,
-    0xec87b4,
-    0xec87b5,
-    0xec87b6,
-    0xec87b7,
-    0xec87b8,
-    0xec87b9,
-    0xec87ba,
-    0xec87bb,
-    0xec87bc,
-    0xec87bd,
-    0xec87be,
-    0xec87bf,
-    0xec8880,
-    0xec8881,
-    0xec8882,
-    0xec8883,
-    0xec8884,
-    0xec8885,
-    0xec8886,
-    0xec8887,
-    0xec8888,
-    0xec8889,
-    0xec888a,
-    0xec888b,
-    0xec888c,
-    0xec888d,
-    0xec888e,
-    0xec888f,
-    0xec8890,
-    0xec8891,
-    0xec8892,
-    0xec8893,
-    0xec8894,
-    0xec8895,
-    0xec8896,
-    0xec8897,
-    0xec8898,
-    0xec8899,
-    0xec889a,
-    0xec889b,
-    0xec889c,
-    0xec889d,
-    0xec889e,
-    0xec889f,
-    0xec88a0,
-    0xec88a1,
-    0xec88a2,
-    0xec88a3,
-    0xec88a4,
-    0xec88a5,
-    0xec88a6,
-    0xec88a7,
-    0xec88a8,
-    0xec88a9,
-    0xec88aa,
-    0xec88ab,
-    0xec88ac,
-    0xec88ad,
-    0xec88ae,
-    0xec88af,
-    0xec88b0,
-    0xec88b1,
-    0xec88b2,
-    0xec88b3,
-    0xec88b4,
-    0xec88b5,
-    0xec88b6,
-    0xec88b7,
-    0xec88b8,
-    0xec88b9,
-    0xec88ba,
-    0xec88bb,
-    0xec88bc,
-    0xec88bd,
-    0xec88be,
-    0xec88bf,
-    0xec8980,
-    0xec8981,
-    0xec8982,
-    0xec8983,
-    0xec8984,
-    0xec8985,
-    0xec8986,
-    0xec8987,
-    0xec8988,
-    0xec8989,
-    0xec898a,
-    0xec898b,
-    0xec898c,
-    0xec898d,
-    0xec898e,
-    0xec898f,
-    0xec8990,
-    0xec8991,
-    0xec8992,
-    0xec8993,
-    0xec8994,
-    0xec8995,
-    0xec8996,
-    0xec8997,
-    0xec8998,
-    0xec8999,
-    0xec899a,
-    0xec899b,
-    0xec899c,
-    0xec899d,
-    0xec899e,
-    0xec899f,
-    0xec89a0,
-    0xec89a1,
-    0xec89a2,
-    0xec89a3,
-    0xec89a4,
-    0xec89a5,
-    0xec89a6,
-    0xec89a7,
-    0xec89a8,
-    0xec89a9,
-    0xec89aa,
-    0xec89ab,
-    0xec89ac,
-    0xec89ad,
-    0xec89ae,
-    0xec89af,
-    0xec89b0,
-    0xec89b1,
-    0xec89b2,
-    0xec89b3,
-    0xec89b4,
-    0xec89b5,
-    0xec89b6,
-    0xec89b7,
-    0xec89b8,
-    0xec89b9,
-    0xec89ba,
-    0xec89bb,
-    0xec89bc,
-    0xec89bd,
-    0xec89be,
-    0xec89bf,
-    0xec8a80,
-    0xec8a81,
-    0xec8a82,
-    0xec8a83,
-    0xec8a84,
-    0xec8a85,
-    0xec8a86,
-    0xec8a87,
-    0xec8a88,
-    0xec8a89,
-    0xec8a8a,
-    0xec8a8b,
-    0xec8a8c,
-    0xec8a8d,
-    0xec8a8e,
-    0xec8a8f,
-    0xec8a90,
-    0xec8a91,
-    0xec8a92,
-    0xec8a93,
-    0xec8a94,
-    0xec8a95,
-    0xec8a96,
-    0xec8a97,
-    0xec8a98,
-    0xec8a99,
-    0xec8a9a,
-    0xec8a9b,
-    0xec8a9c,
-    0xec8a9d,
-    0xec8a9e,
-    0xec8a9f,
-    0xec8aa0,
-    0xec8aa1,
-    0xec8aa2,
-    0xec8aa3,
-    0xec8aa4,
-    0xec8aa5,
-    0xec8aa6,
-    0xec8aa7,
-    0xec8aa8,
-    0xec8aa9,
-    0xec8aaa,
-    0xec8aab,
-    0xec8aac,
-    0xec8aad,
-    0xec8aae,
-    0xec8aaf,
-    0xec8ab0,
-    0xec8ab1,
-    0xec8ab2,
-    0xec8ab3,
-    0xec8ab4,
-    0xec8ab5,
-    0xec8ab6,
-    0xec8ab7,
-    0xec8ab8,
-    0xec8ab9,
-    0xec8aba,
-    0xec8abb,
-    0xec8abc,
-    0xec8abd,
-    0xec8abe,
-    0xec8abf,
-    0xec8b80,
-    0xec8b81,
-    0xec8b82,
-    0xec8b83,
-    0xec8b84,
-    0xec8b85,
-    0xec8b86,
-    0xec8b87,
-    0xec8b88,
-    0xec8b89,
-    0xec8b8a,
-    0xec8b8b,
-    0xec8b8c,
-    0xec8b8d,
-    0xec8b8e,
-    0xec8b8f,
-    0xec8b90,
-    0xec8b91,
-    0xec8b92,
-    0xec8b93,
-    0xec8b94,
-    0xec8b95,
-    0xec8b96,
-    0xec8b97,
-    0xec8b98,
-    0xec8b99,
-    0xec8b9a,
-    0xec8b9b,
-    0xec8b9c,
-    0xec8b9d,
-    0xec8b9e,
-    0xec8b9f,
-    0xec8ba0,
-    0xec8ba1,
-    0xec8ba2,
-    0xec8ba3,
-    0xec8ba4,
-    0xec8ba5,
-    0xec8ba6,
-    0xec8ba7,
-    0xec8ba8,
-    0xec8ba9,
-    0xec8baa,
-    0xec8bab,
-    0xec8bac,
-    0xec8bad,
-    0xec8bae,
-    0xec8baf,
-    0xec8bb0,
-    0xec8bb1,
-    0xec8bb2,
-    0xec8bb3,
-    0xec8bb4,
-    0xec8bb5,
-    0xec8bb6,
-    0xec8bb7,
-    0xec8bb8,
-    0xec8bb9,
-    0xec8bba,
-    0xec8bbb,
-    0xec8bbc,
-    0xec8bbd,
-    0xec8bbe,
-    0xec8bbf,
-    0xec8c80,
-    0xec8c81,
-    0xec8c82,
-    0xec8c83,
-    0xec8c84,
-    0xec8c85,
-    0xec8c86,
-    0xec8c87,
-    0xec8c88,
-    0xec8c89,
-    0xec8c8a,
-    0xec8c8b,
-    0xec8c8c,
-    0xec8c8d,
-    0xec8c8e,
-    0xec8c8f,
-    0xec8c90,
-    0xec8c91,
-    0xec8c92,
-    0xec8c93,
-    0xec8c94,
-    0xec8c95,
-    0xec8c96,
-    0xec8c97,
-    0xec8c98,
-    0xec8c99,
-    0xec8c9a,
-    0xec8c9b,
-    0xec8c9c,
-    0xec8c9d,
-    0xec8c9e,
-    0xec8c9f,
-    0xec8ca0,
-    0xec8ca1,
-    0xec8ca2,
-    0xec8ca3,
-    0xec8ca4,
-    0xec8ca5,
-    0xec8ca6,
-    0xec8ca7,
-    0xec8ca8,
-    0xec8ca9,
-    0xec8caa,
-    0xec8cab,
-    0xec8cac,
-    0xec8cad,
-    0xec8cae,
-    0xec8caf,
-    0xec8cb0,
-    0xec8cb1,
-    0xec8cb2,
-    0xec8cb3,
-    0xec8cb4,
-    0xec8cb5,
-    0xec8cb6,
-    0xec8cb7,
-    0xec8cb8,
-    0xec8cb9,
-    0xec8cba,
-    0xec8cbb,
-    0xec8cbc,
-    0xec8cbd,
-    0xec8cbe,
-    0xec8cbf,
-    0xec8d80,
-    0xec8d81,
-    0xec8d82,
-    0xec8d83,
-    0xec8d84,
-    0xec8d85,
-    0xec8d86,
-    0xec8d87,
-    0xec8d88,
-    0xec8d89,
-    0xec8d8a,
-    0xec8d8b,
-    0xec8d8c,
-    0xec8d8d,
-    0xec8d8e,
-    0xec8d8f,
-    0xec8d90,
-    0xec8d91,
-    0xec8d92,
-    0xec8d93,
-    0xec8d94,
-    0xec8d95,
-    0xec8d96,
-    0xec8d97,
-    0xec8d98,
-    0xec8d99,
-    0xec8d9a,
-    0xec8d9b,
-    0xec8d9c,
-    0xec8d9d,
-    0xec8d9e,
-    0xec8d9f,
-    0xec8da0,
-    0xec8da1,
-    0xec8da2,
-    0xec8da3,
-    0xec8da4,
-    0xec8da5,
-    0xec8da6,
-    0xec8da7,
-    0xec8da8,
-    0xec8da9,
-    0xec8daa,
-    0xec8dab,
-    0xec8dac,
-    0xec8dad,
-    0xec8dae,
-    0xec8daf,
-    0xec8db0,
-    0xec8db1,
-    0xec8db2,
-    0xec8db3,
-    0xec8db4,
-    0xec8db5,
-    0xec8db6,
-    0xec8db7,
-    0xec8db8,
-    0xec8db9,
-    0xec8dba,
-    0xec8dbb,
-    0xec8dbc,
-    0xec8dbd,
-    0xec8dbe,
-    0xec8dbf,
-    0xec8e80,
-    0xec8e81,
-    0xec8e82,
-    0xec8e83,
-    0xec8e84,
-    0xec8e85,
-    0xec8e86,
-    0xec8e87,
-    0xec8e88,
-    0xec8e89,
-    0xec8e8a,
-    0xec8e8b,
-    0xec8e8c,
-    0xec8e8d,
-    0xec8e8e,
-    0xec8e8f,
-    0xec8e90,
-    0xec8e91,
-    0xec8e92,
-    0xec8e93,
-    0xec8e94,
-    0xec8e95,
-    0xec8e96,
-    0xec8e97,
-    0xec8e98,
-    0xec8e99,
-    0xec8e9a,
-    0xec8e9b,
-    0xec8e9c,
-    0xec8e9d,
-    0xec8e9e,
-    0xec8e9f,
-    0xec8ea0,
-    0xec8ea1,
-    0xec8ea2,
-    0xec8ea3,
-    0xec8ea4,
-    0xec8ea5,
-    0xec8ea6,
-    0xec8ea7,
-    0xec8ea8,
-    0xec8ea9,
-    0xec8eaa,
-    0xec8eab,
-    0xec8eac,
-    0xec8ead,
-    0xec8eae,
-    0xec8eaf,
-    0xec8eb0,
-    0xec8eb1,
-    0xec8eb2,
-    0xec8eb3,
-    0xec8eb4,
-    0xec8eb5,
-    0xec8eb6,
-    0xec8eb7,
-    0xec8eb8,
-    0xec8eb9,
-    0xec8eba,
-    0xec8ebb,
-    0xec8ebc,
-    0xec8ebd,
-    0xec8ebe,
-    0xec8ebf,
-    0xec8f80,
-    0xec8f81,
-    0xec8f82,
-    0xec8f83,
-    0xec8f84,
-    0xec8f85,
-    0xec8f86,
-    0xec8f87,
-    0xec8f88,
-    0xec8f89,
-    0xec8f8a,
-    0xec8f8b,
-    0xec8f8c,
-    0xec8f8d,
-    0xec8f8e,
-    0xec8f8f,
-    0xec8f90,
-    0xec8f91,
-    0xec8f92,
-    0xec8f93,
-    0xec8f94,
-    0xec8f95,
-    0xec8f96,
-    0xec8f97,
-    0xec8f98,
-    0xec8f99,
-    0xec8f9a,
-    0xec8f9b,
-    0xec8f9c,
-    0xec8f9d,
-    0xec8f9e,
-    0xec8f9f,
-    0xec8fa0,
-    0xec8fa1,
-    0xec8fa2,
-    0xec8fa3,
-    0xec8fa4,
-    0xec8fa5,
-    0xec8fa6,
-    0xec8fa7,
-    0xec8fa8,
-    0xec8fa9,
-    0xec8faa,
-    0xec8fab,
-    0xec8fac,
-    0xec8fad,
-    0xec8fae,
-    0xec8faf,
-    0xec8fb0,
-    0xec8fb1,
-    0xec8fb2,
-    0xec8fb3,
-    0xec8fb4,
-    0xec8fb5,
-    0xec8fb6,
-    0xec8fb7,
-    0xec8fb8,
-    0xec8fb9,
-    0xec8fba,
-    0xec8fbb,
-    0xec8fbc,
-    0xec8fbd,
-    0xec8fbe,
-    0xec8fbf,
-    0xec9080,
-    0xec9081,
-    0xec9082,
-    0xec9083,
-    0xec9084,
-    0xec9085,
-    0xec9086,
-    0xec9087,
-    0xec9088,
-    0xec9089,
-    0xec908a,
-    0xec908b,
-    0xec908c,
-    0xec908d,
-    0xec908e,
-    0xec908f,
-    0xec9090,
-    0xec9091,
-    0xec9092,
-    0xec9093,
-    0xec9094,
-    0xec9095,
-    0xec9096,
-    0xec9097,
-    0xec9098,
-    0xec9099,
-    0xec909a,
-    0xec909b,
-    0xec909c,
-    0xec909d,
-    0xec909e,
-    0xec909f,
-    0xec90a0,
-    0xec90a1,
-    0xec90a2,
-    0xec90a3,
-    0xec90a4,
-    0xec90a5,
-    0xec90a6,
-    0xec90a7,
-    0xec90a8,
-    0xec90a9,
-    0xec90aa,
-    0xec90ab,
-    0xec90ac,
-    0xec90ad,
-    0xec90ae,
-    0xec90af,
-    0xec90b0,
-    0xec90b1,
-    0xec90b2,
-    0xec90b3,
-    0xec90b4,
-    0xec90b5,
-    0xec90b6,
-    0xec90b7,
-    0xec90b8,
-    0xec90b9,
-    0xec90ba,
-    0xec90bb,
-    0xec90bc,
-    0xec90bd,
-    0xec90be,
-    0xec90bf,
-    0xec9180,
-    0xec9181,
-    0xec9182,
-    0xec9183,
-    0xec9184,
-    0xec9185,
-    0xec9186,
-    0xec9187,
-    0xec9188,
-    0xec9189,
-    0xec918a,
-    0xec918b,
-    0xec918c,
-    0xec918d,
-    0xec918e,
-    0xec918f,
-    0xec9190,
-    0xec9191,
-    0xec9192,
-    0xec9193,
-    0xec9194,
-    0xec9195,
-    0xec9196,
-    0xec9197,
-    0xec9198,
-    0xec9199,
-    0xec919a,
-    0xec919b,
-    0xec919c,
-    0xec919d,
-    0xec919e,
-    0xec919f,
-    0xec91a0,
-    0xec91a1,
-    0xec91a2,
-    0xec91a3,
-    0xec91a4,
-    0xec91a5,
-    0xec91a6,
-    0xec91a7,
-    0xec91a8,
-    0xec91a9,
-    0xec91aa,
-    0xec91ab,
-    0xec91ac,
-    0xec91ad,
-    0xec91ae,
-    0xec91af,
-    0xec91b0,
-    0xec91b1,
-    0xec91b2,
-    0xec91b3,
-    0xec91b4,
-    0xec91b5,
-    0xec91b6,
-    0xec91b7,
-    0xec91b8,
-    0xec91b9,
-    0xec91ba,
-    0xec91bb,
-    0xec91bc,
-    0xec91bd,
-    0xec91be,
-    0xec91bf,
-    0xec9280,
-    0xec9281,
-    0xec9282,
-    0xec9283,
-    0xec9284,
-    0xec9285,
-    0xec9286,
-    0xec9287,
-    0xec9288,
-    0xec9289,
-    0xec928a,
-    0xec928b,
-    0xec928c,
-    0xec928d,
-    0xec928e,
-    0xec928f,
-    0xec9290,
-    0xec9291,
-    0xec9292,
-    0xec9293,
-    0xec9294,
-    0xec9295,
-    0xec9296,
-    0xec9297,
-    0xec9298,
-    0xec9299,
-    0xec929a,
-    0xec929b,
-    0xec929c,
-    0xec929d,
-    0xec929e,
-    0xec929f,
-    0xec92a0,
-    0xec92a1,
-    0xec92a2,
-    0xec92a3,
-    0xec92a4,
-    0xec92a5,
-    0xec92a6,
-    0xec92a7,
-    0xec92a8,
-    0xec92a9,
-    0xec92aa,
-    0xec92ab,
-    0xec92ac,
-    0xec92ad,
-    0xec92ae,
-    0xec92af,
-    0xec92b0,
-    0xec92b1,
-    0xec92b2,
-    0xec92b3,
-    0xec92b4,
-    0xec92b5,
-    0xec92b6,
-    0xec92b7,
-    0xec92b8,
-    0xec92b9,
-    0xec92ba,
-    0xec92bb,
-    0xec92bc,
-    0xec92bd,
-    0xec92be,
-    0xec92bf,
-    0xec9380,
-    0xec9381,
-    0xec9382,
-    0xec9383,
-    0xec9384,
-    0xec9385,
-    0xec9386,
-    0xec9387,
-    0xec9388,
-    0xec9389,
-    0xec938a,
-    0xec938b,
-    0xec938c,
-    0xec938d,
-    0xec938e,
-    0xec938f,
-    0xec9390,
-    0xec9391,
-    0xec9392,
-    0xec9393,
-    0xec9394,
-    0xec9395,
-    0xec9396,
-    0xec9397,
-    0xec9398,
-    0xec9399,
-    0xec939a,
-    0xec939b,
-    0xec939c,
-    0xec939d,
-    0xec939e,
-    0xec939f,
-    0xec93a0,
-    0xec93a1,
-    0xec93a2,
-    0xec93a3,
-    0xec93a4,
-    0xec93a5,
-    0xec93a6,
-    0xec93a7,
-    0xec93a8,
-    0xec93a9,
-    0xec93aa,
-    0xec93ab,
-    0xec93ac,
-    0xec93ad,
-    0xec93ae,
-    0xec93af,
-    0xec93b0,
-    0xec93b1,
-    0xec93b2,
-    0xec93b3,
-    0xec93b4,
-    0xec93b5,
-    0xec93b6,
-    0xec93b7,
-    0xec93b8,
-    0xec93b9,
-    0xec93ba,
-    0xec93bb,
-    0xec93bc,
-    0xec93bd,
-    0xec93be,
-    0xec93bf,
-    0xec9480,
-    0xec9481,
-    0xec9482,
-    0xec9483,
-    0xec9484,
-    0xec9485,
-    0xec9486,
-    0xec9487,
-    0xec9488,
-    0xec9489,
-    0xec948a,
-    0xec948b,
-    0xec948c,
-    0xec948d,
-    0xec948e,
-    0xec948f,
-    0xec9490,
-    0xec9491,
-    0xec9492,
-    0xec9493,
-    0xec9494,
-    0xec9495,
-    0xec9496,
-    0xec9497,
-    0xec9498,
-    0xec9499,
-    0xec949a,
-    0xec949b,
-    0xec949c,
-    0xec949d,
-    0xec949e,
-    0xec949f,
-    0xec94a0,
-    0xec94a1,
-    0xec94a2,
-    0xec94a3,
-    0xec94a4,
-    0xec94a5,
-    0xec94a6,
-    0xec94a7,
-    0xec94a8,
-    0xec94a9,
-    0xec94aa,
-    0xec94ab,
-    0xec94ac,
-    0xec94ad,
-    0xec94ae,
-    0xec94af,
-    0xec94b0,
-    0xec94b1,
-    0xec94b2,
-    0xec94b3,
-    0xec94b4,
-    0xec94b5,
-    0xec94b6,
-    0xec94b7,
-    0xec94b8,
-    0xec94b9,
-    0xec94ba,
-    0xec94bb,
-    0xec94bc,
-    0xec94bd,
-    0xec94be,
-    0xec94bf,
-    0xec9580,
-    0xec9581,
-    0xec9582,
-    0xec9583,
-    0xec9584,
-    0xec9585,
-    0xec9586,
-    0xec9587,
-    0xec9588,
-    0xec9589,
-    0xec958a,
-    0xec958b,
-    0xec958c,
-    0xec958d,
-    0xec958e,
-    0xec958f,
-    0xec9590,
-    0xec9591,
-    0xec9592,
-    0xec9593,
-    0xec9594,
-    0xec9595,
-    0xec9596,
-    0xec9597,
-    0xec9598,
-    0xec9599,
-    0xec959a,
-    0xec959b,
-    0xec959c,
-    0xec959d,
-    0xec959e,
-    0xec959f,
-    0xec95a0,
-    0xec95a1,
-    0xec95a2,
-    0xec95a3,
-    0xec95a4,
-    0xec95a5,
-    0xec95a6,
-    0xec95a7,
-    0xec95a8,
-    0xec95a9,
-    0xec95aa,
-    0xec95ab,
-    0xec95ac,
-    0xec95ad,
-    0xec95ae,
-    0xec95af,
-    0xec95b0,
-    0xec95b1,
-    0xec95b2,
-    0xec95b3,
-    0xec95b4,
-    0xec95b5,
-    0xec95b6,
-    0xec95b7,
-    0xec95b8,
-    0xec95b9,
-    0xec95ba,
-    0xec95bb,
-    0xec95bc,
-    0xec95bd,
-    0xec95be,
-    0xec95bf,
-    0xec9680,
-    0xec9681,
-    0xec9682,
-    0xec9683,
-    0xec9684,
-    0xec9685,
-    0xec9686,
-    0xec9687,
-    0xec9688,
-    0xec9689,
-    0xec968a,
-    0xec968b,
-    0xec968c,
-    0xec968d,
-    0xec968e,
-    0xec968f,
-    0xec9690,
-    0xec9691,
-    0xec9692,
-    0xec9693,
-    0xec9694,
-    0xec9695,
-    0xec9696,
-    0xec9697,
-    0xec9698,
-    0xec9699,
-    0xec969a,
-    0xec969b,
-    0xec969c,
-    0xec969d,
-    0xec969e,
-    0xec969f,
-    0xec96a0,
-    0xec96a1,
-    0xec96a2,
-    0xec96a3,
-    0xec96a4,
-    0xec96a5,
-    0xec96a6,
-    0xec96a7,
-    0xec96a8,
-    0xec96a9,
-    0xec96aa,
-    0xec96ab,
-    0xec96ac,
-    0xec96ad,
-    0xec96ae,
-    0xec96af,
-    0xec96b0,
-    0xec96b1,
-    0xec96b2,
-    0xec96b3,
-    0xec96b4,
-    0xec96b5,
-    0xec96b6,
-    0xec96b7,
-    0xec96b8,
-    0xec96b9,
-    0xec96ba,
-    0xec96bb,
-    0xec96bc,
-    0xec96bd,
-    0xec96be,
-    0xec96bf,
-    0xec9780,
-    0xec9781,
-    0xec9782,
-    0xec9783,
-    0xec9784,
-    0xec9785,
-    0xec9786,
-    0xec9787,
-    0xec9788,
-    0xec9789,
-    0xec978a,
-    0xec978b,
-    0xec978c,
-    0xec978d,
-    0xec978e,
-    0xec978f,
-    0xec9790,
-    0xec9791,
-    0xec9792,
-    0xec9793,
-    0xec9794,
-    0xec9795,
-    0xec9796,
-    0xec9797,
-    0xec9798,
-    0xec9799,
-    0xec979a,
-    0xec979b,
-    0xec979c,
-    0xec979d,
-    0xec979e,
-    0xec979f,
-    0xec97a0,
-    0xec97a1,
-    0xec97a2,
-    0xec97a3,
-    0xec97a4,
-    0xec97a5,
-    0xec97a6,
-    0xec97a7,
-    0xec97a8,
-    0xec97a9,
-    0xec97aa,
-    0xec97ab,
-    0xec97ac,
-    0xec97ad,
-    0xec97ae,
-    0xec97af,
-    0xec97b0,
-    0xec97b1,
-    0xec97b2,
-    0xec97b3,
-    0xec97b4,
-    0xec97b5,
-    0xec97b6,
-    0xec97b7,
-    0xec97b8,
-    0xec97b9,
-    0xec97ba,
-    0xec97bb,
-    0xec97bc,
-    0xec97bd,
-    0xec97be,
-    0xec97bf,
-    0xec9880,
-    0xec9881,
-    0xec9882,
-    0xec9883,
-    0xec9884,
-    0xec9885,
-    0xec9886,
-    0xec9887,
-    0xec9888,
-    0xec9889,
-    0xec988a,
-    0xec988b,
-    0xec988c,
-    0xec988d,
-    0xec988e,
-    0xec988f,
-    0xec9890,
-    0xec9891,
-    0xec9892,
-    0xec9893,
-    0xec9894,
-    0xec9895,
-    0xec9896,
-    0xec9897,
-    0xec9898,
-    0xec9899,
-    0xec989a,
-    0xec989b,
-    0xec989c,
-    0xec989d,
-    0xec989e,
-    0xec989f,
-    0xec98a0,
-    0xec98a1,
-    0xec98a2,
-    0xec98a3,
-    0xec98a4,
-    0xec98a5,
-    0xec98a6,
-    0xec98a7,
-    0xec98a8,
-    0xec98a9,
-    0xec98aa,
-    0xec98ab,
-    0xec98ac,
-    0xec98ad,
-    0xec98ae,
-    0xec98af,
-    0xec98b0,
-    0xec98b1,
-    0xec98b2,
-    0xec98b3,
-    0xec98b4,
-    0xec98b5,
-    0xec98b6,
-    0xec98b7,
-    0xec98b8,
-    0xec98b9,
-    0xec98ba,
-    0xec98bb,
-    0xec98bc,
-    0xec98bd,
-    0xec98be,
-    0xec98bf,
-    0xec9980,
-    0xec9981,
-    0xec9982,
-    0xec9983,
-    0xec9984,
-    0xec9985,
-    0xec9986,
-    0xec9987,
-    0xec9988,
-    0xec9989,
-    0xec998a,
-    0xec998b,
-    0xec998c,
-    0xec998d,
-    0xec998e,
-    0xec998f,
-    0xec9990,
-    0xec9991,
-    0xec9992,
-    0xec9993,
-    0xec9994,
-    0xec9995,
-    0xec9996,
-    0xec9997,
-    0xec9998,
-    0xec9999,
-    0xec999a,
-    0xec999b,
-    0xec999c,
-    0xec999d,
-    0xec999e,
-    0xec999f,
-    0xec99a0,
-    0xec99a1,
-    0xec99a2,
-    0xec99a3,
-    0xec99a4,
-    0xec99a5,
-    0xec99a6,
-    0xec99a7,
-    0xec99a8,
-    0xec99a9,
-    0xec99aa,
-    0xec99ab,
-    0xec99ac,
-    0xec99ad,
-    0xec99ae,
-    0xec99af,
-    0xec99b0,
-    0xec99b1,
-    0xec99b2,
-    0xec99b3,
-    0xec99b4,
-    0xec99b5,
-    0xec99b6,
-    0xec99b7,
-    0xec99b8,
-    0xec99b9,
-    0xec99ba,
-    0xec99bb,
-    0xec99bc,
-    0xec99bd,
-    0xec99be,
-    0xec99bf,
-    0xec9a80,
-    0xec9a81,
-    0xec9a82,
-    0xec9a83,
-    0xec9a84,
-    0xec9a85,
-    0xec9a86,
-    0xec9a87,
-    0xec9a88,
-    0xec9a89,
-    0xec9a8a,
-    0xec9a8b,
-    0xec9a8c,
-    0xec9a8d,
-    0xec9a8e,
-    0xec9a8f,
-    0xec9a90,
-    0xec9a91,
-    0xec9a92,
-    0xec9a93,
-    0xec9a94,
-    0xec9a95,
-    0xec9a96,
-    0xec9a97,
-    0xec9a98,
-    0xec9a99,
-    0xec9a9a,
-    0xec9a9b,
-    0xec9a9c,
-    0xec9a9d,
-    0xec9a9e,
-    0xec9a9f,
-    0xec9aa0,
-    0xec9aa1,
-    0xec9aa2,
-    0xec9aa3,
-    0xec9aa4,
-    0xec9aa5,
-    0xec9aa6,
-    0xec9aa7,
-    0xec9aa8,
-    0xec9aa9,
-    0xec9aaa,
-    0xec9aab,
-    0xec9aac,
-    0xec9aad,
-    0xec9aae,
-    0xec9aaf,
-    0xec9ab0,
-    0xec9ab1,
-    0xec9ab2,
-    0xec9ab3,
-    0xec9ab4,
-    0xec9ab5,
-    0xec9ab6,
-    0xec9ab7,
-    0xec9ab8,
-    0xec9ab9,
-    0xec9aba,
-    0xec9abb,
-    0xec9abc,
-    0xec9abd,
-    0xec9abe,
-    0xec9abf,
-    0xec9b80,
-    0xec9b81,
-    0xec9b82,
-    0xec9b83,
-    0xec9b84,
-    0xec9b85,
-    0xec9b86,
-    0xec9b87,
-    0xec9b88,
-    0xec9b89,
-    0xec9b8a,
-    0xec9b8b,
-    0xec9b8c,
-    0xec9b8d,
-    0xec9b8e,
-    0xec9b8f,
-    0xec9b90,
-    0xec9b91,
-    0xec9b92,
-    0xec9b93,
-    0xec9b94,
-    0xec9b95,
-    0xec9b96,
-    0xec9b97,
-    0xec9b98,
-    0xec9b99,
-    0xec9b9a,
-    0xec9b9b,
-    0xec9b9c,
-    0xec9b9d,
-    0xec9b9e,
-    0xec9b9f,
-    0xec9ba0,
-    0xec9ba1,
-    0xec9ba2,
-    0xec9ba3,
-    0xec9ba4,
-    0xec9ba5,
-    0xec9ba6,
-    0xec9ba7,
-    0xec9ba8,
-    0xec9ba9,
-    0xec9baa,
-    0xec9bab,
-    0xec9bac,
-    0xec9bad,
-    0xec9bae,
-    0xec9baf,
-    0xec9bb0,
-    0xec9bb1,
-    0xec9bb2,
-    0xec9bb3,
-    0xec9bb4,
-    0xec9bb5,
-    0xec9bb6,
-    0xec9bb7,
-    0xec9bb8,
-    0xec9bb9,
-    0xec9bba,
-    0xec9bbb,
-    0xec9bbc,
-    0xec9bbd,
-    0xec9bbe,
-    0xec9bbf,
-    0xec9c80,
-    0xec9c81,
-    0xec9c82,
-    0xec9c83,
-    0xec9c84,
-    0xec9c85,
-    0xec9c86,
-    0xec9c87,
-    0xec9c88,
-    0xec9c89,
-    0xec9c8a,
-    0xec9c8b,
-    0xec9c8c,
-    0xec9c8d,
-    0xec9c8e,
-    0xec9c8f,
-    0xec9c90,
-    0xec9c91,
-    0xec9c92,
-    0xec9c93,
-    0xec9c94,
-    0xec9c95,
-    0xec9c96,
-    0xec9c97,
-    0xec9c98,
-    0xec9c99,
-    0xec9c9a,
-    0xec9c9b,
-    0xec9c9c,
-    0xec9c9d,
-    0xec9c9e,
-    0xec9c9f,
-    0xec9ca0,
-    0xec9ca1,
-    0xec9ca2,
-    0xec9ca3,
-    0xec9ca4,
-    0xec9ca5,
-    0xec9ca6,
-    0xec9ca7,
-    0xec9ca8,
-    0xec9ca9,
-    0xec9caa,
-    0xec9cab,
-    0xec9cac,
-    0xec9cad,
-    0xec9cae,
-    0xec9caf,
-    0xec9cb0,
-    0xec9cb1,
-    0xec9cb2,
-    0xec9cb3,
-    0xec9cb4,
-    0xec9cb5,
-    0xec9cb6,
-    0xec9cb7,
-    0xec9cb8,
-    0xec9cb9,
-    0xec9cba,
-    0xec9cbb,
-    0xec9cbc,
-    0xec9cbd,
-    0xec9cbe,
-    0xec9cbf,
-    0xec9d80,
-    0xec9d81,
-    0xec9d82,
-    0xec9d83,
-    0xec9d84,
-    0xec9d85,
-    0xec9d86,
-    0xec9d87,
-    0xec9d88,
-    0xec9d89,
-    0xec9d8a,
-    0xec9d8b,
-    0xec9d8c,
-    0xec9d8d,
-    0xec9d8e,
-    0xec9d8f,
-    0xec9d90,
-    0xec9d91,
-    0xec9d92,
-    0xec9d93,
-    0xec9d94,
-    0xec9d95,
-    0xec9d96,
-    0xec9d97,
-    0xec9d98,
-    0xec9d99,
-    0xec9d9a,
-    0xec9d9b,
-    0xec9d9c,
-    0xec9d9d,
-    0xec9d9e,
-    0xec9d9f,
-    0xec9da0,
-    0xec9da1,
-    0xec9da2,
-    0xec9da3,
-    0xec9da4,
-    0xec9da5,
-    0xec9da6,
-    0xec9da7,
-    0xec9da8,
-    0xec9da9,
-    0xec9daa,
-    0xec9dab,
-    0xec9dac,
-    0xec9dad,
-    0xec9dae,
-    0xec9daf,
-    0xec9db0,
-    0xec9db1,
-    0xec9db2,
-    0xec9db3,
-    0xec9db4,
-    0xec9db5,
-    0xec9db6,
-    0xec9db7,
-    0xec9db8,
-    0xec9db9,
-    0xec9dba,
-    0xec9dbb,
-    0xec9dbc,
-    0xec9dbd,
-    0xec9dbe,
-    0xec9dbf,
-    0xec9e80,
-    0xec9e81,
-    0xec9e82,
-    0xec9e83,
-    0xec9e84,
-    0xec9e85,
-    0xec9e86,
-    0xec9e87,
-    0xec9e88,
-    0xec9e89,
-    0xec9e8a,
-    0xec9e8b,
-    0xec9e8c,
-    0xec9e8d,
-    0xec9e8e,
-    0xec9e8f,
-    0xec9e90,
-    0xec9e91,
-    0xec9e92,
-    0xec9e93,
-    0xec9e94,
-    0xec9e95,
-    0xec9e96,
-    0xec9e97,
-    0xec9e98,
-    0xec9e99,
-    0xec9e9a,
-    0xec9e9b,
-    0xec9e9c,
-    0xec9e9d,
-    0xec9e9e,
-    0xec9e9f,
-    0xec9ea0,
-    0xec9ea1,
-    0xec9ea2,
-    0xec9ea3,
-    0xec9ea4,
-    0xec9ea5,
-    0xec9ea6,
-    0xec9ea7,
-    0xec9ea8,
-    0xec9ea9,
-    0xec9eaa,
-    0xec9eab,
-    0xec9eac,
-    0xec9ead,
-    0xec9eae,
-    0xec9eaf,
-    0xec9eb0,
-    0xec9eb1,
-    0xec9eb2,
-    0xec9eb3,
-    0xec9eb4,
-    0xec9eb5,
-    0xec9eb6,
-    0xec9eb7,
-    0xec9eb8,
-    0xec9eb9,
-    0xec9eba,
-    0xec9ebb,
-    0xec9ebc,
-    0xec9ebd,
-    0xec9ebe,
-    0xec9ebf,
-    0xec9f80,
-    0xec9f81,
-    0xec9f82,
-    0xec9f83,
-    0xec9f84,
-    0xec9f85,
-    0xec9f86,
-    0xec9f87,
-    0xec9f88,
-    0xec9f89,
-    0xec9f8a,
-    0xec9f8b,
-    0xec9f8c,
-    0xec9f8d,
-    0xec9f8e,
-    0xec9f8f,
-    0xec9f90,
-    0xec9f91,
-    0xec9f92,
-    0xec9f93,
-    0xec9f94,
-    0xec9f95,
-    0xec9f96,
-    0xec9f97,
-    0xec9f98,
-    0xec9f99,
-    0xec9f9a,
-    0xec9f9b,
-    0xec9f9c,
-    0xec9f9d,
-    0xec9f9e,
-    0xec9f9f,
-    0xec9fa0,
-    0xec9fa1,
-    0xec9fa2,
-    0xec9fa3,
-    0xec9fa4,
-    0xec9fa5,
-    0xec9fa6,
-    0xec9fa7,
-    0xec9fa8,
-    0xec9fa9,
-    0xec9faa,
-    0xec9fab,
-    0xec9fac,
-    0xec9fad,
-    0xec9fae,
-    0xec9faf,
-    0xec9fb0,
-    0xec9fb1,
-    0xec9fb2,
-    0xec9fb3,
-    0xec9fb4,
-    0xec9fb5,
-    0xec9fb6,
-    0xec9fb7,
-    0xec9fb8,
-    0xec9fb9,
-    0xec9fba,
-    0xec9fbb,
-    0xec9fbc,
-    0xec9fbd,
-    0xec9fbe,
-    0xec9fbf,
-    0xeca080,
-    0xeca081,
-    0xeca082,
-    0xeca083,
-    0xeca084,
-    0xeca085,
-    0xeca086,
-    0xeca087,
-    0xeca088,
-    0xeca089,
-    0xeca08a,
-    0xeca08b,
-    0xeca08c,
-    0xeca08d,
-    0xeca08e,
-    0xeca08f,
-    0xeca090,
-    0xeca091,
-    0xeca092,
-    0xeca093,
-    0xeca094,
-    0xeca095,
-    0xeca096,
-    0xeca097,
-    0xeca098,
-    0xeca099,
-    0xeca09a,
-    0xeca09b,
-    0xeca09c,
-    0xeca09d,
-    0xeca09e,
-    0xeca09f,
-    0xeca0a0,
-    0xeca0a1,
-    0xeca0a2,
-    0xeca0a3,
-    0xeca0a4,
-    0xeca0a5,
-    0xeca0a6,
-    0xeca0a7,
-    0xeca0a8,
-    0xeca0a9,
-    0xeca0aa,
-    0xeca0ab,
-    0xeca0ac,
-    0xeca0ad,
-    0xeca0ae,
-    0xeca0af,
-    0xeca0b0,
-    0xeca0b1,
-    0xeca0b2,
-    0xeca0b3,
-    0xeca0b4,
-    0xeca0b5,
-    0xeca0b6,
-    0xeca0b7,
-    0xeca0b8,
-    0xeca0b9,
-    0xeca0ba,
-    0xeca0bb,
-    0xeca0bc,
-    0xeca0bd,
-    0xeca0be,
-    0xeca0bf,
-    0xeca180,
-    0xeca181,
-    0xeca182,
-    0xeca183,
-    0xeca184,
-    0xeca185,
-    0xeca186,
-    0xeca187,
-    0xeca188,
-    0xeca189,
-    0xeca18a,
-    0xeca18b,
-    0xeca18c,
-    0xeca18d,
-    0xeca18e,
-    0xeca18f,
-    0xeca190,
-    0xeca191,
-    0xeca192,
-    0xeca193,
-    0xeca194,
-    0xeca195,
-    0xeca196,
-    0xeca197,
-    0xeca198,
-    0xeca199,
-    0xeca19a,
-    0xeca19b,
-    0xeca19c,
-    0xeca19d,
-    0xeca19e,
-    0xeca19f,
-    0xeca1a0,
-    0xeca1a1,
-    0xeca1a2,
-    0xeca1a3,
-    0xeca1a4,
-    0xeca1a5,
-    0xeca1a6,
-    0xeca1a7,
-    0xeca1a8,
-    0xeca1a9,
-    0xeca1aa,
-    0xeca1ab,
-    0xeca1ac,
-    0xeca1ad,
-    0xeca1ae,
-    0xeca1af,
-    0xeca1b0,
-    0xeca1b1,
-    0xeca1b2,
-    0xeca1b3,
-    0xeca1b4,
-    0xeca1b5,
-    0xeca1b6,
-    0xeca1b7,
-    0xeca1b8,
-    0xeca1b9,
-    0xeca1ba,
-    0xeca1bb,
-    0xeca1bc,
-    0xeca1bd,
-    0xeca1be,
-    0xeca1bf,
-    0xeca280,
-    0xeca281,
-    0xeca282,
-    0xeca283,
-    0xeca284,
-    0xeca285,
-    0xeca286,
-    0xeca287,
-    0xeca288,
-    0xeca289,
-    0xeca28a,
-    0xeca28b,
-    0xeca28c,
-    0xeca28d,
-    0xeca28e,
-    0xeca28f,
-    0xeca290,
-    0xeca291,
-    0xeca292,
-    0xeca293,
-    0xeca294,
-    0xeca295,
-    0xeca296,
-    0xeca297,
-    0xeca298,
-    0xeca299,
-    0xeca29a,
-    0xeca29b,
-    0xeca29c,
-    0xeca29d,
-    0xeca29e,
-    0xeca29f,
-    0xeca2a0,
-    0xeca2a1,
-    0xeca2a2,
-    0xeca2a3,
-    0xeca2a4,
-    0xeca2a5,
-    0xeca2a6,
-    0xeca2a7,
-    0xeca2a8,
-    0xeca2a9,
-    0xeca2aa,
-    0xeca2ab,
-    0xeca2ac,
-    0xeca2ad,
-    0xeca2ae,
-    0xeca2af,
-    0xeca2b0,
-    0xeca2b1,
-    0xeca2b2,
-    0xeca2b3,
-    0xeca2b4,
-    0xeca2b5,
-    0xeca2b6,
-    0xeca2b7,
-    0xeca2b8,
-    0xeca2b9,
-    0xeca2ba,
-    0xeca2bb,
-    0xeca2bc,
-    0xeca2bd,
-    0xeca2be,
-    0xeca2bf,
-    0xeca380,
-    0xeca381,
-    0xeca382,
-    0xeca383,
-    0xeca384,
-    0xeca385,
-    0xeca386,
-    0xeca387,
-    0xeca388,
-    0xeca389,
-    0xeca38a,
-    0xeca38b,
-    0xeca38c,
-    0xeca38d,
-    0xeca38e,
-    0xeca38f,
-    0xeca390,
-    0xeca391,
-    0xeca392,
-    0xeca393,
-    0xeca394,
-    0xeca395,
-    0xeca396,
-    0xeca397,
-    0xeca398,
-    0xeca399,
-    0xeca39a,
-    0xeca39b,
-    0xeca39c,
-    0xeca39d,
-    0xeca39e,
-    0xeca39f,
-    0xeca3a0,
-    0xeca3a1,
-    0xeca3a2,
-    0xeca3a3,
-    0xeca3a4,
-    0xeca3a5,
-    0xeca3a6,
-    0xeca3a7,
-    0xeca3a8,
-    0xeca3a9,
-    0xeca3aa,
-    0xeca3ab,
-    0xeca3ac,
-    0xeca3ad,
-    0xeca3ae,
-    0xeca3af,
-    0xeca3b0,
-    0xeca3b1,
-    0xeca3b2,
-    0xeca3b3,
-    0xeca3b4,
-    0xeca3b5,
-    0xeca3b6,
-    0xeca3b7,
-    0xeca3b8,
-    0xeca3b9,
-    0xeca3ba,
-    0xeca3bb,
-    0xeca3bc,
-    0xeca3bd,
-    0xeca3be,
-    0xeca3bf,
-    0xeca480,
-    0xeca481,
-    0xeca482,
-    0xeca483,
-    0xeca484,
-    0xeca485,
-    0xeca486,
-    0xeca487,
-    0xeca488,
-    0xeca489,
-    0xeca48a,
-    0xeca48b,
-    0xeca48c,
-    0xeca48d,
-    0xeca48e,
-    0xeca48f,
-    0xeca490,
-    0xeca491,
-    0xeca492,
-    0xeca493,
-    0xeca494,
-    0xeca495,
-    0xeca496,
-    0xeca497,
-    0xeca498,
-    0xeca499,
-    0xeca49a,
-    0xeca49b,
-    0xeca49c,
-    0xeca49d,
-    0xeca49e,
-    0xeca49f,
-    0xeca4a0,
-    0xeca4a1,
-    0xeca4a2,
-    0xeca4a3,
-    0xeca4a4,
-    0xeca4a5,
-    0xeca4a6,
-    0xeca4a7,
-    0xeca4a8,
-    0xeca4a9,
-    0xeca4aa,
-    0xeca4ab,
-    0xeca4ac,
-    0xeca4ad,
-    0xeca4ae,
-    0xeca4af,
-    0xeca4b0,
-    0xeca4b1,
-    0xeca4b2,
-    0xeca4b3,
-    0xeca4b4,
-    0xeca4b5,
-    0xeca4b6,
-    0xeca4b7,
-    0xeca4b8,
-    0xeca4b9,
-    0xeca4ba,
-    0xeca4bb,
-    0xeca4bc,
-    0xeca4bd,
-    0xeca4be,
-    0xeca4bf,
-    0xeca580,
-    0xeca581,
-    0xeca582,
-    0xeca583,
-    0xeca584,
-    0xeca585,
-    0xeca586,
-    0xeca587,
-    0xeca588,
-    0xeca589,
-    0xeca58a,
-    0xeca58b,
-    0xeca58c,
-    0xeca58d,
-    0xeca58e,
-    0xeca58f,
-    0xeca590,
-    0xeca591,
-    0xeca592,
-    0xeca593,
-    0xeca594,
-    0xeca595,
-    0xeca596,
-    0xeca597,
-    0xeca598,
-    0xeca599,
-    0xeca59a,
-    0xeca59b,
-    0xeca59c,
-    0xeca59d,
-    0xeca59e,
-    0xeca59f,
-    0xeca5a0,
-    0xeca5a1,
-    0xeca5a2,
-    0xeca5a3,
-    0xeca5a4,
-    0xeca5a5,
-    0xeca5a6,
-    0xeca5a7,
-    0xeca5a8,
-    0xeca5a9,
-    0xeca5aa,
-    0xeca5ab,
-    0xeca5ac,
-    0xeca5ad,
-    0xeca5ae,
-    0xeca5af,
-    0xeca5b0,
-    0xeca5b1,
-    0xeca5b2,
-    0xeca5b3,
-    0xeca5b4,
-    0xeca5b5,
-    0xeca5b6,
-    0xeca5b7,
-    0xeca5b8,
-    0xeca5b9,
-    0xeca5ba,
-    0xeca5bb,
-    0xeca5bc,
-    0xeca5bd,
-    0xeca5be,
-    0xeca5bf,
-    0xeca680,
-    0xeca681,
-    0xeca682,
-    0xeca683,
-    0xeca684,
-    0xeca685,
-    0xeca686,
-    0xeca687,
-    0xeca688,
-    0xeca689,
-    0xeca68a,
-    0xeca68b,
-    0xeca68c,
-    0xeca68d,
-    0xeca68e,
-    0xeca68f,
-    0xeca690,
-    0xeca691,
-    0xeca692,
-    0xeca693,
-    0xeca694,
-    0xeca695,
-    0xeca696,
-    0xeca697,
-    0xeca698,
-    0xeca699,
-    0xeca69a,
-    0xeca69b,
-    0xeca69c,
-    0xeca69d,
-    0xeca69e,
-    0xeca69f,
-    0xeca6a0,
-    0xeca6a1,
-    0xeca6a2,
-    0xeca6a3,
-    0xeca6a4,
-    0xeca6a5,
-    0xeca6a6,
-    0xeca6a7,
-    0xeca6a8,
-    0xeca6a9,
-    0xeca6aa,
-    0xeca6ab,
-    0xeca6ac,
-    0xeca6ad,
-    0xeca6ae,
-    0xeca6af,
-    0xeca6b0,
-    0xeca6b1,
-    0xeca6b2,
-    0xeca6b3,
-    0xeca6b4,
-    0xeca6b5,
-    0xeca6b6,
-    0xeca6b7,
-    0xeca6b8,
-    0xeca6b9,
-    0xeca6ba,
-    0xeca6bb,
-    0xeca6bc,
-    0xeca6bd,
-    0xeca6be,
-    0xeca6bf,
-    0xeca780,
-    0xeca781,
-    0xeca782,
-    0xeca783,
-    0xeca784,
-    0xeca785,
-    0xeca786,
-    0xeca787,
-    0xeca788,
-    0xeca789,
-    0xeca78a,
-    0xeca78b,
-    0xeca78c,
-    0xeca78d,
-    0xeca78e,
-    0xeca78f,
-    0xeca790,
-    0xeca791,
-    0xeca792,
-    0xeca793,
-    0xeca794,
-    0xeca795,
-    0xeca796,
-    0xeca797,
-    0xeca798,
-    0xeca799,
-    0xeca79a,
-    0xeca79b,
-    0xeca79c,
-    0xeca79d,
-    0xeca79e,
-    0xeca79f,
-    0xeca7a0,
-    0xeca7a1,
-    0xeca7a2,
-    0xeca7a3,
-    0xeca7a4,
-    0xeca7a5,
-    0xeca7a6,
-    0xeca7a7,
-    0xeca7a8,
-    0xeca7a9,
-    0xeca7aa,
-    0xeca7ab,
-    0xeca7ac,
-    0xeca7ad,
-    0xeca7ae,
-    0xeca7af,
-    0xeca7b0,
-    0xeca7b1,
-    0xeca7b2,
-    0xeca7b3,
-    0xeca7b4,
-    0xeca7b5,
-    0xeca7b6,
-    0xeca7b7,
-    0xeca7b8,
-    0xeca7b9,
-    0xeca7ba,
-    0xeca7bb,
-    0xeca7bc,
-    0xeca7bd,
-    0xeca7be,
-    0xeca7bf,
-    0xeca880,
-    0xeca881,
-    0xeca882,
-    0xeca883,
-    0xeca884,
-    0xeca885,
-    0xeca886,
-    0xeca887,
-    0xeca888,
-    0xeca889,
-    0xeca88a,
-    0xeca88b,
-    0xeca88c,
-    0xeca88d,
-    0xeca88e,
-    0xeca88f,
-    0xeca890,
-    0xeca891,
-    0xeca892,
-    0xeca893,
-    0xeca894,
-    0xeca895,
-    0xeca896,
-    0xeca897,
-    0xeca898,
-    0xeca899,
-    0xeca89a,
-    0xeca89b,
-    0xeca89c,
-    0xeca89d,
-    0xeca89e,
-    0xeca89f,
-    0xeca8a0,
-    0xeca8a1,
-    0xeca8a2,
-    0xeca8a3,
-    0xeca8a4,
-    0xeca8a5,
-    0xeca8a6,
-    0xeca8a7,
-    0xeca8a8,
-    0xeca8a9,
-    0xeca8aa,
-    0xeca8ab,
-    0xeca8ac,
-    0xeca8ad,
-    0xeca8ae,
-    0xeca8af,
-    0xeca8b0,
-    0xeca8b1,
-    0xeca8b2,
-    0xeca8b3,
-    0xeca8b4,
-    0xeca8b5,
-    0xeca8b6,
-    0xeca8b7,
-    0xeca8b8,
-    0xeca8b9,
-    0xeca8ba,
-    0xeca8bb,
-    0xeca8bc,
-    0xeca8bd,
-    0xeca8be,
-    0xeca8bf,
-    0xeca980,
-    0xeca981,
-    0xeca982,
-    0xeca983,
-    0xeca984,
-    0xeca985,
-    0xeca986,
-    0xeca987,
-    0xeca988,
-    0xeca989,
-    0xeca98a,
-    0xeca98b,
-    0xeca98c,
-    0xeca98d,
-    0xeca98e,
-    0xeca98f,
-    0xeca990,
-    0xeca991,
-    0xeca992,
-    0xeca993,
-    0xeca994,
-    0xeca995,
-    0xeca996,
-    0xeca997,
-    0xeca998,
-    0xeca999,
-    0xeca99a,
-    0xeca99b,
-    0xeca99c,
-    0xeca99d,
-    0xeca99e,
-    0xeca99f,
-    0xeca9a0,
-    0xeca9a1,
-    0xeca9a2,
-    0xeca9a3,
-    0xeca9a4,
-    0xeca9a5,
-    0xeca9a6,
-    0xeca9a7,
-    0xeca9a8,
-    0xeca9a9,
-    0xeca9aa,
-    0xeca9ab,
-    0xeca9ac,
-    0xeca9ad,
-    0xeca9ae,
-    0xeca9af,
-    0xeca9b0,
-    0xeca9b1,
-    0xeca9b2,
-    0xeca9b3,
-    0xeca9b4,
-    0xeca9b5,
-    0xeca9b6,
-    0xeca9b7,
-    0xeca9b8,
-    0xeca9b9,
-    0xeca9ba,
-    0xeca9bb,
-    0xeca9bc,
-    0xeca9bd,
-    0xeca9be,
-    0xeca9bf,
-    0xecaa80,
-    0xecaa81,
-    0xecaa82,
-    0xecaa83,
-    0xecaa84,
-    0xecaa85,
-    0xecaa86,
-    0xecaa87,
-    0xecaa88,
-    0xecaa89,
-    0xecaa8a,
-    0xecaa8b,
-    0xecaa8c,
-    0xecaa8d,
-    0xecaa8e,
-    0xecaa8f,
-    0xecaa90,
-    0xecaa91,
-    0xecaa92,
-    0xecaa93,
-    0xecaa94,
-    0xecaa95,
-    0xecaa96,
-    0xecaa97,
-    0xecaa98,
-    0xecaa99,
-    0xecaa9a,
-    0xecaa9b,
-    0xecaa9c,
-    0xecaa9d,
-    0xecaa9e,
-    0xecaa9f,
-    0xecaaa0,
-    0xecaaa1,
-    0xecaaa2,
-    0xecaaa3,
-    0xecaaa4,
-    0xecaaa5,
-    0xecaaa6,
-    0xecaaa7,
-    0xecaaa8,
-    0xecaaa9,
-    0xecaaaa,
-    0xecaaab,
-    0xecaaac,
-    0xecaaad,
-    0xecaaae,
-    0xecaaaf,
-    0xecaab0,
-    0xecaab1,
-    0xecaab2,
-    0xecaab3,
-    0xecaab4,
-    0xecaab5,
-    0xecaab6,
-    0xecaab7,
-    0xecaab8,
-    0xecaab9,
-    0xecaaba,
-    0xecaabb,
-    0xecaabc,
-    0xecaabd,
-    0xecaabe,
-    0xecaabf,
-    0xecab80,
-    0xecab81,
-    0xecab82,
-    0xecab83,
-    0xecab84,
-    0xecab85,
-    0xecab86,
-    0xecab87,
-    0xecab88,
-    0xecab89,
-    0xecab8a,
-    0xecab8b,
-    0xecab8c,
-    0xecab8d,
-    0xecab8e,
-    0xecab8f,
-    0xecab90,
-    0xecab91,
-    0xecab92,
-    0xecab93,
-    0xecab94,
-    0xecab95,
-    0xecab96,
-    0xecab97,
-    0xecab98,
-    0xecab99,
-    0xecab9a,
-    0xecab9b,
-    0xecab9c,
-    0xecab9d,
-    0xecab9e,
-    0xecab9f,
-    0xecaba0,
-    0xecaba1,
-    0xecaba2,
-    0xecaba3,
-    0xecaba4,
-    0xecaba5,
-    0xecaba6,
-    0xecaba7,
-    0xecaba8,
-    0xecaba9,
-    0xecabaa,
-    0xecabab,
-    0xecabac,
-    0xecabad,
-    0xecabae,
-    0xecabaf,
-    0xecabb0,
-    0xecabb1,
-    0xecabb2,
-    0xecabb3,
-    0xecabb4,
-    0xecabb5,
-    0xecabb6,
-    0xecabb7,
-    0xecabb8,
-    0xecabb9,
-    0xecabba,
-    0xecabbb,
-    0xecabbc,
-    0xecabbd,
-    0xecabbe,
-    0xecabbf,
-    0xecac80,
-    0xecac81,
-    0xecac82,
-    0xecac83,
-    0xecac84,
-    0xecac85,
-    0xecac86,
-    0xecac87,
-    0xecac88,
-    0xecac89,
-    0xecac8a,
-    0xecac8b,
-    0xecac8c,
-    0xecac8d,
-    0xecac8e,
-    0xecac8f,
-    0xecac90,
-    0xecac91,
-    0xecac92,
-    0xecac93,
-    0xecac94,
-    0xecac95,
-    0xecac96,
-    0xecac97,
-    0xecac98,
-    0xecac99,
-    0xecac9a,
-    0xecac9b,
-    0xecac9c,
-    0xecac9d,
-    0xecac9e,
-    0xecac9f,
-    0xecaca0,
-    0xecaca1,
-    0xecaca2,
-    0xecaca3,
-    0xecaca4,
-    0xecaca5,
-    0xecaca6,
-    0xecaca7,
-    0xecaca8,
-    0xecaca9,
-    0xecacaa,
-    0xecacab,
-    0xecacac,
-    0xecacad,
-    0xecacae,
-    0xecacaf,
-    0xecacb0,
-    0xecacb1,
-    0xecacb2,
-    0xecacb3,
-    0xecacb4,
-    0xecacb5,
-    0xecacb6,
-    0xecacb7,
-    0xecacb8,
-    0xecacb9,
-    0xecacba,
-    0xecacbb,
-    0xecacbc,
-    0xecacbd,
-    0xecacbe,
-    0xecacbf,
-    0xecad80,
-    0xecad81,
-    0xecad82,
-    0xecad83,
-    0xecad84,
-    0xecad85,
-    0xecad86,
-    0xecad87,
-    0xecad88,
-    0xecad89,
-    0xecad8a,
-    0xecad8b,
-    0xecad8c,
-    0xecad8d,
-    0xecad8e,
-    0xecad8f,
-    0xecad90,
-    0xecad91,
-    0xecad92,
-    0xecad93,
-    0xecad94,
-    0xecad95,
-    0xecad96,
-    0xecad97,
-    0xecad98,
-    0xecad99,
-    0xecad9a,
-    0xecad9b,
-    0xecad9c,
-    0xecad9d,
-    0xecad9e,
-    0xecad9f,
-    0xecada0,
-    0xecada1,
-    0xecada2,
-    0xecada3,
-    0xecada4,
-    0xecada5,
-    0xecada6,
-    0xecada7,
-    0xecada8,
-    0xecada9,
-    0xecadaa,
-    0xecadab,
-    0xecadac,
-    0xecadad,
-    0xecadae,
-    0xecadaf,
-    0xecadb0,
-    0xecadb1,
-    0xecadb2,
-    0xecadb3,
-    0xecadb4,
-    0xecadb5,
-    0xecadb6,
-    0xecadb7,
-    0xecadb8,
-    0xecadb9,
-    0xecadba,
-    0xecadbb,
-    0xecadbc,
-    0xecadbd,
-    0xecadbe,
-    0xecadbf,
-    0xecae80,
-    0xecae81,
-    0xecae82,
-    0xecae83,
-    0xecae84,
-    0xecae85,
-    0xecae86,
-    0xecae87,
-    0xecae88,
-    0xecae89,
-    0xecae8a,
-    0xecae8b,
-    0xecae8c,
-    0xecae8d,
-    0xecae8e,
-    0xecae8f,
-    0xecae90,
-    0xecae91,
-    0xecae92,
-    0xecae93,
-    0xecae94,
-    0xecae95,
-    0xecae96,
-    0xecae97,
-    0xecae98,
-    0xecae99,
-    0xecae9a,
-    0xecae9b,
-    0xecae9c,
-    0xecae9d,
-    0xecae9e,
-    0xecae9f,
-    0xecaea0,
-    0xecaea1,
-    0xecaea2,
-    0xecaea3,
-    0xecaea4,
-    0xecaea5,
-    0xecaea6,
-    0xecaea7,
-    0xecaea8,
-    0xecaea9,
-    0xecaeaa,
-    0xecaeab,
-    0xecaeac,
-    0xecaead,
-    0xecaeae,
-    0xecaeaf,
-    0xecaeb0,
-    0xecaeb1,
-    0xecaeb2,
-    0xecaeb3,
-    0xecaeb4,
-    0xecaeb5,
-    0xecaeb6,
-    0xecaeb7,
-    0xecaeb8,
-    0xecaeb9,
-    0xecaeba,
-    0xecaebb,
-    0xecaebc,
-    0xecaebd,
-    0xecaebe,
-    0xecaebf,
-    0xecaf80,
-    0xecaf81,
-    0xecaf82,
-    0xecaf83,
-    0xecaf84,
-    0xecaf85,
-    0xecaf86,
-    0xecaf87,
-    0xecaf88,
-    0xecaf89,
-    0xecaf8a,
-    0xecaf8b,
-    0xecaf8c,
-    0xecaf8d,
-    0xecaf8e,
-    0xecaf8f,
-    0xecaf90,
-    0xecaf91,
-    0xecaf92,
-    0xecaf93,
-    0xecaf94,
-    0xecaf95,
-    0xecaf96,
-    0xecaf97,
-    0xecaf98,
-    0xecaf99,
-    0xecaf9a,
-    0xecaf9b,
-    0xecaf9c,
-    0xecaf9d,
-    0xecaf9e,
-    0xecaf9f,
-    0xecafa0,
-    0xecafa1,
-    0xecafa2,
-    0xecafa3,
-    0xecafa4,
-    0xecafa5,
-    0xecafa6,
-    0xecafa7,
-    0xecafa8,
-    0xecafa9,
-    0xecafaa,
-    0xecafab,
-    0xecafac,
-    0xecafad,
-    0xecafae,
-    0xecafaf,
-    0xecafb0,
-    0xecafb1,
-    0xecafb2,
-    0xecafb3,
-    0xecafb4,
-    0xecafb5,
-    0xecafb6,
-    0xecafb7,
-    0xecafb8,
-    0xecafb9,
-    0xecafba,
-    0xecafbb,
-    0xecafbc,
-    0xecafbd,
-    0xecafbe,
-    0xecafbf,
-    0xecb080,
-    0xecb081,
-    0xecb082,
-    0xecb083,
-    0xecb084,
-    0xecb085,
-    0xecb086,
-    0xecb087,
-    0xecb088,
-    0xecb089,
-    0xecb08a,
-    0xecb08b,
-    0xecb08c,
-    0xecb08d,
-    0xecb08e,
-    0xecb08f,
-    0xecb090,
-    0xecb091,
-    0xecb092,
-    0xecb093,
-    0xecb094,
-    0xecb095,
-    0xecb096,
-    0xecb097,
-    0xecb098,
-    0xecb099,
-    0xecb09a,
-    0xecb09b,
-    0xecb09c,
-    0xecb09d,
-    0xecb09e,
-    0xecb09f,
-    0xecb0a0,
-    0xecb0a1,
-    0xecb0a2,
-    0xecb0a3,
-    0xecb0a4,
-    0xecb0a5,
-    0xecb0a6,
-    0xecb0a7,
-    0xecb0a8,
-    0xecb0a9,
-    0xecb0aa,
-    0xecb0ab,
-    0xecb0ac,
-    0xecb0ad,
-    0xecb0ae,
-    0xecb0af,
-    0xecb0b0,
-    0xecb0b1,
-    0xecb0b2,
-    0xecb0b3,
-    0xecb0b4,
-    0xecb0b5,
-    0xecb0b6,
-    0xecb0b7,
-    0xecb0b8,
-    0xecb0b9,
-    0xecb0ba,
-    0xecb0bb,
-    0xecb0bc,
-    0xecb0bd,
-    0xecb0be,
-    0xecb0bf,
-    0xecb180,
-    0xecb181,
-    0xecb182,
-    0xecb183,
-    0xecb184,
-    0xecb185,
-    0xecb186,
-    0xecb187,
-    0xecb188,
-    0xecb189,
-    0xecb18a,
-    0xecb18b,
-    0xecb18c,
-    0xecb18d,
-    0xecb18e,
-    0xecb18f,
-    0xecb190,
-    0xecb191,
-    0xecb192,
-    0xecb193,
-    0xecb194,
-    0xecb195,
-    0xecb196,
-    0xecb197,
-    0xecb198,
-    0xecb199,
-    0xecb19a,
-    0xecb19b,
-    0xecb19c,
-    0xecb19d,
-    0xecb19e,
-    0xecb19f,
-    0xecb1a0,
-    0xecb1a1,
-    0xecb1a2,
-    0xecb1a3,
-    0xecb1a4,
-    0xecb1a5,
-    0xecb1a6,
-    0xecb1a7,
-    0xecb1a8,
-    0xecb1a9,
-    0xecb1aa,
-    0xecb1ab,
-    0xecb1ac,
-    0xecb1ad,
-    0xecb1ae,
-    0xecb1af,
-    0xecb1b0,
-    0xecb1b1,
-    0xecb1b2,
-    0xecb1b3,
-    0xecb1b4,
-    0xecb1b5,
-    0xecb1b6,
-    0xecb1b7,
-    0xecb1b8,
-    0xecb1b9,
-    0xecb1ba,
-    0xecb1bb,
-    0xecb1bc,
-    0xecb1bd,
-    0xecb1be,
-    0xecb1bf,
-    0xecb280,
-    0xecb281,
-    0xecb282,
-    0xecb283,
-    0xecb284,
-    0xecb285,
-    0xecb286,
-    0xecb287,
-    0xecb288,
-    0xecb289,
-    0xecb28a,
-    0xecb28b,
-    0xecb28c,
-    0xecb28d,
-    0xecb28e,
-    0xecb28f,
-    0xecb290,
-    0xecb291,
-    0xecb292,
-    0xecb293,
-    0xecb294,
-    0xecb295,
-    0xecb296,
-    0xecb297,
-    0xecb298,
-    0xecb299,
-    0xecb29a,
-    0xecb29b,
-    0xecb29c,
-    0xecb29d,
-    0xecb29e,
-    0xecb29f,
-    0xecb2a0,
-    0xecb2a1,
-    0xecb2a2,
-    0xecb2a3,
-    0xecb2a4,
-    0xecb2a5,
-    0xecb2a6,
-    0xecb2a7,
-    0xecb2a8,
-    0xecb2a9,
-    0xecb2aa,
-    0xecb2ab,
-    0xecb2ac,
-    0xecb2ad,
-    0xecb2ae,
-    0xecb2af,
-    0xecb2b0,
-    0xecb2b1,
-    0xecb2b2,
-    0xecb2b3,
-    0xecb2b4,
-    0xecb2b5,
-    0xecb2b6,
-    0xecb2b7,
-    0xecb2b8,
-    0xecb2b9,
-    0xecb2ba,
-    0xecb2bb,
-    0xecb2bc,
-    0xecb2bd,
-    0xecb2be,
-    0xecb2bf,
-    0xecb380,
-    0xecb381,
-    0xecb382,
-    0xecb383,
-    0xecb384,
-    0xecb385,
-    0xecb386,
-    0xecb387,
-    0xecb388,
-    0xecb389,
-    0xecb38a,
-    0xecb38b,
-    0xecb38c,
-    0xecb38d,
-    0xecb38e,
-    0xecb38f,
-    0xecb390,
-    0xecb391,
-    0xecb392,
-    0xecb393,
-    0xecb394,
-    0xecb395,
-    0xecb396,
-    0xecb397,
-    0xecb398,
-    0xecb399,
-    0xecb39a,
-    0xecb39b,
-    0xecb39c,
-    0xecb39d,
-    0xecb39e,
-    0xecb39f,
-    0xecb3a0,
-    0xecb3a1,
-    0xecb3a2,
-    0xecb3a3,
-    0xecb3a4,
-    0xecb3a5,
-    0xecb3a6,
-    0xecb3a7,
-    0xecb3a8,
-    0xecb3a9,
-    0xecb3aa,
-    0xecb3ab,
-    0xecb3ac,
-    0xecb3ad,
-    0xecb3ae,
-    0xecb3af,
-    0xecb3b0,
-    0xecb3b1,
-    0xecb3b2,
-    0xecb3b3,
-    0xecb3b4,
-    0xecb3b5,
-    0xecb3b6,
-    0xecb3b7,
-    0xecb3b8,
-    0xecb3b9,
-    0xecb3ba,
-    0xecb3bb,
-    0xecb3bc,
-    0xecb3bd,
-    0xecb3be,
-    0xecb3bf,
-    0xecb480,
-    0xecb481,
-    0xecb482,
-    0xecb483,
-    0xecb484,
-    0xecb485,
-    0xecb486,
-    0xecb487,
-    0xecb488,
-    0xecb489,
-    0xecb48a,
-    0xecb48b,
-    0xecb48c,
-    0xecb48d,
-    0xecb48e,
-    0xecb48f,
-    0xecb490,
-    0xecb491,
-    0xecb492,
-    0xecb493,
-    0xecb494,
-    0xecb495,
-    0xecb496,
-    0xecb497,
-    0xecb498,
-    0xecb499,
-    0xecb49a,
-    0xecb49b,
-    0xecb49c,
-    0xecb49d,
-    0xecb49e,
-    0xecb49f,
-    0xecb4a0,
-    0xecb4a1,
-    0xecb4a2,
-    0xecb4a3,
-    0xecb4a4,
-    0xecb4a5,
-    0xecb4a6,
-    0xecb4a7,
-    0xecb4a8,
-    0xecb4a9,
-    0xecb4aa,
-    0xecb4ab,
-    0xecb4ac,
-    0xecb4ad,
-    0xecb4ae,
-    0xecb4af,
-    0xecb4b0,
-    0xecb4b1,
-    0xecb4b2,
-    0xecb4b3,
-    0xecb4b4,
-    0xecb4b5,
-    0xecb4b6,
-    0xecb4b7,
-    0xecb4b8,
-    0xecb4b9,
-    0xecb4ba,
-    0xecb4bb,
-    0xecb4bc,
-    0xecb4bd,
-    0xecb4be,
-    0xecb4bf,
-    0xecb580,
-    0xecb581,
-    0xecb582,
-    0xecb583,
-    0xecb584,
-    0xecb585,
-    0xecb586,
-    0xecb587,
-    0xecb588,
-    0xecb589,
-    0xecb58a,
-    0xecb58b,
-    0xecb58c,
-    0xecb58d,
-    0xecb58e,
-    0xecb58f,
-    0xecb590,
-    0xecb591,
-    0xecb592,
-    0xecb593,
-    0xecb594,
-    0xecb595,
-    0xecb596,
-    0xecb597,
-    0xecb598,
-    0xecb599,
-    0xecb59a,
-    0xecb59b,
-    0xecb59c,
-    0xecb59d,
-    0xecb59e,
-    0xecb59f,
-    0xecb5a0,
-    0xecb5a1,
-    0xecb5a2,
-    0xecb5a3,
-    0xecb5a4,
-    0xecb5a5,
-    0xecb5a6,
-    0xecb5a7,
-    0xecb5a8,
-    0xecb5a9,
-    0xecb5aa,
-    0xecb5ab,
-    0xecb5ac,
-    0xecb5ad,
-    0xecb5ae,
-    0xecb5af,
-    0xecb5b0,
-    0xecb5b1,
-    0xecb5b2,
-    0xecb5b3,
-    0xecb5b4,
-    0xecb5b5,
-    0xecb5b6,
-    0xecb5b7,
-    0xecb5b8,
-    0xecb5b9,
-    0xecb5ba,
-    0xecb5bb,
-    0xecb5bc,
-    0xecb5bd,
-    0xecb5be,
-    0xecb5bf,
-    0xecb680,
-    0xecb681,
-    0xecb682,
-    0xecb683,
-    0xecb684,
-    0xecb685,
-    0xecb686,
-    0xecb687,
-    0xecb688,
-    0xecb689,
-    0xecb68a,
-    0xecb68b,
-    0xecb68c,
-    0xecb68d,
-    0xecb68e,
-    0xecb68f,
-    0xecb690,
-    0xecb691,
-    0xecb692,
-    0xecb693,
-    0xecb694,
-    0xecb695,
-    0xecb696,
-    0xecb697,
-    0xecb698,
-    0xecb699,
-    0xecb69a,
-    0xecb69b,
-    0xecb69c,
-    0xecb69d,
-    0xecb69e,
-    0xecb69f,
-    0xecb6a0,
-    0xecb6a1,
-    0xecb6a2,
-    0xecb6a3,
-    0xecb6a4,
-    0xecb6a5,
-    0xecb6a6,
-    0xecb6a7,
-    0xecb6a8,
-    0xecb6a9,
-    0xecb6aa,
-    0xecb6ab,
-    0xecb6ac,
-    0xecb6ad,
-    0xecb6ae,
-    0xecb6af,
-    0xecb6b0,
-    0xecb6b1,
-    0xecb6b2,
-    0xecb6b3,
-    0xecb6b4,
-    0xecb6b5,
-    0xecb6b6,
-    0xecb6b7,
-    0xecb6b8,
-    0xecb6b9,
-    0xecb6ba,
-    0xecb6bb,
-    0xecb6bc,
-    0xecb6bd,
-    0xecb6be,
-    0xecb6bf,
-    0xecb780,
-    0xecb781,
-    0xecb782,
-    0xecb783,
-    0xecb784,
-    0xecb785,
-    0xecb786,
-    0xecb787,
-    0xecb788,
-    0xecb789,
-    0xecb78a,
-    0xecb78b,
-    0xecb78c,
-    0xecb78d,
-    0xecb78e,
-    0xecb78f,
-    0xecb790,
-    0xecb791,
-    0xecb792,
-    0xecb793,
-    0xecb794,
-    0xecb795,
-    0xecb796,
-    0xecb797,
-    0xecb798,
-    0xecb799,
-    0xecb79a,
-    0xecb79b,
-    0xecb79c,
-    0xecb79d,
-    0xecb79e,
-    0xecb79f,
-    0xecb7a0,
-    0xecb7a1,
-    0xecb7a2,
-    0xecb7a3,
-    0xecb7a4,
-    0xecb7a5,
-    0xecb7a6,
-    0xecb7a7,
-    0xecb7a8,
-    0xecb7a9,
-    0xecb7aa,
-    0xecb7ab,
-    0xecb7ac,
-    0xecb7ad,
-    0xecb7ae,
-    0xecb7af,
-    0xecb7b0,
-    0xecb7b1,
-    0xecb7b2,
-    0xecb7b3,
-    0xecb7b4,
-    0xecb7b5,
-    0xecb7b6,
-    0xecb7b7,
-    0xecb7b8,
-    0xecb7b9,
-    0xecb7ba,
-    0xecb7bb,
-    0xecb7bc,
-    0xecb7bd,
-    0xecb7be,
-    0xecb7bf,
-    0xecb880,
-    0xecb881,
-    0xecb882,
-    0xecb883,
-    0xecb884,
-    0xecb885,
-    0xecb886,
-    0xecb887,
-    0xecb888,
-    0xecb889,
-    0xecb88a,
-    0xecb88b,
-    0xecb88c,
-    0xecb88d,
-    0xecb88e,
-    0xecb88f,
-    0xecb890,
-    0xecb891,
-    0xecb892,
-    0xecb893,
-    0xecb894,
-    0xecb895,
-    0xecb896,
-    0xecb897,
-    0xecb898,
-    0xecb899,
-    0xecb89a,
-    0xecb89b,
-    0xecb89c,
-    0xecb89d,
-    0xecb89e,
-    0xecb89f,
-    0xecb8a0,
-    0xecb8a1,
-    0xecb8a2,
-    0xecb8a3,
-    0xecb8a4,
-    0xecb8a5,
-    0xecb8a6,
-    0xecb8a7,
-    0xecb8a8,
-    0xecb8a9,
-    0xecb8aa,
-    0xecb8ab,
-    0xecb8ac,
-    0xecb8ad,
-    0xecb8ae,
-    0xecb8af,
-    0xecb8b0,
-    0xecb8b1,
-    0xecb8b2,
-    0xecb8b3,
-    0xecb8b4,
-    0xecb8b5,
-    0xecb8b6,
-    0xecb8b7,
-    0xecb8b8,
-    0xecb8b9,
-    0xecb8ba,
-    0xecb8bb,
-    0xecb8bc,
-    0xecb8bd,
-    0xecb8be,
-    0xecb8bf,
-    0xecb980,
-    0xecb981,
-    0xecb982,
-    0xecb983,
-    0xecb984,
-    0xecb985,
-    0xecb986,
-    0xecb987,
-    0xecb988,
-    0xecb989,
-    0xecb98a,
-    0xecb98b,
-    0xecb98c,
-    0xecb98d,
-    0xecb98e,
-    0xecb98f,
-    0xecb990,
-    0xecb991,
-    0xecb992,
-    0xecb993,
-    0xecb994,
-    0xecb995,
-    0xecb996,
-    0xecb997,
-    0xecb998,
-    0xecb999,
-    0xecb99a,
-    0xecb99b,
-    0xecb99c,
-    0xecb99d,
-    0xecb99e,
-    0xecb99f,
-    0xecb9a0,
-    0xecb9a1,
-    0xecb9a2,
-    0xecb9a3,
-    0xecb9a4,
-    0xecb9a5,
-    0xecb9a6,
-    0xecb9a7,
-    0xecb9a8,
-    0xecb9a9,
-    0xecb9aa,
-    0xecb9ab,
-    0xecb9ac,
-    0xecb9ad,
-    0xecb9ae,
-    0xecb9af,
-    0xecb9b0,
-    0xecb9b1,
-    0xecb9b2,
-    0xecb9b3,
-    0xecb9b4,
-    0xecb9b5,
-    0xecb9b6,
-    0xecb9b7,
-    0xecb9b8,
-    0xecb9b9,
-    0xecb9ba,
-    0xecb9bb,
-    0xecb9bc,
-    0xecb9bd,
-    0xecb9be,
-    0xecb9bf,
-    0xecba80,
-    0xecba81,
-    0xecba82,
-    0xecba83,
-    0xecba84,
-    0xecba85,
-    0xecba86,
-    0xecba87,
-    0xecba88,
-    0xecba89,
-    0xecba8a,
-    0xecba8b,
-    0xecba8c,
-    0xecba8d,
-    0xecba8e,
-    0xecba8f,
-    0xecba90,
-    0xecba91,
-    0xecba92,
-    0xecba93,
-    0xecba94,
-    0xecba95,
-    0xecba96,
-    0xecba97,
-    0xecba98,
-    0xecba99,
-    0xecba9a,
-    0xecba9b,
-    0xecba9c,
-    0xecba9d,
-    0xecba9e,
-    0xecba9f,
-    0xecbaa0,
-    0xecbaa1,
-    0xecbaa2,
-    0xecbaa3,
-    0xecbaa4,
-    0xecbaa5,
-    0xecbaa6,
-    0xecbaa7,
-    0xecbaa8,
-    0xecbaa9,
-    0xecbaaa,
-    0xecbaab,
-    0xecbaac,
-    0xecbaad,
-    0xecbaae,
-    0xecbaaf,
-    0xecbab0,
-    0xecbab1,
-    0xecbab2,
-    0xecbab3,
-    0xecbab4,
-    0xecbab5,
-    0xecbab6,
-    0xecbab7,
-    0xecbab8,
-    0xecbab9,
-    0xecbaba,
-    0xecbabb,
-    0xecbabc,
-    0xecbabd,
-    0xecbabe,
-    0xecbabf,
-    0xecbb80,
-    0xecbb81,
-    0xecbb82,
-    0xecbb83,
-    0xecbb84,
-    0xecbb85,
-    0xecbb86,
-    0xecbb87,
-    0xecbb88,
-    0xecbb89,
-    0xecbb8a,
-    0xecbb8b,
-    0xecbb8c,
-    0xecbb8d,
-    0xecbb8e,
-    0xecbb8f,
-    0xecbb90,
-    0xecbb91,
-    0xecbb92,
-    0xecbb93,
-    0xecbb94,
-    0xecbb95,
-    0xecbb96,
-    0xecbb97,
-    0xecbb98,
-    0xecbb99,
-    0xecbb9a,
-    0xecbb9b,
-    0xecbb9c,
-    0xecbb9d,
-    0xecbb9e,
-    0xecbb9f,
-    0xecbba0,
-    0xecbba1,
-    0xecbba2,
-    0xecbba3,
-    0xecbba4,
-    0xecbba5,
-    0xecbba6,
-    0xecbba7,
-    0xecbba8,
-    0xecbba9,
-    0xecbbaa,
-    0xecbbab,
-    0xecbbac,
-    0xecbbad,
-    0xecbbae,
-    0xecbbaf,
-    0xecbbb0,
-    0xecbbb1,
-    0xecbbb2,
-    0xecbbb3,
-    0xecbbb4,
-    0xecbbb5,
-    0xecbbb6,
-    0xecbbb7,
-    0xecbbb8,
-    0xecbbb9,
-    0xecbbba,
-    0xecbbbb,
-    0xecbbbc,
-    0xecbbbd,
-    0xecbbbe,
-    0xecbbbf,
-    0xecbc80,
-    0xecbc81,
-    0xecbc82,
-    0xecbc83,
-    0xecbc84,
-    0xecbc85,
-    0xecbc86,
-    0xecbc87,
-    0xecbc88,
-    0xecbc89,
-    0xecbc8a,
-    0xecbc8b,
-    0xecbc8c,
-    0xecbc8d,
-    0xecbc8e,
-    0xecbc8f,
-    0xecbc90,
-    0xecbc91,
-    0xecbc92,
-    0xecbc93,
-    0xecbc94,
-    0xecbc95,
-    0xecbc96,
-    0xecbc97,
-    0xecbc98,
-    0xecbc99,
-    0xecbc9a,
-    0xecbc9b,
-    0xecbc9c,
-    0xecbc9d,
-    0xecbc9e,
-    0xecbc9f,
-    0xecbca0,
-    0xecbca1,
-    0xecbca2,
-    0xecbca3,
-    0xecbca4,
-    0xecbca5,
-    0xecbca6,
-    0xecbca7,
-    0xecbca8,
-    0xecbca9,
-    0xecbcaa,
-    0xecbcab,
-    0xecbcac,
-    0xecbcad,
-    0xecbcae,
-    0xecbcaf,
-    0xecbcb0,
-    0xecbcb1,
-    0xecbcb2,
-    0xecbcb3,
-    0xecbcb4,
-    0xecbcb5,
-    0xecbcb6,
-    0xecbcb7,
-    0xecbcb8,
-    0xecbcb9,
-    0xecbcba,
-    0xecbcbb,
-    0xecbcbc,
-    0xecbcbd,
-    0xecbcbe,
-    0xecbcbf,
-    0xecbd80,
-    0xecbd81,
-    0xecbd82,
-    0xecbd83,
-    0xecbd84,
-    0xecbd85,
-    0xecbd86,
-    0xecbd87,
-    0xecbd88,
-    0xecbd89,
-    0xecbd8a,
-    0xecbd8b,
-    0xecbd8c,
-    0xecbd8d,
-    0xecbd8e,
-    0xecbd8f,
-    0xecbd90,
-    0xecbd91,
-    0xecbd92,
-    0xecbd93,
-    0xecbd94,
-    0xecbd95,
-    0xecbd96,
-    0xecbd97,
-    0xecbd98,
-    0xecbd99,
-    0xecbd9a,
-    0xecbd9b,
-    0xecbd9c,
-    0xecbd9d,
-    0xecbd9e,
-    0xecbd9f,
-    0xecbda0,
-    0xecbda1,
-    0xecbda2,
-    0xecbda3,
-    0xecbda4,
-    0xecbda5,
-    0xecbda6,
-    0xecbda7,
-    0xecbda8,
-    0xecbda9,
-    0xecbdaa,
-    0xecbdab,
-    0xecbdac,
-    0xecbdad,
-    0xecbdae,
-    0xecbdaf,
-    0xecbdb0,
-    0xecbdb1,
-    0xecbdb2,
-    0xecbdb3,
-    0xecbdb4,
-    0xecbdb5,
-    0xecbdb6,
-    0xecbdb7,
-    0xecbdb8,
-    0xecbdb9,
-    0xecbdba,
-    0xecbdbb,
-    0xecbdbc,
-    0xecbdbd,
-    0xecbdbe,
-    0xecbdbf,
-    0xecbe80,
-    0xecbe81,
-    0xecbe82,
-    0xecbe83,
-    0xecbe84,
-    0xecbe85,
-    0xecbe86,
-    0xecbe87,
-    0xecbe88,
-    0xecbe89,
-    0xecbe8a,
-    0xecbe8b,
-    0xecbe8c,
-    0xecbe8d,
-    0xecbe8e,
-    0xecbe8f,
-    0xecbe90,
-    0xecbe91,
-    0xecbe92,
-    0xecbe93,
-    0xecbe94,
-    0xecbe95,
-    0xecbe96,
-    0xecbe97,
-    0xecbe98,
-    0xecbe99,
-    0xecbe9a,
-    0xecbe9b,
-    0xecbe9c,
-    0xecbe9d,
-    0xecbe9e,
-    0xecbe9f,
-    0xecbea0,
-    0xecbea1,
-    0xecbea2,
-    0xecbea3,
-    0xecbea4,
-    0xecbea5,
-    0xecbea6,
-    0xecbea7,
-    0xecbea8,
-    0xecbea9,
-    0xecbeaa,
-    0xecbeab,
-    0xecbeac,
-    0xecbead,
-    0xecbeae,
-    0xecbeaf,
-    0xecbeb0,
-    0xecbeb1,
-    0xecbeb2,
-    0xecbeb3,
-    0xecbeb4,
-    0xecbeb5,
-    0xecbeb6,
-    0xecbeb7,
-    0xecbeb8,
-    0xecbeb9,
-    0xecbeba,
-    0xecbebb,
-    0xecbebc,
-    0xecbebd,
-    0xecbebe,
-    0xecbebf,
-    0xecbf80,
-    0xecbf81,
-    0xecbf82,
-    0xecbf83,
-    0xecbf84,
-    0xecbf85,
-    0xecbf86,
-    0xecbf87,
-    0xecbf88,
-    0xecbf89,
-    0xecbf8a,
-    0xecbf8b,
-    0xecbf8c,
-    0xecbf8d,
-    0xecbf8e,
-    0xecbf8f,
-    0xecbf90,
-    0xecbf91,
-    0xecbf92,
-    0xecbf93,
-    0xecbf94,
-    0xecbf95,
-    0xecbf96,
-    0xecbf97,
-    0xecbf98,
-    0xecbf99,
-    0xecbf9a,
-    0xecbf9b,
-    0xecbf9c,
-    0xecbf9d,
-    0xecbf9e,
-    0xecbf9f,
-    0xecbfa0,
-    0xecbfa1,
-    0xecbfa2,
-    0xecbfa3,
-    0xecbfa4,
-    0xecbfa5,
-    0xecbfa6,
-    0xecbfa7,
-    0xecbfa8,
-    0xecbfa9,
-    0xecbfaa,
-    0xecbfab,
-    0xecbfac,
-    0xecbfad,
-    0xecbfae,
-    0xecbfaf,
-    0xecbfb0,
-    0xecbfb1,
-    0xecbfb2,
-    0xecbfb3,
-    0xecbfb4,
-    0xecbfb5,
-    0xecbfb6,
-    0xecbfb7,
-    0xecbfb8,
-    0xecbfb9,
-    0xecbfba,
-    0xecbfbb,
-    0xecbfbc,
-    0xecbfbd,
-    0xecbfbe,
-    0xecbfbf,
-    0xed8080,
-    0xed8081,
-    0xed8082,
-    0xed8083,
-    0xed8084,
-    0xed8085,
-    0xed8086,
-    0xed8087,
-    0xed8088,
-    0xed8089,
-    0xed808a,
-    0xed808b,
-    0xed808c,
-    0xed808d,
-    0xed808e,
-    0xed808f,
-    0xed8090,
-    0xed8091,
-    0xed8092,
-    0xed8093,
-    0xed8094,
-    0xed8095,
-    0xed8096,
-    0xed8097,
-    0xed8098,
-    0xed8099,
-    0xed809a,
-    0xed809b,
-    0xed809c,
-    0xed809d,
-    0xed809e,
-    0xed809f,
-    0xed80a0,
-    0xed80a1,
-    0xed80a2,
-    0xed80a3,
-    0xed80a4,
-    0xed80a5,
-    0xed80a6,
-    0xed80a7,
-    0xed80a8,
-    0xed80a9,
-    0xed80aa,
-    0xed80ab,
-    0xed80ac,
-    0xed80ad,
-    0xed80ae,
-    0xed80af,
-    0xed80b0,
-    0xed80b1,
-    0xed80b2,
-    0xed80b3,
-    0xed80b4,
-    0xed80b5,
-    0xed80b6,
-    0xed80b7,
-    0xed80b8,
-    0xed80b9,
-    0xed80ba,
-    0xed80bb,
-    0xed80bc,
-    0xed80bd,
-    0xed80be,
-    0xed80bf,
-    0xed8180,
-    0xed8181,
-    0xed8182,
-    0xed8183,
-    0xed8184,
-    0xed8185,
-    0xed8186,
-    0xed8187,
-    0xed8188,
-    0xed8189,
-    0xed818a,
-    0xed818b,
-    0xed818c,
-    0xed818d,
-    0xed818e,
-    0xed818f,
-    0xed8190,
-    0xed8191,
-    0xed8192,
-    0xed8193,
-    0xed8194,
-    0xed8195,
-    0xed8196,
-    0xed8197,
-    0xed8198,
-    0xed8199,
-    0xed819a,
-    0xed819b,
-    0xed819c,
-    0xed819d,
-    0xed819e,
-    0xed819f,
-    0xed81a0,
-    0xed81a1,
-    0xed81a2,
-    0xed81a3,
-    0xed81a4,
-    0xed81a5,
-    0xed81a6,
-    0xed81a7,
-    0xed81a8,
-    0xed81a9,
-    0xed81aa,
-    0xed81ab,
-    0xed81ac,
-    0xed81ad,
-    0xed81ae,
-    0xed81af,
-    0xed81b0,
-    0xed81b1,
-    0xed81b2,
-    0xed81b3,
-    0xed81b4,
-    0xed81b5,
-    0xed81b6,
-    0xed81b7,
-    0xed81b8,
-    0xed81b9,
-    0xed81ba,
-    0xed81bb,
-    0xed81bc,
-    0xed81bd,
-    0xed81be,
-    0xed81bf,
-    0xed8280,
-    0xed8281,
-    0xed8282,
-    0xed8283,
-    0xed8284,
-    0xed8285,
-    0xed8286,
-    0xed8287,
-    0xed8288,
-    0xed8289,
-    0xed828a,
-    0xed828b,
-    0xed828c,
-    0xed828d,
-    0xed828e,
-    0xed828f,
-    0xed8290,
-    0xed8291,
-    0xed8292,
-    0xed8293,
-    0xed8294,
-    0xed8295,
-    0xed8296,
-    0xed8297,
-    0xed8298,
-    0xed8299,
-    0xed829a,
-    0xed829b,
-    0xed829c,
-    0xed829d,
-    0xed829e,
-    0xed829f,
-    0xed82a0,
-    0xed82a1,
-    0xed82a2,
-    0xed82a3,
-    0xed82a4,
-    0xed82a5,
-    0xed82a6,
-    0xed82a7,
-    0xed82a8,
-    0xed82a9,
-    0xed82aa,
-    0xed82ab,
-    0xed82ac,
-    0xed82ad,
-    0xed82ae,
-    0xed82af,
-    0xed82b0,
-    0xed82b1,
-    0xed82b2,
-    0xed82b3,
-    0xed82b4,
-    0xed82b5,
-    0xed82b6,
-    0xed82b7,
-    0xed82b8,
-    0xed82b9,
-    0xed82ba,
-    0xed82bb,
-    0xed82bc,
-    0xed82bd,
-    0xed82be,
-    0xed82bf,
-    0xed8380,
-    0xed8381,
-    0xed8382,
-    0xed8383,
-    0xed8384,
-    0xed8385,
-    0xed8386,
-    0xed8387,
-    0xed8388,
-    0xed8389,
-    0xed838a,
-    0xed838b,
-    0xed838c,
-    0xed838d,
-    0xed838e,
-    0xed838f,
-    0xed8390,
-    0xed8391,
-    0xed8392,
-    0xed8393,
-    0xed8394,
-    0xed8395,
-    0xed8396,
-    0xed8397,
-    0xed8398,
-    0xed8399,
-    0xed839a,
-    0xed839b,
-    0xed839c,
-    0xed839d,
-    0xed839e,
-    0xed839f,
-    0xed83a0,
-    0xed83a1,
-    0xed83a2,
-    0xed83a3,
-    0xed83a4,
-    0xed83a5,
-    0xed83a6,
-    0xed83a7,
-    0xed83a8,
-    0xed83a9,
-    0xed83aa,
-    0xed83ab,
-    0xed83ac,
-    0xed83ad,
-    0xed83ae,
-    0xed83af,
-    0xed83b0,
-    0xed83b1,
-    0xed83b2,
-    0xed83b3,
-    0xed83b4,
-    0xed83b5,
-    0xed83b6,
-    0xed83b7,
-    0xed83b8,
-    0xed83b9,
-    0xed83ba,
-    0xed83bb,
-    0xed83bc,
-    0xed83bd,
-    0xed83be,
-    0xed83bf,
-    0xed8480,
-    0xed8481,
-    0xed8482,
-    0xed8483,
-    0xed8484,
-    0xed8485,
-    0xed8486,
-    0xed8487,
-    0xed8488,
-    0xed8489,
-    0xed848a,
-    0xed848b,
-    0xed848c,
-    0xed848d,
-    0xed848e,
-    0xed848f,
-    0xed8490,
-    0xed8491,
-    0xed8492,
-    0xed8493,
-    0xed8494,
-    0xed8495,
-    0xed8496,
-    0xed8497,
-    0xed8498,
-    0xed8499,
-    0xed849a,
-    0xed849b,
-    0xed849c,
-    0xed849d,
-    0xed849e,
-    0xed849f,
-    0xed84a0,
-    0xed84a1,
-    0xed84a2,
-    0xed84a3,
-    0xed84a4,
-    0xed84a5,
-    0xed84a6,
-    0xed84a7,
-    0xed84a8,
-    0xed84a9,
-    0xed84aa,
-    0xed84ab,
-    0xed84ac,
-    0xed84ad,
-    0xed84ae,
-    0xed84af,
-    0xed84b0,
-    0xed84b1,
-    0xed84b2,
-    0xed84b3,
-    0xed84b4,
-    0xed84b5,
-    0xed84b6,
-    0xed84b7,
-    0xed84b8,
-    0xed84b9,
-    0xed84ba,
-    0xed84bb,
-    0xed84bc,
-    0xed84bd,
-    0xed84be,
-    0xed84bf,
-    0xed8580,
-    0xed8581,
-    0xed8582,
-    0xed8583,
-    0xed8584,
-    0xed8585,
-    0xed8586,
-    0xed8587,
-    0xed8588,
-    0xed8589,
-    0xed858a,
-    0xed858b,
-    0xed858c,
-    0xed858d,
-    0xed858e,
-    0xed858f,
-    0xed8590,
-    0xed8591,
-    0xed8592,
-    0xed8593,
-    0xed8594,
-    0xed8595,
-    0xed8596,
-    0xed8597,
-    0xed8598,
-    0xed8599,
-    0xed859a,
-    0xed859b,
-    0xed859c,
-    0xed859d,
-    0xed859e,
-    0xed859f,
-    0xed85a0,
-    0xed85a1,
-    0xed85a2,
-    0xed85a3,
-    0xed85a4,
-    0xed85a5,
-    0xed85a6,
-    0xed85a7,
-    0xed85a8,
-    0xed85a9,
-    0xed85aa,
-    0xed85ab,
-    0xed85ac,
-    0xed85ad,
-    0xed85ae,
-    0xed85af,
-    0xed85b0,
-    0xed85b1,
-    0xed85b2,
-    0xed85b3,
-    0xed85b4,
-    0xed85b5,
-    0xed85b6,
-    0xed85b7,
-    0xed85b8,
-    0xed85b9,
-    0xed85ba,
-    0xed85bb,
-    0xed85bc,
-    0xed85bd,
-    0xed85be,
-    0xed85bf,
-    0xed8680,
-    0xed8681,
-    0xed8682,
-    0xed8683,
-    0xed8684,
-    0xed8685,
-    0xed8686,
-    0xed8687,
-    0xed8688,
-    0xed8689,
-    0xed868a,
-    0xed868b,
-    0xed868c,
-    0xed868d,
-    0xed868e,
-    0xed868f,
-    0xed8690,
-    0xed8691,
-    0xed8692,
-    0xed8693,
-    0xed8694,
-    0xed8695,
-    0xed8696,
-    0xed8697,
-    0xed8698,
-    0xed8699,
-    0xed869a,
-    0xed869b,
-    0xed869c,
-    0xed869d,
-    0xed869e,
-    0xed869f,
-    0xed86a0,
-    0xed86a1,
-    0xed86a2,
-    0xed86a3,
-    0xed86a4,
-    0xed86a5,
-    0xed86a6,
-    0xed86a7,
-    0xed86a8,
-    0xed86a9,
-    0xed86aa,
-    0xed86ab,
-    0xed86ac,
-    0xed86ad,
-    0xed86ae,
-    0xed86af,
-    0xed86b0,
-    0xed86b1,
-    0xed86b2,
-    0xed86b3,
-    0xed86b4,
-    0xed86b5,
-    0xed86b6,
-    0xed86b7,
-    0xed86b8,
-    0xed86b9,
-    0xed86ba,
-    0xed86bb,
-    0xed86bc,
-    0xed86bd,
-    0xed86be,
-    0xed86bf,
-    0xed8780,
-    0xed8781,
-    0xed8782,
-    0xed8783,
-    0xed8784,
-    0xed8785,
-    0xed8786,
-    0xed8787,
-    0xed8788,
-    0xed8789,
-    0xed878a,
-    0xed878b,
-    0xed878c,
-    0xed878d,
-    0xed878e,
-    0xed878f,
-    0xed8790,
-    0xed8791,
-    0xed8792,
-    0xed8793,
-    0xed8794,
-    0xed8795,
-    0xed8796,
-    0xed8797,
-    0xed8798,
-    0xed8799,
-    0xed879a,
-    0xed879b,
-    0xed879c,
-    0xed879d,
-    0xed879e,
-    0xed879f,
-    0xed87a0,
-    0xed87a1,
-    0xed87a2,
-    0xed87a3,
-    0xed87a4,
-    0xed87a5,
-    0xed87a6,
-    0xed87a7,
-    0xed87a8,
-    0xed87a9,
-    0xed87aa,
-    0xed87ab,
-    0xed87ac,
-    0xed87ad,
-    0xed87ae,
-    0xed87af,
-    0xed87b0,
-    0xed87b1,
-    0xed87b2,
-    0xed87b3,
-    0xed87b4,
-    0xed87b5,
-    0xed87b6,
-    0xed87b7,
-    0xed87b8,
-    0xed87b9,
-    0xed87ba,
-    0xed87bb,
-    0xed87bc,
-    0xed87bd,
-    0xed87be,
-    0xed87bf,
-    0xed8880,
-    0xed8881,
-    0xed8882,
-    0xed8883,
-    0xed8884,
-    0xed8885,
-    0xed8886,
-    0xed8887,
-    0xed8888,
-    0xed8889,
-    0xed888a,
-    0xed888b,
-    0xed888c,
-    0xed888d,
-    0xed888e,
-    0xed888f,
-    0xed8890,
-    0xed8891,
-    0xed8892,
-    0xed8893,
-    0xed8894,
-    0xed8895,
-    0xed8896,
-    0xed8897,
-    0xed8898,
-    0xed8899,
-    0xed889a,
-    0xed889b,
-    0xed889c,
-    0xed889d,
-    0xed889e,
-    0xed889f,
-    0xed88a0,
-    0xed88a1,
-    0xed88a2,
-    0xed88a3,
-    0xed88a4,
-    0xed88a5,
-    0xed88a6,
-    0xed88a7,
-    0xed88a8,
-    0xed88a9,
-    0xed88aa,
-    0xed88ab,
-    0xed88ac,
-    0xed88ad,
-    0xed88ae,
-    0xed88af,
-    0xed88b0,
-    0xed88b1,
-    0xed88b2,
-    0xed88b3,
-    0xed88b4,
-    0xed88b5,
-    0xed88b6,
-    0xed88b7,
-    0xed88b8,
-    0xed88b9,
-    0xed88ba,
-    0xed88bb,
-    0xed88bc,
-    0xed88bd,
-    0xed88be,
-    0xed88bf,
-    0xed8980,
-    0xed8981,
-    0xed8982,
-    0xed8983,
-    0xed8984,
-    0xed8985,
-    0xed8986,
-    0xed8987,
-    0xed8988,
-    0xed8989,
-    0xed898a,
-    0xed898b,
-    0xed898c,
-    0xed898d,
-    0xed898e,
-    0xed898f,
-    0xed8990,
-    0xed8991,
-    0xed8992,
-    0xed8993,
-    0xed8994,
-    0xed8995,
-    0xed8996,
-    0xed8997,
-    0xed8998,
-    0xed8999,
-    0xed899a,
-    0xed899b,
-    0xed899c,
-    0xed899d,
-    0xed899e,
-    0xed899f,
-    0xed89a0,
-    0xed89a1,
-    0xed89a2,
-    0xed89a3,
-    0xed89a4,
-    0xed89a5,
-    0xed89a6,
-    0xed89a7,
-    0xed89a8,
-    0xed89a9,
-    0xed89aa,
-    0xed89ab,
-    0xed89ac,
-    0xed89ad,
-    0xed89ae,
-    0xed89af,
-    0xed89b0,
-    0xed89b1,
-    0xed89b2,
-    0xed89b3,
-    0xed89b4,
-    0xed89b5,
-    0xed89b6,
-    0xed89b7,
-    0xed89b8,
-    0xed89b9,
-    0xed89ba,
-    0xed89bb,
-    0xed89bc,
-    0xed89bd,
-    0xed89be,
-    0xed89bf,
-    0xed8a80,
-    0xed8a81,
-    0xed8a82,
-    0xed8a83,
-    0xed8a84,
-    0xed8a85,
-    0xed8a86,
-    0xed8a87,
-    0xed8a88,
-    0xed8a89,
-    0xed8a8a,
-    0xed8a8b,
-    0xed8a8c,
-    0xed8a8d,
-    0xed8a8e,
-    0xed8a8f,
-    0xed8a90,
-    0xed8a91,
-    0xed8a92,
-    0xed8a93,
-    0xed8a94,
-    0xed8a95,
-    0xed8a96,
-    0xed8a97,
-    0xed8a98,
-    0xed8a99,
-    0xed8a9a,
-    0xed8a9b,
-    0xed8a9c,
-    0xed8a9d,
-    0xed8a9e,
-    0xed8a9f,
-    0xed8aa0,
-    0xed8aa1,
-    0xed8aa2,
-    0xed8aa3,
-    0xed8aa4,
-    0xed8aa5,
-    0xed8aa6,
-    0xed8aa7,
-    0xed8aa8,
-    0xed8aa9,
-    0xed8aaa,
-    0xed8aab,
-    0xed8aac,
-    0xed8aad,
-    0xed8aae,
-    0xed8aaf,
-    0xed8ab0,
-    0xed8ab1,
-    0xed8ab2,
-    0xed8ab3,
-    0xed8ab4,
-    0xed8ab5,
-    0xed8ab6,
-    0xed8ab7,
-    0xed8ab8,
-    0xed8ab9,
-    0xed8aba,
-    0xed8abb,
-    0xed8abc,
-    0xed8abd,
-    0xed8abe,
-    0xed8abf,
-    0xed8b80,
-    0xed8b81,
-    0xed8b82,
-    0xed8b83,
-    0xed8b84,
-    0xed8b85,
-    0xed8b86,
-    0xed8b87,
-    0xed8b88,
-    0xed8b89,
-    0xed8b8a,
-    0xed8b8b,
-    0xed8b8c,
-    0xed8b8d,
-    0xed8b8e,
-    0xed8b8f,
-    0xed8b90,
-    0xed8b91,
-    0xed8b92,
-    0xed8b93,
-    0xed8b94,
-    0xed8b95,
-    0xed8b96,
-    0xed8b97,
-    0xed8b98,
-    0xed8b99,
-    0xed8b9a,
-    0xed8b9b,
-    0xed8b9c,
-    0xed8b9d,
-    0xed8b9e,
-    0xed8b9f,
-    0xed8ba0,
-    0xed8ba1,
-    0xed8ba2,
-    0xed8ba3,
-    0xed8ba4,
-    0xed8ba5,
-    0xed8ba6,
-    0xed8ba7,
-    0xed8ba8,
-    0xed8ba9,
-    0xed8baa,
-    0xed8bab,
-    0xed8bac,
-    0xed8bad,
-    0xed8bae,
-    0xed8baf,
-    0xed8bb0,
-    0xed8bb1,
-    0xed8bb2,
-    0xed8bb3,
-    0xed8bb4,
-    0xed8bb5,
-    0xed8bb6,
-    0xed8bb7,
-    0xed8bb8,
-    0xed8bb9,
-    0xed8bba,
-    0xed8bbb,
-    0xed8bbc,
-    0xed8bbd,
-    0xed8bbe,
-    0xed8bbf,
-    0xed8c80,
-    0xed8c81,
-    0xed8c82,
-    0xed8c83,
-    0xed8c84,
-    0xed8c85,
-    0xed8c86,
-    0xed8c87,
-    0xed8c88,
-    0xed8c89,
-    0xed8c8a,
-    0xed8c8b,
-    0xed8c8c,
-    0xed8c8d,
-    0xed8c8e,
-    0xed8c8f,
-    0xed8c90,
-    0xed8c91,
-    0xed8c92,
-    0xed8c93,
-    0xed8c94,
-    0xed8c95,
-    0xed8c96,
-    0xed8c97,
-    0xed8c98,
-    0xed8c99,
-    0xed8c9a,
-    0xed8c9b,
-    0xed8c9c,
-    0xed8c9d,
-    0xed8c9e,
-    0xed8c9f,
-    0xed8ca0,
-    0xed8ca1,
-    0xed8ca2,
-    0xed8ca3,
-    0xed8ca4,
-    0xed8ca5,
-    0xed8ca6,
-    0xed8ca7,
-    0xed8ca8,
-    0xed8ca9,
-    0xed8caa,
-    0xed8cab,
-    0xed8cac,
-    0xed8cad,
-    0xed8cae,
-    0xed8caf,
-    0xed8cb0,
-    0xed8cb1,
-    0xed8cb2,
-    0xed8cb3,
-    0xed8cb4,
-    0xed8cb5,
-    0xed8cb6,
-    0xed8cb7,
-    0xed8cb8,
-    0xed8cb9,
-    0xed8cba,
-    0xed8cbb,
-    0xed8cbc,
-    0xed8cbd,
-    0xed8cbe,
-    0xed8cbf,
-    0xed8d80,
-    0xed8d81,
-    0xed8d82,
-    0xed8d83,
-    0xed8d84,
-    0xed8d85,
-    0xed8d86,
-    0xed8d87,
-    0xed8d88,
-    0xed8d89,
-    0xed8d8a,
-    0xed8d8b,
-    0xed8d8c,
-    0xed8d8d,
-    0xed8d8e,
-    0xed8d8f,
-    0xed8d90,
-    0xed8d91,
-    0xed8d92,
-    0xed8d93,
-    0xed8d94,
-    0xed8d95,
-    0xed8d96,
-    0xed8d97,
-    0xed8d98,
-    0xed8d99,
-    0xed8d9a,
-    0xed8d9b,
-    0xed8d9c,
-    0xed8d9d,
-    0xed8d9e,
-    0xed8d9f,
-    0xed8da0,
-    0xed8da1,
-    0xed8da2,
-    0xed8da3,
-    0xed8da4,
-    0xed8da5,
-    0xed8da6,
-    0xed8da7,
-    0xed8da8,
-    0xed8da9,
-    0xed8daa,
-    0xed8dab,
-    0xed8dac,
-    0xed8dad,
-    0xed8dae,
-    0xed8daf,
-    0xed8db0,
-    0xed8db1,
-    0xed8db2,
-    0xed8db3,
-    0xed8db4,
-    0xed8db5,
-    0xed8db6,
-    0xed8db7,
-    0xed8db8,
-    0xed8db9,
-    0xed8dba,
-    0xed8dbb,
-    0xed8dbc,
-    0xed8dbd,
-    0xed8dbe,
-    0xed8dbf,
-    0xed8e80,
-    0xed8e81,
-    0xed8e82,
-    0xed8e83,
-    0xed8e84,
-    0xed8e85,
-    0xed8e86,
-    0xed8e87,
-    0xed8e88,
-    0xed8e89,
-    0xed8e8a,
-    0xed8e8b,
-    0xed8e8c,
-    0xed8e8d,
-    0xed8e8e,
-    0xed8e8f,
-    0xed8e90,
-    0xed8e91,
-    0xed8e92,
-    0xed8e93,
-    0xed8e94,
-    0xed8e95,
-    0xed8e96,
-    0xed8e97,
-    0xed8e98,
-    0xed8e99,
-    0xed8e9a,
-    0xed8e9b,
-    0xed8e9c,
-    0xed8e9d,
-    0xed8e9e,
-    0xed8e9f,
-    0xed8ea0,
-    0xed8ea1,
-    0xed8ea2,
-    0xed8ea3,
-    0xed8ea4,
-    0xed8ea5,
-    0xed8ea6,
-    0xed8ea7,
-    0xed8ea8,
-    0xed8ea9,
-    0xed8eaa,
-    0xed8eab,
-    0xed8eac,
-    0xed8ead,
-    0xed8eae,
-    0xed8eaf,
-    0xed8eb0,
-    0xed8eb1,
-    0xed8eb2,
-    0xed8eb3,
-    0xed8eb4,
-    0xed8eb5,
-    0xed8eb6,
-    0xed8eb7,
-    0xed8eb8,
-    0xed8eb9,
-    0xed8eba,
-    0xed8ebb,
-    0xed8ebc,
-    0xed8ebd,
-    0xed8ebe,
-    0xed8ebf,
-    0xed8f80,
-    0xed8f81,
-    0xed8f82,
-    0xed8f83,
-    0xed8f84,
-    0xed8f85,
-    0xed8f86,
-    0xed8f87,
-    0xed8f88,
-    0xed8f89,
-    0xed8f8a,
-    0xed8f8b,
-    0xed8f8c,
-    0xed8f8d,
-    0xed8f8e,
-    0xed8f8f,
-    0xed8f90,
-    0xed8f91,
-    0xed8f92,
-    0xed8f93,
-    0xed8f94,
-    0xed8f95,
-    0xed8f96,
-    0xed8f97,
-    0xed8f98,
-    0xed8f99,
-    0xed8f9a,
-    0xed8f9b,
-    0xed8f9c,
-    0xed8f9d,
-    0xed8f9e,
-    0xed8f9f,
-    0xed8fa0,
-    0xed8fa1,
-    0xed8fa2,
-    0xed8fa3,
-    0xed8fa4,
-    0xed8fa5,
-    0xed8fa6,
-    0xed8fa7,
-    0xed8fa8,
-    0xed8fa9,
-    0xed8faa,
-    0xed8fab,
-    0xed8fac,
-    0xed8fad,
-    0xed8fae,
-    0xed8faf,
-    0xed8fb0,
-    0xed8fb1,
-    0xed8fb2,
-    0xed8fb3,
-    0xed8fb4,
-    0xed8fb5,
-    0xed8fb6,
-    0xed8fb7,
-    0xed8fb8,
-    0xed8fb9,
-    0xed8fba,
-    0xed8fbb,
-    0xed8fbc,
-    0xed8fbd,
-    0xed8fbe,
-    0xed8fbf,
-    0xed9080,
-    0xed9081,
-    0xed9082,
-    0xed9083,
-    0xed9084,
-    0xed9085,
-    0xed9086,
-    0xed9087,
-    0xed9088,
-    0xed9089,
-    0xed908a,
-    0xed908b,
-    0xed908c,
-    0xed908d,
-    0xed908e,
-    0xed908f,
-    0xed9090,
-    0xed9091,
-    0xed9092,
-    0xed9093,
-    0xed9094,
-    0xed9095,
-    0xed9096,
-    0xed9097,
-    0xed9098,
-    0xed9099,
-    0xed909a,
-    0xed909b,
-    0xed909c,
-    0xed909d,
-    0xed909e,
-    0xed909f,
-    0xed90a0,
-    0xed90a1,
-    0xed90a2,
-    0xed90a3,
-    0xed90a4,
-    0xed90a5,
-    0xed90a6,
-    0xed90a7,
-    0xed90a8,
-    0xed90a9,
-    0xed90aa,
-    0xed90ab,
-    0xed90ac,
-    0xed90ad,
-    0xed90ae,
-    0xed90af,
-    0xed90b0,
-    0xed90b1,
-    0xed90b2,
-    0xed90b3,
-    0xed90b4,
-    0xed90b5,
-    0xed90b6,
-    0xed90b7,
-    0xed90b8,
-    0xed90b9,
-    0xed90ba,
-    0xed90bb,
-    0xed90bc,
-    0xed90bd,
-    0xed90be,
-    0xed90bf,
-    0xed9180,
-    0xed9181,
-    0xed9182,
-    0xed9183,
-    0xed9184,
-    0xed9185,
-    0xed9186,
-    0xed9187,
-    0xed9188,
-    0xed9189,
-    0xed918a,
-    0xed918b,
-    0xed918c,
-    0xed918d,
-    0xed918e,
-    0xed918f,
-    0xed9190,
-    0xed9191,
-    0xed9192,
-    0xed9193,
-    0xed9194,
-    0xed9195,
-    0xed9196,
-    0xed9197,
-    0xed9198,
-    0xed9199,
-    0xed919a,
-    0xed919b,
-    0xed919c,
-    0xed919d,
-    0xed919e,
-    0xed919f,
-    0xed91a0,
-    0xed91a1,
-    0xed91a2,
-    0xed91a3,
-    0xed91a4,
-    0xed91a5,
-    0xed91a6,
-    0xed91a7,
-    0xed91a8,
-    0xed91a9,
-    0xed91aa,
-    0xed91ab,
-    0xed91ac,
-    0xed91ad,
-    0xed91ae,
-    0xed91af,
-    0xed91b0,
-    0xed91b1,
-    0xed91b2,
-    0xed91b3,
-    0xed91b4,
-    0xed91b5,
-    0xed91b6,
-    0xed91b7,
-    0xed91b8,
-    0xed91b9,
-    0xed91ba,
-    0xed91bb,
-    0xed91bc,
-    0xed91bd,
-    0xed91be,
-    0xed91bf,
-    0xed9280,
-    0xed9281,
-    0xed9282,
-    0xed9283,
-    0xed9284,
-    0xed9285,
-    0xed9286,
-    0xed9287,
-    0xed9288,
-    0xed9289,
-    0xed928a,
-    0xed928b,
-    0xed928c,
-    0xed928d,
-    0xed928e,
-    0xed928f,
-    0xed9290,
-    0xed9291,
-    0xed9292,
-    0xed9293,
-    0xed9294,
-    0xed9295,
-    0xed9296,
-    0xed9297,
-    0xed9298,
-    0xed9299,
-    0xed929a,
-    0xed929b,
-    0xed929c,
-    0xed929d,
-    0xed929e,
-    0xed929f,
-    0xed92a0,
-    0xed92a1,
-    0xed92a2,
-    0xed92a3,
-    0xed92a4,
-    0xed92a5,
-    0xed92a6,
-    0xed92a7,
-    0xed92a8,
-    0xed92a9,
-    0xed92aa,
-    0xed92ab,
-    0xed92ac,
-    0xed92ad,
-    0xed92ae,
-    0xed92af,
-    0xed92b0,
-    0xed92b1,
-    0xed92b2,
-    0xed92b3,
-    0xed92b4,
-    0xed92b5,
-    0xed92b6,
-    0xed92b7,
-    0xed92b8,
-    0xed92b9,
-    0xed92ba,
-    0xed92bb,
-    0xed92bc,
-    0xed92bd,
-    0xed92be,
-    0xed92bf,
-    0xed9380,
-    0xed9381,
-    0xed9382,
-    0xed9383,
-    0xed9384,
-    0xed9385,
-    0xed9386,
-    0xed9387,
-    0xed9388,
-    0xed9389,
-    0xed938a,
-    0xed938b,
-    0xed938c,
-    0xed938d,
-    0xed938e,
-    0xed938f,
-    0xed9390,
-    0xed9391,
-    0xed9392,
-    0xed9393,
-    0xed9394,
-    0xed9395,
-    0xed9396,
-    0xed9397,
-    0xed9398,
-    0xed9399,
-    0xed939a,
-    0xed939b,
-    0xed939c,
-    0xed939d,
-    0xed939e,
-    0xed939f,
-    0xed93a0,
-    0xed93a1,
-    0xed93a2,
-    0xed93a3,
-    0xed93a4,
-    0xed93a5,
-    0xed93a6,
-    0xed93a7,
-    0xed93a8,
-    0xed93a9,
-    0xed93aa,
-    0xed93ab,
-    0xed93ac,
-    0xed93ad,
-    0xed93ae,
-    0xed93af,
-    0xed93b0,
-    0xed93b1,
-    0xed93b2,
-    0xed93b3,
-    0xed93b4,
-    0xed93b5,
-    0xed93b6,
-    0xed93b7,
-    0xed93b8,
-    0xed93b9,
-    0xed93ba,
-    0xed93bb,
-    0xed93bc,
-    0xed93bd,
-    0xed93be,
-    0xed93bf,
-    0xed9480,
-    0xed9481,
-    0xed9482,
-    0xed9483,
-    0xed9484,
-    0xed9485,
-    0xed9486,
-    0xed9487,
-    0xed9488,
-    0xed9489,
-    0xed948a,
-    0xed948b,
-    0xed948c,
-    0xed948d,
-    0xed948e,
-    0xed948f,
-    0xed9490,
-    0xed9491,
-    0xed9492,
-    0xed9493,
-    0xed9494,
-    0xed9495,
-    0xed9496,
-    0xed9497,
-    0xed9498,
-    0xed9499,
-    0xed949a,
-    0xed949b,
-    0xed949c,
-    0xed949d,
-    0xed949e,
-    0xed949f,
-    0xed94a0,
-    0xed94a1,
-    0xed94a2,
-    0xed94a3,
-    0xed94a4,
-    0xed94a5,
-    0xed94a6,
-    0xed94a7,
-    0xed94a8,
-    0xed94a9,
-    0xed94aa,
-    0xed94ab,
-    0xed94ac,
-    0xed94ad,
-    0xed94ae,
-    0xed94af,
-    0xed94b0,
-    0xed94b1,
-    0xed94b2,
-    0xed94b3,
-    0xed94b4,
-    0xed94b5,
-    0xed94b6,
-    0xed94b7,
-    0xed94b8,
-    0xed94b9,
-    0xed94ba,
-    0xed94bb,
-    0xed94bc,
-    0xed94bd,
-    0xed94be,
-    0xed94bf,
-    0xed9580,
-    0xed9581,
-    0xed9582,
-    0xed9583,
-    0xed9584,
-    0xed9585,
-    0xed9586,
-    0xed9587,
-    0xed9588,
-    0xed9589,
-    0xed958a,
-    0xed958b,
-    0xed958c,
-    0xed958d,
-    0xed958e,
-    0xed958f,
-    0xed9590,
-    0xed9591,
-    0xed9592,
-    0xed9593,
-    0xed9594,
-    0xed9595,
-    0xed9596,
-    0xed9597,
-    0xed9598,
-    0xed9599,
-    0xed959a,
-    0xed959b,
-    0xed959c,
-    0xed959d,
-    0xed959e,
-    0xed959f,
-    0xed95a0,
-    0xed95a1,
-    0xed95a2,
-    0xed95a3,
-    0xed95a4,
-    0xed95a5,
-    0xed95a6,
-    0xed95a7,
-    0xed95a8,
-    0xed95a9,
-    0xed95aa,
-    0xed95ab,
-    0xed95ac,
-    0xed95ad,
-    0xed95ae,
-    0xed95af,
-    0xed95b0,
-    0xed95b1,
-    0xed95b2,
-    0xed95b3,
-    0xed95b4,
-    0xed95b5,
-    0xed95b6,
-    0xed95b7,
-    0xed95b8,
-    0xed95b9,
-    0xed95ba,
-    0xed95bb,
-    0xed95bc,
-    0xed95bd,
-    0xed95be,
-    0xed95bf,
-    0xed9680,
-    0xed9681,
-    0xed9682,
-    0xed9683,
-    0xed9684,
-    0xed9685,
-    0xed9686,
-    0xed9687,
-    0xed9688,
-    0xed9689,
-    0xed968a,
-    0xed968b,
-    0xed968c,
-    0xed968d,
-    0xed968e,
-    0xed968f,
-    0xed9690,
-    0xed9691,
-    0xed9692,
-    0xed9693,
-    0xed9694,
-    0xed9695,
-    0xed9696,
-    0xed9697,
-    0xed9698,
-    0xed9699,
-    0xed969a,
-    0xed969b,
-    0xed969c,
-    0xed969d,
-    0xed969e,
-    0xed969f,
-    0xed96a0,
-    0xed96a1,
-    0xed96a2,
-    0xed96a3,
-    0xed96a4,
-    0xed96a5,
-    0xed96a6,
-    0xed96a7,
-    0xed96a8,
-    0xed96a9,
-    0xed96aa,
-    0xed96ab,
-    0xed96ac,
-    0xed96ad,
-    0xed96ae,
-    0xed96af,
-    0xed96b0,
-    0xed96b1,
-    0xed96b2,
-    0xed96b3,
-    0xed96b4,
-    0xed96b5,
-    0xed96b6,
-    0xed96b7,
-    0xed96b8,
-    0xed96b9,
-    0xed96ba,
-    0xed96bb,
-    0xed96bc,
-    0xed96bd,
-    0xed96be,
-    0xed96bf,
-    0xed9780,
-    0xed9781,
-    0xed9782,
-    0xed9783,
-    0xed9784,
-    0xed9785,
-    0xed9786,
-    0xed9787,
-    0xed9788,
-    0xed9789,
-    0xed978a,
-    0xed978b,
-    0xed978c,
-    0xed978d,
-    0xed978e,
-    0xed978f,
-    0xed9790,
-    0xed9791,
-    0xed9792,
-    0xed9793,
-    0xed9794,
-    0xed9795,
-    0xed9796,
-    0xed9797,
-    0xed9798,
-    0xed9799,
-    0xed979a,
-    0xed979b,
-    0xed979c,
-    0xed979d,
-    0xed979e,
-    0xed979f,
-    0xed97a0,
-    0xed97a1,
-    0xed97a2,
-    0xed97a3,
-    0xed97a4,
-    0xed97a5,
-    0xed97a6,
-    0xed97a7,
-    0xed97a8,
-    0xed97a9,
-    0xed97aa,
-    0xed97ab,
-    0xed97ac,
-    0xed97ad,
-    0xed97ae,
-    0xed97af,
-    0xed97b0,
-    0xed97b1,
-    0xed97b2,
-    0xed97b3,
-    0xed97b4,
-    0xed97b5,
-    0xed97b6,
-    0xed97b7,
-    0xed97b8,
-    0xed97b9,
-    0xed97ba,
-    0xed97bb,
-    0xed97bc,
-    0xed97bd,
-    0xed97be,
-    0xed97bf,
-    0xed9880,
-    0xed9881,
-    0xed9882,
-    0xed9883,
-    0xed9884,
-    0xed9885,
-    0xed9886,
-    0xed9887,
-    0xed9888,
-    0xed9889,
-    0xed988a,
-    0xed988b,
-    0xed988c,
-    0xed988d,
-    0xed988e,
-    0xed988f,
-    0xed9890,
-    0xed9891,
-    0xed9892,
-    0xed9893,
-    0xed9894,
-    0xed9895,
-    0xed9896,
-    0xed9897,
-    0xed9898,
-    0xed9899,
-    0xed989a,
-    0xed989b,
-    0xed989c,
-    0xed989d,
-    0xed989e,
-    0xed989f,
-    0xed98a0,
-    0xed98a1,
-    0xed98a2,
-    0xed98a3,
-    0xed98a4,
-    0xed98a5,
-    0xed98a6,
-    0xed98a7,
-    0xed98a8,
-    0xed98a9,
-    0xed98aa,
-    0xed98ab,
-    0xed98ac,
-    0xed98ad,
-    0xed98ae,
-    0xed98af,
-    0xed98b0,
-    0xed98b1,
-    0xed98b2,
-    0xed98b3,
-    0xed98b4,
-    0xed98b5,
-    0xed98b6,
-    0xed98b7,
-    0xed98b8,
-    0xed98b9,
-    0xed98ba,
-    0xed98bb,
-    0xed98bc,
-    0xed98bd,
-    0xed98be,
-    0xed98bf,
-    0xed9980,
-    0xed9981,
-    0xed9982,
-    0xed9983,
-    0xed9984,
-    0xed9985,
-    0xed9986,
-    0xed9987,
-    0xed9988,
-    0xed9989,
-    0xed998a,
-    0xed998b,
-    0xed998c,
-    0xed998d,
-    0xed998e,
-    0xed998f,
-    0xed9990,
-    0xed9991,
-    0xed9992,
-    0xed9993,
-    0xed9994,
-    0xed9995,
-    0xed9996,
-    0xed9997,
-    0xed9998,
-    0xed9999,
-    0xed999a,
-    0xed999b,
-    0xed999c,
-    0xed999d,
-    0xed999e,
-    0xed999f,
-    0xed99a0,
-    0xed99a1,
-    0xed99a2,
-    0xed99a3,
-    0xed99a4,
-    0xed99a5,
-    0xed99a6,
-    0xed99a7,
-    0xed99a8,
-    0xed99a9,
-    0xed99aa,
-    0xed99ab,
-    0xed99ac,
-    0xed99ad,
-    0xed99ae,
-    0xed99af,
-    0xed99b0,
-    0xed99b1,
-    0xed99b2,
-    0xed99b3,
-    0xed99b4,
-    0xed99b5,
-    0xed99b6,
-    0xed99b7,
-    0xed99b8,
-    0xed99b9,
-    0xed99ba,
-    0xed99bb,
-    0xed99bc,
-    0xed99bd,
-    0xed99be,
-    0xed99bf,
-    0xed9a80,
-    0xed9a81,
-    0xed9a82,
-    0xed9a83,
-    0xed9a84,
-    0xed9a85,
-    0xed9a86,
-    0xed9a87,
-    0xed9a88,
-    0xed9a89,
-    0xed9a8a,
-    0xed9a8b,
-    0xed9a8c,
-    0xed9a8d,
-    0xed9a8e,
-    0xed9a8f,
-    0xed9a90,
-    0xed9a91,
-    0xed9a92,
-    0xed9a93,
-    0xed9a94,
-    0xed9a95,
-    0xed9a96,
-    0xed9a97,
-    0xed9a98,
-    0xed9a99,
-    0xed9a9a,
-    0xed9a9b,
-    0xed9a9c,
-    0xed9a9d,
-    0xed9a9e,
-    0xed9a9f,
-    0xed9aa0,
-    0xed9aa1,
-    0xed9aa2,
-    0xed9aa3,
-    0xed9aa4,
-    0xed9aa5,
-    0xed9aa6,
-    0xed9aa7,
-    0xed9aa8,
-    0xed9aa9,
-    0xed9aaa,
-    0xed9aab,
-    0xed9aac,
-    0xed9aad,
-    0xed9aae,
-    0xed9aaf,
-    0xed9ab0,
-    0xed9ab1,
-    0xed9ab2,
-    0xed9ab3,
-    0xed9ab4,
-    0xed9ab5,
-    0xed9ab6,
-    0xed9ab7,
-    0xed9ab8,
-    0xed9ab9,
-    0xed9aba,
-    0xed9abb,
-    0xed9abc,
-    0xed9abd,
-    0xed9abe,
-    0xed9abf,
-    0xed9b80,
-    0xed9b81,
-    0xed9b82,
-    0xed9b83,
-    0xed9b84,
-    0xed9b85,
-    0xed9b86,
-    0xed9b87,
-    0xed9b88,
-    0xed9b89,
-    0xed9b8a,
-    0xed9b8b,
-    0xed9b8c,
-    0xed9b8d,
-    0xed9b8e,
-    0xed9b8f,
-    0xed9b90,
-    0xed9b91,
-    0xed9b92,
-    0xed9b93,
-    0xed9b94,
-    0xed9b95,
-    0xed9b96,
-    0xed9b97,
-    0xed9b98,
-    0xed9b99,
-    0xed9b9a,
-    0xed9b9b,
-    0xed9b9c,
-    0xed9b9d,
-    0xed9b9e,
-    0xed9b9f,
-    0xed9ba0,
-    0xed9ba1,
-    0xed9ba2,
-    0xed9ba3,
-    0xed9ba4,
-    0xed9ba5,
-    0xed9ba6,
-    0xed9ba7,
-    0xed9ba8,
-    0xed9ba9,
-    0xed9baa,
-    0xed9bab,
-    0xed9bac,
-    0xed9bad,
-    0xed9bae,
-    0xed9baf,
-    0xed9bb0,
-    0xed9bb1,
-    0xed9bb2,
-    0xed9bb3,
-    0xed9bb4,
-    0xed9bb5,
-    0xed9bb6,
-    0xed9bb7,
-    0xed9bb8,
-    0xed9bb9,
-    0xed9bba,
-    0xed9bbb,
-    0xed9bbc,
-    0xed9bbd,
-    0xed9bbe,
-    0xed9bbf,
-    0xed9c80,
-    0xed9c81,
-    0xed9c82,
-    0xed9c83,
-    0xed9c84,
-    0xed9c85,
-    0xed9c86,
-    0xed9c87,
-    0xed9c88,
-    0xed9c89,
-    0xed9c8a,
-    0xed9c8b,
-    0xed9c8c,
-    0xed9c8d,
-    0xed9c8e,
-    0xed9c8f,
-    0xed9c90,
-    0xed9c91,
-    0xed9c92,
-    0xed9c93,
-    0xed9c94,
-    0xed9c95,
-    0xed9c96,
-    0xed9c97,
-    0xed9c98,
-    0xed9c99,
-    0xed9c9a,
-    0xed9c9b,
-    0xed9c9c,
-    0xed9c9d,
-    0xed9c9e,
-    0xed9c9f,
-    0xed9ca0,
-    0xed9ca1,
-    0xed9ca2,
-    0xed9ca3,
-    0xed9ca4,
-    0xed9ca5,
-    0xed9ca6,
-    0xed9ca7,
-    0xed9ca8,
-    0xed9ca9,
-    0xed9caa,
-    0xed9cab,
-    0xed9cac,
-    0xed9cad,
-    0xed9cae,
-    0xed9caf,
-    0xed9cb0,
-    0xed9cb1,
-    0xed9cb2,
-    0xed9cb3,
-    0xed9cb4,
-    0xed9cb5,
-    0xed9cb6,
-    0xed9cb7,
-    0xed9cb8,
-    0xed9cb9,
-    0xed9cba,
-    0xed9cbb,
-    0xed9cbc,
-    0xed9cbd,
-    0xed9cbe,
-    0xed9cbf,
-    0xed9d80,
-    0xed9d81,
-    0xed9d82,
-    0xed9d83,
-    0xed9d84,
-    0xed9d85,
-    0xed9d86,
-    0xed9d87,
-    0xed9d88,
-    0xed9d89,
-    0xed9d8a,
-    0xed9d8b,
-    0xed9d8c,
-    0xed9d8d,
-    0xed9d8e,
-    0xed9d8f,
-    0xed9d90,
-    0xed9d91,
-    0xed9d92,
-    0xed9d93,
-    0xed9d94,
-    0xed9d95,
-    0xed9d96,
-    0xed9d97,
-    0xed9d98,
-    0xed9d99,
-    0xed9d9a,
-    0xed9d9b,
-    0xed9d9c,
-    0xed9d9d,
-    0xed9d9e,
-    0xed9d9f,
-    0xed9da0,
-    0xed9da1,
-    0xed9da2,
-    0xed9da3,
-    0xed9da4,
-    0xed9da5,
-    0xed9da6,
-    0xed9da7,
-    0xed9da8,
-    0xed9da9,
-    0xed9daa,
-    0xed9dab,
-    0xed9dac,
-    0xed9dad,
-    0xed9dae,
-    0xed9daf,
-    0xed9db0,
-    0xed9db1,
-    0xed9db2,
-    0xed9db3,
-    0xed9db4,
-    0xed9db5,
-    0xed9db6,
-    0xed9db7,
-    0xed9db8,
-    0xed9db9,
-    0xed9dba,
-    0xed9dbb,
-    0xed9dbc,
-    0xed9dbd,
-    0xed9dbe,
-    0xed9dbf,
-    0xed9e80,
-    0xed9e81,
-    0xed9e82,
-    0xed9e83,
-    0xed9e84,
-    0xed9e85,
-    0xed9e86,
-    0xed9e87,
-    0xed9e88,
-    0xed9e89,
-    0xed9e8a,
-    0xed9e8b,
-    0xed9e8c,
-    0xed9e8d,
-    0xed9e8e,
-    0xed9e8f,
-    0xed9e90,
-    0xed9e91,
-    0xed9e92,
-    0xed9e93,
-    0xed9e94,
-    0xed9e95,
-    0xed9e96,
-    0xed9e97,
-    0xed9e98,
-    0xed9e99,
-    0xed9e9a,
-    0xed9e9b,
-    0xed9e9c,
-    0xed9e9d,
-    0xed9e9e,
-    0xed9e9f,
-    0xed9ea0,
-    0xed9ea1,
-    0xed9ea2,
-    0xed9ea3,
-    0xed9ea4,
-    0xed9ea5,
-    0xed9ea6,
-    0xed9ea7,
-    0xed9ea8,
-    0xed9ea9,
-    0xed9eaa,
-    0xed9eab,
-    0xed9eac,
-    0xed9ead,
-    0xed9eae,
-    0xed9eaf,
-    0xed9eb0,
-    0xed9eb1,
-    0xed9eb2,
-    0xed9eb3,
-    0xed9eb4,
-    0xed9eb5,
-    0xed9eb6,
-    0xed9eb7,
-    0xed9eb8,
-    0xed9eb9,
-    0xed9eba,
-    0xed9ebb,
-    0xed9ebc,
-    0xed9ebd,
-    0xed9ebe,
-    0xed9ebf,
-    0xed9f80,
-    0xed9f81,
-    0xed9f82,
-    0xed9f83,
-    0xed9f84,
-    0xed9f85,
-    0xed9f86,
-    0xed9f87,
-    0xed9f88,
-    0xed9f89,
-    0xed9f8a,
-    0xed9f8b,
-    0xed9f8c,
-    0xed9f8d,
-    0xed9f8e,
-    0xed9f8f,
-    0xed9f90,
-    0xed9f91,
-    0xed9f92,
-    0xed9f93,
-    0xed9f94,
-    0xed9f95,
-    0xed9f96,
-    0xed9f97,
-    0xed9f98,
-    0xed9f99,
-    0xed9f9a,
-    0xed9f9b,
-    0xed9f9c,
-    0xed9f9d,
-    0xed9f9e,
-    0xed9f9f,
-    0xed9fa0,
-    0xed9fa1,
-    0xed9fa2,
-    0xed9fa3,
-    0xed9fa4,
-    0xed9fa5,
-    0xed9fa6,
-    0xed9fa7,
-    0xed9fa8,
-    0xed9fa9,
-    0xed9faa,
-    0xed9fab,
-    0xed9fac,
-    0xed9fad,
-    0xed9fae,
-    0xed9faf,
-    0xed9fb0,
-    0xed9fb1,
-    0xed9fb2,
-    0xed9fb3,
-    0xed9fb4,
-    0xed9fb5,
-    0xed9fb6,
-    0xed9fb7,
-    0xed9fb8,
-    0xed9fb9,
-    0xed9fba,
-    0xed9fbb,
-    0xed9fbc,
-    0xed9fbd,
-    0xed9fbe,
-    0xed9fbf,
-    0xee8080,
-    0xee8081,
-    0xee8082,
-    0xee8083,
-    0xee8084,
-    0xee8085,
-    0xee8086,
-    0xee8087,
-    0xee8088,
-    0xee8089,
-    0xee808a,
-    0xee808b,
-    0xee808c,
-    0xee808d,
-    0xee808e,
-    0xee808f,
-    0xee8090,
-    0xee8091,
-    0xee8092,
-    0xee8093,
-    0xee8094,
-    0xee8095,
-    0xee8096,
-    0xee8097,
-    0xee8098,
-    0xee8099,
-    0xee809a,
-    0xee809b,
-    0xee809c,
-    0xee809d,
-    0xee809e,
-    0xee809f,
-    0xee80a0,
-    0xee80a1,
-    0xee80a2,
-    0xee80a3,
-    0xee80a4,
-    0xee80a5,
-    0xee80a6,
-    0xee80a7,
-    0xee80a8,
-    0xee80a9,
-    0xee80aa,
-    0xee80ab,
-    0xee80ac,
-    0xee80ad,
-    0xee80ae,
-    0xee80af,
-    0xee80b0,
-    0xee80b1,
-    0xee80b2,
-    0xee80b3,
-    0xee80b4,
-    0xee80b5,
-    0xee80b6,
-    0xee80b7,
-    0xee80b8,
-    0xee80b9,
-    0xee80ba,
-    0xee80bb,
-    0xee80bc,
-    0xee80bd,
-    0xee80be,
-    0xee80bf,
-    0xee8180,
-    0xee8181,
-    0xee8182,
-    0xee8183,
-    0xee8184,
-    0xee8185,
-    0xee8186,
-    0xee8187,
-    0xee8188,
-    0xee8189,
-    0xee818a,
-    0xee818b,
-    0xee818c,
-    0xee818d,
-    0xee818e,
-    0xee818f,
-    0xee8190,
-    0xee8191,
-    0xee8192,
-    0xee8193,
-    0xee8194,
-    0xee8195,
-    0xee8196,
-    0xee8197,
-    0xee8198,
-    0xee8199,
-    0xee819a,
-    0xee819b,
-    0xee819c,
-    0xee819d,
-    0xee819e,
-    0xee819f,
-    0xee81a0,
-    0xee81a1,
-    0xee81a2,
-    0xee81a3,
-    0xee81a4,
-    0xee81a5,
-    0xee81a6,
-    0xee81a7,
-    0xee81a8,
-    0xee81a9,
-    0xee81aa,
-    0xee81ab,
-    0xee81ac,
-    0xee81ad,
-    0xee81ae,
-    0xee81af,
-    0xee81b0,
-    0xee81b1,
-    0xee81b2,
-    0xee81b3,
-    0xee81b4,
-    0xee81b5,
-    0xee81b6,
-    0xee81b7,
-    0xee81b8,
-    0xee81b9,
-    0xee81ba,
-    0xee81bb,
-    0xee81bc,
-    0xee81bd,
-    0xee81be,
-    0xee81bf,
-    0xee8280,
-    0xee8281,
-    0xee8282,
-    0xee8283,
-    0xee8284,
-    0xee8285,
-    0xee8286,
-    0xee8287,
-    0xee8288,
-    0xee8289,
-    0xee828a,
-    0xee828b,
-    0xee828c,
-    0xee828d,
-    0xee828e,
-    0xee828f,
-    0xee8290,
-    0xee8291,
-    0xee8292,
-    0xee8293,
-    0xee8294,
-    0xee8295,
-    0xee8296,
-    0xee8297,
-    0xee8298,
-    0xee8299,
-    0xee829a,
-    0xee829b,
-    0xee829c,
-    0xee829d,
-    0xee829e,
-    0xee829f,
-    0xee82a0,
-    0xee82a1,
-    0xee82a2,
-    0xee82a3,
-    0xee82a4,
-    0xee82a5,
-    0xee82a6,
-    0xee82a7,
-    0xee82a8,
-    0xee82a9,
-    0xee82aa,
-    0xee82ab,
-    0xee82ac,
-    0xee82ad,
-    0xee82ae,
-    0xee82af,
-    0xee82b0,
-    0xee82b1,
-    0xee82b2,
-    0xee82b3,
-    0xee82b4,
-    0xee82b5,
-    0xee82b6,
-    0xee82b7,
-    0xee82b8,
-    0xee82b9,
-    0xee82ba,
-    0xee82bb,
-    0xee82bc,
-    0xee82bd,
-    0xee82be,
-    0xee82bf,
-    0xee8380,
-    0xee8381,
-    0xee8382,
-    0xee8383,
-    0xee8384,
-    0xee8385,
-    0xee8386,
-    0xee8387,
-    0xee8388,
-    0xee8389,
-    0xee838a,
-    0xee838b,
-    0xee838c,
-    0xee838d,
-    0xee838e,
-    0xee838f,
-    0xee8390,
-    0xee8391,
-    0xee8392,
-    0xee8393,
-    0xee8394,
-    0xee8395,
-    0xee8396,
-    0xee8397,
-    0xee8398,
-    0xee8399,
-    0xee839a,
-    0xee839b,
-    0xee839c,
-    0xee839d,
-    0xee839e,
-    0xee839f,
-    0xee83a0,
-    0xee83a1,
-    0xee83a2,
-    0xee83a3,
-    0xee83a4,
-    0xee83a5,
-    0xee83a6,
-    0xee83a7,
-    0xee83a8,
-    0xee83a9,
-    0xee83aa,
-    0xee83ab,
-    0xee83ac,
-    0xee83ad,
-    0xee83ae,
-    0xee83af,
-    0xee83b0,
-    0xee83b1,
-    0xee83b2,
-    0xee83b3,
-    0xee83b4,
-    0xee83b5,
-    0xee83b6,
-    0xee83b7,
-    0xee83b8,
-    0xee83b9,
-    0xee83ba,
-    0xee83bb,
-    0xee83bc,
-    0xee83bd,
-    0xee83be,
-    0xee83bf,
-    0xee8480,
-    0xee8481,
-    0xee8482,
-    0xee8483,
-    0xee8484,
-    0xee8485,
-    0xee8486,
-    0xee8487,
-    0xee8488,
-    0xee8489,
-    0xee848a,
-    0xee848b,
-    0xee848c,
-    0xee848d,
-    0xee848e,
-    0xee848f,
-    0xee8490,
-    0xee8491,
-    0xee8492,
-    0xee8493,
-    0xee8494,
-    0xee8495,
-    0xee8496,
-    0xee8497,
-    0xee8498,
-    0xee8499,
-    0xee849a,
-    0xee849b,
-    0xee849c,
-    0xee849d,
-    0xee849e,
-    0xee849f,
-    0xee84a0,
-    0xee84a1,
-    0xee84a2,
-    0xee84a3,
-    0xee84a4,
-    0xee84a5,
-    0xee84a6,
-    0xee84a7,
-    0xee84a8,
-    0xee84a9,
-    0xee84aa,
-    0xee84ab,
-    0xee84ac,
-    0xee84ad,
-    0xee84ae,
-    0xee84af,
-    0xee84b0,
-    0xee84b1,
-    0xee84b2,
-    0xee84b3,
-    0xee84b4,
-    0xee84b5,
-    0xee84b6,
-    0xee84b7,
-    0xee84b8,
-    0xee84b9,
-    0xee84ba,
-    0xee84bb,
-    0xee84bc,
-    0xee84bd,
-    0xee84be,
-    0xee84bf,
-    0xee8580,
-    0xee8581,
-    0xee8582,
-    0xee8583,
-    0xee8584,
-    0xee8585,
-    0xee8586,
-    0xee8587,
-    0xee8588,
-    0xee8589,
-    0xee858a,
-    0xee858b,
-    0xee858c,
-    0xee858d,
-    0xee858e,
-    0xee858f,
-    0xee8590,
-    0xee8591,
-    0xee8592,
-    0xee8593,
-    0xee8594,
-    0xee8595,
-    0xee8596,
-    0xee8597,
-    0xee8598,
-    0xee8599,
-    0xee859a,
-    0xee859b,
-    0xee859c,
-    0xee859d,
-    0xee859e,
-    0xee859f,
-    0xee85a0,
-    0xee85a1,
-    0xee85a2,
-    0xee85a3,
-    0xee85a4,
-    0xee85a5,
-    0xee85a6,
-    0xee85a7,
-    0xee85a8,
-    0xee85a9,
-    0xee85aa,
-    0xee85ab,
-    0xee85ac,
-    0xee85ad,
-    0xee85ae,
-    0xee85af,
-    0xee85b0,
-    0xee85b1,
-    0xee85b2,
-    0xee85b3,
-    0xee85b4,
-    0xee85b5,
-    0xee85b6,
-    0xee85b7,
-    0xee85b8,
-    0xee85b9,
-    0xee85ba,
-    0xee85bb,
-    0xee85bc,
-    0xee85bd,
-    0xee85be,
-    0xee85bf,
-    0xee8680,
-    0xee8681,
-    0xee8682,
-    0xee8683,
-    0xee8684,
-    0xee8685,
-    0xee8686,
-    0xee8687,
-    0xee8688,
-    0xee8689,
-    0xee868a,
-    0xee868b,
-    0xee868c,
-    0xee868d,
-    0xee868e,
-    0xee868f,
-    0xee8690,
-    0xee8691,
-    0xee8692,
-    0xee8693,
-    0xee8694,
-    0xee8695,
-    0xee8696,
-    0xee8697,
-    0xee8698,
-    0xee8699,
-    0xee869a,
-    0xee869b,
-    0xee869c,
-    0xee869d,
-    0xee869e,
-    0xee869f,
-    0xee86a0,
-    0xee86a1,
-    0xee86a2,
-    0xee86a3,
-    0xee86a4,
-    0xee86a5,
-    0xee86a6,
-    0xee86a7,
-    0xee86a8,
-    0xee86a9,
-    0xee86aa,
-    0xee86ab,
-    0xee86ac,
-    0xee86ad,
-    0xee86ae,
-    0xee86af,
-    0xee86b0,
-    0xee86b1,
-    0xee86b2,
-    0xee86b3,
-    0xee86b4,
-    0xee86b5,
-    0xee86b6,
-    0xee86b7,
-    0xee86b8,
-    0xee86b9,
-    0xee86ba,
-    0xee86bb,
-    0xee86bc,
-    0xee86bd,
-    0xee86be,
-    0xee86bf,
-    0xee8780,
-    0xee8781,
-    0xee8782,
-    0xee8783,
-    0xee8784,
-    0xee8785,
-    0xee8786,
-    0xee8787,
-    0xee8788,
-    0xee8789,
-    0xee878a,
-    0xee878b,
-    0xee878c,
-    0xee878d,
-    0xee878e,
-    0xee878f,
-    0xee8790,
-    0xee8791,
-    0xee8792,
-    0xee8793,
-    0xee8794,
-    0xee8795,
-    0xee8796,
-    0xee8797,
-    0xee8798,
-    0xee8799,
-    0xee879a,
-    0xee879b,
-    0xee879c,
-    0xee879d,
-    0xee879e,
-    0xee879f,
-    0xee87a0,
-    0xee87a1,
-    0xee87a2,
-    0xee87a3,
-    0xee87a4,
-    0xee87a5,
-    0xee87a6,
-    0xee87a7,
-    0xee87a8,
-    0xee87a9,
-    0xee87aa,
-    0xee87ab,
-    0xee87ac,
-    0xee87ad,
-    0xee87ae,
-    0xee87af,
-    0xee87b0,
-    0xee87b1,
-    0xee87b2,
-    0xee87b3,
-    0xee87b4,
-    0xee87b5,
-    0xee87b6,
-    0xee87b7,
-    0xee87b8,
-    0xee87b9,
-    0xee87ba,
-    0xee87bb,
-    0xee87bc,
-    0xee87bd,
-    0xee87be,
-    0xee87bf,
-    0xee8880,
-    0xee8881,
-    0xee8882,
-    0xee8883,
-    0xee8884,
-    0xee8885,
-    0xee8886,
-    0xee8887,
-    0xee8888,
-    0xee8889,
-    0xee888a,
-    0xee888b,
-    0xee888c,
-    0xee888d,
-    0xee888e,
-    0xee888f,
-    0xee8890,
-    0xee8891,
-    0xee8892,
-    0xee8893,
-    0xee8894,
-    0xee8895,
-    0xee8896,
-    0xee8897,
-    0xee8898,
-    0xee8899,
-    0xee889a,
-    0xee889b,
-    0xee889c,
-    0xee889d,
-    0xee889e,
-    0xee889f,
-    0xee88a0,
-    0xee88a1,
-    0xee88a2,
-    0xee88a3,
-    0xee88a4,
-    0xee88a5,
-    0xee88a6,
-    0xee88a7,
-    0xee88a8,
-    0xee88a9,
-    0xee88aa,
-    0xee88ab,
-    0xee88ac,
-    0xee88ad,
-    0xee88ae,
-    0xee88af,
-    0xee88b0,
-    0xee88b1,
-    0xee88b2,
-    0xee88b3,
-    0xee88b4,
-    0xee88b5,
-    0xee88b6,
-    0xee88b7,
-    0xee88b8,
-    0xee88b9,
-    0xee88ba,
-    0xee88bb,
-    0xee88bc,
-    0xee88bd,
-    0xee88be,
-    0xee88bf,
-    0xee8980,
-    0xee8981,
-    0xee8982,
-    0xee8983,
-    0xee8984,
-    0xee8985,
-    0xee8986,
-    0xee8987,
-    0xee8988,
-    0xee8989,
-    0xee898a,
-    0xee898b,
-    0xee898c,
-    0xee898d,
-    0xee898e,
-    0xee898f,
-    0xee8990,
-    0xee8991,
-    0xee8992,
-    0xee8993,
-    0xee8994,
-    0xee8995,
-    0xee8996,
-    0xee8997,
-    0xee8998,
-    0xee8999,
-    0xee899a,
-    0xee899b,
-    0xee899c,
-    0xee899d,
-    0xee899e,
-    0xee899f,
-    0xee89a0,
-    0xee89a1,
-    0xee89a2,
-    0xee89a3,
-    0xee89a4,
-    0xee89a5,
-    0xee89a6,
-    0xee89a7,
-    0xee89a8,
-    0xee89a9,
-    0xee89aa,
-    0xee89ab,
-    0xee89ac,
-    0xee89ad,
-    0xee89ae,
-    0xee89af,
-    0xee89b0,
-    0xee89b1,
-    0xee89b2,
-    0xee89b3,
-    0xee89b4,
-    0xee89b5,
-    0xee89b6,
-    0xee89b7,
-    0xee89b8,
-    0xee89b9,
-    0xee89ba,
-    0xee89bb,
-    0xee89bc,
-    0xee89bd,
-    0xee89be,
-    0xee89bf,
-    0xee8a80,
-    0xee8a81,
-    0xee8a82,
-    0xee8a83,
-    0xee8a84,
-    0xee8a85,
-    0xee8a86,
-    0xee8a87,
-    0xee8a88,
-    0xee8a89,
-    0xee8a8a,
-    0xee8a8b,
-    0xee8a8c,
-    0xee8a8d,
-    0xee8a8e,
-    0xee8a8f,
-    0xee8a90,
-    0xee8a91,
-    0xee8a92,
-    0xee8a93,
-    0xee8a94,
-    0xee8a95,
-    0xee8a96,
-    0xee8a97,
-    0xee8a98,
-    0xee8a99,
-    0xee8a9a,
-    0xee8a9b,
-    0xee8a9c,
-    0xee8a9d,
-    0xee8a9e,
-    0xee8a9f,
-    0xee8aa0,
-    0xee8aa1,
-    0xee8aa2,
-    0xee8aa3,
-    0xee8aa4,
-    0xee8aa5,
-    0xee8aa6,
-    0xee8aa7,
-    0xee8aa8,
-    0xee8aa9,
-    0xee8aaa,
-    0xee8aab,
-    0xee8aac,
-    0xee8aad,
-    0xee8aae,
-    0xee8aaf,
-    0xee8ab0,
-    0xee8ab1,
-    0xee8ab2,
-    0xee8ab3,
-    0xee8ab4,
-    0xee8ab5,
-    0xee8ab6,
-    0xee8ab7,
-    0xee8ab8,
-    0xee8ab9,
-    0xee8aba,
-    0xee8abb,
-    0xee8abc,
-    0xee8abd,
-    0xee8abe,
-    0xee8abf,
-    0xee8b80,
-    0xee8b81,
-    0xee8b82,
-    0xee8b83,
-    0xee8b84,
-    0xee8b85,
-    0xee8b86,
-    0xee8b87,
-    0xee8b88,
-    0xee8b89,
-    0xee8b8a,
-    0xee8b8b,
-    0xee8b8c,
-    0xee8b8d,
-    0xee8b8e,
-    0xee8b8f,
-    0xee8b90,
-    0xee8b91,
-    0xee8b92,
-    0xee8b93,
-    0xee8b94,
-    0xee8b95,
-    0xee8b96,
-    0xee8b97,
-    0xee8b98,
-    0xee8b99,
-    0xee8b9a,
-    0xee8b9b,
-    0xee8b9c,
-    0xee8b9d,
-    0xee8b9e,
-    0xee8b9f,
-    0xee8ba0,
-    0xee8ba1,
-    0xee8ba2,
-    0xee8ba3,
-    0xee8ba4,
-    0xee8ba5,
-    0xee8ba6,
-    0xee8ba7,
-    0xee8ba8,
-    0xee8ba9,
-    0xee8baa,
-    0xee8bab,
-    0xee8bac,
-    0xee8bad,
-    0xee8bae,
-    0xee8baf,
-    0xee8bb0,
-    0xee8bb1,
-    0xee8bb2,
-    0xee8bb3,
-    0xee8bb4,
-    0xee8bb5,
-    0xee8bb6,
-    0xee8bb7,
-    0xee8bb8,
-    0xee8bb9,
-    0xee8bba,
-    0xee8bbb,
-    0xee8bbc,
-    0xee8bbd,
-    0xee8bbe,
-    0xee8bbf,
-    0xee8c80,
-    0xee8c81,
-    0xee8c82,
-    0xee8c83,
-    0xee8c84,
-    0xee8c85,
-    0xee8c86,
-    0xee8c87,
-    0xee8c88,
-    0xee8c89,
-    0xee8c8a,
-    0xee8c8b,
-    0xee8c8c,
-    0xee8c8d,
-    0xee8c8e,
-    0xee8c8f,
-    0xee8c90,
-    0xee8c91,
-    0xee8c92,
-    0xee8c93,
-    0xee8c94,
-    0xee8c95,
-    0xee8c96,
-    0xee8c97,
-    0xee8c98,
-    0xee8c99,
-    0xee8c9a,
-    0xee8c9b,
-    0xee8c9c,
-    0xee8c9d,
-    0xee8c9e,
-    0xee8c9f,
-    0xee8ca0,
-    0xee8ca1,
-    0xee8ca2,
-    0xee8ca3,
-    0xee8ca4,
-    0xee8ca5,
-    0xee8ca6,
-    0xee8ca7,
-    0xee8ca8,
-    0xee8ca9,
-    0xee8caa,
-    0xee8cab,
-    0xee8cac,
-    0xee8cad,
-    0xee8cae,
-    0xee8caf,
-    0xee8cb0,
-    0xee8cb1,
-    0xee8cb2,
-    0xee8cb3,
-    0xee8cb4,
-    0xee8cb5,
-    0xee8cb6,
-    0xee8cb7,
-    0xee8cb8,
-    0xee8cb9,
-    0xee8cba,
-    0xee8cbb,
-    0xee8cbc,
-    0xee8cbd,
-    0xee8cbe,
-    0xee8cbf,
-    0xee8d80,
-    0xee8d81,
-    0xee8d82,
-    0xee8d83,
-    0xee8d84,
-    0xee8d85,
-    0xee8d86,
-    0xee8d87,
-    0xee8d88,
-    0xee8d89,
-    0xee8d8a,
-    0xee8d8b,
-    0xee8d8c,
-    0xee8d8d,
-    0xee8d8e,
-    0xee8d8f,
-    0xee8d90,
-    0xee8d91,
-    0xee8d92,
-    0xee8d93,
-    0xee8d94,
-    0xee8d95,
-    0xee8d96,
-    0xee8d97,
-    0xee8d98,
-    0xee8d99,
-    0xee8d9a,
-    0xee8d9b,
-    0xee8d9c,
-    0xee8d9d,
-    0xee8d9e,
-    0xee8d9f,
-    0xee8da0,
-    0xee8da1,
-    0xee8da2,
-    0xee8da3,
-    0xee8da4,
-    0xee8da5,
-    0xee8da6,
-    0xee8da7,
-    0xee8da8,
-    0xee8da9,
-    0xee8daa,
-    0xee8dab,
-    0xee8dac,
-    0xee8dad,
-    0xee8dae,
-    0xee8daf,
-    0xee8db0,
-    0xee8db1,
-    0xee8db2,
-    0xee8db3,
-    0xee8db4,
-    0xee8db5,
-    0xee8db6,
-    0xee8db7,
-    0xee8db8,
-    0xee8db9,
-    0xee8dba,
-    0xee8dbb,
-    0xee8dbc,
-    0xee8dbd,
-    0xee8dbe,
-    0xee8dbf,
-    0xee8e80,
-    0xee8e81,
-    0xee8e82,
-    0xee8e83,
-    0xee8e84,
-    0xee8e85,
-    0xee8e86,
-    0xee8e87,
-    0xee8e88,
-    0xee8e89,
-    0xee8e8a,
-    0xee8e8b,
-    0xee8e8c,
-    0xee8e8d,
-    0xee8e8e,
-    0xee8e8f,
-    0xee8e90,
-    0xee8e91,
-    0xee8e92,
-    0xee8e93,
-    0xee8e94,
-    0xee8e95,
-    0xee8e96,
-    0xee8e97,
-    0xee8e98,
-    0xee8e99,
-    0xee8e9a,
-    0xee8e9b,
-    0xee8e9c,
-    0xee8e9d,
-    0xee8e9e,
-    0xee8e9f,
-    0xee8ea0,
-    0xee8ea1,
-    0xee8ea2,
-    0xee8ea3,
-    0xee8ea4,
-    0xee8ea5,
-    0xee8ea6,
-    0xee8ea7,
-    0xee8ea8,
-    0xee8ea9,
-    0xee8eaa,
-    0xee8eab,
-    0xee8eac,
-    0xee8ead,
-    0xee8eae,
-    0xee8eaf,
-    0xee8eb0,
-    0xee8eb1,
-    0xee8eb2,
-    0xee8eb3,
-    0xee8eb4,
-    0xee8eb5,
-    0xee8eb6,
-    0xee8eb7,
-    0xee8eb8,
-    0xee8eb9,
-    0xee8eba,
-    0xee8ebb,
-    0xee8ebc,
-    0xee8ebd,
-    0xee8ebe,
-    0xee8ebf,
-    0xee8f80,
-    0xee8f81,
-    0xee8f82,
-    0xee8f83,
-    0xee8f84,
-    0xee8f85,
-    0xee8f86,
-    0xee8f87,
-    0xee8f88,
-    0xee8f89,
-    0xee8f8a,
-    0xee8f8b,
-    0xee8f8c,
-    0xee8f8d,
-    0xee8f8e,
-    0xee8f8f,
-    0xee8f90,
-    0xee8f91,
-    0xee8f92,
-    0xee8f93,
-    0xee8f94,
-    0xee8f95,
-    0xee8f96,
-    0xee8f97,
-    0xee8f98,
-    0xee8f99,
-    0xee8f9a,
-    0xee8f9b,
-    0xee8f9c,
-    0xee8f9d,
-    0xee8f9e,
-    0xee8f9f,
-    0xee8fa0,
-    0xee8fa1,
-    0xee8fa2,
-    0xee8fa3,
-    0xee8fa4,
-    0xee8fa5,
-    0xee8fa6,
-    0xee8fa7,
-    0xee8fa8,
-    0xee8fa9,
-    0xee8faa,
-    0xee8fab,
-    0xee8fac,
-    0xee8fad,
-    0xee8fae,
-    0xee8faf,
-    0xee8fb0,
-    0xee8fb1,
-    0xee8fb2,
-    0xee8fb3,
-    0xee8fb4,
-    0xee8fb5,
-    0xee8fb6,
-    0xee8fb7,
-    0xee8fb8,
-    0xee8fb9,
-    0xee8fba,
-    0xee8fbb,
-    0xee8fbc,
-    0xee8fbd,
-    0xee8fbe,
-    0xee8fbf,
-    0xee9080,
-    0xee9081,
-    0xee9082,
-    0xee9083,
-    0xee9084,
-    0xee9085,
-    0xee9086,
-    0xee9087,
-    0xee9088,
-    0xee9089,
-    0xee908a,
-    0xee908b,
-    0xee908c,
-    0xee908d,
-    0xee908e,
-    0xee908f,
-    0xee9090,
-    0xee9091,
-    0xee9092,
-    0xee9093,
-    0xee9094,
-    0xee9095,
-    0xee9096,
-    0xee9097,
-    0xee9098,
-    0xee9099,
-    0xee909a,
-    0xee909b,
-    0xee909c,
-    0xee909d,
-    0xee909e,
-    0xee909f,
-    0xee90a0,
-    0xee90a1,
-    0xee90a2,
-    0xee90a3,
-    0xee90a4,
-    0xee90a5,
-    0xee90a6,
-    0xee90a7,
-    0xee90a8,
-    0xee90a9,
-    0xee90aa,
-    0xee90ab,
-    0xee90ac,
-    0xee90ad,
-    0xee90ae,
-    0xee90af,
-    0xee90b0,
-    0xee90b1,
-    0xee90b2,
-    0xee90b3,
-    0xee90b4,
-    0xee90b5,
-    0xee90b6,
-    0xee90b7,
-    0xee90b8,
-    0xee90b9,
-    0xee90ba,
-    0xee90bb,
-    0xee90bc,
-    0xee90bd,
-    0xee90be,
-    0xee90bf,
-    0xee9180,
-    0xee9181,
-    0xee9182,
-    0xee9183,
-    0xee9184,
-    0xee9185,
-    0xee9186,
-    0xee9187,
-    0xee9188,
-    0xee9189,
-    0xee918a,
-    0xee918b,
-    0xee918c,
-    0xee918d,
-    0xee918e,
-    0xee918f,
-    0xee9190,
-    0xee9191,
-    0xee9192,
-    0xee9193,
-    0xee9194,
-    0xee9195,
-    0xee9196,
-    0xee9197,
-    0xee9198,
-    0xee9199,
-    0xee919a,
-    0xee919b,
-    0xee919c,
-    0xee919d,
-    0xee919e,
-    0xee919f,
-    0xee91a0,
-    0xee91a1,
-    0xee91a2,
-    0xee91a3,
-    0xee91a4,
-    0xee91a5,
-    0xee91a6,
-    0xee91a7,
-    0xee91a8,
-    0xee91a9,
-    0xee91aa,
-    0xee91ab,
-    0xee91ac,
-    0xee91ad,
-    0xee91ae,
-    0xee91af,
-    0xee91b0,
-    0xee91b1,
-    0xee91b2,
-    0xee91b3,
-    0xee91b4,
-    0xee91b5,
-    0xee91b6,
-    0xee91b7,
-    0xee91b8,
-    0xee91b9,
-    0xee91ba,
-    0xee91bb,
-    0xee91bc,
-    0xee91bd,
-    0xee91be,
-    0xee91bf,
-    0xee9280,
-    0xee9281,
-    0xee9282,
-    0xee9283,
-    0xee9284,
-    0xee9285,
-    0xee9286,
-    0xee9287,
-    0xee9288,
-    0xee9289,
-    0xee928a,
-    0xee928b,
-    0xee928c,
-    0xee928d,
-    0xee928e,
-    0xee928f,
-    0xee9290,
-    0xee9291,
-    0xee9292,
-    0xee9293,
-    0xee9294,
-    0xee9295,
-    0xee9296,
-    0xee9297,
-    0xee9298,
-    0xee9299,
-    0xee929a,
-    0xee929b,
-    0xee929c,
-    0xee929d,
-    0xee929e,
-    0xee929f,
-    0xee92a0,
-    0xee92a1,
-    0xee92a2,
-    0xee92a3,
-    0xee92a4,
-    0xee92a5,
-    0xee92a6,
-    0xee92a7,
-    0xee92a8,
-    0xee92a9,
-    0xee92aa,
-    0xee92ab,
-    0xee92ac,
-    0xee92ad,
-    0xee92ae,
-    0xee92af,
-    0xee92b0,
-    0xee92b1,
-    0xee92b2,
-    0xee92b3,
-    0xee92b4,
-    0xee92b5,
-    0xee92b6,
-    0xee92b7,
-    0xee92b8,
-    0xee92b9,
-    0xee92ba,
-    0xee92bb,
-    0xee92bc,
-    0xee92bd,
-    0xee92be,
-    0xee92bf,
-    0xee9380,
-    0xee9381,
-    0xee9382,
-    0xee9383,
-    0xee9384,
-    0xee9385,
-    0xee9386,
-    0xee9387,
-    0xee9388,
-    0xee9389,
-    0xee938a,
-    0xee938b,
-    0xee938c,
-    0xee938d,
-    0xee938e,
-    0xee938f,
-    0xee9390,
-    0xee9391,
-    0xee9392,
-    0xee9393,
-    0xee9394,
-    0xee9395,
-    0xee9396,
-    0xee9397,
-    0xee9398,
-    0xee9399,
-    0xee939a,
-    0xee939b,
-    0xee939c,
-    0xee939d,
-    0xee939e,
-    0xee939f,
-    0xee93a0,
-    0xee93a1,
-    0xee93a2,
-    0xee93a3,
-    0xee93a4,
-    0xee93a5,
-    0xee93a6,
-    0xee93a7,
-    0xee93a8,
-    0xee93a9,
-    0xee93aa,
-    0xee93ab,
-    0xee93ac,
-    0xee93ad,
-    0xee93ae,
-    0xee93af,
-    0xee93b0,
-    0xee93b1,
-    0xee93b2,
-    0xee93b3,
-    0xee93b4,
-    0xee93b5,
-    0xee93b6,
-    0xee93b7,
-    0xee93b8,
-    0xee93b9,
-    0xee93ba,
-    0xee93bb,
-    0xee93bc,
-    0xee93bd,
-    0xee93be,
-    0xee93bf,
-    0xee9480,
-    0xee9481,
-    0xee9482,
-    0xee9483,
-    0xee9484,
-    0xee9485,
-    0xee9486,
-    0xee9487,
-    0xee9488,
-    0xee9489,
-    0xee948a,
-    0xee948b,
-    0xee948c,
-    0xee948d,
-    0xee948e,
-    0xee948f,
-    0xee9490,
-    0xee9491,
-    0xee9492,
-    0xee9493,
-    0xee9494,
-    0xee9495,
-    0xee9496,
-    0xee9497,
-    0xee9498,
-    0xee9499,
-    0xee949a,
-    0xee949b,
-    0xee949c,
-    0xee949d,
-    0xee949e,
-    0xee949f,
-    0xee94a0,
-    0xee94a1,
-    0xee94a2,
-    0xee94a3,
-    0xee94a4,
-    0xee94a5,
-    0xee94a6,
-    0xee94a7,
-    0xee94a8,
-    0xee94a9,
-    0xee94aa,
-    0xee94ab,
-    0xee94ac,
-    0xee94ad,
-    0xee94ae,
-    0xee94af,
-    0xee94b0,
-    0xee94b1,
-    0xee94b2,
-    0xee94b3,
-    0xee94b4,
-    0xee94b5,
-    0xee94b6,
-    0xee94b7,
-    0xee94b8,
-    0xee94b9,
-    0xee94ba,
-    0xee94bb,
-    0xee94bc,
-    0xee94bd,
-    0xee94be,
-    0xee94bf,
-    0xee9580,
-    0xee9581,
-    0xee9582,
-    0xee9583,
-    0xee9584,
-    0xee9585,
-    0xee9586,
-    0xee9587,
-    0xee9588,
-    0xee9589,
-    0xee958a,
-    0xee958b,
-    0xee958c,
-    0xee958d,
-    0xee958e,
-    0xee958f,
-    0xee9590,
-    0xee9591,
-    0xee9592,
-    0xee9593,
-    0xee9594,
-    0xee9595,
-    0xee9596,
-    0xee9597,
-    0xee9598,
-    0xee9599,
-    0xee959a,
-    0xee959b,
-    0xee959c,
-    0xee959d,
-    0xee959e,
-    0xee959f,
-    0xee95a0,
-    0xee95a1,
-    0xee95a2,
-    0xee95a3,
-    0xee95a4,
-    0xee95a5,
-    0xee95a6,
-    0xee95a7,
-    0xee95a8,
-    0xee95a9,
-    0xee95aa,
-    0xee95ab,
-    0xee95ac,
-    0xee95ad,
-    0xee95ae,
-    0xee95af,
-    0xee95b0,
-    0xee95b1,
-    0xee95b2,
-    0xee95b3,
-    0xee95b4,
-    0xee95b5,
-    0xee95b6,
-    0xee95b7,
-    0xee95b8,
-    0xee95b9,
-    0xee95ba,
-    0xee95bb,
-    0xee95bc,
-    0xee95bd,
-    0xee95be,
-    0xee95bf,
-    0xee9680,
-    0xee9681,
-    0xee9682,
-    0xee9683,
-    0xee9684,
-    0xee9685,
-    0xee9686,
-    0xee9687,
-    0xee9688,
-    0xee9689,
-    0xee968a,
-    0xee968b,
-    0xee968c,
-    0xee968d,
-    0xee968e,
-    0xee968f,
-    0xee9690,
-    0xee9691,
-    0xee9692,
-    0xee9693,
-    0xee9694,
-    0xee9695,
-    0xee9696,
-    0xee9697,
-    0xee9698,
-    0xee9699,
-    0xee969a,
-    0xee969b,
-    0xee969c,
-    0xee969d,
-    0xee969e,
-    0xee969f,
-    0xee96a0,
-    0xee96a1,
-    0xee96a2,
-    0xee96a3,
-    0xee96a4,
-    0xee96a5,
-    0xee96a6,
-    0xee96a7,
-    0xee96a8,
-    0xee96a9,
-    0xee96aa,
-    0xee96ab,
-    0xee96ac,
-    0xee96ad,
-    0xee96ae,
-    0xee96af,
-    0xee96b0,
-    0xee96b1,
-    0xee96b2,
-    0xee96b3,
-    0xee96b4,
-    0xee96b5,
-    0xee96b6,
-    0xee96b7,
-    0xee96b8,
-    0xee96b9,
-    0xee96ba,
-    0xee96bb,
-    0xee96bc,
-    0xee96bd,
-    0xee96be,
-    0xee96bf,
-    0xee9780,
-    0xee9781,
-    0xee9782,
-    0xee9783,
-    0xee9784,
-    0xee9785,
-    0xee9786,
-    0xee9787,
-    0xee9788,
-    0xee9789,
-    0xee978a,
-    0xee978b,
-    0xee978c,
-    0xee978d,
-    0xee978e,
-    0xee978f,
-    0xee9790,
-    0xee9791,
-    0xee9792,
-    0xee9793,
-    0xee9794,
-    0xee9795,
-    0xee9796,
-    0xee9797,
-    0xee9798,
-    0xee9799,
-    0xee979a,
-    0xee979b,
-    0xee979c,
-    0xee979d,
-    0xee979e,
-    0xee979f,
-    0xee97a0,
-    0xee97a1,
-    0xee97a2,
-    0xee97a3,
-    0xee97a4,
-    0xee97a5,
-    0xee97a6,
-    0xee97a7,
-    0xee97a8,
-    0xee97a9,
-    0xee97aa,
-    0xee97ab,
-    0xee97ac,
-    0xee97ad,
-    0xee97ae,
-    0xee97af,
-    0xee97b0,
-    0xee97b1,
-    0xee97b2,
-    0xee97b3,
-    0xee97b4,
-    0xee97b5,
-    0xee97b6,
-    0xee97b7,
-    0xee97b8,
-    0xee97b9,
-    0xee97ba,
-    0xee97bb,
-    0xee97bc,
-    0xee97bd,
-    0xee97be,
-    0xee97bf,
-    0xee9880,
-    0xee9881,
-    0xee9882,
-    0xee9883,
-    0xee9884,
-    0xee9885,
-    0xee9886,
-    0xee9887,
-    0xee9888,
-    0xee9889,
-    0xee988a,
-    0xee988b,
-    0xee988c,
-    0xee988d,
-    0xee988e,
-    0xee988f,
-    0xee9890,
-    0xee9891,
-    0xee9892,
-    0xee9893,
-    0xee9894,
-    0xee9895,
-    0xee9896,
-    0xee9897,
-    0xee9898,
-    0xee9899,
-    0xee989a,
-    0xee989b,
-    0xee989c,
-    0xee989d,
-    0xee989e,
-    0xee989f,
-    0xee98a0,
-    0xee98a1,
-    0xee98a2,
-    0xee98a3,
-    0xee98a4,
-    0xee98a5,
-    0xee98a6,
-    0xee98a7,
-    0xee98a8,
-    0xee98a9,
-    0xee98aa,
-    0xee98ab,
-    0xee98ac,
-    0xee98ad,
-    0xee98ae,
-    0xee98af,
-    0xee98b0,
-    0xee98b1,
-    0xee98b2,
-    0xee98b3,
-    0xee98b4,
-    0xee98b5,
-    0xee98b6,
-    0xee98b7,
-    0xee98b8,
-    0xee98b9,
-    0xee98ba,
-    0xee98bb,
-    0xee98bc,
-    0xee98bd,
-    0xee98be,
-    0xee98bf,
-    0xee9980,
-    0xee9981,
-    0xee9982,
-    0xee9983,
-    0xee9984,
-    0xee9985,
-    0xee9986,
-    0xee9987,
-    0xee9988,
-    0xee9989,
-    0xee998a,
-    0xee998b,
-    0xee998c,
-    0xee998d,
-    0xee998e,
-    0xee998f,
-    0xee9990,
-    0xee9991,
-    0xee9992,
-    0xee9993,
-    0xee9994,
-    0xee9995,
-    0xee9996,
-    0xee9997,
-    0xee9998,
-    0xee9999,
-    0xee999a,
-    0xee999b,
-    0xee999c,
-    0xee999d,
-    0xee999e,
-    0xee999f,
-    0xee99a0,
-    0xee99a1,
-    0xee99a2,
-    0xee99a3,
-    0xee99a4,
-    0xee99a5,
-    0xee99a6,
-    0xee99a7,
-    0xee99a8,
-    0xee99a9,
-    0xee99aa,
-    0xee99ab,
-    0xee99ac,
-    0xee99ad,
-    0xee99ae,
-    0xee99af,
-    0xee99b0,
-    0xee99b1,
-    0xee99b2,
-    0xee99b3,
-    0xee99b4,
-    0xee99b5,
-    0xee99b6,
-    0xee99b7,
-    0xee99b8,
-    0xee99b9,
-    0xee99ba,
-    0xee99bb,
-    0xee99bc,
-    0xee99bd,
-    0xee99be,
-    0xee99bf,
-    0xee9a80,
-    0xee9a81,
-    0xee9a82,
-    0xee9a83,
-    0xee9a84,
-    0xee9a85,
-    0xee9a86,
-    0xee9a87,
-    0xee9a88,
-    0xee9a89,
-    0xee9a8a,
-    0xee9a8b,
-    0xee9a8c,
-    0xee9a8d,
-    0xee9a8e,
-    0xee9a8f,
-    0xee9a90,
-    0xee9a91,
-    0xee9a92,
-    0xee9a93,
-    0xee9a94,
-    0xee9a95,
-    0xee9a96,
-    0xee9a97,
-    0xee9a98,
-    0xee9a99,
-    0xee9a9a,
-    0xee9a9b,
-    0xee9a9c,
-    0xee9a9d,
-    0xee9a9e,
-    0xee9a9f,
-    0xee9aa0,
-    0xee9aa1,
-    0xee9aa2,
-    0xee9aa3,
-    0xee9aa4,
-    0xee9aa5,
-    0xee9aa6,
-    0xee9aa7,
-    0xee9aa8,
-    0xee9aa9,
-    0xee9aaa,
-    0xee9aab,
-    0xee9aac,
-    0xee9aad,
-    0xee9aae,
-    0xee9aaf,
-    0xee9ab0,
-    0xee9ab1,
-    0xee9ab2,
-    0xee9ab3,
-    0xee9ab4,
-    0xee9ab5,
-    0xee9ab6,
-    0xee9ab7,
-    0xee9ab8,
-    0xee9ab9,
-    0xee9aba,
-    0xee9abb,
-    0xee9abc,
-    0xee9abd,
-    0xee9abe,
-    0xee9abf,
-    0xee9b80,
-    0xee9b81,
-    0xee9b82,
-    0xee9b83,
-    0xee9b84,
-    0xee9b85,
-    0xee9b86,
-    0xee9b87,
-    0xee9b88,
-    0xee9b89,
-    0xee9b8a,
-    0xee9b8b,
-    0xee9b8c,
-    0xee9b8d,
-    0xee9b8e,
-    0xee9b8f,
-    0xee9b90,
-    0xee9b91,
-    0xee9b92,
-    0xee9b93,
-    0xee9b94,
-    0xee9b95,
-    0xee9b96,
-    0xee9b97,
-    0xee9b98,
-    0xee9b99,
-    0xee9b9a,
-    0xee9b9b,
-    0xee9b9c,
-    0xee9b9d,
-    0xee9b9e,
-    0xee9b9f,
-    0xee9ba0,
-    0xee9ba1,
-    0xee9ba2,
-    0xee9ba3,
-    0xee9ba4,
-    0xee9ba5,
-    0xee9ba6,
-    0xee9ba7,
-    0xee9ba8,
-    0xee9ba9,
-    0xee9baa,
-    0xee9bab,
-    0xee9bac,
-    0xee9bad,
-    0xee9bae,
-    0xee9baf,
-    0xee9bb0,
-    0xee9bb1,
-    0xee9bb2,
-    0xee9bb3,
-    0xee9bb4,
-    0xee9bb5,
-    0xee9bb6,
-    0xee9bb7,
-    0xee9bb8,
-    0xee9bb9,
-    0xee9bba,
-    0xee9bbb,
-    0xee9bbc,
-    0xee9bbd,
-    0xee9bbe,
-    0xee9bbf,
-    0xee9c80,
-    0xee9c81,
-    0xee9c82,
-    0xee9c83,
-    0xee9c84,
-    0xee9c85,
-    0xee9c86,
-    0xee9c87,
-    0xee9c88,
-    0xee9c89,
-    0xee9c8a,
-    0xee9c8b,
-    0xee9c8c,
-    0xee9c8d,
-    0xee9c8e,
-    0xee9c8f,
-    0xee9c90,
-    0xee9c91,
-    0xee9c92,
-    0xee9c93,
-    0xee9c94,
-    0xee9c95,
-    0xee9c96,
-    0xee9c97,
-    0xee9c98,
-    0xee9c99,
-    0xee9c9a,
-    0xee9c9b,
-    0xee9c9c,
-    0xee9c9d,
-    0xee9c9e,
-    0xee9c9f,
-    0xee9ca0,
-    0xee9ca1,
-    0xee9ca2,
-    0xee9ca3,
-    0xee9ca4,
-    0xee9ca5,
-    0xee9ca6,
-    0xee9ca7,
-    0xee9ca8,
-    0xee9ca9,
-    0xee9caa,
-    0xee9cab,
-    0xee9cac,
-    0xee9cad,
-    0xee9cae,
-    0xee9caf,
-    0xee9cb0,
-    0xee9cb1,
-    0xee9cb2,
-    0xee9cb3,
-    0xee9cb4,
-    0xee9cb5,
-    0xee9cb6,
-    0xee9cb7,
-    0xee9cb8,
-    0xee9cb9,
-    0xee9cba,
-    0xee9cbb,
-    0xee9cbc,
-    0xee9cbd,
-    0xee9cbe,
-    0xee9cbf,
-    0xee9d80,
-    0xee9d81,
-    0xee9d82,
-    0xee9d83,
-    0xee9d84,
-    0xee9d85,
-    0xee9d86,
-    0xee9d87,
-    0xee9d88,
-    0xee9d89,
-    0xee9d8a,
-    0xee9d8b,
-    0xee9d8c,
-    0xee9d8d,
-    0xee9d8e,
-    0xee9d8f,
-    0xee9d90,
-    0xee9d91,
-    0xee9d92,
-    0xee9d93,
-    0xee9d94,
-    0xee9d95,
-    0xee9d96,
-    0xee9d97,
-    0xee9d98,
-    0xee9d99,
-    0xee9d9a,
-    0xee9d9b,
-    0xee9d9c,
-    0xee9d9d,
-    0xee9d9e,
-    0xee9d9f,
-    0xee9da0,
-    0xee9da1,
-    0xee9da2,
-    0xee9da3,
-    0xee9da4,
-    0xee9da5,
-    0xee9da6,
-    0xee9da7,
-    0xee9da8,
-    0xee9da9,
-    0xee9daa,
-    0xee9dab,
-    0xee9dac,
-    0xee9dad,
-    0xee9dae,
-    0xee9daf,
-    0xee9db0,
-    0xee9db1,
-    0xee9db2,
-    0xee9db3,
-    0xee9db4,
-    0xee9db5,
-    0xee9db6,
-    0xee9db7,
-    0xee9db8,
-    0xee9db9,
-    0xee9dba,
-    0xee9dbb,
-    0xee9dbc,
-    0xee9dbd,
-    0xee9dbe,
-    0xee9dbf,
-    0xee9e80,
-    0xee9e81,
-    0xee9e82,
-    0xee9e83,
-    0xee9e84,
-    0xee9e85,
-    0xee9e86,
-    0xee9e87,
-    0xee9e88,
-    0xee9e89,
-    0xee9e8a,
-    0xee9e8b,
-    0xee9e8c,
-    0xee9e8d,
-    0xee9e8e,
-    0xee9e8f,
-    0xee9e90,
-    0xee9e91,
-    0xee9e92,
-    0xee9e93,
-    0xee9e94,
-    0xee9e95,
-    0xee9e96,
-    0xee9e97,
-    0xee9e98,
-    0xee9e99,
-    0xee9e9a,
-    0xee9e9b,
-    0xee9e9c,
-    0xee9e9d,
-    0xee9e9e,
-    0xee9e9f,
-    0xee9ea0,
-    0xee9ea1,
-    0xee9ea2,
-    0xee9ea3,
-    0xee9ea4,
-    0xee9ea5,
-    0xee9ea6,
-    0xee9ea7,
-    0xee9ea8,
-    0xee9ea9,
-    0xee9eaa,
-    0xee9eab,
-    0xee9eac,
-    0xee9ead,
-    0xee9eae,
-    0xee9eaf,
-    0xee9eb0,
-    0xee9eb1,
-    0xee9eb2,
-    0xee9eb3,
-    0xee9eb4,
-    0xee9eb5,
-    0xee9eb6,
-    0xee9eb7,
-    0xee9eb8,
-    0xee9eb9,
-    0xee9eba,
-    0xee9ebb,
-    0xee9ebc,
-    0xee9ebd,
-    0xee9ebe,
-    0xee9ebf,
-    0xee9f80,
-    0xee9f81,
-    0xee9f82,
-    0xee9f83,
-    0xee9f84,
-    0xee9f85,
-    0xee9f86,
-    0xee9f87,
-    0xee9f88,
-    0xee9f89,
-    0xee9f8a,
-    0xee9f8b,
-    0xee9f8c,
-    0xee9f8d,
-    0xee9f8e,
-    0xee9f8f,
-    0xee9f90,
-    0xee9f91,
-    0xee9f92,
-    0xee9f93,
-    0xee9f94,
-    0xee9f95,
-    0xee9f96,
-    0xee9f97,
-    0xee9f98,
-    0xee9f99,
-    0xee9f9a,
-    0xee9f9b,
-    0xee9f9c,
-    0xee9f9d,
-    0xee9f9e,
-    0xee9f9f,
-    0xee9fa0,
-    0xee9fa1,
-    0xee9fa2,
-    0xee9fa3,
-    0xee9fa4,
-    0xee9fa5,
-    0xee9fa6,
-    0xee9fa7,
-    0xee9fa8,
-    0xee9fa9,
-    0xee9faa,
-    0xee9fab,
-    0xee9fac,
-    0xee9fad,
-    0xee9fae,
-    0xee9faf,
-    0xee9fb0,
-    0xee9fb1,
-    0xee9fb2,
-    0xee9fb3,
-    0xee9fb4,
-    0xee9fb5,
-    0xee9fb6,
-    0xee9fb7,
-    0xee9fb8,
-    0xee9fb9,
-    0xee9fba,
-    0xee9fbb,
-    0xee9fbc,
-    0xee9fbd,
-    0xee9fbe,
-    0xee9fbf,
-    0xeea080,
-    0xeea081,
-    0xeea082,
-    0xeea083,
-    0xeea084,
-    0xeea085,
-    0xeea086,
-    0xeea087,
-    0xeea088,
-    0xeea089,
-    0xeea08a,
-    0xeea08b,
-    0xeea08c,
-    0xeea08d,
-    0xeea08e,
-    0xeea08f,
-    0xeea090,
-    0xeea091,
-    0xeea092,
-    0xeea093,
-    0xeea094,
-    0xeea095,
-    0xeea096,
-    0xeea097,
-    0xeea098,
-    0xeea099,
-    0xeea09a,
-    0xeea09b,
-    0xeea09c,
-    0xeea09d,
-    0xeea09e,
-    0xeea09f,
-    0xeea0a0,
-    0xeea0a1,
-    0xeea0a2,
-    0xeea0a3,
-    0xeea0a4,
-    0xeea0a5,
-    0xeea0a6,
-    0xeea0a7,
-    0xeea0a8,
-    0xeea0a9,
-    0xeea0aa,
-    0xeea0ab,
-    0xeea0ac,
-    0xeea0ad,
-    0xeea0ae,
-    0xeea0af,
-    0xeea0b0,
-    0xeea0b1,
-    0xeea0b2,
-    0xeea0b3,
-    0xeea0b4,
-    0xeea0b5,
-    0xeea0b6,
-    0xeea0b7,
-    0xeea0b8,
-    0xeea0b9,
-    0xeea0ba,
-    0xeea0bb,
-    0xeea0bc,
-    0xeea0bd,
-    0xeea0be,
-    0xeea0bf,
-    0xeea180,
-    0xeea181,
-    0xeea182,
-    0xeea183,
-    0xeea184,
-    0xeea185,
-    0xeea186,
-    0xeea187,
-    0xeea188,
-    0xeea189,
-    0xeea18a,
-    0xeea18b,
-    0xeea18c,
-    0xeea18d,
-    0xeea18e,
-    0xeea18f,
-    0xeea190,
-    0xeea191,
-    0xeea192,
-    0xeea193,
-    0xeea194,
-    0xeea195,
-    0xeea196,
-    0xeea197,
-    0xeea198,
-    0xeea199,
-    0xeea19a,
-    0xeea19b,
-    0xeea19c,
-    0xeea19d,
-    0xeea19e,
-    0xeea19f,
-    0xeea1a0,
-    0xeea1a1,
-    0xeea1a2,
-    0xeea1a3,
-    0xeea1a4,
-    0xeea1a5,
-    0xeea1a6,
-    0xeea1a7,
-    0xeea1a8,
-    0xeea1a9,
-    0xeea1aa,
-    0xeea1ab,
-    0xeea1ac,
-    0xeea1ad,
-    0xeea1ae,
-    0xeea1af,
-    0xeea1b0,
-    0xeea1b1,
-    0xeea1b2,
-    0xeea1b3,
-    0xeea1b4,
-    0xeea1b5,
-    0xeea1b6,
-    0xeea1b7,
-    0xeea1b8,
-    0xeea1b9,
-    0xeea1ba,
-    0xeea1bb,
-    0xeea1bc,
-    0xeea1bd,
-    0xeea1be,
-    0xeea1bf,
-    0xeea280,
-    0xeea281,
-    0xeea282,
-    0xeea283,
-    0xeea284,
-    0xeea285,
-    0xeea286,
-    0xeea287,
-    0xeea288,
-    0xeea289,
-    0xeea28a,
-    0xeea28b,
-    0xeea28c,
-    0xeea28d,
-    0xeea28e,
-    0xeea28f,
-    0xeea290,
-    0xeea291,
-    0xeea292,
-    0xeea293,
-    0xeea294,
-    0xeea295,
-    0xeea296,
-    0xeea297,
-    0xeea298,
-    0xeea299,
-    0xeea29a,
-    0xeea29b,
-    0xeea29c,
-    0xeea29d,
-    0xeea29e,
-    0xeea29f,
-    0xeea2a0,
-    0xeea2a1,
-    0xeea2a2,
-    0xeea2a3,
-    0xeea2a4,
-    0xeea2a5,
-    0xeea2a6,
-    0xeea2a7,
-    0xeea2a8,
-    0xeea2a9,
-    0xeea2aa,
-    0xeea2ab,
-    0xeea2ac,
-    0xeea2ad,
-    0xeea2ae,
-    0xeea2af,
-    0xeea2b0,
-    0xeea2b1,
-    0xeea2b2,
-    0xeea2b3,
-    0xeea2b4,
-    0xeea2b5,
-    0xeea2b6,
-    0xeea2b7,
-    0xeea2b8,
-    0xeea2b9,
-    0xeea2ba,
-    0xeea2bb,
-    0xeea2bc,
-    0xeea2bd,
-    0xeea2be,
-    0xeea2bf,
-    0xeea380,
-    0xeea381,
-    0xeea382,
-    0xeea383,
-    0xeea384,
-    0xeea385,
-    0xeea386,
-    0xeea387,
-    0xeea388,
-    0xeea389,
-    0xeea38a,
-    0xeea38b,
-    0xeea38c,
-    0xeea38d,
-    0xeea38e,
-    0xeea38f,
-    0xeea390,
-    0xeea391,
-    0xeea392,
-    0xeea393,
-    0xeea394,
-    0xeea395,
-    0xeea396,
-    0xeea397,
-    0xeea398,
-    0xeea399,
-    0xeea39a,
-    0xeea39b,
-    0xeea39c,
-    0xeea39d,
-    0xeea39e,
-    0xeea39f,
-    0xeea3a0,
-    0xeea3a1,
-    0xeea3a2,
-    0xeea3a3,
-    0xeea3a4,
-    0xeea3a5,
-    0xeea3a6,
-    0xeea3a7,
-    0xeea3a8,
-    0xeea3a9,
-    0xeea3aa,
-    0xeea3ab,
-    0xeea3ac,
-    0xeea3ad,
-    0xeea3ae,
-    0xeea3af,
-    0xeea3b0,
-    0xeea3b1,
-    0xeea3b2,
-    0xeea3b3,
-    0xeea3b4,
-    0xeea3b5,
-    0xeea3b6,
-    0xeea3b7,
-    0xeea3b8,
-    0xeea3b9,
-    0xeea3ba,
-    0xeea3bb,
-    0xeea3bc,
-    0xeea3bd,
-    0xeea3be,
-    0xeea3bf,
-    0xeea480,
-    0xeea481,
-    0xeea482,
-    0xeea483,
-    0xeea484,
-    0xeea485,
-    0xeea486,
-    0xeea487,
-    0xeea488,
-    0xeea489,
-    0xeea48a,
-    0xeea48b,
-    0xeea48c,
-    0xeea48d,
-    0xeea48e,
-    0xeea48f,
-    0xeea490,
-    0xeea491,
-    0xeea492,
-    0xeea493,
-    0xeea494,
-    0xeea495,
-    0xeea496,
-    0xeea497,
-    0xeea498,
-    0xeea499,
-    0xeea49a,
-    0xeea49b,
-    0xeea49c,
-    0xeea49d,
-    0xeea49e,
-    0xeea49f,
-    0xeea4a0,
-    0xeea4a1,
-    0xeea4a2,
-    0xeea4a3,
-    0xeea4a4,
-    0xeea4a5,
-    0xeea4a6,
-    0xeea4a7,
-    0xeea4a8,
-    0xeea4a9,
-    0xeea4aa,
-    0xeea4ab,
-    0xeea4ac,
-    0xeea4ad,
-    0xeea4ae,
-    0xeea4af,
-    0xeea4b0,
-    0xeea4b1,
-    0xeea4b2,
-    0xeea4b3,
-    0xeea4b4,
-    0xeea4b5,
-    0xeea4b6,
-    0xeea4b7,
-    0xeea4b8,
-    0xeea4b9,
-    0xeea4ba,
-    0xeea4bb,
-    0xeea4bc,
-    0xeea4bd,
-    0xeea4be,
-    0xeea4bf,
-    0xeea580,
-    0xeea581,
-    0xeea582,
-    0xeea583,
-    0xeea584,
-    0xeea585,
-    0xeea586,
-    0xeea587,
-    0xeea588,
-    0xeea589,
-    0xeea58a,
-    0xeea58b,
-    0xeea58c,
-    0xeea58d,
-    0xeea58e,
-    0xeea58f,
-    0xeea590,
-    0xeea591,
-    0xeea592,
-    0xeea593,
-    0xeea594,
-    0xeea595,
-    0xeea596,
-    0xeea597,
-    0xeea598,
-    0xeea599,
-    0xeea59a,
-    0xeea59b,
-    0xeea59c,
-    0xeea59d,
-    0xeea59e,
-    0xeea59f,
-    0xeea5a0,
-    0xeea5a1,
-    0xeea5a2,
-    0xeea5a3,
-    0xeea5a4,
-    0xeea5a5,
-    0xeea5a6,
-    0xeea5a7,
-    0xeea5a8,
-    0xeea5a9,
-    0xeea5aa,
-    0xeea5ab,
-    0xeea5ac,
-    0xeea5ad,
-    0xeea5ae,
-    0xeea5af,
-    0xeea5b0,
-    0xeea5b1,
-    0xeea5b2,
-    0xeea5b3,
-    0xeea5b4,
-    0xeea5b5,
-    0xeea5b6,
-    0xeea5b7,
-    0xeea5b8,
-    0xeea5b9,
-    0xeea5ba,
-    0xeea5bb,
-    0xeea5bc,
-    0xeea5bd,
-    0xeea5be,
-    0xeea5bf,
-    0xeea680,
-    0xeea681,
-    0xeea682,
-    0xeea683,
-    0xeea684,
-    0xeea685,
-    0xeea686,
-    0xeea687,
-    0xeea688,
-    0xeea689,
-    0xeea68a,
-    0xeea68b,
-    0xeea68c,
-    0xeea68d,
-    0xeea68e,
-    0xeea68f,
-    0xeea690,
-    0xeea691,
-    0xeea692,
-    0xeea693,
-    0xeea694,
-    0xeea695,
-    0xeea696,
-    0xeea697,
-    0xeea698,
-    0xeea699,
-    0xeea69a,
-    0xeea69b,
-    0xeea69c,
-    0xeea69d,
-    0xeea69e,
-    0xeea69f,
-    0xeea6a0,
-    0xeea6a1,
-    0xeea6a2,
-    0xeea6a3,
-    0xeea6a4,
-    0xeea6a5,
-    0xeea6a6,
-    0xeea6a7,
-    0xeea6a8,
-    0xeea6a9,
-    0xeea6aa,
-    0xeea6ab,
-    0xeea6ac,
-    0xeea6ad,
-    0xeea6ae,
-    0xeea6af,
-    0xeea6b0,
-    0xeea6b1,
-    0xeea6b2,
-    0xeea6b3,
-    0xeea6b4,
-    0xeea6b5,
-    0xeea6b6,
-    0xeea6b7,
-    0xeea6b8,
-    0xeea6b9,
-    0xeea6ba,
-    0xeea6bb,
-    0xeea6bc,
-    0xeea6bd,
-    0xeea6be,
-    0xeea6bf,
-    0xeea780,
-    0xeea781,
-    0xeea782,
-    0xeea783,
-    0xeea784,
-    0xeea785,
-    0xeea786,
-    0xeea787,
-    0xeea788,
-    0xeea789,
-    0xeea78a,
-    0xeea78b,
-    0xeea78c,
-    0xeea78d,
-    0xeea78e,
-    0xeea78f,
-    0xeea790,
-    0xeea791,
-    0xeea792,
-    0xeea793,
-    0xeea794,
-    0xeea795,
-    0xeea796,
-    0xeea797,
-    0xeea798,
-    0xeea799,
-    0xeea79a,
-    0xeea79b,
-    0xeea79c,
-    0xeea79d,
-    0xeea79e,
-    0xeea79f,
-    0xeea7a0,
-    0xeea7a1,
-    0xeea7a2,
-    0xeea7a3,
-    0xeea7a4,
-    0xeea7a5,
-    0xeea7a6,
-    0xeea7a7,
-    0xeea7a8,
-    0xeea7a9,
-    0xeea7aa,
-    0xeea7ab,
-    0xeea7ac,
-    0xeea7ad,
-    0xeea7ae,
-    0xeea7af,
-    0xeea7b0,
-    0xeea7b1,
-    0xeea7b2,
-    0xeea7b3,
-    0xeea7b4,
-    0xeea7b5,
-    0xeea7b6,
-    0xeea7b7,
-    0xeea7b8,
-    0xeea7b9,
-    0xeea7ba,
-    0xeea7bb,
-    0xeea7bc,
-    0xeea7bd,
-    0xeea7be,
-    0xeea7bf,
-    0xeea880,
-    0xeea881,
-    0xeea882,
-    0xeea883,
-    0xeea884,
-    0xeea885,
-    0xeea886,
-    0xeea887,
-    0xeea888,
-    0xeea889,
-    0xeea88a,
-    0xeea88b,
-    0xeea88c,
-    0xeea88d,
-    0xeea88e,
-    0xeea88f,
-    0xeea890,
-    0xeea891,
-    0xeea892,
-    0xeea893,
-    0xeea894,
-    0xeea895,
-    0xeea896,
-    0xeea897,
-    0xeea898,
-    0xeea899,
-    0xeea89a,
-    0xeea89b,
-    0xeea89c,
-    0xeea89d,
-    0xeea89e,
-    0xeea89f,
-    0xeea8a0,
-    0xeea8a1,
-    0xeea8a2,
-    0xeea8a3,
-    0xeea8a4,
-    0xeea8a5,
-    0xeea8a6,
-    0xeea8a7,
-    0xeea8a8,
-    0xeea8a9,
-    0xeea8aa,
-    0xeea8ab,
-    0xeea8ac,
-    0xeea8ad,
-    0xeea8ae,
-    0xeea8af,
-    0xeea8b0,
-    0xeea8b1,
-    0xeea8b2,
-    0xeea8b3,
-    0xeea8b4,
-    0xeea8b5,
-    0xeea8b6,
-    0xeea8b7,
-    0xeea8b8,
-    0xeea8b9,
-    0xeea8ba,
-    0xeea8bb,
-    0xeea8bc,
-    0xeea8bd,
-    0xeea8be,
-    0xeea8bf,
-    0xeea980,
-    0xeea981,
-    0xeea982,
-    0xeea983,
-    0xeea984,
-    0xeea985,
-    0xeea986,
-    0xeea987,
-    0xeea988,
-    0xeea989,
-    0xeea98a,
-    0xeea98b,
-    0xeea98c,
-    0xeea98d,
-    0xeea98e,
-    0xeea98f,
-    0xeea990,
-    0xeea991,
-    0xeea992,
-    0xeea993,
-    0xeea994,
-    0xeea995,
-    0xeea996,
-    0xeea997,
-    0xeea998,
-    0xeea999,
-    0xeea99a,
-    0xeea99b,
-    0xeea99c,
-    0xeea99d,
-    0xeea99e,
-    0xeea99f,
-    0xeea9a0,
-    0xeea9a1,
-    0xeea9a2,
-    0xeea9a3,
-    0xeea9a4,
-    0xeea9a5,
-    0xeea9a6,
-    0xeea9a7,
-    0xeea9a8,
-    0xeea9a9,
-    0xeea9aa,
-    0xeea9ab,
-    0xeea9ac,
-    0xeea9ad,
-    0xeea9ae,
-    0xeea9af,
-    0xeea9b0,
-    0xeea9b1,
-    0xeea9b2,
-    0xeea9b3,
-    0xeea9b4,
-    0xeea9b5,
-    0xeea9b6,
-    0xeea9b7,
-    0xeea9b8,
-    0xeea9b9,
-    0xeea9ba,
-    0xeea9bb,
-    0xeea9bc,
-    0xeea9bd,
-    0xeea9be,
-    0xeea9bf,
-    0xeeaa80,
-    0xeeaa81,
-    0xeeaa82,
-    0xeeaa83,
-    0xeeaa84,
-    0xeeaa85,
-    0xeeaa86,
-    0xeeaa87,
-    0xeeaa88,
-    0xeeaa89,
-    0xeeaa8a,
-    0xeeaa8b,
-    0xeeaa8c,
-    0xeeaa8d,
-    0xeeaa8e,
-    0xeeaa8f,
-    0xeeaa90,
-    0xeeaa91,
-    0xeeaa92,
-    0xeeaa93,
-    0xeeaa94,
-    0xeeaa95,
-    0xeeaa96,
-    0xeeaa97,
-    0xeeaa98,
-    0xeeaa99,
-    0xeeaa9a,
-    0xeeaa9b,
-    0xeeaa9c,
-    0xeeaa9d,
-    0xeeaa9e,
-    0xeeaa9f,
-    0xeeaaa0,
-    0xeeaaa1,
-    0xeeaaa2,
-    0xeeaaa3,
-    0xeeaaa4,
-    0xeeaaa5,
-    0xeeaaa6,
-    0xeeaaa7,
-    0xeeaaa8,
-    0xeeaaa9,
-    0xeeaaaa,
-    0xeeaaab,
-    0xeeaaac,
-    0xeeaaad,
-    0xeeaaae,
-    0xeeaaaf,
-    0xeeaab0,
-    0xeeaab1,
-    0xeeaab2,
-    0xeeaab3,
-    0xeeaab4,
-    0xeeaab5,
-    0xeeaab6,
-    0xeeaab7,
-    0xeeaab8,
-    0xeeaab9,
-    0xeeaaba,
-    0xeeaabb,
-    0xeeaabc,
-    0xeeaabd,
-    0xeeaabe,
-    0xeeaabf,
-    0xeeab80,
-    0xeeab81,
-    0xeeab82,
-    0xeeab83,
-    0xeeab84,
-    0xeeab85,
-    0xeeab86,
-    0xeeab87,
-    0xeeab88,
-    0xeeab89,
-    0xeeab8a,
-    0xeeab8b,
-    0xeeab8c,
-    0xeeab8d,
-    0xeeab8e,
-    0xeeab8f,
-    0xeeab90,
-    0xeeab91,
-    0xeeab92,
-    0xeeab93,
-    0xeeab94,
-    0xeeab95,
-    0xeeab96,
-    0xeeab97,
-    0xeeab98,
-    0xeeab99,
-    0xeeab9a,
-    0xeeab9b,
-    0xeeab9c,
-    0xeeab9d,
-    0xeeab9e,
-    0xeeab9f,
-    0xeeaba0,
-    0xeeaba1,
-    0xeeaba2,
-    0xeeaba3,
-    0xeeaba4,
-    0xeeaba5,
-    0xeeaba6,
-    0xeeaba7,
-    0xeeaba8,
-    0xeeaba9,
-    0xeeabaa,
-    0xeeabab,
-    0xeeabac,
-    0xeeabad,
-    0xeeabae,
-    0xeeabaf,
-    0xeeabb0,
-    0xeeabb1,
-    0xeeabb2,
-    0xeeabb3,
-    0xeeabb4,
-    0xeeabb5,
-    0xeeabb6,
-    0xeeabb7,
-    0xeeabb8,
-    0xeeabb9,
-    0xeeabba,
-    0xeeabbb,
-    0xeeabbc,
-    0xeeabbd,
-    0xeeabbe,
-    0xeeabbf,
-    0xeeac80,
-    0xeeac81,
-    0xeeac82,
-    0xeeac83,
-    0xeeac84,
-    0xeeac85,
-    0xeeac86,
-    0xeeac87,
-    0xeeac88,
-    0xeeac89,
-    0xeeac8a,
-    0xeeac8b,
-    0xeeac8c,
-    0xeeac8d,
-    0xeeac8e,
-    0xeeac8f,
-    0xeeac90,
-    0xeeac91,
-    0xeeac92,
-    0xeeac93,
-    0xeeac94,
-    0xeeac95,
-    0xeeac96,
-    0xeeac97,
-    0xeeac98,
-    0xeeac99,
-    0xeeac9a,
-    0xeeac9b,
-    0xeeac9c,
-    0xeeac9d,
-    0xeeac9e,
-    0xeeac9f,
-    0xeeaca0,
-    0xeeaca1,
-    0xeeaca2,
-    0xeeaca3,
-    0xeeaca4,
-    0xeeaca5,
-    0xeeaca6,
-    0xeeaca7,
-    0xeeaca8,
-    0xeeaca9,
-    0xeeacaa,
-    0xeeacab,
-    0xeeacac,
-    0xeeacad,
-    0xeeacae,
-    0xeeacaf,
-    0xeeacb0,
-    0xeeacb1,
-    0xeeacb2,
-    0xeeacb3,
-    0xeeacb4,
-    0xeeacb5,
-    0xeeacb6,
-    0xeeacb7,
-    0xeeacb8,
-    0xeeacb9,
-    0xeeacba,
-    0xeeacbb,
-    0xeeacbc,
-    0xeeacbd,
-    0xeeacbe,
-    0xeeacbf,
-    0xeead80,
-    0xeead81,
-    0xeead82,
-    0xeead83,
-    0xeead84,
-    0xeead85,
-    0xeead86,
-    0xeead87,
-    0xeead88,
-    0xeead89,
-    0xeead8a,
-    0xeead8b,
-    0xeead8c,
-    0xeead8d,
-    0xeead8e,
-    0xeead8f,
-    0xeead90,
-    0xeead91,
-    0xeead92,
-    0xeead93,
-    0xeead94,
-    0xeead95,
-    0xeead96,
-    0xeead97,
-    0xeead98,
-    0xeead99,
-    0xeead9a,
-    0xeead9b,
-    0xeead9c,
-    0xeead9d,
-    0xeead9e,
-    0xeead9f,
-    0xeeada0,
-    0xeeada1,
-    0xeeada2,
-    0xeeada3,
-    0xeeada4,
-    0xeeada5,
-    0xeeada6,
-    0xeeada7,
-    0xeeada8,
-    0xeeada9,
-    0xeeadaa,
-    0xeeadab,
-    0xeeadac,
-    0xeeadad,
-    0xeeadae,
-    0xeeadaf,
-    0xeeadb0,
-    0xeeadb1,
-    0xeeadb2,
-    0xeeadb3,
-    0xeeadb4,
-    0xeeadb5,
-    0xeeadb6,
-    0xeeadb7,
-    0xeeadb8,
-    0xeeadb9,
-    0xeeadba,
-    0xeeadbb,
-    0xeeadbc,
-    0xeeadbd,
-    0xeeadbe,
-    0xeeadbf,
-    0xeeae80,
-    0xeeae81,
-    0xeeae82,
-    0xeeae83,
-    0xeeae84,
-    0xeeae85,
-    0xeeae86,
-    0xeeae87,
-    0xeeae88,
-    0xeeae89,
-    0xeeae8a,
-    0xeeae8b,
-    0xeeae8c,
-    0xeeae8d,
-    0xeeae8e,
-    0xeeae8f,
-    0xeeae90,
-    0xeeae91,
-    0xeeae92,
-    0xeeae93,
-    0xeeae94,
-    0xeeae95,
-    0xeeae96,
-    0xeeae97,
-    0xeeae98,
-    0xeeae99,
-    0xeeae9a,
-    0xeeae9b,
-    0xeeae9c,
-    0xeeae9d,
-    0xeeae9e,
-    0xeeae9f,
-    0xeeaea0,
-    0xeeaea1,
-    0xeeaea2,
-    0xeeaea3,
-    0xeeaea4,
-    0xeeaea5,
-    0xeeaea6,
-    0xeeaea7,
-    0xeeaea8,
-    0xeeaea9,
-    0xeeaeaa,
-    0xeeaeab,
-    0xeeaeac,
-    0xeeaead,
-    0xeeaeae,
-    0xeeaeaf,
-    0xeeaeb0,
-    0xeeaeb1,
-    0xeeaeb2,
-    0xeeaeb3,
-    0xeeaeb4,
-    0xeeaeb5,
-    0xeeaeb6,
-    0xeeaeb7,
-    0xeeaeb8,
-    0xeeaeb9,
-    0xeeaeba,
-    0xeeaebb,
-    0xeeaebc,
-    0xeeaebd,
-    0xeeaebe,
-    0xeeaebf,
-    0xeeaf80,
-    0xeeaf81,
-    0xeeaf82,
-    0xeeaf83,
-    0xeeaf84,
-    0xeeaf85,
-    0xeeaf86,
-    0xeeaf87,
-    0xeeaf88,
-    0xeeaf89,
-    0xeeaf8a,
-    0xeeaf8b,
-    0xeeaf8c,
-    0xeeaf8d,
-    0xeeaf8e,
-    0xeeaf8f,
-    0xeeaf90,
-    0xeeaf91,
-    0xeeaf92,
-    0xeeaf93,
-    0xeeaf94,
-    0xeeaf95,
-    0xeeaf96,
-    0xeeaf97,
-    0xeeaf98,
-    0xeeaf99,
-    0xeeaf9a,
-    0xeeaf9b,
-    0xeeaf9c,
-    0xeeaf9d,
-    0xeeaf9e,
-    0xeeaf9f,
-    0xeeafa0,
-    0xeeafa1,
-    0xeeafa2,
-    0xeeafa3,
-    0xeeafa4,
-    0xeeafa5,
-    0xeeafa6,
-    0xeeafa7,
-    0xeeafa8,
-    0xeeafa9,
-    0xeeafaa,
-    0xeeafab,
-    0xeeafac,
-    0xeeafad,
-    0xeeafae,
-    0xeeafaf,
-    0xeeafb0,
-    0xeeafb1,
-    0xeeafb2,
-    0xeeafb3,
-    0xeeafb4,
-    0xeeafb5,
-    0xeeafb6,
-    0xeeafb7,
-    0xeeafb8,
-    0xeeafb9,
-    0xeeafba,
-    0xeeafbb,
-    0xeeafbc,
-    0xeeafbd,
-    0xeeafbe,
-    0xeeafbf,
-    0xeeb080,
-    0xeeb081,
-    0xeeb082,
-    0xeeb083,
-    0xeeb084,
-    0xeeb085,
-    0xeeb086,
-    0xeeb087,
-    0xeeb088,
-    0xeeb089,
-    0xeeb08a,
-    0xeeb08b,
-    0xeeb08c,
-    0xeeb08d,
-    0xeeb08e,
-    0xeeb08f,
-    0xeeb090,
-    0xeeb091,
-    0xeeb092,
-    0xeeb093,
-    0xeeb094,
-    0xeeb095,
-    0xeeb096,
-    0xeeb097,
-    0xeeb098,
-    0xeeb099,
-    0xeeb09a,
-    0xeeb09b,
-    0xeeb09c,
-    0xeeb09d,
-    0xeeb09e,
-    0xeeb09f,
-    0xeeb0a0,
-    0xeeb0a1,
-    0xeeb0a2,
-    0xeeb0a3,
-    0xeeb0a4,
-    0xeeb0a5,
-    0xeeb0a6,
-    0xeeb0a7,
-    0xeeb0a8,
-    0xeeb0a9,
-    0xeeb0aa,
-    0xeeb0ab,
-    0xeeb0ac,
-    0xeeb0ad,
-    0xeeb0ae,
-    0xeeb0af,
-    0xeeb0b0,
-    0xeeb0b1,
-    0xeeb0b2,
-    0xeeb0b3,
-    0xeeb0b4,
-    0xeeb0b5,
-    0xeeb0b6,
-    0xeeb0b7,
-    0xeeb0b8,
-    0xeeb0b9,
-    0xeeb0ba,
-    0xeeb0bb,
-    0xeeb0bc,
-    0xeeb0bd,
-    0xeeb0be,
-    0xeeb0bf,
-    0xeeb180,
-    0xeeb181,
-    0xeeb182,
-    0xeeb183,
-    0xeeb184,
-    0xeeb185,
-    0xeeb186,
-    0xeeb187,
-    0xeeb188,
-    0xeeb189,
-    0xeeb18a,
-    0xeeb18b,
-    0xeeb18c,
-    0xeeb18d,
-    0xeeb18e,
-    0xeeb18f,
-    0xeeb190,
-    0xeeb191,
-    0xeeb192,
-    0xeeb193,
-    0xeeb194,
-    0xeeb195,
-    0xeeb196,
-    0xeeb197,
-    0xeeb198,
-    0xeeb199,
-    0xeeb19a,
-    0xeeb19b,
-    0xeeb19c,
-    0xeeb19d,
-    0xeeb19e,
-    0xeeb19f,
-    0xeeb1a0,
-    0xeeb1a1,
-    0xeeb1a2,
-    0xeeb1a3,
-    0xeeb1a4,
-    0xeeb1a5,
-    0xeeb1a6,
-    0xeeb1a7,
-    0xeeb1a8,
-    0xeeb1a9,
-    0xeeb1aa,
-    0xeeb1ab,
-    0xeeb1ac,
-    0xeeb1ad,
-    0xeeb1ae,
-    0xeeb1af,
-    0xeeb1b0,
-    0xeeb1b1,
-    0xeeb1b2,
-    0xeeb1b3,
-    0xeeb1b4,
-    0xeeb1b5,
-    0xeeb1b6,
-    0xeeb1b7,
-    0xeeb1b8,
-    0xeeb1b9,
-    0xeeb1ba,
-    0xeeb1bb,
-    0xeeb1bc,
-    0xeeb1bd,
-    0xeeb1be,
-    0xeeb1bf,
-    0xeeb280,
-    0xeeb281,
-    0xeeb282,
-    0xeeb283,
-    0xeeb284,
-    0xeeb285,
-    0xeeb286,
-    0xeeb287,
-    0xeeb288,
-    0xeeb289,
-    0xeeb28a,
-    0xeeb28b,
-    0xeeb28c,
-    0xeeb28d,
-    0xeeb28e,
-    0xeeb28f,
-    0xeeb290,
-    0xeeb291,
-    0xeeb292,
-    0xeeb293,
-    0xeeb294,
-    0xeeb295,
-    0xeeb296,
-    0xeeb297,
-    0xeeb298,
-    0xeeb299,
-    0xeeb29a,
-    0xeeb29b,
-    0xeeb29c,
-    0xeeb29d,
-    0xeeb29e,
-    0xeeb29f,
-    0xeeb2a0,
-    0xeeb2a1,
-    0xeeb2a2,
-    0xeeb2a3,
-    0xeeb2a4,
-    0xeeb2a5,
-    0xeeb2a6,
-    0xeeb2a7,
-    0xeeb2a8,
-    0xeeb2a9,
-    0xeeb2aa,
-    0xeeb2ab,
-    0xeeb2ac,
-    0xeeb2ad,
-    0xeeb2ae,
-    0xeeb2af,
-    0xeeb2b0,
-    0xeeb2b1,
-    0xeeb2b2,
-    0xeeb2b3,
-    0xeeb2b4,
-    0xeeb2b5,
-    0xeeb2b6,
-    0xeeb2b7,
-    0xeeb2b8,
-    0xeeb2b9,
-    0xeeb2ba,
-    0xeeb2bb,
-    0xeeb2bc,
-    0xeeb2bd,
-    0xeeb2be,
-    0xeeb2bf,
-    0xeeb380,
-    0xeeb381,
-    0xeeb382,
-    0xeeb383,
-    0xeeb384,
-    0xeeb385,
-    0xeeb386,
-    0xeeb387,
-    0xeeb388,
-    0xeeb389,
-    0xeeb38a,
-    0xeeb38b,
-    0xeeb38c,
-    0xeeb38d,
-    0xeeb38e,
-    0xeeb38f,
-    0xeeb390,
-    0xeeb391,
-    0xeeb392,
-    0xeeb393,
-    0xeeb394,
-    0xeeb395,
-    0xeeb396,
-    0xeeb397,
-    0xeeb398,
-    0xeeb399,
-    0xeeb39a,
-    0xeeb39b,
-    0xeeb39c,
-    0xeeb39d,
-    0xeeb39e,
-    0xeeb39f,
-    0xeeb3a0,
-    0xeeb3a1,
-    0xeeb3a2,
-    0xeeb3a3,
-    0xeeb3a4,
-    0xeeb3a5,
-    0xeeb3a6,
-    0xeeb3a7,
-    0xeeb3a8,
-    0xeeb3a9,
-    0xeeb3aa,
-    0xeeb3ab,
-    0xeeb3ac,
-    0xeeb3ad,
-    0xeeb3ae,
-    0xeeb3af,
-    0xeeb3b0,
-    0xeeb3b1,
-    0xeeb3b2,
-    0xeeb3b3,
-    0xeeb3b4,
-    0xeeb3b5,
-    0xeeb3b6,
-    0xeeb3b7,
-    0xeeb3b8,
-    0xeeb3b9,
-    0xeeb3ba,
-    0xeeb3bb,
-    0xeeb3bc,
-    0xeeb3bd,
-    0xeeb3be,
-    0xeeb3bf,
-    0xeeb480,
-    0xeeb481,
-    0xeeb482,
-    0xeeb483,
-    0xeeb484,
-    0xeeb485,
-    0xeeb486,
-    0xeeb487,
-    0xeeb488,
-    0xeeb489,
-    0xeeb48a,
-    0xeeb48b,
-    0xeeb48c,
-    0xeeb48d,
-    0xeeb48e,
-    0xeeb48f,
-    0xeeb490,
-    0xeeb491,
-    0xeeb492,
-    0xeeb493,
-    0xeeb494,
-    0xeeb495,
-    0xeeb496,
-    0xeeb497,
-    0xeeb498,
-    0xeeb499,
-    0xeeb49a,
-    0xeeb49b,
-    0xeeb49c,
-    0xeeb49d,
-    0xeeb49e,
-    0xeeb49f,
-    0xeeb4a0,
-    0xeeb4a1,
-    0xeeb4a2,
-    0xeeb4a3,
-    0xeeb4a4,
-    0xeeb4a5,
-    0xeeb4a6,
-    0xeeb4a7,
-    0xeeb4a8,
-    0xeeb4a9,
-    0xeeb4aa,
-    0xeeb4ab,
-    0xeeb4ac,
-    0xeeb4ad,
-    0xeeb4ae,
-    0xeeb4af,
-    0xeeb4b0,
-    0xeeb4b1,
-    0xeeb4b2,
-    0xeeb4b3,
-    0xeeb4b4,
-    0xeeb4b5,
-    0xeeb4b6,
-    0xeeb4b7,
-    0xeeb4b8,
-    0xeeb4b9,
-    0xeeb4ba,
-    0xeeb4bb,
-    0xeeb4bc,
-    0xeeb4bd,
-    0xeeb4be,
-    0xeeb4bf,
-    0xeeb580,
-    0xeeb581,
-    0xeeb582,
-    0xeeb583,
-    0xeeb584,
-    0xeeb585,
-    0xeeb586,
-    0xeeb587,
-    0xeeb588,
-    0xeeb589,
-    0xeeb58a,
-    0xeeb58b,
-    0xeeb58c,
-    0xeeb58d,
-    0xeeb58e,
-    0xeeb58f,
-    0xeeb590,
-    0xeeb591,
-    0xeeb592,
-    0xeeb593,
-    0xeeb594,
-    0xeeb595,
-    0xeeb596,
-    0xeeb597,
-    0xeeb598,
-    0xeeb599,
-    0xeeb59a,
-    0xeeb59b,
-    0xeeb59c,
-    0xeeb59d,
-    0xeeb59e,
-    0xeeb59f,
-    0xeeb5a0,
-    0xeeb5a1,
-    0xeeb5a2,
-    0xeeb5a3,
-    0xeeb5a4,
-    0xeeb5a5,
-    0xeeb5a6,
-    0xeeb5a7,
-    0xeeb5a8,
-    0xeeb5a9,
-    0xeeb5aa,
-    0xeeb5ab,
-    0xeeb5ac,
-    0xeeb5ad,
-    0xeeb5ae,
-    0xeeb5af,
-    0xeeb5b0,
-    0xeeb5b1,
-    0xeeb5b2,
-    0xeeb5b3,
-    0xeeb5b4,
-    0xeeb5b5,
-    0xeeb5b6,
-    0xeeb5b7,
-    0xeeb5b8,
-    0xeeb5b9,
-    0xeeb5ba,
-    0xeeb5bb,
-    0xeeb5bc,
-    0xeeb5bd,
-    0xeeb5be,
-    0xeeb5bf,
-    0xeeb680,
-    0xeeb681,
-    0xeeb682,
-    0xeeb683,
-    0xeeb684,
-    0xeeb685,
-    0xeeb686,
-    0xeeb687,
-    0xeeb688,
-    0xeeb689,
-    0xeeb68a,
-    0xeeb68b,
-    0xeeb68c,
-    0xeeb68d,
-    0xeeb68e,
-    0xeeb68f,
-    0xeeb690,
-    0xeeb691,
-    0xeeb692,
-    0xeeb693,
-    0xeeb694,
-    0xeeb695,
-    0xeeb696,
-    0xeeb697,
-    0xeeb698,
-    0xeeb699,
-    0xeeb69a,
-    0xeeb69b,
-    0xeeb69c,
-    0xeeb69d,
-    0xeeb69e,
-    0xeeb69f,
-    0xeeb6a0,
-    0xeeb6a1,
-    0xeeb6a2,
-    0xeeb6a3,
-    0xeeb6a4,
-    0xeeb6a5,
-    0xeeb6a6,
-    0xeeb6a7,
-    0xeeb6a8,
-    0xeeb6a9,
-    0xeeb6aa,
-    0xeeb6ab,
-    0xeeb6ac,
-    0xeeb6ad,
-    0xeeb6ae,
-    0xeeb6af,
-    0xeeb6b0,
-    0xeeb6b1,
-    0xeeb6b2,
-    0xeeb6b3,
-    0xeeb6b4,
-    0xeeb6b5,
-    0xeeb6b6,
-    0xeeb6b7,
-    0xeeb6b8,
-    0xeeb6b9,
-    0xeeb6ba,
-    0xeeb6bb,
-    0xeeb6bc,
-    0xeeb6bd,
-    0xeeb6be,
-    0xeeb6bf,
-    0xeeb780,
-    0xeeb781,
-    0xeeb782,
-    0xeeb783,
-    0xeeb784,
-    0xeeb785,
-    0xeeb786,
-    0xeeb787,
-    0xeeb788,
-    0xeeb789,
-    0xeeb78a,
-    0xeeb78b,
-    0xeeb78c,
-    0xeeb78d,
-    0xeeb78e,
-    0xeeb78f,
-    0xeeb790,
-    0xeeb791,
-    0xeeb792,
-    0xeeb793,
-    0xeeb794,
-    0xeeb795,
-    0xeeb796,
-    0xeeb797,
-    0xeeb798,
-    0xeeb799,
-    0xeeb79a,
-    0xeeb79b,
-    0xeeb79c,
-    0xeeb79d,
-    0xeeb79e,
-    0xeeb79f,
-    0xeeb7a0,
-    0xeeb7a1,
-    0xeeb7a2,
-    0xeeb7a3,
-    0xeeb7a4,
-    0xeeb7a5,
-    0xeeb7a6,
-    0xeeb7a7,
-    0xeeb7a8,
-    0xeeb7a9,
-    0xeeb7aa,
-    0xeeb7ab,
-    0xeeb7ac,
-    0xeeb7ad,
-    0xeeb7ae,
-    0xeeb7af,
-    0xeeb7b0,
-    0xeeb7b1,
-    0xeeb7b2,
-    0xeeb7b3,
-    0xeeb7b4,
-    0xeeb7b5,
-    0xeeb7b6,
-    0xeeb7b7,
-    0xeeb7b8,
-    0xeeb7b9,
-    0xeeb7ba,
-    0xeeb7bb,
-    0xeeb7bc,
-    0xeeb7bd,
-    0xeeb7be,
-    0xeeb7bf,
-    0xeeb880,
-    0xeeb881,
-    0xeeb882,
-    0xeeb883,
-    0xeeb884,
-    0xeeb885,
-    0xeeb886,
-    0xeeb887,
-    0xeeb888,
-    0xeeb889,
-    0xeeb88a,
-    0xeeb88b,
-    0xeeb88c,
-    0xeeb88d,
-    0xeeb88e,
-    0xeeb88f,
-    0xeeb890,
-    0xeeb891,
-    0xeeb892,
-    0xeeb893,
-    0xeeb894,
-    0xeeb895,
-    0xeeb896,
-    0xeeb897,
-    0xeeb898,
-    0xeeb899,
-    0xeeb89a,
-    0xeeb89b,
-    0xeeb89c,
-    0xeeb89d,
-    0xeeb89e,
-    0xeeb89f,
-    0xeeb8a0,
-    0xeeb8a1,
-    0xeeb8a2,
-    0xeeb8a3,
-    0xeeb8a4,
-    0xeeb8a5,
-    0xeeb8a6,
-    0xeeb8a7,
-    0xeeb8a8,
-    0xeeb8a9,
-    0xeeb8aa,
-    0xeeb8ab,
-    0xeeb8ac,
-    0xeeb8ad,
-    0xeeb8ae,
-    0xeeb8af,
-    0xeeb8b0,
-    0xeeb8b1,
-    0xeeb8b2,
-    0xeeb8b3,
-    0xeeb8b4,
-    0xeeb8b5,
-    0xeeb8b6,
-    0xeeb8b7,
-    0xeeb8b8,
-    0xeeb8b9,
-    0xeeb8ba,
-    0xeeb8bb,
-    0xeeb8bc,
-    0xeeb8bd,
-    0xeeb8be,
-    0xeeb8bf,
-    0xeeb980,
-    0xeeb981,
-    0xeeb982,
-    0xeeb983,
-    0xeeb984,
-    0xeeb985,
-    0xeeb986,
-    0xeeb987,
-    0xeeb988,
-    0xeeb989,
-    0xeeb98a,
-    0xeeb98b,
-    0xeeb98c,
-    0xeeb98d,
-    0xeeb98e,
-    0xeeb98f,
-    0xeeb990,
-    0xeeb991,
-    0xeeb992,
-    0xeeb993,
-    0xeeb994,
-    0xeeb995,
-    0xeeb996,
-    0xeeb997,
-    0xeeb998,
-    0xeeb999,
-    0xeeb99a,
-    0xeeb99b,
-    0xeeb99c,
-    0xeeb99d,
-    0xeeb99e,
-    0xeeb99f,
-    0xeeb9a0,
-    0xeeb9a1,
-    0xeeb9a2,
-    0xeeb9a3,
-    0xeeb9a4,
-    0xeeb9a5,
-    0xeeb9a6,
-    0xeeb9a7,
-    0xeeb9a8,
-    0xeeb9a9,
-    0xeeb9aa,
-    0xeeb9ab,
-    0xeeb9ac,
-    0xeeb9ad,
-    0xeeb9ae,
-    0xeeb9af,
-    0xeeb9b0,
-    0xeeb9b1,
-    0xeeb9b2,
-    0xeeb9b3,
-    0xeeb9b4,
-    0xeeb9b5,
-    0xeeb9b6,
-    0xeeb9b7,
-    0xeeb9b8,
-    0xeeb9b9,
-    0xeeb9ba,
-    0xeeb9bb,
-    0xeeb9bc,
-    0xeeb9bd,
-    0xeeb9be,
-    0xeeb9bf,
-    0xeeba80,
-    0xeeba81,
-    0xeeba82,
-    0xeeba83,
-    0xeeba84,
-    0xeeba85,
-    0xeeba86,
-    0xeeba87,
-    0xeeba88,
-    0xeeba89,
-    0xeeba8a,
-    0xeeba8b,
-    0xeeba8c,
-    0xeeba8d,
-    0xeeba8e,
-    0xeeba8f,
-    0xeeba90,
-    0xeeba91,
-    0xeeba92,
-    0xeeba93,
-    0xeeba94,
-    0xeeba95,
-    0xeeba96,
-    0xeeba97,
-    0xeeba98,
-    0xeeba99,
-    0xeeba9a,
-    0xeeba9b,
-    0xeeba9c,
-    0xeeba9d,
-    0xeeba9e,
-    0xeeba9f,
-    0xeebaa0,
-    0xeebaa1,
-    0xeebaa2,
-    0xeebaa3,
-    0xeebaa4,
-    0xeebaa5,
-    0xeebaa6,
-    0xeebaa7,
-    0xeebaa8,
-    0xeebaa9,
-    0xeebaaa,
-    0xeebaab,
-    0xeebaac,
-    0xeebaad,
-    0xeebaae,
-    0xeebaaf,
-    0xeebab0,
-    0xeebab1,
-    0xeebab2,
-    0xeebab3,
-    0xeebab4,
-    0xeebab5,
-    0xeebab6,
-    0xeebab7,
-    0xeebab8,
-    0xeebab9,
-    0xeebaba,
-    0xeebabb,
-    0xeebabc,
-    0xeebabd,
-    0xeebabe,
-    0xeebabf,
-    0xeebb80,
-    0xeebb81,
-    0xeebb82,
-    0xeebb83,
-    0xeebb84,
-    0xeebb85,
-    0xeebb86,
-    0xeebb87,
-    0xeebb88,
-    0xeebb89,
-    0xeebb8a,
-    0xeebb8b,
-    0xeebb8c,
-    0xeebb8d,
-    0xeebb8e,
-    0xeebb8f,
-    0xeebb90,
-    0xeebb91,
-    0xeebb92,
-    0xeebb93,
-    0xeebb94,
-    0xeebb95,
-    0xeebb96,
-    0xeebb97,
-    0xeebb98,
-    0xeebb99,
-    0xeebb9a,
-    0xeebb9b,
-    0xeebb9c,
-    0xeebb9d,
-    0xeebb9e,
-    0xeebb9f,
-    0xeebba0,
-    0xeebba1,
-    0xeebba2,
-    0xeebba3,
-    0xeebba4,
-    0xeebba5,
-    0xeebba6,
-    0xeebba7,
-    0xeebba8,
-    0xeebba9,
-    0xeebbaa,
-    0xeebbab,
-    0xeebbac,
-    0xeebbad,
-    0xeebbae,
-    0xeebbaf,
-    0xeebbb0,
-    0xeebbb1,
-    0xeebbb2,
-    0xeebbb3,
-    0xeebbb4,
-    0xeebbb5,
-    0xeebbb6,
-    0xeebbb7,
-    0xeebbb8,
-    0xeebbb9,
-    0xeebbba,
-    0xeebbbb,
-    0xeebbbc,
-    0xeebbbd,
-    0xeebbbe,
-    0xeebbbf,
-    0xeebc80,
-    0xeebc81,
-    0xeebc82,
-    0xeebc83,
-    0xeebc84,
-    0xeebc85,
-    0xeebc86,
-    0xeebc87,
-    0xeebc88,
-    0xeebc89,
-    0xeebc8a,
-    0xeebc8b,
-    0xeebc8c,
-    0xeebc8d,
-    0xeebc8e,
-    0xeebc8f,
-    0xeebc90,
-    0xeebc91,
-    0xeebc92,
-    0xeebc93,
-    0xeebc94,
-    0xeebc95,
-    0xeebc96,
-    0xeebc97,
-    0xeebc98,
-    0xeebc99,
-    0xeebc9a,
-    0xeebc9b,
-    0xeebc9c,
-    0xeebc9d,
-    0xeebc9e,
-    0xeebc9f,
-    0xeebca0,
-    0xeebca1,
-    0xeebca2,
-    0xeebca3,
-    0xeebca4,
-    0xeebca5,
-    0xeebca6,
-    0xeebca7,
-    0xeebca8,
-    0xeebca9,
-    0xeebcaa,
-    0xeebcab,
-    0xeebcac,
-    0xeebcad,
-    0xeebcae,
-    0xeebcaf,
-    0xeebcb0,
-    0xeebcb1,
-    0xeebcb2,
-    0xeebcb3,
-    0xeebcb4,
-    0xeebcb5,
-    0xeebcb6,
-    0xeebcb7,
-    0xeebcb8,
-    0xeebcb9,
-    0xeebcba,
-    0xeebcbb,
-    0xeebcbc,
-    0xeebcbd,
-    0xeebcbe,
-    0xeebcbf,
-    0xeebd80,
-    0xeebd81,
-    0xeebd82,
-    0xeebd83,
-    0xeebd84,
-    0xeebd85,
-    0xeebd86,
-    0xeebd87,
-    0xeebd88,
-    0xeebd89,
-    0xeebd8a,
-    0xeebd8b,
-    0xeebd8c,
-    0xeebd8d,
-    0xeebd8e,
-    0xeebd8f,
-    0xeebd90,
-    0xeebd91,
-    0xeebd92,
-    0xeebd93,
-    0xeebd94,
-    0xeebd95,
-    0xeebd96,
-    0xeebd97,
-    0xeebd98,
-    0xeebd99,
-    0xeebd9a,
-    0xeebd9b,
-    0xeebd9c,
-    0xeebd9d,
-    0xeebd9e,
-    0xeebd9f,
-    0xeebda0,
-    0xeebda1,
-    0xeebda2,
-    0xeebda3,
-    0xeebda4,
-    0xeebda5,
-    0xeebda6,
-    0xeebda7,
-    0xeebda8,
-    0xeebda9,
-    0xeebdaa,
-    0xeebdab,
-    0xeebdac,
-    0xeebdad,
-    0xeebdae,
-    0xeebdaf,
-    0xeebdb0,
-    0xeebdb1,
-    0xeebdb2,
-    0xeebdb3,
-    0xeebdb4,
-    0xeebdb5,
-    0xeebdb6,
-    0xeebdb7,
-    0xeebdb8,
-    0xeebdb9,
-    0xeebdba,
-    0xeebdbb,
-    0xeebdbc,
-    0xeebdbd,
-    0xeebdbe,
-    0xeebdbf,
-    0xeebe80,
-    0xeebe81,
-    0xeebe82,
-    0xeebe83,
-    0xeebe84,
-    0xeebe85,
-    0xeebe86,
-    0xeebe87,
-    0xeebe88,
-    0xeebe89,
-    0xeebe8a,
-    0xeebe8b,
-    0xeebe8c,
-    0xeebe8d,
-    0xeebe8e,
-    0xeebe8f,
-    0xeebe90,
-    0xeebe91,
-    0xeebe92,
-    0xeebe93,
-    0xeebe94,
-    0xeebe95,
-    0xeebe96,
-    0xeebe97,
-    0xeebe98,
-    0xeebe99,
-    0xeebe9a,
-    0xeebe9b,
-    0xeebe9c,
-    0xeebe9d,
-    0xeebe9e,
-    0xeebe9f,
-    0xeebea0,
-    0xeebea1,
-    0xeebea2,
-    0xeebea3,
-    0xeebea4,
-    0xeebea5,
-    0xeebea6,
-    0xeebea7,
-    0xeebea8,
-    0xeebea9,
-    0xeebeaa,
-    0xeebeab,
-    0xeebeac,
-    0xeebead,
-    0xeebeae,
-    0xeebeaf,
-    0xeebeb0,
-    0xeebeb1,
-    0xeebeb2,
-    0xeebeb3,
-    0xeebeb4,
-    0xeebeb5,
-    0xeebeb6,
-    0xeebeb7,
-    0xeebeb8,
-    0xeebeb9,
-    0xeebeba,
-    0xeebebb,
-    0xeebebc,
-    0xeebebd,
-    0xeebebe,
-    0xeebebf,
-    0xeebf80,
-    0xeebf81,
-    0xeebf82,
-    0xeebf83,
-    0xeebf84,
-    0xeebf85,
-    0xeebf86,
-    0xeebf87,
-    0xeebf88,
-    0xeebf89,
-    0xeebf8a,
-    0xeebf8b,
-    0xeebf8c,
-    0xeebf8d,
-    0xeebf8e,
-    0xeebf8f,
-    0xeebf90,
-    0xeebf91,
-    0xeebf92,
-    0xeebf93,
-    0xeebf94,
-    0xeebf95,
-    0xeebf96,
-    0xeebf97,
-    0xeebf98,
-    0xeebf99,
-    0xeebf9a,
-    0xeebf9b,
-    0xeebf9c,
-    0xeebf9d,
-    0xeebf9e,
-    0xeebf9f,
-    0xeebfa0,
-    0xeebfa1,
-    0xeebfa2,
-    0xeebfa3,
-    0xeebfa4,
-    0xeebfa5,
-    0xeebfa6,
-    0xeebfa7,
-    0xeebfa8,
-    0xeebfa9,
-    0xeebfaa,
-    0xeebfab,
-    0xeebfac,
-    0xeebfad,
-    0xeebfae,
-    0xeebfaf,
-    0xeebfb0,
-    0xeebfb1,
-    0xeebfb2,
-    0xeebfb3,
-    0xeebfb4,
-    0xeebfb5,
-    0xeebfb6,
-    0xeebfb7,
-    0xeebfb8,
-    0xeebfb9,
-    0xeebfba,
-    0xeebfbb,
-    0xeebfbc,
-    0xeebfbd,
-    0xeebfbe,
-    0xeebfbf,
-    0xef8080,
-    0xef8081,
-    0xef8082,
-    0xef8083,
-    0xef8084,
-    0xef8085,
-    0xef8086,
-    0xef8087,
-    0xef8088,
-    0xef8089,
-    0xef808a,
-    0xef808b,
-    0xef808c,
-    0xef808d,
-    0xef808e,
-    0xef808f,
-    0xef8090,
-    0xef8091,
-    0xef8092,
-    0xef8093,
-    0xef8094,
-    0xef8095,
-    0xef8096,
-    0xef8097,
-    0xef8098,
-    0xef8099,
-    0xef809a,
-    0xef809b,
-    0xef809c,
-    0xef809d,
-    0xef809e,
-    0xef809f,
-    0xef80a0,
-    0xef80a1,
-    0xef80a2,
-    0xef80a3,
-    0xef80a4,
-    0xef80a5,
-    0xef80a6,
-    0xef80a7,
-    0xef80a8,
-    0xef80a9,
-    0xef80aa,
-    0xef80ab,
-    0xef80ac,
-    0xef80ad,
-    0xef80ae,
-    0xef80af,
-    0xef80b0,
-    0xef80b1,
-    0xef80b2,
-    0xef80b3,
-    0xef80b4,
-    0xef80b5,
-    0xef80b6,
-    0xef80b7,
-    0xef80b8,
-    0xef80b9,
-    0xef80ba,
-    0xef80bb,
-    0xef80bc,
-    0xef80bd,
-    0xef80be,
-    0xef80bf,
-    0xef8180,
-    0xef8181,
-    0xef8182,
-    0xef8183,
-    0xef8184,
-    0xef8185,
-    0xef8186,
-    0xef8187,
-    0xef8188,
-    0xef8189,
-    0xef818a,
-    0xef818b,
-    0xef818c,
-    0xef818d,
-    0xef818e,
-    0xef818f,
-    0xef8190,
-    0xef8191,
-    0xef8192,
-    0xef8193,
-    0xef8194,
-    0xef8195,
-    0xef8196,
-    0xef8197,
-    0xef8198,
-    0xef8199,
-    0xef819a,
-    0xef819b,
-    0xef819c,
-    0xef819d,
-    0xef819e,
-    0xef819f,
-    0xef81a0,
-    0xef81a1,
-    0xef81a2,
-    0xef81a3,
-    0xef81a4,
-    0xef81a5,
-    0xef81a6,
-    0xef81a7,
-    0xef81a8,
-    0xef81a9,
-    0xef81aa,
-    0xef81ab,
-    0xef81ac,
-    0xef81ad,
-    0xef81ae,
-    0xef81af,
-    0xef81b0,
-    0xef81b1,
-    0xef81b2,
-    0xef81b3,
-    0xef81b4,
-    0xef81b5,
-    0xef81b6,
-    0xef81b7,
-    0xef81b8,
-    0xef81b9,
-    0xef81ba,
-    0xef81bb,
-    0xef81bc,
-    0xef81bd,
-    0xef81be,
-    0xef81bf,
-    0xef8280,
-    0xef8281,
-    0xef8282,
-    0xef8283,
-    0xef8284,
-    0xef8285,
-    0xef8286,
-    0xef8287,
-    0xef8288,
-    0xef8289,
-    0xef828a,
-    0xef828b,
-    0xef828c,
-    0xef828d,
-    0xef828e,
-    0xef828f,
-    0xef8290,
-    0xef8291,
-    0xef8292,
-    0xef8293,
-    0xef8294,
-    0xef8295,
-    0xef8296,
-    0xef8297,
-    0xef8298,
-    0xef8299,
-    0xef829a,
-    0xef829b,
-    0xef829c,
-    0xef829d,
-    0xef829e,
-    0xef829f,
-    0xef82a0,
-    0xef82a1,
-    0xef82a2,
-    0xef82a3,
-    0xef82a4,
-    0xef82a5,
-    0xef82a6,
-    0xef82a7,
-    0xef82a8,
-    0xef82a9,
-    0xef82aa,
-    0xef82ab,
-    0xef82ac,
-    0xef82ad,
-    0xef82ae,
-    0xef82af,
-    0xef82b0,
-    0xef82b1,
-    0xef82b2,
-    0xef82b3,
-    0xef82b4,
-    0xef82b5,
-    0xef82b6,
-    0xef82b7,
-    0xef82b8,
-    0xef82b9,
-    0xef82ba,
-    0xef82bb,
-    0xef82bc,
-    0xef82bd,
-    0xef82be,
-    0xef82bf,
-    0xef8380,
-    0xef8381,
-    0xef8382,
-    0xef8383,
-    0xef8384,
-    0xef8385,
-    0xef8386,
-    0xef8387,
-    0xef8388,
-    0xef8389,
-    0xef838a,
-    0xef838b,
-    0xef838c,
-    0xef838d,
-    0xef838e,
-    0xef838f,
-    0xef8390,
-    0xef8391,
-    0xef8392,
-    0xef8393,
-    0xef8394,
-    0xef8395,
-    0xef8396,
-    0xef8397,
-    0xef8398,
-    0xef8399,
-    0xef839a,
-    0xef839b,
-    0xef839c,
-    0xef839d,
-    0xef839e,
-    0xef839f,
-    0xef83a0,
-    0xef83a1,
-    0xef83a2,
-    0xef83a3,
-    0xef83a4,
-    0xef83a5,
-    0xef83a6,
-    0xef83a7,
-    0xef83a8,
-    0xef83a9,
-    0xef83aa,
-    0xef83ab,
-    0xef83ac,
-    0xef83ad,
-    0xef83ae,
-    0xef83af,
-    0xef83b0,
-    0xef83b1,
-    0xef83b2,
-    0xef83b3,
-    0xef83b4,
-    0xef83b5,
-    0xef83b6,
-    0xef83b7,
-    0xef83b8,
-    0xef83b9,
-    0xef83ba,
-    0xef83bb,
-    0xef83bc,
-    0xef83bd,
-    0xef83be,
-    0xef83bf,
-    0xef8480,
-    0xef8481,
-    0xef8482,
-    0xef8483,
-    0xef8484,
-    0xef8485,
-    0xef8486,
-    0xef8487,
-    0xef8488,
-    0xef8489,
-    0xef848a,
-    0xef848b,
-    0xef848c,
-    0xef848d,
-    0xef848e,
-    0xef848f,
-    0xef8490,
-    0xef8491,
-    0xef8492,
-    0xef8493,
-    0xef8494,
-    0xef8495,
-    0xef8496,
-    0xef8497,
-    0xef8498,
-    0xef8499,
-    0xef849a,
-    0xef849b,
-    0xef849c,
-    0xef849d,
-    0xef849e,
-    0xef849f,
-    0xef84a0,
-    0xef84a1,
-    0xef84a2,
-    0xef84a3,
-    0xef84a4,
-    0xef84a5,
-    0xef84a6,
-    0xef84a7,
-    0xef84a8,
-    0xef84a9,
-    0xef84aa,
-    0xef84ab,
-    0xef84ac,
-    0xef84ad,
-    0xef84ae,
-    0xef84af,
-    0xef84b0,
-    0xef84b1,
-    0xef84b2,
-    0xef84b3,
-    0xef84b4,
-    0xef84b5,
-    0xef84b6,
-    0xef84b7,
-    0xef84b8,
-    0xef84b9,
-    0xef84ba,
-    0xef84bb,
-    0xef84bc,
-    0xef84bd,
-    0xef84be,
-    0xef84bf,
-    0xef8580,
-    0xef8581,
-    0xef8582,
-    0xef8583,
-    0xef8584,
-    0xef8585,
-    0xef8586,
-    0xef8587,
-    0xef8588,
-    0xef8589,
-    0xef858a,
-    0xef858b,
-    0xef858c,
-    0xef858d,
-    0xef858e,
-    0xef858f,
-    0xef8590,
-    0xef8591,
-    0xef8592,
-    0xef8593,
-    0xef8594,
-    0xef8595,
-    0xef8596,
-    0xef8597,
-    0xef8598,
-    0xef8599,
-    0xef859a,
-    0xef859b,
-    0xef859c,
-    0xef859d,
-    0xef859e,
-    0xef859f,
-    0xef85a0,
-    0xef85a1,
-    0xef85a2,
-    0xef85a3,
-    0xef85a4,
-    0xef85a5,
-    0xef85a6,
-    0xef85a7,
-    0xef85a8,
-    0xef85a9,
-    0xef85aa,
-    0xef85ab,
-    0xef85ac,
-    0xef85ad,
-    0xef85ae,
-    0xef85af,
-    0xef85b0,
-    0xef85b1,
-    0xef85b2,
-    0xef85b3,
-    0xef85b4,
-    0xef85b5,
-    0xef85b6,
-    0xef85b7,
-    0xef85b8,
-    0xef85b9,
-    0xef85ba,
-    0xef85bb,
-    0xef85bc,
-    0xef85bd,
-    0xef85be,
-    0xef85bf,
-    0xef8680,
-    0xef8681,
-    0xef8682,
-    0xef8683,
-    0xef8684,
-    0xef8685,
-    0xef8686,
-    0xef8687,
-    0xef8688,
-    0xef8689,
-    0xef868a,
-    0xef868b,
-    0xef868c,
-    0xef868d,
-    0xef868e,
-    0xef868f,
-    0xef8690,
-    0xef8691,
-    0xef8692,
-    0xef8693,
-    0xef8694,
-    0xef8695,
-    0xef8696,
-    0xef8697,
-    0xef8698,
-    0xef8699,
-    0xef869a,
-    0xef869b,
-    0xef869c,
-    0xef869d,
-    0xef869e,
-    0xef869f,
-    0xef86a0,
-    0xef86a1,
-    0xef86a2,
-    0xef86a3,
-    0xef86a4,
-    0xef86a5,
-    0xef86a6,
-    0xef86a7,
-    0xef86a8,
-    0xef86a9,
-    0xef86aa,
-    0xef86ab,
-    0xef86ac,
-    0xef86ad,
-    0xef86ae,
-    0xef86af,
-    0xef86b0,
-    0xef86b1,
-    0xef86b2,
-    0xef86b3,
-    0xef86b4,
-    0xef86b5,
-    0xef86b6,
-    0xef86b7,
-    0xef86b8,
-    0xef86b9,
-    0xef86ba,
-    0xef86bb,
-    0xef86bc,
-    0xef86bd,
-    0xef86be,
-    0xef86bf,
-    0xef8780,
-    0xef8781,
-    0xef8782,
-    0xef8783,
-    0xef8784,
-    0xef8785,
-    0xef8786,
-    0xef8787,
-    0xef8788,
-    0xef8789,
-    0xef878a,
-    0xef878b,
-    0xef878c,
-    0xef878d,
-    0xef878e,
-    0xef878f,
-    0xef8790,
-    0xef8791,
-    0xef8792,
-    0xef8793,
-    0xef8794,
-    0xef8795,
-    0xef8796,
-    0xef8797,
-    0xef8798,
-    0xef8799,
-    0xef879a,
-    0xef879b,
-    0xef879c,
-    0xef879d,
-    0xef879e,
-    0xef879f,
-    0xef87a0,
-    0xef87a1,
-    0xef87a2,
-    0xef87a3,
-    0xef87a4,
-    0xef87a5,
-    0xef87a6,
-    0xef87a7,
-    0xef87a8,
-    0xef87a9,
-    0xef87aa,
-    0xef87ab,
-    0xef87ac,
-    0xef87ad,
-    0xef87ae,
-    0xef87af,
-    0xef87b0,
-    0xef87b1,
-    0xef87b2,
-    0xef87b3,
-    0xef87b4,
-    0xef87b5,
-    0xef87b6,
-    0xef87b7,
-    0xef87b8,
-    0xef87b9,
-    0xef87ba,
-    0xef87bb,
-    0xef87bc,
-    0xef87bd,
-    0xef87be,
-    0xef87bf,
-    0xef8880,
-    0xef8881,
-    0xef8882,
-    0xef8883,
-    0xef8884,
-    0xef8885,
-    0xef8886,
-    0xef8887,
-    0xef8888,
-    0xef8889,
-    0xef888a,
-    0xef888b,
-    0xef888c,
-    0xef888d,
-    0xef888e,
-    0xef888f,
-    0xef8890,
-    0xef8891,
-    0xef8892,
-    0xef8893,
-    0xef8894,
-    0xef8895,
-    0xef8896,
-    0xef8897,
-    0xef8898,
-    0xef8899,
-    0xef889a,
-    0xef889b,
-    0xef889c,
-    0xef889d,
-    0xef889e,
-    0xef889f,
-    0xef88a0,
-    0xef88a1,
-    0xef88a2,
-    0xef88a3,
-    0xef88a4,
-    0xef88a5,
-    0xef88a6,
-    0xef88a7,
-    0xef88a8,
-    0xef88a9,
-    0xef88aa,
-    0xef88ab,
-    0xef88ac,
-    0xef88ad,
-    0xef88ae,
-    0xef88af,
-    0xef88b0,
-    0xef88b1,
-    0xef88b2,
-    0xef88b3,
-    0xef88b4,
-    0xef88b5,
-    0xef88b6,
-    0xef88b7,
-    0xef88b8,
-    0xef88b9,
-    0xef88ba,
-    0xef88bb,
-    0xef88bc,
-    0xef88bd,
-    0xef88be,
-    0xef88bf,
-    0xef8980,
-    0xef8981,
-    0xef8982,
-    0xef8983,
-    0xef8984,
-    0xef8985,
-    0xef8986,
-    0xef8987,
-    0xef8988,
-    0xef8989,
-    0xef898a,
-    0xef898b,
-    0xef898c,
-    0xef898d,
-    0xef898e,
-    0xef898f,
-    0xef8990,
-    0xef8991,
-    0xef8992,
-    0xef8993,
-    0xef8994,
-    0xef8995,
-    0xef8996,
-    0xef8997,
-    0xef8998,
-    0xef8999,
-    0xef899a,
-    0xef899b,
-    0xef899c,
-    0xef899d,
-    0xef899e,
-    0xef899f,
-    0xef89a0,
-    0xef89a1,
-    0xef89a2,
-    0xef89a3,
-    0xef89a4,
-    0xef89a5,
-    0xef89a6,
-    0xef89a7,
-    0xef89a8,
-    0xef89a9,
-    0xef89aa,
-    0xef89ab,
-    0xef89ac,
-    0xef89ad,
-    0xef89ae,
-    0xef89af,
-    0xef89b0,
-    0xef89b1,
-    0xef89b2,
-    0xef89b3,
-    0xef89b4,
-    0xef89b5,
-    0xef89b6,
-    0xef89b7,
-    0xef89b8,
-    0xef89b9,
-    0xef89ba,
-    0xef89bb,
-    0xef89bc,
-    0xef89bd,
-    0xef89be,
-    0xef89bf,
-    0xef8a80,
-    0xef8a81,
-    0xef8a82,
-    0xef8a83,
-    0xef8a84,
-    0xef8a85,
-    0xef8a86,
-    0xef8a87,
-    0xef8a88,
-    0xef8a89,
-    0xef8a8a,
-    0xef8a8b,
-    0xef8a8c,
-    0xef8a8d,
-    0xef8a8e,
-    0xef8a8f,
-    0xef8a90,
-    0xef8a91,
-    0xef8a92,
-    0xef8a93,
-    0xef8a94,
-    0xef8a95,
-    0xef8a96,
-    0xef8a97,
-    0xef8a98,
-    0xef8a99,
-    0xef8a9a,
-    0xef8a9b,
-    0xef8a9c,
-    0xef8a9d,
-    0xef8a9e,
-    0xef8a9f,
-    0xef8aa0,
-    0xef8aa1,
-    0xef8aa2,
-    0xef8aa3,
-    0xef8aa4,
-    0xef8aa5,
-    0xef8aa6,
-    0xef8aa7,
-    0xef8aa8,
-    0xef8aa9,
-    0xef8aaa,
-    0xef8aab,
-    0xef8aac,
-    0xef8aad,
-    0xef8aae,
-    0xef8aaf,
-    0xef8ab0,
-    0xef8ab1,
-    0xef8ab2,
-    0xef8ab3,
-    0xef8ab4,
-    0xef8ab5,
-    0xef8ab6,
-    0xef8ab7,
-    0xef8ab8,
-    0xef8ab9,
-    0xef8aba,
-    0xef8abb,
-    0xef8abc,
-    0xef8abd,
-    0xef8abe,
-    0xef8abf,
-    0xef8b80,
-    0xef8b81,
-    0xef8b82,
-    0xef8b83,
-    0xef8b84,
-    0xef8b85,
-    0xef8b86,
-    0xef8b87,
-    0xef8b88,
-    0xef8b89,
-    0xef8b8a,
-    0xef8b8b,
-    0xef8b8c,
-    0xef8b8d,
-    0xef8b8e,
-    0xef8b8f,
-    0xef8b90,
-    0xef8b91,
-    0xef8b92,
-    0xef8b93,
-    0xef8b94,
-    0xef8b95,
-    0xef8b96,
-    0xef8b97,
-    0xef8b98,
-    0xef8b99,
-    0xef8b9a,
-    0xef8b9b,
-    0xef8b9c,
-    0xef8b9d,
-    0xef8b9e,
-    0xef8b9f,
-    0xef8ba0,
-    0xef8ba1,
-    0xef8ba2,
-    0xef8ba3,
-    0xef8ba4,
-    0xef8ba5,
-    0xef8ba6,
-    0xef8ba7,
-    0xef8ba8,
-    0xef8ba9,
-    0xef8baa,
-    0xef8bab,
-    0xef8bac,
-    0xef8bad,
-    0xef8bae,
-    0xef8baf,
-    0xef8bb0,
-    0xef8bb1,
-    0xef8bb2,
-    0xef8bb3,
-    0xef8bb4,
-    0xef8bb5,
-    0xef8bb6,
-    0xef8bb7,
-    0xef8bb8,
-    0xef8bb9,
-    0xef8bba,
-    0xef8bbb,
-    0xef8bbc,
-    0xef8bbd,
-    0xef8bbe,
-    0xef8bbf,
-    0xef8c80,
-    0xef8c81,
-    0xef8c82,
-    0xef8c83,
-    0xef8c84,
-    0xef8c85,
-    0xef8c86,
-    0xef8c87,
-    0xef8c88,
-    0xef8c89,
-    0xef8c8a,
-    0xef8c8b,
-    0xef8c8c,
-    0xef8c8d,
-    0xef8c8e,
-    0xef8c8f,
-    0xef8c90,
-    0xef8c91,
-    0xef8c92,
-    0xef8c93,
-    0xef8c94,
-    0xef8c95,
-    0xef8c96,
-    0xef8c97,
-    0xef8c98,
-    0xef8c99,
-    0xef8c9a,
-    0xef8c9b,
-    0xef8c9c,
-    0xef8c9d,
-    0xef8c9e,
-    0xef8c9f,
-    0xef8ca0,
-    0xef8ca1,
-    0xef8ca2,
-    0xef8ca3,
-    0xef8ca4,
-    0xef8ca5,
-    0xef8ca6,
-    0xef8ca7,
-    0xef8ca8,
-    0xef8ca9,
-    0xef8caa,
-    0xef8cab,
-    0xef8cac,
-    0xef8cad,
-    0xef8cae,
-    0xef8caf,
-    0xef8cb0,
-    0xef8cb1,
-    0xef8cb2,
-    0xef8cb3,
-    0xef8cb4,
-    0xef8cb5,
-    0xef8cb6,
-    0xef8cb7,
-    0xef8cb8,
-    0xef8cb9,
-    0xef8cba,
-    0xef8cbb,
-    0xef8cbc,
-    0xef8cbd,
-    0xef8cbe,
-    0xef8cbf,
-    0xef8d80,
-    0xef8d81,
-    0xef8d82,
-    0xef8d83,
-    0xef8d84,
-    0xef8d85,
-    0xef8d86,
-    0xef8d87,
-    0xef8d88,
-    0xef8d89,
-    0xef8d8a,
-    0xef8d8b,
-    0xef8d8c,
-    0xef8d8d,
-    0xef8d8e,
-    0xef8d8f,
-    0xef8d90,
-    0xef8d91,
-    0xef8d92,
-    0xef8d93,
-    0xef8d94,
-    0xef8d95,
-    0xef8d96,
-    0xef8d97,
-    0xef8d98,
-    0xef8d99,
-    0xef8d9a,
-    0xef8d9b,
-    0xef8d9c,
-    0xef8d9d,
-    0xef8d9e,
-    0xef8d9f,
-    0xef8da0,
-    0xef8da1,
-    0xef8da2,
-    0xef8da3,
-    0xef8da4,
-    0xef8da5,
-    0xef8da6,
-    0xef8da7,
-    0xef8da8,
-    0xef8da9,
-    0xef8daa,
-    0xef8dab,
-    0xef8dac,
-    0xef8dad,
-    0xef8dae,
-    0xef8daf,
-    0xef8db0,
-    0xef8db1,
-    0xef8db2,
-    0xef8db3,
-    0xef8db4,
-    0xef8db5,
-    0xef8db6,
-    0xef8db7,
-    0xef8db8,
-    0xef8db9,
-    0xef8dba,
-    0xef8dbb,
-    0xef8dbc,
-    0xef8dbd,
-    0xef8dbe,
-    0xef8dbf,
-    0xef8e80,
-    0xef8e81,
-    0xef8e82,
-    0xef8e83,
-    0xef8e84,
-    0xef8e85,
-    0xef8e86,
-    0xef8e87,
-    0xef8e88,
-    0xef8e89,
-    0xef8e8a,
-    0xef8e8b,
-    0xef8e8c,
-    0xef8e8d,
-    0xef8e8e,
-    0xef8e8f,
-    0xef8e90,
-    0xef8e91,
-    0xef8e92,
-    0xef8e93,
-    0xef8e94,
-    0xef8e95,
-    0xef8e96,
-    0xef8e97,
-    0xef8e98,
-    0xef8e99,
-    0xef8e9a,
-    0xef8e9b,
-    0xef8e9c,
-    0xef8e9d,
-    0xef8e9e,
-    0xef8e9f,
-    0xef8ea0,
-    0xef8ea1,
-    0xef8ea2,
-    0xef8ea3,
-    0xef8ea4,
-    0xef8ea5,
-    0xef8ea6,
-    0xef8ea7,
-    0xef8ea8,
-    0xef8ea9,
-    0xef8eaa,
-    0xef8eab,
-    0xef8eac,
-    0xef8ead,
-    0xef8eae,
-    0xef8eaf,
-    0xef8eb0,
-    0xef8eb1,
-    0xef8eb2,
-    0xef8eb3,
-    0xef8eb4,
-    0xef8eb5,
-    0xef8eb6,
-    0xef8eb7,
-    0xef8eb8,
-    0xef8eb9,
-    0xef8eba,
-    0xef8ebb,
-    0xef8ebc,
-    0xef8ebd,
-    0xef8ebe,
-    0xef8ebf,
-    0xef8f80,
-    0xef8f81,
-    0xef8f82,
-    0xef8f83,
-    0xef8f84,
-    0xef8f85,
-    0xef8f86,
-    0xef8f87,
-    0xef8f88,
-    0xef8f89,
-    0xef8f8a,
-    0xef8f8b,
-    0xef8f8c,
-    0xef8f8d,
-    0xef8f8e,
-    0xef8f8f,
-    0xef8f90,
-    0xef8f91,
-    0xef8f92,
-    0xef8f93,
-    0xef8f94,
-    0xef8f95,
-    0xef8f96,
-    0xef8f97,
-    0xef8f98,
-    0xef8f99,
-    0xef8f9a,
-    0xef8f9b,
-    0xef8f9c,
-    0xef8f9d,
-    0xef8f9e,
-    0xef8f9f,
-    0xef8fa0,
-    0xef8fa1,
-    0xef8fa2,
-    0xef8fa3,
-    0xef8fa4,
-    0xef8fa5,
-    0xef8fa6,
-    0xef8fa7,
-    0xef8fa8,
-    0xef8fa9,
-    0xef8faa,
-    0xef8fab,
-    0xef8fac,
-    0xef8fad,
-    0xef8fae,
-    0xef8faf,
-    0xef8fb0,
-    0xef8fb1,
-    0xef8fb2,
-    0xef8fb3,
-    0xef8fb4,
-    0xef8fb5,
-    0xef8fb6,
-    0xef8fb7,
-    0xef8fb8,
-    0xef8fb9,
-    0xef8fba,
-    0xef8fbb,
-    0xef8fbc,
-    0xef8fbd,
-    0xef8fbe,
-    0xef8fbf,
-    0xef9080,
-    0xef9081,
-    0xef9082,
-    0xef9083,
-    0xef9084,
-    0xef9085,
-    0xef9086,
-    0xef9087,
-    0xef9088,
-    0xef9089,
-    0xef908a,
-    0xef908b,
-    0xef908c,
-    0xef908d,
-    0xef908e,
-    0xef908f,
-    0xef9090,
-    0xef9091,
-    0xef9092,
-    0xef9093,
-    0xef9094,
-    0xef9095,
-    0xef9096,
-    0xef9097,
-    0xef9098,
-    0xef9099,
-    0xef909a,
-    0xef909b,
-    0xef909c,
-    0xef909d,
-    0xef909e,
-    0xef909f,
-    0xef90a0,
-    0xef90a1,
-    0xef90a2,
-    0xef90a3,
-    0xef90a4,
-    0xef90a5,
-    0xef90a6,
-    0xef90a7,
-    0xef90a8,
-    0xef90a9,
-    0xef90aa,
-    0xef90ab,
-    0xef90ac,
-    0xef90ad,
-    0xef90ae,
-    0xef90af,
-    0xef90b0,
-    0xef90b1,
-    0xef90b2,
-    0xef90b3,
-    0xef90b4,
-    0xef90b5,
-    0xef90b6,
-    0xef90b7,
-    0xef90b8,
-    0xef90b9,
-    0xef90ba,
-    0xef90bb,
-    0xef90bc,
-    0xef90bd,
-    0xef90be,
-    0xef90bf,
-    0xef9180,
-    0xef9181,
-    0xef9182,
-    0xef9183,
-    0xef9184,
-    0xef9185,
-    0xef9186,
-    0xef9187,
-    0xef9188,
-    0xef9189,
-    0xef918a,
-    0xef918b,
-    0xef918c,
-    0xef918d,
-    0xef918e,
-    0xef918f,
-    0xef9190,
-    0xef9191,
-    0xef9192,
-    0xef9193,
-    0xef9194,
-    0xef9195,
-    0xef9196,
-    0xef9197,
-    0xef9198,
-    0xef9199,
-    0xef919a,
-    0xef919b,
-    0xef919c,
-    0xef919d,
-    0xef919e,
-    0xef919f,
-    0xef91a0,
-    0xef91a1,
-    0xef91a2,
-    0xef91a3,
-    0xef91a4,
-    0xef91a5,
-    0xef91a6,
-    0xef91a7,
-    0xef91a8,
-    0xef91a9,
-    0xef91aa,
-    0xef91ab,
-    0xef91ac,
-    0xef91ad,
-    0xef91ae,
-    0xef91af,
-    0xef91b0,
-    0xef91b1,
-    0xef91b2,
-    0xef91b3,
-    0xef91b4,
-    0xef91b5,
-    0xef91b6,
-    0xef91b7,
-    0xef91b8,
-    0xef91b9,
-    0xef91ba,
-    0xef91bb,
-    0xef91bc,
-    0xef91bd,
-    0xef91be,
-    0xef91bf,
-    0xef9280,
-    0xef9281,
-    0xef9282,
-    0xef9283,
-    0xef9284,
-    0xef9285,
-    0xef9286,
-    0xef9287,
-    0xef9288,
-    0xef9289,
-    0xef928a,
-    0xef928b,
-    0xef928c,
-    0xef928d,
-    0xef928e,
-    0xef928f,
-    0xef9290,
-    0xef9291,
-    0xef9292,
-    0xef9293,
-    0xef9294,
-    0xef9295,
-    0xef9296,
-    0xef9297,
-    0xef9298,
-    0xef9299,
-    0xef929a,
-    0xef929b,
-    0xef929c,
-    0xef929d,
-    0xef929e,
-    0xef929f,
-    0xef92a0,
-    0xef92a1,
-    0xef92a2,
-    0xef92a3,
-    0xef92a4,
-    0xef92a5,
-    0xef92a6,
-    0xef92a7,
-    0xef92a8,
-    0xef92a9,
-    0xef92aa,
-    0xef92ab,
-    0xef92ac,
-    0xef92ad,
-    0xef92ae,
-    0xef92af,
-    0xef92b0,
-    0xef92b1,
-    0xef92b2,
-    0xef92b3,
-    0xef92b4,
-    0xef92b5,
-    0xef92b6,
-    0xef92b7,
-    0xef92b8,
-    0xef92b9,
-    0xef92ba,
-    0xef92bb,
-    0xef92bc,
-    0xef92bd,
-    0xef92be,
-    0xef92bf,
-    0xef9380,
-    0xef9381,
-    0xef9382,
-    0xef9383,
-    0xef9384,
-    0xef9385,
-    0xef9386,
-    0xef9387,
-    0xef9388,
-    0xef9389,
-    0xef938a,
-    0xef938b,
-    0xef938c,
-    0xef938d,
-    0xef938e,
-    0xef938f,
-    0xef9390,
-    0xef9391,
-    0xef9392,
-    0xef9393,
-    0xef9394,
-    0xef9395,
-    0xef9396,
-    0xef9397,
-    0xef9398,
-    0xef9399,
-    0xef939a,
-    0xef939b,
-    0xef939c,
-    0xef939d,
-    0xef939e,
-    0xef939f,
-    0xef93a0,
-    0xef93a1,
-    0xef93a2,
-    0xef93a3,
-    0xef93a4,
-    0xef93a5,
-    0xef93a6,
-    0xef93a7,
-    0xef93a8,
-    0xef93a9,
-    0xef93aa,
-    0xef93ab,
-    0xef93ac,
-    0xef93ad,
-    0xef93ae,
-    0xef93af,
-    0xef93b0,
-    0xef93b1,
-    0xef93b2,
-    0xef93b3,
-    0xef93b4,
-    0xef93b5,
-    0xef93b6,
-    0xef93b7,
-    0xef93b8,
-    0xef93b9,
-    0xef93ba,
-    0xef93bb,
-    0xef93bc,
-    0xef93bd,
-    0xef93be,
-    0xef93bf,
-    0xef9480,
-    0xef9481,
-    0xef9482,
-    0xef9483,
-    0xef9484,
-    0xef9485,
-    0xef9486,
-    0xef9487,
-    0xef9488,
-    0xef9489,
-    0xef948a,
-    0xef948b,
-    0xef948c,
-    0xef948d,
-    0xef948e,
-    0xef948f,
-    0xef9490,
-    0xef9491,
-    0xef9492,
-    0xef9493,
-    0xef9494,
-    0xef9495,
-    0xef9496,
-    0xef9497,
-    0xef9498,
-    0xef9499,
-    0xef949a,
-    0xef949b,
-    0xef949c,
-    0xef949d,
-    0xef949e,
-    0xef949f,
-    0xef94a0,
-    0xef94a1,
-    0xef94a2,
-    0xef94a3,
-    0xef94a4,
-    0xef94a5,
-    0xef94a6,
-    0xef94a7,
-    0xef94a8,
-    0xef94a9,
-    0xef94aa,
-    0xef94ab,
-    0xef94ac,
-    0xef94ad,
-    0xef94ae,
-    0xef94af,
-    0xef94b0,
-    0xef94b1,
-    0xef94b2,
-    0xef94b3,
-    0xef94b4,
-    0xef94b5,
-    0xef94b6,
-    0xef94b7,
-    0xef94b8,
-    0xef94b9,
-    0xef94ba,
-    0xef94bb,
-    0xef94bc,
-    0xef94bd,
-    0xef94be,
-    0xef94bf,
-    0xef9580,
-    0xef9581,
-    0xef9582,
-    0xef9583,
-    0xef9584,
-    0xef9585,
-    0xef9586,
-    0xef9587,
-    0xef9588,
-    0xef9589,
-    0xef958a,
-    0xef958b,
-    0xef958c,
-    0xef958d,
-    0xef958e,
-    0xef958f,
-    0xef9590,
-    0xef9591,
-    0xef9592,
-    0xef9593,
-    0xef9594,
-    0xef9595,
-    0xef9596,
-    0xef9597,
-    0xef9598,
-    0xef9599,
-    0xef959a,
-    0xef959b,
-    0xef959c,
-    0xef959d,
-    0xef959e,
-    0xef959f,
-    0xef95a0,
-    0xef95a1,
-    0xef95a2,
-    0xef95a3,
-    0xef95a4,
-    0xef95a5,
-    0xef95a6,
-    0xef95a7,
-    0xef95a8,
-    0xef95a9,
-    0xef95aa,
-    0xef95ab,
-    0xef95ac,
-    0xef95ad,
-    0xef95ae,
-    0xef95af,
-    0xef95b0,
-    0xef95b1,
-    0xef95b2,
-    0xef95b3,
-    0xef95b4,
-    0xef95b5,
-    0xef95b6,
-    0xef95b7,
-    0xef95b8,
-    0xef95b9,
-    0xef95ba,
-    0xef95bb,
-    0xef95bc,
-    0xef95bd,
-    0xef95be,
-    0xef95bf,
-    0xef9680,
-    0xef9681,
-    0xef9682,
-    0xef9683,
-    0xef9684,
-    0xef9685,
-    0xef9686,
-    0xef9687,
-    0xef9688,
-    0xef9689,
-    0xef968a,
-    0xef968b,
-    0xef968c,
-    0xef968d,
-    0xef968e,
-    0xef968f,
-    0xef9690,
-    0xef9691,
-    0xef9692,
-    0xef9693,
-    0xef9694,
-    0xef9695,
-    0xef9696,
-    0xef9697,
-    0xef9698,
-    0xef9699,
-    0xef969a,
-    0xef969b,
-    0xef969c,
-    0xef969d,
-    0xef969e,
-    0xef969f,
-    0xef96a0,
-    0xef96a1,
-    0xef96a2,
-    0xef96a3,
-    0xef96a4,
-    0xef96a5,
-    0xef96a6,
-    0xef96a7,
-    0xef96a8,
-    0xef96a9,
-    0xef96aa,
-    0xef96ab,
-    0xef96ac,
-    0xef96ad,
-    0xef96ae,
-    0xef96af,
-    0xef96b0,
-    0xef96b1,
-    0xef96b2,
-    0xef96b3,
-    0xef96b4,
-    0xef96b5,
-    0xef96b6,
-    0xef96b7,
-    0xef96b8,
-    0xef96b9,
-    0xef96ba,
-    0xef96bb,
-    0xef96bc,
-    0xef96bd,
-    0xef96be,
-    0xef96bf,
-    0xef9780,
-    0xef9781,
-    0xef9782,
-    0xef9783,
-    0xef9784,
-    0xef9785,
-    0xef9786,
-    0xef9787,
-    0xef9788,
-    0xef9789,
-    0xef978a,
-    0xef978b,
-    0xef978c,
-    0xef978d,
-    0xef978e,
-    0xef978f,
-    0xef9790,
-    0xef9791,
-    0xef9792,
-    0xef9793,
-    0xef9794,
-    0xef9795,
-    0xef9796,
-    0xef9797,
-    0xef9798,
-    0xef9799,
-    0xef979a,
-    0xef979b,
-    0xef979c,
-    0xef979d,
-    0xef979e,
-    0xef979f,
-    0xef97a0,
-    0xef97a1,
-    0xef97a2,
-    0xef97a3,
-    0xef97a4,
-    0xef97a5,
-    0xef97a6,
-    0xef97a7,
-    0xef97a8,
-    0xef97a9,
-    0xef97aa,
-    0xef97ab,
-    0xef97ac,
-    0xef97ad,
-    0xef97ae,
-    0xef97af,
-    0xef97b0,
-    0xef97b1,
-    0xef97b2,
-    0xef97b3,
-    0xef97b4,
-    0xef97b5,
-    0xef97b6,
-    0xef97b7,
-    0xef97b8,
-    0xef97b9,
-    0xef97ba,
-    0xef97bb,
-    0xef97bc,
-    0xef97bd,
-    0xef97be,
-    0xef97bf,
-    0xef9880,
-    0xef9881,
-    0xef9882,
-    0xef9883,
-    0xef9884,
-    0xef9885,
-    0xef9886,
-    0xef9887,
-    0xef9888,
-    0xef9889,
-    0xef988a,
-    0xef988b,
-    0xef988c,
-    0xef988d,
-    0xef988e,
-    0xef988f,
-    0xef9890,
-    0xef9891,
-    0xef9892,
-    0xef9893,
-    0xef9894,
-    0xef9895,
-    0xef9896,
-    0xef9897,
-    0xef9898,
-    0xef9899,
-    0xef989a,
-    0xef989b,
-    0xef989c,
-    0xef989d,
-    0xef989e,
-    0xef989f,
-    0xef98a0,
-    0xef98a1,
-    0xef98a2,
-    0xef98a3,
-    0xef98a4,
-    0xef98a5,
-    0xef98a6,
-    0xef98a7,
-    0xef98a8,
-    0xef98a9,
-    0xef98aa,
-    0xef98ab,
-    0xef98ac,
-    0xef98ad,
-    0xef98ae,
-    0xef98af,
-    0xef98b0,
-    0xef98b1,
-    0xef98b2,
-    0xef98b3,
-    0xef98b4,
-    0xef98b5,
-    0xef98b6,
-    0xef98b7,
-    0xef98b8,
-    0xef98b9,
-    0xef98ba,
-    0xef98bb,
-    0xef98bc,
-    0xef98bd,
-    0xef98be,
-    0xef98bf,
-    0xef9980,
-    0xef9981,
-    0xef9982,
-    0xef9983,
-    0xef9984,
-    0xef9985,
-    0xef9986,
-    0xef9987,
-    0xef9988,
-    0xef9989,
-    0xef998a,
-    0xef998b,
-    0xef998c,
-    0xef998d,
-    0xef998e,
-    0xef998f,
-    0xef9990,
-    0xef9991,
-    0xef9992,
-    0xef9993,
-    0xef9994,
-    0xef9995,
-    0xef9996,
-    0xef9997,
-    0xef9998,
-    0xef9999,
-    0xef999a,
-    0xef999b,
-    0xef999c,
-    0xef999d,
-    0xef999e,
-    0xef999f,
-    0xef99a0,
-    0xef99a1,
-    0xef99a2,
-    0xef99a3,
-    0xef99a4,
-    0xef99a5,
-    0xef99a6,
-    0xef99a7,
-    0xef99a8,
-    0xef99a9,
-    0xef99aa,
-    0xef99ab,
-    0xef99ac,
-    0xef99ad,
-    0xef99ae,
-    0xef99af,
-    0xef99b0,
-    0xef99b1,
-    0xef99b2,
-    0xef99b3,
-    0xef99b4,
-    0xef99b5,
-    0xef99b6,
-    0xef99b7,
-    0xef99b8,
-    0xef99b9,
-    0xef99ba,
-    0xef99bb,
-    0xef99bc,
-    0xef99bd,
-    0xef99be,
-    0xef99bf,
-    0xef9a80,
-    0xef9a81,
-    0xef9a82,
-    0xef9a83,
-    0xef9a84,
-    0xef9a85,
-    0xef9a86,
-    0xef9a87,
-    0xef9a88,
-    0xef9a89,
-    0xef9a8a,
-    0xef9a8b,
-    0xef9a8c,
-    0xef9a8d,
-    0xef9a8e,
-    0xef9a8f,
-    0xef9a90,
-    0xef9a91,
-    0xef9a92,
-    0xef9a93,
-    0xef9a94,
-    0xef9a95,
-    0xef9a96,
-    0xef9a97,
-    0xef9a98,
-    0xef9a99,
-    0xef9a9a,
-    0xef9a9b,
-    0xef9a9c,
-    0xef9a9d,
-    0xef9a9e,
-    0xef9a9f,
-    0xef9aa0,
-    0xef9aa1,
-    0xef9aa2,
-    0xef9aa3,
-    0xef9aa4,
-    0xef9aa5,
-    0xef9aa6,
-    0xef9aa7,
-    0xef9aa8,
-    0xef9aa9,
-    0xef9aaa,
-    0xef9aab,
-    0xef9aac,
-    0xef9aad,
-    0xef9aae,
-    0xef9aaf,
-    0xef9ab0,
-    0xef9ab1,
-    0xef9ab2,
-    0xef9ab3,
-    0xef9ab4,
-    0xef9ab5,
-    0xef9ab6,
-    0xef9ab7,
-    0xef9ab8,
-    0xef9ab9,
-    0xef9aba,
-    0xef9abb,
-    0xef9abc,
-    0xef9abd,
-    0xef9abe,
-    0xef9abf,
-    0xef9b80,
-    0xef9b81,
-    0xef9b82,
-    0xef9b83,
-    0xef9b84,
-    0xef9b85,
-    0xef9b86,
-    0xef9b87,
-    0xef9b88,
-    0xef9b89,
-    0xef9b8a,
-    0xef9b8b,
-    0xef9b8c,
-    0xef9b8d,
-    0xef9b8e,
-    0xef9b8f,
-    0xef9b90,
-    0xef9b91,
-    0xef9b92,
-    0xef9b93,
-    0xef9b94,
-    0xef9b95,
-    0xef9b96,
-    0xef9b97,
-    0xef9b98,
-    0xef9b99,
-    0xef9b9a,
-    0xef9b9b,
-    0xef9b9c,
-    0xef9b9d,
-    0xef9b9e,
-    0xef9b9f,
-    0xef9ba0,
-    0xef9ba1,
-    0xef9ba2,
-    0xef9ba3,
-    0xef9ba4,
-    0xef9ba5,
-    0xef9ba6,
-    0xef9ba7,
-    0xef9ba8,
-    0xef9ba9,
-    0xef9baa,
-    0xef9bab,
-    0xef9bac,
-    0xef9bad,
-    0xef9bae,
-    0xef9baf,
-    0xef9bb0,
-    0xef9bb1,
-    0xef9bb2,
-    0xef9bb3,
-    0xef9bb4,
-    0xef9bb5,
-    0xef9bb6,
-    0xef9bb7,
-    0xef9bb8,
-    0xef9bb9,
-    0xef9bba,
-    0xef9bbb,
-    0xef9bbc,
-    0xef9bbd,
-    0xef9bbe,
-    0xef9bbf,
-    0xef9c80,
-    0xef9c81,
-    0xef9c82,
-    0xef9c83,
-    0xef9c84,
-    0xef9c85,
-    0xef9c86,
-    0xef9c87,
-    0xef9c88,
-    0xef9c89,
-    0xef9c8a,
-    0xef9c8b,
-    0xef9c8c,
-    0xef9c8d,
-    0xef9c8e,
-    0xef9c8f,
-    0xef9c90,
-    0xef9c91,
-    0xef9c92,
-    0xef9c93,
-    0xef9c94,
-    0xef9c95,
-    0xef9c96,
-    0xef9c97,
-    0xef9c98,
-    0xef9c99,
-    0xef9c9a,
-    0xef9c9b,
-    0xef9c9c,
-    0xef9c9d,
-    0xef9c9e,
-    0xef9c9f,
-    0xef9ca0,
-    0xef9ca1,
-    0xef9ca2,
-    0xef9ca3,
-    0xef9ca4,
-    0xef9ca5,
-    0xef9ca6,
-    0xef9ca7,
-    0xef9ca8,
-    0xef9ca9,
-    0xef9caa,
-    0xef9cab,
-    0xef9cac,
-    0xef9cad,
-    0xef9cae,
-    0xef9caf,
-    0xef9cb0,
-    0xef9cb1,
-    0xef9cb2,
-    0xef9cb3,
-    0xef9cb4,
-    0xef9cb5,
-    0xef9cb6,
-    0xef9cb7,
-    0xef9cb8,
-    0xef9cb9,
-    0xef9cba,
-    0xef9cbb,
-    0xef9cbc,
-    0xef9cbd,
-    0xef9cbe,
-    0xef9cbf,
-    0xef9d80,
-    0xef9d81,
-    0xef9d82,
-    0xef9d83,
-    0xef9d84,
-    0xef9d85,
-    0xef9d86,
-    0xef9d87,
-    0xef9d88,
-    0xef9d89,
-    0xef9d8a,
-    0xef9d8b,
-    0xef9d8c,
-    0xef9d8d,
-    0xef9d8e,
-    0xef9d8f,
-    0xef9d90,
-    0xef9d91,
-    0xef9d92,
-    0xef9d93,
-    0xef9d94,
-    0xef9d95,
-    0xef9d96,
-    0xef9d97,
-    0xef9d98,
-    0xef9d99,
-    0xef9d9a,
-    0xef9d9b,
-    0xef9d9c,
-    0xef9d9d,
-    0xef9d9e,
-    0xef9d9f,
-    0xef9da0,
-    0xef9da1,
-    0xef9da2,
-    0xef9da3,
-    0xef9da4,
-    0xef9da5,
-    0xef9da6,
-    0xef9da7,
-    0xef9da8,
-    0xef9da9,
-    0xef9daa,
-    0xef9dab,
-    0xef9dac,
-    0xef9dad,
-    0xef9dae,
-    0xef9daf,
-    0xef9db0,
-    0xef9db1,
-    0xef9db2,
-    0xef9db3,
-    0xef9db4,
-    0xef9db5,
-    0xef9db6,
-    0xef9db7,
-    0xef9db8,
-    0xef9db9,
-    0xef9dba,
-    0xef9dbb,
-    0xef9dbc,
-    0xef9dbd,
-    0xef9dbe,
-    0xef9dbf,
-    0xef9e80,
-    0xef9e81,
-    0xef9e82,
-    0xef9e83,
-    0xef9e84,
-    0xef9e85,
-    0xef9e86,
-    0xef9e87,
-    0xef9e88,
-    0xef9e89,
-    0xef9e8a,
-    0xef9e8b,
-    0xef9e8c,
-    0xef9e8d,
-    0xef9e8e,
-    0xef9e8f,
-    0xef9e90,
-    0xef9e91,
-    0xef9e92,
-    0xef9e93,
-    0xef9e94,
-    0xef9e95,
-    0xef9e96,
-    0xef9e97,
-    0xef9e98,
-    0xef9e99,
-    0xef9e9a,
-    0xef9e9b,
-    0xef9e9c,
-    0xef9e9d,
-    0xef9e9e,
-    0xef9e9f,
-    0xef9ea0,
-    0xef9ea1,
-    0xef9ea2,
-    0xef9ea3,
-    0xef9ea4,
-    0xef9ea5,
-    0xef9ea6,
-    0xef9ea7,
-    0xef9ea8,
-    0xef9ea9,
-    0xef9eaa,
-    0xef9eab,
-    0xef9eac,
-    0xef9ead,
-    0xef9eae,
-    0xef9eaf,
-    0xef9eb0,
-    0xef9eb1,
-    0xef9eb2,
-    0xef9eb3,
-    0xef9eb4,
-    0xef9eb5,
-    0xef9eb6,
-    0xef9eb7,
-    0xef9eb8,
-    0xef9eb9,
-    0xef9eba,
-    0xef9ebb,
-    0xef9ebc,
-    0xef9ebd,
-    0xef9ebe,
-    0xef9ebf,
-    0xef9f80,
-    0xef9f81,
-    0xef9f82,
-    0xef9f83,
-    0xef9f84,
-    0xef9f85,
-    0xef9f86,
-    0xef9f87,
-    0xef9f88,
-    0xef9f89,
-    0xef9f8a,
-    0xef9f8b,
-    0xef9f8c,
-    0xef9f8d,
-    0xef9f8e,
-    0xef9f8f,
-    0xef9f90,
-    0xef9f91,
-    0xef9f92,
-    0xef9f93,
-    0xef9f94,
-    0xef9f95,
-    0xef9f96,
-    0xef9f97,
-    0xef9f98,
-    0xef9f99,
-    0xef9f9a,
-    0xef9f9b,
-    0xef9f9c,
-    0xef9f9d,
-    0xef9f9e,
-    0xef9f9f,
-    0xef9fa0,
-    0xef9fa1,
-    0xef9fa2,
-    0xef9fa3,
-    0xef9fa4,
-    0xef9fa5,
-    0xef9fa6,
-    0xef9fa7,
-    0xef9fa8,
-    0xef9fa9,
-    0xef9faa,
-    0xef9fab,
-    0xef9fac,
-    0xef9fad,
-    0xef9fae,
-    0xef9faf,
-    0xef9fb0,
-    0xef9fb1,
-    0xef9fb2,
-    0xef9fb3,
-    0xef9fb4,
-    0xef9fb5,
-    0xef9fb6,
-    0xef9fb7,
-    0xef9fb8,
-    0xef9fb9,
-    0xef9fba,
-    0xef9fbb,
-    0xef9fbc,
-    0xef9fbd,
-    0xef9fbe,
-    0xef9fbf,
-    0xefa080,
-    0xefa081,
-    0xefa082,
-    0xefa083,
-    0xefa084,
-    0xefa085,
-    0xefa086,
-    0xefa087,
-    0xefa088,
-    0xefa089,
-    0xefa08a,
-    0xefa08b,
-    0xefa08c,
-    0xefa08d,
-    0xefa08e,
-    0xefa08f,
-    0xefa090,
-    0xefa091,
-    0xefa092,
-    0xefa093,
-    0xefa094,
-    0xefa095,
-    0xefa096,
-    0xefa097,
-    0xefa098,
-    0xefa099,
-    0xefa09a,
-    0xefa09b,
-    0xefa09c,
-    0xefa09d,
-    0xefa09e,
-    0xefa09f,
-    0xefa0a0,
-    0xefa0a1,
-    0xefa0a2,
-    0xefa0a3,
-    0xefa0a4,
-    0xefa0a5,
-    0xefa0a6,
-    0xefa0a7,
-    0xefa0a8,
-    0xefa0a9,
-    0xefa0aa,
-    0xefa0ab,
-    0xefa0ac,
-    0xefa0ad,
-    0xefa0ae,
-    0xefa0af,
-    0xefa0b0,
-    0xefa0b1,
-    0xefa0b2,
-    0xefa0b3,
-    0xefa0b4,
-    0xefa0b5,
-    0xefa0b6,
-    0xefa0b7,
-    0xefa0b8,
-    0xefa0b9,
-    0xefa0ba,
-    0xefa0bb,
-    0xefa0bc,
-    0xefa0bd,
-    0xefa0be,
-    0xefa0bf,
-    0xefa180,
-    0xefa181,
-    0xefa182,
-    0xefa183,
-    0xefa184,
-    0xefa185,
-    0xefa186,
-    0xefa187,
-    0xefa188,
-    0xefa189,
-    0xefa18a,
-    0xefa18b,
-    0xefa18c,
-    0xefa18d,
-    0xefa18e,
-    0xefa18f,
-    0xefa190,
-    0xefa191,
-    0xefa192,
-    0xefa193,
-    0xefa194,
-    0xefa195,
-    0xefa196,
-    0xefa197,
-    0xefa198,
-    0xefa199,
-    0xefa19a,
-    0xefa19b,
-    0xefa19c,
-    0xefa19d,
-    0xefa19e,
-    0xefa19f,
-    0xefa1a0,
-    0xefa1a1,
-    0xefa1a2,
-    0xefa1a3,
-    0xefa1a4,
-    0xefa1a5,
-    0xefa1a6,
-    0xefa1a7,
-    0xefa1a8,
-    0xefa1a9,
-    0xefa1aa,
-    0xefa1ab,
-    0xefa1ac,
-    0xefa1ad,
-    0xefa1ae,
-    0xefa1af,
-    0xefa1b0,
-    0xefa1b1,
-    0xefa1b2,
-    0xefa1b3,
-    0xefa1b4,
-    0xefa1b5,
-    0xefa1b6,
-    0xefa1b7,
-    0xefa1b8,
-    0xefa1b9,
-    0xefa1ba,
-    0xefa1bb,
-    0xefa1bc,
-    0xefa1bd,
-    0xefa1be,
-    0xefa1bf,
-    0xefa280,
-    0xefa281,
-    0xefa282,
-    0xefa283,
-    0xefa284,
-    0xefa285,
-    0xefa286,
-    0xefa287,
-    0xefa288,
-    0xefa289,
-    0xefa28a,
-    0xefa28b,
-    0xefa28c,
-    0xefa28d,
-    0xefa28e,
-    0xefa28f,
-    0xefa290,
-    0xefa291,
-    0xefa292,
-    0xefa293,
-    0xefa294,
-    0xefa295,
-    0xefa296,
-    0xefa297,
-    0xefa298,
-    0xefa299,
-    0xefa29a,
-    0xefa29b,
-    0xefa29c,
-    0xefa29d,
-    0xefa29e,
-    0xefa29f,
-    0xefa2a0,
-    0xefa2a1,
-    0xefa2a2,
-    0xefa2a3,
-    0xefa2a4,
-    0xefa2a5,
-    0xefa2a6,
-    0xefa2a7,
-    0xefa2a8,
-    0xefa2a9,
-    0xefa2aa,
-    0xefa2ab,
-    0xefa2ac,
-    0xefa2ad,
-    0xefa2ae,
-    0xefa2af,
-    0xefa2b0,
-    0xefa2b1,
-    0xefa2b2,
-    0xefa2b3,
-    0xefa2b4,
-    0xefa2b5,
-    0xefa2b6,
-    0xefa2b7,
-    0xefa2b8,
-    0xefa2b9,
-    0xefa2ba,
-    0xefa2bb,
-    0xefa2bc,
-    0xefa2bd,
-    0xefa2be,
-    0xefa2bf,
-    0xefa380,
-    0xefa381,
-    0xefa382,
-    0xefa383,
-    0xefa384,
-    0xefa385,
-    0xefa386,
-    0xefa387,
-    0xefa388,
-    0xefa389,
-    0xefa38a,
-    0xefa38b,
-    0xefa38c,
-    0xefa38d,
-    0xefa38e,
-    0xefa38f,
-    0xefa390,
-    0xefa391,
-    0xefa392,
-    0xefa393,
-    0xefa394,
-    0xefa395,
-    0xefa396,
-    0xefa397,
-    0xefa398,
-    0xefa399,
-    0xefa39a,
-    0xefa39b,
-    0xefa39c,
-    0xefa39d,
-    0xefa39e,
-    0xefa39f,
-    0xefa3a0,
-    0xefa3a1,
-    0xefa3a2,
-    0xefa3a3,
-    0xefa3a4,
-    0xefa3a5,
-    0xefa3a6,
-    0xefa3a7,
-    0xefa3a8,
-    0xefa3a9,
-    0xefa3aa,
-    0xefa3ab,
-    0xefa3ac,
-    0xefa3ad,
-    0xefa3ae,
-    0xefa3af,
-    0xefa3b0,
-    0xefa3b1,
-    0xefa3b2,
-    0xefa3b3,
-    0xefa3b4,
-    0xefa3b5,
-    0xefa3b6,
-    0xefa3b7,
-    0xefa3b8,
-    0xefa3b9,
-    0xefa3ba,
-    0xefa3bb,
-    0xefa3bc,
-    0xefa3bd,
-    0xefa3be,
-    0xefa3bf,
-    0xefa480,
-    0xefa481,
-    0xefa482,
-    0xefa483,
-    0xefa484,
-    0xefa485,
-    0xefa486,
-    0xefa487,
-    0xefa488,
-    0xefa489,
-    0xefa48a,
-    0xefa48b,
-    0xefa48c,
-    0xefa48d,
-    0xefa48e,
-    0xefa48f,
-    0xefa490,
-    0xefa491,
-    0xefa492,
-    0xefa493,
-    0xefa494,
-    0xefa495,
-    0xefa496,
-    0xefa497,
-    0xefa498,
-    0xefa499,
-    0xefa49a,
-    0xefa49b,
-    0xefa49c,
-    0xefa49d,
-    0xefa49e,
-    0xefa49f,
-    0xefa4a0,
-    0xefa4a1,
-    0xefa4a2,
-    0xefa4a3,
-    0xefa4a4,
-    0xefa4a5,
-    0xefa4a6,
-    0xefa4a7,
-    0xefa4a8,
-    0xefa4a9,
-    0xefa4aa,
-    0xefa4ab,
-    0xefa4ac,
-    0xefa4ad,
-    0xefa4ae,
-    0xefa4af,
-    0xefa4b0,
-    0xefa4b1,
-    0xefa4b2,
-    0xefa4b3,
-    0xefa4b4,
-    0xefa4b5,
-    0xefa4b6,
-    0xefa4b7,
-    0xefa4b8,
-    0xefa4b9,
-    0xefa4ba,
-    0xefa4bb,
-    0xefa4bc,
-    0xefa4bd,
-    0xefa4be,
-    0xefa4bf,
-    0xefa580,
-    0xefa581,
-    0xefa582,
-    0xefa583,
-    0xefa584,
-    0xefa585,
-    0xefa586,
-    0xefa587,
-    0xefa588,
-    0xefa589,
-    0xefa58a,
-    0xefa58b,
-    0xefa58c,
-    0xefa58d,
-    0xefa58e,
-    0xefa58f,
-    0xefa590,
-    0xefa591,
-    0xefa592,
-    0xefa593,
-    0xefa594,
-    0xefa595,
-    0xefa596,
-    0xefa597,
-    0xefa598,
-    0xefa599,
-    0xefa59a,
-    0xefa59b,
-    0xefa59c,
-    0xefa59d,
-    0xefa59e,
-    0xefa59f,
-    0xefa5a0,
-    0xefa5a1,
-    0xefa5a2,
-    0xefa5a3,
-    0xefa5a4,
-    0xefa5a5,
-    0xefa5a6,
-    0xefa5a7,
-    0xefa5a8,
-    0xefa5a9,
-    0xefa5aa,
-    0xefa5ab,
-    0xefa5ac,
-    0xefa5ad,
-    0xefa5ae,
-    0xefa5af,
-    0xefa5b0,
-    0xefa5b1,
-    0xefa5b2,
-    0xefa5b3,
-    0xefa5b4,
-    0xefa5b5,
-    0xefa5b6,
-    0xefa5b7,
-    0xefa5b8,
-    0xefa5b9,
-    0xefa5ba,
-    0xefa5bb,
-    0xefa5bc,
-    0xefa5bd,
-    0xefa5be,
-    0xefa5bf,
-    0xefa680,
-    0xefa681,
-    0xefa682,
-    0xefa683,
-    0xefa684,
-    0xefa685,
-    0xefa686,
-    0xefa687,
-    0xefa688,
-    0xefa689,
-    0xefa68a,
-    0xefa68b,
-    0xefa68c,
-    0xefa68d,
-    0xefa68e,
-    0xefa68f,
-    0xefa690,
-    0xefa691,
-    0xefa692,
-    0xefa693,
-    0xefa694,
-    0xefa695,
-    0xefa696,
-    0xefa697,
-    0xefa698,
-    0xefa699,
-    0xefa69a,
-    0xefa69b,
-    0xefa69c,
-    0xefa69d,
-    0xefa69e,
-    0xefa69f,
-    0xefa6a0,
-    0xefa6a1,
-    0xefa6a2,
-    0xefa6a3,
-    0xefa6a4,
-    0xefa6a5,
-    0xefa6a6,
-    0xefa6a7,
-    0xefa6a8,
-    0xefa6a9,
-    0xefa6aa,
-    0xefa6ab,
-    0xefa6ac,
-    0xefa6ad,
-    0xefa6ae,
-    0xefa6af,
-    0xefa6b0,
-    0xefa6b1,
-    0xefa6b2,
-    0xefa6b3,
-    0xefa6b4,
-    0xefa6b5,
-    0xefa6b6,
-    0xefa6b7,
-    0xefa6b8,
-    0xefa6b9,
-    0xefa6ba,
-    0xefa6bb,
-    0xefa6bc,
-    0xefa6bd,
-    0xefa6be,
-    0xefa6bf,
-    0xefa780,
-    0xefa781,
-    0xefa782,
-    0xefa783,
-    0xefa784,
-    0xefa785,
-    0xefa786,
-    0xefa787,
-    0xefa788,
-    0xefa789,
-    0xefa78a,
-    0xefa78b,
-    0xefa78c,
-    0xefa78d,
-    0xefa78e,
-    0xefa78f,
-    0xefa790,
-    0xefa791,
-    0xefa792,
-    0xefa793,
-    0xefa794,
-    0xefa795,
-    0xefa796,
-    0xefa797,
-    0xefa798,
-    0xefa799,
-    0xefa79a,
-    0xefa79b,
-    0xefa79c,
-    0xefa79d,
-    0xefa79e,
-    0xefa79f,
-    0xefa7a0,
-    0xefa7a1,
-    0xefa7a2,
-    0xefa7a3,
-    0xefa7a4,
-    0xefa7a5,
-    0xefa7a6,
-    0xefa7a7,
-    0xefa7a8,
-    0xefa7a9,
-    0xefa7aa,
-    0xefa7ab,
-    0xefa7ac,
-    0xefa7ad,
-    0xefa7ae,
-    0xefa7af,
-    0xefa7b0,
-    0xefa7b1,
-    0xefa7b2,
-    0xefa7b3,
-    0xefa7b4,
-    0xefa7b5,
-    0xefa7b6,
-    0xefa7b7,
-    0xefa7b8,
-    0xefa7b9,
-    0xefa7ba,
-    0xefa7bb,
-    0xefa7bc,
-    0xefa7bd,
-    0xefa7be,
-    0xefa7bf,
-    0xefa880,
-    0xefa881,
-    0xefa882,
-    0xefa883,
-    0xefa884,
-    0xefa885,
-    0xefa886,
-    0xefa887,
-    0xefa888,
-    0xefa889,
-    0xefa88a,
-    0xefa88b,
-    0xefa88c,
-    0xefa88d,
-    0xefa88e,
-    0xefa88f,
-    0xefa890,
-    0xefa891,
-    0xefa892,
-    0xefa893,
-    0xefa894,
-    0xefa895,
-    0xefa896,
-    0xefa897,
-    0xefa898,
-    0xefa899,
-    0xefa89a,
-    0xefa89b,
-    0xefa89c,
-    0xefa89d,
-    0xefa89e,
-    0xefa89f,
-    0xefa8a0,
-    0xefa8a1,
-    0xefa8a2,
-    0xefa8a3,
-    0xefa8a4,
-    0xefa8a5,
-    0xefa8a6,
-    0xefa8a7,
-    0xefa8a8,
-    0xefa8a9,
-    0xefa8aa,
-    0xefa8ab,
-    0xefa8ac,
-    0xefa8ad,
-    0xefa8ae,
-    0xefa8af,
-    0xefa8b0,
-    0xefa8b1,
-    0xefa8b2,
-    0xefa8b3,
-    0xefa8b4,
-    0xefa8b5,
-    0xefa8b6,
-    0xefa8b7,
-    0xefa8b8,
-    0xefa8b9,
-    0xefa8ba,
-    0xefa8bb,
-    0xefa8bc,
-    0xefa8bd,
-    0xefa8be,
-    0xefa8bf,
-    0xefa980,
-    0xefa981,
-    0xefa982,
-    0xefa983,
-    0xefa984,
-    0xefa985,
-    0xefa986,
-    0xefa987,
-    0xefa988,
-    0xefa989,
-    0xefa98a,
-    0xefa98b,
-    0xefa98c,
-    0xefa98d,
-    0xefa98e,
-    0xefa98f,
-    0xefa990,
-    0xefa991,
-    0xefa992,
-    0xefa993,
-    0xefa994,
-    0xefa995,
-    0xefa996,
-    0xefa997,
-    0xefa998,
-    0xefa999,
-    0xefa99a,
-    0xefa99b,
-    0xefa99c,
-    0xefa99d,
-    0xefa99e,
-    0xefa99f,
-    0xefa9a0,
-    0xefa9a1,
-    0xefa9a2,
-    0xefa9a3,
-    0xefa9a4,
-    0xefa9a5,
-    0xefa9a6,
-    0xefa9a7,
-    0xefa9a8,
-    0xefa9a9,
-    0xefa9aa,
-    0xefa9ab,
-    0xefa9ac,
-    0xefa9ad,
-    0xefa9ae,
-    0xefa9af,
-    0xefa9b0,
-    0xefa9b1,
-    0xefa9b2,
-    0xefa9b3,
-    0xefa9b4,
-    0xefa9b5,
-    0xefa9b6,
-    0xefa9b7,
-    0xefa9b8,
-    0xefa9b9,
-    0xefa9ba,
-    0xefa9bb,
-    0xefa9bc,
-    0xefa9bd,
-    0xefa9be,
-    0xefa9bf,
-    0xefaa80,
-    0xefaa81,
-    0xefaa82,
-    0xefaa83,
-    0xefaa84,
-    0xefaa85,
-    0xefaa86,
-    0xefaa87,
-    0xefaa88,
-    0xefaa89,
-    0xefaa8a,
-    0xefaa8b,
-    0xefaa8c,
-    0xefaa8d,
-    0xefaa8e,
-    0xefaa8f,
-    0xefaa90,
-    0xefaa91,
-    0xefaa92,
-    0xefaa93,
-    0xefaa94,
-    0xefaa95,
-    0xefaa96,
-    0xefaa97,
-    0xefaa98,
-    0xefaa99,
-    0xefaa9a,
-    0xefaa9b,
-    0xefaa9c,
-    0xefaa9d,
-    0xefaa9e,
-    0xefaa9f,
-    0xefaaa0,
-    0xefaaa1,
-    0xefaaa2,
-    0xefaaa3,
-    0xefaaa4,
-    0xefaaa5,
-    0xefaaa6,
-    0xefaaa7,
-    0xefaaa8,
-    0xefaaa9,
-    0xefaaaa,
-    0xefaaab,
-    0xefaaac,
-    0xefaaad,
-    0xefaaae,
-    0xefaaaf,
-    0xefaab0,
-    0xefaab1,
-    0xefaab2,
-    0xefaab3,
-    0xefaab4,
-    0xefaab5,
-    0xefaab6,
-    0xefaab7,
-    0xefaab8,
-    0xefaab9,
-    0xefaaba,
-    0xefaabb,
-    0xefaabc,
-    0xefaabd,
-    0xefaabe,
-    0xefaabf,
-    0xefab80,
-    0xefab81,
-    0xefab82,
-    0xefab83,
-    0xefab84,
-    0xefab85,
-    0xefab86,
-    0xefab87,
-    0xefab88,
-    0xefab89,
-    0xefab8a,
-    0xefab8b,
-    0xefab8c,
-    0xefab8d,
-    0xefab8e,
-    0xefab8f,
-    0xefab90,
-    0xefab91,
-    0xefab92,
-    0xefab93,
-    0xefab94,
-    0xefab95,
-    0xefab96,
-    0xefab97,
-    0xefab98,
-    0xefab99,
-    0xefab9a,
-    0xefab9b,
-    0xefab9c,
-    0xefab9d,
-    0xefab9e,
-    0xefab9f,
-    0xefaba0,
-    0xefaba1,
-    0xefaba2,
-    0xefaba3,
-    0xefaba4,
-    0xefaba5,
-    0xefaba6,
-    0xefaba7,
-    0xefaba8,
-    0xefaba9,
-    0xefabaa,
-    0xefabab,
-    0xefabac,
-    0xefabad,
-    0xefabae,
-    0xefabaf,
-    0xefabb0,
-    0xefabb1,
-    0xefabb2,
-    0xefabb3,
-    0xefabb4,
-    0xefabb5,
-    0xefabb6,
-    0xefabb7,
-    0xefabb8,
-    0xefabb9,
-    0xefabba,
-    0xefabbb,
-    0xefabbc,
-    0xefabbd,
-    0xefabbe,
-    0xefabbf,
-    0xefac80,
-    0xefac81,
-    0xefac82,
-    0xefac83,
-    0xefac84,
-    0xefac85,
-    0xefac86,
-    0xefac87,
-    0xefac88,
-    0xefac89,
-    0xefac8a,
-    0xefac8b,
-    0xefac8c,
-    0xefac8d,
-    0xefac8e,
-    0xefac8f,
-    0xefac90,
-    0xefac91,
-    0xefac92,
-    0xefac93,
-    0xefac94,
-    0xefac95,
-    0xefac96,
-    0xefac97,
-    0xefac98,
-    0xefac99,
-    0xefac9a,
-    0xefac9b,
-    0xefac9c,
-    0xefac9d,
-    0xefac9e,
-    0xefac9f,
-    0xefaca0,
-    0xefaca1,
-    0xefaca2,
-    0xefaca3,
-    0xefaca4,
-    0xefaca5,
-    0xefaca6,
-    0xefaca7,
-    0xefaca8,
-    0xefaca9,
-    0xefacaa,
-    0xefacab,
-    0xefacac,
-    0xefacad,
-    0xefacae,
-    0xefacaf,
-    0xefacb0,
-    0xefacb1,
-    0xefacb2,
-    0xefacb3,
-    0xefacb4,
-    0xefacb5,
-    0xefacb6,
-    0xefacb7,
-    0xefacb8,
-    0xefacb9,
-    0xefacba,
-    0xefacbb,
-    0xefacbc,
-    0xefacbd,
-    0xefacbe,
-    0xefacbf,
-    0xefad80,
-    0xefad81,
-    0xefad82,
-    0xefad83,
-    0xefad84,
-    0xefad85,
-    0xefad86,
-    0xefad87,
-    0xefad88,
-    0xefad89,
-    0xefad8a,
-    0xefad8b,
-    0xefad8c,
-    0xefad8d,
-    0xefad8e,
-    0xefad8f,
-    0xefad90,
-    0xefad91,
-    0xefad92,
-    0xefad93,
-    0xefad94,
-    0xefad95,
-    0xefad96,
-    0xefad97,
-    0xefad98,
-    0xefad99,
-    0xefad9a,
-    0xefad9b,
-    0xefad9c,
-    0xefad9d,
-    0xefad9e,
-    0xefad9f,
-    0xefada0,
-    0xefada1,
-    0xefada2,
-    0xefada3,
-    0xefada4,
-    0xefada5,
-    0xefada6,
-    0xefada7,
-    0xefada8,
-    0xefada9,
-    0xefadaa,
-    0xefadab,
-    0xefadac,
-    0xefadad,
-    0xefadae,
-    0xefadaf,
-    0xefadb0,
-    0xefadb1,
-    0xefadb2,
-    0xefadb3,
-    0xefadb4,
-    0xefadb5,
-    0xefadb6,
-    0xefadb7,
-    0xefadb8,
-    0xefadb9,
-    0xefadba,
-    0xefadbb,
-    0xefadbc,
-    0xefadbd,
-    0xefadbe,
-    0xefadbf,
-    0xefae80,
-    0xefae81,
-    0xefae82,
-    0xefae83,
-    0xefae84,
-    0xefae85,
-    0xefae86,
-    0xefae87,
-    0xefae88,
-    0xefae89,
-    0xefae8a,
-    0xefae8b,
-    0xefae8c,
-    0xefae8d,
-    0xefae8e,
-    0xefae8f,
-    0xefae90,
-    0xefae91,
-    0xefae92,
-    0xefae93,
-    0xefae94,
-    0xefae95,
-    0xefae96,
-    0xefae97,
-    0xefae98,
-    0xefae99,
-    0xefae9a,
-    0xefae9b,
-    0xefae9c,
-    0xefae9d,
-    0xefae9e,
-    0xefae9f,
-    0xefaea0,
-    0xefaea1,
-    0xefaea2,
-    0xefaea3,
-    0xefaea4,
-    0xefaea5,
-    0xefaea6,
-    0xefaea7,
-    0xefaea8,
-    0xefaea9,
-    0xefaeaa,
-    0xefaeab,
-    0xefaeac,
-    0xefaead,
-    0xefaeae,
-    0xefaeaf,
-    0xefaeb0,
-    0xefaeb1,
-    0xefaeb2,
-    0xefaeb3,
-    0xefaeb4,
-    0xefaeb5,
-    0xefaeb6,
-    0xefaeb7,
-    0xefaeb8,
-    0xefaeb9,
-    0xefaeba,
-    0xefaebb,
-    0xefaebc,
-    0xefaebd,
-    0xefaebe,
-    0xefaebf,
-    0xefaf80,
-    0xefaf81,
-    0xefaf82,
-    0xefaf83,
-    0xefaf84,
-    0xefaf85,
-    0xefaf86,
-    0xefaf87,
-    0xefaf88,
-    0xefaf89,
-    0xefaf8a,
-    0xefaf8b,
-    0xefaf8c,
-    0xefaf8d,
-    0xefaf8e,
-    0xefaf8f,
-    0xefaf90,
-    0xefaf91,
-    0xefaf92,
-    0xefaf93,
-    0xefaf94,
-    0xefaf95,
-    0xefaf96,
-    0xefaf97,
-    0xefaf98,
-    0xefaf99,
-    0xefaf9a,
-    0xefaf9b,
-    0xefaf9c,
-    0xefaf9d,
-    0xefaf9e,
-    0xefaf9f,
-    0xefafa0,
-    0xefafa1,
-    0xefafa2,
-    0xefafa3,
-    0xefafa4,
-    0xefafa5,
-    0xefafa6,
-    0xefafa7,
-    0xefafa8,
-    0xefafa9,
-    0xefafaa,
-    0xefafab,
-    0xefafac,
-    0xefafad,
-    0xefafae,
-    0xefafaf,
-    0xefafb0,
-    0xefafb1,
-    0xefafb2,
-    0xefafb3,
-    0xefafb4,
-    0xefafb5,
-    0xefafb6,
-    0xefafb7,
-    0xefafb8,
-    0xefafb9,
-    0xefafba,
-    0xefafbb,
-    0xefafbc,
-    0xefafbd,
-    0xefafbe,
-    0xefafbf,
-    0xefb080,
-    0xefb081,
-    0xefb082,
-    0xefb083,
-    0xefb084,
-    0xefb085,
-    0xefb086,
-    0xefb087,
-    0xefb088,
-    0xefb089,
-    0xefb08a,
-    0xefb08b,
-    0xefb08c,
-    0xefb08d,
-    0xefb08e,
-    0xefb08f,
-    0xefb090,
-    0xefb091,
-    0xefb092,
-    0xefb093,
-    0xefb094,
-    0xefb095,
-    0xefb096,
-    0xefb097,
-    0xefb098,
-    0xefb099,
-    0xefb09a,
-    0xefb09b,
-    0xefb09c,
-    0xefb09d,
-    0xefb09e,
-    0xefb09f,
-    0xefb0a0,
-    0xefb0a1,
-    0xefb0a2,
-    0xefb0a3,
-    0xefb0a4,
-    0xefb0a5,
-    0xefb0a6,
-    0xefb0a7,
-    0xefb0a8,
-    0xefb0a9,
-    0xefb0aa,
-    0xefb0ab,
-    0xefb0ac,
-    0xefb0ad,
-    0xefb0ae,
-    0xefb0af,
-    0xefb0b0,
-    0xefb0b1,
-    0xefb0b2,
-    0xefb0b3,
-    0xefb0b4,
-    0xefb0b5,
-    0xefb0b6,
-    0xefb0b7,
-    0xefb0b8,
-    0xefb0b9,
-    0xefb0ba,
-    0xefb0bb,
-    0xefb0bc,
-    0xefb0bd,
-    0xefb0be,
-    0xefb0bf,
-    0xefb180,
-    0xefb181,
-    0xefb182,
-    0xefb183,
-    0xefb184,
-    0xefb185,
-    0xefb186,
-    0xefb187,
-    0xefb188,
-    0xefb189,
-    0xefb18a,
-    0xefb18b,
-    0xefb18c,
-    0xefb18d,
-    0xefb18e,
-    0xefb18f,
-    0xefb190,
-    0xefb191,
-    0xefb192,
-    0xefb193,
-    0xefb194,
-    0xefb195,
-    0xefb196,
-    0xefb197,
-    0xefb198,
-    0xefb199,
-    0xefb19a,
-    0xefb19b,
-    0xefb19c,
-    0xefb19d,
-    0xefb19e,
-    0xefb19f,
-    0xefb1a0,
-    0xefb1a1,
-    0xefb1a2,
-    0xefb1a3,
-    0xefb1a4,
-    0xefb1a5,
-    0xefb1a6,
-    0xefb1a7,
-    0xefb1a8,
-    0xefb1a9,
-    0xefb1aa,
-    0xefb1ab,
-    0xefb1ac,
-    0xefb1ad,
-    0xefb1ae,
-    0xefb1af,
-    0xefb1b0,
-    0xefb1b1,
-    0xefb1b2,
-    0xefb1b3,
-    0xefb1b4,
-    0xefb1b5,
-    0xefb1b6,
-    0xefb1b7,
-    0xefb1b8,
-    0xefb1b9,
-    0xefb1ba,
-    0xefb1bb,
-    0xefb1bc,
-    0xefb1bd,
-    0xefb1be,
-    0xefb1bf,
-    0xefb280,
-    0xefb281,
-    0xefb282,
-    0xefb283,
-    0xefb284,
-    0xefb285,
-    0xefb286,
-    0xefb287,
-    0xefb288,
-    0xefb289,
-    0xefb28a,
-    0xefb28b,
-    0xefb28c,
-    0xefb28d,
-    0xefb28e,
-    0xefb28f,
-    0xefb290,
-    0xefb291,
-    0xefb292,
-    0xefb293,
-    0xefb294,
-    0xefb295,
-    0xefb296,
-    0xefb297,
-    0xefb298,
-    0xefb299,
-    0xefb29a,
-    0xefb29b,
-    0xefb29c,
-    0xefb29d,
-    0xefb29e,
-    0xefb29f,
-    0xefb2a0,
-    0xefb2a1,
-    0xefb2a2,
-    0xefb2a3,
-    0xefb2a4,
-    0xefb2a5,
-    0xefb2a6,
-    0xefb2a7,
-    0xefb2a8,
-    0xefb2a9,
-    0xefb2aa,
-    0xefb2ab,
-    0xefb2ac,
-    0xefb2ad,
-    0xefb2ae,
-    0xefb2af,
-    0xefb2b0,
-    0xefb2b1,
-    0xefb2b2,
-    0xefb2b3,
-    0xefb2b4,
-    0xefb2b5,
-    0xefb2b6,
-    0xefb2b7,
-    0xefb2b8,
-    0xefb2b9,
-    0xefb2ba,
-    0xefb2bb,
-    0xefb2bc,
-    0xefb2bd,
-    0xefb2be,
-    0xefb2bf,
-    0xefb380,
-    0xefb381,
-    0xefb382,
-    0xefb383,
-    0xefb384,
-    0xefb385,
-    0xefb386,
-    0xefb387,
-    0xefb388,
-    0xefb389,
-    0xefb38a,
-    0xefb38b,
-    0xefb38c,
-    0xefb38d,
-    0xefb38e,
-    0xefb38f,
-    0xefb390,
-    0xefb391,
-    0xefb392,
-    0xefb393,
-    0xefb394,
-    0xefb395,
-    0xefb396,
-    0xefb397,
-    0xefb398,
-    0xefb399,
-    0xefb39a,
-    0xefb39b,
-    0xefb39c,
-    0xefb39d,
-    0xefb39e,
-    0xefb39f,
-    0xefb3a0,
-    0xefb3a1,
-    0xefb3a2,
-    0xefb3a3,
-    0xefb3a4,
-    0xefb3a5,
-    0xefb3a6,
-    0xefb3a7,
-    0xefb3a8,
-    0xefb3a9,
-    0xefb3aa,
-    0xefb3ab,
-    0xefb3ac,
-    0xefb3ad,
-    0xefb3ae,
-    0xefb3af,
-    0xefb3b0,
-    0xefb3b1,
-    0xefb3b2,
-    0xefb3b3,
-    0xefb3b4,
-    0xefb3b5,
-    0xefb3b6,
-    0xefb3b7,
-    0xefb3b8,
-    0xefb3b9,
-    0xefb3ba,
-    0xefb3bb,
-    0xefb3bc,
-    0xefb3bd,
-    0xefb3be,
-    0xefb3bf,
-    0xefb480,
-    0xefb481,
-    0xefb482,
-    0xefb483,
-    0xefb484,
-    0xefb485,
-    0xefb486,
-    0xefb487,
-    0xefb488,
-    0xefb489,
-    0xefb48a,
-    0xefb48b,
-    0xefb48c,
-    0xefb48d,
-    0xefb48e,
-    0xefb48f,
-    0xefb490,
-    0xefb491,
-    0xefb492,
-    0xefb493,
-    0xefb494,
-    0xefb495,
-    0xefb496,
-    0xefb497,
-    0xefb498,
-    0xefb499,
-    0xefb49a,
-    0xefb49b,
-    0xefb49c,
-    0xefb49d,
-    0xefb49e,
-    0xefb49f,
-    0xefb4a0,
-    0xefb4a1,
-    0xefb4a2,
-    0xefb4a3,
-    0xefb4a4,
-    0xefb4a5,
-    0xefb4a6,
-    0xefb4a7,
-    0xefb4a8,
-    0xefb4a9,
-    0xefb4aa,
-    0xefb4ab,
-    0xefb4ac,
-    0xefb4ad,
-    0xefb4ae,
-    0xefb4af,
-    0xefb4b0,
-    0xefb4b1,
-    0xefb4b2,
-    0xefb4b3,
-    0xefb4b4,
-    0xefb4b5,
-    0xefb4b6,
-    0xefb4b7,
-    0xefb4b8,
-    0xefb4b9,
-    0xefb4ba,
-    0xefb4bb,
-    0xefb4bc,
-    0xefb4bd,
-    0xefb4be,
-    0xefb4bf,
-    0xefb580,
-    0xefb581,
-    0xefb582,
-    0xefb583,
-    0xefb584,
-    0xefb585,
-    0xefb586,
-    0xefb587,
-    0xefb588,
-    0xefb589,
-    0xefb58a,
-    0xefb58b,
-    0xefb58c,
-    0xefb58d,
-    0xefb58e,
-    0xefb58f,
-    0xefb590,
-    0xefb591,
-    0xefb592,
-    0xefb593,
-    0xefb594,
-    0xefb595,
-    0xefb596,
-    0xefb597,
-    0xefb598,
-    0xefb599,
-    0xefb59a,
-    0xefb59b,
-    0xefb59c,
-    0xefb59d,
-    0xefb59e,
-    0xefb59f,
-    0xefb5a0,
-    0xefb5a1,
-    0xefb5a2,
-    0xefb5a3,
-    0xefb5a4,
-    0xefb5a5,
-    0xefb5a6,
-    0xefb5a7,
-    0xefb5a8,
-    0xefb5a9,
-    0xefb5aa,
-    0xefb5ab,
-    0xefb5ac,
-    0xefb5ad,
-    0xefb5ae,
-    0xefb5af,
-    0xefb5b0,
-    0xefb5b1,
-    0xefb5b2,
-    0xefb5b3,
-    0xefb5b4,
-    0xefb5b5,
-    0xefb5b6,
-    0xefb5b7,
-    0xefb5b8,
-    0xefb5b9,
-    0xefb5ba,
-    0xefb5bb,
-    0xefb5bc,
-    0xefb5bd,
-    0xefb5be,
-    0xefb5bf,
-    0xefb680,
-    0xefb681,
-    0xefb682,
-    0xefb683,
-    0xefb684,
-    0xefb685,
-    0xefb686,
-    0xefb687,
-    0xefb688,
-    0xefb689,
-    0xefb68a,
-    0xefb68b,
-    0xefb68c,
-    0xefb68d,
-    0xefb68e,
-    0xefb68f,
-    0xefb690,
-    0xefb691,
-    0xefb692,
-    0xefb693,
-    0xefb694,
-    0xefb695,
-    0xefb696,
-    0xefb697,
-    0xefb698,
-    0xefb699,
-    0xefb69a,
-    0xefb69b,
-    0xefb69c,
-    0xefb69d,
-    0xefb69e,
-    0xefb69f,
-    0xefb6a0,
-    0xefb6a1,
-    0xefb6a2,
-    0xefb6a3,
-    0xefb6a4,
-    0xefb6a5,
-    0xefb6a6,
-    0xefb6a7,
-    0xefb6a8,
-    0xefb6a9,
-    0xefb6aa,
-    0xefb6ab,
-    0xefb6ac,
-    0xefb6ad,
-    0xefb6ae,
-    0xefb6af,
-    0xefb6b0,
-    0xefb6b1,
-    0xefb6b2,
-    0xefb6b3,
-    0xefb6b4,
-    0xefb6b5,
-    0xefb6b6,
-    0xefb6b7,
-    0xefb6b8,
-    0xefb6b9,
-    0xefb6ba,
-    0xefb6bb,
-    0xefb6bc,
-    0xefb6bd,
-    0xefb6be,
-    0xefb6bf,
-    0xefb780,
-    0xefb781,
-    0xefb782,
-    0xefb783,
-    0xefb784,
-    0xefb785,
-    0xefb786,
-    0xefb787,
-    0xefb788,
-    0xefb789,
-    0xefb78a,
-    0xefb78b,
-    0xefb78c,
-    0xefb78d,
-    0xefb78e,
-    0xefb78f,
-    0xefb790,
-    0xefb791,
-    0xefb792,
-    0xefb793,
-    0xefb794,
-    0xefb795,
-    0xefb796,
-    0xefb797,
-    0xefb798,
-    0xefb799,
-    0xefb79a,
-    0xefb79b,
-    0xefb79c,
-    0xefb79d,
-    0xefb79e,
-    0xefb79f,
-    0xefb7a0,
-    0xefb7a1,
-    0xefb7a2,
-    0xefb7a3,
-    0xefb7a4,
-    0xefb7a5,
-    0xefb7a6,
-    0xefb7a7,
-    0xefb7a8,
-    0xefb7a9,
-    0xefb7aa,
-    0xefb7ab,
-    0xefb7ac,
-    0xefb7ad,
-    0xefb7ae,
-    0xefb7af,
-    0xefb7b0,
-    0xefb7b1,
-    0xefb7b2,
-    0xefb7b3,
-    0xefb7b4,
-    0xefb7b5,
-    0xefb7b6,
-    0xefb7b7,
-    0xefb7b8,
-    0xefb7b9,
-    0xefb7ba,
-    0xefb7bb,
-    0xefb7bc,
-    0xefb7bd,
-    0xefb7be,
-    0xefb7bf,
-    0xefb880,
-    0xefb881,
-    0xefb882,
-    0xefb883,
-    0xefb884,
-    0xefb885,
-    0xefb886,
-    0xefb887,
-    0xefb888,
-    0xefb889,
-    0xefb88a,
-    0xefb88b,
-    0xefb88c,
-    0xefb88d,
-    0xefb88e,
-    0xefb88f,
-    0xefb890,
-    0xefb891,
-    0xefb892,
-    0xefb893,
-    0xefb894,
-    0xefb895,
-    0xefb896,
-    0xefb897,
-    0xefb898,
-    0xefb899,
-    0xefb89a,
-    0xefb89b,
-    0xefb89c,
-    0xefb89d,
-    0xefb89e,
-    0xefb89f,
-    0xefb8a0,
-    0xefb8a1,
-    0xefb8a2,
-    0xefb8a3,
-    0xefb8a4,
-    0xefb8a5,
-    0xefb8a6,
-    0xefb8a7,
-    0xefb8a8,
-    0xefb8a9,
-    0xefb8aa,
-    0xefb8ab,
-    0xefb8ac,
-    0xefb8ad,
-    0xefb8ae,
-    0xefb8af,
-    0xefb8b0,
-    0xefb8b1,
-    0xefb8b2,
-    0xefb8b3,
-    0xefb8b4,
-    0xefb8b5,
-    0xefb8b6,
-    0xefb8b7,
-    0xefb8b8,
-    0xefb8b9,
-    0xefb8ba,
-    0xefb8bb,
-    0xefb8bc,
-    0xefb8bd,
-    0xefb8be,
-    0xefb8bf,
-    0xefb980,
-    0xefb981,
-    0xefb982,
-    0xefb983,
-    0xefb984,
-    0xefb985,
-    0xefb986,
-    0xefb987,
-    0xefb988,
-    0xefb989,
-    0xefb98a,
-    0xefb98b,
-    0xefb98c,
-    0xefb98d,
-    0xefb98e,
-    0xefb98f,
-    0xefb990,
-    0xefb991,
-    0xefb992,
-    0xefb993,
-    0xefb994,
-    0xefb995,
-    0xefb996,
-    0xefb997,
-    0xefb998,
-    0xefb999,
-    0xefb99a,
-    0xefb99b,
-    0xefb99c,
-    0xefb99d,
-    0xefb99e,
-    0xefb99f,
-    0xefb9a0,
-    0xefb9a1,
-    0xefb9a2,
-    0xefb9a3,
-    0xefb9a4,
-    0xefb9a5,
-    0xefb9a6,
-    0xefb9a7,
-    0xefb9a8,
-    0xefb9a9,
-    0xefb9aa,
-    0xefb9ab,
-    0xefb9ac,
-    0xefb9ad,
-    0xefb9ae,
-    0xefb9af,
-    0xefb9b0,
-    0xefb9b1,
-    0xefb9b2,
-    0xefb9b3,
-    0xefb9b4,
-    0xefb9b5,
-    0xefb9b6,
-    0xefb9b7,
-    0xefb9b8,
-    0xefb9b9,
-    0xefb9ba,
-    0xefb9bb,
-    0xefb9bc,
-    0xefb9bd,
-    0xefb9be,
-    0xefb9bf,
-    0xefba80,
-    0xefba81,
-    0xefba82,
-    0xefba83,
-    0xefba84,
-    0xefba85,
-    0xefba86,
-    0xefba87,
-    0xefba88,
-    0xefba89,
-    0xefba8a,
-    0xefba8b,
-    0xefba8c,
-    0xefba8d,
-    0xefba8e,
-    0xefba8f,
-    0xefba90,
-    0xefba91,
-    0xefba92,
-    0xefba93,
-    0xefba94,
-    0xefba95,
-    0xefba96,
-    0xefba97,
-    0xefba98,
-    0xefba99,
-    0xefba9a,
-    0xefba9b,
-    0xefba9c,
-    0xefba9d,
-    0xefba9e,
-    0xefba9f,
-    0xefbaa0,
-    0xefbaa1,
-    0xefbaa2,
-    0xefbaa3,
-    0xefbaa4,
-    0xefbaa5,
-    0xefbaa6,
-    0xefbaa7,
-    0xefbaa8,
-    0xefbaa9,
-    0xefbaaa,
-    0xefbaab,
-    0xefbaac,
-    0xefbaad,
-    0xefbaae,
-    0xefbaaf,
-    0xefbab0,
-    0xefbab1,
-    0xefbab2,
-    0xefbab3,
-    0xefbab4,
-    0xefbab5,
-    0xefbab6,
-    0xefbab7,
-    0xefbab8,
-    0xefbab9,
-    0xefbaba,
-    0xefbabb,
-    0xefbabc,
-    0xefbabd,
-    0xefbabe,
-    0xefbabf,
-    0xefbb80,
-    0xefbb81,
-    0xefbb82,
-    0xefbb83,
-    0xefbb84,
-    0xefbb85,
-    0xefbb86,
-    0xefbb87,
-    0xefbb88,
-    0xefbb89,
-    0xefbb8a,
-    0xefbb8b,
-    0xefbb8c,
-    0xefbb8d,
-    0xefbb8e,
-    0xefbb8f,
-    0xefbb90,
-    0xefbb91,
-    0xefbb92,
-    0xefbb93,
-    0xefbb94,
-    0xefbb95,
-    0xefbb96,
-    0xefbb97,
-    0xefbb98,
-    0xefbb99,
-    0xefbb9a,
-    0xefbb9b,
-    0xefbb9c,
-    0xefbb9d,
-    0xefbb9e,
-    0xefbb9f,
-    0xefbba0,
-    0xefbba1,
-    0xefbba2,
-    0xefbba3,
-    0xefbba4,
-    0xefbba5,
-    0xefbba6,
-    0xefbba7,
-    0xefbba8,
-    0xefbba9,
-    0xefbbaa,
-    0xefbbab,
-    0xefbbac,
-    0xefbbad,
-    0xefbbae,
-    0xefbbaf,
-    0xefbbb0,
-    0xefbbb1,
-    0xefbbb2,
-    0xefbbb3,
-    0xefbbb4,
-    0xefbbb5,
-    0xefbbb6,
-    0xefbbb7,
-    0xefbbb8,
-    0xefbbb9,
-    0xefbbba,
-    0xefbbbb,
-    0xefbbbc,
-    0xefbbbd,
-    0xefbbbe,
-    0xefbbbf,
-    0xefbc80,
-    0xefbc81,
-    0xefbc82,
-    0xefbc83,
-    0xefbc84,
-    0xefbc85,
-    0xefbc86,
-    0xefbc87,
-    0xefbc88,
-    0xefbc89,
-    0xefbc8a,
-    0xefbc8b,
-    0xefbc8c,
-    0xefbc8d,
-    0xefbc8e,
-    0xefbc8f,
-    0xefbc90,
-    0xefbc91,
-    0xefbc92,
-    0xefbc93,
-    0xefbc94,
-    0xefbc95,
-    0xefbc96,
-    0xefbc97,
-    0xefbc98,
-    0xefbc99,
-    0xefbc9a,
-    0xefbc9b,
-    0xefbc9c,
-    0xefbc9d,
-    0xefbc9e,
-    0xefbc9f,
-    0xefbca0,
-    0xefbca1,
-    0xefbca2,
-    0xefbca3,
-    0xefbca4,
-    0xefbca5,
-    0xefbca6,
-    0xefbca7,
-    0xefbca8,
-    0xefbca9,
-    0xefbcaa,
-    0xefbcab,
-    0xefbcac,
-    0xefbcad,
-    0xefbcae,
-    0xefbcaf,
-    0xefbcb0,
-    0xefbcb1,
-    0xefbcb2,
-    0xefbcb3,
-    0xefbcb4,
-    0xefbcb5,
-    0xefbcb6,
-    0xefbcb7,
-    0xefbcb8,
-    0xefbcb9,
-    0xefbcba,
-    0xefbcbb,
-    0xefbcbc,
-    0xefbcbd,
-    0xefbcbe,
-    0xefbcbf,
-    0xefbd80,
-    0xefbd81,
-    0xefbd82,
-    0xefbd83,
-    0xefbd84,
-    0xefbd85,
-    0xefbd86,
-    0xefbd87,
-    0xefbd88,
-    0xefbd89,
-    0xefbd8a,
-    0xefbd8b,
-    0xefbd8c,
-    0xefbd8d,
-    0xefbd8e,
-    0xefbd8f,
-    0xefbd90,
-    0xefbd91,
-    0xefbd92,
-    0xefbd93,
-    0xefbd94,
-    0xefbd95,
-    0xefbd96,
-    0xefbd97,
-    0xefbd98,
-    0xefbd99,
-    0xefbd9a,
-    0xefbd9b,
-    0xefbd9c,
-    0xefbd9d,
-    0xefbd9e,
-    0xefbd9f,
-    0xefbda0,
-    0xefbda1,
-    0xefbda2,
-    0xefbda3,
-    0xefbda4,
-    0xefbda5,
-    0xefbda6,
-    0xefbda7,
-    0xefbda8,
-    0xefbda9,
-    0xefbdaa,
-    0xefbdab,
-    0xefbdac,
-    0xefbdad,
-    0xefbdae,
-    0xefbdaf,
-    0xefbdb0,
-    0xefbdb1,
-    0xefbdb2,
-    0xefbdb3,
-    0xefbdb4,
-    0xefbdb5,
-    0xefbdb6,
-    0xefbdb7,
-    0xefbdb8,
-    0xefbdb9,
-    0xefbdba,
-    0xefbdbb,
-    0xefbdbc,
-    0xefbdbd,
-    0xefbdbe,
-    0xefbdbf,
-    0xefbe80,
-    0xefbe81,
-    0xefbe82,
-    0xefbe83,
-    0xefbe84,
-    0xefbe85,
-    0xefbe86,
-    0xefbe87,
-    0xefbe88,
-    0xefbe89,
-    0xefbe8a,
-    0xefbe8b,
-    0xefbe8c,
-    0xefbe8d,
-    0xefbe8e,
-    0xefbe8f,
-    0xefbe90,
-    0xefbe91,
-    0xefbe92,
-    0xefbe93,
-    0xefbe94,
-    0xefbe95,
-    0xefbe96,
-    0xefbe97,
-    0xefbe98,
-    0xefbe99,
-    0xefbe9a,
-    0xefbe9b,
-    0xefbe9c,
-    0xefbe9d,
-    0xefbe9e,
-    0xefbe9f,
-    0xefbea0,
-    0xefbea1,
-    0xefbea2,
-    0xefbea3,
-    0xefbea4,
-    0xefbea5,
-    0xefbea6,
-    0xefbea7,
-    0xefbea8,
-    0xefbea9,
-    0xefbeaa,
-    0xefbeab,
-    0xefbeac,
-    0xefbead,
-    0xefbeae,
-    0xefbeaf,
-    0xefbeb0,
-    0xefbeb1,
-    0xefbeb2,
-    0xefbeb3,
-    0xefbeb4,
-    0xefbeb5,
-    0xefbeb6,
-    0xefbeb7,
-    0xefbeb8,
-    0xefbeb9,
-    0xefbeba,
-    0xefbebb,
-    0xefbebc,
-    0xefbebd,
-    0xefbebe,
-    0xefbebf,
-    0xefbf80,
-    0xefbf81,
-    0xefbf82,
-    0xefbf83,
-    0xefbf84,
-    0xefbf85,
-    0xefbf86,
-    0xefbf87,
-    0xefbf88,
-    0xefbf89,
-    0xefbf8a,
-    0xefbf8b,
-    0xefbf8c,
-    0xefbf8d,
-    0xefbf8e,
-    0xefbf8f,
-    0xefbf90,
-    0xefbf91,
-    0xefbf92,
-    0xefbf93,
-    0xefbf94,
-    0xefbf95,
-    0xefbf96,
-    0xefbf97,
-    0xefbf98,
-    0xefbf99,
-    0xefbf9a,
-    0xefbf9b,
-    0xefbf9c,
-    0xefbf9d,
-    0xefbf9e,
-    0xefbf9f,
-    0xefbfa0,
-    0xefbfa1,
-    0xefbfa2,
-    0xefbfa3,
-    0xefbfa4,
-    0xefbfa5,
-    0xefbfa6,
-    0xefbfa7,
-    0xefbfa8,
-    0xefbfa9,
-    0xefbfaa,
-    0xefbfab,
-    0xefbfac,
-    0xefbfad,
-    0xefbfae,
-    0xefbfaf,
-    0xefbfb0,
-    0xefbfb1,
-    0xefbfb2,
-    0xefbfb3,
-    0xefbfb4,
-    0xefbfb5,
-    0xefbfb6,
-    0xefbfb7,
-    0xefbfb8,
-    0xefbfb9,
-    0xefbfba,
-    0xefbfbb,
-    0xefbfbc,
-    0xefbfbd,
-    0xefbfbe,
-    0xefbfbf
-};
-
-// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -0,0 +1,83 @@
+/***************************************************************************
+ *   Copyright (C) 2012~2012 by CSSlayer                                   *
+ *   wengxt@gmail.com                                                      *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA.              *
+ ***************************************************************************/
+
+#ifndef _FCITX_CONFIGCACHE_INTERNAL_H_
+#define _FCITX_CONFIGCACHE_INTERNAL_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include "fcitx-utils/utils.h"
+
+/* record type of the parsed ini in cache */
+#define FCITX_CONFIG_CACHE_GROUP 'G'
+#define FCITX_CONFIG_CACHE_OPTION 'O'
+#define FCITX_CONFIG_CACHE_SUBKEY 'S'
+
+/**
+ * identity of an opened file, dev and ino are used as the hash key,
+ * others tell whether the file is changed since it's cached
+ */
+typedef struct _FcitxConfigCacheKey {
+    uint64_t dev;
+    uint64_t ino;
+    int64_t size;
+    int64_t mtimeSec;
+    int64_t mtimeNsec;
+    int64_t ctimeSec;
+    int64_t ctimeNsec;
+    boolean valid; /**< file can be cached */
+} FcitxConfigCacheKey;
+
+/**
+ * record of one FcitxConfigParseIniFp, every record is a type byte and
+ * nul terminated strings, group has a name, option has name and value,
+ * subkey has name, subkey name and value.
+ */
+typedef struct _FcitxConfigCacheBuffer {
+    char* data;
+    size_t len;
+    size_t size;
+} FcitxConfigCacheBuffer;
+
+void FcitxConfigCacheBufferAppend(FcitxConfigCacheBuffer* buffer, char type,
+                                  const char* name, const char* subkey,
+                                  const char* value);
+void FcitxConfigCacheBufferFree(FcitxConfigCacheBuffer* buffer);
+
+/**
+ * look up the record of fp, key is filled for FcitxConfigCacheAdd
+ *
+ * @return record or NULL if the file is not cached or changed
+ */
+const char* FcitxConfigCacheFind(FILE* fp, FcitxConfigCacheKey* key, size_t* len);
+
+/**
+ * add or replace a record, cache takes the data of buffer
+ */
+void FcitxConfigCacheAdd(const FcitxConfigCacheKey* key, FcitxConfigCacheBuffer* buffer);
+
+/**
+ * create the directory and its parents, defined in xdg.c
+ */
+void FcitxXDGMakePath(const char* path);
+
+#endif
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
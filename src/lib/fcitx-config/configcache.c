@@ -0,0 +1,416 @@
+/***************************************************************************
+ *   Copyright (C) 2012~2012 by CSSlayer                                   *
+ *   wengxt@gmail.com                                                      *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA.              *
+ ***************************************************************************/
+
+/**
+ * @file configcache.c
+ *
+ * binary cache of parsed ini file, the cache file is mmap-ed, and a file
+ * is validated by a single fstat on the opened file, no matter who opened it.
+ */
+
+#define FCITX_CONFIG_XDG_DEPRECATED
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <libgen.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "fcitx/fcitx.h"
+#include "fcitx-config.h"
+#include "xdg.h"
+#include "fcitx-utils/log.h"
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/uthash.h"
+#include "configcache-internal.h"
+
+#define FCITX_CONFIG_CACHE_MAGIC "FCXCACHE"
+#define FCITX_CONFIG_CACHE_VERSION 1
+#define FCITX_CONFIG_CACHE_NAME "configcache"
+#define FCITX_CONFIG_CACHE_KEY_LEN (sizeof(uint64_t) * 2)
+
+typedef struct _FcitxConfigCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+} FcitxConfigCacheHeader;
+
+/* every entry is followed by data, padded to 8 bytes */
+typedef struct _FcitxConfigCacheEntry {
+    uint64_t dev;
+    uint64_t ino;
+    int64_t size;
+    int64_t mtimeSec;
+    int64_t mtimeNsec;
+    int64_t ctimeSec;
+    int64_t ctimeNsec;
+    uint64_t dataLen;
+} FcitxConfigCacheEntry;
+
+typedef struct _FcitxConfigCacheItem {
+    FcitxConfigCacheKey key;
+    const char* data;
+    size_t dataLen;
+    char* owned; /**< data not in the mapped file */
+    boolean used;
+    UT_hash_handle hh;
+} FcitxConfigCacheItem;
+
+typedef struct _FcitxConfigCache {
+    boolean enabled;
+    boolean dirty;
+    char* path;
+    void* map;
+    size_t mapLen;
+    FcitxConfigCacheItem* items;
+} FcitxConfigCache;
+
+static FcitxConfigCache configCache;
+
+static boolean FcitxConfigCacheCheckData(const char* data, size_t len)
+{
+    const char* end = data + len;
+    boolean hasGroup = false;
+    while (data < end) {
+        int count;
+        switch (*data++) {
+        case FCITX_CONFIG_CACHE_GROUP:
+            hasGroup = true;
+            count = 1;
+            break;
+        case FCITX_CONFIG_CACHE_OPTION:
+            count = 2;
+            break;
+        case FCITX_CONFIG_CACHE_SUBKEY:
+            count = 3;
+            break;
+        default:
+            return false;
+        }
+        if (!hasGroup)
+            return false;
+        while (count--) {
+            const char* nul = memchr(data, '\0', end - data);
+            if (!nul)
+                return false;
+            data = nul + 1;
+        }
+    }
+    return true;
+}
+
+static boolean FcitxConfigCacheKeyEqual(const FcitxConfigCacheKey* a, const FcitxConfigCacheKey* b)
+{
+    return a->dev == b->dev && a->ino == b->ino && a->size == b->size
+        && a->mtimeSec == b->mtimeSec && a->mtimeNsec == b->mtimeNsec
+        && a->ctimeSec == b->ctimeSec && a->ctimeNsec == b->ctimeNsec;
+}
+
+static void FcitxConfigCacheMap()
+{
+    struct stat fileStat;
+    int fd = open(configCache.path, O_RDONLY);
+    if (fd < 0)
+        return;
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t) sizeof(FcitxConfigCacheHeader)) {
+        close(fd);
+        return;
+    }
+
+    void* map = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return;
+
+    configCache.map = map;
+    configCache.mapLen = fileStat.st_size;
+
+    const FcitxConfigCacheHeader* header = map;
+    if (memcmp(header->magic, FCITX_CONFIG_CACHE_MAGIC, sizeof(header->magic)) != 0
+        || header->version != FCITX_CONFIG_CACHE_VERSION)
+        return;
+
+    const char* p = (const char*) map + sizeof(FcitxConfigCacheHeader);
+    const char* end = (const char*) map + configCache.mapLen;
+    uint32_t i;
+    for (i = 0; i < header->count; i++) {
+        if ((size_t)(end - p) < sizeof(FcitxConfigCacheEntry))
+            break;
+        const FcitxConfigCacheEntry* entry = (const FcitxConfigCacheEntry*) p;
+        const char* data = p + sizeof(FcitxConfigCacheEntry);
+        if (entry->dataLen > (size_t)(end - data)
+            || !FcitxConfigCacheCheckData(data, entry->dataLen)) {
+            FcitxLog(WARNING, "Config cache %s is broken", configCache.path);
+            break;
+        }
+        p = data + fcitx_utils_align_to(entry->dataLen, sizeof(uint64_t));
+
+        FcitxConfigCacheItem* item;
+        HASH_FIND(hh, configCache.items, entry, FCITX_CONFIG_CACHE_KEY_LEN, item);
+        if (item)
+            continue;
+        item = fcitx_utils_new(FcitxConfigCacheItem);
+        item->key.dev = entry->dev;
+        item->key.ino = entry->ino;
+        item->key.size = entry->size;
+        item->key.mtimeSec = entry->mtimeSec;
+        item->key.mtimeNsec = entry->mtimeNsec;
+        item->key.ctimeSec = entry->ctimeSec;
+        item->key.ctimeNsec = entry->ctimeNsec;
+        item->key.valid = true;
+        item->data = data;
+        item->dataLen = entry->dataLen;
+        HASH_ADD(hh, configCache.items, key, FCITX_CONFIG_CACHE_KEY_LEN, item);
+    }
+}
+
+FCITX_EXPORT_API
+void FcitxConfigCacheOpen(const char* path)
+{
+    FcitxConfigCacheClose();
+
+    if (path) {
+        configCache.path = strdup(path);
+    } else {
+        size_t len;
+        char** cachePath = FcitxXDGGetPath(&len, "XDG_CACHE_HOME", ".cache",
+                                           PACKAGE, NULL, NULL);
+        fcitx_utils_alloc_cat_str(configCache.path, cachePath[0],
+                                  "/" FCITX_CONFIG_CACHE_NAME);
+        FcitxXDGFreePath(cachePath);
+    }
+
+    configCache.enabled = true;
+    FcitxConfigCacheMap();
+}
+
+FCITX_EXPORT_API
+boolean FcitxConfigCacheSave()
+{
+    FcitxConfigCacheItem* item;
+    FcitxConfigCacheItem* next;
+    uint32_t count = 0;
+
+    if (!configCache.enabled)
+        return false;
+
+    for (item = configCache.items; item; item = item->hh.next) {
+        if (item->used)
+            count++;
+    }
+
+    /* nothing changed and every entry is still in use */
+    if (!configCache.dirty && count == HASH_COUNT(configCache.items))
+        return true;
+
+    char* dirc = strdup(configCache.path);
+    FcitxXDGMakePath(dirname(dirc));
+    free(dirc);
+
+    char* tmpPath;
+    fcitx_utils_alloc_cat_str(tmpPath, configCache.path, ".XXXXXX");
+    int fd = mkstemp(tmpPath);
+    FILE* fp = fd >= 0 ? fdopen(fd, "w") : NULL;
+    if (!fp) {
+        if (fd >= 0) {
+            close(fd);
+            unlink(tmpPath);
+        }
+        free(tmpPath);
+        return false;
+    }
+
+    static const char padding[sizeof(uint64_t)] = { 0 };
+    FcitxConfigCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FCITX_CONFIG_CACHE_MAGIC, sizeof(header.magic));
+    header.version = FCITX_CONFIG_CACHE_VERSION;
+    header.count = count;
+    boolean success = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+    for (item = configCache.items; item && success; item = item->hh.next) {
+        if (!item->used)
+            continue;
+        FcitxConfigCacheEntry entry;
+        entry.dev = item->key.dev;
+        entry.ino = item->key.ino;
+        entry.size = item->key.size;
+        entry.mtimeSec = item->key.mtimeSec;
+        entry.mtimeNsec = item->key.mtimeNsec;
+        entry.ctimeSec = item->key.ctimeSec;
+        entry.ctimeNsec = item->key.ctimeNsec;
+        entry.dataLen = item->dataLen;
+        size_t padLen = fcitx_utils_align_to(item->dataLen, sizeof(uint64_t)) - item->dataLen;
+        success = fwrite(&entry, sizeof(entry), 1, fp) == 1
+            && fwrite(item->data, 1, item->dataLen, fp) == item->dataLen
+            && fwrite(padding, 1, padLen, fp) == padLen;
+    }
+
+    if (fclose(fp) != 0)
+        success = false;
+    if (success && rename(tmpPath, configCache.path) != 0)
+        success = false;
+    if (!success) {
+        FcitxLog(WARNING, "Failed to save config cache %s", configCache.path);
+        unlink(tmpPath);
+        free(tmpPath);
+        return false;
+    }
+    free(tmpPath);
+
+    /* entries not in use are not in the new file */
+    for (item = configCache.items; item; item = next) {
+        next = item->hh.next;
+        if (!item->used) {
+            HASH_DEL(configCache.items, item);
+            free(item->owned);
+            free(item);
+        }
+    }
+    configCache.dirty = false;
+    return true;
+}
+
+FCITX_EXPORT_API
+void FcitxConfigCacheClose()
+{
+    while (configCache.items) {
+        FcitxConfigCacheItem* item = configCache.items;
+        HASH_DEL(configCache.items, item);
+        free(item->owned);
+        free(item);
+    }
+    if (configCache.map)
+        munmap(configCache.map, configCache.mapLen);
+    free(configCache.path);
+    memset(&configCache, 0, sizeof(configCache));
+}
+
+const char* FcitxConfigCacheFind(FILE* fp, FcitxConfigCacheKey* key, size_t* len)
+{
+    struct stat fileStat;
+    memset(key, 0, sizeof(FcitxConfigCacheKey));
+    if (!configCache.enabled)
+        return NULL;
+
+    int fd = fileno(fp);
+    if (fd < 0 || fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        return NULL;
+    /* someone has read from it */
+    if (ftello(fp) != 0)
+        return NULL;
+
+    /*
+     * a file changed again within the same second may keep the same
+     * time stamp on some file systems, don't trust a new one
+     */
+    if (fileStat.st_mtime >= time(NULL) - 1)
+        return NULL;
+
+    key->dev = fileStat.st_dev;
+    key->ino = fileStat.st_ino;
+    key->size = fileStat.st_size;
+    key->mtimeSec = fileStat.st_mtim.tv_sec;
+    key->mtimeNsec = fileStat.st_mtim.tv_nsec;
+    key->ctimeSec = fileStat.st_ctim.tv_sec;
+    key->ctimeNsec = fileStat.st_ctim.tv_nsec;
+    key->valid = true;
+
+    FcitxConfigCacheItem* item;
+    HASH_FIND(hh, configCache.items, key, FCITX_CONFIG_CACHE_KEY_LEN, item);
+    if (!item || !FcitxConfigCacheKeyEqual(&item->key, key))
+        return NULL;
+
+    item->used = true;
+    /* behave like the file is parsed */
+    fseeko(fp, 0, SEEK_END);
+    *len = item->dataLen;
+    return item->dataLen ? item->data : "";
+}
+
+void FcitxConfigCacheAdd(const FcitxConfigCacheKey* key, FcitxConfigCacheBuffer* buffer)
+{
+    FcitxConfigCacheItem* item;
+    if (!configCache.enabled || !key->valid) {
+        FcitxConfigCacheBufferFree(buffer);
+        return;
+    }
+
+    HASH_FIND(hh, configCache.items, key, FCITX_CONFIG_CACHE_KEY_LEN, item);
+    if (item) {
+        free(item->owned);
+    } else {
+        item = fcitx_utils_new(FcitxConfigCacheItem);
+        item->key = *key;
+        HASH_ADD(hh, configCache.items, key, FCITX_CONFIG_CACHE_KEY_LEN, item);
+    }
+    item->key = *key;
+    item->owned = buffer->data;
+    item->data = buffer->data;
+    item->dataLen = buffer->len;
+    item->used = true;
+    buffer->data = NULL;
+    buffer->len = buffer->size = 0;
+    configCache.dirty = true;
+}
+
+static void FcitxConfigCacheBufferAppendString(FcitxConfigCacheBuffer* buffer, const char* str)
+{
+    size_t len = strlen(str) + 1;
+    if (buffer->len + len > buffer->size) {
+        while (buffer->len + len > buffer->size)
+            buffer->size = buffer->size ? buffer->size * 2 : 256;
+        buffer->data = realloc(buffer->data, buffer->size);
+    }
+    memcpy(buffer->data + buffer->len, str, len);
+    buffer->len += len;
+}
+
+void FcitxConfigCacheBufferAppend(FcitxConfigCacheBuffer* buffer, char type,
+                                  const char* name, const char* subkey,
+                                  const char* value)
+{
+    const char typeStr[2] = { type, '\0' };
+    /* type is a single byte, drop the nul after it */
+    FcitxConfigCacheBufferAppendString(buffer, typeStr);
+    buffer->len--;
+    FcitxConfigCacheBufferAppendString(buffer, name);
+    if (subkey)
+        FcitxConfigCacheBufferAppendString(buffer, subkey);
+    if (value)
+        FcitxConfigCacheBufferAppendString(buffer, value);
+}
+
+void FcitxConfigCacheBufferFree(FcitxConfigCacheBuffer* buffer)
+{
+    if (!buffer)
+        return;
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->len = buffer->size = 0;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
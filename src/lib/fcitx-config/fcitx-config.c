@@ -37,6 +37,7 @@
 #include "fcitx-utils/log.h"
 #include "hotkey.h"
 #include "fcitx-utils/utils.h"
+#include "configcache-internal.h"
 
 
 #define IsColorValid(c) ((c) >=0 && (c) <= 255)
@@ -860,6 +861,107 @@ FcitxConfigFile* FcitxConfigParseIni(char* filename, FcitxConfigFile* reuse)
     return cf;
 }
 
+static FcitxConfigGroup*
+FcitxConfigIniAddGroup(FcitxConfigFile* cfile, const char* name, size_t grp_len, int lineNo)
+{
+    FcitxConfigGroup* curGroup;
+    HASH_FIND(hh, cfile->groups, name, grp_len, curGroup);
+    if (curGroup) {
+        FcitxLog(DEBUG, _("Duplicate group name, "
+                          "merge with the previous: %s :line %d"),
+                 curGroup->groupName, lineNo);
+        return curGroup;
+    }
+
+    char *groupName;
+    groupName = fcitx_utils_set_str_with_len(NULL, name, grp_len);
+    curGroup = fcitx_utils_malloc0(sizeof(FcitxConfigGroup));
+    curGroup->groupName = groupName;
+    curGroup->options = NULL;
+    curGroup->groupDesc = NULL;
+    HASH_ADD_KEYPTR(hh, cfile->groups, curGroup->groupName,
+                    grp_len, curGroup);
+    return curGroup;
+}
+
+static void
+FcitxConfigIniSetOption(FcitxConfigGroup* curGroup, const char* name, const char* subkeyname, const char* value, int lineNo)
+{
+    FcitxConfigOption *option;
+
+    HASH_FIND_STR(curGroup->options, name, option);
+
+    if (option) {
+        if (subkeyname) {
+            FcitxConfigOptionSubkey* subkey = NULL;
+            HASH_FIND_STR(option->subkey, subkeyname, subkey);
+
+            if (subkey) {
+                free(subkey->rawValue);
+                subkey->rawValue = strdup(value);
+            } else {
+                subkey = fcitx_utils_malloc0(sizeof(FcitxConfigOptionSubkey));
+                subkey->subkeyName = strdup(subkeyname);
+                subkey->rawValue = strdup(value);
+                HASH_ADD_KEYPTR(hh, option->subkey, subkey->subkeyName, strlen(subkey->subkeyName), subkey);
+            }
+        } else {
+            FcitxLog(DEBUG, _("Duplicate option, overwrite: line %d"), lineNo);
+            free(option->rawValue);
+            option->rawValue = strdup(value);
+        }
+    } else {
+        option = fcitx_utils_malloc0(sizeof(FcitxConfigOption));
+        option->optionName = strdup(name);
+        option->rawValue = strdup(value);
+        HASH_ADD_KEYPTR(hh, curGroup->options, option->optionName, strlen(option->optionName), option);
+
+        /* if the subkey is new, and no default key exists, so we can assign it to default value */
+
+        if (subkeyname) {
+            FcitxConfigOptionSubkey* subkey = NULL;
+            subkey = fcitx_utils_malloc0(sizeof(FcitxConfigOptionSubkey));
+            subkey->subkeyName = strdup(subkeyname);
+            subkey->rawValue = strdup(value);
+            HASH_ADD_KEYPTR(hh, option->subkey, subkey->subkeyName, strlen(subkey->subkeyName), subkey);
+        }
+    }
+}
+
+/**
+ * replay the record of FcitxConfigParseIniFp saved in config cache,
+ * the record is already checked when the cache is loaded
+ */
+static FcitxConfigFile*
+FcitxConfigReplayIni(const char* data, size_t len, FcitxConfigFile* cfile)
+{
+    const char* end = data + len;
+    FcitxConfigGroup* curGroup = NULL;
+
+    if (!cfile)
+        cfile = fcitx_utils_new(FcitxConfigFile);
+
+    while (data < end) {
+        char type = *data++;
+        const char* name = data;
+        data += strlen(data) + 1;
+        if (type == FCITX_CONFIG_CACHE_GROUP) {
+            curGroup = FcitxConfigIniAddGroup(cfile, name, strlen(name), 0);
+        } else {
+            const char* subkey = NULL;
+            if (type == FCITX_CONFIG_CACHE_SUBKEY) {
+                subkey = data;
+                data += strlen(data) + 1;
+            }
+            const char* value = data;
+            data += strlen(data) + 1;
+            FcitxConfigIniSetOption(curGroup, name, subkey, value, 0);
+        }
+    }
+
+    return cfile;
+}
+
 FCITX_EXPORT_API
 FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
 {
@@ -870,6 +972,20 @@ FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
     if (!fp)
         return cfile;
 
+    FcitxConfigCacheKey cacheKey;
+    size_t cacheLen;
+    const char* cacheData = FcitxConfigCacheFind(fp, &cacheKey, &cacheLen);
+    if (cacheData)
+        return FcitxConfigReplayIni(cacheData, cacheLen, cfile);
+
+    /* only file parsed without any warning is cached */
+    FcitxConfigCacheBuffer record;
+    FcitxConfigCacheBuffer* recorder = NULL;
+    if (cacheKey.valid) {
+        memset(&record, 0, sizeof(record));
+        recorder = &record;
+    }
+
     if (!cfile)
         cfile = fcitx_utils_new(FcitxConfigFile);
 
@@ -892,26 +1008,16 @@ FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
         if (line[0] == '[') {
             if (!(line[lineLen - 1] == ']' && lineLen != 2)) {
                 FcitxLog(ERROR, _("Configure group name error: line %d"), lineNo);
+                FcitxConfigCacheBufferFree(recorder);
                 return NULL;
             }
 
             size_t grp_len = lineLen - 2;
-            HASH_FIND(hh, cfile->groups, line + 1, grp_len, curGroup);
-            if (curGroup) {
-                FcitxLog(DEBUG, _("Duplicate group name, "
-                                  "merge with the previous: %s :line %d"),
-                         curGroup->groupName, lineNo);
-                continue;
+            curGroup = FcitxConfigIniAddGroup(cfile, line + 1, grp_len, lineNo);
+            if (recorder) {
+                line[lineLen - 1] = '\0';
+                FcitxConfigCacheBufferAppend(recorder, FCITX_CONFIG_CACHE_GROUP, line + 1, NULL, NULL);
             }
-
-            char *groupName;
-            groupName = fcitx_utils_set_str_with_len(NULL, line + 1, grp_len);
-            curGroup = fcitx_utils_malloc0(sizeof(FcitxConfigGroup));
-            curGroup->groupName = groupName;
-            curGroup->options = NULL;
-            curGroup->groupDesc = NULL;
-            HASH_ADD_KEYPTR(hh, cfile->groups, curGroup->groupName,
-                            grp_len, curGroup);
         } else {
             if (curGroup == NULL)
                 continue;
@@ -920,6 +1026,8 @@ FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
 
             if (!value) {
                 FcitxLog(WARNING, _("Invalid Entry: line %d missing '='"), lineNo);
+                FcitxConfigCacheBufferFree(recorder);
+                recorder = NULL;
                 goto next_line;
             }
 
@@ -946,44 +1054,11 @@ FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
                 }
             }
 
-            FcitxConfigOption *option;
-
-            HASH_FIND_STR(curGroup->options, name, option);
-
-            if (option) {
-                if (subkeyname) {
-                    FcitxConfigOptionSubkey* subkey = NULL;
-                    HASH_FIND_STR(option->subkey, subkeyname, subkey);
-
-                    if (subkey) {
-                        free(subkey->rawValue);
-                        subkey->rawValue = strdup(value);
-                    } else {
-                        subkey = fcitx_utils_malloc0(sizeof(FcitxConfigOptionSubkey));
-                        subkey->subkeyName = strdup(subkeyname);
-                        subkey->rawValue = strdup(value);
-                        HASH_ADD_KEYPTR(hh, option->subkey, subkey->subkeyName, strlen(subkey->subkeyName), subkey);
-                    }
-                } else {
-                    FcitxLog(DEBUG, _("Duplicate option, overwrite: line %d"), lineNo);
-                    free(option->rawValue);
-                    option->rawValue = strdup(value);
-                }
-            } else {
-                option = fcitx_utils_malloc0(sizeof(FcitxConfigOption));
-                option->optionName = strdup(name);
-                option->rawValue = strdup(value);
-                HASH_ADD_KEYPTR(hh, curGroup->options, option->optionName, strlen(option->optionName), option);
-
-                /* if the subkey is new, and no default key exists, so we can assign it to default value */
-
-                if (subkeyname) {
-                    FcitxConfigOptionSubkey* subkey = NULL;
-                    subkey = fcitx_utils_malloc0(sizeof(FcitxConfigOptionSubkey));
-                    subkey->subkeyName = strdup(subkeyname);
-                    subkey->rawValue = strdup(value);
-                    HASH_ADD_KEYPTR(hh, option->subkey, subkey->subkeyName, strlen(subkey->subkeyName), subkey);
-                }
+            FcitxConfigIniSetOption(curGroup, name, subkeyname, value, lineNo);
+            if (recorder) {
+                FcitxConfigCacheBufferAppend(recorder,
+                                             subkeyname ? FCITX_CONFIG_CACHE_SUBKEY : FCITX_CONFIG_CACHE_OPTION,
+                                             name, subkeyname, value);
             }
         }
 
@@ -998,6 +1073,9 @@ FcitxConfigFile* FcitxConfigParseIniFp(FILE *fp, FcitxConfigFile *cfile)
     if (buf)
         free(buf);
 
+    if (recorder)
+        FcitxConfigCacheAdd(&cacheKey, recorder);
+
     return cfile;
 }
 
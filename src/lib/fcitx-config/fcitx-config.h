@@ -546,6 +546,36 @@ boolean name##LoadConfig(type* _cfg) { \
      **/
     FcitxConfigFile* FcitxConfigParseIniFp(FILE* fp, FcitxConfigFile* reuse);
 
+    /**
+     * keep the parsed ini file in a binary cache, FcitxConfigParseIniFp will
+     * skip parsing an unchanged file, the cache is not thread safe.
+     *
+     * @param path cache file, NULL for $XDG_CACHE_HOME/fcitx/configcache
+     * @return void
+     *
+     * @since 4.2.9.7
+     **/
+    void FcitxConfigCacheOpen(const char* path);
+
+    /**
+     * write cache back if anything changed, only the files used since the
+     * cache is opened or saved last time are kept.
+     *
+     * @return boolean cache is saved or nothing to save
+     *
+     * @since 4.2.9.7
+     **/
+    boolean FcitxConfigCacheSave();
+
+    /**
+     * close the cache, it doesn't save the cache
+     *
+     * @return void
+     *
+     * @since 4.2.9.7
+     **/
+    void FcitxConfigCacheClose();
+
     /**
      * free a config file
      *
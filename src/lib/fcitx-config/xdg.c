@@ -42,6 +42,7 @@
 #include "fcitx/fcitx.h"
 #include "fcitx-utils/utils.h"
 #include "xdg.h"
+#include "configcache-internal.h"
 
 static inline void
 combine_path_with_len(char *dest, const char *str1, size_t len1,
@@ -52,8 +53,8 @@ combine_path_with_len(char *dest, const char *str1, size_t len1,
     fcitx_utils_cat_str(dest, 3, str_list, size_list);
 }
 
-static void
-make_path(const char *path)
+void
+FcitxXDGMakePath(const char *path)
 {
     char *p;
     if (fcitx_utils_isdir(path))
@@ -129,7 +130,7 @@ void FcitxXDGMakeDirUser(const char* prefix)
     size_t len;
     char ** path = FcitxXDGGetPathUserWithPrefix(&len, prefix);
 
-    make_path(path[0]);
+    FcitxXDGMakePath(path[0]);
 
     FcitxXDGFreePath(path);
 }
@@ -176,7 +177,7 @@ FILE *FcitxXDGGetFile(const char *fileName, char **path, const char *mode,
             *retFile = strdup(path[0]);
         }
         if (strchr(mode, 'w') || strchr(mode, 'a')) {
-            make_path(path[0]);
+            FcitxXDGMakePath(path[0]);
         }
         return NULL;
     }
@@ -198,7 +199,7 @@ FILE *FcitxXDGGetFile(const char *fileName, char **path, const char *mode,
             fcitx_utils_alloc_cat_str(buf, path[0], "/", fileName);
             char *dirc = strdup(buf);
             char *dir = dirname(dirc);
-            make_path(dir);
+            FcitxXDGMakePath(dir);
             free(dirc);
             fp = fopen(buf, mode);
         } else {
@@ -354,15 +355,26 @@ FcitxStringHashSet* FcitxXDGGetFiles(const char *path, const char *prefix, const
                 continue;
             if (prefix && strncmp(drt->d_name, prefix, prefixlen) != 0)
                 continue;
-            size_t len1 = strlen(xdgPath[i]);
-            char path_buf[nameLen + len1 + 2];
-            combine_path_with_len(path_buf, xdgPath[i], len1,
-                                  drt->d_name, nameLen);
-            int statresult = stat(path_buf, &fileStat);
-            if (statresult == -1)
+            boolean isFile = false;
+#ifdef _DIRENT_HAVE_D_TYPE
+            /* only stat when readdir can't tell, or it's a link */
+            if (drt->d_type == DT_REG)
+                isFile = true;
+            else if (drt->d_type != DT_UNKNOWN && drt->d_type != DT_LNK)
                 continue;
+#endif
+            if (!isFile) {
+                size_t len1 = strlen(xdgPath[i]);
+                char path_buf[nameLen + len1 + 2];
+                combine_path_with_len(path_buf, xdgPath[i], len1,
+                                      drt->d_name, nameLen);
+                int statresult = stat(path_buf, &fileStat);
+                if (statresult == -1)
+                    continue;
+                isFile = (fileStat.st_mode & S_IFREG) != 0;
+            }
 
-            if (fileStat.st_mode & S_IFREG) {
+            if (isFile) {
                 FcitxStringHashSet *string;
                 HASH_FIND_STR(sset, drt->d_name, string);
                 if (!string) {
@@ -127,3 +127,23 @@ fcitx_memory_pool_clear(FcitxMemoryPool *pool)
     utarray_clear(pool->fullchunks);
     utarray_clear(pool->chunks);
 }
+
+FCITX_EXPORT_API
+void
+fcitx_memory_pool_reset(FcitxMemoryPool *pool)
+{
+    FcitxMemoryChunk* chunk;
+    for (chunk = (FcitxMemoryChunk*) utarray_front(pool->fullchunks);
+         chunk != NULL;
+         chunk = (FcitxMemoryChunk*) utarray_next(pool->fullchunks, chunk)) {
+        utarray_push_back(pool->chunks, chunk);
+        /* the chunk is moved, don't let utarray_clear free it */
+        chunk->memory = NULL;
+    }
+    utarray_clear(pool->fullchunks);
+
+    for (chunk = (FcitxMemoryChunk*) utarray_front(pool->chunks);
+         chunk != NULL;
+         chunk = (FcitxMemoryChunk*) utarray_next(pool->chunks, chunk))
+        chunk->cur = chunk->memory;
+}
@@ -96,6 +96,17 @@ void fcitx_memory_pool_destroy(FcitxMemoryPool* pool);
  **/
 void fcitx_memory_pool_clear(FcitxMemoryPool* pool);
 
+/**
+ * mark all the memory inside the pool as unused but keep it for later
+ * allocation, so a pool reused in a loop will stop calling malloc once
+ * it reaches its peak size. Memory returned afterwards is not zeroed.
+ *
+ * @param pool memory pool
+ * @return void
+ * @since 4.2.9.7
+ **/
+void fcitx_memory_pool_reset(FcitxMemoryPool* pool);
+
 #ifdef __cplusplus
 }
 #endif
@@ -96,3 +96,111 @@ fcitx_msort_r(void *b, size_t n, size_t s, int(*cmp)(const void *, const void*,
         }
     }
 }
+
+typedef struct {
+    const char* b;
+    size_t s;
+    int(*cmp)(const void *, const void *, void *);
+    void* thunk;
+} TopKContext;
+
+/* order by element, then by the original position to keep it stable */
+static inline int
+topk_cmp(const TopKContext* ctx, size_t a, size_t b)
+{
+    int result = ctx->cmp(ctx->b + a * ctx->s, ctx->b + b * ctx->s, ctx->thunk);
+    if (result != 0)
+        return result;
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static int
+topk_index_cmp(const void* a, const void* b, void* thunk)
+{
+    return topk_cmp(thunk, *(const size_t*) a, *(const size_t*) b);
+}
+
+/* max heap of indexes, the root is the largest one being kept */
+static void
+topk_sift_down(const TopKContext* ctx, size_t* heap, size_t k, size_t i)
+{
+    while (1) {
+        size_t largest = i;
+        size_t l = 2 * i + 1;
+        size_t r = l + 1;
+        if (l < k && topk_cmp(ctx, heap[l], heap[largest]) > 0)
+            largest = l;
+        if (r < k && topk_cmp(ctx, heap[r], heap[largest]) > 0)
+            largest = r;
+        if (largest == i)
+            break;
+        size_t t = heap[i];
+        heap[i] = heap[largest];
+        heap[largest] = t;
+        i = largest;
+    }
+}
+
+FCITX_EXPORT_API
+void
+fcitx_msort_topk_r(void *b, size_t n, size_t s, size_t k, int(*cmp)(const void *, const void*, void *), void* thunk)
+{
+    if (k == 0 || n < 2)
+        return;
+
+    /* a bounded heap only pays off if k is much smaller than n */
+    if (k > n / 2 || n < MINIMUM_INSERT_SORT) {
+        fcitx_msort_r(b, n, s, cmp, thunk);
+        return;
+    }
+
+    size_t* heap = malloc(k * sizeof(size_t));
+    char* mark = calloc(n, 1);
+    char* tmp = malloc(k * s);
+
+    if (!heap || !mark || !tmp) {
+        free(heap);
+        free(mark);
+        free(tmp);
+        fcitx_msort_r(b, n, s, cmp, thunk);
+        return;
+    }
+
+    TopKContext ctx = {b, s, cmp, thunk};
+    size_t i;
+    for (i = 0; i < k; i++)
+        heap[i] = i;
+    for (i = k / 2; i-- > 0;)
+        topk_sift_down(&ctx, heap, k, i);
+
+    /* index i is always larger than any index in heap, equal means larger */
+    for (i = k; i < n; i++) {
+        if (cmp(ctx.b + i * s, ctx.b + heap[0] * s, thunk) < 0) {
+            heap[0] = i;
+            topk_sift_down(&ctx, heap, k, 0);
+        }
+    }
+
+    fcitx_msort_r(heap, k, sizeof(size_t), topk_index_cmp, &ctx);
+
+    for (i = 0; i < k; i++) {
+        memcpy(tmp + i * s, ctx.b + heap[i] * s, s);
+        mark[heap[i]] = 1;
+    }
+
+    /* move the rest to the end, from back to front so nothing is overwritten */
+    char* cb = b;
+    size_t dest = n;
+    for (i = n; i-- > 0;) {
+        if (mark[i])
+            continue;
+        dest--;
+        if (dest != i)
+            memcpy(cb + dest * s, cb + i * s, s);
+    }
+    memcpy(cb, tmp, k * s);
+
+    free(heap);
+    free(mark);
+    free(tmp);
+}
@@ -307,6 +307,18 @@ void fcitx_msort_r(void *base_, size_t nmemb, size_t size,
                    int (*compar)(const void *, const void *, void *),
                    void *thunk);
 
+/*
+ * Put the first k elements in the same order fcitx_msort_r would, the others
+ * are left behind them in unspecified order, except that equal elements keep
+ * their original order. So sorting the rest later with fcitx_msort_r or
+ * fcitx_msort_topk_r gives the same result as sorting the whole array once.
+ *
+ * @since 4.2.9.7
+ */
+void fcitx_msort_topk_r(void *base_, size_t nmemb, size_t size, size_t k,
+                        int (*compar)(const void *, const void *, void *),
+                        void *thunk);
+
 #define utarray_sort_r(a, cmp, arg) do {                        \
         fcitx_qsort_r((a)->d, (a)->i, (a)->icd->sz, cmp, arg);  \
     } while(0)
@@ -315,6 +327,10 @@ void fcitx_msort_r(void *base_, size_t nmemb, size_t size,
         fcitx_msort_r((a)->d, (a)->i, (a)->icd->sz, cmp, arg);  \
     } while(0)
 
+#define utarray_msort_topk_r(a, k, cmp, arg) do {                       \
+        fcitx_msort_topk_r((a)->d, (a)->i, (a)->icd->sz, k, cmp, arg);  \
+    } while(0)
+
 #define utarray_eltidx(a, e) (((char*)(e) >= (char*)((a)->d)) ?         \
                               (((char*)(e) - (char*)((a)->d)) / (a)->icd->sz) : \
                               -1)
@@ -25,10 +25,28 @@
 #include "instance.h"
 
 boolean FcitxCheckABIVersion(void* handle, const char* addonName);
+int FcitxGetABIVersion(void* handle, const char* addonName);
 void* FcitxGetSymbol(void* handle, const char* addonName, const char* symbolName);
 FcitxAddon* FcitxAddonsLoadInternal(UT_array* addons, boolean reloadIM);
 void FcitxInstanceResolveAddonDependencyInternal(FcitxInstance* instance, FcitxAddon* startAddon);
 void FcitxInstanceFillAddonOwner(FcitxInstance* instance, FcitxAddon* addonHead);
 FcitxAddon* FcitxAddonsGetAddonByNameInternal(UT_array* addons, const char* name, boolean checkDisabled);
 
+/**
+ * open the libraries of addons loaded at start up in a background thread,
+ * following the Dependency of addons, so the loader finds them already
+ * mapped. Create of addons is still called from the main thread.
+ */
+void FcitxInstanceStartAddonPreload(FcitxInstance* instance);
+
+/**
+ * drop the pending jobs and wait for the preload thread
+ */
+void FcitxInstanceFinishAddonPreload(FcitxInstance* instance);
+
+/**
+ * open and create a single module, used by FcitxModuleLoad and on demand module
+ */
+void FcitxModuleLoadAddon(FcitxInstance* instance, FcitxAddon* addon);
+
 #endif
@@ -27,6 +27,8 @@
 #include <sys/stat.h>
 #include <libintl.h>
 #include <dlfcn.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "fcitx/fcitx.h"
 #include "addon.h"
@@ -53,8 +55,30 @@ CONFIG_BINDING_REGISTER("Addon", "IMRegisterArgument", registerArgument)
 CONFIG_BINDING_REGISTER("Addon", "UIFallback", uifallback)
 CONFIG_BINDING_REGISTER("Addon", "Advance", advance)
 CONFIG_BINDING_REGISTER("Addon", "LoadLocal", loadLocal)
+CONFIG_BINDING_REGISTER("Addon", "OnDemand", onDemand)
 CONFIG_BINDING_END()
 
+typedef enum _FcitxAddonPreloadState {
+    APS_PENDING,
+    APS_OPENING,
+    APS_DONE
+} FcitxAddonPreloadState;
+
+typedef struct _FcitxAddonPreloadJob {
+    char* library;
+    boolean loadLocal;
+    int* depend; /**< index of jobs need to be opened first */
+    int dependCount;
+    FcitxAddonPreloadState state;
+} FcitxAddonPreloadJob;
+
+struct _FcitxAddonPreloader {
+    pthread_t thread;
+    volatile int32_t stop;
+    FcitxAddonPreloadJob* jobs;
+    int jobCount;
+};
+
 static const UT_icd addon_icd = {
     sizeof(FcitxAddon), NULL , NULL, FcitxAddonFree
 };
@@ -302,6 +326,187 @@ void FcitxInstanceResolveAddonDependencyInternal(FcitxInstance* instance, FcitxA
     }
 }
 
+/**
+ * the user interface FcitxUILoad will pick, dependency resolving has already
+ * put it before its fallback, and the fallback is only loaded when needed
+ */
+static FcitxAddon* FcitxAddonGetStartupUI(FcitxInstance* instance)
+{
+    UT_array* addons = &instance->addons;
+    FcitxAddon* addon;
+    if (instance->uiname) {
+        addon = FcitxAddonsGetAddonByName(addons, instance->uiname);
+        if (addon && addon->category == AC_UI)
+            return addon;
+    }
+    for (addon = (FcitxAddon *) utarray_front(addons);
+         addon != NULL;
+         addon = (FcitxAddon *) utarray_next(addons, addon)) {
+        if (addon->bEnabled && addon->category == AC_UI)
+            return addon;
+    }
+    return NULL;
+}
+
+static boolean FcitxAddonNeedPreload(FcitxAddon* addon, FcitxAddonCategory category, FcitxAddon* ui)
+{
+    if (!addon->bEnabled || addon->category != category
+        || addon->type != AT_SHAREDLIBRARY || addon->addonInstance)
+        return false;
+    /* lazy ones stay lazy */
+    if (category == AC_MODULE && addon->onDemand)
+        return false;
+    if (category == AC_INPUTMETHOD && addon->registerMethod != IMRM_SELF)
+        return false;
+    if (category == AC_UI && addon != ui)
+        return false;
+    return true;
+}
+
+static void FcitxAddonPreloadJobRun(struct _FcitxAddonPreloader* preloader, int i)
+{
+    FcitxAddonPreloadJob* job = &preloader->jobs[i];
+    int j;
+
+    /* a job being opened here means dependency is a circle, just go on */
+    if (job->state != APS_PENDING)
+        return;
+    job->state = APS_OPENING;
+    for (j = 0; j < job->dependCount; j++)
+        FcitxAddonPreloadJobRun(preloader, job->depend[j]);
+
+    char* libraryPath = NULL;
+    FILE* fp = NULL;
+    if (!fcitx_utils_atomic_add(&preloader->stop, 0))
+        fp = FcitxXDGGetLibFile(job->library, "r", &libraryPath);
+    if (fp) {
+        fclose(fp);
+        /*
+         * library is RTLD_NODELETE, so it stays mapped after dlclose, and the
+         * dlopen done by the real loader only need to bump the reference.
+         */
+        void* handle = dlopen(libraryPath, RTLD_NOW | RTLD_NODELETE | (job->loadLocal ? RTLD_LOCAL : RTLD_GLOBAL));
+        if (handle)
+            dlclose(handle);
+        else
+            FcitxLog(DEBUG, "Preload %s failed: %s", libraryPath, dlerror());
+    }
+    free(libraryPath);
+    job->state = APS_DONE;
+}
+
+static void* FcitxAddonPreloadThread(void* arg)
+{
+    struct _FcitxAddonPreloader* preloader = arg;
+    int i;
+    for (i = 0; i < preloader->jobCount; i++) {
+        if (fcitx_utils_atomic_add(&preloader->stop, 0))
+            break;
+        FcitxAddonPreloadJobRun(preloader, i);
+    }
+    return NULL;
+}
+
+static void FcitxAddonPreloaderFree(struct _FcitxAddonPreloader* preloader)
+{
+    int i;
+    for (i = 0; i < preloader->jobCount; i++) {
+        free(preloader->jobs[i].library);
+        free(preloader->jobs[i].depend);
+    }
+    free(preloader->jobs);
+    free(preloader);
+}
+
+void FcitxInstanceStartAddonPreload(FcitxInstance* instance)
+{
+    /* same order as they are loaded in RunInstance */
+    static const FcitxAddonCategory order[] = {
+        AC_MODULE, AC_INPUTMETHOD, AC_UI, AC_FRONTEND
+    };
+    UT_array* addons = &instance->addons;
+    FcitxAddon* ui = FcitxAddonGetStartupUI(instance);
+    FcitxAddon* addon;
+    FcitxAddon** jobAddon;
+    int jobCount = 0;
+    int i, j;
+
+    if (instance->addonPreloader)
+        return;
+
+    for (addon = (FcitxAddon *) utarray_front(addons);
+         addon != NULL;
+         addon = (FcitxAddon *) utarray_next(addons, addon)) {
+        for (i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+            if (FcitxAddonNeedPreload(addon, order[i], ui))
+                jobCount++;
+        }
+    }
+    if (jobCount == 0)
+        return;
+
+    /* jobs only keep copies, the thread never touches the addons */
+    struct _FcitxAddonPreloader* preloader = fcitx_utils_new(struct _FcitxAddonPreloader);
+    preloader->jobs = fcitx_utils_malloc0(sizeof(FcitxAddonPreloadJob) * jobCount);
+    jobAddon = fcitx_utils_malloc0(sizeof(FcitxAddon*) * jobCount);
+    for (i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        for (addon = (FcitxAddon *) utarray_front(addons);
+             addon != NULL;
+             addon = (FcitxAddon *) utarray_next(addons, addon)) {
+            if (!FcitxAddonNeedPreload(addon, order[i], ui))
+                continue;
+            FcitxAddonPreloadJob* job = &preloader->jobs[preloader->jobCount];
+            job->library = strdup(addon->library);
+            job->loadLocal = addon->loadLocal;
+            jobAddon[preloader->jobCount++] = addon;
+        }
+    }
+
+    for (i = 0; i < preloader->jobCount; i++) {
+        FcitxAddonPreloadJob* job = &preloader->jobs[i];
+        UT_array* dependlist = fcitx_utils_split_string(jobAddon[i]->depend, ',');
+        char** depend;
+        job->depend = fcitx_utils_malloc0(sizeof(int) * (utarray_len(dependlist) + 1));
+        for (depend = (char **) utarray_front(dependlist);
+             depend != NULL;
+             depend = (char **) utarray_next(dependlist, depend)) {
+            for (j = 0; j < preloader->jobCount; j++) {
+                if (j != i && strcmp(jobAddon[j]->name, *depend) == 0) {
+                    job->depend[job->dependCount++] = j;
+                    break;
+                }
+            }
+        }
+        utarray_free(dependlist);
+    }
+    free(jobAddon);
+
+    /*
+     * dlopen is serialized by the dynamic loader anyway, so one thread is
+     * enough to have the libraries opened while the main thread is busy
+     * reading configs and creating addons.
+     */
+    if (pthread_create(&preloader->thread, NULL, FcitxAddonPreloadThread, preloader) != 0) {
+        FcitxAddonPreloaderFree(preloader);
+        return;
+    }
+
+    instance->addonPreloader = preloader;
+}
+
+void FcitxInstanceFinishAddonPreload(FcitxInstance* instance)
+{
+    struct _FcitxAddonPreloader* preloader = instance->addonPreloader;
+    if (!preloader)
+        return;
+
+    /* anything not opened yet will be opened by the loader anyway */
+    fcitx_utils_atomic_add(&preloader->stop, 1);
+    pthread_join(preloader->thread, NULL);
+    FcitxAddonPreloaderFree(preloader);
+    instance->addonPreloader = NULL;
+}
+
 FCITX_EXPORT_API
 boolean FcitxAddonsIsAddonAvailable(UT_array* addons, const char* name)
 {
@@ -350,14 +555,17 @@ void FcitxAddonFree(void* v)
     free(addon->subconfig);
 }
 
-boolean FcitxCheckABIVersion(void* handle, const char* addonName)
+int FcitxGetABIVersion(void* handle, const char* addonName)
 {
     int* version = (int*) FcitxGetSymbol(handle, addonName, "ABI_VERSION");
     if (!version)
-        return false;
-    if (*version < FCITX_ABI_VERSION)
-        return false;
-    return true;
+        return 0;
+    return *version;
+}
+
+boolean FcitxCheckABIVersion(void* handle, const char* addonName)
+{
+    return FcitxGetABIVersion(handle, addonName) >= FCITX_ABI_VERSION;
 }
 
 // kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -124,7 +124,17 @@ extern "C" {
             void* dummy3;
         };
 
-        void* padding[7]; /**< padding */
+        union {
+            boolean onDemand; /**< module is only loaded when its function is used, @since 4.2.9.7 */
+            void* dummy4;
+        };
+
+        union {
+            int abiVersion; /**< ABI_VERSION of a loaded frontend, @since 4.2.9.7 */
+            void* dummy5;
+        };
+
+        void* padding[5]; /**< padding */
     } FcitxAddon;
 
     /**
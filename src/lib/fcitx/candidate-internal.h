@@ -21,10 +21,14 @@
 #ifndef _FCITX_CANDIDATE_INTERNAL_H_
 #define _FCITX_CANDIDATE_INTERNAL_H_
 
+#include "fcitx-utils/memory.h"
 #include "candidate.h"
 
 struct _FcitxCandidateWordList {
     UT_array candWords;
+    /* FcitxCandidateWordFlags of candWords, always of the same length */
+    UT_array candFlags;
+    FcitxMemoryPool* arena;
     char strChoose[MAX_CAND_WORD + 1];
     unsigned int candiateModifier;
     int currentPage;
@@ -40,6 +44,14 @@ struct _FcitxCandidateWordList {
     boolean override;
     boolean overrideHighlight;
     boolean overrideHighlightValue;
+    FcitxCandidateWordGenerator generator;
+    void* generatorArg;
+    FcitxDestroyNotify generatorDestroyNotify;
+    boolean generatorSorted;
+    boolean generating;
 };
 
+void FcitxCandidateWordFetch(FcitxCandidateWordList* candList,
+                             unsigned int count);
+
 #endif
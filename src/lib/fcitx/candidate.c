@@ -18,19 +18,37 @@
  *   51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA.              *
  ***************************************************************************/
 
+#include <limits.h>
+
 #include "candidate-internal.h"
 
+/* words are freed by FcitxCandidateWordFreeRange according to candFlags */
 static const UT_icd cand_icd = {
-    sizeof(FcitxCandidateWord), NULL, NULL, FcitxCandidateWordFree
+    sizeof(FcitxCandidateWord), NULL, NULL, NULL
+};
+
+static const UT_icd cand_flags_icd = {
+    sizeof(unsigned int), NULL, NULL, NULL
 };
 
+/* placed before every block from FcitxCandidateWordArenaAlloc */
+typedef union {
+    size_t size;
+    void* ptr;
+    double d;
+    long long ll;
+} FcitxCandidateArenaHeader;
+
 FCITX_EXPORT_API
 FcitxCandidateWordList* FcitxCandidateWordNewList()
 {
     FcitxCandidateWordList* candList = fcitx_utils_new(FcitxCandidateWordList);
 
     utarray_init(&candList->candWords, &cand_icd);
+    utarray_init(&candList->candFlags, &cand_flags_icd);
+    candList->arena = fcitx_memory_pool_create();
     utarray_reserve(&candList->candWords, 128);
+    utarray_reserve(&candList->candFlags, 128);
     candList->wordPerPage = 5; /* anyway put a default value for safety */
     candList->layoutHint = CLH_NotSet;
     strncpy(candList->strChoose, DIGIT_STR_CHOOSE, MAX_CAND_WORD);
@@ -38,10 +56,82 @@ FcitxCandidateWordList* FcitxCandidateWordNewList()
     return candList;
 }
 
+static void
+FcitxCandidateWordFreeRange(FcitxCandidateWordList* candList,
+                            unsigned int start, unsigned int end)
+{
+    unsigned int i;
+    for (i = start;i < end;i++) {
+        FcitxCandidateWord* candWord =
+            (FcitxCandidateWord*)utarray_eltptr(&candList->candWords, i);
+        unsigned int flags = *(unsigned int*)utarray_eltptr(&candList->candFlags, i);
+        if (candWord->strWord &&
+            !(flags & (CWF_BorrowedWord | CWF_ArenaWord)))
+            free(candWord->strWord);
+        if (candWord->strExtra &&
+            !(flags & (CWF_BorrowedExtra | CWF_ArenaExtra)))
+            free(candWord->strExtra);
+        if (candWord->priv &&
+            !(flags & (CWF_BorrowedPriv | CWF_ArenaPriv)))
+            free(candWord->priv);
+    }
+}
+
+static void
+FcitxCandidateWordStopGenerator(FcitxCandidateWordList* candList)
+{
+    FcitxDestroyNotify destroyNotify = candList->generatorDestroyNotify;
+    void* arg = candList->generatorArg;
+    candList->generator = NULL;
+    candList->generatorArg = NULL;
+    candList->generatorDestroyNotify = NULL;
+    if (destroyNotify)
+        destroyNotify(arg);
+}
+
+/*
+ * pull candidate words from the generator until there are at least count of
+ * them, or the generator runs out. an unsorted generator is always drained.
+ */
+void FcitxCandidateWordFetch(FcitxCandidateWordList* candList,
+                             unsigned int count)
+{
+    while (candList->generator && !candList->generating &&
+           utarray_len(&candList->candWords) < count) {
+        unsigned int len = utarray_len(&candList->candWords);
+        int want = INT_MAX;
+        if (candList->generatorSorted && count - len < INT_MAX)
+            want = count - len;
+        candList->generating = true;
+        boolean more = candList->generator(candList->generatorArg, candList,
+                                           want);
+        candList->generating = false;
+        if (!more || utarray_len(&candList->candWords) == len)
+            FcitxCandidateWordStopGenerator(candList);
+    }
+}
+
+FCITX_EXPORT_API void
+FcitxCandidateWordSetGenerator(FcitxCandidateWordList* candList,
+                               FcitxCandidateWordGenerator generator,
+                               boolean sorted, void* arg,
+                               FcitxDestroyNotify destroyNotify)
+{
+    FcitxCandidateWordStopGenerator(candList);
+    candList->generator = generator;
+    candList->generatorSorted = sorted;
+    candList->generatorArg = arg;
+    candList->generatorDestroyNotify = destroyNotify;
+}
+
 FCITX_EXPORT_API
 void FcitxCandidateWordFreeList(FcitxCandidateWordList* list)
 {
+    FcitxCandidateWordStopGenerator(list);
+    FcitxCandidateWordFreeRange(list, 0, utarray_len(&list->candWords));
     utarray_done(&list->candWords);
+    utarray_done(&list->candFlags);
+    fcitx_memory_pool_destroy(list->arena);
     free(list);
 }
 
@@ -49,7 +139,71 @@ FCITX_EXPORT_API
 void FcitxCandidateWordInsert(FcitxCandidateWordList* candList,
                               FcitxCandidateWord* candWord, int position)
 {
+    FcitxCandidateWordInsertWithFlags(candList, candWord, position, CWF_None);
+}
+
+FCITX_EXPORT_API
+void FcitxCandidateWordInsertWithFlags(FcitxCandidateWordList* candList,
+                                       FcitxCandidateWord* candWord,
+                                       int position, unsigned int flags)
+{
+    if (position > 0)
+        FcitxCandidateWordFetch(candList, position);
+    if (position < 0)
+        return;
     fcitx_array_insert(&candList->candWords, candWord, position);
+    fcitx_array_insert(&candList->candFlags, &flags, position);
+}
+
+FCITX_EXPORT_API
+void* FcitxCandidateWordArenaAlloc(FcitxCandidateWordList* candList,
+                                   size_t size)
+{
+    const size_t align = sizeof(FcitxCandidateArenaHeader);
+    /* pool only align to int */
+    void* p = fcitx_memory_pool_alloc(candList->arena,
+                                      align - 1 + sizeof(FcitxCandidateArenaHeader) + size);
+    FcitxCandidateArenaHeader* header =
+        (FcitxCandidateArenaHeader*)fcitx_utils_align_to((uintptr_t)p, align);
+    header->size = size;
+    memset(header + 1, 0, size);
+    return header + 1;
+}
+
+FCITX_EXPORT_API
+char* FcitxCandidateWordArenaStrdup(FcitxCandidateWordList* candList,
+                                    const char* str)
+{
+    size_t len = strlen(str) + 1;
+    char* result = fcitx_memory_pool_alloc(candList->arena, len);
+    memcpy(result, str, len);
+    return result;
+}
+
+/*
+ * arena of newList is going to be reused, copy what candidate words of it
+ * still need into candList
+ */
+static void
+FcitxCandidateWordAdoptArena(FcitxCandidateWordList* candList,
+                             FcitxCandidateWordList* newList)
+{
+    unsigned int i;
+    for (i = 0;i < utarray_len(&newList->candWords);i++) {
+        FcitxCandidateWord* candWord =
+            (FcitxCandidateWord*)utarray_eltptr(&newList->candWords, i);
+        unsigned int flags = *(unsigned int*)utarray_eltptr(&newList->candFlags, i);
+        if ((flags & CWF_ArenaWord) && candWord->strWord)
+            candWord->strWord = FcitxCandidateWordArenaStrdup(candList, candWord->strWord);
+        if ((flags & CWF_ArenaExtra) && candWord->strExtra)
+            candWord->strExtra = FcitxCandidateWordArenaStrdup(candList, candWord->strExtra);
+        if ((flags & CWF_ArenaPriv) && candWord->priv) {
+            size_t size = ((FcitxCandidateArenaHeader*)candWord->priv - 1)->size;
+            void* priv = FcitxCandidateWordArenaAlloc(candList, size);
+            memcpy(priv, candWord->priv, size);
+            candWord->priv = priv;
+        }
+    }
 }
 
 FCITX_EXPORT_API
@@ -60,15 +214,27 @@ FcitxCandidateWordMerge(FcitxCandidateWordList* candList,
     void *p;
     if (!newList)
         return;
+    FcitxCandidateWordFetch(newList, UINT_MAX);
+    FcitxCandidateWordAdoptArena(candList, newList);
     if (position >= 0) {
+        if (position > 0)
+            FcitxCandidateWordFetch(candList, position);
         fcitx_array_inserta(&candList->candWords, &newList->candWords,
                             position);
+        fcitx_array_inserta(&candList->candFlags, &newList->candFlags,
+                            position);
     } else {
+        FcitxCandidateWordFetch(candList, UINT_MAX);
         utarray_concat(&candList->candWords, &newList->candWords);
+        utarray_concat(&candList->candFlags, &newList->candFlags);
     }
+    /* words are owned by candList now */
     utarray_steal(&newList->candWords, p);
-    newList->currentPage = 0;
     free(p);
+    utarray_steal(&newList->candFlags, p);
+    free(p);
+    newList->currentPage = 0;
+    fcitx_memory_pool_reset(newList->arena);
 }
 
 INPUT_RETURN_VALUE DummyHandler(void* arg, FcitxCandidateWord* candWord)
@@ -85,13 +251,15 @@ void FcitxCandidateWordInsertPlaceHolder(FcitxCandidateWordList* candList,
     FcitxCandidateWord candWord;
     memset(&candWord, 0, sizeof(FcitxCandidateWord));
     candWord.callback = DummyHandler;
-    fcitx_array_insert(&candList->candWords, &candWord, position);
+    FcitxCandidateWordInsertWithFlags(candList, &candWord, position, CWF_None);
 }
 
 FCITX_EXPORT_API
 void FcitxCandidateWordMove(FcitxCandidateWordList* candList, int from, int to)
 {
+    FcitxCandidateWordFetch(candList, (from > to ? from : to) + 1);
     fcitx_array_move(&candList->candWords, from, to);
+    fcitx_array_move(&candList->candFlags, from, to);
 }
 
 FCITX_EXPORT_API void
@@ -105,7 +273,12 @@ FcitxCandidateWordMoveByWord(FcitxCandidateWordList *candList,
 FCITX_EXPORT_API void
 FcitxCandidateWordRemoveByIndex(FcitxCandidateWordList *candList, int idx)
 {
+    FcitxCandidateWordFetch(candList, idx + 1);
+    if (idx < 0 || (unsigned int)idx >= utarray_len(&candList->candWords))
+        return;
+    FcitxCandidateWordFreeRange(candList, idx, idx + 1);
     fcitx_array_erase(&candList->candWords, idx, 1);
+    fcitx_array_erase(&candList->candFlags, idx, 1);
 }
 
 FCITX_EXPORT_API void
@@ -119,7 +292,10 @@ FcitxCandidateWordRemove(FcitxCandidateWordList *candList,
 FCITX_EXPORT_API void
 FcitxCandidateWordSetPage(FcitxCandidateWordList *candList, int index)
 {
-    if (index >= 0 && index < FcitxCandidateWordPageCount(candList)) {
+    if (index < 0)
+        return;
+    FcitxCandidateWordFetch(candList, index * candList->wordPerPage + 1);
+    if (index * candList->wordPerPage < utarray_len(&candList->candWords)) {
         candList->currentPage = index;
     }
 }
@@ -133,7 +309,11 @@ FcitxCandidateWordSetFocus(FcitxCandidateWordList* candList, int index)
 FCITX_EXPORT_API
 void FcitxCandidateWordReset(FcitxCandidateWordList* candList)
 {
+    FcitxCandidateWordStopGenerator(candList);
+    FcitxCandidateWordFreeRange(candList, 0, utarray_len(&candList->candWords));
     utarray_clear(&candList->candWords);
+    utarray_clear(&candList->candFlags);
+    fcitx_memory_pool_reset(candList->arena);
     if (candList->override) {
         candList->override = false;
         candList->hasPrev = false;
@@ -161,6 +341,9 @@ int FcitxCandidateWordGetCurrentIndex(FcitxCandidateWordList* candList)
 FCITX_EXPORT_API FcitxCandidateWord*
 FcitxCandidateWordGetCurrentWindow(FcitxCandidateWordList* candList)
 {
+    /* the whole page is going to be used */
+    FcitxCandidateWordFetch(candList,
+                            (candList->currentPage + 1) * candList->wordPerPage);
     return FcitxCandidateWordGetByTotalIndex(
         candList, candList->currentPage * candList->wordPerPage);
 }
@@ -169,33 +352,33 @@ FCITX_EXPORT_API FcitxCandidateWord*
 FcitxCandidateWordGetCurrentWindowNext(FcitxCandidateWordList* candList,
                                        FcitxCandidateWord* candWord)
 {
-    FcitxCandidateWord *nextCandWord = (FcitxCandidateWord*)utarray_next(&candList->candWords, candWord);
-    if (nextCandWord == NULL)
-        return NULL;
-    FcitxCandidateWord *startCandWord = FcitxCandidateWordGetCurrentWindow(candList);
-    if (nextCandWord < startCandWord ||
-        nextCandWord >= startCandWord + candList->wordPerPage)
+    /* fetching the window may move the array, only keep the index */
+    int idx = utarray_eltidx(&candList->candWords, candWord) + 1;
+    int start = candList->currentPage * candList->wordPerPage;
+    if (idx < start || idx >= start + candList->wordPerPage)
         return NULL;
-    return nextCandWord;
+    FcitxCandidateWordGetCurrentWindow(candList);
+    return fcitx_array_eltptr(&candList->candWords, idx);
 }
 
 FCITX_EXPORT_API FcitxCandidateWord*
 FcitxCandidateWordGetCurrentWindowPrev(FcitxCandidateWordList* candList,
                                        FcitxCandidateWord* candWord)
 {
-    FcitxCandidateWord *prevWord = utarray_prev(&candList->candWords, candWord);
-    if (prevWord == NULL)
+    /* fetching the window may move the array, only keep the index */
+    int idx = utarray_eltidx(&candList->candWords, candWord) - 1;
+    int start = candList->currentPage * candList->wordPerPage;
+    if (idx < 0 || idx < start || idx >= start + candList->wordPerPage)
         return NULL;
-    FcitxCandidateWord *startWord = FcitxCandidateWordGetCurrentWindow(candList);
-    if (prevWord < startWord ||
-        prevWord >= startWord + candList->wordPerPage)
-        return NULL;
-    return prevWord;
+    FcitxCandidateWordGetCurrentWindow(candList);
+    return fcitx_array_eltptr(&candList->candWords, idx);
 }
 
 FCITX_EXPORT_API FcitxCandidateWord*
 FcitxCandidateWordGetByTotalIndex(FcitxCandidateWordList* candList, int index)
 {
+    if (index >= 0)
+        FcitxCandidateWordFetch(candList, index + 1);
     return fcitx_array_eltptr(&candList->candWords, index);
 }
 
@@ -259,7 +442,9 @@ boolean FcitxCandidateWordHasNext(FcitxCandidateWordList* candList)
     if (candList->override)
         return candList->hasNext;
 
-    if (candList->currentPage + 1 < FcitxCandidateWordPageCount(candList))
+    unsigned int pageEnd = (candList->currentPage + 1) * candList->wordPerPage;
+    FcitxCandidateWordFetch(candList, pageEnd + 1);
+    if (pageEnd < utarray_len(&candList->candWords))
         return true;
     else
         return false;
@@ -268,6 +453,7 @@ boolean FcitxCandidateWordHasNext(FcitxCandidateWordList* candList)
 FCITX_EXPORT_API int
 FcitxCandidateWordPageCount(FcitxCandidateWordList* candList)
 {
+    FcitxCandidateWordFetch(candList, UINT_MAX);
     return (utarray_len(&candList->candWords) + candList->wordPerPage - 1) / candList->wordPerPage;
 }
 
@@ -286,7 +472,18 @@ void FcitxCandidateWordFree(void* arg)
 FCITX_EXPORT_API
 void FcitxCandidateWordAppend(FcitxCandidateWordList* candList, FcitxCandidateWord* candWord)
 {
+    FcitxCandidateWordAppendWithFlags(candList, candWord, CWF_None);
+}
+
+FCITX_EXPORT_API
+void FcitxCandidateWordAppendWithFlags(FcitxCandidateWordList* candList,
+                                       FcitxCandidateWord* candWord,
+                                       unsigned int flags)
+{
+    /* keep words from the generator before this one */
+    FcitxCandidateWordFetch(candList, UINT_MAX);
     utarray_push_back(&candList->candWords, candWord);
+    utarray_push_back(&candList->candFlags, &flags);
 }
 
 FCITX_EXPORT_API
@@ -300,8 +497,6 @@ boolean FcitxCandidateWordGoPrevPage(FcitxCandidateWordList* candList)
         }
     }
 
-    if (!FcitxCandidateWordPageCount(candList))
-        return false;
     if (FcitxCandidateWordHasPrev(candList)) {
         candList->currentPage -- ;
         candList->hasGonePrevPage = true;
@@ -321,8 +516,6 @@ boolean FcitxCandidateWordGoNextPage(FcitxCandidateWordList* candList)
         }
     }
 
-    if (!FcitxCandidateWordPageCount(candList))
-        return false;
     if (FcitxCandidateWordHasNext(candList)) {
         candList->currentPage ++ ;
         candList->hasGoneNextPage = true;
@@ -365,7 +558,15 @@ int FcitxCandidateWordGetCurrentPage(FcitxCandidateWordList* candList)
 FCITX_EXPORT_API
 void FcitxCandidateWordResize(FcitxCandidateWordList* candList, int length)
 {
+    FcitxCandidateWordFetch(candList, length);
+    FcitxCandidateWordStopGenerator(candList);
+    if (length < 0)
+        return;
+    if ((unsigned int)length < utarray_len(&candList->candWords))
+        FcitxCandidateWordFreeRange(candList, length,
+                                    utarray_len(&candList->candWords));
     fcitx_array_resize(&candList->candWords, length);
+    fcitx_array_resize(&candList->candFlags, length);
 }
 
 FCITX_EXPORT_API
@@ -386,20 +587,21 @@ void FcitxCandidateWordSetPageSize(FcitxCandidateWordList* candList, int size)
 FCITX_EXPORT_API
 int FcitxCandidateWordGetCurrentWindowSize(FcitxCandidateWordList* candList)
 {
-    if (utarray_len(&candList->candWords) == 0)
+    int start = candList->currentPage * candList->wordPerPage;
+    FcitxCandidateWordFetch(candList, start + candList->wordPerPage);
+    int size = (int)utarray_len(&candList->candWords) - start;
+    if (size <= 0)
         return 0;
     /* last page */
-    if (candList->currentPage + 1 == FcitxCandidateWordPageCount(candList)) {
-        int size = utarray_len(&candList->candWords) % candList->wordPerPage;
-        if (size != 0)
-            return size;
-    }
+    if (size < candList->wordPerPage)
+        return size;
     return candList->wordPerPage;
 }
 
 FCITX_EXPORT_API
 int FcitxCandidateWordGetListSize(FcitxCandidateWordList* candList)
 {
+    FcitxCandidateWordFetch(candList, UINT_MAX);
     return utarray_len(&candList->candWords);
 }
 
@@ -415,22 +617,36 @@ boolean FcitxCandidateWordGetHasGoneToNextPage(FcitxCandidateWordList* candList)
     return candList->hasGoneNextPage;
 }
 
+FCITX_EXPORT_API
+boolean FcitxCandidateWordIsEmpty(FcitxCandidateWordList* candList)
+{
+    FcitxCandidateWordFetch(candList, 1);
+    return utarray_len(&candList->candWords) == 0;
+}
+
 FCITX_EXPORT_API
 FcitxCandidateWord* FcitxCandidateWordGetFirst(FcitxCandidateWordList* candList)
 {
+    FcitxCandidateWordFetch(candList, 1);
     return (FcitxCandidateWord*)utarray_front(&candList->candWords);
 }
 
 FCITX_EXPORT_API
 FcitxCandidateWord* FcitxCandidateWordGetLast(FcitxCandidateWordList* candList)
 {
+    FcitxCandidateWordFetch(candList, UINT_MAX);
     return (FcitxCandidateWord*)utarray_back(&candList->candWords);
 }
 
 FCITX_EXPORT_API
 FcitxCandidateWord* FcitxCandidateWordGetNext(FcitxCandidateWordList* candList, FcitxCandidateWord* candWord)
 {
-    return (FcitxCandidateWord*)utarray_next(&candList->candWords, candWord);
+    /* fetching may move the array, candWord is no longer valid after it */
+    int idx = utarray_eltidx(&candList->candWords, candWord);
+    if (idx < 0)
+        return NULL;
+    FcitxCandidateWordFetch(candList, idx + 2);
+    return fcitx_array_eltptr(&candList->candWords, idx + 1);
 }
 
 FCITX_EXPORT_API FcitxCandidateWord*
@@ -100,6 +100,28 @@ extern "C" {
         void* priv;
     } FcitxCandidateWord;
 
+    /**
+     * Tell the candidate word list who owns the pointers of a candidate word.
+     *
+     * By default strWord, strExtra and priv are allocated by malloc and freed
+     * by the list. A borrowed pointer is never freed, it must stay valid
+     * until the candidate word list is reset. An arena pointer is allocated
+     * by FcitxCandidateWordArenaAlloc or FcitxCandidateWordArenaStrdup of the
+     * same list, and is released all at once when the list is reset.
+     *
+     * @since 4.2.9.7
+     */
+    typedef enum _FcitxCandidateWordFlag {
+        CWF_None = 0,
+        CWF_BorrowedWord = (1 << 0),
+        CWF_BorrowedExtra = (1 << 1),
+        CWF_BorrowedPriv = (1 << 2),
+        CWF_ArenaWord = (1 << 3),
+        CWF_ArenaExtra = (1 << 4),
+        CWF_ArenaPriv = (1 << 5),
+        CWF_Arena = CWF_ArenaWord | CWF_ArenaExtra | CWF_ArenaPriv
+    } FcitxCandidateWordFlag;
+
     /**
      * Initialize a word list
      *
@@ -182,6 +204,63 @@ extern "C" {
      **/
     void FcitxCandidateWordAppend(struct _FcitxCandidateWordList* candList, FcitxCandidateWord* candWord);
 
+    /**
+     * add a candidate word at last, flags tells which of its pointers are not
+     * allocated by malloc
+     *
+     * @param candList candidate word list
+     * @param candWord candidate word
+     * @param flags FcitxCandidateWordFlag
+     * @return void
+     *
+     * @since 4.2.9.7
+     **/
+    void FcitxCandidateWordAppendWithFlags(FcitxCandidateWordList* candList,
+                                           FcitxCandidateWord* candWord,
+                                           unsigned int flags);
+
+    /**
+     * Insert a candidate to position, flags tells which of its pointers are
+     * not allocated by malloc
+     *
+     * @param candList candidate word list
+     * @param candWord candidate word
+     * @param position position to insert
+     * @param flags FcitxCandidateWordFlag
+     * @return void
+     *
+     * @since 4.2.9.7
+     **/
+    void FcitxCandidateWordInsertWithFlags(FcitxCandidateWordList* candList,
+                                           FcitxCandidateWord* candWord,
+                                           int position, unsigned int flags);
+
+    /**
+     * allocate zeroed memory from the arena of the list, it is suitably
+     * aligned for any type and will be reused after the list is reset, so
+     * filling the list again won't call malloc once the arena is warm.
+     *
+     * @param candList candidate word list
+     * @param size size of wanted memory
+     * @return void*
+     *
+     * @since 4.2.9.7
+     **/
+    void* FcitxCandidateWordArenaAlloc(FcitxCandidateWordList* candList,
+                                       size_t size);
+
+    /**
+     * duplicate a string into the arena of the list
+     *
+     * @param candList candidate word list
+     * @param str string to copy
+     * @return char*
+     *
+     * @since 4.2.9.7
+     **/
+    char* FcitxCandidateWordArenaStrdup(FcitxCandidateWordList* candList,
+                                        const char* str);
+
     /**
      * remove a candidate word from list
      *
@@ -580,6 +659,59 @@ extern "C" {
      */
     void FcitxCandidateWordSetOverrideDefaultHighlight(FcitxCandidateWordList* candList, boolean overrideValue);
 
+    /**
+     * generate candidate words on demand, append at least count candidate
+     * words to candList with FcitxCandidateWordAppend, or less if there are
+     * not so many left
+     *
+     * @param arg generator argument
+     * @param candList candidate words
+     * @param count number of candidate words wanted
+     * @return false if there is no more candidate word
+     *
+     * @since 4.2.9.7
+     */
+    typedef boolean (*FcitxCandidateWordGenerator)(void* arg, FcitxCandidateWordList* candList, int count);
+
+    /**
+     * let candList pull candidate words from generator only when they are
+     * needed, for example when a new page is going to be shown, so the cost of
+     * the first page doesn't depend on the number of all candidate words.
+     *
+     * Words from generator always come after those already in the list.
+     * A sorted generator promises its words are already in the final order
+     * and is called page by page, otherwise it will be drained the first time
+     * any candidate word is used. Functions need the whole list, like
+     * FcitxCandidateWordGetListSize, FcitxCandidateWordPageCount or appending
+     * to the list, will also drain the generator. The generator is removed
+     * once it runs out, or when the list is reset. Setting a NULL generator
+     * drops the current one without pulling the rest of its words.
+     *
+     * @param candList candidate words
+     * @param generator generator
+     * @param sorted output of generator is already sorted
+     * @param arg generator argument
+     * @param destroyNotify called with arg when the generator is removed
+     * @return void
+     *
+     * @since 4.2.9.7
+     */
+    void FcitxCandidateWordSetGenerator(FcitxCandidateWordList* candList,
+                                        FcitxCandidateWordGenerator generator,
+                                        boolean sorted, void* arg,
+                                        FcitxDestroyNotify destroyNotify);
+
+    /**
+     * check whether the list is empty, it only pulls one word from the
+     * generator, while FcitxCandidateWordGetListSize needs all of them
+     *
+     * @param candList candidate words
+     * @return boolean
+     *
+     * @since 4.2.9.7
+     */
+    boolean FcitxCandidateWordIsEmpty(FcitxCandidateWordList* candList);
+
 /** convinient string for candidate word */
 #define DIGIT_STR_CHOOSE "1234567890"
 
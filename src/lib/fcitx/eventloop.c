@@ -0,0 +1,577 @@
+/***************************************************************************
+ *   Copyright (C) 2012~2012 by CSSlayer                                   *
+ *   wengxt@gmail.com                                                      *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA.              *
+ ***************************************************************************/
+
+/**
+ * @file   eventloop.c
+ *
+ * main loop of fcitx: persistent fd watches and a min heap of timeouts.
+ *
+ * Fd watches are registered to epoll once, instead of rebuilding fd_set in
+ * every loop. Modules which still use SetFD/ProcessEvent keep working, their
+ * fd_set is synced to epoll before waiting, and rewritten to ready fds after
+ * waiting, just like select does. Without epoll, select is used for all fd.
+ */
+
+#include "config.h"
+
+#include <unistd.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <sys/time.h>
+#include <sys/select.h>
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
+
+#include "fcitx/fcitx.h"
+#include "fcitx-utils/log.h"
+#include "fcitx-utils/utils.h"
+#include "instance.h"
+#include "module.h"
+#include "addon.h"
+#include "instance-internal.h"
+
+#define EPOLL_MAX_EVENTS 64
+/* epoll data of fd from SetFD, watch id never reaches this bit */
+#define LEGACY_FD_TAG (((uint64_t) 1) << 63)
+
+static const UT_icd watch_id_icd = {
+    sizeof(uint64_t), NULL, NULL, NULL
+};
+
+static inline uint64_t
+FcitxEventLoopNow()
+{
+    struct timeval current_time;
+    gettimeofday(&current_time, NULL);
+    return (current_time.tv_sec * 1000LL) + (current_time.tv_usec / 1000LL);
+}
+
+static inline TimeoutItem**
+TimeoutHeap(FcitxInstance* instance)
+{
+    return (TimeoutItem**) instance->timeout.d;
+}
+
+static inline uint64_t
+TimeoutDeadline(const TimeoutItem* ti)
+{
+    return ti->time + ti->milli;
+}
+
+/* same deadline are called in the order they are added */
+static inline boolean
+TimeoutLess(const TimeoutItem* a, const TimeoutItem* b)
+{
+    uint64_t da = TimeoutDeadline(a), db = TimeoutDeadline(b);
+    return da < db || (da == db && a->idx < b->idx);
+}
+
+static inline void
+TimeoutHeapSet(TimeoutItem** heap, unsigned int pos, TimeoutItem* ti)
+{
+    heap[pos] = ti;
+    ti->heapIdx = pos;
+}
+
+static void
+TimeoutHeapUp(FcitxInstance* instance, unsigned int pos)
+{
+    TimeoutItem** heap = TimeoutHeap(instance);
+    TimeoutItem* ti = heap[pos];
+    while (pos > 0) {
+        unsigned int parent = (pos - 1) / 2;
+        if (!TimeoutLess(ti, heap[parent]))
+            break;
+        TimeoutHeapSet(heap, pos, heap[parent]);
+        pos = parent;
+    }
+    TimeoutHeapSet(heap, pos, ti);
+}
+
+static void
+TimeoutHeapDown(FcitxInstance* instance, unsigned int pos)
+{
+    TimeoutItem** heap = TimeoutHeap(instance);
+    unsigned int len = utarray_len(&instance->timeout);
+    TimeoutItem* ti = heap[pos];
+    while (1) {
+        unsigned int child = pos * 2 + 1;
+        if (child >= len)
+            break;
+        if (child + 1 < len && TimeoutLess(heap[child + 1], heap[child]))
+            child++;
+        if (!TimeoutLess(heap[child], ti))
+            break;
+        TimeoutHeapSet(heap, pos, heap[child]);
+        pos = child;
+    }
+    TimeoutHeapSet(heap, pos, ti);
+}
+
+static void
+TimeoutRemove(FcitxInstance* instance, TimeoutItem* ti)
+{
+    unsigned int pos = ti->heapIdx;
+    unsigned int last = utarray_len(&instance->timeout) - 1;
+    HASH_DEL(instance->timeoutById, ti);
+    if (pos != last) {
+        TimeoutItem* moved = TimeoutHeap(instance)[last];
+        TimeoutHeapSet(TimeoutHeap(instance), pos, moved);
+        utarray_pop_back(&instance->timeout);
+        TimeoutHeapDown(instance, pos);
+        TimeoutHeapUp(instance, moved->heapIdx);
+    } else {
+        utarray_pop_back(&instance->timeout);
+    }
+    free(ti);
+}
+
+static TimeoutItem*
+TimeoutFindById(FcitxInstance* instance, uint64_t id)
+{
+    TimeoutItem* ti = NULL;
+    HASH_FIND(hh, instance->timeoutById, &id, sizeof(uint64_t), ti);
+    return ti;
+}
+
+void FcitxEventLoopInit(FcitxInstance* instance)
+{
+    utarray_init(&instance->timeout, fcitx_ptr_icd);
+    instance->epollfd = -1;
+#ifdef HAVE_SYS_EPOLL_H
+    instance->epollfd = epoll_create1(EPOLL_CLOEXEC);
+    if (instance->epollfd < 0)
+        FcitxLog(WARNING, "epoll_create1 failed, fallback to select");
+#endif
+}
+
+void FcitxEventLoopDestroy(FcitxInstance* instance)
+{
+    while (instance->ioWatches)
+        FcitxInstanceRemoveIOWatch(instance, instance->ioWatches->id);
+    while (utarray_len(&instance->timeout) != 0)
+        TimeoutRemove(instance, TimeoutHeap(instance)[0]);
+    if (instance->epollfd >= 0) {
+        close(instance->epollfd);
+        instance->epollfd = -1;
+    }
+}
+
+void FcitxEventLoopProcessTimeout(FcitxInstance* instance, uint64_t curtime)
+{
+    while (utarray_len(&instance->timeout) != 0) {
+        TimeoutItem* ti = TimeoutHeap(instance)[0];
+        if (TimeoutDeadline(ti) > curtime)
+            break;
+        /* callback may add or remove timeout, including itself */
+        uint64_t id = ti->idx;
+        ti->callback(ti->arg);
+        FcitxInstanceRemoveTimeoutById(instance, id);
+    }
+}
+
+/* milli seconds to the nearest timeout, -1 for none */
+static int
+FcitxEventLoopNextTimeout(FcitxInstance* instance)
+{
+    if (utarray_len(&instance->timeout) == 0)
+        return -1;
+    uint64_t deadline = TimeoutDeadline(TimeoutHeap(instance)[0]);
+    uint64_t curtime = FcitxEventLoopNow();
+    if (deadline <= curtime)
+        return 0;
+    if (deadline - curtime > INT_MAX)
+        return INT_MAX;
+    return deadline - curtime;
+}
+
+static FcitxIOWatch*
+IOWatchFindById(FcitxInstance* instance, uint64_t id)
+{
+    FcitxIOWatch* watch = NULL;
+    HASH_FIND(hh, instance->ioWatches, &id, sizeof(uint64_t), watch);
+    return watch;
+}
+
+static FcitxIOWatch*
+IOWatchFindByFd(FcitxInstance* instance, int fd)
+{
+    FcitxIOWatch* watch;
+    for (watch = instance->ioWatches; watch;
+         watch = (FcitxIOWatch*) watch->hh.next) {
+        if (watch->fd == fd)
+            return watch;
+    }
+    return NULL;
+}
+
+#ifdef HAVE_SYS_EPOLL_H
+
+static uint32_t
+IOEventsToEpoll(unsigned int events)
+{
+    uint32_t result = 0;
+    if (events & FCITX_IO_READ)
+        result |= EPOLLIN;
+    if (events & FCITX_IO_WRITE)
+        result |= EPOLLOUT;
+    if (events & FCITX_IO_EXCEPT)
+        result |= EPOLLPRI;
+    return result;
+}
+
+static unsigned int
+IOEventsFromEpoll(uint32_t events)
+{
+    unsigned int result = 0;
+    if (events & EPOLLIN)
+        result |= FCITX_IO_READ;
+    if (events & EPOLLOUT)
+        result |= FCITX_IO_WRITE;
+    if (events & EPOLLPRI)
+        result |= FCITX_IO_EXCEPT;
+    if (events & (EPOLLERR | EPOLLHUP))
+        result |= FCITX_IO_ERROR;
+    return result;
+}
+
+static boolean
+EpollControl(FcitxInstance* instance, int op, int fd, unsigned int events,
+             uint64_t data)
+{
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = IOEventsToEpoll(events);
+    ev.data.u64 = data;
+    if (epoll_ctl(instance->epollfd, op, fd, &ev) == 0)
+        return true;
+    /* fd is closed and reused, epoll already forgot it */
+    if (op == EPOLL_CTL_MOD && errno == ENOENT)
+        return epoll_ctl(instance->epollfd, EPOLL_CTL_ADD, fd, &ev) == 0;
+    return false;
+}
+
+/*
+ * Modules may close and reopen fd without telling us, so fd from SetFD is
+ * re-armed in every loop, there are only a few of them.
+ */
+static void
+EpollSyncLegacyFD(FcitxInstance* instance)
+{
+    int fd;
+    int last = instance->maxfd;
+    if (last < instance->legacyMaxFD)
+        last = instance->legacyMaxFD;
+    for (fd = 0; fd <= last && fd < FD_SETSIZE; fd++) {
+        unsigned int events = 0;
+        if (fd <= instance->maxfd) {
+            if (FD_ISSET(fd, &instance->rfds))
+                events |= FCITX_IO_READ;
+            if (FD_ISSET(fd, &instance->wfds))
+                events |= FCITX_IO_WRITE;
+            if (FD_ISSET(fd, &instance->efds))
+                events |= FCITX_IO_EXCEPT;
+        }
+        if (events == 0 && instance->legacyEvents[fd] == 0)
+            continue;
+        if (events && IOWatchFindByFd(instance, fd)) {
+            FcitxLog(WARNING, "fd %d is already watched", fd);
+            events = 0;
+        }
+        if (events == 0) {
+            struct epoll_event ev;
+            epoll_ctl(instance->epollfd, EPOLL_CTL_DEL, fd, &ev);
+        } else if (!EpollControl(instance,
+                                 instance->legacyEvents[fd] ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+                                 fd, events, LEGACY_FD_TAG | fd)) {
+            events = 0;
+        }
+        instance->legacyEvents[fd] = events;
+    }
+    instance->legacyMaxFD = instance->maxfd;
+}
+
+static void
+FcitxEventLoopWaitEpoll(FcitxInstance* instance, int timeout)
+{
+    struct epoll_event events[EPOLL_MAX_EVENTS];
+    int i, n;
+
+    EpollSyncLegacyFD(instance);
+    FD_ZERO(&instance->rfds);
+    FD_ZERO(&instance->wfds);
+    FD_ZERO(&instance->efds);
+
+    n = epoll_wait(instance->epollfd, events, EPOLL_MAX_EVENTS, timeout);
+    for (i = 0; i < n; i++) {
+        uint64_t data = events[i].data.u64;
+        unsigned int ready = IOEventsFromEpoll(events[i].events);
+        if (data & LEGACY_FD_TAG) {
+            int fd = data & ~LEGACY_FD_TAG;
+            unsigned int wanted = instance->legacyEvents[fd];
+            /* select reports hang up and error as readable */
+            if (ready & FCITX_IO_ERROR)
+                ready |= FCITX_IO_READ;
+            ready &= wanted;
+            if (ready & FCITX_IO_READ)
+                FD_SET(fd, &instance->rfds);
+            if (ready & FCITX_IO_WRITE)
+                FD_SET(fd, &instance->wfds);
+            if (ready & FCITX_IO_EXCEPT)
+                FD_SET(fd, &instance->efds);
+        } else {
+            /* previous callback may remove this one */
+            FcitxIOWatch* watch = IOWatchFindById(instance, data);
+            if (watch)
+                watch->callback(watch->arg, watch->fd, ready);
+        }
+    }
+}
+
+#endif
+
+static void
+FcitxEventLoopWaitSelect(FcitxInstance* instance, int timeout)
+{
+    int maxfd = instance->maxfd;
+    FcitxIOWatch* watch;
+    for (watch = instance->ioWatches; watch;
+         watch = (FcitxIOWatch*) watch->hh.next) {
+        if (watch->events & FCITX_IO_READ)
+            FD_SET(watch->fd, &instance->rfds);
+        if (watch->events & FCITX_IO_WRITE)
+            FD_SET(watch->fd, &instance->wfds);
+        if (watch->events & FCITX_IO_EXCEPT)
+            FD_SET(watch->fd, &instance->efds);
+        if (watch->fd > maxfd)
+            maxfd = watch->fd;
+    }
+
+    struct timeval tval;
+    struct timeval* ptval = NULL;
+    if (timeout >= 0) {
+        tval.tv_usec = (timeout % 1000) * 1000;
+        tval.tv_sec = timeout / 1000;
+        ptval = &tval;
+    }
+    if (select(maxfd + 1, &instance->rfds, &instance->wfds,
+               &instance->efds, ptval) <= 0) {
+        FD_ZERO(&instance->rfds);
+        FD_ZERO(&instance->wfds);
+        FD_ZERO(&instance->efds);
+        return;
+    }
+
+    /* callback may add or remove watches, so collect them first */
+    UT_array ready;
+    utarray_init(&ready, &watch_id_icd);
+    for (watch = instance->ioWatches; watch;
+         watch = (FcitxIOWatch*) watch->hh.next) {
+        if (FD_ISSET(watch->fd, &instance->rfds)
+            || FD_ISSET(watch->fd, &instance->wfds)
+            || FD_ISSET(watch->fd, &instance->efds))
+            utarray_push_back(&ready, &watch->id);
+    }
+    utarray_foreach(id, &ready, uint64_t) {
+        watch = IOWatchFindById(instance, *id);
+        if (!watch)
+            continue;
+        unsigned int events = 0;
+        if (FD_ISSET(watch->fd, &instance->rfds))
+            events |= FCITX_IO_READ;
+        if (FD_ISSET(watch->fd, &instance->wfds))
+            events |= FCITX_IO_WRITE;
+        if (FD_ISSET(watch->fd, &instance->efds))
+            events |= FCITX_IO_EXCEPT;
+        watch->callback(watch->arg, watch->fd, events & watch->events);
+    }
+    utarray_done(&ready);
+}
+
+/*
+ * wait for fd or timeout, return false if there is nothing to wait,
+ * ready fd of SetFD are left in fd_set for ProcessEvent
+ */
+boolean FcitxEventLoopWait(FcitxInstance* instance)
+{
+    FD_ZERO(&instance->rfds);
+    FD_ZERO(&instance->wfds);
+    FD_ZERO(&instance->efds);
+
+    instance->maxfd = 0;
+    /* SetFD may load an on demand module, which grows eventmodules */
+    unsigned int i;
+    for (i = 0; i < utarray_len(&instance->eventmodules); i++) {
+        FcitxAddon* addon = *(FcitxAddon**) utarray_eltptr(&instance->eventmodules, i);
+        addon->module->SetFD(addon->addonInstance);
+    }
+    if (instance->maxfd == 0 && HASH_COUNT(instance->ioWatches) == 0)
+        return false;
+
+    int timeout = FcitxEventLoopNextTimeout(instance);
+#ifdef HAVE_SYS_EPOLL_H
+    if (instance->epollfd >= 0) {
+        FcitxEventLoopWaitEpoll(instance, timeout);
+        return true;
+    }
+#endif
+    FcitxEventLoopWaitSelect(instance, timeout);
+    return true;
+}
+
+FCITX_EXPORT_API
+uint64_t FcitxInstanceAddTimeout(FcitxInstance* instance, long int milli, FcitxTimeoutCallback callback , void* arg)
+{
+    if (milli < 0)
+        return 0;
+
+    TimeoutItem* ti = fcitx_utils_new(TimeoutItem);
+    ti->arg = arg;
+    ti->callback = callback;
+    ti->milli = milli;
+    ti->idx = ++instance->timeoutIdx;
+    ti->time = FcitxEventLoopNow();
+    ti->heapIdx = utarray_len(&instance->timeout);
+    utarray_push_back(&instance->timeout, &ti);
+    TimeoutHeapUp(instance, ti->heapIdx);
+    HASH_ADD(hh, instance->timeoutById, idx, sizeof(uint64_t), ti);
+
+    return ti->idx;
+}
+
+FCITX_EXPORT_API
+boolean FcitxInstanceCheckTimeoutByFunc(FcitxInstance* instance, FcitxTimeoutCallback callback)
+{
+    utarray_foreach(pti, &instance->timeout, TimeoutItem*) {
+        if ((*pti)->callback == callback)
+            return true;
+    }
+    return false;
+}
+
+FCITX_EXPORT_API
+boolean FcitxInstanceCheckTimeoutById(FcitxInstance *instance, uint64_t id)
+{
+    return TimeoutFindById(instance, id) != NULL;
+}
+
+FCITX_EXPORT_API boolean
+FcitxInstanceRemoveTimeoutByFunc(FcitxInstance* instance,
+                                 FcitxTimeoutCallback callback)
+{
+    utarray_foreach(pti, &instance->timeout, TimeoutItem*) {
+        if ((*pti)->callback == callback) {
+            TimeoutRemove(instance, *pti);
+            return true;
+        }
+    }
+    return false;
+}
+
+FCITX_EXPORT_API
+boolean FcitxInstanceRemoveTimeoutById(FcitxInstance* instance, uint64_t id)
+{
+    if (id == 0)
+        return false;
+    TimeoutItem* ti = TimeoutFindById(instance, id);
+    if (!ti)
+        return false;
+    TimeoutRemove(instance, ti);
+    return true;
+}
+
+FCITX_EXPORT_API
+uint64_t FcitxInstanceAddIOWatch(FcitxInstance* instance, int fd, unsigned int events, FcitxIOCallback callback, void* arg)
+{
+    if (fd < 0 || !callback)
+        return 0;
+    if (IOWatchFindByFd(instance, fd)) {
+        FcitxLog(WARNING, "fd %d is already watched", fd);
+        return 0;
+    }
+#ifdef HAVE_SYS_EPOLL_H
+    /* stale registration of a closed fd from SetFD */
+    if (instance->epollfd >= 0 && fd < FD_SETSIZE && instance->legacyEvents[fd]) {
+        struct epoll_event ev;
+        epoll_ctl(instance->epollfd, EPOLL_CTL_DEL, fd, &ev);
+        instance->legacyEvents[fd] = 0;
+    }
+#endif
+
+    uint64_t id = ++instance->ioWatchIdx;
+#ifdef HAVE_SYS_EPOLL_H
+    if (instance->epollfd >= 0) {
+        if (!EpollControl(instance, EPOLL_CTL_ADD, fd, events, id)) {
+            FcitxLog(WARNING, "cannot watch fd %d: %s", fd, strerror(errno));
+            return 0;
+        }
+    } else
+#endif
+    if (fd >= FD_SETSIZE) {
+        FcitxLog(WARNING, "fd %d is too large for select", fd);
+        return 0;
+    }
+
+    FcitxIOWatch* watch = fcitx_utils_new(FcitxIOWatch);
+    watch->id = id;
+    watch->fd = fd;
+    watch->events = events;
+    watch->callback = callback;
+    watch->arg = arg;
+    HASH_ADD(hh, instance->ioWatches, id, sizeof(uint64_t), watch);
+    return id;
+}
+
+FCITX_EXPORT_API
+boolean FcitxInstanceUpdateIOWatch(FcitxInstance* instance, uint64_t id, unsigned int events)
+{
+    FcitxIOWatch* watch = IOWatchFindById(instance, id);
+    if (!watch)
+        return false;
+#ifdef HAVE_SYS_EPOLL_H
+    if (instance->epollfd >= 0
+        && !EpollControl(instance, EPOLL_CTL_MOD, watch->fd, events, id))
+        return false;
+#endif
+    watch->events = events;
+    return true;
+}
+
+FCITX_EXPORT_API
+boolean FcitxInstanceRemoveIOWatch(FcitxInstance* instance, uint64_t id)
+{
+    FcitxIOWatch* watch = IOWatchFindById(instance, id);
+    if (!watch)
+        return false;
+#ifdef HAVE_SYS_EPOLL_H
+    if (instance->epollfd >= 0) {
+        /* fd may be closed already, nothing to do then */
+        struct epoll_event ev;
+        epoll_ctl(instance->epollfd, EPOLL_CTL_DEL, watch->fd, &ev);
+    }
+#endif
+    HASH_DEL(instance->ioWatches, watch);
+    free(watch);
+    return true;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 4;
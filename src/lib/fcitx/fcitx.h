@@ -65,8 +65,16 @@ extern "C" {
 /** fcitx addon ABI version, need to be used with addon */
 #define FCITX_ABI_VERSION 5
 
+/**
+ * ABI version recorded by FCITX_DEFINE_PLUGIN, addons of FCITX_ABI_VERSION
+ * are still loaded. 6 appended the hash callbacks to FcitxFrontend, they are
+ * only read from frontends built with 6 or later.
+ * @since 4.2.9.7
+ */
+#define FCITX_ADDON_ABI_VERSION 6
+
 #define FCITX_DEFINE_PLUGIN(name, category, type) \
-FCITX_EXPORT_API int name##_ABI_VERSION = FCITX_ABI_VERSION; \
+FCITX_EXPORT_API int name##_ABI_VERSION = FCITX_ADDON_ABI_VERSION; \
 FCITX_EXPORT_API type name##_##category
 
 #if defined(__GNUC__) && ((__GNUC__ * 100 + __GNUC_MINOR__) >= 301)
@@ -43,6 +43,123 @@ static void FreeICData(FcitxInstance* instance, FcitxInputContext* ic);
 static void FillICData(FcitxInstance* instance, FcitxInputContext* ic);
 static boolean AppPreeditBlacklisted(
     FcitxInstance* instance, FcitxInputContext* ic);
+static void FcitxInstanceLinkIC(FcitxInstance* instance, FcitxAddon* addon,
+                                FcitxInputContext* ic);
+static void FcitxInstanceUnlinkIC(FcitxInstance* instance, FcitxInputContext* ic);
+
+static inline FcitxInputContext**
+ICBucketNext(FcitxInputContext* ic, boolean app)
+{
+    FcitxInputContext2* ic2 = (FcitxInputContext2*) ic;
+    return app ? &ic2->nextSameApp : &ic2->nextSameHash;
+}
+
+static FcitxICBucket*
+ICBucketFind(FcitxICBucket* table, int frontendid, uintptr_t hash)
+{
+    FcitxICHashKey key;
+    FcitxICBucket* bucket = NULL;
+    memset(&key, 0, sizeof(key));
+    key.frontendid = frontendid;
+    key.hash = hash;
+    HASH_FIND(hh, table, &key, sizeof(FcitxICHashKey), bucket);
+    return bucket;
+}
+
+static void
+ICBucketAdd(FcitxICBucket** table, FcitxInputContext* ic, uintptr_t hash,
+            boolean app)
+{
+    FcitxICBucket* bucket = ICBucketFind(*table, ic->frontendid, hash);
+    if (!bucket) {
+        bucket = fcitx_utils_new(FcitxICBucket);
+        bucket->key.frontendid = ic->frontendid;
+        bucket->key.hash = hash;
+        HASH_ADD(hh, *table, key, sizeof(FcitxICHashKey), bucket);
+    }
+    /* newest first, same as ic_list */
+    *ICBucketNext(ic, app) = bucket->ic;
+    bucket->ic = ic;
+}
+
+static void
+ICBucketRemove(FcitxICBucket** table, FcitxInputContext* ic, uintptr_t hash,
+               boolean app)
+{
+    FcitxICBucket* bucket = ICBucketFind(*table, ic->frontendid, hash);
+    if (!bucket)
+        return;
+    FcitxInputContext** prec;
+    for (prec = &bucket->ic; *prec; prec = ICBucketNext(*prec, app)) {
+        if (*prec == ic) {
+            *prec = *ICBucketNext(ic, app);
+            break;
+        }
+    }
+    *ICBucketNext(ic, app) = NULL;
+    if (!bucket->ic) {
+        HASH_DEL(*table, bucket);
+        free(bucket);
+    }
+}
+
+/* older frontends don't have the hash callbacks at all */
+#define FRONTEND_HASH_ABI_VERSION 6
+
+static inline boolean FrontendHasHashIC(FcitxAddon* addon)
+{
+    return addon->abiVersion >= FRONTEND_HASH_ABI_VERSION
+        && addon->frontend->HashIC && addon->frontend->HashICFilter;
+}
+
+static inline boolean FrontendHasHashICApplication(FcitxAddon* addon)
+{
+    return addon->abiVersion >= FRONTEND_HASH_ABI_VERSION
+        && addon->frontend->HashICApplication;
+}
+
+void FcitxInstanceLinkIC(FcitxInstance* instance, FcitxAddon* addon,
+                         FcitxInputContext* ic)
+{
+    FcitxFrontend* frontend = addon->frontend;
+    FcitxInputContext2* ic2 = (FcitxInputContext2*) ic;
+    ic->next = instance->ic_list;
+    ic2->prev = NULL;
+    if (instance->ic_list)
+        ((FcitxInputContext2*) instance->ic_list)->prev = ic;
+    instance->ic_list = ic;
+
+    if (FrontendHasHashIC(addon)) {
+        ic2->icHash = frontend->HashIC(addon->addonInstance, ic);
+        ICBucketAdd(&instance->icByHash, ic, ic2->icHash, false);
+    }
+    if (FrontendHasHashICApplication(addon)) {
+        ic2->appHash = frontend->HashICApplication(addon->addonInstance, ic);
+        ICBucketAdd(&instance->icByApp, ic, ic2->appHash, true);
+    }
+}
+
+void FcitxInstanceUnlinkIC(FcitxInstance* instance, FcitxInputContext* ic)
+{
+    FcitxAddon **pfrontend = FcitxInstanceGetPFrontend(instance,
+                                                       ic->frontendid);
+    FcitxInputContext2* ic2 = (FcitxInputContext2*) ic;
+    if (ic2->prev)
+        ic2->prev->next = ic->next;
+    else
+        instance->ic_list = ic->next;
+    if (ic->next)
+        ((FcitxInputContext2*) ic->next)->prev = ic2->prev;
+    ic2->prev = NULL;
+
+    if (FrontendHasHashIC(*pfrontend))
+        ICBucketRemove(&instance->icByHash, ic, ic2->icHash, false);
+    if (FrontendHasHashICApplication(*pfrontend))
+        ICBucketRemove(&instance->icByApp, ic, ic2->appHash, true);
+
+    ic->next = instance->free_list;
+    instance->free_list = ic;
+}
 
 void FillICData(FcitxInstance* instance, FcitxInputContext* ic)
 {
@@ -188,8 +305,7 @@ FcitxInstanceCreateIC(FcitxInstance* instance, int frontendid, void * priv)
 
     frontend->CreateIC((*pfrontend)->addonInstance, rec, priv);
 
-    rec->next = instance->ic_list;
-    instance->ic_list = rec;
+    FcitxInstanceLinkIC(instance, *pfrontend, rec);
     return rec;
 }
 
@@ -216,7 +332,7 @@ int FcitxInstanceAllocDataForIC(FcitxInstance* instance,
 
 void FcitxInstanceCleanUpIC(FcitxInstance* instance)
 {
-    FcitxInputContext *rec = instance->ic_list, *last = NULL, *todel;
+    FcitxInputContext *rec = instance->ic_list, *todel;
 
     while (rec) {
         FcitxAddon **pfrontend = FcitxInstanceGetPFrontend(instance,
@@ -226,14 +342,9 @@ void FcitxInstanceCleanUpIC(FcitxInstance* instance)
         if (frontend->GetPid)
             pid = frontend->GetPid((*pfrontend)->addonInstance, rec);
         if (pid && !fcitx_utils_pid_exists(pid)) {
-            if (last != NULL)
-                last->next = rec->next;
-            else
-                instance->ic_list = rec->next;
             todel = rec;
             rec = rec->next;
-            todel->next = instance->free_list;
-            instance->free_list = todel;
+            FcitxInstanceUnlinkIC(instance, todel);
             frontend->DestroyIC((*pfrontend)->addonInstance, todel);
             FreeICData(instance, todel);
 
@@ -249,7 +360,6 @@ void FcitxInstanceCleanUpIC(FcitxInstance* instance)
             }
         }
         else {
-            last = rec;
             rec = rec->next;
         }
     }
@@ -262,7 +372,17 @@ FcitxInputContext* FcitxInstanceFindIC(FcitxInstance* instance, int frontendid,
     if (pfrontend == NULL)
         return NULL;
     FcitxFrontend* frontend = (*pfrontend)->frontend;
-    FcitxInputContext *rec = instance->ic_list;
+    FcitxInputContext *rec;
+    if (FrontendHasHashIC(*pfrontend)) {
+        uintptr_t hash = frontend->HashICFilter((*pfrontend)->addonInstance, filter);
+        FcitxICBucket* bucket = ICBucketFind(instance->icByHash, frontendid, hash);
+        for (rec = bucket ? bucket->ic : NULL; rec; rec = *ICBucketNext(rec, false)) {
+            if (frontend->CheckIC((*pfrontend)->addonInstance, rec, filter))
+                return rec;
+        }
+        return NULL;
+    }
+    rec = instance->ic_list;
     while (rec != NULL) {
         if (rec->frontendid == frontendid && frontend->CheckIC((*pfrontend)->addonInstance, rec, filter))
             return rec;
@@ -280,7 +400,20 @@ void FcitxInstanceSetICStateFromSameApplication(FcitxInstance* instance, int fro
     FcitxFrontend* frontend = (*pfrontend)->frontend;
     if (!frontend->CheckICFromSameApplication)
         return;
-    FcitxInputContext *rec = instance->ic_list;
+    FcitxInputContext *rec;
+    /* ic may be not in ic_list yet, it's called from CreateIC */
+    if (FrontendHasHashICApplication(*pfrontend)) {
+        uintptr_t hash = frontend->HashICApplication((*pfrontend)->addonInstance, ic);
+        FcitxICBucket* bucket = ICBucketFind(instance->icByApp, frontendid, hash);
+        for (rec = bucket ? bucket->ic : NULL; rec; rec = *ICBucketNext(rec, true)) {
+            if (rec != ic && frontend->CheckICFromSameApplication((*pfrontend)->addonInstance, rec, ic)) {
+                ic->state = rec->state;
+                break;
+            }
+        }
+        return;
+    }
+    rec = instance->ic_list;
     while (rec != NULL) {
         if (rec->frontendid == frontendid && frontend->CheckICFromSameApplication((*pfrontend)->addonInstance, rec, ic)) {
             ic->state = rec->state;
@@ -293,41 +426,29 @@ void FcitxInstanceSetICStateFromSameApplication(FcitxInstance* instance, int fro
 FCITX_EXPORT_API
 void FcitxInstanceDestroyIC(FcitxInstance* instance, int frontendid, void* filter)
 {
-    FcitxInputContext *rec, *last;
     FcitxAddon **pfrontend = FcitxInstanceGetPFrontend(instance, frontendid);
     if (pfrontend == NULL)
         return;
     FcitxFrontend* frontend = (*pfrontend)->frontend;
 
-    last = NULL;
-
-    for (rec = instance->ic_list; rec != NULL; last = rec, rec = rec->next) {
-        if (rec->frontendid == frontendid && frontend->CheckIC((*pfrontend)->addonInstance, rec, filter)) {
-            if (last != NULL)
-                last->next = rec->next;
-            else
-                instance->ic_list = rec->next;
+    FcitxInputContext *rec = FcitxInstanceFindIC(instance, frontendid, filter);
+    if (!rec)
+        return;
 
-            rec->next = instance->free_list;
-            instance->free_list = rec;
+    FcitxInstanceUnlinkIC(instance, rec);
 
-            if (rec == instance->lastIC) {
-                FcitxInstanceSetLastIC(instance, NULL);
-            }
-
-            if (rec == FcitxInstanceGetCurrentIC(instance)) {
-                FcitxUICloseInputWindow(instance);
-                FcitxUIOnInputUnFocus(instance);
-                FcitxInstanceSetCurrentIC(instance, NULL);
-            }
+    if (rec == instance->lastIC) {
+        FcitxInstanceSetLastIC(instance, NULL);
+    }
 
-            frontend->DestroyIC((*pfrontend)->addonInstance, rec);
-            FreeICData(instance, rec);
-            return;
-        }
+    if (rec == FcitxInstanceGetCurrentIC(instance)) {
+        FcitxUICloseInputWindow(instance);
+        FcitxUIOnInputUnFocus(instance);
+        FcitxInstanceSetCurrentIC(instance, NULL);
     }
 
-    return;
+    frontend->DestroyIC((*pfrontend)->addonInstance, rec);
+    FreeICData(instance, rec);
 }
 
 FCITX_EXPORT_API
@@ -543,6 +664,7 @@ boolean FcitxInstanceLoadFrontend(FcitxInstance* instance)
                     dlclose(handle);
                     break;
                 }
+                addon->abiVersion = FcitxGetABIVersion(handle, addon->name);
                 if ((addon->addonInstance = frontend->Create(instance, frontendindex)) == NULL) {
                     dlclose(handle);
                     break;
@@ -105,7 +105,13 @@ extern "C" {
             FcitxTriState mayUsePreedit;
             void* _dummy;
         };
-        void* padding[12];
+        /* below are maintained by the instance for frontends with HashIC */
+        struct _FcitxInputContext* prev; /**< previous input context in ic_list */
+        struct _FcitxInputContext* nextSameHash; /**< next input context with same HashIC */
+        struct _FcitxInputContext* nextSameApp; /**< next input context with same HashICApplication */
+        uintptr_t icHash; /**< cached HashIC */
+        uintptr_t appHash; /**< cached HashICApplication */
+        void* padding[7];
     } FcitxInputContext2;
 
     /**
@@ -130,6 +136,17 @@ extern "C" {
         pid_t (*GetPid)(void* arg, FcitxInputContext* arg1); /**< get pid for ic, zero for unknown */
         void (*DeleteSurroundingText)(void* addonInstance, FcitxInputContext* ic, int offset, unsigned int size);
         boolean (*GetSurroundingPreedit)(void* addonInstance, FcitxInputContext* ic, char** str, unsigned int* cursor, unsigned int* anchor);
+        /**
+         * optional, hash of the filter passed to FcitxInstanceFindIC and
+         * FcitxInstanceDestroyIC, must equal to HashIC of the input context
+         * that CheckIC accepts with this filter. It should be set together
+         * with HashIC, then input context can be found without calling
+         * CheckIC on every one of them.
+         * @since 4.2.9.7
+         **/
+        uintptr_t (*HashICFilter)(void* addonInstance, void* filter);
+        uintptr_t (*HashIC)(void* addonInstance, FcitxInputContext* ic); /**< optional, hash of the input context, it should not change after CreateIC @since 4.2.9.7 */
+        uintptr_t (*HashICApplication)(void* addonInstance, FcitxInputContext* ic); /**< optional, equal for input contexts that CheckICFromSameApplication accepts, it should not change after CreateIC @since 4.2.9.7 */
     } FcitxFrontend;
 
     /**
@@ -78,6 +78,35 @@ void FcitxInstanceProcessPostReleaseInputFilter(struct _FcitxInstance* instance,
  **/
 INPUT_RETURN_VALUE FcitxInstanceProcessHotkey(struct _FcitxInstance* instance, FcitxKeySym keysym, unsigned int state);
 
+/**
+ * mark the compiled hotkey table out of date, it will be compiled again
+ * on next key event
+ *
+ * @param instance fcitx instance
+ * @return void
+ **/
+void FcitxInstanceInvalidateHotkeyTable(struct _FcitxInstance* instance);
+
+/**
+ * find everything bound to a key in the compiled hotkey table
+ *
+ * @param instance fcitx instance
+ * @param sym keysym
+ * @param state keystate
+ * @return struct _FcitxHotkeyEntry*, NULL if nothing bound
+ **/
+struct _FcitxHotkeyEntry* FcitxInstanceFindHotkeyEntry(struct _FcitxInstance* instance, FcitxKeySym sym, unsigned int state);
+
+/**
+ * add a key to hotkey table while compiling
+ *
+ * @param instance fcitx instance
+ * @param sym keysym
+ * @param state keystate
+ * @return struct _FcitxHotkeyEntry*
+ **/
+struct _FcitxHotkeyEntry* FcitxInstanceAddHotkeyEntry(struct _FcitxInstance* instance, FcitxKeySym sym, unsigned int state);
+
 /**
  * process reset input
  *
@@ -26,6 +26,7 @@
 #include "fcitx/hook-internal.h"
 #include "fcitx-utils/utils.h"
 #include "instance-internal.h"
+#include "ime-internal.h"
 
 /**
  * @file hook.c
@@ -52,9 +53,9 @@ typedef struct _HookStack {
 } HookStack;
 
 /**
- * internal macro to define a hook
+ * internal macro to define a hook, changed is run after a new hook is added
  */
-#define DEFINE_HOOK(name, type, field) \
+#define DEFINE_HOOK_NOTIFY(name, type, field, changed) \
     static HookStack* Get##name(FcitxInstance* instance); \
     HookStack* Get##name(FcitxInstance* instance) \
     { \
@@ -73,15 +74,19 @@ typedef struct _HookStack {
         head->next = fcitx_utils_malloc0(sizeof(HookStack)); \
         head = head->next; \
         head->field = value; \
+        changed; \
     }
 
+#define DEFINE_HOOK(name, type, field) DEFINE_HOOK_NOTIFY(name, type, field, )
+
 DEFINE_HOOK(PreInputFilter, FcitxKeyFilterHook, keyfilter)
 DEFINE_HOOK(PostInputFilter, FcitxKeyFilterHook, keyfilter)
 DEFINE_HOOK(PreReleaseInputFilter, FcitxKeyFilterHook, keyfilter)
 DEFINE_HOOK(PostReleaseInputFilter, FcitxKeyFilterHook, keyfilter)
 DEFINE_HOOK(OutputFilter, FcitxStringFilterHook, stringfilter)
 DEFINE_HOOK(CommitFilter, FcitxStringFilterHook, stringfilter)
-DEFINE_HOOK(HotkeyFilter, FcitxHotkeyHook, hotkey)
+DEFINE_HOOK_NOTIFY(HotkeyFilter, FcitxHotkeyHook, hotkey,
+                   FcitxInstanceInvalidateHotkeyTable(instance))
 DEFINE_HOOK(ResetInputHook, FcitxIMEventHook, eventhook);
 DEFINE_HOOK(TriggerOnHook, FcitxIMEventHook, eventhook);
 DEFINE_HOOK(TriggerOffHook, FcitxIMEventHook, eventhook);
@@ -271,31 +276,85 @@ void FcitxInstanceProcessICStateChangedHook(FcitxInstance* instance, FcitxInputC
 
 INPUT_RETURN_VALUE FcitxInstanceProcessHotkey(FcitxInstance* instance, FcitxKeySym keysym, unsigned int state)
 {
+    FcitxHotkeyEntry* entry = FcitxInstanceFindHotkeyEntry(instance, keysym, state);
+    if (entry && entry->hasHook)
+        return entry->hook.hotkeyhandle(entry->hook.arg);
+    return IRV_TO_PROCESS;
+}
+
+void FcitxInstanceInvalidateHotkeyTable(FcitxInstance* instance)
+{
+    instance->hotkeyTableValid = false;
+}
+
+FcitxHotkeyEntry* FcitxInstanceAddHotkeyEntry(FcitxInstance* instance, FcitxKeySym sym, unsigned int state)
+{
+    FcitxHotkeyEntryKey key;
+    FcitxHotkeyEntry* entry = NULL;
+    memset(&key, 0, sizeof(key));
+    key.sym = sym;
+    key.state = state;
+    HASH_FIND(hh, instance->hotkeyTable, &key, sizeof(FcitxHotkeyEntryKey), entry);
+    if (!entry) {
+        entry = fcitx_utils_new(FcitxHotkeyEntry);
+        entry->key = key;
+        HASH_ADD(hh, instance->hotkeyTable, key, sizeof(FcitxHotkeyEntryKey), entry);
+    }
+    return entry;
+}
+
+/*
+ * hotkey of the hooks are pointers to config, so they are read again
+ * whenever the table is invalidated, e.g. after config is reloaded.
+ */
+static void FcitxInstanceCompileHotkeyTable(FcitxInstance* instance)
+{
+    FcitxHotkeyEntry* entry;
+    while (instance->hotkeyTable) {
+        entry = instance->hotkeyTable;
+        HASH_DEL(instance->hotkeyTable, entry);
+        free(entry);
+    }
+
+    FcitxInstanceCompileKeyHandle(instance);
+
     HookStack* stack = GetHotkeyFilter(instance);
-    stack = stack->next;
-    INPUT_RETURN_VALUE out = IRV_TO_PROCESS;
-    while (stack) {
-        /* a little bit hack here, but safer */
-        FcitxHotkey tempKey[2];
-        FcitxHotkeyGetKey(
-            stack->hotkey.hotkey[0].sym,
-            stack->hotkey.hotkey[0].state,
-            &tempKey[0].sym,
-            &tempKey[0].state
-        );
-        FcitxHotkeyGetKey(
-            stack->hotkey.hotkey[1].sym,
-            stack->hotkey.hotkey[1].state,
-            &tempKey[1].sym,
-            &tempKey[1].state
-        );
-        if (FcitxHotkeyIsHotKey(keysym, state, tempKey)) {
-            out = stack->hotkey.hotkeyhandle(stack->hotkey.arg);
-            break;
+    for (stack = stack->next; stack; stack = stack->next) {
+        int i;
+        for (i = 0; i < 2; i++) {
+            /* a little bit hack here, but safer */
+            FcitxKeySym sym;
+            unsigned int state;
+            FcitxHotkeyGetKey(stack->hotkey.hotkey[i].sym,
+                              stack->hotkey.hotkey[i].state,
+                              &sym, &state);
+            if (!sym)
+                continue;
+            entry = FcitxInstanceAddHotkeyEntry(instance, sym, state);
+            /* first registered wins */
+            if (!entry->hasHook) {
+                entry->hasHook = true;
+                entry->hook = stack->hotkey;
+            }
         }
-        stack = stack->next;
     }
-    return out;
+
+    instance->hotkeyTableValid = true;
+}
+
+FcitxHotkeyEntry* FcitxInstanceFindHotkeyEntry(FcitxInstance* instance, FcitxKeySym sym, unsigned int state)
+{
+    if (!instance->hotkeyTableValid)
+        FcitxInstanceCompileHotkeyTable(instance);
+
+    FcitxHotkeyEntryKey key;
+    FcitxHotkeyEntry* entry = NULL;
+    memset(&key, 0, sizeof(key));
+    key.sym = sym;
+    /* same as FcitxHotkeyIsHotKey */
+    key.state = state & (FcitxKeyState_Ctrl_Alt_Shift | FcitxKeyState_Super);
+    HASH_FIND(hh, instance->hotkeyTable, &key, sizeof(FcitxHotkeyEntryKey), entry);
+    return entry;
 }
 
 void FcitxInstanceProcessUIStatusChangedHook(FcitxInstance* instance, const char* statusName)
@@ -97,6 +97,8 @@ void FcitxInstanceInitIM(struct _FcitxInstance* instance);
 
 void FcitxInstanceInitBuiltInHotkey(struct _FcitxInstance* instance);
 
+void FcitxInstanceCompileKeyHandle(struct _FcitxInstance* instance);
+
 void FcitxInstanceDoPhraseTips(struct _FcitxInstance* instance);
 
 boolean FcitxInstanceLoadAllIM(struct _FcitxInstance* instance);
@@ -703,6 +703,88 @@ boolean _CheckSwitchIM(FcitxInstance* instance) {
     return instance->config->bIMSwitchKey;
 }
 
+typedef struct _FcitxKeyHandle {
+    KEY_RELEASED kr;
+    INPUT_RETURN_VALUE (*callback)(FcitxInstance*);
+    boolean (*check)(FcitxInstance*);
+} FcitxKeyHandle;
+
+/* in priority order, hotkeys are in _GetKeyHandleHotkey */
+static const FcitxKeyHandle keyHandle[] = {
+    {KR_2ND_SELECTKEY, _Do2ndSelect, _Check2ndSelect},
+    {KR_3RD_SELECTKEY, _Do3ndSelect, _Check3ndSelect},
+    {KR_SWITCH, _DoSwitch, _CheckSwitch},
+    {KR_SWITCH_IM, _DoSwitchIM, _CheckSwitchIM},
+    {KR_SWITCH_IM_REVERSE, _DoSwitchIMReverse, _CheckSwitchIM},
+    {KR_TRIGGER, _DoTrigger, NULL},
+    {KR_ACTIVATE, _DoActivate, _CheckActivate},
+    {KR_DEACTIVATE, _DoDeactivate, _CheckDeactivate},
+};
+
+/* hotkeys of keyHandle[index], at most 4 of them */
+static void
+_GetKeyHandleHotkey(FcitxGlobalConfig* fc, int index, FcitxHotkey hotkey[4])
+{
+    memset(hotkey, 0, sizeof(FcitxHotkey[4]));
+    switch (keyHandle[index].kr) {
+    case KR_2ND_SELECTKEY:
+        memcpy(hotkey, fc->i2ndSelectKey, sizeof(FcitxHotkey[2]));
+        break;
+    case KR_3RD_SELECTKEY:
+        memcpy(hotkey, fc->i3rdSelectKey, sizeof(FcitxHotkey[2]));
+        break;
+    case KR_SWITCH:
+        // check config.desc
+#define CUSTOM_SWITCH_KEY 19
+        if ((int) fc->iSwitchKey < CUSTOM_SWITCH_KEY) {
+            memcpy(hotkey, switchKey1[fc->iSwitchKey], sizeof(FcitxHotkey[2]));
+            memcpy(hotkey + 2, switchKey2[fc->iSwitchKey], sizeof(FcitxHotkey[2]));
+        } else {
+            _NormalizeHotkeyForModifier(fc->hkCustomSwitchKey, hotkey, hotkey + 2);
+        }
+        break;
+    case KR_SWITCH_IM:
+        memcpy(hotkey, imSWNextKey1[fc->iIMSwitchKey], sizeof(FcitxHotkey[2]));
+        memcpy(hotkey + 2, imSWNextKey2[fc->iIMSwitchKey], sizeof(FcitxHotkey[2]));
+        break;
+    case KR_SWITCH_IM_REVERSE:
+        memcpy(hotkey, imSWPrevKey1[fc->iIMSwitchKey], sizeof(FcitxHotkey[2]));
+        memcpy(hotkey + 2, imSWPrevKey2[fc->iIMSwitchKey], sizeof(FcitxHotkey[2]));
+        break;
+    case KR_TRIGGER:
+        _NormalizeHotkeyForModifier(fc->hkTrigger, hotkey, hotkey + 2);
+        break;
+    case KR_ACTIVATE:
+        _NormalizeHotkeyForModifier(fc->hkActivate, hotkey, hotkey + 2);
+        break;
+    case KR_DEACTIVATE:
+        _NormalizeHotkeyForModifier(fc->hkInactivate, hotkey, hotkey + 2);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * add hotkeys of keyHandle to the hotkey table, instead of normalizing and
+ * comparing them on every key event
+ */
+void FcitxInstanceCompileKeyHandle(FcitxInstance* instance)
+{
+    int i, j;
+    for (i = 0; i < FCITX_ARRAY_SIZE(keyHandle); i ++) {
+        FcitxHotkey hotkey[4];
+        _GetKeyHandleHotkey(instance->config, i, hotkey);
+        for (j = 0; j < 4; j ++) {
+            if (!hotkey[j].sym)
+                continue;
+            FcitxHotkeyEntry* entry = FcitxInstanceAddHotkeyEntry(
+                instance, hotkey[j].sym, hotkey[j].state);
+            entry->keyHandleMask |= (1 << i);
+        }
+    }
+}
+
 FCITX_EXPORT_API
 INPUT_RETURN_VALUE FcitxInstanceProcessKey(
     FcitxInstance* instance,
@@ -721,54 +803,6 @@ INPUT_RETURN_VALUE FcitxInstanceProcessKey(
 
     FcitxGlobalConfig *fc = instance->config;
 
-    const FcitxHotkey* hkSwitchNext1 = imSWNextKey1[fc->iIMSwitchKey];
-    const FcitxHotkey* hkSwitchNext2 = imSWNextKey2[fc->iIMSwitchKey];
-
-    const FcitxHotkey* hkSwitchPrev1 = imSWPrevKey1[fc->iIMSwitchKey];
-    const FcitxHotkey* hkSwitchPrev2 = imSWPrevKey2[fc->iIMSwitchKey];
-
-    const FcitxHotkey* hkSwitchKey1;
-    const FcitxHotkey* hkSwitchKey2;
-
-    FcitxHotkey hkCustomSwitchKey1[2];
-    FcitxHotkey hkCustomSwitchKey2[2];
-    FcitxHotkey hkTrigger1[2];
-    FcitxHotkey hkTrigger2[2];
-    FcitxHotkey hkActivate1[2];
-    FcitxHotkey hkActivate2[2];
-    FcitxHotkey hkInactivate1[2];
-    FcitxHotkey hkInactivate2[2];
-    // check config.desc
-#define CUSTOM_SWITCH_KEY 19
-    if ((int) fc->iSwitchKey < CUSTOM_SWITCH_KEY) {
-        hkSwitchKey1 = switchKey1[fc->iSwitchKey];
-        hkSwitchKey2 = switchKey2[fc->iSwitchKey];
-    } else {
-        _NormalizeHotkeyForModifier(fc->hkCustomSwitchKey, hkCustomSwitchKey1, hkCustomSwitchKey2);
-        hkSwitchKey1 = hkCustomSwitchKey1;
-        hkSwitchKey2 = hkCustomSwitchKey2;
-    }
-    _NormalizeHotkeyForModifier(fc->hkTrigger, hkTrigger1, hkTrigger2);
-    _NormalizeHotkeyForModifier(fc->hkActivate, hkActivate1, hkActivate2);
-    _NormalizeHotkeyForModifier(fc->hkInactivate, hkInactivate1, hkInactivate2);
-
-    struct {
-        KEY_RELEASED kr;
-        const FcitxHotkey* hk1;
-        const FcitxHotkey* hk2;
-        INPUT_RETURN_VALUE (*callback)(FcitxInstance*);
-        boolean (*check)(FcitxInstance*);
-    } keyHandle[] = {
-        {KR_2ND_SELECTKEY, fc->i2ndSelectKey, NULL, _Do2ndSelect, _Check2ndSelect}, // KR_2ND_SELECTKEY,
-        {KR_3RD_SELECTKEY, fc->i3rdSelectKey, NULL, _Do3ndSelect, _Check3ndSelect}, // KR_3RD_SELECTKEY,
-        {KR_SWITCH, hkSwitchKey1, hkSwitchKey2, _DoSwitch, _CheckSwitch}, // KR_SWITCH
-        {KR_SWITCH_IM, hkSwitchNext1, hkSwitchNext2, _DoSwitchIM, _CheckSwitchIM}, //  KR_SWITCH_IM,
-        {KR_SWITCH_IM_REVERSE, hkSwitchPrev1, hkSwitchPrev2, _DoSwitchIMReverse, _CheckSwitchIM}, // KR_SWITCH_IM_REVERSE,
-        {KR_TRIGGER, hkTrigger1, hkTrigger2, _DoTrigger, NULL},
-        {KR_ACTIVATE, hkActivate1, hkActivate2, _DoActivate, _CheckActivate},
-        {KR_DEACTIVATE, hkInactivate1, hkInactivate2, _DoDeactivate, _CheckDeactivate}, //  KR_DEACTIVATE
-    };
-
     if (instance->CurrentIC == NULL)
         return IRV_TO_PROCESS;
 
@@ -788,7 +822,9 @@ INPUT_RETURN_VALUE FcitxInstanceProcessKey(
     boolean triggerOnRelease = IsTriggerOnRelease(sym, state);
 
 #define HAVE_IM (utarray_len(&instance->imes) > 1)
-#define CHECK_HOTKEY(name) ((name##1 ? FcitxHotkeyIsHotKey(sym, state, name##1) : false) || (name##2 ? FcitxHotkeyIsHotKey(sym, state, name##2) : false))
+    FcitxHotkeyEntry* entry = FcitxInstanceFindHotkeyEntry(instance, sym, state);
+    uint32_t keyHandleMask = entry ? entry->keyHandleMask : 0;
+#define CHECK_HOTKEY(i) (keyHandleMask & (1 << (i)))
 
     /*
      * for following reason, we cannot just process switch key, 2nd, 3rd key as other simple hotkey
@@ -807,7 +843,7 @@ INPUT_RETURN_VALUE FcitxInstanceProcessKey(
         for (i = 0; i < FCITX_ARRAY_SIZE(keyHandle); i ++) {
             if (retVal == IRV_TO_PROCESS
                 && input->keyReleased == keyHandle[i].kr
-                && CHECK_HOTKEY(keyHandle[i].hk)) {
+                && CHECK_HOTKEY(i)) {
                 if (triggerOnRelease) {
                     retVal = keyHandle[i].callback(instance);
                 } else {
@@ -842,7 +878,7 @@ INPUT_RETURN_VALUE FcitxInstanceProcessKey(
                 }
                 int i;
                 for (i = 0; i < FCITX_ARRAY_SIZE(keyHandle); i ++) {
-                    if (CHECK_HOTKEY(keyHandle[i].hk) && (!keyHandle[i].check || keyHandle[i].check(instance))) {
+                    if (CHECK_HOTKEY(i) && (!keyHandle[i].check || keyHandle[i].check(instance))) {
                         if (!triggerOnRelease) {
                             retVal = keyHandle[i].callback(instance);
                         }
@@ -1372,6 +1408,8 @@ void FcitxInstanceReloadAddonConfig(FcitxInstance *instance, const char* addonna
             }
         } while(0);
     }
+
+    FcitxInstanceInvalidateHotkeyTable(instance);
 }
 
 FCITX_EXPORT_API
@@ -1435,6 +1473,8 @@ void FcitxInstanceReloadConfig(FcitxInstance *instance)
 
     if (instance->ui && instance->ui->ui->ReloadConfig)
         instance->ui->ui->ReloadConfig(instance->ui->addonInstance);
+
+    FcitxInstanceInvalidateHotkeyTable(instance);
     
     instance->eventflag |= FEF_RELOAD_ADDON;
 }
@@ -1735,7 +1775,7 @@ void HideInputSpeed(void* arg)
         || FcitxMessagesIsMessageChanged(input->msgAuxDown)
         || FcitxMessagesGetMessageCount(input->msgPreedit)
         || FcitxMessagesGetMessageCount(input->msgClientPreedit)
-        || FcitxCandidateWordGetListSize(input->candList))
+        || !FcitxCandidateWordIsEmpty(input->candList))
         return;
     FcitxUICloseInputWindow(instance);
 }
@@ -1759,7 +1799,7 @@ void FcitxInstanceShowInputSpeed(FcitxInstance* instance, boolean force)
         || FcitxMessagesGetMessageCount(input->msgAuxDown)
         || FcitxMessagesGetMessageCount(input->msgPreedit)
         || FcitxMessagesGetMessageCount(input->msgClientPreedit)
-        || FcitxCandidateWordGetListSize(input->candList))
+        || !FcitxCandidateWordIsEmpty(input->candList))
         return;
 
     input->bShowCursor = false;
@@ -2079,7 +2119,7 @@ INPUT_RETURN_VALUE FcitxStandardKeyBlocker(FcitxInputState* input, FcitxKeySym k
     if ((FcitxInputStateGetRawInputBufferSize(input) != 0
          || FcitxMessagesGetMessageCount(input->msgPreedit)
          || FcitxMessagesGetMessageCount(input->msgClientPreedit)
-         || FcitxCandidateWordGetListSize(input->candList))
+         || !FcitxCandidateWordIsEmpty(input->candList))
         && (FcitxHotkeyIsHotKeySimple(key, state)
         || FcitxHotkeyIsHotkeyCursorMove(key, state)
         || FcitxHotkeyIsHotKey(key, state, FCITX_SHIFT_SPACE)
@@ -36,6 +36,7 @@
 #include "profile.h"
 #include "addon.h"
 #include "context.h"
+#include "hook.h"
 
 typedef struct _UnusedIMItem {
     char* name;
@@ -49,8 +50,45 @@ typedef struct _TimeoutItem {
     unsigned long int milli;
     uint64_t idx;
     uint64_t time;
+    unsigned int heapIdx; /* position in FcitxInstance::timeout */
+    UT_hash_handle hh; /* FcitxInstance::timeoutById */
 } TimeoutItem;
 
+typedef struct _FcitxIOWatch {
+    uint64_t id;
+    int fd;
+    unsigned int events;
+    FcitxIOCallback callback;
+    void* arg;
+    UT_hash_handle hh;
+} FcitxIOWatch;
+
+typedef struct _FcitxICHashKey {
+    int frontendid;
+    uintptr_t hash;
+} FcitxICHashKey;
+
+/* input contexts with same hash, chained by FcitxInputContext2 */
+typedef struct _FcitxICBucket {
+    FcitxICHashKey key;
+    FcitxInputContext* ic;
+    UT_hash_handle hh;
+} FcitxICBucket;
+
+typedef struct _FcitxHotkeyEntryKey {
+    FcitxKeySym sym;
+    unsigned int state;
+} FcitxHotkeyEntryKey;
+
+/* everything bound to one key, see FcitxInstanceFindHotkeyEntry */
+typedef struct _FcitxHotkeyEntry {
+    FcitxHotkeyEntryKey key;
+    uint32_t keyHandleMask; /* bit n for keyHandle[n] in ime.c */
+    boolean hasHook;
+    FcitxHotkeyHook hook; /* first matched hotkey filter */
+    UT_hash_handle hh;
+} FcitxHotkeyEntry;
+
 typedef struct _FcitxICDataInfo {
     FcitxICDataAllocCallback allocCallback;
     FcitxICDataCopyCallback copyCallback;
@@ -93,6 +131,8 @@ struct _FcitxInstance {
     struct _FcitxInputContext *CurrentIC;
     struct _FcitxInputContext *ic_list;
     struct _FcitxInputContext *free_list;
+    FcitxICBucket* icByHash;
+    FcitxICBucket* icByApp;
     sem_t* sem;
     sem_t startUpSem;
     sem_t notifySem;
@@ -119,6 +159,12 @@ struct _FcitxInstance {
     struct _HookStack* hookIMChangedHook;
     struct _HookStack* hookUIStatusChangedHook;
 
+    FcitxHotkeyEntry* hotkeyTable;
+    boolean hotkeyTableValid;
+
+    /* see FcitxInstanceStartAddonPreload */
+    struct _FcitxAddonPreloader* addonPreloader;
+
     uint32_t eventflag;
 
     FcitxContextState globalState;
@@ -151,9 +197,18 @@ struct _FcitxInstance {
     UT_array* disableList;
     UT_array* enableList;
 
+    /* min heap of TimeoutItem*, ordered by deadline */
     UT_array timeout;
     volatile boolean initialized;
     uint64_t timeoutIdx;
+    TimeoutItem* timeoutById;
+
+    /* event loop, see eventloop.c */
+    int epollfd;
+    FcitxIOWatch* ioWatches;
+    uint64_t ioWatchIdx;
+    int legacyMaxFD;
+    uint8_t legacyEvents[FD_SETSIZE];
 
     UT_array icdata;
     volatile boolean loadingFatalError;
@@ -173,6 +228,11 @@ struct _FcitxInstance {
 void FcitxInstanceSetLastIC(FcitxInstance* instance, FcitxInputContext* ic);
 void FcitxInstanceSetDelayedIM(FcitxInstance* instance, const char* im);
 
+void FcitxEventLoopInit(FcitxInstance* instance);
+void FcitxEventLoopDestroy(FcitxInstance* instance);
+void FcitxEventLoopProcessTimeout(FcitxInstance* instance, uint64_t curtime);
+boolean FcitxEventLoopWait(FcitxInstance* instance);
+
 static inline FcitxAddon**
 FcitxInstanceGetPFrontend(FcitxInstance *instance, int id)
 {
@@ -76,9 +76,6 @@ static const UT_icd stat_icd = {
 static const UT_icd compstat_icd = {
     sizeof(FcitxUIComplexStatus), NULL, NULL, NULL
 };
-static const UT_icd timeout_icd = {
-    sizeof(TimeoutItem), NULL, NULL, NULL
-};
 static const UT_icd icdata_icd = {
     sizeof(FcitxICDataInfo), NULL, NULL, NULL
 };
@@ -93,6 +90,7 @@ static void FcitxInstanceInitBuiltContext(FcitxInstance* instance);
 static void FcitxInstanceShowRemindStatusChanged(void* arg, const void* value);
 static void FcitxInstanceRealEnd(FcitxInstance* instance);
 static void FcitxInstanceInitNoPreeditApps(FcitxInstance* instance);
+static void FcitxInstanceProcessSignal(void* arg, int fd, unsigned int events);
 
 /**
  * 显示命令行参数
@@ -231,7 +229,7 @@ void* RunInstance(void* arg)
     utarray_init(&instance->uistats, &stat_icd);
     utarray_init(&instance->uicompstats, &compstat_icd);
     utarray_init(&instance->uimenus, fcitx_ptr_icd);
-    utarray_init(&instance->timeout, &timeout_icd);
+    FcitxEventLoopInit(instance);
     utarray_init(&instance->icdata, &icdata_icd);
     instance->input = FcitxInputStateCreate();
     instance->config = fcitx_utils_malloc0(sizeof(FcitxGlobalConfig));
@@ -243,6 +241,9 @@ void* RunInstance(void* arg)
         instance->fd = -1;
     }
 
+    if (CHECK_ENV("FCITX_NO_CONFIG_CACHE", "1", true))
+        FcitxConfigCacheOpen(NULL);
+
     if (!FcitxGlobalConfigLoad(instance->config))
         goto error_exit;
 
@@ -271,11 +272,12 @@ void* RunInstance(void* arg)
     FcitxAddonsLoad(&instance->addons);
     FcitxInstanceFillAddonOwner(instance, NULL);
     FcitxInstanceResolveAddonDependency(instance);
+    FcitxInstanceStartAddonPreload(instance);
     FcitxInstanceInitBuiltInHotkey(instance);
     FcitxInstanceInitBuiltContext(instance);
     FcitxModuleLoad(instance);
     if (instance->loadingFatalError)
-        return NULL;
+        goto error_exit;
     if (!FcitxInstanceLoadAllIM(instance)) {
         goto error_exit;
     }
@@ -300,6 +302,9 @@ void* RunInstance(void* arg)
         goto error_exit;
     }
 
+    FcitxInstanceFinishAddonPreload(instance);
+    FcitxConfigCacheSave();
+
     /* fcitx is running in a standalone thread or not */
     if (instance->sem) {
         sem_post(&instance->notifySem);
@@ -308,52 +313,29 @@ void* RunInstance(void* arg)
         instance->initialized = true;
     }
 
+    if (instance->fd >= 0) {
+        FcitxInstanceAddIOWatch(instance, instance->fd, FCITX_IO_READ,
+                                FcitxInstanceProcessSignal, instance);
+    }
+
     uint64_t curtime = 0;
     while (1) {
-        FcitxAddon** pmodule;
-        uint8_t signo = 0;
-        if (instance->fd >= 0) {
-            while (read(instance->fd, &signo, sizeof(char)) > 0) {
-                if (signo == SIGINT || signo == SIGTERM || signo == SIGQUIT || signo == SIGXCPU)
-                    FcitxInstanceEnd(instance);
-                else if (signo == SIGHUP)
-                    FcitxInstanceRestart(instance);
-                else if (signo == SIGUSR1)
-                    FcitxInstanceReloadConfig(instance);
-            }
-        }
+        unsigned int i;
         do {
             instance->eventflag &= (~FEF_PROCESS_EVENT_MASK);
-            for (pmodule = (FcitxAddon**) utarray_front(&instance->eventmodules);
-                  pmodule != NULL;
-                  pmodule = (FcitxAddon**) utarray_next(&instance->eventmodules, pmodule)) {
-                FcitxModule* module = (*pmodule)->module;
-                module->ProcessEvent((*pmodule)->addonInstance);
+            /*
+             * an on demand module may be loaded by ProcessEvent and appended
+             * to eventmodules, so don't keep a pointer into the array
+             */
+            for (i = 0; i < utarray_len(&instance->eventmodules); i++) {
+                FcitxAddon* addon = *(FcitxAddon**) utarray_eltptr(&instance->eventmodules, i);
+                addon->module->ProcessEvent(addon->addonInstance);
             }
             struct timeval current_time;
             gettimeofday(&current_time, NULL);
             curtime = (current_time.tv_sec * 1000LL) + (current_time.tv_usec / 1000LL);
 
-            unsigned int idx = 0;
-            while(idx < utarray_len(&instance->timeout))
-            {
-                TimeoutItem* ti = (TimeoutItem*) utarray_eltptr(&instance->timeout, idx);
-                uint64_t id = ti->idx;
-                if (ti->time + ti->milli <= curtime) {
-                    ti->callback(ti->arg);
-                    ti = (TimeoutItem*) utarray_eltptr(&instance->timeout, idx);
-                    /* faster remove */
-                    if (ti && ti->idx == id)
-                        utarray_remove_quick(&instance->timeout, idx);
-                    else {
-                        FcitxInstanceRemoveTimeoutById(instance, id);
-                        idx = 0;
-                    }
-                }
-                else {
-                    idx++;
-                }
-            }
+            FcitxEventLoopProcessTimeout(instance, curtime);
 
             if (instance->eventflag & FEF_UI_MOVE)
                 FcitxUIMoveInputWindowReal(instance);
@@ -375,40 +357,9 @@ void* RunInstance(void* arg)
             FcitxInstanceReloadAddon(instance);
         }
 
-        FD_ZERO(&instance->rfds);
-        FD_ZERO(&instance->wfds);
-        FD_ZERO(&instance->efds);
-
-        instance->maxfd = 0;
-        if (instance->fd > 0) {
-            instance->maxfd = instance->fd;
-            FD_SET(instance->fd, &instance->rfds);
-        }
-        for (pmodule = (FcitxAddon**) utarray_front(&instance->eventmodules);
-              pmodule != NULL;
-              pmodule = (FcitxAddon**) utarray_next(&instance->eventmodules, pmodule)) {
-            FcitxModule* module = (*pmodule)->module;
-            module->SetFD((*pmodule)->addonInstance);
-        }
-        if (instance->maxfd == 0)
+        /* ready fd of SetFD is left in fd_set for ProcessEvent */
+        if (!FcitxEventLoopWait(instance))
             break;
-        struct timeval tval;
-        struct timeval* ptval = NULL;
-        if (utarray_len(&instance->timeout) != 0) {
-            unsigned long int min_time = LONG_MAX;
-            TimeoutItem* ti;
-            for (ti = (TimeoutItem*)utarray_front(&instance->timeout);ti;
-                 ti = (TimeoutItem*)utarray_next(&instance->timeout, ti)) {
-                if (ti->time + ti->milli - curtime < min_time) {
-                    min_time = ti->time + ti->milli - curtime;
-                }
-            }
-            tval.tv_usec = (min_time % 1000) * 1000;
-            tval.tv_sec = min_time / 1000;
-            ptval = &tval;
-        }
-        select(instance->maxfd + 1, &instance->rfds, &instance->wfds,
-               &instance->efds, ptval);
     }
     if (instance->restart) {
         fcitx_utils_restart_in_place();
@@ -417,10 +368,12 @@ void* RunInstance(void* arg)
     return NULL;
 
 error_exit:
+    FcitxInstanceFinishAddonPreload(instance);
+    FcitxInstanceEnd(instance);
+    /* FcitxInstanceCreatePause is waiting for start up */
     if (instance->sem) {
-        sem_post(&instance->startUpSem);
+        sem_post(&instance->notifySem);
     }
-    FcitxInstanceEnd(instance);
     return NULL;
 }
 
@@ -518,11 +471,31 @@ void FcitxInstanceRealEnd(FcitxInstance* instance) {
             module->Destroy((*pmodule)->addonInstance);
     }
 
+    FcitxEventLoopDestroy(instance);
+
+    /* save files parsed after start up, e.g. lazy loaded input method */
+    FcitxConfigCacheSave();
+    FcitxConfigCacheClose();
+
     if (instance->sem) {
         sem_post(instance->sem);
     }
 }
 
+void FcitxInstanceProcessSignal(void* arg, int fd, unsigned int events)
+{
+    FcitxInstance* instance = (FcitxInstance*) arg;
+    uint8_t signo = 0;
+    while (read(fd, &signo, sizeof(char)) > 0) {
+        if (signo == SIGINT || signo == SIGTERM || signo == SIGQUIT || signo == SIGXCPU)
+            FcitxInstanceEnd(instance);
+        else if (signo == SIGHUP)
+            FcitxInstanceRestart(instance);
+        else if (signo == SIGUSR1)
+            FcitxInstanceReloadConfig(instance);
+    }
+}
+
 void FcitxInitThread(FcitxInstance* inst)
 {
     int rc;
@@ -734,74 +707,6 @@ void FcitxInstanceResetTryReplace(FcitxInstance* instance)
     instance->tryReplace = false;
 }
 
-FCITX_EXPORT_API
-uint64_t FcitxInstanceAddTimeout(FcitxInstance* instance, long int milli, FcitxTimeoutCallback callback , void* arg)
-{
-    if (milli < 0)
-        return 0;
-
-    struct timeval current_time;
-    gettimeofday(&current_time, NULL);
-    TimeoutItem item;
-    item.arg = arg;
-    item.callback =callback;
-    item.milli = milli;
-    item.idx = ++instance->timeoutIdx;
-    item.time = (current_time.tv_sec * 1000LL) + (current_time.tv_usec / 1000LL);
-    utarray_push_back(&instance->timeout, &item);
-
-    return item.idx;
-}
-
-FCITX_EXPORT_API
-boolean FcitxInstanceCheckTimeoutByFunc(FcitxInstance* instance, FcitxTimeoutCallback callback)
-{
-    utarray_foreach(ti, &instance->timeout, TimeoutItem) {
-        if (ti->callback == callback)
-            return true;
-    }
-    return false;
-}
-
-FCITX_EXPORT_API
-boolean FcitxInstanceCheckTimeoutById(FcitxInstance *instance, uint64_t id)
-{
-    utarray_foreach(ti, &instance->timeout, TimeoutItem) {
-        if (ti->idx == id)
-            return true;
-    }
-    return false;
-}
-
-FCITX_EXPORT_API boolean
-FcitxInstanceRemoveTimeoutByFunc(FcitxInstance* instance,
-                                 FcitxTimeoutCallback callback)
-{
-    utarray_foreach(ti, &instance->timeout, TimeoutItem) {
-        if (ti->callback == callback) {
-            unsigned int idx = utarray_eltidx(&instance->timeout, ti);
-            utarray_remove_quick(&instance->timeout, idx);
-            return true;
-        }
-    }
-    return false;
-}
-
-FCITX_EXPORT_API
-boolean FcitxInstanceRemoveTimeoutById(FcitxInstance* instance, uint64_t id)
-{
-    if (id == 0)
-        return false;
-    utarray_foreach(ti, &instance->timeout, TimeoutItem) {
-        if (ti->idx == id) {
-            unsigned int idx = utarray_eltidx(&instance->timeout, ti);
-            utarray_remove_quick(&instance->timeout, idx);
-            return true;
-        }
-    }
-    return false;
-}
-
 FCITX_EXPORT_API
 int FcitxInstanceWaitForEnd(FcitxInstance* instance) {
     return pthread_join(instance->pid, NULL);
@@ -49,6 +49,25 @@ extern "C" {
 
     typedef void (*FcitxTimeoutCallback)(void* arg);
 
+    /**
+     * events of a file descriptor watched by main loop
+     **/
+    typedef enum _FcitxIOEventFlag {
+        FCITX_IO_READ = (1 << 0),
+        FCITX_IO_WRITE = (1 << 1),
+        FCITX_IO_EXCEPT = (1 << 2),
+        FCITX_IO_ERROR = (1 << 3) /**< only reported, hang up or error */
+    } FcitxIOEventFlag;
+
+    /**
+     * callback of a file descriptor watch
+     *
+     * @param arg argument passed to FcitxInstanceAddIOWatch
+     * @param fd file descriptor
+     * @param events ready events, FcitxIOEventFlag
+     **/
+    typedef void (*FcitxIOCallback)(void* arg, int fd, unsigned int events);
+
     /**
      * create new fcitx instance
      *
@@ -257,6 +276,44 @@ extern "C" {
      **/
     boolean FcitxInstanceRemoveTimeoutById(FcitxInstance* instance, uint64_t id);
 
+    /**
+     * watch a file descriptor in main loop, the watch stays until it is removed,
+     * so module doesn't need to set fd_set in every loop
+     *
+     * @param instance fcitx instance
+     * @param fd file descriptor, can only be watched once
+     * @param events events to watch, FcitxIOEventFlag
+     * @param callback callback function
+     * @param arg argument
+     * @return watch id, 0 for failure
+     *
+     * @since 4.2.9.7
+     **/
+    uint64_t FcitxInstanceAddIOWatch(FcitxInstance* instance, int fd, unsigned int events, FcitxIOCallback callback, void* arg);
+
+    /**
+     * change the events of an io watch
+     *
+     * @param instance fcitx instance
+     * @param id watch id
+     * @param events events to watch, FcitxIOEventFlag
+     * @return boolean
+     *
+     * @since 4.2.9.7
+     **/
+    boolean FcitxInstanceUpdateIOWatch(FcitxInstance* instance, uint64_t id, unsigned int events);
+
+    /**
+     * remove an io watch, it's safe to call it inside the callback
+     *
+     * @param instance fcitx instance
+     * @param id watch id
+     * @return true if there is a watch removed
+     *
+     * @since 4.2.9.7
+     **/
+    boolean FcitxInstanceRemoveIOWatch(FcitxInstance* instance, uint64_t id);
+
     /**
      * wait for instance to end, it simple join with a started fcitx thread
      *
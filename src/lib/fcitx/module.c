@@ -45,54 +45,62 @@ void FcitxModuleLoad(FcitxInstance* instance)
     for (addon = (FcitxAddon *) utarray_front(addons);
             addon != NULL;
             addon = (FcitxAddon *) utarray_next(addons, addon)) {
-        if (addon->bEnabled && addon->category == AC_MODULE) {
-            char *modulePath;
-            switch (addon->type) {
-            case AT_SHAREDLIBRARY: {
-                FILE *fp = FcitxXDGGetLibFile(addon->library, "r", &modulePath);
-                void *handle;
-                FcitxModule* module;
-                void* moduleinstance = NULL;
-                if (!fp)
-                    break;
-                fclose(fp);
-                handle = dlopen(modulePath, RTLD_NOW | RTLD_NODELETE | (addon->loadLocal ? RTLD_LOCAL : RTLD_GLOBAL));
-                if (!handle) {
-                    FcitxLog(ERROR, _("Module: open %s fail %s") , modulePath , dlerror());
-                    break;
-                }
-
-                if (!FcitxCheckABIVersion(handle, addon->name)) {
-                    FcitxLog(ERROR, "%s ABI Version Error", addon->name);
-                    dlclose(handle);
-                    break;
-                }
-
-                module = FcitxGetSymbol(handle, addon->name, "module");
-                if (!module || !module->Create) {
-                    FcitxLog(ERROR, _("Module: bad module"));
-                    dlclose(handle);
-                    break;
-                }
-                if ((moduleinstance = module->Create(instance)) == NULL) {
-                    dlclose(handle);
-                    break;
-                }
-                if (instance->loadingFatalError)
-                    return;
-                addon->module = module;
-                addon->addonInstance = moduleinstance;
-                if (module->ProcessEvent && module->SetFD)
-                    utarray_push_back(&instance->eventmodules, &addon);
-                utarray_push_back(&instance->modules, &addon);
-            }
+        /* on demand module is loaded by FcitxModuleFindFunction */
+        if (addon->bEnabled && addon->category == AC_MODULE && !addon->onDemand) {
+            FcitxModuleLoadAddon(instance, addon);
+            if (instance->loadingFatalError)
+                return;
+        }
+    }
+}
+
+void FcitxModuleLoadAddon(FcitxInstance* instance, FcitxAddon* addon)
+{
+    char *modulePath = NULL;
+    switch (addon->type) {
+    case AT_SHAREDLIBRARY: {
+        FILE *fp = FcitxXDGGetLibFile(addon->library, "r", &modulePath);
+        void *handle;
+        FcitxModule* module;
+        void* moduleinstance = NULL;
+        if (!fp)
+            break;
+        fclose(fp);
+        handle = dlopen(modulePath, RTLD_NOW | RTLD_NODELETE | (addon->loadLocal ? RTLD_LOCAL : RTLD_GLOBAL));
+        if (!handle) {
+            FcitxLog(ERROR, _("Module: open %s fail %s") , modulePath , dlerror());
+            break;
+        }
+
+        if (!FcitxCheckABIVersion(handle, addon->name)) {
+            FcitxLog(ERROR, "%s ABI Version Error", addon->name);
+            dlclose(handle);
+            break;
+        }
+
+        module = FcitxGetSymbol(handle, addon->name, "module");
+        if (!module || !module->Create) {
+            FcitxLog(ERROR, _("Module: bad module"));
+            dlclose(handle);
+            break;
+        }
+        if ((moduleinstance = module->Create(instance)) == NULL) {
+            dlclose(handle);
             break;
-            default:
-                break;
-            }
-            free(modulePath);
         }
+        if (instance->loadingFatalError)
+            break;
+        addon->module = module;
+        addon->addonInstance = moduleinstance;
+        if (module->ProcessEvent && module->SetFD)
+            utarray_push_back(&instance->eventmodules, &addon);
+        utarray_push_back(&instance->modules, &addon);
+    }
+    break;
+    default:
+        break;
     }
+    free(modulePath);
 }
 
 FCITX_EXPORT_API
@@ -123,6 +131,17 @@ FcitxModuleFindFunction(FcitxAddon *addon, int func_id)
             FcitxInstanceUpdateIMList(addon->owner);
         }
     }
+    else if (addon->category == AC_MODULE && addon->onDemand) {
+        /* clear the flag first, Create may look up its own function */
+        addon->onDemand = false;
+        if (addon->bEnabled && !addon->addonInstance) {
+            FcitxModuleLoadAddon(addon->owner, addon);
+            if (!addon->addonInstance) {
+                FcitxLog(WARNING, _("Disable addon %s, failed to load on demand."), addon->name);
+                addon->bEnabled = false;
+            }
+        }
+    }
     FcitxModuleFunction *func_p = fcitx_array_eltptr(&addon->functionList,
                                                      func_id);
     if (func_p)
@@ -999,10 +999,13 @@ void FcitxUIUpdateInputWindowReal(FcitxInstance *instance)
         || FcitxMessagesGetMessageCount(input->msgAuxDown) != 0)
         toshow = true;
 
-    if (FcitxCandidateWordGetListSize(input->candList) > 1)
+    /* only need to know whether there is more than one */
+    FcitxCandidateWordFetch(input->candList, 2);
+    unsigned int candCount = utarray_len(&input->candList->candWords);
+    if (candCount > 1)
         toshow = true;
 
-    if (FcitxCandidateWordGetListSize(input->candList) == 1
+    if (candCount == 1
             && (!instance->config->bHideInputWindowWhenOnlyPreeditString
                 || !instance->config->bHideInputWindowWhenOnlyOneCandidate))
         toshow = true;
@@ -312,7 +312,7 @@ AutoEngCheckSelect(FcitxAutoEngState *autoEngState,
     FcitxInstance *instance = autoEngState->owner;
     FcitxCandidateWordList *cand_list = FcitxInputStateGetCandidateList(
         FcitxInstanceGetInputState(autoEngState->owner));
-    if (!FcitxCandidateWordGetListSize(cand_list))
+    if (FcitxCandidateWordIsEmpty(cand_list))
         return IRV_TO_PROCESS;
     FcitxInputState *input = FcitxInstanceGetInputState(instance);
     FcitxGlobalConfig *fc = FcitxInstanceGetGlobalConfig(instance);
@@ -282,7 +282,7 @@ boolean ProcessPunc(void* arg, FcitxKeySym sym, unsigned int state, INPUT_RETURN
         return false;
 
     FcitxCandidateWordList *candList = FcitxInputStateGetCandidateList(input);
-    if (FcitxCandidateWordGetListSize(candList) != 0) {
+    if (!FcitxCandidateWordIsEmpty(candList)) {
         if (FcitxCandidateWordGetHasGoneToNextPage(candList) &&
             FcitxHotkeyIsHotKey(sym, state,
                                 FcitxConfigPrevPageKey(instance, config))) {
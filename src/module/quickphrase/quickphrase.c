@@ -661,19 +661,20 @@ INPUT_RETURN_VALUE QuickPhraseGetCandWords(QuickPhraseState* qpstate)
              currentQuickPhrase = (QUICK_PHRASE*)utarray_next(qpstate->quickPhrases, currentQuickPhrase)) {
             if (!strncmp(qpstate->buffer, currentQuickPhrase->strCode,
                          iInputLen)) {
-                QuickPhraseCand *qpcand = fcitx_utils_new(QuickPhraseCand);
+                QuickPhraseCand *qpcand = FcitxCandidateWordArenaAlloc(candList, sizeof(QuickPhraseCand));
                 qpcand->cand = currentQuickPhrase;
                 FcitxCandidateWord candWord;
                 candWord.callback = QuickPhraseGetCandWord;
                 candWord.owner = qpstate;
                 candWord.priv = qpcand;
-                fcitx_utils_alloc_cat_str(candWord.strExtra, " ",
-                                          currentQuickPhrase->strCode +
-                                          iInputLen);
-                candWord.strWord = strdup(currentQuickPhrase->strPhrase);
+                const char *restCode = currentQuickPhrase->strCode + iInputLen;
+                candWord.strExtra = FcitxCandidateWordArenaAlloc(candList, strlen(restCode) + 2);
+                candWord.strExtra[0] = ' ';
+                strcpy(candWord.strExtra + 1, restCode);
+                candWord.strWord = FcitxCandidateWordArenaStrdup(candList, currentQuickPhrase->strPhrase);
                 candWord.wordType = MSG_OTHER;
                 candWord.extraType = MSG_CODE;
-                FcitxCandidateWordAppend(FcitxInputStateGetCandidateList(input), &candWord);
+                FcitxCandidateWordAppendWithFlags(candList, &candWord, CWF_Arena);
             }
         }
     } while(0);
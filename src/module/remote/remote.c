@@ -40,15 +40,14 @@
 #define MAX_IMNAME_LEN 30
 
 static void* RemoteCreate(FcitxInstance* instance);
-static void RemoteProcessEvent(void* arg);
-static void RemoteSetFD(void* arg);
+static void RemoteProcessEvent(void* arg, int fd, unsigned int events);
 static void RemoteDestroy(void* arg);
 static int CreateSocket(const char *name);
 
 FCITX_DEFINE_PLUGIN(fcitx_remote, module, FcitxModule) = {
     RemoteCreate,
-    RemoteSetFD,
-    RemoteProcessEvent,
+    NULL,
+    NULL,
     RemoteDestroy,
     NULL
 };
@@ -56,6 +55,7 @@ FCITX_DEFINE_PLUGIN(fcitx_remote, module, FcitxModule) = {
 typedef struct _FcitxRemote {
     FcitxInstance* owner;
     int socket_fd;
+    uint64_t watch;
 } FcitxRemote;
 
 void* RemoteCreate(FcitxInstance* instance)
@@ -77,6 +77,9 @@ void* RemoteCreate(FcitxInstance* instance)
     fcntl(remote->socket_fd, F_SETFL, O_NONBLOCK);
     chmod(socketfile, 0600);
     free(socketfile);
+    remote->watch = FcitxInstanceAddIOWatch(instance, remote->socket_fd,
+                                            FCITX_IO_READ, RemoteProcessEvent,
+                                            remote);
     return remote;
 }
 
@@ -144,7 +147,7 @@ static void SendIMState(FcitxRemote* remote, int fd)
     write(fd, &r, sizeof(r));
 }
 
-static void RemoteProcessEvent(void* p)
+static void RemoteProcessEvent(void* p, int fd, unsigned int events)
 {
     FcitxRemote* remote = (FcitxRemote*) p;
     unsigned int O;
@@ -188,17 +191,10 @@ static void RemoteProcessEvent(void* p)
     close(client_fd);
 }
 
-void RemoteSetFD(void* arg)
-{
-    FcitxRemote* remote = (FcitxRemote*) arg;
-    FD_SET(remote->socket_fd, FcitxInstanceGetReadFDSet(remote->owner));
-    if (FcitxInstanceGetMaxFD(remote->owner) < remote->socket_fd)
-        FcitxInstanceSetMaxFD(remote->owner, remote->socket_fd);
-}
-
 void RemoteDestroy(void* arg)
 {
     FcitxRemote* remote = (FcitxRemote*) arg;
+    FcitxInstanceRemoveIOWatch(remote->owner, remote->watch);
     close(remote->socket_fd);
     free(remote);
 }
@@ -758,14 +758,14 @@ DBusHandlerResult KimpanelDBusFilter(DBusConnection* connection, DBusMessage* ms
         return DBUS_HANDLER_RESULT_HANDLED;
     } else if (dbus_message_is_signal(msg, "org.kde.impanel", "LookupTablePageUp")) {
         FcitxLog(DEBUG, "LookupTablePageUp");
-        if (FcitxCandidateWordPageCount(FcitxInputStateGetCandidateList(input)) != 0) {
+        if (!FcitxCandidateWordIsEmpty(FcitxInputStateGetCandidateList(input))) {
             FcitxCandidateWordGoPrevPage(FcitxInputStateGetCandidateList(input));
             FcitxInstanceProcessInputReturnValue(instance, IRV_DISPLAY_CANDWORDS);
         }
         return DBUS_HANDLER_RESULT_HANDLED;
     } else if (dbus_message_is_signal(msg, "org.kde.impanel", "LookupTablePageDown")) {
         FcitxLog(DEBUG, "LookupTablePageDown");
-        if (FcitxCandidateWordPageCount(FcitxInputStateGetCandidateList(input)) != 0) {
+        if (!FcitxCandidateWordIsEmpty(FcitxInputStateGetCandidateList(input))) {
             FcitxCandidateWordGoNextPage(FcitxInputStateGetCandidateList(input));
             FcitxInstanceProcessInputReturnValue(instance, IRV_DISPLAY_CANDWORDS);
         }
@@ -0,0 +1,137 @@
+#include <string.h>
+
+#include <fcitx/fcitx.h>
+#include <fcitx/frontend.h>
+#include <fcitx/instance.h>
+#include <fcitx/ui.h>
+#include <fcitx-utils/utils.h>
+
+#include "benchkey.h"
+
+/*
+ * Frontend and user interface that talk to nobody, so benchkey can run an
+ * instance without X or DBus. One library provides both addons.
+ */
+
+static void* BenchFrontendCreate(FcitxInstance* instance, int frontendid);
+static boolean BenchFrontendDestroy(void* arg);
+static void BenchFrontendCreateIC(void* arg, FcitxInputContext* context, void* priv);
+static boolean BenchFrontendCheckIC(void* arg, FcitxInputContext* context, void* priv);
+static void BenchFrontendDestroyIC(void* arg, FcitxInputContext* context);
+static void BenchFrontendEnableIM(void* arg, FcitxInputContext* ic);
+static void BenchFrontendCloseIM(void* arg, FcitxInputContext* ic);
+static void BenchFrontendCommitString(void* arg, FcitxInputContext* ic, const char* str);
+static void BenchFrontendForwardKey(void* arg, FcitxInputContext* ic, FcitxKeyEventType event, FcitxKeySym sym, unsigned int state);
+static void BenchFrontendSetWindowOffset(void* arg, FcitxInputContext* ic, int x, int y);
+static void BenchFrontendGetWindowRect(void* arg, FcitxInputContext* ic, int* x, int* y, int* w, int* h);
+static void BenchFrontendUpdatePreedit(void* arg, FcitxInputContext* ic);
+static boolean BenchFrontendCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, FcitxInputContext* ic);
+static pid_t BenchFrontendGetPid(void* arg, FcitxInputContext* ic);
+
+static void* BenchUICreate(FcitxInstance* instance);
+
+/* callbacks left out are optional */
+FCITX_DEFINE_PLUGIN(fcitx_bench_frontend, frontend, FcitxFrontend) = {
+    .Create = BenchFrontendCreate,
+    .Destroy = BenchFrontendDestroy,
+    .CreateIC = BenchFrontendCreateIC,
+    .CheckIC = BenchFrontendCheckIC,
+    .DestroyIC = BenchFrontendDestroyIC,
+    .EnableIM = BenchFrontendEnableIM,
+    .CloseIM = BenchFrontendCloseIM,
+    .CommitString = BenchFrontendCommitString,
+    .ForwardKey = BenchFrontendForwardKey,
+    .SetWindowOffset = BenchFrontendSetWindowOffset,
+    .GetWindowRect = BenchFrontendGetWindowRect,
+    .UpdatePreedit = BenchFrontendUpdatePreedit,
+    .CheckICFromSameApplication = BenchFrontendCheckICFromSameApplication,
+    .GetPid = BenchFrontendGetPid,
+};
+
+/* every callback of ui is optional */
+FCITX_DEFINE_PLUGIN(fcitx_bench_ui, ui, FcitxUI) = {
+    .Create = BenchUICreate,
+};
+
+void* BenchFrontendCreate(FcitxInstance* instance, int frontendid)
+{
+    FcitxBenchFrontend* bench = fcitx_utils_new(FcitxBenchFrontend);
+    bench->owner = instance;
+    bench->frontendid = frontendid;
+    return bench;
+}
+
+boolean BenchFrontendDestroy(void* arg)
+{
+    free(arg);
+    return true;
+}
+
+void BenchFrontendCreateIC(void* arg, FcitxInputContext* context, void* priv)
+{
+    context->privateic = priv;
+}
+
+boolean BenchFrontendCheckIC(void* arg, FcitxInputContext* context, void* priv)
+{
+    return context->privateic == priv;
+}
+
+void BenchFrontendDestroyIC(void* arg, FcitxInputContext* context)
+{
+}
+
+void BenchFrontendEnableIM(void* arg, FcitxInputContext* ic)
+{
+}
+
+void BenchFrontendCloseIM(void* arg, FcitxInputContext* ic)
+{
+}
+
+void BenchFrontendCommitString(void* arg, FcitxInputContext* ic, const char* str)
+{
+    FcitxBenchFrontend* bench = (FcitxBenchFrontend*) arg;
+    bench->iCommit++;
+    bench->iCommitLen += strlen(str);
+}
+
+void BenchFrontendForwardKey(void* arg, FcitxInputContext* ic, FcitxKeyEventType event, FcitxKeySym sym, unsigned int state)
+{
+    FcitxBenchFrontend* bench = (FcitxBenchFrontend*) arg;
+    if (event == FCITX_PRESS_KEY)
+        bench->iForward++;
+}
+
+void BenchFrontendSetWindowOffset(void* arg, FcitxInputContext* ic, int x, int y)
+{
+    ic->offset_x = x;
+    ic->offset_y = y;
+}
+
+void BenchFrontendGetWindowRect(void* arg, FcitxInputContext* ic, int* x, int* y, int* w, int* h)
+{
+    *x = ic->offset_x;
+    *y = ic->offset_y;
+    *w = 0;
+    *h = 0;
+}
+
+void BenchFrontendUpdatePreedit(void* arg, FcitxInputContext* ic)
+{
+}
+
+boolean BenchFrontendCheckICFromSameApplication(void* arg, FcitxInputContext* icToCheck, FcitxInputContext* ic)
+{
+    return true;
+}
+
+pid_t BenchFrontendGetPid(void* arg, FcitxInputContext* ic)
+{
+    return 0;
+}
+
+void* BenchUICreate(FcitxInstance* instance)
+{
+    return instance;
+}
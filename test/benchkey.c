@@ -0,0 +1,424 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <ftw.h>
+#include <time.h>
+#include <semaphore.h>
+
+#include "config.h"
+#include <fcitx/fcitx.h>
+#include <fcitx/addon.h>
+#include <fcitx/candidate.h>
+#include <fcitx/frontend.h>
+#include <fcitx/ime.h>
+#include <fcitx/instance.h>
+#include <fcitx-config/hotkey.h>
+#include <fcitx-config/xdg.h>
+#include <fcitx-utils/utarray.h>
+#include <fcitx-utils/utils.h>
+
+#include "benchkey.h"
+
+/*
+ * Replay a keystroke corpus through FcitxInstanceProcessKey and report the
+ * latency of every key, so regressions of input methods can be measured
+ * without X or a real client.
+ *
+ * The instance runs with an empty configuration directory and only the
+ * addons it is told to load, the input methods and their data are the
+ * installed ones (FCITXDIR selects another prefix).
+ */
+
+#define BENCH_DEFAULT_ADDONS "fcitx-pinyin,fcitx-table,fcitx-punc,fcitx-keyboard"
+
+typedef struct _BenchKey {
+    FcitxKeySym sym;
+    unsigned int state;
+} BenchKey;
+
+static const UT_icd bench_key_icd = {sizeof(BenchKey), NULL, NULL, NULL};
+
+typedef struct _BenchSample {
+    uint64_t iTime;
+    int32_t iAlloc;
+    int iWindow;
+    int iTotal;
+} BenchSample;
+
+static const UT_icd bench_sample_icd = {sizeof(BenchSample), NULL, NULL, NULL};
+
+/*
+ * count allocations by taking over malloc, it is exported so that fcitx
+ * libraries and addons also call it.
+ */
+#ifdef __GLIBC__
+#define BENCH_COUNT_ALLOC 1
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static volatile int32_t iAllocCount = 0;
+
+FCITX_EXPORT_API void *malloc(size_t size)
+{
+    fcitx_utils_atomic_add(&iAllocCount, 1);
+    return __libc_malloc(size);
+}
+
+FCITX_EXPORT_API void *calloc(size_t nmemb, size_t size)
+{
+    fcitx_utils_atomic_add(&iAllocCount, 1);
+    return __libc_calloc(nmemb, size);
+}
+
+FCITX_EXPORT_API void *realloc(void *ptr, size_t size)
+{
+    fcitx_utils_atomic_add(&iAllocCount, 1);
+    return __libc_realloc(ptr, size);
+}
+#else
+static volatile int32_t iAllocCount = 0;
+#endif
+
+static void usage();
+
+static uint64_t BenchNow()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Every line is typed into an empty input, printable ascii characters stand
+ * for themselves, other keys are written as <KEY> in the same format as the
+ * hotkeys in config files, e.g. <SPACE>, <BACKSPACE>, <CTRL_ENTER>, and <<>
+ * for '<' itself. Empty lines and lines begin with '#' are ignored.
+ */
+static boolean BenchLoadCorpus(const char* path, UT_array* keys)
+{
+    FILE* fp = fopen(path, "r");
+    char* buf = NULL;
+    size_t bufsize = 0;
+    int lineno = 0;
+    boolean result = true;
+
+    if (!fp) {
+        fprintf(stderr, "Can't open corpus %s.\n", path);
+        return false;
+    }
+
+    while (result && getline(&buf, &bufsize, fp) != -1) {
+        char* p = buf;
+        lineno++;
+        p[strcspn(p, "\r\n")] = '\0';
+        if (p[0] == '#' || p[0] == '\0')
+            continue;
+
+        while (*p) {
+            BenchKey key;
+            if (*p == '<') {
+                char* end = p[1] ? strchr(p + 2, '>') : NULL;
+                if (!end) {
+                    result = false;
+                    break;
+                }
+                *end = '\0';
+                if (!FcitxHotkeyParseKey(p + 1, &key.sym, &key.state)) {
+                    result = false;
+                    break;
+                }
+                p = end + 1;
+            } else if (*p >= 0x20 && *p < 0x7f) {
+                key.sym = *p;
+                key.state = (*p >= 'A' && *p <= 'Z') ? FcitxKeyState_Shift : 0;
+                p++;
+            } else {
+                result = false;
+                break;
+            }
+            utarray_push_back(keys, &key);
+        }
+
+        /* FcitxKey_None resets the input */
+        BenchKey reset = {FcitxKey_None, 0};
+        utarray_push_back(keys, &reset);
+    }
+
+    if (!result)
+        fprintf(stderr, "%s:%d: bad key.\n", path, lineno);
+    else if (utarray_len(keys) == 0) {
+        fprintf(stderr, "%s: no key.\n", path);
+        result = false;
+    }
+
+    free(buf);
+    fclose(fp);
+    return result;
+}
+
+static boolean BenchWriteAddonConf(const char* dir, const char* name,
+                                   const char* category)
+{
+    char* path;
+    asprintf(&path, "%s/" PACKAGE "/addon/%s.conf", dir, name);
+    FILE* fp = fopen(path, "w");
+    free(path);
+    if (!fp)
+        return false;
+    fprintf(fp,
+            "[Addon]\n"
+            "Name=%s\n"
+            "Category=%s\n"
+            "Enabled=True\n"
+            "Library=%s\n"
+            "Type=SharedLibrary\n",
+            name, category, BENCH_FRONTEND_LIBRARY);
+    fclose(fp);
+    return true;
+}
+
+/* enable only the input method to test whatever the language is */
+static boolean BenchWriteProfile(const char* dir, const char* imname)
+{
+    char* path;
+    asprintf(&path, "%s/" PACKAGE "/profile", dir);
+    FILE* fp = fopen(path, "w");
+    free(path);
+    if (!fp)
+        return false;
+    fprintf(fp,
+            "[Profile]\n"
+            "IMName=%s\n"
+            "EnabledIMList=%s:True\n",
+            imname, imname);
+    fclose(fp);
+    return true;
+}
+
+static int BenchRemoveFile(const char* path, const struct stat* sb,
+                           int flag, struct FTW* ftw)
+{
+    remove(path);
+    return 0;
+}
+
+static void BenchReplay(FcitxInstance* instance, UT_array* keys,
+                        UT_array* samples)
+{
+    FcitxInputState* input = FcitxInstanceGetInputState(instance);
+    BenchKey* key;
+    for (key = (BenchKey*) utarray_front(keys);
+         key != NULL;
+         key = (BenchKey*) utarray_next(keys, key)) {
+        if (key->sym == FcitxKey_None) {
+            FcitxInstanceResetInput(instance);
+            FcitxInstanceCleanInputWindow(instance);
+            continue;
+        }
+
+        BenchSample sample;
+        int32_t iAlloc = iAllocCount;
+        uint64_t start = BenchNow();
+        FcitxInstanceProcessKey(instance, FCITX_PRESS_KEY, 0, key->sym, key->state);
+        FcitxInstanceProcessKey(instance, FCITX_RELEASE_KEY, 0, key->sym, key->state);
+        /* what a user interface would show */
+        sample.iWindow = FcitxCandidateWordGetCurrentWindowSize(FcitxInputStateGetCandidateList(input));
+        sample.iTime = BenchNow() - start;
+        sample.iAlloc = iAllocCount - iAlloc;
+        sample.iTotal = FcitxCandidateWordGetListSize(FcitxInputStateGetCandidateList(input));
+        if (samples)
+            utarray_push_back(samples, &sample);
+    }
+    FcitxInstanceResetInput(instance);
+    FcitxInstanceCleanInputWindow(instance);
+}
+
+static int BenchSampleCmp(const void* a, const void* b)
+{
+    uint64_t ta = ((const BenchSample*) a)->iTime;
+    uint64_t tb = ((const BenchSample*) b)->iTime;
+    return ta < tb ? -1 : (ta > tb ? 1 : 0);
+}
+
+static void BenchReport(const char* imname, UT_array* samples, int rounds,
+                        FcitxBenchFrontend* bench)
+{
+    unsigned int n = utarray_len(samples);
+    uint64_t totalTime = 0, totalAlloc = 0, totalWindow = 0, totalCand = 0;
+    int maxCand = 0;
+    BenchSample* sample;
+
+    for (sample = (BenchSample*) utarray_front(samples);
+         sample != NULL;
+         sample = (BenchSample*) utarray_next(samples, sample)) {
+        totalTime += sample->iTime;
+        totalAlloc += sample->iAlloc;
+        totalWindow += sample->iWindow;
+        totalCand += sample->iTotal;
+        if (sample->iTotal > maxCand)
+            maxCand = sample->iTotal;
+    }
+    utarray_sort(samples, BenchSampleCmp);
+
+#define BENCH_PERCENTILE(p) \
+    (((BenchSample*) utarray_eltptr(samples, (n - 1) * (p) / 100))->iTime / 1000.0)
+
+    printf("input method: %s\n", imname);
+    printf("keys:         %u (%d rounds)\n", n, rounds);
+    printf("latency (us): p50 %.1f  p99 %.1f  max %.1f  mean %.1f\n",
+           BENCH_PERCENTILE(50), BENCH_PERCENTILE(99), BENCH_PERCENTILE(100),
+           totalTime / 1000.0 / n);
+#undef BENCH_PERCENTILE
+#ifdef BENCH_COUNT_ALLOC
+    printf("allocations:  %.2f per key\n", (double) totalAlloc / n);
+#else
+    printf("allocations:  not available\n");
+#endif
+    printf("candidates:   %.2f shown, %.2f total per key, max %d\n",
+           (double) totalWindow / n, (double) totalCand / n, maxCand);
+    printf("commits:      %d (%lu bytes), forwarded keys: %d\n",
+           bench->iCommit, (unsigned long) bench->iCommitLen, bench->iForward);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* imname = "pinyin";
+    const char* addons = BENCH_DEFAULT_ADDONS;
+    int rounds = 1, warmup = 1;
+    int c, i;
+
+    while ((c = getopt(argc, argv, "i:a:n:w:h")) != -1) {
+        switch (c) {
+        case 'i':
+            imname = optarg;
+            break;
+        case 'a':
+            addons = optarg;
+            break;
+        case 'n':
+            rounds = atoi(optarg);
+            break;
+        case 'w':
+            warmup = atoi(optarg);
+            break;
+        case 'h':
+        default:
+            usage();
+        }
+    }
+
+    if (optind >= argc || rounds <= 0 || warmup < 0)
+        usage();
+
+    UT_array keys;
+    utarray_init(&keys, &bench_key_icd);
+    if (!BenchLoadCorpus(argv[optind], &keys))
+        return 1;
+
+    char confdir[] = "/tmp/fcitx-benchkey-XXXXXX";
+    if (!mkdtemp(confdir)) {
+        fprintf(stderr, "Can't create config directory.\n");
+        return 1;
+    }
+    setenv("XDG_CONFIG_HOME", confdir, 1);
+    FcitxXDGMakeDirUser("addon");
+    if (!BenchWriteAddonConf(confdir, BENCH_FRONTEND_NAME, "Frontend")
+        || !BenchWriteAddonConf(confdir, BENCH_UI_NAME, "UI")
+        || !BenchWriteProfile(confdir, imname)) {
+        fprintf(stderr, "Can't write config.\n");
+        return 1;
+    }
+
+    char* enable;
+    fcitx_utils_alloc_cat_str(enable, BENCH_FRONTEND_NAME "," BENCH_UI_NAME ",", addons);
+    char* fcitxArgv[] = {
+        argv[0], "-D", "-s", "0", "-u", BENCH_UI_NAME,
+        "--disable", "all", "--enable", enable, NULL
+    };
+
+    /* the instance parses its own arguments with getopt */
+    optind = 1;
+
+    /*
+     * Without event modules and fd the main loop of the instance ends after
+     * start up, so all keys below are processed in this thread.
+     * sem is posted if the instance fails to load.
+     */
+    sem_t sem;
+    sem_init(&sem, 0, 0);
+    FcitxInstance* instance = FcitxInstanceCreatePause(&sem, sizeof(fcitxArgv) / sizeof(fcitxArgv[0]) - 1, fcitxArgv, -1);
+    int result = 1;
+    do {
+        if (!instance || sem_trywait(&sem) == 0) {
+            fprintf(stderr, "Failed to start fcitx.\n");
+            break;
+        }
+        FcitxInstanceStart(instance);
+        FcitxInstanceWaitForEnd(instance);
+
+        FcitxAddon* addon = FcitxAddonsGetAddonByName(FcitxInstanceGetAddons(instance),
+                                                      BENCH_FRONTEND_NAME);
+        if (!addon || !addon->addonInstance) {
+            fprintf(stderr, "Failed to load frontend.\n");
+            break;
+        }
+        FcitxBenchFrontend* bench = addon->addonInstance;
+
+        FcitxInputContext* ic = FcitxInstanceCreateIC(instance, bench->frontendid, bench);
+        FcitxInstanceSetCurrentIC(instance, ic);
+        FcitxUIOnInputFocus(instance);
+        FcitxInstanceEnableIM(instance, ic, false);
+        FcitxIM* im = FcitxInstanceGetCurrentIM(instance);
+        if (!im || strcmp(im->uniqueName, imname) != 0) {
+            fprintf(stderr, "Input method %s is not available.\n", imname);
+            break;
+        }
+
+        for (i = 0; i < warmup; i++)
+            BenchReplay(instance, &keys, NULL);
+        bench->iCommit = 0;
+        bench->iCommitLen = 0;
+        bench->iForward = 0;
+
+        UT_array samples;
+        utarray_init(&samples, &bench_sample_icd);
+        for (i = 0; i < rounds; i++)
+            BenchReplay(instance, &keys, &samples);
+        BenchReport(imname, &samples, rounds, bench);
+        utarray_done(&samples);
+        result = 0;
+    } while(0);
+
+    nftw(confdir, BenchRemoveFile, 16, FTW_DEPTH | FTW_PHYS);
+    free(enable);
+    utarray_done(&keys);
+    return result;
+}
+
+void usage()
+{
+    puts(
+        "benchkey - replay keystrokes through fcitx input methods\n"
+        "\n"
+        "  usage: benchkey [OPTION] <corpus>\n"
+        "\n"
+        "  -i <im>      unique name of input method, defaults to pinyin\n"
+        "  -a <addons>  comma separated addons to load besides the dummy\n"
+        "               frontend and ui, defaults to\n"
+        "               " BENCH_DEFAULT_ADDONS "\n"
+        "  -n <rounds>  times to replay the corpus, defaults to 1\n"
+        "  -w <rounds>  times to replay before measuring, defaults to 1\n"
+        "  -h           display this help\n"
+        "\n"
+        "  Each line of corpus is typed into an empty input, keys other than\n"
+        "  printable ascii are written as <SPACE>, <BACKSPACE>, <CTRL_ENTER>..\n"
+        "  Addons that need an event loop, like fcitx-x11 or fcitx-dbus, can't\n"
+        "  be loaded.\n"
+    );
+    exit(1);
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 0;
@@ -0,0 +1,21 @@
+#ifndef BENCHKEY_H
+#define BENCHKEY_H
+
+#include <fcitx/instance.h>
+
+#define BENCH_FRONTEND_NAME "fcitx-bench-frontend"
+#define BENCH_UI_NAME "fcitx-bench-ui"
+
+/*
+ * addonInstance of the dummy frontend, benchkey reads it back through
+ * FcitxAddonsGetAddonByName to create its input context and count commits.
+ */
+typedef struct _FcitxBenchFrontend {
+    FcitxInstance* owner;
+    int frontendid;
+    int iCommit;
+    size_t iCommitLen;
+    int iForward;
+} FcitxBenchFrontend;
+
+#endif
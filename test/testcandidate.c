@@ -0,0 +1,213 @@
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+#include "fcitx/candidate.h"
+
+static const char* words[] = {"a", "bb", "ccc", "dddd", "eeeee", "ffffff"};
+
+static void fill(FcitxCandidateWordList* candList, int round)
+{
+    int i;
+    for (i = 0; i < 6; i++) {
+        FcitxCandidateWord candWord;
+        memset(&candWord, 0, sizeof(FcitxCandidateWord));
+        candWord.strWord = FcitxCandidateWordArenaStrdup(candList, words[i]);
+        candWord.strExtra = (char*) words[(i + round) % 6];
+        int* priv = FcitxCandidateWordArenaAlloc(candList, sizeof(int) * 3);
+        assert(((uintptr_t) priv) % sizeof(void*) == 0);
+        assert(priv[0] == 0 && priv[1] == 0 && priv[2] == 0);
+        priv[0] = i;
+        priv[2] = round;
+        candWord.priv = priv;
+        FcitxCandidateWordAppendWithFlags(candList, &candWord,
+                                          CWF_ArenaWord | CWF_BorrowedExtra |
+                                          CWF_ArenaPriv);
+    }
+}
+
+static void check(FcitxCandidateWordList* candList, int first, int round)
+{
+    int i;
+    for (i = 0; i < 6; i++) {
+        FcitxCandidateWord* candWord =
+            FcitxCandidateWordGetByTotalIndex(candList, first + i);
+        int* priv = candWord->priv;
+        assert(strcmp(candWord->strWord, words[i]) == 0);
+        assert(candWord->strExtra == words[(i + round) % 6]);
+        assert(priv[0] == i && priv[1] == 0 && priv[2] == round);
+    }
+}
+
+typedef struct {
+    int next;
+    int total;
+    int calls;
+} Generator;
+
+static boolean generate(void* arg, FcitxCandidateWordList* candList, int count)
+{
+    Generator* gen = arg;
+    gen->calls++;
+    while (count-- > 0 && gen->next < gen->total) {
+        FcitxCandidateWord candWord;
+        memset(&candWord, 0, sizeof(FcitxCandidateWord));
+        candWord.strWord = (char*) words[gen->next % 6];
+        candWord.priv = (void*)(intptr_t) gen->next;
+        FcitxCandidateWordAppendWithFlags(candList, &candWord,
+                                          CWF_BorrowedWord | CWF_BorrowedPriv);
+        gen->next++;
+    }
+    return gen->next < gen->total;
+}
+
+static int destroyed = 0;
+
+static void destroy(void* arg)
+{
+    destroyed++;
+}
+
+static void test_generator()
+{
+    FcitxCandidateWordList* candList = FcitxCandidateWordNewList();
+    Generator gen = {0, 1000, 0};
+    FcitxCandidateWordSetPageSize(candList, 5);
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+
+    /* only the first page and one more for HasNext */
+    assert(!FcitxCandidateWordIsEmpty(candList));
+    assert(FcitxCandidateWordGetCurrentWindowSize(candList) == 5);
+    assert(FcitxCandidateWordHasNext(candList));
+    assert(gen.next <= 6);
+    assert(FcitxCandidateWordGoNextPage(candList));
+    FcitxCandidateWord* candWord = FcitxCandidateWordGetCurrentWindow(candList);
+    assert((intptr_t) candWord->priv == 5);
+    assert(gen.next <= 11);
+    assert(FcitxCandidateWordGetByIndex(candList, 4)->priv == (void*) 9);
+
+    /* whole list is needed */
+    assert(FcitxCandidateWordPageCount(candList) == 200);
+    assert(gen.next == 1000 && destroyed == 1);
+    assert((intptr_t) FcitxCandidateWordGetLast(candList)->priv == 999);
+    FcitxCandidateWordReset(candList);
+
+    /* unsorted one is drained on first use */
+    gen.next = 0;
+    gen.total = 12;
+    FcitxCandidateWordSetGenerator(candList, generate, false, &gen, destroy);
+    assert(FcitxCandidateWordGetFirst(candList));
+    assert(gen.next == 12 && destroyed == 2);
+
+    /* appending goes after generated words, reset drops the generator */
+    FcitxCandidateWordReset(candList);
+    gen.next = 0;
+    gen.total = 8;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    FcitxCandidateWordSetPage(candList, 1);
+    assert(FcitxCandidateWordGetCurrentPage(candList) == 1);
+    assert(FcitxCandidateWordGetCurrentWindowSize(candList) == 3);
+    assert(!FcitxCandidateWordHasNext(candList));
+    FcitxCandidateWordReset(candList);
+    gen.next = 0;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    FcitxCandidateWord last;
+    memset(&last, 0, sizeof(FcitxCandidateWord));
+    last.strWord = strdup("last");
+    FcitxCandidateWordAppend(candList, &last);
+    assert(FcitxCandidateWordGetListSize(candList) == 9);
+    assert(strcmp(FcitxCandidateWordGetLast(candList)->strWord, "last") == 0);
+    gen.next = 0;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    FcitxCandidateWordReset(candList);
+    assert(destroyed == 5 && FcitxCandidateWordIsEmpty(candList));
+
+    /* walking the list pulls words, which may move the array */
+    gen.next = 0;
+    gen.total = 1000;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    intptr_t i = 0;
+    for (candWord = FcitxCandidateWordGetFirst(candList); candWord;
+         candWord = FcitxCandidateWordGetNext(candList, candWord))
+        assert((intptr_t) candWord->priv == i++);
+    assert(i == 1000);
+    FcitxCandidateWordReset(candList);
+
+    /* the rest of the page is pulled after the first word is taken */
+    gen.next = 0;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    FcitxCandidateWordSetPage(candList, 25);
+    i = 125;
+    for (candWord = FcitxCandidateWordGetByTotalIndex(candList, i); candWord;
+         candWord = FcitxCandidateWordGetCurrentWindowNext(candList, candWord))
+        assert((intptr_t) candWord->priv == i++);
+    assert(i == 130);
+    FcitxCandidateWordReset(candList);
+
+    gen.next = 0;
+    FcitxCandidateWordSetGenerator(candList, generate, true, &gen, destroy);
+    FcitxCandidateWordSetPage(candList, 25);
+    candWord = FcitxCandidateWordGetByTotalIndex(candList, 126);
+    candWord = FcitxCandidateWordGetCurrentWindowPrev(candList, candWord);
+    assert(candWord && (intptr_t) candWord->priv == 125);
+    assert(!FcitxCandidateWordGetCurrentWindowPrev(candList, candWord));
+    FcitxCandidateWordReset(candList);
+
+    FcitxCandidateWordFreeList(candList);
+}
+
+int main()
+{
+    FcitxCandidateWordList* candList = FcitxCandidateWordNewList();
+    FcitxCandidateWordList* newList = FcitxCandidateWordNewList();
+    FcitxCandidateWord candWord;
+    int round;
+
+    FcitxCandidateWordSetPageSize(candList, 4);
+    for (round = 0; round < 100; round++) {
+        FcitxCandidateWordReset(candList);
+
+        /* mix with malloc'ed one */
+        memset(&candWord, 0, sizeof(FcitxCandidateWord));
+        candWord.strWord = strdup("malloc");
+        FcitxCandidateWordAppend(candList, &candWord);
+
+        fill(candList, round);
+        check(candList, 1, round);
+
+        /* newList is reused right after merge */
+        fill(newList, round + 1);
+        FcitxCandidateWordMerge(candList, newList, 1);
+        assert(FcitxCandidateWordGetListSize(newList) == 0);
+        fill(newList, 0);
+        FcitxCandidateWordReset(newList);
+
+        assert(FcitxCandidateWordGetListSize(candList) == 13);
+        check(candList, 1, round + 1);
+        check(candList, 7, round);
+        assert(strcmp(FcitxCandidateWordGetLast(candList)->strWord, "malloc") != 0);
+        assert(strcmp(FcitxCandidateWordGetByTotalIndex(candList, 0)->strWord, "malloc") == 0);
+
+        /* window navigation works on entries */
+        int count = 0;
+        FcitxCandidateWord* word;
+        FcitxCandidateWordSetPage(candList, 1);
+        for (word = FcitxCandidateWordGetCurrentWindow(candList); word;
+             word = FcitxCandidateWordGetCurrentWindowNext(candList, word))
+            count++;
+        assert(count == 4);
+        assert(FcitxCandidateWordGetCurrentWindowSize(candList) == 4);
+        FcitxCandidateWordSetPage(candList, 3);
+        assert(FcitxCandidateWordGetCurrentWindowSize(candList) == 1);
+
+        FcitxCandidateWordInsertPlaceHolder(candList, 0);
+        assert(FcitxCandidateWordGetByTotalIndex(candList, 0)->strWord == NULL);
+        FcitxCandidateWordRemoveByIndex(candList, 0);
+    }
+
+    FcitxCandidateWordFreeList(newList);
+    FcitxCandidateWordFreeList(candList);
+
+    test_generator();
+
+    return 0;
+}
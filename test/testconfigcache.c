@@ -0,0 +1,162 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "fcitx-config/fcitx-config.h"
+#include "fcitx-utils/utils.h"
+
+static const char* iniA =
+    "# comment\n"
+    "[Group]\n"
+    "Name=A\n"
+    "Name[zh_CN]=B\n"
+    "Name=C\n"
+    "Broken[key=D\n"
+    "\n"
+    "[Other]\n"
+    "Empty=\n"
+    "[Group]\n"
+    "Merged=E\n";
+
+static const char* iniB =
+    "[Other]\n"
+    "Empty=F\n"
+    "Label[en]=G\n";
+
+static void WriteFile(const char* path, const char* content)
+{
+    FILE* fp = fopen(path, "w");
+    assert(fp);
+    fputs(content, fp);
+    fclose(fp);
+
+    /* cache doesn't trust file changed just now */
+    struct timeval tv[2];
+    gettimeofday(&tv[0], NULL);
+    tv[0].tv_sec -= 3600;
+    tv[1] = tv[0];
+    utimes(path, tv);
+}
+
+/* change a cached value, only a replayed cache can give it back */
+static void PatchCache(const char* path, const char* from, const char* to, size_t len)
+{
+    FILE* fp = fopen(path, "r+");
+    assert(fp);
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    char* data = malloc(size);
+    rewind(fp);
+    assert(fread(data, 1, size, fp) == (size_t) size);
+    char* hit = memmem(data, size, from, len);
+    assert(hit);
+    fseek(fp, hit - data, SEEK_SET);
+    fwrite(to, 1, len, fp);
+    fclose(fp);
+    free(data);
+}
+
+static char* Dump(FcitxConfigFile* cfile)
+{
+    char* result = strdup("");
+    HASH_FOREACH(group, cfile->groups, FcitxConfigGroup) {
+        char* tmp;
+        fcitx_utils_alloc_cat_str(tmp, result, "[", group->groupName, "]\n");
+        free(result);
+        result = tmp;
+        HASH_FOREACH(option, group->options, FcitxConfigOption) {
+            fcitx_utils_alloc_cat_str(tmp, result, option->optionName, "=",
+                                      option->rawValue, "\n");
+            free(result);
+            result = tmp;
+            HASH_FOREACH(subkey, option->subkey, FcitxConfigOptionSubkey) {
+                fcitx_utils_alloc_cat_str(tmp, result, option->optionName,
+                                          "{", subkey->subkeyName, "}=",
+                                          subkey->rawValue, "\n");
+                free(result);
+                result = tmp;
+            }
+        }
+    }
+    return result;
+}
+
+static char* ParseAndDump(const char* a, const char* b)
+{
+    FcitxConfigFile* cfile = FcitxConfigParseIni((char*) a, NULL);
+    assert(cfile);
+    cfile = FcitxConfigParseIni((char*) b, cfile);
+    char* result = Dump(cfile);
+    FcitxConfigFreeConfigFile(cfile);
+    return result;
+}
+
+int main()
+{
+    char dir[] = "/tmp/testconfigcacheXXXXXX";
+    assert(mkdtemp(dir));
+    char *a, *b, *cache;
+    fcitx_utils_alloc_cat_str(a, dir, "/a.conf");
+    fcitx_utils_alloc_cat_str(b, dir, "/b.conf");
+    fcitx_utils_alloc_cat_str(cache, dir, "/cache/configcache");
+    WriteFile(a, iniA);
+    WriteFile(b, iniB);
+
+    char* expect = ParseAndDump(a, b);
+
+    /* first run fills the cache */
+    FcitxConfigCacheOpen(cache);
+    char* result = ParseAndDump(a, b);
+    assert(strcmp(result, expect) == 0);
+    free(result);
+    assert(FcitxConfigCacheSave());
+    FcitxConfigCacheClose();
+    assert(access(cache, R_OK) == 0);
+
+    /* second run replays the cache */
+    FcitxConfigCacheOpen(cache);
+    result = ParseAndDump(a, b);
+    assert(strcmp(result, expect) == 0);
+    free(result);
+    FcitxConfigCacheClose();
+
+    /* the files are not read again when the cache is hit */
+    PatchCache(cache, "Merged\0E", "Merged\0X", sizeof("Merged\0E"));
+    FcitxConfigCacheOpen(cache);
+    result = ParseAndDump(a, b);
+    assert(strstr(result, "\nMerged=X\n") && !strstr(result, "Merged=E"));
+    free(result);
+
+    /* changed file is parsed again */
+    WriteFile(a, "[Group]\nName=Changed\n");
+    FcitxConfigFile* cfile = FcitxConfigParseIni(a, NULL);
+    FcitxConfigOption* option = FcitxConfigFileGetOption(cfile, "Group", "Name");
+    assert(option && strcmp(option->rawValue, "Changed") == 0);
+    FcitxConfigFreeConfigFile(cfile);
+    assert(FcitxConfigCacheSave());
+    FcitxConfigCacheClose();
+
+    /* broken cache is ignored */
+    WriteFile(a, iniA);
+    assert(truncate(cache, 100) == 0);
+    FcitxConfigCacheOpen(cache);
+    result = ParseAndDump(a, b);
+    assert(strcmp(result, expect) == 0);
+    free(result);
+    FcitxConfigCacheClose();
+
+    unlink(a);
+    unlink(b);
+    unlink(cache);
+    char* cachedir = strdup(cache);
+    *strrchr(cachedir, '/') = '\0';
+    rmdir(cachedir);
+    rmdir(dir);
+    free(cachedir);
+    free(expect);
+    free(a);
+    free(b);
+    free(cache);
+    return 0;
+}
@@ -1,9 +1,13 @@
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 #include <fcitx/fcitx.h>
 
 #include "pyParser.h"
 #include "pyconfig.h"
 #include "PYFA.h"
+#include "sp.h"
+#include "spdata.h"
 
 
 void PrintParsedPY(ParsePYStruct *parse, const char *expect)
@@ -22,6 +26,158 @@ void PrintParsedPY(ParsePYStruct *parse, const char *expect)
     free(buf);
 }
 
+static void CheckParse(ParsePYStruct *expect, ParsePYStruct *result)
+{
+    int i;
+    assert(expect->iHZCount == result->iHZCount);
+    assert(expect->iMode == result->iMode);
+    for (i = 0; i < expect->iHZCount; i++) {
+        assert(strcmp(expect->strPYParsed[i], result->strPYParsed[i]) == 0);
+        assert(strcmp(expect->strMap[i], result->strMap[i]) == 0);
+    }
+}
+
+/* typing, deleting and editing in the middle, with and without the cache */
+static void TestParseCache(FcitxPinyinConfig *pyconfig)
+{
+    const char *chars = "abcdefghijklmnopqrstuvwxyzaeiounng'";
+    char strPY[MAX_USER_INPUT + 1] = "";
+    ParsePYCache *cache = fcitx_utils_new(ParsePYCache);
+    ParsePYStruct expect, result;
+    int i, j;
+
+    srand(0);
+    for (i = 0; i < 20000; i++) {
+        size_t len = strlen(strPY);
+        int op = rand() % 10;
+        if (op < 6 && len < 64) {
+            strPY[len] = chars[rand() % strlen(chars)];
+            strPY[len + 1] = '\0';
+        } else if (op < 8 && len > 0) {
+            strPY[len - 1] = '\0';
+        } else if (op < 9 && len > 0) {
+            strPY[rand() % len] = chars[rand() % strlen(chars)];
+        } else {
+            strPY[0] = '\0';
+        }
+        if (i % 1000 == 0) {
+            for (j = 0; pyconfig->MHPY_C[j].strMap[0]; j++)
+                pyconfig->MHPY_C[j].bMode = rand() % 2;
+            pyconfig->bFullPY = rand() % 2;
+            pyconfig->iSerial++;
+        }
+        if (!strPY[0])
+            continue;
+
+        ParsePY(pyconfig, strPY, &expect, PY_PARSE_INPUT_USER, false);
+        ParsePYCached(pyconfig, strPY, &result, PY_PARSE_INPUT_USER, false, cache);
+        CheckParse(&expect, &result);
+    }
+    free(cache);
+}
+
+static void CheckSPKey(FcitxPinyinConfig *pyconfig, char c1, char c2)
+{
+    SP_KEY buf;
+    const SP_KEY *key = SPGetKey(pyconfig, c1, c2, &buf);
+    char strJP[3] = { c1, c2, '\0' };
+    char strQP[MAX_PY_LENGTH + 1];
+    char strMap[3];
+    boolean bValid;
+
+    SP2QP(pyconfig, strJP, strQP);
+    if (c2)
+        bValid = (FindPYFAIndex(pyconfig, strQP, 0) != -1);
+    else
+        bValid = MapPY(pyconfig, strQP, strMap, PY_PARSE_INPUT_USER);
+    assert(key->bValid == bValid);
+
+    if (!MapPY(pyconfig, strQP, strMap, PY_PARSE_INPUT_USER))
+        strcpy(strMap, strJP);
+    assert(strcmp(key->strMap[0], strMap) == 0);
+    if (!MapPY(pyconfig, strQP, strMap, PY_PARSE_INPUT_SYSTEM))
+        strcpy(strMap, strJP);
+    assert(strcmp(key->strMap[1], strMap) == 0);
+}
+
+/* the precomputed shuangpin key table agrees with converting key by key */
+static void TestSPTable(FcitxPinyinConfig *pyconfig)
+{
+    const SP_C *schemeC[] = { SPMap_C_MS, SPMap_C_Ziguang, SPMap_C_ABC, SPMap_C_XIAOHE };
+    const SP_S *schemeS[] = { SPMap_S_MS, SPMap_S_Ziguang, SPMap_S_ABC, SPMap_S_XIAOHE };
+    const char *keys = "abcdefghijklmnopqrstuvwxyz;";
+    ParsePYStruct parse;
+    char strMap[3];
+    int s, i, j;
+
+    for (s = 0; s < 4; s++) {
+        memset(pyconfig->SPMap_C, 0, sizeof(pyconfig->SPMap_C));
+        for (i = 0; schemeC[s][i].strQP[0]; i++)
+            pyconfig->SPMap_C[i] = schemeC[s][i];
+        memcpy(pyconfig->SPMap_S, schemeS[s], 4 * sizeof(SP_S));
+        pyconfig->cNonS = (schemeC[s] == SPMap_C_XIAOHE) ? '*' : 'o';
+        pyconfig->MHPY_C[1].bMode = s % 2;
+        pyconfig->bMisstypeNGGN = s % 2;
+        pyconfig->iSerial++;
+
+        for (i = 0; keys[i]; i++) {
+            CheckSPKey(pyconfig, keys[i], '\0');
+            for (j = 0; keys[j]; j++)
+                CheckSPKey(pyconfig, keys[i], keys[j]);
+        }
+        CheckSPKey(pyconfig, 'A', 'i');
+        CheckSPKey(pyconfig, 'a', '1');
+    }
+
+    /* 微软双拼 */
+    memcpy(pyconfig->SPMap_C, SPMap_C_MS, 31 * sizeof(SP_C));
+    memcpy(pyconfig->SPMap_S, SPMap_S_MS, 4 * sizeof(SP_S));
+    pyconfig->cNonS = 'o';
+    pyconfig->iSerial++;
+    ParsePY(pyconfig, "uiwohv", &parse, PY_PARSE_INPUT_USER, true);
+    PrintParsedPY(&parse, "ui wo hv");
+    MapPY(pyconfig, "shi", strMap, PY_PARSE_INPUT_USER);
+    assert(strcmp(parse.strMap[0], strMap) == 0);
+    ParsePY(pyconfig, "ui'w", &parse, PY_PARSE_INPUT_USER, true);
+    PrintParsedPY(&parse, "ui' w");
+}
+
+/* lines of .org phrase files, in both orders */
+static void TestPhraseLine(FcitxPinyinConfig *pyconfig)
+{
+    char line[64];
+    char strMap[MAX_PY_PHRASE_LENGTH * 2 + 1];
+    char expect[MAX_PY_PHRASE_LENGTH * 2 + 1];
+    char map[3];
+    char *phrase;
+
+    MapPY(pyconfig, "zhong", map, PY_PARSE_INPUT_SYSTEM);
+    strcpy(expect, map);
+    MapPY(pyconfig, "guo", map, PY_PARSE_INPUT_SYSTEM);
+    strcat(expect, map);
+
+    strcpy(line, "zhong'guo 中国\n");
+    assert(ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    assert(strcmp(phrase, "中国") == 0);
+    assert(strcmp(strMap, expect) == 0);
+
+    strcpy(line, "  中国\tzhongguo\r\n");
+    assert(ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    assert(strcmp(phrase, "中国") == 0);
+    assert(strcmp(strMap, expect) == 0);
+
+    strcpy(line, "# zhong'guo 中国");
+    assert(!ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    strcpy(line, "zhong'guo'ren 中国");
+    assert(!ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    strcpy(line, "zhong 中");
+    assert(!ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    strcpy(line, "zh'g 中国");
+    assert(!ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+    strcpy(line, "zhong'guo");
+    assert(!ParsePYPhraseLine(pyconfig, line, &phrase, strMap));
+}
+
 int main()
 {
     FcitxPinyinConfig pyconfig;
@@ -46,5 +202,13 @@ int main()
     PrintParsedPY(&parse, "bing an");
     ParsePY(&pyconfig, "xiai", &parse, PY_PARSE_INPUT_USER, false);
     PrintParsedPY(&parse, "xi ai");
+
+    InitMHPY(&pyconfig.MHPY_C, MHPY_C_TEMPLATE);
+    InitMHPY(&pyconfig.MHPY_S, MHPY_S_TEMPLATE);
+    free(pyconfig.PYTable);
+    InitPYTable(&pyconfig);
+    TestParseCache(&pyconfig);
+    TestSPTable(&pyconfig);
+    TestPhraseLine(&pyconfig);
     return 0;
 }
@@ -0,0 +1,337 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcitx/fcitx.h>
+#include <fcitx-utils/utils.h>
+#include <fcitx-utils/utf8.h>
+
+#include "py.h"
+#include "pyParser.h"
+#include "pyconfig.h"
+#include "PYFA.h"
+
+#define BASE_PER_PYFA 3
+/* 单字在不同的 PYFA 中重复出现 */
+#define HZ_COUNT 50
+
+static void RandomMap(FcitxPinyinState* pystate, char* strMap, int count)
+{
+    int i;
+    strMap[0] = '\0';
+    for (i = 0; i < count; i++)
+        strcat(strMap, pystate->PYFAList[rand() % pystate->iPYFACount].strMap);
+}
+
+static void BuildDict(FcitxPinyinState* pystate)
+{
+    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
+    int i, j, k;
+
+    pystate->PYFAList = fcitx_utils_malloc0(sizeof(PYFA) * 512);
+    for (i = 0; pyconfig->PYTable[i].strPY[0]; i++) {
+        char strMap[3] = {0};
+        if (!MapPY(pyconfig, pyconfig->PYTable[i].strPY, strMap, PY_PARSE_INPUT_SYSTEM)
+            || strlen(strMap) != 2)
+            continue;
+        for (j = 0; j < pystate->iPYFACount; j++) {
+            if (!strncmp(pystate->PYFAList[j].strMap, strMap, 2))
+                break;
+        }
+        if (j < pystate->iPYFACount || j == 512)
+            continue;
+        strncpy(pystate->PYFAList[j].strMap, strMap, 2);
+        pystate->PYFAList[j].iSyllable = PYMapToSyllable(strMap);
+        pystate->iPYFACount++;
+    }
+
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        PYFA* pyfa = &pystate->PYFAList[i];
+        pyfa->iBase = BASE_PER_PYFA;
+        pyfa->pyBase = fcitx_utils_malloc0(sizeof(PyBase) * BASE_PER_PYFA);
+        for (j = 0; j < BASE_PER_PYFA; j++) {
+            PyBase* base = &pyfa->pyBase[j];
+            int len = fcitx_ucs4_to_utf8(0x4e00 + (i * BASE_PER_PYFA + j) % HZ_COUNT,
+                                         base->strHZ);
+            base->strHZ[len] = '\0';
+            base->iHit = rand() % 4;
+            base->iIndex = rand();
+            base->iPhrase = rand() % 8;
+            base->phrase = fcitx_utils_malloc0(sizeof(PyPhrase) * (base->iPhrase + 1));
+            for (k = 0; k < base->iPhrase; k++) {
+                base->phrase[k].strMap = malloc(MAX_PY_PHRASE_LENGTH * 2 + 1);
+                RandomMap(pystate, base->phrase[k].strMap, 1 + rand() % 3);
+                base->phrase[k].strPhrase = strdup("p");
+                base->phrase[k].iHit = rand() % 4;
+                base->phrase[k].iIndex = rand();
+            }
+            base->userPhrase = fcitx_utils_new(PyUsrPhrase);
+            base->userPhrase->next = base->userPhrase;
+            base->iUserPhrase = rand() % 3;
+            PyUsrPhrase* prev = base->userPhrase;
+            for (k = 0; k < base->iUserPhrase; k++) {
+                PyUsrPhrase* userPhrase = fcitx_utils_new(PyUsrPhrase);
+                userPhrase->phrase.strMap = malloc(MAX_PY_PHRASE_LENGTH * 2 + 1);
+                RandomMap(pystate, userPhrase->phrase.strMap, 1 + rand() % 3);
+                userPhrase->phrase.strPhrase = strdup("u");
+                userPhrase->phrase.iHit = rand() % 4;
+                userPhrase->phrase.iIndex = rand();
+                userPhrase->next = prev->next;
+                prev->next = userPhrase;
+                prev = userPhrase;
+            }
+        }
+    }
+}
+
+/* the same as the loops used before the index */
+static void BruteForce(FcitxPinyinState* pystate, const char* str,
+                       const char* strMap, boolean bUser, UT_array* matches)
+{
+    PYFA* PYFAList = pystate->PYFAList;
+    int32_t i, j, k;
+    int iMatchedLength;
+    PYPhraseMatch match;
+
+    utarray_clear(matches);
+    for (i = 0; i < pystate->iPYFACount; i++) {
+        if (Cmp2Map(&pystate->pyconfig, PYFAList[i].strMap, (char*) str, pystate->bSP))
+            continue;
+        for (j = 0; j < PYFAList[i].iBase; j++) {
+            PyBase* base = &PYFAList[i].pyBase[j];
+            int count = bUser ? base->iUserPhrase : base->iPhrase;
+            PyPhrase* phrase = bUser ? USER_PHRASE_NEXT(base->userPhrase) : base->phrase;
+            for (k = 0; k < count; k++) {
+                int val = CmpMap(&pystate->pyconfig, phrase->strMap, strMap,
+                                 &iMatchedLength, pystate->bSP);
+                if (!val || strlen(phrase->strMap) == iMatchedLength) {
+                    match.iPYFA = i;
+                    match.iBase = j;
+                    match.iPhrase = k;
+                    match.phrase = phrase;
+                    utarray_push_back(matches, &match);
+                }
+                phrase = bUser ? USER_PHRASE_NEXT(phrase) : phrase + 1;
+            }
+        }
+    }
+}
+
+static void RandomPY(FcitxPinyinState* pystate, char* strPY, int count)
+{
+    int i;
+    strPY[0] = '\0';
+    for (i = 0; i < count; i++) {
+        char py[MAX_PY_LENGTH + 1];
+        int index = rand() % 200;
+        strcpy(py, pystate->pyconfig.PYTable[index].strPY);
+        /* sometimes only the consonant */
+        if (rand() % 4 == 0 && strlen(py) > 2)
+            py[rand() % 2 + 1] = '\0';
+        strcat(strPY, py);
+    }
+}
+
+static int Check(FcitxPinyinState* pystate, UT_array* expect, UT_array* result)
+{
+    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
+    int count = 0;
+    char strPY[MAX_USER_INPUT + 1];
+    ParsePYStruct parse;
+    int i, j;
+
+    RandomPY(pystate, strPY, 1 + rand() % 4);
+    ParsePY(&pystate->pyconfig, strPY, &parse, PY_PARSE_INPUT_USER, false);
+    if (parse.iHZCount < 2)
+        return 0;
+    /* CmpMap reads past the end of a shorter phrase for such input */
+    for (i = 0; i < parse.iHZCount; i++) {
+        if (parse.strMap[i][0] == '0')
+            return 0;
+    }
+
+    char strMap[MAX_WORDS_USER_INPUT * 2 + 1];
+    strMap[0] = '\0';
+    for (i = 1; i < parse.iHZCount; i++)
+        strcat(strMap, parse.strMap[i]);
+
+    for (i = 0; i < 2; i++) {
+        /* 不用模糊音位图比较 */
+        pyconfig->bFuzzyMaskBuilt = false;
+        BruteForce(pystate, parse.strMap[0], strMap, i == 0, expect);
+        pyconfig->bFuzzyMaskBuilt = true;
+        PYPhraseIndexMatch(pystate, parse.strMap[0], strMap, i == 0, result);
+        assert(utarray_len(expect) == utarray_len(result));
+        for (j = 0; j < utarray_len(expect); j++) {
+            PYPhraseMatch* a = (PYPhraseMatch*) utarray_eltptr(expect, j);
+            PYPhraseMatch* b = (PYPhraseMatch*) utarray_eltptr(result, j);
+            assert(a->iPYFA == b->iPYFA);
+            assert(a->iBase == b->iBase);
+            assert(a->iPhrase == b->iPhrase);
+            assert(a->phrase == b->phrase);
+        }
+        count += utarray_len(expect);
+    }
+    return count;
+}
+
+/* every pair of map characters, with and without the fuzzy mask */
+static void CheckFuzzyMask(FcitxPinyinConfig* pyconfig)
+{
+    const char* maps = " 0ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!";
+    int i, j, k;
+
+    for (i = 0; maps[i]; i++) {
+        for (j = 0; maps[j]; j++) {
+            for (k = 0; k < 8; k++) {
+                boolean is_S = k & 1, bUseMH = (k >> 1) & 1, bSP = (k >> 2) & 1;
+                int expect, result;
+                pyconfig->bFuzzyMaskBuilt = false;
+                expect = Cmp1Map(pyconfig, maps[i], maps[j], is_S, bUseMH, bSP);
+                pyconfig->bFuzzyMaskBuilt = true;
+                result = Cmp1Map(pyconfig, maps[i], maps[j], is_S, bUseMH, bSP);
+                assert(expect == result);
+            }
+        }
+    }
+}
+
+/* the same order as the loops used before the index */
+static void CheckHZIndex(FcitxPinyinState* pystate)
+{
+    PYFA* PYFAList = pystate->PYFAList;
+    int32_t c, i, j;
+
+    for (c = 0; c <= HZ_COUNT; c++) {
+        char strHZ[UTF8_MAX_LENGTH + 1];
+        int len = fcitx_ucs4_to_utf8(0x4e00 + c, strHZ);
+        strHZ[len] = '\0';
+
+        PYHZEntry* entry = PYHZIndexFind(pystate, strHZ);
+        for (i = pystate->iPYFACount - 1; i >= 0; i--) {
+            for (j = 0; j < PYFAList[i].iBase; j++) {
+                if (strcmp(PYFAList[i].pyBase[j].strHZ, strHZ))
+                    continue;
+                assert(entry);
+                assert(entry->iPYFA == i);
+                assert(entry->iBase == j);
+                entry = PYHZIndexNext(pystate, entry);
+            }
+        }
+        assert(!entry);
+
+        /* more than one hanzi */
+        memcpy(strHZ + len, strHZ, len);
+        strHZ[len * 2] = '\0';
+        assert(!PYHZIndexFind(pystate, strHZ));
+    }
+    assert(!PYHZIndexFind(pystate, ""));
+}
+
+/* the sentence should not depend on what was typed before */
+static void CheckLattice(FcitxPinyinState* pystate)
+{
+    char strPY[MAX_USER_INPUT + 1];
+    char strHZ[MAX_WORDS_USER_INPUT * UTF8_MAX_LENGTH + 1];
+    char strMap[MAX_WORDS_USER_INPUT * 2 + 1];
+    char strHZ2[MAX_WORDS_USER_INPUT * UTF8_MAX_LENGTH + 1];
+    char strMap2[MAX_WORDS_USER_INPUT * 2 + 1];
+    size_t len;
+
+    RandomPY(pystate, strPY, 1 + rand() % 8);
+    for (len = 1; len <= strlen(strPY); len++) {
+        char input[MAX_USER_INPUT + 1];
+        strncpy(input, strPY, len);
+        input[len] = '\0';
+        /* sometimes delete some */
+        if (len > 3 && rand() % 8 == 0)
+            input[len - 3] = '\0';
+        ParsePY(&pystate->pyconfig, input, &pystate->findMap,
+                PY_PARSE_INPUT_USER, false);
+        if (pystate->findMap.iHZCount < 2)
+            continue;
+
+        boolean result = PYLatticeGetSentence(pystate, strHZ, strMap);
+        PYLatticeReset(pystate);
+        boolean result2 = PYLatticeGetSentence(pystate, strHZ2, strMap2);
+        assert(result == result2);
+        assert(strcmp(strHZ, strHZ2) == 0);
+        assert(strcmp(strMap, strMap2) == 0);
+        if (result)
+            assert(strlen(strMap) == pystate->findMap.iHZCount * 2);
+    }
+}
+
+int main()
+{
+    FcitxPinyinState* pystate = fcitx_utils_new(FcitxPinyinState);
+    FcitxPinyinConfig* pyconfig = &pystate->pyconfig;
+    UT_array expect, result;
+    int i, j, count = 0;
+
+    srand(0);
+    InitMHPY(&pyconfig->MHPY_C, MHPY_C_TEMPLATE);
+    InitMHPY(&pyconfig->MHPY_S, MHPY_S_TEMPLATE);
+    InitPYTable(pyconfig);
+    PYBuildFuzzyMask(pyconfig);
+    BuildDict(pystate);
+    PYPhraseIndexBuild(pystate);
+    PYHZIndexBuild(pystate);
+    CheckHZIndex(pystate);
+
+    utarray_init(&expect, &py_phrase_match_icd);
+    utarray_init(&result, &py_phrase_match_icd);
+
+    for (i = 0; i < 2000; i++) {
+        /* fuzzy pinyin is applied while matching, no need to rebuild */
+        if (i % 100 == 0) {
+            for (j = 0; pyconfig->MHPY_C[j].strMap[0]; j++)
+                pyconfig->MHPY_C[j].bMode = rand() % 2;
+            for (j = 0; pyconfig->MHPY_S[j].strMap[0]; j++)
+                pyconfig->MHPY_S[j].bMode = rand() % 2;
+            pyconfig->bFullPY = rand() % 2;
+            PYBuildFuzzyMask(pyconfig);
+            CheckFuzzyMask(pyconfig);
+            PYLatticeReset(pystate);
+        }
+
+        /* remove a user phrase and add it back at the front */
+        if (i % 10 == 0) {
+            PYFA* pyfa = &pystate->PYFAList[rand() % pystate->iPYFACount];
+            int32_t iBase = rand() % pyfa->iBase;
+            PyBase* base = &pyfa->pyBase[iBase];
+            if (base->iUserPhrase) {
+                PyUsrPhrase* last = base->userPhrase;
+                while (last->next != base->userPhrase)
+                    last = last->next;
+                PyUsrPhrase* prev = base->userPhrase;
+                while (prev->next != last)
+                    prev = prev->next;
+                int32_t iPYFA = pyfa - pystate->PYFAList;
+                PYPhraseIndexRemoveUser(pystate, iPYFA, iBase, last);
+                prev->next = last->next;
+                base->iUserPhrase--;
+                if (rand() % 2) {
+                    last->next = base->userPhrase->next;
+                    base->userPhrase->next = last;
+                    base->iUserPhrase++;
+                    PYPhraseIndexInsertUser(pystate, iPYFA, iBase, last);
+                } else {
+                    free(last->phrase.strMap);
+                    free(last);
+                }
+                PYLatticeReset(pystate);
+            }
+        }
+
+        count += Check(pystate, &expect, &result);
+        if (i % 4 == 0)
+            CheckLattice(pystate);
+    }
+    assert(count > 0);
+
+    utarray_done(&expect);
+    utarray_done(&result);
+    PYPhraseIndexFree(pystate);
+    PYHZIndexFree(pystate);
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
 #include "fcitx-utils/utarray.h"
 
 typedef struct {
@@ -122,5 +123,38 @@ int main()
         }
     }
 
+    {
+        /* topk_test, compare with stable msort, b keeps the original position */
+        SortItem items[1000], sorted[1000], topk[1000];
+        size_t ks[] = {0, 1, 7, 10, 64, 499, 500, 501, 999, 1000, 2000};
+        int j;
+        for (i = 0; i < _AS(items); i ++) {
+            items[i].a = rand() % 50;
+            items[i].b = i;
+        }
+        memcpy(sorted, items, sizeof(items));
+        fcitx_msort_r(sorted, _AS(sorted), sizeof(sorted[0]), cmp, NULL);
+
+        for (j = 0; j < _AS(ks); j ++) {
+            size_t k = ks[j] > _AS(items) ? _AS(items) : ks[j];
+            memcpy(topk, items, sizeof(items));
+            fcitx_msort_topk_r(topk, _AS(topk), sizeof(topk[0]), ks[j], cmp, NULL);
+            for (i = 0; i < k; i ++) {
+                assert(topk[i].a == sorted[i].a);
+                assert(topk[i].b == sorted[i].b);
+            }
+
+            /* sort the rest by more steps, should be the same as sort once */
+            while (k < _AS(topk)) {
+                fcitx_msort_topk_r(topk + k, _AS(topk) - k, sizeof(topk[0]), 37, cmp, NULL);
+                k += 37;
+            }
+            for (i = 0; i < _AS(topk); i ++) {
+                assert(topk[i].a == sorted[i].a);
+                assert(topk[i].b == sorted[i].b);
+            }
+        }
+    }
+
     return 0;
 }
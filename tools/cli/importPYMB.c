@@ -0,0 +1,371 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/uthash.h"
+#include "fcitx-config/xdg.h"
+#include "im/pinyin/pyParser.h"
+#include "im/pinyin/pyMapTable.h"
+#include "im/pinyin/PYFA.h"
+#include "im/pinyin/pyconfig.h"
+#include "im/pinyin/py.h"
+#include "pyTools.h"
+
+/*
+ * Import .org phrase files (the output of scel2org or mb2org) into the user
+ * phrase file in one go. Typing every phrase into fcitx would rewrite the
+ * whole user phrase file again and again, so the phrases are checked with a
+ * hash set, sorted and merged into each base, and the file is written once.
+ */
+
+typedef struct _PYMBPhrase {
+    char *Map;
+    char *Phrase;
+    int Index;
+    int Hit;
+} PYMBPhrase;
+
+typedef struct _PYMBGroup {
+    char *key;
+    int PYFAIndex;
+    char *HZ;
+    UT_array phrases;           /* already in the user file */
+    UT_array imported;
+    FcitxStringHashSet *seen;
+    UT_hash_handle hh;
+} PYMBGroup;
+
+static const UT_icd pymb_phrase_icd = {
+    sizeof(PYMBPhrase), NULL, NULL, NULL
+};
+
+FcitxPinyinConfig pyconfig;
+
+void usage();
+
+static PYMBGroup *GetGroup(PYMBGroup **groups, UT_array *order,
+                           int PYFAIndex, const char *HZ)
+{
+    PYMBGroup *group;
+    char *key;
+    asprintf(&key, "%d %s", PYFAIndex, HZ);
+    HASH_FIND_STR(*groups, key, group);
+    if (group) {
+        free(key);
+        return group;
+    }
+    group = fcitx_utils_new(PYMBGroup);
+    group->key = key;
+    group->PYFAIndex = PYFAIndex;
+    group->HZ = strdup(HZ);
+    utarray_init(&group->phrases, &pymb_phrase_icd);
+    utarray_init(&group->imported, &pymb_phrase_icd);
+    HASH_ADD_KEYPTR(hh, *groups, group->key, strlen(group->key), group);
+    utarray_push_back(order, &group);
+    return group;
+}
+
+/* returns false if the phrase is already in the group */
+static boolean GroupSee(PYMBGroup *group, const char *Map, const char *Phrase)
+{
+    char *key;
+    boolean seen;
+    /* map never contains space */
+    fcitx_utils_alloc_cat_str(key, Map, " ", Phrase);
+    seen = fcitx_utils_string_hash_set_contains(group->seen, key);
+    if (!seen)
+        group->seen = fcitx_utils_string_hash_set_insert(group->seen, key);
+    free(key);
+    return !seen;
+}
+
+static void LoadGroups(FILE *fi, boolean isUser, PYMBGroup **groups,
+                       UT_array *order, int *maxIndex)
+{
+    struct _PYMB *PYMB;
+    int i, j;
+
+    LoadPYMB(fi, &PYMB, isUser);
+    for (i = 0; PYMB[i].HZ[0]; ++i) {
+        PYMBGroup *group = GetGroup(groups, order, PYMB[i].PYFAIndex, PYMB[i].HZ);
+        for (j = 0; j < PYMB[i].UserPhraseCount; ++j) {
+            PYMBPhrase phrase;
+            phrase.Map = PYMB[i].UserPhrase[j].Map;
+            phrase.Phrase = PYMB[i].UserPhrase[j].Phrase;
+            phrase.Index = PYMB[i].UserPhrase[j].Index;
+            phrase.Hit = PYMB[i].UserPhrase[j].Hit;
+            if (phrase.Index > *maxIndex)
+                *maxIndex = phrase.Index;
+            /* system phrases are only used to drop duplicates */
+            if (GroupSee(group, phrase.Map, phrase.Phrase) && isUser) {
+                utarray_push_back(&group->phrases, &phrase);
+            } else {
+                free(phrase.Map);
+                free(phrase.Phrase);
+            }
+        }
+        free(PYMB[i].UserPhrase);
+    }
+    free(PYMB);
+}
+
+/* the same order as the user phrase list of fcitx, larger map first */
+static int PhraseCmp(const void *a, const void *b)
+{
+    return strcmp(((const PYMBPhrase*) b)->Map, ((const PYMBPhrase*) a)->Map);
+}
+
+static void WritePhrase(FILE *fo, const PYMBPhrase *phrase)
+{
+    int32_t len = strlen(phrase->Map);
+    fcitx_utils_write_int32(fo, len);
+    fwrite(phrase->Map, sizeof(char), len, fo);
+    len = strlen(phrase->Phrase);
+    fcitx_utils_write_int32(fo, len);
+    fwrite(phrase->Phrase, sizeof(char), len, fo);
+    fcitx_utils_write_int32(fo, phrase->Index);
+    fcitx_utils_write_int32(fo, phrase->Hit);
+}
+
+int main(int argc, char **argv)
+{
+    char *pyusrphrase_mb = NULL, *pybase_mb = NULL, *pyphrase_mb = NULL;
+    char *output = NULL, *tempfile;
+    FILE *fi;
+    int c, i, fd;
+    struct _HZMap *HZMap;
+    int PYFACount;
+    PYMBGroup *groups = NULL, *group;
+    UT_array order;
+    FcitxStringHashSet *baseHZ = NULL;
+    int maxIndex = 0;
+    int total = 0, added = 0, dup = 0, invalid = 0;
+
+    while ((c = getopt(argc, argv, "f:b:s:o:h")) != -1) {
+        switch (c) {
+
+        case 'f':
+            pyusrphrase_mb = strdup(optarg);
+            break;
+
+        case 'b':
+            pybase_mb = strdup(optarg);
+            break;
+
+        case 's':
+            pyphrase_mb = strdup(optarg);
+            break;
+
+        case 'o':
+            output = strdup(optarg);
+            break;
+
+        case 'h':
+
+        default:
+            usage();
+        }
+    }
+
+    if (optind >= argc)
+        usage();
+
+    memset(&pyconfig, 0, sizeof(pyconfig));
+    InitMHPY(&pyconfig.MHPY_C, MHPY_C_TEMPLATE);
+    InitMHPY(&pyconfig.MHPY_S, MHPY_S_TEMPLATE);
+    InitPYTable(&pyconfig);
+
+    if (pybase_mb)
+        fi = fopen(pybase_mb, "r");
+    else
+        fi = FcitxXDGGetFileWithPrefix("pinyin", PY_BASE_FILE, "r", NULL);
+
+    if (!fi) {
+        fprintf(stderr, "Can't open base file.\n");
+        exit(1);
+    }
+
+    PYFACount = LoadPYBase(fi, &HZMap);
+    fclose(fi);
+
+    for (i = 0; i < PYFACount; i++) {
+        int j;
+        for (j = 0; j < HZMap[i].BaseCount; j++) {
+            char *key;
+            asprintf(&key, "%s %s", HZMap[i].Map, HZMap[i].HZ[j]);
+            baseHZ = fcitx_utils_string_hash_set_insert(baseHZ, key);
+            free(key);
+        }
+    }
+
+    utarray_init(&order, fcitx_ptr_icd);
+
+    if (!pyusrphrase_mb)
+        FcitxXDGGetFileUserWithPrefix("pinyin", PY_USERPHRASE_FILE, NULL,
+                                      &pyusrphrase_mb);
+    fi = fopen(pyusrphrase_mb, "r");
+    if (fi) {
+        LoadGroups(fi, true, &groups, &order, &maxIndex);
+        fclose(fi);
+    }
+
+    if (pyphrase_mb)
+        fi = fopen(pyphrase_mb, "r");
+    else
+        fi = FcitxXDGGetFileWithPrefix("pinyin", PY_PHRASE_FILE, "r", NULL);
+    if (fi) {
+        LoadGroups(fi, false, &groups, &order, &maxIndex);
+        fclose(fi);
+    } else if (pyphrase_mb) {
+        fprintf(stderr, "Can't open phrase file %s.\n", pyphrase_mb);
+        exit(1);
+    }
+
+    for (; optind < argc; optind++) {
+        char *buf = NULL, *strPhrase;
+        char strMap[MAX_PY_PHRASE_LENGTH * 2 + 1];
+        size_t bufLen = 0;
+
+        fi = fopen(argv[optind], "r");
+        if (!fi) {
+            fprintf(stderr, "Can't open org file %s.\n", argv[optind]);
+            exit(1);
+        }
+
+        while (getline(&buf, &bufLen, fi) != -1) {
+            char HZ[UTF8_MAX_LENGTH + 1];
+            char Map[3];
+            char *key;
+            int PYFAIndex, clen;
+            boolean inBase;
+
+            const char *line = buf + strspn(buf, " \t\r\n");
+            boolean blank = (!*line || *line == '#');
+
+            if (!ParsePYPhraseLine(&pyconfig, buf, &strPhrase, strMap)) {
+                if (!blank)
+                    invalid++;
+                continue;
+            }
+            total++;
+
+            strncpy(Map, strMap, 2);
+            Map[2] = '\0';
+            clen = fcitx_utf8_char_len(strPhrase);
+            strncpy(HZ, strPhrase, clen);
+            HZ[clen] = '\0';
+            fcitx_utils_alloc_cat_str(key, Map, " ", HZ);
+            inBase = fcitx_utils_string_hash_set_contains(baseHZ, key);
+            free(key);
+            if (!inBase) {
+                invalid++;
+                continue;
+            }
+
+            for (PYFAIndex = 0; PYFAIndex < PYFACount; PYFAIndex++) {
+                if (!strcmp(HZMap[PYFAIndex].Map, Map))
+                    break;
+            }
+
+            group = GetGroup(&groups, &order, PYFAIndex, HZ);
+            if (!GroupSee(group, strMap + 2, strPhrase + clen)) {
+                dup++;
+                continue;
+            }
+
+            PYMBPhrase phrase;
+            phrase.Map = strdup(strMap + 2);
+            phrase.Phrase = strdup(strPhrase + clen);
+            phrase.Index = 0;
+            phrase.Hit = 1;
+            utarray_push_back(&group->imported, &phrase);
+            added++;
+        }
+        free(buf);
+        fclose(fi);
+    }
+
+    if (!output)
+        output = strdup(pyusrphrase_mb);
+    fcitx_utils_alloc_cat_str(tempfile, output, "_XXXXXX");
+    fd = mkstemp(tempfile);
+    FILE *fo = fd >= 0 ? fdopen(fd, "w") : NULL;
+    if (!fo) {
+        fprintf(stderr, "Can't write output file.\n");
+        exit(1);
+    }
+
+    PYMBGroup **pgroup;
+    for (pgroup = (PYMBGroup**) utarray_front(&order);
+         pgroup != NULL;
+         pgroup = (PYMBGroup**) utarray_next(&order, pgroup)) {
+        group = *pgroup;
+        unsigned int count = utarray_len(&group->phrases) + utarray_len(&group->imported);
+        if (!count)
+            continue;
+
+        int8_t clen = strlen(group->HZ);
+        fcitx_utils_write_int32(fo, group->PYFAIndex);
+        fwrite(&clen, sizeof(int8_t), 1, fo);
+        fwrite(group->HZ, sizeof(char) * clen, 1, fo);
+        fcitx_utils_write_int32(fo, count);
+
+        /* one sorted merge, imported phrases go before the first smaller map */
+        if (utarray_len(&group->imported) > 1)
+            utarray_sort(&group->imported, PhraseCmp);
+        PYMBPhrase *phrase = (PYMBPhrase*) utarray_front(&group->phrases);
+        PYMBPhrase *imported = (PYMBPhrase*) utarray_front(&group->imported);
+        while (phrase || imported) {
+            if (imported && (!phrase || strcmp(imported->Map, phrase->Map) > 0)) {
+                imported->Index = ++maxIndex;
+                WritePhrase(fo, imported);
+                imported = (PYMBPhrase*) utarray_next(&group->imported, imported);
+            } else {
+                WritePhrase(fo, phrase);
+                phrase = (PYMBPhrase*) utarray_next(&group->phrases, phrase);
+            }
+        }
+    }
+
+    if (fclose(fo) != 0 || rename(tempfile, output) != 0) {
+        fprintf(stderr, "Can't write output file.\n");
+        unlink(tempfile);
+        exit(1);
+    }
+
+    fprintf(stderr, "%d phrases, %d added, %d duplicated, %d invalid.\n",
+            total, added, dup, invalid);
+
+    free(tempfile);
+    free(output);
+    return 0;
+}
+
+void usage()
+{
+    puts(
+        "importPYMB - import .org phrase files into the pinyin user phrase file\n"
+        "\n"
+        "  usage: importPYMB [OPTION] <orgfile> [<orgfile> ...]\n"
+        "\n"
+        "  -f <pyusrphrase.mb> user phrase file to import into, defaults to\n"
+        "                      ~/.config/fcitx/pinyin/" PY_USERPHRASE_FILE "\n"
+        "  -b <pybase.mb>      pinyin base file, defaults to the installed one\n"
+        "  -s <pyphrase.mb>    system phrase file, phrases in it are not imported,\n"
+        "                      defaults to the installed one\n"
+        "  -o <mbfile>         output file, defaults to the user phrase file\n"
+        "  -h                  display this help\n"
+        "\n"
+        "  Every line of an org file is \"pin'yin phrase\" or \"phrase pin'yin\".\n"
+        "  Quit fcitx before importing, or it will overwrite the user phrase\n"
+        "  file with the phrases it has in memory.\n"
+    );
+    exit(1);
+    return;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 4;
@@ -96,6 +96,97 @@ char guessValidChar(char prefer, const char* invalid) {
         return c;
 }
 
+static void PrintTableImage(FILE* fpDict, const char** templ)
+{
+    TableDict* tableDict = fcitx_utils_new(TableDict);
+    RECORD* recTemp;
+    unsigned int i, j;
+
+    tableDict->pool = fcitx_memory_pool_create();
+    if (!TableImageLoad(tableDict, fpDict)) {
+        fprintf(stderr, "Invalid table image\n");
+        exit(1);
+    }
+
+    printf(templ[TEMPL_VERNEW], INTERNAL_VERSION);
+    printf(templ[TEMPL_KEYCODE], tableDict->strInputCode);
+    printf(templ[TEMPL_LEN], tableDict->iCodeLength);
+
+    char cPinyin = guessValidChar('@', tableDict->strInputCode);
+    printf(templ[TEMPL_PY], cPinyin);
+    printf(templ[TEMPL_PYLEN], tableDict->iPYCodeLength);
+
+    char* temp = malloc(strlen(tableDict->strInputCode) * sizeof(char) + 3);
+    strcpy(temp, tableDict->strInputCode);
+    char pyStr[] = {cPinyin, '\0'};
+    strcat(temp, pyStr);
+    char cPrompt = guessValidChar('&', temp);
+    char prStr[] = {cPrompt, '\0'};
+    strcat(temp, prStr);
+    char cPhrase = guessValidChar('^', temp);
+    free(temp);
+    if (cPrompt == 0)
+        printf("%s", templ[TEMPL_PROMPT2]);
+    else
+        printf(templ[TEMPL_PROMPT], cPrompt);
+    if (cPhrase == 0)
+        printf("%s", templ[TEMPL_CONSTRUCTPHRASE2]);
+    else
+        printf(templ[TEMPL_CONSTRUCTPHRASE], cPhrase);
+
+    if (tableDict->strIgnoreChars[0])
+        printf(templ[TEMPL_INVALIDCHAR], tableDict->strIgnoreChars);
+
+    if (tableDict->bRule) {
+        printf("%s", templ[TEMPL_RULE]);
+
+        for (i = 0; i < tableDict->iCodeLength - 1; i++) {
+            RULE* rule = &tableDict->rule[i];
+            printf("%c%d=", rule->iFlag ? 'a' : 'e', rule->iWords);
+
+            for (j = 0; j < tableDict->iCodeLength; j++) {
+                printf("%c%d%d", rule->rule[j].iFlag ? 'p' : 'n',
+                       rule->rule[j].iWhich, rule->rule[j].iIndex);
+
+                if (j != (tableDict->iCodeLength - 1))
+                    printf("+");
+            }
+
+            printf("\n");
+        }
+    }
+
+    printf("%s", templ[TEMPL_DATA]);
+
+    for (recTemp = tableDict->recordHead->next;
+         recTemp != tableDict->recordHead; recTemp = recTemp->next) {
+        char prefix = '\0';
+        if (recTemp->type == RECORDTYPE_PINYIN)
+            prefix = cPinyin;
+        else if (recTemp->type == RECORDTYPE_CONSTRUCT)
+            prefix = cPhrase;
+        else if (recTemp->type == RECORDTYPE_PROMPT)
+            prefix = cPrompt;
+
+        if (recTemp->type != RECORDTYPE_NORMAL && prefix == 0) {
+            fprintf(stderr, "Could not find a valid char for %s\n",
+                    recTemp->type == RECORDTYPE_PROMPT ? "prompt" : "construct phrase");
+            exit(1);
+        }
+
+        if (prefix)
+            printf("%c%s %s\n", prefix, recTemp->strCode, recTemp->strHZ);
+        else
+            printf("%s %s\n", recTemp->strCode, recTemp->strHZ);
+    }
+
+    TableCodeIndexFree(tableDict);
+    TablePhraseIndexFree(tableDict);
+    TableImageFree(tableDict);
+    fcitx_memory_pool_destroy(tableDict->pool);
+    free(tableDict);
+}
+
 void usage()
 {
     printf("Usage: mb2txt [-o] <Source File>\n");
@@ -144,6 +235,12 @@ int main(int argc, char *argv[])
         exit(2);
     }
 
+    if (TableImageCheck(fpDict)) {
+        PrintTableImage(fpDict, templ);
+        fclose(fpDict);
+        return 0;
+    }
+
     //先读取码表的信息
     fcitx_utils_read_uint32(fpDict, &iTemp);
 
@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "fcitx-utils/utils.h"
+#include "fcitx-utils/uthash.h"
+#include "pyTools.h"
+
+/*
+ * Merge several system format phrase MB files into one, so fcitx does not
+ * need to strip the duplicated phrases of every extra file on startup.
+ * Phrases are kept in the order they are first seen, and duplicates are
+ * dropped by the same rule as LoadPYPhraseDict: nothing is dropped from the
+ * first file, which plays pyphrase.mb, and a phrase of a later file is only
+ * compared with the phrases loaded before its record.
+ */
+
+typedef struct _PYMBGroup {
+    char *key;
+    int PYFAIndex;
+    char *HZ;
+    UT_array phrases;
+    FcitxStringHashSet *seen;
+    UT_hash_handle hh;
+} PYMBGroup;
+
+typedef struct _PYMBPhrase {
+    char *Map;
+    char *Phrase;
+    int Index;
+} PYMBPhrase;
+
+static const UT_icd pymb_phrase_icd = {
+    sizeof(PYMBPhrase), NULL, NULL, NULL
+};
+
+void usage();
+
+int main(int argc, char **argv)
+{
+    char *output = NULL;
+    int c, i, j, k;
+    boolean isBase = true;
+    PYMBGroup *groups = NULL, *group;
+    UT_array order;
+    int total = 0, dup = 0;
+
+    while ((c = getopt(argc, argv, "o:h")) != -1) {
+        switch (c) {
+
+        case 'o':
+            output = strdup(optarg);
+            break;
+
+        case 'h':
+
+        default:
+            usage();
+        }
+    }
+
+    if (optind >= argc)
+        usage();
+
+    utarray_init(&order, fcitx_ptr_icd);
+
+    for (; optind < argc; optind++) {
+        FILE *fi = fopen(argv[optind], "r");
+        struct _PYMB *PYMB;
+
+        if (!fi) {
+            fprintf(stderr, "Can't open phrase file %s.\n", argv[optind]);
+            exit(1);
+        }
+
+        LoadPYMB(fi, &PYMB, 0);
+        fclose(fi);
+
+        for (i = 0; PYMB[i].HZ[0]; ++i) {
+            char *key;
+            asprintf(&key, "%d %s", PYMB[i].PYFAIndex, PYMB[i].HZ);
+            HASH_FIND_STR(groups, key, group);
+            if (group) {
+                free(key);
+            } else {
+                group = fcitx_utils_new(PYMBGroup);
+                group->key = key;
+                group->PYFAIndex = PYMB[i].PYFAIndex;
+                group->HZ = strdup(PYMB[i].HZ);
+                utarray_init(&group->phrases, &pymb_phrase_icd);
+                HASH_ADD_KEYPTR(hh, groups, group->key, strlen(group->key), group);
+                utarray_push_back(&order, &group);
+            }
+
+            /* duplicates inside one record are kept, the same as fcitx */
+            unsigned int loaded = utarray_len(&group->phrases);
+            for (j = 0; j < PYMB[i].UserPhraseCount; ++j) {
+                char *phraseKey;
+                /* map never contains space */
+                fcitx_utils_alloc_cat_str(phraseKey, PYMB[i].UserPhrase[j].Map,
+                                          " ", PYMB[i].UserPhrase[j].Phrase);
+                total++;
+                if (!isBase && fcitx_utils_string_hash_set_contains(group->seen, phraseKey)) {
+                    dup++;
+                    free(phraseKey);
+                    free(PYMB[i].UserPhrase[j].Map);
+                    free(PYMB[i].UserPhrase[j].Phrase);
+                    continue;
+                }
+                free(phraseKey);
+
+                PYMBPhrase phrase;
+                phrase.Map = PYMB[i].UserPhrase[j].Map;
+                phrase.Phrase = PYMB[i].UserPhrase[j].Phrase;
+                phrase.Index = PYMB[i].UserPhrase[j].Index;
+                utarray_push_back(&group->phrases, &phrase);
+            }
+            free(PYMB[i].UserPhrase);
+
+            for (k = loaded; k < utarray_len(&group->phrases); k++) {
+                PYMBPhrase *phrase = (PYMBPhrase*) utarray_eltptr(&group->phrases, k);
+                char *phraseKey;
+                fcitx_utils_alloc_cat_str(phraseKey, phrase->Map, " ", phrase->Phrase);
+                if (!fcitx_utils_string_hash_set_contains(group->seen, phraseKey))
+                    group->seen = fcitx_utils_string_hash_set_insert(group->seen, phraseKey);
+                free(phraseKey);
+            }
+        }
+        free(PYMB);
+        isBase = false;
+    }
+
+    FILE *fo = fopen(output ? output : "pyphrase.mb", "w");
+    if (!fo) {
+        fprintf(stderr, "Can't write output file.\n");
+        exit(1);
+    }
+
+    PYMBGroup **pgroup;
+    for (pgroup = (PYMBGroup**) utarray_front(&order);
+         pgroup != NULL;
+         pgroup = (PYMBGroup**) utarray_next(&order, pgroup)) {
+        group = *pgroup;
+        int8_t clen = strlen(group->HZ);
+        fcitx_utils_write_int32(fo, group->PYFAIndex);
+        fwrite(&clen, sizeof(int8_t), 1, fo);
+        fwrite(group->HZ, sizeof(char) * clen, 1, fo);
+        fcitx_utils_write_int32(fo, utarray_len(&group->phrases));
+
+        PYMBPhrase *phrase;
+        for (phrase = (PYMBPhrase*) utarray_front(&group->phrases);
+             phrase != NULL;
+             phrase = (PYMBPhrase*) utarray_next(&group->phrases, phrase)) {
+            int32_t len = strlen(phrase->Map);
+            fcitx_utils_write_int32(fo, len);
+            fwrite(phrase->Map, sizeof(char), len, fo);
+            len = strlen(phrase->Phrase);
+            fcitx_utils_write_int32(fo, len);
+            fwrite(phrase->Phrase, sizeof(char), len, fo);
+            fcitx_utils_write_int32(fo, phrase->Index);
+        }
+    }
+    fclose(fo);
+
+    fprintf(stderr, "%d phrases, %d duplicated.\n", total, dup);
+
+    free(output);
+    return 0;
+}
+
+void usage()
+{
+    puts(
+        "mergePYMB - merge system format pinyin phrase .mb files into one\n"
+        "\n"
+        "  usage: mergePYMB [OPTION] <mbfile> [<mbfile> ...]\n"
+        "\n"
+        "  -o <mbfile> output file, defaults to pyphrase.mb\n"
+        "  -h          display this help\n"
+        "\n"
+        "  The first mbfile is taken as pyphrase.mb and kept as it is. Phrases\n"
+        "  of the other files with the same pinyin and phrase as one loaded\n"
+        "  before are dropped, the same as fcitx does when it loads extra\n"
+        "  phrase files from the pinyin directory.\n"
+    );
+    exit(1);
+    return;
+}
+
+// kate: indent-mode cstyle; space-indent on; indent-width 4;
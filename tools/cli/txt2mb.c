@@ -24,6 +24,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <getopt.h>
 #ifdef HAVE_STDLIB_H
 #include <stdlib.h>
 #endif
@@ -91,6 +92,40 @@ boolean IsValidCode(char cChar)
     return false;
 }
 
+void usage()
+{
+    printf("\nUsage: txt2mb [-i] <Source File> <IM File>\n");
+    printf("\t-i\t\tWrite a table image which can be mapped directly\n\n");
+    exit(1);
+}
+
+static void WriteTableImage(FILE* fpNew, RECORD* head, uint32_t s,
+                            unsigned char iCodeLength,
+                            unsigned char iPYCodeLength,
+                            unsigned char bRule, RULE* rule)
+{
+    TableDict* tableDict = fcitx_utils_new(TableDict);
+
+    tableDict->strInputCode = strInputCode;
+    tableDict->strIgnoreChars = strIgnoreChars;
+    tableDict->iCodeLength = iCodeLength;
+    tableDict->iPYCodeLength = iPYCodeLength;
+    tableDict->bRule = bRule;
+    tableDict->rule = rule;
+    tableDict->recordHead = head;
+    tableDict->iRecordCount = s;
+
+    TableCodeIndexBuild(tableDict);
+
+    if (!TableImageWrite(tableDict, fpNew)) {
+        printf("\nCannot write target file!\n\n");
+        exit(3);
+    }
+
+    TableCodeIndexFree(tableDict);
+    free(tableDict);
+}
+
 int main(int argc, char *argv[])
 {
     FILE           *fpDict, *fpNew;
@@ -108,13 +143,25 @@ int main(int argc, char *argv[])
     unsigned char   iPYCodeLength = 0;
 
     int8_t          type;
+    boolean         image = false;
 
-    if (argc != 3) {
-        printf("\nUsage: txt2mb <Source File> <IM File>\n\n");
-        exit(1);
+    int c;
+    while ((c = getopt(argc, argv, "ih")) != -1) {
+        switch (c) {
+        case 'i':
+            image = true;
+            break;
+        case 'h':
+
+        default:
+            usage();
+        }
     }
 
-    fpDict = fopen(argv[1], "r");
+    if (optind + 2 != argc)
+        usage();
+
+    fpDict = fopen(argv[optind], "r");
 
     if (!fpDict) {
         printf("\nCannot read source file!\n\n");
@@ -485,13 +532,22 @@ int main(int argc, char *argv[])
 
     printf("\nReading %d records.\n\n", s);
 
-    fpNew = fopen(argv[2], "w");
+    fpNew = fopen(argv[optind + 1], "w");
 
     if (!fpNew) {
         printf("\nCannot create target file!\n\n");
         exit(3);
     }
 
+    if (image) {
+        WriteTableImage(fpNew, head, s, iCodeLength, iPYCodeLength, bRule, rule);
+        if (fclose(fpNew) == EOF) {
+            printf("\nCannot write target file!\n\n");
+            exit(3);
+        }
+        return 0;
+    }
+
     int8_t iInternalVersion = INTERNAL_VERSION;
 
     //写入版本号--如果第一个字为0,表示后面那个字节为版本号